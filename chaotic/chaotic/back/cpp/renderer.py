@@ -107,6 +107,15 @@ def cpp_struct_is_strict_parsing(struct: cpp_types.CppStruct) -> bool:
     return struct.strict_parsing and struct.extra_type is False
 
 
+def sax_extra_parser_type(struct: cpp_types.CppStruct) -> str:
+    if cpp_struct_is_strict_parsing(struct):
+        return 'USERVER_NAMESPACE::chaotic::sax::NoExtra'
+    elif isinstance(struct.extra_type, cpp_types.CppType):
+        return extra_cpp_parser_type(struct.extra_type)
+    else:
+        return 'USERVER_NAMESPACE::chaotic::sax::AnyExtra'
+
+
 def not_implemented(obj: Any = None) -> NoReturn:
     raise Exception(repr(obj))
 
@@ -151,6 +160,7 @@ def make_env() -> jinja2.Environment:
 
     env.globals['extra_cpp_type'] = extra_cpp_type
     env.globals['extra_cpp_parser_type'] = extra_cpp_parser_type
+    env.globals['sax_extra_parser_type'] = sax_extra_parser_type
 
     env.globals['open_namespace'] = open_namespace
     env.globals['close_namespace'] = close_namespace
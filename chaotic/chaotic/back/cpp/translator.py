@@ -27,6 +27,8 @@ class GeneratorConfig:
     )
     autodiscover_default_dict: bool = False
     strict_parsing_default: bool = True
+    # plain strings are std::string_view, short arrays are small_vector
+    view_types_default: bool = False
 
 
 @dataclasses.dataclass
@@ -39,6 +41,9 @@ class GeneratorState:
 
 NON_NAME_SYMBOL_RE = re.compile('[^_0-9a-zA-Z]')
 
+# Arrays with bigger maxItems are not kept inline in the parent by view types
+MAX_INLINE_ARRAY_ITEMS = 16
+
 
 class FormatChooser:
     def __init__(self, types: List[cpp_types.CppType]) -> None:
@@ -80,6 +85,14 @@ class FormatChooser:
                     type_,
                     f'{type_.raw_cpp_type} has JSON-specific field "extra"',
                 )
+            if (
+                    isinstance(type_, cpp_types.CppPrimitiveType)
+                    and type_.raw_cpp_type == 'std::string_view'
+            ):
+                mark_as_only_json(
+                    type_,
+                    f'{type_.raw_cpp_type} views the string of a JSON value',
+                )
             if isinstance(type_, cpp_types.CppStruct):
                 assert isinstance(type_, cpp_types.CppStruct)
 
@@ -196,6 +209,11 @@ class Generator:
             cpp_type = cpp_type.strip()
         return cpp_type or None
 
+    def _extract_view(self, schema: types.Schema) -> bool:
+        return schema.get_x_property_bool(
+            'x-usrv-cpp-view', self._config.view_types_default,
+        )
+
     def _extract_container(self, schema: types.Schema) -> str:
         container = schema.get_x_property_str(
             'x-usrv-cpp-container', 'std::vector',
@@ -404,6 +422,16 @@ class Generator:
                 f'userver::utils::StrongTypedef<{typedef_tag}, std::string>'
             )
 
+        view = self._extract_view(schema)
+        if schema.get_x_property_bool('x-usrv-cpp-view') and (
+                schema.format or user_cpp_type
+        ):
+            self._raise(
+                schema,
+                '"x-usrv-cpp-view" is supported only for the strings without '
+                '"format", "x-usrv-cpp-type" and "x-usrv-cpp-typedef-tag"',
+            )
+
         if schema.format:
             if schema.format == types.StringFormat.UUID:
                 format_cpp_type = 'boost::uuids::uuid'
@@ -439,7 +467,11 @@ class Generator:
         return cpp_types.CppPrimitiveType(
             json_schema=schema,
             nullable=schema.nullable,
-            raw_cpp_type='std::string',
+            raw_cpp_type=(
+                'std::string_view'
+                if view and not user_cpp_type
+                else 'std::string'
+            ),
             user_cpp_type=user_cpp_type,
             validators=validators,
             default=schema.default,
@@ -498,6 +530,17 @@ class Generator:
             container = user_cpp_type
             user_cpp_type = None
 
+        inline_capacity = None
+        if (
+                self._extract_view(schema)
+                and container == 'std::vector'
+                and not user_cpp_type
+                and schema.maxItems is not None
+                and 0 < schema.maxItems <= MAX_INLINE_ARRAY_ITEMS
+        ):
+            container = 'boost::container::small_vector'
+            inline_capacity = schema.maxItems
+
         return cpp_types.CppArray(
             raw_cpp_type='NOT_USED',  # _cpp_type() is overridden in array
             json_schema=schema,
@@ -508,6 +551,7 @@ class Generator:
             validators=cpp_types.CppArrayValidator(
                 minItems=schema.minItems, maxItems=schema.maxItems,
             ),
+            inline_capacity=inline_capacity,
         )
 
     def _gen_all_of(self, name: str, schema: types.AllOf) -> cpp_types.CppType:
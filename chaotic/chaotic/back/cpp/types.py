@@ -203,6 +203,9 @@ class CppType:
     def need_operator_lshift(self) -> bool:
         return True
 
+    def may_generate_sax_validator(self) -> bool:
+        return False
+
 
 def camel_to_snake_case(string: str) -> str:
     parts = string.rsplit('/', 1)
@@ -268,6 +271,7 @@ class CppPrimitiveType(CppType):
     KNOWN_X_PROPERTIES = [
         'x-usrv-cpp-type',
         'x-usrv-cpp-typedef-tag',
+        'x-usrv-cpp-view',
         'x-taxi-cpp-type',
         'x-taxi-cpp-typedef-tag',
     ]
@@ -285,6 +289,8 @@ class CppPrimitiveType(CppType):
             includes.append('cstdint')
         elif type_ in ('number', 'boolean'):
             pass
+        elif type_ == 'string' and self.raw_cpp_type == 'std::string_view':
+            includes.append('string_view')
         elif type_ == 'string':
             includes.append('string')
         else:
@@ -662,6 +668,10 @@ class CppStructField:
         else:
             return f'std::optional<{type_}>'
 
+    def is_parse_required(self) -> bool:
+        # neither missing nor null value is replaced with a default
+        return self.required and self._default() is None
+
 
 @dataclasses.dataclass
 class CppStruct(CppType):
@@ -811,6 +821,17 @@ class CppStruct(CppType):
     def need_operator_eq(self) -> bool:
         return True
 
+    def may_generate_sax_validator(self) -> bool:
+        # required fields are stored in a 64-bit mask
+        return len(self.fields) <= 64 and not self._is_default_dict()
+
+    def sax_required_fields_mask(self) -> str:
+        mask = 0
+        for num, field in enumerate(self.fields.values()):
+            if field.is_parse_required():
+                mask |= 1 << num
+        return hex(mask)
+
 
 @dataclasses.dataclass
 class CppArrayValidator:
@@ -826,10 +847,13 @@ class CppArray(CppType):
     items: CppType
     container: str
     validators: CppArrayValidator
+    # items kept inside the container, e.g. for small_vector
+    inline_capacity: Optional[int] = None
 
     KNOWN_X_PROPERTIES = [
         'x-usrv-cpp-type',
         'x-usrv-cpp-container',
+        'x-usrv-cpp-view',
         'x-taxi-cpp-type',
         'x-taxi-cpp-container',
     ]
@@ -837,6 +861,11 @@ class CppArray(CppType):
     __hash__ = CppType.__hash__
 
     def _cpp_name(self) -> str:
+        if self.inline_capacity is not None:
+            return (
+                f'{self.container}<{self.items.cpp_user_name()}, '
+                f'{self.inline_capacity}>'
+            )
         return f'{self.container}<{self.items.cpp_user_name()}>'
 
     def without_json_schema(self) -> 'CppArray':
@@ -865,7 +894,7 @@ class CppArray(CppType):
         parser_type = (
             'USERVER_NAMESPACE::chaotic::Array'
             f'<{self.items.parser_type(ns, name)}, '
-            f'{self.container}<{self.items.cpp_user_name()}>{validators}>'
+            f'{self._cpp_name()}{validators}>'
         )
         user_cpp_type = self.user_cpp_type
         if user_cpp_type:
@@ -85,6 +85,14 @@ def parse_args() -> argparse.Namespace:
         action='store_true',
         help='Generate JSON serializers for generated types',
     )
+    parser.add_argument(
+        '--view-types',
+        action='store_true',
+        help=(
+            'Generate read-only types viewing the parsed JSON: strings are '
+            'std::string_view, short bounded arrays are small_vector'
+        ),
+    )
 
     parser.add_argument(
         '-o',
@@ -256,6 +264,7 @@ def main() -> None:
             include_dirs=args.include_dir or [],
             namespaces={file: '' for file in args.file},
             infile_to_name_func=cpp_name_func,
+            view_types_default=args.view_types,
         ),
     )
     types = gen.generate_types(schemas, external_schemas={})
@@ -91,6 +91,47 @@ AllOf Parse(USERVER_NAMESPACE::formats::json::Value json,
 /* Parse(USERVER_NAMESPACE::yaml_config::Value, To<ns::AllOf>) was not
  * generated: ns::AllOf@Foo__P0 has JSON-specific field "extra" */
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__AllOf__Foo__P0_SaxFieldIndices = [](auto selector) {
+      return selector().template Type<std::string_view, std::size_t>().Case(
+          "foo", 0);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::AllOf::Foo__P0>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__AllOf__Foo__P0_SaxFieldIndices, 0x0,
+      USERVER_NAMESPACE::chaotic::sax::AnyExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>>();
+}
+
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__AllOf__Foo__P1_SaxFieldIndices = [](auto selector) {
+      return selector().template Type<std::string_view, std::size_t>().Case(
+          "bar", 0);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::AllOf::Foo__P1>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__AllOf__Foo__P1_SaxFieldIndices, 0x0,
+      USERVER_NAMESPACE::chaotic::sax::AnyExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>>();
+}
+
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__AllOf_SaxFieldIndices = [](auto selector) {
+      return selector().template Type<std::string_view, std::size_t>().Case(
+          "foo", 0);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::AllOf>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__AllOf_SaxFieldIndices, 0x0, USERVER_NAMESPACE::chaotic::sax::NoExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<ns::AllOf::Foo>>>>();
+}
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     [[maybe_unused]] const ns::AllOf::Foo__P0& value,
     USERVER_NAMESPACE::formats::serialize::To<
@@ -150,4 +191,54 @@ USERVER_NAMESPACE::formats::json::Value Serialize(
   return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::AllOf::Foo__P0& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.foo) {
+    sw.Key("foo");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::Primitive<std::string>{*value.foo}, sw);
+  }
+
+  for (const auto& [field_key, field_value] :
+       USERVER_NAMESPACE::formats::common::Items(value.extra)) {
+    if (kns__AllOf__Foo__P0_PropertiesNames.Contains(field_key)) {
+      continue;
+    }
+    sw.Key(field_key);
+    sw.WriteValue(field_value);
+  }
+}
+
+void WriteToStream([[maybe_unused]] const ns::AllOf::Foo__P1& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.bar) {
+    sw.Key("bar");
+    WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<int>{*value.bar}, sw);
+  }
+
+  for (const auto& [field_key, field_value] :
+       USERVER_NAMESPACE::formats::common::Items(value.extra)) {
+    if (kns__AllOf__Foo__P1_PropertiesNames.Contains(field_key)) {
+      continue;
+    }
+    sw.Key(field_key);
+    sw.WriteValue(field_value);
+  }
+}
+
+void WriteToStream([[maybe_unused]] const ns::AllOf& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.foo) {
+    sw.Key("foo");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::Primitive<ns::AllOf::Foo>{*value.foo}, sw);
+  }
+}
+
 }  // namespace ns
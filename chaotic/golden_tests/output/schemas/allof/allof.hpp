@@ -77,16 +77,31 @@ AllOf Parse(USERVER_NAMESPACE::formats::json::Value json,
 /* Parse(USERVER_NAMESPACE::yaml_config::Value, To<ns::AllOf>) was not
  * generated: ns::AllOf@Foo__P0 has JSON-specific field "extra" */
 
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::AllOf::Foo__P0>);
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::AllOf::Foo__P1>);
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::AllOf>);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::AllOf::Foo__P0& value,
     USERVER_NAMESPACE::formats::serialize::To<
         USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::AllOf::Foo__P0& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::AllOf::Foo__P1& value,
     USERVER_NAMESPACE::formats::serialize::To<
         USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::AllOf::Foo__P1& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::AllOf::Foo& value, USERVER_NAMESPACE::formats::serialize::To<
                                      USERVER_NAMESPACE::formats::json::Value>);
@@ -95,4 +110,7 @@ USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::AllOf& value, USERVER_NAMESPACE::formats::serialize::To<
                                 USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::AllOf& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
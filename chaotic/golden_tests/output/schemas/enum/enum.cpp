@@ -73,6 +73,19 @@ ns::Enum::Foo Parse(std::string_view value,
   return FromString(value, to);
 }
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__Enum_SaxFieldIndices = [](auto selector) {
+      return selector().template Type<std::string_view, std::size_t>().Case(
+          "foo", 0);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::Enum>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__Enum_SaxFieldIndices, 0x0, USERVER_NAMESPACE::chaotic::sax::NoExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<ns::Enum::Foo>>>>();
+}
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::Enum::Foo& value, USERVER_NAMESPACE::formats::serialize::To<
                                     USERVER_NAMESPACE::formats::json::Value>) {
@@ -95,6 +108,27 @@ USERVER_NAMESPACE::formats::json::Value Serialize(
   return vb.ExtractValue();
 }
 
+void WriteToStream(const ns::Enum::Foo& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  const auto result = kns__Enum__Foo_Mapping.TryFindByFirst(value);
+  if (result.has_value()) {
+    sw.WriteString(*result);
+    return;
+  }
+  throw std::runtime_error("Bad enum value");
+}
+
+void WriteToStream([[maybe_unused]] const ns::Enum& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.foo) {
+    sw.Key("foo");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::Primitive<ns::Enum::Foo>{*value.foo}, sw);
+  }
+}
+
 std::string ToString(ns::Enum::Foo value) {
   const auto result = kns__Enum__Foo_Mapping.TryFindByFirst(value);
   if (result.has_value()) {
@@ -62,14 +62,23 @@ Enum::Foo FromString(std::string_view value,
 Enum::Foo Parse(std::string_view value,
                 USERVER_NAMESPACE::formats::parse::To<ns::Enum::Foo>);
 
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::Enum>);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::Enum::Foo& value, USERVER_NAMESPACE::formats::serialize::To<
                                     USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::Enum::Foo& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::Enum& value, USERVER_NAMESPACE::formats::serialize::To<
                                USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::Enum& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 std::string ToString(ns::Enum::Foo value);
 
 }  // namespace ns
@@ -37,6 +37,19 @@ Int Parse(USERVER_NAMESPACE::yaml_config::Value json,
   return Parse<USERVER_NAMESPACE::yaml_config::Value>(json, to);
 }
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__Int_SaxFieldIndices = [](auto selector) {
+      return selector().template Type<std::string_view, std::size_t>().Case(
+          "foo", 0);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::Int>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__Int_SaxFieldIndices, 0x0, USERVER_NAMESPACE::chaotic::sax::NoExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>>();
+}
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     [[maybe_unused]] const ns::Int& value,
     USERVER_NAMESPACE::formats::serialize::To<
@@ -51,4 +64,14 @@ USERVER_NAMESPACE::formats::json::Value Serialize(
   return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::Int& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.foo) {
+    sw.Key("foo");
+    WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<int>{*value.foo}, sw);
+  }
+}
+
 }  // namespace ns
@@ -32,8 +32,14 @@ Int Parse(USERVER_NAMESPACE::formats::yaml::Value json,
 Int Parse(USERVER_NAMESPACE::yaml_config::Value json,
           USERVER_NAMESPACE::formats::parse::To<ns::Int>);
 
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::Int>);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::Int& value, USERVER_NAMESPACE::formats::serialize::To<
                               USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::Int& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
@@ -39,6 +39,21 @@ OneOf Parse(USERVER_NAMESPACE::yaml_config::Value json,
   return Parse<USERVER_NAMESPACE::yaml_config::Value>(json, to);
 }
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__OneOf_SaxFieldIndices = [](auto selector) {
+      return selector().template Type<std::string_view, std::size_t>().Case(
+          "foo", 0);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::OneOf>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__OneOf_SaxFieldIndices, 0x0, USERVER_NAMESPACE::chaotic::sax::NoExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::Variant<
+          USERVER_NAMESPACE::chaotic::Primitive<int>,
+          USERVER_NAMESPACE::chaotic::Primitive<std::string>>>>>();
+}
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     [[maybe_unused]] const ns::OneOf& value,
     USERVER_NAMESPACE::formats::serialize::To<
@@ -55,4 +70,18 @@ USERVER_NAMESPACE::formats::json::Value Serialize(
   return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::OneOf& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.foo) {
+    sw.Key("foo");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::Variant<
+            USERVER_NAMESPACE::chaotic::Primitive<int>,
+            USERVER_NAMESPACE::chaotic::Primitive<std::string>>{*value.foo},
+        sw);
+  }
+}
+
 }  // namespace ns
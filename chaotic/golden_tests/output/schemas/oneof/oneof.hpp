@@ -37,8 +37,14 @@ OneOf Parse(USERVER_NAMESPACE::formats::yaml::Value json,
 OneOf Parse(USERVER_NAMESPACE::yaml_config::Value json,
             USERVER_NAMESPACE::formats::parse::To<ns::OneOf>);
 
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::OneOf>);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::OneOf& value, USERVER_NAMESPACE::formats::serialize::To<
                                 USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::OneOf& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
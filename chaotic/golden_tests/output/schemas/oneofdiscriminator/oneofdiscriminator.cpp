@@ -38,6 +38,22 @@ A Parse(USERVER_NAMESPACE::formats::json::Value json,
 /* Parse(USERVER_NAMESPACE::yaml_config::Value, To<ns::A>) was not generated:
  * ns::A has JSON-specific field "extra" */
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__A_SaxFieldIndices = [](auto selector) {
+      return selector()
+          .template Type<std::string_view, std::size_t>()
+          .Case("type", 0)
+          .Case("a_prop", 1);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::A>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__A_SaxFieldIndices, 0x0, USERVER_NAMESPACE::chaotic::sax::AnyExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>>();
+}
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     [[maybe_unused]] const ns::A& value,
     USERVER_NAMESPACE::formats::serialize::To<
@@ -56,6 +72,32 @@ USERVER_NAMESPACE::formats::json::Value Serialize(
   return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::A& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.type) {
+    sw.Key("type");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::Primitive<std::string>{*value.type}, sw);
+  }
+
+  if (value.a_prop) {
+    sw.Key("a_prop");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::Primitive<int>{*value.a_prop}, sw);
+  }
+
+  for (const auto& [field_key, field_value] :
+       USERVER_NAMESPACE::formats::common::Items(value.extra)) {
+    if (kns__A_PropertiesNames.Contains(field_key)) {
+      continue;
+    }
+    sw.Key(field_key);
+    sw.WriteValue(field_value);
+  }
+}
+
 bool operator==(const ns::B& lhs, const ns::B& rhs) {
   return lhs.type == rhs.type && lhs.b_prop == rhs.b_prop &&
          lhs.extra == rhs.extra &&
@@ -80,6 +122,22 @@ B Parse(USERVER_NAMESPACE::formats::json::Value json,
 /* Parse(USERVER_NAMESPACE::yaml_config::Value, To<ns::B>) was not generated:
  * ns::B has JSON-specific field "extra" */
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__B_SaxFieldIndices = [](auto selector) {
+      return selector()
+          .template Type<std::string_view, std::size_t>()
+          .Case("type", 0)
+          .Case("b_prop", 1);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::B>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__B_SaxFieldIndices, 0x0, USERVER_NAMESPACE::chaotic::sax::AnyExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>>();
+}
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     [[maybe_unused]] const ns::B& value,
     USERVER_NAMESPACE::formats::serialize::To<
@@ -98,6 +156,32 @@ USERVER_NAMESPACE::formats::json::Value Serialize(
   return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::B& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.type) {
+    sw.Key("type");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::Primitive<std::string>{*value.type}, sw);
+  }
+
+  if (value.b_prop) {
+    sw.Key("b_prop");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::Primitive<int>{*value.b_prop}, sw);
+  }
+
+  for (const auto& [field_key, field_value] :
+       USERVER_NAMESPACE::formats::common::Items(value.extra)) {
+    if (kns__B_PropertiesNames.Contains(field_key)) {
+      continue;
+    }
+    sw.Key(field_key);
+    sw.WriteValue(field_value);
+  }
+}
+
 bool operator==(const ns::OneOfDiscriminator& lhs,
                 const ns::OneOfDiscriminator& rhs) {
   return lhs.foo == rhs.foo && true;
@@ -123,6 +207,24 @@ OneOfDiscriminator Parse(
 /* Parse(USERVER_NAMESPACE::yaml_config::Value, To<ns::OneOfDiscriminator>) was
  * not generated: ns::OneOfDiscriminator@Foo has JSON-specific field "extra" */
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__OneOfDiscriminator_SaxFieldIndices = [](auto selector) {
+      return selector().template Type<std::string_view, std::size_t>().Case(
+          "foo", 0);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(
+    USERVER_NAMESPACE::formats::parse::To<ns::OneOfDiscriminator>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__OneOfDiscriminator_SaxFieldIndices, 0x0,
+      USERVER_NAMESPACE::chaotic::sax::NoExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::OneOfWithDiscriminator<
+          &ns::impl::kns__OneOfDiscriminator__Foo_Settings,
+          USERVER_NAMESPACE::chaotic::Primitive<ns::A>,
+          USERVER_NAMESPACE::chaotic::Primitive<ns::B>>>>>();
+}
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     [[maybe_unused]] const ns::OneOfDiscriminator& value,
     USERVER_NAMESPACE::formats::serialize::To<
@@ -140,4 +242,19 @@ USERVER_NAMESPACE::formats::json::Value Serialize(
   return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::OneOfDiscriminator& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.foo) {
+    sw.Key("foo");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::OneOfWithDiscriminator<
+            &ns::impl::kns__OneOfDiscriminator__Foo_Settings,
+            USERVER_NAMESPACE::chaotic::Primitive<ns::A>,
+            USERVER_NAMESPACE::chaotic::Primitive<ns::B>>{*value.foo},
+        sw);
+  }
+}
+
 }  // namespace ns
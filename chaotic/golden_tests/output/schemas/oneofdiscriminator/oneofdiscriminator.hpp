@@ -38,10 +38,16 @@ A Parse(USERVER_NAMESPACE::formats::json::Value json,
 /* Parse(USERVER_NAMESPACE::yaml_config::Value, To<ns::A>) was not generated:
  * ns::A has JSON-specific field "extra" */
 
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::A>);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::A& value, USERVER_NAMESPACE::formats::serialize::To<
                             USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::A& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
 
 namespace ns {
@@ -71,10 +77,16 @@ B Parse(USERVER_NAMESPACE::formats::json::Value json,
 /* Parse(USERVER_NAMESPACE::yaml_config::Value, To<ns::B>) was not generated:
  * ns::B has JSON-specific field "extra" */
 
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::B>);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::B& value, USERVER_NAMESPACE::formats::serialize::To<
                             USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::B& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
 
 namespace ns {
@@ -116,9 +128,15 @@ OneOfDiscriminator Parse(
 /* Parse(USERVER_NAMESPACE::yaml_config::Value, To<ns::OneOfDiscriminator>) was
  * not generated: ns::OneOfDiscriminator@Foo has JSON-specific field "extra" */
 
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::OneOfDiscriminator>);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::OneOfDiscriminator& value,
     USERVER_NAMESPACE::formats::serialize::To<
         USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::OneOfDiscriminator& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
@@ -37,6 +37,20 @@ String Parse(USERVER_NAMESPACE::yaml_config::Value json,
   return Parse<USERVER_NAMESPACE::yaml_config::Value>(json, to);
 }
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap
+    kns__String_SaxFieldIndices = [](auto selector) {
+      return selector().template Type<std::string_view, std::size_t>().Case(
+          "foo", 0);
+    };
+
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::String>) {
+  return std::make_unique<USERVER_NAMESPACE::chaotic::sax::ObjectValidator<
+      kns__String_SaxFieldIndices, 0x0,
+      USERVER_NAMESPACE::chaotic::sax::NoExtra,
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>>();
+}
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     [[maybe_unused]] const ns::String& value,
     USERVER_NAMESPACE::formats::serialize::To<
@@ -51,4 +65,15 @@ USERVER_NAMESPACE::formats::json::Value Serialize(
   return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::String& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+  USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+  if (value.foo) {
+    sw.Key("foo");
+    WriteToStream(
+        USERVER_NAMESPACE::chaotic::Primitive<std::string>{*value.foo}, sw);
+  }
+}
+
 }  // namespace ns
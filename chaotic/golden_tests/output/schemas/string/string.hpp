@@ -32,8 +32,14 @@ String Parse(USERVER_NAMESPACE::formats::yaml::Value json,
 String Parse(USERVER_NAMESPACE::yaml_config::Value json,
              USERVER_NAMESPACE::formats::parse::To<ns::String>);
 
+std::unique_ptr<USERVER_NAMESPACE::chaotic::sax::ValidatorBase>
+MakeSaxValidator(USERVER_NAMESPACE::formats::parse::To<ns::String>);
+
 USERVER_NAMESPACE::formats::json::Value Serialize(
     const ns::String& value, USERVER_NAMESPACE::formats::serialize::To<
                                  USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::String& value,
+                   USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
@@ -0,0 +1,3 @@
+#pragma once
+
+#include <boost/container/small_vector.hpp>
@@ -0,0 +1,517 @@
+#pragma once
+
+/// @file userver/chaotic/sax_validator.hpp
+/// @brief Validation of JSON against the chaotic types while it is parsed
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/chaotic/array.hpp>
+#include <userver/chaotic/primitive.hpp>
+#include <userver/chaotic/ref.hpp>
+#include <userver/chaotic/sax_validator_fwd.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Validators that check JSON against the schema of a chaotic type
+/// token by token, without building formats::json::Value.
+///
+/// chaotic generates a validator for each object type, the type checks,
+/// enums and the bounds of the fields are checked as soon as the value is
+/// read, so invalid input is rejected before the rest of it is parsed.
+/// The subschemas without a SAX validator (allOf, oneOf, x-usrv-cpp-type,
+/// integer enums) are parsed into a formats::json::Value of the subtree and
+/// checked by the DOM parser.
+namespace chaotic::sax {
+
+/// additionalProperties are forbidden
+struct NoExtra final {};
+
+/// additionalProperties are allowed and not validated
+struct AnyExtra final {};
+
+namespace impl {
+
+template <typename T>
+using HasSaxValidator = decltype(MakeSaxValidator(formats::parse::To<T>{}));
+
+template <typename T>
+using HasFromString = decltype(FromString(std::declval<std::string_view>(),
+                                          formats::parse::To<T>{}));
+
+template <typename T>
+struct TypeTag final {
+  using Type = T;
+};
+
+template <typename Int, typename From>
+constexpr bool IsInRange(From value) noexcept {
+  using Limits = std::numeric_limits<Int>;
+  if constexpr (std::is_signed_v<From> && std::is_signed_v<Int>) {
+    return value >= Limits::min() && value <= Limits::max();
+  } else if constexpr (!std::is_signed_v<From> && !std::is_signed_v<Int>) {
+    return value <= Limits::max();
+  } else if constexpr (std::is_signed_v<From>) {
+    return value >= 0 &&
+           static_cast<std::make_unsigned_t<From>>(value) <= Limits::max();
+  } else {
+    return value <= static_cast<std::make_unsigned_t<Int>>(Limits::max());
+  }
+}
+
+// Same as formats::json::Value: a double with zero fractional part is
+// an integer
+template <typename Int>
+std::optional<Int> DoubleToInteger(double value) noexcept {
+  if (std::trunc(value) != value) return std::nullopt;
+  if constexpr (sizeof(Int) >= sizeof(double)) {
+    constexpr auto kMaxIntDouble = static_cast<double>(
+        std::int64_t{1} << std::numeric_limits<double>::digits);
+    if (!(value > -kMaxIntDouble && value < kMaxIntDouble)) return std::nullopt;
+    if (std::is_unsigned_v<Int> && value < 0) return std::nullopt;
+  } else if (!(value >= std::numeric_limits<Int>::min() &&
+               value <= std::numeric_limits<Int>::max())) {
+    return std::nullopt;
+  }
+  return static_cast<Int>(value);
+}
+
+// Argument for MinItems/MaxItems
+struct ArraySize final {
+  std::size_t size() const noexcept { return value; }
+
+  std::size_t value;
+};
+
+// Accepts any JSON value
+class SkipValidator final : public ValidatorBase {
+ public:
+  void Reset() override { depth_ = 0; }
+
+ private:
+  void Null() override;
+  void Bool(bool) override;
+  void Int64(std::int64_t) override;
+  void Uint64(std::uint64_t) override;
+  void Double(double) override;
+  void String(std::string_view) override;
+  void StartObject() override;
+  void Key(std::string_view) override;
+  void EndObject() override;
+  void StartArray() override;
+  void EndArray() override;
+
+  std::string GetPathItem() const override { return {}; }
+  std::string Expected() const override;
+
+  void OnValueEnd();
+
+  std::size_t depth_{0};
+};
+
+}  // namespace impl
+
+template <typename T, typename = void>
+struct ValidatorTraits;
+
+/// Validator for the chaotic parser type `T`, e.g.
+/// `chaotic::Primitive<int, chaotic::Minimum<kMin>>`, or for a generated type
+template <typename T>
+using ValidatorFor = typename ValidatorTraits<T>::Type;
+
+/// @brief Checks a value by parsing its subtree into formats::json::Value
+/// and calling `As<T>()`.
+template <typename T>
+class DomValidator final
+    : private formats::json::parser::Subscriber<formats::json::Value> {
+ public:
+  void Reset() {
+    // JsonValueParser gives away its document with the result and cannot be
+    // reused
+    parser_ = std::make_unique<formats::json::parser::JsonValueParser>();
+    parser_->Subscribe(*this);
+  }
+
+  formats::json::parser::JsonValueParser& GetParser() {
+    UASSERT(parser_);
+    return *parser_;
+  }
+
+ private:
+  void OnSend(formats::json::Value&& value) override {
+    [[maybe_unused]] const auto result = value.As<T>();
+  }
+
+  std::unique_ptr<formats::json::parser::JsonValueParser> parser_;
+};
+
+/// @brief Validator of a generated type, created on first use to allow
+/// recursive types
+template <typename T>
+class ErasedValidator final {
+ public:
+  void Reset() {
+    if (!validator_) validator_ = MakeSaxValidator(formats::parse::To<T>{});
+    validator_->Reset();
+  }
+
+  ValidatorBase& GetParser() {
+    UASSERT(validator_);
+    return *validator_;
+  }
+
+ private:
+  std::unique_ptr<ValidatorBase> validator_;
+};
+
+class BooleanValidator final : public ValidatorBase {
+ private:
+  void Bool(bool) override { SetResult(Valid{}); }
+
+  std::string GetPathItem() const override { return {}; }
+  std::string Expected() const override { return "bool"; }
+};
+
+template <typename Int, typename... Validators>
+class IntegerValidator final : public ValidatorBase {
+ private:
+  void Int64(std::int64_t value) override { Check(value); }
+  void Uint64(std::uint64_t value) override { Check(value); }
+
+  void Double(double value) override {
+    const auto integer = impl::DoubleToInteger<Int>(value);
+    if (!integer) Throw("double");
+    Finish(*integer);
+  }
+
+  template <typename From>
+  void Check(From value) {
+    if (!impl::IsInRange<Int>(value)) {
+      Throw(fmt::format("out of range integer {}", value));
+    }
+    Finish(static_cast<Int>(value));
+  }
+
+  void Finish([[maybe_unused]] Int value) {
+    (Validators::Validate(value), ...);
+    SetResult(Valid{});
+  }
+
+  std::string GetPathItem() const override { return {}; }
+  std::string Expected() const override { return "integer"; }
+};
+
+template <typename Float, typename... Validators>
+class NumberValidator final : public ValidatorBase {
+ private:
+  void Int64(std::int64_t value) override { Finish(value); }
+  void Uint64(std::uint64_t value) override { Finish(value); }
+  void Double(double value) override { Finish(value); }
+
+  template <typename From>
+  void Finish(From value) {
+    [[maybe_unused]] const auto number = static_cast<Float>(value);
+    (Validators::Validate(number), ...);
+    SetResult(Valid{});
+  }
+
+  std::string GetPathItem() const override { return {}; }
+  std::string Expected() const override { return "number"; }
+};
+
+template <typename... Validators>
+class StringValidator final : public ValidatorBase {
+ private:
+  void String([[maybe_unused]] std::string_view value) override {
+    (Validators::Validate(value), ...);
+    SetResult(Valid{});
+  }
+
+  std::string GetPathItem() const override { return {}; }
+  std::string Expected() const override { return "string"; }
+};
+
+/// Validator of a string enum, looks the value up in the generated mapping
+template <typename Enum>
+class EnumValidator final : public ValidatorBase {
+ private:
+  void String(std::string_view value) override {
+    [[maybe_unused]] const auto result =
+        FromString(value, formats::parse::To<Enum>{});
+    SetResult(Valid{});
+  }
+
+  std::string GetPathItem() const override { return {}; }
+  std::string Expected() const override { return "string"; }
+};
+
+template <typename ItemValidator, typename... Validators>
+class ArrayValidator final : public ValidatorBase {
+ public:
+  void Reset() override {
+    size_ = 0;
+    inside_ = false;
+  }
+
+ private:
+  void StartArray() override {
+    if (!inside_) {
+      inside_ = true;
+    } else {
+      PushItem("array").StartArray();
+    }
+  }
+
+  void EndArray() override {
+    UASSERT(inside_);
+    inside_ = false;
+    (Validators::Validate(impl::ArraySize{size_}), ...);
+    SetResult(Valid{});
+  }
+
+  void Null() override { PushItem("null").Null(); }
+  void Bool(bool value) override { PushItem("bool").Bool(value); }
+  void Int64(std::int64_t value) override { PushItem("integer").Int64(value); }
+  void Uint64(std::uint64_t value) override {
+    PushItem("integer").Uint64(value);
+  }
+  void Double(double value) override { PushItem("double").Double(value); }
+  void String(std::string_view value) override {
+    PushItem("string").String(value);
+  }
+  void StartObject() override { PushItem("object").StartObject(); }
+
+  formats::json::parser::BaseParser& PushItem(std::string_view what) {
+    if (!inside_) Throw(std::string{what});
+
+    item_.Reset();
+    auto& parser = item_.GetParser();
+    parser_state_->PushParser(parser);
+    ++size_;
+    return parser;
+  }
+
+  std::string GetPathItem() const override {
+    return inside_ && size_ ? formats::common::GetIndexString(size_ - 1)
+                            : std::string{};
+  }
+  std::string Expected() const override { return "array"; }
+
+  ItemValidator item_;
+  std::size_t size_{0};
+  bool inside_{false};
+};
+
+/// @brief Base class of the generated object validators.
+///
+/// Up to 64 fields are supported, the required ones are set in a bit mask.
+/// An optional field accepts `null`, a `null` object is accepted if there are
+/// no required fields, as in the DOM parsers.
+class ObjectValidatorBase : public ValidatorBase {
+ public:
+  void Reset() override;
+
+ protected:
+  enum class ExtraPolicy {
+    kForbid,
+    kSkip,
+    kValidate,
+  };
+
+  ObjectValidatorBase(std::uint64_t required_fields,
+                      ExtraPolicy extra_policy) noexcept;
+
+  virtual std::optional<std::size_t> FindField(std::string_view name) const = 0;
+  virtual std::string_view GetFieldName(std::size_t index) const = 0;
+
+  // Resets the validator of a field and returns its parser
+  virtual formats::json::parser::BaseParser& ResetField(std::size_t index) = 0;
+  virtual formats::json::parser::BaseParser& ResetExtraField() = 0;
+
+ private:
+  void Null() override;
+  void Bool(bool value) override;
+  void Int64(std::int64_t value) override;
+  void Uint64(std::uint64_t value) override;
+  void Double(double value) override;
+  void String(std::string_view value) override;
+  void StartObject() override;
+  void Key(std::string_view key) override;
+  void EndObject() override;
+  void StartArray() override;
+
+  std::string GetPathItem() const override { return key_; }
+  std::string Expected() const override { return "object"; }
+
+  formats::json::parser::BaseParser& PushValue(std::string_view what);
+
+  const std::uint64_t required_fields_;
+  const ExtraPolicy extra_policy_;
+  std::uint64_t seen_fields_{0};
+  std::optional<std::size_t> field_;
+  std::string key_;
+  impl::SkipValidator skip_;
+  bool inside_{false};
+};
+
+/// @brief Validator of an object, chaotic generates one per type.
+///
+/// @tparam kFieldIndices utils::TrivialBiMap of field names to indices
+/// @tparam kRequiredFields bit mask of the required fields
+/// @tparam Extra sax::NoExtra, sax::AnyExtra or the parser type of
+/// additionalProperties
+/// @tparam Fields parser types of the fields in the order of indices
+template <const auto& kFieldIndices, std::uint64_t kRequiredFields,
+          typename Extra, typename... Fields>
+class ObjectValidator final : public ObjectValidatorBase {
+  static_assert(sizeof...(Fields) <= 64, "Too many fields for a bit mask");
+
+ public:
+  ObjectValidator()
+      : ObjectValidatorBase(kRequiredFields, GetExtraPolicy()) {}
+
+ private:
+  struct NoValidator final {};
+
+  using ExtraValidator = std::conditional_t<
+      std::is_same_v<Extra, NoExtra> || std::is_same_v<Extra, AnyExtra>,
+      NoValidator, ValidatorFor<Extra>>;
+
+  static constexpr ExtraPolicy GetExtraPolicy() noexcept {
+    if constexpr (std::is_same_v<Extra, NoExtra>) {
+      return ExtraPolicy::kForbid;
+    } else if constexpr (std::is_same_v<Extra, AnyExtra>) {
+      return ExtraPolicy::kSkip;
+    } else {
+      return ExtraPolicy::kValidate;
+    }
+  }
+
+  std::optional<std::size_t> FindField(std::string_view name) const override {
+    return kFieldIndices.TryFindByFirst(name);
+  }
+
+  std::string_view GetFieldName(std::size_t index) const override {
+    return kFieldIndices.TryFindBySecond(index).value_or(std::string_view{});
+  }
+
+  formats::json::parser::BaseParser& ResetField(std::size_t index) override {
+    return ResetField(index, std::index_sequence_for<Fields...>{});
+  }
+
+  formats::json::parser::BaseParser& ResetExtraField() override {
+    if constexpr (GetExtraPolicy() == ExtraPolicy::kValidate) {
+      extra_.Reset();
+      return extra_.GetParser();
+    } else {
+      UINVARIANT(false, "additionalProperties are not validated");
+    }
+  }
+
+  template <std::size_t... Indices>
+  formats::json::parser::BaseParser& ResetField(
+      std::size_t index, std::index_sequence<Indices...>) {
+    formats::json::parser::BaseParser* parser = nullptr;
+    (void)((Indices == index
+                ? (std::get<Indices>(fields_).Reset(),
+                   parser = &std::get<Indices>(fields_).GetParser(), true)
+                : false) ||
+           ...);
+    UINVARIANT(parser, "Unknown field index");
+    return *parser;
+  }
+
+  std::tuple<ValidatorFor<Fields>...> fields_;
+  ExtraValidator extra_;
+};
+
+/// @brief Checks `json` against the schema of `T` without building
+/// formats::json::Value.
+/// @throws formats::json::parser::ParseError with the path of the first
+/// invalid value
+template <typename T>
+void Validate(std::string_view json) {
+  ValidatorFor<T> validator;
+  validator.Reset();
+
+  formats::json::parser::ParserState state;
+  state.PushParser(validator.GetParser());
+  state.ProcessInput(json);
+}
+
+template <typename T, typename>
+struct ValidatorTraits final {
+  using Type =
+      std::conditional_t<meta::kIsDetected<impl::HasSaxValidator, T>,
+                         ErasedValidator<T>, DomValidator<T>>;
+};
+
+template <typename T>
+struct ValidatorTraits<std::optional<T>> final {
+  using Type = ValidatorFor<T>;
+};
+
+template <typename T>
+struct ValidatorTraits<Ref<T>> final {
+  using Type = ValidatorFor<T>;
+};
+
+template <typename ItemType, typename Item, typename... Validators>
+struct ValidatorTraits<Array<ItemType, std::vector<Item>, Validators...>>
+    final {
+  using Type = ArrayValidator<ValidatorFor<ItemType>, Validators...>;
+};
+
+namespace impl {
+
+template <typename RawType, typename... Validators>
+auto SelectPrimitiveValidator() {
+  if constexpr (std::is_same_v<RawType, bool> && !sizeof...(Validators)) {
+    return TypeTag<BooleanValidator>{};
+  } else if constexpr (std::is_integral_v<RawType> &&
+                       !std::is_same_v<RawType, bool>) {
+    return TypeTag<IntegerValidator<RawType, Validators...>>{};
+  } else if constexpr (std::is_floating_point_v<RawType>) {
+    return TypeTag<NumberValidator<RawType, Validators...>>{};
+  } else if constexpr (std::is_same_v<RawType, std::string> ||
+                       std::is_same_v<RawType, std::string_view>) {
+    return TypeTag<StringValidator<Validators...>>{};
+  } else if constexpr (std::is_enum_v<RawType> &&
+                       meta::kIsDetected<HasFromString, RawType> &&
+                       !sizeof...(Validators)) {
+    return TypeTag<EnumValidator<RawType>>{};
+  } else if constexpr (!sizeof...(Validators)) {
+    return TypeTag<ValidatorFor<RawType>>{};
+  } else {
+    return TypeTag<DomValidator<Primitive<RawType, Validators...>>>{};
+  }
+}
+
+}  // namespace impl
+
+template <typename RawType, typename... Validators>
+struct ValidatorTraits<Primitive<RawType, Validators...>> final {
+  using Type = typename decltype(impl::SelectPrimitiveValidator<
+                                 RawType, Validators...>())::Type;
+};
+
+}  // namespace chaotic::sax
+
+USERVER_NAMESPACE_END
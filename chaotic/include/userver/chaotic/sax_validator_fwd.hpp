@@ -0,0 +1,25 @@
+#pragma once
+
+/// @file userver/chaotic/sax_validator_fwd.hpp
+/// @brief Forward declarations for userver/chaotic/sax_validator.hpp
+
+#include <memory>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+template <typename T>
+class TypedParser;
+}  // namespace formats::json::parser
+
+namespace chaotic::sax {
+
+/// The result of a successful validation, carries no data
+struct Valid final {};
+
+/// Base class of the validators of the generated types
+using ValidatorBase = formats::json::parser::TypedParser<Valid>;
+
+}  // namespace chaotic::sax
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <userver/chaotic/sax_validator_fwd.hpp>
+#include <userver/formats/json/string_builder_fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
 #include <userver/formats/parse/to.hpp>
 #include <userver/formats/yaml_fwd.hpp>
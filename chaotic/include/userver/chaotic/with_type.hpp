@@ -36,6 +36,14 @@ Value Serialize(const WithType<RawType, UserType>& ps,
       .ExtractValue();
 }
 
+template <typename RawType, typename UserType, typename StringBuilder>
+void WriteToStream(const WithType<RawType, UserType>& ps, StringBuilder& sw) {
+  WriteToStream(
+      RawType{Convert(ps.value,
+                      convert::To<std::decay_t<decltype(RawType::value)>>())},
+      sw);
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/chaotic/sax_validator.hpp>
+#include <userver/formats/json/parser/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+#include <schemas/int_minmax.hpp>
+#include <schemas/recursion.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using formats::json::parser::ParseError;
+
+TEST(SaxValidator, MinMax) {
+  EXPECT_NO_THROW(chaotic::sax::Validate<ns::IntegerObject>(
+      R"({"foo": 2, "bar": "abc", "zoo": [1, 2]})"));
+  EXPECT_NO_THROW(chaotic::sax::Validate<ns::IntegerObject>("{}"));
+
+  UEXPECT_THROW(chaotic::sax::Validate<ns::IntegerObject>(R"({"foo": 1})"),
+                ParseError);
+  UEXPECT_THROW(chaotic::sax::Validate<ns::IntegerObject>(R"({"bar": ""})"),
+                ParseError);
+  UEXPECT_THROW(chaotic::sax::Validate<ns::IntegerObject>(
+                    R"({"zoo": [1, 2, 3, 4, 5, 6]})"),
+                ParseError);
+  UEXPECT_THROW(chaotic::sax::Validate<ns::IntegerObject>(R"({"foo": "1"})"),
+                ParseError);
+}
+
+TEST(SaxValidator, Strict) {
+  UEXPECT_THROW(chaotic::sax::Validate<ns::IntegerObject>(R"({"unknown": 1})"),
+                ParseError);
+}
+
+TEST(SaxValidator, Recursion) {
+  EXPECT_NO_THROW(chaotic::sax::Validate<ns::RecursiveObject>(
+      R"({"data": "a", "next": [{"data": "b", "next": [{}]}]})"));
+  UEXPECT_THROW(chaotic::sax::Validate<ns::RecursiveObject>(
+                    R"({"next": [{"next": [{"data": 1}]}]})"),
+                ParseError);
+}
+
+TEST(SaxValidator, MatchesDom) {
+  for (const auto* json : {R"({"foo": 2.0})", R"({"foo": 2.5})", "null", "[]",
+                           R"({"foo": null})"}) {
+    bool dom_ok = true;
+    try {
+      formats::json::FromString(json).As<ns::IntegerObject>();
+    } catch (const std::exception&) {
+      dom_ok = false;
+    }
+
+    bool sax_ok = true;
+    try {
+      chaotic::sax::Validate<ns::IntegerObject>(json);
+    } catch (const ParseError&) {
+      sax_ok = false;
+    }
+    EXPECT_EQ(dom_ok, sax_ok) << json;
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <type_traits>
+
+#include <userver/chaotic/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+#include <schemas/view.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+static_assert(std::is_same_v<decltype(ns::ViewObject::name), std::string_view>);
+static_assert(
+    std::is_same_v<decltype(ns::ViewObject::tags),
+                   std::optional<boost::container::small_vector<
+                       std::string_view, 4>>>);
+static_assert(std::is_same_v<decltype(ns::ViewObject::copied),
+                             std::optional<std::string>>);
+
+TEST(View, Parse) {
+  const auto json = formats::json::FromString(
+      R"({"name": "a long enough name", "tags": ["a", "b"], "copied": "c"})");
+  const auto obj = json.As<ns::ViewObject>();
+
+  EXPECT_EQ(obj.name, "a long enough name");
+  // Points into the parsed JSON
+  EXPECT_EQ(obj.name.data(), json["name"].As<std::string_view>().data());
+  ASSERT_TRUE(obj.tags);
+  ASSERT_EQ(obj.tags->size(), 2);
+  EXPECT_EQ((*obj.tags)[0], "a");
+  EXPECT_EQ((*obj.tags)[1], "b");
+  EXPECT_EQ(obj.copied, "c");
+}
+
+TEST(View, Validators) {
+  auto json = formats::json::FromString(
+      R"({"name": "x", "tags": ["a", "b", "c", "d", "e"]})");
+  UEXPECT_THROW_MSG(
+      json.As<ns::ViewObject>(), chaotic::Error,
+      "Error at path 'tags': Too long array, maximum length=4, given=5");
+
+  json = formats::json::FromString(R"({"name": "x", "tags": ["too long"]})");
+  EXPECT_EQ(json.As<ns::ViewObject>().tags->front(), "too long");
+
+  json = formats::json::FromString(R"({"name": "x", "tags": ["too long!"]})");
+  UEXPECT_THROW_MSG(
+      json.As<ns::ViewObject>(), chaotic::Error,
+      "Error at path 'tags[0]': Too long string, maximum length=8, given=9");
+}
+
+TEST(View, Serialize) {
+  const auto json = formats::json::FromString(
+      R"({"name": "x", "tags": ["a"], "copied": "c"})");
+  const auto obj = json.As<ns::ViewObject>();
+  EXPECT_EQ(formats::json::ValueBuilder{obj}.ExtractValue(), json);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+
+#include <schemas/all_of.hpp>
+#include <schemas/extra_container.hpp>
+#include <schemas/object_single_field.hpp>
+#include <schemas/one_of.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+formats::json::Value WriteAndParse(const T& value) {
+  formats::json::StringBuilder sw;
+  WriteToStream(value, sw);
+  return formats::json::FromString(sw.GetString());
+}
+
+template <typename T>
+void CheckSameAsSerialize(const formats::json::Value& json) {
+  const auto obj = json.As<T>();
+  EXPECT_EQ(WriteAndParse(obj),
+            formats::json::ValueBuilder{obj}.ExtractValue());
+  EXPECT_EQ(WriteAndParse(obj).template As<T>(), obj);
+}
+
+}  // namespace
+
+TEST(WriteToStream, Simple) {
+  CheckSameAsSerialize<ns::SimpleObject>(
+      formats::json::MakeObject("int3", 1, "integer", 3));
+}
+
+TEST(WriteToStream, Types) {
+  CheckSameAsSerialize<ns::ObjectTypes>(formats::json::MakeObject(
+      "boolean", true, "integer", 1, "number", 1.5, "string", "foo", "object",
+      formats::json::MakeObject(), "array", formats::json::MakeArray(1, 2, 3),
+      "int-enum", 2, "string-enum", "foo"));
+}
+
+TEST(WriteToStream, ExtraContainer) {
+  CheckSameAsSerialize<ns::ObjectWithExtraType>(
+      formats::json::MakeObject("foo", "bar", "baz", "qux"));
+}
+
+TEST(WriteToStream, OneOfWithDiscriminator) {
+  CheckSameAsSerialize<ns::ObjectOneOfWithDiscriminator>(
+      formats::json::MakeObject(
+          "oneof", formats::json::MakeObject("type", "ObjectFoo", "foo", 1)));
+}
+
+TEST(WriteToStream, AllOf) {
+  CheckSameAsSerialize<ns::AllOf>(
+      formats::json::MakeObject("foo", 1, "bar", 2, "extra", "value"));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,146 @@
+#include <userver/chaotic/sax_validator.hpp>
+
+#include <stdexcept>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace chaotic::sax {
+
+namespace impl {
+
+void SkipValidator::Null() { OnValueEnd(); }
+
+void SkipValidator::Bool(bool) { OnValueEnd(); }
+
+void SkipValidator::Int64(std::int64_t) { OnValueEnd(); }
+
+void SkipValidator::Uint64(std::uint64_t) { OnValueEnd(); }
+
+void SkipValidator::Double(double) { OnValueEnd(); }
+
+void SkipValidator::String(std::string_view) { OnValueEnd(); }
+
+void SkipValidator::StartObject() { ++depth_; }
+
+void SkipValidator::Key(std::string_view) {}
+
+void SkipValidator::EndObject() {
+  UASSERT(depth_);
+  --depth_;
+  OnValueEnd();
+}
+
+void SkipValidator::StartArray() { ++depth_; }
+
+void SkipValidator::EndArray() {
+  UASSERT(depth_);
+  --depth_;
+  OnValueEnd();
+}
+
+std::string SkipValidator::Expected() const { return "anything"; }
+
+void SkipValidator::OnValueEnd() {
+  if (depth_ == 0) SetResult(Valid{});
+}
+
+}  // namespace impl
+
+ObjectValidatorBase::ObjectValidatorBase(std::uint64_t required_fields,
+                                         ExtraPolicy extra_policy) noexcept
+    : required_fields_(required_fields), extra_policy_(extra_policy) {}
+
+void ObjectValidatorBase::Reset() {
+  seen_fields_ = 0;
+  field_.reset();
+  key_.clear();
+  inside_ = false;
+}
+
+void ObjectValidatorBase::Null() {
+  if (inside_) {
+    if (field_ && !(required_fields_ & (std::uint64_t{1} << *field_))) {
+      // An optional field may be null
+      return;
+    }
+    PushValue("null").Null();
+    return;
+  }
+
+  // A null object is an empty one for the DOM parsers
+  if (required_fields_) Throw("null");
+  SetResult(Valid{});
+}
+
+void ObjectValidatorBase::Bool(bool value) { PushValue("bool").Bool(value); }
+
+void ObjectValidatorBase::Int64(std::int64_t value) {
+  PushValue("integer").Int64(value);
+}
+
+void ObjectValidatorBase::Uint64(std::uint64_t value) {
+  PushValue("integer").Uint64(value);
+}
+
+void ObjectValidatorBase::Double(double value) {
+  PushValue("double").Double(value);
+}
+
+void ObjectValidatorBase::String(std::string_view value) {
+  PushValue("string").String(value);
+}
+
+void ObjectValidatorBase::StartObject() {
+  if (!inside_) {
+    inside_ = true;
+    return;
+  }
+  PushValue("object").StartObject();
+}
+
+void ObjectValidatorBase::Key(std::string_view key) {
+  key_.assign(key);
+  field_ = FindField(key);
+  if (field_) {
+    seen_fields_ |= std::uint64_t{1} << *field_;
+  } else if (extra_policy_ == ExtraPolicy::kForbid) {
+    throw std::runtime_error(fmt::format("Unknown property '{}'", key));
+  }
+}
+
+void ObjectValidatorBase::EndObject() {
+  UASSERT(inside_);
+  key_.clear();
+
+  const auto missing_fields = required_fields_ & ~seen_fields_;
+  if (missing_fields) {
+    std::size_t index = 0;
+    while (!(missing_fields & (std::uint64_t{1} << index))) ++index;
+    throw std::runtime_error(
+        fmt::format("Field '{}' is missing", GetFieldName(index)));
+  }
+  SetResult(Valid{});
+}
+
+void ObjectValidatorBase::StartArray() { PushValue("array").StartArray(); }
+
+formats::json::parser::BaseParser& ObjectValidatorBase::PushValue(
+    std::string_view what) {
+  if (!inside_) Throw(std::string{what});
+
+  formats::json::parser::BaseParser* parser = nullptr;
+  if (field_) {
+    parser = &ResetField(*field_);
+  } else if (extra_policy_ == ExtraPolicy::kValidate) {
+    parser = &ResetExtraField();
+  } else {
+    skip_.Reset();
+    parser = &skip_;
+  }
+  parser_state_->PushParser(*parser);
+  return *parser;
+}
+
+}  // namespace chaotic::sax
+
+USERVER_NAMESPACE_END
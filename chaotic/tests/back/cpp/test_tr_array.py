@@ -62,3 +62,48 @@ def test_array_array_with_validators(simple_gen):
             validators=CppArrayValidator(),
         ),
     }
+
+
+def test_array_view(simple_gen):
+    types = simple_gen(
+        {
+            'type': 'array',
+            'items': {'type': 'integer'},
+            'maxItems': 4,
+            'x-usrv-cpp-view': True,
+        },
+    )
+    assert types == {
+        '/definitions/type': CppArray(
+            raw_cpp_type='NOT_USED',
+            user_cpp_type=None,
+            json_schema=None,
+            nullable=False,
+            items=CppPrimitiveType(
+                raw_cpp_type='int',
+                user_cpp_type=None,
+                json_schema=None,
+                nullable=False,
+                validators=CppPrimitiveValidator(prefix='/definitions/typeA'),
+            ),
+            container='boost::container::small_vector',
+            validators=CppArrayValidator(maxItems=4),
+            inline_capacity=4,
+        ),
+    }
+    assert (
+        types['/definitions/type'].cpp_user_name()
+        == 'boost::container::small_vector<int, 4>'
+    )
+
+
+def test_array_view_unbounded(simple_gen):
+    types = simple_gen(
+        {
+            'type': 'array',
+            'items': {'type': 'integer'},
+            'x-usrv-cpp-view': True,
+        },
+    )
+    assert types['/definitions/type'].container == 'std::vector'
+    assert types['/definitions/type'].inline_capacity is None
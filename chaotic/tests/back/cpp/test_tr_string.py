@@ -1,3 +1,4 @@
+from chaotic import error
 from chaotic.back.cpp import types as cpp_types
 
 
@@ -60,3 +61,31 @@ def test_datetime_isobasic(simple_gen):
             default=None,
         ),
     }
+
+
+def test_view(simple_gen):
+    types = simple_gen({'type': 'string', 'x-usrv-cpp-view': True})
+    assert types == {
+        '/definitions/type': cpp_types.CppPrimitiveType(
+            raw_cpp_type='std::string_view',
+            user_cpp_type=None,
+            json_schema=None,
+            nullable=False,
+            validators=cpp_types.CppPrimitiveValidator(
+                prefix='/definitions/type',
+            ),
+        ),
+    }
+
+
+def test_view_with_format(simple_gen):
+    try:
+        simple_gen(
+            {'type': 'string', 'format': 'uuid', 'x-usrv-cpp-view': True},
+        )
+        assert False
+    except error.BaseError as exc:
+        assert exc.msg == (
+            '"x-usrv-cpp-view" is supported only for the strings without '
+            '"format", "x-usrv-cpp-type" and "x-usrv-cpp-typedef-tag"'
+        )
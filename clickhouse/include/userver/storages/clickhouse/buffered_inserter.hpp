@@ -0,0 +1,207 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BufferedInserter
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// storages::clickhouse::BufferedInserter settings
+struct BufferedInserterSettings final {
+  /// Buffered rows count that triggers a flush
+  std::size_t flush_rows{10'000};
+
+  /// Maximum time between flushes
+  std::chrono::milliseconds flush_interval{1000};
+
+  /// Rows pushed over this count of buffered rows are dropped
+  std::size_t max_buffered_rows{1'000'000};
+
+  /// Command control of the flush inserts
+  OptionalCommandControl command_control{};
+};
+
+// clang-format off
+
+/// @brief Accumulates rows of concurrent producers and inserts them into a
+/// table in big batches from a background task.
+///
+/// A batch is flushed with Cluster::InsertRows as soon as `flush_rows` rows
+/// are buffered or `flush_interval` passes, whichever comes first. Compression
+/// of the inserts follows the `compression` option of components::ClickHouse.
+///
+/// If the inserts do not keep up and `max_buffered_rows` rows are waiting,
+/// new rows are dropped and accounted in metrics instead of growing the
+/// memory without bounds. Rows of a failed insert are dropped as well, there
+/// are no retries.
+///
+/// `Row` is expected to be a clickhouse-mapped type, see @ref clickhouse_io.
+///
+/// ## Metrics
+/// Name | Description
+/// ---- | -----------
+/// rows.pushed | rows accepted into the buffer
+/// rows.inserted | rows successfully inserted
+/// rows.dropped-overflow | rows dropped due to the full buffer
+/// rows.dropped-failed | rows dropped due to failed inserts
+/// rows.buffered | rows currently waiting for a flush
+/// flushes.ok / flushes.failed | insert operations
+
+// clang-format on
+template <typename Row>
+class BufferedInserter final {
+ public:
+  BufferedInserter(std::shared_ptr<Cluster> cluster, std::string table_name,
+                   std::vector<std::string> column_names,
+                   BufferedInserterSettings settings);
+
+  /// Stops background flushes and synchronously inserts the buffered rows
+  ~BufferedInserter();
+
+  BufferedInserter(const BufferedInserter&) = delete;
+  BufferedInserter& operator=(const BufferedInserter&) = delete;
+
+  /// @brief Buffers a row for insertion
+  /// @returns false if the row is dropped due to the full buffer
+  bool Push(Row row);
+
+  /// Synchronously inserts the buffered rows
+  void Flush();
+
+  template <typename T>
+  friend void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                         const BufferedInserter<T>& inserter);
+
+ private:
+  void DoFlush() noexcept;
+
+  const std::shared_ptr<Cluster> cluster_;
+  const std::string table_name_;
+  const std::vector<std::string> column_names_;
+  const std::vector<std::string_view> column_name_views_;
+  const BufferedInserterSettings settings_;
+
+  mutable engine::Mutex mutex_;
+  std::vector<Row> buffer_;
+
+  USERVER_NAMESPACE::utils::statistics::RateCounter pushed_rows_;
+  USERVER_NAMESPACE::utils::statistics::RateCounter inserted_rows_;
+  USERVER_NAMESPACE::utils::statistics::RateCounter dropped_overflow_rows_;
+  USERVER_NAMESPACE::utils::statistics::RateCounter dropped_failed_rows_;
+  USERVER_NAMESPACE::utils::statistics::RateCounter ok_flushes_;
+  USERVER_NAMESPACE::utils::statistics::RateCounter failed_flushes_;
+
+  USERVER_NAMESPACE::utils::PeriodicTask flush_task_;
+};
+
+template <typename Row>
+BufferedInserter<Row>::BufferedInserter(std::shared_ptr<Cluster> cluster,
+                                        std::string table_name,
+                                        std::vector<std::string> column_names,
+                                        BufferedInserterSettings settings)
+    : cluster_{std::move(cluster)},
+      table_name_{std::move(table_name)},
+      column_names_{std::move(column_names)},
+      column_name_views_{column_names_.begin(), column_names_.end()},
+      settings_{std::move(settings)} {
+  UINVARIANT(cluster_, "Cluster is required for BufferedInserter");
+  UINVARIANT(settings_.flush_rows > 0, "flush_rows must be positive");
+
+  using PeriodicTask = USERVER_NAMESPACE::utils::PeriodicTask;
+  flush_task_.Start("clickhouse_buffered_insert_" + table_name_,
+                    {settings_.flush_interval, PeriodicTask::Flags::kStrong},
+                    [this] { DoFlush(); });
+}
+
+template <typename Row>
+BufferedInserter<Row>::~BufferedInserter() {
+  flush_task_.Stop();
+  DoFlush();
+}
+
+template <typename Row>
+bool BufferedInserter<Row>::Push(Row row) {
+  bool should_flush = false;
+  {
+    const std::lock_guard lock{mutex_};
+    if (buffer_.size() >= settings_.max_buffered_rows) {
+      ++dropped_overflow_rows_;
+      return false;
+    }
+    buffer_.push_back(std::move(row));
+    should_flush = buffer_.size() == settings_.flush_rows;
+  }
+  ++pushed_rows_;
+
+  if (should_flush) flush_task_.ForceStepAsync();
+  return true;
+}
+
+template <typename Row>
+void BufferedInserter<Row>::Flush() {
+  DoFlush();
+}
+
+template <typename Row>
+void BufferedInserter<Row>::DoFlush() noexcept {
+  std::vector<Row> rows;
+  {
+    const std::lock_guard lock{mutex_};
+    rows.swap(buffer_);
+  }
+  if (rows.empty()) return;
+
+  using Rate = USERVER_NAMESPACE::utils::statistics::Rate;
+  try {
+    cluster_->InsertRows(settings_.command_control, table_name_,
+                         column_name_views_, rows);
+    inserted_rows_ += Rate{rows.size()};
+    ++ok_flushes_;
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to insert " << rows.size() << " rows into '"
+                << table_name_ << "': " << ex;
+    dropped_failed_rows_ += Rate{rows.size()};
+    ++failed_flushes_;
+  }
+}
+
+template <typename T>
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const BufferedInserter<T>& inserter) {
+  auto rows = writer["rows"];
+  rows["pushed"] = inserter.pushed_rows_;
+  rows["inserted"] = inserter.inserted_rows_;
+  rows["dropped-overflow"] = inserter.dropped_overflow_rows_;
+  rows["dropped-failed"] = inserter.dropped_failed_rows_;
+  {
+    const std::lock_guard lock{inserter.mutex_};
+    rows["buffered"] = inserter.buffer_.size();
+  }
+
+  auto flushes = writer["flushes"];
+  flushes["ok"] = inserter.ok_flushes_;
+  flushes["failed"] = inserter.failed_flushes_;
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 /// @brief @copybrief storages::clickhouse::Cluster
 
 #include <atomic>
+#include <functional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -49,6 +50,9 @@ class Cluster final {
 
   Cluster(const Cluster&) = delete;
 
+  /// Callback that receives every result block as soon as it is read
+  using BlockCallback = std::function<void(ExecutionResult&&)>;
+
   /// @brief Execute a statement at some host of the cluster
   /// with args as query parameters.
   template <typename... Args>
@@ -60,6 +64,22 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at some host of the cluster
+  /// with args as query parameters, passing each result block to `on_block`
+  /// as it arrives instead of collecting the whole result in memory.
+  ///
+  /// Every block is given as a separate ExecutionResult and may be converted
+  /// with any of its methods. Values of columns that view the block data,
+  /// e.g. io::columns::StringViewColumn, are valid until `on_block` returns.
+  ///
+  /// @note Execute timeout of `optional_cc` applies to the whole statement.
+  /// @warning An exception thrown from `on_block` cancels the statement and
+  /// closes the connection, then it is rethrown to the caller.
+  template <typename... Args>
+  void ExecuteStreaming(OptionalCommandControl optional_cc,
+                        const BlockCallback& on_block, const Query& query,
+                        const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -131,6 +151,9 @@ class Cluster final {
 
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  void DoExecuteStreaming(OptionalCommandControl, const Query& query,
+                          const BlockCallback& on_block) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
@@ -189,6 +212,14 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteStreaming(OptionalCommandControl optional_cc,
+                               const BlockCallback& on_block,
+                               const Query& query, const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  DoExecuteStreaming(optional_cc, formatted_query, on_block);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include <userver/storages/clickhouse/execution_result.hpp>
@@ -29,6 +30,10 @@ class Pool final {
 
   ExecutionResult Execute(OptionalCommandControl, const Query& query) const;
 
+  void ExecuteStreaming(
+      OptionalCommandControl, const Query& query,
+      const std::function<void(ExecutionResult&&)>& on_block) const;
+
   void Insert(OptionalCommandControl, const InsertionRequest& request) const;
 
   void WriteStatistics(
@@ -22,6 +22,9 @@ namespace storages::clickhouse::io::columns {
 /// - `static ColumnRef Serialize(const container_type&)` - constructs a column from C++ container,
 /// - `cpp_type ColumnIterator<YourColumnType>::DataHolder::Get()`
 ///
+/// Optionally `void AppendTo(container_type&) const` may be implemented to
+/// convert the whole column at once, e.g. with a single copy of POD values.
+///
 /// see implementation of any of the existing columns for better understanding.
 // clang-format on
 template <typename ColumnType>
@@ -37,6 +40,9 @@ class ClickhouseColumn {
 
   size_t Size() const { return GetColumnSize(column_); }
 
+ protected:
+  const ColumnRef& GetColumn() const { return column_; }
+
  private:
   ColumnRef column_;
 };
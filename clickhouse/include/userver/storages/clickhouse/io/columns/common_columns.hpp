@@ -5,12 +5,18 @@
 
 #include <userver/storages/clickhouse/io/columns/datetime64_column.hpp>
 #include <userver/storages/clickhouse/io/columns/datetime_column.hpp>
+#include <userver/storages/clickhouse/io/columns/decimal64_column.hpp>
+#include <userver/storages/clickhouse/io/columns/enum16_column.hpp>
+#include <userver/storages/clickhouse/io/columns/enum8_column.hpp>
+#include <userver/storages/clickhouse/io/columns/fixed_string_column.hpp>
 #include <userver/storages/clickhouse/io/columns/float32_column.hpp>
 #include <userver/storages/clickhouse/io/columns/float64_column.hpp>
 #include <userver/storages/clickhouse/io/columns/int32_column.hpp>
 #include <userver/storages/clickhouse/io/columns/int64_column.hpp>
 #include <userver/storages/clickhouse/io/columns/int8_column.hpp>
+#include <userver/storages/clickhouse/io/columns/low_cardinality_string_column.hpp>
 #include <userver/storages/clickhouse/io/columns/string_column.hpp>
+#include <userver/storages/clickhouse/io/columns/string_view_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint16_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint32_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint64_column.hpp>
@@ -0,0 +1,146 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/decimal64_column.hpp
+/// @brief Decimal columns support
+/// @ingroup userver_clickhouse_types
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <userver/decimal64/decimal64.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @cond
+// Non-template helpers of Decimal64Column, internal use only
+ColumnRef GetTypedDecimal64Column(const ColumnRef& column, int scale);
+
+std::int64_t GetDecimal64Unbiased(const ColumnRef& column, std::size_t ind);
+
+ColumnRef SerializeDecimal64(const std::vector<std::int64_t>& unbiased,
+                             int scale);
+/// @endcond
+
+/// @brief Represents ClickHouse Decimal(P, Scale) column with P up to 18,
+/// i.e. Decimal64(Scale) and narrower, mapped to decimal64::Decimal<Scale>.
+///
+/// Values are read in their unbiased form without any string conversions.
+/// Reading a column of another scale or of a precision above 18 throws.
+/// Serialized columns are Decimal(18, Scale).
+template <int Scale>
+class Decimal64Column final : public ClickhouseColumn<Decimal64Column<Scale>> {
+ public:
+  using cpp_type = decimal64::Decimal<Scale>;
+  using container_type = std::vector<cpp_type>;
+
+  class DecimalDataHolder final {
+   public:
+    DecimalDataHolder() = default;
+    DecimalDataHolder(
+        typename ColumnIterator<Decimal64Column<Scale>>::IteratorPosition
+            iter_position,
+        ColumnRef&& column);
+
+    DecimalDataHolder operator++(int);
+    DecimalDataHolder& operator++();
+    cpp_type& UpdateValue();
+
+    bool operator==(const DecimalDataHolder& other) const;
+
+   private:
+    ColumnRef column_;
+    std::size_t ind_{0};
+    std::optional<cpp_type> current_value_ = std::nullopt;
+  };
+  using iterator_data = DecimalDataHolder;
+
+  Decimal64Column(ColumnRef column);
+
+  static ColumnRef Serialize(const container_type& from);
+
+  /// Appends all the values to `to`
+  void AppendTo(container_type& to) const;
+};
+
+template <int Scale>
+Decimal64Column<Scale>::Decimal64Column(ColumnRef column)
+    : ClickhouseColumn<Decimal64Column>{
+          GetTypedDecimal64Column(column, Scale)} {}
+
+template <int Scale>
+Decimal64Column<Scale>::DecimalDataHolder::DecimalDataHolder(
+    typename ColumnIterator<Decimal64Column<Scale>>::IteratorPosition
+        iter_position,
+    ColumnRef&& column)
+    : column_{std::move(column)},
+      ind_{iter_position == decltype(iter_position)::kEnd
+               ? GetColumnSize(column_)
+               : 0} {}
+
+template <int Scale>
+typename Decimal64Column<Scale>::DecimalDataHolder
+Decimal64Column<Scale>::DecimalDataHolder::operator++(int) {
+  DecimalDataHolder old{};
+  old.column_ = column_;
+  old.ind_ = ind_++;
+  old.current_value_ = std::exchange(current_value_, std::nullopt);
+
+  return old;
+}
+
+template <int Scale>
+typename Decimal64Column<Scale>::DecimalDataHolder&
+Decimal64Column<Scale>::DecimalDataHolder::operator++() {
+  ++ind_;
+  current_value_.reset();
+
+  return *this;
+}
+
+template <int Scale>
+typename Decimal64Column<Scale>::cpp_type&
+Decimal64Column<Scale>::DecimalDataHolder::UpdateValue() {
+  UASSERT(ind_ < GetColumnSize(column_));
+  if (!current_value_.has_value()) {
+    current_value_.emplace(
+        cpp_type::FromUnbiased(GetDecimal64Unbiased(column_, ind_)));
+  }
+
+  return *current_value_;
+}
+
+template <int Scale>
+bool Decimal64Column<Scale>::DecimalDataHolder::operator==(
+    const DecimalDataHolder& other) const {
+  return ind_ == other.ind_ && column_.get() == other.column_.get();
+}
+
+template <int Scale>
+ColumnRef Decimal64Column<Scale>::Serialize(const container_type& from) {
+  std::vector<std::int64_t> unbiased;
+  unbiased.reserve(from.size());
+  for (const auto value : from) unbiased.push_back(value.AsUnbiased());
+
+  return SerializeDecimal64(unbiased, Scale);
+}
+
+template <int Scale>
+void Decimal64Column<Scale>::AppendTo(container_type& to) const {
+  const auto& column = this->GetColumn();
+  const auto size = GetColumnSize(column);
+  to.reserve(to.size() + size);
+  for (std::size_t i = 0; i < size; ++i) {
+    to.push_back(cpp_type::FromUnbiased(GetDecimal64Unbiased(column, i)));
+  }
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/enum16_column.hpp
+/// @brief Enum16 column support
+/// @ingroup userver_clickhouse_types
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @brief Represents ClickHouse Enum16 column by the numeric values of its
+/// elements
+///
+/// Values are read without resolving the element names, select
+/// `toString(column)` if the names are required.
+///
+/// The column is read-only: insertion requires the full list of the enum
+/// elements, insert the numeric values via Int16Column instead.
+class Enum16Column final : public ClickhouseColumn<Enum16Column> {
+ public:
+  using cpp_type = std::int16_t;
+  using container_type = std::vector<cpp_type>;
+
+  Enum16Column(ColumnRef column);
+
+  template <typename T>
+  static ColumnRef Serialize(const T&) {
+    static_assert(!sizeof(T),
+                  "Enum16Column is read-only, insert the values via "
+                  "Int16Column instead");
+    return {};
+  }
+};
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/enum8_column.hpp
+/// @brief Enum8 column support
+/// @ingroup userver_clickhouse_types
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @brief Represents ClickHouse Enum8 column by the numeric values of its
+/// elements
+///
+/// Values are read without resolving the element names, select
+/// `toString(column)` if the names are required.
+///
+/// The column is read-only: insertion requires the full list of the enum
+/// elements, insert the numeric values via Int8Column instead.
+class Enum8Column final : public ClickhouseColumn<Enum8Column> {
+ public:
+  using cpp_type = std::int8_t;
+  using container_type = std::vector<cpp_type>;
+
+  Enum8Column(ColumnRef column);
+
+  template <typename T>
+  static ColumnRef Serialize(const T&) {
+    static_assert(!sizeof(T),
+                  "Enum8Column is read-only, insert the values via "
+                  "Int8Column instead");
+    return {};
+  }
+};
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,32 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/fixed_string_column.hpp
+/// @brief FixedString column support
+/// @ingroup userver_clickhouse_types
+
+#include <string>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @brief Represents ClickHouse FixedString(N) column
+///
+/// Values are read with their trailing zero bytes, if any. Serialized values
+/// are padded with zero bytes to the length of the longest one, so inserted
+/// values are expected to be exactly N bytes long.
+class FixedStringColumn final : public ClickhouseColumn<FixedStringColumn> {
+ public:
+  using cpp_type = std::string;
+  using container_type = std::vector<cpp_type>;
+
+  FixedStringColumn(ColumnRef column);
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -19,6 +19,9 @@ class Float32Column final : public ClickhouseColumn<Float32Column> {
   Float32Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  /// Appends all the values to `to` with a single copy
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -0,0 +1,32 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/string_view_column.hpp
+/// @brief String column support without copying the values
+/// @ingroup userver_clickhouse_types
+
+#include <string_view>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @brief Represents ClickHouse String column viewed in place.
+///
+/// Values point into the result block and are valid only while the block is
+/// alive, e.g. within storages::clickhouse::Cluster::ExecuteStreaming
+/// callback. Use StringColumn to keep the values.
+class StringViewColumn final : public ClickhouseColumn<StringViewColumn> {
+ public:
+  using cpp_type = std::string_view;
+  using container_type = std::vector<cpp_type>;
+
+  StringViewColumn(ColumnRef column);
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
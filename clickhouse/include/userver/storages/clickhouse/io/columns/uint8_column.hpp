@@ -19,6 +19,9 @@ class UInt8Column final : public ClickhouseColumn<UInt8Column> {
   UInt8Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  /// Appends all the values to `to` with a single copy
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
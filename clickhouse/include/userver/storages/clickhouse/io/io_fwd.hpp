@@ -29,6 +29,12 @@ namespace storages::clickhouse::io {
 /// - UInt32 @ref storages::clickhouse::io::columns::UInt32Column
 /// - UInt64 @ref storages::clickhouse::io::columns::UInt64Column
 /// - String @ref storages::clickhouse::io::columns::StringColumn
+/// - String as std::string_view @ref storages::clickhouse::io::columns::StringViewColumn
+/// - FixedString(N) @ref storages::clickhouse::io::columns::FixedStringColumn
+/// - LowCardinality(String) @ref storages::clickhouse::io::columns::LowCardinalityStringColumn
+/// - Enum8 (read-only) @ref storages::clickhouse::io::columns::Enum8Column
+/// - Enum16 (read-only) @ref storages::clickhouse::io::columns::Enum16Column
+/// - Decimal(P, S) with P <= 18 @ref storages::clickhouse::io::columns::Decimal64Column
 /// - UUID @ref storages::clickhouse::io::columns::UuidColumn
 /// - Nullable @ref storages::clickhouse::io::columns::NullableColumn
 /// - Float32 @ref storages::clickhouse::io::columns::Float32Column
@@ -12,6 +12,7 @@
 #include <userver/storages/clickhouse/impl/iterators_helper.hpp>
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
 #include <userver/storages/clickhouse/io/io_fwd.hpp>
+#include <userver/storages/clickhouse/io/type_traits.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -31,8 +32,12 @@ class ColumnsMapper final {
     static_assert(std::is_same_v<Field, typename ColumnType::container_type>);
 
     auto column = ColumnType{io::columns::GetWrappedColumn(block_, i)};
-    field.reserve(column.Size());
-    for (auto& it : column) field.push_back(std::move(it));
+    if constexpr (traits::kHasBulkAppend<ColumnType>) {
+      column.AppendTo(field);
+    } else {
+      field.reserve(column.Size());
+      for (auto& it : column) field.push_back(std::move(it));
+    }
   }
 
  private:
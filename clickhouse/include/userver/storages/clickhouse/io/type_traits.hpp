@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+
 #include <userver/utils/meta.hpp>
 
 #include <userver/storages/clickhouse/impl/is_decl_complete.hpp>
@@ -27,6 +29,17 @@ inline constexpr bool kIsSizeable = meta::kIsSizable<T>;
 template <typename T>
 inline constexpr bool kIsRange = meta::kIsRange<T>;
 
+namespace impl {
+template <typename ColumnType>
+using AppendToResult = decltype(std::declval<const ColumnType&>().AppendTo(
+    std::declval<typename ColumnType::container_type&>()));
+}  // namespace impl
+
+/// Whether the column can append all its values to a container at once
+template <typename ColumnType>
+inline constexpr bool kHasBulkAppend =
+    meta::kIsDetected<impl::AppendToResult, ColumnType>;
+
 }  // namespace storages::clickhouse::io::traits
 
 USERVER_NAMESPACE_END
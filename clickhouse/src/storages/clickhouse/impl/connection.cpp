@@ -104,6 +104,31 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
   return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(
+    OptionalCommandControl optional_cc, const Query& query,
+    const std::function<void(ExecutionResult&&)>& on_block) {
+  clickhouse_cpp::Query native_query{query.QueryText()};
+  native_query.OnDataCancelable([]([[maybe_unused]] const auto& block) {
+    // we must return 'true' if we don't want to cancel query
+    return !engine::current_task::ShouldCancel();
+  });
+
+  auto& span = tracing::Span::CurrentSpan();
+  auto scope = span.CreateScopeTime(scopes::kExec);
+
+  native_query.OnData([&on_block, &scope](const NativeBlock& data) {
+    scope.Reset(scopes::kExec);
+    // Empty blocks carry only the header and progress, skip them
+    if (data.GetColumnCount() == 0 || data.GetRowCount() == 0) return;
+
+    // Block copy only shares the columns, the data is not copied
+    auto block_ptr = std::make_unique<BlockWrapper>(NativeBlock{data});
+    on_block(ExecutionResult{BlockWrapperPtr{block_ptr.release()}});
+  });
+
+  DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc,
                         const InsertionRequest& request) {
   const auto& block = request.GetBlock();
@@ -0,0 +1,45 @@
+#include <userver/storages/clickhouse/io/columns/decimal64_column.hpp>
+
+#include <fmt/format.h>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/decimal.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnDecimal;
+
+constexpr std::size_t kMaxDecimal64Precision = 18;
+}  // namespace
+
+ColumnRef GetTypedDecimal64Column(const ColumnRef& column, int scale) {
+  auto decimal = impl::GetTypedColumn<Decimal64Column<0>, NativeType>(column);
+  if (decimal->GetPrecision() > kMaxDecimal64Precision ||
+      decimal->GetScale() != static_cast<std::size_t>(scale)) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to Decimal(18, {})",
+                    column->Type()->GetName(), scale)};
+  }
+
+  return decimal;
+}
+
+std::int64_t GetDecimal64Unbiased(const ColumnRef& column, std::size_t ind) {
+  return static_cast<std::int64_t>(impl::NativeGetAt<NativeType>(column, ind));
+}
+
+ColumnRef SerializeDecimal64(const std::vector<std::int64_t>& unbiased,
+                             int scale) {
+  auto column = std::make_shared<NativeType>(kMaxDecimal64Precision,
+                                             static_cast<std::size_t>(scale));
+  for (const auto value : unbiased) column->Append(value);
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,26 @@
+#include <userver/storages/clickhouse/io/columns/enum16_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/enum.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnEnum16;
+}
+
+Enum16Column::Enum16Column(ColumnRef column)
+    : ClickhouseColumn{impl::GetTypedColumn<Enum16Column, NativeType>(column)} {
+}
+
+template <>
+Enum16Column::cpp_type ColumnIterator<Enum16Column>::DataHolder::Get() const {
+  return impl::NativeGetAt<NativeType>(column_, ind_);
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,25 @@
+#include <userver/storages/clickhouse/io/columns/enum8_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/enum.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnEnum8;
+}
+
+Enum8Column::Enum8Column(ColumnRef column)
+    : ClickhouseColumn{impl::GetTypedColumn<Enum8Column, NativeType>(column)} {}
+
+template <>
+Enum8Column::cpp_type ColumnIterator<Enum8Column>::DataHolder::Get() const {
+  return impl::NativeGetAt<NativeType>(column_, ind_);
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,38 @@
+#include <userver/storages/clickhouse/io/columns/fixed_string_column.hpp>
+
+#include <algorithm>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/string.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnFixedString;
+}
+
+FixedStringColumn::FixedStringColumn(ColumnRef column)
+    : ClickhouseColumn{
+          impl::GetTypedColumn<FixedStringColumn, NativeType>(column)} {}
+
+template <>
+FixedStringColumn::cpp_type
+ColumnIterator<FixedStringColumn>::DataHolder::Get() const {
+  return std::string{impl::NativeGetAt<NativeType>(column_, ind_)};
+}
+
+ColumnRef FixedStringColumn::Serialize(const container_type& from) {
+  std::size_t length = 0;
+  for (const auto& value : from) length = std::max(length, value.size());
+
+  auto column = std::make_shared<NativeType>(length);
+  for (const auto& value : from) column->Append(value);
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,22 @@ struct NumericColumn final {
     return std::make_shared<
         clickhouse::impl::clickhouse_cpp::ColumnVector<value_type>>(from);
   }
+
+  static void AppendTo(const clickhouse::impl::clickhouse_cpp::ColumnRef& from,
+                       container_type& to) {
+    using NativeType =
+        clickhouse::impl::clickhouse_cpp::ColumnVector<value_type>;
+    UASSERT(from->As<NativeType>() != nullptr);
+
+    const auto size = from->Size();
+    if (size == 0) return;
+
+    // ColumnVector keeps the values contiguous, copy them all at once
+    const auto& native = static_cast<const NativeType&>(*from);
+    const auto offset = to.size();
+    to.resize(offset + size);
+    std::memcpy(to.data() + offset, &native.At(0), size * sizeof(value_type));
+  }
 };
 
 }  // namespace storages::clickhouse::io::columns::impl
@@ -22,6 +22,10 @@ ColumnRef Int32Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Int32Column>::Serialize(from);
 }
 
+void Int32Column::AppendTo(container_type& to) const {
+  impl::NumericColumn<Int32Column>::AppendTo(GetColumn(), to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,36 @@
+#include <userver/storages/clickhouse/io/columns/low_cardinality_string_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/lowcardinality.h>
+#include <clickhouse/columns/string.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnLowCardinalityT<
+    clickhouse::impl::clickhouse_cpp::ColumnString>;
+}
+
+LowCardinalityStringColumn::LowCardinalityStringColumn(ColumnRef column)
+    : ClickhouseColumn{
+          impl::GetTypedColumn<LowCardinalityStringColumn, NativeType>(
+              column)} {}
+
+template <>
+LowCardinalityStringColumn::cpp_type
+ColumnIterator<LowCardinalityStringColumn>::DataHolder::Get() const {
+  return std::string{impl::NativeGetAt<NativeType>(column_, ind_)};
+}
+
+ColumnRef LowCardinalityStringColumn::Serialize(const container_type& from) {
+  auto column = std::make_shared<NativeType>();
+  for (const auto& value : from) column->Append(value);
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
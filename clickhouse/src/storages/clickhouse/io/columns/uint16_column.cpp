@@ -23,6 +23,10 @@ ColumnRef UInt16Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt16Column>::Serialize(from);
 }
 
+void UInt16Column::AppendTo(container_type& to) const {
+  impl::NumericColumn<UInt16Column>::AppendTo(GetColumn(), to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -23,6 +23,10 @@ ColumnRef UInt32Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt32Column>::Serialize(from);
 }
 
+void UInt32Column::AppendTo(container_type& to) const {
+  impl::NumericColumn<UInt32Column>::AppendTo(GetColumn(), to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#include <userver/utest/utest.hpp>
+
+#include <memory>
+#include <string>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct BufferedRow final {
+  uint64_t id;
+  std::string value;
+};
+
+struct CountResult final {
+  std::vector<uint64_t> count;
+};
+
+std::shared_ptr<storages::clickhouse::Cluster> MakeNonOwning(
+    ClusterWrapper& cluster) {
+  return {std::shared_ptr<void>{}, &*cluster};
+}
+
+uint64_t CountRows(ClusterWrapper& cluster) {
+  return cluster->Execute("SELECT count() FROM buffered_table")
+      .As<CountResult>()
+      .count.at(0);
+}
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<BufferedRow> final {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<CountResult> final {
+  using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(BufferedInserter, FlushesOnSizeAndDestruction) {
+  ClusterWrapper cluster{};
+  cluster->Execute("DROP TABLE IF EXISTS buffered_table");
+  cluster->Execute(
+      "CREATE TABLE buffered_table (id UInt64, value String) ENGINE = Memory");
+
+  storages::clickhouse::BufferedInserterSettings settings;
+  settings.flush_rows = 100;
+  settings.flush_interval = std::chrono::hours{1};
+
+  {
+    storages::clickhouse::BufferedInserter<BufferedRow> inserter{
+        MakeNonOwning(cluster), "buffered_table", {"id", "value"}, settings};
+
+    for (uint64_t i = 0; i < 150; ++i) {
+      EXPECT_TRUE(inserter.Push({i, std::to_string(i)}));
+    }
+    // the first 100 rows are flushed in background
+    while (CountRows(cluster) < 100) {
+      engine::SleepFor(std::chrono::milliseconds{10});
+    }
+    EXPECT_EQ(CountRows(cluster), 100);
+  }
+
+  EXPECT_EQ(CountRows(cluster), 150);
+}
+
+UTEST(BufferedInserter, DropsOnOverflow) {
+  ClusterWrapper cluster{};
+  cluster->Execute("DROP TABLE IF EXISTS buffered_table");
+  cluster->Execute(
+      "CREATE TABLE buffered_table (id UInt64, value String) ENGINE = Memory");
+
+  storages::clickhouse::BufferedInserterSettings settings;
+  settings.flush_rows = 1000;
+  settings.flush_interval = std::chrono::hours{1};
+  settings.max_buffered_rows = 10;
+
+  storages::clickhouse::BufferedInserter<BufferedRow> inserter{
+      MakeNonOwning(cluster), "buffered_table", {"id", "value"}, settings};
+  for (uint64_t i = 0; i < 10; ++i) {
+    EXPECT_TRUE(inserter.Push({i, "value"}));
+  }
+  EXPECT_FALSE(inserter.Push({10, "value"}));
+
+  inserter.Flush();
+  EXPECT_EQ(CountRows(cluster), 10);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/decimal64/decimal64.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Decimal = decimal64::Decimal<4>;
+
+struct DataWithDecimals final {
+  std::vector<Decimal> decimals;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithDecimals> {
+  using mapped_type = std::tuple<columns::Decimal64Column<4>>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Decimal64, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value Decimal64(4))");
+
+  const DataWithDecimals insert_data{
+      {Decimal{"0"}, Decimal{"1.5"}, Decimal{"-12345.6789"},
+       Decimal::FromUnbiased(std::numeric_limits<int64_t>::max())}};
+  cluster->Insert("tmp_table", {"value"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT * from tmp_table").As<DataWithDecimals>();
+  EXPECT_EQ(select_data.decimals, insert_data.decimals);
+}
+
+UTEST(Decimal64, NarrowPrecision) {
+  ClusterWrapper cluster{};
+
+  const auto select_data =
+      cluster->Execute("SELECT toDecimal32(2.25, 4)").As<DataWithDecimals>();
+  EXPECT_EQ(select_data.decimals, (std::vector<Decimal>{Decimal{"2.25"}}));
+}
+
+UTEST(Decimal64, ScaleMismatch) {
+  ClusterWrapper cluster{};
+
+  UEXPECT_THROW(
+      cluster->Execute("SELECT toDecimal64(2.25, 2)").As<DataWithDecimals>(),
+      std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DataWithEnums final {
+  std::vector<int8_t> enums8;
+  std::vector<int16_t> enums16;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithEnums> {
+  using mapped_type = std::tuple<columns::Enum8Column, columns::Enum16Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Enum, Select) {
+  ClusterWrapper cluster{};
+
+  const auto select_data =
+      cluster
+          ->Execute(
+              "SELECT CAST(number % 2 + 1, 'Enum8(\\'a\\' = 1, \\'b\\' = 2)'), "
+              "CAST(number * 1000 - 1000, "
+              "'Enum16(\\'x\\' = -1000, \\'y\\' = 0, \\'z\\' = 1000)') "
+              "FROM system.numbers LIMIT 3")
+          .As<DataWithEnums>();
+  EXPECT_EQ(select_data.enums8, (std::vector<int8_t>{1, 2, 1}));
+  EXPECT_EQ(select_data.enums16, (std::vector<int16_t>{-1000, 0, 1000}));
+}
+
+USERVER_NAMESPACE_END
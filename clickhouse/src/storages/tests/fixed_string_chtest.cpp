@@ -0,0 +1,55 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DataWithFixedStrings final {
+  std::vector<std::string> strings;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithFixedStrings> {
+  using mapped_type = std::tuple<columns::FixedStringColumn>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(FixedString, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value FixedString(4))");
+
+  const DataWithFixedStrings insert_data{
+      {"abcd", "1234", std::string("a\0\0\0", 4)}};
+  cluster->Insert("tmp_table", {"value"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT * from tmp_table").As<DataWithFixedStrings>();
+  EXPECT_EQ(select_data.strings, insert_data.strings);
+}
+
+UTEST(FixedString, ShorterValuesArePadded) {
+  ClusterWrapper cluster{};
+
+  const auto select_data =
+      cluster->Execute("SELECT toFixedString('ab', 4)")
+          .As<DataWithFixedStrings>();
+  ASSERT_EQ(select_data.strings.size(), 1);
+  EXPECT_EQ(select_data.strings.front(), std::string("ab\0\0", 4));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,49 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DataWithLowCardinality final {
+  std::vector<std::string> strings;
+  std::vector<uint32_t> ids;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithLowCardinality> {
+  using mapped_type = std::tuple<columns::LowCardinalityStringColumn,
+                                 columns::UInt32Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(LowCardinality, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value LowCardinality(String), id UInt32)");
+
+  const DataWithLowCardinality insert_data{{"a", "b", "a", "", "b", "a"},
+                                           {0, 1, 2, 3, 4, 5}};
+  cluster->Insert("tmp_table", {"value", "id"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT value, id FROM tmp_table ORDER BY id")
+          .As<DataWithLowCardinality>();
+  EXPECT_EQ(select_data.strings, insert_data.strings);
+  EXPECT_EQ(select_data.ids, insert_data.ids);
+}
+
+USERVER_NAMESPACE_END
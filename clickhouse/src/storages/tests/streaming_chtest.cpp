@@ -0,0 +1,83 @@
+#include <userver/utest/utest.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/execution_result.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct StreamedData final {
+  std::vector<uint64_t> numbers;
+  std::vector<std::string_view> strings;
+};
+
+const storages::clickhouse::Query streaming_query{
+    "SELECT c.number, toString(c.number) "
+    "FROM numbers(0, 100000) c "
+    "SETTINGS max_block_size = 1000"};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<StreamedData> final {
+  using mapped_type =
+      std::tuple<columns::UInt64Column, columns::StringViewColumn>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Streaming, BlocksArriveSeparately) {
+  ClusterWrapper cluster{};
+
+  size_t blocks_count = 0;
+  size_t rows_count = 0;
+  uint64_t sum = 0;
+  cluster->ExecuteStreaming(
+      {},
+      [&](storages::clickhouse::ExecutionResult&& block) {
+        ++blocks_count;
+        EXPECT_LE(block.GetRowsCount(), 1000);
+        rows_count += block.GetRowsCount();
+
+        const auto data = std::move(block).As<StreamedData>();
+        for (size_t i = 0; i < data.numbers.size(); ++i) {
+          sum += data.numbers[i];
+          EXPECT_EQ(data.strings[i], std::to_string(data.numbers[i]));
+        }
+      },
+      streaming_query);
+
+  EXPECT_GT(blocks_count, 1);
+  EXPECT_EQ(rows_count, 100000);
+  EXPECT_EQ(sum, uint64_t{100000} * (100000 - 1) / 2);
+}
+
+UTEST(Streaming, CallbackExceptionPropagates) {
+  ClusterWrapper cluster{};
+
+  size_t blocks_count = 0;
+  UEXPECT_THROW(cluster->ExecuteStreaming(
+                    {},
+                    [&](storages::clickhouse::ExecutionResult&&) {
+                      ++blocks_count;
+                      throw std::runtime_error{"stop"};
+                    },
+                    streaming_query),
+                std::runtime_error);
+  EXPECT_EQ(blocks_count, 1);
+
+  // the broken connection is replaced, the cluster keeps working
+  EXPECT_EQ(cluster->Execute("SELECT 1").GetRowsCount(), 1);
+}
+
+USERVER_NAMESPACE_END
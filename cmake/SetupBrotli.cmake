@@ -10,11 +10,12 @@ if (NOT USERVER_FORCE_DOWNLOAD_PACKAGES)
   endif()
 
   if (Brotli_FOUND)
+    # FindBrotli provides a single target for both of the libraries
     if(NOT TARGET Brotli::dec)
-      add_library(Brotli::dec ALIAS brotlidec)
+      add_library(Brotli::dec ALIAS Brotli)
     endif()
     if(NOT TARGET Brotli::enc)
-      add_library(Brotli::enc ALIAS brotlienc)
+      add_library(Brotli::enc ALIAS Brotli)
     endif()
     return()
   endif()
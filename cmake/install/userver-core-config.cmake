@@ -17,6 +17,7 @@ find_package(CURL "7.68" REQUIRED)
 find_package(ZLIB REQUIRED)
 find_package(Nghttp2 REQUIRED)
 find_package(LibEv REQUIRED)
+find_package(Brotli REQUIRED)
 
 include("${USERVER_CMAKE_DIR}/UserverTestsuite.cmake")
 include("${USERVER_CMAKE_DIR}/Findc-ares.cmake")
@@ -102,6 +102,7 @@ class UserverConan(ConanFile):
 
     def requirements(self):
         self.requires('boost/1.79.0', transitive_headers=True)
+        self.requires('brotli/1.1.0')
         self.requires('c-ares/1.19.1')
         self.requires('cctz/2.3', transitive_headers=True)
         self.requires('concurrentqueue/1.0.3', transitive_headers=True)
@@ -420,6 +421,9 @@ class UserverConan(ConanFile):
         def libnghttp2():
             return ['libnghttp2::libnghttp2']
 
+        def brotli():
+            return ['brotli::brotli']
+
         def openssl():
             return ['openssl::openssl']
 
@@ -502,6 +506,7 @@ class UserverConan(ConanFile):
                     + yaml()
                     + libev()
                     + libnghttp2()
+                    + brotli()
                     + curl()
                     + cryptopp()
                     + jemalloc()
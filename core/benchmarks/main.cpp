@@ -2,6 +2,9 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/impl/static_registration.hpp>
+#include <utils/gbench_allocations.hpp>
+
+USERVER_GBENCH_COUNT_ALLOCATIONS()
 
 int main(int argc, char** argv) {
   USERVER_NAMESPACE::utils::impl::FinishStaticRegistration();
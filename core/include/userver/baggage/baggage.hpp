@@ -4,6 +4,7 @@
 /// @brief @copybrief baggage::Baggage
 
 #include <algorithm>  // TODO: remove
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -20,6 +21,9 @@ namespace baggage {
 using BaggageProperties =
     std::vector<std::pair<std::string, std::optional<std::string>>>;
 
+/// Keys allowed in a baggage, shared by the baggage of all the requests
+using AllowedKeysPtr = std::shared_ptr<const std::unordered_set<std::string>>;
+
 class Baggage;
 class BaggageEntryProperty;
 
@@ -89,10 +93,12 @@ class BaggageEntry {
 class Baggage {
  public:
   Baggage(std::string header, std::unordered_set<std::string> allowed_keys);
+  Baggage(std::string header, AllowedKeysPtr allowed_keys);
   Baggage(const Baggage&) noexcept;
   Baggage(Baggage&&) noexcept;
 
-  std::string ToString() const;
+  /// @return the header value, serialized once on construction
+  const std::string& ToString() const noexcept;
 
   /// @return vector of entries
   const std::vector<BaggageEntry>& GetEntries() const;
@@ -117,6 +123,9 @@ class Baggage {
   /// @brief get baggage allowed keys
   std::unordered_set<std::string> GetAllowedKeys() const;
 
+  /// @brief get baggage allowed keys without copying them
+  const AllowedKeysPtr& GetSharedAllowedKeys() const noexcept;
+
  protected:
   /// @brief parsers
   /// @returns std::nullopt If key, value or properties
@@ -134,7 +143,7 @@ class Baggage {
   void CreateResultHeader();
 
   std::string header_value_;
-  std::unordered_set<std::string> allowed_keys_;
+  AllowedKeysPtr allowed_keys_;
   std::vector<BaggageEntry> entries_;
 
   // result header after parsing entities.
@@ -149,6 +158,10 @@ class Baggage {
 std::optional<Baggage> TryMakeBaggage(
     std::string header, std::unordered_set<std::string> allowed_keys);
 
+/// @overload
+std::optional<Baggage> TryMakeBaggage(std::string header,
+                                      AllowedKeysPtr allowed_keys);
+
 template <typename T>
 bool HasInvalidSymbols(const T& obj) {
   return std::find_if(obj.begin(), obj.end(), [](unsigned char x) {
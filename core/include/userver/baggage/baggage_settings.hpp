@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_set>
 
@@ -11,7 +12,17 @@ USERVER_NAMESPACE_BEGIN
 namespace baggage {
 
 struct BaggageSettings final {
+  BaggageSettings();
+
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  BaggageSettings(std::unordered_set<std::string> allowed_keys);
+
   std::unordered_set<std::string> allowed_keys;
+
+  // The same keys, built once on config update and shared by the baggage of
+  // all the requests instead of copying allowed_keys for each of them.
+  // Filled by the constructors.
+  std::shared_ptr<const std::unordered_set<std::string>> shared_allowed_keys;
 };
 
 BaggageSettings Parse(const formats::json::Value& value,
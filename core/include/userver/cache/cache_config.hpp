@@ -74,6 +74,7 @@ struct Config final {
   std::optional<std::string> task_processor_name;
   std::chrono::milliseconds cleanup_interval{};
   bool is_strong_period{};
+  bool is_heavy_update{};
   std::optional<std::uint64_t> failed_updates_before_expiration;
   bool is_safe_data_lifetime{};
 
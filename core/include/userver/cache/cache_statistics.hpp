@@ -39,6 +39,11 @@ struct Statistics final {
   UpdateStatistics full_update;
   UpdateStatistics incremental_update;
   std::atomic<std::size_t> documents_current_count{0};
+  std::atomic<std::size_t> snapshot_chunks{0};
+  std::atomic<std::size_t> snapshot_shared_chunks{0};
+  std::atomic<std::size_t> snapshot_capacity{0};
+  std::atomic<std::size_t> snapshot_allocated_bytes{0};
+  std::atomic<std::chrono::milliseconds> update_schedule_lag{{}};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats);
@@ -92,6 +92,14 @@ class CacheUpdateTrait {
   // For internal use only.
   void SetDataSizeStatistic(std::size_t size) noexcept;
 
+  // For internal use only.
+  void SetSnapshotSharingStatistic(std::size_t chunks,
+                                   std::size_t shared_chunks) noexcept;
+
+  // For internal use only.
+  void SetSnapshotMemoryStatistic(std::size_t capacity,
+                                  std::size_t allocated_bytes) noexcept;
+
   // For internal use only
   // TODO remove after TAXICOMMON-3959
   engine::TaskProcessor& GetCacheTaskProcessor() const;
@@ -146,6 +154,10 @@ class CacheUpdateTrait {
 
   virtual void ReadAndSet(dump::Reader& reader);
 
+  virtual bool WriteDelta(dump::Writer& writer) const;
+
+  virtual void ReadAndApplyDelta(dump::Reader& reader);
+
   class Impl;
   std::unique_ptr<Impl> impl_;
 };
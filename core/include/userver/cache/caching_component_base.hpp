@@ -30,6 +30,18 @@ USERVER_NAMESPACE_BEGIN
 
 namespace components {
 
+namespace impl {
+
+template <typename T>
+using HasSharingStatistics =
+    decltype(std::declval<const T&>().GetSharingStatistics());
+
+template <typename T>
+using HasMemoryStatistics =
+    decltype(std::declval<const T&>().GetMemoryStatistics());
+
+}  // namespace impl
+
 // clang-format off
 
 /// @ingroup userver_components userver_base_classes
@@ -68,6 +80,7 @@ namespace components {
 /// exception-interval | Used instead of `update-interval` in case of exception | update_interval
 /// additional-cleanup-interval | how often to run background RCU garbage collector | 10 seconds
 /// is-strong-period | whether to include Update execution time in update-interval | false
+/// heavy-update | spread the periodic updates of the heavy caches across update-interval and run at most 2 of them at once process-wide | false
 /// testsuite-force-periodic-update | override testsuite-periodic-update-enabled in TestsuiteSupport component config | --
 /// failed-updates-before-expiration | the number of consecutive failed updates for data expiration | --
 /// has-pre-assign-check | enables the check before changing the value in the cache, by default it is the check that the new value is not empty | false
@@ -296,6 +309,23 @@ void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
     PreAssignCheck(old_value->get(), new_value.get());
   }
 
+  // For structurally shared containers, e.g. cache::SharedChunkedMap, report
+  // how much of the new snapshot is shared with the previous ones
+  if constexpr (meta::kIsDetected<impl::HasSharingStatistics, T>) {
+    if (new_value) {
+      const auto stats = new_value->GetSharingStatistics();
+      SetSnapshotSharingStatistic(stats.chunks, stats.shared_chunks);
+    }
+  }
+
+  // For flat containers, e.g. cache::FlatHashMap, report the allocated memory
+  if constexpr (meta::kIsDetected<impl::HasMemoryStatistics, T>) {
+    if (new_value) {
+      const auto stats = new_value->GetMemoryStatistics();
+      SetSnapshotMemoryStatistic(stats.capacity, stats.allocated_bytes);
+    }
+  }
+
   cache_.Assign(new_value);
   event_channel_.SendEvent(new_value);
   OnCacheModified();
@@ -3,20 +3,30 @@
 /// @file userver/cache/expirable_lru_cache.hpp
 /// @brief @copybrief cache::ExpirableLruCache
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
 
 #include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_cache_statistics.hpp>
 #include <userver/cache/nway_lru_cache.hpp>
-#include <userver/concurrent/mutex_set.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/utils/datetime.hpp>
+#include <userver/utils/filter_bloom.hpp>
 #include <userver/utils/impl/cached_time.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/meta.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -47,12 +57,65 @@ impl::ExpirableValue<Value> Read(dump::Reader& reader,
       reader.Read<std::chrono::system_clock::time_point>() - now + steady_now};
 }
 
+/// Second hash of the double hashing in the negative cache filter, derived
+/// from the user-provided hash by a 64-bit finalizer mix
+template <typename Key, typename Hash>
+struct NegativeCacheHash final {
+  std::size_t operator()(const Key& key) const {
+    auto result = static_cast<std::uint64_t>(hash(key));
+    result ^= result >> 33;
+    result *= 0xff51afd7ed558ccdULL;
+    result ^= result >> 33;
+    result *= 0xc4ceb9fe1a85ec53ULL;
+    result ^= result >> 33;
+    // a zero second hash would map all the probes to the same counter
+    return static_cast<std::size_t>(result | 1);
+  }
+
+  Hash hash;
+};
+
+template <typename Key, typename Hash>
+struct NegativeCache final {
+  NegativeCache(std::size_t size, const Hash& hash)
+      : size(size), filter(size, hash, NegativeCacheHash<Key, Hash>{hash}) {}
+
+  void Reset(std::chrono::steady_clock::time_point now) {
+    filter.Clear();
+    reset_time = now;
+  }
+
+  void ResetIfDecayed(std::chrono::steady_clock::time_point now) {
+    if (decay.count() != 0 && reset_time + decay < now) Reset(now);
+  }
+
+  const std::size_t size;
+  utils::FilterBloom<Key, unsigned, Hash, NegativeCacheHash<Key, Hash>> filter;
+  std::chrono::milliseconds decay{0};
+  std::chrono::steady_clock::time_point reset_time{};
+};
+
+/// Update of a key that is shared by all the concurrent misses of the key
+template <typename Value>
+struct InFlightFetch final {
+  engine::Mutex mutex;
+  engine::ConditionVariable cv;
+  bool finished{false};
+  // empty if the update function has thrown
+  std::optional<Value> value;
+  // guarded by the in-flight fetches mutex of the cache
+  bool use_cache{false};
+};
+
 }  // namespace impl
 
 /// @ingroup userver_containers
 /// @brief Class for expirable LRU cache. Use cache::LruMap for not expirable
 /// LRU Cache.
 ///
+/// Concurrent misses of the same key are coalesced: only one of them calls the
+/// update function, the others wait for its result.
+///
 /// Example usage:
 ///
 /// @snippet cache/expirable_lru_cache_test.cpp Sample ExpirableLruCache
@@ -68,10 +131,11 @@ class ExpirableLruCache final {
     kUseCache,   ///< Cache value got from update function
   };
 
-  /// For the description of `ways` and `way_size`,
+  /// For the description of `ways`, `way_size` and `policy`,
   /// see the cache::NWayLRU::NWayLRU constructor.
   ExpirableLruCache(size_t ways, size_t way_size, const Hash& hash = Hash(),
-                    const Equal& equal = Equal());
+                    const Equal& equal = Equal(),
+                    CachePolicy policy = CachePolicy::kLru);
 
   ~ExpirableLruCache();
 
@@ -90,10 +154,34 @@ class ExpirableLruCache final {
    */
   void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+  /**
+   * Sets the maximum jitter of the background update. Values are updated in
+   * background after half of their lifetime minus a per-key offset in
+   * [0, jitter], so the keys written at once are not refreshed at once.
+   * The jitter is clamped to half of the lifetime.
+   */
+  void SetBackgroundUpdateJitter(std::chrono::milliseconds jitter);
+
+  /**
+   * Enables the negative cache for the keys, for which the update function
+   * returns an empty `std::optional`. Such keys are not stored in the LRU, but
+   * in a counting Bloom filter of `size` counters, and repeated lookups of
+   * them are answered with an empty value without calling the update function.
+   *
+   * The filter may report false positives, so it is reset every `decay`
+   * (0 is unlimited) and when a key it reports is put into the cache or
+   * invalidated. `size` of 0 disables the negative cache.
+   *
+   * @note Available only for `std::optional` values.
+   */
+  void SetNegativeCache(std::size_t size, std::chrono::milliseconds decay);
+
   /**
    * @returns GetOptional("key", update_func) if it is not std::nullopt.
    * Otherwise the result of update_func(key) is returned, and additionally
-   * stored in cache if "read_mode" is kUseCache.
+   * stored in cache if "read_mode" is kUseCache. If the key is being updated
+   * by a concurrent Get() or a background update, waits for its result
+   * instead of calling update_func.
    */
   Value Get(const Key& key, const UpdateValueFunc& update_func,
             ReadMode read_mode = ReadMode::kUseCache);
@@ -156,24 +244,64 @@ class ExpirableLruCache final {
   bool IsExpired(std::chrono::steady_clock::time_point update_time,
                  std::chrono::steady_clock::time_point now) const;
 
-  bool ShouldUpdate(std::chrono::steady_clock::time_point update_time,
+  bool ShouldUpdate(const Key& key,
+                    std::chrono::steady_clock::time_point update_time,
                     std::chrono::steady_clock::time_point now) const;
 
+  using InFlightFetch = impl::InFlightFetch<Value>;
+
+  Value FetchCoalesced(const Key& key, const UpdateValueFunc& update_func,
+                       ReadMode read_mode,
+                       std::chrono::steady_clock::time_point now);
+
+  Value RunFetch(const Key& key, const UpdateValueFunc& update_func,
+                 InFlightFetch& fetch,
+                 std::chrono::steady_clock::time_point now);
+
+  void FinishFetch(const Key& key, InFlightFetch& fetch,
+                   const std::optional<Value>& value,
+                   std::chrono::steady_clock::time_point now);
+
+  void StoreValue(const Key& key, const Value& value,
+                  std::chrono::steady_clock::time_point now);
+
+  static bool IsEmptyValue(const Value& value);
+
+  bool IsNegativeCached(const Key& key,
+                        std::chrono::steady_clock::time_point now);
+
+  void AddNegative(const Key& key, std::chrono::steady_clock::time_point now);
+
+  /// Resets the negative cache filter if it reports the key
+  bool ForgetNegative(const Key& key);
+
+  static constexpr bool kIsNegativeCacheSupported = meta::kIsOptional<Value>;
+
   cache::NWayLRU<Key, impl::ExpirableValue<Value>, Hash, Equal> lru_;
   std::atomic<std::chrono::milliseconds> max_lifetime_{
       std::chrono::milliseconds(0)};
   std::atomic<BackgroundUpdateMode> background_update_mode_{
       BackgroundUpdateMode::kDisabled};
+  std::atomic<std::chrono::milliseconds> background_update_jitter_{
+      std::chrono::milliseconds(0)};
   impl::ExpirableLruCacheStatistics stats_;
-  concurrent::MutexSet<Key, Hash, Equal> mutex_set_;
+  engine::Mutex in_flight_mutex_;
+  std::unordered_map<Key, std::shared_ptr<InFlightFetch>, Hash, Equal>
+      in_flight_;
+  const Hash hash_;
+  std::atomic<bool> negative_cache_enabled_{false};
+  engine::Mutex negative_cache_mutex_;
+  std::optional<impl::NegativeCache<Key, Hash>> negative_cache_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
-    size_t ways, size_t way_size, const Hash& hash, const Equal& equal)
-    : lru_(ways, way_size, hash, equal),
-      mutex_set_{ways, way_size, hash, equal} {}
+    size_t ways, size_t way_size, const Hash& hash, const Equal& equal,
+    CachePolicy policy)
+    : lru_(ways, way_size, hash, equal, policy),
+      in_flight_(0, hash, equal),
+      hash_(hash) {}
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::~ExpirableLruCache() {
@@ -203,6 +331,33 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(
   background_update_mode_ = background_update;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdateJitter(
+    std::chrono::milliseconds jitter) {
+  background_update_jitter_ = jitter;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetNegativeCache(
+    std::size_t size, std::chrono::milliseconds decay) {
+  static_assert(kIsNegativeCacheSupported,
+                "Negative cache requires std::optional values");
+
+  std::lock_guard lock(negative_cache_mutex_);
+  if (size == 0) {
+    negative_cache_enabled_ = false;
+    negative_cache_.reset();
+    return;
+  }
+
+  if (!negative_cache_ || negative_cache_->size != size) {
+    negative_cache_.emplace(size, hash_);
+    negative_cache_->Reset(utils::datetime::SteadyNow());
+  }
+  negative_cache_->decay = decay;
+  negative_cache_enabled_ = true;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode) {
@@ -212,20 +367,93 @@ Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     return std::move(*opt_old_value);
   }
 
-  auto mutex = mutex_set_.GetMutexForKey(key);
-  std::lock_guard lock(mutex);
-  // Test one more time - concurrent ExpirableLruCache::Get()
-  // might have put the value
-  auto old_value = lru_.Get(key);
-  if (old_value && !IsExpired(old_value->update_time, now)) {
-    return std::move(old_value->value);
+  return FetchCoalesced(key, update_func, read_mode, now);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value ExpirableLruCache<Key, Value, Hash, Equal>::FetchCoalesced(
+    const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode,
+    std::chrono::steady_clock::time_point now) {
+  while (true) {
+    std::shared_ptr<InFlightFetch> fetch;
+    bool is_leader = false;
+    {
+      std::lock_guard lock(in_flight_mutex_);
+      // Test one more time - concurrent fetch might have put the value
+      auto old_value = lru_.Get(key);
+      if (old_value && !IsExpired(old_value->update_time, now)) {
+        return std::move(old_value->value);
+      }
+      if (!old_value && IsNegativeCached(key, now)) {
+        impl::CacheNegativeHit(stats_);
+        return Value{};
+      }
+
+      auto& in_flight = in_flight_[key];
+      if (!in_flight) {
+        in_flight = std::make_shared<InFlightFetch>();
+        is_leader = true;
+      }
+      in_flight->use_cache |= (read_mode == ReadMode::kUseCache);
+      fetch = in_flight;
+    }
+
+    if (is_leader) return RunFetch(key, update_func, *fetch, now);
+
+    impl::CacheCoalescedWait(stats_);
+    std::unique_lock lock(fetch->mutex);
+    if (!fetch->cv.Wait(lock, [&fetch] { return fetch->finished; })) {
+      throw engine::WaitInterruptedException(
+          engine::current_task::CancellationReason());
+    }
+    if (fetch->value) return *fetch->value;
+    // The update function has thrown in another task, retry the fetch
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value ExpirableLruCache<Key, Value, Hash, Equal>::RunFetch(
+    const Key& key, const UpdateValueFunc& update_func, InFlightFetch& fetch,
+    std::chrono::steady_clock::time_point now) {
+  std::optional<Value> value;
+  try {
+    value.emplace(update_func(key));
+  } catch (...) {
+    FinishFetch(key, fetch, std::nullopt, now);
+    throw;
+  }
+  FinishFetch(key, fetch, value, now);
+  return std::move(*value);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::FinishFetch(
+    const Key& key, InFlightFetch& fetch, const std::optional<Value>& value,
+    std::chrono::steady_clock::time_point now) {
+  {
+    std::lock_guard lock(in_flight_mutex_);
+    if (value && fetch.use_cache) StoreValue(key, *value, now);
+    in_flight_.erase(key);
   }
 
-  auto value = update_func(key);
-  if (read_mode == ReadMode::kUseCache) {
+  {
+    std::lock_guard lock(fetch.mutex);
+    fetch.value = value;
+    fetch.finished = true;
+  }
+  fetch.cv.NotifyAll();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::StoreValue(
+    const Key& key, const Value& value,
+    std::chrono::steady_clock::time_point now) {
+  if (IsEmptyValue(value) && negative_cache_enabled_) {
+    lru_.InvalidateByKey(key);
+    AddNegative(key, now);
+  } else {
     lru_.Put(key, {value, now});
   }
-  return value;
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -238,7 +466,7 @@ std::optional<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(
     if (!IsExpired(old_value->update_time, now)) {
       impl::CacheHit(stats_);
 
-      if (ShouldUpdate(old_value->update_time, now)) {
+      if (ShouldUpdate(key, old_value->update_time, now)) {
         UpdateInBackground(key, update_func);
       }
 
@@ -246,6 +474,9 @@ std::optional<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(
     } else {
       impl::CacheStale(stats_);
     }
+  } else if (IsNegativeCached(key, now)) {
+    impl::CacheNegativeHit(stats_);
+    return Value{};
   }
   impl::CacheMiss(stats_);
 
@@ -277,7 +508,7 @@ ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalUnexpirableWithUpdate(
   if (old_value) {
     impl::CacheHit(stats_);
 
-    if (ShouldUpdate(old_value->update_time, now)) {
+    if (ShouldUpdate(key, old_value->update_time, now)) {
       UpdateInBackground(key, update_func);
     }
 
@@ -312,12 +543,18 @@ ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalNoUpdate(
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Put(const Key& key,
                                                      const Value& value) {
+  if (!IsEmptyValue(value) && ForgetNegative(key)) {
+    impl::CacheNegativeFalsePositive(stats_);
+  }
   lru_.Put(key, {value, utils::datetime::SteadyNow()});
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Put(const Key& key,
                                                      Value&& value) {
+  if (!IsEmptyValue(value) && ForgetNegative(key)) {
+    impl::CacheNegativeFalsePositive(stats_);
+  }
   lru_.Put(key, {std::move(value), utils::datetime::SteadyNow()});
 }
 
@@ -335,12 +572,17 @@ size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetSizeApproximate() const {
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Invalidate() {
   lru_.Invalidate();
+  if (negative_cache_enabled_) {
+    std::lock_guard lock(negative_cache_mutex_);
+    if (negative_cache_) negative_cache_->Reset(utils::datetime::SteadyNow());
+  }
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::InvalidateByKey(
     const Key& key) {
   lru_.InvalidateByKey(key);
+  ForgetNegative(key);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -352,16 +594,20 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateInBackground(
   // cache will wait for all detached tasks in ~ExpirableLruCache()
   engine::AsyncNoSpan([token = wait_token_storage_.GetToken(), this, key,
                        update_func = std::move(update_func)] {
-    auto mutex = mutex_set_.GetMutexForKey(key);
-    std::unique_lock lock(mutex, std::try_to_lock);
-    if (!lock) {
-      // someone is updating the key right now
-      return;
+    std::shared_ptr<InFlightFetch> fetch;
+    {
+      std::lock_guard lock(in_flight_mutex_);
+      auto& in_flight = in_flight_[key];
+      if (in_flight) {
+        // someone is updating the key right now
+        return;
+      }
+      in_flight = std::make_shared<InFlightFetch>();
+      in_flight->use_cache = true;
+      fetch = in_flight;
     }
 
-    auto now = utils::datetime::SteadyNow();
-    auto value = update_func(key);
-    lru_.Put(key, {value, now});
+    RunFetch(key, update_func, *fetch, utils::datetime::SteadyNow());
   }).Detach();
 }
 
@@ -375,11 +621,68 @@ bool ExpirableLruCache<Key, Value, Hash, Equal>::IsExpired(
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldUpdate(
-    std::chrono::steady_clock::time_point update_time,
+    const Key& key, std::chrono::steady_clock::time_point update_time,
     std::chrono::steady_clock::time_point now) const {
   auto max_lifetime = max_lifetime_.load();
-  return (background_update_mode_.load() == BackgroundUpdateMode::kEnabled) &&
-         max_lifetime.count() != 0 && update_time + max_lifetime / 2 < now;
+  if (background_update_mode_.load() != BackgroundUpdateMode::kEnabled ||
+      max_lifetime.count() == 0) {
+    return false;
+  }
+
+  auto update_after = max_lifetime / 2;
+  const auto jitter = std::min(background_update_jitter_.load(), update_after);
+  if (jitter.count() != 0) {
+    // The offset depends only on the key, so a key is updated once per
+    // lifetime, while the keys written at once are updated at different times
+    update_after -= std::chrono::milliseconds(
+        hash_(key) % static_cast<std::size_t>(jitter.count() + 1));
+  }
+  return update_time + update_after < now;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool ExpirableLruCache<Key, Value, Hash, Equal>::IsEmptyValue(
+    const Value& value) {
+  if constexpr (kIsNegativeCacheSupported) {
+    return !value.has_value();
+  } else {
+    return false;
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool ExpirableLruCache<Key, Value, Hash, Equal>::IsNegativeCached(
+    const Key& key, std::chrono::steady_clock::time_point now) {
+  if (!negative_cache_enabled_) return false;
+
+  std::lock_guard lock(negative_cache_mutex_);
+  if (!negative_cache_) return false;
+
+  negative_cache_->ResetIfDecayed(now);
+  return negative_cache_->filter.Has(key);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::AddNegative(
+    const Key& key, std::chrono::steady_clock::time_point now) {
+  std::lock_guard lock(negative_cache_mutex_);
+  if (!negative_cache_) return;
+
+  negative_cache_->ResetIfDecayed(now);
+  negative_cache_->filter.Increment(key);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool ExpirableLruCache<Key, Value, Hash, Equal>::ForgetNegative(
+    const Key& key) {
+  if (!negative_cache_enabled_) return false;
+
+  std::lock_guard lock(negative_cache_mutex_);
+  if (!negative_cache_ || !negative_cache_->filter.Has(key)) return false;
+
+  // The filter can not remove a single key, it is reset instead
+  negative_cache_->Reset(utils::datetime::SteadyNow());
+  return true;
 }
 
 template <typename Key, typename Value, typename Hash = std::hash<Key>,
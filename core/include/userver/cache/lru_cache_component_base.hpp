@@ -4,6 +4,7 @@
 /// @brief @copybrief cache::LruCacheComponent
 
 #include <functional>
+#include <stdexcept>
 
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/cache/lru_cache_config.hpp>
@@ -15,6 +16,7 @@
 #include <userver/dynamic_config/source.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/cache_control.hpp>
+#include <userver/utils/meta.hpp>
 #include <userver/utils/statistics/entry.hpp>
 #include <userver/yaml_config/schema.hpp>
 
@@ -57,7 +59,12 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// ---- | ----------- | -------------
 /// size | max amount of items to store in cache | --
 /// ways | number of ways for associative cache | --
+/// policy | eviction policy of the ways: `lru` or `clock` (lock-free hits, approximate recency), see cache::CachePolicy | lru
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
+/// background-update | enables asynchronous updates for expiring values | false
+/// background-update-jitter | max per-key offset of the background update before half of the lifetime, see cache::ExpirableLruCache::SetBackgroundUpdateJitter | 0
+/// negative-cache-size | number of counters of the negative cache filter for the keys with empty `std::optional` values (0 disables it), see cache::ExpirableLruCache::SetNegativeCache | 0
+/// negative-cache-decay | reset period of the negative cache filter (0 is unlimited) | 0
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
 ///
 /// ## Example usage:
@@ -103,6 +110,8 @@ class LruCacheComponent : public components::ComponentBase,
 
   void UpdateConfig(const LruCacheConfig& config);
 
+  void UpdateNegativeCache(const LruCacheConfig& config);
+
   static constexpr bool kCacheIsDumpable =
       dump::kIsDumpable<Key> && dump::kIsDumpable<Value>;
 
@@ -129,7 +138,8 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
       cache_(std::make_shared<Cache>(static_config_.ways,
-                                     static_config_.GetWaySize())) {
+                                     static_config_.GetWaySize(), Hash(),
+                                     Equal(), static_config_.policy)) {
   if (impl::IsDumpSupportEnabled(config)) {
     dumper_ = std::make_shared<dump::Dumper>(
         config, context, static_cast<dump::DumpableEntity&>(*this));
@@ -139,6 +149,9 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
 
   cache_->SetMaxLifetime(static_config_.config.lifetime);
   cache_->SetBackgroundUpdate(static_config_.config.background_update);
+  cache_->SetBackgroundUpdateJitter(
+      static_config_.config.background_update_jitter);
+  UpdateNegativeCache(static_config_.config);
 
   if (static_config_.use_dynamic_config) {
     LOG_INFO() << "Dynamic LRU cache config is enabled, subscribing on "
@@ -206,6 +219,21 @@ void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(
   cache_->SetWaySize(config.GetWaySize(static_config_.ways));
   cache_->SetMaxLifetime(config.lifetime);
   cache_->SetBackgroundUpdate(config.background_update);
+  cache_->SetBackgroundUpdateJitter(config.background_update_jitter);
+  UpdateNegativeCache(config);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::UpdateNegativeCache(
+    const LruCacheConfig& config) {
+  if constexpr (meta::kIsOptional<Value>) {
+    cache_->SetNegativeCache(config.negative_cache_size,
+                             config.negative_cache_decay);
+  } else if (config.negative_cache_size != 0) {
+    throw std::runtime_error(
+        "negative-cache-size is set for the LRU cache '" + name_ +
+        "', but its values are not std::optional");
+  }
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -3,8 +3,10 @@
 #include <chrono>
 #include <cstddef>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
 
+#include <userver/cache/nway_lru_cache.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -30,11 +32,21 @@ struct LruCacheConfig final {
   std::size_t size;
   std::chrono::milliseconds lifetime;
   BackgroundUpdateMode background_update;
+  std::chrono::milliseconds background_update_jitter;
+  /// Number of counters of the negative cache filter, 0 disables it
+  std::size_t negative_cache_size;
+  /// Period of the negative cache filter reset (0 is unlimited)
+  std::chrono::milliseconds negative_cache_decay;
 };
 
 LruCacheConfig Parse(const formats::json::Value& value,
                      formats::parse::To<LruCacheConfig>);
 
+CachePolicy Parse(const yaml_config::YamlConfig& config,
+                  formats::parse::To<CachePolicy>);
+
+std::string_view ToString(CachePolicy policy);
+
 struct LruCacheConfigStatic final {
   explicit LruCacheConfigStatic(const yaml_config::YamlConfig& config);
   explicit LruCacheConfigStatic(const components::ComponentConfig& config);
@@ -43,6 +55,7 @@ struct LruCacheConfigStatic final {
 
   LruCacheConfig config;
   std::size_t ways;
+  CachePolicy policy;
   bool use_dynamic_config;
 };
 
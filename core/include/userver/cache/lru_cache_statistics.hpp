@@ -16,6 +16,9 @@ struct ExpirableLruCacheStatisticsBase final {
   std::atomic<std::size_t> misses{0};
   std::atomic<std::size_t> stale{0};
   std::atomic<std::size_t> background_updates{0};
+  std::atomic<std::size_t> negative_hits{0};
+  std::atomic<std::size_t> negative_false_positives{0};
+  std::atomic<std::size_t> coalesced_waits{0};
 
   ExpirableLruCacheStatisticsBase();
 
@@ -40,6 +43,12 @@ void CacheMiss(ExpirableLruCacheStatistics& stats);
 
 void CacheStale(ExpirableLruCacheStatistics& stats);
 
+void CacheNegativeHit(ExpirableLruCacheStatistics& stats);
+
+void CacheNegativeFalsePositive(ExpirableLruCacheStatistics& stats);
+
+void CacheCoalescedWait(ExpirableLruCacheStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const ExpirableLruCacheStatistics& stats);
 
@@ -2,19 +2,33 @@
 
 #include <functional>
 #include <optional>
+#include <shared_mutex>
+#include <variant>
 #include <vector>
 
 #include <boost/container_hash/hash.hpp>
 
+#include <userver/cache/impl/clock.hpp>
 #include <userver/cache/lru_map.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/operations.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/shared_mutex.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace cache {
 
+/// @brief Eviction policy of the cache::NWayLRU ways
+enum class CachePolicy {
+  /// Exact LRU, each lookup takes the mutex of the way to update the recency
+  kLru,
+  /// CLOCK approximation of LRU. Lookups take the way for reading and only
+  /// set the atomic reference bit of the element, so they do not contend with
+  /// each other. Insertions and evictions take the way exclusively.
+  kClock,
+};
+
 /// @ingroup userver_containers
 template <typename T, typename U, typename Hash = std::hash<T>,
           typename Equal = std::equal_to<T>>
@@ -32,12 +46,18 @@ class NWayLRU final {
   /// the size of a way reaches this number, existing elements are deleted
   /// according to the LRU policy.
   ///
+  /// @param policy chooses between the exact LRU and its CLOCK approximation,
+  /// see cache::CachePolicy. Use cache::CachePolicy::kClock for read-heavy
+  /// caches with hot keys.
+  ///
   /// The maximum total number of elements is `ways * way_size`.
   NWayLRU(size_t ways, size_t way_size, const Hash& hash = Hash(),
-          const Equal& equal = Equal());
+          const Equal& equal = Equal(), CachePolicy policy = CachePolicy::kLru);
 
   void Put(const T& key, U value);
 
+  /// @note With cache::CachePolicy::kClock the validator may be called twice
+  /// for an invalid element.
   template <typename Validator>
   std::optional<U> Get(const T& key, Validator validator);
 
@@ -69,43 +89,155 @@ class NWayLRU final {
   void SetDumper(std::shared_ptr<dump::Dumper> dumper);
 
  private:
-  struct Way {
-    Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
+  struct LruWay {
+    LruWay(LruWay&& other) noexcept : cache(std::move(other.cache)) {}
 
     // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
-    Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+    LruWay(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+
+    void Put(const T& key, U value) {
+      std::unique_lock<engine::Mutex> lock(mutex);
+      cache.Put(key, std::move(value));
+    }
+
+    template <typename Validator>
+    std::optional<U> Get(const T& key, Validator& validator) {
+      std::unique_lock<engine::Mutex> lock(mutex);
+      auto* value = cache.Get(key);
+
+      if (value) {
+        if (validator(*value)) return *value;
+        cache.Erase(key);
+      }
+
+      return std::nullopt;
+    }
+
+    U GetOr(const T& key, const U& default_value) {
+      std::unique_lock<engine::Mutex> lock(mutex);
+      return cache.GetOr(key, default_value);
+    }
+
+    void Erase(const T& key) {
+      std::unique_lock<engine::Mutex> lock(mutex);
+      cache.Erase(key);
+    }
+
+    void Clear() {
+      std::unique_lock<engine::Mutex> lock(mutex);
+      cache.Clear();
+    }
+
+    void SetMaxSize(size_t max_size) {
+      std::unique_lock<engine::Mutex> lock(mutex);
+      cache.SetMaxSize(max_size);
+    }
+
+    template <typename Function>
+    void Read(Function& func) const {
+      std::unique_lock<engine::Mutex> lock(mutex);
+      func(cache);
+    }
 
     mutable engine::Mutex mutex;
     LruMap<T, U, Hash, Equal> cache;
   };
 
-  Way& GetWay(const T& key);
+  struct ClockWay {
+    ClockWay(ClockWay&& other) noexcept : cache(std::move(other.cache)) {}
+
+    // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
+    ClockWay(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+
+    void Put(const T& key, U value) {
+      std::unique_lock lock(mutex);
+      cache.Put(key, std::move(value));
+    }
+
+    template <typename Validator>
+    std::optional<U> Get(const T& key, Validator& validator) {
+      {
+        std::shared_lock lock(mutex);
+        const auto* value = cache.Get(key);
+        if (!value) return std::nullopt;
+        if (validator(*value)) return *value;
+      }
+
+      // The element could have been replaced while the lock was released
+      std::unique_lock lock(mutex);
+      const auto* value = cache.Get(key);
+      if (value && !validator(*value)) cache.Erase(key);
+      return std::nullopt;
+    }
+
+    U GetOr(const T& key, const U& default_value) {
+      std::shared_lock lock(mutex);
+      const auto* value = cache.Get(key);
+      return value ? *value : default_value;
+    }
+
+    void Erase(const T& key) {
+      std::unique_lock lock(mutex);
+      cache.Erase(key);
+    }
+
+    void Clear() {
+      std::unique_lock lock(mutex);
+      cache.Clear();
+    }
+
+    void SetMaxSize(size_t max_size) {
+      std::unique_lock lock(mutex);
+      cache.SetMaxSize(max_size);
+    }
+
+    template <typename Function>
+    void Read(Function& func) const {
+      std::shared_lock lock(mutex);
+      func(cache);
+    }
+
+    mutable engine::SharedMutex mutex;
+    impl::ClockBase<T, U, Hash, Equal> cache;
+  };
+
+  template <typename Function>
+  decltype(auto) VisitWay(const T& key, Function func);
+
+  template <typename Function>
+  void VisitWays(Function func);
+
+  template <typename Function>
+  void VisitWays(Function func) const;
 
   void NotifyDumper();
 
-  std::vector<Way> caches_;
+  std::variant<std::vector<LruWay>, std::vector<ClockWay>> caches_;
   Hash hash_fn_;
   std::shared_ptr<dump::Dumper> dumper_{nullptr};
 };
 
 template <typename T, typename U, typename Hash, typename Eq>
 NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash,
-                                 const Eq& equal)
+                                 const Eq& equal, CachePolicy policy)
     : caches_(), hash_fn_(hash) {
-  caches_.reserve(ways);
-  for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
+  if (policy == CachePolicy::kClock) {
+    caches_.template emplace<std::vector<ClockWay>>();
+  }
+  std::visit(
+      [&](auto& caches) {
+        caches.reserve(ways);
+        for (size_t i = 0; i < ways; ++i) caches.emplace_back(hash, equal);
+      },
+      caches_);
   if (ways == 0) throw std::logic_error("Ways must be positive");
 
-  for (auto& way : caches_) way.cache.SetMaxSize(way_size);
+  VisitWays([way_size](auto& way) { way.SetMaxSize(way_size); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
-  auto& way = GetWay(key);
-  {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Put(key, std::move(value));
-  }
+  VisitWay(key, [&](auto& way) { way.Put(key, std::move(value)); });
   NotifyDumper();
 }
 
@@ -113,98 +245,104 @@ template <typename T, typename U, typename Hash, typename Eq>
 template <typename Validator>
 std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key,
                                               Validator validator) {
-  auto& way = GetWay(key);
-  std::unique_lock<engine::Mutex> lock(way.mutex);
-  auto* value = way.cache.Get(key);
-
-  if (value) {
-    if (validator(*value)) return *value;
-    way.cache.Erase(key);
-  }
-
-  return std::nullopt;
+  return VisitWay(key, [&](auto& way) { return way.Get(key, validator); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
-  auto& way = GetWay(key);
-  {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Erase(key);
-  }
+  VisitWay(key, [&](auto& way) { way.Erase(key); });
   NotifyDumper();
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
-  auto& way = GetWay(key);
-  std::unique_lock<engine::Mutex> lock(way.mutex);
-  return way.cache.GetOr(key, default_value);
+  return VisitWay(key,
+                  [&](auto& way) { return way.GetOr(key, default_value); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
-  for (auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Clear();
-  }
+  VisitWays([](auto& way) { way.Clear(); });
   NotifyDumper();
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
-  for (const auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.VisitAll(func);
-  }
+  VisitWays([&func](const auto& way) {
+    auto visitor = [&func](const auto& cache) { cache.VisitAll(func); };
+    way.Read(visitor);
+  });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
   size_t size{0};
-  for (const auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    size += way.cache.GetSize();
-  }
+  VisitWays([&size](const auto& way) {
+    auto visitor = [&size](const auto& cache) { size += cache.GetSize(); };
+    way.Read(visitor);
+  });
   return size;
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
-  for (auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.SetMaxSize(way_size);
-  }
+  VisitWays([way_size](auto& way) { way.SetMaxSize(way_size); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
-typename NWayLRU<T, U, Hash, Eq>::Way& NWayLRU<T, U, Hash, Eq>::GetWay(
-    const T& key) {
+template <typename Function>
+decltype(auto) NWayLRU<T, U, Hash, Eq>::VisitWay(const T& key,
+                                                 Function func) {
   /// It is needed to twist hash because there is hash map in LruMap. Otherwise
   /// nodes will fall into one bucket. According to
   /// https://www.boost.org/doc/libs/1_83_0/libs/container_hash/doc/html/hash.html#notes_hash_combine
   /// hash_combine can be treated as hash itself
   auto seed = hash_fn_(key);
   boost::hash_combine(seed, 0);
-  auto n = seed % caches_.size();
-  return caches_[n];
+  return std::visit(
+      [&](auto& caches) -> decltype(auto) {
+        return func(caches[seed % caches.size()]);
+      },
+      caches_);
 }
 
-template <typename T, typename U, typename Hash, typename Equal>
-void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
-  writer.Write(caches_.size());
-
-  for (const Way& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Function>
+void NWayLRU<T, U, Hash, Eq>::VisitWays(Function func) {
+  std::visit(
+      [&func](auto& caches) {
+        for (auto& way : caches) func(way);
+      },
+      caches_);
+}
 
-    writer.Write(way.cache.GetSize());
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Function>
+void NWayLRU<T, U, Hash, Eq>::VisitWays(Function func) const {
+  std::visit(
+      [&func](const auto& caches) {
+        for (const auto& way : caches) func(way);
+      },
+      caches_);
+}
 
-    way.cache.VisitAll([&writer](const T& key, const U& value) {
-      writer.Write(key);
-      writer.Write(value);
-    });
-  }
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
+  writer.Write(std::visit([](const auto& caches) { return caches.size(); },
+                          caches_));
+
+  VisitWays([&writer](const auto& way) {
+    auto visitor = [&writer](const auto& cache) {
+      writer.Write(cache.GetSize());
+
+      cache.VisitAll([&writer](const T& key, const U& value) {
+        writer.Write(key);
+        writer.Write(value);
+      });
+    };
+    way.Read(visitor);
+  });
 }
 
 template <typename T, typename U, typename Hash, typename Equal>
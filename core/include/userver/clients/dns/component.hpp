@@ -33,6 +33,7 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-refresh-ahead | how long before the expiration a requested record is refreshed in background | network-timeout
 ///
 /// ## Static configuration example:
 ///
@@ -4,6 +4,7 @@
 /// @brief @copybrief clients::dns::ResolverConfig
 
 #include <chrono>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -39,6 +40,10 @@ struct ResolverConfig {
 
   /// Network cache failure TTL
   std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+  /// How long before the expiration a requested record is refreshed in
+  /// background, network_timeout if not set
+  std::optional<std::chrono::milliseconds> cache_refresh_ahead;
 };
 
 }  // namespace clients::dns
@@ -3,6 +3,10 @@
 /// @file userver/clients/dns/resolver.hpp
 /// @brief @copybrief clients::dns::Resolver
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <userver/clients/dns/common.hpp>
 #include <userver/clients/dns/config.hpp>
 #include <userver/clients/dns/exception.hpp>
@@ -34,6 +38,16 @@ class Resolver {
     utils::statistics::RelaxedCounter<size_t> network_failure{0};
   };
 
+  /// Network queries made for a domain name
+  struct NameQueryCounters {
+    /// queries the callers had to wait for
+    size_t foreground{0};
+    /// refreshes of the records before or after their expiration
+    size_t background{0};
+    /// failed queries of both kinds
+    size_t failures{0};
+  };
+
   Resolver(engine::TaskProcessor& fs_task_processor,
            const ResolverConfig& config);
   Resolver(const Resolver&) = delete;
@@ -54,6 +68,11 @@ class Resolver {
   /// Returns lookup source counters.
   const LookupSourceCounters& GetLookupSourceCounters() const;
 
+  /// Returns network query counters of the names in the network results
+  /// cache. Counters of a name are reset once it leaves the cache.
+  std::vector<std::pair<std::string, NameQueryCounters>> GetNameQueryCounters()
+      const;
+
   /// Forces the reload of lookup table file. Waits until the reload is done.
   void ReloadHosts();
 
@@ -7,7 +7,12 @@
 #error Use clients::Http from clients/http.hpp instead
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -53,6 +58,7 @@ class Statistics;
 struct PoolStatistics;
 struct InstanceStatistics;
 class DestinationStatistics;
+class ConnectionAffinity;
 
 /// @ingroup userver_clients
 ///
@@ -98,6 +104,17 @@ class Client final {
 
   // For internal use only.
   const http::DestinationStatistics& GetDestinationStatistics() const;
+  /// @endcond
+
+  /// @brief Returns the timing percentile of the requests recently finished
+  /// for the destination of the @a url, std::nullopt if there were none.
+  ///
+  /// Requests with an explicit Request::SetDestinationMetricName() are
+  /// accounted under that name rather than under the @a url.
+  std::optional<std::chrono::milliseconds> GetDestinationTimingPercentile(
+      const std::string& url, double percent) const;
+
+  /// @cond
 
   // For internal use only.
   void SetTestsuiteConfig(const TestsuiteConfig& config);
@@ -107,6 +124,10 @@ class Client final {
 
   // For internal use only.
   void SetConfig(const impl::Config&);
+
+  // Starts periodic requests to ClientSettings::warmup_urls from each IO
+  // thread. For internal use only.
+  void StartConnectionsWarmup();
   /// @endcond
 
   /// @brief Sets User-Agent headers for all the requests or removes that
@@ -132,6 +153,11 @@ class Client final {
  private:
   void ReinitEasy();
 
+  Request CreateRequestForMulti(size_t multi_index);
+  Request SetupRequest(impl::EasyWrapper&& wrapper, size_t multi_index);
+
+  void WarmupConnections();
+
   InstanceStatistics GetMultiStatistics(size_t n) const;
 
   size_t FindMultiIndex(const curl::multi*) const;
@@ -145,6 +171,15 @@ class Client final {
 
   std::shared_ptr<curl::easy> TryDequeueIdle() noexcept;
 
+  // Connection affinity for EasyWrapper, see ConnectionAffinity
+  bool HasConnectionAffinity() const noexcept {
+    return connection_affinity_ != nullptr;
+  }
+  std::shared_ptr<std::atomic<std::size_t>> BindToOriginMulti(
+      curl::easy& easy, const std::string& origin);
+  void RememberOriginMulti(const curl::easy& easy,
+                           std::atomic<std::size_t>& multi_index) const;
+
   std::atomic<std::size_t> pending_tasks_{0};
 
   const DeadlinePropagationConfig deadline_propagation_config_;
@@ -170,6 +205,11 @@ class Client final {
   utils::SwappingSmart<const curl::easy> easy_;
   utils::PeriodicTask easy_reinit_task_;
 
+  std::unique_ptr<ConnectionAffinity> connection_affinity_;
+  const std::vector<std::string> warmup_urls_;
+  const std::chrono::milliseconds warmup_interval_;
+  utils::PeriodicTask warmup_task_;
+
   // Testsuite support
   std::shared_ptr<const TestsuiteConfig> testsuite_config_;
   rcu::Variable<std::vector<std::string>> allowed_urls_extra_;
@@ -49,6 +49,9 @@ namespace components {
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name. | []
 /// cancellation-policy | Cancellation policy for new requests. | cancel
+/// connection-affinity | route requests to the IO thread that has recently finished a request to the same host, so that its idle connection is reused | false
+/// warmup-urls | URLs to send HEAD requests to from each IO thread at start and then periodically, to keep warm connections to hot destinations | []
+/// warmup-interval | interval between the warmup requests, new connections resolve the host again | 1m
 ///
 /// ## Static configuration example:
 ///
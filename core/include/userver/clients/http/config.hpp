@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -41,6 +42,9 @@ struct ClientSettings final {
   const clients::http::plugins::headers_propagator::HeadersPropagator*
       headers_propagator{nullptr};
   CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+  bool connection_affinity{false};
+  std::vector<std::string> warmup_urls{};
+  std::chrono::milliseconds warmup_interval{std::chrono::minutes{1}};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value,
@@ -0,0 +1,124 @@
+#pragma once
+
+/// @file userver/clients/http/hedged_request.hpp
+/// @brief Hedged HTTP requests with the delay derived from the recent latency
+/// of the destination.
+///
+/// Example:
+/// @code
+/// auto response = clients::http::PerformHedged(client, [&client, &url] {
+///   return client.CreateRequest().get(url).timeout(std::chrono::seconds{1});
+/// });
+/// @endcode
+
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/utils/hedged_request.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+class RetryBudget;
+}  // namespace utils
+
+namespace clients::http {
+
+class Client;
+
+/// Settings of PerformHedged() and PerformHedgedAsync()
+struct HedgedRequestSettings final {
+  /// Maximum requests to do, including the hedged ones and the retries
+  std::size_t max_attempts{3};
+
+  /// Delay before the next hedged request. If not set, the
+  /// @ref delay_percentile of the recent timings of the destination is used.
+  std::optional<std::chrono::milliseconds> hedging_delay;
+
+  /// Percentile of the recent timings of the destination to use as the delay
+  double delay_percentile{95};
+
+  /// Delay to use if there are no recent timings of the destination yet
+  std::chrono::milliseconds fallback_delay{50};
+
+  /// Max time to wait for all the requests
+  std::chrono::milliseconds timeout_all{1000};
+
+  /// If set, the extra requests are made only if the budget allows a retry.
+  /// Results of all the requests are accounted in the budget. The budget may
+  /// be shared between the requests and must outlive them.
+  utils::RetryBudget* retry_budget{nullptr};
+};
+
+/// Creates a fully set up request for each attempt. Retries of the request
+/// itself are disabled, the attempts are made by the hedging.
+using RequestFactory = std::function<Request()>;
+
+namespace impl {
+
+/// RequestStrategy of utils::hedging for the HTTP client requests.
+///
+/// 5xx responses and network problems are retried right away, the rest of the
+/// responses are final. Requests that are not needed any more are cancelled
+/// without waiting for them.
+class HedgedRequestStrategy final {
+ public:
+  HedgedRequestStrategy(RequestFactory factory, Request&& first_request,
+                        utils::RetryBudget* retry_budget);
+
+  HedgedRequestStrategy(HedgedRequestStrategy&&) noexcept;
+  HedgedRequestStrategy& operator=(HedgedRequestStrategy&&) = delete;
+  ~HedgedRequestStrategy();
+
+  /// @{
+  /// Methods needed by utils::hedging
+  std::optional<ResponseFuture> Create(std::size_t attempt);
+  std::optional<std::chrono::milliseconds> ProcessReply(
+      ResponseFuture&& future);
+  std::optional<std::shared_ptr<Response>> ExtractReply();
+  void Finish(ResponseFuture&& future);
+  /// @}
+
+ private:
+  RequestFactory factory_;
+  std::optional<Request> first_request_;
+  utils::RetryBudget* retry_budget_;
+  std::shared_ptr<Response> reply_;
+  std::exception_ptr error_;
+};
+
+}  // namespace impl
+
+using HedgedResponseFuture =
+    utils::hedging::HedgedRequestFuture<impl::HedgedRequestStrategy>;
+
+/// @brief Performs the request, sending one more copy of it each time the
+/// previous ones take longer than the hedging delay. The first reply wins,
+/// the rest of the requests are cancelled.
+///
+/// The delay is HedgedRequestSettings::hedging_delay or, by default, is taken
+/// from Client::GetDestinationTimingPercentile() for the URL of the request.
+///
+/// @throws the exception of the last request if none of them got a response;
+/// clients::http::TimeoutException if HedgedRequestSettings::timeout_all
+/// expired.
+std::shared_ptr<Response> PerformHedged(
+    const Client& client, const RequestFactory& factory,
+    const HedgedRequestSettings& settings = {});
+
+/// Same as PerformHedged() but allows to do other work meanwhile. Get() of
+/// the future returns std::nullopt if HedgedRequestSettings::timeout_all
+/// expired.
+HedgedResponseFuture PerformHedgedAsync(
+    const Client& client, const RequestFactory& factory,
+    const HedgedRequestSettings& settings = {});
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
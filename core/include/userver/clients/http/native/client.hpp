@@ -0,0 +1,83 @@
+#pragma once
+
+/// @file userver/clients/http/native/client.hpp
+/// @brief @copybrief clients::http::native::Client
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::dns {
+class Resolver;
+}  // namespace clients::dns
+
+namespace clients::http::native {
+
+/// clients::http::native::Client settings
+struct ClientSettings final {
+  /// Maximum number of idle keep-alive connections kept for each host
+  std::size_t max_idle_connections_per_host{16};
+
+  /// Responses with bigger bodies fail with clients::http::BaseException
+  std::size_t max_response_size{64 * 1024 * 1024};
+};
+
+/// Single request of clients::http::native::Client
+struct Request final {
+  HttpMethod method{HttpMethod::kGet};
+  std::string url;
+  Headers headers;
+  std::string body;
+  std::chrono::milliseconds timeout{1000};
+};
+
+// clang-format off
+
+/// @ingroup userver_clients
+///
+/// @brief Minimal HTTP/1.1 client that runs directly on engine sockets
+/// without curl.
+///
+/// Meant for high-rate internal traffic with plain requests, where the curl
+/// multi handles, event loop hops and per-request bookkeeping of
+/// clients::http::Client are the dominant cost. Connections are kept alive
+/// and reused per `scheme://host:port`, HTTPS is served by
+/// engine::io::TlsWrapper.
+///
+/// Only the simplest subset of clients::http::Client features is supported:
+/// there are no retries, redirects, proxies, compression, HTTP/2, tracing
+/// headers, plugins, testsuite hooks or destination statistics. Use
+/// clients::http::Client whenever any of those is required.
+///
+/// Errors are reported with the exceptions of clients::http::Request,
+/// e.g. clients::http::TimeoutException and
+/// clients::http::NetworkProblemException. HTTP error statuses are returned
+/// as is, call clients::http::Response::raise_for_status() if required.
+
+// clang-format on
+class Client final {
+ public:
+  Client(clients::dns::Resolver& resolver, ClientSettings settings = {});
+  ~Client();
+
+  Client(const Client&) = delete;
+  Client& operator=(const Client&) = delete;
+
+  /// Performs the request, suspending the current task until the whole
+  /// response is received
+  std::shared_ptr<Response> Perform(const Request& request);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace clients::http::native
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,9 @@
 /// @file userver/clients/http/request.hpp
 /// @brief @copybrief clients::http::Request
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -157,6 +159,21 @@ class Request final {
   /// data for POST request
   Request& data(std::string data) &;
   Request data(std::string data) &&;
+  /// @brief Body for POST or PUT request, streamed from the queue
+  ///
+  /// Chunks are sent as they are pushed into the queue and the body ends when
+  /// all the producers of the queue are destroyed, so get a producer before
+  /// performing the request. At most one chunk besides the queue is kept in
+  /// memory and the producer is suspended once the queue is full.
+  ///
+  /// Without @p content_length the body is sent with
+  /// `Transfer-Encoding: chunked`. Such requests are never retried.
+  Request& data_stream(
+      const std::shared_ptr<concurrent::StringStreamQueue>& queue,
+      std::optional<std::size_t> content_length = {}) &;
+  Request data_stream(
+      const std::shared_ptr<concurrent::StringStreamQueue>& queue,
+      std::optional<std::size_t> content_length = {}) &&;
   /// form for POST request
   Request& form(Form&& form) &;
   Request form(Form&& form) &&;
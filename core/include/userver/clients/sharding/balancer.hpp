@@ -0,0 +1,115 @@
+#pragma once
+
+/// @file userver/clients/sharding/balancer.hpp
+/// @brief @copybrief clients::sharding::ConsistentHashBalancer
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/clients/sharding/maglev_table.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::sharding {
+
+/// Thrown by ConsistentHashBalancer if there are no backends yet
+class NoBackendsError : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+/// Returns the current backends, e.g. `host:port` endpoints
+using MembershipSource = std::function<std::vector<std::string>()>;
+
+/// @brief Makes a source of the `ip:port` endpoints the `host` is resolved
+/// to by the `resolver`.
+///
+/// IPv6 addresses are enclosed in brackets, the endpoints are usable both as
+/// gRPC targets and as the authority of HTTP URLs.
+MembershipSource MakeDnsMembershipSource(
+    clients::dns::Resolver& resolver, std::string host, std::uint16_t port,
+    std::chrono::milliseconds timeout = std::chrono::seconds{1});
+
+/// @ingroup userver_clients
+///
+/// @brief Picks a backend for the hash key of a request by consistent
+/// hashing, so that requests with the same key go to the same backend, e.g.
+/// to hit its local cache.
+///
+/// Backends are set by UpdateMembership() or refreshed in background from a
+/// MembershipSource. A change of the backends moves only the keys of the
+/// added and removed backends. Pick() is wait-free and may be called
+/// concurrently with the updates.
+///
+/// Used by ugrpc::client::ShardedClient, for HTTP clients the backend
+/// becomes a part of the URL:
+/// @code
+/// auto response = http_client.CreateRequest()
+///     .get(fmt::format("http://{}/v1/items?id={}", balancer.Pick(id), id))
+///     .timeout(std::chrono::seconds{1})
+///     .perform();
+/// @endcode
+class ConsistentHashBalancer final {
+ public:
+  struct Settings {
+    /// Size of the Maglev lookup table, must be a prime. See
+    /// MaglevTable::kDefaultTableSize.
+    std::size_t table_size{MaglevTable::kDefaultTableSize};
+  };
+
+  ConsistentHashBalancer() : ConsistentHashBalancer(Settings{}) {}
+  explicit ConsistentHashBalancer(Settings settings);
+
+  ConsistentHashBalancer(const ConsistentHashBalancer&) = delete;
+  ConsistentHashBalancer& operator=(const ConsistentHashBalancer&) = delete;
+  ~ConsistentHashBalancer();
+
+  /// @brief Returns the backend of the `key`.
+  /// @throws NoBackendsError if there are no backends
+  std::string Pick(std::string_view key) const;
+
+  /// @brief Returns up to `count` distinct backends of the `key` to retry
+  /// the request on, the first one is the same as Pick() returns.
+  std::vector<std::string> PickReplicas(std::string_view key,
+                                        std::size_t count) const;
+
+  /// Sorted unique backends
+  std::vector<std::string> GetBackends() const;
+
+  /// @brief Replaces the backends, the lookup table is rebuilt only if the
+  /// backends have changed.
+  void UpdateMembership(std::vector<std::string> backends);
+
+  /// @brief Updates the backends from the `source` now and then every
+  /// `period` in background until StopRefresh() or destruction.
+  ///
+  /// Failures and empty results of the source are logged and keep the
+  /// previous backends, so that a temporary outage of the discovery does not
+  /// stop the requests.
+  /// @throws the exception of the first call to the `source` if it fails
+  void StartRefresh(std::string name, MembershipSource source,
+                    std::chrono::milliseconds period);
+
+  void StopRefresh() noexcept;
+
+ private:
+  void Refresh();
+
+  const Settings settings_;
+  rcu::Variable<MaglevTable> table_;
+  MembershipSource source_;
+  std::string name_;
+  utils::PeriodicTask refresh_task_;
+};
+
+}  // namespace clients::sharding
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file userver/clients/sharding/maglev_table.hpp
+/// @brief @copybrief clients::sharding::MaglevTable
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Client-side sharding of requests between backends
+namespace clients::sharding {
+
+/// @brief Maglev consistent hashing lookup table.
+///
+/// Maps a key to one of the backends so that every backend gets almost the
+/// same share of the keys, and a change of the backends moves only the keys
+/// of the changed backends. Hashes are stable across processes and restarts,
+/// so all the clients with the same backends pick the same backend for a key.
+///
+/// The order of the backends does not matter, duplicates are ignored.
+///
+/// @see https://research.google/pubs/pub44824/
+class MaglevTable final {
+ public:
+  /// Default size of the lookup table, a prime much greater than the number
+  /// of backends
+  static constexpr std::size_t kDefaultTableSize = 65537;
+
+  /// @brief Creates an empty table, Pick() may not be called on it.
+  MaglevTable() = default;
+
+  /// @throws std::invalid_argument if the `table_size` is not a prime or is
+  /// less than the number of backends
+  explicit MaglevTable(std::vector<std::string> backends,
+                       std::size_t table_size = kDefaultTableSize);
+
+  /// @brief Returns the backend of the `key`.
+  /// @warning The table must not be empty.
+  const std::string& Pick(std::string_view key) const;
+
+  /// @brief Returns up to `count` distinct backends of the `key`, the first
+  /// one is the same as Pick() returns.
+  ///
+  /// Useful for retries of a request on another backend that are still
+  /// consistent between the clients.
+  std::vector<std::string> PickReplicas(std::string_view key,
+                                        std::size_t count) const;
+
+  /// Sorted unique backends
+  const std::vector<std::string>& GetBackends() const { return backends_; }
+
+  bool IsEmpty() const { return backends_.empty(); }
+
+ private:
+  std::vector<std::string> backends_;
+  std::vector<std::uint32_t> lookup_;
+};
+
+}  // namespace clients::sharding
+
+USERVER_NAMESPACE_END
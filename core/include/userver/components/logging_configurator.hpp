@@ -8,6 +8,7 @@
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,6 +36,7 @@ namespace components {
 /// ---- | ----------- | -------------
 /// limited-logging-enable | set to true to make LOG_LIMITED drop repeated logs | -
 /// limited-logging-interval | utils::StringToDuration suitable duration string to group repeated logs into one message | -
+/// limited-logging-summary-interval | utils::StringToDuration suitable duration string, how often to log the count of messages suppressed by LOG_LIMITED for each location; 0s to disable | 1m
 ///
 /// ## Config example:
 ///
@@ -59,6 +61,7 @@ class LoggingConfigurator final : public RawComponentBase {
 
   concurrent::AsyncEventSubscriberScope config_subscription_;
   rcu::Variable<logging::DynamicDebugConfig> dynamic_debug_;
+  utils::PeriodicTask limited_logging_summary_task_;
 };
 
 /// }@
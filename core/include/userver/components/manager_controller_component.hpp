@@ -26,6 +26,7 @@ class Manager;
 /// ## Dynamic config
 /// * @ref USERVER_TASK_PROCESSOR_PROFILER_DEBUG
 /// * @ref USERVER_TASK_PROCESSOR_QOS
+/// * @ref USERVER_JEMALLOC_DECAY
 ///
 /// ## Static options:
 /// Name | Description | Default value
@@ -51,6 +52,12 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 1000
+/// task-queue | task queue implementation: 'global' for a single queue shared by all the workers, 'work-stealing' for per-worker queues with stealing between them | global
+/// scheduling-classes | list of `{name, weight}` classes that share the task processor in proportion to their weights under load; tasks join a class via engine::current_task::SetSchedulingClass() or the `scheduling-class` handler option, the other tasks belong to the first class. Requires `task-queue: global` | a single class
+/// cpu-affinity | list of CPU indices to pin the task processor threads to | no affinity
+/// numa-node | NUMA node to pin the task processor threads to; together with `cpu-affinity` only the CPUs of the node from the list are used | no affinity
+/// resource-usage-accounting | account CPU time and allocated bytes (with jemalloc) per task; reported as `cpu_time_us` and `allocated_bytes` tags of tracing spans and as handler metrics. Costs a few syscalls per context switch | false
+/// jemalloc-dedicated-arena | serve the allocations of the task processor threads from a jemalloc arena of their own, so that the fragmentation caused by the other task processors (e.g. by the cache updates) does not increase the memory of these threads. The arena is reported as `engine.task-processors.jemalloc-arena.*` metrics | false
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
@@ -23,7 +23,10 @@ void TryValidateStaticConfig(const components::ComponentConfig& static_config,
                              ValidationMode validation_condition) {
   if (components::kHasValidate<Component> ||
       validation_condition == ValidationMode::kAll) {
-    yaml_config::Schema schema = Component::GetStaticConfigSchema();
+    // Schema is parsed from YAML, which is slow. It never changes, so it is
+    // parsed once for all the starts of the service within the process.
+    static const yaml_config::Schema schema =
+        Component::GetStaticConfigSchema();
 
     yaml_config::impl::Validate(static_config, schema);
   }
@@ -24,6 +24,13 @@ namespace components {
 ///
 /// The component does **not** have any options for service config.
 ///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// cardinality-limits.max-series-per-path | series with different labels per metric path on a single metrics request, the rest are summed into the overflow series, see utils::statistics::CardinalityLimits; 0 means unlimited | 0
+/// cardinality-limits.prefixes | map of a metric path prefix to the limit of its paths, overrides max-series-per-path | {}
+/// cardinality-limits.keep-labels | names of the labels that keep their values in the overflow series | []
+///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_component_list_test.cpp  Sample statistics storage component config
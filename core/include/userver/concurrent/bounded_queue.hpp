@@ -0,0 +1,312 @@
+#pragma once
+
+/// @file userver/concurrent/bounded_queue.hpp
+/// @brief Bounded array-based queues with single and multi producer/consumer
+/// options
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <userver/concurrent/impl/bounded_ring_buffer.hpp>
+#include <userver/concurrent/impl/queue_waiters.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/concurrent/queue_helpers.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/atomic.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// @brief FIFO queue of a fixed capacity with single and multi
+/// producer/consumer options.
+///
+/// Unlike concurrent::GenericQueue, the elements are stored in a preallocated
+/// ring buffer, so pushes and pops do not allocate, and the blocked producers
+/// and consumers are parked directly on the queue without a semaphore
+/// operation per element. The elements are delivered in the order of the
+/// pushes.
+///
+/// @tparam T element type
+/// @tparam QueuePolicy policy type, see concurrent::GenericQueue. Only the
+/// policies with `GetElementSize` of 1 are supported.
+///
+/// `Producer::PushMany` is not available, because the cells of the ring buffer
+/// cannot be reserved for the whole batch at once.
+///
+/// On practice, instead of using `BoundedQueue` directly, use an alias:
+///
+/// * concurrent::BoundedMpmcQueue
+/// * concurrent::BoundedMpscQueue
+/// * concurrent::BoundedSpmcQueue
+/// * concurrent::BoundedSpscQueue
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T, typename QueuePolicy>
+class BoundedQueue final
+    : public std::enable_shared_from_this<BoundedQueue<T, QueuePolicy>> {
+  struct EmplaceEnabler final {
+    // Disable {}-initialization in Queue's constructor
+    explicit EmplaceEnabler() = default;
+  };
+
+  using Token = impl::NoToken;
+
+  friend class Producer<BoundedQueue, Token, EmplaceEnabler>;
+  friend class Consumer<BoundedQueue, Token, EmplaceEnabler>;
+
+ public:
+  using ValueType = T;
+
+  using Producer = concurrent::Producer<BoundedQueue, Token, EmplaceEnabler>;
+  using Consumer = concurrent::Consumer<BoundedQueue, Token, EmplaceEnabler>;
+  using MultiProducer = Producer;
+  using MultiConsumer = Consumer;
+
+  /// The capacity of the queues created without an explicit one
+  static constexpr std::size_t kDefaultCapacity = 1024;
+
+  /// @cond
+  // For internal use only
+  explicit BoundedQueue(std::size_t capacity, EmplaceEnabler /*unused*/)
+      : queue_(capacity),
+        soft_max_size_(std::min(capacity, queue_.GetCapacity())) {}
+
+  ~BoundedQueue() {
+    UASSERT(consumers_count_ == kCreatedAndDead || !consumers_count_);
+    UASSERT(producers_count_ == kCreatedAndDead || !producers_count_);
+    // The remaining elements are destroyed by the ring buffer
+  }
+
+  BoundedQueue(BoundedQueue&&) = delete;
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(BoundedQueue&&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+  /// @endcond
+
+  /// Create a new queue. The memory for `capacity` elements is allocated
+  /// at once, so the capacity should be reasonably small.
+  static std::shared_ptr<BoundedQueue> Create(
+      std::size_t capacity = kDefaultCapacity) {
+    return std::make_shared<BoundedQueue>(capacity, EmplaceEnabler{});
+  }
+
+  /// @copydoc concurrent::GenericQueue::GetProducer
+  Producer GetProducer() {
+    PrepareProducer();
+    return Producer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  /// @copydoc concurrent::GenericQueue::GetMultiProducer
+  MultiProducer GetMultiProducer() {
+    static_assert(QueuePolicy::kIsMultipleProducer,
+                  "Trying to obtain MultiProducer for a single-producer queue");
+    return GetProducer();
+  }
+
+  /// @copydoc concurrent::GenericQueue::GetConsumer
+  Consumer GetConsumer() {
+    PrepareConsumer();
+    return Consumer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  /// @copydoc concurrent::GenericQueue::GetMultiConsumer
+  MultiConsumer GetMultiConsumer() {
+    static_assert(QueuePolicy::kIsMultipleConsumer,
+                  "Trying to obtain MultiConsumer for a single-consumer queue");
+    return GetConsumer();
+  }
+
+  /// @brief Sets the limit on the queue size, pushes over this limit will block
+  /// @note This is a soft limit and may be slightly overrun under load. It
+  /// never exceeds the capacity the queue was created with.
+  void SetSoftMaxSize(std::size_t max_size) {
+    const auto new_max_size = std::min(max_size, queue_.GetCapacity());
+    const auto old_max_size = soft_max_size_.exchange(new_max_size);
+    if (new_max_size > old_max_size) push_waiters_.NotifyAll();
+  }
+
+  /// @brief Gets the limit on the queue size
+  std::size_t GetSoftMaxSize() const { return soft_max_size_.load(); }
+
+  /// @brief Gets the approximate size of queue
+  std::size_t GetSizeApproximate() const {
+    return queue_.GetSizeApproximate();
+  }
+
+ private:
+  using RingBuffer =
+      impl::BoundedRingBuffer<T, QueuePolicy::kIsMultipleProducer,
+                              QueuePolicy::kIsMultipleConsumer>;
+
+  [[nodiscard]] bool Push(Token& /*unused*/, T&& value,
+                          engine::Deadline deadline) {
+    UASSERT(QueuePolicy::GetElementSize(value) == 1);
+    bool no_more_consumers = false;
+    const bool success = push_waiters_.WaitUntil(deadline, [&] {
+      if (NoMoreConsumers()) {
+        no_more_consumers = true;
+        return true;
+      }
+      return DoPush(std::move(value));
+    });
+    if (!success || no_more_consumers) return false;
+    pop_waiters_.NotifyOne();
+    return true;
+  }
+
+  [[nodiscard]] bool PushNoblock(Token& /*unused*/, T&& value) {
+    UASSERT(QueuePolicy::GetElementSize(value) == 1);
+    if (NoMoreConsumers() || !DoPush(std::move(value))) return false;
+    pop_waiters_.NotifyOne();
+    return true;
+  }
+
+  [[nodiscard]] bool Pop(Token& /*unused*/, T& value,
+                         engine::Deadline deadline) {
+    bool no_more_producers = false;
+    const bool success = pop_waiters_.WaitUntil(deadline, [&] {
+      if (DoPop(value)) return true;
+      if (NoMoreProducers()) {
+        // Producer might have pushed something in queue between the pop
+        // and the NoMoreProducers() check. Check twice to avoid TOCTOU.
+        if (!DoPop(value)) no_more_producers = true;
+        return true;
+      }
+      return false;
+    });
+    if (!success || no_more_producers) return false;
+    push_waiters_.NotifyOne();
+    return true;
+  }
+
+  [[nodiscard]] bool PopNoblock(Token& /*unused*/, T& value) {
+    if (!DoPop(value)) return false;
+    push_waiters_.NotifyOne();
+    return true;
+  }
+
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    T value;
+    if (!Pop(token, value, deadline)) return 0;
+    values.push_back(std::move(value));
+
+    std::size_t count = 1;
+    while (count < max_count && DoPop(value)) {
+      values.push_back(std::move(value));
+      ++count;
+    }
+    if (count > 1) push_waiters_.NotifyAll();
+    return count;
+  }
+
+  // The operations below are retried under the lock of the waiters, so they
+  // must not notify the other side
+
+  [[nodiscard]] bool DoPush(T&& value) {
+    const auto soft_max_size = soft_max_size_.load(std::memory_order_relaxed);
+    // The size is not checked if only the ring buffer limits it
+    if (soft_max_size < queue_.GetCapacity() &&
+        queue_.GetSizeApproximate() >= soft_max_size) {
+      return false;
+    }
+    return queue_.TryPush(std::move(value));
+  }
+
+  [[nodiscard]] bool DoPop(T& value) { return queue_.TryPop(value); }
+
+  void PrepareProducer() {
+    utils::AtomicUpdate(producers_count_, [](auto old_value) {
+      UINVARIANT(QueuePolicy::kIsMultipleProducer || old_value != 1,
+                 "Incorrect usage of queue producers");
+      return old_value == kCreatedAndDead ? 1 : old_value + 1;
+    });
+  }
+
+  void PrepareConsumer() {
+    utils::AtomicUpdate(consumers_count_, [](auto old_value) {
+      UINVARIANT(QueuePolicy::kIsMultipleConsumer || old_value != 1,
+                 "Incorrect usage of queue consumers");
+      return old_value == kCreatedAndDead ? 1 : old_value + 1;
+    });
+  }
+
+  void MarkConsumerIsDead() {
+    const auto new_consumers_count =
+        utils::AtomicUpdate(consumers_count_, [](auto old_value) {
+          return old_value == 1 ? kCreatedAndDead : old_value - 1;
+        });
+    if (new_consumers_count == kCreatedAndDead) push_waiters_.NotifyAll();
+  }
+
+  void MarkProducerIsDead() {
+    const auto new_producers_count =
+        utils::AtomicUpdate(producers_count_, [](auto old_value) {
+          return old_value == 1 ? kCreatedAndDead : old_value - 1;
+        });
+    if (new_producers_count == kCreatedAndDead) pop_waiters_.NotifyAll();
+  }
+
+  bool NoMoreConsumers() const { return consumers_count_ == kCreatedAndDead; }
+
+  bool NoMoreProducers() const { return producers_count_ == kCreatedAndDead; }
+
+  static constexpr std::size_t kCreatedAndDead =
+      std::numeric_limits<std::size_t>::max();
+
+  // Named `queue_` for the tokens of concurrent::Producer and
+  // concurrent::Consumer
+  RingBuffer queue_;
+  std::atomic<std::size_t> soft_max_size_;
+  std::atomic<std::size_t> consumers_count_{0};
+  std::atomic<std::size_t> producers_count_{0};
+  impl::QueueWaiters push_waiters_;
+  impl::QueueWaiters pop_waiters_;
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO multiple producers multiple consumers queue.
+///
+/// @see concurrent::BoundedQueue
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedMpmcQueue = BoundedQueue<T, impl::SimpleQueuePolicy<true, true>>;
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO multiple producers single consumer queue.
+///
+/// @see concurrent::BoundedQueue
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedMpscQueue = BoundedQueue<T, impl::SimpleQueuePolicy<true, false>>;
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO single producer multiple consumers queue.
+///
+/// @see concurrent::BoundedQueue
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedSpmcQueue = BoundedQueue<T, impl::SimpleQueuePolicy<false, true>>;
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO single producer single consumer queue.
+///
+/// @see concurrent::BoundedQueue
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedSpscQueue =
+    BoundedQueue<T, impl::SimpleQueuePolicy<false, false>>;
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+// Bounded array-based lock-free queue, see
+// https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+//
+// Each cell has a sequence number that tells whether the cell is ready to be
+// written or read at the current position. A push or a pop is a single CAS on
+// the position (a plain store for a single producer or consumer) and does not
+// allocate.
+//
+// The capacity is rounded up to a power of two, at least 2.
+template <typename T, bool MultipleProducer, bool MultipleConsumer>
+class BoundedRingBuffer final {
+ public:
+  explicit BoundedRingBuffer(std::size_t capacity)
+      : mask_(RoundUpCapacity(capacity) - 1),
+        cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  BoundedRingBuffer(const BoundedRingBuffer&) = delete;
+  BoundedRingBuffer& operator=(const BoundedRingBuffer&) = delete;
+
+  ~BoundedRingBuffer() {
+    const auto end = enqueue_pos_.load(std::memory_order_relaxed);
+    for (auto pos = dequeue_pos_.load(std::memory_order_relaxed); pos != end;
+         ++pos) {
+      cells_[pos & mask_].Get().~T();
+    }
+  }
+
+  // Leaves the `value` unmodified if the buffer is full
+  [[nodiscard]] bool TryPush(T&& value) {
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const auto sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::intptr_t>(sequence - pos);
+      if (diff == 0) {
+        if constexpr (MultipleProducer) {
+          if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                 std::memory_order_relaxed)) {
+            break;
+          }
+        } else {
+          enqueue_pos_.store(pos + 1, std::memory_order_relaxed);
+          break;
+        }
+      } else if (diff < 0) {
+        // The cell is still occupied by the value of the previous lap
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    ::new (static_cast<void*>(&cell->storage)) T(std::move(value));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  [[nodiscard]] bool TryPop(T& value) {
+    auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const auto sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::intptr_t>(sequence - (pos + 1));
+      if (diff == 0) {
+        if constexpr (MultipleConsumer) {
+          if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                 std::memory_order_relaxed)) {
+            break;
+          }
+        } else {
+          dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+          break;
+        }
+      } else if (diff < 0) {
+        // The value is not written yet
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    auto& stored = cell->Get();
+    value = std::move(stored);
+    stored.~T();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  std::size_t GetCapacity() const noexcept { return mask_ + 1; }
+
+  // May be inaccurate under concurrent pushes and pops
+  std::size_t GetSizeApproximate() const noexcept {
+    const auto dequeue_pos = dequeue_pos_.load(std::memory_order_relaxed);
+    const auto enqueue_pos = enqueue_pos_.load(std::memory_order_relaxed);
+    const auto size = static_cast<std::intptr_t>(enqueue_pos - dequeue_pos);
+    return size > 0 ? static_cast<std::size_t>(size) : 0;
+  }
+
+ private:
+  // Keeps the producer and the consumer positions out of each other's cache
+  // lines
+  static constexpr std::size_t kCacheLineSize = 64;
+
+  struct Cell final {
+    T& Get() noexcept { return *std::launder(reinterpret_cast<T*>(&storage)); }
+
+    std::atomic<std::size_t> sequence{0};
+    std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+  };
+
+  static std::size_t RoundUpCapacity(std::size_t capacity) noexcept {
+    UASSERT(capacity <= std::numeric_limits<std::size_t>::max() / 4);
+    std::size_t result = 2;
+    while (result < capacity) result *= 2;
+    return result;
+  }
+
+  const std::size_t mask_;
+  const std::unique_ptr<Cell[]> cells_;
+  alignas(kCacheLineSize) std::atomic<std::size_t> enqueue_pos_{0};
+  alignas(kCacheLineSize) std::atomic<std::size_t> dequeue_pos_{0};
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
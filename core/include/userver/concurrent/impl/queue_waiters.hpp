@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/impl/wait_list_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+// Parks the tasks that wait for a lock-free operation to become possible,
+// e.g. for a push into a full queue.
+//
+// The side that makes the operation possible calls Notify*() after the change.
+// The notification is a couple of loads when nobody waits.
+class QueueWaiters final {
+ public:
+  QueueWaiters();
+  ~QueueWaiters();
+
+  QueueWaiters(const QueueWaiters&) = delete;
+  QueueWaiters& operator=(const QueueWaiters&) = delete;
+
+  // Retries `operation` until it returns `true`, sleeping in between until
+  // notified. Returns `false` on deadline or task cancellation, if the last
+  // attempt does not succeed either.
+  template <typename Operation>
+  bool WaitUntil(engine::Deadline deadline, Operation&& operation) {
+    if (operation()) return true;
+    return DoWaitUntil(
+        deadline,
+        [](void* data) { return (*static_cast<Operation*>(data))(); },
+        &operation);
+  }
+
+  void NotifyOne() {
+    if (HasWaiters()) DoNotify(false);
+  }
+
+  void NotifyAll() {
+    if (HasWaiters()) DoNotify(true);
+  }
+
+ private:
+  using OperationRef = bool (*)(void*);
+
+  bool HasWaiters() const noexcept {
+    // Pairs with the fence of the waiter: either the waiter sees the change
+    // made before the notification, or the notifier sees the waiter
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return sleepies_.load(std::memory_order_relaxed) != 0;
+  }
+
+  bool DoWaitUntil(engine::Deadline deadline, OperationRef operation,
+                   void* data);
+  void DoNotify(bool all);
+
+  std::atomic<std::size_t> sleepies_{0};
+  engine::impl::FastPimplWaitList waiters_;
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <atomic>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <boost/lockfree/queue.hpp>
 
@@ -16,6 +17,7 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -154,10 +156,15 @@ class MpscQueue final : public std::enable_shared_from_this<MpscQueue<T>> {
   bool Push(ProducerToken&, T&&, engine::Deadline);
   bool PushNoblock(ProducerToken&, T&&);
   bool DoPush(ProducerToken&, T&&);
+  bool PushMany(ProducerToken&, utils::span<T>, engine::Deadline);
+  bool DoPushMany(ProducerToken&, utils::span<T>);
 
   bool Pop(ConsumerToken&, T&, engine::Deadline);
   bool PopNoblock(ConsumerToken&, T&);
   bool DoPop(ConsumerToken&, T&);
+  std::size_t PopMany(ConsumerToken&, std::vector<T>&, std::size_t,
+                      engine::Deadline);
+  std::size_t DoPopMany(ConsumerToken&, std::vector<T>&, std::size_t);
 
   void MarkConsumerIsDead();
   void MarkProducerIsDead();
@@ -251,6 +258,31 @@ bool MpscQueue<T>::DoPush(ProducerToken& /*unused*/, T&& value) {
   return true;
 }
 
+template <typename T>
+bool MpscQueue<T>::PushMany(ProducerToken& token, utils::span<T> values,
+                            engine::Deadline deadline) {
+  return remaining_capacity_.try_lock_shared_until_count(deadline,
+                                                         values.size()) &&
+         DoPushMany(token, values);
+}
+
+template <typename T>
+bool MpscQueue<T>::DoPushMany(ProducerToken& /*unused*/,
+                              utils::span<T> values) {
+  if (consumer_is_created_and_dead_) {
+    remaining_capacity_.unlock_shared_count(values.size());
+    return false;
+  }
+
+  for (auto& value : values) {
+    QueueHelper::Push(queue_, std::move(value));
+  }
+  size_ += values.size();
+  nonempty_event_.Send();
+
+  return true;
+}
+
 template <typename T>
 bool MpscQueue<T>::Pop(ConsumerToken& token, T& value,
                        engine::Deadline deadline) {
@@ -282,6 +314,39 @@ bool MpscQueue<T>::DoPop(ConsumerToken& /*unused*/, T& value) {
   return false;
 }
 
+template <typename T>
+std::size_t MpscQueue<T>::PopMany(ConsumerToken& token, std::vector<T>& values,
+                                  std::size_t max_count,
+                                  engine::Deadline deadline) {
+  while (true) {
+    const auto count = DoPopMany(token, values, max_count);
+    if (count) return count;
+    if (producer_is_created_and_dead_ ||
+        !nonempty_event_.WaitForEventUntil(deadline)) {
+      // Same TOCTOU as in Pop
+      return DoPopMany(token, values, max_count);
+    }
+  }
+}
+
+template <typename T>
+std::size_t MpscQueue<T>::DoPopMany(ConsumerToken& /*unused*/,
+                                    std::vector<T>& values,
+                                    std::size_t max_count) {
+  std::size_t count = 0;
+  T value;
+  while (count < max_count && QueueHelper::Pop(queue_, value)) {
+    values.push_back(std::move(value));
+    ++count;
+  }
+  if (count) {
+    size_ -= count;
+    remaining_capacity_.unlock_shared_count(count);
+    nonempty_event_.Reset();
+  }
+  return count;
+}
+
 template <typename T>
 void MpscQueue<T>::MarkConsumerIsDead() {
   consumer_is_created_and_dead_ = true;
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -14,6 +16,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/atomic.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -240,11 +243,29 @@ class GenericQueue final
     return producer_side_.PushNoblock(token, std::move(value), value_size);
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, utils::span<T> values,
+                              engine::Deadline deadline) {
+    std::size_t values_size = 0;
+    for (const auto& value : values) {
+      values_size += QueuePolicy::GetElementSize(value);
+    }
+    UASSERT(values_size > 0);
+    return producer_side_.PushMany(token, values, deadline, values_size);
+  }
+
   template <typename Token>
   [[nodiscard]] bool Pop(Token& token, T& value, engine::Deadline deadline) {
     return consumer_side_.Pop(token, value, deadline);
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    return consumer_side_.PopMany(token, values, max_count, deadline);
+  }
+
   template <typename Token>
   [[nodiscard]] bool PopNoblock(Token& token, T& value) {
     return consumer_side_.PopNoblock(token, value);
@@ -320,7 +341,25 @@ class GenericQueue final
       queue_.enqueue(single_producer_token_, std::move(value));
     }
 
-    consumer_side_.OnElementPushed();
+    consumer_side_.OnElementsPushed(1);
+  }
+
+  template <typename Token>
+  void DoPushMany(Token& token, utils::span<T> values) {
+    const auto first = std::make_move_iterator(values.begin());
+    if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(token, first, values.size());
+    } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(first, values.size());
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(single_producer_token_, first, values.size());
+    }
+
+    consumer_side_.OnElementsPushed(values.size());
   }
 
   template <typename Token>
@@ -347,6 +386,36 @@ class GenericQueue final
     return false;
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_count) {
+    const auto old_size = values.size();
+    const auto out = std::back_inserter(values);
+    std::size_t count{};
+
+    if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(token, out, max_count);
+    } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(out, max_count);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk_from_producer(single_producer_token_,
+                                                    out, max_count);
+    }
+
+    if (count) {
+      std::size_t released_capacity = 0;
+      for (auto it = values.begin() + old_size; it != values.end(); ++it) {
+        released_capacity += QueuePolicy::GetElementSize(*it);
+      }
+      producer_side_.OnElementPopped(released_capacity);
+    }
+    return count;
+  }
+
   moodycamel::ConcurrentQueue<T> queue_{1};
   std::atomic<std::size_t> consumers_count_{0};
   std::atomic<std::size_t> producers_count_{0};
@@ -395,6 +464,21 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
            DoPush(token, std::move(value), value_size);
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, utils::span<T> values,
+                              engine::Deadline deadline,
+                              std::size_t values_size) {
+    bool no_more_consumers = false;
+    const bool success = non_full_event_.WaitUntil(deadline, [&] {
+      if (queue_.NoMoreConsumers()) {
+        no_more_consumers = true;
+        return true;
+      }
+      return DoPushMany(token, values, values_size);
+    });
+    return success && !no_more_consumers;
+  }
+
   void OnElementPopped(std::size_t released_capacity) {
     used_capacity_.fetch_sub(released_capacity);
     non_full_event_.Send();
@@ -427,6 +511,18 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushMany(Token& token, utils::span<T> values,
+                                std::size_t values_size) {
+    if (used_capacity_.load() + values_size > total_capacity_.load()) {
+      return false;
+    }
+
+    used_capacity_.fetch_add(values_size);
+    queue_.DoPushMany(token, values);
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent non_full_event_;
   std::atomic<std::size_t> used_capacity_;
@@ -459,6 +555,23 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
            DoPush(token, std::move(value), value_size);
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, utils::span<T> values,
+                              engine::Deadline deadline,
+                              std::size_t values_size) {
+    if (!remaining_capacity_.try_lock_shared_until_count(deadline,
+                                                         values_size)) {
+      return false;
+    }
+    if (queue_.NoMoreConsumers()) {
+      remaining_capacity_.unlock_shared_count(values_size);
+      return false;
+    }
+
+    queue_.DoPushMany(token, values);
+    return true;
+  }
+
   void OnElementPopped(std::size_t value_size) {
     remaining_capacity_.unlock_shared_count(value_size);
   }
@@ -534,8 +647,27 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return DoPop(token, value);
   }
 
-  void OnElementPushed() {
-    ++element_count_;
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    std::size_t count = 0;
+    [[maybe_unused]] const bool success =
+        nonempty_event_.WaitUntil(deadline, [&] {
+          count = DoPopMany(token, values, max_count);
+          if (count) return true;
+          if (queue_.NoMoreProducers()) {
+            // The same TOCTOU as in Pop
+            count = DoPopMany(token, values, max_count);
+            return true;
+          }
+          return false;
+        });
+    return count;
+  }
+
+  void OnElementsPushed(std::size_t count) {
+    element_count_ += count;
     nonempty_event_.Send();
   }
 
@@ -556,6 +688,17 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return false;
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_count) {
+    const auto count = queue_.DoPopMany(token, values, max_count);
+    if (count) {
+      element_count_ -= count;
+      nonempty_event_.Reset();
+    }
+    return count;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent nonempty_event_;
   std::atomic<std::size_t> element_count_;
@@ -587,7 +730,24 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     return element_count_.try_lock_shared() && DoPop(token, value);
   }
 
-  void OnElementPushed() { element_count_.unlock_shared(); }
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (!element_count_.try_lock_shared_until(deadline)) return 0;
+    // Takes the elements that are already in the queue in one go. Another
+    // consumer may have taken them meanwhile, then only one is popped.
+    std::size_t count = 1;
+    const auto extra_count = std::min(max_count - 1, GetElementCount());
+    if (extra_count && element_count_.try_lock_shared_count(extra_count)) {
+      count += extra_count;
+    }
+    return DoPopMany(token, values, count);
+  }
+
+  void OnElementsPushed(std::size_t count) {
+    element_count_.unlock_shared_count(count);
+  }
 
   void StopBlockingOnPop() {
     element_count_control_.SetCapacityOverride(kUnbounded +
@@ -624,6 +784,23 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     }
   }
 
+  // Pops exactly `count` elements, unless there are no more producers
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t count) {
+    std::size_t popped = 0;
+    while (popped < count) {
+      const auto batch = queue_.DoPopMany(token, values, count - popped);
+      popped += batch;
+      if (!batch && queue_.NoMoreProducers()) {
+        element_count_.unlock_shared_count(count - popped);
+        break;
+      }
+      // The same element stealing as in DoPop may happen here
+    }
+    return popped;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore element_count_;
   concurrent::impl::SemaphoreCapacityControl element_count_control_;
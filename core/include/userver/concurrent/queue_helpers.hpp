@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -67,6 +69,22 @@ class Producer final {
     return queue_->PushNoblock(token_, std::move(value));
   }
 
+  /// Push all the elements into queue at once. May wait asynchronously until
+  /// the queue has space for all of them. On success, the elements are moved
+  /// out of `values`, otherwise they are left unmodified.
+  ///
+  /// A batch takes the queue capacity and wakes up the consumers once, so it
+  /// is cheaper than pushing the elements one by one.
+  /// @returns whether push succeeded before the deadline and before the task
+  /// was canceled.
+  /// @note A batch that is bigger than the queue max size is never pushed.
+  [[nodiscard]] bool PushMany(utils::span<ValueType> values,
+                              engine::Deadline deadline = {}) const {
+    UASSERT(queue_);
+    if (values.empty()) return true;
+    return queue_->PushMany(token_, values, deadline);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkProducerIsDead();
     queue_.reset();
@@ -136,6 +154,20 @@ class Consumer final {
     return queue_->PopNoblock(token_, value);
   }
 
+  /// Pop up to `max_count` elements from queue and append them to `values`.
+  /// May wait asynchronously if the queue is empty, but the producer is alive.
+  /// Does not wait for more elements once there is at least one.
+  /// @returns the number of the popped elements, 0 if nothing was popped
+  /// before the deadline.
+  /// @note 0 can be returned before the deadline when the producer is no
+  /// longer alive.
+  [[nodiscard]] std::size_t PopMany(std::vector<ValueType>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline = {}) const {
+    if (max_count == 0) return 0;
+    return queue_->PopMany(token_, values, max_count, deadline);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkConsumerIsDead();
     queue_.reset();
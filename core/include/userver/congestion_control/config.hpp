@@ -28,6 +28,10 @@ struct Policy {
   size_t load_limit_crit_percent{0};
 
   double start_limit_factor{0.75};
+
+  /// Sensor::Data::system_pressure_percent to treat as an overload,
+  /// 0 disables the check
+  size_t system_pressure_limit_percent{0};
 };
 
 Policy Parse(const formats::json::Value& policy, formats::parse::To<Policy>);
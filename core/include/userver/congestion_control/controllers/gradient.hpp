@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include <userver/congestion_control/controllers/gradient_config.hpp>
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/congestion_control/limiter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// @brief Adaptive concurrency limit driven by the timings.
+///
+/// Compares the recent average timings with the long-term ones, the latter
+/// are not updated during an overload. Once the recent timings exceed the
+/// long-term ones times GradientConfig::rtt_tolerance, the limit is set to
+/// the current load and from then on follows
+/// `limit * gradient + sqrt(limit)`, where the gradient is the ratio of the
+/// timings clamped to [0.5, 1]. The limit grows only while the load is close
+/// to it. It is removed after it reaches GradientConfig::max_limit or after
+/// several calm steps with the load far below it.
+class GradientController final : public Controller {
+ public:
+  using StaticConfig = GradientConfig;
+
+  GradientController(const std::string& name, v2::Sensor& sensor,
+                     Limiter& limiter, Stats& stats,
+                     const StaticConfig& config);
+
+  Limit Update(const Sensor::Data& current) override;
+
+ private:
+  void Deactivate();
+
+  const StaticConfig config_;
+  std::optional<double> long_timings_ms_;
+  double limit_{0};
+  std::size_t epochs_passed_{0};
+  std::size_t calm_epochs_{0};
+};
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
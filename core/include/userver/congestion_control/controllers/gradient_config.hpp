@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// Static config of GradientController
+struct GradientConfig {
+  bool fake_mode{false};
+
+  /// The limit is never set below this value
+  std::size_t min_limit{10};
+
+  /// The limit is removed once it grows up to this value
+  std::size_t max_limit{10000};
+
+  /// Timings up to `rtt_tolerance` times the usual ones are not an overload
+  double rtt_tolerance{1.5};
+
+  /// Share of the new limit estimation in the limit on each step
+  double smoothing{0.2};
+
+  /// Less requests per second are too noisy to change the limit
+  std::size_t min_qps{10};
+};
+
+GradientConfig Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<GradientConfig>);
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -18,6 +18,10 @@ class Sensor {
     std::uint64_t no_overload_events_count{0};
     std::chrono::steady_clock::time_point tp;
 
+    /// Share of the time the process was stalled by the lack of CPU or
+    /// memory since the previous fetch, 0 if unknown
+    double system_pressure_percent{0};
+
     double GetLoadPercent() const;
   };
 
@@ -0,0 +1,255 @@
+#pragma once
+
+/// @file userver/dump/chunked.hpp
+/// @brief Parallel dump format for large containers, see dump::WriteChunked
+///
+/// @ingroup userver_dump_read_write
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/utils/meta.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/meta.hpp>
+#include <userver/dump/meta_containers.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/unsafe.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// Settings of dump::WriteChunked
+struct ChunkedOptions final {
+  /// The maximum number of chunks, the chunks are serialized in parallel.
+  /// Reading does not depend on this setting.
+  std::size_t max_chunks{16};
+
+  /// The minimum number of elements in a chunk, smaller containers are split
+  /// into fewer chunks
+  std::size_t min_chunk_size{1000};
+
+  /// zstd compression level of the chunks
+  int compression_level{compression::zstd::kDefaultCompressionLevel};
+
+  /// Dictionary to compress the chunks with, e.g. trained by
+  /// compression::zstd::TrainDictionary on the serialized elements. It pays
+  /// off for small chunks, e.g. of a few hundred bytes, larger ones compress
+  /// well on their own. The level of the dictionary is used instead of
+  /// `compression_level`. The dump is read by the dump::ReadChunked overload
+  /// with a registry that contains the dictionary.
+  std::shared_ptr<const compression::zstd::Dictionary> dictionary{};
+};
+
+namespace impl {
+
+/// A `Writer` that appends to a string buffer
+class StringWriter final : public Writer {
+ public:
+  void Finish() override;
+
+  std::string Extract() &&;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  std::string data_;
+};
+
+/// A `Reader` that reads from a string buffer
+class StringReader final : public Reader {
+ public:
+  explicit StringReader(std::string data);
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string data_;
+  std::string_view unread_data_;
+};
+
+struct ChunkHeader final {
+  std::size_t elements{0};
+  std::size_t size{0};
+  std::size_t compressed_size{0};
+};
+
+struct Chunk final {
+  ChunkHeader header;
+  std::string data;
+};
+
+std::size_t GetChunksCount(std::size_t size, const ChunkedOptions& options);
+
+Chunk MakeChunk(std::size_t elements, std::string&& data,
+                const ChunkedOptions& options);
+
+void WriteChunks(Writer& writer, std::size_t size,
+                 const std::vector<Chunk>& chunks);
+
+std::vector<ChunkHeader> ReadChunkHeaders(Reader& reader);
+
+std::string DecompressChunk(
+    std::string_view compressed, const ChunkHeader& header,
+    const compression::zstd::DictionaryRegistry* dictionaries);
+
+[[noreturn]] void ThrowSizeMismatch(std::size_t expected, std::size_t actual);
+
+template <typename T>
+using HasMerge = decltype(std::declval<T&>().merge(std::declval<T&>()));
+
+template <typename T>
+void MergeChunk(T& result, T&& chunk) {
+  if constexpr (meta::kIsDetected<HasMerge, T>) {
+    // Relinks the nodes of node-based containers without reallocating them
+    result.merge(chunk);
+  } else {
+    for (auto&& item : chunk) {
+      // explicit cast for vector<bool> shenanigans
+      dump::Insert(result, static_cast<meta::RangeValueType<T>&&>(item));
+    }
+  }
+}
+
+template <typename T>
+T ReadChunk(const std::string& compressed, const ChunkHeader& header,
+            const compression::zstd::DictionaryRegistry* dictionaries) {
+  StringReader reader{DecompressChunk(compressed, header, dictionaries)};
+
+  T result{};
+  if constexpr (meta::kIsReservable<T>) {
+    result.reserve(header.elements);
+  }
+  for (std::size_t i = 0; i < header.elements; ++i) {
+    dump::Insert(result, reader.Read<meta::RangeValueType<T>>());
+  }
+  reader.Finish();
+  return result;
+}
+
+template <typename T>
+T ReadChunked(Reader& reader,
+              const compression::zstd::DictionaryRegistry* dictionaries) {
+  static_assert(kIsContainer<T> && kIsReadable<meta::RangeValueType<T>>,
+                "ReadChunked supports only the containers of readable "
+                "elements, see <userver/dump/common_containers.hpp>");
+
+  const auto size = reader.Read<std::size_t>();
+  const auto headers = ReadChunkHeaders(reader);
+
+  std::vector<engine::TaskWithResult<T>> tasks;
+  tasks.reserve(headers.size());
+  for (const auto& header : headers) {
+    // The chunk is being parsed while the next ones are being read
+    std::string compressed{
+        ReadStringViewUnsafe(reader, header.compressed_size)};
+    tasks.push_back(engine::AsyncNoSpan(
+        [compressed = std::move(compressed), header, dictionaries] {
+          return ReadChunk<T>(compressed, header, dictionaries);
+        }));
+  }
+
+  T result{};
+  for (auto& task : tasks) {
+    if (&task == &tasks.front()) {
+      result = task.Get();
+      if constexpr (meta::kIsReservable<T>) {
+        result.reserve(size);
+      }
+    } else {
+      MergeChunk(result, task.Get());
+    }
+  }
+
+  if (std::size(result) != size) {
+    ThrowSizeMismatch(size, std::size(result));
+  }
+  return result;
+}
+
+}  // namespace impl
+
+/// @brief Writes a container as independent zstd-compressed chunks
+///
+/// The chunks are serialized and compressed in parallel by tasks of the
+/// current engine::TaskProcessor, e.g. the `fs-task-processor` of the dumper.
+/// The data starts with an index of the chunks, so dump::ReadChunked can
+/// deserialize the chunks in parallel while the rest of the dump is being read.
+///
+/// The format differs from the one of `writer.Write(value)`, so switching
+/// an existing cache to the chunked format requires a new `format-version`.
+///
+/// ## Example usage:
+///
+/// @snippet core/src/dump/chunked_test.cpp  Sample chunked dump
+template <typename T>
+void WriteChunked(Writer& writer, const T& value,
+                  const ChunkedOptions& options = {}) {
+  static_assert(kIsContainer<T> && kIsWritable<meta::RangeValueType<T>>,
+                "WriteChunked supports only the containers of writable "
+                "elements, see <userver/dump/common_containers.hpp>");
+
+  const std::size_t size = std::size(value);
+  const auto chunks_count = impl::GetChunksCount(size, options);
+
+  std::vector<engine::TaskWithResult<impl::Chunk>> tasks;
+  tasks.reserve(chunks_count);
+
+  auto chunk_begin = std::begin(value);
+  for (std::size_t i = 0; i < chunks_count; ++i) {
+    const std::size_t elements =
+        size / chunks_count + (i < size % chunks_count ? 1 : 0);
+    const auto chunk_end = std::next(chunk_begin, elements);
+
+    tasks.push_back(engine::AsyncNoSpan(
+        [chunk_begin, chunk_end, elements, &options] {
+          impl::StringWriter chunk_writer;
+          for (auto it = chunk_begin; it != chunk_end; ++it) {
+            // explicit cast for vector<bool> shenanigans
+            chunk_writer.Write(
+                static_cast<const meta::RangeValueType<T>&>(*it));
+          }
+          return impl::MakeChunk(elements, std::move(chunk_writer).Extract(),
+                                 options);
+        }));
+    chunk_begin = chunk_end;
+  }
+
+  impl::WriteChunks(writer, size, engine::GetAll(tasks));
+}
+
+/// @brief Reads a container written by dump::WriteChunked
+///
+/// The chunks are decompressed and deserialized in parallel by tasks of the
+/// current engine::TaskProcessor, the results are merged into one container.
+template <typename T>
+T ReadChunked(Reader& reader, To<T>) {
+  return impl::ReadChunked<T>(reader, nullptr);
+}
+
+/// @brief Reads a container written by dump::WriteChunked with or without
+/// ChunkedOptions::dictionary
+///
+/// Keep the previous versions of the dictionary in the registry to read the
+/// dumps written before the dictionary was retrained.
+template <typename T>
+T ReadChunked(Reader& reader, To<T>,
+              const compression::zstd::DictionaryRegistry& dictionaries) {
+  return impl::ReadChunked<T>(reader, &dictionaries);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
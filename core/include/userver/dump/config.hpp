@@ -42,9 +42,11 @@ struct Config final {
   std::string dump_directory;
   std::string fs_task_processor;
   uint64_t max_dump_count;
+  uint64_t max_delta_count;
   std::optional<std::chrono::milliseconds> max_dump_age;
   bool max_dump_age_set;
   bool dump_is_encrypted;
+  bool write_on_stop;
 
   bool static_dumps_enabled;
   std::chrono::milliseconds static_min_dump_interval;
@@ -43,6 +43,17 @@ class DumpableEntity {
   virtual void GetAndWrite(dump::Writer& writer) const = 0;
 
   virtual void ReadAndSet(dump::Reader& reader) = 0;
+
+  /// @brief Writes the changes since the last `GetAndWrite`, `ReadAndSet`,
+  /// `WriteDelta` or `ReadAndApplyDelta` call
+  /// @returns `false` if a delta is not available, e.g. if the changes are
+  /// not tracked, then `Dumper` writes a full dump instead
+  /// @note Only called if `max-delta-count` is set in the static config
+  virtual bool WriteDelta(dump::Writer& writer) const;
+
+  /// @brief Applies a delta written by `WriteDelta` to the current data
+  /// @throws std::exception on failure, then the dump is not loaded
+  virtual void ReadAndApplyDelta(dump::Reader& reader);
 };
 
 enum class UpdateType {
@@ -82,9 +93,20 @@ enum class UpdateType {
 /// `format-version` | `integer` | Allows to ignore dumps written with an obsolete `format-version` | (required)
 /// `max-age` | optional `string` (duration) | Overdue dumps are ignored | null
 /// `max-count` | optional `integer` | Old dumps over the limit are removed from disk | `1`
+/// `max-delta-count` | optional `integer` | The maximum number of deltas written on top of a full dump, `0` disables deltas | `0`
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `write-on-stop` | `boolean` | Whether to write the latest data on the component stop, so that the next start of the service loads it | `false`
+///
+/// ## Delta dumps
+///
+/// If `max-delta-count` is positive and `DumpableEntity::WriteDelta` is
+/// implemented, then updates are appended to the latest full dump as separate
+/// delta files instead of rewriting the whole dump. A full dump is written
+/// again (compacting the deltas) once there are `max-delta-count` deltas,
+/// or once the deltas outgrow the full dump. `ReadDump` loads the full dump
+/// and then applies its deltas in order.
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
@@ -154,6 +176,9 @@ class Dumper final {
   /// method must be called explicitly if the `DumpableEntity` may start its
   /// destruction before the `Dumper` is destroyed.
   ///
+  /// If `write-on-stop` is set in the static config, the first call also
+  /// writes a dump of the latest data synchronously.
+  ///
   /// After calling this method, OnUpdateCompleted calls have no effect.
   void CancelWriteTaskAndWait();
 
@@ -166,7 +191,7 @@ class Dumper final {
          const components::ComponentContext& context, DumpableEntity& dumpable);
 
   class Impl;
-  utils::FastPimpl<Impl, 1088, 16> impl_;
+  utils::FastPimpl<Impl, 1216, 16> impl_;
 };
 
 }  // namespace dump
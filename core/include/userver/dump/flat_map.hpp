@@ -0,0 +1,265 @@
+#pragma once
+
+/// @file userver/dump/flat_map.hpp
+/// @brief @copybrief dump::FlatMap
+///
+/// @ingroup userver_dump_read_write
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/unsafe.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace impl {
+
+struct FlatStringRef final {
+  std::uint64_t offset;
+  std::uint64_t size;
+};
+
+template <typename Value>
+using FlatStoredValue =
+    std::conditional_t<std::is_same_v<Value, std::string_view>, FlatStringRef,
+                       Value>;
+
+template <typename T>
+T LoadUnaligned(const char* data, std::size_t index) noexcept {
+  T result;
+  std::memcpy(&result, data + index * sizeof(T), sizeof(T));
+  return result;
+}
+
+std::shared_ptr<const char> MakeSharedBuffer(std::string&& data);
+
+void CheckFlatMapLayout(std::size_t size, std::size_t key_size,
+                        std::size_t expected_key_size, std::size_t value_size,
+                        std::size_t expected_value_size);
+
+}  // namespace impl
+
+/// @brief Read-only sorted map of flat records, which is dumped as is and is
+/// not deserialized on the dump load
+///
+/// The keys and the values are stored in contiguous sorted arrays, the
+/// `std::string_view` values are stored in a string pool. Such a layout is
+/// written to a dump as is. When the dump is read from a plain file, the map
+/// refers to the memory-mapped dump file instead of copying it, so the load
+/// of the dump is near-instant, the pages are loaded on the first access, and
+/// the memory is shared with all the processes that map the same dump.
+///
+/// Encrypted dumps are read by copying the arrays, still without
+/// per-element deserialization.
+///
+/// The elements are returned by value, because the mapped arrays are not
+/// aligned. Lookups take O(log(N)).
+///
+/// @tparam Key trivially copyable type with `operator<`, e.g. an integer
+/// @tparam Value trivially copyable type or `std::string_view`
+///
+/// ## Example usage:
+///
+/// @snippet core/src/dump/flat_map_test.cpp  Sample dump::FlatMap usage
+template <typename Key, typename Value>
+class FlatMap final {
+  using StoredValue = impl::FlatStoredValue<Value>;
+
+  static constexpr bool kHasStrings = std::is_same_v<Value, std::string_view>;
+
+  static_assert(std::is_trivially_copyable_v<Key> && !std::is_pointer_v<Key>,
+                "FlatMap keys must be flat trivially copyable records");
+  static_assert(std::is_trivially_copyable_v<Value> &&
+                    !std::is_pointer_v<Value>,
+                "FlatMap values must be flat trivially copyable records or "
+                "std::string_view");
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+
+  FlatMap() = default;
+
+  /// @brief Builds the map from unsorted elements
+  /// @note For duplicate keys, the first element is kept
+  /// @note `std::string_view` values are copied into the map
+  explicit FlatMap(std::vector<std::pair<Key, Value>> elements);
+
+  /// Returns the value for the key, `std::nullopt` if it is missing
+  std::optional<Value> Find(const Key& key) const;
+
+  bool contains(const Key& key) const { return FindIndex(key).has_value(); }
+
+  std::size_t size() const noexcept { return size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// Returns the key of the element with the index in the sorted order
+  Key GetKey(std::size_t index) const;
+
+  /// Returns the value of the element with the index in the sorted order
+  Value GetValue(std::size_t index) const;
+
+  /// Calls `func(key, value)` for every element in the sorted order
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  friend void Write(Writer& writer, const FlatMap& value) {
+    writer.Write(value.size_);
+    writer.Write(sizeof(Key));
+    writer.Write(sizeof(StoredValue));
+    WriteStringViewUnsafe(writer, value.GetBlock(value.keys_, sizeof(Key)));
+    WriteStringViewUnsafe(writer,
+                          value.GetBlock(value.values_, sizeof(StoredValue)));
+    if constexpr (kHasStrings) {
+      writer.Write(value.strings_size_);
+      WriteStringViewUnsafe(
+          writer, std::string_view{value.strings_.get(), value.strings_size_});
+    }
+  }
+
+  friend FlatMap Read(Reader& reader, To<FlatMap>) {
+    FlatMap result;
+    result.size_ = reader.Read<std::size_t>();
+    const auto key_size = reader.Read<std::size_t>();
+    const auto value_size = reader.Read<std::size_t>();
+    impl::CheckFlatMapLayout(result.size_, key_size, sizeof(Key), value_size,
+                             sizeof(StoredValue));
+
+    // Neither the keys nor the values are validated, to keep the pages from
+    // being loaded until the first access
+    result.keys_ = ReadSharedUnsafe(reader, result.size_ * sizeof(Key));
+    result.values_ =
+        ReadSharedUnsafe(reader, result.size_ * sizeof(StoredValue));
+    if constexpr (kHasStrings) {
+      result.strings_size_ = reader.Read<std::size_t>();
+      result.strings_ = ReadSharedUnsafe(reader, result.strings_size_);
+    }
+    return result;
+  }
+
+ private:
+  std::optional<std::size_t> FindIndex(const Key& key) const;
+
+  std::string_view GetBlock(const std::shared_ptr<const char>& block,
+                            std::size_t element_size) const noexcept {
+    return {block.get(), size_ * element_size};
+  }
+
+  std::size_t size_{0};
+  std::shared_ptr<const char> keys_;
+  std::shared_ptr<const char> values_;
+  std::shared_ptr<const char> strings_;
+  std::size_t strings_size_{0};
+};
+
+template <typename Key, typename Value>
+FlatMap<Key, Value>::FlatMap(std::vector<std::pair<Key, Value>> elements) {
+  std::stable_sort(
+      elements.begin(), elements.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  elements.erase(std::unique(elements.begin(), elements.end(),
+                             [](const auto& lhs, const auto& rhs) {
+                               return !(lhs.first < rhs.first);
+                             }),
+                 elements.end());
+
+  std::string keys(elements.size() * sizeof(Key), '\0');
+  std::string values(elements.size() * sizeof(StoredValue), '\0');
+  std::string strings;
+  for (std::size_t i = 0; i < elements.size(); ++i) {
+    const auto& [key, value] = elements[i];
+    std::memcpy(keys.data() + i * sizeof(Key), &key, sizeof(Key));
+
+    StoredValue stored_value{};
+    if constexpr (kHasStrings) {
+      stored_value = {strings.size(), value.size()};
+      strings.append(value);
+    } else {
+      stored_value = value;
+    }
+    std::memcpy(values.data() + i * sizeof(StoredValue), &stored_value,
+                sizeof(StoredValue));
+  }
+
+  size_ = elements.size();
+  keys_ = impl::MakeSharedBuffer(std::move(keys));
+  values_ = impl::MakeSharedBuffer(std::move(values));
+  strings_size_ = strings.size();
+  strings_ = impl::MakeSharedBuffer(std::move(strings));
+}
+
+template <typename Key, typename Value>
+std::optional<Value> FlatMap<Key, Value>::Find(const Key& key) const {
+  const auto index = FindIndex(key);
+  if (!index) return std::nullopt;
+  return GetValue(*index);
+}
+
+template <typename Key, typename Value>
+Key FlatMap<Key, Value>::GetKey(std::size_t index) const {
+  UASSERT(index < size_);
+  return impl::LoadUnaligned<Key>(keys_.get(), index);
+}
+
+template <typename Key, typename Value>
+Value FlatMap<Key, Value>::GetValue(std::size_t index) const {
+  UASSERT(index < size_);
+  const auto stored_value =
+      impl::LoadUnaligned<StoredValue>(values_.get(), index);
+
+  if constexpr (kHasStrings) {
+    UINVARIANT(stored_value.offset <= strings_size_ &&
+                   stored_value.size <= strings_size_ - stored_value.offset,
+               "Broken string reference in dump::FlatMap");
+    return std::string_view{strings_.get() + stored_value.offset,
+                            stored_value.size};
+  } else {
+    return stored_value;
+  }
+}
+
+template <typename Key, typename Value>
+template <typename Function>
+void FlatMap<Key, Value>::VisitAll(Function&& func) const {
+  for (std::size_t i = 0; i < size_; ++i) {
+    func(GetKey(i), GetValue(i));
+  }
+}
+
+template <typename Key, typename Value>
+std::optional<std::size_t> FlatMap<Key, Value>::FindIndex(
+    const Key& key) const {
+  std::size_t begin = 0;
+  std::size_t end = size_;
+  while (begin < end) {
+    const auto middle = begin + (end - begin) / 2;
+    if (GetKey(middle) < key) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+
+  if (begin == size_ || key < GetKey(begin)) return std::nullopt;
+  return begin;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
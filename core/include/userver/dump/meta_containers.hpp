@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include <userver/cache/flat_hash_map.hpp>
 #include <userver/dump/meta.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +34,12 @@ void Insert(std::unordered_map<K, V, Hash, Eq, Alloc>& cont,
   cont.insert(std::move(elem));
 }
 
+template <typename K, typename V, typename Hash, typename Eq>
+void Insert(cache::FlatHashMap<K, V, Hash, Eq>& cont,
+            std::pair<const K, V>&& elem) {
+  cont.insert(std::move(elem));
+}
+
 template <typename T, typename Comp, typename Alloc>
 void Insert(std::set<T, Comp, Alloc>& cont, T&& elem) {
   cont.insert(std::forward<T>(elem));
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -68,7 +69,16 @@ class Reader {
   /// @throws `Error` on read operation failure
   virtual std::string_view ReadRaw(std::size_t max_size) = 0;
 
+  /// @brief Reads exactly `size` bytes into memory that is owned by the
+  /// returned pointer and is not invalidated by the further reads
+  /// @details The default implementation copies the data returned by
+  /// `ReadRaw`. Readers of plain files return a memory-mapped region instead.
+  /// @throws `Error` on read operation failure or on end-of-file
+  virtual std::shared_ptr<const char> ReadShared(std::size_t size);
+
   friend std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t size);
+  friend std::shared_ptr<const char> ReadSharedUnsafe(Reader& reader,
+                                                      std::size_t size);
 };
 
 namespace impl {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <memory>
 
 #include <boost/filesystem/operations.hpp>
 
@@ -47,9 +49,14 @@ class FileReader final : public Reader {
  private:
   std::string_view ReadRaw(std::size_t max_size) override;
 
+  // Maps the file on the first call
+  std::shared_ptr<const char> ReadShared(std::size_t size) override;
+
   fs::blocking::CFile file_;
   std::string path_;
   std::string curr_chunk_;
+  std::shared_ptr<const char> mapping_;
+  std::uint64_t mapping_size_{0};
 };
 
 class FileOperationsFactory final : public OperationsFactory {
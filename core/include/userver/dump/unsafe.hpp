@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string_view>
 
 #include <userver/dump/operations.hpp>
@@ -27,6 +28,12 @@ std::string_view ReadStringViewUnsafe(Reader& reader, std::size_t size);
 /// @warning The `string_view` will be invalidated on the next `Read` operation
 std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size);
 
+/// @brief Reads a non-size-prefixed block of `size` bytes, the memory stays
+/// valid until the returned pointer and its copies are destroyed
+/// @note The memory may be mapped from the dump file, so the reads are
+/// zero-copy, and the pages are loaded lazily on the first access
+std::shared_ptr<const char> ReadSharedUnsafe(Reader& reader, std::size_t size);
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
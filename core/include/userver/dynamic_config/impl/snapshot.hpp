@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -56,6 +57,11 @@ class SnapshotData final {
   SnapshotData(const SnapshotData& defaults,
                const std::vector<KeyValue>& overrides);
 
+  /// Same as `SnapshotData(docs_map, overrides)`, but reuses the values from
+  /// `previous` if the docs they were parsed from have not changed
+  SnapshotData(const DocsMap& docs_map, const SnapshotData& previous,
+               const std::vector<KeyValue>& overrides);
+
   SnapshotData(SnapshotData&&) noexcept = default;
   SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -70,10 +76,19 @@ class SnapshotData final {
 
   bool IsEmpty() const noexcept;
 
+  /// Returns `true` if the config is known to be the same object in both
+  /// snapshots; otherwise the values should be compared
+  bool IsSameValue(ConfigId id, const SnapshotData& other) const noexcept;
+
  private:
+  struct ConfigValue;
+  using ConfigValuePtr = std::shared_ptr<const ConfigValue>;
+
+  void ParseMissing(const DocsMap& docs_map, const SnapshotData* previous);
+
   const std::any& DoGet(ConfigId id) const;
 
-  std::vector<std::any> user_configs_;
+  std::vector<ConfigValuePtr> user_configs_;
 };
 
 class StorageData;
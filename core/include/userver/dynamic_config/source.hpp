@@ -220,7 +220,11 @@ class Source final {
     UASSERT(!current.GetData().IsEmpty());
     UASSERT(!previous.GetData().IsEmpty());
 
-    const bool is_equal = (true && ... && (previous[keys] == current[keys]));
+    const bool is_equal =
+        (true && ... &&
+         (previous.GetData().IsSameValue(impl::ConfigIdGetter::Get(keys),
+                                         current.GetData()) ||
+          previous[keys] == current[keys]));
     return !is_equal;
   }
 
@@ -3,6 +3,7 @@
 #include <optional>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -15,8 +16,25 @@ USERVER_NAMESPACE_BEGIN
 
 namespace dynamic_config {
 
+namespace impl {
+
+// For internal use only. The configs a parser has looked at.
+struct DocsMapUsage final {
+  std::vector<std::string> names;
+  bool all_names_used{false};
+};
+
+}  // namespace impl
+
 class DocsMap final {
  public:
+  DocsMap() = default;
+  DocsMap(const DocsMap& other);
+  DocsMap(DocsMap&& other) noexcept;
+  DocsMap& operator=(const DocsMap& other);
+  DocsMap& operator=(DocsMap&& other) noexcept;
+  ~DocsMap() = default;
+
   /* Returns config item or throws an exception if key is missing */
   formats::json::Value Get(std::string_view name) const;
 
@@ -45,11 +63,20 @@ class DocsMap final {
   // For internal use only.
   const utils::impl::TransparentSet<std::string>& GetConfigsExpectedToBeUsed(
       utils::impl::InternalTag) const;
+
+  // For internal use only.
+  // While set, the names passed to 'Has' and 'Get' are recorded in `usage`.
+  // Not copied along with the DocsMap.
+  void SetUsageRecorder(impl::DocsMapUsage* usage,
+                        utils::impl::InternalTag) const;
   /// @endcond
 
  private:
+  void RecordUsage(std::string_view name) const;
+
   utils::impl::TransparentMap<std::string, formats::json::Value> docs_;
   mutable utils::impl::TransparentSet<std::string> configs_to_be_used_;
+  mutable impl::DocsMapUsage* usage_{nullptr};
 };
 
 template <typename ValueType>
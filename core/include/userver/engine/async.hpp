@@ -16,19 +16,29 @@ namespace engine {
 
 namespace impl {
 
+// config.wait_mode is ignored, the one of TaskType is used
 template <template <typename> typename TaskType, typename Function,
           typename... Args>
-[[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
-                                      Task::Importance importance,
-                                      Deadline deadline, Function&& f,
+[[nodiscard]] auto MakeTaskWithResult(TaskConfig config, Function&& f,
                                       Args&&... args) {
   using ResultType =
       typename utils::impl::WrappedCallImplType<Function, Args...>::ResultType;
-  constexpr auto kWaitMode = TaskType<ResultType>::kWaitMode;
+  config.wait_mode = TaskType<ResultType>::kWaitMode;
 
-  return TaskType<ResultType>{
-      MakeTask({task_processor, importance, kWaitMode, deadline},
-               std::forward<Function>(f), std::forward<Args>(args)...)};
+  return TaskType<ResultType>{MakeTask(config, std::forward<Function>(f),
+                                       std::forward<Args>(args)...)};
+}
+
+template <template <typename> typename TaskType, typename Function,
+          typename... Args>
+[[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
+                                      Task::Importance importance,
+                                      Deadline deadline, Function&& f,
+                                      Args&&... args) {
+  return MakeTaskWithResult<TaskType>(
+      TaskConfig{task_processor, importance, Task::WaitMode::kSingleWaiter,
+                 deadline, {}},
+      std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
 }  // namespace impl
@@ -37,6 +37,7 @@ class DetachedTasksSyncBlock final {
   static void Dispose(Token& token) noexcept;
 
  private:
+  struct Shard;
   struct Impl;
   utils::FastPimpl<Impl, 96, 16> impl_;
 };
@@ -24,6 +24,8 @@ struct TaskConfig final {
   Task::Importance importance{Task::Importance::kNormal};
   Task::WaitMode wait_mode{Task::WaitMode::kSingleWaiter};
   engine::Deadline deadline;
+  // The task is cancelled without starting if it is still queued by then
+  engine::Deadline start_deadline;
 };
 
 [[nodiscard]] TaskContext& PlacementNewTaskContext(
@@ -91,7 +91,9 @@ class Storage final {
   Storage& operator=(Storage&&) = delete;
   ~Storage();
 
-  // Copies pointers to inherited variables from 'other'
+  // Shares the snapshot of inherited variables of 'other', in O(1). The
+  // snapshot is copied on the first modification of inherited variables in
+  // either of the storages.
   // 'this' must not contain any variables
   void InheritFrom(Storage& other);
 
@@ -108,7 +110,7 @@ class Storage final {
   // Otherwise it is UB.
   template <typename T, VariableKind Kind>
   T& GetOrEmplace(Key key) {
-    DataBase* const old_data = GetGeneric(key);
+    DataBase* const old_data = GetGeneric<Kind>(key);
     if (!old_data) {
       const bool has_existing_variable = false;
       return DoEmplace<T, Kind>(key, has_existing_variable);
@@ -118,7 +120,7 @@ class Storage final {
 
   template <typename T, VariableKind Kind>
   T* GetOptional(Key key) noexcept {
-    DataBase* const data = GetGeneric(key);
+    DataBase* const data = GetGeneric<Kind>(key);
     if (!data) return nullptr;
     return &static_cast<DataImpl<T, Kind>&>(*data).Get();
   }
@@ -132,7 +134,7 @@ class Storage final {
 
   template <typename T, VariableKind Kind, typename... Args>
   T& Emplace(Key key, Args&&... args) {
-    DataBase* const old_data = GetGeneric(key);
+    DataBase* const old_data = GetGeneric<Kind>(key);
     const bool has_existing_variable = old_data != nullptr;
     auto& result = DoEmplace<T, Kind>(key, has_existing_variable,
                                       std::forward<Args>(args)...);
@@ -141,21 +143,30 @@ class Storage final {
   }
 
   template <typename T, VariableKind Kind>
-  void Erase(Key key) noexcept {
+  void Erase(Key key) {
     static_assert(Kind == VariableKind::kInherited);
     EraseInherited(key);
   }
 
  private:
-  DataBase* GetGeneric(Key key) noexcept;
+  template <VariableKind Kind>
+  DataBase* GetGeneric(Key key) noexcept {
+    if constexpr (Kind == VariableKind::kInherited) {
+      return GetInherited(key);
+    } else {
+      return GetNormal(key);
+    }
+  }
+
+  DataBase* GetNormal(Key key) noexcept;
+
+  InheritedDataBase* GetInherited(Key key) noexcept;
 
   void SetGeneric(Key key, NormalDataBase& node, bool has_existing_variable);
 
   void SetGeneric(Key key, InheritedDataBase& node, bool has_existing_variable);
 
-  void EraseInherited(Key key) noexcept;
-
-  void InheritNode(InheritedDataBase&);
+  void EraseInherited(Key key);
 
   // Provides strong exception guarantee. Does not delete the old data, if any.
   template <typename T, VariableKind Kind, typename... Args>
@@ -167,7 +178,7 @@ class Storage final {
   }
 
   struct Impl;
-  utils::FastPimpl<Impl, 40, 8> impl_;
+  utils::FastPimpl<Impl, 32, 8> impl_;
 };
 
 class Variable final {
@@ -81,6 +81,18 @@ class WritableBase {
     return result;
   }
 
+  /// @brief Sends exactly list_size IoData, a stream may override this to
+  /// gather the buffers into a single write.
+  [[nodiscard]] virtual size_t WriteAll(const IoData* list,
+                                        std::size_t list_size,
+                                        Deadline deadline) {
+    size_t result{0};
+    for (std::size_t i = 0; i < list_size; ++i) {
+      result += WriteAll(list[i].data, list[i].len, deadline);
+    }
+    return result;
+  }
+
   /// For internal use only
   impl::ContextAccessor* TryGetContextAccessor() { return ca_; }
 
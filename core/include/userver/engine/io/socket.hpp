@@ -99,6 +99,11 @@ class [[nodiscard]] Socket final : public RwBase {
   [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size,
                                Deadline deadline);
 
+  [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size,
+                                Deadline deadline) override {
+    return SendAll(list, list_size, deadline);
+  }
+
   /// @brief Sends exactly list_size iovec to the socket.
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const struct iovec* list, std::size_t list_size,
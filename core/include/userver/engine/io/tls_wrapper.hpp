@@ -3,6 +3,8 @@
 /// @file userver/engine/io/tls_wrapper.hpp
 /// @brief TLS socket wrappers
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -17,8 +19,32 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+/// @brief Cache of the client TLS sessions, allows to skip the full handshake
+/// on reconnection to the same server.
+///
+/// Sessions are looked up by the server name or, if it is empty, by the peer
+/// address. Thread safe, may be shared between the clients. Must outlive the
+/// TlsWrappers started with it.
+class TlsClientSessionCache final {
+ public:
+  explicit TlsClientSessionCache(std::size_t max_size = 1024);
+  ~TlsClientSessionCache();
+
+  TlsClientSessionCache(const TlsClientSessionCache&) = delete;
+  TlsClientSessionCache& operator=(const TlsClientSessionCache&) = delete;
+
+ private:
+  friend class TlsWrapper;
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Class for TLS communications over a Socket.
 ///
+/// Servers started with the same certificate and authorities resume the
+/// sessions of each other for the clients that support session tickets.
+///
 /// Not thread safe. E.g. you MAY NOT read and write concurrently from multiple
 /// coroutines.
 ///
@@ -31,12 +57,20 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
                                    const std::string& server_name,
                                    Deadline deadline);
 
+  /// Starts a TLS client on an opened socket, resumes the session from the
+  /// @a session_cache if possible
+  static TlsWrapper StartTlsClient(Socket&& socket,
+                                   const std::string& server_name,
+                                   TlsClientSessionCache& session_cache,
+                                   Deadline deadline);
+
   /// Starts a TLS client with client cert on an opened socket
   static TlsWrapper StartTlsClient(
       Socket&& socket, const std::string& server_name,
       const crypto::Certificate& cert, const crypto::PrivateKey& key,
       Deadline deadline,
-      const std::vector<crypto::Certificate>& extra_cert_authorities = {});
+      const std::vector<crypto::Certificate>& extra_cert_authorities = {},
+      TlsClientSessionCache* session_cache = nullptr);
 
   /// Starts a TLS server on an opened socket
   static TlsWrapper StartTlsServer(
@@ -55,6 +89,9 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
   /// Whether the socket is valid.
   bool IsValid() const override;
 
+  /// Whether the session was resumed instead of a full handshake.
+  bool IsSessionReused() const;
+
   /// Suspends current task until the socket has data available.
   [[nodiscard]] bool WaitReadable(Deadline) override;
 
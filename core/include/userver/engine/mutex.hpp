@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <mutex>  // for std locks
 
 #include <userver/engine/deadline.hpp>
@@ -14,6 +15,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
+/// @brief Contention statistics of an engine::Mutex
+struct MutexStatistics final {
+  /// The number of locks that made the task sleep
+  std::uint64_t waits{0};
+
+  /// The number of locks that were taken by a brief spinning instead of
+  /// sleeping
+  std::uint64_t spin_acquisitions{0};
+
+  /// The total time the tasks slept waiting for the mutex
+  std::chrono::nanoseconds wait_time{0};
+};
+
 /// @ingroup userver_concurrency
 ///
 /// @brief std::mutex replacement for asynchronous tasks.
@@ -85,10 +99,14 @@ class Mutex final {
   /// @overload
   [[nodiscard]] bool try_lock_until(Deadline deadline);
 
+  /// Returns the contention statistics collected since the mutex creation.
+  /// The uncontended locks are not counted.
+  MutexStatistics GetStatistics() const noexcept;
+
  private:
   class Impl;
 
-  utils::FastPimpl<Impl, 96, alignof(void*)> impl_;
+  utils::FastPimpl<Impl, 104, alignof(void*)> impl_;
 };
 
 template <typename Rep, typename Period>
@@ -0,0 +1,161 @@
+#pragma once
+
+/// @file userver/engine/striped_shared_mutex.hpp
+/// @brief @copybrief engine::StripedSharedMutex
+
+#include <atomic>
+#include <chrono>
+
+#include <userver/concurrent/impl/striped_read_indicator.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief engine::SharedMutex replacement for read-mostly data with very
+/// frequent shared locks.
+///
+/// A shared lock only increments a per-thread stripe of a counter and does not
+/// touch any memory written by the other readers, so the readers do not
+/// contend with each other. The price is paid by the writers: a unique lock
+/// waits for all the stripes to drain by polling them, and issues a heavy
+/// memory barrier that interrupts all the threads of the process. Use it where
+/// the writes are rare and `rcu::Variable` does not fit, e.g. because the data
+/// is too expensive to copy.
+///
+/// Ignores task cancellations (succeeds even if the current task is cancelled).
+///
+/// Writers (unique locks) have priority over readers (shared locks): a new
+/// shared lock waits for the pending writes to finish. Under a constant stream
+/// of writes the readers may starve.
+///
+/// Allocates `16 * N_CORES` bytes, see concurrent::impl::StripedReadIndicator.
+///
+/// ## Example usage:
+///
+/// @snippet engine/striped_shared_mutex_test.cpp  Sample engine::StripedSharedMutex usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class StripedSharedMutex final {
+ public:
+  StripedSharedMutex();
+  ~StripedSharedMutex();
+
+  StripedSharedMutex(const StripedSharedMutex&) = delete;
+  StripedSharedMutex(StripedSharedMutex&&) = delete;
+  StripedSharedMutex& operator=(const StripedSharedMutex&) = delete;
+  StripedSharedMutex& operator=(StripedSharedMutex&&) = delete;
+
+  /// Locks the mutex for unique ownership. Blocks current coroutine if the
+  /// mutex is locked by another coroutine for reading or writing.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock();
+
+  /// Unlocks the mutex for unique ownership. Before calling this method the
+  /// the mutex should be locked for unique ownership by current coroutine.
+  void unlock();
+
+  /// Tries to lock the mutex for unique ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock();
+
+  /// Tries to lock the mutex for unique ownership in specified duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for unique ownership till specified time point.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_until(Deadline deadline);
+
+  /// Locks the mutex for shared ownership. Blocks current coroutine if the
+  /// mutex is locked or is being locked by another coroutine for writing.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock_shared();
+
+  /// Unlocks the mutex for shared ownership. Before calling this method the
+  /// mutex should be locked for shared ownership by current coroutine.
+  void unlock_shared() noexcept;
+
+  /// Tries to lock the mutex for shared ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock_shared() noexcept;
+
+  /// Tries to lock the mutex for shared ownership in specified duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_shared_for(
+      const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for shared ownership till specified time point.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_shared_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+ private:
+  bool WaitForNoWriter(Deadline deadline);
+  bool WaitForNoReaders(Deadline deadline);
+  void ReleaseWriter();
+
+  concurrent::impl::StripedReadIndicator readers_;
+
+  // Set by a writer before it waits for the readers to drain. Readers that
+  // see it back off and wait on writer_cv_.
+  std::atomic<bool> writer_{false};
+
+  // Serializes the writers
+  Mutex writers_mutex_;
+
+  Mutex writer_cv_mutex_;
+  ConditionVariable writer_cv_;
+};
+
+template <typename Rep, typename Period>
+bool StripedSharedMutex::try_lock_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Rep, typename Period>
+bool StripedSharedMutex::try_lock_shared_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool StripedSharedMutex::try_lock_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+template <typename Clock, typename Duration>
+bool StripedSharedMutex::try_lock_shared_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -13,6 +13,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::io {
+class PipeReader;
+}  // namespace engine::io
+
 namespace engine::subprocess {
 
 class ChildProcessImpl;
@@ -29,7 +33,8 @@ class ChildProcess final {
   /// Does not terminate the child process (just detaches from it).
   ~ChildProcess();
 
-  /// Returns pid of the child process.
+  /// Returns pid of the child process, or -1 if the command could not be
+  /// executed.
   int GetPid() const;
 
   /// Wait for the child process to terminate.
@@ -63,9 +68,19 @@ class ChildProcess final {
   /// Send a signal to the child process.
   void SendSignal(int signum);
 
+  /// @brief Reading end of the stdout of the child process.
+  /// @note Read the output concurrently with waiting for the process, the
+  /// child blocks once the pipe buffer is full.
+  /// @throws std::logic_error unless ExecOptions::pipe_stdout was set
+  io::PipeReader& GetStdout();
+
+  /// @brief Reading end of the stderr of the child process.
+  /// @throws std::logic_error unless ExecOptions::pipe_stderr was set
+  io::PipeReader& GetStderr();
+
  private:
   static constexpr std::size_t kImplSize =
-      compiler::SelectSize().For64Bit(24).For32Bit(12);
+      compiler::SelectSize().For64Bit(40).For32Bit(20);
   static constexpr std::size_t kImplAlignment = alignof(void*);
   utils::FastPimpl<ChildProcessImpl, kImplSize, kImplAlignment> impl_;
 };
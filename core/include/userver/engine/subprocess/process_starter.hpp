@@ -41,14 +41,29 @@ struct ExecOptions final {
   /// If `true`, and `command` contains `/`, `command` is treated as absolute
   /// path or a relative path.
   bool use_path{false};
+  /// If `true`, stdout is redirected to a pipe, readable from a coroutine via
+  /// ChildProcess::GetStdout(). Can not be combined with `stdout_file`.
+  bool pipe_stdout{false};
+  /// If `true`, stderr is redirected to a pipe, readable from a coroutine via
+  /// ChildProcess::GetStderr(). Can not be combined with `stderr_file`.
+  bool pipe_stderr{false};
+  /// If `true`, ProcessStarter::Exec throws std::system_error if the command
+  /// could not be executed, e.g. it does not exist.
+  /// If `false`, the failure is logged and reported as a child process that
+  /// was terminated by `SIGABRT`, the same as it was for the forked child.
+  bool throw_on_exec_failure{false};
 };
 
 /// @ingroup userver_clients
 ///
 /// @brief Creates a new OS subprocess and executes a command in it.
+///
+/// The subprocess is spawned via `posix_spawn`, which does not copy the page
+/// tables of the service as `fork` does, so the spawning does not stall the
+/// service even with a large RSS.
 class ProcessStarter {
  public:
-  /// @param task_processor will be used for executing asynchronous fork + exec.
+  /// @param task_processor will be used for executing asynchronous spawning.
   /// `main-task-processor is OK for this purpose.
   explicit ProcessStarter(TaskProcessor& task_processor);
 
@@ -60,6 +75,9 @@ class ProcessStarter {
   /// @param options @ref ExecOptions settings
   /// @throws std::runtime_error if `use_path` is `true`, `command` contains `/`
   /// and PATH not in environment variables
+  /// @throws std::system_error if the output files could not be opened, or
+  /// if `throw_on_exec_failure` is `true` and the command could not be
+  /// executed
   ChildProcess Exec(const std::string& command,
                     const std::vector<std::string>& args,
                     ExecOptions&& options = {});
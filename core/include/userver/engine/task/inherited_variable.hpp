@@ -19,6 +19,10 @@ namespace engine {
 /// These are like engine::TaskLocalVariable, but the variable instances are
 /// inherited by child tasks created via utils::Async.
 ///
+/// The child tasks share the variables of their parent until either of them
+/// modifies any, so the cost of a child task start does not depend on the
+/// number of the variables set.
+///
 /// The order of destruction of task-inherited variables is unspecified.
 template <typename T>
 class TaskInheritedVariable final {
@@ -5,7 +5,9 @@
 
 #include <chrono>
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
@@ -180,6 +182,31 @@ TaskProcessor& GetTaskProcessor();
 /// Returns task coroutine stack size
 std::size_t GetStackSize();
 
+/// @brief Moves the current task into the scheduling class `name` of its
+/// engine::TaskProcessor, see the `scheduling-classes` option of
+/// components::ManagerControllerComponent.
+///
+/// Takes effect from the next scheduling of the task. The tasks started by
+/// the current task on the same engine::TaskProcessor afterwards inherit the
+/// class. Does nothing on task processors without scheduling classes.
+///
+/// @throws std::runtime_error if the engine::TaskProcessor has scheduling
+/// classes, but none of them is named `name`
+void SetSchedulingClass(std::string_view name);
+
+/// @brief Returns the memory arena of the current task.
+///
+/// The arena is created on the first call and is released in one go when the
+/// task finishes and its result is destroyed. Deallocations do nothing, so
+/// the arena suits the allocation-heavy tasks with short-lived objects, e.g.
+/// request handling. The memory must not outlive the task and the resource
+/// must not be used for allocations by other tasks.
+///
+/// Pass it to `std::pmr` containers or to formats::json::ArenaScope.
+///
+/// @snippet engine/task/task_arena_test.cpp  Sample GetMemoryResource
+std::pmr::memory_resource& GetMemoryResource();
+
 /// @cond
 // Returns ev thread handle, internal use only
 ev::ThreadControl& GetEventThread();
@@ -16,15 +16,31 @@ namespace fs {
 ///
 /// @brief Class client for storing files in memory
 /// Usually retrieved from `components::FsCache`
+///
+/// Each file gets an ETag from its inode, size and modification time. The
+/// updates only reload the files with a changed ETag.
 class FsCacheClient final {
  public:
+  /// @brief The way the file contents are kept
+  enum class Storage {
+    /// Read the files into memory
+    kRead,
+    /// Map the files into memory. The pages are loaded by the kernel on the
+    /// first access and may be evicted on memory pressure, so large
+    /// directories do not occupy the RAM.
+    /// @warning The files must be replaced atomically (e.g. via rename),
+    /// truncating a mapped file in place crashes the process on access.
+    kMmap,
+  };
+
   /// @brief Fills the cache and starts periodic update
   /// @param dir directory to cache files from
   /// @param update_period time (0 - fill the cache only at startup), not used
   /// in Linux
   /// @param tp task processor to do filesystem operations
+  /// @param storage the way to keep the file contents
   FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period,
-                engine::TaskProcessor& tp);
+                engine::TaskProcessor& tp, Storage storage = Storage::kRead);
 
   /// @brief get file from memory
   /// @param path to file
@@ -50,9 +66,15 @@ class FsCacheClient final {
                              const std::string& path);
 #endif
 
+  // Returns `current` if the file has not changed since it was loaded
+  FileInfoWithDataConstPtr LoadFile(const std::string& path,
+                                    std::string etag,
+                                    FileInfoWithDataConstPtr current) const;
+
   const std::string dir_;
   const std::chrono::milliseconds update_period_;
   engine::TaskProcessor& tp_;
+  const Storage storage_;
 #ifndef __linux__
   utils::PeriodicTask cache_updater_;
 #endif
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -12,6 +13,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace fs::blocking {
+class FileDescriptor;
+}  // namespace fs::blocking
+
 /// @brief filesystem support
 namespace fs {
 
@@ -19,6 +24,19 @@ namespace fs {
 struct FileInfoWithData {
   std::string data;
   std::string extension;
+
+  /// Contents of a memory-mapped file, `data` is empty if it is set
+  std::shared_ptr<const char> mapped_data;
+  std::size_t mapped_size{0};
+
+  /// Strong entity tag of the file, empty if not computed
+  std::string etag;
+
+  /// @returns the file contents, either from `data` or from the mapping
+  std::string_view GetContents() const {
+    return mapped_data ? std::string_view{mapped_data.get(), mapped_size}
+                       : std::string_view{data};
+  }
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -50,6 +68,8 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden});
 
 /// @brief Reads file contents asynchronously
+/// @note The file is read through io_uring when the kernel supports it,
+/// `async_tp` is only used as a fallback then.
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file to open
 /// @returns file contents
@@ -58,6 +78,23 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
 std::string ReadFileContents(engine::TaskProcessor& async_tp,
                              const std::string& path);
 
+/// @brief Reads up to `max_size` bytes at `offset` asynchronously, the
+/// file offset is not changed
+/// @note Uses io_uring when the kernel supports it, like `ReadFileContents`.
+/// With `kDirect` the buffer, the size and the offset must be aligned to
+/// the logical block size of the file system.
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param fd file to read, may be opened with `fs::blocking::OpenFlag::kDirect`
+/// @param buffer storage for at least `max_size` bytes
+/// @param max_size the amount of bytes to read
+/// @param offset position in the file to read from
+/// @returns The amount of bytes actually acquired, which can be equal
+/// to `max_size`, or less on end-of-file
+/// @throws std::runtime_error if read fails for any reason
+std::size_t ReadPositioned(engine::TaskProcessor& async_tp,
+                           blocking::FileDescriptor& fd, char* buffer,
+                           std::size_t max_size, std::size_t offset);
+
 /// @brief Checks whether the file exists asynchronously
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file path to check
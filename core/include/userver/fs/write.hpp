@@ -10,6 +10,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace fs::blocking {
+class FileDescriptor;
+}  // namespace fs::blocking
+
 namespace fs {
 
 /// @{
@@ -29,6 +33,8 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path);
 /// @brief Rewrite file contents asynchronously
 /// It doesn't provide strict atomic guarantees. If you need them, use
 /// `fs::RewriteFileContentsAtomically`.
+/// @note The file is written through io_uring when the kernel supports it,
+/// `async_tp` is only used as a fallback then.
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file to rewrite
 /// @param contents new file contents
@@ -36,6 +42,30 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path);
 void RewriteFileContents(engine::TaskProcessor& async_tp,
                          const std::string& path, std::string_view contents);
 
+/// @brief Writes `contents` at `offset` asynchronously, the file offset is not
+/// changed
+/// @note Uses io_uring when the kernel supports it, like
+/// `RewriteFileContents`. With `fs::blocking::OpenFlag::kDirect` the data,
+/// its size and the offset must be aligned to the logical block size of the
+/// file system.
+/// @warning Unless `FSync` is called, there is no guarantee the data
+/// is stored on disk safely.
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param fd file to write to
+/// @param contents data to write
+/// @param offset position in the file to write at
+/// @throws std::runtime_error if failed to write
+void WritePositioned(engine::TaskProcessor& async_tp,
+                     blocking::FileDescriptor& fd, std::string_view contents,
+                     std::size_t offset);
+
+/// @brief Makes sure the written data is actually stored on disk
+/// @note Uses io_uring when the kernel supports it.
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param fd file to sync
+/// @throws std::runtime_error
+void FSync(engine::TaskProcessor& async_tp, blocking::FileDescriptor& fd);
+
 /// @brief Renames existing file
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param source path to move from
@@ -47,6 +47,8 @@ namespace components {
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
 /// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
+/// deferred_formatting | if `true`, the logging coroutine only copies the message into a binary record, the escaping and the formatting of the timestamp and numbers are done on the `fs-task-processor` of the logger | false
+/// compression | `zstd` to write the log file as a stream of zstd frames, that are flushed with the logs and are readable with `zstd -dc` or `tail -f file | zstd -d`; `none` to write plain text | none
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
 ///
@@ -1,8 +1,10 @@
 #pragma once
 
 /// @file userver/rcu/fwd.hpp
-/// @brief Forward declarations for rcu::Variable and rcu::RcuMap
+/// @brief Forward declarations for rcu::Variable, rcu::RcuMap and
+/// rcu::ShardedRcuMap
 
+#include <cstddef>
 #include <functional>
 #include <unordered_map>
 
@@ -19,6 +21,9 @@ namespace rcu {
 template <typename T>
 struct DefaultRcuTraits;
 
+template <typename T>
+struct EpochRcuTraits;
+
 template <typename Key, typename Value>
 struct DefaultRcuMapTraits;
 
@@ -35,6 +40,10 @@ template <typename Key, typename Value,
           typename RcuMapTraits = DefaultRcuMapTraits<Key, Value>>
 class RcuMap;
 
+template <typename Key, typename Value, std::size_t ShardCount = 16,
+          typename RcuMapTraits = DefaultRcuMapTraits<Key, Value>>
+class ShardedRcuMap;
+
 }  // namespace rcu
 
 USERVER_NAMESPACE_END
@@ -3,9 +3,12 @@
 /// @file userver/rcu/rcu.hpp
 /// @brief @copybrief rcu::Variable
 
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <optional>
+#include <type_traits>
 #include <utility>
 
 #include <userver/concurrent/impl/asymmetric_fence.hpp>
@@ -17,6 +20,7 @@
 #include <userver/rcu/fwd.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/meta_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,6 +39,8 @@ struct SnapshotRecord final {
   concurrent::impl::StripedReadIndicator indicator;
   concurrent::impl::SinglyLinkedHook<SnapshotRecord> free_list_hook;
   SnapshotRecord* next_retired{nullptr};
+  // Only used with ReclamationType::kEpochs
+  std::uint64_t retire_epoch{0};
 };
 
 // Used instead of concurrent::impl::MemberHook to avoid instantiating
@@ -82,16 +88,66 @@ class SnapshotRecordRetiredList final {
   SnapshotRecord<T>* head_{nullptr};
 };
 
+template <typename T>
+using HasReclamation = decltype(T::kReclamation);
+
 }  // namespace impl
 
+/// @brief Can be specified in RcuTraits to customize how rcu::Variable
+/// detects that the old values are no longer used by the readers.
+enum class ReclamationType {
+  /// Each value has its own read indicator, a value is destroyed as soon as
+  /// its last reader is gone
+  kHazardPointers,
+
+  /// The readers only mark the current epoch of the `Variable`, the retired
+  /// values are destroyed in batches once all the readers of the epochs
+  /// in which they were current are gone. Reads are cheaper and consume less
+  /// memory, but a long-living ReadablePtr delays the destruction of all the
+  /// values retired after it was obtained.
+  kEpochs,
+};
+
 /// Default Rcu traits.
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - optional `kReclamation` of type rcu::ReclamationType:
+/// `ReclamationType::kHazardPointers` by default
 template <typename T>
 struct DefaultRcuTraits {
   using MutexType = engine::Mutex;
 };
 
+/// Rcu traits for frequently read variables, where ReadablePtr instances
+/// are short-lived, e.g. for configs that are read on every request.
+/// @see rcu::ReclamationType::kEpochs
+template <typename T>
+struct EpochRcuTraits {
+  using MutexType = engine::Mutex;
+  static constexpr ReclamationType kReclamation = ReclamationType::kEpochs;
+};
+
+namespace impl {
+
+template <typename RcuTraits>
+constexpr ReclamationType GetReclamation() noexcept {
+  if constexpr (meta::kIsDetected<HasReclamation, RcuTraits>) {
+    return RcuTraits::kReclamation;
+  } else {
+    return ReclamationType::kHazardPointers;
+  }
+}
+
+struct EpochState final {
+  std::atomic<std::uint64_t> epoch{0};
+  // Readers that have observed the epoch E lock indicators[E % 2]
+  std::array<concurrent::impl::StripedReadIndicator, 2> indicators;
+};
+
+struct NoEpochState final {};
+
+}  // namespace impl
+
 /// Reader smart pointer for rcu::Variable<T>. You may use operator*() or
 /// operator->() to do something with the stored value. Once created,
 /// ReadablePtr references the same immutable value: if Variable's value is
@@ -101,6 +157,20 @@ template <typename T, typename RcuTraits>
 class [[nodiscard]] ReadablePtr final {
  public:
   explicit ReadablePtr(const Variable<T, RcuTraits>& ptr) {
+    if constexpr (impl::GetReclamation<RcuTraits>() ==
+                  ReclamationType::kEpochs) {
+      auto& state = ptr.epoch_state_;
+      const auto epoch = state.epoch.load(std::memory_order_relaxed);
+      // The epoch may have been advanced in the meantime. That's fine:
+      // any value loaded after the lock is destroyed only after two more
+      // epoch advances, and one of them will wait for this lock.
+      lock_ = state.indicators[epoch % 2].Lock();
+      // Same as for hazard pointers below
+      concurrent::impl::AsymmetricThreadFenceLight();
+      ptr_ = &*ptr.current_.load(std::memory_order_seq_cst)->data;
+      return;
+    }
+
     auto* record = ptr.current_.load();
 
     while (true) {
@@ -312,6 +382,12 @@ class Variable final {
   Variable& operator=(Variable&&) = delete;
 
   ~Variable() {
+    if constexpr (kReclamation == ReclamationType::kEpochs) {
+      UASSERT_MSG(concurrent::impl::StripedReadIndicator::AreAllFree(
+                      epoch_state_.indicators),
+                  "RCU variable is destroyed while being used");
+    }
+
     {
       auto* record = current_.load();
       UASSERT_MSG(record->indicator.IsFree(),
@@ -388,6 +464,9 @@ class Variable final {
   friend class ReadablePtr<T, RcuTraits>;
   friend class WritablePtr<T, RcuTraits>;
 
+  static constexpr ReclamationType kReclamation =
+      impl::GetReclamation<RcuTraits>();
+
   void DoAssign(impl::SnapshotRecord<T>& new_snapshot,
                 std::unique_lock<MutexType>& lock) {
     UASSERT(lock.owns_lock());
@@ -397,6 +476,11 @@ class Variable final {
     current_.store(&new_snapshot, std::memory_order_seq_cst);
 
     UASSERT(old_snapshot);
+    if constexpr (kReclamation == ReclamationType::kEpochs) {
+      // Only modified under the lock
+      old_snapshot->retire_epoch =
+          epoch_state_.epoch.load(std::memory_order_relaxed);
+    }
     retired_list_.Push(*old_snapshot);
     ScanRetiredList(lock);
   }
@@ -428,6 +512,11 @@ class Variable final {
     UASSERT(lock.owns_lock());
     if (retired_list_.IsEmpty()) return;
 
+    if constexpr (kReclamation == ReclamationType::kEpochs) {
+      ScanRetiredListByEpochs();
+      return;
+    }
+
     concurrent::impl::AsymmetricThreadFenceHeavy();
 
     retired_list_.RemoveAndDisposeIf(
@@ -437,6 +526,28 @@ class Variable final {
         [&](impl::SnapshotRecord<T>& record) { DeleteSnapshot(record); });
   }
 
+  // A value retired in the epoch E may only be observed by the readers of
+  // the epochs up to E, so it is destroyed once the epoch reaches E + 2.
+  // Advancing the epoch to E waits for the readers of the epoch E - 2, which
+  // share the read indicator.
+  void ScanRetiredListByEpochs() noexcept {
+    auto& state = epoch_state_;
+
+    for (int i = 0; i < 2 && !retired_list_.IsEmpty(); ++i) {
+      concurrent::impl::AsymmetricThreadFenceHeavy();
+
+      const auto new_epoch = state.epoch.load(std::memory_order_relaxed) + 1;
+      if (!state.indicators[new_epoch % 2].IsFree()) return;
+      state.epoch.store(new_epoch, std::memory_order_seq_cst);
+
+      retired_list_.RemoveAndDisposeIf(
+          [new_epoch](impl::SnapshotRecord<T>& record) {
+            return record.retire_epoch + 2 <= new_epoch;
+          },
+          [&](impl::SnapshotRecord<T>& record) { DeleteSnapshot(record); });
+    }
+  }
+
   void DeleteSnapshot(impl::SnapshotRecord<T>& record) {
     switch (destruction_type_) {
       case DestructionType::kSync:
@@ -462,6 +573,10 @@ class Variable final {
   impl::SnapshotRecordFreeList<T> free_list_;
   impl::SnapshotRecordRetiredList<T> retired_list_;
   std::atomic<impl::SnapshotRecord<T>*> current_;
+  // Readers lock the indicators of a const Variable
+  mutable std::conditional_t<kReclamation == ReclamationType::kEpochs,
+                             impl::EpochState, impl::NoEpochState>
+      epoch_state_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
@@ -0,0 +1,294 @@
+#pragma once
+
+/// @file userver/rcu/sharded_rcu_map.hpp
+/// @brief @copybrief rcu::ShardedRcuMap
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include <userver/rcu/fwd.hpp>
+#include <userver/rcu/rcu_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+namespace impl {
+
+// std::hash is the identity for integers, so the hash is mixed before taking
+// the shard index to keep sequential keys from landing in the same shard
+inline std::size_t GetShardIndex(std::size_t hash,
+                                 std::size_t shard_count) noexcept {
+  const auto mixed = static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+  return static_cast<std::size_t>(mixed >> 32) % shard_count;
+}
+
+}  // namespace impl
+
+/// @brief Forward iterator for the rcu::ShardedRcuMap
+///
+/// Use member functions of rcu::ShardedRcuMap to retrieve the iterator.
+template <typename Shards, typename ShardIterator>
+class ShardedRcuMapIterator final {
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using difference_type = ptrdiff_t;
+  using value_type = typename ShardIterator::value_type;
+  using reference = typename ShardIterator::reference;
+  using pointer = typename ShardIterator::pointer;
+
+  ShardedRcuMapIterator() = default;
+
+  ShardedRcuMapIterator operator++(int);
+  ShardedRcuMapIterator& operator++();
+  reference operator*() const { return *it_; }
+  pointer operator->() const { return it_.operator->(); }
+
+  bool operator==(const ShardedRcuMapIterator&) const;
+  bool operator!=(const ShardedRcuMapIterator&) const;
+
+  /// @cond
+  /// For internal use only
+  explicit ShardedRcuMapIterator(Shards& shards);
+  /// @endcond
+
+ private:
+  void SkipEmptyShards();
+
+  Shards* shards_{nullptr};
+  std::size_t shard_index_{0};
+  ShardIterator it_;
+};
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Map-like structure allowing RCU keyset updates, that splits the
+/// keys between `ShardCount` independent rcu::RcuMap shards.
+///
+/// The interface mirrors rcu::RcuMap. A keyset change copies only the shard
+/// that contains the key, so for write-heavy maps the copying is about
+/// `ShardCount` times cheaper than with a single rcu::RcuMap, and the writers
+/// of different shards do not contend for the same mutex. Reads stay
+/// lock-free and cost a single extra hash mixing.
+///
+/// The shards are independent, so neither iteration nor `GetSnapshot` fix
+/// the keyset of the whole map at a single point in time: each shard is
+/// fixed when the iteration reaches it. Use rcu::RcuMap if the changes of
+/// several keys must become visible atomically.
+///
+/// @note No synchronization is provided for value access, it must be
+/// implemented by Value when necessary.
+///
+/// ## Example usage:
+///
+/// @snippet rcu/sharded_rcu_map_test.cpp  Sample rcu::ShardedRcuMap usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value, std::size_t ShardCount,
+          typename RcuMapTraits>
+class ShardedRcuMap final {
+  static_assert(ShardCount > 0);
+
+  using Shard = RcuMap<Key, Value, RcuMapTraits>;
+  using Shards = std::array<Shard, ShardCount>;
+
+ public:
+  using Hash = typename Shard::Hash;
+  using KeyEqual = typename Shard::KeyEqual;
+  using ValuePtr = typename Shard::ValuePtr;
+  using ConstValuePtr = typename Shard::ConstValuePtr;
+  using Iterator = ShardedRcuMapIterator<Shards, typename Shard::Iterator>;
+  using ConstIterator =
+      ShardedRcuMapIterator<const Shards, typename Shard::ConstIterator>;
+  using RawMap = typename Shard::RawMap;
+  using Snapshot = typename Shard::Snapshot;
+  using InsertReturnType = typename Shard::InsertReturnType;
+
+  static constexpr std::size_t kShardCount = ShardCount;
+
+  ShardedRcuMap() = default;
+
+  ShardedRcuMap(const ShardedRcuMap&) = delete;
+  ShardedRcuMap(ShardedRcuMap&&) = delete;
+  ShardedRcuMap& operator=(const ShardedRcuMap&) = delete;
+  ShardedRcuMap& operator=(ShardedRcuMap&&) = delete;
+
+  /// Returns an estimated size of the map at some point in time
+  size_t SizeApprox() const;
+
+  /// @name Iteration support
+  /// @details Keyset of each shard is fixed when the iteration reaches it and
+  /// is not affected by concurrent changes.
+  /// @{
+  ConstIterator begin() const { return ConstIterator{shards_}; }
+  ConstIterator end() const { return {}; }
+  Iterator begin() { return Iterator{shards_}; }
+  Iterator end() { return {}; }
+  /// @}
+
+  /// @brief Returns a readonly value pointer by its key if exists
+  /// @throws MissingKeyException if the key is not present
+  const ConstValuePtr operator[](const Key& key) const {
+    return GetShard(key)[key];
+  }
+
+  /// @brief Returns a modifiable value pointer by key if exists or
+  /// default-creates one
+  /// @note Copies the shard of the key if the key doesn't exist.
+  const ValuePtr operator[](const Key& key) { return GetShard(key)[key]; }
+
+  /// @brief Inserts a new element if there is no element with the key.
+  /// @see rcu::RcuMap::Insert
+  InsertReturnType Insert(const Key& key, ValuePtr value) {
+    return GetShard(key).Insert(key, std::move(value));
+  }
+
+  /// @brief Inserts a new element constructed in-place with the given args if
+  /// there is no element with the key.
+  /// @see rcu::RcuMap::Emplace
+  template <typename... Args>
+  InsertReturnType Emplace(const Key& key, Args&&... args) {
+    return GetShard(key).Emplace(key, std::forward<Args>(args)...);
+  }
+
+  /// @brief Like `Emplace`, but does not construct the value if the key
+  /// already exists.
+  /// @see rcu::RcuMap::TryEmplace
+  template <typename... Args>
+  InsertReturnType TryEmplace(const Key& key, Args&&... args) {
+    return GetShard(key).TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  /// @brief Replaces the value of the key if it exists, inserts a new pair
+  /// otherwise.
+  template <typename RawKey>
+  void InsertOrAssign(RawKey&& key, ValuePtr value) {
+    auto& shard = GetShard(key);
+    shard.InsertOrAssign(std::forward<RawKey>(key), std::move(value));
+  }
+
+  /// @brief Returns a readonly value pointer by its key or an empty pointer
+  const ConstValuePtr Get(const Key& key) const {
+    return GetShard(key).Get(key);
+  }
+
+  /// @brief Returns a modifiable value pointer by key or an empty pointer
+  const ValuePtr Get(const Key& key) { return GetShard(key).Get(key); }
+
+  /// @brief Removes a key from the map
+  /// @returns whether the key was present
+  /// @note Copies the shard of the key.
+  bool Erase(const Key& key) { return GetShard(key).Erase(key); }
+
+  /// @brief Removes a key from the map returning its value
+  /// @returns a value if the key was present, empty pointer otherwise
+  /// @note Copies the shard of the key.
+  ValuePtr Pop(const Key& key) { return GetShard(key).Pop(key); }
+
+  /// Resets the map to an empty state
+  void Clear();
+
+  /// @brief Replace current data by data from `new_map`.
+  /// @note The shards are replaced one by one, so readers may observe a mix
+  /// of the old and the new data.
+  void Assign(RawMap new_map);
+
+  /// @brief Returns a readonly copy of the map
+  /// @note Equivalent to `{begin(), end()}` construct, preferable
+  /// for long-running operations.
+  Snapshot GetSnapshot() const { return {begin(), end()}; }
+
+ private:
+  std::size_t GetShardIndex(const Key& key) const {
+    return impl::GetShardIndex(Hash{}(key), ShardCount);
+  }
+
+  Shard& GetShard(const Key& key) { return shards_[GetShardIndex(key)]; }
+
+  const Shard& GetShard(const Key& key) const {
+    return shards_[GetShardIndex(key)];
+  }
+
+  Shards shards_;
+};
+
+template <typename K, typename V, std::size_t ShardCount, typename Traits>
+size_t ShardedRcuMap<K, V, ShardCount, Traits>::SizeApprox() const {
+  size_t result = 0;
+  for (const auto& shard : shards_) result += shard.SizeApprox();
+  return result;
+}
+
+template <typename K, typename V, std::size_t ShardCount, typename Traits>
+void ShardedRcuMap<K, V, ShardCount, Traits>::Clear() {
+  for (auto& shard : shards_) shard.Clear();
+}
+
+template <typename K, typename V, std::size_t ShardCount, typename Traits>
+void ShardedRcuMap<K, V, ShardCount, Traits>::Assign(RawMap new_map) {
+  std::array<RawMap, ShardCount> shard_maps;
+  while (!new_map.empty()) {
+    auto node = new_map.extract(new_map.begin());
+    shard_maps[GetShardIndex(node.key())].insert(std::move(node));
+  }
+  for (std::size_t i = 0; i < ShardCount; ++i) {
+    shards_[i].Assign(std::move(shard_maps[i]));
+  }
+}
+
+template <typename Shards, typename ShardIterator>
+ShardedRcuMapIterator<Shards, ShardIterator>::ShardedRcuMapIterator(
+    Shards& shards)
+    : shards_(&shards), it_(shards[0].begin()) {
+  SkipEmptyShards();
+}
+
+template <typename Shards, typename ShardIterator>
+auto ShardedRcuMapIterator<Shards, ShardIterator>::operator++(int)
+    -> ShardedRcuMapIterator {
+  ShardedRcuMapIterator tmp(*this);
+  ++*this;
+  return tmp;
+}
+
+template <typename Shards, typename ShardIterator>
+auto ShardedRcuMapIterator<Shards, ShardIterator>::operator++()
+    -> ShardedRcuMapIterator& {
+  ++it_;
+  SkipEmptyShards();
+  return *this;
+}
+
+template <typename Shards, typename ShardIterator>
+bool ShardedRcuMapIterator<Shards, ShardIterator>::operator==(
+    const ShardedRcuMapIterator& rhs) const {
+  // End iterators have no shards, every other iterator points to an element
+  if (!shards_ || !rhs.shards_) return shards_ == rhs.shards_;
+  return shard_index_ == rhs.shard_index_ && it_ == rhs.it_;
+}
+
+template <typename Shards, typename ShardIterator>
+bool ShardedRcuMapIterator<Shards, ShardIterator>::operator!=(
+    const ShardedRcuMapIterator& rhs) const {
+  return !(*this == rhs);
+}
+
+template <typename Shards, typename ShardIterator>
+void ShardedRcuMapIterator<Shards, ShardIterator>::SkipEmptyShards() {
+  while (it_ == ShardIterator{}) {
+    if (++shard_index_ == shards_->size()) {
+      *this = {};
+      return;
+    }
+    it_ = (*shards_)[shard_index_].begin();
+  }
+}
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
@@ -60,6 +60,7 @@ namespace components {
 /// port | port to listen on | 0
 /// unix-socket | unix socket to listen on instead of listening on a port and network address | ''
 /// max_connections | max connections count to keep | 32768
+/// shed-connections-on-overload | drop new connections right after accepting them while the congestion control throttles the requests | false
 /// task_processor | task processor to process incoming requests | -
 /// backlog | max count of new connections pending acceptance | 1024
 /// tls.ca | paths to TLS CAs for client authentication | -
@@ -77,6 +78,8 @@ namespace components {
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
 /// connection.stream_close_check_delay | delay in microseconds of the start of stream close check routine; do not set if not sure what it is doing | 20ms
+/// connection.http2_enabled | accept HTTP/2 connections with prior knowledge (h2c) alongside HTTP/1.1 ones, TLS connections stay HTTP/1.1 | false
+/// connection.pipeline_concurrency | how many pipelined HTTP/1.1 requests of a connection are handled concurrently; responses of completed requests are coalesced into a single write | 1
 /// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
 /// middleware-pipeline-builder | name of a component to build a server-wide middleware pipeline | default-server-middleware-pipeline-builder
 ///
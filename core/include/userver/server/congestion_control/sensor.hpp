@@ -22,6 +22,8 @@ class Sensor final : public USERVER_NAMESPACE::congestion_control::Sensor {
  public:
   explicit Sensor(engine::TaskProcessor& tp);
 
+  /// Fills the Data::system_pressure_percent from the PSI and the CPU
+  /// throttling counters of the cgroup of the process, if available
   Data FetchCurrent() override;
 
   void RegisterRequestsSource(RequestsSource& source);
@@ -34,6 +36,11 @@ class Sensor final : public USERVER_NAMESPACE::congestion_control::Sensor {
   std::uint64_t last_overloads_{0};
   std::uint64_t last_no_overloads_{0};
   std::uint64_t last_requests_{0};
+
+  std::uint64_t last_cpu_stall_us_{0};
+  std::uint64_t last_memory_stall_us_{0};
+  std::uint64_t last_cpu_periods_{0};
+  std::uint64_t last_cpu_throttled_periods_{0};
 };
 
 }  // namespace server::congestion_control
@@ -0,0 +1,75 @@
+#pragma once
+
+/// @file userver/server/handlers/auth/verified_token_cache.hpp
+/// @brief @copybrief server::handlers::auth::VerifiedTokenCache
+
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/crypto/verifiers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers::auth {
+
+/// @brief Bounded cache of the tokens with verified signatures, e.g. of JWTs.
+///
+/// Clients send the same token with each request until it expires, so the
+/// signature of a token is verified only on the first request and the
+/// following ones only look it up. The tokens are keyed by their SHA-256
+/// hashes, so the cache does not store the tokens themselves.
+///
+/// The cache does not know the key the token was verified with, use a
+/// separate cache for each crypto::Verifier and Invalidate() the cache when
+/// the keys are rotated.
+///
+/// @par Usage synopsis
+/// @code
+/// const auto [signed_part, signature] = SplitJwt(token);
+/// cache_.Verify(verifier_, token, {signed_part}, signature, GetExpiry(token));
+/// @endcode
+class VerifiedTokenCache final {
+ public:
+  using TimePoint = std::chrono::system_clock::time_point;
+
+  /// For the description of `ways` and `way_size`, see the
+  /// cache::NWayLRU::NWayLRU constructor.
+  VerifiedTokenCache(std::size_t ways, std::size_t way_size);
+
+  /// @brief Verifies the signature of the token, unless the same token was
+  /// verified before and has not expired yet.
+  /// @param token the whole token, the cache key
+  /// @param data the signed parts of the token
+  /// @param expires_at the token is not taken from the cache after this
+  /// time, e.g. the `exp` claim of a JWT
+  /// @throws crypto::VerificationError, the tokens with invalid signatures
+  /// are not cached
+  void Verify(const crypto::Verifier& verifier, std::string_view token,
+              std::initializer_list<std::string_view> data,
+              std::string_view raw_signature, TimePoint expires_at);
+
+  /// Returns true if the token was marked as verified and has not expired yet
+  bool IsVerified(std::string_view token);
+
+  /// Caches the token with a verified signature until `expires_at`
+  void MarkVerified(std::string_view token, TimePoint expires_at);
+
+  /// Forgets all the tokens, e.g. after the keys rotation
+  void Invalidate();
+
+  std::size_t GetSize() const;
+
+ private:
+  // SHA-256 of the token in binary form
+  using TokenHash = std::string;
+
+  cache::NWayLRU<TokenHash, TimePoint> tokens_;
+};
+
+}  // namespace server::handlers::auth
+
+USERVER_NAMESPACE_END
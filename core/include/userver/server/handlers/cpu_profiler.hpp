@@ -0,0 +1,83 @@
+#pragma once
+
+/// @file userver/server/handlers/cpu_profiler.hpp
+/// @brief @copybrief server::handlers::CpuProfiler
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that controls the sampling CPU profiler of the
+/// TaskProcessor threads.
+///
+/// Each worker thread is sampled by a per-thread CPU time timer, so the idle
+/// threads cost nothing and the overhead of the busy threads is proportional
+/// to the frequency: ~0.1% of CPU with the default frequency. The samples are
+/// labeled with the name of the task processor and with the name of the root
+/// tracing::Span of the task. The stacks are symbolized only on profile
+/// retrieval.
+///
+/// The profiler uses the SIGPROF signal and per-thread timers, so it is only
+/// available on Linux and conflicts with other SIGPROF based profilers.
+///
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase and adds
+/// the following ones:
+///
+/// Name      | Description                                   | Default value
+/// --------- | --------------------------------------------- | -------------
+/// frequency | default sampling frequency of each thread, Hz | 99
+/// autostart | start profiling on service start              | false
+///
+/// ## Static configuration example:
+///
+/// @snippet components/common_server_component_list_test.cpp  Sample handler cpu profiler component config
+///
+/// ## Schema
+/// Set an URL path argument `command` to one of the following values:
+/// * `start` - to start profiling, an optional `frequency` argument overrides
+///   the static option
+/// * `stop` - to stop profiling, the collected samples are kept
+/// * `reset` - to forget the collected samples
+/// * `pprof` - to get the collected profile in the pprof format, e.g.
+///   `curl -X POST localhost:1188/service/cpu-profiler/pprof > cpu.pb && go tool pprof -http=: cpu.pb`
+/// * `folded` - to get the collected profile in the 'folded stacks' format
+///   of the FlameGraph tools
+/// * `stat` - to get the state of the profiler
+
+// clang-format on
+
+class CpuProfiler final : public HttpHandlerBase {
+ public:
+  CpuProfiler(const components::ComponentConfig&,
+              const components::ComponentContext&);
+  ~CpuProfiler() override;
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::CpuProfiler
+  static constexpr std::string_view kName = "handler-cpu-profiler";
+
+  std::string HandleRequestThrow(const http::HttpRequest&,
+                                 request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const std::size_t default_frequency_;
+  utils::PeriodicTask drain_task_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::CpuProfiler> =
+    true;
+
+USERVER_NAMESPACE_END
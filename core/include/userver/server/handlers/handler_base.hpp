@@ -26,6 +26,7 @@ namespace server::handlers {
 /// path | if a request matches this path wildcard then process it by handler | -
 /// as_fallback | set to "implicit-http-options" and do not specify a path if this handler processes the OPTIONS requests for paths that do not process OPTIONS method | -
 /// task_processor | a task processor to execute the requests | -
+/// scheduling-class | scheduling class of the `task_processor` to run the requests in, see `scheduling-classes` in components::ManagerControllerComponent | the first class of the task processor
 /// method | comma-separated list of allowed HTTP methods. HEAD method is implicitly enabled if GET method is enabled | -
 /// max_request_size | max size of the whole request | 1024 * 1024
 /// max_headers_size | max request headers size | 65536
@@ -36,6 +37,7 @@ namespace server::handlers {
 /// request_body_size_log_limit | trim request to this size before logging | 512
 /// response_data_size_log_limit | trim responses to this size before logging | 512
 /// max_requests_per_second | integer to limit RPS to this handler | <no limit>
+/// adaptive_concurrency_limit | limit pending requests to this handler by a limit adjusted to the handler timings, see congestion_control::v2::GradientController for the algorithm; object with `min-limit`, `max-limit`, `rtt-tolerance`, `smoothing`, `min-qps` and `fake-mode` fields | <no limit>
 /// decompress_request | allow decompression of the requests | true
 /// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
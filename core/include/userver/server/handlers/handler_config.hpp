@@ -5,6 +5,7 @@
 #include <variant>
 #include <vector>
 
+#include <userver/congestion_control/controllers/gradient_config.hpp>
 #include <userver/server/handlers/auth/handler_auth_config.hpp>
 #include <userver/server/handlers/fallback_handlers.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -29,6 +30,7 @@ enum class UrlTrailingSlashOption {
 struct HandlerConfig {
   std::variant<std::string, FallbackHandler> path;
   std::string task_processor;
+  std::optional<std::string> scheduling_class;
   std::string method;
   request::HttpRequestConfig request_config{};
   size_t request_body_size_log_limit{0};
@@ -37,9 +39,12 @@ struct HandlerConfig {
   UrlTrailingSlashOption url_trailing_slash{UrlTrailingSlashOption::kDefault};
   std::optional<size_t> max_requests_in_flight;
   std::optional<size_t> max_requests_per_second;
+  std::optional<USERVER_NAMESPACE::congestion_control::v2::GradientConfig>
+      adaptive_concurrency_limit;
   bool decompress_request{true};
   bool throttling_enabled{true};
   bool response_body_stream{false};
+  bool request_body_stream{false};
   std::optional<bool> set_response_server_hostname;
   bool set_tracing_headers{true};
   bool deadline_propagation_enabled{true};
@@ -198,7 +198,6 @@ class HttpHandlerBase : public HandlerBase {
   void FormatStatistics(utils::statistics::Writer result,
                         const HttpStatistics& stats);
 
-  void SetResponseServerHostname(http::HttpResponse& response) const;
 
   void BuildMiddlewarePipeline(const components::ComponentConfig&,
                                const components::ComponentContext&);
@@ -213,7 +212,8 @@ class HttpHandlerBase : public HandlerBase {
   std::unique_ptr<HttpHandlerStatistics> handler_statistics_;
   std::unique_ptr<HttpRequestStatistics> request_statistics_;
 
-  bool set_response_server_hostname_;
+  // Server and X-YaTaxi-Server-Hostname headers
+  std::unique_ptr<http::impl::PrecomputedHeaders> precomputed_headers_;
   bool is_body_streamed_;
 
   std::unique_ptr<middlewares::HttpMiddlewareBase> first_middleware_;
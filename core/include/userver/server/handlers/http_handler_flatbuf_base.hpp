@@ -3,7 +3,11 @@
 /// @file userver/server/handlers/http_handler_flatbuf_base.hpp
 /// @brief @copybrief server::handlers::HttpHandlerFlatbufBase
 
+#include <cstddef>
+#include <memory>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 
@@ -21,6 +25,61 @@ namespace impl {
 inline constexpr std::string_view kFlatbufRequestDataName = "__request_flatbuf";
 inline constexpr std::string_view kFlatbufResponseDataName =
     "__response_flatbuf";
+inline constexpr std::string_view kFlatbufRequestTableName =
+    "__request_flatbuf_table";
+inline constexpr std::string_view kFlatbufResponseBufferName =
+    "__response_flatbuf_buffer";
+
+// Builders of a thread are reused by the responses built on it. A builder
+// belongs to a single response at a time, so the handler may suspend and
+// continue on another thread while building the response.
+inline constexpr std::size_t kMaxCachedFlatbufBuilders = 16;
+// Builders that produced bigger responses are not cached to not keep
+// the memory of occasional big responses
+inline constexpr std::size_t kMaxCachedFlatbufBuilderSize = 1024 * 1024;
+
+struct FlatbufBuildersCache final {
+  FlatbufBuildersCache() { builders.reserve(kMaxCachedFlatbufBuilders); }
+  ~FlatbufBuildersCache();
+
+  std::vector<std::unique_ptr<flatbuffers::FlatBufferBuilder>> builders;
+};
+
+inline thread_local bool is_flatbuf_builders_cache_destroyed = false;
+inline thread_local FlatbufBuildersCache flatbuf_builders_cache;
+
+inline FlatbufBuildersCache::~FlatbufBuildersCache() {
+  is_flatbuf_builders_cache_destroyed = true;
+}
+
+inline void ReleaseFlatbufBuilder(
+    flatbuffers::FlatBufferBuilder* builder_ptr) noexcept {
+  std::unique_ptr<flatbuffers::FlatBufferBuilder> builder{builder_ptr};
+  if (is_flatbuf_builders_cache_destroyed) return;
+  if (builder->GetSize() > kMaxCachedFlatbufBuilderSize) return;
+
+  auto& builders = flatbuf_builders_cache.builders;
+  if (builders.size() < kMaxCachedFlatbufBuilders) {
+    // Keeps the allocated buffer
+    builder->Clear();
+    builders.push_back(std::move(builder));
+  }
+}
+
+/// Returns a cleared builder that goes back to the cache of the current
+/// thread on destruction of the last copy of the pointer
+inline std::shared_ptr<flatbuffers::FlatBufferBuilder> AcquireFlatbufBuilder() {
+  std::unique_ptr<flatbuffers::FlatBufferBuilder> builder;
+  if (!is_flatbuf_builders_cache_destroyed) {
+    auto& builders = flatbuf_builders_cache.builders;
+    if (!builders.empty()) {
+      builder = std::move(builders.back());
+      builders.pop_back();
+    }
+  }
+  if (!builder) builder = std::make_unique<flatbuffers::FlatBufferBuilder>();
+  return {builder.release(), &ReleaseFlatbufBuilder};
+}
 
 }  // namespace impl
 
@@ -166,6 +225,151 @@ HttpHandlerFlatbufBase<InputType, ReturnType>::GetStaticConfigSchema() {
   return schema;
 }
 
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers userver_base_classes
+///
+/// @brief Base for handlers that accept requests with body in Flatbuffer
+/// format and respond with body in Flatbuffer format without the object API.
+///
+/// Unlike server::handlers::HttpHandlerFlatbufBase the request is not
+/// unpacked: the handler gets the verified table right over the request body.
+/// The response is built by the handler into a flatbuffers::FlatBufferBuilder
+/// reused by the requests of the thread, the finished buffer is sent without
+/// copying.
+///
+/// ## Example usage:
+///
+/// @snippet samples/flatbuf_service/flatbuf_service.cpp Flatbuf service sample - view component
+
+// clang-format on
+
+template <typename InputType, typename ReturnType>
+class HttpHandlerFlatbufViewBase : public HttpHandlerBase {
+  static_assert(std::is_base_of<flatbuffers::Table, InputType>::value,
+                "Input type should be auto-generated FlatBuffers table type");
+  static_assert(std::is_base_of<flatbuffers::Table, ReturnType>::value,
+                "Return type should be auto-generated FlatBuffers table type");
+
+ public:
+  HttpHandlerFlatbufViewBase(
+      const components::ComponentConfig& config,
+      const components::ComponentContext& component_context);
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext& context) const final;
+
+  /// @brief Builds the response into the `builder`, the builder is finished
+  /// with the returned table.
+  ///
+  /// `input` points into the request body and is valid during the handling
+  /// of the request.
+  virtual flatbuffers::Offset<ReturnType> HandleRequestFlatbufViewThrow(
+      const http::HttpRequest& request, const InputType& input,
+      flatbuffers::FlatBufferBuilder& builder,
+      request::RequestContext& context) const = 0;
+
+  /// @returns A pointer to the verified input table or nullptr if the request
+  /// body was not parsed successfully.
+  const InputType* GetInputTable(const request::RequestContext& context) const;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Override it if you need a custom request body logging.
+  std::string GetRequestBodyForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& request_body) const override;
+
+  /// Override it if you need a custom response data logging. The
+  /// `response_data` is empty, the default implementation logs the finished
+  /// buffer.
+  std::string GetResponseDataForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& response_data) const override;
+
+  void ParseRequestData(const http::HttpRequest& request,
+                        request::RequestContext& context) const final;
+};
+
+template <typename InputType, typename ReturnType>
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HttpHandlerFlatbufViewBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context) {}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HandleRequestThrow(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto* input = context.GetData<const InputType*>(
+      impl::kFlatbufRequestTableName);
+
+  auto builder = impl::AcquireFlatbufBuilder();
+  builder->Finish(
+      HandleRequestFlatbufViewThrow(request, *input, *builder, context));
+
+  const std::string_view buffer{
+      reinterpret_cast<const char*>(builder->GetBufferPointer()),
+      builder->GetSize()};
+  context.SetData(std::string{impl::kFlatbufResponseBufferName}, buffer);
+  // The builder goes back to the cache after the response is sent
+  request.GetHttpResponse().AppendBodySegment(std::move(builder), buffer);
+  return {};
+}
+
+template <typename InputType, typename ReturnType>
+const InputType*
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetInputTable(
+    const request::RequestContext& context) const {
+  const auto* input =
+      context.GetDataOptional<const InputType*>(impl::kFlatbufRequestTableName);
+  return input ? *input : nullptr;
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetRequestBodyForLogging(
+    const http::HttpRequest&, request::RequestContext&,
+    const std::string& request_body) const {
+  size_t limit = GetConfig().request_body_size_log_limit;
+  return utils::log::ToLimitedHex(request_body, limit);
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetResponseDataForLogging(
+    const http::HttpRequest&, request::RequestContext& context,
+    const std::string& response_data) const {
+  size_t limit = GetConfig().response_data_size_log_limit;
+  const auto* buffer = context.GetDataOptional<const std::string_view>(
+      impl::kFlatbufResponseBufferName);
+  return utils::log::ToLimitedHex(buffer ? *buffer : response_data, limit);
+}
+
+template <typename InputType, typename ReturnType>
+void HttpHandlerFlatbufViewBase<InputType, ReturnType>::ParseRequestData(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto& body = request.RequestBody();
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(body.data()),
+                                 body.size());
+  if (!verifier.VerifyBuffer<InputType>(nullptr)) {
+    throw ClientError(
+        InternalMessage{"Invalid FlatBuffers format in request body"});
+  }
+
+  const InputType* input = flatbuffers::GetRoot<InputType>(body.data());
+  context.SetData(std::string{impl::kFlatbufRequestTableName}, input);
+}
+
+template <typename InputType, typename ReturnType>
+yaml_config::Schema
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("HTTP handler flatbuf view base config");
+  return schema;
+}
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
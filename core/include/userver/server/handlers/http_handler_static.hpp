@@ -28,9 +28,10 @@ namespace server::handlers {
 /// Inherits all the options from server::handlers::HttpHandlerBase and adds the
 /// following ones:
 ///
-/// Name               | Description                   | Default value
-/// ------------------ | ----------------------------- | -------------
-/// fs-cache-component | Name of the FsCache component | fs-cache-component
+/// Name                | Description                   | Default value
+/// ------------------- | ----------------------------- | -------------
+/// fs-cache-component  | Name of the FsCache component | fs-cache-component
+/// serve-precompressed | serve `file.zst`, `file.br` or `file.gz` from the cache instead of `file` if the client accepts the coding | false
 ///
 /// ## Example usage:
 ///
@@ -55,8 +56,12 @@ class HttpHandlerStatic final : public HttpHandlerBase {
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  fs::FileInfoWithDataConstPtr TryGetPrecompressedFile(
+      const http::HttpRequest& request, http::HttpResponse& response) const;
+
   dynamic_config::Source config_;
   const fs::FsCacheClient& storage_;
+  const bool serve_precompressed_;
 };
 
 }  // namespace server::handlers
@@ -12,7 +12,8 @@ namespace server::handlers {
 
 namespace impl {
 enum class StatsFormat;
-}
+class RenderedMetricsCache;
+}  // namespace impl
 
 // clang-format off
 
@@ -43,6 +44,11 @@ enum class StatsFormat;
 ///   be a JSON dictionary in the form '{"label1":"value1", "label2":"value2"}'.
 /// * path - return metrics on for the following path
 /// * prefix - return metrics whose path starts from the specified prefix.
+///
+/// If 'cache-ttl' option is set, the rendered response is reused for the
+/// requests with the same arguments during that period. That lowers the CPU
+/// usage of services with many metrics that are scraped by multiple
+/// monitoring agents.
 
 // clang-format on
 class ServerMonitor final : public HttpHandlerBase {
@@ -50,6 +56,8 @@ class ServerMonitor final : public HttpHandlerBase {
   ServerMonitor(const components::ComponentConfig& config,
                 const components::ComponentContext& component_context);
 
+  ~ServerMonitor() override;
+
   /// @ingroup userver_component_names
   /// @brief The default name of server::handlers::ServerMonitor
   static constexpr std::string_view kName = "handler-server-monitor";
@@ -69,6 +77,7 @@ class ServerMonitor final : public HttpHandlerBase {
   using CommonLabels = std::unordered_map<std::string, std::string>;
   const CommonLabels common_labels_;
   const std::optional<impl::StatsFormat> default_format_;
+  const std::unique_ptr<impl::RenderedMetricsCache> rendered_cache_;
 };
 
 }  // namespace server::handlers
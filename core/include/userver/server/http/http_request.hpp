@@ -32,6 +32,7 @@ class HttpHandlerBase;
 namespace server::http {
 
 class HttpRequestImpl;
+class RequestBodyStream;
 
 /// @brief HTTP Request data
 class HttpRequest final {
@@ -202,9 +203,18 @@ class HttpRequest final {
   /// @return List of cookies names.
   CookiesMapKeys GetCookieNames() const;
 
-  /// @return HTTP body.
+  /// @return HTTP body, empty if the body is streamed.
   const std::string& RequestBody() const;
 
+  /// @return Whether the body is read with GetBodyStream(), see the
+  /// `request-body-stream` option of the handler.
+  bool IsBodyStreamed() const;
+
+  /// @brief Returns the stream of the body chunks, see
+  /// userver/server/http/http_request_body_stream.hpp
+  /// @throws std::logic_error if the body is not streamed
+  RequestBodyStream& GetBodyStream() const;
+
   /// @return HTTP headers.
   const HeadersMap& RequestHeaders() const;
 
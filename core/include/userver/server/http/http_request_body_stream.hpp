@@ -0,0 +1,67 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <atomic>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/server/http/http_error.hpp>
+#include <userver/server/http/http_status.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpRequestImpl;
+
+/// @brief Thrown by RequestBodyStream::ReadChunk() if the body was not
+/// received completely, e.g. the connection was closed by the peer.
+///
+/// If the handler does not catch it, the request fails with GetHttpStatus():
+/// 408 on timeouts, 413 if the body exceeds `max_request_size` and 400
+/// otherwise.
+class RequestBodyStreamError final : public CustomHandlerException {
+ public:
+  RequestBodyStreamError(HttpStatus status, std::string message);
+};
+
+/// @brief Chunks of the HTTP request body that are read by the handler while
+/// the body is still being received.
+///
+/// Enabled by the `request-body-stream` option of the handler. The connection
+/// stops reading from the socket while the handler does not consume the
+/// chunks, so the memory used by a request does not depend on its body size.
+class RequestBodyStream final {
+ public:
+  using Queue = concurrent::StringStreamQueue;
+
+  RequestBodyStream(RequestBodyStream&&) = default;
+
+  /// @brief Waits for the next chunk of the body.
+  /// @returns false if the whole body has already been read
+  /// @throws RequestBodyStreamError if the body is incomplete or the deadline
+  /// is reached
+  bool ReadChunk(std::string& chunk, engine::Deadline deadline);
+
+  /// @returns whether the whole body has been read with ReadChunk()
+  bool IsComplete() const noexcept { return is_read_; }
+
+ private:
+  friend class HttpRequestImpl;
+
+  RequestBodyStream(Queue::Consumer&& queue_consumer,
+                    const std::atomic<bool>& is_body_received,
+                    const std::atomic<HttpStatus>& error_status);
+
+  Queue::Consumer queue_consumer_;
+  const std::atomic<bool>& is_body_received_;
+  const std::atomic<HttpStatus>& error_status_;
+  bool is_read_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
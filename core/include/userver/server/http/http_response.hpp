@@ -4,8 +4,11 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/single_consumer_event.hpp>
@@ -27,9 +30,12 @@ namespace impl {
 void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header,
                   std::string_view key, std::string_view val);
 
+class PrecomputedHeaders;
+
 }  // namespace impl
 
 class HttpRequestImpl;
+class Http2Session;
 
 /// @brief HTTP Response data
 class HttpResponse final : public request::ResponseBase {
@@ -120,9 +126,30 @@ class HttpResponse final : public request::ResponseBase {
   /// empty string if no such cookie exists.
   const Cookie& GetCookie(std::string_view cookie_name) const;
 
+  /// @brief Appends `data` to the response body without copying it.
+  ///
+  /// The body is sent as GetData() followed by the segments in the order of
+  /// appending. `owner` must keep `data` alive, e.g. a file from
+  /// fs::FsCacheClient. The segments are not logged.
+  void AppendBodySegment(std::shared_ptr<const void> owner,
+                         std::string_view data);
+
+  /// @overload
+  void AppendBodySegment(std::shared_ptr<const std::string> data);
+
+  /// @brief Drops all the segments appended by AppendBodySegment().
+  void ClearBodySegments();
+
+  /// @return Total size of the response body: GetData() and body segments.
+  std::size_t GetBodySize() const;
+
   /// @cond
   // TODO: server internals. remove from public interface
   void SendResponse(engine::io::RwBase& socket) override;
+
+  // Headers formatted once for all the responses of a handler, the headers
+  // set by SetHeader() take precedence. `headers` must outlive the response.
+  void SetPrecomputedHeaders(const impl::PrecomputedHeaders& headers);
   /// @endcond
 
   void SetStatusServiceUnavailable() override {
@@ -142,6 +169,13 @@ class HttpResponse final : public request::ResponseBase {
   Queue::Producer GetBodyProducer();
 
  private:
+  friend class Http2Session;
+
+  struct BodySegment final {
+    std::shared_ptr<const void> owner;
+    std::string_view data;
+  };
+
   // Returns total size of the response
   std::size_t SetBodyStreamed(
       engine::io::RwBase& socket,
@@ -155,7 +189,9 @@ class HttpResponse final : public request::ResponseBase {
   const HttpRequestImpl& request_;
   HttpStatus status_ = HttpStatus::kOk;
   HeadersMap headers_;
+  const impl::PrecomputedHeaders* precomputed_headers_{nullptr};
   CookiesMap cookies_;
+  std::vector<BodySegment> body_segments_;
 
   engine::SingleConsumerEvent headers_end_{
       engine::SingleConsumerEvent::NoAutoReset()};
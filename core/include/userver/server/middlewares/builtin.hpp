@@ -12,6 +12,8 @@ namespace server::middlewares::builtin {
 
 inline constexpr std::string_view kHandlerMetrics =
     "userver-handler-metrics-middleware";
+inline constexpr std::string_view kCompression =
+    "userver-compression-middleware";
 inline constexpr std::string_view kTracing = "userver-tracing-middleware";
 inline constexpr std::string_view kSetAcceptEncoding =
     "userver-set-accept-encoding-middleware";
@@ -0,0 +1,114 @@
+#pragma once
+
+/// @file userver/server/websocket/broadcast_hub.hpp
+/// @brief @copybrief server::websocket::BroadcastHub
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+namespace impl {
+struct BroadcastHubImpl;
+struct HubSubscriber;
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Delivers messages to the WebSocket connections subscribed to
+/// topics.
+///
+/// A published message is encoded once into a PreparedMessage that is shared
+/// by all the receivers. Each connection has its own bounded outbound queue
+/// and a task that writes the queued messages, so a slow client does not
+/// delay the others: the messages that do not fit into its queue are
+/// dropped.
+///
+/// Subscriptions are split into shards, Publish() fans out the message to
+/// the shards in parallel on the task processor.
+///
+/// ## Example usage:
+///
+/// @code
+/// void Handle(WebSocketConnection& websocket,
+///             server::request::RequestContext&) const override {
+///   auto connection = hub_.Connect(websocket);
+///   connection.Subscribe("prices");
+///
+///   Message message;
+///   while (!message.close_status) websocket.Recv(message);
+/// }
+///
+/// // In some other task
+/// hub_.Publish("prices", Message{R"({"ABC":10.25})", {}, true});
+/// @endcode
+class BroadcastHub final {
+ public:
+  struct Config final {
+    /// max messages waiting to be sent to a connection, the new messages
+    /// over this limit are dropped
+    std::size_t max_queue_size{1000};
+    /// shards of the subscriptions, 0 - the worker threads count of the
+    /// task processor
+    std::size_t shards_count{0};
+    /// max output fragment size of the messages published with Message
+    unsigned fragment_size{65536};
+  };
+
+  /// @brief Registration of a WebSocket connection in the hub.
+  ///
+  /// Messages of the subscribed topics are sent to the connection until the
+  /// registration is destroyed. Not thread-safe.
+  class Connection final {
+   public:
+    Connection(Connection&&) noexcept;
+    Connection& operator=(Connection&&) noexcept;
+    ~Connection();
+
+    void Subscribe(std::string topic);
+    void Unsubscribe(std::string_view topic);
+
+   private:
+    friend class BroadcastHub;
+
+    explicit Connection(std::unique_ptr<impl::HubSubscriber>&& subscriber);
+
+    std::unique_ptr<impl::HubSubscriber> subscriber_;
+  };
+
+  /// @param task_processor runs the fan-out and the writing tasks
+  BroadcastHub(engine::TaskProcessor& task_processor, const Config& config);
+  ~BroadcastHub();
+
+  /// @brief Starts sending the messages to the connection.
+  /// @note Both the hub and the connection must outlive the result.
+  [[nodiscard]] Connection Connect(WebSocketConnection& connection);
+
+  /// @brief Queues the message to all the connections subscribed to the
+  /// topic.
+  /// @returns the number of connections the message was queued to
+  std::size_t Publish(std::string_view topic, const Message& message);
+
+  /// @overload
+  std::size_t Publish(std::string_view topic,
+                      std::shared_ptr<const PreparedMessage> message);
+
+  /// @cond
+  void WriteStatistics(utils::statistics::Writer& writer) const;
+  /// @endcond
+
+ private:
+  std::unique_ptr<impl::BroadcastHubImpl> impl_;
+};
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -48,10 +49,30 @@ class WebSocketConnectionImpl;
 struct Config final {
   unsigned max_remote_payload = 65536;
   unsigned fragment_size = 65536;  // 0 - do not fragment
+  // compress the messages if the client supports permessage-deflate
+  bool permessage_deflate = false;
 };
 
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
 
+/// @brief Message that is encoded into WebSocket frames once and could be
+/// sent to many connections without copying or encoding it again.
+///
+/// The frames are not compressed, so the message could be sent to any
+/// connection, including the ones with permessage-deflate.
+class PreparedMessage final {
+ public:
+  /// @param message message to encode
+  /// @param config only the fragment_size is used
+  explicit PreparedMessage(const Message& message, const Config& config = {});
+
+ private:
+  friend class WebSocketConnectionImpl;
+
+  std::string frames_;
+  std::size_t payload_size_{0};
+};
+
 struct Statistics final {
   std::atomic<int64_t> msg_sent{0};
   std::atomic<int64_t> msg_recv{0};
@@ -91,6 +112,19 @@ class WebSocketConnection {
   virtual void Send(const Message& message) = 0;
   virtual void SendText(std::string_view message) = 0;
 
+  /// @brief Send multiple messages to websocket with a single write to the
+  /// socket.
+  /// @param messages messages to send in order
+  /// @throws engine::io::IoException in case of socket errors
+  /// @note Has the same thread-safety guarantees as Send()
+  virtual void SendBatch(utils::span<const Message> messages) = 0;
+
+  /// @brief Send a message that was encoded beforehand, useful to broadcast
+  /// the same message to many connections.
+  /// @throws engine::io::IoException in case of socket errors
+  /// @note Has the same thread-safety guarantees as Send()
+  virtual void SendPrepared(const PreparedMessage& message) = 0;
+
   template <typename ContiguousContainer>
   void SendBinary(const ContiguousContainer& message) {
     static_assert(sizeof(typename ContiguousContainer::value_type) == 1,
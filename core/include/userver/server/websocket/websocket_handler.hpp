@@ -28,6 +28,7 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// permessage-deflate | compress the messages with permessage-deflate extension if the client supports it | false
 ///
 /// ## Example usage:
 ///
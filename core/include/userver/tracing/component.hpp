@@ -26,6 +26,14 @@ namespace components {
 /// ---- | ----------- | -------------
 /// service-name | name of the service to write in traces | ''
 /// tracer | type of the tracer to trace, currently supported only 'native' | 'native'
+/// tail-sampling.enabled | buffer the span records of a trace in memory until its local root span ends, then log the whole trace or drop it | false
+/// tail-sampling.slow-threshold | traces at least this long are always logged | 1s
+/// tail-sampling.sample-percent | percentage of the other traces to log; traces with the `error` tag or with error level spans are always logged | 5
+/// tail-sampling.max-spans-per-trace | span records of a trace over this limit are dropped | 1000
+///
+/// A trace here is the tree of spans of the current service that is rooted
+/// at a span without a parent span, e.g. the span of an incoming request.
+/// Ordinary log records are not affected by the tail-based sampling.
 ///
 /// ## Static configuration example:
 ///
@@ -185,11 +185,17 @@ class Span final {
   ///
   /// Propagates both to sub-spans within a single service, and from client
   /// to server
-  const std::string& GetTraceId() const;
+  std::string GetTraceId() const;
 
   /// Identifies a specific span. It does not propagate
-  const std::string& GetSpanId() const;
-  const std::string& GetParentId() const;
+  std::string GetSpanId() const;
+  std::string GetParentId() const;
+
+  /// @brief Same as GetTraceId(), GetSpanId() and GetParentId(), but do not
+  /// copy the id. The views are valid until the span is destroyed.
+  std::string_view GetTraceIdView() const noexcept;
+  std::string_view GetSpanIdView() const noexcept;
+  std::string_view GetParentIdView() const noexcept;
 
   /// @returns true if this span would be logged with the current local and
   /// global log levels to the default logger.
@@ -4,6 +4,7 @@
 /// @brief @copybrief tracing::SpanBuilder
 
 #include <string>
+#include <string_view>
 
 #include <userver/tracing/span.hpp>
 #include <userver/utils/impl/source_location.hpp>
@@ -20,7 +21,8 @@ class SpanBuilder final {
                            utils::impl::SourceLocation::Current());
 
   void SetTraceId(std::string trace_id);
-  const std::string& GetTraceId() const noexcept;
+  std::string GetTraceId() const;
+  std::string_view GetTraceIdView() const noexcept;
   void SetSpanId(std::string span_id);
   void SetParentSpanId(std::string parent_span_id);
   void SetParentLink(std::string parent_link);
@@ -41,11 +41,16 @@ struct SpanWrapCall {
 
   struct Impl;
 
-  static constexpr std::size_t kImplSize = 4264;
+  static constexpr std::size_t kImplSize = 4272;
   static constexpr std::size_t kImplAlign = 8;
   utils::FastPimpl<Impl, kImplSize, kImplAlign> pimpl_;
 };
 
+// The config of the tasks that inherit the variables of the current task.
+// They are not started after the propagated deadline of the current request.
+engine::impl::TaskConfig MakeInheritingTaskConfig(
+    engine::TaskProcessor& task_processor, engine::Deadline deadline);
+
 // Note: 'name' must outlive the result of this function
 inline auto SpanLazyPrvalue(std::string&& name) {
   return utils::LazyPrvalue([&name] {
@@ -119,7 +124,10 @@ inline auto SpanLazyPrvalue(std::string&& name) {
 ///
 /// By deadline: some `utils::*Async*` functions accept an `engine::Deadline`
 /// parameter. If the deadline expires, the task is cancelled. See `*Async*`
-/// function signatures for details.
+/// function signatures for details. Besides that, the non-critical tasks that
+/// inherit the task-inherited variables are cancelled without starting if
+/// they are still queued when the propagated deadline of the request expires,
+/// see @ref scripts/docs/en/userver/deadline_propagation.md.
 ///
 /// ## Lifetime of captures
 ///
@@ -220,10 +228,11 @@ inline auto SpanLazyPrvalue(std::string&& name) {
 /// @returns engine::TaskWithResult
 template <typename Function, typename... Args>
 [[nodiscard]] auto Async(std::string name, Function&& f, Args&&... args) {
-  return engine::AsyncNoSpan(engine::current_task::GetTaskProcessor(),
-                             impl::SpanLazyPrvalue(std::move(name)),
-                             std::forward<Function>(f),
-                             std::forward<Args>(args)...);
+  return engine::impl::MakeTaskWithResult<engine::TaskWithResult>(
+      impl::MakeInheritingTaskConfig(engine::current_task::GetTaskProcessor(),
+                                     {}),
+      impl::SpanLazyPrvalue(std::move(name)), std::forward<Function>(f),
+      std::forward<Args>(args)...);
 }
 
 /// @overload
@@ -240,9 +249,10 @@ template <typename Function, typename... Args>
 template <typename Function, typename... Args>
 [[nodiscard]] auto Async(engine::TaskProcessor& task_processor,
                          std::string name, Function&& f, Args&&... args) {
-  return engine::AsyncNoSpan(
-      task_processor, impl::SpanLazyPrvalue(std::move(name)),
-      std::forward<Function>(f), std::forward<Args>(args)...);
+  return engine::impl::MakeTaskWithResult<engine::TaskWithResult>(
+      impl::MakeInheritingTaskConfig(task_processor, {}),
+      impl::SpanLazyPrvalue(std::move(name)), std::forward<Function>(f),
+      std::forward<Args>(args)...);
 }
 
 /// @overload
@@ -299,9 +309,10 @@ template <typename Function, typename... Args>
 template <typename Function, typename... Args>
 [[nodiscard]] auto SharedAsync(engine::TaskProcessor& task_processor,
                                std::string name, Function&& f, Args&&... args) {
-  return engine::SharedAsyncNoSpan(
-      task_processor, impl::SpanLazyPrvalue(std::move(name)),
-      std::forward<Function>(f), std::forward<Args>(args)...);
+  return engine::impl::MakeTaskWithResult<engine::SharedTaskWithResult>(
+      impl::MakeInheritingTaskConfig(task_processor, {}),
+      impl::SpanLazyPrvalue(std::move(name)), std::forward<Function>(f),
+      std::forward<Args>(args)...);
 }
 
 /// @overload
@@ -319,9 +330,10 @@ template <typename Function, typename... Args>
 [[nodiscard]] auto Async(engine::TaskProcessor& task_processor,
                          std::string name, engine::Deadline deadline,
                          Function&& f, Args&&... args) {
-  return engine::AsyncNoSpan(
-      task_processor, deadline, impl::SpanLazyPrvalue(std::move(name)),
-      std::forward<Function>(f), std::forward<Args>(args)...);
+  return engine::impl::MakeTaskWithResult<engine::TaskWithResult>(
+      impl::MakeInheritingTaskConfig(task_processor, deadline),
+      impl::SpanLazyPrvalue(std::move(name)), std::forward<Function>(f),
+      std::forward<Args>(args)...);
 }
 
 /// @overload
@@ -339,9 +351,10 @@ template <typename Function, typename... Args>
 [[nodiscard]] auto SharedAsync(engine::TaskProcessor& task_processor,
                                std::string name, engine::Deadline deadline,
                                Function&& f, Args&&... args) {
-  return engine::SharedAsyncNoSpan(
-      task_processor, deadline, impl::SpanLazyPrvalue(std::move(name)),
-      std::forward<Function>(f), std::forward<Args>(args)...);
+  return engine::impl::MakeTaskWithResult<engine::SharedTaskWithResult>(
+      impl::MakeInheritingTaskConfig(task_processor, deadline),
+      impl::SpanLazyPrvalue(std::move(name)), std::forward<Function>(f),
+      std::forward<Args>(args)...);
 }
 
 /// @overload
@@ -0,0 +1,204 @@
+#pragma once
+
+/// @file userver/utils/parallel_for_each.hpp
+/// @brief Utility functions to process a range in parallel tasks with
+/// bounded parallelism.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace impl {
+
+// Each worker takes about this many chunks, so that the workers that got
+// faster elements take more of them
+inline constexpr std::size_t kParallelChunksPerWorker = 4;
+
+template <typename Function>
+class ParallelForIndexState final {
+ public:
+  ParallelForIndexState(std::size_t size, std::size_t chunk_size,
+                        Function& func) noexcept
+      : size_(size), chunk_size_(chunk_size), func_(func) {}
+
+  void Work() {
+    try {
+      while (!failed_.load(std::memory_order_relaxed)) {
+        const auto chunk_begin =
+            next_.fetch_add(chunk_size_, std::memory_order_relaxed);
+        if (chunk_begin >= size_) return;
+
+        const auto chunk_end = std::min(size_, chunk_begin + chunk_size_);
+        for (auto i = chunk_begin; i < chunk_end; ++i) func_(i);
+      }
+    } catch (...) {
+      // Stops the siblings at their next chunk
+      failed_.store(true, std::memory_order_relaxed);
+      throw;
+    }
+  }
+
+ private:
+  const std::size_t size_;
+  const std::size_t chunk_size_;
+  Function& func_;
+  std::atomic<std::size_t> next_{0};
+  std::atomic<bool> failed_{false};
+};
+
+template <typename Iterator>
+constexpr void CheckRandomAccess() noexcept {
+  static_assert(
+      std::is_base_of_v<std::random_access_iterator_tag,
+                        typename std::iterator_traits<
+                            std::remove_const_t<Iterator>>::iterator_category>,
+      "utils::ParallelForEach and utils::ParallelTransform require a random "
+      "access range");
+}
+
+template <typename Function>
+void ParallelForIndex(engine::TaskProcessor& task_processor,
+                      const std::string& name, std::size_t size,
+                      std::size_t max_parallelism, Function& func) {
+  UINVARIANT(max_parallelism != 0, "max_parallelism must be positive");
+
+  const auto workers = std::min(size, max_parallelism);
+  if (workers <= 1) {
+    // Not worth a task
+    for (std::size_t i = 0; i < size; ++i) func(i);
+    return;
+  }
+
+  const auto chunk_size =
+      std::max<std::size_t>(1, size / (workers * kParallelChunksPerWorker));
+  ParallelForIndexState<Function> state{size, chunk_size, func};
+
+  // Destroying the tasks on exceptions cancels them and waits for them, so
+  // none of them outlives the `state`
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(workers - 1);
+  for (std::size_t i = 0; i < workers - 1; ++i) {
+    tasks.push_back(utils::Async(task_processor, name, [&state] {
+      state.Work();
+    }));
+  }
+
+  // The current task is a worker too
+  state.Work();
+  engine::GetAll(tasks);
+}
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Calls `func` for each element of `range` in at most
+/// `max_parallelism` tasks at once, the current task included.
+///
+/// The elements are handed out to the tasks in chunks, so a task is started
+/// per `max_parallelism` rather than per element, and for a single element
+/// or `max_parallelism == 1` no tasks are started at all.
+///
+/// `func` is called concurrently from multiple tasks, so it must be
+/// safe to call in parallel. The order of the calls is unspecified.
+///
+/// If `func` throws, the remaining elements are not processed, the other
+/// tasks are cancelled and awaited, and the exception is rethrown.
+///
+/// @param task_processor Task processor to run the tasks on
+/// @param name Name of the tasks to show in logs
+/// @param range Random access range to process, must outlive the call
+/// @param max_parallelism The maximum number of tasks, must be positive
+/// @param func Function to call for each element of the range
+/// @throws std::exception rethrows the exception of `func`, if any
+/// @throws engine::WaitInterruptedException when the current task is cancelled
+///
+/// ## Example usage:
+///
+/// @snippet utils/parallel_for_each_test.cpp  Sample utils::ParallelForEach usage
+template <typename Range, typename Function>
+void ParallelForEach(engine::TaskProcessor& task_processor,
+                     const std::string& name, Range&& range,
+                     std::size_t max_parallelism, Function func) {
+  const auto begin = std::begin(range);
+  impl::CheckRandomAccess<decltype(begin)>();
+
+  auto call = [&begin, &func](std::size_t i) { func(begin[i]); };
+  impl::ParallelForIndex(task_processor, name, std::size(range),
+                         max_parallelism, call);
+}
+
+/// @overload
+/// @ingroup userver_concurrency
+///
+/// The tasks are launched on the current TaskProcessor.
+template <typename Range, typename Function>
+void ParallelForEach(const std::string& name, Range&& range,
+                     std::size_t max_parallelism, Function func) {
+  utils::ParallelForEach(engine::current_task::GetTaskProcessor(), name,
+                         std::forward<Range>(range), max_parallelism,
+                         std::move(func));
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Applies `func` to each element of `range` in at most
+/// `max_parallelism` tasks at once, and returns the results in the order of
+/// the elements.
+///
+/// @see utils::ParallelForEach for the details on scheduling and errors
+template <typename Range, typename Function>
+auto ParallelTransform(engine::TaskProcessor& task_processor,
+                       const std::string& name, Range&& range,
+                       std::size_t max_parallelism, Function func) {
+  const auto begin = std::begin(range);
+  impl::CheckRandomAccess<decltype(begin)>();
+  using Result =
+      std::decay_t<std::invoke_result_t<Function&, decltype(*begin)>>;
+  static_assert(!std::is_void_v<Result>,
+                "Use utils::ParallelForEach for the functions without result");
+
+  std::vector<std::optional<Result>> results(std::size(range));
+  auto call = [&results, &begin, &func](std::size_t i) {
+    results[i].emplace(func(begin[i]));
+  };
+  impl::ParallelForIndex(task_processor, name, results.size(), max_parallelism,
+                         call);
+
+  std::vector<Result> values;
+  values.reserve(results.size());
+  for (auto& result : results) values.push_back(std::move(*result));
+  return values;
+}
+
+/// @overload
+/// @ingroup userver_concurrency
+///
+/// The tasks are launched on the current TaskProcessor.
+template <typename Range, typename Function>
+auto ParallelTransform(const std::string& name, Range&& range,
+                       std::size_t max_parallelism, Function func) {
+  return utils::ParallelTransform(engine::current_task::GetTaskProcessor(),
+                                  name, std::forward<Range>(range),
+                                  max_parallelism, std::move(func));
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 /// @file userver/utils/periodic_task.hpp
 /// @brief @copybrief utils::PeriodicTask
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <optional>
@@ -11,6 +12,7 @@
 
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
@@ -33,6 +35,12 @@ namespace utils {
 /// * `B` is the time of previous callback execution if Flags::kStrong flag is
 ///   set, otherwise is `0`;
 ///
+/// Many periodic tasks with the same period, started together, would run
+/// their callbacks together every period, causing CPU bursts. Flags::kSpread
+/// spreads their first callbacks across the period, and
+/// PeriodicTask::Settings::step_semaphore limits the number of callbacks of
+/// the heavy tasks running at once.
+///
 /// TaskProcessor to execute the callback and many other options are specified
 /// in PeriodicTask::Settings.
 class PeriodicTask final {
@@ -53,6 +61,9 @@ class PeriodicTask final {
     /// Subtasks that may be spawned in the callback
     /// are not critical by default and may be cancelled as usual.
     kCritical = 1 << 4,
+    /// Start the first wait period, if kNow is not set, at a random point of
+    /// the period, so that the tasks started together do not run together
+    kSpread = 1 << 5,
   };
 
   /// Configuration parameters for PeriodicTask.
@@ -114,6 +125,12 @@ class PeriodicTask final {
     /// PeriodicTask::Start() calls engine::current_task::GetTaskProcessor()
     /// to get the TaskProcessor.
     engine::TaskProcessor* task_processor{nullptr};
+
+    /// @brief If set, each execution of the task holds a lock of the
+    /// semaphore. A semaphore shared by the heavy tasks with N locks allows
+    /// at most N of them to run at once. The time spent waiting for the
+    /// semaphore is accounted in PeriodicTask::GetLastScheduleLag().
+    engine::CancellableSemaphore* step_semaphore{nullptr};
   };
 
   /// Signature of the task to be executed each period.
@@ -194,6 +211,11 @@ class PeriodicTask final {
   /// Get current settings. Note that they might become stale very quickly.
   Settings GetCurrentSettings() const;
 
+  /// @brief Returns the delay of the start of the last execution of the task
+  /// relative to its schedule, including the wait for
+  /// PeriodicTask::Settings::step_semaphore.
+  std::chrono::milliseconds GetLastScheduleLag() const;
+
  private:
   enum class SuspendState { kRunning, kSuspended };
 
@@ -216,6 +238,7 @@ class PeriodicTask final {
   engine::SingleConsumerEvent changed_event_;
   std::atomic<bool> should_force_step_{false};
   std::optional<std::minstd_rand> mutate_period_random_;
+  std::atomic<std::chrono::milliseconds> last_schedule_lag_{{}};
 
   // For kNow only
   engine::Mutex step_mutex_;
@@ -0,0 +1,64 @@
+#pragma once
+
+/// @file userver/utils/statistics/cardinality_limits.hpp
+/// @brief @copybrief utils::statistics::CardinalityLimits
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// Value of the aggregated labels of the overflow series
+inline constexpr std::string_view kOverflowLabelValue = "__overflow__";
+
+/// @brief Limits of the number of series with different labels written for
+/// the same metric path on a single metrics request.
+///
+/// Protects the metrics requests from accidental high-cardinality labels,
+/// e.g. a URL with IDs in `http_destination`. Once a path has as many series
+/// as its limit, the values of further series are summed into the overflow
+/// series of the path. The labels of an overflow series have the same names,
+/// the values of the labels except the `keep_labels` and the common labels of
+/// the request are replaced by kOverflowLabelValue. Totals survive, the
+/// details of the dropped series do not.
+///
+/// Integer and floating point values and rates are summed, so the overflow
+/// series of gauges that are not additive, e.g. percentiles, are meaningless.
+/// Histograms are merged if they have the same bucket bounds.
+///
+/// Set via utils::statistics::Storage::SetCardinalityLimits(), usually from
+/// the `cardinality-limits` static config option of
+/// components::StatisticsStorage.
+struct CardinalityLimits {
+  /// Series per metric path, zero means unlimited
+  std::size_t max_series_per_path{0};
+
+  /// Limits of the paths that start with the prefix, e.g. `httpclient`,
+  /// override `max_series_per_path`. The longest matching prefix wins.
+  std::unordered_map<std::string, std::size_t> prefix_limits;
+
+  /// Names of the low-cardinality labels that keep their values in the
+  /// overflow series
+  std::vector<std::string> keep_labels;
+
+  /// Returns the limit for the metric `path`, zero means unlimited
+  std::size_t GetLimit(std::string_view path) const;
+
+  /// True if no series are limited
+  bool IsUnlimited() const;
+};
+
+CardinalityLimits Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<CardinalityLimits>);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,48 @@
+#pragma once
+
+/// @file userver/utils/statistics/changed_metrics_filter.hpp
+/// @brief @copybrief utils::statistics::ChangedMetricsFilter
+
+#include <memory>
+
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief Remembers the values of metrics between visits and passes only the
+/// new and the changed metrics to the output.
+///
+/// Used by push-based exporters to send only the metrics that changed since
+/// the previous export. A metric that is missing from a visit is forgotten,
+/// so it is passed to the output again as soon as it reappears.
+///
+/// Usage example:
+/// @snippet utils/statistics/changed_metrics_filter_test.cpp  Sample
+///
+/// Not thread-safe, a single instance should be used by a single exporter.
+class ChangedMetricsFilter final {
+ public:
+  ChangedMetricsFilter();
+  ChangedMetricsFilter(ChangedMetricsFilter&&) noexcept;
+  ChangedMetricsFilter& operator=(ChangedMetricsFilter&&) noexcept;
+  ~ChangedMetricsFilter();
+
+  /// Visits all the metrics of the `storage` and calls `out.HandleMetric` for
+  /// each metric that is new or that has changed since the previous call.
+  void VisitChangedMetrics(const Storage& storage, BaseFormatBuilder& out,
+                           const Request& request = {});
+
+  /// Forgets all the remembered values, so that the next visit passes all
+  /// the metrics to the output.
+  void Reset() noexcept;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,203 @@
+#pragma once
+
+/// @file userver/utils/statistics/log_linear_histogram.hpp
+/// @brief @copybrief utils::statistics::LogLinearHistogram
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <userver/utils/span.hpp>
+#include <userver/utils/statistics/histogram_view.hpp>
+#include <userver/utils/statistics/impl/histogram_bucket.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl::log_linear {
+
+// Bucket `k` of a power of two covers (2^((k-1)/2^schema), 2^(k/2^schema)].
+// The mantissa is split into 2^(schema+1) linear slices, and each slice
+// contains at most one border of those exponential buckets. For each slice
+// fills the first border that is not less than the slice start, and the index
+// of the bucket that ends with that border.
+void FillSubBucketTable(int schema, utils::span<double> borders,
+                        utils::span<std::uint16_t> indices);
+
+// Fills 2^min_power_of_two, then the upper bounds of exponential buckets up to
+// 2^max_power_of_two inclusive.
+void FillUpperBounds(int schema, int min_power_of_two,
+                     utils::span<double> upper_bounds);
+
+}  // namespace impl::log_linear
+
+/// @brief A lock-free histogram with exponential buckets, that are spread
+/// evenly in the logarithmic scale.
+///
+/// Each power of two `(2^i, 2^(i+1)]` is split into `2^Schema` buckets, the
+/// upper bound of each bucket is `2^(1/2^Schema)` times larger than
+/// the previous one. So the relative error of any value is bounded, e.g.
+/// it is less than 9% for `Schema == 2` and less than 2.2% for `Schema == 4`.
+///
+/// The buckets cover `(2^MinPowerOfTwo, 2^MaxPowerOfTwo]`. Besides them:
+/// * the first bucket with upper bound `2^MinPowerOfTwo` contains all
+///   the smaller values (including zero and negative values);
+/// * the "infinity" bucket contains values greater than `2^MaxPowerOfTwo`.
+///
+/// The layout of buckets matches the one of Prometheus native histograms
+/// with the same `Schema`: bucket with upper bound `2^(i/2^Schema)` is
+/// the native bucket with index `i`, and the first bucket is the "zero bucket"
+/// with `zero_threshold == 2^MinPowerOfTwo`.
+///
+/// Unlike utils::statistics::Histogram, the layout is fixed at compile time,
+/// so the histogram is default-constructible and two histograms of the same
+/// type are merged by adding the buckets elementwise. That makes it
+/// a cheap `Counter` and `Result` for utils::statistics::RecentPeriod:
+/// @snippet utils/statistics/log_linear_histogram_test.cpp  RecentPeriod
+///
+/// `Account` is a few bit operations, a table lookup and an atomic increment,
+/// it does not depend on the number of buckets.
+///
+/// The histogram is serialized as an ordinary utils::statistics::HistogramView.
+/// Mind the limits of the monitoring systems on the number of buckets
+/// (`kBucketCount`), e.g. Solomon accepts up to 50 buckets. To produce a
+/// histogram with less buckets, add the view of a LogLinearHistogram to
+/// a utils::statistics::HistogramAggregator with a subset of its bounds, e.g.
+/// with the bounds of a LogLinearHistogram with a smaller `Schema`.
+///
+/// @tparam Schema log2 of the number of buckets per power of two, [0, 8]
+/// @tparam MinPowerOfTwo log2 of the upper bound of the first bucket
+/// @tparam MaxPowerOfTwo log2 of the upper bound of the last bucket
+template <int Schema, int MinPowerOfTwo, int MaxPowerOfTwo>
+class LogLinearHistogram final {
+  static_assert(Schema >= 0 && Schema <= 8, "Schema must be in [0, 8]");
+  static_assert(MinPowerOfTwo < MaxPowerOfTwo,
+                "MinPowerOfTwo must be less than MaxPowerOfTwo");
+  static_assert(MinPowerOfTwo > -1000 && MaxPowerOfTwo < 1000,
+                "Bucket bounds must be normal double values");
+
+ public:
+  static constexpr int kSchema = Schema;
+
+  /// The number of "normal" (non-"infinity") buckets.
+  static constexpr std::size_t kBucketCount =
+      (static_cast<std::size_t>(MaxPowerOfTwo - MinPowerOfTwo) << Schema) + 1;
+
+  LogLinearHistogram() {
+    impl::histogram::CopyBounds(buckets_.data(), GetLayout().upper_bounds);
+  }
+
+  /// Atomically increment the bucket corresponding to the given value.
+  void Account(double value, std::uint64_t count = 1) noexcept {
+    buckets_[GetBucketIndex(value)].counter.fetch_add(
+        count, std::memory_order_relaxed);
+  }
+
+  /// @brief Add the other histogram to the current one.
+  ///
+  /// Writes to `*this` are non-atomic.
+  LogLinearHistogram& operator+=(const LogLinearHistogram& other) noexcept {
+    for (std::size_t i = 0; i < buckets_.size(); ++i) {
+      auto& counter = buckets_[i].counter;
+      counter.store(counter.load(std::memory_order_relaxed) +
+                        other.buckets_[i].counter.load(
+                            std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+    }
+    return *this;
+  }
+
+  /// Atomically reset all counters to zero.
+  void Reset() noexcept {
+    for (auto& bucket : buckets_) {
+      bucket.counter.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /// Allows reading the histogram.
+  HistogramView GetView() const& noexcept {
+    return impl::histogram::MakeView(buckets_.data());
+  }
+
+  /// @cond
+  // Store LogLinearHistogram in a variable before taking a view on it.
+  HistogramView GetView() && noexcept = delete;
+  /// @endcond
+
+ private:
+  static constexpr std::size_t kSlices = std::size_t{2} << Schema;
+  static constexpr int kMantissaBits = 52;
+  static constexpr std::uint64_t kMantissaMask =
+      (std::uint64_t{1} << kMantissaBits) - 1;
+  static constexpr std::uint64_t kExponentBias = 1023;
+
+  struct Layout final {
+    Layout() {
+      impl::log_linear::FillSubBucketTable(Schema, slice_borders,
+                                           slice_indices);
+      impl::log_linear::FillUpperBounds(Schema, MinPowerOfTwo, upper_bounds);
+    }
+
+    std::array<double, kSlices> slice_borders{};
+    std::array<std::uint16_t, kSlices> slice_indices{};
+    std::array<double, kBucketCount> upper_bounds{};
+  };
+
+  static const Layout& GetLayout() noexcept {
+    static const Layout layout;
+    return layout;
+  }
+
+  // 0th bucket is the "infinity" bucket, 1st one is the "zero" bucket.
+  static std::size_t GetBucketIndex(double value) noexcept {
+    const auto& layout = GetLayout();
+    // Also catches NaN
+    if (!(value > layout.upper_bounds.front())) return 1;
+    if (value > layout.upper_bounds.back()) return 0;
+
+    std::uint64_t bits{};
+    std::memcpy(&bits, &value, sizeof(value));
+    const auto power_of_two =
+        static_cast<int>(bits >> kMantissaBits) -
+        static_cast<int>(kExponentBias);
+    const auto slice = (bits & kMantissaMask) >> (kMantissaBits - Schema - 1);
+
+    // The value scaled to [1, 2)
+    const std::uint64_t mantissa_bits =
+        (bits & kMantissaMask) | (kExponentBias << kMantissaBits);
+    double mantissa{};
+    std::memcpy(&mantissa, &mantissa_bits, sizeof(mantissa_bits));
+
+    const std::size_t sub_bucket =
+        layout.slice_indices[slice] +
+        (mantissa > layout.slice_borders[slice] ? 1 : 0);
+    return 1 +
+           (static_cast<std::size_t>(power_of_two - MinPowerOfTwo) << Schema) +
+           sub_bucket;
+  }
+
+  std::array<impl::histogram::Bucket, kBucketCount + 1> buckets_;
+};
+
+/// Reset support for LogLinearHistogram.
+template <int Schema, int MinPowerOfTwo, int MaxPowerOfTwo>
+void ResetMetric(
+    LogLinearHistogram<Schema, MinPowerOfTwo, MaxPowerOfTwo>& histogram) {
+  histogram.Reset();
+}
+
+/// Metric serialization support for LogLinearHistogram.
+template <int Schema, int MinPowerOfTwo, int MaxPowerOfTwo>
+void DumpMetric(
+    Writer& writer,
+    const LogLinearHistogram<Schema, MinPowerOfTwo, MaxPowerOfTwo>& histogram) {
+  writer = histogram.GetView();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
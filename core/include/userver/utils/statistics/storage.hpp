@@ -7,6 +7,7 @@
 #include <functional>
 #include <initializer_list>
 #include <list>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -15,6 +16,7 @@
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/cardinality_limits.hpp>
 #include <userver/utils/statistics/entry.hpp>
 #include <userver/utils/statistics/metric_value.hpp>
 #include <userver/utils/statistics/writer.hpp>
@@ -95,6 +97,8 @@ struct MetricsSource final {
 
   WriterFunc writer;
   std::vector<Label> writer_labels;
+  // Views of `writer_labels`, built once at registration
+  std::vector<LabelView> writer_label_views;
 };
 
 using StorageData = std::list<MetricsSource>;
@@ -130,8 +134,15 @@ class Storage final {
   formats::json::Value GetAsJson() const;
 
   /// Visits all the metrics and calls `out.HandleMetric` for each metric.
+  ///
+  /// The series over the cardinality limits are aggregated into the overflow
+  /// series, which are visited last.
   void VisitMetrics(BaseFormatBuilder& out, const Request& request = {}) const;
 
+  /// @brief Sets the limits of the series per metric path for all the
+  /// following VisitMetrics() calls, see utils::statistics::CardinalityLimits
+  void SetCardinalityLimits(CardinalityLimits limits);
+
   /// @cond
   /// Must be called from StatisticsStorage only. Don't call it from user
   /// components.
@@ -154,6 +165,7 @@ class Storage final {
 
   std::atomic<bool> may_register_extenders_;
   impl::StorageData metrics_sources_;
+  std::shared_ptr<const CardinalityLimits> cardinality_limits_;
   mutable engine::SharedMutex mutex_;
 };
 
@@ -25,6 +25,8 @@ namespace components {
 /// ---- | ----------- | -------------
 /// fs-task-processor | Task processor to use for statistics gathering | -
 /// with-nginx | Whether to collect and report nginx processes statistics | false
+/// with-pressure | Whether to report the Linux PSI and the cgroup v2 CPU throttling of the process as `system_pressure` | false
+/// with-jemalloc | Whether to report the jemalloc totals (allocated, active, resident, retained and others) as `jemalloc` metrics; `resident - allocated` is the allocator overhead and fragmentation | false
 ///
 /// Note that `with-nginx` is a relatively expensive option as it requires full
 /// process list scan.
@@ -50,6 +52,8 @@ class SystemStatisticsCollector final : public ComponentBase {
   void ExtendStatistics(utils::statistics::Writer& writer);
 
   const bool with_nginx_;
+  const bool with_pressure_;
+  const bool with_jemalloc_;
   engine::TaskProcessor& fs_task_processor_;
   utils::statistics::Entry statistics_holder_;
 };
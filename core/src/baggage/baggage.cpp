@@ -8,6 +8,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/http/url.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -91,7 +92,7 @@ const BaggageEntryProperty& BaggageEntry::GetProperty(
   throw BaggageException("Entry doesn't contain selected property");
 }
 
-std::string Baggage::ToString() const {
+const std::string& Baggage::ToString() const noexcept {
   if (is_valid_header_) {
     return header_value_;
   }
@@ -122,7 +123,13 @@ const BaggageEntry& Baggage::GetEntry(const std::string& key) const {
 
 Baggage::Baggage(std::string header,
                  std::unordered_set<std::string> allowed_keys)
+    : Baggage(std::move(header),
+              std::make_shared<const std::unordered_set<std::string>>(
+                  std::move(allowed_keys))) {}
+
+Baggage::Baggage(std::string header, AllowedKeysPtr allowed_keys)
     : header_value_(std::move(header)), allowed_keys_(std::move(allowed_keys)) {
+  UASSERT(allowed_keys_);
   header_value_.erase(
       std::remove_if(header_value_.begin(), header_value_.end(),
                      [](unsigned char x) { return std::isspace(x); }),
@@ -226,10 +233,14 @@ void Baggage::AddEntry(std::string key, std::string value,
 }
 
 bool Baggage::IsValidEntry(const std::string& key) const {
-  return allowed_keys_.count(key);
+  return allowed_keys_->count(key);
 }
 
 std::unordered_set<std::string> Baggage::GetAllowedKeys() const {
+  return *allowed_keys_;
+}
+
+const AllowedKeysPtr& Baggage::GetSharedAllowedKeys() const noexcept {
   return allowed_keys_;
 }
 
@@ -289,7 +300,7 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
     return std::nullopt;
   }
   key.remove_suffix(entry.size() - entry_delimiter);
-  if (!allowed_keys_.count(http::parser::UrlDecode(key))) {
+  if (!allowed_keys_->count(http::parser::UrlDecode(key))) {
     LOG_LIMITED_WARNING() << fmt::format("Key {} is not available", key);
     return std::nullopt;
   }
@@ -382,6 +393,14 @@ std::optional<BaggageEntryProperty> Baggage::TryMakeBaggageEntryProperty(
 
 std::optional<Baggage> TryMakeBaggage(
     std::string header, std::unordered_set<std::string> allowed_keys) {
+  return TryMakeBaggage(
+      std::move(header),
+      std::make_shared<const std::unordered_set<std::string>>(
+          std::move(allowed_keys)));
+}
+
+std::optional<Baggage> TryMakeBaggage(std::string header,
+                                      AllowedKeysPtr allowed_keys) {
   if (header.size() > kHeaderLengthLimit) {
     LOG_LIMITED_WARNING() << fmt::format(
         "Exceeded the limit of header length: {}", kHeaderLengthLimit);
@@ -13,15 +13,15 @@ namespace baggage {
 
 namespace {
 
-std::unordered_set<std::string> ChooseCurrentAllowedKeys(
+AllowedKeysPtr ChooseCurrentAllowedKeys(
     const Baggage* current_baggage,
     const dynamic_config::Source& config_source) {
   if (current_baggage != nullptr) {
-    return current_baggage->GetAllowedKeys();
+    return current_baggage->GetSharedAllowedKeys();
   }
   const auto snapshot = config_source.GetSnapshot();
   const auto& baggage_settings = snapshot[kBaggageSettings];
-  return baggage_settings.allowed_keys;
+  return baggage_settings.shared_allowed_keys;
 }
 
 }  // namespace
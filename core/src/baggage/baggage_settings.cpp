@@ -7,12 +7,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace baggage {
 
+BaggageSettings::BaggageSettings()
+    : BaggageSettings(std::unordered_set<std::string>{}) {}
+
+BaggageSettings::BaggageSettings(std::unordered_set<std::string> allowed_keys)
+    : allowed_keys(std::move(allowed_keys)),
+      shared_allowed_keys(
+          std::make_shared<const std::unordered_set<std::string>>(
+              this->allowed_keys)) {}
+
 BaggageSettings Parse(const formats::json::Value& value,
                       formats::parse::To<BaggageSettings>) {
-  BaggageSettings result{};
-  result.allowed_keys =
-      value["allowed_keys"].As<std::unordered_set<std::string>>();
-  return result;
+  return BaggageSettings{
+      value["allowed_keys"].As<std::unordered_set<std::string>>()};
 }
 
 const dynamic_config::Key<BaggageSettings> kBaggageSettings{
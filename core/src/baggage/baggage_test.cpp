@@ -183,6 +183,22 @@ UTEST(Baggage, AvailableEntries) {
 }
 
 // Check header Parser
+UTEST(Baggage, SharedAllowedKeys) {
+  const auto allowed_keys =
+      std::make_shared<const std::unordered_set<std::string>>(kAllowedKeys);
+
+  auto baggage = baggage::TryMakeBaggage("key1=value1,key6=value6",
+                                         allowed_keys);
+  ASSERT_TRUE(baggage);
+  EXPECT_EQ(baggage->ToString(), "key1=value1");
+  EXPECT_EQ(baggage->GetSharedAllowedKeys(), allowed_keys);
+
+  const baggage::Baggage copy = *baggage;
+  EXPECT_EQ(copy.GetSharedAllowedKeys(), allowed_keys);
+  EXPECT_EQ(copy.ToString(), "key1=value1");
+  EXPECT_EQ(copy.GetAllowedKeys(), kAllowedKeys);
+}
+
 UTEST(Parse, BaggageHeader) {
   std::string header =
       "key1=value1,  key2 = value2  ; property1; PropertyKey2 "
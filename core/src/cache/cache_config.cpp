@@ -35,6 +35,7 @@ constexpr std::string_view kFullUpdateJitter = "full-update-jitter";
 constexpr std::string_view kExceptionInterval = "exception-interval";
 constexpr std::string_view kCleanupInterval = "additional-cleanup-interval";
 constexpr std::string_view kIsStrongPeriod = "is-strong-period";
+constexpr std::string_view kIsHeavyUpdate = "heavy-update";
 constexpr std::string_view kHasPreAssignCheck = "has-pre-assign-check";
 
 constexpr std::string_view kFirstUpdateFailOk = "first-update-fail-ok";
@@ -151,6 +152,7 @@ Config::Config(const yaml_config::YamlConfig& config,
       cleanup_interval(config[kCleanupInterval].As<std::chrono::milliseconds>(
           kDefaultCleanupInterval)),
       is_strong_period(config[kIsStrongPeriod].As<bool>(false)),
+      is_heavy_update(config[kIsHeavyUpdate].As<bool>(false)),
       failed_updates_before_expiration(config[kFailedUpdatesBeforeExpiration]
                                            .As<std::optional<std::uint64_t>>()),
       is_safe_data_lifetime(config[kSafeDataLifetime].As<bool>(true)),
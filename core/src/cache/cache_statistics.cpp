@@ -15,6 +15,8 @@ constexpr const char* kStatisticsNameIncremental = "incremental";
 constexpr const char* kStatisticsNameAny = "any";
 constexpr const char* kStatisticsNameCurrentDocumentsCount =
     "current-documents-count";
+constexpr const char* kStatisticsNameSnapshot = "snapshot";
+constexpr const char* kStatisticsNameScheduleLag = "update-schedule-lag-ms";
 
 template <typename Clock, typename Duration>
 std::int64_t TimeStampToMillisecondsFromNow(
@@ -101,6 +103,22 @@ void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
 
   writer[cache::kStatisticsNameCurrentDocumentsCount] =
       stats.documents_current_count;
+  writer[cache::kStatisticsNameScheduleLag] =
+      stats.update_schedule_lag.load().count();
+
+  // Only the caches of structurally shared containers report the sharing
+  if (const auto chunks = stats.snapshot_chunks.load()) {
+    auto snapshot = writer[cache::kStatisticsNameSnapshot];
+    snapshot["chunks"] = chunks;
+    snapshot["shared-chunks"] = stats.snapshot_shared_chunks.load();
+  }
+
+  // Only the caches of flat containers report their memory
+  if (const auto capacity = stats.snapshot_capacity.load()) {
+    auto snapshot = writer[cache::kStatisticsNameSnapshot];
+    snapshot["capacity"] = capacity;
+    snapshot["allocated-bytes"] = stats.snapshot_allocated_bytes.load();
+  }
 }
 
 }  // namespace impl
@@ -2,9 +2,12 @@
 
 #include <utility>
 
+#include <fmt/format.h>
+
 #include <cache/cache_dependencies.hpp>
 #include <cache/cache_update_trait_impl.hpp>
 #include <userver/dump/helpers.hpp>
+#include <userver/dump/operations.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -57,6 +60,16 @@ void CacheUpdateTrait::SetDataSizeStatistic(std::size_t size) noexcept {
   impl_->SetDataSizeStatistic(size);
 }
 
+void CacheUpdateTrait::SetSnapshotSharingStatistic(
+    std::size_t chunks, std::size_t shared_chunks) noexcept {
+  impl_->SetSnapshotSharingStatistic(chunks, shared_chunks);
+}
+
+void CacheUpdateTrait::SetSnapshotMemoryStatistic(
+    std::size_t capacity, std::size_t allocated_bytes) noexcept {
+  impl_->SetSnapshotMemoryStatistic(capacity, allocated_bytes);
+}
+
 rcu::ReadablePtr<Config> CacheUpdateTrait::GetConfig() const {
   return impl_->GetConfig();
 }
@@ -75,6 +88,13 @@ void CacheUpdateTrait::ReadAndSet(dump::Reader&) {
   dump::ThrowDumpUnimplemented(Name());
 }
 
+bool CacheUpdateTrait::WriteDelta(dump::Writer&) const { return false; }
+
+void CacheUpdateTrait::ReadAndApplyDelta(dump::Reader&) {
+  throw dump::Error(
+      fmt::format("{}: delta dumps are not supported by the cache", Name()));
+}
+
 }  // namespace cache
 
 USERVER_NAMESPACE_END
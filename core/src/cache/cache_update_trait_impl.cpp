@@ -5,6 +5,7 @@
 #include <userver/components/component.hpp>
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dynamic_config/source.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/cache_control.hpp>
@@ -33,6 +34,15 @@ T CheckNotNull(T ptr) {
   return ptr;
 }
 
+// The periodic updates of the caches with `heavy-update: true` of the whole
+// process share this limit
+constexpr std::size_t kMaxConcurrentHeavyUpdates = 2;
+
+engine::CancellableSemaphore& GetHeavyUpdatesSemaphore() {
+  static engine::CancellableSemaphore semaphore{kMaxConcurrentHeavyUpdates};
+  return semaphore;
+}
+
 }  // namespace
 
 void CacheUpdateTrait::Impl::InvalidateAsync(UpdateType update_type) {
@@ -211,6 +221,10 @@ void CacheUpdateTrait::Impl::StartPeriodicUpdates(
       periodic_task_flags_ |= utils::PeriodicTask::Flags::kStrong;
     }
 
+    if (static_config_.is_heavy_update) {
+      periodic_task_flags_ |= utils::PeriodicTask::Flags::kSpread;
+    }
+
     if (periodic_update_enabled_) {
       const auto first_update_invalidation =
           first_update_invalidation_.exchange(
@@ -220,7 +234,11 @@ void CacheUpdateTrait::Impl::StartPeriodicUpdates(
       }
 
       update_task_.Start(update_task_name_, GetPeriodicTaskSettings(*config),
-                         [this] { DoPeriodicUpdate(); });
+                         [this] {
+                           statistics_.update_schedule_lag =
+                               update_task_.GetLastScheduleLag();
+                           DoPeriodicUpdate();
+                         });
 
       utils::PeriodicTask::Settings cleanup_settings(config->cleanup_interval);
       cleanup_settings.span_level = logging::Level::kNone;
@@ -391,6 +409,18 @@ void CacheUpdateTrait::Impl::SetDataSizeStatistic(std::size_t size) noexcept {
   statistics_.documents_current_count = size;
 }
 
+void CacheUpdateTrait::Impl::SetSnapshotSharingStatistic(
+    std::size_t chunks, std::size_t shared_chunks) noexcept {
+  statistics_.snapshot_chunks = chunks;
+  statistics_.snapshot_shared_chunks = shared_chunks;
+}
+
+void CacheUpdateTrait::Impl::SetSnapshotMemoryStatistic(
+    std::size_t capacity, std::size_t allocated_bytes) noexcept {
+  statistics_.snapshot_capacity = capacity;
+  statistics_.snapshot_allocated_bytes = allocated_bytes;
+}
+
 engine::TaskProcessor& CacheUpdateTrait::Impl::GetCacheTaskProcessor() const {
   return task_processor_;
 }
@@ -464,6 +494,9 @@ utils::PeriodicTask::Settings CacheUpdateTrait::Impl::GetPeriodicTaskSettings(
       config.update_interval, config.update_jitter, periodic_task_flags_};
   settings.exception_period = config.exception_interval;
   settings.task_processor = &task_processor_;
+  if (static_config_.is_heavy_update) {
+    settings.step_semaphore = &GetHeavyUpdatesSemaphore();
+  }
   return settings;
 }
 
@@ -481,6 +514,16 @@ void CacheUpdateTrait::Impl::DumpableEntityProxy::ReadAndSet(
   cache_.ReadAndSet(reader);
 }
 
+bool CacheUpdateTrait::Impl::DumpableEntityProxy::WriteDelta(
+    dump::Writer& writer) const {
+  return cache_.WriteDelta(writer);
+}
+
+void CacheUpdateTrait::Impl::DumpableEntityProxy::ReadAndApplyDelta(
+    dump::Reader& reader) {
+  cache_.ReadAndApplyDelta(reader);
+}
+
 }  // namespace cache
 
 USERVER_NAMESPACE_END
@@ -60,6 +60,12 @@ class CacheUpdateTrait::Impl final {
 
   void SetDataSizeStatistic(std::size_t size) noexcept;
 
+  void SetSnapshotSharingStatistic(std::size_t chunks,
+                                   std::size_t shared_chunks) noexcept;
+
+  void SetSnapshotMemoryStatistic(std::size_t capacity,
+                                  std::size_t allocated_bytes) noexcept;
+
   rcu::ReadablePtr<Config> GetConfig() const;
 
   engine::TaskProcessor& GetCacheTaskProcessor() const;
@@ -73,6 +79,10 @@ class CacheUpdateTrait::Impl final {
 
     void ReadAndSet(dump::Reader& reader) override;
 
+    bool WriteDelta(dump::Writer& writer) const override;
+
+    void ReadAndApplyDelta(dump::Reader& reader) override;
+
    private:
     CacheUpdateTrait& cache_;
   };
@@ -61,6 +61,12 @@ properties:
         type: boolean
         description: whether to include Update execution time in update-interval
         defaultDescription: false
+    heavy-update:
+        type: boolean
+        description: |
+            spread the periodic updates of the heavy caches across
+            update-interval and run a few of them at once
+        defaultDescription: false
     has-pre-assign-check:
         type: boolean
         description: |
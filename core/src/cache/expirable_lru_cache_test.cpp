@@ -1,9 +1,12 @@
 #include <string>
+#include <vector>
 
 #include <userver/utest/utest.hpp>
 
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/dump/operations_mock.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/mock_now.hpp>
 
@@ -330,6 +333,137 @@ UTEST(ExpirableLruCache, BackgroundUpdate) {
   EXPECT_EQ(2, cache.Get(key, UpdateNever()));
 }
 
+UTEST_MT(ExpirableLruCache, CoalescedMisses, 4) {
+  auto cache = CreateSimpleCachePtr();
+  const SimpleCacheKey key = "my-key";
+
+  std::atomic<int> calls{0};
+  engine::SingleConsumerEvent fetch_started;
+  engine::SingleConsumerEvent fetch_allowed;
+  const auto update_func = [&](const SimpleCacheKey&) {
+    ++calls;
+    fetch_started.Send();
+    EXPECT_TRUE(fetch_allowed.WaitForEvent());
+    return 1;
+  };
+
+  std::vector<engine::TaskWithResult<int>> tasks;
+  tasks.push_back(engine::AsyncNoSpan([&] {
+    return cache->Get(key, update_func, SimpleCache::ReadMode::kSkipCache);
+  }));
+  ASSERT_TRUE(fetch_started.WaitForEvent());
+
+  for (int i = 0; i < 10; ++i) {
+    tasks.push_back(
+        engine::AsyncNoSpan([&] { return cache->Get(key, update_func); }));
+  }
+  while (cache->GetStatistics().total.coalesced_waits != 10) {
+    engine::Yield();
+  }
+
+  fetch_allowed.Send();
+  for (auto& task : tasks) EXPECT_EQ(1, task.Get());
+  EXPECT_EQ(1, calls);
+
+  // one of the waiters wanted the value to be cached
+  EXPECT_EQ(1, cache->Get(key, UpdateNever()));
+}
+
+UTEST(ExpirableLruCache, CoalescedMissFailure) {
+  auto cache = CreateSimpleCachePtr();
+  const SimpleCacheKey key = "my-key";
+
+  engine::SingleConsumerEvent fetch_started;
+  engine::SingleConsumerEvent fetch_allowed;
+  auto failing_task = engine::AsyncNoSpan([&] {
+    return cache->Get(key, [&](const SimpleCacheKey&) -> SimpleCacheValue {
+      fetch_started.Send();
+      EXPECT_TRUE(fetch_allowed.WaitForEvent());
+      throw std::runtime_error("update failed");
+    });
+  });
+  ASSERT_TRUE(fetch_started.WaitForEvent());
+
+  auto counter = std::make_shared<Counter>();
+  auto waiting_task = engine::AsyncNoSpan(
+      [&] { return cache->Get(key, UpdateValue(counter, 2)); });
+  while (cache->GetStatistics().total.coalesced_waits != 1) {
+    engine::Yield();
+  }
+
+  fetch_allowed.Send();
+  UEXPECT_THROW(failing_task.Get(), std::runtime_error);
+  // the waiter retries the update on failure
+  EXPECT_EQ(2, waiting_task.Get());
+  EXPECT_EQ(Counter::One(), *counter);
+}
+
+UTEST(ExpirableLruCache, BackgroundUpdateJitter) {
+  auto counter = std::make_shared<Counter>();
+
+  auto cache = CreateSimpleCache();
+  cache.SetMaxLifetime(std::chrono::seconds(10));
+  cache.SetBackgroundUpdate(cache::BackgroundUpdateMode::kEnabled);
+  // the jitter is clamped to the half of the lifetime
+  cache.SetBackgroundUpdateJitter(std::chrono::seconds(100));
+
+  SimpleCacheKey key = "my-key";
+
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+
+  EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 1)));
+
+  // the value is updated in background at some point before the half of its
+  // lifetime
+  utils::datetime::MockSleep(std::chrono::seconds(5) +
+                             std::chrono::milliseconds(1));
+  counter->Flush();
+  EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 2)));
+  EngineYield();
+
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(2, cache.Get(key, UpdateNever()));
+}
+
+UTEST(ExpirableLruCache, NegativeCache) {
+  using OptionalCache =
+      cache::ExpirableLruCache<SimpleCacheKey, std::optional<int>>;
+  OptionalCache cache(1, 1);
+  cache.SetNegativeCache(1024, std::chrono::seconds(10));
+
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+
+  int calls = 0;
+  const auto update_missing = [&calls](const SimpleCacheKey&) {
+    ++calls;
+    return std::optional<int>{};
+  };
+
+  EXPECT_EQ(std::nullopt, cache.Get("missing", update_missing));
+  EXPECT_EQ(std::nullopt, cache.Get("missing", update_missing));
+  EXPECT_EQ(1, calls);
+  EXPECT_EQ(1, cache.GetStatistics().total.negative_hits);
+
+  // the missing keys do not occupy the LRU
+  EXPECT_EQ(0, cache.GetSizeApproximate());
+
+  // the key appeared, the filter is reset
+  cache.Put("missing", 1);
+  EXPECT_EQ(1, cache.GetStatistics().total.negative_false_positives);
+  cache.InvalidateByKey("missing");
+  EXPECT_EQ(std::nullopt, cache.Get("missing", update_missing));
+  EXPECT_EQ(2, calls);
+
+  utils::datetime::MockSleep(std::chrono::seconds(11));
+  EXPECT_EQ(std::nullopt, cache.Get("missing", update_missing));
+  EXPECT_EQ(3, calls);
+
+  cache.SetNegativeCache(0, std::chrono::seconds(10));
+  EXPECT_EQ(std::nullopt, cache.Get("missing", update_missing));
+  EXPECT_EQ(4, calls);
+  EXPECT_EQ(1, cache.GetSizeApproximate());
+}
+
 UTEST(ExpirableLruCache, Example) {
   /// [Sample ExpirableLruCache]
   using Key = std::string;
@@ -53,14 +53,33 @@ properties:
     ways:
         type: integer
         description: number of ways for associative cache
+    policy:
+        type: string
+        description: eviction policy of the ways
+        defaultDescription: lru
+        enum:
+          - lru
+          - clock
     lifetime:
         type: string
         description: TTL for cache entries (0 is unlimited)
         defaultDescription: 0
+    negative-cache-size:
+        type: integer
+        description: number of counters of the negative cache filter (0 disables it)
+        defaultDescription: 0
+    negative-cache-decay:
+        type: string
+        description: reset period of the negative cache filter (0 is unlimited)
+        defaultDescription: 0
     background-update:
         type: boolean
         description: enables asynchronous updates for expiring values
         defaultDescription: false
+    background-update-jitter:
+        type: string
+        description: max per-key offset of the background update before half of the lifetime
+        defaultDescription: 0
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
@@ -6,6 +6,7 @@
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,7 +18,21 @@ constexpr std::string_view kWays = "ways";
 constexpr std::string_view kSize = "size";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
+constexpr std::string_view kBackgroundUpdateJitter = "background-update-jitter";
+constexpr std::string_view kBackgroundUpdateJitterMs =
+    "background-update-jitter-ms";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kPolicy = "policy";
+constexpr std::string_view kNegativeCacheSize = "negative-cache-size";
+constexpr std::string_view kNegativeCacheDecay = "negative-cache-decay";
+constexpr std::string_view kNegativeCacheDecayMs = "negative-cache-decay-ms";
+
+constexpr utils::TrivialBiMap kCachePolicyMap([](auto selector) {
+  return selector()
+      .template Type<CachePolicy, std::string_view>()
+      .Case(CachePolicy::kLru, "lru")
+      .Case(CachePolicy::kClock, "clock");
+});
 
 }  // namespace
 
@@ -28,7 +43,12 @@ LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(config[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      background_update_jitter(
+          config[kBackgroundUpdateJitter].As<std::chrono::milliseconds>(0)),
+      negative_cache_size(config[kNegativeCacheSize].As<std::size_t>(0)),
+      negative_cache_decay(
+          config[kNegativeCacheDecay].As<std::chrono::milliseconds>(0)) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -40,7 +60,12 @@ LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(value[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      background_update_jitter(ParseMs(value[kBackgroundUpdateJitterMs],
+                                       std::chrono::milliseconds::zero())),
+      negative_cache_size(value[kNegativeCacheSize].As<std::size_t>(0)),
+      negative_cache_decay(ParseMs(value[kNegativeCacheDecayMs],
+                                   std::chrono::milliseconds::zero())) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -54,10 +79,20 @@ LruCacheConfig Parse(const formats::json::Value& value,
   return LruCacheConfig{value};
 }
 
+CachePolicy Parse(const yaml_config::YamlConfig& config,
+                  formats::parse::To<CachePolicy>) {
+  return utils::ParseFromValueString(config, kCachePolicyMap);
+}
+
+std::string_view ToString(CachePolicy policy) {
+  return utils::impl::EnumToStringView(policy, kCachePolicyMap);
+}
+
 LruCacheConfigStatic::LruCacheConfigStatic(
     const yaml_config::YamlConfig& config)
     : config(config),
       ways(config[kWays].As<std::size_t>()),
+      policy(config[kPolicy].As<CachePolicy>(CachePolicy::kLru)),
       use_dynamic_config(config["config-settings"].As<bool>(true)) {
   if (ways <= 0) throw std::runtime_error("cache-ways is non-positive");
 }
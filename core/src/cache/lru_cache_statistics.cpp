@@ -13,13 +13,19 @@ ExpirableLruCacheStatisticsBase::ExpirableLruCacheStatisticsBase(
     : hits(other.hits.load()),
       misses(other.misses.load()),
       stale(other.stale.load()),
-      background_updates(other.background_updates.load()) {}
+      background_updates(other.background_updates.load()),
+      negative_hits(other.negative_hits.load()),
+      negative_false_positives(other.negative_false_positives.load()),
+      coalesced_waits(other.coalesced_waits.load()) {}
 
 void ExpirableLruCacheStatisticsBase::Reset() {
   hits = 0;
   misses = 0;
   stale = 0;
   background_updates = 0;
+  negative_hits = 0;
+  negative_false_positives = 0;
+  coalesced_waits = 0;
 }
 
 ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
@@ -28,6 +34,9 @@ ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
   misses += other.misses.load();
   stale += other.stale.load();
   background_updates += other.background_updates.load();
+  negative_hits += other.negative_hits.load();
+  negative_false_positives += other.negative_false_positives.load();
+  coalesced_waits += other.coalesced_waits.load();
   return *this;
 }
 
@@ -49,12 +58,34 @@ void CacheStale(ExpirableLruCacheStatistics& stats) {
   LOG_TRACE() << "stale cache";
 }
 
+void CacheNegativeHit(ExpirableLruCacheStatistics& stats) {
+  ++stats.total.negative_hits;
+  ++stats.recent.GetCurrentCounter().negative_hits;
+  LOG_TRACE() << "negative cache hit";
+}
+
+void CacheNegativeFalsePositive(ExpirableLruCacheStatistics& stats) {
+  ++stats.total.negative_false_positives;
+  ++stats.recent.GetCurrentCounter().negative_false_positives;
+  LOG_TRACE() << "negative cache false positive";
+}
+
+void CacheCoalescedWait(ExpirableLruCacheStatistics& stats) {
+  ++stats.total.coalesced_waits;
+  ++stats.recent.GetCurrentCounter().coalesced_waits;
+  LOG_TRACE() << "coalesced cache miss";
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const ExpirableLruCacheStatistics& stats) {
   writer["hits"] = stats.total.hits.load();
   writer["misses"] = stats.total.misses.load();
   writer["stale"] = stats.total.stale.load();
   writer["background-updates"] = stats.total.background_updates.load();
+  writer["negative-hits"] = stats.total.negative_hits.load();
+  writer["negative-false-positives"] =
+      stats.total.negative_false_positives.load();
+  writer["coalesced-waits"] = stats.total.coalesced_waits.load();
 
   auto s1min = stats.recent.GetStatsForPeriod();
   double s1min_hits = s1min.hits.load();
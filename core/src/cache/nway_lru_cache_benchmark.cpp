@@ -0,0 +1,96 @@
+#include <userver/cache/nway_lru_cache.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWays = 16;
+constexpr std::size_t kWaySize = 1000;
+// A few hot keys, most of the lookups are hits
+constexpr unsigned kHotKeys = 64;
+
+void NWayLruHotKeysGet(benchmark::State& state, cache::CachePolicy policy) {
+  engine::RunStandalone(state.range(0), [&] {
+    cache::NWayLRU<unsigned, unsigned> cache(kWays, kWaySize, {}, {}, policy);
+    for (unsigned i = 0; i < kHotKeys; ++i) cache.Put(i, i);
+
+    const std::size_t concurrent_jobs = state.range(0);
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrent_jobs);
+
+    for (std::size_t thread_id = 1; thread_id < concurrent_jobs; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        unsigned i = thread_id;
+        while (keep_running) {
+          benchmark::DoNotOptimize(cache.Get(++i % kHotKeys));
+        }
+      }));
+    }
+
+    unsigned i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(cache.Get(++i % kHotKeys));
+    }
+
+    keep_running = false;
+    for (auto& task : tasks) task.Get();
+  });
+}
+
+void NWayLruMixed(benchmark::State& state, cache::CachePolicy policy) {
+  engine::RunStandalone(state.range(0), [&] {
+    cache::NWayLRU<unsigned, unsigned> cache(kWays, kWaySize, {}, {}, policy);
+
+    const std::size_t concurrent_jobs = state.range(0);
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrent_jobs);
+
+    // Every 16th lookup misses and inserts a new key
+    const auto iteration = [&cache](unsigned i) {
+      const auto key = (i % 16 == 0) ? i : i % kHotKeys;
+      if (!cache.Get(key)) cache.Put(key, key);
+    };
+
+    for (std::size_t thread_id = 1; thread_id < concurrent_jobs; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        unsigned i = thread_id;
+        while (keep_running) iteration(++i);
+      }));
+    }
+
+    unsigned i = 0;
+    for ([[maybe_unused]] auto _ : state) iteration(++i);
+
+    keep_running = false;
+    for (auto& task : tasks) task.Get();
+  });
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(NWayLruHotKeysGet, lru, cache::CachePolicy::kLru)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_CAPTURE(NWayLruHotKeysGet, clock, cache::CachePolicy::kClock)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+BENCHMARK_CAPTURE(NWayLruMixed, lru, cache::CachePolicy::kLru)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_CAPTURE(NWayLruMixed, clock, cache::CachePolicy::kClock)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+USERVER_NAMESPACE_END
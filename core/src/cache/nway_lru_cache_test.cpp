@@ -1,6 +1,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -64,4 +65,74 @@ UTEST(NWayLRU, HashCombine) {
   }
 }
 
+UTEST(NWayLRU, ClockSet) {
+  Cache cache(1, 2, {}, {}, cache::CachePolicy::kClock);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  EXPECT_EQ(2, cache.GetSize());
+
+  // 1 gets the second chance, 2 is evicted
+  EXPECT_EQ(1, cache.Get(1));
+  cache.Put(3, 3);
+
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_FALSE(cache.Get(2).has_value());
+  EXPECT_EQ(3, cache.Get(3));
+}
+
+UTEST(NWayLRU, ClockGetExpired) {
+  Cache cache(1, 2, {}, {}, cache::CachePolicy::kClock);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+
+  EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+  EXPECT_EQ(1, cache.GetSize());
+  EXPECT_EQ(2, cache.GetOr(2, 0));
+  EXPECT_EQ(0, cache.GetOr(1, 0));
+
+  cache.InvalidateByKey(2);
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST(NWayLRU, ClockUpdateWaySize) {
+  Cache cache(2, 10, {}, {}, cache::CachePolicy::kClock);
+  for (int i = 0; i < 20; ++i) cache.Put(i, i);
+
+  cache.UpdateWaySize(1);
+  EXPECT_LE(cache.GetSize(), 2);
+
+  std::size_t visited = 0;
+  cache.VisitAll([&visited](int key, int value) {
+    EXPECT_EQ(key, value);
+    ++visited;
+  });
+  EXPECT_EQ(visited, cache.GetSize());
+
+  cache.Invalidate();
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST_MT(NWayLRU, ClockConcurrentGet, 4) {
+  Cache cache(4, 100, {}, {}, cache::CachePolicy::kClock);
+  for (int i = 0; i < 200; ++i) cache.Put(i, i);
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int t = 0; t < 4; ++t) {
+    tasks.push_back(engine::AsyncNoSpan([&cache, t] {
+      for (int i = 0; i < 1000; ++i) {
+        const auto key = (i * 7 + t) % 300;
+        const auto value = cache.Get(key);
+        if (value) {
+          EXPECT_EQ(*value, key);
+        }
+        if (key >= 200) cache.Put(key, key);
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_LE(cache.GetSize(), 400);
+}
+
 USERVER_NAMESPACE_END
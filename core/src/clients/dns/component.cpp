@@ -12,6 +12,8 @@ namespace clients::dns {
 namespace {
 
 constexpr std::string_view kDnsReplySource = "dns_reply_source";
+constexpr std::string_view kDnsName = "dns_name";
+constexpr std::string_view kDnsQueryType = "dns_query_type";
 
 ResolverConfig ParseResolverConfig(
     const components::ComponentConfig& component_config) {
@@ -31,14 +33,17 @@ ResolverConfig ParseResolverConfig(
           config.network_custom_servers);
   config.cache_ways =
       component_config["cache-ways"].As<size_t>(config.cache_ways);
-  config.cache_size_per_way = component_config["cache_size_per_way"].As<size_t>(
+  config.cache_size_per_way = component_config["cache-size-per-way"].As<size_t>(
       config.cache_size_per_way);
   config.cache_max_reply_ttl =
-      component_config["cache_max_reply_ttl"].As<std::chrono::milliseconds>(
+      component_config["cache-max-reply-ttl"].As<std::chrono::milliseconds>(
           config.cache_max_reply_ttl);
   config.cache_failure_ttl =
-      component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(
+      component_config["cache-failure-ttl"].As<std::chrono::milliseconds>(
           config.cache_failure_ttl);
+  config.cache_refresh_ahead =
+      component_config["cache-refresh-ahead"]
+          .As<std::optional<std::chrono::milliseconds>>();
   return config;
 }
 
@@ -69,6 +74,21 @@ void Component::Write(utils::statistics::Writer& writer) {
   writer.ValueWithLabels(counters.network, {kDnsReplySource, "network"});
   writer.ValueWithLabels(counters.network_failure,
                          {kDnsReplySource, "network-failure"});
+
+  if (auto names_writer = writer["names"]) {
+    for (const auto& [name, name_counters] :
+         GetResolver().GetNameQueryCounters()) {
+      names_writer.ValueWithLabels(name_counters.foreground,
+                                   {{kDnsName, name},
+                                    {kDnsQueryType, "foreground"}});
+      names_writer.ValueWithLabels(name_counters.background,
+                                   {{kDnsName, name},
+                                    {kDnsQueryType, "background"}});
+      names_writer.ValueWithLabels(name_counters.failures,
+                                   {{kDnsName, name},
+                                    {kDnsQueryType, "failure"}});
+    }
+  }
 }
 
 yaml_config::Schema Component::GetStaticConfigSchema() {
@@ -119,6 +139,12 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-refresh-ahead:
+        type: string
+        description: |
+            how long before the expiration a requested record is refreshed
+            in background
+        defaultDescription: network-timeout
 )");
 }
 
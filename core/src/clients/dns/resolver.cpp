@@ -5,6 +5,8 @@
 #include <cctype>
 #include <chrono>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <clients/dns/file_resolver.hpp>
 #include <clients/dns/helpers.hpp>
@@ -134,6 +136,8 @@ class Resolver::Impl {
   ~Impl();
 
   const LookupSourceCounters& GetLookupSourceCounters() const;
+  std::vector<std::pair<std::string, NameQueryCounters>> GetNameQueryCounters()
+      const;
 
   void ReloadHosts();
   void FlushNetworkCache();
@@ -159,6 +163,7 @@ class Resolver::Impl {
     AddrVector addrs;
     std::chrono::steady_clock::time_point expiration;
     bool is_failure{false};
+    NameQueryCounters counters;
   };
 
   template <typename Mutex>
@@ -189,7 +194,8 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
                      config.file_update_interval},
       net_resolver_{fs_task_processor, config.network_timeout,
                     config.network_attempts, config.network_custom_servers},
-      net_cache_update_margin_{config.network_timeout},
+      net_cache_update_margin_{
+          config.cache_refresh_ahead.value_or(config.network_timeout)},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
       net_cache_{config.cache_ways, config.cache_size_per_way},
@@ -202,6 +208,16 @@ const Resolver::LookupSourceCounters& Resolver::Impl::GetLookupSourceCounters()
   return source_counters_;
 }
 
+std::vector<std::pair<std::string, Resolver::NameQueryCounters>>
+Resolver::Impl::GetNameQueryCounters() const {
+  std::vector<std::pair<std::string, NameQueryCounters>> result;
+  net_cache_.VisitAll([&result](const std::string& name,
+                                const NetCacheEntry& entry) {
+    result.emplace_back(name, entry.counters);
+  });
+  return result;
+}
+
 void Resolver::Impl::ReloadHosts() { file_resolver_.ReloadHosts(); }
 
 void Resolver::Impl::FlushNetworkCache() { net_cache_.Invalidate(); }
@@ -329,17 +345,32 @@ void Resolver::Impl::FinishNetUpdate(
     engine::Future<NetResolver::Response>&& future, const std::string& name,
     AddrVector* addrs, FailureMode failure_mode) {
   UASSERT(lock);
+  // Only the holder of the update mutex puts the name into the cache, so the
+  // counters are not lost between Get and Put
+  auto previous = net_cache_.Get(name);
+  auto counters = previous ? previous->counters : NameQueryCounters{};
+  // Foreground queries cache failures, background ones keep the stale record
+  if (failure_mode == FailureMode::kCache) {
+    ++counters.foreground;
+  } else {
+    ++counters.background;
+  }
+
   NetResolver::Response response;
   try {
     response = future.get();
   } catch (const ResolverException& ex) {
     LOG_LIMITED_ERROR() << "Resolving of '" << name << "' failed: " << ex;
+    ++counters.failures;
     if (failure_mode == FailureMode::kCache) {
       LOG_TRACE() << "Caching failure for '" << name << '\'';
       net_cache_.Put(name, NetCacheEntry{{},
                                          utils::datetime::MockSteadyNow() +
                                              net_cache_failure_ttl_,
-                                         true});
+                                         true, counters});
+    } else if (previous) {
+      previous->counters = counters;
+      net_cache_.Put(name, std::move(*previous));
     }
     ++source_counters_.network_failure;
     throw;
@@ -352,9 +383,10 @@ void Resolver::Impl::FinishNetUpdate(
   if (addrs) *addrs = response.addrs;
   if (effective_ttl.count() > 0) {
     LOG_TRACE() << "Updating cache for '" << name << '\'';
-    net_cache_.Put(
-        name, NetCacheEntry{std::move(response.addrs),
-                            utils::datetime::MockSteadyNow() + effective_ttl});
+    net_cache_.Put(name, NetCacheEntry{std::move(response.addrs),
+                                       utils::datetime::MockSteadyNow() +
+                                           effective_ttl,
+                                       false, counters});
   } else {
     LOG_TRACE() << "Skipping cache update for '" << name << '\'';
   }
@@ -436,6 +468,11 @@ const Resolver::LookupSourceCounters& Resolver::GetLookupSourceCounters()
   return impl_->GetLookupSourceCounters();
 }
 
+std::vector<std::pair<std::string, Resolver::NameQueryCounters>>
+Resolver::GetNameQueryCounters() const {
+  return impl_->GetNameQueryCounters();
+}
+
 void Resolver::ReloadHosts() { impl_->ReloadHosts(); }
 
 void Resolver::FlushNetworkCache() { impl_->FlushNetworkCache(); }
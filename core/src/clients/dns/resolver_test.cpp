@@ -426,6 +426,46 @@ UTEST(Resolver, CacheFailures) {
   EXPECT_EQ(counters.network_failure, 2);
 }
 
+UTEST(Resolver, NameQueryCounters) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1000, 2};
+
+  utils::datetime::MockNowSet({});
+
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  UEXPECT_THROW(resolver->Resolve("fail", test_deadline),
+                clients::dns::NotResolvedException);
+
+  // within the refresh-ahead margin (network_timeout) of the expiration
+  utils::datetime::MockSleep(std::chrono::seconds{990});
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  const auto find_counters = [&resolver](std::string_view name) {
+    for (const auto& [cached_name, counters] :
+         resolver->GetNameQueryCounters()) {
+      if (cached_name == name) return counters;
+    }
+    return clients::dns::Resolver::NameQueryCounters{};
+  };
+  while (find_counters("first").background == 0 && !test_deadline.IsReached()) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+
+  const auto first = find_counters("first");
+  EXPECT_EQ(first.foreground, 1);
+  EXPECT_EQ(first.background, 1);
+  EXPECT_EQ(first.failures, 0);
+
+  const auto fail = find_counters("fail");
+  EXPECT_EQ(fail.foreground, 1);
+  EXPECT_EQ(fail.background, 0);
+  EXPECT_EQ(fail.failures, 1);
+}
+
 UTEST(Resolver, FileDoesNotCache) {
   const auto test_deadline =
       engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
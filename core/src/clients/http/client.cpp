@@ -7,12 +7,14 @@
 #include <moodycamel/concurrentqueue.h>
 
 #include <userver/crypto/openssl.hpp>
+#include <userver/http/url.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/manager.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/userver_info.hpp>
 
+#include <clients/http/connection_affinity.hpp>
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
 #include <clients/http/statistics.hpp>
@@ -28,6 +30,8 @@ namespace {
 
 const std::string kIoThreadName = "curl";
 const auto kEasyReinitPeriod = std::chrono::minutes{1};
+const auto kWarmupTimeout = std::chrono::seconds{5};
+constexpr size_t kMaxAffinityOrigins = 1000;
 
 // cURL accepts options as long, but we use size_t to avoid writing checks.
 // Clamp too high values to LONG_MAX, it shouldn't matter for these magnitudes.
@@ -52,6 +56,12 @@ Client::Client(ClientSettings settings,
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
+      connection_affinity_(settings.connection_affinity
+                               ? std::make_unique<ConnectionAffinity>(
+                                     kMaxAffinityOrigins)
+                               : nullptr),
+      warmup_urls_(std::move(settings.warmup_urls)),
+      warmup_interval_(settings.warmup_interval),
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()),
       tracing_manager_(GetTracingManager(settings)),
       headers_propagator_(settings.headers_propagator),
@@ -89,6 +99,7 @@ Client::Client(ClientSettings settings,
 }
 
 Client::~Client() {
+  warmup_task_.Stop();
   easy_reinit_task_.Stop();
 
   // We have to destroy *this only when all the requests are finished, because
@@ -113,37 +124,40 @@ Client::~Client() {
 }
 
 Request Client::CreateRequest() {
-  auto request = [this] {
-    auto easy = TryDequeueIdle();
-    if (easy) {
-      auto idx = FindMultiIndex(easy->GetMulti());
-      auto wrapper = impl::EasyWrapper{std::move(easy), *this};
-      return Request{
-          std::move(wrapper),      statistics_[idx].CreateRequestStats(),
-          destination_statistics_, resolver_,
-          plugin_pipeline_,        *tracing_manager_.GetBase()};
-    } else {
-      auto i = utils::RandRange(multis_.size());
-      auto& multi = multis_[i];
-
-      try {
-        auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
-                         return impl::EasyWrapper{
-                             easy_.Get()->GetBoundBlocking(*multi), *this};
-                       }).Get();
-        return Request{
-            std::move(wrapper),      statistics_[i].CreateRequestStats(),
-            destination_statistics_, resolver_,
-            plugin_pipeline_,        *tracing_manager_.GetBase()};
-      } catch (engine::WaitInterruptedException&) {
-        throw clients::http::CancelException("wait interrupted", {},
-                                             ErrorKind::kCancel);
-      } catch (engine::TaskCancelledException&) {
-        throw clients::http::CancelException("task cancelled", {},
-                                             ErrorKind::kCancel);
-      }
-    }
-  }();
+  auto easy = TryDequeueIdle();
+  if (easy) {
+    auto idx = FindMultiIndex(easy->GetMulti());
+    return SetupRequest(impl::EasyWrapper{std::move(easy), *this}, idx);
+  }
+  return CreateRequestForMulti(utils::RandRange(multis_.size()));
+}
+
+Request Client::CreateRequestForMulti(size_t multi_index) {
+  UASSERT(multi_index < multis_.size());
+  auto& multi = multis_[multi_index];
+
+  try {
+    auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
+                     return impl::EasyWrapper{
+                         easy_.Get()->GetBoundBlocking(*multi), *this};
+                   }).Get();
+    return SetupRequest(std::move(wrapper), multi_index);
+  } catch (engine::WaitInterruptedException&) {
+    throw clients::http::CancelException("wait interrupted", {},
+                                         ErrorKind::kCancel);
+  } catch (engine::TaskCancelledException&) {
+    throw clients::http::CancelException("task cancelled", {},
+                                         ErrorKind::kCancel);
+  }
+}
+
+Request Client::SetupRequest(impl::EasyWrapper&& wrapper, size_t multi_index) {
+  Request request{std::move(wrapper),
+                  statistics_[multi_index].CreateRequestStats(),
+                  destination_statistics_,
+                  resolver_,
+                  plugin_pipeline_,
+                  *tracing_manager_.GetBase()};
 
   if (testsuite_config_) {
     request.SetTestsuiteConfig(testsuite_config_);
@@ -169,6 +183,38 @@ Request Client::CreateRequest() {
   return request;
 }
 
+void Client::StartConnectionsWarmup() {
+  if (warmup_urls_.empty()) return;
+
+  warmup_task_.Start(
+      "http_connections_warmup",
+      {warmup_interval_, utils::PeriodicTask::Flags::kNow},
+      [this] { WarmupConnections(); });
+}
+
+void Client::WarmupConnections() {
+  // A request from each multi leaves an idle connection in its cache
+  std::vector<ResponseFuture> futures;
+  futures.reserve(warmup_urls_.size() * multis_.size());
+  for (const auto& url : warmup_urls_) {
+    for (size_t i = 0; i < multis_.size(); ++i) {
+      futures.push_back(CreateRequestForMulti(i)
+                            .head(url)
+                            .retry(1)
+                            .timeout(kWarmupTimeout)
+                            .async_perform());
+    }
+  }
+
+  for (auto& future : futures) {
+    try {
+      future.Get();
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_WARNING() << "Connections warmup request failed: " << ex;
+    }
+  }
+}
+
 void Client::SetMultiplexingEnabled(bool enabled) {
   for (auto& multi : multis_) {
     multi->SetMultiplexingEnabled(enabled);
@@ -234,6 +280,13 @@ const DestinationStatistics& Client::GetDestinationStatistics() const {
   return *destination_statistics_;
 }
 
+std::optional<std::chrono::milliseconds>
+Client::GetDestinationTimingPercentile(const std::string& url,
+                                       double percent) const {
+  return destination_statistics_->GetTimingPercentile(
+      USERVER_NAMESPACE::http::ExtractMetaTypeFromUrl(url), percent);
+}
+
 void Client::PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept {
   try {
     easy->reset();
@@ -253,6 +306,25 @@ std::shared_ptr<curl::easy> Client::TryDequeueIdle() noexcept {
   return result;
 }
 
+std::shared_ptr<std::atomic<std::size_t>> Client::BindToOriginMulti(
+    curl::easy& easy, const std::string& origin) {
+  UASSERT(connection_affinity_);
+  auto multi_index = connection_affinity_->GetMultiIndex(origin);
+  if (!multi_index) return {};
+
+  const auto index = multi_index->load();
+  if (index != ConnectionAffinity::kUnknownMulti) {
+    UASSERT(index < multis_.size());
+    easy.Rebind(*multis_[index]);
+  }
+  return multi_index;
+}
+
+void Client::RememberOriginMulti(const curl::easy& easy,
+                                 std::atomic<std::size_t>& multi_index) const {
+  multi_index.store(FindMultiIndex(easy.GetMulti()));
+}
+
 void Client::SetTestsuiteConfig(const TestsuiteConfig& config) {
   LOG_INFO() << "http client: configured for testsuite";
   testsuite_config_ = std::make_shared<const TestsuiteConfig>(config);
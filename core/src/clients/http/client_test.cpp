@@ -305,6 +305,46 @@ HttpResponse huge_data_callback(const HttpRequest& request) {
       HttpResponse::kWriteAndClose};
 }
 
+HttpResponse streamed_body_echo_callback(const HttpRequest& request) {
+  const auto headers_end = request.find("\r\n\r\n");
+  if (headers_end == std::string::npos) return {{}, HttpResponse::kTryReadMore};
+  const auto headers = request.substr(0, headers_end);
+  auto body = request.substr(headers_end + 4);
+
+  if (headers.find("Transfer-Encoding: chunked") != std::string::npos) {
+    const std::string_view kLastChunk = "0\r\n\r\n";
+    if (body.size() < kLastChunk.size() ||
+        body.compare(body.size() - kLastChunk.size(), kLastChunk.size(),
+                     kLastChunk) != 0) {
+      return {{}, HttpResponse::kTryReadMore};
+    }
+
+    std::string decoded;
+    std::size_t pos = 0;
+    while (true) {
+      const auto size_end = body.find("\r\n", pos);
+      const auto size = std::stoul(body.substr(pos, size_end - pos), nullptr,
+                                   16);
+      if (size == 0) break;
+      decoded += body.substr(size_end + 2, size);
+      pos = size_end + 2 + size + 2;
+    }
+    body = std::move(decoded);
+  } else {
+    const std::string_view kContentLength = "Content-Length: ";
+    const auto length_pos = headers.find(kContentLength);
+    EXPECT_NE(length_pos, std::string::npos) << headers;
+    if (length_pos == std::string::npos) return {};
+    const auto length =
+        std::stoul(headers.substr(length_pos + kContentLength.size()));
+    if (body.size() < length) return {{}, HttpResponse::kTryReadMore};
+  }
+
+  return {"HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: " +
+              std::to_string(body.size()) + "\r\n\r\n" + body,
+          HttpResponse::kWriteAndClose};
+}
+
 std::string TryGetHeader(const HttpRequest& request, std::string_view header) {
   const auto first_pos = request.find(header);
   if (first_pos == std::string::npos) return {};
@@ -612,6 +652,57 @@ UTEST(HttpClient, PostEcho) {
   }
 }
 
+UTEST(HttpClient, StreamedRequestBody) {
+  const utest::SimpleServer http_server{&streamed_body_echo_callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  for (const bool is_length_known : {true, false}) {
+    auto queue = concurrent::StringStreamQueue::Create(2);
+    auto producer = queue->GetProducer();
+
+    std::string expected;
+    for (int i = 0; i < 10; ++i) expected += std::string(10000, 'a' + i);
+    const auto content_length =
+        is_length_known ? std::optional<std::size_t>{expected.size()}
+                        : std::nullopt;
+
+    auto future = http_client_ptr->CreateRequest()
+                      .post(http_server.GetBaseUrl())
+                      .data_stream(queue, content_length)
+                      .timeout(kTimeout)
+                      .async_perform();
+
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_TRUE(producer.Push(std::string(10000, 'a' + i)));
+    }
+    [[maybe_unused]] const auto finished_producer = std::move(producer);
+
+    const auto response = future.Get();
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+    EXPECT_EQ(response->body(), expected);
+  }
+}
+
+UTEST(HttpClient, StreamedRequestBodyTimeout) {
+  const utest::SimpleServer http_server{&streamed_body_echo_callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  auto queue = concurrent::StringStreamQueue::Create(2);
+  auto producer = queue->GetProducer();
+  ASSERT_TRUE(producer.Push("partial body"));
+
+  auto request = http_client_ptr->CreateRequest()
+                     .post(http_server.GetBaseUrl())
+                     .data_stream(queue)
+                     .timeout(std::chrono::milliseconds{100});
+  UEXPECT_THROW(request.async_perform().Get(),
+                clients::http::TimeoutException);
+
+  // the body is not consumed any more
+  while (producer.Push("more data")) {
+  }
+}
+
 UTEST(HttpClient, StatsOnTimeout) {
   const int kRetries = 5;
   const utest::SimpleServer http_server{&sleep_callback};
@@ -152,6 +152,8 @@ HttpClient::HttpClient(const ComponentConfig& component_config,
       std::move(stats_name), [this](utils::statistics::Writer& writer) {
         return WriteStatistics(writer);
       });
+
+  http_client_.StartConnectionsWarmup();
 }
 
 std::vector<utils::NotNull<clients::http::Plugin*>> HttpClient::FindPlugins(
@@ -262,6 +264,21 @@ properties:
         enum:
           - cancel
           - ignore
+    connection-affinity:
+        type: boolean
+        description: route requests to the IO thread that has recently finished a request to the same host, so that its idle connection is reused
+        defaultDescription: false
+    warmup-urls:
+        type: array
+        description: URLs to send HEAD requests to from each IO thread at start and then periodically, to keep warm connections to hot destinations
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: URL
+    warmup-interval:
+        type: string
+        description: interval between the warmup requests, new connections resolve the host again
+        defaultDescription: 1m
 )");
 }
 
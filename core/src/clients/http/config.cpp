@@ -4,6 +4,7 @@
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -55,6 +56,13 @@ ClientSettings Parse(const yaml_config::YamlConfig& value,
   result.io_threads = value["threads"].As<size_t>(result.io_threads);
   result.defer_events = value["defer-events"].As<bool>(result.defer_events);
   result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+  result.connection_affinity =
+      value["connection-affinity"].As<bool>(result.connection_affinity);
+  result.warmup_urls =
+      value["warmup-urls"].As<std::vector<std::string>>(result.warmup_urls);
+  result.warmup_interval =
+      value["warmup-interval"].As<std::chrono::milliseconds>(
+          result.warmup_interval);
   return result;
 }
 
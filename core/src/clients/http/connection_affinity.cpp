@@ -0,0 +1,27 @@
+#include <clients/http/connection_affinity.hpp>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+ConnectionAffinity::ConnectionAffinity(std::size_t max_origins)
+    : max_origins_(max_origins) {}
+
+std::shared_ptr<ConnectionAffinity::MultiIndex>
+ConnectionAffinity::GetMultiIndex(const std::string& origin) {
+  if (auto index = origins_.Get(origin)) return index;
+
+  if (origins_.SizeApprox() >= max_origins_) {
+    LOG_LIMITED_WARNING() << "Too many HTTP origins for connection affinity ("
+                          << max_origins_ << "), requests to '" << origin
+                          << "' are spread over all the IO threads";
+    return {};
+  }
+  return origins_.Emplace(origin, kUnknownMulti).value;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <userver/rcu/rcu_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// Remembers the multi that has recently finished a request to an origin
+/// (scheme, host and port), so that the idle connection in the connection
+/// cache of that multi is reused by the next request to the origin.
+class ConnectionAffinity final {
+ public:
+  static constexpr std::size_t kUnknownMulti =
+      std::numeric_limits<std::size_t>::max();
+
+  // Index of the multi in clients::http::Client or kUnknownMulti
+  using MultiIndex = std::atomic<std::size_t>;
+
+  explicit ConnectionAffinity(std::size_t max_origins);
+
+  // Returns nullptr if max_origins are already tracked.
+  // Must be called from a coroutine, the returned value may be updated from
+  // any thread.
+  std::shared_ptr<MultiIndex> GetMultiIndex(const std::string& origin);
+
+ private:
+  const std::size_t max_origins_;
+  rcu::RcuMap<std::string, MultiIndex> origins_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
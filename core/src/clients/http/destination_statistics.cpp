@@ -36,6 +36,14 @@ DestinationStatistics::GetExistingStatisticsForDestination(
     return {};
 }
 
+std::optional<std::chrono::milliseconds>
+DestinationStatistics::GetTimingPercentile(const std::string& destination,
+                                           double percent) const {
+  const auto stats = rcu_map_.Get(destination);
+  if (!stats) return std::nullopt;
+  return stats->GetRecentTimingPercentile(percent);
+}
+
 std::shared_ptr<RequestStats>
 DestinationStatistics::GetStatisticsForDestinationAuto(
     const std::string& destination) {
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include <userver/rcu/rcu_map.hpp>
@@ -25,6 +27,11 @@ class DestinationStatistics final {
 
   void SetAutoMaxSize(size_t max_auto_destinations);
 
+  // Recent timing percentile of the destination, std::nullopt if there is no
+  // such destination or no requests to it were finished recently
+  std::optional<std::chrono::milliseconds> GetTimingPercentile(
+      const std::string& destination, double percent) const;
+
   using DestinationsMap = rcu::RcuMap<std::string, Statistics>;
 
   DestinationsMap::ConstIterator begin() const;
@@ -1,9 +1,12 @@
 #include <clients/http/destination_statistics.hpp>
 
+#include <atomic>
 #include <unordered_set>
 #include <userver/engine/sleep.hpp>
 
 #include <userver/clients/http/client.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/tracing/manager.hpp>
 #include <userver/utest/http_client.hpp>
 #include <userver/utest/simple_server.hpp>
 #include <userver/utest/utest.hpp>
@@ -23,6 +26,33 @@ static HttpResponse Callback(int code, const HttpRequest& request) {
           HttpResponse::kWriteAndClose};
 }
 
+static HttpResponse KeepAliveCallback(const HttpRequest& request) {
+  LOG_INFO() << "HTTP Server receive: " << request;
+
+  return {"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+          HttpResponse::kWriteAndContinue};
+}
+
+static std::shared_ptr<clients::http::Client> CreateClient(
+    clients::http::ClientSettings settings) {
+  static const tracing::GenericTracingManager kTracingManager{
+      tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+  settings.io_threads = 4;
+  settings.tracing_manager = &kTracingManager;
+
+  return std::make_shared<clients::http::Client>(
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{});
+}
+
+static clients::http::InstanceStatistics GetDestinationStats(
+    const clients::http::Client& client, const std::string& url) {
+  for (const auto& [stat_url, stat_ptr] : client.GetDestinationStatistics()) {
+    if (stat_url == url) return clients::http::InstanceStatistics{*stat_ptr};
+  }
+  return {};
+}
+
 UTEST(DestinationStatistics, Empty) {
   auto client = utest::CreateHttpClient();
 
@@ -134,4 +164,61 @@ UTEST(DestinationStatistics, Multiple) {
   }
 }
 
+UTEST(DestinationStatistics, ConnectionAffinity) {
+  constexpr std::size_t kRequests = 20;
+  const utest::SimpleServer http_server{&KeepAliveCallback};
+  clients::http::ClientSettings settings;
+  settings.connection_affinity = true;
+  auto client = CreateClient(std::move(settings));
+
+  const auto url = http_server.GetBaseUrl();
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    const auto response = client->CreateRequest()
+                              .get(url)
+                              .retry(1)
+                              .timeout(utest::kMaxTestWaitTime)
+                              .perform();
+    EXPECT_EQ(clients::http::Status::OK, response->status_code());
+  }
+
+  // Without the affinity the requests are spread over the 4 IO threads, and
+  // each thread has to establish its own connection
+  const auto stats = GetDestinationStats(*client, url);
+  EXPECT_EQ(utils::statistics::Rate{1}, stats.connections_new);
+  EXPECT_EQ(utils::statistics::Rate{kRequests - 1}, stats.connections_reused);
+}
+
+UTEST(DestinationStatistics, ConnectionsWarmup) {
+  std::atomic<std::size_t> head_requests{0};
+  const utest::SimpleServer http_server{
+      [&head_requests](const HttpRequest& request) {
+        if (request.rfind("HEAD ", 0) == 0) ++head_requests;
+        return KeepAliveCallback(request);
+      }};
+  const auto url = http_server.GetBaseUrl();
+
+  clients::http::ClientSettings settings;
+  settings.warmup_urls = {url};
+  settings.warmup_interval = utest::kMaxTestWaitTime;
+  auto client = CreateClient(std::move(settings));
+  client->StartConnectionsWarmup();
+
+  // one warm connection for each IO thread
+  while (GetDestinationStats(*client, url).connections_new.value < 4) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  EXPECT_EQ(4, head_requests.load());
+
+  const auto response = client->CreateRequest()
+                            .get(url)
+                            .retry(1)
+                            .timeout(utest::kMaxTestWaitTime)
+                            .perform();
+  EXPECT_EQ(clients::http::Status::OK, response->status_code());
+
+  const auto stats = GetDestinationStats(*client, url);
+  EXPECT_EQ(utils::statistics::Rate{4}, stats.connections_new);
+  EXPECT_EQ(utils::statistics::Rate{1}, stats.connections_reused);
+}
+
 USERVER_NAMESPACE_END
@@ -25,6 +25,20 @@ curl::easy& EasyWrapper::Easy() { return *easy_; }
 
 const curl::easy& EasyWrapper::Easy() const { return *easy_; }
 
+bool EasyWrapper::HasConnectionAffinity() const noexcept {
+  return client_.HasConnectionAffinity();
+}
+
+std::shared_ptr<std::atomic<std::size_t>> EasyWrapper::BindToOriginMulti(
+    const std::string& origin) {
+  return client_.BindToOriginMulti(*easy_, origin);
+}
+
+void EasyWrapper::RememberOriginMulti(
+    std::atomic<std::size_t>& multi_index) const {
+  client_.RememberOriginMulti(*easy_, multi_index);
+}
+
 }  // namespace clients::http::impl
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <string>
 
 #include <curl-ev/easy.hpp>
 
@@ -26,6 +29,19 @@ class EasyWrapper final {
   curl::easy& Easy();
   const curl::easy& Easy() const;
 
+  // Whether requests are routed to the multi with an idle connection to their
+  // origin, see clients::http::ConnectionAffinity
+  bool HasConnectionAffinity() const noexcept;
+
+  // Moves the easy to the multi that has recently finished a request to the
+  // origin. Returns the value to pass to RememberOriginMulti() after a
+  // successful request or nullptr if the origin is not tracked.
+  std::shared_ptr<std::atomic<std::size_t>> BindToOriginMulti(
+      const std::string& origin);
+
+  // Remembers the multi of the easy for the next requests to the origin
+  void RememberOriginMulti(std::atomic<std::size_t>& multi_index) const;
+
  private:
   std::shared_ptr<curl::easy> easy_;
   Client& client_;
@@ -0,0 +1,135 @@
+#include <userver/clients/http/hedged_request.hpp>
+
+#include <utility>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/error.hpp>
+#include <userver/utils/retry_budget.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace impl {
+
+namespace {
+
+bool IsRetriable(Status status) {
+  return static_cast<int>(status) >= 500;
+}
+
+}  // namespace
+
+HedgedRequestStrategy::HedgedRequestStrategy(RequestFactory factory,
+                                             Request&& first_request,
+                                             utils::RetryBudget* retry_budget)
+    : factory_(std::move(factory)),
+      first_request_(std::move(first_request)),
+      retry_budget_(retry_budget) {}
+
+HedgedRequestStrategy::HedgedRequestStrategy(
+    HedgedRequestStrategy&&) noexcept = default;
+
+HedgedRequestStrategy::~HedgedRequestStrategy() = default;
+
+std::optional<ResponseFuture> HedgedRequestStrategy::Create(
+    std::size_t attempt) {
+  if (attempt > 0 && retry_budget_ && !retry_budget_->CanRetry()) {
+    return std::nullopt;
+  }
+
+  auto request = first_request_ ? std::move(*first_request_) : factory_();
+  first_request_.reset();
+  return std::move(request).retry(1).async_perform();
+}
+
+std::optional<std::chrono::milliseconds> HedgedRequestStrategy::ProcessReply(
+    ResponseFuture&& future) {
+  try {
+    auto response = future.Get();
+    const bool is_retriable = IsRetriable(response->status_code());
+    reply_ = std::move(response);
+    if (!is_retriable) {
+      if (retry_budget_) retry_budget_->AccountOk();
+      return std::nullopt;
+    }
+  } catch (const CancelException&) {
+    error_ = std::current_exception();
+    return std::nullopt;
+  } catch (const TimeoutException&) {
+    error_ = std::current_exception();
+  } catch (const NetworkProblemException&) {
+    error_ = std::current_exception();
+  } catch (const DNSProblemException&) {
+    error_ = std::current_exception();
+  } catch (const BaseException&) {
+    error_ = std::current_exception();
+    return std::nullopt;
+  }
+
+  if (retry_budget_) retry_budget_->AccountFail();
+  return std::chrono::milliseconds{0};
+}
+
+std::optional<std::shared_ptr<Response>> HedgedRequestStrategy::ExtractReply() {
+  if (reply_) return std::move(reply_);
+  if (error_) std::rethrow_exception(error_);
+  return std::nullopt;
+}
+
+void HedgedRequestStrategy::Finish(ResponseFuture&& future) {
+  future.Cancel();
+}
+
+}  // namespace impl
+
+namespace {
+
+std::pair<impl::HedgedRequestStrategy, utils::hedging::HedgingSettings>
+PrepareHedging(const Client& client, const RequestFactory& factory,
+               const HedgedRequestSettings& settings) {
+  auto first_request = factory();
+
+  utils::hedging::HedgingSettings hedging_settings;
+  hedging_settings.max_attempts = settings.max_attempts;
+  hedging_settings.timeout_all = settings.timeout_all;
+  hedging_settings.hedging_delay =
+      settings.hedging_delay
+          ? *settings.hedging_delay
+          : client
+                .GetDestinationTimingPercentile(first_request.GetUrl(),
+                                                settings.delay_percentile)
+                .value_or(settings.fallback_delay);
+
+  return {impl::HedgedRequestStrategy{factory, std::move(first_request),
+                                      settings.retry_budget},
+          hedging_settings};
+}
+
+}  // namespace
+
+std::shared_ptr<Response> PerformHedged(const Client& client,
+                                        const RequestFactory& factory,
+                                        const HedgedRequestSettings& settings) {
+  auto [strategy, hedging_settings] =
+      PrepareHedging(client, factory, settings);
+  auto reply =
+      utils::hedging::HedgeRequest(std::move(strategy), hedging_settings);
+  if (!reply) {
+    throw TimeoutException("Hedged request timeout_all expired", {});
+  }
+  return std::move(*reply);
+}
+
+HedgedResponseFuture PerformHedgedAsync(const Client& client,
+                                        const RequestFactory& factory,
+                                        const HedgedRequestSettings& settings) {
+  auto [strategy, hedging_settings] =
+      PrepareHedging(client, factory, settings);
+  return utils::hedging::HedgeRequestAsync(std::move(strategy),
+                                           hedging_settings);
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
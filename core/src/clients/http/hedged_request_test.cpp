@@ -0,0 +1,127 @@
+#include <userver/clients/http/hedged_request.hpp>
+
+#include <atomic>
+#include <string>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/retry_budget.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr char kOkResponse[] =
+    "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 2\r\n\r\nok";
+constexpr char kErrorResponse[] =
+    "HTTP/1.1 500 Internal Server Error\r\nConnection: close\r\n"
+    "Content-Length: 0\r\n\r\n";
+
+// Responds to the first request with @a first_response or never if it is
+// empty, to the rest of the requests with 200
+class CountingServer final {
+ public:
+  explicit CountingServer(std::string first_response)
+      : first_response_(std::move(first_response)),
+        server_([this](const HttpRequest& request) {
+          return Handle(request);
+        }) {}
+
+  std::string GetUrl() const { return server_.GetBaseUrl() + "/hedged"; }
+
+  int GetRequestsCount() const { return requests_count_; }
+
+ private:
+  HttpResponse Handle(const HttpRequest& request) {
+    if (request.find("\r\n\r\n") == std::string::npos) {
+      return {{}, HttpResponse::kTryReadMore};
+    }
+
+    if (requests_count_++ == 0) {
+      if (first_response_.empty()) {
+        engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+      }
+      return {first_response_, HttpResponse::kWriteAndClose};
+    }
+    return {kOkResponse, HttpResponse::kWriteAndClose};
+  }
+
+  const std::string first_response_;
+  std::atomic<int> requests_count_{0};
+  const utest::SimpleServer server_;
+};
+
+clients::http::RequestFactory MakeFactory(clients::http::Client& client,
+                                          const std::string& url) {
+  return [&client, url] {
+    return client.CreateRequest().get(url).timeout(utest::kMaxTestWaitTime);
+  };
+}
+
+clients::http::HedgedRequestSettings MakeSettings(
+    std::chrono::milliseconds hedging_delay) {
+  clients::http::HedgedRequestSettings settings;
+  settings.max_attempts = 2;
+  settings.hedging_delay = hedging_delay;
+  settings.timeout_all = utest::kMaxTestWaitTime;
+  return settings;
+}
+
+}  // namespace
+
+UTEST(HttpClientHedged, SlowRequestIsHedged) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  const CountingServer server{""};
+
+  const auto response = clients::http::PerformHedged(
+      *http_client_ptr, MakeFactory(*http_client_ptr, server.GetUrl()),
+      MakeSettings(std::chrono::milliseconds{10}));
+  EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+  EXPECT_EQ(response->body_view(), "ok");
+  EXPECT_EQ(server.GetRequestsCount(), 2);
+}
+
+UTEST(HttpClientHedged, ServerErrorIsRetried) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  const CountingServer server{kErrorResponse};
+
+  auto future = clients::http::PerformHedgedAsync(
+      *http_client_ptr, MakeFactory(*http_client_ptr, server.GetUrl()),
+      MakeSettings(utest::kMaxTestWaitTime));
+  const auto response = future.Get();
+  ASSERT_TRUE(response);
+  EXPECT_EQ((*response)->status_code(), clients::http::Status::OK);
+  EXPECT_EQ(server.GetRequestsCount(), 2);
+}
+
+UTEST(HttpClientHedged, RetryBudget) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  const CountingServer server{kErrorResponse};
+
+  utils::RetryBudget budget;
+  for (int i = 0; i < 100; ++i) budget.AccountFail();
+  ASSERT_FALSE(budget.CanRetry());
+
+  auto settings = MakeSettings(std::chrono::milliseconds{10});
+  settings.retry_budget = &budget;
+  const auto response = clients::http::PerformHedged(
+      *http_client_ptr, MakeFactory(*http_client_ptr, server.GetUrl()),
+      settings);
+  EXPECT_EQ(response->status_code(),
+            clients::http::Status::InternalServerError);
+  EXPECT_EQ(server.GetRequestsCount(), 1);
+}
+
+UTEST(HttpClientHedged, NoTimingsWithoutRequests) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  EXPECT_FALSE(http_client_ptr->GetDestinationTimingPercentile(
+      "http://localhost:1/unknown", 95));
+}
+
+USERVER_NAMESPACE_END
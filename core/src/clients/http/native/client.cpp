@@ -0,0 +1,444 @@
+#include <userver/clients/http/native/client.hpp>
+
+#include <array>
+#include <charconv>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <llhttp.h>
+
+#include <userver/clients/dns/exception.hpp>
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/clients/http/error.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::native {
+namespace {
+
+constexpr std::size_t kReadBufferSize = 16 * 1024;
+
+using Stream = std::unique_ptr<engine::io::RwBase>;
+
+struct Url final {
+  bool is_tls{false};
+  std::string host;
+  std::uint16_t port{0};
+  std::string target;
+  std::string origin;
+};
+
+[[noreturn]] void ThrowBadUrl(std::string_view url, std::string_view reason) {
+  throw BadArgumentException(std::make_error_code(std::errc::invalid_argument),
+                             fmt::format("Bad URL: {}", reason), url, {});
+}
+
+Url ParseUrl(std::string_view url) {
+  Url result;
+
+  std::string_view rest = url;
+  if (rest.substr(0, 7) == "http://") {
+    rest.remove_prefix(7);
+    result.port = 80;
+  } else if (rest.substr(0, 8) == "https://") {
+    rest.remove_prefix(8);
+    result.is_tls = true;
+    result.port = 443;
+  } else {
+    ThrowBadUrl(url, "only http and https schemes are supported");
+  }
+
+  const auto authority_end = rest.find_first_of("/?#");
+  auto authority = rest.substr(0, authority_end);
+  rest = authority_end == std::string_view::npos ? std::string_view{}
+                                                 : rest.substr(authority_end);
+  if (authority.find('@') != std::string_view::npos) {
+    ThrowBadUrl(url, "user info is not supported");
+  }
+
+  std::string_view port;
+  if (!authority.empty() && authority.front() == '[') {
+    const auto bracket = authority.find(']');
+    if (bracket == std::string_view::npos) ThrowBadUrl(url, "unclosed '['");
+    result.host = std::string{authority.substr(1, bracket - 1)};
+    authority.remove_prefix(bracket + 1);
+    if (!authority.empty()) {
+      if (authority.front() != ':') ThrowBadUrl(url, "garbage after host");
+      port = authority.substr(1);
+    }
+  } else {
+    const auto colon = authority.rfind(':');
+    result.host = std::string{authority.substr(0, colon)};
+    if (colon != std::string_view::npos) port = authority.substr(colon + 1);
+  }
+  if (result.host.empty()) ThrowBadUrl(url, "empty host");
+
+  if (!port.empty()) {
+    const auto [ptr, ec] =
+        std::from_chars(port.data(), port.data() + port.size(), result.port);
+    if (ec != std::errc{} || ptr != port.data() + port.size() ||
+        result.port == 0) {
+      ThrowBadUrl(url, "invalid port");
+    }
+  }
+
+  const auto fragment = rest.find('#');
+  rest = rest.substr(0, fragment);
+  if (rest.empty() || rest.front() != '/') {
+    result.target = "/";
+  }
+  result.target.append(rest);
+
+  result.origin = fmt::format("{}://{}:{}", result.is_tls ? "https" : "http",
+                              result.host, result.port);
+  return result;
+}
+
+std::string SerializeRequest(const Request& request, const Url& url) {
+  namespace headers = USERVER_NAMESPACE::http::headers;
+
+  std::string data;
+  data.reserve(256 + request.body.size());
+
+  data.append(ToStringView(request.method));
+  data += ' ';
+  data += url.target;
+  data += " HTTP/1.1\r\n";
+
+  if (!request.headers.contains(headers::kHost)) {
+    data += "Host: ";
+    const bool is_ipv6 = url.host.find(':') != std::string::npos;
+    if (is_ipv6) data += '[';
+    data += url.host;
+    if (is_ipv6) data += ']';
+    data += ':';
+    data += std::to_string(url.port);
+    data += "\r\n";
+  }
+
+  const bool has_body = !request.body.empty() ||
+                        request.method == HttpMethod::kPost ||
+                        request.method == HttpMethod::kPut ||
+                        request.method == HttpMethod::kPatch;
+  if (has_body) {
+    data += "Content-Length: ";
+    data += std::to_string(request.body.size());
+    data += "\r\n";
+  }
+
+  for (const auto& [name, value] : request.headers) {
+    if (USERVER_NAMESPACE::utils::StrIcaseEqual{}(name,
+                                                  headers::kContentLength)) {
+      continue;
+    }
+    data += name;
+    data += ": ";
+    data += value;
+    data += "\r\n";
+  }
+  data += "\r\n";
+  data += request.body;
+  return data;
+}
+
+class ParseError final : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+class ResponseTooLarge final : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+class ResponseParser final {
+ public:
+  ResponseParser(Response& response, bool is_head, std::size_t max_body_size)
+      : response_(response), max_body_size_(max_body_size) {
+    llhttp_settings_init(&settings_);
+    settings_.on_header_field = &OnHeaderField;
+    settings_.on_header_value = &OnHeaderValue;
+    settings_.on_headers_complete =
+        is_head ? &OnHeadersCompleteSkipBody : &OnHeadersComplete;
+    settings_.on_body = &OnBody;
+    settings_.on_message_complete = &OnMessageComplete;
+
+    llhttp_init(&parser_, HTTP_RESPONSE, &settings_);
+    parser_.data = this;
+  }
+
+  ResponseParser(const ResponseParser&) = delete;
+  ResponseParser& operator=(const ResponseParser&) = delete;
+
+  void Feed(const char* data, std::size_t size) {
+    const auto error = llhttp_execute(&parser_, data, size);
+    CheckError(error);
+  }
+
+  /// Signals EOF, which completes responses without Content-Length
+  void Finish() {
+    const auto error = llhttp_finish(&parser_);
+    CheckError(error);
+    if (!is_complete_) throw ParseError("unexpected end of response");
+  }
+
+  bool IsComplete() const { return is_complete_; }
+
+  bool ShouldKeepAlive() const {
+    return is_complete_ && llhttp_should_keep_alive(&parser_);
+  }
+
+ private:
+  static ResponseParser& Self(llhttp_t* parser) {
+    return *static_cast<ResponseParser*>(parser->data);
+  }
+
+  static int OnHeaderField(llhttp_t* parser, const char* at, size_t length) {
+    auto& self = Self(parser);
+    if (self.is_in_value_) self.FlushHeader();
+    self.header_field_.append(at, length);
+    return 0;
+  }
+
+  static int OnHeaderValue(llhttp_t* parser, const char* at, size_t length) {
+    auto& self = Self(parser);
+    self.is_in_value_ = true;
+    self.header_value_.append(at, length);
+    return 0;
+  }
+
+  static int OnHeadersComplete(llhttp_t* parser) {
+    auto& self = Self(parser);
+    if (self.is_in_value_ || !self.header_field_.empty()) self.FlushHeader();
+    self.response_.SetStatusCode(
+        static_cast<Status>(llhttp_get_status_code(parser)));
+    return 0;
+  }
+
+  static int OnHeadersCompleteSkipBody(llhttp_t* parser) {
+    OnHeadersComplete(parser);
+    return 1;
+  }
+
+  static int OnBody(llhttp_t* parser, const char* at, size_t length) {
+    auto& self = Self(parser);
+    auto& body = self.response_.sink_string();
+    if (body.size() + length > self.max_body_size_) {
+      self.is_too_large_ = true;
+      return -1;
+    }
+    body.append(at, length);
+    return 0;
+  }
+
+  static int OnMessageComplete(llhttp_t* parser) {
+    Self(parser).is_complete_ = true;
+    // Bytes after the response are not expected, stop the parser
+    return HPE_PAUSED;
+  }
+
+  void FlushHeader() {
+    response_.headers().emplace(std::move(header_field_),
+                                std::move(header_value_));
+    header_field_.clear();
+    header_value_.clear();
+    is_in_value_ = false;
+  }
+
+  void CheckError(llhttp_errno_t error) const {
+    if (error == HPE_OK || (error == HPE_PAUSED && is_complete_)) return;
+    if (is_too_large_) {
+      throw ResponseTooLarge(
+          fmt::format("response body exceeds {} bytes", max_body_size_));
+    }
+    throw ParseError(llhttp_get_error_reason(&parser_));
+  }
+
+  Response& response_;
+  const std::size_t max_body_size_;
+
+  llhttp_settings_t settings_{};
+  llhttp_t parser_{};
+
+  std::string header_field_;
+  std::string header_value_;
+  bool is_in_value_{false};
+  bool is_complete_{false};
+  bool is_too_large_{false};
+};
+
+}  // namespace
+
+class Client::Impl final {
+ public:
+  Impl(clients::dns::Resolver& resolver, ClientSettings settings)
+      : resolver_(resolver), settings_(std::move(settings)) {}
+
+  std::shared_ptr<Response> Perform(const Request& request) {
+    const auto deadline = engine::Deadline::FromDuration(request.timeout);
+    const auto url = ParseUrl(request.url);
+    const auto data = SerializeRequest(request, url);
+
+    try {
+      if (auto stream = TakeIdleStream(url.origin)) {
+        auto response = TryPerform(std::move(stream), request, data, url,
+                                   deadline, /*is_reused=*/true);
+        if (response) return response;
+        LOG_DEBUG() << "Idle connection to " << url.origin
+                    << " is closed by peer, reconnecting";
+      }
+      return TryPerform(Connect(url, deadline), request, data, url, deadline,
+                        /*is_reused=*/false);
+    } catch (const engine::io::IoTimeout& ex) {
+      throw TimeoutException(
+          fmt::format("Timeout of {} to {}: {}", ToStringView(request.method),
+                      request.url, ex.what()),
+          {});
+    } catch (const engine::io::IoCancelled& ex) {
+      throw CancelException(
+          fmt::format("Request to {} is cancelled: {}", request.url,
+                      ex.what()),
+          {}, ErrorKind::kCancel);
+    } catch (const engine::io::TlsException& ex) {
+      throw SSLException(std::make_error_code(std::errc::protocol_error),
+                         ex.what(), request.url, {});
+    } catch (const engine::io::IoSystemError& ex) {
+      throw NetworkProblemException(ex.Code(), ex.what(), request.url, {});
+    } catch (const engine::io::IoException& ex) {
+      throw NetworkProblemException(
+          std::make_error_code(std::errc::io_error), ex.what(), request.url,
+          {});
+    } catch (const clients::dns::ResolverException& ex) {
+      throw DNSProblemException(
+          std::make_error_code(std::errc::host_unreachable), ex.what(),
+          request.url, {});
+    } catch (const ParseError& ex) {
+      throw NetworkProblemException(
+          std::make_error_code(std::errc::protocol_error),
+          fmt::format("Malformed response: {}", ex.what()), request.url, {});
+    } catch (const ResponseTooLarge& ex) {
+      throw TechnicalError(std::make_error_code(std::errc::message_size),
+                           ex.what(), request.url, {});
+    }
+  }
+
+ private:
+  /// @returns nullptr if a reused connection turned out to be closed before
+  /// any response bytes were received
+  std::shared_ptr<Response> TryPerform(Stream stream, const Request& request,
+                                       const std::string& data, const Url& url,
+                                       engine::Deadline deadline,
+                                       bool is_reused) {
+    auto response = std::make_shared<Response>();
+    ResponseParser parser{*response, request.method == HttpMethod::kHead,
+                          settings_.max_response_size};
+
+    bool has_received_data = false;
+    try {
+      const auto sent = stream->WriteAll(data.data(), data.size(), deadline);
+      if (sent != data.size()) {
+        if (is_reused) return nullptr;
+        throw engine::io::IoSystemError(
+            std::make_error_code(std::errc::connection_reset),
+            "Connection is closed while sending the request");
+      }
+
+      std::array<char, kReadBufferSize> buffer;  // NOLINT
+      while (!parser.IsComplete()) {
+        const auto read =
+            stream->ReadSome(buffer.data(), buffer.size(), deadline);
+        if (read == 0) {
+          if (is_reused && !has_received_data) return nullptr;
+          parser.Finish();
+          break;
+        }
+        has_received_data = true;
+        parser.Feed(buffer.data(), read);
+      }
+    } catch (const engine::io::IoSystemError&) {
+      if (is_reused && !has_received_data) return nullptr;
+      throw;
+    }
+
+    if (parser.ShouldKeepAlive()) {
+      ReturnIdleStream(url.origin, std::move(stream));
+    }
+    return response;
+  }
+
+  Stream Connect(const Url& url, engine::Deadline deadline) {
+    const auto addrs = resolver_.Resolve(url.host, deadline);
+
+    std::exception_ptr last_error;
+    for (auto addr : addrs) {
+      addr.SetPort(url.port);
+      try {
+        engine::io::Socket socket{addr.Domain(),
+                                  engine::io::SocketType::kStream};
+        socket.Connect(addr, deadline);
+        if (!url.is_tls) {
+          return std::make_unique<engine::io::Socket>(std::move(socket));
+        }
+        return std::make_unique<engine::io::TlsWrapper>(
+            engine::io::TlsWrapper::StartTlsClient(std::move(socket), url.host,
+                                                   deadline));
+      } catch (const engine::io::IoSystemError& ex) {
+        LOG_DEBUG() << "Failed to connect to " << addr << ": " << ex;
+        last_error = std::current_exception();
+      }
+    }
+
+    if (last_error) std::rethrow_exception(last_error);
+    throw clients::dns::NotResolvedException(
+        fmt::format("No addresses for '{}'", url.host));
+  }
+
+  Stream TakeIdleStream(const std::string& origin) {
+    const std::lock_guard lock{idle_mutex_};
+    const auto it = idle_streams_.find(origin);
+    if (it == idle_streams_.end() || it->second.empty()) return {};
+    auto stream = std::move(it->second.back());
+    it->second.pop_back();
+    return stream;
+  }
+
+  void ReturnIdleStream(const std::string& origin, Stream stream) {
+    const std::lock_guard lock{idle_mutex_};
+    auto& streams = idle_streams_[origin];
+    if (streams.size() < settings_.max_idle_connections_per_host) {
+      streams.push_back(std::move(stream));
+    }
+  }
+
+  clients::dns::Resolver& resolver_;
+  const ClientSettings settings_;
+
+  engine::Mutex idle_mutex_;
+  std::unordered_map<std::string, std::vector<Stream>> idle_streams_;
+};
+
+Client::Client(clients::dns::Resolver& resolver, ClientSettings settings)
+    : impl_(std::make_unique<Impl>(resolver, std::move(settings))) {}
+
+Client::~Client() = default;
+
+std::shared_ptr<Response> Client::Perform(const Request& request) {
+  return impl_->Perform(request);
+}
+
+}  // namespace clients::http::native
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/native/client.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/tracing/manager.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kTimeout = std::chrono::seconds{10};
+constexpr std::string_view kResponse =
+    "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok";
+
+void ServeKeepAlive(engine::io::Socket socket) {
+  std::array<char, 4096> buffer{};
+  std::string pending;
+  try {
+    while (true) {
+      const auto read =
+          socket.RecvSome(buffer.data(), buffer.size(),
+                          engine::Deadline::FromDuration(kTimeout));
+      if (read == 0) return;
+      pending.append(buffer.data(), read);
+
+      // Requests of the benchmark have no body
+      for (auto end = pending.find("\r\n\r\n"); end != std::string::npos;
+           end = pending.find("\r\n\r\n")) {
+        pending.erase(0, end + 4);
+        [[maybe_unused]] const auto sent =
+            socket.SendAll(kResponse.data(), kResponse.size(),
+                           engine::Deadline::FromDuration(kTimeout));
+      }
+    }
+  } catch (const engine::io::IoException&) {
+    // connection is closed by the client or the server is stopped
+  }
+}
+
+class KeepAliveServer final {
+ public:
+  KeepAliveServer()
+      : listener_(internal::net::IpVersion::kV4),
+        acceptor_(engine::AsyncNoSpan([this] { Accept(); })) {}
+
+  ~KeepAliveServer() {
+    acceptor_.SyncCancel();
+    for (auto& connection : connections_) connection.SyncCancel();
+  }
+
+  std::string GetUrl() const {
+    return fmt::format("http://127.0.0.1:{}/ping", listener_.Port());
+  }
+
+ private:
+  void Accept() {
+    try {
+      while (true) {
+        auto socket = listener_.socket.Accept({});
+        connections_.push_back(
+            engine::AsyncNoSpan(&ServeKeepAlive, std::move(socket)));
+      }
+    } catch (const engine::io::IoException&) {
+      // the server is stopped
+    }
+  }
+
+  internal::net::TcpListener listener_;
+  std::vector<engine::TaskWithResult<void>> connections_;
+  engine::TaskWithResult<void> acceptor_;
+};
+
+}  // namespace
+
+void http_client_curl_get(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const KeepAliveServer server;
+    const auto url = server.GetUrl();
+
+    const tracing::GenericTracingManager tracing_manager{
+        tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    clients::http::ClientSettings settings;
+    settings.io_threads = 1;
+    settings.tracing_manager = &tracing_manager;
+    clients::http::Client client{
+        std::move(settings), engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+    for ([[maybe_unused]] auto _ : state) {
+      auto response =
+          client.CreateRequest().get(url).timeout(kTimeout).perform();
+      benchmark::DoNotOptimize(response);
+    }
+  });
+}
+BENCHMARK(http_client_curl_get);
+
+void http_client_native_get(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const KeepAliveServer server;
+
+    clients::dns::Resolver resolver{engine::current_task::GetTaskProcessor(),
+                                    {}};
+    clients::http::native::Client client{resolver};
+
+    clients::http::native::Request request;
+    request.url = server.GetUrl();
+    request.timeout = kTimeout;
+
+    for ([[maybe_unused]] auto _ : state) {
+      auto response = client.Perform(request);
+      benchmark::DoNotOptimize(response);
+    }
+  });
+}
+BENCHMARK(http_client_native_get);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,136 @@
+#include <userver/clients/http/native/client.hpp>
+
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/http/predefined_header.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+namespace native = clients::http::native;
+
+constexpr http::headers::PredefinedHeader kRequestHeader{"X-Request"};
+
+class NativeClientFixture : public ::testing::Test {
+ protected:
+  NativeClientFixture()
+      : resolver_(engine::current_task::GetTaskProcessor(), {}),
+        client_(resolver_) {}
+
+  native::Client& GetClient() { return client_; }
+
+ private:
+  clients::dns::Resolver resolver_;
+  native::Client client_;
+};
+
+HttpResponse EchoKeepAliveCallback(const HttpRequest& request) {
+  const auto body_pos = request.find("\r\n\r\n");
+  if (body_pos == std::string::npos) return {{}, HttpResponse::kTryReadMore};
+
+  const auto body = request.substr(body_pos + 4);
+  const auto first_line = request.substr(0, request.find("\r\n"));
+  return {"HTTP/1.1 200 OK\r\nX-Request: " + first_line +
+              "\r\nContent-Length: " + std::to_string(body.size()) +
+              "\r\n\r\n" + body,
+          HttpResponse::kWriteAndContinue};
+}
+
+HttpResponse ChunkedCloseCallback(const HttpRequest&) {
+  return {"HTTP/1.1 404 Not Found\r\nTransfer-Encoding: chunked\r\n"
+          "Connection: close\r\n\r\n3\r\nabc\r\n2\r\nde\r\n0\r\n\r\n",
+          HttpResponse::kWriteAndClose};
+}
+
+HttpResponse SleepCallback(const HttpRequest&) {
+  engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+  return {"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+          HttpResponse::kWriteAndClose};
+}
+
+}  // namespace
+
+UTEST_F(NativeClientFixture, GetAndPost) {
+  const utest::SimpleServer server{&EchoKeepAliveCallback};
+
+  native::Request get;
+  get.url = server.GetBaseUrl() + "/path?arg=1";
+  get.timeout = utest::kMaxTestWaitTime;
+  const auto get_response = GetClient().Perform(get);
+  EXPECT_EQ(get_response->status_code(), clients::http::Status::OK);
+  EXPECT_EQ(get_response->headers()[kRequestHeader],
+            "GET /path?arg=1 HTTP/1.1");
+  EXPECT_EQ(get_response->body_view(), "");
+
+  native::Request post;
+  post.method = clients::http::HttpMethod::kPost;
+  post.url = server.GetBaseUrl();
+  post.body = "some data";
+  post.timeout = utest::kMaxTestWaitTime;
+  const auto post_response = GetClient().Perform(post);
+  EXPECT_EQ(post_response->headers()[kRequestHeader], "POST / HTTP/1.1");
+  EXPECT_EQ(post_response->body_view(), "some data");
+}
+
+UTEST_F(NativeClientFixture, KeepAlive) {
+  const utest::SimpleServer server{&EchoKeepAliveCallback};
+
+  native::Request request;
+  request.url = server.GetBaseUrl();
+  request.timeout = utest::kMaxTestWaitTime;
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(GetClient().Perform(request)->IsOk());
+  }
+  EXPECT_EQ(server.GetConnectionsOpenedCount(), 1);
+}
+
+UTEST_F(NativeClientFixture, Ipv6) {
+  const utest::SimpleServer server{&EchoKeepAliveCallback,
+                                   utest::SimpleServer::kTcpIpV6};
+
+  native::Request request;
+  request.url = server.GetBaseUrl();
+  request.timeout = utest::kMaxTestWaitTime;
+  EXPECT_TRUE(GetClient().Perform(request)->IsOk());
+}
+
+UTEST_F(NativeClientFixture, ChunkedAndClose) {
+  const utest::SimpleServer server{&ChunkedCloseCallback};
+
+  native::Request request;
+  request.url = server.GetBaseUrl();
+  request.timeout = utest::kMaxTestWaitTime;
+  for (int i = 0; i < 2; ++i) {
+    const auto response = GetClient().Perform(request);
+    EXPECT_EQ(response->status_code(), clients::http::Status::NotFound);
+    EXPECT_EQ(response->body_view(), "abcde");
+  }
+  EXPECT_EQ(server.GetConnectionsOpenedCount(), 2);
+}
+
+UTEST_F(NativeClientFixture, Errors) {
+  const utest::SimpleServer server{&SleepCallback};
+
+  native::Request request;
+  request.url = server.GetBaseUrl();
+  request.timeout = std::chrono::milliseconds{100};
+  UEXPECT_THROW(GetClient().Perform(request),
+                clients::http::TimeoutException);
+
+  request.url = "ftp://localhost/";
+  UEXPECT_THROW(GetClient().Perform(request),
+                clients::http::BadArgumentException);
+
+  request.url = "http://127.0.0.1:0/";
+  UEXPECT_THROW(GetClient().Perform(request),
+                clients::http::BadArgumentException);
+}
+
+USERVER_NAMESPACE_END
@@ -377,6 +377,20 @@ Request Request::data(std::string data) && {
   return std::move(this->data(std::move(data)));
 }
 
+Request& Request::data_stream(
+    const std::shared_ptr<concurrent::StringStreamQueue>& queue,
+    std::optional<std::size_t> content_length) & {
+  pimpl_->easy().add_header(kHeaderExpect, "",
+                            curl::easy::EmptyHeaderAction::kDoNotSend);
+  pimpl_->data_stream(queue, content_length);
+  return *this;
+}
+Request Request::data_stream(
+    const std::shared_ptr<concurrent::StringStreamQueue>& queue,
+    std::optional<std::size_t> content_length) && {
+  return std::move(this->data_stream(queue, content_length));
+}
+
 Request& Request::form(Form&& form) & {
   pimpl_->easy().set_http_post(std::move(form).GetNative());
   pimpl_->easy().add_header(kHeaderExpect, "",
@@ -502,7 +516,9 @@ Request& Request::method(HttpMethod method) & {
     case HttpMethod::kPatch:
       pimpl_->easy().set_custom_request(ToString(method));
       // ensure a body as we should send Content-Length for this method
-      if (!pimpl_->easy().has_post_data()) data({});
+      if (!pimpl_->easy().has_post_data() && !pimpl_->HasBodyStream()) {
+        data({});
+      }
       break;
   };
   return *this;
@@ -233,20 +233,21 @@ RequestState::RequestState(
   easy().set_header_data(this);
 
   // set autodecoding
-  static const bool curl_supports_zstd = [] {
+  static const std::string accept_encoding = [] {
+    [[maybe_unused]] const auto features =
+        curl_version_info(curl::native::CURLVERSION_NOW)->features;
+
+    std::string result;
 #ifdef CURL_VERSION_ZSTD
-    return curl_version_info(curl::native::CURLVERSION_NOW)->features &
-           CURL_VERSION_ZSTD;
-#else
-    return false;
+    if (features & CURL_VERSION_ZSTD) result += "zstd,";
+#endif
+#ifdef CURL_VERSION_BROTLI
+    if (features & CURL_VERSION_BROTLI) result += "br,";
 #endif
+    result += "gzip,deflate,identity";
+    return result;
   }();
-
-  if (curl_supports_zstd) {
-    easy().set_accept_encoding("zstd,gzip,deflate,identity");
-  } else {
-    easy().set_accept_encoding("gzip,deflate,identity");
-  }
+  easy().set_accept_encoding(accept_encoding);
 }
 
 RequestState::~RequestState() {
@@ -255,6 +256,21 @@ RequestState::~RequestState() {
   UASSERT(!ec);
 }
 
+void RequestState::data_stream(const std::shared_ptr<Queue>& queue,
+                               std::optional<std::size_t> content_length) {
+  body_source_ = std::make_shared<StreamedBodySource>(queue);
+
+  // with no post fields curl reads the body with the read callback
+  easy().set_post_fields(static_cast<void*>(nullptr));
+  easy().set_post(true);
+  // unknown size results in Transfer-Encoding: chunked
+  easy().set_post_field_size_large(
+      content_length ? static_cast<curl::native::curl_off_t>(*content_length)
+                     : -1);
+  easy().set_read_function(&StreamedBodySource::ReadFunction);
+  easy().set_read_data(body_source_.get());
+}
+
 void RequestState::follow_redirects(bool follow) {
   easy().set_follow_location(follow);
   easy().set_post_redir(static_cast<long>(follow));
@@ -468,6 +484,8 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
   auto& span = holder->span_storage_->Get();
   auto& easy = holder->easy();
 
+  if (holder->body_source_) holder->body_source_->Abort();
+
   // TODO don't swallow errors, report them to StreamedResponse
   auto* stream_data = std::get_if<StreamData>(&holder->data_);
   if (stream_data && !stream_data->headers_promise_set.exchange(true)) {
@@ -486,8 +504,14 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
 
   holder->AccountResponse(err);
   const auto sockets = easy.get_num_connects();
-  holder->WithRequestStats(
-      [sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
+  holder->WithRequestStats([sockets, err](RequestStats& stats) {
+    stats.AccountOpenSockets(sockets);
+    if (!err) stats.AccountConnectionReuse(sockets == 0);
+  });
+
+  if (holder->origin_multi_index_ && !err) {
+    holder->easy_.RememberOriginMulti(*holder->origin_multi_index_);
+  }
 
   span.AddTag(tracing::kAttempts, holder->retry_.current);
   if (holder->deadline_propagation_config_.update_header) {
@@ -743,6 +767,21 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
 
   plugin_pipeline_.HookPerformRequest(*this);
 
+  if (body_source_) {
+    // the consumed part of the body stream can not be sent again
+    retry_.retries = 1;
+    if (retry_.current == 1) {
+      body_source_->Start(easy(),
+                          engine::Deadline::FromDuration(original_timeout_));
+    }
+  }
+
+  if (retry_.current == 1 && easy_.HasConnectionAffinity()) {
+    const auto origin = GetConnectionOrigin();
+    origin_multi_index_ =
+        origin.empty() ? nullptr : easy_.BindToOriginMulti(origin);
+  }
+
   if (resolver_ && retry_.current == 1) {
     engine::AsyncNoSpan([this, holder = shared_from_this(),
                          handler = std::move(handler)]() mutable {
@@ -1080,6 +1119,20 @@ void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
                      fmt::to_string(fmt::join(addr_strings, ",")));
 }
 
+std::string RequestState::GetConnectionOrigin() {
+  try {
+    const MaybeOwnedUrl target{proxy_url_, easy()};
+    const auto scheme = target.Get().GetSchemePtr();
+    const auto host = target.Get().GetHostPtr();
+    const auto port = target.Get().GetPortPtr();
+    return fmt::format("{}://{}:{}", scheme.get(), host.get(), port.get());
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_WARNING() << "Failed to get the origin of '"
+                          << GetLoggedOriginalUrl() << "': " << ex;
+    return {};
+  }
+}
+
 void RequestState::SetTracingManager(const tracing::TracingManagerBase& m) {
   tracing_manager_ = m;
 }
@@ -29,6 +29,7 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/streamed_body_source.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/helpers.hpp>
 #include <engine/ev/watcher/timer_watcher.hpp>
@@ -62,6 +63,11 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
       utils::impl::SourceLocation location =
           utils::impl::SourceLocation::Current());
 
+  /// send the body from the queue, see Request::data_stream
+  void data_stream(const std::shared_ptr<Queue>& queue,
+                   std::optional<std::size_t> content_length);
+  bool HasBodyStream() const noexcept { return body_source_ != nullptr; }
+
   /// set redirect flags
   void follow_redirects(bool follow);
   /// set verify flags
@@ -185,8 +191,14 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   void ResolveTargetAddress(clients::dns::Resolver& resolver);
 
+  /// scheme, host and port of the server or proxy to connect to, empty on
+  /// failure
+  std::string GetConnectionOrigin();
+
   /// curl handler wrapper
   impl::EasyWrapper easy_;
+  /// multi to remember after a successful request, see ConnectionAffinity
+  std::shared_ptr<std::atomic<std::size_t>> origin_multi_index_;
   RequestStats stats_;
   std::shared_ptr<RequestStats> dest_req_stats_;
   CancellationPolicy cancellation_policy_{CancellationPolicy::kCancel};
@@ -254,6 +266,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   };
 
   std::variant<FullBufferedData, StreamData> data_;
+
+  std::shared_ptr<StreamedBodySource> body_source_;
 };
 
 }  // namespace clients::http
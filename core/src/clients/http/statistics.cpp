@@ -77,6 +77,11 @@ void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
   stats_->socket_open_ += utils::statistics::Rate{sockets};
 }
 
+void RequestStats::AccountConnectionReuse(bool reused) noexcept {
+  UASSERT(stats_);
+  ++(reused ? stats_->connections_reused_ : stats_->connections_new_);
+}
+
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
   UASSERT(stats_);
   ++stats_->timeout_updated_by_deadline_;
@@ -156,6 +161,22 @@ void Statistics::AccountError(ErrorGroup error) {
 
 void Statistics::AccountStatus(int code) { reply_status_.Account(code); }
 
+std::optional<std::chrono::milliseconds> Statistics::GetRecentTimingPercentile(
+    double percent) const {
+  const auto now = utils::datetime::SteadyClock::now().time_since_epoch();
+  auto update_time = recent_timings_update_time_.load();
+  if (now - utils::datetime::SteadyClock::duration{update_time} >=
+          kTimingPercentileTtl &&
+      recent_timings_update_time_.compare_exchange_strong(update_time,
+                                                          now.count())) {
+    recent_timings_.Assign(timings_percentile_.GetStatsForPeriod());
+  }
+
+  const auto timings = recent_timings_.Read();
+  if (timings->Count() == 0) return std::nullopt;
+  return std::chrono::milliseconds{timings->GetPercentile(percent)};
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const DestinationStatisticsView& view) {
   const auto& stats = view.stats;
@@ -178,6 +199,10 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
 
   writer["sockets"]["open"] = stats.multi.socket_open;
+
+  // reuse rate is reused / (reused + new)
+  writer["connections"]["reused"] = stats.connections_reused;
+  writer["connections"]["new"] = stats.connections_new;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -214,6 +239,8 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       last_time_to_start_us(other.last_time_to_start_us_.load()),
       timings_percentile(other.timings_percentile_.GetStatsForPeriod()),
       retries(other.retries_.Load()),
+      connections_reused(other.connections_reused_.Load()),
+      connections_new(other.connections_new_.Load()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.Load()),
       cancelled_by_deadline(other.cancelled_by_deadline_.Load()),
       reply_status(other.reply_status_) {
@@ -247,6 +274,8 @@ InstanceStatistics& InstanceStatistics::operator+=(
     error_count[i] += stat.error_count[i];
   }
   retries += stat.retries;
+  connections_reused += stat.connections_reused;
+  connections_new += stat.connections_new;
 
   timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
   cancelled_by_deadline += stat.cancelled_by_deadline;
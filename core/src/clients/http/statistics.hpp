@@ -2,9 +2,11 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate.hpp>
@@ -38,6 +40,10 @@ class RequestStats final {
 
   void AccountOpenSockets(size_t sockets) noexcept;
 
+  // Accounts a successful request that either reused an idle connection or
+  // had to open a new one
+  void AccountConnectionReuse(bool reused) noexcept;
+
   void AccountTimeoutUpdatedByDeadline() noexcept;
   void AccountCancelledByDeadline() noexcept;
 
@@ -96,6 +102,13 @@ class Statistics {
 
   void AccountStatus(int);
 
+  // Timing percentile of the requests finished recently, std::nullopt if
+  // there were none. Recomputed at most once per kTimingPercentileTtl.
+  std::optional<std::chrono::milliseconds> GetRecentTimingPercentile(
+      double percent) const;
+
+  static constexpr std::chrono::seconds kTimingPercentileTtl{1};
+
  private:
   std::atomic<uint64_t> easy_handles_{0};
   std::atomic<uint64_t> last_time_to_start_us_{0};
@@ -105,10 +118,17 @@ class Statistics {
   std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
   utils::statistics::RateCounter retries_;
   utils::statistics::RateCounter socket_open_{0};
+  utils::statistics::RateCounter connections_reused_;
+  utils::statistics::RateCounter connections_new_;
   utils::statistics::RateCounter timeout_updated_by_deadline_;
   utils::statistics::RateCounter cancelled_by_deadline_;
   utils::statistics::HttpCodes reply_status_;
 
+  // Aggregating the recent period is too expensive to do for each request
+  mutable rcu::Variable<Percentile> recent_timings_;
+  mutable std::atomic<utils::datetime::SteadyClock::rep>
+      recent_timings_update_time_{0};
+
   friend struct InstanceStatistics;
   friend class RequestStats;
 };
@@ -131,6 +151,8 @@ struct InstanceStatistics {
   Percentile timings_percentile;
   std::array<utils::statistics::Rate, Statistics::kErrorGroupCount> error_count;
   utils::statistics::Rate retries{0};
+  utils::statistics::Rate connections_reused;
+  utils::statistics::Rate connections_new;
 
   utils::statistics::Rate timeout_updated_by_deadline;
   utils::statistics::Rate cancelled_by_deadline;
@@ -0,0 +1,119 @@
+#include <clients/http/streamed_body_source.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include <curl-ev/easy.hpp>
+#include <engine/ev/thread_control.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+StreamedBodySource::StreamedBodySource(const std::shared_ptr<Queue>& queue)
+    : consumer_(queue->GetConsumer()) {}
+
+void StreamedBodySource::Start(curl::easy& easy, engine::Deadline deadline) {
+  easy_ = easy.shared_from_this();
+  engine::AsyncNoSpan([self = shared_from_this(), deadline] {
+    self->Pump(deadline);
+  }).Detach();
+}
+
+void StreamedBodySource::Abort() {
+  {
+    const std::lock_guard lock{mutex_};
+    is_aborted_ = true;
+  }
+  chunk_sent_.Send();
+}
+
+size_t StreamedBodySource::ReadFunction(void* ptr, size_t size, size_t nmemb,
+                                        void* userdata) noexcept {
+  auto& self = *static_cast<StreamedBodySource*>(userdata);
+  const auto buffer_size = size * nmemb;
+
+  std::size_t copied = 0;
+  bool is_chunk_sent = false;
+  {
+    const std::lock_guard lock{self.mutex_};
+    if (self.chunk_offset_ < self.chunk_.size()) {
+      copied = std::min(buffer_size, self.chunk_.size() - self.chunk_offset_);
+      std::memcpy(ptr, self.chunk_.data() + self.chunk_offset_, copied);
+      self.chunk_offset_ += copied;
+      is_chunk_sent = self.chunk_offset_ == self.chunk_.size();
+    } else if (self.is_failed_) {
+      return CURL_READFUNC_ABORT;
+    } else if (self.is_finished_) {
+      return 0;
+    } else {
+      self.is_paused_ = true;
+      return CURL_READFUNC_PAUSE;
+    }
+  }
+
+  if (is_chunk_sent) self.chunk_sent_.Send();
+  return copied;
+}
+
+void StreamedBodySource::Pump(engine::Deadline deadline) {
+  // Producers are not suspended on a full queue after the pump is done
+  const auto consumer = std::move(consumer_);
+
+  std::string chunk;
+  while (consumer.Pop(chunk, deadline)) {
+    if (chunk.empty()) continue;
+
+    bool was_paused = false;
+    {
+      const std::lock_guard lock{mutex_};
+      if (is_aborted_) return;
+      std::swap(chunk_, chunk);
+      chunk_offset_ = 0;
+      was_paused = std::exchange(is_paused_, false);
+    }
+    Resume(was_paused);
+
+    if (!chunk_sent_.WaitForEventUntil(deadline)) break;
+  }
+
+  bool was_paused = false;
+  {
+    const std::lock_guard lock{mutex_};
+    if (is_aborted_) return;
+    // Pop() fails without the deadline or cancellation only if there are no
+    // more producers, i.e. the body is complete
+    if (deadline.IsReached() || engine::current_task::ShouldCancel()) {
+      LOG_WARNING() << "Streamed request body is not completed in time";
+      is_failed_ = true;
+    } else {
+      is_finished_ = true;
+    }
+    chunk_.clear();
+    chunk_offset_ = 0;
+    was_paused = std::exchange(is_paused_, false);
+  }
+  Resume(was_paused);
+}
+
+void StreamedBodySource::Resume(bool is_paused) {
+  if (!is_paused) return;
+
+  easy_->GetThreadControl().RunInEvLoopAsync([self = shared_from_this()] {
+    {
+      // The request is finished and the easy handle may already serve
+      // another one
+      const std::lock_guard lock{self->mutex_};
+      if (self->is_aborted_) return;
+    }
+    self->easy_->unpause();
+  });
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
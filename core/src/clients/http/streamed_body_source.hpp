@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace curl {
+class easy;
+}  // namespace curl
+
+namespace clients::http {
+
+/// Feeds the curl read callback of a request with the chunks of a queue.
+///
+/// A detached coroutine pops the chunks one at a time and hands them over to
+/// the curl thread. The next chunk is popped only after the previous one is
+/// sent, so the producer of the queue is suspended once the queue is full.
+/// While there is no chunk to send the transfer is paused, the coroutine
+/// resumes it on the next chunk.
+class StreamedBodySource final
+    : public std::enable_shared_from_this<StreamedBodySource> {
+ public:
+  using Queue = concurrent::StringStreamQueue;
+
+  explicit StreamedBodySource(const std::shared_ptr<Queue>& queue);
+
+  StreamedBodySource(const StreamedBodySource&) = delete;
+  StreamedBodySource& operator=(const StreamedBodySource&) = delete;
+
+  /// Starts popping the chunks, the body must be sent before the deadline
+  void Start(curl::easy& easy, engine::Deadline deadline);
+
+  /// Stops popping the chunks after the request is finished. Lets the
+  /// producer of the queue know that the data is not needed any more.
+  void Abort();
+
+  /// curl read callback, @a userdata is StreamedBodySource*
+  static size_t ReadFunction(void* ptr, size_t size, size_t nmemb,
+                             void* userdata) noexcept;
+
+ private:
+  void Pump(engine::Deadline deadline);
+  void Resume(bool is_paused);
+
+  Queue::Consumer consumer_;
+  std::shared_ptr<curl::easy> easy_;
+
+  // Protects the handover between the coroutine and the curl thread
+  std::mutex mutex_;
+  std::string chunk_;
+  std::size_t chunk_offset_{0};
+  bool is_paused_{false};
+  bool is_finished_{false};
+  bool is_failed_{false};
+  bool is_aborted_{false};
+
+  engine::SingleConsumerEvent chunk_sent_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,100 @@
+#include <userver/clients/sharding/balancer.hpp>
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::sharding {
+
+MembershipSource MakeDnsMembershipSource(clients::dns::Resolver& resolver,
+                                         std::string host, std::uint16_t port,
+                                         std::chrono::milliseconds timeout) {
+  return [&resolver, host = std::move(host), port, timeout] {
+    auto addrs =
+        resolver.Resolve(host, engine::Deadline::FromDuration(timeout));
+    std::vector<std::string> endpoints;
+    endpoints.reserve(addrs.size());
+    for (auto& addr : addrs) {
+      addr.SetPort(port);
+      endpoints.push_back(fmt::to_string(addr));
+    }
+    return endpoints;
+  };
+}
+
+ConsistentHashBalancer::ConsistentHashBalancer(Settings settings)
+    : settings_(settings),
+      table_(std::vector<std::string>{}, settings.table_size) {}
+
+ConsistentHashBalancer::~ConsistentHashBalancer() { StopRefresh(); }
+
+std::string ConsistentHashBalancer::Pick(std::string_view key) const {
+  const auto table = table_.Read();
+  if (table->IsEmpty()) {
+    throw NoBackendsError("No backends to pick for the consistent hashing");
+  }
+  return table->Pick(key);
+}
+
+std::vector<std::string> ConsistentHashBalancer::PickReplicas(
+    std::string_view key, std::size_t count) const {
+  const auto table = table_.Read();
+  return table->PickReplicas(key, count);
+}
+
+std::vector<std::string> ConsistentHashBalancer::GetBackends() const {
+  const auto table = table_.Read();
+  return table->GetBackends();
+}
+
+void ConsistentHashBalancer::UpdateMembership(
+    std::vector<std::string> backends) {
+  std::sort(backends.begin(), backends.end());
+  backends.erase(std::unique(backends.begin(), backends.end()),
+                 backends.end());
+  {
+    const auto current = table_.Read();
+    if (backends == current->GetBackends()) return;
+  }
+
+  MaglevTable table{std::move(backends), settings_.table_size};
+  LOG_INFO() << "Consistent hashing backends changed to "
+             << fmt::to_string(fmt::join(table.GetBackends(), ", "));
+  table_.Assign(std::move(table));
+}
+
+void ConsistentHashBalancer::StartRefresh(std::string name,
+                                          MembershipSource source,
+                                          std::chrono::milliseconds period) {
+  StopRefresh();
+  name_ = std::move(name);
+  source_ = std::move(source);
+  UpdateMembership(source_());
+  refresh_task_.Start(name_, period, [this] { Refresh(); });
+}
+
+void ConsistentHashBalancer::StopRefresh() noexcept { refresh_task_.Stop(); }
+
+void ConsistentHashBalancer::Refresh() {
+  try {
+    auto backends = source_();
+    if (backends.empty()) {
+      LOG_WARNING() << "No backends from the membership source of '" << name_
+                    << "', keeping the previous ones";
+      return;
+    }
+    UpdateMembership(std::move(backends));
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to refresh the backends of '" << name_
+                  << "', keeping the previous ones: " << e;
+  }
+}
+
+}  // namespace clients::sharding
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <userver/clients/sharding/balancer.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::sharding::ConsistentHashBalancer;
+
+}  // namespace
+
+UTEST(ConsistentHashBalancer, UpdateMembership) {
+  ConsistentHashBalancer balancer;
+  UEXPECT_THROW(balancer.Pick("key"), clients::sharding::NoBackendsError);
+
+  balancer.UpdateMembership({"b:80", "a:80", "b:80"});
+  EXPECT_EQ(balancer.GetBackends(),
+            (std::vector<std::string>{"a:80", "b:80"}));
+  const auto backend = balancer.Pick("key");
+  EXPECT_EQ(balancer.PickReplicas("key", 2).front(), backend);
+
+  balancer.UpdateMembership({backend});
+  EXPECT_EQ(balancer.Pick("key"), backend);
+}
+
+UTEST(ConsistentHashBalancer, Refresh) {
+  std::atomic<int> calls{0};
+  ConsistentHashBalancer balancer;
+  balancer.StartRefresh(
+      "sharding-test",
+      [&calls]() -> std::vector<std::string> {
+        switch (calls++) {
+          case 0:
+            return {"a:80"};
+          case 1:
+            throw std::runtime_error("discovery is down");
+          case 2:
+            return {};
+          default:
+            return {"a:80", "b:80"};
+        }
+      },
+      std::chrono::milliseconds{1});
+  EXPECT_EQ(balancer.GetBackends(), std::vector<std::string>{"a:80"});
+
+  while (calls < 5) engine::SleepFor(std::chrono::milliseconds{1});
+  balancer.StopRefresh();
+  // Failures and empty results keep the previous backends
+  EXPECT_EQ(balancer.GetBackends(),
+            (std::vector<std::string>{"a:80", "b:80"}));
+}
+
+USERVER_NAMESPACE_END
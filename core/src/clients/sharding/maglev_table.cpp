@@ -0,0 +1,122 @@
+#include <userver/clients/sharding/maglev_table.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::sharding {
+
+namespace {
+
+constexpr std::uint64_t kOffsetSeed = 0;
+constexpr std::uint64_t kSkipSeed = 1;
+constexpr std::uint64_t kKeySeed = 2;
+
+constexpr auto kNoBackend = static_cast<std::uint32_t>(-1);
+
+// FNV-1a with a SplitMix64 finalizer. std::hash differs between the standard
+// libraries and processes, the backend choice must not.
+std::uint64_t StableHash(std::string_view data, std::uint64_t seed) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  hash ^= seed * 0x9E3779B97F4A7C15ULL;
+  for (const char c : data) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  hash ^= hash >> 30;
+  hash *= 0xBF58476D1CE4E5B9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94D049BB133111EBULL;
+  hash ^= hash >> 31;
+  return hash;
+}
+
+bool IsPrime(std::size_t value) {
+  if (value < 2) return false;
+  for (std::size_t divisor = 2; divisor * divisor <= value; ++divisor) {
+    if (value % divisor == 0) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+MaglevTable::MaglevTable(std::vector<std::string> backends,
+                         std::size_t table_size)
+    : backends_(std::move(backends)) {
+  if (!IsPrime(table_size)) {
+    throw std::invalid_argument(
+        fmt::format("Maglev table size {} is not a prime", table_size));
+  }
+  std::sort(backends_.begin(), backends_.end());
+  backends_.erase(std::unique(backends_.begin(), backends_.end()),
+                  backends_.end());
+  if (backends_.size() > table_size) {
+    throw std::invalid_argument(
+        fmt::format("Maglev table size {} is less than the {} backends",
+                    table_size, backends_.size()));
+  }
+  if (backends_.empty()) return;
+
+  // Every backend fills the free entries in the order of its own
+  // permutation of the table, in turns
+  const auto size = backends_.size();
+  std::vector<std::uint64_t> offsets(size);
+  std::vector<std::uint64_t> skips(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    offsets[i] = StableHash(backends_[i], kOffsetSeed) % table_size;
+    skips[i] = StableHash(backends_[i], kSkipSeed) % (table_size - 1) + 1;
+  }
+
+  lookup_.assign(table_size, kNoBackend);
+  std::vector<std::uint64_t> next(size, 0);
+  std::size_t filled = 0;
+  while (true) {
+    for (std::size_t i = 0; i < size; ++i) {
+      auto entry = (offsets[i] + next[i] * skips[i]) % table_size;
+      while (lookup_[entry] != kNoBackend) {
+        ++next[i];
+        entry = (offsets[i] + next[i] * skips[i]) % table_size;
+      }
+      lookup_[entry] = static_cast<std::uint32_t>(i);
+      ++next[i];
+      if (++filled == table_size) return;
+    }
+  }
+}
+
+const std::string& MaglevTable::Pick(std::string_view key) const {
+  UASSERT_MSG(!IsEmpty(), "No backends to pick from");
+  return backends_[lookup_[StableHash(key, kKeySeed) % lookup_.size()]];
+}
+
+std::vector<std::string> MaglevTable::PickReplicas(std::string_view key,
+                                                   std::size_t count) const {
+  std::vector<std::string> result;
+  count = std::min(count, backends_.size());
+  if (count == 0) return result;
+  result.reserve(count);
+
+  // The following entries of the table are taken by the other backends in
+  // a pseudo-random order
+  std::vector<bool> picked(backends_.size(), false);
+  auto entry = StableHash(key, kKeySeed) % lookup_.size();
+  while (result.size() < count) {
+    const auto backend = lookup_[entry];
+    if (!picked[backend]) {
+      picked[backend] = true;
+      result.push_back(backends_[backend]);
+    }
+    entry = (entry + 1) % lookup_.size();
+  }
+  return result;
+}
+
+}  // namespace clients::sharding
+
+USERVER_NAMESPACE_END
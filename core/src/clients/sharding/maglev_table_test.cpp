@@ -0,0 +1,95 @@
+#include <userver/clients/sharding/maglev_table.hpp>
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::sharding::MaglevTable;
+
+constexpr std::size_t kKeys = 100'000;
+
+std::vector<std::string> MakeBackends(std::size_t count) {
+  std::vector<std::string> backends;
+  for (std::size_t i = 0; i < count; ++i) {
+    backends.push_back(fmt::format("backend-{}:8080", i));
+  }
+  return backends;
+}
+
+std::map<std::string, std::size_t> CountKeys(const MaglevTable& table) {
+  std::map<std::string, std::size_t> counts;
+  for (std::size_t i = 0; i < kKeys; ++i) {
+    ++counts[table.Pick(fmt::format("key-{}", i))];
+  }
+  return counts;
+}
+
+}  // namespace
+
+TEST(MaglevTable, Balance) {
+  const MaglevTable table{MakeBackends(10)};
+  const auto counts = CountKeys(table);
+  ASSERT_EQ(counts.size(), 10);
+  for (const auto& [backend, count] : counts) {
+    EXPECT_NEAR(count, kKeys / 10, kKeys / 100) << backend;
+  }
+}
+
+TEST(MaglevTable, Stable) {
+  auto backends = MakeBackends(5);
+  const MaglevTable table{backends};
+  std::reverse(backends.begin(), backends.end());
+  backends.push_back(backends.front());
+  const MaglevTable reordered{backends};
+
+  EXPECT_EQ(table.GetBackends(), reordered.GetBackends());
+  for (std::size_t i = 0; i < 1000; ++i) {
+    const auto key = fmt::format("key-{}", i);
+    EXPECT_EQ(table.Pick(key), reordered.Pick(key));
+  }
+}
+
+TEST(MaglevTable, MinimalDisruption) {
+  auto backends = MakeBackends(10);
+  const MaglevTable table{backends};
+  backends.pop_back();
+  const MaglevTable removed{backends};
+
+  std::size_t moved = 0;
+  for (std::size_t i = 0; i < kKeys; ++i) {
+    const auto key = fmt::format("key-{}", i);
+    const auto& before = table.Pick(key);
+    const auto& after = removed.Pick(key);
+    if (before == after) continue;
+    // Only the keys of the removed backend have to move
+    if (before != "backend-9:8080") ++moved;
+  }
+  EXPECT_LT(moved, kKeys / 50);
+}
+
+TEST(MaglevTable, PickReplicas) {
+  const MaglevTable table{MakeBackends(3)};
+  const auto replicas = table.PickReplicas("key", 5);
+  ASSERT_EQ(replicas.size(), 3);
+  EXPECT_EQ(replicas.front(), table.Pick("key"));
+  auto sorted = replicas;
+  std::sort(sorted.begin(), sorted.end());
+  EXPECT_EQ(sorted, table.GetBackends());
+
+  EXPECT_TRUE(MaglevTable{}.PickReplicas("key", 2).empty());
+}
+
+TEST(MaglevTable, InvalidSize) {
+  EXPECT_THROW(MaglevTable(MakeBackends(1), 100), std::invalid_argument);
+  EXPECT_THROW(MaglevTable(MakeBackends(5), 3), std::invalid_argument);
+  EXPECT_NO_THROW(MaglevTable(MakeBackends(3), 3));
+}
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <userver/congestion_control/component.hpp>
 #include <userver/server/component.hpp>
 #include <userver/server/handlers/auth/auth_checker_settings_component.hpp>
+#include <userver/server/handlers/cpu_profiler.hpp>
 #include <userver/server/handlers/dns_client_control.hpp>
 #include <userver/server/handlers/dynamic_debug_log.hpp>
 #include <userver/server/handlers/implicit_options.hpp>
@@ -22,6 +23,7 @@ namespace components {
 ComponentList CommonServerComponentList() {
   return components::ComponentList()
       .Append<components::Server>()
+      .Append<server::handlers::CpuProfiler>()
       .Append<server::handlers::DnsClientControl>()
       .Append<server::handlers::DynamicDebugLog>()
       .Append<server::handlers::ImplicitOptions>()
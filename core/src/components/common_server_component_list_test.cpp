@@ -200,6 +200,15 @@ components_manager:
         method: POST
         task_processor: monitor-task-processor
 # /// [Sample handler jemalloc component config]
+# /// [Sample handler cpu profiler component config]
+# yaml
+    handler-cpu-profiler:
+        path: /service/cpu-profiler/{command}
+        method: POST
+        task_processor: monitor-task-processor
+        frequency: 99
+        autostart: false
+# /// [Sample handler cpu profiler component config]
 # /// [Sample handler dns client control component config]
 # yaml
     handler-dns-client-control:
@@ -1,6 +1,7 @@
 #include <components/component_context_impl.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <queue>
 
 #include <fmt/format.h>
@@ -27,6 +28,7 @@ const std::string kOnAllComponentsLoadedRootName = "all_components_loaded";
 const std::string kClearComponentsRootName = "clear_components";
 
 const std::chrono::seconds kPrintAddingComponentsPeriod{10};
+constexpr std::size_t kLoadTimelineMaxComponents = 20;
 
 template <class Container>
 std::string JoinNamesFromInfo(const Container& container,
@@ -118,7 +120,14 @@ RawComponentBase* ComponentContextImpl::AddComponent(
     throw std::runtime_error("trying to add component " + std::string{name} +
                              " multiple times");
 
+  const auto start = std::chrono::steady_clock::now();
   component_info.SetComponent(factory(context));
+  {
+    auto data = shared_data_.Lock();
+    data->load_timeline.push_back(
+        {component_info.Name(), start, std::chrono::steady_clock::now()});
+  }
+
   auto* component = component_info.GetComponent();
   if (component) {
     // Call the following command on logs to get the component dependencies:
@@ -133,6 +142,7 @@ RawComponentBase* ComponentContextImpl::AddComponent(
 
 void ComponentContextImpl::OnAllComponentsLoaded() {
   StopPrintAddingComponentsTask();
+  PrintLoadTimeline();
   tracing::Span span(kOnAllComponentsLoadedRootName);
   return ProcessAllComponentLifetimeStageSwitchings(
       {impl::ComponentLifetimeStage::kRunning,
@@ -544,6 +554,47 @@ void ComponentContextImpl::PrintAddingComponents() const {
              << JoinNamesFromInfo(adding_components, ", ") << ']';
 }
 
+void ComponentContextImpl::PrintLoadTimeline() const {
+  std::vector<ComponentLoadTime> timeline;
+  {
+    auto data = shared_data_.Lock();
+    timeline = data->load_timeline;
+  }
+  if (timeline.empty()) return;
+
+  const auto load_start =
+      std::min_element(timeline.begin(), timeline.end(),
+                       [](const auto& lhs, const auto& rhs) {
+                         return lhs.start < rhs.start;
+                       })
+          ->start;
+
+  // Construction times include the waiting for the dependencies, so the
+  // slowest components are the ones on the critical path of the startup
+  std::sort(timeline.begin(), timeline.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.finish - lhs.start > rhs.finish - rhs.start;
+            });
+  if (timeline.size() > kLoadTimelineMaxComponents) {
+    timeline.erase(timeline.begin() + kLoadTimelineMaxComponents,
+                   timeline.end());
+  }
+
+  const auto to_ms = [](auto duration) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(duration)
+        .count();
+  };
+  std::string message;
+  for (const auto& item : timeline) {
+    fmt::format_to(std::back_inserter(message), "{}{} (+{}ms, {}ms)",
+                   message.empty() ? "" : ", ", item.name.StringViewName(),
+                   to_ms(item.start - load_start),
+                   to_ms(item.finish - item.start));
+  }
+  LOG_INFO() << "slowest components to load (start offset, duration): ["
+             << message << "]";
+}
+
 }  // namespace components::impl
 
 USERVER_NAMESPACE_END
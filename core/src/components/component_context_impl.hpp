@@ -3,6 +3,7 @@
 #include <userver/components/component_context.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <set>
 #include <stdexcept>
 #include <unordered_map>
@@ -89,12 +90,19 @@ class ComponentContextImpl {
 
   enum class DependencyType { kNormal, kInverted };
 
+  struct ComponentLoadTime {
+    impl::ComponentNameFromInfo name;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point finish;
+  };
+
   struct ProtectedData {
     std::unordered_map<engine::impl::TaskContext*, impl::ComponentNameFromInfo>
         task_to_component_map;
     mutable std::unordered_set<impl::ComponentNameFromInfo>
         searching_components;
     bool print_adding_components_stopped{false};
+    std::vector<ComponentLoadTime> load_timeline;
   };
 
   struct ComponentLifetimeStageSwitchingParams {
@@ -151,6 +159,7 @@ class ComponentContextImpl {
   void StartPrintAddingComponentsTask();
   void StopPrintAddingComponentsTask();
   void PrintAddingComponents() const;
+  void PrintLoadTimeline() const;
 
   const Manager& manager_;
 
@@ -16,7 +16,9 @@ FsCache::FsCache(const components::ComponentConfig& config,
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
           context.GetTaskProcessor(config["fs-task-processor"].As<std::string>(
-              "fs-task-processor"))) {}
+              "fs-task-processor")),
+          config["mmap"].As<bool>(false) ? Client::Storage::kMmap
+                                         : Client::Storage::kRead) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<components::ComponentBase>(R"(
@@ -37,6 +39,12 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: fs-task-processor
+    mmap:
+        type: boolean
+        description: |
+            map the files into memory instead of reading them, the files must
+            be replaced atomically
+        defaultDescription: false
 )");
 }
 
@@ -1,5 +1,7 @@
 #include <userver/components/logging_configurator.hpp>
 
+#include <chrono>
+
 #include <logging/dynamic_debug.hpp>
 #include <logging/dynamic_debug_config.hpp>
 #include <tracing/no_log_spans.hpp>
@@ -28,6 +30,8 @@ const dynamic_config::Key<tracing::NoLogSpans> kNoLogSpans{
 )"}};
 /// [key]
 
+constexpr std::chrono::minutes kDefaultLimitedLoggingSummaryInterval{1};
+
 const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
     "USERVER_LOG_DYNAMIC_DEBUG", dynamic_config::DefaultAsJsonString{R"(
   {
@@ -45,6 +49,17 @@ LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config,
   logging::impl::SetLogLimitedInterval(
       config["limited-logging-interval"].As<std::chrono::milliseconds>());
 
+  const auto summary_interval =
+      config["limited-logging-summary-interval"].As<std::chrono::milliseconds>(
+          kDefaultLimitedLoggingSummaryInterval);
+  if (summary_interval.count() > 0) {
+    utils::PeriodicTask::Settings settings{summary_interval};
+    settings.span_level = logging::Level::kNone;
+    limited_logging_summary_task_.Start(
+        "limited-logging-summary", settings,
+        [] { logging::impl::LogLimitedSummary(); });
+  }
+
   config_subscription_ =
       context.FindComponent<components::DynamicConfig>()
           .GetSource()
@@ -52,6 +67,7 @@ LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config,
 }
 
 LoggingConfigurator::~LoggingConfigurator() {
+  limited_logging_summary_task_.Stop();
   config_subscription_.Unsubscribe();
 }
 
@@ -89,6 +105,13 @@ void LoggingConfigurator::OnConfigUpdate(
         AddDynamicDebugLog(path, line, state);
       }
 
+      logging::ResetLogLimits();
+      for (const auto& [location, limit] : dd.limited_logging) {
+        const auto [path, line] = logging::SplitLocation(location);
+        logging::SetLogLimit(path, line,
+                             {limit.interval_ms, limit.max_per_interval});
+      }
+
       lock.Commit();
     }
   } catch (const std::exception& e) {
@@ -108,6 +131,13 @@ properties:
     limited-logging-interval:
         type: string
         description: utils::StringToDuration suitable duration string to group repeated logs into one message
+    limited-logging-summary-interval:
+        type: string
+        description: |
+            utils::StringToDuration suitable duration string, how often to log
+            the count of messages suppressed by LOG_LIMITED for each location;
+            0s to disable
+        defaultDescription: 1m
 )");
 }
 
@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 #include <fmt/core.h>
 #include <boost/range/adaptor/map.hpp>
@@ -72,21 +73,38 @@ std::optional<size_t> GuessCpuLimit(const std::string& tp_name) {
 void ValidateConfigs(const components::ComponentList& component_list,
                      const components::ComponentConfigMap& component_config_map,
                      components::ValidationMode validation_condition) {
-  std::string validation_errors;
+  // Schemas are parsed from YAML, which takes a noticeable part of the startup
+  // for hundreds of components. Validating them concurrently.
+  std::vector<std::string> errors(
+      std::distance(component_list.begin(), component_list.end()));
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(errors.size());
 
+  std::size_t index = 0;
   for (const auto& adder : component_list) {
     const auto it = component_config_map.find(adder->GetComponentName());
     UINVARIANT(
         it != component_config_map.cend(),
         fmt::format("Component-config map does not have name of component '{}'",
                     adder->GetComponentName()));
-    try {
-      adder->ValidateStaticConfig(it->second, validation_condition);
-    } catch (const std::exception& exception) {
-      auto component_name = adder->GetComponentName();
-      validation_errors +=
-          fmt::format("\n\t{}: {}", component_name, exception.what());
-    }
+
+    tasks.push_back(engine::CriticalAsyncNoSpan(
+        [&adder, &config = it->second, &error = errors[index],
+         validation_condition] {
+          try {
+            adder->ValidateStaticConfig(config, validation_condition);
+          } catch (const std::exception& exception) {
+            error = fmt::format("\n\t{}: {}", adder->GetComponentName(),
+                                exception.what());
+          }
+        }));
+    ++index;
+  }
+
+  std::string validation_errors;
+  for (std::size_t i = 0; i < tasks.size(); ++i) {
+    tasks[i].Get();
+    validation_errors += errors[i];
   }
 
   if (!validation_errors.empty()) {
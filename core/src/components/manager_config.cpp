@@ -115,6 +115,15 @@ properties:
                     lead to inaccuracy in coro pool size estimation.
                     local_cache_size=0 disables local cache.
                 defaultDescription: 8
+            max_resident_idle_stacks:
+                type: integer
+                description: |
+                    The coroutines returned to the pool while it already has
+                    this amount of idle coroutines release the memory of their
+                    stacks with madvise(MADV_DONTNEED). Lower values reduce
+                    the RSS after a load spike, at the cost of page faults when
+                    the released stacks are used again.
+                defaultDescription: unlimited
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -178,6 +187,67 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                task-queue:
+                    type: string
+                    description: |
+                        task queue implementation. `global` is a single queue
+                        shared by all the workers. `work-stealing` gives each
+                        worker a local queue and lets idle workers steal tasks
+                        from the busy ones.
+                    defaultDescription: global
+                    enum:
+                      - global
+                      - work-stealing
+                scheduling-classes:
+                    type: array
+                    description: |
+                        weighted shares of the task processor for the groups
+                        of tasks; the tasks that are not assigned to a class
+                        belong to the first one. Requires the `global`
+                        task-queue
+                    defaultDescription: a single class
+                    items:
+                        type: object
+                        description: scheduling class
+                        additionalProperties: false
+                        properties:
+                            name:
+                                type: string
+                                description: name of the class
+                            weight:
+                                type: integer
+                                description: |
+                                    relative share of the CPU time the class
+                                    gets under load
+                                defaultDescription: 1
+                                minimum: 1
+                cpu-affinity:
+                    type: array
+                    description: |
+                        CPUs to pin the task processor threads to
+                    defaultDescription: no affinity
+                    items:
+                        type: integer
+                        description: CPU index
+                numa-node:
+                    type: integer
+                    description: |
+                        NUMA node to pin the task processor threads to;
+                        if 'cpu-affinity' is also set, only its CPUs of the
+                        node are used
+                    defaultDescription: no affinity
+                resource-usage-accounting:
+                    type: boolean
+                    description: |
+                        account CPU time and allocated bytes per task and
+                        report them per tracing span and per handler
+                    defaultDescription: false
+                jemalloc-dedicated-arena:
+                    type: boolean
+                    description: |
+                        serve the allocations of the task processor threads
+                        from a jemalloc arena of their own
+                    defaultDescription: false
                 task-trace:
                     type: object
                     description: .
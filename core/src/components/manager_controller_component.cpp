@@ -8,6 +8,8 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/logging/component.hpp>
+#include <userver/logging/log.hpp>
+#include <utils/jemalloc.hpp>
 
 #include <components/manager.hpp>
 
@@ -49,6 +51,55 @@ void DumpMetric(utils::statistics::Writer& writer,
   }
 
   writer["worker-threads"] = task_processor.GetWorkerCount();
+
+  {
+    engine::TaskProcessor::QueueWaitHistogram queue_wait;
+    task_processor.CollectQueueWaitHistogram(queue_wait);
+    writer["queue-wait-time-us"] = queue_wait;
+  }
+
+  // Lets tell the engine queueing apart from the OS CPU starvation
+  if (auto os_scheduler = writer["os-scheduler"]) {
+    using utils::statistics::Rate;
+    const auto stats = task_processor.CollectWorkersSchedulerStats();
+    const auto to_us = [](std::chrono::nanoseconds duration) {
+      return Rate{static_cast<Rate::ValueType>(
+          std::chrono::duration_cast<std::chrono::microseconds>(duration)
+              .count())};
+    };
+    os_scheduler["run-time-us"] = to_us(stats.run_time);
+    os_scheduler["run-queue-wait-time-us"] = to_us(stats.run_queue_wait_time);
+    os_scheduler["timeslices"] = Rate{stats.timeslices};
+    os_scheduler["voluntary-context-switches"] =
+        Rate{stats.voluntary_context_switches};
+    os_scheduler["involuntary-context-switches"] =
+        Rate{stats.involuntary_context_switches};
+  }
+
+  if (task_processor.HasSchedulingClasses()) {
+    const auto& queue = task_processor.GetWeightedTaskQueue();
+    auto classes = writer["scheduling-classes"];
+    for (std::size_t i = 0; i < queue.GetClassCount(); ++i) {
+      const auto stats = queue.GetClassStatistics(i);
+      const utils::statistics::LabelView label{"scheduling_class", stats.name};
+      classes["queued"].ValueWithLabels(stats.queued, label);
+      classes["slices"].ValueWithLabels(stats.executed_slices, label);
+      classes["execution-time-us"].ValueWithLabels(
+          stats.execution_time.count(), label);
+      classes["wait-samples"].ValueWithLabels(stats.wait_samples, label);
+      classes["wait-time-us"].ValueWithLabels(stats.wait_time.count(), label);
+    }
+  }
+
+  if (const auto arena = task_processor.GetJemallocArena()) {
+    utils::jemalloc::ArenaStats stats;
+    if (!utils::jemalloc::GetArenaStats(*arena, stats)) {
+      auto arena_writer = writer["jemalloc-arena"];
+      arena_writer["active-bytes"] = stats.active_bytes;
+      arena_writer["dirty-bytes"] = stats.dirty_bytes;
+      arena_writer["muzzy-bytes"] = stats.muzzy_bytes;
+    }
+  }
 }
 
 }  // namespace engine
@@ -138,6 +189,23 @@ void ManagerControllerComponent::OnConfigUpdate(
       task_processor->SetSettings(config.default_settings);
     }
   }
+
+  if (config.jemalloc_dirty_decay) {
+    const auto ec =
+        utils::jemalloc::SetDirtyDecay(*config.jemalloc_dirty_decay);
+    if (ec) {
+      LOG_WARNING() << "Failed to set jemalloc dirty_decay_ms: "
+                    << ec.message();
+    }
+  }
+  if (config.jemalloc_muzzy_decay) {
+    const auto ec =
+        utils::jemalloc::SetMuzzyDecay(*config.jemalloc_muzzy_decay);
+    if (ec) {
+      LOG_WARNING() << "Failed to set jemalloc muzzy_decay_ms: "
+                    << ec.message();
+    }
+  }
 }
 
 }  // namespace components
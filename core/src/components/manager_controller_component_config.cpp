@@ -1,6 +1,7 @@
 #include <components/manager_controller_component_config.hpp>
 
 #include <userver/dynamic_config/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -34,6 +35,23 @@ constexpr dynamic_config::DefaultAsJsonString kProfilerDefault{R"(
 }
 )"};
 
+constexpr dynamic_config::DefaultAsJsonString kJemallocDecayDefault{R"(
+{}
+)"};
+
+std::optional<std::chrono::milliseconds> ParseDecay(
+    const formats::json::Value& value) {
+  const auto decay_ms = value.As<std::optional<std::int64_t>>();
+  if (!decay_ms) return std::nullopt;
+  if (*decay_ms < -1) {
+    throw std::runtime_error(
+        fmt::format("Invalid '{}' value {}, expected -1 or a non-negative "
+                    "number of milliseconds",
+                    value.GetPath(), *decay_ms));
+  }
+  return std::chrono::milliseconds{*decay_ms};
+}
+
 }  // namespace
 
 ManagerControllerDynamicConfig ManagerControllerDynamicConfig::Parse(
@@ -65,6 +83,10 @@ ManagerControllerDynamicConfig ManagerControllerDynamicConfig::Parse(
     }
   }
 
+  const auto jemalloc_doc = docs_map.Get("USERVER_JEMALLOC_DECAY");
+  result.jemalloc_dirty_decay = ParseDecay(jemalloc_doc["dirty-decay-ms"]);
+  result.jemalloc_muzzy_decay = ParseDecay(jemalloc_doc["muzzy-decay-ms"]);
+
   return result;
 }
 
@@ -74,6 +96,7 @@ const dynamic_config::Key<ManagerControllerDynamicConfig>
         {
             {"USERVER_TASK_PROCESSOR_QOS", kQosDefault},
             {"USERVER_TASK_PROCESSOR_PROFILER_DEBUG", kProfilerDefault},
+            {"USERVER_JEMALLOC_DECAY", kJemallocDecayDefault},
         },
     };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -16,6 +18,10 @@ struct ManagerControllerDynamicConfig {
 
   engine::TaskProcessorSettings default_settings;
   std::unordered_map<std::string, engine::TaskProcessorSettings> settings;
+
+  // std::nullopt keeps the jemalloc settings as is
+  std::optional<std::chrono::milliseconds> jemalloc_dirty_decay;
+  std::optional<std::chrono::milliseconds> jemalloc_muzzy_decay;
 };
 
 extern const dynamic_config::Key<ManagerControllerDynamicConfig>
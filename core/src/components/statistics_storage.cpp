@@ -1,15 +1,20 @@
 #include <userver/components/statistics_storage.hpp>
 
+#include <userver/components/component_config.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace components {
 
-StatisticsStorage::StatisticsStorage(const ComponentConfig&,
+StatisticsStorage::StatisticsStorage(const ComponentConfig& config,
                                      const ComponentContext&)
     : metrics_storage_(std::make_shared<utils::statistics::MetricsStorage>()),
-      metrics_storage_registration_(metrics_storage_->RegisterIn(storage_)) {}
+      metrics_storage_registration_(metrics_storage_->RegisterIn(storage_)) {
+  storage_.SetCardinalityLimits(
+      config["cardinality-limits"].As<utils::statistics::CardinalityLimits>(
+          {}));
+}
 
 StatisticsStorage::~StatisticsStorage() {
   for (auto& entry : metrics_storage_registration_) {
@@ -26,7 +31,38 @@ yaml_config::Schema StatisticsStorage::GetStaticConfigSchema() {
 type: object
 description: Component that keeps a utils::statistics::Storage storage for metrics.
 additionalProperties: false
-properties: {}
+properties:
+    cardinality-limits:
+        type: object
+        description: |
+            limits of the series with different labels per metric path on
+            a single metrics request, the rest are summed into the overflow
+            series with the label values replaced by '__overflow__'
+        additionalProperties: false
+        properties:
+            max-series-per-path:
+                type: integer
+                description: series per metric path, 0 means unlimited
+                defaultDescription: 0
+                minimum: 0
+            prefixes:
+                type: object
+                description: |
+                    limits of the metric paths that start with the prefix,
+                    the longest matching prefix wins
+                additionalProperties:
+                    type: integer
+                    description: series per metric path, 0 means unlimited
+                    minimum: 0
+                properties: {}
+            keep-labels:
+                type: array
+                description: |
+                    low-cardinality labels that keep their values in the
+                    overflow series
+                items:
+                    type: string
+                    description: label name
 )");
 }
 
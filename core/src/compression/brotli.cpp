@@ -0,0 +1,93 @@
+#include <compression/brotli.hpp>
+
+#include <memory>
+#include <stdexcept>
+
+#include <brotli/decode.h>
+#include <brotli/encode.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::brotli {
+
+namespace {
+
+constexpr std::size_t kDecompressBufferSize = 16 * 1024;
+
+struct DecoderDeleter final {
+  void operator()(BrotliDecoderState* state) const noexcept {
+    BrotliDecoderDestroyInstance(state);
+  }
+};
+
+}  // namespace
+
+std::string Compress(std::string_view data, int quality) {
+  std::string compressed(BrotliEncoderMaxCompressedSize(data.size()), '\0');
+  auto compressed_size = compressed.size();
+  const auto ok = BrotliEncoderCompress(
+      quality, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_GENERIC, data.size(),
+      reinterpret_cast<const uint8_t*>(data.data()), &compressed_size,
+      reinterpret_cast<uint8_t*>(compressed.data()));
+  if (!ok) {
+    throw std::runtime_error("Brotli compression failed");
+  }
+
+  compressed.resize(compressed_size);
+  return compressed;
+}
+
+std::string Decompress(std::string_view compressed, size_t max_size) {
+  const std::unique_ptr<BrotliDecoderState, DecoderDeleter> state{
+      BrotliDecoderCreateInstance(nullptr, nullptr, nullptr)};
+  if (!state) {
+    throw std::runtime_error("Couldn't create brotli decoder");
+  }
+
+  std::string decompressed;
+  auto available_in = compressed.size();
+  const auto* next_in = reinterpret_cast<const uint8_t*>(compressed.data());
+
+  while (true) {
+    // At most one byte over the limit is ever written, which is enough to
+    // detect the overflow without allocating the whole output of a bomb.
+    const auto remaining = max_size - decompressed.size();
+    const auto chunk_size = remaining < kDecompressBufferSize
+                                ? remaining + 1
+                                : kDecompressBufferSize;
+
+    const auto old_size = decompressed.size();
+    decompressed.resize(old_size + chunk_size);
+    auto available_out = chunk_size;
+    auto* next_out = reinterpret_cast<uint8_t*>(decompressed.data() + old_size);
+
+    const auto result = BrotliDecoderDecompressStream(
+        state.get(), &available_in, &next_in, &available_out, &next_out,
+        nullptr);
+    decompressed.resize(old_size + chunk_size - available_out);
+
+    if (decompressed.size() > max_size) {
+      throw TooBigError();
+    }
+
+    switch (result) {
+      case BROTLI_DECODER_RESULT_SUCCESS:
+        if (available_in != 0) {
+          throw DecompressionError(
+              "Decompression failed: trailing data after brotli stream");
+        }
+        return decompressed;
+      case BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT:
+        break;
+      case BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT:
+        throw DecompressionError("Decompression failed: truncated brotli data");
+      case BROTLI_DECODER_RESULT_ERROR:
+        throw ErrWithCode(BrotliDecoderErrorString(
+            BrotliDecoderGetErrorCode(state.get())));
+    }
+  }
+}
+
+}  // namespace compression::brotli
+
+USERVER_NAMESPACE_END
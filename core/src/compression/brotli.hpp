@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string_view>
+
+#include <userver/compression/error.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::brotli {
+
+/// Compresses the string, `quality` is from 0 to 11.
+/// @throws std::runtime_error on compression failure
+std::string Compress(std::string_view data, int quality);
+
+/// Decompresses the string. The limit is checked while decompressing, the
+/// output is never allocated beyond it.
+/// @throws DecompressionError
+std::string Decompress(std::string_view compressed, size_t max_size);
+
+}  // namespace compression::brotli
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <compression/brotli.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kQuality = 4;
+
+std::string Compress(std::string_view data) {
+  return compression::brotli::Compress(data, kQuality);
+}
+
+}  // namespace
+
+TEST(Brotli, Decompress) {
+  std::string str;
+  for (int i = 0; i < 10'000; ++i) str += std::to_string(i);
+
+  const auto compressed = Compress(str);
+  EXPECT_LT(compressed.size(), str.size());
+  EXPECT_EQ(compression::brotli::Decompress(compressed, str.size()), str);
+  EXPECT_EQ(compression::brotli::Decompress(Compress({}), 0), "");
+}
+
+TEST(Brotli, TestOverflow) {
+  const std::string big_msg(64 << 20, 'a');
+  const auto compressed = Compress(big_msg);
+  ASSERT_LT(compressed.size(), 64 * 1024);
+
+  EXPECT_THROW(compression::brotli::Decompress(compressed, 1000),
+               compression::TooBigError);
+}
+
+TEST(Brotli, InvalidData) {
+  const auto compressed = Compress("This is a \"Very long\" msg!");
+  EXPECT_THROW(compression::brotli::Decompress(
+                   compressed.substr(0, compressed.size() / 2), 1000),
+               compression::DecompressionError);
+  EXPECT_THROW(compression::brotli::Decompress("not a brotli data", 1000),
+               compression::DecompressionError);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <compression/gzip.hpp>
 
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -11,6 +12,19 @@ namespace {
 constexpr auto kDecompressBufferSize = 1024;
 }
 
+std::string Compress(std::string_view data, int level) {
+  namespace bio = boost::iostreams;
+
+  std::string compressed;
+  bio::filtering_ostream stream;
+  stream.push(bio::gzip_compressor(bio::gzip_params(level)));
+  stream.push(bio::back_inserter(compressed));
+  stream.write(data.data(), data.size());
+  stream.reset();
+
+  return compressed;
+}
+
 std::string Decompress(std::string_view compressed, size_t max_size) {
   std::string decompressed;
 
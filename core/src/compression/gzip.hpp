@@ -8,6 +8,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
+/// Compresses the string into the gzip format, `level` is from 1 to 9.
+std::string Compress(std::string_view data, int level);
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
@@ -29,4 +29,18 @@ TEST(Gzip, TestOverflow) {
                compression::TooBigError);
 }
 
+TEST(Gzip, CompressRoundTrip) {
+  std::string str;
+  for (int i = 0; i < 10'000; ++i) str += std::to_string(i);
+
+  for (const int level : {1, 6, 9}) {
+    const auto compressed = compression::gzip::Compress(str, level);
+    EXPECT_LT(compressed.size(), str.size());
+    EXPECT_EQ(compression::gzip::Decompress(compressed, str.size()), str);
+  }
+  EXPECT_EQ(compression::gzip::Decompress(compression::gzip::Compress({}, 6),
+                                          0),
+            "");
+}
+
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <atomic>
+#include <vector>
 
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -9,6 +10,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/engine/task/task_processor_utils.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/lazy_prvalue.hpp>
 
 using namespace std::chrono_literals;
@@ -131,6 +133,28 @@ UTEST(BackgroundTaskStorage, ActiveTasksCounter) {
   EXPECT_EQ(bts.ActiveTasksApprox(), kLongTasks);
 }
 
+UTEST_MT(BackgroundTaskStorage, ActiveTasksCounterMultipleThreads, 4) {
+  constexpr std::int64_t kDetachers = 8;
+  constexpr std::int64_t kTasksPerDetacher = 100;
+  concurrent::BackgroundTaskStorage bts;
+
+  std::vector<engine::TaskWithResult<void>> detachers;
+  for (std::int64_t i = 0; i < kDetachers; ++i) {
+    detachers.push_back(utils::Async("detacher", [&] {
+      for (std::int64_t j = 0; j < kTasksPerDetacher; ++j) {
+        bts.AsyncDetach("long-task", [] {
+          engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+        });
+      }
+    }));
+  }
+  for (auto& detacher : detachers) detacher.Get();
+
+  EXPECT_EQ(bts.ActiveTasksApprox(), kDetachers * kTasksPerDetacher);
+
+  bts.CancelAndWait();
+}
+
 UTEST(BackgroundTaskStorage, ExceptionWhilePreparingTask) {
   concurrent::BackgroundTaskStorage bts;
 
@@ -0,0 +1,182 @@
+#include <userver/concurrent/bounded_queue.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <concurrent/mp_queue_test.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kProducersCount = 4;
+constexpr std::size_t kConsumersCount = 4;
+constexpr std::size_t kMessageCount = 1000;
+
+using TestMpmcTypes =
+    testing::Types<concurrent::BoundedMpmcQueue<int>,
+                   concurrent::BoundedMpmcQueue<std::unique_ptr<int>>,
+                   concurrent::BoundedMpmcQueue<std::unique_ptr<RefCountData>>>;
+using TestSpscTypes =
+    testing::Types<concurrent::BoundedSpscQueue<int>,
+                   concurrent::BoundedSpscQueue<std::unique_ptr<int>>,
+                   concurrent::BoundedSpscQueue<std::unique_ptr<RefCountData>>>;
+
+template <typename T>
+class NonCoroutineTest : public ::testing::Test {};
+
+using TestQueueTypes =
+    testing::Types<concurrent::BoundedMpmcQueue<std::size_t>,
+                   concurrent::BoundedMpscQueue<std::size_t>,
+                   concurrent::BoundedSpmcQueue<std::size_t>,
+                   concurrent::BoundedSpscQueue<std::size_t>>;
+
+}  // namespace
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedMpmcQueue, QueueFixture,
+                                concurrent::BoundedMpmcQueue<int>);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedMpmcQueue, TypedQueueFixture,
+                                TestMpmcTypes);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedMpscQueue, QueueFixture,
+                                concurrent::BoundedMpscQueue<int>);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedSpscQueue, TypedQueueFixture,
+                                TestSpscTypes);
+
+TYPED_TEST_SUITE(NonCoroutineTest, TestQueueTypes);
+
+TYPED_TEST(NonCoroutineTest, Capacity) {
+  auto queue = TypeParam::Create(3);
+  EXPECT_EQ(queue->GetSoftMaxSize(), 3);
+
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  // The ring buffer is rounded up to 4 elements, but the requested capacity
+  // is kept as the size limit
+  EXPECT_TRUE(producer.PushNoblock(0));
+  EXPECT_TRUE(producer.PushNoblock(1));
+  EXPECT_TRUE(producer.PushNoblock(2));
+  EXPECT_FALSE(producer.PushNoblock(3));
+  EXPECT_EQ(queue->GetSizeApproximate(), 3);
+
+  queue->SetSoftMaxSize(100);
+  EXPECT_EQ(queue->GetSoftMaxSize(), 4);
+  EXPECT_TRUE(producer.PushNoblock(3));
+  EXPECT_FALSE(producer.PushNoblock(4));
+
+  // Wraps around the ring buffer several times
+  std::size_t value{};
+  for (std::size_t i = 0; i < 20; ++i) {
+    ASSERT_TRUE(consumer.PopNoblock(value));
+    EXPECT_EQ(value, i);
+    ASSERT_TRUE(producer.PushNoblock(i + 4));
+  }
+  EXPECT_EQ(queue->GetSizeApproximate(), 4);
+}
+
+UTEST(BoundedMpmcQueue, PopMany) {
+  auto queue = concurrent::BoundedMpmcQueue<int>::Create(4);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+  for (int i = 0; i < 3; ++i) ASSERT_TRUE(producer.Push(int{i}));
+
+  std::vector<int> values;
+  EXPECT_EQ(consumer.PopMany(values, 2), 2);
+  EXPECT_EQ(consumer.PopMany(values, 10), 1);
+  EXPECT_EQ(values, (std::vector<int>{0, 1, 2}));
+  EXPECT_EQ(consumer.PopMany(values, 10, engine::Deadline::Passed()), 0);
+
+  std::move(producer).Reset();
+  EXPECT_EQ(consumer.PopMany(values, 10), 0);
+}
+
+UTEST(BoundedMpmcQueue, ConsumerIsDead) {
+  auto queue = concurrent::BoundedMpmcQueue<int>::Create(1);
+  auto producer = queue->GetProducer();
+  ASSERT_TRUE(producer.Push(0));
+
+  auto task = utils::Async("pusher", [&] { return producer.Push(1); });
+  (void)(queue->GetConsumer());
+  EXPECT_FALSE(task.Get());
+}
+
+UTEST_MT(BoundedMpmcQueue, Mpmc, kProducersCount + kConsumersCount) {
+  // A small capacity makes both the producers and the consumers sleep
+  auto queue = concurrent::BoundedMpmcQueue<std::size_t>::Create(16);
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(
+        utils::Async("producer", [producer = queue->GetProducer(), i] {
+          for (std::size_t message = i * kMessageCount;
+               message < (i + 1) * kMessageCount; ++message) {
+            ASSERT_TRUE(producer.Push(std::size_t{message}));
+          }
+        }));
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer",
+        [consumer = queue->GetConsumer(), &consumed_messages, &mutex] {
+          std::vector<std::size_t> last_by_producer(kProducersCount, 0);
+          std::size_t value{};
+          while (consumer.Pop(value)) {
+            // FIFO: the messages of a producer are popped in order
+            auto& last = last_by_producer[value / kMessageCount];
+            EXPECT_GT(value + 1, last);
+            last = value + 1;
+
+            const std::lock_guard lock(mutex);
+            ++consumed_messages[value];
+          }
+        }));
+  }
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+UTEST_MT(BoundedSpscQueue, Spsc, 1 + 1) {
+  auto queue = concurrent::BoundedSpscQueue<std::size_t>::Create(8);
+
+  auto consumer_task =
+      utils::Async("consumer", [consumer = queue->GetConsumer()] {
+        std::size_t expected = 0;
+        std::size_t value{};
+        while (consumer.Pop(value)) {
+          ASSERT_EQ(value, expected++);
+        }
+        EXPECT_EQ(expected, kMessageCount);
+      });
+
+  {
+    auto producer = queue->GetProducer();
+    for (std::size_t message = 0; message < kMessageCount; ++message) {
+      ASSERT_TRUE(producer.Push(std::size_t{message}));
+    }
+  }
+  consumer_task.Get();
+}
+
+USERVER_NAMESPACE_END
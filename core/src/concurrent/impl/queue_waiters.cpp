@@ -0,0 +1,80 @@
+#include <userver/concurrent/impl/queue_waiters.hpp>
+
+#include <engine/impl/wait_list.hpp>
+#include <engine/task/task_context.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+namespace {
+
+class QueueWaitStrategy final : public engine::impl::WaitStrategy {
+ public:
+  QueueWaitStrategy(engine::impl::WaitList& waiters,
+                    std::atomic<std::size_t>& sleepies,
+                    engine::impl::TaskContext& current) noexcept
+      : waiters_(waiters),
+        sleepies_(sleepies),
+        current_(current),
+        lock_(waiters_) {
+    sleepies_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  ~QueueWaitStrategy() { sleepies_.fetch_sub(1, std::memory_order_relaxed); }
+
+  engine::impl::EarlyWakeup SetupWakeups() override {
+    waiters_.Append(lock_, &current_);
+    lock_.unlock();
+    // The operation is retried under WaitList::Lock, and the notification
+    // takes it too, so the wakeup is not missed
+    return engine::impl::EarlyWakeup{false};
+  }
+
+  void DisableWakeups() noexcept override {
+    lock_.lock();
+    waiters_.Remove(lock_, current_);
+  }
+
+ private:
+  engine::impl::WaitList& waiters_;
+  std::atomic<std::size_t>& sleepies_;
+  engine::impl::TaskContext& current_;
+  engine::impl::WaitList::Lock lock_;
+};
+
+}  // namespace
+
+QueueWaiters::QueueWaiters() = default;
+
+QueueWaiters::~QueueWaiters() = default;
+
+bool QueueWaiters::DoWaitUntil(engine::Deadline deadline,
+                               OperationRef operation, void* data) {
+  auto& current = engine::current_task::GetCurrentTaskContext();
+  QueueWaitStrategy wait_strategy{*waiters_, sleepies_, current};
+
+  while (!operation(data)) {
+    const auto wakeup_source = current.Sleep(wait_strategy, deadline);
+    if (!engine::impl::HasWaitSucceeded(wakeup_source)) {
+      // The notification might have been sent to this task, so the last
+      // attempt takes what it was about instead of losing it
+      return operation(data);
+    }
+  }
+  return true;
+}
+
+void QueueWaiters::DoNotify(bool all) {
+  engine::impl::WaitList::Lock lock{*waiters_};
+  if (all) {
+    waiters_->WakeupAll(lock);
+  } else {
+    waiters_->WakeupOne(lock);
+  }
+}
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
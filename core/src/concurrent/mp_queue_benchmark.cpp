@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <userver/concurrent/bounded_queue.hpp>
 #include <userver/concurrent/mpsc_queue.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -95,4 +96,16 @@ BENCHMARK_TEMPLATE(producer_consumer, concurrent::MpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {1'000'000'000, 1'000'000'000}});
 
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::BoundedMpmcQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 4}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::BoundedMpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::BoundedSpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 1}, {1, 1}, {128, 512}});
+
 USERVER_NAMESPACE_END
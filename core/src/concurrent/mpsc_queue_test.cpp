@@ -30,6 +30,40 @@ UTEST(MpscQueue, ConsumerIsDead) {
   EXPECT_FALSE(producer.Push(0));
 }
 
+UTEST(MpscQueue, PushManyPopMany) {
+  auto queue = concurrent::MpscQueue<std::unique_ptr<int>>::Create(3);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<std::unique_ptr<int>> values;
+  values.push_back(std::make_unique<int>(0));
+  values.push_back(std::make_unique<int>(1));
+  EXPECT_TRUE(producer.PushMany(values));
+  EXPECT_EQ(queue->GetSizeApproximate(), 2);
+
+  // The batch does not fit into the remaining capacity and is left intact
+  EXPECT_FALSE(producer.PushMany(values, engine::Deadline::Passed()));
+  values.clear();
+  values.push_back(std::make_unique<int>(2));
+  values.push_back(std::make_unique<int>(3));
+  EXPECT_FALSE(producer.PushMany(values, engine::Deadline::Passed()));
+  ASSERT_TRUE(values[0] && values[1]);
+
+  std::vector<std::unique_ptr<int>> popped;
+  EXPECT_EQ(consumer.PopMany(popped, 10), 2);
+  ASSERT_EQ(popped.size(), 2);
+  EXPECT_EQ(*popped[0], 0);
+  EXPECT_EQ(*popped[1], 1);
+
+  EXPECT_TRUE(producer.PushMany(values));
+  std::move(producer).Reset();
+  EXPECT_EQ(consumer.PopMany(popped, 1), 1);
+  EXPECT_EQ(consumer.PopMany(popped, 1), 1);
+  EXPECT_EQ(consumer.PopMany(popped, 1), 0);
+  ASSERT_EQ(popped.size(), 4);
+  EXPECT_EQ(*popped[3], 3);
+}
+
 UTEST(MpscQueue, NoCrashOnProducerReuse) {
   auto queue = concurrent::MpscQueue<int>::Create();
   auto producer = queue->GetProducer();
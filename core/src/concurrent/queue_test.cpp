@@ -31,6 +31,9 @@ auto GetProducerTask(const Producer& producer, std::size_t i) {
 template <typename T>
 class NonCoroutineTest : public ::testing::Test {};
 
+template <typename T>
+class QueueBatch : public ::testing::Test {};
+
 using TestMpmcTypes =
     testing::Types<concurrent::NonFifoMpmcQueue<int>,
                    concurrent::NonFifoMpmcQueue<std::unique_ptr<int>>,
@@ -61,6 +64,37 @@ INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpscQueue, TypedQueueFixture,
 
 TYPED_TEST_SUITE(NonCoroutineTest, TestQueueTypes);
 
+TYPED_UTEST_SUITE(QueueBatch, TestQueueTypes);
+
+TYPED_UTEST(QueueBatch, PushManyPopMany) {
+  auto queue = TypeParam::Create(4);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<std::size_t> values{0, 1, 2};
+  EXPECT_TRUE(producer.PushMany(values));
+  EXPECT_EQ(queue->GetSizeApproximate(), 3);
+
+  // The batch does not fit into the remaining capacity
+  std::vector<std::size_t> more{3, 4};
+  EXPECT_FALSE(producer.PushMany(more, engine::Deadline::Passed()));
+  EXPECT_EQ(queue->GetSizeApproximate(), 3);
+
+  std::vector<std::size_t> popped;
+  EXPECT_EQ(consumer.PopMany(popped, 2), 2);
+  EXPECT_EQ(consumer.PopMany(popped, 10), 1);
+  EXPECT_EQ(popped, values);
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+  EXPECT_EQ(consumer.PopMany(popped, 10, engine::Deadline::Passed()), 0);
+
+  EXPECT_TRUE(producer.PushMany(more));
+  std::move(producer).Reset();
+  popped.clear();
+  EXPECT_EQ(consumer.PopMany(popped, 10), 2);
+  EXPECT_EQ(popped, more);
+  EXPECT_EQ(consumer.PopMany(popped, 10), 0);
+}
+
 TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
   auto queue = TypeParam::Create();
 
@@ -140,6 +174,58 @@ UTEST_MT(NonFifoMpmcQueue, Mpmc, kProducersCount + kConsumersCount) {
                           [](int item) { return item == 1; }));
 }
 
+UTEST_MT(NonFifoMpmcQueue, MpmcBatches, kProducersCount + kConsumersCount) {
+  constexpr std::size_t kBatchSize = 10;
+  auto queue = concurrent::NonFifoMpmcQueue<std::size_t>::Create(kBatchSize);
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(
+        utils::Async("producer", [producer = queue->GetProducer(), i] {
+          std::vector<std::size_t> batch;
+          for (std::size_t message = i * kMessageCount;
+               message < (i + 1) * kMessageCount; ++message) {
+            batch.push_back(message);
+            if (batch.size() == kBatchSize) {
+              ASSERT_TRUE(producer.PushMany(batch));
+              batch.clear();
+            }
+          }
+          ASSERT_TRUE(producer.PushMany(batch));
+        }));
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer",
+        [consumer = queue->GetConsumer(), &consumed_messages, &mutex] {
+          std::vector<std::size_t> values;
+          while (consumer.PopMany(values, kBatchSize / 2)) {
+            const std::lock_guard lock(mutex);
+            for (const auto value : values) ++consumed_messages[value];
+            values.clear();
+          }
+        }));
+  }
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
 UTEST_MT(NonFifoMpmcQueue, SizeAfterConsumersDie, kConsumersCount + 1) {
   constexpr std::size_t kAttemptsCount = 1000;
 
@@ -54,6 +54,7 @@ void FormatStats(const Controller& c, size_t activated_factor,
   writer["time-from-last-overloaded-under-pressure-secs"] =
       std::chrono::duration_cast<std::chrono::seconds>(diff).count();
   writer["current-state"] = stats.current_state;
+  writer["system-pressure-percent"] = stats.system_pressure_percent;
 }
 
 }  // namespace
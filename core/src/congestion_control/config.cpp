@@ -45,6 +45,10 @@ Policy Parse(const formats::json::Value& policy, formats::parse::To<Policy>) {
   p.load_limit_percent = policy["load-limit-percent"].As<int>(0);
   p.load_limit_crit_percent = policy["load-limit-crit-percent"].As<int>(101);
   p.start_limit_factor = policy["start-limit-factor"].As<double>(0.75);
+  if (!policy["system-pressure-limit-percent"].IsMissing()) {
+    p.system_pressure_limit_percent =
+        ParsePercent<int>(policy["system-pressure-limit-percent"]);
+  }
   return p;
 }
 
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,7 +20,8 @@ TEST(CongestionControlConfig, Parsing) {
       "no-limit-seconds": 10,
       "load-limit-percent": 11,
       "load-limit-crit-percent": 12,
-      "start-limit-factor": 13.5
+      "start-limit-factor": 13.5,
+      "system-pressure-limit-percent": 14
     }
   )";
   const auto policy =
@@ -36,6 +38,30 @@ TEST(CongestionControlConfig, Parsing) {
   EXPECT_EQ(policy.load_limit_percent, 11);
   EXPECT_EQ(policy.load_limit_crit_percent, 12);
   EXPECT_DOUBLE_EQ(policy.start_limit_factor, 13.5);
+  EXPECT_EQ(policy.system_pressure_limit_percent, 14);
+}
+
+TEST(CongestionControlConfig, SystemPressureIsDisabledByDefault) {
+  constexpr std::string_view kPolicyJson = R"(
+    {
+      "min-limit": 1,
+      "up-rate-percent": 2,
+      "down-rate-percent": 2,
+      "overload-on-seconds": 3,
+      "overload-off-seconds": 3,
+      "up-level": 2,
+      "down-level": 1,
+      "no-limit-seconds": 10
+    }
+  )";
+  const auto policy =
+      formats::json::FromString(kPolicyJson).As<congestion_control::Policy>();
+  EXPECT_EQ(policy.system_pressure_limit_percent, 0);
+
+  auto builder =
+      formats::json::ValueBuilder{formats::json::FromString(kPolicyJson)};
+  builder["system-pressure-limit-percent"] = 101;
+  EXPECT_ANY_THROW(builder.ExtractValue().As<congestion_control::Policy>());
 }
 
 USERVER_NAMESPACE_END
@@ -17,6 +17,13 @@ Controller::Controller(std::string name, dynamic_config::Source config_source)
 
 bool Controller::IsOverloadedNow(const Sensor::Data& data,
                                  const Policy& policy) const {
+  if (policy.system_pressure_limit_percent != 0 &&
+      data.system_pressure_percent >= policy.system_pressure_limit_percent) {
+    // CPU throttling and memory stalls slow down the whole process before
+    // the task queue grows, do not wait for the task overload events
+    return true;
+  }
+
   // Use on/off limits for anti-flap
   const size_t overload_limit =
       state_.is_overloaded ? policy.down_count : policy.up_count;
@@ -89,6 +96,8 @@ void Controller::Feed(const Sensor::Data& data) {
   const auto& policy = config[impl::kRpsCcConfig].policy;
 
   const auto is_overloaded_pressure = IsOverloadedNow(data, policy);
+  stats_.system_pressure_percent =
+      static_cast<size_t>(std::lround(data.system_pressure_percent));
   const auto old_overloaded = state_.is_overloaded;
 
   if (is_overloaded_pressure) {
@@ -181,7 +190,8 @@ void Controller::Feed(const Sensor::Data& data) {
     LOG(log_level) << "congestion control '" << name_
                    << "' state: input load=" << data.current_load
                    << " input overloads=" << data.overload_events_count
-                   << load_prc_str
+                   << load_prc_str << fmt::format(" system_pressure={:.2f}%",
+                                                  data.system_pressure_percent)
                    << " => is_overloaded=" << state_.is_overloaded
                    << " current_limit=" << state_.current_limit
                    << " times_w=" << state_.times_with_overload
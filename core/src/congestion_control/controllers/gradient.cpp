@@ -0,0 +1,121 @@
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <userver/logging/log.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+namespace {
+// Number of steps to average the long-term timings over
+constexpr std::size_t kLongTimingsEpochs = 30;
+
+constexpr double kMinGradient = 0.5;
+
+// Number of steps without the overload and far from the limit to remove it
+constexpr std::size_t kCalmEpochs = 10;
+}  // namespace
+
+GradientController::GradientController(const std::string& name,
+                                       v2::Sensor& sensor, Limiter& limiter,
+                                       Stats& stats, const StaticConfig& config)
+    : Controller(name, sensor, limiter, stats, {config.fake_mode, true}),
+      config_(config) {}
+
+Limit GradientController::Update(const Sensor::Data& current) {
+  if (current.total < config_.min_qps) {
+    // Too little QPS, timings avg data is VERY noisy
+    return {current_limit_, current.current_load};
+  }
+
+  const auto short_timings_ms =
+      static_cast<double>(std::max<std::size_t>(current.timings_avg_ms, 1));
+  if (!long_timings_ms_) long_timings_ms_ = short_timings_ms;
+
+  if (epochs_passed_ < kLongTimingsEpochs) {
+    // First seconds of service life might be too noisy
+    ++epochs_passed_;
+    *long_timings_ms_ +=
+        (short_timings_ms - *long_timings_ms_) / epochs_passed_;
+    return {std::nullopt, current.current_load};
+  }
+
+  const auto gradient =
+      std::clamp(config_.rtt_tolerance * *long_timings_ms_ / short_timings_ms,
+                 kMinGradient, 1.0);
+
+  if (gradient < 1.0) {
+    if (!current_limit_) {
+      LOG_ERROR() << GetName() << " adaptive concurrency limit is activated";
+      limit_ = std::max<double>(current.current_load, config_.min_limit);
+    }
+  } else {
+    // Long-term timings are sticky to the "good" ones
+    *long_timings_ms_ +=
+        (short_timings_ms - *long_timings_ms_) / kLongTimingsEpochs;
+  }
+
+  if (!current_limit_ && gradient == 1.0) {
+    return {std::nullopt, current.current_load};
+  }
+
+  if (gradient == 1.0 && current.current_load * 2 < limit_) {
+    // The limit is not reached, there is no evidence that a bigger one is OK
+    if (++calm_epochs_ >= kCalmEpochs) Deactivate();
+    return {current_limit_, current.current_load};
+  }
+  calm_epochs_ = 0;
+
+  const auto new_limit = limit_ * gradient + std::sqrt(limit_);
+  limit_ = limit_ * (1 - config_.smoothing) + new_limit * config_.smoothing;
+  limit_ = std::max<double>(limit_, config_.min_limit);
+
+  if (limit_ >= config_.max_limit) {
+    Deactivate();
+  } else {
+    current_limit_ = static_cast<std::size_t>(limit_);
+  }
+
+  LOG_DEBUG() << GetName() << " sensor=(" << current.ToLogString()
+              << ") long_timings_ms=" << *long_timings_ms_
+              << " gradient=" << gradient << " limit=" << limit_;
+  return {current_limit_, current.current_load};
+}
+
+void GradientController::Deactivate() {
+  LOG_ERROR() << GetName() << " adaptive concurrency limit is deactivated";
+  current_limit_.reset();
+  calm_epochs_ = 0;
+}
+
+GradientConfig Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<GradientConfig>) {
+  GradientConfig config;
+  config.fake_mode = value["fake-mode"].As<bool>(config.fake_mode);
+  config.min_limit = value["min-limit"].As<std::size_t>(config.min_limit);
+  config.max_limit = value["max-limit"].As<std::size_t>(config.max_limit);
+  config.rtt_tolerance =
+      value["rtt-tolerance"].As<double>(config.rtt_tolerance);
+  config.smoothing = value["smoothing"].As<double>(config.smoothing);
+  config.min_qps = value["min-qps"].As<std::size_t>(config.min_qps);
+
+  if (config.min_limit == 0 || config.min_limit >= config.max_limit) {
+    throw std::runtime_error(
+        "adaptive concurrency limit requires 0 < min-limit < max-limit");
+  }
+  if (config.rtt_tolerance < 1 || config.smoothing <= 0 ||
+      config.smoothing > 1) {
+    throw std::runtime_error(
+        "adaptive concurrency limit requires rtt-tolerance >= 1 and "
+        "0 < smoothing <= 1");
+  }
+  return config;
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class FakeSensor : public congestion_control::v2::Sensor {
+  Data GetCurrent() override { return {}; }
+};
+
+class FakeLimiter : public congestion_control::Limiter {
+  void SetLimit(const congestion_control::Limit&) override {}
+};
+
+congestion_control::v2::Stats stats;
+FakeSensor sensor;
+FakeLimiter limiter;
+
+congestion_control::v2::Sensor::Data MakeData(std::size_t timings_avg_ms,
+                                              std::size_t current_load) {
+  congestion_control::v2::Sensor::Data data;
+  data.total = 1000;
+  data.timings_avg_ms = timings_avg_ms;
+  data.current_load = current_load;
+  return data;
+}
+
+void WarmUp(congestion_control::v2::GradientController& controller) {
+  for (std::size_t i = 0; i < 30; i++) {
+    const auto limit = controller.Update(MakeData(100, 100));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+}  // namespace
+
+TEST(CCGradient, NoOverload) {
+  congestion_control::v2::GradientController controller("test", sensor,
+                                                        limiter, stats, {});
+  WarmUp(controller);
+
+  for (std::size_t i = 0; i < 100; i++) {
+    // Within the default rtt-tolerance
+    const auto limit = controller.Update(MakeData(140, 100));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, SmallRps) {
+  congestion_control::v2::GradientController controller("test", sensor,
+                                                        limiter, stats, {});
+  WarmUp(controller);
+
+  auto data = MakeData(10000, 100);
+  data.total = 1;
+  for (std::size_t i = 0; i < 100; i++) {
+    EXPECT_EQ(controller.Update(data).load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, Overload) {
+  congestion_control::v2::GradientController controller("test", sensor,
+                                                        limiter, stats, {});
+  WarmUp(controller);
+
+  auto limit = controller.Update(MakeData(1000, 200));
+  ASSERT_TRUE(limit.load_limit);
+  EXPECT_LT(*limit.load_limit, 200);
+  EXPECT_GT(*limit.load_limit, 100);
+
+  // The limit decreases while the timings are bad
+  for (std::size_t i = 0; i < 10; i++) {
+    const auto previous = *limit.load_limit;
+    limit = controller.Update(MakeData(1000, previous));
+    ASSERT_TRUE(limit.load_limit) << i;
+    EXPECT_LT(*limit.load_limit, previous) << i;
+  }
+
+  // The limit grows back once the timings are good and the limit is reached
+  const auto lowest = *limit.load_limit;
+  for (std::size_t i = 0; i < 10; i++) {
+    limit = controller.Update(MakeData(100, *limit.load_limit));
+    ASSERT_TRUE(limit.load_limit) << i;
+  }
+  EXPECT_GT(*limit.load_limit, lowest);
+
+  // The limit is removed after the load is far below the limit for a while
+  for (std::size_t i = 0; i < 10; i++) {
+    limit = controller.Update(MakeData(100, 1));
+  }
+  EXPECT_EQ(limit.load_limit, std::nullopt);
+}
+
+TEST(CCGradient, MinLimit) {
+  congestion_control::v2::GradientConfig config;
+  config.min_limit = 50;
+  congestion_control::v2::GradientController controller("test", sensor,
+                                                        limiter, stats, config);
+  WarmUp(controller);
+
+  for (std::size_t i = 0; i < 100; i++) {
+    const auto limit = controller.Update(MakeData(10000, 60));
+    ASSERT_TRUE(limit.load_limit) << i;
+    EXPECT_GE(*limit.load_limit, 50) << i;
+  }
+}
+
+USERVER_NAMESPACE_END
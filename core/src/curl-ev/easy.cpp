@@ -140,6 +140,12 @@ std::shared_ptr<easy> easy::GetBoundBlocking(multi& multi_handle) const {
   return std::make_shared<easy>(cloned, &multi_handle);
 }
 
+void easy::Rebind(multi& multi_handle) {
+  UASSERT(multi_);
+  UASSERT(!multi_registered_);
+  multi_ = &multi_handle;
+}
+
 easy* easy::from_native(native::CURL* native_easy) {
   easy* easy_handle = nullptr;
   native::curl_easy_getinfo(native_easy, native::CURLINFO_PRIVATE,
@@ -265,6 +271,15 @@ void easy::reset() {
   LOG_TRACE() << "easy::reset finished " << this;
 }
 
+void easy::unpause() {
+  UASSERT(GetThreadControl().IsInEvThread());
+  const auto code = native::curl_easy_pause(handle_, CURLPAUSE_CONT);
+  if (code != native::CURLE_OK) {
+    LOG_WARNING() << "curl_easy_pause failed: "
+                  << native::curl_easy_strerror(code);
+  }
+}
+
 void easy::mark_start_performing() {
   if (start_performing_ts_ == time_point{}) {
     start_performing_ts_ = std::chrono::steady_clock::now();
@@ -567,7 +582,7 @@ void easy::add_resolve(const std::string& host, const std::string& port,
     UASSERT_MSG(
         !host_port_addr.empty(),
         "ReplaceFirstIf moved the string out, when it shouldn't have done so.");
-    resolved_hosts_->add(std::move(host_port_addr));
+    resolved_hosts_->add(host_port_addr);
   }
 
   ec =
@@ -222,6 +222,10 @@ class easy final : public std::enable_shared_from_this<easy> {
 
   const multi* GetMulti() const { return multi_; }
 
+  // Moves an easy that is not being performed to another multi, so that the
+  // next request uses the connection cache of that multi.
+  void Rebind(multi& multi_handle);
+
   inline native::CURL* native_handle() { return handle_; }
   engine::ev::ThreadControl& GetThreadControl();
 
@@ -230,6 +234,8 @@ class easy final : public std::enable_shared_from_this<easy> {
   void async_perform(handler_type handler);
   void cancel();
   void reset();
+  // Resumes a transfer paused by a callback, must be called in the ev thread
+  void unpause();
   void set_source(std::shared_ptr<std::istream> source);
   void set_source(std::shared_ptr<std::istream> source, std::error_code& ec);
   void set_sink(std::string* sink);
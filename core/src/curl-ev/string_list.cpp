@@ -12,19 +12,48 @@ USERVER_NAMESPACE_BEGIN
 
 namespace curl {
 
+namespace {
+
+// Bounds the memory kept by clear() for unusual requests
+constexpr std::size_t kMaxKeptElements = 64;
+constexpr std::size_t kMaxKeptElementCapacity = 1024;
+
+}  // namespace
+
 string_list::Elem::Elem(std::string new_value) : value(std::move(new_value)) {
   list_node.data = value.data();
   list_node.next = nullptr;
 }
 
-void string_list::add(std::string str) {
-  native::curl_slist* prev =
-      list_elements_.empty() ? nullptr : &list_elements_.back().list_node;
-  auto& last = list_elements_.emplace_back(std::move(str));
-  if (prev) prev->next = &last.list_node;
+void string_list::add(std::string_view str) {
+  if (size_ < list_elements_.size()) {
+    auto& elem = list_elements_[size_];
+    elem.value.assign(str);
+    elem.list_node.data = elem.value.data();
+    elem.list_node.next = nullptr;
+  } else {
+    list_elements_.emplace_back(std::string{str});
+  }
+
+  if (size_ > 0) {
+    list_elements_[size_ - 1].list_node.next = &list_elements_[size_].list_node;
+  }
+  ++size_;
 }
 
-void string_list::clear() noexcept { list_elements_.clear(); }
+void string_list::clear() noexcept {
+  size_ = 0;
+  if (list_elements_.size() > kMaxKeptElements) {
+    list_elements_.erase(list_elements_.begin() + kMaxKeptElements,
+                         list_elements_.end());
+  }
+  for (auto& elem : list_elements_) {
+    if (elem.value.capacity() > kMaxKeptElementCapacity) {
+      std::string{}.swap(elem.value);
+      elem.list_node.data = elem.value.data();
+    }
+  }
+}
 
 void string_list::ReplaceValue(Elem& list_elem, std::string&& new_value) {
   list_elem.value = std::move(new_value);
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <deque>
 #include <optional>
 #include <string>
@@ -28,20 +29,24 @@ class string_list {
   string_list& operator=(string_list&&) = delete;
 
   inline native::curl_slist* native_handle() {
-    return list_elements_.empty() ? nullptr : &list_elements_.front().list_node;
+    return size_ == 0 ? nullptr : &list_elements_.front().list_node;
   }
 
   inline const native::curl_slist* native_handle() const {
-    return list_elements_.empty() ? nullptr : &list_elements_.front().list_node;
+    return size_ == 0 ? nullptr : &list_elements_.front().list_node;
   }
 
-  void add(std::string str);
+  /// Reuses the buffer of an element dropped by clear(), if any
+  void add(std::string_view str);
+
+  /// Keeps the element buffers for the next add() calls, as the lists are
+  /// refilled with similar values for each request of an easy handle
   void clear() noexcept;
 
   template <typename Pred>
   std::optional<std::string_view> FindIf(const Pred& pred) const {
-    for (const auto& list_elem : list_elements_) {
-      const auto& value = list_elem.value;
+    for (std::size_t i = 0; i < size_; ++i) {
+      const auto& value = list_elements_[i].value;
       if (pred(value)) return value;
     }
     return std::nullopt;
@@ -49,7 +54,8 @@ class string_list {
 
   template <typename Pred>
   bool ReplaceFirstIf(const Pred& pred, std::string&& new_value) {
-    for (auto& list_elem : list_elements_) {
+    for (std::size_t i = 0; i < size_; ++i) {
+      auto& list_elem = list_elements_[i];
       const auto& value = list_elem.value;
       if (pred(value)) {
         ReplaceValue(list_elem, std::move(new_value));
@@ -61,7 +67,8 @@ class string_list {
 
   template <typename Pred>
   bool ReplaceFirstIf(const Pred& pred, const char* new_value) {
-    for (auto& list_elem : list_elements_) {
+    for (std::size_t i = 0; i < size_; ++i) {
+      auto& list_elem = list_elements_[i];
       const auto& value = list_elem.value;
       if (pred(value)) {
         ReplaceValue(list_elem, std::string{new_value});
@@ -81,7 +88,9 @@ class string_list {
 
   static void ReplaceValue(Elem& list_elem, std::string&& new_value);
 
+  // Elements past size_ are unused buffers left by clear()
   std::deque<Elem> list_elements_;
+  std::size_t size_{0};
 };
 
 }  // namespace curl
@@ -45,6 +45,23 @@ TEST(CurlStringList, Clear) {
   EXPECT_EQ(ToVector(list), expected);
 }
 
+TEST(CurlStringList, ClearKeepsBuffers) {
+  curl::string_list list;
+
+  // 100 just to avoid SSO
+  list.add(std::string(100, 'a'));
+  list.add("bbb");
+  const auto* first_data = list.native_handle()->data;
+
+  list.clear();
+  EXPECT_FALSE(list.FindIf([](std::string_view) { return true; }));
+
+  list.add(std::string(50, 'c'));
+  EXPECT_EQ(list.native_handle()->data, first_data);
+  std::vector<std::string> expected{std::string(50, 'c')};
+  EXPECT_EQ(ToVector(list), expected);
+}
+
 TEST(CurlStringList, FindIf) {
   curl::string_list list;
 
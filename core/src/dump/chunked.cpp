@@ -0,0 +1,124 @@
+#include <userver/dump/chunked.hpp>
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include <userver/compression/error.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+void StringWriter::Finish() {
+  // nothing to do
+}
+
+std::string StringWriter::Extract() && { return std::move(data_); }
+
+void StringWriter::WriteRaw(std::string_view data) { data_.append(data); }
+
+StringReader::StringReader(std::string data)
+    : data_(std::move(data)), unread_data_(data_) {}
+
+std::string_view StringReader::ReadRaw(std::size_t max_size) {
+  const auto result_size = std::min(max_size, unread_data_.size());
+  const auto result = unread_data_.substr(0, result_size);
+  unread_data_ = unread_data_.substr(result_size);
+  return result;
+}
+
+void StringReader::Finish() {
+  if (!unread_data_.empty()) {
+    throw Error(fmt::format(
+        "Unexpected extra data at the end of a dump chunk: chunk-size={}, "
+        "unread-size={}",
+        data_.size(), unread_data_.size()));
+  }
+}
+
+std::size_t GetChunksCount(std::size_t size, const ChunkedOptions& options) {
+  const auto min_chunk_size = std::max(options.min_chunk_size, std::size_t{1});
+  return std::clamp(size / min_chunk_size, std::size_t{1},
+                    std::max(options.max_chunks, std::size_t{1}));
+}
+
+Chunk MakeChunk(std::size_t elements, std::string&& data,
+                const ChunkedOptions& options) {
+  Chunk chunk;
+  chunk.header.elements = elements;
+  chunk.header.size = data.size();
+  try {
+    chunk.data =
+        options.dictionary
+            ? options.dictionary->Compress(data)
+            : compression::zstd::Compress(data, options.compression_level);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to compress a dump chunk: {}", ex.what()));
+  }
+  chunk.header.compressed_size = chunk.data.size();
+  return chunk;
+}
+
+// Format:
+// 1. total elements count
+// 2. chunks count
+// 3. chunk headers: elements count, data size, compressed data size
+// 4. compressed data of the chunks
+void WriteChunks(Writer& writer, std::size_t size,
+                 const std::vector<Chunk>& chunks) {
+  writer.Write(size);
+  writer.Write(chunks.size());
+  for (const auto& chunk : chunks) {
+    writer.Write(chunk.header.elements);
+    writer.Write(chunk.header.size);
+    writer.Write(chunk.header.compressed_size);
+  }
+  for (const auto& chunk : chunks) {
+    WriteStringViewUnsafe(writer, chunk.data);
+  }
+}
+
+std::vector<ChunkHeader> ReadChunkHeaders(Reader& reader) {
+  const auto chunks_count = reader.Read<std::size_t>();
+
+  std::vector<ChunkHeader> headers;
+  for (std::size_t i = 0; i < chunks_count; ++i) {
+    auto& header = headers.emplace_back();
+    header.elements = reader.Read<std::size_t>();
+    header.size = reader.Read<std::size_t>();
+    header.compressed_size = reader.Read<std::size_t>();
+  }
+  return headers;
+}
+
+std::string DecompressChunk(
+    std::string_view compressed, const ChunkHeader& header,
+    const compression::zstd::DictionaryRegistry* dictionaries) {
+  std::string data;
+  try {
+    data = dictionaries
+               ? dictionaries->Decompress(compressed, header.size)
+               : compression::zstd::Decompress(compressed, header.size);
+  } catch (const std::exception& ex) {
+    throw Error(
+        fmt::format("Failed to decompress a dump chunk: {}", ex.what()));
+  }
+
+  if (data.size() != header.size) {
+    throw Error(fmt::format(
+        "Unexpected size of a decompressed dump chunk: expected={}, actual={}",
+        header.size, data.size()));
+  }
+  return data;
+}
+
+void ThrowSizeMismatch(std::size_t expected, std::size_t actual) {
+  throw Error(fmt::format(
+      "Unexpected size of a chunked container: expected={}, actual={}",
+      expected, actual));
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
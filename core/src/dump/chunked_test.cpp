@@ -0,0 +1,184 @@
+#include <userver/dump/chunked.hpp>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/operations_mock.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+std::string ToChunkedBinary(const T& value,
+                            const dump::ChunkedOptions& options = {}) {
+  dump::MockWriter writer;
+  dump::WriteChunked(writer, value, options);
+  writer.Finish();
+  return std::move(writer).Extract();
+}
+
+template <typename T>
+T FromChunkedBinary(std::string data) {
+  dump::MockReader reader(std::move(data));
+  auto result = dump::ReadChunked(reader, dump::To<T>{});
+  reader.Finish();
+  return result;
+}
+
+template <typename T>
+void TestChunkedWriteReadCycle(const T& original,
+                               const dump::ChunkedOptions& options = {}) {
+  EXPECT_EQ(FromChunkedBinary<T>(ToChunkedBinary(original, options)),
+            original);
+}
+
+using Map = std::unordered_map<std::string, std::vector<int>>;
+
+Map MakeMap(int size) {
+  Map result;
+  for (int i = 0; i < size; ++i) {
+    result.emplace(std::to_string(i), std::vector<int>(i % 10, i));
+  }
+  return result;
+}
+
+// Small records that share most of their content with each other
+std::vector<std::string> MakeRecords(std::size_t count, int seed) {
+  std::vector<std::string> records;
+  records.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    records.push_back(R"({"id":")" + std::to_string(seed * 100'000 + i * 7) +
+                      R"(","status":")" + (i % 3 ? "disabled" : "active") +
+                      R"(","zone":"moscow"})");
+  }
+  return records;
+}
+
+std::size_t ReadChunksCount(std::string data) {
+  dump::MockReader reader(std::move(data));
+  reader.Read<std::size_t>();
+  return reader.Read<std::size_t>();
+}
+
+}  // namespace
+
+/// [Sample chunked dump]
+class SampleCache /* : public components::CachingComponentBase<Data> */ {
+ public:
+  using Data = Map;
+
+  void WriteContents(dump::Writer& writer, const Data& contents) const {
+    dump::WriteChunked(writer, contents);
+  }
+
+  std::unique_ptr<const Data> ReadContents(dump::Reader& reader) const {
+    return std::make_unique<const Data>(
+        dump::ReadChunked(reader, dump::To<Data>{}));
+  }
+};
+/// [Sample chunked dump]
+
+UTEST_MT(DumpChunked, Sample, 4) {
+  const auto data = MakeMap(10'000);
+  const SampleCache cache;
+
+  dump::MockWriter writer;
+  cache.WriteContents(writer, data);
+  dump::MockReader reader(std::move(writer).Extract());
+  EXPECT_EQ(*cache.ReadContents(reader), data);
+  reader.Finish();
+}
+
+UTEST_MT(DumpChunked, Containers, 4) {
+  std::vector<int> vector(12'345);
+  for (std::size_t i = 0; i < vector.size(); ++i) vector[i] = i * 7;
+  TestChunkedWriteReadCycle(vector);
+
+  std::map<int, std::string> map;
+  for (int i = 0; i < 5'000; ++i) map.emplace(i, std::to_string(i));
+  TestChunkedWriteReadCycle(map);
+
+  std::unordered_set<std::string> set;
+  for (int i = 0; i < 5'000; ++i) set.insert(std::to_string(i));
+  TestChunkedWriteReadCycle(set);
+
+  TestChunkedWriteReadCycle(std::vector<bool>(3'000, true));
+  TestChunkedWriteReadCycle(MakeMap(20'000));
+}
+
+UTEST(DumpChunked, Small) {
+  TestChunkedWriteReadCycle(std::vector<int>{});
+  TestChunkedWriteReadCycle(std::vector<int>{1, 2, 3});
+  TestChunkedWriteReadCycle(MakeMap(1));
+
+  EXPECT_EQ(ReadChunksCount(ToChunkedBinary(std::vector<int>{})), 1);
+  EXPECT_EQ(ReadChunksCount(ToChunkedBinary(std::vector<int>(1'999))), 1);
+}
+
+UTEST(DumpChunked, ChunksCount) {
+  const auto data = MakeMap(10'000);
+
+  dump::ChunkedOptions options;
+  options.max_chunks = 3;
+  options.min_chunk_size = 100;
+  EXPECT_EQ(ReadChunksCount(ToChunkedBinary(data, options)), 3);
+  TestChunkedWriteReadCycle(data, options);
+
+  options.max_chunks = 1'000;
+  options.min_chunk_size = 1'000;
+  EXPECT_EQ(ReadChunksCount(ToChunkedBinary(data, options)), 10);
+  TestChunkedWriteReadCycle(data, options);
+}
+
+UTEST(DumpChunked, Compressed) {
+  const std::vector<std::string> data(10'000, std::string(100, 'a'));
+  EXPECT_LT(ToChunkedBinary(data).size(), data.size() * data.front().size());
+}
+
+UTEST(DumpChunked, Dictionary) {
+  auto old_dictionary = std::make_shared<compression::zstd::Dictionary>(
+      compression::zstd::TrainDictionary(MakeRecords(1'000, 1), 4096));
+  auto dictionary = std::make_shared<compression::zstd::Dictionary>(
+      compression::zstd::TrainDictionary(MakeRecords(1'000, 2), 2048));
+  ASSERT_NE(old_dictionary->GetId(), dictionary->GetId());
+
+  // A dictionary pays off for small chunks
+  const auto data = MakeRecords(80, 3);
+  dump::ChunkedOptions options;
+  options.min_chunk_size = 5;
+  const auto plain_binary = ToChunkedBinary(data, options);
+  options.dictionary = old_dictionary;
+  const auto old_binary = ToChunkedBinary(data, options);
+  options.dictionary = dictionary;
+  const auto binary = ToChunkedBinary(data, options);
+  EXPECT_LT(binary.size(), plain_binary.size());
+
+  compression::zstd::DictionaryRegistry dictionaries;
+  dictionaries.Add(old_dictionary);
+  dictionaries.Add(dictionary);
+  for (const auto* chunked : {&plain_binary, &old_binary, &binary}) {
+    dump::MockReader reader(*chunked);
+    EXPECT_EQ(dump::ReadChunked(reader, dump::To<std::vector<std::string>>{},
+                                dictionaries),
+              data);
+    reader.Finish();
+  }
+
+  // The dictionary is required to read the chunks
+  EXPECT_THROW(FromChunkedBinary<std::vector<std::string>>(binary),
+               dump::Error);
+}
+
+UTEST(DumpChunked, Corrupted) {
+  const auto binary = ToChunkedBinary(MakeMap(5'000));
+  EXPECT_THROW(FromChunkedBinary<Map>(binary.substr(0, binary.size() - 1)),
+               dump::Error);
+}
+
+USERVER_NAMESPACE_END
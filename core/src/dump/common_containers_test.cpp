@@ -96,6 +96,14 @@ TEST(DumpCommonContainers, UnorderedMap) {
   TestWriteReadCycle(std::unordered_map<bool, bool>{});
 }
 
+TEST(DumpCommonContainers, FlatHashMap) {
+  TestWriteReadCycle(cache::FlatHashMap<int, std::string>{});
+
+  cache::FlatHashMap<std::string, int> map;
+  for (int i = 0; i < 1000; ++i) map.insert_or_assign(std::to_string(i), i);
+  TestWriteReadCycle(map);
+}
+
 TEST(DumpCommonContainers, Set) {
   TestWriteReadCycle(std::set<int>{1, 2, 5});
   TestWriteReadCycle(std::set<std::string>{"a", "b", "bb"});
@@ -16,11 +16,14 @@ constexpr std::string_view kDumpsEnabled = "enable";
 constexpr std::string_view kFsTaskProcessor = "fs-task-processor";
 constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
+constexpr std::string_view kMaxDeltaCount = "max-delta-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kWriteOnStop = "write-on-stop";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
+constexpr auto kDefaultMaxDeltaCount = uint64_t{0};
 
 }  // namespace
 
@@ -63,10 +66,13 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
       fs_task_processor(
           config[kFsTaskProcessor].As<std::string>(kDefaultFsTaskProcessor)),
       max_dump_count(config[kMaxDumpCount].As<uint64_t>(kDefaultMaxDumpCount)),
+      max_delta_count(
+          config[kMaxDeltaCount].As<uint64_t>(kDefaultMaxDeltaCount)),
       max_dump_age(
           config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      write_on_stop(config[kWriteOnStop].As<bool>(false)),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(
           config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
@@ -1,6 +1,7 @@
 #include <dump/dump_locator.hpp>
 
 #include <algorithm>
+#include <unordered_map>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
@@ -26,7 +27,8 @@ const std::string kTimeZone = "UTC";
 DumpLocator::DumpLocator(Config static_config)
     : config_(static_config),
       filename_regex_(GenerateFilenameRegex(FileFormatType::kNormal)),
-      tmp_filename_regex_(GenerateFilenameRegex(FileFormatType::kTmp)) {}
+      tmp_filename_regex_(GenerateFilenameRegex(FileFormatType::kTmp)),
+      delta_filename_regex_(GenerateFilenameRegex(FileFormatType::kDelta)) {}
 
 DumpFileStats DumpLocator::RegisterNewDump(TimePoint update_time) {
   std::string dump_path = GenerateDumpPath(update_time);
@@ -48,6 +50,25 @@ DumpFileStats DumpLocator::RegisterNewDump(TimePoint update_time) {
   return {update_time, std::move(dump_path), config_.dump_format_version};
 }
 
+DumpFileStats DumpLocator::RegisterNewDelta(const std::string& base_path,
+                                            TimePoint update_time) {
+  std::string delta_path = GenerateDeltaPath(base_path, update_time);
+
+  if (!boost::filesystem::is_regular_file(base_path)) {
+    throw std::runtime_error(fmt::format(
+        "{}: could not write a delta to \"{}\", because the base dump has "
+        "disappeared",
+        config_.name, delta_path));
+  }
+  if (boost::filesystem::exists(delta_path)) {
+    throw std::runtime_error(fmt::format(
+        "{}: could not dump to \"{}\", because the file already exists",
+        config_.name, delta_path));
+  }
+
+  return {update_time, std::move(delta_path), config_.dump_format_version};
+}
+
 std::optional<DumpFileStats> DumpLocator::GetLatestDump() const {
   try {
     std::optional<DumpFileStats> stats = GetLatestDumpImpl();
@@ -57,7 +78,8 @@ std::optional<DumpFileStats> DumpLocator::GetLatestDump() const {
     }
 
     LOG_DEBUG() << config_.name << ": a usable dump found, path=\""
-                << stats->full_path << "\"";
+                << stats->full_path
+                << "\", deltas=" << stats->delta_paths.size();
 
     return *std::move(stats);
   } catch (const std::exception& ex) {
@@ -79,9 +101,19 @@ bool DumpLocator::BumpDumpTime(TimePoint old_update_time,
                                                  kFilenameDateFormat);
   }
 
-  const std::string old_name = GenerateDumpPath({old_update_time});
-  const std::string new_name = GenerateDumpPath({new_update_time});
+  return RenameDump(GenerateDumpPath({old_update_time}),
+                    GenerateDumpPath({new_update_time}));
+}
+
+bool DumpLocator::BumpDeltaTime(const std::string& base_path,
+                                TimePoint old_update_time,
+                                TimePoint new_update_time) {
+  return RenameDump(GenerateDeltaPath(base_path, old_update_time),
+                    GenerateDeltaPath(base_path, new_update_time));
+}
 
+bool DumpLocator::RenameDump(const std::string& old_name,
+                             const std::string& new_name) {
   try {
     if (!boost::filesystem::is_regular_file(old_name)) {
       LOG_WARNING()
@@ -102,7 +134,13 @@ bool DumpLocator::BumpDumpTime(TimePoint old_update_time,
 
 void DumpLocator::Cleanup() {
   const auto min_update_time = MinAcceptableUpdateTime();
-  std::vector<DumpFileStats> dumps;
+
+  const auto remove_dump = [](const DumpFileStats& dump) {
+    boost::filesystem::remove(dump.full_path);
+    for (const auto& delta_path : dump.delta_paths) {
+      boost::filesystem::remove(delta_path);
+    }
+  };
 
   try {
     if (!boost::filesystem::exists(config_.dump_directory)) {
@@ -111,39 +149,31 @@ void DumpLocator::Cleanup() {
       return;
     }
 
-    for (const auto& file :
-         boost::filesystem::directory_iterator{config_.dump_directory}) {
-      if (!boost::filesystem::is_regular_file(file.status())) {
-        continue;
-      }
-
-      std::string filename = file.path().filename().string();
+    auto contents = ListDirectory();
 
-      if (utils::regex_match(filename, tmp_filename_regex_)) {
-        LOG_DEBUG() << "Removing a leftover tmp file \"" << file.path().string()
-                    << "\"";
-        boost::filesystem::remove(file);
-        continue;
-      }
+    for (const auto& tmp_file : contents.tmp_files) {
+      LOG_DEBUG() << "Removing a leftover tmp file \"" << tmp_file << "\"";
+      boost::filesystem::remove(tmp_file);
+    }
 
-      auto dump = ParseDumpName(file.path().string());
-      if (!dump) {
-        LOG_WARNING() << config_.name
-                      << ": unrelated file in the dump directory, path=\""
-                      << file.path().string() << "\"";
-        continue;
-      }
+    for (const auto& delta_path : contents.orphaned_deltas) {
+      LOG_DEBUG() << config_.name << ": removing an orphaned delta, path=\""
+                  << delta_path << "\"";
+      boost::filesystem::remove(delta_path);
+    }
 
-      if (dump->format_version < config_.dump_format_version ||
-          dump->update_time < min_update_time) {
+    std::vector<DumpFileStats> dumps;
+    for (auto& dump : contents.dumps) {
+      if (dump.format_version < config_.dump_format_version ||
+          dump.update_time < min_update_time) {
         LOG_DEBUG() << config_.name << ": removing an expired dump, path=\""
-                    << file.path().string() << "\"";
-        boost::filesystem::remove(file);
+                    << dump.full_path << "\"";
+        remove_dump(dump);
         continue;
       }
 
-      if (dump->format_version == config_.dump_format_version) {
-        dumps.push_back(std::move(*dump));
+      if (dump.format_version == config_.dump_format_version) {
+        dumps.push_back(std::move(dump));
       }
     }
 
@@ -155,7 +185,7 @@ void DumpLocator::Cleanup() {
     for (size_t i = config_.max_dump_count; i < dumps.size(); ++i) {
       LOG_DEBUG() << config_.name << ": removing an excessive dump \""
                   << dumps[i].full_path << "\"";
-      boost::filesystem::remove(dumps[i].full_path);
+      remove_dump(dumps[i]);
     }
   } catch (const std::exception& ex) {
     LOG_ERROR() << config_.name
@@ -191,6 +221,88 @@ std::optional<DumpFileStats> DumpLocator::ParseDumpName(
   return std::nullopt;
 }
 
+std::optional<std::pair<std::string, DumpLocator::DeltaFileStats>>
+DumpLocator::ParseDeltaName(std::string full_path) const {
+  const auto filename = boost::filesystem::path{full_path}.filename().string();
+
+  utils::match_results regex;
+  if (!utils::regex_match(filename, regex, delta_filename_regex_)) {
+    return std::nullopt;
+  }
+  UASSERT_MSG(regex.size() == 3,
+              fmt::format("Incorrect sub-match count: {} for filename {}",
+                          regex.size(), filename));
+
+  try {
+    const auto date = utils::datetime::Stringtime(
+        std::string{regex[2]}, kTimeZone, kFilenameDateFormat);
+    return std::pair{std::string{regex[1]},
+                     DeltaFileStats{Round(date), std::move(full_path)}};
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "A filename looks like a delta, but it is not, path=\""
+                  << filename << "\". Reason: " << ex;
+    return std::nullopt;
+  }
+}
+
+DumpLocator::DirectoryContents DumpLocator::ListDirectory() const {
+  DirectoryContents contents;
+  std::unordered_map<std::string, std::vector<DeltaFileStats>> deltas;
+
+  for (const auto& file :
+       boost::filesystem::directory_iterator{config_.dump_directory}) {
+    if (!boost::filesystem::is_regular_file(file.status())) {
+      continue;
+    }
+
+    const auto filename = file.path().filename().string();
+    if (utils::regex_match(filename, tmp_filename_regex_)) {
+      contents.tmp_files.push_back(file.path().string());
+      continue;
+    }
+
+    if (auto delta = ParseDeltaName(file.path().string())) {
+      deltas[std::move(delta->first)].push_back(std::move(delta->second));
+      continue;
+    }
+
+    auto dump = ParseDumpName(file.path().string());
+    if (!dump) {
+      LOG_WARNING() << config_.name
+                    << ": unrelated file in the dump directory, path=\""
+                    << file.path().string() << "\"";
+      continue;
+    }
+    contents.dumps.push_back(std::move(*dump));
+  }
+
+  for (auto& dump : contents.dumps) {
+    const auto filename =
+        boost::filesystem::path{dump.full_path}.filename().string();
+    const auto it = deltas.find(filename);
+    if (it == deltas.end()) continue;
+
+    auto& dump_deltas = it->second;
+    std::sort(dump_deltas.begin(), dump_deltas.end(),
+              [](const DeltaFileStats& a, const DeltaFileStats& b) {
+                return a.update_time < b.update_time;
+              });
+    for (auto& delta : dump_deltas) {
+      dump.update_time = std::max(dump.update_time, delta.update_time);
+      dump.delta_paths.push_back(std::move(delta.full_path));
+    }
+    deltas.erase(it);
+  }
+
+  for (auto& [base_filename, orphaned_deltas] : deltas) {
+    for (auto& delta : orphaned_deltas) {
+      contents.orphaned_deltas.push_back(std::move(delta.full_path));
+    }
+  }
+
+  return contents;
+}
+
 std::optional<DumpFileStats> DumpLocator::GetLatestDumpImpl() const {
   const auto min_update_time = MinAcceptableUpdateTime();
   std::optional<DumpFileStats> best_dump;
@@ -202,42 +314,30 @@ std::optional<DumpFileStats> DumpLocator::GetLatestDumpImpl() const {
       return {};
     }
 
-    for (const auto& file :
-         boost::filesystem::directory_iterator{config_.dump_directory}) {
-      if (!boost::filesystem::is_regular_file(file.status())) {
-        continue;
-      }
-
-      auto curr_dump = ParseDumpName(file.path().string());
-      if (!curr_dump) {
-        if (utils::regex_match(file.path().filename().string(),
-                               tmp_filename_regex_)) {
-          LOG_DEBUG() << "A leftover tmp file found: \"" << file.path().string()
-                      << "\". It will be removed on next Cleanup";
-        } else {
-          LOG_WARNING() << "Unrelated file in the dump directory: \""
-                        << file.path().string() << "\"";
-        }
-        continue;
-      }
+    auto contents = ListDirectory();
+    for (const auto& tmp_file : contents.tmp_files) {
+      LOG_DEBUG() << "A leftover tmp file found: \"" << tmp_file
+                  << "\". It will be removed on next Cleanup";
+    }
 
-      if (curr_dump->format_version != config_.dump_format_version) {
-        LOG_DEBUG() << "Ignoring dump \"" << curr_dump->full_path
+    for (auto& curr_dump : contents.dumps) {
+      if (curr_dump.format_version != config_.dump_format_version) {
+        LOG_DEBUG() << "Ignoring dump \"" << curr_dump.full_path
                     << "\", because its format version ("
-                    << curr_dump->format_version << ") != current version ("
+                    << curr_dump.format_version << ") != current version ("
                     << config_.dump_format_version << ")";
         continue;
       }
 
-      if (curr_dump->update_time < min_update_time && config_.max_dump_age) {
-        LOG_DEBUG() << "Ignoring dump \"" << curr_dump->full_path
+      if (curr_dump.update_time < min_update_time && config_.max_dump_age) {
+        LOG_DEBUG() << "Ignoring dump \"" << curr_dump.full_path
                     << "\", because its age is greater than the maximum "
                        "allowed dump age ("
                     << config_.max_dump_age->count() << "ms)";
         continue;
       }
 
-      if (!best_dump || curr_dump->update_time > best_dump->update_time) {
+      if (!best_dump || curr_dump.update_time > best_dump->update_time) {
         best_dump = std::move(curr_dump);
       }
     }
@@ -257,6 +357,13 @@ std::string DumpLocator::GenerateDumpPath(TimePoint update_time) const {
       config_.dump_format_version);
 }
 
+std::string DumpLocator::GenerateDeltaPath(const std::string& base_path,
+                                           TimePoint update_time) {
+  return fmt::format(
+      FMT_COMPILE("{}.delta-{}"), base_path,
+      utils::datetime::Timestring(update_time, kTimeZone, kFilenameDateFormat));
+}
+
 TimePoint DumpLocator::MinAcceptableUpdateTime() const {
   return config_.max_dump_age
              ? Round(utils::datetime::Now()) - *config_.max_dump_age
@@ -264,9 +371,22 @@ TimePoint DumpLocator::MinAcceptableUpdateTime() const {
 }
 
 std::string DumpLocator::GenerateFilenameRegex(FileFormatType type) {
-  return std::string{
-             R"(^(\d{4}-\d{2}-\d{2}T\d{2}:?\d{2}:?\d{2}\.\d{6}Z?)-v(\d+))"} +
-         (type == FileFormatType::kTmp ? "\\.tmp$" : "$");
+  const std::string dump_regex =
+      R"((\d{4}-\d{2}-\d{2}T\d{2}:?\d{2}:?\d{2}\.\d{6}Z?)-v(\d+))";
+  const std::string delta_regex =
+      R"(\.delta-(\d{4}-\d{2}-\d{2}T\d{6}\.\d{6}Z))";
+
+  switch (type) {
+    case FileFormatType::kNormal:
+      return "^" + dump_regex + "$";
+    case FileFormatType::kTmp:
+      return "^" + dump_regex + "(?:" + delta_regex + ")?\\.tmp$";
+    case FileFormatType::kDelta:
+      // The whole name of the base dump is the first sub-match
+      return R"(^(\d{4}-\d{2}-\d{2}T\d{2}:?\d{2}:?\d{2}\.\d{6}Z?-v\d+))" +
+             delta_regex + "$";
+  }
+  UINVARIANT(false, "Unexpected FileFormatType");
 }
 
 TimePoint DumpLocator::Round(std::chrono::system_clock::time_point time) {
@@ -4,6 +4,8 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <userver/dump/config.hpp>
 #include <userver/dump/helpers.hpp>
@@ -17,9 +19,12 @@ const std::string kFilenameDateFormat = "%Y-%m-%dT%H%M%E6SZ";
 const std::string kLegacyFilenameDateFormat = "%Y-%m-%dT%H:%M:%E6S";
 
 struct DumpFileStats final {
+  /// The update time of the data, including the deltas
   TimePoint update_time;
   std::string full_path;
   uint64_t format_version;
+  /// Full paths of the deltas on top of the dump, in the order of writing
+  std::vector<std::string> delta_paths{};
 };
 
 /// @brief Manages dump files on disk. Encapsulates file paths and naming scheme
@@ -35,6 +40,13 @@ class DumpLocator final {
   /// @throws On a filesystem error
   DumpFileStats RegisterNewDump(TimePoint update_time);
 
+  /// @brief Prepare the place for a new delta on top of the base dump
+  /// @note The operation is blocking, and should run in FS TaskProcessor
+  /// @note The actual creation of the file is a caller's responsibility
+  /// @throws On a filesystem error
+  DumpFileStats RegisterNewDelta(const std::string& base_path,
+                                 TimePoint update_time);
+
   /// @brief Finds the latest suitable dump
   /// @note The operation is blocking, and should run in FS TaskProcessor
   /// @returns The full path of the dump if available and fresh enough,
@@ -46,19 +58,50 @@ class DumpLocator final {
   /// @return `true` on success, `false` if the dump is not available
   bool BumpDumpTime(TimePoint old_update_time, TimePoint new_update_time);
 
-  /// @brief Removes old dumps and tmp files
+  /// @brief Modifies the update time for the last delta of a dump
+  /// @note The operation is blocking, and should run in FS TaskProcessor
+  /// @return `true` on success, `false` if the delta is not available
+  bool BumpDeltaTime(const std::string& base_path, TimePoint old_update_time,
+                     TimePoint new_update_time);
+
+  /// @brief Removes old dumps with their deltas, orphaned deltas and tmp files
   /// @note The operation is blocking, and should run in FS TaskProcessor
   /// @warning Must not be called concurrently with `RegisterNewDump`
   void Cleanup();
 
+  /// Returns the path of a full dump with the specified update time
+  std::string GenerateDumpPath(TimePoint update_time) const;
+
  private:
-  enum class FileFormatType { kNormal, kTmp };
+  enum class FileFormatType { kNormal, kTmp, kDelta };
+
+  struct DeltaFileStats final {
+    TimePoint update_time;
+    std::string full_path;
+  };
+
+  struct DirectoryContents final {
+    // Dumps of all format versions with the deltas attached
+    std::vector<DumpFileStats> dumps;
+    std::vector<std::string> tmp_files;
+    std::vector<std::string> orphaned_deltas;
+  };
 
   std::optional<DumpFileStats> ParseDumpName(std::string full_path) const;
 
+  // Returns the filename of the base dump for a delta
+  std::optional<std::pair<std::string, DeltaFileStats>> ParseDeltaName(
+      std::string full_path) const;
+
+  /// @throws On a filesystem error
+  DirectoryContents ListDirectory() const;
+
+  bool RenameDump(const std::string& old_name, const std::string& new_name);
+
   std::optional<DumpFileStats> GetLatestDumpImpl() const;
 
-  std::string GenerateDumpPath(TimePoint update_time) const;
+  static std::string GenerateDeltaPath(const std::string& base_path,
+                                       TimePoint update_time);
 
   TimePoint MinAcceptableUpdateTime() const;
 
@@ -69,6 +112,7 @@ class DumpLocator final {
   const Config config_;
   const utils::regex filename_regex_;
   const utils::regex tmp_filename_regex_;
+  const utils::regex delta_filename_regex_;
 };
 
 }  // namespace dump
@@ -1,6 +1,8 @@
 #include <dump/dump_locator.hpp>
 
 #include <set>
+#include <string>
+#include <vector>
 
 #include <dump/internal_helpers_test.hpp>
 #include <userver/fs/blocking/read.hpp>
@@ -268,4 +270,90 @@ max-age: 30m
   }
 }
 
+UTEST(DumpLocator, Deltas) {
+  using namespace std::chrono_literals;
+
+  const std::string kConfig = R"(
+enable: true
+world-readable: false
+format-version: 5
+max-age: null
+)";
+  const auto dir = fs::blocking::TempDirectory::Create();
+  dump::CreateDumps({"2015-03-22T090001.000000Z-v5"}, dir, kDumperName);
+
+  const dump::Config config{dump::ConfigFromYaml(kConfig, dir, kDumperName)};
+  dump::DumpLocator locator{config};
+
+  const auto base_stats = locator.RegisterNewDump(BaseTime());
+  fs::blocking::RewriteFileContents(base_stats.full_path, "base");
+
+  std::vector<std::string> delta_paths;
+  for (const auto delta_time : {BaseTime() + 2s, BaseTime() + 1s}) {
+    const auto delta_stats =
+        locator.RegisterNewDelta(base_stats.full_path, delta_time);
+    fs::blocking::RewriteFileContents(delta_stats.full_path, "delta");
+    delta_paths.insert(delta_paths.begin(), delta_stats.full_path);
+  }
+  EXPECT_EQ(Filename(delta_paths.back()),
+            "2015-03-22T090000.000000Z-v5.delta-2015-03-22T090002.000000Z");
+
+  {
+    // The update time of a dump is the one of its last delta
+    const auto dump_stats = locator.GetLatestDump();
+    ASSERT_TRUE(dump_stats);
+    EXPECT_EQ(dump_stats->full_path, base_stats.full_path);
+    EXPECT_EQ(dump_stats->update_time, BaseTime() + 2s);
+    EXPECT_EQ(dump_stats->delta_paths, delta_paths);
+  }
+
+  EXPECT_TRUE(locator.BumpDeltaTime(base_stats.full_path, BaseTime() + 2s,
+                                    BaseTime() + 3s));
+
+  {
+    const auto dump_stats = locator.GetLatestDump();
+    ASSERT_TRUE(dump_stats);
+    EXPECT_EQ(dump_stats->full_path, base_stats.full_path);
+    EXPECT_EQ(dump_stats->update_time, BaseTime() + 3s);
+    ASSERT_EQ(dump_stats->delta_paths.size(), 2);
+    EXPECT_EQ(Filename(dump_stats->delta_paths.back()),
+              "2015-03-22T090000.000000Z-v5.delta-2015-03-22T090003.000000Z");
+  }
+}
+
+UTEST(DumpLocator, CleanupDeltas) {
+  const std::string kConfig = R"(
+enable: true
+world-readable: false
+format-version: 5
+max-count: 1
+max-age: null
+)";
+  const auto dir = fs::blocking::TempDirectory::Create();
+
+  const std::string base = "2015-03-22T090000.000000Z-v5";
+  const std::string delta = base + ".delta-2015-03-22T090005.000000Z";
+  const std::string newer_base = "2015-03-22T090003.000000Z-v5";
+  const std::string orphaned_delta =
+      "2015-03-22T090001.000000Z-v5.delta-2015-03-22T090002.000000Z";
+  const std::string tmp_delta = base + ".delta-2015-03-22T090006.000000Z.tmp";
+  dump::CreateDumps({base, delta, newer_base, orphaned_delta, tmp_delta}, dir,
+                    kDumperName);
+
+  const dump::Config config{dump::ConfigFromYaml(kConfig, dir, kDumperName)};
+  dump::DumpLocator locator{config};
+  locator.Cleanup();
+
+  // The dumps are ordered by the update time of their last delta
+  EXPECT_EQ(dump::FilenamesInDirectory(dir, kDumperName),
+            (std::set<std::string>{base, delta}));
+
+  // A dump is removed together with its deltas
+  const std::string latest_base = "2015-03-22T090010.000000Z-v5";
+  dump::CreateDumps({latest_base}, dir, kDumperName);
+  locator.Cleanup();
+  EXPECT_EQ(dump::FilenamesInDirectory(dir, kDumperName),
+            std::set<std::string>{latest_base});
+}
+
 USERVER_NAMESPACE_END
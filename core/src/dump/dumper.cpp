@@ -48,6 +48,12 @@ void ThrowDumpUnimplemented(const std::string& name) {
 
 DumpableEntity::~DumpableEntity() = default;
 
+bool DumpableEntity::WriteDelta(dump::Writer&) const { return false; }
+
+void DumpableEntity::ReadAndApplyDelta(dump::Reader&) {
+  throw Error("Delta dumps are not supported by the dumpable entity");
+}
+
 namespace {
 
 struct UpdateTime final {
@@ -55,6 +61,13 @@ struct UpdateTime final {
   TimePoint last_modifying_update;
 };
 
+struct DeltaState final {
+  std::string base_path;
+  std::uint64_t deltas_count{0};
+  std::uintmax_t base_size{0};
+  std::uintmax_t deltas_size{0};
+};
+
 struct DumpData {
   DumpData(const Config& static_config,
            std::unique_ptr<OperationsFactory> rw_factory,
@@ -69,6 +82,8 @@ struct DumpData {
   DumpableEntity& dumpable;
   DumpLocator locator;
   std::optional<UpdateTime> dumped_update_time;
+  // The latest full dump, on top of which deltas may be written
+  std::optional<DeltaState> delta_state;
 };
 
 struct UpdateData {
@@ -132,6 +147,8 @@ class Dumper::Impl {
  private:
   void PeriodicWriteTask();
 
+  void WriteDumpOnStop() noexcept;
+
   /// @throws std::exception on failure
   void WriteDump(DumpData& dump_data);
 
@@ -141,6 +158,11 @@ class Dumper::Impl {
   void DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope,
                    DumpData& dump_data);
 
+  /// @returns `false` if a full dump should be written instead
+  /// @throws std::exception on failure
+  bool TryWriteDelta(TimePoint update_time, tracing::ScopeTime& scope,
+                     DumpData& dump_data);
+
   enum class DumpOperation { kNewDump, kBumpTime };
 
   /// @returns `update_time` of the loaded dump on success, `null` otherwise
@@ -158,6 +180,7 @@ class Dumper::Impl {
   engine::TaskProcessor& fs_task_processor_;
   Statistics statistics_;
   std::atomic<bool> tried_to_read_dump_{false};
+  std::atomic<bool> is_stopped_{false};
 
   engine::SingleConsumerEvent config_updated_signal_{NoAutoReset{}};
   engine::SingleConsumerEvent data_updated_signal_{NoAutoReset{}};
@@ -354,13 +377,27 @@ void Dumper::Impl::WriteDump(DumpData& dump_data) {
   switch (operation_type) {
     case DumpOperation::kNewDump: {
       dump_data.locator.Cleanup();
-      DoWriteDump(update_time.last_update, scope_time, dump_data);
+      if (!TryWriteDelta(update_time.last_update, scope_time, dump_data)) {
+        DoWriteDump(update_time.last_update, scope_time, dump_data);
+      }
       break;
     }
     case DumpOperation::kBumpTime: {
       UASSERT(dumped_update_time);
-      if (!dump_data.locator.BumpDumpTime(dumped_update_time->last_update,
-                                          update_time.last_update)) {
+      auto& delta_state = dump_data.delta_state;
+      const bool has_deltas = delta_state && delta_state->deltas_count != 0;
+      const bool bumped =
+          has_deltas
+              ? dump_data.locator.BumpDeltaTime(
+                    delta_state->base_path, dumped_update_time->last_update,
+                    update_time.last_update)
+              : dump_data.locator.BumpDumpTime(dumped_update_time->last_update,
+                                               update_time.last_update);
+      if (bumped && delta_state && !has_deltas) {
+        delta_state->base_path =
+            dump_data.locator.GenerateDumpPath(update_time.last_update);
+      }
+      if (!bumped) {
         DoWriteDump(update_time.last_update, scope_time, dump_data);
       }
       break;
@@ -416,11 +453,43 @@ void Dumper::Impl::CancelWriteTaskAndWait() noexcept {
   if (periodic_task_.IsValid()) {
     periodic_task_.SyncCancel();
   }
+  if (!is_stopped_.exchange(true)) {
+    WriteDumpOnStop();
+  }
+}
+
+void Dumper::Impl::WriteDumpOnStop() noexcept {
+  if (!static_config_.write_on_stop || !tried_to_read_dump_.load()) return;
+  {
+    const auto config = dynamic_config_.Read();
+    if (!config->dumps_enabled) return;
+  }
+
+  {
+    auto update_data = update_data_.Lock();
+    if (!update_data->update_time &&
+        data_signal_status_.load() != SignalStatus::kSignaled) {
+      LOG_INFO() << Name() << ": no data to write a dump on stop";
+      return;
+    }
+  }
+
+  try {
+    auto dump_data = dump_data_.Lock();
+    utils::Async(fs_task_processor_, write_span_name_, [&] {
+      WriteDump(*dump_data);
+    }).Get();
+    LOG_INFO() << Name() << ": written a dump on stop";
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << Name() << ": failed to write a dump on stop. Reason: "
+                << ex;
+  }
 }
 
 void Dumper::Impl::DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope,
                                DumpData& dump_data) {
   const auto dump_start = std::chrono::steady_clock::now();
+  dump_data.delta_state.reset();
 
   const auto dump_stats = dump_data.locator.RegisterNewDump(update_time);
   const auto& dump_path = dump_stats.full_path;
@@ -437,6 +506,61 @@ void Dumper::Impl::DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope,
       std::chrono::duration_cast<std::chrono::milliseconds>(
           std::chrono::steady_clock::now() - dump_start);
   statistics_.last_nontrivial_write_start_time = dump_start;
+
+  dump_data.delta_state = DeltaState{dump_path, 0, dump_size, 0};
+}
+
+bool Dumper::Impl::TryWriteDelta(TimePoint update_time,
+                                 tracing::ScopeTime& scope,
+                                 DumpData& dump_data) {
+  // Any failure below makes the next dump a full one
+  auto delta_state = std::exchange(dump_data.delta_state, std::nullopt);
+  if (!delta_state || !dump_data.dumped_update_time) return false;
+
+  if (delta_state->deltas_count >= static_config_.max_delta_count) {
+    LOG_DEBUG() << Name() << ": compacting " << delta_state->deltas_count
+                << " deltas into a full dump";
+    return false;
+  }
+  if (delta_state->deltas_size > delta_state->base_size) {
+    LOG_DEBUG() << Name()
+                << ": the deltas have outgrown the full dump, compacting";
+    return false;
+  }
+  // The deltas are applied in the order of their update times
+  if (update_time <= dump_data.dumped_update_time->last_update) return false;
+  // The base dump could have been removed by Cleanup due to `max-age`
+  if (!boost::filesystem::is_regular_file(delta_state->base_path)) {
+    return false;
+  }
+
+  const auto dump_start = std::chrono::steady_clock::now();
+
+  const auto delta_stats =
+      dump_data.locator.RegisterNewDelta(delta_state->base_path, update_time);
+  const auto& delta_path = delta_stats.full_path;
+  auto writer = dump_data.rw_factory->CreateWriter(delta_path, scope);
+  if (!dump_data.dumpable.WriteDelta(*writer)) {
+    // The unfinished tmp file will be removed by the next Cleanup
+    LOG_DEBUG() << Name() << ": a delta is not available, writing a full dump";
+    return false;
+  }
+  writer->Finish();
+  const auto delta_size = boost::filesystem::file_size(delta_path);
+
+  LOG_INFO() << Name() << ": a new delta has been written at \"" << delta_path
+             << '"';
+
+  statistics_.last_written_size = delta_size;
+  statistics_.last_nontrivial_write_duration =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - dump_start);
+  statistics_.last_nontrivial_write_start_time = dump_start;
+
+  ++delta_state->deltas_count;
+  delta_state->deltas_size += delta_size;
+  dump_data.delta_state = std::move(delta_state);
+  return true;
 }
 
 std::optional<TimePoint> Dumper::Impl::LoadFromDump(
@@ -456,6 +580,7 @@ std::optional<TimePoint> Dumper::Impl::LoadFromDump(
         auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime();
 
         try {
+          dump_data.delta_state.reset();
           auto dump_stats = dump_data.locator.GetLatestDump();
           if (!dump_stats) return std::optional<TimePoint>{};
 
@@ -464,6 +589,19 @@ std::optional<TimePoint> Dumper::Impl::LoadFromDump(
           dump_data.dumpable.ReadAndSet(*reader);
           reader->Finish();
 
+          DeltaState delta_state{
+              dump_stats->full_path, 0,
+              boost::filesystem::file_size(dump_stats->full_path), 0};
+          for (const auto& delta_path : dump_stats->delta_paths) {
+            auto delta_reader = dump_data.rw_factory->CreateReader(delta_path);
+            dump_data.dumpable.ReadAndApplyDelta(*delta_reader);
+            delta_reader->Finish();
+
+            ++delta_state.deltas_count;
+            delta_state.deltas_size += boost::filesystem::file_size(delta_path);
+          }
+          dump_data.delta_state = std::move(delta_state);
+
           LOG_INFO() << Name() << ": a dump has been loaded successfully";
           return std::optional{dump_stats->update_time};
         } catch (const std::exception& ex) {
@@ -562,6 +700,10 @@ properties:
                 type: integer
                 description: Old dumps over the limit are removed from disk
                 defaultDescription: 1
+            max-delta-count:
+                type: integer
+                description: The maximum number of deltas written on top of a full dump, 0 disables deltas
+                defaultDescription: 0
             min-interval:
                 type: string
                 description: "`WriteDumpAsync` calls performed in a fast succession are ignored"
@@ -574,6 +716,10 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            write-on-stop:
+                type: boolean
+                description: Whether to write the latest data on the component stop, so that the next start of the service loads it
+                defaultDescription: false
 )");
 }
 
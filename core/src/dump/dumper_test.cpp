@@ -351,6 +351,145 @@ UTEST_F(DumperFixtureNonPeriodic, ForcedReadsEnabled) {
 
 namespace {
 
+struct DeltaEntity final : public dump::DumpableEntity {
+  void GetAndWrite(dump::Writer& writer) const override {
+    writer.Write(values);
+    written_count = values.size();
+    ++full_write_count;
+  }
+
+  void ReadAndSet(dump::Reader& reader) override {
+    values = reader.Read<std::vector<int>>();
+    written_count = values.size();
+  }
+
+  bool WriteDelta(dump::Writer& writer) const override {
+    writer.Write(
+        std::vector<int>(values.begin() + written_count, values.end()));
+    written_count = values.size();
+    ++delta_write_count;
+    return true;
+  }
+
+  void ReadAndApplyDelta(dump::Reader& reader) override {
+    const auto delta = reader.Read<std::vector<int>>();
+    values.insert(values.end(), delta.begin(), delta.end());
+    written_count = values.size();
+  }
+
+  std::vector<int> values;
+  mutable std::size_t written_count{0};
+  mutable int full_write_count{0};
+  mutable int delta_write_count{0};
+};
+
+const std::string kDeltaConfig = R"(
+enable: true
+world-readable: true
+format-version: 0
+max-age:  # unlimited
+max-count: 1
+max-delta-count: 2
+)";
+
+}  // namespace
+
+UTEST(Dumper, Deltas) {
+  const auto root = fs::blocking::TempDirectory::Create();
+  const auto config = dump::ConfigFromYaml(kDeltaConfig, root, "deltas");
+  testsuite::DumpControl control{
+      testsuite::DumpControl::PeriodicsMode::kDisabled};
+  utils::statistics::Storage statistics_storage;
+  dynamic_config::StorageMock config_storage{{dump::kConfigSet, {}}};
+
+  const auto make_dumper = [&](DeltaEntity& entity) {
+    return dump::Dumper{config,
+                        dump::CreateDefaultOperationsFactory(config),
+                        engine::current_task::GetTaskProcessor(),
+                        config_storage.GetSource(),
+                        statistics_storage,
+                        control,
+                        entity};
+  };
+
+  utils::datetime::MockNowSet({});
+  DeltaEntity entity;
+  // The full dump is big enough for the deltas not to outgrow it
+  entity.values.assign(100, -1);
+  {
+    auto dumper = make_dumper(entity);
+    dumper.ReadDump();
+
+    for (int i = 0; i < 5; ++i) {
+      utils::datetime::MockSleep(1s);
+      entity.values.push_back(i);
+      dumper.OnUpdateCompleted(Now(), dump::UpdateType::kModified);
+      dumper.WriteDumpSyncDebug();
+    }
+
+    // full, delta, delta, full (compaction), delta
+    EXPECT_EQ(entity.full_write_count, 2);
+    EXPECT_EQ(entity.delta_write_count, 3);
+
+    // The time of the last delta is bumped
+    utils::datetime::MockSleep(1s);
+    dumper.OnUpdateCompleted(Now(), dump::UpdateType::kAlreadyUpToDate);
+    dumper.WriteDumpSyncDebug();
+    EXPECT_EQ(entity.full_write_count, 2);
+    EXPECT_EQ(entity.delta_write_count, 3);
+  }
+
+  // The previous full dump is removed together with its deltas
+  EXPECT_EQ(dump::FilenamesInDirectory(root, "deltas").size(), 2);
+
+  DeltaEntity loaded;
+  auto dumper = make_dumper(loaded);
+  EXPECT_EQ(dumper.ReadDump(), Now());
+  EXPECT_EQ(loaded.values, entity.values);
+}
+
+UTEST(Dumper, WriteOnStop) {
+  const auto root = fs::blocking::TempDirectory::Create();
+  const auto config = dump::ConfigFromYaml(kConfig + "write-on-stop: true\n",
+                                           root, DummyEntity::kName);
+  testsuite::DumpControl control{
+      testsuite::DumpControl::PeriodicsMode::kDisabled};
+  utils::statistics::Storage statistics_storage;
+  dynamic_config::StorageMock config_storage{{dump::kConfigSet, {}}};
+
+  const auto make_dumper = [&](DummyEntity& entity) {
+    return dump::Dumper{config,
+                        dump::CreateDefaultOperationsFactory(config),
+                        engine::current_task::GetTaskProcessor(),
+                        config_storage.GetSource(),
+                        statistics_storage,
+                        control,
+                        entity};
+  };
+
+  utils::datetime::MockNowSet({});
+  DummyEntity entity;
+  {
+    auto dumper = make_dumper(entity);
+    dumper.ReadDump();
+    entity.value = 42;
+    dumper.OnUpdateCompleted(Now(), dump::UpdateType::kModified);
+    EXPECT_EQ(entity.write_count, 0);
+
+    dumper.CancelWriteTaskAndWait();
+    EXPECT_EQ(entity.write_count, 1);
+  }
+  // The destructor does not write the dump again
+  EXPECT_EQ(entity.write_count, 1);
+
+  DummyEntity loaded;
+  auto dumper = make_dumper(loaded);
+  EXPECT_EQ(dumper.ReadDump(), Now());
+  EXPECT_EQ(loaded.value, 42);
+}
+
+namespace {
+
 /// [Sample Dumper usage]
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class SampleComponentWithDumps final : public components::ComponentBase,
@@ -0,0 +1,35 @@
+#include <userver/dump/flat_map.hpp>
+
+#include <limits>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+std::shared_ptr<const char> MakeSharedBuffer(std::string&& data) {
+  auto buffer = std::make_shared<const std::string>(std::move(data));
+  return std::shared_ptr<const char>(buffer, buffer->data());
+}
+
+void CheckFlatMapLayout(std::size_t size, std::size_t key_size,
+                        std::size_t expected_key_size, std::size_t value_size,
+                        std::size_t expected_value_size) {
+  if (key_size != expected_key_size || value_size != expected_value_size) {
+    throw Error(fmt::format(
+        "dump::FlatMap layout mismatch: key-size={} (expected {}), "
+        "value-size={} (expected {}). Did you forget to update the "
+        "format-version of the dump?",
+        key_size, expected_key_size, value_size, expected_value_size));
+  }
+
+  constexpr auto kMaxSize = std::numeric_limits<std::size_t>::max();
+  if (size > kMaxSize / std::max(key_size, value_size)) {
+    throw Error(fmt::format("dump::FlatMap size is too big: {}", size));
+  }
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
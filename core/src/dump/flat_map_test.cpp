@@ -0,0 +1,148 @@
+#include <userver/dump/flat_map.hpp>
+
+#include <string>
+
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Record final {
+  std::int64_t id;
+  double rating;
+};
+
+bool operator==(const Record& lhs, const Record& rhs) {
+  return lhs.id == rhs.id && lhs.rating == rhs.rating;
+}
+
+using RecordsMap = dump::FlatMap<std::uint64_t, Record>;
+using NamesMap = dump::FlatMap<int, std::string_view>;
+
+RecordsMap MakeRecords(int count) {
+  std::vector<std::pair<std::uint64_t, Record>> elements;
+  for (int i = count - 1; i >= 0; --i) {
+    elements.emplace_back(i * 2, Record{i, i * 0.5});
+  }
+  return RecordsMap{std::move(elements)};
+}
+
+template <typename T>
+void ExpectEqual(const T& lhs, const T& rhs) {
+  ASSERT_EQ(lhs.size(), rhs.size());
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(lhs.GetKey(i), rhs.GetKey(i));
+    EXPECT_EQ(lhs.GetValue(i), rhs.GetValue(i));
+  }
+}
+
+}  // namespace
+
+UTEST(DumpFlatMap, Sample) {
+  /// [Sample dump::FlatMap usage]
+  using Map = dump::FlatMap<int, std::string_view>;
+  const Map map{{
+      {2, "two"},
+      {1, "one"},
+      {3, "three"},
+  }};
+
+  EXPECT_EQ(map.Find(1), "one");
+  EXPECT_EQ(map.Find(4), std::nullopt);
+
+  // No per-element deserialization. If the dump is read from a plain file,
+  // `after_load` refers to the memory-mapped file.
+  const auto after_load = dump::FromBinary<Map>(dump::ToBinary(map));
+  EXPECT_EQ(after_load.Find(3), "three");
+  /// [Sample dump::FlatMap usage]
+}
+
+UTEST(DumpFlatMap, Find) {
+  const auto map = MakeRecords(1000);
+  EXPECT_EQ(map.size(), 1000);
+
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(map.Find(i * 2), (Record{i, i * 0.5}));
+    EXPECT_FALSE(map.contains(i * 2 + 1));
+  }
+
+  for (std::size_t i = 1; i < map.size(); ++i) {
+    EXPECT_LT(map.GetKey(i - 1), map.GetKey(i));
+  }
+}
+
+UTEST(DumpFlatMap, Empty) {
+  const RecordsMap map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.Find(0));
+
+  const auto after_load = dump::FromBinary<RecordsMap>(dump::ToBinary(map));
+  EXPECT_TRUE(after_load.empty());
+  EXPECT_FALSE(after_load.contains(0));
+}
+
+UTEST(DumpFlatMap, Duplicates) {
+  const NamesMap map{{{1, "first"}, {2, "two"}, {1, "second"}}};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.Find(1), "first");
+}
+
+UTEST(DumpFlatMap, WriteReadCycle) {
+  const auto records = MakeRecords(1000);
+  ExpectEqual(dump::FromBinary<RecordsMap>(dump::ToBinary(records)), records);
+
+  std::vector<std::string> names;
+  std::vector<std::pair<int, std::string_view>> elements;
+  names.reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    elements.emplace_back(i, names.emplace_back(std::string(i, 'a' + i % 26)));
+  }
+  const NamesMap names_map{std::move(elements)};
+  names.clear();
+  ExpectEqual(dump::FromBinary<NamesMap>(dump::ToBinary(names_map)),
+              names_map);
+}
+
+UTEST(DumpFlatMap, LayoutMismatch) {
+  const auto binary = dump::ToBinary(MakeRecords(10));
+  EXPECT_THROW(dump::FromBinary<NamesMap>(binary), dump::Error);
+}
+
+UTEST(DumpFlatMap, MappedFile) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+
+  const auto records = MakeRecords(10'000);
+  const NamesMap names{{{1, "one"}, {2, "two"}}};
+  {
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                            scope_time);
+    writer.Write(records);
+    writer.Write(std::string{"separator"});
+    writer.Write(names);
+    writer.Finish();
+  }
+
+  std::optional<RecordsMap> records_after_load;
+  std::optional<NamesMap> names_after_load;
+  {
+    dump::FileReader reader(path);
+    records_after_load.emplace(reader.Read<RecordsMap>());
+    EXPECT_EQ(reader.Read<std::string>(), "separator");
+    names_after_load.emplace(reader.Read<NamesMap>());
+    reader.Finish();
+  }
+
+  // The mapping outlives both the reader and the file
+  boost::filesystem::remove(path);
+  ExpectEqual(*records_after_load, records);
+  ExpectEqual(*names_after_load, names);
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,11 @@
 #include <userver/dump/operations_file.hpp>
 
+#include <sys/mman.h>
+
 #include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
 #include <stdexcept>
 #include <utility>
 
@@ -13,9 +18,27 @@ USERVER_NAMESPACE_BEGIN
 namespace dump {
 
 namespace {
+
 constexpr std::size_t kCheckTimeAfterBytes{1 << 15};
+
+// Returns nullptr if the file could not be mapped
+std::shared_ptr<const char> MapFile(std::FILE* file, std::uint64_t size) {
+  if (size == 0) return nullptr;
+
+  // Read-only shared mapping, the pages are shared with the page cache and
+  // with the other processes that map the same dump. Dump files are never
+  // modified after the rename, so the mapping is immutable.
+  void* data =
+      ::mmap(nullptr, size, PROT_READ, MAP_SHARED, ::fileno(file), 0);
+  if (data == MAP_FAILED) return nullptr;
+
+  return std::shared_ptr<const char>(
+      static_cast<const char*>(data),
+      [size](const char* ptr) { ::munmap(const_cast<char*>(ptr), size); });
 }
 
+}  // namespace
+
 FileWriter::FileWriter(std::string path, boost::filesystem::perms perms,
                        tracing::ScopeTime& scope)
     : final_path_(std::move(path)),
@@ -88,6 +111,28 @@ std::string_view FileReader::ReadRaw(std::size_t max_size) {
   return {curr_chunk_.data(), bytes_read};
 }
 
+std::shared_ptr<const char> FileReader::ReadShared(std::size_t size) {
+  if (!mapping_) {
+    mapping_size_ = file_.GetSize();
+    mapping_ = MapFile(file_.GetNative(), mapping_size_);
+    if (!mapping_) return Reader::ReadShared(size);
+  }
+
+  const auto position = file_.GetPosition();
+  if (position + size > mapping_size_) {
+    throw Error(fmt::format(
+        "Unexpected end-of-file while trying to read from the dump file "
+        "\"{}\": requested-size={}",
+        path_, size));
+  }
+  if (std::fseek(file_.GetNative(), static_cast<long>(size), SEEK_CUR) != 0) {
+    throw Error(fmt::format("Failed to seek in the dump file \"{}\": {}",
+                            path_, std::strerror(errno)));
+  }
+
+  return std::shared_ptr<const char>(mapping_, mapping_.get() + position);
+}
+
 void FileReader::Finish() {
   std::size_t bytes_read = 0;
 
@@ -1,5 +1,7 @@
 #include <userver/dump/unsafe.hpp>
 
+#include <cstring>
+
 #include <fmt/format.h>
 
 #include <userver/dump/common.hpp>
@@ -37,6 +39,21 @@ std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size) {
   return result;
 }
 
+std::shared_ptr<const char> ReadSharedUnsafe(Reader& reader,
+                                             std::size_t size) {
+  auto result = reader.ReadShared(size);
+  UASSERT(result || size == 0);
+  return result;
+}
+
+std::shared_ptr<const char> Reader::ReadShared(std::size_t size) {
+  const auto data = ReadStringViewUnsafe(*this, size);
+
+  std::shared_ptr<char> result{new char[size], std::default_delete<char[]>{}};
+  if (size != 0) std::memcpy(result.get(), data.data(), size);
+  return result;
+}
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
@@ -50,6 +50,24 @@ UTEST(DynamicConfig, SampleStructConfig) {
   EXPECT_EQ(config[kSampleStructConfig].bar_period, 42s);
 }
 
+UTEST(DynamicConfig, ReparseOnlyChanged) {
+  using dynamic_config::impl::ConfigIdGetter;
+  using dynamic_config::impl::SnapshotData;
+  const auto id = ConfigIdGetter::Get(kSampleStructConfig);
+
+  auto docs_map = dynamic_config::impl::MakeDefaultDocsMap();
+  const SnapshotData first(docs_map, SnapshotData{}, {});
+  const SnapshotData same(docs_map, first, {});
+  EXPECT_TRUE(same.IsSameValue(id, first));
+
+  docs_map.Set("SAMPLE_STRUCT_CONFIG", formats::json::FromString(R"(
+    {"is_foo_enabled": true, "bar_period_ms": 42000}
+  )"));
+  const SnapshotData changed(docs_map, same, {});
+  EXPECT_FALSE(changed.IsSameValue(id, same));
+  EXPECT_TRUE(changed.Get<SampleStructConfig>(id).is_foo_enabled);
+}
+
 struct DummyConfig final {
   int foo;
   std::string bar;
@@ -1,5 +1,8 @@
 #include <userver/dynamic_config/impl/snapshot.hpp>
 
+#include <algorithm>
+#include <optional>
+
 #include <fmt/format.h>
 
 #include <userver/compiler/demangle.hpp>
@@ -7,6 +10,7 @@
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/enumerate.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/static_registration.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -107,31 +111,44 @@ DocsMap MakeDefaultDocsMap() {
   return result;
 }
 
+struct SnapshotData::ConfigValue final {
+  struct Doc final {
+    std::string name;
+    std::optional<formats::json::Value> value;
+  };
+
+  bool CanBeReusedFor(const DocsMap& docs_map) const {
+    if (!is_reusable) return false;
+    for (const auto& doc : docs) {
+      if (docs_map.Has(doc.name) != doc.value.has_value()) return false;
+      if (doc.value && docs_map.Get(doc.name) != *doc.value) return false;
+    }
+    return true;
+  }
+
+  std::any value;
+
+  // The docs the value was parsed from. The value is reused by the next
+  // update if the docs are the same.
+  std::vector<Doc> docs;
+  bool is_reusable{false};
+};
+
 SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
   utils::impl::AssertStaticRegistrationFinished();
   user_configs_.resize(Registry().size());
 
   for (const auto& config_variable : config_variables) {
-    user_configs_[config_variable.GetId()] = config_variable.GetValue();
+    auto config = std::make_shared<ConfigValue>();
+    config->value = config_variable.GetValue();
+    user_configs_[config_variable.GetId()] = std::move(config);
   }
 }
 
 SnapshotData::SnapshotData(const DocsMap& defaults,
                            const std::vector<KeyValue>& overrides)
     : SnapshotData(overrides) {
-  utils::StreamingCpuRelax relax(1, nullptr);
-  for (const auto [id, metadata] : utils::enumerate(Registry())) {
-    if (!user_configs_[id].has_value()) {
-      relax.Relax(1);
-      try {
-        user_configs_[id] = metadata.factory(defaults);
-      } catch (const std::exception& ex) {
-        throw ConfigParseError(
-            fmt::format("{} while parsing dynamic config values. {}",
-                        compiler::GetTypeName(typeid(ex)), ex.what()));
-      }
-    }
-  }
+  ParseMissing(defaults, nullptr);
 }
 
 SnapshotData::SnapshotData(const SnapshotData& defaults,
@@ -140,20 +157,79 @@ SnapshotData::SnapshotData(const SnapshotData& defaults,
   if (defaults.IsEmpty()) return;
 
   for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (user_configs_[id].has_value()) continue;
+    if (user_configs_[id]) continue;
     user_configs_[id] = defaults.user_configs_[id];
   }
 }
 
+SnapshotData::SnapshotData(const DocsMap& docs_map,
+                           const SnapshotData& previous,
+                           const std::vector<KeyValue>& overrides)
+    : SnapshotData(overrides) {
+  ParseMissing(docs_map, previous.IsEmpty() ? nullptr : &previous);
+}
+
+void SnapshotData::ParseMissing(const DocsMap& docs_map,
+                                const SnapshotData* previous) {
+  utils::StreamingCpuRelax relax(1, nullptr);
+  for (const auto [id, metadata] : utils::enumerate(Registry())) {
+    if (user_configs_[id]) continue;
+
+    if (previous) {
+      const auto& previous_config = previous->user_configs_[id];
+      if (previous_config && previous_config->CanBeReusedFor(docs_map)) {
+        user_configs_[id] = previous_config;
+        continue;
+      }
+    }
+
+    relax.Relax(1);
+    auto config = std::make_shared<ConfigValue>();
+    DocsMapUsage usage;
+    try {
+      docs_map.SetUsageRecorder(&usage, utils::impl::InternalTag{});
+      utils::FastScopeGuard reset_recorder{[&docs_map]() noexcept {
+        docs_map.SetUsageRecorder(nullptr, utils::impl::InternalTag{});
+      }};
+      config->value = metadata.factory(docs_map);
+    } catch (const std::exception& ex) {
+      throw ConfigParseError(
+          fmt::format("{} while parsing dynamic config values. {}",
+                      compiler::GetTypeName(typeid(ex)), ex.what()));
+    }
+
+    config->is_reusable = !usage.all_names_used;
+    if (config->is_reusable) {
+      std::sort(usage.names.begin(), usage.names.end());
+      usage.names.erase(std::unique(usage.names.begin(), usage.names.end()),
+                        usage.names.end());
+      config->docs.reserve(usage.names.size());
+      for (auto& name : usage.names) {
+        auto value = docs_map.Has(name)
+                         ? std::make_optional(docs_map.Get(name))
+                         : std::nullopt;
+        config->docs.push_back({std::move(name), std::move(value)});
+      }
+    }
+    user_configs_[id] = std::move(config);
+  }
+}
+
 bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 
+bool SnapshotData::IsSameValue(ConfigId id,
+                               const SnapshotData& other) const noexcept {
+  UASSERT(id < user_configs_.size() && id < other.user_configs_.size());
+  return user_configs_[id] && user_configs_[id] == other.user_configs_[id];
+}
+
 const std::any& SnapshotData::DoGet(ConfigId id) const {
   UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
   const auto& config = user_configs_[id];
-  if (!config.has_value()) {
+  if (!config) {
     throw std::logic_error("This type is not registered as config");
   }
-  return config;
+  return config->value;
 }
 
 }  // namespace dynamic_config::impl
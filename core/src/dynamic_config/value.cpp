@@ -11,7 +11,28 @@ USERVER_NAMESPACE_BEGIN
 
 namespace dynamic_config {
 
+DocsMap::DocsMap(const DocsMap& other)
+    : docs_(other.docs_), configs_to_be_used_(other.configs_to_be_used_) {}
+
+DocsMap::DocsMap(DocsMap&& other) noexcept
+    : docs_(std::move(other.docs_)),
+      configs_to_be_used_(std::move(other.configs_to_be_used_)) {}
+
+DocsMap& DocsMap::operator=(const DocsMap& other) {
+  if (this == &other) return *this;
+  docs_ = other.docs_;
+  configs_to_be_used_ = other.configs_to_be_used_;
+  return *this;
+}
+
+DocsMap& DocsMap::operator=(DocsMap&& other) noexcept {
+  docs_ = std::move(other.docs_);
+  configs_to_be_used_ = std::move(other.configs_to_be_used_);
+  return *this;
+}
+
 formats::json::Value DocsMap::Get(std::string_view name) const {
+  RecordUsage(name);
   const auto it = utils::impl::FindTransparent(docs_, name);
   if (it == docs_.end()) {
     throw std::runtime_error(fmt::format("Can't find doc for '{}'", name));
@@ -27,6 +48,7 @@ formats::json::Value DocsMap::Get(std::string_view name) const {
 }
 
 bool DocsMap::Has(std::string_view name) const {
+  RecordUsage(name);
   return utils::impl::FindTransparent(docs_, name) != docs_.end();
 }
 
@@ -68,12 +90,14 @@ void DocsMap::MergeMissing(const DocsMap& source) {
 }
 
 std::unordered_set<std::string> DocsMap::GetNames() const {
+  if (usage_) usage_->all_names_used = true;
   std::unordered_set<std::string> names;
   for (const auto& [k, v] : docs_) names.insert(k);
   return names;
 }
 
 formats::json::Value DocsMap::AsJson() const {
+  if (usage_) usage_->all_names_used = true;
   return formats::json::ValueBuilder{docs_}.ExtractValue();
 }
 
@@ -92,6 +116,15 @@ DocsMap::GetConfigsExpectedToBeUsed(utils::impl::InternalTag) const {
   return configs_to_be_used_;
 }
 
+void DocsMap::SetUsageRecorder(impl::DocsMapUsage* usage,
+                               utils::impl::InternalTag) const {
+  usage_ = usage;
+}
+
+void DocsMap::RecordUsage(std::string_view name) const {
+  if (usage_) usage_->names.emplace_back(name);
+}
+
 }  // namespace dynamic_config
 
 USERVER_NAMESPACE_END
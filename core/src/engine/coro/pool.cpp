@@ -1,6 +1,10 @@
 #include <engine/coro/pool.hpp>
 
+#include <sys/mman.h>
+
 #include <algorithm>  // for std::max/std::min
+#include <cerrno>
+#include <cstdint>
 #include <iterator>
 #include <optional>
 
@@ -13,6 +17,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+namespace {
+
+// Kept below the saved stack pointer of an idle coroutine, covers the red zone
+// and whatever the context switch code may touch there
+constexpr std::size_t kSavedStackMarginPages = 1;
+
+}  // namespace
+
 Pool::Pool(PoolConfig config, Executor executor)
     : config_(FixupConfig(std::move(config))),
       executor_(executor),
@@ -66,6 +78,7 @@ typename Pool::CoroutinePtr Pool::GetCoroutine() {
 
 void Pool::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
   if (config_.local_cache_size == 0) {
+    ReleaseIdleStacks(&coroutine_ptr.Get(), 1, idle_coroutines_num_.load());
     const bool ok =
         // We only ever return coroutines into our 'working set'.
         used_coroutines_.enqueue(GetUsedPoolToken<moodycamel::ProducerToken>(),
@@ -108,6 +121,9 @@ void Pool::ClearLocalCache() {
         std::min(config_.max_size - current_idle_coroutines_num,
                  local_coro_buffer_.size());
 
+    ReleaseIdleStacks(local_coro_buffer_.data(),
+                      return_to_pool_from_local_cache_num,
+                      current_idle_coroutines_num);
     const bool ok = used_coroutines_.enqueue_bulk(
         GetUsedPoolToken<moodycamel::ProducerToken>(),
         std::make_move_iterator(local_coro_buffer_.begin()),
@@ -155,6 +171,55 @@ Pool::Coroutine Pool::CreateCoroutine(bool quiet) {
 
 void Pool::OnCoroutineDestruction() noexcept { --total_coroutines_num_; }
 
+void Pool::ReleaseIdleStacks(Coroutine* coroutines, std::size_t count,
+                             std::size_t idle_coroutines_num) const noexcept {
+  const auto resident_limit = config_.max_resident_idle_stacks;
+  if (idle_coroutines_num + count <= resident_limit) return;
+
+  // The stacks of the first coroutines fit into the limit
+  const auto kept = resident_limit > idle_coroutines_num
+                        ? resident_limit - idle_coroutines_num
+                        : 0;
+  for (std::size_t i = kept; i < count; ++i) {
+    ReleaseStackMemory(coroutines[i]);
+  }
+}
+
+void Pool::ReleaseStackMemory(const Coroutine& coroutine) const noexcept {
+  // The frames of the idle coroutine are above its saved stack pointer. If it
+  // is unknown, nothing can be released safely.
+  const auto saved_stack_ptr =
+      reinterpret_cast<std::uintptr_t>(GetCoroSavedStackPtr(coroutine));
+  if (!saved_stack_ptr) return;
+
+  const auto page_size = utils::sys_info::GetPageSize();
+  // The stack grows downwards from the page with the control block
+  const auto stack_begin =
+      (reinterpret_cast<std::uintptr_t>(GetCoroCbPtr(coroutine)) +
+       page_size - 1) &
+      ~(page_size - 1);
+  const auto stack_end = stack_begin - config_.stack_size;
+  UASSERT_MSG(stack_end < saved_stack_ptr && saved_stack_ptr <= stack_begin,
+              "The saved stack pointer is outside of the coroutine stack");
+
+  const auto kept_end = saved_stack_ptr & ~(page_size - 1);
+  const auto margin = kSavedStackMarginPages * page_size;
+  if (kept_end <= stack_end + margin) return;
+  const auto released_size = kept_end - margin - stack_end;
+
+  // madvise fails with EINVAL on an unaligned address
+  UASSERT(stack_end % page_size == 0);
+  UASSERT(released_size % page_size == 0);
+  // NOLINTNEXTLINE(performance-no-int-to-ptr)
+  auto* const released_begin = reinterpret_cast<void*>(stack_end);
+  // The pages are zero-filled on the next access. Failure only means that
+  // the memory is not released.
+  [[maybe_unused]] const auto ret =
+      ::madvise(released_begin, released_size, MADV_DONTNEED);
+  UASSERT_MSG(ret == 0 || errno != EINVAL,
+              "Invalid range for the coroutine stack release");
+}
+
 bool Pool::TryPopulateLocalCache() {
   if (local_coroutine_move_size_ == 0) return false;
 
@@ -176,6 +241,10 @@ void Pool::DepopulateLocalCache() {
         std::min(config_.max_size - current_idle_coroutines_num,
                  local_coroutine_move_size_);
 
+    ReleaseIdleStacks(
+        local_coro_buffer_.data() + local_coro_buffer_.size() -
+            return_to_pool_from_local_cache_num,
+        return_to_pool_from_local_cache_num, current_idle_coroutines_num);
     const bool ok = used_coroutines_.enqueue_bulk(
         GetUsedPoolToken<moodycamel::ProducerToken>(),
         std::make_move_iterator(local_coro_buffer_.end() -
@@ -41,6 +41,11 @@ class Pool final {
   Coroutine CreateCoroutine(bool quiet = false);
   void OnCoroutineDestruction() noexcept;
 
+  // Releases the memory of the idle stacks above max_resident_idle_stacks
+  void ReleaseIdleStacks(Coroutine* coroutines, std::size_t count,
+                         std::size_t idle_coroutines_num) const noexcept;
+  void ReleaseStackMemory(const Coroutine& coroutine) const noexcept;
+
   bool TryPopulateLocalCache();
   void DepopulateLocalCache();
 
@@ -12,6 +12,9 @@ PoolConfig Parse(const yaml_config::YamlConfig& value,
   config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
   config.local_cache_size =
       value["local_cache_size"].As<size_t>(config.local_cache_size);
+  config.max_resident_idle_stacks =
+      value["max_resident_idle_stacks"].As<size_t>(
+          config.max_resident_idle_stacks);
   return config;
 }
 
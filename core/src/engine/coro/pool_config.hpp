@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
@@ -14,6 +15,8 @@ struct PoolConfig {
   std::size_t max_size = 4000;
   std::size_t stack_size = 256 * 1024ULL;
   std::size_t local_cache_size = 8;
+  std::size_t max_resident_idle_stacks =
+      std::numeric_limits<std::size_t>::max();
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value,
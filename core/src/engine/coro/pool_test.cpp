@@ -0,0 +1,48 @@
+#include <engine/coro/pool.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor_pools.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(CoroPool, ReleasedIdleStacksAreReused) {
+  engine::coro::PoolConfig coro_config;
+  coro_config.initial_size = 2;
+  coro_config.max_size = 4;
+  // Every coroutine returned to the pool gets its stack released at once
+  coro_config.local_cache_size = 0;
+  coro_config.max_resident_idle_stacks = 0;
+
+  engine::ev::ThreadPoolConfig ev_config;
+  ev_config.threads = 1;
+
+  auto task_processor = engine::impl::TaskProcessorHolder::Make(
+      1, "coro-pool-test",
+      std::make_shared<engine::impl::TaskProcessorPools>(
+          std::move(coro_config), std::move(ev_config)));
+
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [] {
+    constexpr std::uint64_t kValuesCount = 8 * 1024;
+    for (std::uint64_t i = 0; i < 20; ++i) {
+      auto task = engine::AsyncNoSpan([i] {
+        std::array<std::uint64_t, kValuesCount> values{};
+        std::iota(values.begin(), values.end(), i);
+        engine::Yield();
+        return std::accumulate(values.begin(), values.end(), std::uint64_t{0});
+      });
+      EXPECT_EQ(task.Get(), kValuesCount * (kValuesCount - 1) / 2 +
+                                kValuesCount * i);
+    }
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -57,9 +57,31 @@ class pull_coroutine<FriendHijackTag> {
   static const void* GetCbPtr(const push_coroutine<T>& coro) {
     return coro.cb_;
   }
+
+  template <typename T>
+  static const boost::context::fiber* GetFiber(const push_coroutine<T>& coro) {
+    return coro.cb_ ? &coro.cb_->c : nullptr;
+  }
 };
 }  // namespace boost::coroutines2::detail
 
+// With fcontext the fiber of a suspended coroutine holds its stack pointer,
+// ucontext and winfib keep it elsewhere
+#if !defined(BOOST_USE_UCONTEXT) && !defined(BOOST_USE_WINFIB)
+#define HAS_CORO_SAVED_STACK_PTR
+
+namespace boost::context::detail {
+
+template <>
+class fiber_record<fiber, coroutines2::detail::FriendHijackTag,
+                   coroutines2::detail::FriendHijackTag> {
+ public:
+  static const void* GetFctx(const fiber& fiber) { return fiber.fctx_; }
+};
+
+}  // namespace boost::context::detail
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
@@ -71,6 +93,22 @@ const void* GetCoroCbPtr(
       boost::coroutines2::detail::FriendHijackTag>::GetCbPtr(coro);
 }
 
+const void* GetCoroSavedStackPtr(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type&
+        coro) noexcept {
+#ifdef HAS_CORO_SAVED_STACK_PTR
+  using Tag = boost::coroutines2::detail::FriendHijackTag;
+  const auto* fiber =
+      boost::coroutines2::detail::pull_coroutine<Tag>::GetFiber(coro);
+  if (!fiber) return nullptr;
+  return boost::context::detail::fiber_record<boost::context::fiber, Tag,
+                                              Tag>::GetFctx(*fiber);
+#else
+  (void)coro;
+  return nullptr;
+#endif
+}
+
 #ifdef HAS_STACK_USAGE_MONITOR
 
 namespace {
@@ -43,6 +43,17 @@ class StackUsageMonitor final {
 
 std::size_t GetCurrentTaskStackUsageBytes() noexcept;
 
+// The control block of the coroutine, it resides at the beginning of the stack
+const void* GetCoroCbPtr(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type&
+        coro) noexcept;
+
+// The stack pointer saved when the coroutine was suspended, nullptr if it
+// cannot be obtained with the current context implementation
+const void* GetCoroSavedStackPtr(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type&
+        coro) noexcept;
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include "thread.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <stdexcept>
 
@@ -61,7 +62,11 @@ Thread::~Thread() { StopEventLoop(); }
 void Thread::RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept {
   RegisterInEvLoop(payload);
 
-  if (!IsInEvThread()) {
+  // A single wakeup is enough for all the payloads pushed until the ev thread
+  // starts draining the queue. The flag is set after the Push, so the ev
+  // thread that resets it in UpdateLoopWatcherImpl sees the payload.
+  if (!IsInEvThread() &&
+      !is_wakeup_pending_.exchange(true, std::memory_order_acq_rel)) {
     ev_async_send(GetEvLoop(), &watch_update_);
   }
 }
@@ -104,6 +109,27 @@ std::uint8_t Thread::GetCurrentLoadPercent() const {
 
 const std::string& Thread::GetName() const { return name_; }
 
+void Thread::StartTimerWheelEntry(TimerWheel::Entry& entry,
+                                  Deadline deadline) noexcept {
+  UASSERT(IsInEvThread());
+  UASSERT(deadline.IsReachable());
+  const auto now = TimerWheel::Clock::now();
+  const auto fire_at = timer_wheel_.Schedule(entry, now + deadline.TimeLeft());
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  if (!ev_is_active(&timer_wheel_driver_) ||
+      fire_at < timer_wheel_driver_at_) {
+    ArmTimerWheelDriver(fire_at, now);
+  }
+}
+
+void Thread::StopTimerWheelEntry(TimerWheel::Entry& entry) noexcept {
+  UASSERT(IsInEvThread());
+  // The driver is left armed, a spurious wakeup is cheaper than the search
+  // of the next entry
+  timer_wheel_.Cancel(entry);
+}
+
 void Thread::Start() {
   auto* loop = GetEvLoop();
 
@@ -117,6 +143,9 @@ void Thread::Start() {
   ev_set_priority(&watch_update_, 1);
   ev_async_start(loop, &watch_update_);
 
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_init(&timer_wheel_driver_, TimerWheelWatcher);
+
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   ev_async_init(&watch_break_, BreakLoopWatcher);
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -170,6 +199,7 @@ void Thread::RunEvLoop() {
 
   ev_async_stop(GetEvLoop(), &watch_update_);
   ev_async_stop(GetEvLoop(), &watch_break_);
+  ev_timer_stop(GetEvLoop(), &timer_wheel_driver_);
   if (register_event_mode_ == RegisterEventMode::kDeferred) {
     ev_timer_stop(GetEvLoop(), &timers_driver_);
   } else {
@@ -191,6 +221,7 @@ void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*,
 }
 
 void Thread::UpdateLoopWatcherImpl() {
+  is_wakeup_pending_.exchange(false, std::memory_order_acq_rel);
   while (AsyncPayloadBase* payload = func_queue_.TryPop()) {
     LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), "
                 << compiler::GetTypeName(typeid(*payload));
@@ -202,6 +233,39 @@ void Thread::UpdateLoopWatcherImpl() {
   }
 }
 
+void Thread::TimerWheelWatcher(struct ev_loop* loop, ev_timer*,
+                               int) noexcept {
+  auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+  UASSERT(ev_thread != nullptr);
+  ev_thread->TimerWheelWatcherImpl();
+}
+
+void Thread::TimerWheelWatcherImpl() {
+  const auto now = TimerWheel::Clock::now();
+  timer_wheel_.Advance(now);
+
+  const auto next_event = timer_wheel_.GetNextEventTime();
+  if (next_event) {
+    ArmTimerWheelDriver(*next_event, now);
+  } else {
+    ev_timer_stop(GetEvLoop(), &timer_wheel_driver_);
+  }
+}
+
+void Thread::ArmTimerWheelDriver(TimerWheel::Clock::time_point at,
+                                 TimerWheel::Clock::time_point now) noexcept {
+  using LibEvDuration = std::chrono::duration<double>;
+  // The repeat value of 0 would stop the timer
+  constexpr LibEvDuration kMinDelay{1e-6};
+
+  timer_wheel_driver_at_ = at;
+  timer_wheel_driver_.repeat =
+      std::max(std::chrono::duration_cast<LibEvDuration>(at - now), kMinDelay)
+          .count();
+  ev_now_update(GetEvLoop());
+  ev_timer_again(GetEvLoop(), &timer_wheel_driver_);
+}
+
 void Thread::BreakLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
   auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
   UASSERT(ev_thread != nullptr);
@@ -13,6 +13,7 @@
 #include <concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <engine/ev/async_payload_base.hpp>
 #include <engine/ev/event_loop.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -54,6 +55,15 @@ class Thread final {
 
   bool IsInEvThread() const;
 
+  // Schedules the entry in the timer wheel of the thread. One ev timer per
+  // thread drives the wheel, so a lot of the timers with coarse deadlines are
+  // cheaper than the separate ev timers. Must be called in the ev thread.
+  void StartTimerWheelEntry(TimerWheel::Entry& entry,
+                            Deadline deadline) noexcept;
+
+  // Must be called in the ev thread
+  void StopTimerWheelEntry(TimerWheel::Entry& entry) noexcept;
+
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
 
@@ -71,6 +81,10 @@ class Thread final {
   static void UpdateLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
   static void UpdateTimersWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
   void UpdateLoopWatcherImpl();
+  static void TimerWheelWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
+  void TimerWheelWatcherImpl();
+  void ArmTimerWheelDriver(TimerWheel::Clock::time_point at,
+                           TimerWheel::Clock::time_point now) noexcept;
   static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
   void BreakLoopWatcherImpl();
 
@@ -80,6 +94,7 @@ class Thread final {
   void ReleaseImpl() noexcept;
 
   concurrent::impl::IntrusiveMpscQueue<AsyncPayloadBase> func_queue_{};
+  std::atomic<bool> is_wakeup_pending_{false};
 
   RegisterEventMode register_event_mode_;
 
@@ -91,6 +106,9 @@ class Thread final {
 
   ev_timer timers_driver_{};
   ev_timer stats_timer_{};
+  TimerWheel timer_wheel_;
+  ev_timer timer_wheel_driver_{};
+  TimerWheel::Clock::time_point timer_wheel_driver_at_{};
   ev_async watch_update_{};
   ev_async watch_break_{};
 
@@ -77,6 +77,17 @@ void ThreadControlBase::DoStop(ev_io& w) noexcept {
   ev_io_stop(GetEvLoop(), &w);
 }
 
+void ThreadControlBase::DoStart(TimerWheel::Entry& entry,
+                                Deadline deadline) noexcept {
+  UASSERT(IsInEvThread());
+  thread_.StartTimerWheelEntry(entry, deadline);
+}
+
+void ThreadControlBase::DoStop(TimerWheel::Entry& entry) noexcept {
+  UASSERT(IsInEvThread());
+  thread_.StopTimerWheelEntry(entry);
+}
+
 TimerThreadControl::TimerThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -89,6 +100,15 @@ void TimerThreadControl::Stop(ev_timer& w) noexcept { DoStop(w); }
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void TimerThreadControl::Again(ev_timer& w) noexcept { DoAgain(w); }
 
+void TimerThreadControl::Start(TimerWheel::Entry& entry,
+                               Deadline deadline) noexcept {
+  DoStart(entry, deadline);
+}
+
+void TimerThreadControl::Stop(TimerWheel::Entry& entry) noexcept {
+  DoStop(entry);
+}
+
 ThreadControl::ThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -0,0 +1,152 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+constexpr std::uint64_t LevelSpan(std::size_t level_bits, std::size_t level) {
+  return std::uint64_t{1} << (level_bits * level);
+}
+
+}  // namespace
+
+TimerWheel::TimerWheel(Clock::time_point now) noexcept : start_(now) {}
+
+TimerWheel::Clock::time_point TimerWheel::Schedule(
+    Entry& entry, Clock::time_point expiry) noexcept {
+  Cancel(entry);
+  entry.expiry_tick_ = std::max(ToExpiryTick(expiry), processed_tick_ + 1);
+  Insert(entry);
+  ++size_;
+  return ToTime(entry.expiry_tick_);
+}
+
+void TimerWheel::Cancel(Entry& entry) noexcept {
+  if (!entry.IsScheduled()) return;
+  entry.unlink();
+  UASSERT(size_ > 0);
+  --size_;
+}
+
+void TimerWheel::Advance(Clock::time_point now) noexcept {
+  if (now < start_) return;
+  const auto now_tick = static_cast<std::uint64_t>((now - start_) / kTick);
+
+  while (processed_tick_ < now_tick) {
+    const auto next_tick = GetNextEventTick();
+    if (!next_tick || *next_tick > now_tick) {
+      processed_tick_ = now_tick;
+      return;
+    }
+    // Nothing happens in the skipped ticks
+    processed_tick_ = *next_tick - 1;
+    ProcessTick(*next_tick);
+  }
+}
+
+std::optional<TimerWheel::Clock::time_point> TimerWheel::GetNextEventTime()
+    const noexcept {
+  const auto tick = GetNextEventTick();
+  if (!tick) return std::nullopt;
+  return ToTime(*tick);
+}
+
+std::uint64_t TimerWheel::ToExpiryTick(Clock::time_point time) const noexcept {
+  const auto since_start = time - start_;
+  if (since_start <= Clock::duration::zero()) return 0;
+  // Rounded up, an entry never fires before its expiry
+  return static_cast<std::uint64_t>(
+      (since_start + kTick - Clock::duration{1}) / kTick);
+}
+
+TimerWheel::Clock::time_point TimerWheel::ToTime(
+    std::uint64_t tick) const noexcept {
+  return start_ + tick * kTick;
+}
+
+std::optional<std::uint64_t> TimerWheel::GetNextEventTick() const noexcept {
+  if (size_ == 0) return std::nullopt;
+
+  std::optional<std::uint64_t> result;
+  // The level 0 entries fire at their ticks, the entries of the upper levels
+  // are moved down at the ticks their slot starts with
+  for (std::size_t level = 0; level < kLevels; ++level) {
+    const auto span = LevelSpan(kLevelBits, level);
+    const auto& slots = levels_[level];
+    for (std::uint64_t tick = (processed_tick_ / span + 1) * span;
+         !result || tick < *result; tick += span) {
+      if (!slots[(tick / span) % kSlots].empty()) {
+        result = tick;
+        break;
+      }
+      if (tick >= (processed_tick_ / span + kSlots) * span) break;
+    }
+  }
+  UASSERT(result);
+  return result;
+}
+
+void TimerWheel::Insert(Entry& entry) noexcept {
+  UASSERT(entry.expiry_tick_ > processed_tick_);
+  // The entries are moved down before the tick is processed, so the ones
+  // that expire at the next tick are still inserted into the level 0
+  const auto delta = entry.expiry_tick_ - (processed_tick_ + 1);
+
+  std::size_t level = 0;
+  while (level + 1 < kLevels && delta >= LevelSpan(kLevelBits, level + 1)) {
+    ++level;
+  }
+
+  auto slot_tick = entry.expiry_tick_;
+  if (delta >= LevelSpan(kLevelBits, kLevels)) {
+    // Too far away, the entry stays in the last slot of the top level until
+    // it is moved down
+    slot_tick = processed_tick_ + LevelSpan(kLevelBits, kLevels);
+  }
+
+  const auto span = LevelSpan(kLevelBits, level);
+  levels_[level][(slot_tick / span) % kSlots].push_back(entry);
+}
+
+void TimerWheel::ProcessTick(std::uint64_t tick) noexcept {
+  UASSERT(tick == processed_tick_ + 1);
+
+  std::size_t top_level = 1;
+  while (top_level < kLevels &&
+         tick % LevelSpan(kLevelBits, top_level) == 0) {
+    ++top_level;
+  }
+  // The higher levels move the entries to the slots of the lower ones that
+  // start at this tick
+  for (auto level = top_level - 1; level > 0; --level) {
+    const auto span = LevelSpan(kLevelBits, level);
+    List entries;
+    entries.swap(levels_[level][(tick / span) % kSlots]);
+    while (!entries.empty()) {
+      auto& entry = entries.front();
+      entries.pop_front();
+      Insert(entry);
+    }
+  }
+
+  processed_tick_ = tick;
+  List expired;
+  expired.swap(levels_[0][tick % kSlots]);
+  while (!expired.empty()) {
+    auto& entry = expired.front();
+    expired.pop_front();
+    UASSERT(entry.expiry_tick_ <= tick);
+    --size_;
+    entry.callback_(entry);
+  }
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <boost/intrusive/list.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+// Hierarchical timing wheel with a coarse granularity of kTick.
+//
+// The entries are kept in the intrusive lists of the slots, so scheduling and
+// cancellation are O(1) and do not allocate. The entries of the upper levels
+// are moved to the lower ones when the time approaches their expiry.
+//
+// An entry never fires before its expiry, but fires up to kTick later.
+// Not thread-safe, all the functions are called by the ev thread.
+class TimerWheel final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr std::chrono::milliseconds kTick{1};
+
+  class Entry final
+      : public boost::intrusive::list_base_hook<
+            boost::intrusive::link_mode<boost::intrusive::auto_unlink>> {
+   public:
+    using Callback = void (*)(Entry&) noexcept;
+
+    Entry(Callback callback, void* data) noexcept
+        : callback_(callback), data_(data) {}
+
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+
+    bool IsScheduled() const noexcept { return is_linked(); }
+
+    void* GetData() const noexcept { return data_; }
+
+   private:
+    friend class TimerWheel;
+
+    const Callback callback_;
+    void* const data_;
+    std::uint64_t expiry_tick_{0};
+  };
+
+  explicit TimerWheel(Clock::time_point now = Clock::now()) noexcept;
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  // Schedules a new or reschedules a scheduled entry. The expired entries fire
+  // on the next Advance(). Returns the time since which Advance() fires the
+  // entry.
+  Clock::time_point Schedule(Entry& entry, Clock::time_point expiry) noexcept;
+
+  // Does nothing if the entry is not scheduled
+  void Cancel(Entry& entry) noexcept;
+
+  // Fires the callbacks of all the entries expired by `now`. The callbacks may
+  // schedule and cancel the entries, the ones expired by `now` fire too.
+  void Advance(Clock::time_point now) noexcept;
+
+  // Returns the time of the next Advance() that has some work to do: fires
+  // or moves the entries. Returns std::nullopt if nothing is scheduled.
+  std::optional<Clock::time_point> GetNextEventTime() const noexcept;
+
+  std::size_t GetSize() const noexcept { return size_; }
+
+ private:
+  using List =
+      boost::intrusive::list<Entry,
+                             boost::intrusive::constant_time_size<false>>;
+
+  static constexpr std::size_t kLevelBits = 8;
+  static constexpr std::size_t kSlots = 1 << kLevelBits;
+  static constexpr std::size_t kLevels = 4;
+
+  std::uint64_t ToExpiryTick(Clock::time_point time) const noexcept;
+  Clock::time_point ToTime(std::uint64_t tick) const noexcept;
+  std::optional<std::uint64_t> GetNextEventTick() const noexcept;
+  void Insert(Entry& entry) noexcept;
+  void ProcessTick(std::uint64_t tick) noexcept;
+
+  const Clock::time_point start_;
+  // All the ticks up to this one are processed
+  std::uint64_t processed_tick_{0};
+  std::size_t size_{0};
+  std::array<std::array<List, kSlots>, kLevels> levels_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
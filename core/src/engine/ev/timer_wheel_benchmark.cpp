@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <engine/ev/timer_wheel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+
+void Noop(TimerWheel::Entry&) noexcept {}
+
+// Restarts of the deadlines of the running tasks, `state.range(0)` timers
+// are already scheduled
+void timer_wheel_restart(benchmark::State& state) {
+  const auto now = TimerWheel::Clock::now();
+  TimerWheel wheel{now};
+
+  std::vector<std::unique_ptr<TimerWheel::Entry>> entries;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    entries.push_back(std::make_unique<TimerWheel::Entry>(&Noop, nullptr));
+    wheel.Schedule(*entries.back(), now + std::chrono::milliseconds{100 + i});
+  }
+
+  TimerWheel::Entry entry{&Noop, nullptr};
+  std::chrono::milliseconds timeout{0};
+  for ([[maybe_unused]] auto _ : state) {
+    timeout = (timeout + std::chrono::milliseconds{7}) % 10'000;
+    wheel.Schedule(entry, now + std::chrono::seconds{1} + timeout);
+  }
+  wheel.Cancel(entry);
+}
+
+void timer_wheel_advance(benchmark::State& state) {
+  auto now = TimerWheel::Clock::now();
+  TimerWheel wheel{now};
+
+  std::vector<std::unique_ptr<TimerWheel::Entry>> entries;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    entries.push_back(std::make_unique<TimerWheel::Entry>(&Noop, nullptr));
+  }
+
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    // Each tick fires and reschedules a single timer
+    now += TimerWheel::kTick;
+    wheel.Schedule(*entries[i++ % entries.size()],
+                   now + std::chrono::seconds{1});
+    wheel.Advance(now);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(timer_wheel_restart)->RangeMultiplier(10)->Range(1, 100'000);
+BENCHMARK(timer_wheel_advance)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+USERVER_NAMESPACE_END
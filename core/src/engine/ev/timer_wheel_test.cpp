@@ -0,0 +1,167 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+using Clock = TimerWheel::Clock;
+using std::chrono::milliseconds;
+
+struct TestEntry final {
+  TestEntry() : entry(&OnFire, this) {}
+
+  static void OnFire(TimerWheel::Entry& entry) noexcept {
+    auto& self = *static_cast<TestEntry*>(entry.GetData());
+    self.fired_at.push_back(*self.now);
+    if (self.on_fire) self.on_fire();
+  }
+
+  TimerWheel::Entry entry;
+  const Clock::time_point* now{nullptr};
+  std::vector<Clock::time_point> fired_at;
+  std::function<void()> on_fire;
+};
+
+class TimerWheelTest : public ::testing::Test {
+ protected:
+  TestEntry& MakeEntry() {
+    entries_.push_back(std::make_unique<TestEntry>());
+    entries_.back()->now = &now_;
+    return *entries_.back();
+  }
+
+  void AdvanceTo(Clock::time_point time) {
+    now_ = time;
+    wheel_.Advance(now_);
+  }
+
+  void AdvanceBy(Clock::duration duration) { AdvanceTo(now_ + duration); }
+
+  const Clock::time_point start_{Clock::now()};
+  Clock::time_point now_{start_};
+  TimerWheel wheel_{start_};
+  std::vector<std::unique_ptr<TestEntry>> entries_;
+};
+
+}  // namespace
+
+TEST_F(TimerWheelTest, FiresAfterExpiry) {
+  auto& entry = MakeEntry();
+  const auto expiry = start_ + std::chrono::microseconds{1500};
+  EXPECT_EQ(wheel_.Schedule(entry.entry, expiry), start_ + milliseconds{2});
+  EXPECT_TRUE(entry.entry.IsScheduled());
+  EXPECT_EQ(wheel_.GetSize(), 1);
+  EXPECT_EQ(wheel_.GetNextEventTime(), start_ + milliseconds{2});
+
+  AdvanceTo(expiry);
+  EXPECT_TRUE(entry.fired_at.empty());
+  AdvanceTo(start_ + milliseconds{2});
+  ASSERT_EQ(entry.fired_at.size(), 1);
+  EXPECT_FALSE(entry.entry.IsScheduled());
+  EXPECT_EQ(wheel_.GetSize(), 0);
+  EXPECT_EQ(wheel_.GetNextEventTime(), std::nullopt);
+}
+
+TEST_F(TimerWheelTest, ExpiredFiresOnNextAdvance) {
+  AdvanceBy(milliseconds{10});
+  auto& entry = MakeEntry();
+  wheel_.Schedule(entry.entry, start_);
+
+  AdvanceBy(std::chrono::microseconds{100});
+  EXPECT_TRUE(entry.fired_at.empty());
+  AdvanceBy(milliseconds{1});
+  EXPECT_EQ(entry.fired_at.size(), 1);
+}
+
+TEST_F(TimerWheelTest, CancelAndReschedule) {
+  auto& cancelled = MakeEntry();
+  auto& rescheduled = MakeEntry();
+  wheel_.Schedule(cancelled.entry, start_ + milliseconds{5});
+  wheel_.Schedule(rescheduled.entry, start_ + milliseconds{5});
+  wheel_.Schedule(rescheduled.entry, start_ + milliseconds{1000});
+  EXPECT_EQ(wheel_.GetSize(), 2);
+
+  wheel_.Cancel(cancelled.entry);
+  wheel_.Cancel(cancelled.entry);
+  EXPECT_EQ(wheel_.GetSize(), 1);
+
+  AdvanceTo(start_ + milliseconds{999});
+  EXPECT_TRUE(cancelled.fired_at.empty());
+  EXPECT_TRUE(rescheduled.fired_at.empty());
+  AdvanceTo(start_ + milliseconds{1000});
+  EXPECT_EQ(rescheduled.fired_at.size(), 1);
+}
+
+TEST_F(TimerWheelTest, ScheduleFromCallback) {
+  auto& periodic = MakeEntry();
+  auto& cancelled = MakeEntry();
+  periodic.on_fire = [&] {
+    wheel_.Cancel(cancelled.entry);
+    if (periodic.fired_at.size() < 3) {
+      wheel_.Schedule(periodic.entry, now_);
+    }
+  };
+  wheel_.Schedule(periodic.entry, start_ + milliseconds{1});
+  wheel_.Schedule(cancelled.entry, start_ + milliseconds{1});
+
+  AdvanceTo(start_ + milliseconds{1});
+  EXPECT_EQ(periodic.fired_at.size(), 1);
+  EXPECT_TRUE(cancelled.fired_at.empty());
+  EXPECT_EQ(wheel_.GetSize(), 1);
+
+  // The entries scheduled by the callbacks fire in the same Advance() if
+  // they are expired by its `now`
+  AdvanceTo(start_ + milliseconds{100});
+  EXPECT_EQ(periodic.fired_at.size(), 3);
+  EXPECT_EQ(wheel_.GetSize(), 0);
+}
+
+TEST_F(TimerWheelTest, FarFuture) {
+  // Beyond the range of all the levels
+  const auto far = std::chrono::hours{24 * 100};
+  auto& entry = MakeEntry();
+  const auto expiry = wheel_.Schedule(entry.entry, start_ + far);
+
+  AdvanceTo(start_ + far / 2);
+  EXPECT_TRUE(entry.fired_at.empty());
+  AdvanceTo(expiry - milliseconds{1});
+  EXPECT_TRUE(entry.fired_at.empty());
+  AdvanceTo(expiry);
+  EXPECT_EQ(entry.fired_at.size(), 1);
+}
+
+TEST_F(TimerWheelTest, Random) {
+  std::minstd_rand rng{42};
+  std::vector<Clock::time_point> expiries;
+  for (int i = 0; i < 2000; ++i) {
+    auto& entry = MakeEntry();
+    // Covers all the levels of the wheel
+    const auto delay = std::chrono::microseconds{
+        std::uniform_int_distribution<std::int64_t>{0, 1} (rng)
+            ? rng() % 300'000
+            : rng() % 100'000'000'000};
+    expiries.push_back(wheel_.Schedule(entry.entry, start_ + delay));
+    EXPECT_GE(expiries.back(), start_ + delay);
+    EXPECT_LT(expiries.back(), start_ + delay + TimerWheel::kTick);
+  }
+
+  while (const auto next = wheel_.GetNextEventTime()) {
+    // Jumps over big gaps, slowly walks through the others
+    AdvanceTo(std::max(*next, now_ + std::chrono::microseconds{rng() % 2000}));
+  }
+
+  for (std::size_t i = 0; i < entries_.size(); ++i) {
+    ASSERT_EQ(entries_[i]->fired_at.size(), 1) << i;
+    EXPECT_GE(entries_[i]->fired_at[0], expiries[i]);
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+inline void SpinPause() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  _mm_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+// Brief spinning on a lock before the task parks, for the critical sections
+// that are shorter than a sleep + wakeup.
+//
+// The spin budget follows the observed hold times: a lock taken while spinning
+// keeps the budget at about twice the spins it took, a failed spin halves the
+// budget, so the waiters of a lock held for long mostly park at once.
+class AdaptiveSpin final {
+ public:
+  // Returns `true` if `try_lock` succeeded while spinning
+  template <typename TryLock>
+  bool Spin(TryLock&& try_lock) noexcept {
+    const auto budget = budget_.load(std::memory_order_relaxed);
+    for (std::uint32_t spins = 1; spins <= budget; ++spins) {
+      SpinPause();
+      if (try_lock()) {
+        const auto target = std::min(kMaxSpins, 2 * spins);
+        // Moving average, so that a single fast lock does not drop the budget
+        budget_.store(std::max(kMinSpins, budget - budget / 8 + target / 8),
+                      std::memory_order_relaxed);
+        return true;
+      }
+    }
+    budget_.store(std::max(kMinSpins, budget / 2), std::memory_order_relaxed);
+    return false;
+  }
+
+  std::uint32_t GetBudget() const noexcept {
+    return budget_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr std::uint32_t kMinSpins = 4;
+  static constexpr std::uint32_t kMaxSpins = 512;
+  static constexpr std::uint32_t kInitialSpins = 64;
+
+  std::atomic<std::uint32_t> budget_{kInitialSpins};
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -1,11 +1,15 @@
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 
+#include <algorithm>
 #include <atomic>
-#include <optional>
+#include <memory>
+#include <vector>
 
+#include <userver/engine/single_use_event.hpp>
+#include <userver/engine/task/task.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/impl/wait_token_storage.hpp>
 
+#include <concurrent/impl/interference_shield.hpp>
 #include <concurrent/intrusive_walkable_pool.hpp>
 #include <engine/task/task_context.hpp>
 
@@ -13,47 +17,118 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// The tasks are registered in the shard of the current thread, so that
+// the frequent detaching does not contend on a single free list and counter
+constexpr std::size_t kShardCount = 8;
+
+// Each shard holds one task count until the waiting starts
+constexpr std::int64_t kShardInitialCount = 1;
+
+std::size_t GetCurrentShardIndex() noexcept {
+  static std::atomic<std::size_t> next_index{0};
+  thread_local const std::size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed) % kShardCount;
+  return index;
+}
+
+}  // namespace
+
 struct DetachedTasksSyncBlock::Token final {
-  explicit Token(DetachedTasksSyncBlock& owner) : owner(owner) {}
+  explicit Token(Shard& shard) : shard(shard) {}
 
-  DetachedTasksSyncBlock& owner;
+  Shard& shard;
 
   concurrent::impl::IntrusiveWalkablePoolHook<Token> pool_hook{};
 
   // For cancellations
   std::atomic<TaskContext*> task{nullptr};
-
-  // For waiting for a cancelled task
-  utils::impl::WaitTokenStorage::Token wait_token{};
 };
 
-struct DetachedTasksSyncBlock::Impl final {
-  std::optional<utils::impl::WaitTokenStorage> wait_tokens{};
+struct alignas(concurrent::impl::kDestructiveInterferenceSize)
+    DetachedTasksSyncBlock::Shard final {
+  explicit Shard(Impl& owner) : owner(owner) {}
+
+  Impl& owner;
+
+  // The detached tasks of the shard plus kShardInitialCount
+  std::atomic<std::int64_t> tasks{kShardInitialCount};
+
   concurrent::impl::IntrusiveWalkablePool<
       Token, concurrent::impl::MemberHook<&Token::pool_hook>>
       cancel_tokens{};
+};
+
+struct DetachedTasksSyncBlock::Impl final {
+  explicit Impl(StopMode stop_mode)
+      : wait_for_tasks(stop_mode == StopMode::kCancelAndWait) {
+    shards.reserve(kShardCount);
+    for (std::size_t i = 0; i < kShardCount; ++i) {
+      shards.push_back(std::make_unique<Shard>(*this));
+    }
+  }
+
+  void ReleaseTask(Shard& shard) noexcept {
+    if (shard.tasks.fetch_sub(1) == 1) ReleaseShard();
+  }
+
+  void ReleaseShard() noexcept {
+    if (alive_shards.fetch_sub(1) == 1) all_tasks_completed.Send();
+  }
+
+  void WaitAllTasks() noexcept {
+    UASSERT_MSG(wait_for_tasks,
+                "The tasks are only waited for in StopMode::kCancelAndWait");
+    if (!wait_for_tasks) return;
+    if (is_waited.exchange(true)) {
+      UASSERT_MSG(false, "The tasks must be waited for at most once");
+      return;
+    }
+
+    for (auto& shard : shards) ReleaseTask(*shard);
+    ReleaseShard();
+
+    if (current_task::IsTaskProcessorThread()) {
+      all_tasks_completed.WaitNonCancellable();
+    } else {
+      // The coroutine environment has already stopped and waited for all
+      // the tasks. Same as in utils::impl::WaitTokenStorage.
+    }
+  }
+
+  const bool wait_for_tasks;
+  std::vector<std::unique_ptr<Shard>> shards;
+  // The shards with alive tasks plus one, dropped by WaitAllTasks
+  std::atomic<std::int64_t> alive_shards{kShardCount + 1};
+  SingleUseEvent all_tasks_completed;
+  std::atomic<bool> is_waited{false};
   std::atomic<TaskCancellationReason> cancel_new_tasks{
       TaskCancellationReason::kNone};
 };
 
-DetachedTasksSyncBlock::DetachedTasksSyncBlock(StopMode stop_mode) {
-  if (stop_mode == StopMode::kCancelAndWait) {
-    impl_->wait_tokens.emplace();
-  }
-}
+DetachedTasksSyncBlock::DetachedTasksSyncBlock(StopMode stop_mode)
+    : impl_(stop_mode) {}
 
 DetachedTasksSyncBlock::~DetachedTasksSyncBlock() = default;
 
 void DetachedTasksSyncBlock::Add(TaskContext& context) {
-  auto& token = impl_->cancel_tokens.Acquire([this] { return Token(*this); });
+  auto& shard = *impl_->shards[GetCurrentShardIndex()];
+  if (shard.tasks.fetch_add(1) == 0) {
+    // The shard has been released by WaitAllTasks. A task may still be
+    // detached while the wait is in progress, e.g. by another detached task.
+    if (impl_->alive_shards.fetch_add(1) == 0) {
+      utils::impl::AbortWithStacktrace(
+          "Trying to detach a task after the tasks were waited for");
+    }
+  }
+
+  auto& token =
+      shard.cancel_tokens.Acquire([&shard] { return Token(shard); });
   UASSERT(token.task == nullptr);
 
   boost::intrusive_ptr<TaskContext> context_copy(&context);
-
   token.task.store(context_copy.detach());
-  if (impl_->wait_tokens) {
-    token.wait_token = impl_->wait_tokens->GetToken();
-  }
 
   context.SetDetached(token);
 
@@ -74,41 +149,45 @@ void DetachedTasksSyncBlock::Dispose(Token& token) noexcept {
     const boost::intrusive_ptr<TaskContext> context(context_ptr,
                                                     /*add_ref=*/false);
   }
-  [[maybe_unused]] const auto wait_token = std::move(token.wait_token);
-  token.owner.impl_->cancel_tokens.Release(token);
+  auto& shard = token.shard;
+  shard.cancel_tokens.Release(token);
+  // The sync block may be destroyed right after the last task is released
+  shard.owner.ReleaseTask(shard);
 }
 
 void DetachedTasksSyncBlock::RequestCancellation(
     TaskCancellationReason reason) noexcept {
   impl_->cancel_new_tasks.store(reason);
 
-  impl_->cancel_tokens.Walk([&](Token& token) {
-    auto* const context_ptr = token.task.exchange(nullptr);
+  for (auto& shard : impl_->shards) {
+    shard->cancel_tokens.Walk([&](Token& token) {
+      auto* const context_ptr = token.task.exchange(nullptr);
 
-    if (context_ptr != nullptr) {
-      boost::intrusive_ptr<TaskContext> context(context_ptr,
-                                                /*add_ref=*/false);
-      context->RequestCancel(reason);
-    }
-  });
-
-  if (impl_->wait_tokens) {
-    impl_->wait_tokens->WaitForAllTokens();
+      if (context_ptr != nullptr) {
+        boost::intrusive_ptr<TaskContext> context(context_ptr,
+                                                  /*add_ref=*/false);
+        context->RequestCancel(reason);
+      }
+    });
   }
+
+  if (impl_->wait_for_tasks) impl_->WaitAllTasks();
 }
 
 void DetachedTasksSyncBlock::WaitAllTasksCompleteDebug() noexcept {
-  if (impl_->wait_tokens) {
-    impl_->wait_tokens->WaitForAllTokens();
-  }
+  if (impl_->wait_for_tasks) impl_->WaitAllTasks();
 }
 
 std::int64_t DetachedTasksSyncBlock::ActiveTasksApprox() const noexcept {
-  UASSERT_MSG(impl_->wait_tokens,
+  UASSERT_MSG(impl_->wait_for_tasks,
               "Task count is only available for StopMode::kCancelAndWait");
-  if (!impl_->wait_tokens) return 0;
+  if (!impl_->wait_for_tasks) return 0;
 
-  return impl_->wait_tokens->AliveTokensApprox();
+  std::int64_t tasks = 0;
+  for (const auto& shard : impl_->shards) {
+    tasks += shard->tasks.load(std::memory_order_relaxed) - kShardInitialCount;
+  }
+  return std::max(tasks, std::int64_t{0});
 }
 
 }  // namespace engine::impl
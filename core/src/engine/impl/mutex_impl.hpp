@@ -1,11 +1,16 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
 
 #include <userver/utils/assert.hpp>
 
+#include <engine/impl/adaptive_spin.hpp>
 #include <engine/impl/wait_list.hpp>
 #include <engine/impl/wait_list_light.hpp>
 #include <engine/task/task_context.hpp>
@@ -15,6 +20,15 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+// Contention counters of engine::Mutex, updated on the slow path only
+struct MutexContentionCounters final {
+  std::atomic<std::uint64_t> waits{0};
+  std::atomic<std::uint64_t> spin_acquisitions{0};
+  std::atomic<std::uint64_t> wait_time_ns{0};
+};
+
+struct NoMutexContentionCounters final {};
+
 template <class Waiters>
 class MutexImpl {
  public:
@@ -34,13 +48,33 @@ class MutexImpl {
 
   bool try_lock_until(Deadline deadline);
 
+  MutexStatistics GetStatistics() const noexcept;
+
  private:
   class MutexWaitStrategy;
 
+  // Only the WaitList allows to choose the task to wake up
+  static constexpr bool kHasHandoff = std::is_same_v<Waiters, WaitList>;
+
+  // A waiter that is overtaken by the newcomers for longer than this switches
+  // the mutex to the direct handoff, see handoff_
+  static constexpr std::chrono::milliseconds kHandoffThreshold{1};
+
+  using Clock = std::chrono::steady_clock;
+  using Counters = std::conditional_t<kHasHandoff, MutexContentionCounters,
+                                      NoMutexContentionCounters>;
+
   bool LockFastPath(TaskContext&) noexcept;
   bool LockSlowPath(TaskContext&, Deadline);
+  bool LockByWaiting(TaskContext&, Deadline);
 
   std::atomic<TaskContext*> owner_;
+  AdaptiveSpin spin_;
+  // While set, unlock() passes the ownership to the first waiter instead of
+  // releasing the mutex, and the newcomers do not spin, so they can not
+  // overtake the waiters that starve
+  std::atomic<bool> handoff_{false};
+  Counters counters_;
   Waiters lock_waiters_;
 };
 
@@ -121,23 +155,71 @@ bool MutexImpl<Waiters>::LockFastPath(TaskContext& current) noexcept {
 
 template <class Waiters>
 bool MutexImpl<Waiters>::LockSlowPath(TaskContext& current, Deadline deadline) {
-  TaskContext* expected = nullptr;
+  UINVARIANT(owner_.load(std::memory_order_relaxed) != &current,
+             "MutexImpl is locked twice from the same task");
+
+  if (!handoff_.load(std::memory_order_relaxed) && spin_.Spin([&] {
+        return owner_.load(std::memory_order_relaxed) == nullptr &&
+               LockFastPath(current);
+      })) {
+    if constexpr (kHasHandoff) {
+      counters_.spin_acquisitions.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+  }
 
-  const engine::TaskCancellationBlocker block_cancels;
-  MutexWaitStrategy wait_manager{*this, current};
-  while (!owner_.compare_exchange_strong(expected, &current,
-                                         std::memory_order_relaxed)) {
-    UINVARIANT(expected != &current,
-               "MutexImpl is locked twice from the same task");
+  return LockByWaiting(current, deadline);
+}
 
-    const auto wakeup_source = current.Sleep(wait_manager, deadline);
-    if (!HasWaitSucceeded(wakeup_source)) {
-      return false;
+template <class Waiters>
+bool MutexImpl<Waiters>::LockByWaiting(TaskContext& current,
+                                       Deadline deadline) {
+  [[maybe_unused]] const auto wait_start =
+      kHasHandoff ? Clock::now() : Clock::time_point{};
+  [[maybe_unused]] bool was_woken_up = false;
+  bool locked = false;
+
+  {
+    const engine::TaskCancellationBlocker block_cancels;
+    MutexWaitStrategy wait_manager{*this, current};
+    while (true) {
+      TaskContext* expected = nullptr;
+      if (owner_.compare_exchange_strong(expected, &current,
+                                         std::memory_order_acquire)) {
+        locked = true;
+        break;
+      }
+      if constexpr (kHasHandoff) {
+        if (was_woken_up && Clock::now() - wait_start > kHandoffThreshold) {
+          handoff_.store(true, std::memory_order_relaxed);
+        }
+      }
+
+      const auto wakeup_source = current.Sleep(wait_manager, deadline);
+      if constexpr (kHasHandoff) {
+        // The ownership might have been passed by unlock() under the
+        // WaitList::Lock, which is held again after the Sleep
+        if (owner_.load(std::memory_order_acquire) == &current) {
+          if (Clock::now() - wait_start < kHandoffThreshold) {
+            handoff_.store(false, std::memory_order_relaxed);
+          }
+          locked = true;
+          break;
+        }
+      }
+      if (!HasWaitSucceeded(wakeup_source)) break;
+      was_woken_up = true;
     }
+  }
 
-    expected = nullptr;
+  if constexpr (kHasHandoff) {
+    const auto wait_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - wait_start);
+    counters_.waits.fetch_add(1, std::memory_order_relaxed);
+    counters_.wait_time_ns.fetch_add(wait_time.count(),
+                                     std::memory_order_relaxed);
   }
-  return true;
+  return locked;
 }
 
 template <class Waiters>
@@ -150,6 +232,25 @@ void MutexImpl<Waiters>::unlock() {
 #if USERVER_IMPL_HAS_TSAN
   __tsan_mutex_pre_unlock(this, 0);
 #endif
+  if constexpr (kHasHandoff) {
+    if (handoff_.load(std::memory_order_relaxed) &&
+        lock_waiters_.GetCountOfSleepies()) {
+      WaitList::Lock lock(lock_waiters_);
+      if (auto next = lock_waiters_.PopFront(lock)) {
+        UASSERT(owner_.load()->IsCurrent());
+        owner_.store(next.get(), std::memory_order_release);
+        next->Wakeup(TaskContext::WakeupSource::kWaitList,
+                     TaskContext::NoEpoch{});
+#if USERVER_IMPL_HAS_TSAN
+        __tsan_mutex_post_unlock(this, 0);
+#endif
+        return;
+      }
+      // Nobody starves anymore
+      handoff_.store(false, std::memory_order_relaxed);
+    }
+  }
+
   auto* old_owner = owner_.exchange(nullptr, std::memory_order_acq_rel);
   UASSERT(old_owner && old_owner->IsCurrent());
 
@@ -204,6 +305,18 @@ bool MutexImpl<Waiters>::try_lock_until(Deadline deadline) {
   return result;
 }
 
+template <class Waiters>
+MutexStatistics MutexImpl<Waiters>::GetStatistics() const noexcept {
+  static_assert(kHasHandoff, "Only engine::Mutex keeps the statistics");
+  MutexStatistics result;
+  result.waits = counters_.waits.load(std::memory_order_relaxed);
+  result.spin_acquisitions =
+      counters_.spin_acquisitions.load(std::memory_order_relaxed);
+  result.wait_time = std::chrono::nanoseconds{
+      counters_.wait_time_ns.load(std::memory_order_relaxed)};
+  return result;
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
@@ -1,10 +1,8 @@
 #include <userver/engine/impl/task_local_storage.hpp>
 
 #include <fmt/format.h>
-#include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
 #include <boost/intrusive/slist.hpp>
-#include <boost/range/adaptor/reversed.hpp>
 
 #include <engine/task/task_context.hpp>
 #include <userver/compiler/demangle.hpp>
@@ -47,10 +45,63 @@ using NormalDataList = boost::intrusive::slist<
     boost::intrusive::constant_time_size<false>, boost::intrusive::linear<true>,
     boost::intrusive::cache_last<false>>;
 
-using InheritedDataList = boost::intrusive::list<
-    DataPtr,
-    boost::intrusive::member_hook<DataPtr, ListHook, &DataPtr::list_hook>,
-    boost::intrusive::constant_time_size<false>>;
+// An immutable once shared table of the inherited variables. The child tasks
+// share the table of their parent, the table is copied on the first
+// modification of a shared one. So the task spawn cost does not depend on
+// the number of the inherited variables.
+class InheritedSnapshot final {
+ public:
+  InheritedSnapshot()
+      : nodes_(std::make_unique<InheritedDataBase*[]>(variable_count)) {}
+
+  InheritedSnapshot(const InheritedSnapshot& other) : InheritedSnapshot() {
+    for (Key key = 0; key < variable_count; ++key) {
+      nodes_[key] = other.nodes_[key];
+      if (nodes_[key]) nodes_[key]->AddRef();
+    }
+  }
+
+  InheritedSnapshot& operator=(const InheritedSnapshot&) = delete;
+
+  ~InheritedSnapshot() {
+    for (Key key = 0; key < variable_count; ++key) {
+      if (nodes_[key]) nodes_[key]->DeleteSelf();
+    }
+  }
+
+  void AddRef() noexcept {
+    ref_counter_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Release() noexcept {
+    if (ref_counter_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+  bool IsShared() const noexcept {
+    return ref_counter_.load(std::memory_order_acquire) != 1;
+  }
+
+  InheritedDataBase*& operator[](Key key) noexcept {
+    UASSERT(key < variable_count);
+    return nodes_[key];
+  }
+
+ private:
+  std::atomic<std::size_t> ref_counter_{1};
+  const std::unique_ptr<InheritedDataBase*[]> nodes_;
+};
+
+// Not final for the empty base optimization in std::unique_ptr
+struct InheritedSnapshotReleaser {
+  void operator()(InheritedSnapshot* snapshot) const noexcept {
+    snapshot->Release();
+  }
+};
+
+using InheritedSnapshotPtr =
+    std::unique_ptr<InheritedSnapshot, InheritedSnapshotReleaser>;
 
 }  // namespace
 
@@ -71,9 +122,12 @@ void ReportVariableNotSet(const std::type_info& type) {
 struct Storage::Impl final {
   std::unique_ptr<DataPtr[]> data;
   NormalDataList normal_data_storage;
-  InheritedDataList inherited_data_storage;
+  InheritedSnapshotPtr inherited_data;
 
   void DoSetGeneric(Key key, DataBase& node);
+
+  // Returns the snapshot owned by this storage only, copies the shared one
+  InheritedSnapshot& GetUniqueInheritedData();
 };
 
 Storage::Storage() { utils::impl::AssertStaticRegistrationFinished(); }
@@ -90,79 +144,67 @@ Storage::~Storage() {
   while (!impl_->normal_data_storage.empty()) {
     impl_->normal_data_storage.pop_front_and_dispose(disposer);
   }
-
-  while (!impl_->inherited_data_storage.empty()) {
-    impl_->inherited_data_storage.pop_front_and_dispose(disposer);
-  }
 }
 
 void Storage::InheritFrom(Storage& other) {
   UASSERT(impl_->normal_data_storage.empty());
-  UASSERT(impl_->inherited_data_storage.empty());
+  UASSERT(!impl_->inherited_data);
 
-  if (!other.impl_->inherited_data_storage.empty() && !impl_->data) {
-    impl_->data = std::make_unique<DataPtr[]>(variable_count);
-  }
-
-  for (DataPtr& their_ptr :
-       other.impl_->inherited_data_storage | boost::adaptors::reversed) {
-    UASSERT(their_ptr.ptr);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
+  auto* const snapshot = other.impl_->inherited_data.get();
+  if (!snapshot) return;
 
-    InheritNode(node);
-  }
+  snapshot->AddRef();
+  impl_->inherited_data.reset(snapshot);
 }
 
 void Storage::InheritNodeIfExists(Storage& other, Key key) {
   UASSERT(key < variable_count);
 
   // we want to stop asap if there is nothing to copy
-  if (!other.impl_->data) {
-    return;
-  }
-  auto& their_ptr = other.impl_->data[key];
-  if (!their_ptr.ptr) {
+  InheritedDataBase* const node = other.GetInherited(key);
+  if (!node) {
     return;
   }
 
-  if (!impl_->data) {
-    impl_->data = std::make_unique<DataPtr[]>(variable_count);
-  }
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-  auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
-
-  InheritNode(node);
-}
-
-void Storage::InheritNode(InheritedDataBase& node) {
-  UASSERT(node.GetKey() < variable_count);
-
-  auto& our_ptr = impl_->data[node.GetKey()];
-  UASSERT(!our_ptr.ptr);
-  our_ptr.ptr = &node;
-  impl_->inherited_data_storage.push_front(our_ptr);
-  node.AddRef();
+  auto& our_ptr = impl_->GetUniqueInheritedData()[key];
+  UASSERT(!our_ptr);
+  our_ptr = node;
+  node->AddRef();
 }
 
 void Storage::InitializeFrom(Storage&& other) noexcept {
   UASSERT(impl_->normal_data_storage.empty());
-  UASSERT(impl_->inherited_data_storage.empty());
+  UASSERT(!impl_->inherited_data);
   impl_ = std::move(other.impl_);
 }
 
-DataBase* Storage::GetGeneric(Key key) noexcept {
+DataBase* Storage::GetNormal(Key key) noexcept {
   UASSERT(key < variable_count);
   if (!impl_->data) return nullptr;
   return impl_->data[key].ptr;
 }
 
+InheritedDataBase* Storage::GetInherited(Key key) noexcept {
+  UASSERT(key < variable_count);
+  if (!impl_->inherited_data) return nullptr;
+  return (*impl_->inherited_data)[key];
+}
+
 void Storage::Impl::DoSetGeneric(Key key, DataBase& node) {
   UASSERT(key < variable_count);
   if (!data) data = std::make_unique<DataPtr[]>(variable_count);
   data[key].ptr = &node;
 }
 
+InheritedSnapshot& Storage::Impl::GetUniqueInheritedData() {
+  if (!inherited_data) {
+    inherited_data.reset(new InheritedSnapshot());
+  } else if (inherited_data->IsShared()) {
+    inherited_data.reset(new InheritedSnapshot(*inherited_data));
+  }
+  return *inherited_data;
+}
+
 void Storage::SetGeneric(Key key, NormalDataBase& node,
                          bool has_existing_variable) {
   impl_->DoSetGeneric(key, node);
@@ -172,25 +214,17 @@ void Storage::SetGeneric(Key key, NormalDataBase& node,
 }
 
 void Storage::SetGeneric(Key key, InheritedDataBase& node,
-                         bool has_existing_variable) {
-  impl_->DoSetGeneric(key, node);
-  if (!has_existing_variable) {
-    impl_->inherited_data_storage.push_front(impl_->data[key]);
-  }
+                         bool /*has_existing_variable*/) {
+  // The old node, if any, stays referenced by the copy of a shared snapshot
+  // and is released by the caller
+  impl_->GetUniqueInheritedData()[key] = &node;
 }
 
-void Storage::EraseInherited(Key key) noexcept {
-  UASSERT(key < variable_count);
-  if (!impl_->data) return;
-
-  auto& data_ptr = impl_->data[key];
-  auto* const data = data_ptr.ptr;
-  if (!data) return;
+void Storage::EraseInherited(Key key) {
+  if (!GetInherited(key)) return;
 
-  data_ptr.ptr = nullptr;
-  impl_->inherited_data_storage.erase(
-      InheritedDataList::s_iterator_to(data_ptr));
-  data->DeleteSelf();
+  auto& node = impl_->GetUniqueInheritedData()[key];
+  std::exchange(node, nullptr)->DeleteSelf();
 }
 
 Variable::Variable() : key_(RegisterVariable()) {}
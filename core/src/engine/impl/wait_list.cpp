@@ -60,6 +60,17 @@ void WaitList::Append(
   waiting_contexts_->push_back(*context.detach());  // referencing, not copying!
 }
 
+boost::intrusive_ptr<impl::TaskContext> WaitList::PopFront(
+    Lock& lock) noexcept {
+  UASSERT(lock);
+  if (waiting_contexts_->empty()) return nullptr;
+
+  boost::intrusive_ptr<impl::TaskContext> context(&waiting_contexts_->front(),
+                                                  kAdopt);
+  context->wait_list_hook.unlink();
+  return context;
+}
+
 void WaitList::WakeupOne(Lock& lock) {
   UASSERT(lock);
   if (!waiting_contexts_->empty()) {
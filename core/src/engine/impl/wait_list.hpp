@@ -65,6 +65,10 @@ class WaitList final {
   /// @brief Remove the task from the `WaitList` without wakeup
   void Remove(Lock& lock, impl::TaskContext& context) noexcept;
 
+  /// @brief Remove the first task from the `WaitList` without wakeup
+  /// @returns nullptr if the `WaitList` is empty
+  boost::intrusive_ptr<impl::TaskContext> PopFront(Lock& lock) noexcept;
+
   void WakeupOne(Lock&);
   void WakeupAll(Lock&);
 
@@ -245,6 +245,9 @@ size_t Direction::PerformIo(SingleUserGuard&, IoFunc&& io_func, void* buf,
       if (mode == TransferMode::kOnce) {
         break;
       }
+      // A short transfer is retried rather than followed by a wait: the retry
+      // picks up the data that arrived meanwhile, and the kPartial callers
+      // get all the data that is already available
     } else if (!chunk_size || TryHandleError(errno, pos - begin, mode, deadline,
                                              context...) == ErrorMode::kFatal) {
       break;
@@ -6,6 +6,7 @@
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 #include <engine/ev/thread_control.hpp>
 #include <engine/ev/watcher.hpp>
@@ -37,17 +38,29 @@ utils::Flags<Poller::Event::Type> FromEvEvents(int ev_events) {
 
 }  // namespace
 
-struct Poller::IoWatcher {
-  explicit IoWatcher(Poller&);
+// The (re)starts of the ev_io are coalesced: IoWatcher is enqueued onto the
+// ev thread at most once, and the ev thread applies the latest requested
+// events. No allocations are done for Poller::Add.
+struct Poller::IoWatcher final
+    : public ev::MultiShotAsyncPayload<Poller::IoWatcher> {
+  IoWatcher(Poller&, int fd);
+  ~IoWatcher();
 
   IoWatcher(const IoWatcher&) = delete;
   IoWatcher(IoWatcher&&) = delete;
 
   static void IoEventCb(struct ev_loop*, ev_io*, int) noexcept;
 
+  // Must be called on the ev thread
+  void DoPerformAndRelease();
+
   Poller& poller;
+  const int fd;
   std::atomic<size_t> coro_epoch;
   size_t ev_epoch{0};
+  std::atomic<int> ev_events{0};
+  std::atomic<size_t> pending_ops{0};
+  ev::ThreadControl thread_control;
   ev::Watcher<ev_io> ev_watcher;
   utils::AtomicFlags<Event::Type> awaited_events;
 };
@@ -64,23 +77,20 @@ Poller::Poller(
       event_producer_(queue->GetProducer()) {}
 
 void Poller::Add(int fd, utils::Flags<Event::Type> events) {
-  auto& watcher = watchers_->emplace(fd, *this).first->second;
+  auto& watcher = watchers_->try_emplace(fd, *this, fd).first->second;
 
   const auto old_events = watcher.awaited_events.Exchange(events);
   if (old_events == events) return;
 
+  // ev_events are stored before the epoch, so the ev thread that sees the
+  // new epoch also sees the new events.
+  watcher.ev_events.store(ToEvEvents(events), std::memory_order_relaxed);
   ++watcher.coro_epoch;
-  watcher.ev_watcher.RunInBoundEvLoopAsync([&watcher, fd,
-                                            should_stop = !!old_events,
-                                            ev_events = ToEvEvents(events)] {
-    // watcher lifetime is guarded by ev_watcher dtor
-    if (should_stop) watcher.ev_watcher.Stop();
-    ++watcher.ev_epoch;
-    if (ev_events && watcher.ev_epoch == watcher.coro_epoch) {
-      watcher.ev_watcher.Set(fd, ev_events);
-      watcher.ev_watcher.Start();
-    }
-  });
+  if (watcher.PrepareEnqueue()) {
+    // watcher lifetime is guarded by pending_ops in ~IoWatcher
+    ++watcher.pending_ops;
+    watcher.thread_control.RunPayloadInEvLoopAsync(watcher);
+  }
 }
 
 void Poller::Remove(int fd) {
@@ -106,10 +116,11 @@ void Poller::RemoveImpl(Poller::IoWatcher& watcher) {
   //
   // Watching a bad fd results in EV_ERROR, which is an application bug.
 
+  watcher.ev_events.store(0, std::memory_order_relaxed);
   ++watcher.coro_epoch;
   watcher.ev_watcher.RunInBoundEvLoopSync([&watcher] {
     watcher.ev_watcher.Stop();
-    ++watcher.ev_epoch;
+    watcher.ev_epoch = watcher.coro_epoch;
   });
 }
 
@@ -181,13 +192,43 @@ void Poller::IoWatcher::IoEventCb(struct ev_loop*, ev_io* watcher,
   watcher_meta->ev_watcher.Stop();
 }
 
-Poller::IoWatcher::IoWatcher(Poller& owner)
+void Poller::IoWatcher::DoPerformAndRelease() {
+  utils::FastScopeGuard release_guard([this]() noexcept {
+    // *this may be destroyed right after the decrement
+    pending_ops.fetch_sub(1, std::memory_order_release);
+  });
+
+  // Several Add() calls may be coalesced into a single execution, and an Add()
+  // may race with this function. In the latter case *this is enqueued again,
+  // so the latest events are always applied.
+  const auto epoch = coro_epoch.load();
+  const auto events = ev_events.load(std::memory_order_relaxed);
+
+  ev_watcher.Stop();
+  ev_epoch = epoch;
+  if (events) {
+    ev_watcher.Set(fd, events);
+    ev_watcher.Start();
+  }
+}
+
+Poller::IoWatcher::IoWatcher(Poller& owner, int watched_fd)
     : poller(owner),
+      fd(watched_fd),
       coro_epoch{0},
-      ev_watcher(engine::current_task::GetEventThread(), this) {
+      thread_control(engine::current_task::GetEventThread()),
+      ev_watcher(thread_control, this) {
   ev_watcher.Init(&IoEventCb);
 }
 
+Poller::IoWatcher::~IoWatcher() {
+  if (pending_ops.load(std::memory_order_acquire) != 0) {
+    // The ev thread processes the payloads in order, so after this call
+    // DoPerformAndRelease() is done with *this
+    ev_watcher.RunInBoundEvLoopSync([] {});
+  }
+}
+
 }  // namespace engine::io
 
 USERVER_NAMESPACE_END
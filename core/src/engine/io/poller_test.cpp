@@ -295,6 +295,35 @@ UTEST(Poller, AwaitedEventsChange) {
   ASSERT_EQ(poller.NextEventNoblock(event), Poller::Status::kNoEvents);
 }
 
+UTEST(Poller, CoalescedEventsChange) {
+  Pipe pipe;
+  Poller poller;
+  Poller::Event event{};
+
+  for (unsigned i = 0; i < kRepetitions; ++i) {
+    poller.Add(pipe.In(), Poller::Event::kRead);
+    poller.Add(pipe.In(), Poller::Event::kNone);
+  }
+  poller.Add(pipe.In(), Poller::Event::kRead);
+
+  WriteOne(pipe.Out());
+  ASSERT_EQ(
+      poller.NextEvent(event, engine::Deadline::FromDuration(kReadTimeout)),
+      Poller::Status::kSuccess);
+  EXPECT_EQ(event.type, Poller::Event::kRead);
+  EXPECT_EQ(event.fd, pipe.In());
+  ASSERT_EQ(poller.NextEventNoblock(event), Poller::Status::kNoEvents);
+  ReadOne(pipe.In());
+}
+
+UTEST(Poller, DestroyWithPendingAdd) {
+  Pipe pipe;
+  for (unsigned i = 0; i < kRepetitions; ++i) {
+    Poller poller;
+    poller.Add(pipe.In(), Poller::Event::kRead);
+  }
+}
+
 UTEST(Poller, Interrupt) {
   Pipe pipe;
   Poller poller;
@@ -5,7 +5,9 @@
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cerrno>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -248,6 +250,21 @@ size_t Socket::SendAll(std::initializer_list<IoData> list, Deadline deadline) {
 
 size_t Socket::SendAll(const IoData* list, std::size_t list_size,
                        Deadline deadline) {
+  if (list_size > IOV_MAX) {
+    // writev does not accept more than IOV_MAX buffers at once
+    size_t sent_bytes = 0;
+    for (std::size_t offset = 0; offset < list_size; offset += IOV_MAX) {
+      const auto count = std::min<std::size_t>(IOV_MAX, list_size - offset);
+      const auto expected = std::accumulate(
+          list + offset, list + offset + count, size_t{0},
+          [](size_t sum, const IoData& io_data) { return sum + io_data.len; });
+      const auto sent = SendAll(list + offset, count, deadline);
+      sent_bytes += sent;
+      if (sent != expected) break;
+    }
+    return sent_bytes;
+  }
+
   if (list_size < kMaxStackSizeVector) {
     /// stack
     std::array<struct ::iovec, kMaxStackSizeVector> data{};
@@ -1,13 +1,20 @@
 #include <userver/engine/io/tls_wrapper.hpp>
 
 #include <boost/stacktrace/stacktrace.hpp>
+#include <chrono>
 #include <exception>
 #include <memory>
+#include <mutex>
 
 #include <fmt/format.h>
 #include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
+#include <openssl/x509.h>
 
+#include <userver/cache/lru_map.hpp>
+#include <userver/crypto/hash.hpp>
 #include <userver/crypto/openssl.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/logging/log.hpp>
@@ -31,6 +38,12 @@ struct SslDeleter {
 };
 using Ssl = std::unique_ptr<SSL, SslDeleter>;
 
+struct SslSessionDeleter {
+  void operator()(SSL_SESSION* session) const noexcept {
+    SSL_SESSION_free(session);
+  }
+};
+
 struct BioDeleter {
   void operator()(BIO* bio) const noexcept { BIO_free_all(bio); }
 };
@@ -263,8 +276,113 @@ void AddCertAuthorities(
   }
 }
 
+// Ticket keys are the same for all the servers of the process, so that the
+// sessions survive reconnections to another TLS context. An old ticket is
+// not accepted after the rotation and the client makes a full handshake.
+constexpr std::chrono::hours kTicketKeysRotationPeriod{1};
+
+void SetTicketKeys(SslCtx& ctx) {
+  const auto keys_size = SSL_CTX_get_tlsext_ticket_keys(ctx.get(), nullptr, 0);
+  if (keys_size <= 0) return;
+
+  static std::mutex mutex;
+  static std::string keys;
+  static std::chrono::steady_clock::time_point rotated_at;
+
+  const std::lock_guard lock{mutex};
+  const auto now = std::chrono::steady_clock::now();
+  if (keys.size() != static_cast<std::size_t>(keys_size) ||
+      now - rotated_at >= kTicketKeysRotationPeriod) {
+    std::string new_keys(keys_size, '\0');
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (1 != RAND_bytes(reinterpret_cast<unsigned char*>(new_keys.data()),
+                        new_keys.size())) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS wrapper: RAND_bytes"));
+    }
+    keys = std::move(new_keys);
+    rotated_at = now;
+  }
+
+  if (1 !=
+      SSL_CTX_set_tlsext_ticket_keys(ctx.get(), keys.data(), keys.size())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up server TLS wrapper: "
+        "SSL_CTX_set_tlsext_ticket_keys"));
+  }
+}
+
+// Sessions are resumed only by the servers that would accept the same peers
+void SetSessionIdContext(
+    SslCtx& ctx, const crypto::Certificate& cert,
+    const std::vector<crypto::Certificate>& cert_authorities) {
+  std::string digests;
+  const auto append_digest = [&digests](const crypto::Certificate& cert) {
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digest_size = 0;
+    if (1 != X509_digest(cert.GetNative(), EVP_sha256(), digest,
+                         &digest_size)) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS wrapper: X509_digest"));
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    digests.append(reinterpret_cast<const char*>(digest), digest_size);
+  };
+  append_digest(cert);
+  for (const auto& ca : cert_authorities) append_digest(ca);
+
+  const auto sid_ctx =
+      crypto::hash::Sha256(digests, crypto::hash::OutputEncoding::kBinary);
+  static_assert(SSL_MAX_SID_CTX_LENGTH >= 32);
+  if (1 != SSL_CTX_set_session_id_context(
+               ctx.get(),
+               // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+               reinterpret_cast<const unsigned char*>(sid_ctx.data()),
+               sid_ctx.size())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up server TLS wrapper: "
+        "SSL_CTX_set_session_id_context"));
+  }
+}
+
 }  // namespace
 
+class TlsClientSessionCache::Impl final {
+ public:
+  explicit Impl(std::size_t max_size) : sessions_(max_size) {}
+
+  std::shared_ptr<SSL_SESSION> Take(const std::string& key) {
+    const std::lock_guard lock{mutex_};
+    auto* session_ptr = sessions_.Get(key);
+    if (!session_ptr) return {};
+
+    auto session = *session_ptr;
+#ifdef TLS1_3_VERSION
+    // TLS 1.3 tickets should not be reused, the server sends new ones
+    if (SSL_SESSION_get_protocol_version(session.get()) >= TLS1_3_VERSION) {
+      sessions_.Erase(key);
+    }
+#endif
+    return session;
+  }
+
+  // Takes the ownership of the session even if throws
+  void Put(const std::string& key, SSL_SESSION* session) {
+    std::shared_ptr<SSL_SESSION> session_ptr{session, SslSessionDeleter{}};
+    const std::lock_guard lock{mutex_};
+    sessions_.Put(key, std::move(session_ptr));
+  }
+
+ private:
+  std::mutex mutex_;
+  cache::LruMap<std::string, std::shared_ptr<SSL_SESSION>> sessions_;
+};
+
+TlsClientSessionCache::TlsClientSessionCache(std::size_t max_size)
+    : impl_(std::make_unique<Impl>(max_size)) {}
+
+TlsClientSessionCache::~TlsClientSessionCache() = default;
+
 class TlsWrapper::ReadContextAccessor final
     : public engine::impl::ContextAccessor {
  public:
@@ -294,6 +412,7 @@ class TlsWrapper::Impl {
   Impl(Impl&& other) noexcept
       : bio_data(std::move(other.bio_data)),
         ssl(std::move(other.ssl)),
+        client_session(std::move(other.client_session)),
         read_accessor(*this),
         is_in_shutdown(other.is_in_shutdown) {
     UASSERT(ssl);
@@ -323,7 +442,12 @@ class TlsWrapper::Impl {
     [[maybe_unused]] const auto* disowned_bio = socket_bio.release();
   }
 
-  void ClientConnect(const std::string& server_name, Deadline deadline) {
+  void ClientConnect(const std::string& server_name, Deadline deadline,
+                     TlsClientSessionCache* session_cache) {
+    if (session_cache) {
+      SetUpClientSession(*session_cache->impl_, server_name);
+    }
+
     if (!server_name.empty()) {
       // cast in openssl1.0 macro expansion
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -425,8 +549,15 @@ class TlsWrapper::Impl {
     }
   }
 
+  struct ClientSession {
+    TlsClientSessionCache::Impl& cache;
+    std::string key;
+  };
+
   SocketBioData bio_data;
   Ssl ssl;
+  // Has a stable address for the new session callback
+  std::unique_ptr<ClientSession> client_session;
   ReadContextAccessor read_accessor;
   bool is_in_shutdown{false};
   std::atomic<int> ssl_usage_level{0};
@@ -437,6 +568,40 @@ class TlsWrapper::Impl {
     UASSERT(BIO_get_data(bio) == old_data);
     BIO_set_data(bio, &bio_data);
   }
+
+  void SetUpClientSession(TlsClientSessionCache::Impl& cache,
+                          const std::string& server_name) {
+    client_session = std::make_unique<ClientSession>(ClientSession{
+        cache, server_name.empty()
+                   ? fmt::to_string(bio_data.socket.Getpeername())
+                   : server_name});
+    SSL_set_app_data(ssl.get(), client_session.get());
+
+    // The context is not shared with other connections
+    auto* ssl_ctx = SSL_get_SSL_CTX(ssl.get());
+    SSL_CTX_set_session_cache_mode(
+        ssl_ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ssl_ctx, &OnNewClientSession);
+
+    const auto session = cache.Take(client_session->key);
+    if (session && 1 != SSL_set_session(ssl.get(), session.get())) {
+      LOG_LIMITED_WARNING() << crypto::FormatSslError(
+          "Failed to resume TLS session: SSL_set_session");
+    }
+  }
+
+  // Called on the handshake for TLS 1.2 and on the receipt of each ticket
+  // after the handshake for TLS 1.3
+  static int OnNewClientSession(SSL* ssl, SSL_SESSION* session) noexcept {
+    auto* client_session = static_cast<ClientSession*>(SSL_get_app_data(ssl));
+    if (!client_session) return 0;
+    try {
+      client_session->cache.Put(client_session->key, session);
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_WARNING() << "Failed to store TLS session: " << ex;
+    }
+    return 1;
+  }
 };
 
 TlsWrapper::ReadContextAccessor::ReadContextAccessor(TlsWrapper::Impl& impl)
@@ -488,7 +653,20 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
 
   TlsWrapper wrapper{std::move(socket)};
   wrapper.impl_->SetUp(std::move(ssl_ctx));
-  wrapper.impl_->ClientConnect(server_name, deadline);
+  wrapper.impl_->ClientConnect(server_name, deadline, nullptr);
+  return wrapper;
+}
+
+TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
+                                      const std::string& server_name,
+                                      TlsClientSessionCache& session_cache,
+                                      Deadline deadline) {
+  auto ssl_ctx = MakeSslCtx();
+  SetServerName(ssl_ctx, server_name);
+
+  TlsWrapper wrapper{std::move(socket)};
+  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->ClientConnect(server_name, deadline, &session_cache);
   return wrapper;
 }
 
@@ -496,7 +674,8 @@ TlsWrapper TlsWrapper::StartTlsClient(
     Socket&& socket, const std::string& server_name,
     const crypto::Certificate& cert, const crypto::PrivateKey& key,
     Deadline deadline,
-    const std::vector<crypto::Certificate>& extra_cert_authorities) {
+    const std::vector<crypto::Certificate>& extra_cert_authorities,
+    TlsClientSessionCache* session_cache) {
   auto ssl_ctx = MakeSslCtx();
   SetServerName(ssl_ctx, server_name);
 
@@ -520,7 +699,7 @@ TlsWrapper TlsWrapper::StartTlsClient(
 
   TlsWrapper wrapper{std::move(socket)};
   wrapper.impl_->SetUp(std::move(ssl_ctx));
-  wrapper.impl_->ClientConnect(server_name, deadline);
+  wrapper.impl_->ClientConnect(server_name, deadline, session_cache);
   return wrapper;
 }
 
@@ -550,6 +729,9 @@ TlsWrapper TlsWrapper::StartTlsServer(
         "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
   }
 
+  SetTicketKeys(ssl_ctx);
+  SetSessionIdContext(ssl_ctx, cert, extra_cert_authorities);
+
   TlsWrapper wrapper{std::move(socket)};
   wrapper.impl_->SetUp(std::move(ssl_ctx));
   wrapper.impl_->bio_data.current_deadline = deadline;
@@ -595,6 +777,10 @@ bool TlsWrapper::IsValid() const {
   return impl_->ssl && !impl_->is_in_shutdown;
 }
 
+bool TlsWrapper::IsSessionReused() const {
+  return impl_->ssl && SSL_session_reused(impl_->ssl.get()) == 1;
+}
+
 bool TlsWrapper::WaitReadable(Deadline deadline) {
   impl_->CheckAlive();
   char buf = 0;
@@ -686,4 +686,38 @@ UTEST(TlsWrapper, PeerDisconnect) {
   server_task.Get();
 }
 
+UTEST_MT(TlsWrapper, SessionResumption, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  TcpListener tcp_listener;
+  io::TlsClientSessionCache session_cache;
+
+  for (const bool expect_reused : {false, true}) {
+    auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+    auto server_task = engine::AsyncNoSpan(
+        [test_deadline, expect_reused](auto&& server) {
+          auto tls_server = io::TlsWrapper::StartTlsServer(
+              std::forward<decltype(server)>(server),
+              crypto::Certificate::LoadFromString(cert),
+              crypto::PrivateKey::LoadFromString(key), test_deadline);
+          EXPECT_EQ(tls_server.IsSessionReused(), expect_reused);
+          EXPECT_EQ(1, tls_server.SendAll("1", 1, test_deadline));
+          char c = 0;
+          EXPECT_EQ(1, tls_server.RecvSome(&c, 1, test_deadline));
+        },
+        std::move(server));
+
+    auto tls_client = io::TlsWrapper::StartTlsClient(
+        std::move(client), {}, session_cache, test_deadline);
+    EXPECT_EQ(tls_client.IsSessionReused(), expect_reused);
+    // TLS 1.3 tickets arrive after the handshake
+    char c = 0;
+    EXPECT_EQ(1, tls_client.RecvSome(&c, 1, test_deadline));
+    EXPECT_EQ(1, tls_client.SendAll("2", 1, test_deadline));
+
+    UEXPECT_NO_THROW(server_task.Get());
+  }
+}
+
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ bool Mutex::try_lock_until(Deadline deadline) {
   return impl_->try_lock_until(deadline);
 }
 
+MutexStatistics Mutex::GetStatistics() const noexcept {
+  return impl_->GetStatistics();
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
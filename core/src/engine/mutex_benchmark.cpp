@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <mutex>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 #include <concurrent/impl/interference_shield.hpp>
@@ -72,6 +73,20 @@ void generic_unlock(benchmark::State& state) {
   }
 }
 
+template <typename Mutex>
+void ReportContention(benchmark::State& state, const Mutex& mutex,
+                      double locks) {
+  if constexpr (std::is_same_v<Mutex, engine::Mutex>) {
+    const auto statistics = mutex.GetStatistics();
+    state.counters["waits-ratio"] =
+        static_cast<double>(statistics.waits) / locks;
+    state.counters["spins-ratio"] =
+        static_cast<double>(statistics.spin_acquisitions) / locks;
+    state.counters["wait-ns-per-lock"] =
+        static_cast<double>(statistics.wait_time.count()) / locks;
+  }
+}
+
 template <typename Mutex>
 void generic_contention(benchmark::State& state) {
   std::atomic<std::size_t> lock_unlock_count{0};
@@ -95,6 +110,7 @@ void generic_contention(benchmark::State& state) {
       benchmark::Counter(total_lock_unlock_count, benchmark::Counter::kIsRate);
   state.counters["locks-per-thread"] = benchmark::Counter(
       total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
+  ReportContention(state, *m, total_lock_unlock_count);
 }
 
 template <typename Mutex>
@@ -123,6 +139,7 @@ void generic_contention_with_payload(benchmark::State& state) {
       benchmark::Counter(total_lock_unlock_count, benchmark::Counter::kIsRate);
   state.counters["locks-per-thread"] = benchmark::Counter(
       total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
+  ReportContention(state, *m, total_lock_unlock_count);
 }
 
 //////// Benchmarks
@@ -1,11 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <vector>
+
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/single_waiting_task_mutex.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/striped_shared_mutex.hpp>
 
 #include <userver/utest/utest.hpp>
 
@@ -165,6 +169,53 @@ UTEST(Mutex, SampleMutex) {
   /// [Sample engine::Mutex usage]
 }
 
+UTEST(Mutex, Statistics) {
+  engine::Mutex mutex;
+  {
+    const std::lock_guard lock(mutex);
+  }
+  EXPECT_EQ(mutex.GetStatistics().waits, 0);
+
+  std::unique_lock lock(mutex);
+  auto task = engine::AsyncNoSpan([&mutex] {
+    const std::lock_guard task_lock(mutex);
+  });
+  // Held for much longer than the spinning lasts, so the task sleeps
+  engine::SleepFor(10ms);
+  lock.unlock();
+  task.Get();
+
+  const auto statistics = mutex.GetStatistics();
+  EXPECT_EQ(statistics.waits, 1);
+  EXPECT_EQ(statistics.spin_acquisitions, 0);
+  EXPECT_GE(statistics.wait_time, 5ms);
+}
+
+UTEST_MT(Mutex, StarvingWaiterIsNotOvertaken, 2) {
+  constexpr auto kTestDuration = 100ms;
+  engine::Mutex mutex;
+  std::atomic<bool> stop{false};
+
+  // Two tasks relock the mutex in a loop, so the waiter would be overtaken
+  // all the time without the handoff
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 2; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&mutex, &stop] {
+      while (!stop) {
+        const std::lock_guard lock(mutex);
+      }
+    }));
+  }
+
+  const auto deadline = engine::Deadline::FromDuration(kTestDuration);
+  while (!deadline.IsReached()) {
+    std::unique_lock lock(mutex, std::defer_lock);
+    ASSERT_TRUE(lock.try_lock_for(utest::kMaxTestWaitTime));
+  }
+  stop = true;
+  for (auto& task : tasks) task.Get();
+}
+
 REGISTER_TYPED_UTEST_SUITE_P(Mutex,
 
                              LockUnlock, LockUnlockDouble, WaitAndCancel,
@@ -172,6 +223,8 @@ REGISTER_TYPED_UTEST_SUITE_P(Mutex,
 
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineMutex, Mutex, engine::Mutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSharedMutex, Mutex, engine::SharedMutex);
+INSTANTIATE_TYPED_UTEST_SUITE_P(EngineStripedSharedMutex, Mutex,
+                                engine::StripedSharedMutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSingleWaitingTaskMutex, Mutex,
                                 engine::SingleWaitingTaskMutex);
 
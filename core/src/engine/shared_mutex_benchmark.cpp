@@ -3,14 +3,18 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/shared_mutex.hpp>
+#include <userver/engine/striped_shared_mutex.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-void shared_mutex_benchmark(benchmark::State& state) {
+namespace {
+
+template <typename SharedMutex>
+void generic_shared_lock(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     int variable = 0;
-    engine::SharedMutex mutex;
+    SharedMutex mutex;
 
     auto initial_lock_holder = engine::AsyncNoSpan([&] {
       // ensure the locks are actually needed
@@ -26,6 +30,17 @@ void shared_mutex_benchmark(benchmark::State& state) {
     });
   });
 }
+
+}  // namespace
+
+void shared_mutex_benchmark(benchmark::State& state) {
+  generic_shared_lock<engine::SharedMutex>(state);
+}
 BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6);
 
+void striped_shared_mutex_benchmark(benchmark::State& state) {
+  generic_shared_lock<engine::StripedSharedMutex>(state);
+}
+BENCHMARK(striped_shared_mutex_benchmark)->DenseRange(1, 6);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,136 @@
+#include <userver/engine/striped_shared_mutex.hpp>
+
+#include <algorithm>
+
+#include <userver/concurrent/impl/asymmetric_fence.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// The readers are polled with exponential backoff: the critical sections of
+// the readers are expected to be short, and the writers to be rare
+constexpr std::size_t kYieldsBeforeSleep = 4;
+constexpr std::chrono::microseconds kMinPollInterval{10};
+constexpr std::chrono::microseconds kMaxPollInterval{1000};
+
+}  // namespace
+
+StripedSharedMutex::StripedSharedMutex() = default;
+
+StripedSharedMutex::~StripedSharedMutex() {
+  UASSERT_MSG(!writer_.load(), "StripedSharedMutex is destroyed while locked");
+}
+
+void StripedSharedMutex::lock() {
+  const auto ok = try_lock_until(Deadline{});
+  UASSERT(ok);
+}
+
+void StripedSharedMutex::unlock() {
+  ReleaseWriter();
+  writers_mutex_.unlock();
+}
+
+bool StripedSharedMutex::try_lock() {
+  if (!writers_mutex_.try_lock()) return false;
+  utils::ScopeGuard unlock_writers([this] { writers_mutex_.unlock(); });
+
+  writer_.store(true, std::memory_order_seq_cst);
+  concurrent::impl::AsymmetricThreadFenceHeavy();
+  if (!readers_.IsFree()) {
+    ReleaseWriter();
+    return false;
+  }
+
+  unlock_writers.Release();
+  return true;
+}
+
+bool StripedSharedMutex::try_lock_until(Deadline deadline) {
+  if (!writers_mutex_.try_lock_until(deadline)) return false;
+  utils::ScopeGuard unlock_writers([this] { writers_mutex_.unlock(); });
+
+  // From now on the new readers back off. The pair of asymmetric fences
+  // guarantees that either a reader sees writer_, or the writer sees the lock
+  // of the reader.
+  writer_.store(true, std::memory_order_seq_cst);
+  concurrent::impl::AsymmetricThreadFenceHeavy();
+  if (!WaitForNoReaders(deadline)) {
+    ReleaseWriter();
+    return false;
+  }
+
+  unlock_writers.Release();
+  return true;
+}
+
+void StripedSharedMutex::lock_shared() {
+  const auto ok = try_lock_shared_until(Deadline{});
+  UASSERT(ok);
+}
+
+void StripedSharedMutex::unlock_shared() noexcept { readers_.DoUnlock(); }
+
+bool StripedSharedMutex::try_lock_shared() noexcept {
+  // Fast path, keeps the stripes intact while a writer waits for them
+  if (writer_.load(std::memory_order_relaxed)) return false;
+
+  readers_.DoLock();
+  // Pairs with AsymmetricThreadFenceHeavy of the writer, see try_lock_until
+  concurrent::impl::AsymmetricThreadFenceLight();
+  if (!writer_.load(std::memory_order_seq_cst)) return true;
+
+  readers_.DoUnlock();
+  return false;
+}
+
+bool StripedSharedMutex::try_lock_shared_until(Deadline deadline) {
+  while (!try_lock_shared()) {
+    if (!WaitForNoWriter(deadline)) return false;
+  }
+  return true;
+}
+
+bool StripedSharedMutex::WaitForNoWriter(Deadline deadline) {
+  const TaskCancellationBlocker block_cancels;
+  std::unique_lock lock(writer_cv_mutex_);
+  return writer_cv_.WaitUntil(lock, deadline, [this] {
+    return !writer_.load(std::memory_order_relaxed);
+  });
+}
+
+bool StripedSharedMutex::WaitForNoReaders(Deadline deadline) {
+  // The readers do not signal the unlocks to stay cheap, so the writer polls
+  auto poll_interval = kMinPollInterval;
+  for (std::size_t attempt = 0; !readers_.IsFree(); ++attempt) {
+    if (deadline.IsReached()) return false;
+    if (attempt < kYieldsBeforeSleep) {
+      engine::Yield();
+      continue;
+    }
+
+    engine::SleepUntil(
+        std::min(deadline, Deadline::FromDuration(poll_interval)));
+    poll_interval = std::min(poll_interval * 2, kMaxPollInterval);
+  }
+  return true;
+}
+
+void StripedSharedMutex::ReleaseWriter() {
+  writer_.store(false, std::memory_order_release);
+
+  const TaskCancellationBlocker block_cancels;
+  const std::lock_guard lock(writer_cv_mutex_);
+  writer_cv_.NotifyAll();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,173 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/striped_shared_mutex.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(StripedSharedMutex, SharedLockUnlockDouble) {
+  engine::StripedSharedMutex mutex;
+  mutex.lock_shared();
+  mutex.lock_shared();
+  mutex.unlock_shared();
+  mutex.unlock_shared();
+
+  ASSERT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
+UTEST(StripedSharedMutex, SharedAndUniqueLock) {
+  engine::StripedSharedMutex mutex;
+
+  std::unique_lock lock(mutex);
+  EXPECT_FALSE(mutex.try_lock_shared());
+  auto reader = utils::Async("", [&mutex] { std::shared_lock lock(mutex); });
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(reader.IsFinished());
+
+  lock.unlock();
+
+  reader.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(reader.IsFinished());
+  UEXPECT_NO_THROW(reader.Get());
+}
+
+UTEST(StripedSharedMutex, UniqueAndSharedLock) {
+  engine::StripedSharedMutex mutex;
+
+  std::shared_lock lock(mutex);
+  EXPECT_FALSE(mutex.try_lock());
+  auto writer = utils::Async("", [&mutex] { std::unique_lock lock(mutex); });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  writer.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(writer.IsFinished());
+  UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST(StripedSharedMutex, TryLockSharedTimeout) {
+  engine::StripedSharedMutex mutex;
+
+  std::unique_lock lock(mutex);
+  auto reader = utils::Async("", [&mutex] {
+    return mutex.try_lock_shared_for(std::chrono::milliseconds(10));
+  });
+  EXPECT_FALSE(reader.Get());
+
+  lock.unlock();
+  ASSERT_TRUE(mutex.try_lock_shared_for(std::chrono::milliseconds(10)));
+  mutex.unlock_shared();
+}
+
+UTEST(StripedSharedMutex, TryLockTimeoutReleasesReaders) {
+  engine::StripedSharedMutex mutex;
+
+  std::shared_lock lock(mutex);
+  auto writer = utils::Async("", [&mutex] {
+    return mutex.try_lock_for(std::chrono::milliseconds(10));
+  });
+  EXPECT_FALSE(writer.Get());
+
+  // The failed writer must not block the new readers
+  ASSERT_TRUE(mutex.try_lock_shared());
+  mutex.unlock_shared();
+}
+
+UTEST_MT(StripedSharedMutex, WritersDontStarve, 2) {
+  engine::StripedSharedMutex mutex;
+  std::atomic<int> counter{0};
+  std::atomic<int> loaded{-1};
+
+  std::shared_lock lock(mutex);
+  auto writer = utils::Async("", [&mutex, &counter, &loaded] {
+    std::unique_lock lock(mutex);
+    loaded = counter.load();
+  });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  readers.reserve(10);
+  for (int i = 0; i < 10; i++) {
+    readers.push_back(utils::Async("", [&counter, &mutex] {
+      std::shared_lock lock(mutex);
+      counter++;
+    }));
+  }
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  writer.Get();
+  for (auto& reader : readers) reader.Get();
+
+  EXPECT_EQ(loaded.load(), 0);
+  EXPECT_EQ(counter.load(), 10);
+}
+
+UTEST_MT(StripedSharedMutex, ReadersAndWriters, 4) {
+  constexpr int kIterations = 1000;
+  engine::StripedSharedMutex mutex;
+  // Both are modified under the unique lock and must always be equal
+  int first = 0;
+  int second = 0;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 3; ++i) {
+    tasks.push_back(utils::Async("reader", [&] {
+      for (int j = 0; j < kIterations; ++j) {
+        std::shared_lock lock(mutex);
+        ASSERT_EQ(first, second);
+      }
+    }));
+  }
+  tasks.push_back(utils::Async("writer", [&] {
+    for (int j = 0; j < kIterations / 10; ++j) {
+      std::unique_lock lock(mutex);
+      ++first;
+      ++second;
+    }
+  }));
+
+  for (auto& task : tasks) task.Get();
+  EXPECT_EQ(first, kIterations / 10);
+}
+
+UTEST(StripedSharedMutex, SampleStripedSharedMutex) {
+  /// [Sample engine::StripedSharedMutex usage]
+
+  constexpr auto kTestString = "123";
+
+  engine::StripedSharedMutex mutex;
+  std::string data;
+  {
+    std::lock_guard lock(mutex);
+    // accessing the data under the mutex for writing, rarely
+    data = kTestString;
+  }
+
+  {
+    std::shared_lock lock(mutex);
+    // accessing the data under the mutex for reading, cheaply and often
+    const auto& x = data;
+    ASSERT_EQ(x, kTestString);
+  }
+  /// [Sample engine::StripedSharedMutex usage]
+}
+
+USERVER_NAMESPACE_END
@@ -27,6 +27,10 @@ ChildProcessStatus ChildProcess::Get() { return impl_->Get(); }
 
 void ChildProcess::SendSignal(int signum) { return impl_->SendSignal(signum); }
 
+io::PipeReader& ChildProcess::GetStdout() { return impl_->GetStdout(); }
+
+io::PipeReader& ChildProcess::GetStderr() { return impl_->GetStderr(); }
+
 }  // namespace engine::subprocess
 
 USERVER_NAMESPACE_END
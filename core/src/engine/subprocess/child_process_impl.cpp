@@ -2,18 +2,28 @@
 
 #include <sys/types.h>
 
+#include <cerrno>
 #include <csignal>
+#include <system_error>
+
+#include <fmt/format.h>
 
 #include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
 #include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 
-ChildProcessImpl::ChildProcessImpl(int pid,
-                                   Future<ChildProcessStatus>&& status_future)
-    : pid_(pid), status_future_(std::move(status_future)) {}
+ChildProcessImpl::ChildProcessImpl(
+    int pid, Future<ChildProcessStatus>&& status_future,
+    std::unique_ptr<io::PipeReader> stdout_pipe,
+    std::unique_ptr<io::PipeReader> stderr_pipe)
+    : pid_(pid),
+      status_future_(std::move(status_future)),
+      stdout_pipe_(std::move(stdout_pipe)),
+      stderr_pipe_(std::move(stderr_pipe)) {}
 
 void ChildProcessImpl::WaitNonCancellable() {
   TaskCancellationBlocker cancel_blocker;
@@ -32,9 +42,24 @@ ChildProcessStatus ChildProcessImpl::Get() {
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ChildProcessImpl::SendSignal(int signum) {
+  if (pid_ == kNoProcess) {
+    // kill(-1) would signal every process, report it as a reaped child
+    throw std::system_error(std::error_code(ESRCH, std::system_category()),
+                            fmt::format("kill, pid={}", pid_));
+  }
   utils::CheckSyscall(kill(pid_, signum), "kill, pid={}", pid_);
 }
 
+io::PipeReader& ChildProcessImpl::GetStdout() {
+  UINVARIANT(stdout_pipe_, "ExecOptions::pipe_stdout was not set");
+  return *stdout_pipe_;
+}
+
+io::PipeReader& ChildProcessImpl::GetStderr() {
+  UINVARIANT(stderr_pipe_, "ExecOptions::pipe_stderr was not set");
+  return *stderr_pipe_;
+}
+
 }  // namespace engine::subprocess
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process_status.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,7 +14,12 @@ namespace engine::subprocess {
 
 class ChildProcessImpl {
  public:
-  ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future);
+  // The pid of a command that could not be executed
+  static constexpr int kNoProcess = -1;
+
+  ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future,
+                   std::unique_ptr<io::PipeReader> stdout_pipe = {},
+                   std::unique_ptr<io::PipeReader> stderr_pipe = {});
 
   int GetPid() const { return pid_; }
 
@@ -24,9 +31,15 @@ class ChildProcessImpl {
 
   void SendSignal(int signum);
 
+  io::PipeReader& GetStdout();
+
+  io::PipeReader& GetStderr();
+
  private:
   int pid_;
   Future<ChildProcessStatus> status_future_;
+  std::unique_ptr<io::PipeReader> stdout_pipe_;
+  std::unique_ptr<io::PipeReader> stderr_pipe_;
 };
 
 }  // namespace engine::subprocess
@@ -1,13 +1,15 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
+#include <spawn.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
 #include <csignal>
-#include <cstdio>
-#include <cstring>
-#include <iostream>
+#include <optional>
+#include <string_view>
+#include <system_error>
 
 #include <fmt/format.h>
 #include <boost/range/adaptor/transformed.hpp>
@@ -18,63 +20,143 @@
 #include <engine/subprocess/child_process_impl.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <utils/check_syscall.hpp>
 
-extern char** environ;
-
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 namespace {
 
-void DoExec(const std::string& command, const std::vector<std::string>& args,
-            const EnvironmentVariables& env,
-            const std::optional<std::string>& stdout_file,
-            const std::optional<std::string>& stderr_file, bool use_path) {
-  if (stdout_file) {
-    if (!std::freopen(stdout_file->c_str(), "a", stdout)) {
-      utils::CheckSyscall(-1, "freopen stdout to {}", *stdout_file);
+// The arguments of posix_spawn, prepared before the spawning
+class SpawnArgs final {
+ public:
+  SpawnArgs(const std::string& command, const std::vector<std::string>& args,
+            const EnvironmentVariables& env) {
+    argv_ptrs_.reserve(args.size() + 2);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    argv_ptrs_.push_back(const_cast<char*>(command.c_str()));
+    for (const auto& arg : args) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      argv_ptrs_.push_back(const_cast<char*>(arg.c_str()));
     }
-  }
-  if (stderr_file) {
-    if (!std::freopen(stderr_file->c_str(), "a", stderr)) {
-      utils::CheckSyscall(-1, "freopen stderr to {}", *stdout_file);
+    argv_ptrs_.push_back(nullptr);
+
+    envp_buf_.reserve(env.size());
+    envp_ptrs_.reserve(env.size() + 1);
+    for (const auto& [key, value] : env) {
+      envp_buf_.emplace_back(utils::StrCat(key, "=", value));
+      envp_ptrs_.push_back(envp_buf_.back().data());
     }
+    envp_ptrs_.push_back(nullptr);
   }
-  std::vector<char*> argv_ptrs;
-  std::vector<std::string> envp_buf;
-  std::vector<char*> envp_ptrs;
-  argv_ptrs.reserve(args.size() + 2);
-  envp_buf.reserve(env.size());
-  envp_ptrs.reserve(env.size() + 1);
-
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-  argv_ptrs.push_back(const_cast<char*>(command.c_str()));
-  for (const auto& arg : args) {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    argv_ptrs.push_back(const_cast<char*>(arg.c_str()));
+
+  char* const* Argv() const { return argv_ptrs_.data(); }
+  char* const* Envp() const { return envp_ptrs_.data(); }
+
+ private:
+  std::vector<char*> argv_ptrs_;
+  std::vector<std::string> envp_buf_;
+  std::vector<char*> envp_ptrs_;
+};
+
+class FileActions final {
+ public:
+  FileActions() {
+    CheckSpawnError(::posix_spawn_file_actions_init(&actions_),
+                    "posix_spawn_file_actions_init");
   }
-  argv_ptrs.push_back(nullptr);
 
-  for (const auto& [key, value] : env) {
-    envp_buf.emplace_back(utils::StrCat(key, "=", value));
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    envp_ptrs.push_back(const_cast<char*>(envp_buf.back().c_str()));
+  FileActions(const FileActions&) = delete;
+  FileActions& operator=(const FileActions&) = delete;
+
+  ~FileActions() { ::posix_spawn_file_actions_destroy(&actions_); }
+
+  void AddAppend(int fd, const std::string& path) {
+    // Same as freopen(path, "a")
+    CheckSpawnError(
+        ::posix_spawn_file_actions_addopen(&actions_, fd, path.c_str(),
+                                           O_WRONLY | O_CREAT | O_APPEND,
+                                           0666),
+        "posix_spawn_file_actions_addopen");
   }
-  envp_ptrs.push_back(nullptr);
 
-  environ = envp_ptrs.data();  // The variable is assigned to the environment to
-                               // use the execv, execvp functions
+  // The source stays open in the parent, dup2 clears its O_CLOEXEC in the
+  // child
+  void AddDup(int source_fd, int fd) {
+    CheckSpawnError(
+        ::posix_spawn_file_actions_adddup2(&actions_, source_fd, fd),
+        "posix_spawn_file_actions_adddup2");
+  }
 
-  if (!use_path) {
-    utils::CheckSyscall(execv(command.c_str(), argv_ptrs.data()), "execv");
-  } else {
-    utils::CheckSyscall(execvp(command.c_str(), argv_ptrs.data()), "execvp");
+  const ::posix_spawn_file_actions_t* Get() const { return &actions_; }
+
+  static void CheckSpawnError(int error, std::string_view what) {
+    if (error != 0) {
+      throw std::system_error(std::error_code(error, std::system_category()),
+                              fmt::format("Error while calling {}", what));
+    }
   }
+
+ private:
+  ::posix_spawn_file_actions_t actions_{};
+};
+
+// Mimics execvp(): the command is searched in the PATH of the child
+// environment, not of the current process as posix_spawnp() does
+std::string FindInPath(const std::string& command,
+                       const EnvironmentVariables& env) {
+  if (command.find('/') != std::string::npos) return command;
+
+  // The default of execvp for a missing PATH
+  const auto* path = env.GetValueOptional("PATH");
+  std::string_view dirs = path ? std::string_view{*path} : "/bin:/usr/bin";
+  while (true) {
+    const auto colon = dirs.find(':');
+    auto dir = dirs.substr(0, colon);
+    // An empty element is the current directory
+    auto candidate =
+        dir.empty() ? command : utils::StrCat(dir, "/", command);
+    if (::access(candidate.c_str(), X_OK) == 0) return candidate;
+    if (colon == std::string_view::npos) break;
+    dirs.remove_prefix(colon + 1);
+  }
+
+  // posix_spawn reports ENOENT for it
+  return command;
+}
+
+// The child gets a blocking write end, the parent keeps a non-blocking
+// read end: each end of a pipe has its own file status flags
+int ReleaseBlockingWriter(io::Pipe& pipe) {
+  const auto fd = pipe.writer.Release();
+  const auto flags = utils::CheckSyscall(::fcntl(fd, F_GETFL), "fcntl");
+  utils::CheckSyscall(::fcntl(fd, F_SETFL, flags & ~O_NONBLOCK), "fcntl");
+  return fd;
+}
+
+std::unique_ptr<io::PipeReader> TakeReader(std::optional<io::Pipe>& pipe) {
+  if (!pipe) return {};
+  return std::make_unique<io::PipeReader>(std::move(pipe->reader));
+}
+
+// The forked child used to abort if exec failed, a command that could not be
+// executed is reported the same way
+ChildProcess MakeFailedChild(std::unique_ptr<io::PipeReader> stdout_pipe,
+                             std::unique_ptr<io::PipeReader> stderr_pipe) {
+  Promise<ChildProcessStatus> status_promise;
+  // The wait status of a process terminated by the signal
+  status_promise.set_value(
+      ChildProcessStatus{SIGABRT, std::chrono::milliseconds{0}});
+  return ChildProcess{ChildProcessImpl{
+      ChildProcessImpl::kNoProcess, status_promise.get_future(),
+      std::move(stdout_pipe), std::move(stderr_pipe)}};
 }
 
 EnvironmentVariables ApplyEnviromentUpdate(
@@ -115,8 +197,47 @@ ChildProcess ProcessStarter::Exec(const std::string& command,
         "https://github.com/userver-framework/userver/issues/588");
   }
 
+  UINVARIANT(!(options.stdout_file && options.pipe_stdout),
+             "stdout_file and pipe_stdout are mutually exclusive");
+  UINVARIANT(!(options.stderr_file && options.pipe_stderr),
+             "stderr_file and pipe_stderr are mutually exclusive");
+
   tracing::Span span("ProcessStarter::Exec");
   span.AddTag("command", command);
+
+  const auto executable =
+      options.use_path ? FindInPath(command, env) : command;
+  const SpawnArgs spawn_args{command, args, env};
+
+  FileActions file_actions;
+  if (options.stdout_file) {
+    file_actions.AddAppend(STDOUT_FILENO, *options.stdout_file);
+  }
+  if (options.stderr_file) {
+    file_actions.AddAppend(STDERR_FILENO, *options.stderr_file);
+  }
+
+  std::optional<io::Pipe> stdout_pipe;
+  std::optional<io::Pipe> stderr_pipe;
+  // The writing ends are closed in the parent right after the spawning, so
+  // that the reader gets EOF when the child exits
+  int stdout_writer = -1;
+  int stderr_writer = -1;
+  const utils::FastScopeGuard close_writers([&]() noexcept {
+    if (stdout_writer != -1) ::close(stdout_writer);
+    if (stderr_writer != -1) ::close(stderr_writer);
+  });
+  if (options.pipe_stdout) {
+    stdout_pipe.emplace();
+    stdout_writer = ReleaseBlockingWriter(*stdout_pipe);
+    file_actions.AddDup(stdout_writer, STDOUT_FILENO);
+  }
+  if (options.pipe_stderr) {
+    stderr_pipe.emplace();
+    stderr_writer = ReleaseBlockingWriter(*stderr_pipe);
+    file_actions.AddDup(stderr_writer, STDERR_FILENO);
+  }
+
   Promise<ChildProcess> promise;
   auto future = promise.get_future();
 
@@ -126,43 +247,45 @@ ChildProcess ProcessStarter::Exec(const std::string& command,
           return key_value.first + '=' + key_value.second;
         });
     LOG_DEBUG() << fmt::format(
-        "do fork() + {}(), command={}, args=[\'{}\'], env=[]",
-        options.use_path ? "execv" : "execvp", fmt::join(args, "' '"),
-        fmt::join(keys, ", "));
-
-    const auto pid = utils::CheckSyscall(fork(), "fork");
-    if (pid) {
-      // in parent thread
-      span.AddTag("child-process-pid", pid);
-      LOG_DEBUG() << "Started child process with pid=" << pid;
-      Promise<ChildProcessStatus> exec_result_promise;
-      auto res = ChildProcessMapSet(
-          pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
-      if (res.second) {
-        promise.set_value(ChildProcess{
-            ChildProcessImpl{pid, res.first->status_promise.get_future()}});
+        "do posix_spawn(), command={}, args=[\'{}\'], env=[{}]", executable,
+        fmt::join(args, "' '"), fmt::join(keys, ", "));
+
+    // posix_spawn uses vfork semantics (clone(CLONE_VM | CLONE_VFORK) in
+    // glibc), so unlike fork() it does not copy the page tables of the
+    // service, and the failures of exec are reported here.
+    ::pid_t pid = -1;
+    const auto error =
+        ::posix_spawn(&pid, executable.c_str(), file_actions.Get(), nullptr,
+                      spawn_args.Argv(), spawn_args.Envp());
+    if (error != 0) {
+      const auto code = std::error_code(error, std::system_category());
+      std::system_error exec_error{
+          code, fmt::format("Error while spawning '{}'", command)};
+      if (options.throw_on_exec_failure) {
+        promise.set_exception(std::make_exception_ptr(std::move(exec_error)));
       } else {
-        const auto msg = fmt::format(
-            "process with pid={} already exists in child_process_map", pid);
-        LOG_ERROR() << msg << ", send SIGKILL";
-        ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
-        promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
+        LOG_ERROR() << "Cannot execute child: " << exec_error;
+        promise.set_value(MakeFailedChild(TakeReader(stdout_pipe),
+                                          TakeReader(stderr_pipe)));
       }
+      return;
+    }
+
+    span.AddTag("child-process-pid", pid);
+    LOG_DEBUG() << "Started child process with pid=" << pid;
+    Promise<ChildProcessStatus> exec_result_promise;
+    auto res = ChildProcessMapSet(
+        pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
+    if (res.second) {
+      promise.set_value(ChildProcess{ChildProcessImpl{
+          pid, res.first->status_promise.get_future(),
+          TakeReader(stdout_pipe), TakeReader(stderr_pipe)}});
     } else {
-      // in child thread
-      try {
-        try {
-          DoExec(command, args, env, options.stdout_file, options.stderr_file,
-                 options.use_path);
-        } catch (const std::exception& ex) {
-          std::cerr << "Cannot execute child: " << ex.what();
-        }
-      } catch (...) {
-        // must not do anything in a child
-        std::abort();
-      }
-      // on success execve or execvp does not return
-      std::abort();
+      const auto msg = fmt::format(
+          "process with pid={} already exists in child_process_map", pid);
+      LOG_ERROR() << msg << ", send SIGKILL";
+      ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
+      promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
     }
   });
 
@@ -3,7 +3,9 @@
 #include <sys/param.h>
 #include <unistd.h>
 
+#include <array>
 #include <chrono>
+#include <csignal>
 #include <string>
 #include <thread>
 #include <utility>
@@ -18,11 +20,13 @@
 #include <boost/filesystem.hpp>
 #endif
 
+#include <fmt/format.h>
 #include <gmock/gmock.h>
 #include <boost/range/adaptors.hpp>
 
 #include <engine/ev/thread_control.hpp>
 #include <engine/ev/thread_pool.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process.hpp>
 #include <userver/engine/subprocess/process_starter.hpp>
 #include <userver/engine/task/task.hpp>
@@ -96,8 +100,88 @@ UTEST(Subprocess, ExecvExecvFailure) {
 UTEST(Subprocess, ExecvFileNotFound) {
   engine::subprocess::ProcessStarter starter(
       engine::current_task::GetTaskProcessor());
-  const auto status = starter.Exec("myawesomebinary", {}).Get();
+  auto child = starter.Exec("myawesomebinary", {});
+  const auto status = child.Get();
   ASSERT_FALSE(status.IsExited());
+  EXPECT_EQ(status.GetTermSignal(), SIGABRT);
+  UEXPECT_THROW(child.SendSignal(SIGTERM), std::system_error);
+}
+
+UTEST(Subprocess, ExecvFileNotFoundThrows) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  engine::subprocess::ExecOptions options{};
+  options.throw_on_exec_failure = true;
+
+  // posix_spawn reports the failure of exec to the parent
+  UEXPECT_THROW((void)starter.Exec("myawesomebinary", {}, std::move(options)),
+                std::system_error);
+}
+
+UTEST(Subprocess, ExecvpFileNotFound) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  engine::subprocess::ExecOptions options{};
+  options.env_update = engine::subprocess::EnvironmentVariablesUpdate{
+      {{"PATH", kPath}}};
+  options.use_path = true;
+  options.throw_on_exec_failure = true;
+
+  UEXPECT_THROW((void)starter.Exec("myawesomebinary", {}, std::move(options)),
+                std::system_error);
+}
+
+UTEST(Subprocess, PipeOutput) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  engine::subprocess::ExecOptions options{};
+  options.pipe_stdout = true;
+  options.pipe_stderr = true;
+
+  auto child = starter.Exec(
+      "/bin/sh", {"-c", "echo out; echo err >&2; exit 3"}, std::move(options));
+
+  const auto read_all = [](engine::io::PipeReader& reader) {
+    std::string result;
+    std::array<char, 16> buffer{};
+    while (const auto size =
+               reader.ReadSome(buffer.data(), buffer.size(), {})) {
+      result.append(buffer.data(), size);
+    }
+    return result;
+  };
+  EXPECT_EQ(read_all(child.GetStdout()), "out\n");
+  EXPECT_EQ(read_all(child.GetStderr()), "err\n");
+
+  const auto status = child.Get();
+  ASSERT_TRUE(status.IsExited());
+  EXPECT_EQ(status.GetExitCode(), 3);
+}
+
+UTEST(Subprocess, PipeLargeOutput) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  engine::subprocess::ExecOptions options{};
+  options.pipe_stdout = true;
+
+  // More than the pipe buffer, the child blocks until the parent reads
+  constexpr std::size_t kSize = 1024 * 1024;
+  auto child = starter.Exec(
+      "/bin/sh", {"-c", fmt::format("head -c {} /dev/zero", kSize)},
+      std::move(options));
+
+  std::size_t total = 0;
+  std::array<char, 4096> buffer{};
+  while (const auto size =
+             child.GetStdout().ReadSome(buffer.data(), buffer.size(), {})) {
+    total += size;
+  }
+  EXPECT_EQ(total, kSize);
+  EXPECT_EQ(child.Get().GetExitCode(), 0);
 }
 
 UTEST(Subprocess, EnvironmentVariablesScope) {
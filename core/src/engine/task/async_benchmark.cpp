@@ -5,6 +5,7 @@
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/fixed_array.hpp>
@@ -17,6 +18,10 @@ using WrappedSpanCall =
     utils::impl::WrappedCallImplType<decltype(utils::impl::SpanLazyPrvalue("")),
                                      void (*)()>;
 
+constexpr std::size_t kMaxInheritedVariables = 64;
+std::array<engine::TaskInheritedVariable<int>, kMaxInheritedVariables>
+    inherited_variables;
+
 }
 
 // Note: We intentionally do not run this benchmark from RunStandalone to avoid
@@ -87,6 +92,20 @@ void wrap_call_and_perform(benchmark::State& state) {
 }
 BENCHMARK(wrap_call_and_perform);
 
+// Argument is the number of the inherited variables set in the parent
+void wrap_call_inherited(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      inherited_variables[i].Set(static_cast<int>(i));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      WrappedSpanCall(utils::impl::SpanLazyPrvalue(""), []() {});
+    }
+  });
+}
+BENCHMARK(wrap_call_inherited)->RangeMultiplier(4)->Range(1, 64);
+
 void async_comparisons_coro_spanned(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     std::uint64_t constructed_joined_count = 0;
@@ -18,6 +18,12 @@ enum class Action {
   kWakeupByEpoch,
 };
 
+// Shorter timers use a separate ev timer for the precision. The longer ones,
+// that are mostly the deadlines of the requests and the timeouts, go to the
+// timer wheel of the ev thread, which is cheaper to (re)start and stop.
+constexpr std::chrono::milliseconds kMinTimerWheelDelay{
+    10 * ev::TimerWheel::kTick};
+
 template <class Derived>
 class Finalizer : public ev::SingleShotAsyncPayload<Finalizer<Derived>> {
  public:
@@ -65,6 +71,7 @@ class ContextTimer::Impl final : public TimerArmer<Impl>,
   void StopTimerInEvThread() noexcept;
 
   static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+  static void OnTimerWheel(ev::TimerWheel::Entry& entry) noexcept;
   static void InvokeTimerFunction(const Params& params, TaskContext& context);
   void DoOnTimer();
 
@@ -72,6 +79,7 @@ class ContextTimer::Impl final : public TimerArmer<Impl>,
   ev::TimerThreadControl* thread_control_ = nullptr;
   Params params_;
   ev_timer timer_{};
+  ev::TimerWheel::Entry timer_wheel_entry_{&OnTimerWheel, this};
   ev::DataPipeToEv<Params> params_pipe_to_ev_;
 };
 
@@ -84,6 +92,7 @@ ContextTimer::Impl::Impl() {
 ContextTimer::Impl::~Impl() {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   UASSERT(!ev_is_active(&timer_));
+  UASSERT(!timer_wheel_entry_.IsScheduled());
 }
 
 bool ContextTimer::Impl::WasStarted() const noexcept {
@@ -137,19 +146,25 @@ void ContextTimer::Impl::DoArmTimerInEvThread() {
   params_ = std::move(*params);
 
   using LibEvDuration = std::chrono::duration<double>;
-  const auto time_left =
-      std::chrono::duration_cast<LibEvDuration>(params_.deadline.TimeLeft())
-          .count();
+  const auto time_left = params_.deadline.TimeLeft();
 
-  LOG_TRACE() << "time_left=" << time_left;
-  if (time_left <= 0.0) {
+  LOG_TRACE() << "time_left="
+              << std::chrono::duration_cast<LibEvDuration>(time_left).count();
+  if (time_left <= Deadline::Duration::zero()) {
     // Optimization for small deadlines or high load
     DoOnTimer();
     return;
   }
 
-  timer_.repeat = time_left;
   UASSERT(thread_control_);
+  if (time_left >= kMinTimerWheelDelay) {
+    thread_control_->Stop(timer_);
+    thread_control_->Start(timer_wheel_entry_, params_.deadline);
+    return;
+  }
+
+  thread_control_->Stop(timer_wheel_entry_);
+  timer_.repeat = std::chrono::duration_cast<LibEvDuration>(time_left).count();
   thread_control_->Again(timer_);
 }
 
@@ -171,6 +186,7 @@ void ContextTimer::Impl::InvokeTimerFunction(const Params& params,
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
   thread_control_->Stop(timer_);
+  thread_control_->Stop(timer_wheel_entry_);
 }
 
 void ContextTimer::Impl::DoFinalizeInEvThread() {
@@ -193,6 +209,14 @@ void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
   ev_timer->DoOnTimer();
 }
 
+void ContextTimer::Impl::OnTimerWheel(ev::TimerWheel::Entry& entry) noexcept {
+  UASSERT(!engine::current_task::IsTaskProcessorThread());
+
+  auto* ev_timer = static_cast<Impl*>(entry.GetData());
+  UASSERT(ev_timer != nullptr);
+  ev_timer->DoOnTimer();
+}
+
 void ContextTimer::Impl::DoOnTimer() {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
 
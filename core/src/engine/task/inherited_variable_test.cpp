@@ -151,6 +151,27 @@ UTEST(TaskInheritedVariable, SameObjectIsInherited) {
   }).Get();
 }
 
+UTEST(TaskInheritedVariable, SiblingsIndependence) {
+  kStringVariable.Set("parent");
+  kStringVariable2.Set("parent2");
+
+  utils::Async("first", [] {
+    kStringVariable.Set("first");
+
+    utils::Async("grandchild", [] {
+      EXPECT_EQ(kStringVariable.Get(), "first");
+      EXPECT_EQ(kStringVariable2.Get(), "parent2");
+    }).Get();
+  }).Get();
+
+  utils::Async("second", [] {
+    EXPECT_EQ(kStringVariable.Get(), "parent");
+    EXPECT_EQ(kStringVariable2.Get(), "parent2");
+  }).Get();
+
+  EXPECT_EQ(kStringVariable.Get(), "parent");
+}
+
 UTEST_MT(TaskInheritedVariable, VariablesAfterParentTaskDeath, 4) {
   using Event = engine::SingleConsumerEvent;
   Event assigned_a{Event::NoAutoReset{}};
@@ -0,0 +1,57 @@
+#include <engine/task/resource_usage.hpp>
+
+#include <ctime>
+
+#include <engine/task/task_context.hpp>
+#include <userver/compiler/thread_local.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+compiler::ThreadLocal thread_allocated_bytes = [] {
+  return utils::jemalloc::GetThreadAllocatedBytesCounter();
+};
+
+}  // namespace
+
+TaskResourceUsage GetThreadResourceUsage() noexcept {
+  TaskResourceUsage usage;
+
+  ::timespec cpu_time{};
+  if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time) == 0) {
+    usage.cpu_time =
+        std::chrono::seconds{cpu_time.tv_sec} +
+        std::chrono::nanoseconds{cpu_time.tv_nsec};
+  }
+
+  auto allocated_bytes = thread_allocated_bytes.Use();
+  if (const auto* counter = *allocated_bytes) {
+    usage.allocated_bytes = *counter;
+  }
+
+  return usage;
+}
+
+TaskResourceUsageStopwatch::TaskResourceUsageStopwatch() noexcept {
+  const auto* const context = current_task::GetCurrentTaskContextUnchecked();
+  if (context && context->IsResourceUsageAccounted()) {
+    task_ = context;
+    start_ = context->GetResourceUsage();
+  }
+}
+
+std::optional<TaskResourceUsage> TaskResourceUsageStopwatch::GetElapsed()
+    const noexcept {
+  if (!task_ || task_ != current_task::GetCurrentTaskContextUnchecked()) {
+    return std::nullopt;
+  }
+  return task_->GetResourceUsage() - start_;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+class TaskContext;
+
+/// CPU time and allocated memory, accounted per task if
+/// TaskProcessorConfig::resource_usage_accounting is set.
+struct TaskResourceUsage final {
+  std::chrono::nanoseconds cpu_time{0};
+  /// Zero if jemalloc is not used
+  std::uint64_t allocated_bytes{0};
+
+  TaskResourceUsage& operator+=(const TaskResourceUsage& other) noexcept {
+    cpu_time += other.cpu_time;
+    allocated_bytes += other.allocated_bytes;
+    return *this;
+  }
+
+  TaskResourceUsage& operator-=(const TaskResourceUsage& other) noexcept {
+    cpu_time -= other.cpu_time;
+    allocated_bytes -= other.allocated_bytes;
+    return *this;
+  }
+};
+
+inline TaskResourceUsage operator+(TaskResourceUsage lhs,
+                                   const TaskResourceUsage& rhs) noexcept {
+  return lhs += rhs;
+}
+
+inline TaskResourceUsage operator-(TaskResourceUsage lhs,
+                                   const TaskResourceUsage& rhs) noexcept {
+  return lhs -= rhs;
+}
+
+/// CPU time and allocated bytes of the current thread since its start
+TaskResourceUsage GetThreadResourceUsage() noexcept;
+
+/// Measures the resource usage of the current task from construction till
+/// the GetElapsed() call.
+class TaskResourceUsageStopwatch final {
+ public:
+  TaskResourceUsageStopwatch() noexcept;
+
+  /// Returns std::nullopt if the accounting is disabled for the task or if
+  /// called from a task other than the one that constructed the stopwatch
+  std::optional<TaskResourceUsage> GetElapsed() const noexcept;
+
+ private:
+  const TaskContext* task_{nullptr};
+  TaskResourceUsage start_{};
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
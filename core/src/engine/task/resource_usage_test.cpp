@@ -0,0 +1,77 @@
+#include <engine/task/resource_usage.hpp>
+
+#include <chrono>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void BurnCpu(std::chrono::milliseconds duration) {
+  // Thread CPU time, so that the sleeping or a preempted thread is not counted
+  const auto start = engine::impl::GetThreadResourceUsage().cpu_time;
+  volatile std::uint64_t sink = 0;
+  while (engine::impl::GetThreadResourceUsage().cpu_time - start < duration) {
+    for (int i = 0; i < 1000; ++i) sink = sink + i;
+  }
+}
+
+engine::impl::TaskProcessorHolder MakeAccountingTaskProcessor() {
+  engine::TaskProcessorConfig config;
+  config.name = "accounting";
+  config.thread_name = "acc-worker";
+  config.worker_threads = 1;
+  config.resource_usage_accounting = true;
+
+  return engine::impl::TaskProcessorHolder{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config),
+          engine::current_task::GetTaskProcessor().GetTaskProcessorPools())};
+}
+
+}  // namespace
+
+UTEST(TaskResourceUsage, Disabled) {
+  const engine::impl::TaskResourceUsageStopwatch stopwatch;
+  BurnCpu(std::chrono::milliseconds{1});
+  EXPECT_FALSE(stopwatch.GetElapsed());
+}
+
+UTEST(TaskResourceUsage, CpuTime) {
+  auto task_processor = MakeAccountingTaskProcessor();
+
+  engine::AsyncNoSpan(*task_processor, [] {
+    const engine::impl::TaskResourceUsageStopwatch stopwatch;
+    BurnCpu(std::chrono::milliseconds{20});
+    // Time spent in sleep is not accounted
+    engine::SleepFor(std::chrono::milliseconds{50});
+    BurnCpu(std::chrono::milliseconds{20});
+
+    const auto elapsed = stopwatch.GetElapsed();
+    ASSERT_TRUE(elapsed);
+    EXPECT_GE(elapsed->cpu_time, std::chrono::milliseconds{40});
+    EXPECT_LT(elapsed->cpu_time, std::chrono::milliseconds{90});
+  }).Get();
+}
+
+UTEST(TaskResourceUsage, OtherTask) {
+  auto task_processor = MakeAccountingTaskProcessor();
+
+  engine::AsyncNoSpan(*task_processor, [&task_processor] {
+    const engine::impl::TaskResourceUsageStopwatch stopwatch;
+    engine::AsyncNoSpan(*task_processor, [&stopwatch] {
+      EXPECT_FALSE(stopwatch.GetElapsed());
+    }).Get();
+    EXPECT_TRUE(stopwatch.GetElapsed());
+  }).Get();
+}
+
+USERVER_NAMESPACE_END
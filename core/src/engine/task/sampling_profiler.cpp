@@ -0,0 +1,650 @@
+#include <engine/task/sampling_profiler.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <boost/stacktrace.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <userver/compiler/thread_local.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/strerror.hpp>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <csignal>
+#include <ctime>
+
+#if defined(SIGEV_THREAD_ID)
+#define HAS_SAMPLING_PROFILER
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+void ProfilerTaskLabel::Set(std::string_view label) noexcept {
+  const auto size = std::min(label.size(), kMaxSize);
+
+  // The signal handler may interrupt us at any point. It reads nothing while
+  // the size is zero, so the data is never observed half-written.
+  size_.store(0, std::memory_order_relaxed);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  std::memcpy(data_.data(), label.data(), size);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  size_.store(static_cast<std::uint8_t>(size), std::memory_order_relaxed);
+}
+
+void ProfilerTaskLabel::Clear() noexcept {
+  size_.store(0, std::memory_order_relaxed);
+}
+
+std::size_t ProfilerTaskLabel::CopyTo(char* out) const noexcept {
+  const auto size = size_.load(std::memory_order_relaxed);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  std::memcpy(out, data_.data(), size);
+  return size;
+}
+
+namespace {
+
+constexpr std::size_t kMaxFrames = 64;
+
+// ~2.5 seconds of samples with the default frequency, the buffers are drained
+// more often than that.
+constexpr std::size_t kBufferCapacity = 256;
+
+constexpr std::size_t kMaxFrequency = 1000;
+
+struct StackKey final {
+  std::string task_processor;
+  std::string label;
+  // The innermost frame goes first
+  std::vector<const void*> frames;
+
+  bool operator<(const StackKey& other) const {
+    return std::tie(task_processor, label, frames) <
+           std::tie(other.task_processor, other.label, other.frames);
+  }
+};
+
+using Profile = std::map<StackKey, std::uint64_t>;
+
+struct Symbol final {
+  std::string name;
+  std::string file;
+  std::size_t line{0};
+};
+
+Symbol Symbolize(const void* address) {
+  const boost::stacktrace::frame frame{address};
+  Symbol symbol{frame.name(), frame.source_file(), frame.source_line()};
+  if (symbol.name.empty()) {
+    symbol.name = fmt::format("{}", address);
+  }
+  return symbol;
+}
+
+/// Minimal protobuf encoder, enough for the pprof `Profile` message
+class ProtoWriter final {
+ public:
+  void Varint(std::uint64_t value) {
+    while (value >= 0x80) {
+      data_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    data_.push_back(static_cast<char>(value));
+  }
+
+  void UInt(int field, std::uint64_t value) {
+    Tag(field, kVarintType);
+    Varint(value);
+  }
+
+  void Bytes(int field, std::string_view value) {
+    Tag(field, kLengthDelimitedType);
+    Varint(value.size());
+    data_.append(value);
+  }
+
+  void Message(int field, const ProtoWriter& message) {
+    Bytes(field, message.data_);
+  }
+
+  const std::string& Get() const& { return data_; }
+  std::string Extract() && { return std::move(data_); }
+
+ private:
+  static constexpr int kVarintType = 0;
+  static constexpr int kLengthDelimitedType = 2;
+
+  void Tag(int field, int wire_type) {
+    Varint(static_cast<std::uint64_t>(field) << 3 |
+           static_cast<std::uint64_t>(wire_type));
+  }
+
+  std::string data_;
+};
+
+class StringTable final {
+ public:
+  StringTable() { Index({}); }
+
+  std::uint64_t Index(const std::string& value) {
+    const auto [it, inserted] = indices_.emplace(value, strings_.size());
+    if (inserted) strings_.push_back(value);
+    return it->second;
+  }
+
+  void WriteTo(int field, ProtoWriter& out) const {
+    for (const auto& string : strings_) out.Bytes(field, string);
+  }
+
+ private:
+  std::unordered_map<std::string, std::uint64_t> indices_;
+  std::vector<std::string> strings_;
+};
+
+ProtoWriter MakeValueType(StringTable& strings, const std::string& type,
+                          const std::string& unit) {
+  ProtoWriter value_type;
+  value_type.UInt(1, strings.Index(type));
+  value_type.UInt(2, strings.Index(unit));
+  return value_type;
+}
+
+ProtoWriter MakeStringLabel(StringTable& strings, const std::string& key,
+                            const std::string& value) {
+  ProtoWriter label;
+  label.UInt(1, strings.Index(key));
+  label.UInt(2, strings.Index(value));
+  return label;
+}
+
+#ifdef HAS_SAMPLING_PROFILER
+
+// The signal handler and the signal trampoline
+constexpr std::size_t kSkippedFrames = 2;
+
+struct Sample final {
+  // +1 for the terminating zero frame of boost::stacktrace::safe_dump_to
+  std::array<const void*, kMaxFrames + 1> frames;
+  std::uint8_t frames_count;
+  std::uint8_t label_size;
+  std::array<char, ProfilerTaskLabel::kMaxSize> label;
+};
+
+// Single producer (the signal handler) and single consumer (Drain) ring
+// buffer.
+struct SampleBuffer final {
+  std::array<Sample, kBufferCapacity> samples{};
+  std::atomic<std::uint64_t> head{0};
+  std::atomic<std::uint64_t> tail{0};
+  std::atomic<std::uint64_t> dropped{0};
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "Lock-free atomics are required in the signal handler");
+
+struct ThreadEntry final {
+  std::string task_processor_name;
+  ::pid_t tid{};
+  ::pthread_t thread{};
+
+  // Allocated on the first start of the profiler and only freed on thread
+  // unregistration, so that a late signal never observes a dangling buffer.
+  std::unique_ptr<SampleBuffer> buffer;
+  std::atomic<SampleBuffer*> active_buffer{nullptr};
+
+  ::timer_t timer{};
+  bool has_timer{false};
+};
+
+compiler::ThreadLocal local_thread_entry = [] {
+  return static_cast<ThreadEntry*>(nullptr);
+};
+
+void SamplingSignalHandler(int, siginfo_t*, void*) noexcept {
+  const auto saved_errno = errno;
+
+  ThreadEntry* entry = nullptr;
+  {
+    auto entry_scope = local_thread_entry.Use();
+    entry = *entry_scope;
+  }
+  auto* const buffer =
+      entry ? entry->active_buffer.load(std::memory_order_acquire) : nullptr;
+
+  if (buffer) {
+    const auto head = buffer->head.load(std::memory_order_relaxed);
+    const auto tail = buffer->tail.load(std::memory_order_acquire);
+    if (head - tail >= kBufferCapacity) {
+      buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      auto& sample = buffer->samples[head % kBufferCapacity];
+      const auto stored = boost::stacktrace::safe_dump_to(
+          kSkippedFrames, sample.frames.data(), sizeof(sample.frames));
+      sample.frames_count = static_cast<std::uint8_t>(stored ? stored - 1 : 0);
+
+      auto* const context = current_task::GetCurrentTaskContextUnchecked();
+      sample.label_size = static_cast<std::uint8_t>(
+          context ? context->GetProfilerLabel().CopyTo(sample.label.data())
+                  : 0);
+
+      buffer->head.store(head + 1, std::memory_order_release);
+    }
+  }
+
+  errno = saved_errno;
+}
+
+void LogErrno(std::string_view message) {
+  const auto saved_errno = errno;
+  LOG_LIMITED_WARNING() << message << ", errno: " << saved_errno << " ("
+                        << utils::strerror(saved_errno) << ")";
+}
+
+#endif
+
+}  // namespace
+
+struct SamplingProfiler::Impl final {
+#ifdef HAS_SAMPLING_PROFILER
+  void InstallSignalHandler() {
+    if (is_signal_handler_installed) return;
+
+    struct sigaction sa {};
+    sa.sa_flags = SA_RESTART | SA_SIGINFO | SA_ONSTACK;
+    sa.sa_sigaction = &SamplingSignalHandler;
+    if (::sigaction(SIGPROF, &sa, nullptr) == -1) {
+      const auto saved_errno = errno;
+      throw std::runtime_error(
+          fmt::format("Failed to install the SIGPROF handler: {}",
+                      utils::strerror(saved_errno)));
+    }
+    is_signal_handler_installed = true;
+  }
+
+  void ArmTimer(ThreadEntry& entry) {
+    UASSERT(!entry.has_timer);
+    if (!entry.buffer) {
+      entry.buffer = std::make_unique<SampleBuffer>();
+      entry.active_buffer.store(entry.buffer.get(), std::memory_order_release);
+    }
+
+    ::clockid_t clock{};
+    if (::pthread_getcpuclockid(entry.thread, &clock) != 0) {
+      LOG_LIMITED_WARNING() << "Failed to get the CPU clock of a thread";
+      return;
+    }
+
+    ::sigevent event{};
+    event.sigev_notify = SIGEV_THREAD_ID;
+    event.sigev_signo = SIGPROF;
+    event.sigev_notify_thread_id = entry.tid;
+    ::timer_t timer{};
+    if (::timer_create(clock, &event, &timer) == -1) {
+      LogErrno("Failed to create a profiling timer");
+      return;
+    }
+
+    const auto period = std::chrono::nanoseconds{std::chrono::seconds{1}} /
+                        static_cast<std::int64_t>(frequency);
+    const auto period_seconds =
+        std::chrono::duration_cast<std::chrono::seconds>(period);
+    ::itimerspec spec{};
+    spec.it_interval.tv_sec = period_seconds.count();
+    spec.it_interval.tv_nsec = (period - period_seconds).count();
+    spec.it_value = spec.it_interval;
+    if (::timer_settime(timer, 0, &spec, nullptr) == -1) {
+      LogErrno("Failed to arm a profiling timer");
+      ::timer_delete(timer);
+      return;
+    }
+
+    entry.timer = timer;
+    entry.has_timer = true;
+  }
+
+  static void DisarmTimer(ThreadEntry& entry) noexcept {
+    if (!entry.has_timer) return;
+    ::timer_delete(entry.timer);
+    entry.has_timer = false;
+  }
+
+  void DrainBuffer(ThreadEntry& entry) {
+    if (!entry.buffer) return;
+    auto& buffer = *entry.buffer;
+
+    const auto head = buffer.head.load(std::memory_order_acquire);
+    auto tail = buffer.tail.load(std::memory_order_relaxed);
+    for (; tail != head; ++tail) {
+      const auto& sample = buffer.samples[tail % kBufferCapacity];
+      StackKey key{
+          entry.task_processor_name,
+          std::string{sample.label.data(), sample.label_size},
+          std::vector<const void*>(
+              sample.frames.begin(),
+              sample.frames.begin() + sample.frames_count),
+      };
+      ++profile[std::move(key)];
+      ++samples;
+    }
+    buffer.tail.store(tail, std::memory_order_release);
+
+    dropped_samples += buffer.dropped.exchange(0, std::memory_order_relaxed);
+  }
+
+  std::vector<std::unique_ptr<ThreadEntry>> threads;
+  bool is_signal_handler_installed{false};
+#endif
+
+  // Protects everything below
+  mutable std::mutex mutex;
+  bool is_running{false};
+  std::size_t frequency{0};
+  Profile profile;
+  std::uint64_t samples{0};
+  std::uint64_t dropped_samples{0};
+  std::chrono::system_clock::time_point profile_start{
+      std::chrono::system_clock::now()};
+
+  // Symbolization is slow, so it is done under a separate mutex to not block
+  // the draining and the threads registration.
+  std::mutex symbols_mutex;
+  std::unordered_map<const void*, Symbol> symbols;
+
+  struct ProfileCopy final {
+    Profile profile;
+    std::size_t frequency{0};
+    std::uint64_t dropped_samples{0};
+    std::chrono::system_clock::time_point profile_start;
+  };
+
+  ProfileCopy CopyProfile() const {
+    const std::lock_guard lock{mutex};
+    return {profile, frequency, dropped_samples, profile_start};
+  }
+
+  // Must be called with symbols_mutex held
+  const Symbol& GetSymbol(const void* address) {
+    auto it = symbols.find(address);
+    if (it == symbols.end()) {
+      it = symbols.emplace(address, Symbolize(address)).first;
+    }
+    return it->second;
+  }
+};
+
+SamplingProfiler& SamplingProfiler::Get() {
+  static SamplingProfiler profiler;
+  return profiler;
+}
+
+SamplingProfiler::SamplingProfiler() : impl_(std::make_unique<Impl>()) {}
+
+SamplingProfiler::~SamplingProfiler() { Stop(); }
+
+void SamplingProfiler::RegisterThread(
+    [[maybe_unused]] std::string_view task_processor_name) {
+#ifdef HAS_SAMPLING_PROFILER
+  auto entry = std::make_unique<ThreadEntry>();
+  entry->task_processor_name = std::string{task_processor_name};
+  entry->tid = static_cast<::pid_t>(::syscall(SYS_gettid));
+  entry->thread = ::pthread_self();
+
+  const std::lock_guard lock{impl_->mutex};
+  if (impl_->is_running) impl_->ArmTimer(*entry);
+
+  {
+    auto entry_scope = local_thread_entry.Use();
+    UASSERT_MSG(!*entry_scope, "The thread is already registered");
+    *entry_scope = entry.get();
+  }
+  impl_->threads.push_back(std::move(entry));
+#endif
+}
+
+void SamplingProfiler::UnregisterThread() noexcept {
+#ifdef HAS_SAMPLING_PROFILER
+  ThreadEntry* entry = nullptr;
+  {
+    auto entry_scope = local_thread_entry.Use();
+    entry = std::exchange(*entry_scope, nullptr);
+  }
+  if (!entry) return;
+  // The signal handler of this thread does not see the entry any more
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+
+  const std::lock_guard lock{impl_->mutex};
+  Impl::DisarmTimer(*entry);
+  try {
+    impl_->DrainBuffer(*entry);
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_WARNING() << "Failed to drain the profiling samples: " << ex;
+  }
+
+  auto& threads = impl_->threads;
+  const auto it =
+      std::find_if(threads.begin(), threads.end(),
+                   [entry](const auto& other) { return other.get() == entry; });
+  UASSERT(it != threads.end());
+  if (it != threads.end()) threads.erase(it);
+#endif
+}
+
+void SamplingProfiler::Start([[maybe_unused]] std::size_t frequency) {
+#ifdef HAS_SAMPLING_PROFILER
+  if (frequency == 0 || frequency > kMaxFrequency) {
+    throw std::invalid_argument(fmt::format(
+        "Profiling frequency should be in [1, {}], got {}", kMaxFrequency,
+        frequency));
+  }
+
+  const std::lock_guard lock{impl_->mutex};
+  impl_->InstallSignalHandler();
+
+  if (!impl_->is_running && impl_->profile.empty()) {
+    impl_->profile_start = std::chrono::system_clock::now();
+  }
+  impl_->frequency = frequency;
+  impl_->is_running = true;
+  for (auto& entry : impl_->threads) {
+    Impl::DisarmTimer(*entry);
+    impl_->ArmTimer(*entry);
+  }
+  LOG_INFO() << "Sampling profiler started with frequency " << frequency
+             << "Hz for " << impl_->threads.size() << " threads";
+#else
+  throw std::runtime_error(
+      "Sampling profiler is not supported on this platform");
+#endif
+}
+
+void SamplingProfiler::Stop() noexcept {
+  const std::lock_guard lock{impl_->mutex};
+  if (!impl_->is_running) return;
+
+#ifdef HAS_SAMPLING_PROFILER
+  for (auto& entry : impl_->threads) Impl::DisarmTimer(*entry);
+#endif
+  impl_->is_running = false;
+}
+
+void SamplingProfiler::Drain() {
+#ifdef HAS_SAMPLING_PROFILER
+  const std::lock_guard lock{impl_->mutex};
+  for (auto& entry : impl_->threads) impl_->DrainBuffer(*entry);
+#endif
+}
+
+void SamplingProfiler::Reset() {
+  const std::lock_guard lock{impl_->mutex};
+#ifdef HAS_SAMPLING_PROFILER
+  // Samples taken before the reset should not get into the new profile
+  for (auto& entry : impl_->threads) impl_->DrainBuffer(*entry);
+#endif
+  impl_->profile.clear();
+  impl_->samples = 0;
+  impl_->dropped_samples = 0;
+  impl_->profile_start = std::chrono::system_clock::now();
+}
+
+std::string SamplingProfiler::GetPprof() {
+  Drain();
+  const auto copy = impl_->CopyProfile();
+
+  const auto period =
+      copy.frequency
+          ? std::chrono::nanoseconds{std::chrono::seconds{1}}.count() /
+                static_cast<std::int64_t>(copy.frequency)
+          : 0;
+
+  StringTable strings;
+  ProtoWriter profile;
+  profile.Message(1, MakeValueType(strings, "samples", "count"));
+  profile.Message(1, MakeValueType(strings, "cpu", "nanoseconds"));
+
+  ProtoWriter locations;
+  ProtoWriter functions;
+  std::unordered_map<const void*, std::uint64_t> location_ids;
+  std::unordered_map<std::string, std::uint64_t> function_ids;
+
+  const std::lock_guard symbols_lock{impl_->symbols_mutex};
+  const auto get_location_id = [&](const void* address) {
+    const auto [location_it, location_inserted] =
+        location_ids.emplace(address, location_ids.size() + 1);
+    if (!location_inserted) return location_it->second;
+
+    const auto& symbol = impl_->GetSymbol(address);
+    const auto [function_it, function_inserted] =
+        function_ids.emplace(symbol.name, function_ids.size() + 1);
+    if (function_inserted) {
+      ProtoWriter function;
+      function.UInt(1, function_it->second);
+      function.UInt(2, strings.Index(symbol.name));
+      function.UInt(3, strings.Index(symbol.name));
+      function.UInt(4, strings.Index(symbol.file));
+      functions.Message(5, function);
+    }
+
+    ProtoWriter line;
+    line.UInt(1, function_it->second);
+    line.UInt(2, symbol.line);
+
+    ProtoWriter location;
+    location.UInt(1, location_it->second);
+    location.UInt(3, reinterpret_cast<std::uintptr_t>(address));
+    location.Message(4, line);
+    locations.Message(4, location);
+    return location_it->second;
+  };
+
+  for (const auto& [key, count] : copy.profile) {
+    ProtoWriter location_id_list;
+    for (const auto* address : key.frames) {
+      location_id_list.Varint(get_location_id(address));
+    }
+
+    ProtoWriter values;
+    values.Varint(count);
+    values.Varint(count * period);
+
+    ProtoWriter sample;
+    sample.Message(1, location_id_list);
+    sample.Message(2, values);
+    sample.Message(
+        3, MakeStringLabel(strings, "task_processor", key.task_processor));
+    if (!key.label.empty()) {
+      sample.Message(3, MakeStringLabel(strings, "span", key.label));
+    }
+    profile.Message(2, sample);
+  }
+
+  const auto now = std::chrono::system_clock::now();
+  const auto start_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      copy.profile_start.time_since_epoch());
+  const auto duration_nanos =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now -
+                                                           copy.profile_start);
+  const auto comment = strings.Index(
+      fmt::format("dropped samples: {}", copy.dropped_samples));
+  const auto period_type = MakeValueType(strings, "cpu", "nanoseconds");
+
+  auto result = std::move(profile).Extract();
+  result += locations.Get();
+  result += functions.Get();
+
+  ProtoWriter tail;
+  strings.WriteTo(6, tail);
+  tail.UInt(9, start_nanos.count());
+  tail.UInt(10, duration_nanos.count());
+  tail.Message(11, period_type);
+  tail.UInt(12, period);
+  tail.UInt(13, comment);
+  result += tail.Get();
+  return result;
+}
+
+std::string SamplingProfiler::GetFolded() {
+  Drain();
+  const auto copy = impl_->CopyProfile();
+
+  // Different addresses within the same function are merged
+  std::map<std::string, std::uint64_t> stacks;
+  {
+    const std::lock_guard symbols_lock{impl_->symbols_mutex};
+    std::string stack;
+    for (const auto& [key, count] : copy.profile) {
+      stack = key.task_processor;
+      if (!key.label.empty()) {
+        stack += ';';
+        stack += key.label;
+      }
+      for (auto it = key.frames.rbegin(); it != key.frames.rend(); ++it) {
+        stack += ';';
+        stack += impl_->GetSymbol(*it).name;
+      }
+      stacks[stack] += count;
+    }
+  }
+
+  std::string result;
+  for (const auto& [stack, count] : stacks) {
+    result += stack;
+    result += fmt::format(" {}\n", count);
+  }
+  return result;
+}
+
+SamplingProfilerStats SamplingProfiler::GetStats() const {
+  const std::lock_guard lock{impl_->mutex};
+  SamplingProfilerStats stats;
+  stats.is_running = impl_->is_running;
+  stats.frequency = impl_->frequency;
+  stats.samples = impl_->samples;
+  stats.dropped_samples = impl_->dropped_samples;
+#ifdef HAS_SAMPLING_PROFILER
+  stats.threads = impl_->threads.size();
+#endif
+  return stats;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// A short label of the task, that is read by the SamplingProfiler signal
+/// handler. Written only by the thread that runs the task, so the signal
+/// handler that interrupted the writer never observes a torn value.
+class ProfilerTaskLabel final {
+ public:
+  static constexpr std::size_t kMaxSize = 47;
+
+  /// Truncates the label to kMaxSize bytes
+  void Set(std::string_view label) noexcept;
+  void Clear() noexcept;
+
+  /// Async-signal-safe, returns the number of bytes written into `out`
+  std::size_t CopyTo(char* out) const noexcept;
+
+ private:
+  std::array<char, kMaxSize> data_{};
+  std::atomic<std::uint8_t> size_{0};
+};
+
+struct SamplingProfilerStats final {
+  bool is_running{false};
+  std::size_t frequency{0};
+  std::uint64_t samples{0};
+  std::uint64_t dropped_samples{0};
+  std::size_t threads{0};
+};
+
+/// @brief Always-on capable sampling CPU profiler of the TaskProcessor
+/// threads.
+///
+/// Each registered thread gets a per-thread CPU time timer that delivers
+/// SIGPROF to that very thread. The signal handler captures the raw
+/// stacktrace and the label of the current task into a single-producer
+/// single-consumer ring buffer of the thread. Drain() moves the samples from
+/// the ring buffers to the aggregated profile, symbolization is done only on
+/// GetPprof() and GetFolded().
+///
+/// Only implemented on Linux, Start() throws on other platforms.
+class SamplingProfiler final {
+ public:
+  static SamplingProfiler& Get();
+
+  /// Must be called from the thread that is being registered
+  void RegisterThread(std::string_view task_processor_name);
+
+  /// Must be called from the thread that was registered
+  void UnregisterThread() noexcept;
+
+  /// Starts sampling of all the registered threads and of the threads
+  /// registered later. Restarts the sampling if it is already running.
+  void Start(std::size_t frequency);
+  void Stop() noexcept;
+
+  /// Moves the samples from the per-thread buffers to the aggregated profile
+  void Drain();
+
+  /// Forgets the aggregated profile
+  void Reset();
+
+  /// Drains and returns the aggregated profile in the uncompressed pprof
+  /// protobuf format
+  std::string GetPprof();
+
+  /// Drains and returns the aggregated profile in the 'folded stacks' format
+  /// of the FlameGraph tools
+  std::string GetFolded();
+
+  SamplingProfilerStats GetStats() const;
+
+  ~SamplingProfiler();
+
+ private:
+  struct Impl;
+
+  SamplingProfiler();
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
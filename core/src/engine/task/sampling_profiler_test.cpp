@@ -0,0 +1,94 @@
+#include <engine/task/sampling_profiler.hpp>
+
+#include <chrono>
+#include <string>
+
+#include <engine/task/task_context.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void BurnCpu(std::chrono::milliseconds duration) {
+  const auto deadline = std::chrono::steady_clock::now() + duration;
+  volatile std::uint64_t sink = 0;
+  while (std::chrono::steady_clock::now() < deadline) {
+    for (int i = 0; i < 1000; ++i) sink = sink + i;
+  }
+}
+
+std::string GetLabel(engine::impl::TaskContext& context) {
+  std::string label(engine::impl::ProfilerTaskLabel::kMaxSize, '\0');
+  label.resize(context.GetProfilerLabel().CopyTo(label.data()));
+  return label;
+}
+
+}  // namespace
+
+TEST(SamplingProfiler, LabelTruncation) {
+  engine::impl::ProfilerTaskLabel label;
+  const std::string long_label(100, 'x');
+  label.Set(long_label);
+
+  std::string result(engine::impl::ProfilerTaskLabel::kMaxSize, '\0');
+  EXPECT_EQ(label.CopyTo(result.data()),
+            engine::impl::ProfilerTaskLabel::kMaxSize);
+  EXPECT_EQ(result, long_label.substr(0, result.size()));
+
+  label.Clear();
+  EXPECT_EQ(label.CopyTo(result.data()), 0);
+}
+
+UTEST(SamplingProfiler, RootSpanLabel) {
+  auto& context = engine::current_task::GetCurrentTaskContext();
+  EXPECT_EQ(GetLabel(context), "");
+  {
+    tracing::Span root_span{"root_span"};
+    EXPECT_EQ(GetLabel(context), "root_span");
+    {
+      tracing::Span child_span{"child_span"};
+      EXPECT_EQ(GetLabel(context), "root_span");
+    }
+    EXPECT_EQ(GetLabel(context), "root_span");
+  }
+  EXPECT_EQ(GetLabel(context), "");
+}
+
+#ifdef __linux__
+
+UTEST(SamplingProfiler, Sample) {
+  auto& profiler = engine::impl::SamplingProfiler::Get();
+  profiler.Reset();
+
+  profiler.Start(1000);
+  {
+    tracing::Span span{"profiled_span"};
+    BurnCpu(std::chrono::milliseconds{300});
+  }
+  profiler.Stop();
+
+  const auto stats = profiler.GetStats();
+  EXPECT_FALSE(stats.is_running);
+  EXPECT_GE(stats.threads, 1);
+
+  const auto folded = profiler.GetFolded();
+  EXPECT_NE(folded.find("profiled_span"), std::string::npos) << folded;
+  EXPECT_FALSE(profiler.GetPprof().empty());
+  EXPECT_GT(profiler.GetStats().samples, 0);
+
+  profiler.Reset();
+  EXPECT_EQ(profiler.GetStats().samples, 0);
+}
+
+UTEST(SamplingProfiler, InvalidFrequency) {
+  auto& profiler = engine::impl::SamplingProfiler::Get();
+  EXPECT_THROW(profiler.Start(0), std::invalid_argument);
+  EXPECT_THROW(profiler.Start(100500), std::invalid_argument);
+  EXPECT_FALSE(profiler.GetStats().is_running);
+}
+
+#endif
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,120 @@
+#include <engine/task/task_arena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// Chunks freed on a thread are reused by the tasks that allocate on it. The
+// number of cached chunks is bounded, as tasks may migrate between threads.
+constexpr std::size_t kMaxCachedChunks = 16;
+
+class ChunkCache final {
+ public:
+  ~ChunkCache() {
+    for (void* chunk : chunks_) ::operator delete(chunk);
+  }
+
+  void* Acquire() {
+    if (chunks_.empty()) return ::operator new(TaskArena::kChunkSize);
+
+    void* chunk = chunks_.back();
+    chunks_.pop_back();
+    return chunk;
+  }
+
+  void Release(void* chunk) noexcept {
+    if (chunks_.size() < kMaxCachedChunks) {
+      chunks_.reserve(kMaxCachedChunks);
+      chunks_.push_back(chunk);
+    } else {
+      ::operator delete(chunk);
+    }
+  }
+
+ private:
+  std::vector<void*> chunks_;
+};
+
+ChunkCache& GetChunkCache() {
+  thread_local ChunkCache cache;
+  return cache;
+}
+
+char* AlignUp(char* ptr, std::size_t alignment) noexcept {
+  const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+  const auto aligned = (address + alignment - 1) & ~(alignment - 1);
+  return ptr + (aligned - address);
+}
+
+}  // namespace
+
+TaskArena::~TaskArena() {
+  FreeChunks(std::exchange(large_blocks_, nullptr));
+
+  auto& cache = GetChunkCache();
+  while (chunks_) {
+    cache.Release(std::exchange(chunks_, chunks_->next));
+  }
+}
+
+void* TaskArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+  if (bytes > kChunkSize / 4 || alignment > alignof(Chunk)) {
+    return AllocateLarge(bytes, alignment);
+  }
+
+  char* result = AlignUp(pos_, alignment);
+  if (!pos_ || result + bytes > end_) {
+    auto* chunk = static_cast<Chunk*>(GetChunkCache().Acquire());
+    chunk->next = chunks_;
+    chunks_ = chunk;
+    end_ = reinterpret_cast<char*>(chunk) + kChunkSize;
+    // sizeof(Chunk) is a multiple of any fundamental alignment
+    result = reinterpret_cast<char*>(chunk + 1);
+  }
+
+  pos_ = result + bytes;
+  return result;
+}
+
+void TaskArena::do_deallocate(void* /*ptr*/, std::size_t /*bytes*/,
+                              std::size_t /*alignment*/) {}
+
+bool TaskArena::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+void* TaskArena::AllocateLarge(std::size_t bytes, std::size_t alignment) {
+  const auto header_size = std::max(sizeof(Chunk), alignment);
+  auto* block = static_cast<char*>(
+      ::operator new(header_size + bytes, std::align_val_t{header_size}));
+
+  // The header is placed right before the memory handed out
+  auto* chunk = reinterpret_cast<Chunk*>(block + header_size) - 1;
+  chunk->next = large_blocks_;
+  chunk->header_size = header_size;
+  large_blocks_ = chunk;
+  return block + header_size;
+}
+
+void TaskArena::FreeChunks(Chunk* chunks) noexcept {
+  while (chunks) {
+    auto* chunk = std::exchange(chunks, chunks->next);
+    auto* block = reinterpret_cast<char*>(chunk + 1) - chunk->header_size;
+    // header_size is the alignment of the block, see AllocateLarge
+    ::operator delete(block, std::align_val_t{chunk->header_size});
+  }
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Monotonic memory arena of a task, see
+// engine::current_task::GetMemoryResource().
+//
+// Memory is handed out from chunks and is returned only when the whole arena
+// is destroyed. The chunks come from a bounded thread-local cache, so a task
+// that fits into a few chunks does not call the system allocator at all.
+// Allocations over a quarter of a chunk get a dedicated block.
+//
+// Not thread-safe: only the owning task allocates. Deallocation does nothing,
+// so it may happen anywhere.
+class TaskArena final : public std::pmr::memory_resource {
+ public:
+  static constexpr std::size_t kChunkSize = 64 * 1024;
+
+  TaskArena() = default;
+  ~TaskArena() override;
+
+  TaskArena(TaskArena&&) = delete;
+  TaskArena& operator=(TaskArena&&) = delete;
+
+ private:
+  struct alignas(std::max_align_t) Chunk final {
+    Chunk* next;
+    // Offset of the header from the start of a large block
+    std::size_t header_size;
+  };
+  static_assert(sizeof(Chunk) == alignof(Chunk));
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* ptr, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+  void* AllocateLarge(std::size_t bytes, std::size_t alignment);
+  static void FreeChunks(Chunk* chunks) noexcept;
+
+  Chunk* chunks_{nullptr};
+  Chunk* large_blocks_{nullptr};
+  char* pos_{nullptr};
+  char* end_{nullptr};
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,70 @@
+#include <engine/task/task_arena.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task_base.hpp>
+#include <userver/formats/json/arena.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+bool IsAligned(const void* ptr, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(TaskArena, Allocate) {
+  engine::impl::TaskArena arena;
+
+  std::vector<void*> blocks;
+  for (std::size_t alignment : {1, 2, 8, 16, 64, 4096}) {
+    for (std::size_t size : {1, 10, 1000, 20000, 100000}) {
+      void* block = arena.allocate(size, alignment);
+      EXPECT_TRUE(IsAligned(block, alignment));
+      std::memset(block, 0, size);
+      blocks.push_back(block);
+    }
+  }
+
+  for (void* block : blocks) arena.deallocate(block, 1);
+  EXPECT_TRUE(arena.is_equal(arena));
+  EXPECT_FALSE(arena.is_equal(*std::pmr::new_delete_resource()));
+}
+
+UTEST(TaskArena, Sample) {
+  /// [Sample GetMemoryResource]
+  auto& resource = engine::current_task::GetMemoryResource();
+
+  std::pmr::vector<std::pmr::string> strings{&resource};
+  for (int i = 0; i < 1000; ++i) {
+    strings.emplace_back("some string that does not fit into SSO");
+  }
+
+  formats::json::ArenaScope arena{resource};
+  const auto json = formats::json::FromString(R"({"key":[1,2,3]})");
+  /// [Sample GetMemoryResource]
+
+  EXPECT_EQ(strings.back(), "some string that does not fit into SSO");
+  EXPECT_EQ(json["key"].GetSize(), 3);
+}
+
+UTEST(TaskArena, PerTask) {
+  auto* resource = &engine::current_task::GetMemoryResource();
+  EXPECT_EQ(resource, &engine::current_task::GetMemoryResource());
+
+  auto* other_resource = utils::Async("other", [] {
+                           return &engine::current_task::GetMemoryResource();
+                         }).Get();
+  EXPECT_NE(resource, other_resource);
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #include <userver/engine/task/task_base.hpp>
 
 #include <future>
+#include <stdexcept>
+
+#include <fmt/format.h>
 
 #include <engine/impl/generic_wait_list.hpp>
 #include <engine/task/task_context.hpp>
@@ -182,6 +185,24 @@ std::size_t GetStackSize() {
       .GetStackSize();
 }
 
+void SetSchedulingClass(std::string_view name) {
+  auto& context = GetCurrentTaskContext();
+  auto& task_processor = context.GetTaskProcessor();
+  if (!task_processor.HasSchedulingClasses()) return;
+
+  const auto scheduling_class = task_processor.FindSchedulingClass(name);
+  if (!scheduling_class) {
+    throw std::runtime_error(
+        fmt::format("Task processor '{}' has no scheduling class '{}'",
+                    task_processor.Name(), name));
+  }
+  context.SetSchedulingClass(*scheduling_class);
+}
+
+std::pmr::memory_resource& GetMemoryResource() {
+  return GetCurrentTaskContext().GetMemoryArena();
+}
+
 ev::ThreadControl& GetEventThread() {
   return GetTaskProcessor().EventThreadPool().NextThread();
 }
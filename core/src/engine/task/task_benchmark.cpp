@@ -4,8 +4,11 @@
 #include <thread>
 
 #include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/single_threaded_task_processors_pool.hpp>
@@ -14,6 +17,25 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+void RunWithTaskQueue(engine::TaskQueueType task_queue,
+                      std::size_t worker_threads,
+                      utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.name = "bench-task-processor";
+  config.thread_name = "bench-worker";
+  config.worker_threads = worker_threads;
+  config.task_queue = task_queue;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+}  // namespace
+
 void engine_task_create(benchmark::State& state) {
   // We use 2 threads to ensure that detached tasks are deallocated,
   // otherwise this benchmark OOMs after some time.
@@ -128,4 +150,87 @@ BENCHMARK(engine_multiple_tasks_multiple_threads)
     ->Arg(6)
     ->Arg(12);
 
+template <engine::TaskQueueType TaskQueue>
+void engine_multiple_tasks_by_task_queue(benchmark::State& state) {
+  RunWithTaskQueue(TaskQueue, state.range(0), [&] {
+    std::atomic<std::uint64_t> tasks_count_total = 0;
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::uint64_t tasks_count = 0;
+      for ([[maybe_unused]] auto _ : range) {
+        engine::AsyncNoSpan([] {}).Wait();
+        tasks_count++;
+      }
+      tasks_count_total += tasks_count;
+    });
+    state.counters["tasks"] =
+        benchmark::Counter(tasks_count_total, benchmark::Counter::kIsRate);
+  });
+}
+BENCHMARK_TEMPLATE(engine_multiple_tasks_by_task_queue,
+                   engine::TaskQueueType::kGlobalTaskQueue)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(engine_multiple_tasks_by_task_queue,
+                   engine::TaskQueueType::kWorkStealingTaskQueue)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+template <engine::TaskQueueType TaskQueue>
+void engine_task_yield_by_task_queue(benchmark::State& state) {
+  RunWithTaskQueue(TaskQueue, state.range(0), [&] {
+    std::atomic<std::uint64_t> total_yields{0};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::uint64_t yields_performed = 0;
+      for ([[maybe_unused]] auto _ : range) {
+        engine::Yield();
+        ++yields_performed;
+      }
+      total_yields += yields_performed;
+    });
+
+    state.counters["yields"] =
+        benchmark::Counter(total_yields, benchmark::Counter::kIsRate);
+  });
+}
+BENCHMARK_TEMPLATE(engine_task_yield_by_task_queue,
+                   engine::TaskQueueType::kGlobalTaskQueue)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(engine_task_yield_by_task_queue,
+                   engine::TaskQueueType::kWorkStealingTaskQueue)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+template <engine::TaskQueueType TaskQueue>
+void engine_task_switch_ping_pong(benchmark::State& state) {
+  RunWithTaskQueue(TaskQueue, state.range(0), [&] {
+    engine::SingleConsumerEvent ping;
+    engine::SingleConsumerEvent pong;
+    std::atomic<bool> keep_running{true};
+
+    auto partner = engine::AsyncNoSpan([&] {
+      while (ping.WaitForEvent() && keep_running) pong.Send();
+    });
+
+    // Each iteration is a wakeup of the partner and two context switches
+    for ([[maybe_unused]] auto _ : state) {
+      ping.Send();
+      [[maybe_unused]] const bool is_sent = pong.WaitForEvent();
+    }
+
+    keep_running = false;
+    ping.Send();
+    partner.Get();
+  });
+}
+BENCHMARK_TEMPLATE(engine_task_switch_ping_pong,
+                   engine::TaskQueueType::kGlobalTaskQueue)
+    ->Arg(1)
+    ->Arg(2);
+BENCHMARK_TEMPLATE(engine_task_switch_ping_pong,
+                   engine::TaskQueueType::kWorkStealingTaskQueue)
+    ->Arg(1)
+    ->Arg(2);
+
 USERVER_NAMESPACE_END
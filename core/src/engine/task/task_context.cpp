@@ -117,10 +117,14 @@ TaskContext::TaskContext(TaskProcessor& task_processor,
       payload_(&payload),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
-      trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
+      trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()),
+      account_resource_usage_(task_processor_.ShouldAccountResourceUsage()) {
   UASSERT(payload_);
-  LOG_TRACE() << "task with task_id="
-              << ReadableTaskId(current_task::GetCurrentTaskContextUnchecked())
+  auto* const parent = current_task::GetCurrentTaskContextUnchecked();
+  if (parent && &parent->task_processor_ == &task_processor_) {
+    scheduling_class_ = parent->scheduling_class_;
+  }
+  LOG_TRACE() << "task with task_id=" << ReadableTaskId(parent)
               << " created task with task_id=" << ReadableTaskId(this)
               << logging::LogExtra::Stacktrace();
 
@@ -542,6 +546,11 @@ void TaskContext::SetCancelDeadline(Deadline deadline) {
   ArmCancellationTimer();
 }
 
+bool TaskContext::IsStartDeadlineReached() const noexcept {
+  if (coro_ || is_critical_) return false;
+  return start_deadline_.IsReached() || cancel_deadline_.IsReached();
+}
+
 bool TaskContext::HasLocalStorage() const noexcept {
   return local_storage_.has_value();
 }
@@ -551,6 +560,12 @@ task_local::Storage& TaskContext::GetLocalStorage() noexcept {
   return *local_storage_;
 }
 
+TaskArena& TaskContext::GetMemoryArena() {
+  UASSERT(IsCurrent());
+  if (!memory_arena_) memory_arena_ = std::make_unique<TaskArena>();
+  return *memory_arena_;
+}
+
 bool TaskContext::IsReady() const noexcept { return IsFinished(); }
 
 EarlyWakeup TaskContext::TryAppendWaiter(TaskContext& waiter) {
@@ -620,7 +635,17 @@ void TaskContext::Schedule() {
   // NOTE: may be executed at this point
 }
 
+TaskResourceUsage TaskContext::GetResourceUsage() const noexcept {
+  UASSERT(current_task::GetCurrentTaskContextUnchecked() == this);
+  if (!account_resource_usage_) return {};
+  return resource_usage_ + (GetThreadResourceUsage() - slice_start_usage_);
+}
+
 void TaskContext::ProfilerStartExecution() {
+  if (account_resource_usage_) {
+    slice_start_usage_ = GetThreadResourceUsage();
+  }
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() > 0) {
     execute_started_ = std::chrono::steady_clock::now();
@@ -630,6 +655,10 @@ void TaskContext::ProfilerStartExecution() {
 }
 
 void TaskContext::ProfilerStopExecution() {
+  if (account_resource_usage_) {
+    resource_usage_ += GetThreadResourceUsage() - slice_start_usage_;
+  }
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() <= 0) return;
 
@@ -14,7 +14,10 @@
 #include <engine/task/context_timer.hpp>
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/cxxabi_eh_globals.hpp>
+#include <engine/task/resource_usage.hpp>
+#include <engine/task/sampling_profiler.hpp>
 #include <engine/task/sleep_state.hpp>
+#include <engine/task/task_arena.hpp>
 #include <engine/task/task_counter.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/context_accessor.hpp>
@@ -160,6 +163,27 @@ class TaskContext final : public ContextAccessor {
 
   TaskId GetTaskId() const { return reinterpret_cast<TaskId>(this); }
 
+  // Label of the task in the SamplingProfiler samples
+  ProfilerTaskLabel& GetProfilerLabel() noexcept { return profiler_label_; }
+
+  bool IsResourceUsageAccounted() const noexcept {
+    return account_resource_usage_;
+  }
+
+  // Includes the current execution slice, must be called from the task itself
+  TaskResourceUsage GetResourceUsage() const noexcept;
+
+  // Index of the scheduling class in the TaskProcessor, inherited from the
+  // task that created this one on the same TaskProcessor
+  std::uint8_t GetSchedulingClass() const noexcept {
+    return scheduling_class_;
+  }
+
+  // Takes effect from the next scheduling of the task
+  void SetSchedulingClass(std::uint8_t scheduling_class) noexcept {
+    scheduling_class_ = scheduling_class;
+  }
+
   std::chrono::steady_clock::time_point GetQueueWaitTimepoint() const {
     return task_queue_wait_timepoint_;
   }
@@ -170,9 +194,22 @@ class TaskContext final : public ContextAccessor {
 
   void SetCancelDeadline(Deadline deadline);
 
+  // Must be called before the task is scheduled
+  void SetStartDeadline(Deadline deadline) noexcept {
+    start_deadline_ = deadline;
+  }
+
+  // The non-critical tasks that have not started by their start or cancel
+  // deadline are cancelled without starting
+  bool IsStartDeadlineReached() const noexcept;
+
   bool HasLocalStorage() const noexcept;
   task_local::Storage& GetLocalStorage() noexcept;
 
+  // Created on the first use, released with the TaskContext, after the
+  // payload and the result of the task
+  TaskArena& GetMemoryArena();
+
   // ContextAccessor implementation
   bool IsReady() const noexcept override;
   EarlyWakeup TryAppendWaiter(TaskContext& waiter) override;
@@ -218,6 +255,7 @@ class TaskContext final : public ContextAccessor {
   const bool is_critical_;
   bool is_cancellable_{true};
   bool within_sleep_{false};
+  std::uint8_t scheduling_class_{0};
   EhGlobals eh_globals_;
 
   utils::impl::WrappedCallBase* payload_;
@@ -230,6 +268,7 @@ class TaskContext final : public ContextAccessor {
 
   ContextTimer deadline_timer_;
   engine::Deadline cancel_deadline_;
+  engine::Deadline start_deadline_;
 
   // {} if not defined
   std::chrono::steady_clock::time_point task_queue_wait_timepoint_;
@@ -238,6 +277,13 @@ class TaskContext final : public ContextAccessor {
 
   std::size_t trace_csw_left_;
 
+  ProfilerTaskLabel profiler_label_;
+
+  const bool account_resource_usage_;
+  TaskResourceUsage resource_usage_{};
+  // Thread counters at the start of the current execution slice
+  TaskResourceUsage slice_start_usage_{};
+
   AtomicSleepState sleep_state_{
       SleepState{SleepFlags::kSleeping, SleepState::Epoch{0}}};
   WakeupSource wakeup_source_{WakeupSource::kNone};
@@ -247,6 +293,7 @@ class TaskContext final : public ContextAccessor {
   YieldReason yield_reason_{YieldReason::kNone};
 
   std::optional<task_local::Storage> local_storage_{};
+  std::unique_ptr<TaskArena> memory_arena_;
 
   // refcounter for task abandoning (cancellation) in engine::SharedTask
   std::atomic<std::size_t> shared_task_usages_{1};
@@ -1,6 +1,7 @@
 #include "task_processor.hpp"
 
 #include <sys/types.h>
+#include <algorithm>
 #include <csignal>
 
 #include <fmt/format.h>
@@ -13,9 +14,12 @@
 #include <userver/utils/rand.hpp>
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
+#include <utils/jemalloc.hpp>
 #include <utils/statistics/thread_statistics.hpp>
+#include <utils/sys_info.hpp>
 
 #include <engine/task/counted_coroutine_ptr.hpp>
+#include <engine/task/sampling_profiler.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
 
@@ -72,6 +76,27 @@ void EmitMagicNanosleep() {
   nanosleep(&ts, nullptr);
 }
 
+std::vector<std::size_t> GetWorkerCpus(const TaskProcessorConfig& config) {
+  if (!config.numa_node) return config.cpu_affinity;
+
+  auto numa_cpus = utils::sys_info::GetNumaNodeCpus(*config.numa_node);
+  if (config.cpu_affinity.empty()) return numa_cpus;
+
+  std::vector<std::size_t> result;
+  for (const auto cpu : config.cpu_affinity) {
+    if (std::find(numa_cpus.begin(), numa_cpus.end(), cpu) != numa_cpus.end()) {
+      result.push_back(cpu);
+    }
+  }
+  if (result.empty()) {
+    throw std::runtime_error(fmt::format(
+        "None of the 'cpu-affinity' CPUs of task processor '{}' belong to "
+        "NUMA node {}",
+        config.name, *config.numa_node));
+  }
+  return result;
+}
+
 void TaskProcessorThreadStartedHook() {
   utils::impl::AssertStaticRegistrationFinished();
   utils::WithDefaultRandom([](auto&) {});
@@ -85,15 +110,31 @@ void TaskProcessorThreadStartedHook() {
 
 TaskProcessor::TaskProcessor(TaskProcessorConfig config,
                              std::shared_ptr<impl::TaskProcessorPools> pools)
-    : task_queue_(config),
+    : task_queue_(MakeTaskQueue(config)),
+      weighted_task_queue_(std::get_if<WeightedTaskQueue>(&task_queue_)),
       task_counter_(config.worker_threads),
+      queue_wait_histograms_(config.worker_threads),
+      worker_os_ids_(config.worker_threads, -1),
       config_(std::move(config)),
-      pools_(std::move(pools)) {
+      pools_(std::move(pools)),
+      worker_cpus_(GetWorkerCpus(config_)) {
   utils::impl::FinishStaticRegistration();
+  if (config_.jemalloc_dedicated_arena) {
+    unsigned arena_index = 0;
+    const auto ec = utils::jemalloc::CreateArena(arena_index);
+    if (ec) {
+      LOG_WARNING() << "Failed to create a jemalloc arena for task processor "
+                    << Name() << ", the shared arenas are used: "
+                    << ec.message();
+    } else {
+      jemalloc_arena_ = arena_index;
+    }
+  }
   try {
     LOG_INFO() << "creating task_processor " << Name() << " "
                << "worker_threads=" << config_.worker_threads
-               << " thread_name=" << config_.thread_name;
+               << " thread_name=" << config_.thread_name
+               << " pinned_cpus=" << worker_cpus_.size();
     concurrent::impl::Latch workers_left{
         static_cast<std::ptrdiff_t>(config_.worker_threads)};
     workers_.reserve(config_.worker_threads);
@@ -101,7 +142,7 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config,
       workers_.emplace_back([this, i, &workers_left] {
         PrepareWorkerThread(i);
         workers_left.count_down();
-        ProcessTasks();
+        ProcessTasks(i);
         FinalizeWorkerThread();
       });
     }
@@ -118,13 +159,31 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config,
 
 TaskProcessor::~TaskProcessor() { Cleanup(); }
 
+TaskProcessor::TaskQueueVariant TaskProcessor::MakeTaskQueue(
+    const TaskProcessorConfig& config) {
+  if (!config.scheduling_classes.empty()) {
+    UINVARIANT(config.task_queue == TaskQueueType::kGlobalTaskQueue,
+               "Scheduling classes require the global task queue");
+    return TaskQueueVariant{std::in_place_type<WeightedTaskQueue>, config};
+  }
+
+  switch (config.task_queue) {
+    case TaskQueueType::kGlobalTaskQueue:
+      return TaskQueueVariant{std::in_place_type<TaskQueue>, config};
+    case TaskQueueType::kWorkStealingTaskQueue:
+      return TaskQueueVariant{std::in_place_type<WorkStealingTaskQueue>,
+                              config};
+  }
+  UINVARIANT(false, "Unexpected task queue type");
+}
+
 void TaskProcessor::Cleanup() noexcept {
   InitiateShutdown();
 
   // Some tasks may be bound but not scheduled yet
   task_counter_.WaitForExhaustionBlocking();
 
-  task_queue_.StopProcessing();
+  std::visit([](auto& queue) { queue.StopProcessing(); }, task_queue_);
 
   for (auto& w : workers_) {
     w.join();
@@ -158,7 +217,7 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
 
   SetTaskQueueWaitTimepoint(context);
 
-  task_queue_.Push(context);
+  std::visit([context](auto& queue) { queue.Push(context); }, task_queue_);
 }
 
 void TaskProcessor::Adopt(impl::TaskContext& context) {
@@ -224,6 +283,19 @@ void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
   profiler_force_stacktrace_.store(settings.profiler_force_stacktrace);
 }
 
+std::optional<std::uint8_t> TaskProcessor::FindSchedulingClass(
+    std::string_view name) const noexcept {
+  if (!weighted_task_queue_) return std::nullopt;
+  const auto index = weighted_task_queue_->FindClass(name);
+  if (!index) return std::nullopt;
+  return static_cast<std::uint8_t>(*index);
+}
+
+const WeightedTaskQueue& TaskProcessor::GetWeightedTaskQueue() const noexcept {
+  UASSERT(weighted_task_queue_);
+  return *weighted_task_queue_;
+}
+
 std::chrono::microseconds TaskProcessor::GetProfilerThreshold() const {
   return task_profiler_threshold_.load();
 }
@@ -259,6 +331,22 @@ logging::LoggerPtr TaskProcessor::GetTaskTraceLogger() const {
   return task_trace_logger_;
 }
 
+void TaskProcessor::CollectQueueWaitHistogram(
+    QueueWaitHistogram& result) const noexcept {
+  for (const auto& histogram : queue_wait_histograms_) {
+    result += *histogram;
+  }
+}
+
+utils::statistics::impl::ThreadSchedulerStats
+TaskProcessor::CollectWorkersSchedulerStats() const {
+  utils::statistics::impl::ThreadSchedulerStats result;
+  for (const auto os_id : worker_os_ids_) {
+    result += utils::statistics::impl::GetThreadSchedulerStats(os_id);
+  }
+  return result;
+}
+
 std::vector<std::uint8_t> TaskProcessor::CollectCurrentLoadPct() const {
   UASSERT(cpu_stats_storage_);
 
@@ -283,29 +371,81 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
       break;
   }
 
+  if (!worker_cpus_.empty()) {
+    // Pin before the first allocations of the thread, so that the thread
+    // local caches and the memory first touched by the worker are placed on
+    // the right NUMA node.
+    try {
+      utils::SetCurrentThreadCpuAffinity(worker_cpus_);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to set CPU affinity for task processor "
+                  << Name() << ": " << ex;
+    }
+  }
+
+  if (jemalloc_arena_) {
+    // Before the thread local caches are filled
+    const auto ec = utils::jemalloc::SetThreadArena(*jemalloc_arena_);
+    if (ec) {
+      LOG_ERROR() << "Failed to bind a thread of task processor " << Name()
+                  << " to its jemalloc arena: " << ec.message();
+    }
+  }
+
   pools_->GetCoroPool().PrepareLocalCache();
 
   utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
 
   impl::SetLocalTaskCounterData(task_counter_, index);
+  worker_os_ids_[index] = utils::statistics::impl::GetCurrentThreadOsId();
 
   pools_->GetCoroPool().RegisterThread();
 
+  impl::SamplingProfiler::Get().RegisterThread(Name());
+
   TaskProcessorThreadStartedHook();
 }
 
 void TaskProcessor::FinalizeWorkerThread() noexcept {
+  impl::SamplingProfiler::Get().UnregisterThread();
   pools_->GetCoroPool().ClearLocalCache();
 }
 
-void TaskProcessor::ProcessTasks() noexcept {
+void TaskProcessor::ProcessTasks(std::size_t worker_index) noexcept {
   while (true) {
-    auto context = task_queue_.PopBlocking();
+    auto context = std::visit([](auto& queue) { return queue.PopBlocking(); },
+                              task_queue_);
     if (!context) break;
 
     GetTaskCounter().AccountTaskSwitchSlow();
     CheckWaitTime(*context);
 
+    // Nobody waits for the results of such tasks anymore, so they are
+    // cancelled right away instead of starting and being cancelled later by
+    // the deadline timer
+    if (context->IsStartDeadlineReached()) {
+      context->RequestCancel(TaskCancellationReason::kDeadline);
+    }
+
+    // The class may change during the step, the slice is charged to the class
+    // the task was scheduled in
+    const auto scheduling_class = context->GetSchedulingClass();
+    const auto wait_timepoint = context->GetQueueWaitTimepoint();
+    const bool has_wait_timepoint =
+        wait_timepoint != std::chrono::steady_clock::time_point();
+    std::chrono::steady_clock::time_point slice_start;
+    if (weighted_task_queue_ || has_wait_timepoint) {
+      slice_start = std::chrono::steady_clock::now();
+    }
+    if (has_wait_timepoint) {
+      const auto wait_time = slice_start - wait_timepoint;
+      queue_wait_histograms_[worker_index]->Account(
+          std::chrono::duration<double, std::micro>(wait_time).count());
+      if (weighted_task_queue_) {
+        weighted_task_queue_->AccountWait(scheduling_class, wait_time);
+      }
+    }
+
     bool has_failed = false;
     try {
       context->DoStep();
@@ -314,6 +454,11 @@ void TaskProcessor::ProcessTasks() noexcept {
       has_failed = true;
     }
 
+    if (weighted_task_queue_) {
+      weighted_task_queue_->AccountExecution(
+          scheduling_class, std::chrono::steady_clock::now() - slice_start);
+    }
+
     pools_->GetCoroPool().AccountStackUsage();
 
     if (has_failed || context->IsFinished()) {
@@ -4,7 +4,10 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <string_view>
 #include <thread>
+#include <variant>
 #include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
@@ -13,10 +16,14 @@
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_queue.hpp>
+#include <engine/task/weighted_task_queue.hpp>
+#include <engine/task/work_stealing_task_queue.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/log_linear_histogram.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -58,17 +65,35 @@ class TaskProcessor final {
   const impl::TaskCounter& GetTaskCounter() const { return task_counter_; }
 
   std::size_t GetTaskQueueSize() const {
-    return task_queue_.GetSizeApproximate();
+    return std::visit(
+        [](const auto& queue) { return queue.GetSizeApproximate(); },
+        task_queue_);
   }
 
   std::size_t GetWorkerCount() const { return workers_.size(); }
 
+  // Returns std::nullopt if there is no such class or the task processor has
+  // no scheduling classes at all
+  std::optional<std::uint8_t> FindSchedulingClass(
+      std::string_view name) const noexcept;
+
+  bool HasSchedulingClasses() const noexcept {
+    return weighted_task_queue_ != nullptr;
+  }
+
+  // Requires HasSchedulingClasses()
+  const WeightedTaskQueue& GetWeightedTaskQueue() const noexcept;
+
   void SetSettings(const TaskProcessorSettings& settings);
 
   std::chrono::microseconds GetProfilerThreshold() const;
 
   bool ShouldProfilerForceStacktrace() const;
 
+  bool ShouldAccountResourceUsage() const {
+    return config_.resource_usage_accounting;
+  }
+
   std::size_t GetTaskTraceMaxCswForNewTask() const;
 
   const std::string& GetTaskTraceLoggerName() const;
@@ -79,22 +104,43 @@ class TaskProcessor final {
 
   std::vector<std::uint8_t> CollectCurrentLoadPct() const;
 
+  // std::nullopt if the workers use the shared jemalloc arenas
+  std::optional<unsigned> GetJemallocArena() const noexcept {
+    return jemalloc_arena_;
+  }
+
+  // Microseconds, from 1us to ~1s with 41% buckets
+  using QueueWaitHistogram = utils::statistics::LogLinearHistogram<1, 0, 20>;
+
+  // Adds the time from Schedule to the start of a step of the tasks, only
+  // the tasks with a queue wait timepoint are sampled
+  void CollectQueueWaitHistogram(QueueWaitHistogram& result) const noexcept;
+
+  // Sums the OS scheduler stats of the worker threads, reads procfs
+  utils::statistics::impl::ThreadSchedulerStats CollectWorkersSchedulerStats()
+      const;
+
  private:
   // Contains queue size cache when overloaded by length, 0 otherwise.
   using OverloadByLength = std::size_t;
 
+  using TaskQueueVariant =
+      std::variant<TaskQueue, WorkStealingTaskQueue, WeightedTaskQueue>;
+
   struct OverloadedCache final {
     std::atomic<bool> overloaded_by_wait_time{false};
     std::atomic<OverloadByLength> overload_by_length{0};
   };
 
+  static TaskQueueVariant MakeTaskQueue(const TaskProcessorConfig& config);
+
   void Cleanup() noexcept;
 
   void PrepareWorkerThread(std::size_t index) noexcept;
 
   void FinalizeWorkerThread() noexcept;
 
-  void ProcessTasks() noexcept;
+  void ProcessTasks(std::size_t worker_index) noexcept;
 
   void CheckWaitTime(impl::TaskContext& context);
 
@@ -112,11 +158,20 @@ class TaskProcessor final {
   concurrent::impl::InterferenceShield<impl::DetachedTasksSyncBlock>
       detached_contexts_{impl::DetachedTasksSyncBlock::StopMode::kCancel};
   concurrent::impl::InterferenceShield<OverloadedCache> overloaded_cache_;
-  TaskQueue task_queue_;
+  TaskQueueVariant task_queue_;
+  // Points into task_queue_ if it is the WeightedTaskQueue, nullptr otherwise
+  WeightedTaskQueue* const weighted_task_queue_;
   impl::TaskCounter task_counter_;
+  // Per worker, to avoid the contention on the hot buckets
+  utils::FixedArray<concurrent::impl::InterferenceShield<QueueWaitHistogram>>
+      queue_wait_histograms_;
+  // Written by the workers before the constructor returns
+  std::vector<std::int64_t> worker_os_ids_;
 
   const TaskProcessorConfig config_;
   const std::shared_ptr<impl::TaskProcessorPools> pools_;
+  std::vector<std::size_t> worker_cpus_;
+  std::optional<unsigned> jemalloc_arena_;
   std::vector<std::thread> workers_;
   logging::LoggerPtr task_trace_logger_{nullptr};
 
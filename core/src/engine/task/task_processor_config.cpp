@@ -1,5 +1,6 @@
 #include <engine/task/task_processor_config.hpp>
 
+#include <algorithm>
 #include <cstdint>
 
 #include <userver/formats/json/value.hpp>
@@ -45,6 +46,31 @@ OsScheduling Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(TaskQueueType::kGlobalTaskQueue, "global")
+        .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
+SchedulingClassConfig Parse(const yaml_config::YamlConfig& value,
+                            formats::parse::To<SchedulingClassConfig>) {
+  SchedulingClassConfig config;
+  config.name = value["name"].As<std::string>();
+  config.weight = value["weight"].As<std::size_t>(config.weight);
+  if (config.weight == 0) {
+    throw std::runtime_error(fmt::format(
+        "Invalid weight of the scheduling class '{}' at '{}', it must be "
+        "positive",
+        config.name, value.GetPath()));
+  }
+  return config;
+}
+
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
                           formats::parse::To<TaskProcessorConfig>) {
   TaskProcessorConfig config;
@@ -56,6 +82,40 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.task_queue = value["task-queue"].As<TaskQueueType>(config.task_queue);
+  config.scheduling_classes =
+      value["scheduling-classes"].As<std::vector<SchedulingClassConfig>>({});
+  if (!config.scheduling_classes.empty() &&
+      config.task_queue != TaskQueueType::kGlobalTaskQueue) {
+    throw std::runtime_error(fmt::format(
+        "'scheduling-classes' at '{}' are only supported by the 'global' "
+        "task-queue",
+        value.GetPath()));
+  }
+  if (config.scheduling_classes.size() > kMaxSchedulingClasses) {
+    throw std::runtime_error(
+        fmt::format("At most {} 'scheduling-classes' are supported at '{}'",
+                    kMaxSchedulingClasses, value.GetPath()));
+  }
+  for (auto it = config.scheduling_classes.begin();
+       it != config.scheduling_classes.end(); ++it) {
+    const auto is_same_name = [&it](const SchedulingClassConfig& other) {
+      return other.name == it->name;
+    };
+    if (std::any_of(config.scheduling_classes.begin(), it, is_same_name)) {
+      throw std::runtime_error(
+          fmt::format("Duplicate scheduling class '{}' at '{}'", it->name,
+                      value.GetPath()));
+    }
+  }
+  config.cpu_affinity =
+      value["cpu-affinity"].As<std::vector<std::size_t>>(config.cpu_affinity);
+  config.numa_node = value["numa-node"].As<std::optional<std::size_t>>();
+  config.resource_usage_accounting =
+      value["resource-usage-accounting"].As<bool>(
+          config.resource_usage_accounting);
+  config.jemalloc_dedicated_arena = value["jemalloc-dedicated-arena"].As<bool>(
+      config.jemalloc_dedicated_arena);
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
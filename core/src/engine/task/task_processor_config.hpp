@@ -3,7 +3,9 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -21,6 +23,26 @@ enum class OsScheduling {
 OsScheduling Parse(const yaml_config::YamlConfig& value,
                    formats::parse::To<OsScheduling>);
 
+enum class TaskQueueType {
+  kGlobalTaskQueue,
+  kWorkStealingTaskQueue,
+};
+
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>);
+
+inline constexpr std::size_t kMaxSchedulingClasses = 16;
+
+// A share of the task processor for the tasks of a group, e.g. of a handler
+struct SchedulingClassConfig {
+  std::string name;
+  // The relative share of the CPU time the class gets under load
+  std::size_t weight{1};
+};
+
+SchedulingClassConfig Parse(const yaml_config::YamlConfig& value,
+                            formats::parse::To<SchedulingClassConfig>);
+
 struct TaskProcessorConfig {
   std::string name;
 
@@ -29,11 +51,29 @@ struct TaskProcessorConfig {
   std::string thread_name;
   OsScheduling os_scheduling{OsScheduling::kNormal};
   int spinning_iterations{1000};
+  TaskQueueType task_queue{TaskQueueType::kGlobalTaskQueue};
+
+  // Empty means a single class. The tasks that are not assigned to any class
+  // belong to the first one.
+  std::vector<SchedulingClassConfig> scheduling_classes;
+
+  // Empty means no affinity
+  std::vector<std::size_t> cpu_affinity;
+  std::optional<std::size_t> numa_node;
 
   std::size_t task_trace_every{1000};
   std::size_t task_trace_max_csw{0};
   std::string task_trace_logger_name;
 
+  // Account CPU time and allocated bytes per task, costs a few syscalls per
+  // context switch
+  bool resource_usage_accounting{false};
+
+  // Serve the allocations of the workers from a jemalloc arena of their own,
+  // so that the fragmentation of the other task processors does not affect
+  // them
+  bool jemalloc_dedicated_arena{false};
+
   void SetName(const std::string& new_name);
 };
 
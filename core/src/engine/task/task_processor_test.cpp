@@ -1,10 +1,18 @@
 #include <engine/task/task_processor.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include <engine/impl/standalone.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_base.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utest/utest.hpp>
+#include <utils/jemalloc.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -47,4 +55,127 @@ UTEST(TaskProcessor, Overload) {
   }
 }
 
+UTEST(TaskProcessor, WorkStealingTaskQueue) {
+  engine::TaskProcessorConfig config;
+  config.name = "work-stealing";
+  config.thread_name = "ws-worker";
+  config.worker_threads = 4;
+  config.task_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::current_task::GetTaskProcessor()
+                                 .GetTaskProcessorPools())};
+
+  constexpr std::size_t kOuterTasksCount = 50;
+  constexpr std::size_t kInnerTasksCount = 20;
+  std::atomic<std::size_t> finished{0};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kOuterTasksCount);
+  for (std::size_t i = 0; i < kOuterTasksCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(*task_processor, [&finished] {
+      // Tasks spawned from a worker go to its local queue and get stolen
+      std::vector<engine::TaskWithResult<void>> subtasks;
+      subtasks.reserve(kInnerTasksCount);
+      for (std::size_t j = 0; j < kInnerTasksCount; ++j) {
+        subtasks.push_back(engine::AsyncNoSpan([&finished] {
+          engine::Yield();
+          ++finished;
+        }));
+      }
+      for (auto& subtask : subtasks) subtask.Get();
+    }));
+  }
+
+  for (auto& task : tasks) task.Get();
+  EXPECT_EQ(finished.load(), kOuterTasksCount * kInnerTasksCount);
+}
+
+UTEST(TaskProcessor, SchedulingClasses) {
+  engine::TaskProcessorConfig config;
+  config.name = "weighted";
+  config.thread_name = "wt-worker";
+  config.worker_threads = 1;
+  config.scheduling_classes = {{"batch", 1}, {"latency", 4}};
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::current_task::GetTaskProcessor()
+                                 .GetTaskProcessorPools())};
+  ASSERT_TRUE(task_processor->HasSchedulingClasses());
+  EXPECT_EQ(task_processor->FindSchedulingClass("latency"), 1);
+  EXPECT_EQ(task_processor->FindSchedulingClass("unknown"), std::nullopt);
+
+  std::atomic<bool> stop{false};
+  const auto busy_loop = [&stop] {
+    while (!stop) {
+      const auto slice_end =
+          std::chrono::steady_clock::now() + std::chrono::microseconds{100};
+      while (std::chrono::steady_clock::now() < slice_end) {
+      }
+      engine::Yield();
+    }
+  };
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (const auto* name : {"batch", "latency"}) {
+    tasks.push_back(engine::AsyncNoSpan(*task_processor, [name, &busy_loop] {
+      engine::current_task::SetSchedulingClass(name);
+      // The subtasks inherit the class
+      std::vector<engine::TaskWithResult<void>> subtasks;
+      for (int i = 0; i < 2; ++i) {
+        subtasks.push_back(engine::AsyncNoSpan(busy_loop));
+      }
+      for (auto& subtask : subtasks) subtask.Get();
+    }));
+  }
+
+  engine::SleepFor(std::chrono::milliseconds{200});
+  stop = true;
+  for (auto& task : tasks) task.Get();
+
+  const auto& queue = task_processor->GetWeightedTaskQueue();
+  const auto batch = queue.GetClassStatistics(0);
+  const auto latency = queue.GetClassStatistics(1);
+  EXPECT_EQ(batch.name, "batch");
+  EXPECT_EQ(latency.name, "latency");
+  EXPECT_GT(batch.execution_time.count(), 0);
+  EXPECT_GT(latency.execution_time, 2 * batch.execution_time);
+
+  UEXPECT_THROW(engine::AsyncNoSpan(*task_processor,
+                                    [] {
+                                      engine::current_task::SetSchedulingClass(
+                                          "unknown");
+                                    })
+                    .Get(),
+                std::runtime_error);
+}
+
+UTEST(TaskProcessor, JemallocDedicatedArena) {
+  engine::TaskProcessorConfig config;
+  config.name = "dedicated-arena";
+  config.thread_name = "arena-worker";
+  config.worker_threads = 2;
+  config.jemalloc_dedicated_arena = true;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::current_task::GetTaskProcessor()
+                                 .GetTaskProcessorPools())};
+
+  // Without jemalloc the task processor falls back to the shared arenas
+  const auto arena = task_processor->GetJemallocArena();
+  if (!arena) return;
+
+  constexpr std::size_t kAllocationSize = 1 << 20;
+  auto allocation = engine::AsyncNoSpan(*task_processor, [] {
+                      return std::vector<char>(kAllocationSize, 'a');
+                    }).Get();
+
+  utils::jemalloc::ArenaStats stats;
+  ASSERT_FALSE(utils::jemalloc::GetArenaStats(*arena, stats));
+  EXPECT_GE(stats.active_bytes, kAllocationSize);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,180 @@
+#include <engine/task/weighted_task_queue.hpp>
+
+#include <limits>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+void AtomicMax(std::atomic<std::uint64_t>& value,
+               std::uint64_t candidate) noexcept {
+  auto old_value = value.load(std::memory_order_relaxed);
+  while (old_value < candidate &&
+         !value.compare_exchange_weak(old_value, candidate,
+                                      std::memory_order_relaxed)) {
+  }
+}
+
+std::uint64_t ToNanoseconds(std::chrono::steady_clock::duration duration) {
+  const auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  return ns > 0 ? static_cast<std::uint64_t>(ns) : 0;
+}
+
+std::chrono::microseconds ToMicroseconds(std::uint64_t ns) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::nanoseconds{ns});
+}
+
+}  // namespace
+
+WeightedTaskQueue::Class::Class(const SchedulingClassConfig& config)
+    : name(config.name), weight(config.weight) {
+  UASSERT(weight > 0);
+}
+
+WeightedTaskQueue::WeightedTaskQueue(const TaskProcessorConfig& config)
+    : classes_(utils::GenerateFixedArray(
+          config.scheduling_classes.size(),
+          [&config](std::size_t index) {
+            return Shielded{config.scheduling_classes[index]};
+          })),
+      semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {
+  UINVARIANT(!classes_.empty(), "No scheduling classes");
+}
+
+void WeightedTaskQueue::Push(
+    boost::intrusive_ptr<impl::TaskContext>&& context) {
+  UASSERT(context);
+  const auto class_index = context->GetSchedulingClass();
+  UASSERT(class_index < classes_.size());
+  auto& cls = *classes_[class_index];
+
+  if (cls.size.fetch_add(1, std::memory_order_relaxed) == 0) {
+    // The class was idle, it does not get the unused share back
+    AtomicMax(cls.virtual_time,
+              virtual_now_->load(std::memory_order_relaxed));
+  }
+  cls.queue.enqueue(context.detach());
+  semaphore_.signal();
+}
+
+boost::intrusive_ptr<impl::TaskContext> WeightedTaskQueue::PopBlocking() {
+  return {DoPopBlocking(), /* add_ref= */ false};
+}
+
+void WeightedTaskQueue::StopProcessing() {
+  is_stopped_.store(true);
+  semaphore_.signal();
+}
+
+std::size_t WeightedTaskQueue::GetSizeApproximate() const noexcept {
+  std::size_t size = 0;
+  for (const auto& cls : classes_) {
+    size += cls->size.load(std::memory_order_relaxed);
+  }
+  return size;
+}
+
+std::optional<std::size_t> WeightedTaskQueue::FindClass(
+    std::string_view name) const noexcept {
+  for (std::size_t i = 0; i < classes_.size(); ++i) {
+    if (classes_[i]->name == name) return i;
+  }
+  return std::nullopt;
+}
+
+void WeightedTaskQueue::AccountExecution(
+    std::size_t class_index,
+    std::chrono::steady_clock::duration duration) noexcept {
+  UASSERT(class_index < classes_.size());
+  auto& cls = *classes_[class_index];
+  const auto ns = ToNanoseconds(duration);
+
+  // At least 1, so that the classes of the instant tasks advance too
+  cls.virtual_time.fetch_add(ns / cls.weight + 1, std::memory_order_relaxed);
+  cls.executed_slices.fetch_add(1, std::memory_order_relaxed);
+  cls.execution_time_ns.fetch_add(ns, std::memory_order_relaxed);
+}
+
+void WeightedTaskQueue::AccountWait(
+    std::size_t class_index,
+    std::chrono::steady_clock::duration duration) noexcept {
+  UASSERT(class_index < classes_.size());
+  auto& cls = *classes_[class_index];
+  cls.wait_samples.fetch_add(1, std::memory_order_relaxed);
+  cls.wait_time_ns.fetch_add(ToNanoseconds(duration),
+                             std::memory_order_relaxed);
+}
+
+WeightedTaskQueue::ClassStatistics WeightedTaskQueue::GetClassStatistics(
+    std::size_t class_index) const noexcept {
+  UASSERT(class_index < classes_.size());
+  const auto& cls = *classes_[class_index];
+
+  ClassStatistics result;
+  result.name = cls.name;
+  result.queued = cls.size.load(std::memory_order_relaxed);
+  result.executed_slices = cls.executed_slices.load(std::memory_order_relaxed);
+  result.execution_time =
+      ToMicroseconds(cls.execution_time_ns.load(std::memory_order_relaxed));
+  result.wait_samples = cls.wait_samples.load(std::memory_order_relaxed);
+  result.wait_time =
+      ToMicroseconds(cls.wait_time_ns.load(std::memory_order_relaxed));
+  return result;
+}
+
+impl::TaskContext* WeightedTaskQueue::DoPopBlocking() {
+  semaphore_.wait();
+
+  impl::TaskContext* context{};
+  while (!TryPop(context)) {
+    if (is_stopped_.load()) {
+      // Return the "stop" token back for the other workers
+      semaphore_.signal();
+      return nullptr;
+    }
+    // The pushed task is not in the queue yet, or has been taken by another
+    // worker in exchange for a task that is not visible to us yet
+  }
+  return context;
+}
+
+bool WeightedTaskQueue::TryPop(impl::TaskContext*& context) noexcept {
+  Class* best = nullptr;
+  auto best_virtual_time = std::numeric_limits<std::uint64_t>::max();
+  for (auto& cls : classes_) {
+    if (cls->size.load(std::memory_order_relaxed) == 0) continue;
+    const auto virtual_time = cls->virtual_time.load(std::memory_order_relaxed);
+    if (virtual_time < best_virtual_time) {
+      best = &*cls;
+      best_virtual_time = virtual_time;
+    }
+  }
+
+  if (best && best->queue.try_dequeue(context)) {
+    best->size.fetch_sub(1, std::memory_order_relaxed);
+    AtomicMax(*virtual_now_, best_virtual_time);
+    return true;
+  }
+
+  // Lost a race for the best class, any task will do
+  for (auto& cls : classes_) {
+    if (cls->queue.try_dequeue(context)) {
+      cls->size.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
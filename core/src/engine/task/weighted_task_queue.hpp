@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <concurrent/impl/interference_shield.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// A task queue that shares the workers between the scheduling classes in
+/// proportion to their weights.
+///
+/// * Each class has its own FIFO queue.
+/// * The workers charge a class for the execution time of its tasks divided by
+///   the weight of the class, the "virtual time" of the class.
+/// * A worker takes a task of the non-empty class with the least virtual time,
+///   so under load a class with weight 3 gets 3 times more CPU time than
+///   a class with weight 1, and an idle class does not limit the others.
+/// * A class that becomes non-empty starts from the virtual time of the
+///   latest picked class, so it can not take over the workers for the time it
+///   stayed idle.
+class WeightedTaskQueue final {
+ public:
+  struct ClassStatistics final {
+    std::string_view name;
+    std::size_t queued{0};
+    std::uint64_t executed_slices{0};
+    std::chrono::microseconds execution_time{0};
+    // The wait time is sampled, see TaskProcessor
+    std::uint64_t wait_samples{0};
+    std::chrono::microseconds wait_time{0};
+  };
+
+  explicit WeightedTaskQueue(const TaskProcessorConfig& config);
+
+  void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+  // Returns nullptr as a stop signal
+  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+  void StopProcessing();
+
+  std::size_t GetSizeApproximate() const noexcept;
+
+  std::optional<std::size_t> FindClass(std::string_view name) const noexcept;
+
+  std::size_t GetClassCount() const noexcept { return classes_.size(); }
+
+  // Charges the class for an execution slice of its task
+  void AccountExecution(std::size_t class_index,
+                        std::chrono::steady_clock::duration duration) noexcept;
+
+  void AccountWait(std::size_t class_index,
+                   std::chrono::steady_clock::duration duration) noexcept;
+
+  ClassStatistics GetClassStatistics(std::size_t class_index) const noexcept;
+
+ private:
+  struct Class final {
+    explicit Class(const SchedulingClassConfig& config);
+
+    const std::string name;
+    const std::uint64_t weight;
+    moodycamel::ConcurrentQueue<impl::TaskContext*> queue;
+    // Incremented before the push, so a popper may briefly see a task that is
+    // not in the queue yet
+    std::atomic<std::size_t> size{0};
+    std::atomic<std::uint64_t> virtual_time{0};
+
+    std::atomic<std::uint64_t> executed_slices{0};
+    std::atomic<std::uint64_t> execution_time_ns{0};
+    std::atomic<std::uint64_t> wait_samples{0};
+    std::atomic<std::uint64_t> wait_time_ns{0};
+  };
+
+  using Shielded = concurrent::impl::InterferenceShield<Class>;
+
+  impl::TaskContext* DoPopBlocking();
+
+  // nullptr is a valid (stop) value, so the success is reported separately
+  bool TryPop(impl::TaskContext*& context) noexcept;
+
+  utils::FixedArray<Shielded> classes_;
+  concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>>
+      virtual_now_{0};
+  std::atomic<bool> is_stopped_{false};
+  moodycamel::LightweightSemaphore semaphore_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
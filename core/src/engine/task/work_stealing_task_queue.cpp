@@ -0,0 +1,265 @@
+#include <engine/task/work_stealing_task_queue.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+// After that many tasks in a row taken from the LIFO slot the local queue gets
+// its turn. Otherwise a pair of tasks that wake each other up could starve
+// all the other tasks of the worker.
+constexpr std::size_t kMaxLifoStreak = 3;
+
+// The global queue is checked first once in a while, so that tasks scheduled
+// from outside of the task processor are not starved by the local ones.
+constexpr std::size_t kGlobalQueueCheckInterval = 61;
+
+// Passes over all the queues before the worker goes to sleep.
+constexpr std::size_t kSearchRounds = 2;
+
+constexpr std::uint64_t kSearcher = 1;
+constexpr std::uint64_t kSleeper = std::uint64_t{1} << 32;
+
+constexpr std::uint64_t GetSearchers(std::uint64_t state) noexcept {
+  return state & (kSleeper - 1);
+}
+
+constexpr std::uint64_t GetSleepers(std::uint64_t state) noexcept {
+  return state / kSleeper;
+}
+
+std::uint32_t NextRandom(std::uint32_t& state) noexcept {
+  // xorshift32
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+struct LocalConsumerData final {
+  const WorkStealingTaskQueue* owner{nullptr};
+  std::size_t index{0};
+};
+
+compiler::ThreadLocal local_consumer_data = [] {
+  return LocalConsumerData{};
+};
+
+}  // namespace
+
+WorkStealingTaskQueue::Consumer::Consumer(WorkStealingTaskQueue& owner)
+    : local_producer_token(local_queue),
+      local_consumer_token(local_queue),
+      global_consumer_token(owner.global_queue_) {}
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
+    : consumers_(config.worker_threads, *this),
+      sleep_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+
+void WorkStealingTaskQueue::Push(
+    boost::intrusive_ptr<impl::TaskContext>&& context) {
+  UASSERT(context);
+  auto* const raw_context = context.detach();
+
+  if (auto* const consumer = GetLocalConsumer()) {
+    auto* const previous = consumer->lifo_slot.exchange(
+        raw_context, std::memory_order_acq_rel);
+    if (previous) {
+      consumer->local_queue.enqueue(consumer->local_producer_token, previous);
+    }
+  } else {
+    global_queue_.enqueue(raw_context);
+  }
+
+  // Pairs with the fence in DoPopBlocking: either the sleeping worker sees the
+  // task, or we see the sleeping worker.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  NotifyOne();
+}
+
+boost::intrusive_ptr<impl::TaskContext> WorkStealingTaskQueue::PopBlocking() {
+  auto& consumer = GetOrRegisterLocalConsumer();
+
+  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(consumer),
+                                                  /* add_ref= */ false};
+
+  if (!context) {
+    // return "stop" token back
+    DoPush(nullptr);
+  }
+
+  return context;
+}
+
+void WorkStealingTaskQueue::StopProcessing() { DoPush(nullptr); }
+
+std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
+  std::size_t size = global_queue_.size_approx();
+  for (const auto& consumer : consumers_) {
+    size += consumer->local_queue.size_approx();
+    if (consumer->lifo_slot.load(std::memory_order_relaxed)) ++size;
+  }
+  return size;
+}
+
+WorkStealingTaskQueue::Consumer*
+WorkStealingTaskQueue::GetLocalConsumer() noexcept {
+  auto data = local_consumer_data.Use();
+  if (data->owner != this) return nullptr;
+  return &*consumers_[data->index];
+}
+
+WorkStealingTaskQueue::Consumer&
+WorkStealingTaskQueue::GetOrRegisterLocalConsumer() {
+  auto data = local_consumer_data.Use();
+  if (data->owner != this) {
+    // Current thread handles only a single TaskProcessor, so it's safe to
+    // bind the thread to a consumer once and forever.
+    const auto index = registered_consumers_.fetch_add(1);
+    UINVARIANT(index < consumers_.size(),
+               "More worker threads than expected use WorkStealingTaskQueue");
+    data->owner = this;
+    data->index = index;
+    consumers_[index]->steal_seed =
+        static_cast<std::uint32_t>(index + 1) * 2654435761U;
+  }
+  return *consumers_[data->index];
+}
+
+void WorkStealingTaskQueue::DoPush(impl::TaskContext* context) {
+  global_queue_.enqueue(context);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  NotifyOne();
+}
+
+impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking(Consumer& consumer) {
+  impl::TaskContext* context{};
+  if (TryPop(consumer, context)) return context;
+
+  idle_state_->fetch_add(kSearcher);
+  while (true) {
+    for (std::size_t round = 0; round < kSearchRounds; ++round) {
+      if (TryPop(consumer, context) || TrySteal(consumer, context)) {
+        StopSearching();
+        return context;
+      }
+    }
+
+    idle_state_->fetch_add(kSleeper - kSearcher);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // A task could have been pushed after the last check but before we were
+    // accounted as a sleeping worker.
+    if (TryPop(consumer, context) || TrySteal(consumer, context)) {
+      CancelSleep();
+      return context;
+    }
+
+    sleep_semaphore_.wait();
+    // NotifyOne has accounted us as a searching worker.
+  }
+}
+
+bool WorkStealingTaskQueue::TryPop(Consumer& consumer,
+                                   impl::TaskContext*& context) {
+  if (++consumer.pops_since_global_check >= kGlobalQueueCheckInterval) {
+    consumer.pops_since_global_check = 0;
+    if (global_queue_.try_dequeue(consumer.global_consumer_token, context)) {
+      return true;
+    }
+  }
+
+  if (consumer.lifo_streak < kMaxLifoStreak) {
+    context = consumer.lifo_slot.exchange(nullptr, std::memory_order_acquire);
+    if (context) {
+      ++consumer.lifo_streak;
+      return true;
+    }
+  }
+  consumer.lifo_streak = 0;
+
+  if (consumer.local_queue.try_dequeue(consumer.local_consumer_token,
+                                       context)) {
+    return true;
+  }
+  if (global_queue_.try_dequeue(consumer.global_consumer_token, context)) {
+    return true;
+  }
+
+  // The LIFO slot could have been skipped because of the streak limit
+  context = consumer.lifo_slot.exchange(nullptr, std::memory_order_acquire);
+  return context != nullptr;
+}
+
+bool WorkStealingTaskQueue::TrySteal(Consumer& consumer,
+                                     impl::TaskContext*& context) {
+  const auto count = consumers_.size();
+  if (count <= 1) return false;
+
+  const auto start = NextRandom(consumer.steal_seed) % count;
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& victim = *consumers_[(start + i) % count];
+    if (&victim == &consumer) continue;
+    if (victim.local_queue.try_dequeue(context)) return true;
+  }
+
+  // LIFO slots are the last resort, stealing them hurts the cache locality of
+  // the victim. Still, a task must not wait for a long-running neighbour.
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& victim = *consumers_[(start + i) % count];
+    if (&victim == &consumer) continue;
+    context = victim.lifo_slot.exchange(nullptr, std::memory_order_acquire);
+    if (context) return true;
+  }
+
+  return false;
+}
+
+void WorkStealingTaskQueue::NotifyOne() noexcept {
+  auto state = idle_state_->load();
+  // A searching worker will find the task by itself, no need to wake up
+  // another one.
+  while (GetSearchers(state) == 0 && GetSleepers(state) != 0) {
+    if (idle_state_->compare_exchange_weak(state,
+                                           state - kSleeper + kSearcher)) {
+      sleep_semaphore_.signal();
+      return;
+    }
+  }
+}
+
+void WorkStealingTaskQueue::StopSearching() noexcept {
+  const auto previous = idle_state_->fetch_sub(kSearcher);
+  UASSERT(GetSearchers(previous) != 0);
+  if (GetSearchers(previous) == 1) {
+    // The last searching worker has found a task. There may be more tasks,
+    // give a sleeping worker a chance to pick them up.
+    NotifyOne();
+  }
+}
+
+void WorkStealingTaskQueue::CancelSleep() {
+  auto state = idle_state_->load();
+  while (true) {
+    if (GetSleepers(state) != 0) {
+      if (idle_state_->compare_exchange_weak(state, state - kSleeper)) return;
+    } else {
+      // NotifyOne has already accounted us as a searching worker and has
+      // signaled the semaphore, consume the signal.
+      sleep_semaphore_.wait();
+      StopSearching();
+      return;
+    }
+  }
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <concurrent/impl/interference_shield.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// A task queue with a local run queue per worker thread.
+///
+/// * Tasks scheduled from a worker of the owning TaskProcessor go to the
+///   LIFO slot of that worker, the previous LIFO task is moved into the local
+///   FIFO queue of the worker.
+/// * Tasks scheduled from other threads go to the global queue.
+/// * An idle worker checks its LIFO slot, its local queue, the global queue,
+///   and then tries to steal from the other workers in a random order.
+/// * At most one sleeping worker is woken up per Push, and only if no other
+///   worker is already searching for tasks.
+class WorkStealingTaskQueue final {
+ public:
+  explicit WorkStealingTaskQueue(const TaskProcessorConfig& config);
+
+  void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+  // Returns nullptr as a stop signal
+  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+  void StopProcessing();
+
+  std::size_t GetSizeApproximate() const noexcept;
+
+ private:
+  struct Consumer final {
+    explicit Consumer(WorkStealingTaskQueue& owner);
+
+    std::atomic<impl::TaskContext*> lifo_slot{nullptr};
+    moodycamel::ConcurrentQueue<impl::TaskContext*> local_queue;
+
+    // Accessed by the owning worker thread only
+    moodycamel::ProducerToken local_producer_token;
+    moodycamel::ConsumerToken local_consumer_token;
+    moodycamel::ConsumerToken global_consumer_token;
+    std::size_t lifo_streak{0};
+    std::size_t pops_since_global_check{0};
+    std::uint32_t steal_seed{0};
+  };
+
+  Consumer* GetLocalConsumer() noexcept;
+  Consumer& GetOrRegisterLocalConsumer();
+
+  void DoPush(impl::TaskContext* context);
+
+  impl::TaskContext* DoPopBlocking(Consumer& consumer);
+
+  // nullptr is a valid (stop) value, so the success is reported separately
+  bool TryPop(Consumer& consumer, impl::TaskContext*& context);
+  bool TrySteal(Consumer& consumer, impl::TaskContext*& context);
+
+  void NotifyOne() noexcept;
+  void StopSearching() noexcept;
+  void CancelSleep();
+
+  using Shielded = concurrent::impl::InterferenceShield<Consumer>;
+
+  moodycamel::ConcurrentQueue<impl::TaskContext*> global_queue_;
+
+  utils::FixedArray<Shielded> consumers_;
+  std::atomic<std::size_t> registered_consumers_{0};
+
+  // Low half: searching workers count, high half: sleeping workers count.
+  concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>>
+      idle_state_{0};
+  moodycamel::LightweightSemaphore sleep_semaphore_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
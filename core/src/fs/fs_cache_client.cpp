@@ -1,13 +1,24 @@
 #include <userver/fs/fs_cache_client.hpp>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <system_error>
+#include <utility>
+#include <vector>
+
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
+#include <fmt/format.h>
 
+#include <userver/engine/async.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/periodic_task.hpp>
+#include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,7 +40,6 @@ std::string GetNormalizeDirectory(std::string_view dir) {
 
 namespace fs {
 
-#ifdef __linux__
 namespace {
 
 bool IsFilepathHidden(const std::string& path) {
@@ -37,13 +47,63 @@ bool IsFilepathHidden(const std::string& path) {
   return filename[0] == '.';
 }
 
+// The functions below are blocking and run on the fs TaskProcessor
+
+std::string GetETag(const std::string& path) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+  struct ::stat stats;
+  utils::CheckSyscall(::stat(path.c_str(), &stats), "calling ::stat for '{}'",
+                      path);
+  // A replaced file gets a new inode, an overwritten one a new size or mtime
+  return fmt::format("\"{:x}-{:x}-{:x}\"", stats.st_ino, stats.st_size,
+                     stats.st_mtime);
+}
+
+// Paths of the regular non-hidden files with their ETags
+std::vector<std::pair<std::string, std::string>> ListFiles(
+    const std::string& dir) {
+  std::vector<std::pair<std::string, std::string>> result;
+  for (boost::filesystem::recursive_directory_iterator it(dir), end;
+       it != end; ++it) {
+    if (it->status().type() != boost::filesystem::regular_file) continue;
+    auto path = it->path().string();
+    if (IsFilepathHidden(path)) continue;
+    auto etag = GetETag(path);
+    result.emplace_back(std::move(path), std::move(etag));
+  }
+  return result;
+}
+
+void MapFile(const std::string& path, FileInfoWithData& info) {
+  const auto fd =
+      blocking::FileDescriptor::Open(path, blocking::OpenFlag::kRead);
+  const auto size = fd.GetSize();
+  // Empty files can not be mapped
+  if (size == 0) return;
+
+  void* const address =
+      ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd.GetNative(), 0);
+  if (address == MAP_FAILED) {
+    throw std::system_error(std::error_code(errno, std::system_category()),
+                            fmt::format("Error while mapping file '{}'", path));
+  }
+
+  // The mapping outlives the file descriptor
+  info.mapped_data = std::shared_ptr<const char>(
+      static_cast<const char*>(address),
+      [size](const char* data) { ::munmap(const_cast<char*>(data), size); });
+  info.mapped_size = size;
+}
+
 }  // namespace
-#endif  // __linux__
 
 FsCacheClient::FsCacheClient(std::string_view dir,
                              std::chrono::milliseconds update_period,
-                             engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
+                             engine::TaskProcessor& tp, Storage storage)
+    : dir_(GetNormalizeDirectory(dir)),
+      update_period_(update_period),
+      tp_(tp),
+      storage_(storage) {
   UpdateCache();
 
   if (update_period_ == std::chrono::milliseconds(0)) {
@@ -61,11 +121,40 @@ FsCacheClient::FsCacheClient(std::string_view dir,
 }
 
 void FsCacheClient::UpdateCache() {
-  auto map = fs::ReadRecursiveFilesInfoWithData(
-      tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+  // A single blocking task for the whole traversal
+  auto files = engine::AsyncNoSpan(tp_, &ListFiles, dir_).Get();
+  const auto snapshot = data_.GetSnapshot();
+
+  FileInfoWithDataMap map;
+  map.reserve(files.size());
+  for (auto& [path, etag] : files) {
+    auto key = GetLexicallyRelative(path, dir_);
+    FileInfoWithDataConstPtr current;
+    if (const auto it = snapshot.find(key); it != snapshot.end()) {
+      current = it->second;
+    }
+    auto file = LoadFile(path, std::move(etag), std::move(current));
+    map.emplace(std::move(key), std::move(file));
+  }
   data_.Assign(std::move(map));
 }
 
+FileInfoWithDataConstPtr FsCacheClient::LoadFile(
+    const std::string& path, std::string etag,
+    FileInfoWithDataConstPtr current) const {
+  if (current && current->etag == etag) return current;
+
+  FileInfoWithData info{};
+  info.extension = boost::filesystem::path(path).extension().string();
+  info.etag = std::move(etag);
+  if (storage_ == Storage::kMmap) {
+    engine::AsyncNoSpan(tp_, [&path, &info] { MapFile(path, info); }).Get();
+  } else {
+    info.data = ReadFileContents(tp_, path);
+  }
+  return std::make_shared<const FileInfoWithData>(std::move(info));
+}
+
 #ifdef __linux__
 void FsCacheClient::InotifyWork() {
   namespace sys_linux = engine::io::sys_linux;
@@ -112,12 +201,13 @@ void FsCacheClient::HandleDeleteDirectory(
 void FsCacheClient::HandleCreate(const std::string& path) {
   if (IsFilepathHidden(path)) return;
 
-  FileInfoWithData info{};
-  info.extension = boost::filesystem::path(path).extension().string();
-  info.data = ReadFileContents(tp_, path);
-  data_.InsertOrAssign(
-      GetLexicallyRelative(path, dir_),
-      std::make_shared<const FileInfoWithData>(std::move(info)));
+  auto key = GetLexicallyRelative(path, dir_);
+  auto etag = engine::AsyncNoSpan(tp_, &GetETag, path).Get();
+  FileInfoWithDataConstPtr current = data_.Get(key);
+  auto file = LoadFile(path, std::move(etag), current);
+  // The initial scan of the watched directories finds the files loaded by
+  // UpdateCache(), those are not read again
+  if (file != current) data_.InsertOrAssign(std::move(key), std::move(file));
 }
 
 void FsCacheClient::HandleCreateDirectory(
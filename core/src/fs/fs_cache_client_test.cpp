@@ -0,0 +1,85 @@
+#include <userver/fs/fs_cache_client.hpp>
+
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Storage = fs::FsCacheClient::Storage;
+
+class FsCacheClientTest : public testing::TestWithParam<Storage> {};
+
+}  // namespace
+
+UTEST_P(FsCacheClientTest, Basic) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto& root = dir.GetPath();
+  fs::blocking::CreateDirectories(root + "/sub");
+  fs::blocking::RewriteFileContents(root + "/index.html", "<html></html>");
+  fs::blocking::RewriteFileContents(root + "/sub/data.json", "{}");
+  fs::blocking::RewriteFileContents(root + "/empty.txt", "");
+  fs::blocking::RewriteFileContents(root + "/.hidden", "secret");
+
+  fs::FsCacheClient client(root, std::chrono::milliseconds{0},
+                           engine::current_task::GetTaskProcessor(),
+                           GetParam());
+
+  const auto index = client.TryGetFile("/index.html");
+  ASSERT_TRUE(index);
+  EXPECT_EQ(index->GetContents(), "<html></html>");
+  EXPECT_EQ(index->extension, ".html");
+  EXPECT_FALSE(index->etag.empty());
+  EXPECT_EQ(GetParam() == Storage::kMmap, index->data.empty());
+
+  const auto data = client.TryGetFile("/sub/data.json");
+  ASSERT_TRUE(data);
+  EXPECT_EQ(data->GetContents(), "{}");
+  EXPECT_NE(data->etag, index->etag);
+
+  const auto empty = client.TryGetFile("/empty.txt");
+  ASSERT_TRUE(empty);
+  EXPECT_EQ(empty->GetContents(), "");
+
+  EXPECT_FALSE(client.TryGetFile("/.hidden"));
+  EXPECT_FALSE(client.TryGetFile("/missing"));
+}
+
+UTEST_P(FsCacheClientTest, UpdateReloadsChangedFiles) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto& root = dir.GetPath();
+  fs::blocking::RewriteFileContents(root + "/same.txt", "same");
+  fs::blocking::RewriteFileContents(root + "/changed.txt", "old");
+  fs::blocking::RewriteFileContents(root + "/removed.txt", "removed");
+
+  fs::FsCacheClient client(root, std::chrono::milliseconds{0},
+                           engine::current_task::GetTaskProcessor(),
+                           GetParam());
+  const auto same = client.TryGetFile("/same.txt");
+  const auto changed = client.TryGetFile("/changed.txt");
+  ASSERT_TRUE(same);
+  ASSERT_TRUE(changed);
+
+  // The size differs, so the ETag changes within the same second
+  fs::blocking::RewriteFileContents(root + "/changed.txt", "new contents");
+  fs::blocking::RemoveSingleFile(root + "/removed.txt");
+  client.UpdateCache();
+
+  EXPECT_EQ(client.TryGetFile("/same.txt"), same);
+
+  const auto updated = client.TryGetFile("/changed.txt");
+  ASSERT_TRUE(updated);
+  EXPECT_EQ(updated->GetContents(), "new contents");
+  EXPECT_NE(updated->etag, changed->etag);
+  EXPECT_EQ(changed->GetContents().size(), 3);
+
+  EXPECT_FALSE(client.TryGetFile("/removed.txt"));
+}
+
+INSTANTIATE_UTEST_SUITE_P(FsCacheClientStorage, FsCacheClientTest,
+                          testing::Values(Storage::kRead, Storage::kMmap));
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,352 @@
+#include <fs/impl/io_uring.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <shared_mutex>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/thread_name.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs::impl {
+
+// IORING_FEAT_FAST_POLL comes with the Linux 5.7 headers, those are the first
+// ones to declare all the used opcodes and IORING_REGISTER_PROBE.
+#if defined(IORING_FEAT_FAST_POLL) && defined(__NR_io_uring_setup)
+#define USERVER_FS_IO_URING 1
+#endif
+
+struct IoUring::Sqe final {
+  std::uint8_t opcode{0};
+  int fd{-1};
+  std::uint64_t addr{0};
+  std::uint32_t len{0};
+  std::uint64_t off{0};
+  std::uint32_t op_flags{0};
+};
+
+#ifdef USERVER_FS_IO_URING
+
+namespace {
+
+constexpr unsigned kEntries = 128;
+
+// The reaper thread stops on the completion with this user_data
+constexpr std::uint64_t kStopUserData = 0;
+
+struct Request final {
+  int result{0};
+  engine::SingleConsumerEvent event;
+};
+
+int Setup(unsigned entries, ::io_uring_params& params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int Enter(int ring_fd, unsigned to_submit, unsigned min_complete,
+          unsigned flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+bool SupportsRequiredOps(int ring_fd) {
+  constexpr unsigned kProbeOps = 256;
+  const auto size =
+      sizeof(::io_uring_probe) + kProbeOps * sizeof(::io_uring_probe_op);
+  const auto storage = std::make_unique<std::uint64_t[]>(
+      (size + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+  std::memset(storage.get(), 0, size);
+  auto* probe = reinterpret_cast<::io_uring_probe*>(storage.get());
+
+  if (::syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_PROBE, probe,
+                kProbeOps) < 0) {
+    return false;
+  }
+
+  for (const int op : {IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_WRITE,
+                       IORING_OP_FSYNC, IORING_OP_NOP}) {
+    if (op > probe->last_op ||
+        !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+T* At(void* base, std::uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+}  // namespace
+
+struct IoUring::Rings final {
+  Rings() = default;
+  Rings(const Rings&) = delete;
+  Rings& operator=(const Rings&) = delete;
+
+  ~Rings() {
+    if (sqes != MAP_FAILED) ::munmap(sqes, sqes_size);
+    if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+      ::munmap(cq_ring, cq_ring_size);
+    }
+    if (sq_ring != MAP_FAILED) ::munmap(sq_ring, sq_ring_size);
+    if (fd != -1) ::close(fd);
+  }
+
+  int fd{-1};
+  unsigned cq_entries{0};
+
+  void* sq_ring{MAP_FAILED};
+  std::size_t sq_ring_size{0};
+  void* cq_ring{MAP_FAILED};
+  std::size_t cq_ring_size{0};
+  void* sqes{MAP_FAILED};
+  std::size_t sqes_size{0};
+
+  // Written by the kernel
+  std::uint32_t* sq_head{nullptr};
+  std::uint32_t* sq_tail{nullptr};
+  std::uint32_t sq_mask{0};
+  std::uint32_t* sq_array{nullptr};
+
+  std::uint32_t* cq_head{nullptr};
+  // Written by the kernel
+  std::uint32_t* cq_tail{nullptr};
+  std::uint32_t cq_mask{0};
+  ::io_uring_cqe* cqes{nullptr};
+};
+
+std::unique_ptr<IoUring> IoUring::Create() {
+  ::io_uring_params params{};
+  auto rings = std::make_unique<Rings>();
+  rings->fd = Setup(kEntries, params);
+  if (rings->fd < 0) {
+    const auto code = std::error_code(errno, std::system_category());
+    LOG_INFO() << "io_uring is not available, the file operations use the "
+                  "blocking TaskProcessor: "
+               << code.message();
+    return nullptr;
+  }
+
+  if (!(params.features & IORING_FEAT_SINGLE_MMAP) ||
+      !(params.features & IORING_FEAT_NODROP) ||
+      !SupportsRequiredOps(rings->fd)) {
+    LOG_INFO() << "io_uring lacks the needed features, the file operations "
+                  "use the blocking TaskProcessor";
+    return nullptr;
+  }
+
+  rings->sq_ring_size =
+      params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+  rings->cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe);
+  // IORING_FEAT_SINGLE_MMAP: both rings live in the same mapping
+  rings->sq_ring_size = rings->cq_ring_size =
+      std::max(rings->sq_ring_size, rings->cq_ring_size);
+  rings->sq_ring =
+      ::mmap(nullptr, rings->sq_ring_size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, rings->fd, IORING_OFF_SQ_RING);
+  if (rings->sq_ring == MAP_FAILED) return nullptr;
+  rings->cq_ring = rings->sq_ring;
+
+  rings->sqes_size = params.sq_entries * sizeof(::io_uring_sqe);
+  rings->sqes = ::mmap(nullptr, rings->sqes_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, rings->fd, IORING_OFF_SQES);
+  if (rings->sqes == MAP_FAILED) return nullptr;
+
+  rings->sq_head = At<std::uint32_t>(rings->sq_ring, params.sq_off.head);
+  rings->sq_tail = At<std::uint32_t>(rings->sq_ring, params.sq_off.tail);
+  rings->sq_mask = *At<std::uint32_t>(rings->sq_ring, params.sq_off.ring_mask);
+  rings->sq_array = At<std::uint32_t>(rings->sq_ring, params.sq_off.array);
+
+  rings->cq_head = At<std::uint32_t>(rings->cq_ring, params.cq_off.head);
+  rings->cq_tail = At<std::uint32_t>(rings->cq_ring, params.cq_off.tail);
+  rings->cq_mask = *At<std::uint32_t>(rings->cq_ring, params.cq_off.ring_mask);
+  rings->cqes = At<::io_uring_cqe>(rings->cq_ring, params.cq_off.cqes);
+  rings->cq_entries = params.cq_entries;
+
+  return std::unique_ptr<IoUring>(new IoUring(std::move(rings)));
+}
+
+IoUring::IoUring(std::unique_ptr<Rings> rings)
+    : rings_(std::move(rings)), in_flight_(rings_->cq_entries) {
+  reaper_ = std::thread([this] {
+    utils::SetCurrentThreadName("fs-io-uring");
+    ReapCompletions();
+  });
+}
+
+IoUring::~IoUring() {
+  Submit(Sqe{IORING_OP_NOP}, kStopUserData);
+  reaper_.join();
+}
+
+int IoUring::OpenAt(const char* path, int flags, ::mode_t mode) {
+  Sqe sqe;
+  sqe.opcode = IORING_OP_OPENAT;
+  sqe.fd = AT_FDCWD;
+  sqe.addr = reinterpret_cast<std::uintptr_t>(path);
+  sqe.len = mode;
+  sqe.op_flags = flags;
+  return Perform(sqe);
+}
+
+int IoUring::Read(int fd, char* buffer, std::size_t size,
+                  std::uint64_t offset) {
+  Sqe sqe;
+  sqe.opcode = IORING_OP_READ;
+  sqe.fd = fd;
+  sqe.addr = reinterpret_cast<std::uintptr_t>(buffer);
+  // Short reads are reported as such, the callers loop over them
+  sqe.len = static_cast<std::uint32_t>(std::min<std::size_t>(size, 1U << 30));
+  sqe.off = offset;
+  return Perform(sqe);
+}
+
+int IoUring::Write(int fd, const char* buffer, std::size_t size,
+                   std::uint64_t offset) {
+  Sqe sqe;
+  sqe.opcode = IORING_OP_WRITE;
+  sqe.fd = fd;
+  sqe.addr = reinterpret_cast<std::uintptr_t>(buffer);
+  sqe.len = static_cast<std::uint32_t>(std::min<std::size_t>(size, 1U << 30));
+  sqe.off = offset;
+  return Perform(sqe);
+}
+
+int IoUring::FSync(int fd) {
+  Sqe sqe;
+  sqe.opcode = IORING_OP_FSYNC;
+  sqe.fd = fd;
+  return Perform(sqe);
+}
+
+int IoUring::Perform(const Sqe& sqe) {
+  const engine::TaskCancellationBlocker cancellation_blocker;
+  const std::shared_lock in_flight_lock(in_flight_);
+
+  Request request;
+  Submit(sqe, reinterpret_cast<std::uintptr_t>(&request));
+
+  [[maybe_unused]] const bool completed = request.event.WaitForEvent();
+  UASSERT(completed);
+  return request.result;
+}
+
+void IoUring::Submit(const Sqe& sqe, std::uint64_t user_data) {
+  auto& rings = *rings_;
+  const std::lock_guard lock(submit_mutex_);
+
+  // Only this thread writes the tail. The kernel consumes all the entries
+  // within io_uring_enter, so the queue is empty here.
+  const auto tail = __atomic_load_n(rings.sq_tail, __ATOMIC_RELAXED);
+  UASSERT(__atomic_load_n(rings.sq_head, __ATOMIC_ACQUIRE) == tail);
+  const auto index = tail & rings.sq_mask;
+
+  auto& entry = static_cast<::io_uring_sqe*>(rings.sqes)[index];
+  std::memset(&entry, 0, sizeof(entry));
+  entry.opcode = sqe.opcode;
+  entry.fd = sqe.fd;
+  entry.addr = sqe.addr;
+  entry.len = sqe.len;
+  entry.off = sqe.off;
+  entry.rw_flags = static_cast<::__kernel_rwf_t>(sqe.op_flags);
+  entry.user_data = user_data;
+  rings.sq_array[index] = index;
+
+  __atomic_store_n(rings.sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+  while (true) {
+    const auto submitted = Enter(rings.fd, 1, 0, 0);
+    if (submitted == 1) return;
+    if (submitted < 0 && (errno == EINTR || errno == EAGAIN)) continue;
+
+    // The entry was not consumed, take it back to not leave a dangling
+    // user_data in the queue
+    const auto code = std::error_code(
+        submitted < 0 ? errno : EAGAIN, std::system_category());
+    __atomic_store_n(rings.sq_tail, tail, __ATOMIC_RELEASE);
+    throw std::system_error(code, "Error while calling io_uring_enter");
+  }
+}
+
+void IoUring::ReapCompletions() {
+  auto& rings = *rings_;
+  bool is_running = true;
+
+  while (is_running) {
+    auto head = __atomic_load_n(rings.cq_head, __ATOMIC_RELAXED);
+    const auto tail = __atomic_load_n(rings.cq_tail, __ATOMIC_ACQUIRE);
+    if (head == tail) {
+      const auto result = Enter(rings.fd, 0, 1, IORING_ENTER_GETEVENTS);
+      UINVARIANT(result >= 0 || errno == EINTR || errno == EAGAIN,
+                 "Error while waiting for the io_uring completions");
+      continue;
+    }
+
+    for (; head != tail; ++head) {
+      const auto& cqe = rings.cqes[head & rings.cq_mask];
+      if (cqe.user_data == kStopUserData) {
+        is_running = false;
+        continue;
+      }
+
+      // The submitter may destroy the request right after the wakeup
+      auto* request = reinterpret_cast<Request*>(cqe.user_data);
+      request->result = cqe.res;
+      request->event.Send();
+    }
+    __atomic_store_n(rings.cq_head, head, __ATOMIC_RELEASE);
+  }
+}
+
+IoUring* IoUring::Get() {
+  static const auto instance = Create();
+  return instance.get();
+}
+
+#else
+
+struct IoUring::Rings final {};
+
+std::unique_ptr<IoUring> IoUring::Create() { return nullptr; }
+
+IoUring* IoUring::Get() { return nullptr; }
+
+IoUring::IoUring(std::unique_ptr<Rings> rings)
+    : rings_(std::move(rings)), in_flight_(1) {}
+
+IoUring::~IoUring() = default;
+
+int IoUring::OpenAt(const char*, int, ::mode_t) { return -ENOSYS; }
+
+int IoUring::Read(int, char*, std::size_t, std::uint64_t) { return -ENOSYS; }
+
+int IoUring::Write(int, const char*, std::size_t, std::uint64_t) {
+  return -ENOSYS;
+}
+
+int IoUring::FSync(int) { return -ENOSYS; }
+
+#endif
+
+}  // namespace fs::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <sys/types.h>
+
+#include <userver/engine/semaphore.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs::impl {
+
+// A process-wide io_uring instance for the file operations of the fs:: API.
+//
+// The operations are submitted by the calling coroutine and complete without
+// occupying a thread of the blocking TaskProcessor: a single reaper thread
+// waits for the completions and wakes up the submitters.
+//
+// The ring is set up with raw syscalls, liburing is not required. The
+// operations return the result of the matching syscall, or `-errno`.
+class IoUring final {
+ public:
+  // Returns `nullptr` if the kernel or the build headers lack io_uring or
+  // any of the required operations (Linux 5.6+), or if io_uring is forbidden
+  // (e.g. by seccomp). The callers should fall back to the blocking
+  // TaskProcessor in that case.
+  static IoUring* Get();
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+  ~IoUring();
+
+  int OpenAt(const char* path, int flags, ::mode_t mode);
+  int Read(int fd, char* buffer, std::size_t size, std::uint64_t offset);
+  int Write(int fd, const char* buffer, std::size_t size,
+            std::uint64_t offset);
+  int FSync(int fd);
+
+  // Exposed for the tests
+  static std::unique_ptr<IoUring> Create();
+
+ private:
+  struct Rings;
+  struct Sqe;
+
+  explicit IoUring(std::unique_ptr<Rings> rings);
+
+  // Submits the operation and waits, without cancellation, for its
+  // completion: the kernel may access the buffers of the caller until then.
+  int Perform(const Sqe& sqe);
+  void Submit(const Sqe& sqe, std::uint64_t user_data);
+  void ReapCompletions();
+
+  std::unique_ptr<Rings> rings_;
+  // Keeps the number of operations in flight within the completion queue
+  engine::Semaphore in_flight_;
+  std::mutex submit_mutex_;
+  std::thread reaper_;
+};
+
+}  // namespace fs::impl
+
+USERVER_NAMESPACE_END
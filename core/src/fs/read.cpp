@@ -1,10 +1,18 @@
 #include <userver/fs/read.hpp>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <system_error>
+
 #include <boost/filesystem.hpp>
 
+#include <fs/impl/io_uring.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +26,35 @@ bool IsHiddenFile(const boost::filesystem::path& path) {
   return name != ".." && name != "." && name[0] == '.';
 }
 
+constexpr std::size_t kInitialReadSize = 4096;
+
+std::size_t CheckResult(int result, const char* what) {
+  if (result < 0) {
+    throw std::system_error(std::error_code(-result, std::system_category()),
+                            what);
+  }
+  return static_cast<std::size_t>(result);
+}
+
+std::string ReadFileContents(impl::IoUring& ring, const std::string& path) {
+  const auto fd = ring.OpenAt(path.c_str(), O_RDONLY | O_CLOEXEC, 0);
+  if (fd < 0) throw std::runtime_error("Error opening '" + path + '\'');
+  const utils::FastScopeGuard close_guard([fd]() noexcept { ::close(fd); });
+
+  std::string result(kInitialReadSize, '\0');
+  std::size_t size = 0;
+  while (true) {
+    if (size == result.size()) result.resize(result.size() * 2);
+    const auto read = CheckResult(
+        ring.Read(fd, result.data() + size, result.size() - size, size),
+        "Error while reading file contents");
+    if (read == 0) break;
+    size += read;
+  }
+  result.resize(size);
+  return result;
+}
+
 }  // namespace
 
 std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
@@ -29,6 +66,7 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
 
 std::string ReadFileContents(engine::TaskProcessor& async_tp,
                              const std::string& path) {
+  if (auto* ring = impl::IoUring::Get()) return ReadFileContents(*ring, path);
   return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path)
       .Get();
 }
@@ -59,6 +97,28 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
   return data;
 }
 
+std::size_t ReadPositioned(engine::TaskProcessor& async_tp,
+                           blocking::FileDescriptor& fd, char* buffer,
+                           std::size_t max_size, std::size_t offset) {
+  const auto native_fd = fd.GetNative();
+  if (auto* ring = impl::IoUring::Get()) {
+    return CheckResult(ring->Read(native_fd, buffer, max_size, offset),
+                       "Error while calling io_uring read");
+  }
+
+  return engine::AsyncNoSpan(async_tp, [native_fd, buffer, max_size, offset] {
+           while (true) {
+             const auto result = ::pread(native_fd, buffer, max_size, offset);
+             if (result >= 0) return static_cast<std::size_t>(result);
+             if (errno == EINTR) continue;
+             throw std::system_error(
+                 std::error_code(errno, std::system_category()),
+                 "Error while calling ::pread");
+           }
+         })
+      .Get();
+}
+
 bool FileExists(engine::TaskProcessor& async_tp, const std::string& path) {
   return engine::AsyncNoSpan(async_tp, &fs::blocking::FileExists, path).Get();
 }
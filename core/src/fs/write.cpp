@@ -1,14 +1,59 @@
 #include <userver/fs/write.hpp>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <system_error>
+
 #include <fmt/format.h>
 
+#include <fs/impl/io_uring.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/write.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
 
+namespace {
+
+void CheckResult(int result, const char* what) {
+  if (result < 0) {
+    throw std::system_error(std::error_code(-result, std::system_category()),
+                            what);
+  }
+}
+
+void WritePositioned(impl::IoUring& ring, int fd, std::string_view contents,
+                     std::size_t offset) {
+  while (!contents.empty()) {
+    const auto written =
+        ring.Write(fd, contents.data(), contents.size(), offset);
+    CheckResult(written, "Error while calling io_uring write");
+    contents.remove_prefix(written);
+    offset += written;
+  }
+}
+
+void RewriteFileContents(impl::IoUring& ring, const std::string& path,
+                         std::string_view contents) {
+  // Same flags and permissions as fs::blocking::RewriteFileContents
+  const auto fd = ring.OpenAt(path.c_str(),
+                              O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                              S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    throw std::system_error(std::error_code(-fd, std::system_category()),
+                            fmt::format("Error while opening file '{}'", path));
+  }
+
+  auto file = blocking::FileDescriptor::AdoptFd(fd);
+  WritePositioned(ring, fd, contents, 0);
+  std::move(file).Close();
+}
+
+}  // namespace
+
 void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path,
                        boost::filesystem::perms perms) {
   engine::AsyncNoSpan(async_tp, [path, perms] {
@@ -24,11 +69,48 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path) {
 
 void RewriteFileContents(engine::TaskProcessor& async_tp,
                          const std::string& path, std::string_view contents) {
+  if (auto* ring = impl::IoUring::Get()) {
+    RewriteFileContents(*ring, path, contents);
+    return;
+  }
   engine::AsyncNoSpan(async_tp, &fs::blocking::RewriteFileContents, path,
                       contents)
       .Get();
 }
 
+void WritePositioned(engine::TaskProcessor& async_tp,
+                     blocking::FileDescriptor& fd, std::string_view contents,
+                     std::size_t offset) {
+  const auto native_fd = fd.GetNative();
+  if (auto* ring = impl::IoUring::Get()) {
+    WritePositioned(*ring, native_fd, contents, offset);
+    return;
+  }
+
+  engine::AsyncNoSpan(async_tp, [native_fd, contents, offset]() mutable {
+    while (!contents.empty()) {
+      const auto written =
+          ::pwrite(native_fd, contents.data(), contents.size(), offset);
+      if (written < 0) {
+        if (errno == EINTR) continue;
+        throw std::system_error(std::error_code(errno, std::system_category()),
+                                "Error while calling ::pwrite");
+      }
+      contents.remove_prefix(written);
+      offset += written;
+    }
+  }).Get();
+}
+
+void FSync(engine::TaskProcessor& async_tp, blocking::FileDescriptor& fd) {
+  if (auto* ring = impl::IoUring::Get()) {
+    CheckResult(ring->FSync(fd.GetNative()),
+                "Error while calling io_uring fsync");
+    return;
+  }
+  engine::AsyncNoSpan(async_tp, [&fd] { fd.FSync(); }).Get();
+}
+
 void SyncDirectoryContents(engine::TaskProcessor& async_tp,
                            const std::string& path) {
   engine::AsyncNoSpan(async_tp, &fs::blocking::SyncDirectoryContents, path)
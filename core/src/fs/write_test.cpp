@@ -4,6 +4,8 @@
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/fs/read.hpp>
@@ -52,4 +54,76 @@ UTEST_MT(AsyncFs, RewriteFileContentsAtomicallyConcurrent, 4) {
   EXPECT_EQ(new_text, fs::ReadFileContents(async_tp, file.GetPath()));
 }
 
+UTEST(AsyncFs, RewriteFileContents) {
+  const auto file = fs::blocking::TempFile::Create();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  // Larger than the initial read buffer of fs::ReadFileContents
+  const std::string text(100'000, 'x');
+  fs::RewriteFileContents(async_tp, file.GetPath(), text);
+  EXPECT_EQ(fs::blocking::ReadFileContents(file.GetPath()), text);
+  EXPECT_EQ(fs::ReadFileContents(async_tp, file.GetPath()), text);
+
+  fs::RewriteFileContents(async_tp, file.GetPath(), "short");
+  EXPECT_EQ(fs::ReadFileContents(async_tp, file.GetPath()), "short");
+
+  fs::RewriteFileContents(async_tp, file.GetPath(), "");
+  EXPECT_EQ(fs::ReadFileContents(async_tp, file.GetPath()), "");
+
+  UEXPECT_THROW(fs::ReadFileContents(async_tp, file.GetPath() + "/missing"),
+                std::runtime_error);
+}
+
+UTEST(AsyncFs, PositionedReadWrite) {
+  const auto file = fs::blocking::TempFile::Create();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  auto fd = fs::blocking::FileDescriptor::Open(
+      file.GetPath(), {fs::blocking::OpenFlag::kRead,
+                       fs::blocking::OpenFlag::kWrite});
+  fs::WritePositioned(async_tp, fd, "world", 6);
+  fs::WritePositioned(async_tp, fd, "hello ", 0);
+  UEXPECT_NO_THROW(fs::FSync(async_tp, fd));
+
+  std::string buffer(16, '\0');
+  EXPECT_EQ(fs::ReadPositioned(async_tp, fd, buffer.data(), 5, 6), 5);
+  EXPECT_EQ(buffer.substr(0, 5), "world");
+  EXPECT_EQ(fs::ReadPositioned(async_tp, fd, buffer.data(), buffer.size(), 0),
+            11);
+  EXPECT_EQ(buffer.substr(0, 11), "hello world");
+  EXPECT_EQ(fs::ReadPositioned(async_tp, fd, buffer.data(), buffer.size(), 11),
+            0);
+
+  // The positioned operations do not move the file offset
+  EXPECT_EQ(fd.Read(buffer.data(), buffer.size()), 11);
+}
+
+UTEST_MT(AsyncFs, PositionedWriteConcurrent, 4) {
+  constexpr std::size_t kTasksCount = 16;
+  constexpr std::size_t kChunkSize = 512;
+
+  const auto file = fs::blocking::TempFile::Create();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+  auto fd = fs::blocking::FileDescriptor::Open(
+      file.GetPath(), {fs::blocking::OpenFlag::kRead,
+                       fs::blocking::OpenFlag::kWrite});
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasksCount);
+  for (std::size_t i = 0; i < kTasksCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&, i] {
+      const std::string chunk(kChunkSize, static_cast<char>('a' + i));
+      fs::WritePositioned(async_tp, fd, chunk, i * kChunkSize);
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  const auto contents = fs::ReadFileContents(async_tp, file.GetPath());
+  ASSERT_EQ(contents.size(), kTasksCount * kChunkSize);
+  for (std::size_t i = 0; i < kTasksCount; ++i) {
+    EXPECT_EQ(contents.substr(i * kChunkSize, kChunkSize),
+              std::string(kChunkSize, static_cast<char>('a' + i)));
+  }
+}
+
 USERVER_NAMESPACE_END
@@ -296,6 +296,17 @@ properties:
                     enum:
                       - discard
                       - block
+                deferred_formatting:
+                    type: boolean
+                    description: format the messages on the logger task processor instead of the logging coroutine
+                    defaultDescription: false
+                compression:
+                    type: string
+                    description: "compression of the log file: `none` writes plain text, `zstd` writes a stream of zstd frames"
+                    defaultDescription: none
+                    enum:
+                      - none
+                      - zstd
                 fs-task-processor:
                     type: string
                     description: task processor for disk I/O operations for this logger
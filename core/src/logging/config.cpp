@@ -18,6 +18,16 @@ QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+LogCompression Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<LogCompression>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(LogCompression::kNone, "none")
+        .Case(LogCompression::kZstd, "zstd");
+  });
+  return utils::ParseFromValueString(value, kMap);
+}
+
 Format Parse(const yaml_config::YamlConfig& value, formats::parse::To<Format>) {
   const auto format_str = value.As<std::string>("tskv");
   return FormatFromString(format_str);
@@ -52,6 +62,12 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value,
       value["overflow_behavior"].As<QueueOverflowBehavior>(
           config.queue_overflow_behavior);
 
+  config.deferred_formatting =
+      value["deferred_formatting"].As<bool>(config.deferred_formatting);
+
+  config.compression =
+      value["compression"].As<LogCompression>(config.compression);
+
   config.fs_task_processor =
       value["fs-task-processor"].As<std::optional<std::string>>();
 
@@ -24,6 +24,11 @@ enum class QueueOverflowBehavior { kDiscard, kBlock };
 QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
                             formats::parse::To<QueueOverflowBehavior>);
 
+enum class LogCompression { kNone, kZstd };
+
+LogCompression Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<LogCompression>);
+
 struct LoggerConfig final {
   static constexpr size_t kDefaultMessageQueueSize = 1 << 16;
 
@@ -40,6 +45,8 @@ struct LoggerConfig final {
   size_t message_queue_size = kDefaultMessageQueueSize;
   QueueOverflowBehavior queue_overflow_behavior =
       QueueOverflowBehavior::kDiscard;
+  bool deferred_formatting = false;
+  LogCompression compression = LogCompression::kNone;
 
   std::optional<std::string> fs_task_processor;
 
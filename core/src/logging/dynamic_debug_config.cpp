@@ -8,9 +8,23 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 
+bool operator==(const LogLimitConfig& a, const LogLimitConfig& b) {
+  return a.interval_ms == b.interval_ms &&
+         a.max_per_interval == b.max_per_interval;
+}
+
+LogLimitConfig Parse(const formats::json::Value& value,
+                     formats::parse::To<LogLimitConfig>) {
+  LogLimitConfig result;
+  result.interval_ms = value["interval-ms"].As<std::uint32_t>(0);
+  result.max_per_interval = value["max-per-interval"].As<std::uint32_t>();
+  return result;
+}
+
 bool operator==(const DynamicDebugConfig& a, const DynamicDebugConfig& b) {
   return a.force_enabled == b.force_enabled &&
-         a.force_disabled == b.force_disabled;
+         a.force_disabled == b.force_disabled &&
+         a.limited_logging == b.limited_logging;
 }
 
 DynamicDebugConfig Parse(const formats::json::Value& value,
@@ -23,6 +37,9 @@ DynamicDebugConfig Parse(const formats::json::Value& value,
   result.force_disabled =
       value["force-disabled-level"]
           .As<std::unordered_map<std::string, logging::Level>>({});
+  result.limited_logging =
+      value["limited-logging"]
+          .As<std::unordered_map<std::string, LogLimitConfig>>({});
 
   for (auto location : value["force-enabled"].As<std::vector<std::string>>()) {
     result.force_enabled[std::move(location)] = logging::Level::kTrace;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 
@@ -14,9 +15,20 @@ class Value;
 
 namespace logging {
 
+struct LogLimitConfig {
+  std::uint32_t interval_ms{0};
+  std::uint32_t max_per_interval{0};
+};
+
+bool operator==(const LogLimitConfig& a, const LogLimitConfig& b);
+
+LogLimitConfig Parse(const formats::json::Value&,
+                     formats::parse::To<LogLimitConfig>);
+
 struct DynamicDebugConfig {
   std::unordered_map<std::string, logging::Level> force_enabled;
   std::unordered_map<std::string, logging::Level> force_disabled;
+  std::unordered_map<std::string, LogLimitConfig> limited_logging;
 };
 
 bool operator==(const DynamicDebugConfig& a, const DynamicDebugConfig& b);
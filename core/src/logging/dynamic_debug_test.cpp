@@ -4,6 +4,7 @@
 
 #include <logging/dynamic_debug.hpp>
 #include <logging/logging_test.hpp>
+#include <logging/rate_limit.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -303,4 +304,32 @@ TEST_F(LoggingTest, DynamicDebugDisableLevel) {
   EXPECT_THAT(GetStreamString(), testing::HasSubstr("unrelated"));
 }
 
+TEST_F(LoggingTest, DynamicDebugLogLimit) {
+  const std::string filename{USERVER_FILEPATH};
+  SetDefaultLoggerLevel(logging::Level::kInfo);
+  logging::impl::LogLimitedSummary();
+
+  const auto do_log = [](logging::Level level, int i) {
+#line 70001
+    LOG_LIMITED(level) << "limited " << i;
+  };
+
+  logging::SetLogLimit(filename, 70001,
+                       {/*interval_ms=*/3'600'000, /*max_per_interval=*/3});
+
+  // Filtered out messages do not consume the budget
+  do_log(logging::Level::kDebug, -1);
+  for (int i = 0; i < 10; ++i) do_log(logging::Level::kInfo, i);
+
+  logging::ResetLogLimits();
+
+  EXPECT_EQ(logging::impl::LogLimitedSummary(), 7);
+  EXPECT_EQ(logging::impl::LogLimitedSummary(), 0);
+
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("limited 2"));
+  EXPECT_THAT(GetStreamString(), testing::Not(testing::HasSubstr("limited 3")));
+  EXPECT_THAT(GetStreamString(),
+              testing::HasSubstr("suppressed 7 messages"));
+}
+
 USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 
 #include <logging/impl/reopen_mode.hpp>
 #include <userver/logging/level.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,6 +23,10 @@ class BaseSink {
 
   void Log(const LogMessage& message);
 
+  /// Logs several messages in order. Sinks that can write multiple records
+  /// at once (e.g. with a single `writev`) override it.
+  virtual void LogBatch(utils::span<const LogMessage> messages);
+
   virtual void Flush();
 
   virtual void Reopen(ReopenMode);
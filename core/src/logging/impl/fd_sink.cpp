@@ -1,13 +1,69 @@
 #include "fd_sink.hpp"
 
+#include <sys/uio.h>
+
+#include <array>
+#include <cerrno>
+#include <system_error>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+// Well below IOV_MAX, that is at least 1024 on Linux and macOS
+constexpr std::size_t kMaxIovecs = 64;
+
+void WriteVectored(int fd, ::iovec* iov, std::size_t count) {
+  while (count > 0) {
+    const auto result = ::writev(fd, iov, static_cast<int>(count));
+    if (result < 0) {
+      if (errno == EAGAIN || errno == EINTR) continue;
+
+      const auto code = std::make_error_code(std::errc{errno});
+      throw std::system_error(code, "calling ::writev");
+    }
+
+    // Skip the fully written buffers and adjust the partially written one
+    auto written = static_cast<std::size_t>(result);
+    while (count > 0 && written >= iov->iov_len) {
+      written -= iov->iov_len;
+      ++iov;
+      --count;
+    }
+    if (count > 0) {
+      iov->iov_base = static_cast<char*>(iov->iov_base) + written;
+      iov->iov_len -= written;
+    }
+  }
+}
+
+}  // namespace
+
 FdSink::FdSink(fs::blocking::FileDescriptor fd) : fd_{std::move(fd)} {}
 
 void FdSink::Write(std::string_view log) { fd_.Write(log); }
 
+void FdSink::LogBatch(utils::span<const LogMessage> messages) {
+  std::array<::iovec, kMaxIovecs> iov{};
+  std::size_t count = 0;
+
+  for (const auto& message : messages) {
+    if (!ShouldLog(message.level) || message.payload.empty()) continue;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    iov[count].iov_base = const_cast<char*>(message.payload.data());
+    iov[count].iov_len = message.payload.size();
+    if (++count == iov.size()) {
+      WriteVectored(fd_.GetNative(), iov.data(), count);
+      count = 0;
+    }
+  }
+
+  WriteVectored(fd_.GetNative(), iov.data(), count);
+}
+
 void FdSink::Flush() {
   if (fd_.IsOpen()) {
     fd_.FSync();
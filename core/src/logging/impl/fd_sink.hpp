@@ -16,6 +16,8 @@ class FdSink : public BaseSink {
 
   ~FdSink() override;
 
+  void LogBatch(utils::span<const LogMessage> messages) override;
+
   void Flush() override;
 
  protected:
@@ -0,0 +1,72 @@
+#include "zstd_file_sink.hpp"
+
+#include <exception>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+
+#include "open_file_helper.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+// Compressed output is written in chunks of at least this size between the
+// flushes, to issue fewer syscalls
+constexpr std::size_t kMinWriteSize = 64 << 10;
+
+}  // namespace
+
+ZstdFileSink::ZstdFileSink(const std::string& filename)
+    : filename_{filename},
+      fd_(OpenFile<fs::blocking::FileDescriptor>(filename)) {}
+
+ZstdFileSink::~ZstdFileSink() {
+  try {
+    compressor_.EndFrame(compressed_);
+    WriteCompressed();
+  } catch (const std::exception& e) {
+    UASSERT_MSG(false, fmt::format("Failed to end the zstd frame of '{}': {}",
+                                   filename_, e.what()));
+  }
+}
+
+void ZstdFileSink::Reopen(ReopenMode mode) {
+  // The rotated file must end with a complete frame
+  compressor_.EndFrame(compressed_);
+  WriteCompressed();
+
+  auto new_fd = OpenFile<fs::blocking::FileDescriptor>(filename_, mode);
+  std::move(fd_).Close();
+  fd_ = std::move(new_fd);
+}
+
+void ZstdFileSink::Flush() {
+  compressor_.Flush(compressed_);
+  WriteCompressed();
+}
+
+void ZstdFileSink::Write(std::string_view log) {
+  compressor_.Compress(log, compressed_);
+  if (compressor_.GetFrameInputSize() >= kMaxFrameInputSize) {
+    compressor_.EndFrame(compressed_);
+  }
+
+  if (compressed_.size() >= kMinWriteSize) {
+    WriteCompressed();
+  }
+}
+
+void ZstdFileSink::WriteCompressed() {
+  if (compressed_.empty() || !fd_.IsOpen()) return;
+
+  fd_.Write(compressed_);
+  compressed_.clear();
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <logging/impl/base_sink.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// Writes the logs to the file as a sequence of zstd frames.
+///
+/// Flush makes all the written data decodable by a streaming decoder, e.g.
+/// by `tail -f file | zstd -d`. A frame is ended each kMaxFrameInputSize
+/// bytes of logs and on Reopen, so a rotated file is a complete zstd stream.
+class ZstdFileSink final : public BaseSink {
+ public:
+  static constexpr std::size_t kMaxFrameInputSize = 4 << 20;
+
+  explicit ZstdFileSink(const std::string& filename);
+  ~ZstdFileSink() override;
+
+  void Reopen(ReopenMode mode) override;
+
+  void Flush() override;
+
+ protected:
+  void Write(std::string_view log) override;
+
+ private:
+  void WriteCompressed();
+
+  std::string filename_;
+  fs::blocking::FileDescriptor fd_;
+  compression::zstd::StreamCompressor compressor_;
+  std::string compressed_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
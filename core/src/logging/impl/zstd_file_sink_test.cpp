@@ -0,0 +1,83 @@
+#include "zstd_file_sink.hpp"
+
+#include <string>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMaxDecompressedSize = 1 << 30;
+
+std::string ReadCompressedFile(const std::string& filename) {
+  return compression::zstd::Decompress(
+      fs::blocking::ReadFileContents(filename), kMaxDecompressedSize);
+}
+
+}  // namespace
+
+UTEST(ZstdFileSink, WriteAndFlush) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const auto filename = temp_root.GetPath() + "/temp_file.zst";
+  logging::impl::ZstdFileSink sink{filename};
+
+  EXPECT_EQ(fs::blocking::ReadFileContents(filename), "");
+
+  std::string expected;
+  for (int i = 0; i < 1000; ++i) {
+    const auto message = "message " + std::to_string(i) + '\n';
+    EXPECT_NO_THROW(sink.Log({message, logging::Level::kInfo}));
+    expected += message;
+  }
+  EXPECT_NO_THROW(sink.Flush());
+
+  const auto compressed = fs::blocking::ReadFileContents(filename);
+  EXPECT_LT(compressed.size(), expected.size());
+  EXPECT_EQ(ReadCompressedFile(filename), expected);
+}
+
+UTEST(ZstdFileSink, LargeOutputSpansFrames) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const auto filename = temp_root.GetPath() + "/temp_file.zst";
+  logging::impl::ZstdFileSink sink{filename};
+  constexpr auto kMaxFrameInputSize =
+      logging::impl::ZstdFileSink::kMaxFrameInputSize;
+
+  std::string expected;
+  for (int i = 0; expected.size() < 3 * kMaxFrameInputSize; ++i) {
+    const auto message = "a somewhat longer message " + std::to_string(i) +
+                         " that compresses well\n";
+    sink.Log({message, logging::Level::kInfo});
+    expected += message;
+  }
+  sink.Flush();
+
+  EXPECT_EQ(ReadCompressedFile(filename), expected);
+}
+
+UTEST(ZstdFileSink, ReopenAfterRotation) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const auto filename = temp_root.GetPath() + "/temp_file.zst";
+  const auto rotated_filename = temp_root.GetPath() + "/temp_file.zst.1";
+  logging::impl::ZstdFileSink sink{filename};
+
+  sink.Log({"message\n", logging::Level::kWarning});
+  fs::blocking::Rename(filename, rotated_filename);
+  sink.Log({"message 2\n", logging::Level::kInfo});
+  EXPECT_NO_THROW(sink.Reopen(logging::impl::ReopenMode::kAppend));
+
+  // The rotated file ends with a complete frame
+  EXPECT_EQ(ReadCompressedFile(rotated_filename), "message\nmessage 2\n");
+  EXPECT_EQ(fs::blocking::ReadFileContents(filename), "");
+
+  sink.Log({"message 3\n", logging::Level::kInfo});
+  sink.Flush();
+  EXPECT_EQ(ReadCompressedFile(filename), "message 3\n");
+}
+
+USERVER_NAMESPACE_END
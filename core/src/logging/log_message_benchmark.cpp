@@ -2,11 +2,16 @@
 
 #include <ostream>
 
+#include <fmt/format.h>
+
+#include <userver/engine/run_standalone.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/tracing/span.hpp>
 
+#include <utils/gbench_allocations.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -162,6 +167,24 @@ void LogPrependedTags(benchmark::State& state) {
 }
 BENCHMARK(LogPrependedTags);
 
+// The tags of the current span are written into each record
+void LogSpanTags(benchmark::State& state) {
+  const logging::DefaultLoggerGuard guard{std::make_shared<NoopLogger>()};
+
+  engine::RunStandalone([&] {
+    tracing::Span span("span");
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      span.AddTag(fmt::format("tag_{}", i), "a value out of the SSO buffer");
+    }
+
+    const utils::bench::AllocationsReporter allocations_reporter{state};
+    for ([[maybe_unused]] auto _ : state) {
+      LOG_INFO() << "";
+    }
+  });
+}
+BENCHMARK(LogSpanTags)->Arg(0)->Arg(4)->Arg(16);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -1,8 +1,11 @@
 #include "tp_logger.hpp"
 
+#include <array>
+
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
+#include <logging/binary_record.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -19,8 +22,9 @@ struct TpLogger::ActionVisitor final {
   TpLogger& logger;
 
   void operator()(impl::async::Log&& log) const {
-    logger.AccountLogConsumed();
-    logger.BackendLog(std::move(log));
+    logger.AccountLogsConsumed(1);
+    const impl::async::Log* const logs[] = {&log};
+    logger.BackendLog(logs);
   }
 
   void operator()(impl::async::Stop&&) const noexcept {
@@ -245,8 +249,8 @@ void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
   }
 }
 
-void TpLogger::AccountLogConsumed() noexcept {
-  consumed_->store(consumed_->load(std::memory_order_relaxed) + 1,
+void TpLogger::AccountLogsConsumed(QueueSize count) noexcept {
+  consumed_->store(consumed_->load(std::memory_order_relaxed) + count,
                    std::memory_order_relaxed);
   if (overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
     {
@@ -257,7 +261,11 @@ void TpLogger::AccountLogConsumed() noexcept {
       //    not fall asleep
       const std::lock_guard lock{capacity_waiters_mutex_};
     }
-    capacity_waiters_cv_.NotifyOne();
+    if (count == 1) {
+      capacity_waiters_cv_.NotifyOne();
+    } else {
+      capacity_waiters_cv_.NotifyAll();
+    }
   }
 }
 
@@ -271,32 +279,122 @@ void TpLogger::ConsumeNode(
   delete &action_node;
 }
 
+void TpLogger::ConsumeLogBatch(
+    utils::span<impl::async::ActionNode* const> nodes) noexcept {
+  if (nodes.empty()) return;
+
+  std::array<const impl::async::Log*, kMaxLogBatchSize> logs{};
+  UASSERT(nodes.size() <= logs.size());
+  for (std::size_t i = 0; i < nodes.size(); ++i) {
+    logs[i] = &std::get<impl::async::Log>(nodes[i]->action);
+  }
+
+  AccountLogsConsumed(static_cast<QueueSize>(nodes.size()));
+  try {
+    BackendLog(utils::span{logs.data(), nodes.size()});
+  } catch (const std::exception& e) {
+    UASSERT_MSG(false, fmt::format("Exception while doing an async logging: {}",
+                                   e.what()));
+  }
+
+  for (auto* const node : nodes) {
+    delete node;
+  }
+}
+
 void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
+  std::array<impl::async::ActionNode*, kMaxLogBatchSize> batch{};
+  std::size_t batch_size = 0;
+
   while (auto* const node_base = consumer.TryPop()) {
-    ConsumeNode(*node_base);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    auto& node = static_cast<impl::async::ActionNode&>(*node_base);
+    if (&node != &stop_node_ &&
+        std::holds_alternative<impl::async::Log>(node.action)) {
+      batch[batch_size++] = &node;
+      if (batch_size == batch.size()) {
+        ConsumeLogBatch(batch);
+        batch_size = 0;
+      }
+      continue;
+    }
+
+    // Flushes and reopens must observe all the preceding records
+    ConsumeLogBatch(utils::span{batch.data(), batch_size});
+    batch_size = 0;
+    ConsumeNode(node);
   }
+
+  ConsumeLogBatch(utils::span{batch.data(), batch_size});
 }
 
 void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
+  // ConsumeAndStop handles the nodes pushed concurrently with the stopping,
+  // the rest of them are consumed in batches.
+  ConsumeQueueOnce(consumer);
   std::move(consumer).ConsumeAndStop(
       [this](auto& node) noexcept { ConsumeNode(node); });
 }
 
-void TpLogger::BackendLog(impl::async::Log&& action) const {
-  LogMessage message;
-  message.payload = action.payload;
-  message.level = action.level;
+void TpLogger::BackendLog(
+    utils::span<const impl::async::Log* const> logs) const {
+  struct FormattedRange final {
+    std::size_t begin{0};
+    std::size_t end{0};
+    bool is_formatted{false};
+  };
+
+  // Messages forwarded from other loggers and LogRaw are passed as is
+  LogBuffer formatted;
+  std::array<FormattedRange, kMaxLogBatchSize> ranges{};
+  UASSERT(logs.size() <= ranges.size());
+  for (std::size_t i = 0; i < logs.size(); ++i) {
+    if (!IsBinaryRecord(logs[i]->payload)) continue;
+
+    auto& range = ranges[i];
+    range.begin = formatted.size();
+    try {
+      FormatBinaryRecord(logs[i]->payload, GetFormat(), formatted);
+      range.is_formatted = true;
+    } catch (const std::exception& e) {
+      formatted.resize(range.begin);
+      UASSERT_MSG(false, "While formatting a log message caught an "
+                         "exception: " + std::string(e.what()));
+    }
+    range.end = formatted.size();
+  }
+
+  // `formatted` does not reallocate any more, the views remain valid
+  std::array<LogMessage, kMaxLogBatchSize> messages{};
+  std::size_t messages_size = 0;
+  bool should_flush = false;
+  for (std::size_t i = 0; i < logs.size(); ++i) {
+    auto& message = messages[messages_size];
+    message.level = logs[i]->level;
+    if (!IsBinaryRecord(logs[i]->payload)) {
+      message.payload = logs[i]->payload;
+    } else if (ranges[i].is_formatted) {
+      message.payload = std::string_view{formatted.data() + ranges[i].begin,
+                                         ranges[i].end - ranges[i].begin};
+    } else {
+      continue;
+    }
+
+    should_flush = should_flush || ShouldFlush(message.level);
+    ++messages_size;
+  }
 
+  const utils::span<const LogMessage> batch{messages.data(), messages_size};
   for (const auto& sink : GetSinks()) {
     try {
-      sink->Log(message);
+      sink->LogBatch(batch);
     } catch (const std::exception& e) {
       UASSERT_MSG(false, "While writing a log message caught an exception: " +
                              std::string(e.what()));
     }
   }
 
-  if (ShouldFlush(message.level)) {
+  if (should_flush) {
     BackendFlush();
   }
 }
@@ -23,6 +23,7 @@
 #include <logging/impl/reopen_mode.hpp>
 #include <userver/concurrent/impl/intrusive_hooks.hpp>
 #include <userver/logging/impl/log_stats.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -77,6 +78,10 @@ class TpLogger final : public LoggerBase {
   void Flush() override;
   void PrependCommonTags(TagWriter writer) const override;
 
+  // With the deferred formatting, the messages are formatted on the
+  // consumer side, see logging/binary_record.hpp
+  using LoggerBase::SetFormattingDeferred;
+
   void AddSink(impl::SinkPtr&& sink);
   const std::vector<impl::SinkPtr>& GetSinks() const;
   void Reopen(ReopenMode reopen_mode);
@@ -100,6 +105,10 @@ class TpLogger final : public LoggerBase {
   using Queue = engine::impl::AsyncFlatCombiningQueue;
   using QueueSize = std::int64_t;
 
+  // Log records are consumed in batches of up to kMaxLogBatchSize, so that
+  // the sinks could write them at once and consumed_ is updated only once.
+  static constexpr std::size_t kMaxLogBatchSize = 64;
+
   void ProcessingLoop();
   bool HasFreeQueueCapacity() noexcept;
   bool TryWaitFreeQueueCapacity();
@@ -108,9 +117,11 @@ class TpLogger final : public LoggerBase {
   void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
   void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
-  void AccountLogConsumed() noexcept;
+  void ConsumeLogBatch(
+      utils::span<impl::async::ActionNode* const> nodes) noexcept;
+  void AccountLogsConsumed(QueueSize count) noexcept;
   void BackendPerform(impl::async::Action&& action) noexcept;
-  void BackendLog(impl::async::Log&& action) const;
+  void BackendLog(utils::span<const impl::async::Log* const> logs) const;
   void BackendFlush() const;
   void BackendReopen(ReopenMode reopen_mode) const;
 
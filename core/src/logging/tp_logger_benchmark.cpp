@@ -8,7 +8,9 @@
 #include <userver/logging/logger.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <utils/gbench_allocations.hpp>
 #include <utils/gbench_auxilary.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -53,6 +55,7 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogString)(benchmark::State& state) {
   engine::RunStandalone(2, [&] {
     auto scope = StartAsyncLoggerScope();
     const auto msg = Launder(std::string(state.range(0), '*'));
+    const utils::bench::AllocationsReporter allocations_reporter{state};
     for ([[maybe_unused]] auto _ : state) {
       LOG_INFO() << msg;
     }
@@ -65,6 +68,23 @@ BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)
     ->Range(8, 8 << 10)
     ->Complexity();
 
+// Many producers, the consumer batches the records
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogStringMultithreaded)
+(benchmark::State& state) {
+  engine::RunStandalone(state.range(0) + 1, [&] {
+    auto scope = StartAsyncLoggerScope();
+    const utils::bench::AllocationsReporter allocations_reporter{state};
+    RunParallelBenchmark(state, [](auto& range) {
+      for ([[maybe_unused]] auto _ : range) {
+        LOG_INFO() << "message";
+      }
+    });
+  });
+}
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogStringMultithreaded)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
 namespace {
 
 __attribute__((noinline)) void LogDebug() { LOG_DEBUG() << 42; }
@@ -77,6 +97,7 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogCheck)
 (benchmark::State& state) {
   engine::RunStandalone(2, [&] {
     auto scope = StartAsyncLoggerScope();
+    const utils::bench::AllocationsReporter allocations_reporter{state};
     for ([[maybe_unused]] auto _ : state) {
       LogDebug();
     }
@@ -89,6 +110,7 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogCheckSpan)
   engine::RunStandalone(2, [&] {
     auto scope = StartAsyncLoggerScope();
     tracing::Span::CurrentSpan().SetLocalLogLevel(logging::Level::kError);
+    const utils::bench::AllocationsReporter allocations_reporter{state};
     for ([[maybe_unused]] auto _ : state) {
       LogInfo();
     }
@@ -1,9 +1,12 @@
 #include <logging/tp_logger.hpp>
 
+#include <regex>
+
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/logging/logger.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/statistics/storage.hpp>
 #include <userver/utils/statistics/testing.hpp>
@@ -194,6 +197,32 @@ TEST_F(LoggingTest, TpLoggerBasicRecursive) {
   EXPECT_EQ(GetRecordsCount(), kLoggingRecursionDepth);
 }
 
+TEST_F(LoggingTest, TpLoggerDeferredFormatting) {
+  for (const auto format : {logging::Format::kTskv, logging::Format::kLtsv}) {
+    auto eager = MakeNamedStreamLogger("eager", format);
+    auto deferred = MakeNamedStreamLogger("deferred", format);
+    deferred.logger->SetFormattingDeferred(true);
+
+    for (const auto& logger : {eager.logger, deferred.logger}) {
+      LOG_INFO_TO(logger) << "text\twith escaping " << 42 << ' ' << -1 << ' '
+                          << 0.5 << ' ' << 0.1F << ' ' << true
+                          << logging::LogExtra{{"key.with.periods", 1u},
+                                               {"str", "multi\nline"}};
+      logging::impl::LogRaw(*logger, logging::Level::kInfo, "raw message\n");
+      logger->Flush();
+    }
+
+    // The timestamps differ, everything else must match
+    const auto without_timestamps = [](std::string logs) {
+      static const std::regex kTimestamp{"timestamp[=:][^\t]*\t"};
+      return std::regex_replace(logs, kTimestamp, "");
+    };
+    EXPECT_EQ(without_timestamps(deferred.stream.str()),
+              without_timestamps(eager.stream.str()));
+    EXPECT_THAT(deferred.stream.str(), testing::HasSubstr("raw message\n"));
+  }
+}
+
 TEST_F(LoggingTest, TpLoggerBasicMT) {
   ASSERT_FALSE(engine::current_task::IsTaskProcessorThread())
       << "Misconfigured test. Should not be run in coroutine environment";
@@ -11,6 +11,7 @@
 #include <logging/impl/buffered_file_sink.hpp>
 #include <logging/impl/tcp_socket_sink.hpp>
 #include <logging/impl/unix_socket_sink.hpp>
+#include <logging/impl/zstd_file_sink.hpp>
 #include <userver/logging/format.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
@@ -38,11 +39,14 @@ void CreateLogDirectory(const std::string& logger_name,
   }
 }
 
-SinkPtr GetSinkFromFilename(const std::string& file_path) {
+SinkPtr GetSinkFromFilename(const std::string& file_path,
+                            LogCompression compression) {
   if (utils::text::StartsWith(file_path, kUnixSocketPrefix)) {
     // Use Unix-socket sink
     return std::make_unique<UnixSocketSink>(
         file_path.substr(kUnixSocketPrefix.size()));
+  } else if (compression == LogCompression::kZstd) {
+    return std::make_unique<ZstdFileSink>(file_path);
   } else {
     return std::make_unique<BufferedFileSink>(file_path);
   }
@@ -57,7 +61,7 @@ SinkPtr MakeOptionalSink(const LoggerConfig& config) {
     return std::make_unique<logging::impl::BufferedUnownedFileSink>(stdout);
   } else {
     CreateLogDirectory(config.logger_name, config.file_path);
-    return GetSinkFromFilename(config.file_path);
+    return GetSinkFromFilename(config.file_path, config.compression);
   }
 }
 
@@ -73,6 +77,7 @@ std::shared_ptr<TpLogger> MakeTpLogger(const LoggerConfig& config) {
   auto logger = std::make_shared<TpLogger>(config.format, config.logger_name);
   logger->SetLevel(config.level);
   logger->SetFlushOn(config.flush_level);
+  logger->SetFormattingDeferred(config.deferred_formatting);
 
   if (auto basic_sink = MakeOptionalSink(config)) {
     logger->AddSink(std::move(basic_sink));
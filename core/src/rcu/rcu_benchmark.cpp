@@ -9,15 +9,18 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/rcu/sharded_rcu_map.hpp>
 #include <userver/utils/async.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-template <int VariableCount>
+template <int VariableCount,
+          typename RcuTraits = rcu::DefaultRcuTraits<std::uint64_t>>
 void rcu_read(benchmark::State& state) {
   engine::RunStandalone([&] {
-    rcu::Variable<std::uint64_t> vars[VariableCount];
+    rcu::Variable<std::uint64_t, RcuTraits> vars[VariableCount];
     {
       std::uint64_t i = 0;
       for (auto& var : vars) {
@@ -37,11 +40,14 @@ void rcu_read(benchmark::State& state) {
 BENCHMARK_TEMPLATE(rcu_read, 1);
 BENCHMARK_TEMPLATE(rcu_read, 2);
 BENCHMARK_TEMPLATE(rcu_read, 4);
+BENCHMARK_TEMPLATE(rcu_read, 1, rcu::EpochRcuTraits<std::uint64_t>);
+BENCHMARK_TEMPLATE(rcu_read, 4, rcu::EpochRcuTraits<std::uint64_t>);
 
-template <int VariableCount>
+template <int VariableCount,
+          typename RcuTraits = rcu::DefaultRcuTraits<std::uint64_t>>
 void rcu_write(benchmark::State& state) {
   engine::RunStandalone([&] {
-    rcu::Variable<std::uint64_t> vars[VariableCount];
+    rcu::Variable<std::uint64_t, RcuTraits> vars[VariableCount];
 
     std::uint64_t i = 0;
     for ([[maybe_unused]] auto _ : state) {
@@ -53,6 +59,7 @@ void rcu_write(benchmark::State& state) {
 BENCHMARK_TEMPLATE(rcu_write, 1);
 BENCHMARK_TEMPLATE(rcu_write, 2);
 BENCHMARK_TEMPLATE(rcu_write, 4);
+BENCHMARK_TEMPLATE(rcu_write, 1, rcu::EpochRcuTraits<std::uint64_t>);
 
 void rcu_contention(benchmark::State& state) {
   const std::size_t readers_count = state.range(0);
@@ -135,4 +142,51 @@ void rcu_of_shared_ptr(benchmark::State& state) {
 }
 BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
 
+// Every keyset change of a map copies the map (or its shard), so the time of
+// an insert+erase pair grows with the map size
+template <typename Map>
+void rcu_map_write(benchmark::State& state) {
+  const auto size = static_cast<int>(state.range(0));
+
+  engine::RunStandalone([&] {
+    Map map;
+    for (int i = 0; i < size; ++i) map.Emplace(i, i);
+
+    int key = size;
+    for ([[maybe_unused]] auto _ : state) {
+      map.Emplace(key, key);
+      map.Erase(key);
+      ++key;
+    }
+  });
+}
+BENCHMARK_TEMPLATE(rcu_map_write, rcu::RcuMap<int, int>)
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
+BENCHMARK_TEMPLATE(rcu_map_write, rcu::ShardedRcuMap<int, int>)
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
+
+template <typename Map>
+void rcu_map_read(benchmark::State& state) {
+  const auto size = static_cast<int>(state.range(0));
+
+  engine::RunStandalone([&] {
+    Map map;
+    for (int i = 0; i < size; ++i) map.Emplace(i, i);
+
+    int key = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(map.Get(key));
+      if (++key == size) key = 0;
+    }
+  });
+}
+BENCHMARK_TEMPLATE(rcu_map_read, rcu::RcuMap<int, int>)
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
+BENCHMARK_TEMPLATE(rcu_map_read, rcu::ShardedRcuMap<int, int>)
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
+
 USERVER_NAMESPACE_END
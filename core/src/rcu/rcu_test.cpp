@@ -414,14 +414,13 @@ constexpr std::size_t kSleeperTask = 1;
 constexpr std::size_t kTotalTasks =
     kReadablePtrPingPongTasks + kReadingTasks + kWritingTasks + kSleeperTask;
 
-}  // namespace
-
-UTEST_MT(Rcu, TortureTest, kTotalTasks) {
-  rcu::Variable<CleaningUpInt> data{1};
+template <typename RcuTraits>
+void RunTortureTest() {
+  rcu::Variable<CleaningUpInt, RcuTraits> data{1};
   std::atomic<bool> keep_running{true};
 
   engine::Mutex ping_pong_mutex;
-  rcu::ReadablePtr<CleaningUpInt> ptr = data.Read();
+  rcu::ReadablePtr<CleaningUpInt, RcuTraits> ptr = data.Read();
 
   std::vector<engine::TaskWithResult<void>> tasks;
 
@@ -461,6 +460,16 @@ UTEST_MT(Rcu, TortureTest, kTotalTasks) {
   keep_running = false;
 }
 
+}  // namespace
+
+UTEST_MT(Rcu, TortureTest, kTotalTasks) {
+  RunTortureTest<rcu::DefaultRcuTraits<CleaningUpInt>>();
+}
+
+UTEST_MT(Rcu, EpochsTortureTest, kTotalTasks) {
+  RunTortureTest<rcu::EpochRcuTraits<CleaningUpInt>>();
+}
+
 UTEST(Rcu, WritablePtrUnlocksInCommit) {
   rcu::Variable<int> var{1};
 
@@ -539,6 +548,37 @@ UTEST(Rcu, SyncDestruction) {
   EXPECT_TRUE(destroyed[2]);
 }
 
+UTEST(Rcu, EpochsDestruction) {
+  using Traits = rcu::EpochRcuTraits<DestructionTracker>;
+  std::atomic<bool> destroyed[4]{false, false, false, false};
+  {
+    rcu::Variable<DestructionTracker, Traits> var{rcu::DestructionType::kSync,
+                                                  destroyed[0]};
+
+    // Without readers, the old values are destroyed right away
+    var.Emplace(destroyed[1]);
+    EXPECT_TRUE(destroyed[0]);
+
+    {
+      const auto reader = var.Read();
+      var.Emplace(destroyed[2]);
+      var.Emplace(destroyed[3]);
+
+      // The reader delays the destruction of all the values retired after it
+      // has been obtained
+      EXPECT_FALSE(destroyed[1]);
+      EXPECT_FALSE(destroyed[2]);
+    }
+
+    var.Cleanup();
+    EXPECT_TRUE(destroyed[1]);
+    EXPECT_TRUE(destroyed[2]);
+    EXPECT_FALSE(destroyed[3]);
+  }
+
+  EXPECT_TRUE(destroyed[3]);
+}
+
 UTEST_MT(Rcu, Core, 3) {
   const auto deadline =
       engine::Deadline::FromDuration(std::chrono::milliseconds{100});
@@ -0,0 +1,130 @@
+#include <userver/rcu/sharded_rcu_map.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ShardedRcuMap, Empty) {
+  rcu::ShardedRcuMap<std::string, int> map;
+  const auto& cmap = map;
+
+  EXPECT_EQ(0, map.SizeApprox());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(cmap.begin(), cmap.end());
+  EXPECT_TRUE(map.GetSnapshot().empty());
+  map.Clear();
+  EXPECT_TRUE(map.GetSnapshot().empty());
+}
+
+UTEST(ShardedRcuMap, Modify) {
+  rcu::ShardedRcuMap<std::string, int> map;
+  const auto& cmap = map;
+
+  UEXPECT_THROW(cmap["any"], rcu::MissingKeyException);
+  EXPECT_FALSE(map.Get("any"));
+  EXPECT_FALSE(map.Erase("any"));
+  EXPECT_FALSE(map.Pop("any"));
+
+  UEXPECT_NO_THROW(*map["any"] = 1);
+  EXPECT_EQ(1, *cmap["any"]);
+  EXPECT_EQ(1, *cmap.Get("any"));
+  EXPECT_TRUE(map.Erase("any"));
+  EXPECT_FALSE(map.Erase("any"));
+
+  EXPECT_TRUE(map.Insert("any", std::make_shared<int>(3)).inserted);
+  EXPECT_FALSE(map.Insert("any", std::make_shared<int>(0)).inserted);
+  EXPECT_EQ(*map.Pop("any"), 3);
+
+  EXPECT_TRUE(map.Emplace("any", 4).inserted);
+  EXPECT_FALSE(map.TryEmplace("any", 0).inserted);
+  EXPECT_EQ(*map.TryEmplace("any", 0).value, 4);
+
+  map.InsertOrAssign("any", std::make_shared<int>(5));
+  EXPECT_EQ(*cmap["any"], 5);
+  EXPECT_EQ(*map.Pop("any"), 5);
+}
+
+UTEST(ShardedRcuMap, IterationOverShards) {
+  /// [Sample rcu::ShardedRcuMap usage]
+  // Keys are split between 8 shards, a write copies only one of them
+  rcu::ShardedRcuMap<int, std::atomic<int>, 8> map;
+
+  for (int i = 0; i < 100; ++i) {
+    map.Emplace(i, i);
+  }
+  EXPECT_EQ(map.SizeApprox(), 100);
+
+  // Iteration visits every shard
+  int sum = 0;
+  for (const auto& [key, value] : map) {
+    sum += value->load();
+  }
+  EXPECT_EQ(sum, 99 * 100 / 2);
+  /// [Sample rcu::ShardedRcuMap usage]
+
+  std::unordered_set<int> seen;
+  for (auto it = map.begin(); it != map.end(); it++) {
+    EXPECT_TRUE(seen.insert(it->first).second);
+  }
+  EXPECT_EQ(seen.size(), 100);
+  EXPECT_EQ(map.GetSnapshot().size(), 100);
+
+  for (int i = 0; i < 100; i += 2) {
+    EXPECT_TRUE(map.Erase(i));
+  }
+  EXPECT_EQ(map.GetSnapshot().size(), 50);
+}
+
+UTEST(ShardedRcuMap, Assign) {
+  rcu::ShardedRcuMap<int, int, 4> map;
+  *map[-1] = -1;
+
+  std::unordered_map<int, std::shared_ptr<int>> new_map;
+  for (int i = 0; i < 20; ++i) new_map.emplace(i, std::make_shared<int>(i));
+  map.Assign(std::move(new_map));
+
+  EXPECT_FALSE(map.Get(-1));
+  EXPECT_EQ(map.SizeApprox(), 20);
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_TRUE(map.Get(i));
+    EXPECT_EQ(*map.Get(i), i);
+  }
+}
+
+UTEST_MT(ShardedRcuMap, ConcurrentUpdates, 4) {
+  rcu::ShardedRcuMap<int, int> map;
+  std::array<engine::TaskWithResult<void>, 4> workers;
+  std::atomic<bool> stop_flag{false};
+
+  for (int i = 0; i < static_cast<int>(workers.size()); ++i) {
+    workers[i] = utils::Async("writer", [i, &map, &stop_flag] {
+      while (!stop_flag) {
+        for (int key = i * 100; key < (i + 1) * 100; ++key) {
+          ASSERT_TRUE(map.Emplace(key, key).inserted);
+        }
+        for (int key = i * 100; key < (i + 1) * 100; ++key) {
+          ASSERT_EQ(*map.Pop(key), key);
+        }
+      }
+    });
+  }
+
+  engine::SleepFor(std::chrono::milliseconds(100));
+  stop_flag = true;
+  for (auto& w : workers) w.Get();
+
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+USERVER_NAMESPACE_END
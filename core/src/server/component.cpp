@@ -107,6 +107,10 @@ properties:
                 type: integer
                 description: max connections count to keep
                 defaultDescription: 32768
+            shed-connections-on-overload:
+                type: boolean
+                description: drop new connections while the congestion control throttles the requests
+                defaultDescription: false
             task_processor:
                 type: string
                 description: task processor to process incoming requests
@@ -188,9 +192,23 @@ properties:
                         type: integer
                         description: delay in microseconds of the start of abort check routine
                         defaultDescription: 20ms
+                    http2_enabled:
+                        type: boolean
+                        description: accept HTTP/2 connections with prior knowledge (h2c) alongside HTTP/1.1 ones
+                        defaultDescription: false
+                    pipeline_concurrency:
+                        type: integer
+                        description: how many pipelined HTTP/1.1 requests of a connection are handled concurrently; responses of completed requests are coalesced into a single write
+                        defaultDescription: 1
+                        minimum: 1
             shards:
                 type: integer
-                description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+                description: how many listening sockets bound with SO_REUSEPORT to the same port, each with its own accept task; the kernel distributes the new connections between them; unix sockets always use a single one
+                defaultDescription: the event threads count of the task processor
+            shards-cpu-steering:
+                type: boolean
+                description: on Linux, make the kernel pass a new connection to the shard with the index of the CPU that received it, set shards to the CPUs count to use it
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
@@ -1,7 +1,10 @@
 #include <userver/server/congestion_control/sensor.hpp>
 
+#include <algorithm>
+
 #include <engine/task/task_processor.hpp>
 #include <server/net/stats.hpp>
+#include <utils/statistics/system_pressure.hpp>
 #include <userver/server/server.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -10,8 +13,17 @@ namespace server::congestion_control {
 
 namespace {
 const std::chrono::seconds kSecond{1};
+
+double CalcPercent(std::uint64_t current, std::uint64_t& last,
+                   std::uint64_t total) {
+  const auto diff = current >= last ? current - last : 0;
+  last = current;
+  if (total == 0) return 0;
+  return std::min(100.0, static_cast<double>(diff) * 100 / total);
 }
 
+}  // namespace
+
 Sensor::Sensor(engine::TaskProcessor& tp) : tp_(tp) {}
 
 void Sensor::RegisterRequestsSource(RequestsSource& source) {
@@ -48,11 +60,42 @@ Sensor::Data Sensor::FetchCurrent() {
   last_no_overloads_ = no_overloads;
   last_requests_ = requests;
 
+  // Full memory stalls are used, as the `some` ones are common for the page
+  // cache reclaim and do not mean an overload
+  const auto pressure = utils::statistics::impl::GetSelfSystemPressure();
+  const auto duration_us = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(duration_ms)
+          .count());
+  double system_pressure_percent = 0;
+  if (pressure.cpu) {
+    system_pressure_percent = std::max(
+        system_pressure_percent,
+        CalcPercent(pressure.cpu->some.total_us, last_cpu_stall_us_,
+                    duration_us));
+  }
+  if (pressure.memory && pressure.memory->full) {
+    system_pressure_percent = std::max(
+        system_pressure_percent,
+        CalcPercent(pressure.memory->full->total_us, last_memory_stall_us_,
+                    duration_us));
+  }
+  if (const auto& throttling = pressure.cpu_throttling) {
+    const auto periods = throttling->nr_periods >= last_cpu_periods_
+                             ? throttling->nr_periods - last_cpu_periods_
+                             : 0;
+    last_cpu_periods_ = throttling->nr_periods;
+    system_pressure_percent = std::max(
+        system_pressure_percent,
+        CalcPercent(throttling->nr_throttled, last_cpu_throttled_periods_,
+                    periods));
+  }
+
   return Data{
       first_fetch ? 0 : rps,
       first_fetch ? 0 : overloads_ps,
       first_fetch ? 0 : no_overloads_ps,
       now,
+      first_fetch ? 0 : system_pressure_percent,
   };
 }
 
@@ -0,0 +1,57 @@
+#include <userver/server/handlers/auth/verified_token_cache.hpp>
+
+#include <userver/crypto/hash.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers::auth {
+
+namespace {
+
+std::string HashToken(std::string_view token) {
+  // A cryptographic hash, so that a forged token can not collide with a
+  // verified one
+  return crypto::hash::Sha256(token, crypto::hash::OutputEncoding::kBinary);
+}
+
+}  // namespace
+
+VerifiedTokenCache::VerifiedTokenCache(std::size_t ways, std::size_t way_size)
+    : tokens_(ways, way_size, {}, {}, cache::CachePolicy::kClock) {}
+
+void VerifiedTokenCache::Verify(const crypto::Verifier& verifier,
+                                std::string_view token,
+                                std::initializer_list<std::string_view> data,
+                                std::string_view raw_signature,
+                                TimePoint expires_at) {
+  const auto hash = HashToken(token);
+  const auto now = utils::datetime::Now();
+  const auto is_valid = [now](TimePoint cached) { return now < cached; };
+  if (tokens_.Get(hash, is_valid)) return;
+
+  verifier.Verify(data, raw_signature);
+  if (now < expires_at) tokens_.Put(hash, expires_at);
+}
+
+bool VerifiedTokenCache::IsVerified(std::string_view token) {
+  const auto now = utils::datetime::Now();
+  return tokens_
+      .Get(HashToken(token), [now](TimePoint cached) { return now < cached; })
+      .has_value();
+}
+
+void VerifiedTokenCache::MarkVerified(std::string_view token,
+                                      TimePoint expires_at) {
+  if (utils::datetime::Now() < expires_at) {
+    tokens_.Put(HashToken(token), expires_at);
+  }
+}
+
+void VerifiedTokenCache::Invalidate() { tokens_.Invalidate(); }
+
+std::size_t VerifiedTokenCache::GetSize() const { return tokens_.GetSize(); }
+
+}  // namespace server::handlers::auth
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,77 @@
+#include <userver/server/handlers/auth/verified_token_cache.hpp>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace auth = server::handlers::auth;
+
+constexpr std::size_t kWays = 2;
+constexpr std::size_t kWaySize = 4;
+
+class CountingVerifier final : public crypto::Verifier {
+ public:
+  CountingVerifier() : crypto::Verifier("counting") {}
+
+  void Verify(std::initializer_list<std::string_view> data,
+              std::string_view raw_signature) const override {
+    ++calls;
+    if (data.size() != 1 || *data.begin() != raw_signature) {
+      throw crypto::VerificationError("Invalid signature");
+    }
+  }
+
+  mutable int calls{0};
+};
+
+}  // namespace
+
+UTEST(VerifiedTokenCache, Verify) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::time_point{});
+  const auto expires_at = utils::datetime::Now() + std::chrono::seconds{10};
+
+  auth::VerifiedTokenCache cache{kWays, kWaySize};
+  CountingVerifier verifier;
+
+  UEXPECT_NO_THROW(cache.Verify(verifier, "a.b", {"a"}, "a", expires_at));
+  UEXPECT_NO_THROW(cache.Verify(verifier, "a.b", {"a"}, "a", expires_at));
+  EXPECT_EQ(verifier.calls, 1);
+  EXPECT_TRUE(cache.IsVerified("a.b"));
+
+  // Invalid signatures are verified each time
+  UEXPECT_THROW(cache.Verify(verifier, "c.d", {"c"}, "d", expires_at),
+                crypto::VerificationError);
+  UEXPECT_THROW(cache.Verify(verifier, "c.d", {"c"}, "d", expires_at),
+                crypto::VerificationError);
+  EXPECT_EQ(verifier.calls, 3);
+  EXPECT_FALSE(cache.IsVerified("c.d"));
+
+  utils::datetime::MockSleep(std::chrono::seconds{10});
+  EXPECT_FALSE(cache.IsVerified("a.b"));
+  UEXPECT_NO_THROW(cache.Verify(verifier, "a.b", {"a"}, "a", expires_at));
+  EXPECT_EQ(verifier.calls, 4);
+  // Expired tokens are not cached
+  EXPECT_FALSE(cache.IsVerified("a.b"));
+
+  cache.MarkVerified("e.f", utils::datetime::Now() + std::chrono::seconds{1});
+  EXPECT_TRUE(cache.IsVerified("e.f"));
+  cache.Invalidate();
+  EXPECT_FALSE(cache.IsVerified("e.f"));
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+UTEST(VerifiedTokenCache, Bounded) {
+  auth::VerifiedTokenCache cache{kWays, kWaySize};
+  const auto expires_at = utils::datetime::Now() + std::chrono::hours{1};
+
+  for (int i = 0; i < 100; ++i) {
+    cache.MarkVerified(std::to_string(i), expires_at);
+  }
+  EXPECT_LE(cache.GetSize(), kWays * kWaySize);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,120 @@
+#include <userver/server/handlers/cpu_profiler.hpp>
+
+#include <chrono>
+
+#include <fmt/format.h>
+
+#include <engine/task/sampling_profiler.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::size_t kDefaultFrequency = 99;
+
+// Per-thread buffers fit ~2.5 seconds of samples with the default frequency
+constexpr std::chrono::seconds kDrainPeriod{1};
+
+std::string FormatStats(const engine::impl::SamplingProfilerStats& stats) {
+  return fmt::format(
+      "running: {}\nfrequency: {}\nthreads: {}\nsamples: {}\n"
+      "dropped_samples: {}\n",
+      stats.is_running, stats.frequency, stats.threads, stats.samples,
+      stats.dropped_samples);
+}
+
+}  // namespace
+
+CpuProfiler::CpuProfiler(const components::ComponentConfig& config,
+                         const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
+      default_frequency_(
+          config["frequency"].As<std::size_t>(kDefaultFrequency)) {
+  auto& profiler = engine::impl::SamplingProfiler::Get();
+  if (config["autostart"].As<bool>(false)) {
+    try {
+      profiler.Start(default_frequency_);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to start the CPU profiler: " << ex;
+    }
+  }
+
+  utils::PeriodicTask::Settings settings{kDrainPeriod};
+  settings.span_level = logging::Level::kNone;
+  drain_task_.Start("cpu-profiler-drain", settings,
+                    [&profiler] { profiler.Drain(); });
+}
+
+CpuProfiler::~CpuProfiler() {
+  drain_task_.Stop();
+  engine::impl::SamplingProfiler::Get().Stop();
+}
+
+std::string CpuProfiler::HandleRequestThrow(const http::HttpRequest& request,
+                                            request::RequestContext&) const {
+  auto& profiler = engine::impl::SamplingProfiler::Get();
+  const auto& command = request.GetPathArg("command");
+  if (command == "start") {
+    auto frequency = default_frequency_;
+    if (request.HasArg("frequency")) {
+      try {
+        frequency = utils::FromString<std::size_t>(request.GetArg("frequency"));
+      } catch (const std::exception& ex) {
+        request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+        return std::string{"invalid 'frequency' value: "} + ex.what();
+      }
+    }
+    try {
+      profiler.Start(frequency);
+    } catch (const std::invalid_argument& ex) {
+      request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+      return ex.what();
+    }
+    return "OK\n";
+  } else if (command == "stop") {
+    profiler.Stop();
+    return "OK\n";
+  } else if (command == "reset") {
+    profiler.Reset();
+    return "OK\n";
+  } else if (command == "pprof") {
+    request.GetHttpResponse().SetContentType("application/octet-stream");
+    return profiler.GetPprof();
+  } else if (command == "folded") {
+    return profiler.GetFolded();
+  } else if (command == "stat") {
+    return FormatStats(profiler.GetStats());
+  } else {
+    request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+    return "Unsupported command";
+  }
+}
+
+yaml_config::Schema CpuProfiler::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: handler-cpu-profiler config
+additionalProperties: false
+properties:
+    frequency:
+        type: integer
+        description: default sampling frequency of each thread, Hz
+        defaultDescription: 99
+        minimum: 1
+        maximum: 1000
+    autostart:
+        type: boolean
+        description: start profiling on service start
+        defaultDescription: false
+)");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
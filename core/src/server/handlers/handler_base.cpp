@@ -75,6 +75,12 @@ properties:
         enum:
           - both
           - strict-match
+    scheduling-class:
+        type: string
+        description: |
+            scheduling class of the `task_processor` to run the requests in,
+            see the `scheduling-classes` task processor option
+        defaultDescription: the first class of the task processor
     max_requests_in_flight:
         type: integer
         description: integer to limit max pending requests to this handler
@@ -91,6 +97,39 @@ properties:
         type: integer
         description: integer to limit RPS to this handler
         defaultDescription: <no limit>
+    adaptive_concurrency_limit:
+        type: object
+        description: |
+            limit pending requests to this handler by a limit adjusted to the
+            handler timings
+        defaultDescription: <no limit>
+        additionalProperties: false
+        properties:
+            min-limit:
+                type: integer
+                description: the limit is never set below this value
+                defaultDescription: 10
+                minimum: 1
+            max-limit:
+                type: integer
+                description: the limit is removed once it grows up to this value
+                defaultDescription: 10000
+            rtt-tolerance:
+                type: number
+                description: timings up to this many times the usual ones are not an overload
+                defaultDescription: 1.5
+            smoothing:
+                type: number
+                description: share of the new limit estimation in the limit on each step
+                defaultDescription: 0.2
+            min-qps:
+                type: integer
+                description: less requests per second are too noisy to change the limit
+                defaultDescription: 10
+            fake-mode:
+                type: boolean
+                description: only log and report the limit without applying it
+                defaultDescription: false
     decompress_request:
         type: boolean
         description: allow decompression of the requests
@@ -107,6 +146,10 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    request-body-stream:
+        type: boolean
+        description: set to true to start the handler once the headers are received and read the body with server::http::RequestBodyStream
+        defaultDescription: false
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
@@ -60,6 +60,8 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
   }
 
   config.task_processor = value["task_processor"].As<std::string>();
+  config.scheduling_class =
+      value["scheduling-class"].As<std::optional<std::string>>();
   config.method = value["method"].As<std::string>();
   config.request_config.max_request_size =
       value["max_request_size"].As<size_t>(handler_defaults.max_request_size);
@@ -82,12 +84,17 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
           kLogRequestDataSizeDefaultLimit);
   config.max_requests_per_second =
       value["max_requests_per_second"].As<std::optional<size_t>>();
+  config.adaptive_concurrency_limit =
+      value["adaptive_concurrency_limit"]
+          .As<std::optional<
+              USERVER_NAMESPACE::congestion_control::v2::GradientConfig>>();
   config.decompress_request = value["decompress_request"].As<bool>(true);
   config.throttling_enabled = value["throttling_enabled"].As<bool>(true);
   config.set_response_server_hostname =
       value["set-response-server-hostname"].As<std::optional<bool>>();
 
   config.response_body_stream = value["response-body-stream"].As<bool>(false);
+  config.request_body_stream = value["request-body-stream"].As<bool>(false);
 
   if (config.max_requests_per_second &&
       config.max_requests_per_second.value() <= 0) {
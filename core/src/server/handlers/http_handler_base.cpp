@@ -5,7 +5,9 @@
 #include <boost/container/small_vector.hpp>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
+#include <engine/task/task_processor.hpp>
 #include <server/http/http_request_impl.hpp>
+#include <server/http/precomputed_headers.hpp>
 #include <server/middlewares/handler_adapter.hpp>
 #include <server/request/internal_request_context.hpp>
 #include <server/server_config.hpp>
@@ -16,6 +18,7 @@
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/inherited_variable.hpp>
+#include <userver/engine/task/task_base.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/level_serialization.hpp>
@@ -67,6 +70,7 @@ std::vector<http::HttpMethod> InitAllowedMethods(const HandlerConfig& config) {
 void SetFormattedErrorResponse(http::HttpResponse& http_response,
                                FormattedErrorData&& formatted_error_data) {
   http_response.SetData(std::move(formatted_error_data.external_body));
+  http_response.ClearBodySegments();
   if (formatted_error_data.content_type) {
     http_response.SetContentType(*std::move(formatted_error_data.content_type));
   }
@@ -144,8 +148,11 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
       log_level_for_status_codes_(ParseStatusCodesLogLevel(
           config["status-codes-log-level"]
               .As<std::unordered_map<std::string, std::string>>({}))),
-      handler_statistics_(std::make_unique<HttpHandlerStatistics>()),
-      request_statistics_(std::make_unique<HttpRequestStatistics>()),
+      handler_statistics_(
+          std::make_unique<HttpHandlerStatistics>(allowed_methods_)),
+      request_statistics_(
+          std::make_unique<HttpRequestStatistics>(allowed_methods_)),
+      precomputed_headers_(std::make_unique<http::impl::PrecomputedHeaders>()),
       is_body_streamed_(config["response-body-stream"].As<bool>(false)) {
   if (allowed_methods_.empty()) {
     LOG_WARNING() << "empty allowed methods list in " << config.Name();
@@ -155,6 +162,13 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
 
   engine::TaskProcessor& task_processor =
       context.GetTaskProcessor(GetConfig().task_processor);
+  const auto& scheduling_class = GetConfig().scheduling_class;
+  if (scheduling_class && task_processor.HasSchedulingClasses() &&
+      !task_processor.FindSchedulingClass(*scheduling_class)) {
+    throw std::runtime_error(fmt::format(
+        "Task processor '{}' of handler '{}' has no scheduling class '{}'",
+        GetConfig().task_processor, config.Name(), *scheduling_class));
+  }
   try {
     server_component.AddHandler(*this, task_processor);
   } catch (const std::exception& ex) {
@@ -191,11 +205,14 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
       },
       std::move(labels));
 
-  set_response_server_hostname_ =
-      GetConfig().set_response_server_hostname.value_or(
-          server_component.GetServer()
-              .GetConfig()
-              .set_response_server_hostname);
+  const auto& server_config = server_component.GetServer().GetConfig();
+  precomputed_headers_->Add(USERVER_NAMESPACE::http::headers::kServer,
+                            server_config.server_name);
+  if (GetConfig().set_response_server_hostname.value_or(
+          server_config.set_response_server_hostname)) {
+    precomputed_headers_->Add(
+        USERVER_NAMESPACE::http::headers::kXYaTaxiServerHostname, kHostname);
+  }
 }
 
 HttpHandlerBase::~HttpHandlerBase() { statistics_holder_.Unregister(); }
@@ -277,6 +294,12 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
   auto& response = http_request.GetHttpResponse();
 
   context.GetInternalContext().SetConfigSnapshot(config_source_.GetSnapshot());
+  if (const auto& scheduling_class = GetConfig().scheduling_class) {
+    engine::current_task::SetSchedulingClass(*scheduling_class);
+  }
+  // Set before the pipeline for the streamed responses, the headers set by
+  // the handler still take precedence
+  response.SetPrecomputedHeaders(*precomputed_headers_);
   try {
     UASSERT(first_middleware_);
     first_middleware_->HandleRequest(http_request, context);
@@ -288,7 +311,6 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     response.SetStatus(http::HttpStatus::kInternalServerError);
   }
 
-  SetResponseServerHostname(response);
   response.SetHeadersEnd();
 }
 
@@ -419,6 +441,7 @@ void HttpHandlerBase::HandleCustomHandlerException(
   response.SetStatus(http_status);
   if (ex.IsExternalErrorBodyFormatted()) {
     response.SetData(ex.GetExternalErrorBody());
+    response.ClearBodySegments();
   } else {
     SetFormattedErrorResponse(response, GetFormattedExternalErrorBody(ex));
   }
@@ -477,14 +500,6 @@ void HttpHandlerBase::FormatStatistics(utils::statistics::Writer result,
   result = total;
 }
 
-void HttpHandlerBase::SetResponseServerHostname(
-    http::HttpResponse& response) const {
-  if (set_response_server_hostname_) {
-    response.SetHeader(USERVER_NAMESPACE::http::headers::kXYaTaxiServerHostname,
-                       kHostname);
-  }
-}
-
 void HttpHandlerBase::BuildMiddlewarePipeline(
     const components::ComponentConfig& config,
     const components::ComponentContext& context) {
@@ -25,6 +25,11 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["deadline-received"] = stats.deadline_received;
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
   writer["timings"] = stats.timings;
+  // Only reported by the task processors with resource usage accounting
+  if (stats.cpu_time_us || stats.allocated_bytes) {
+    writer["cpu-time-us"] = stats.cpu_time_us;
+    writer["allocated-bytes"] = stats.allocated_bytes;
+  }
 }
 
 }  // namespace
@@ -36,6 +41,14 @@ void HttpHandlerMethodStatistics::Account(
   timings_.GetCurrentCounter().Account(stats.timing.count());
   if (stats.deadline.IsReachable()) ++deadline_received_;
   if (stats.cancelled_by_deadline) ++cancelled_by_deadline_;
+  if (stats.resource_usage) {
+    cpu_time_us_ += utils::statistics::Rate{static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            stats.resource_usage->cpu_time)
+            .count())};
+    allocated_bytes_ +=
+        utils::statistics::Rate{stats.resource_usage->allocated_bytes};
+  }
 }
 
 std::size_t HttpHandlerMethodStatistics::GetInFlight() const noexcept {
@@ -59,7 +72,9 @@ HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(
       too_many_requests_in_flight(stats.too_many_requests_in_flight_.Load()),
       rate_limit_reached(stats.rate_limit_reached_.Load()),
       deadline_received(stats.deadline_received_.Load()),
-      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()) {}
+      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()),
+      cpu_time_us(stats.cpu_time_us_.Load()),
+      allocated_bytes(stats.allocated_bytes_.Load()) {}
 
 void HttpHandlerStatisticsSnapshot::Add(
     const HttpHandlerStatisticsSnapshot& other) {
@@ -71,6 +86,8 @@ void HttpHandlerStatisticsSnapshot::Add(
   rate_limit_reached += other.rate_limit_reached;
   deadline_received += other.deadline_received;
   cancelled_by_deadline += other.cancelled_by_deadline;
+  cpu_time_us += other.cpu_time_us;
+  allocated_bytes += other.allocated_bytes;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -112,6 +129,7 @@ HttpHandlerStatisticsScope::~HttpHandlerStatisticsScope() {
       finish_time - start_time_);
   stats.deadline = data ? data->deadline : engine::Deadline{};
   stats.cancelled_by_deadline = cancelled_by_deadline_;
+  stats.resource_usage = resource_usage_stopwatch_.GetElapsed();
   stats_.ForMethod(method_).Account(stats);
   stats_.ForMethod(method_).DecrementInFlight();
 }
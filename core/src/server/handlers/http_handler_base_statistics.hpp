@@ -3,8 +3,12 @@
 #include <array>
 #include <chrono>
 #include <cstddef>
+#include <memory>
+#include <optional>
 #include <type_traits>
+#include <vector>
 
+#include <engine/task/resource_usage.hpp>
 #include <server/http/handler_methods.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
@@ -13,6 +17,7 @@
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/striped_rate_counter.hpp>
 #include <utils/statistics/http_codes.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,6 +30,8 @@ struct HttpHandlerStatisticsEntry final {
   std::chrono::milliseconds timing{};
   engine::Deadline deadline{};
   bool cancelled_by_deadline{false};
+  // Set if the resource usage accounting is enabled for the task processor
+  std::optional<engine::impl::TaskResourceUsage> resource_usage{};
 };
 
 struct HttpHandlerStatisticsSnapshot;
@@ -57,11 +64,16 @@ class HttpHandlerMethodStatistics final {
 
   RecentPeriod timings_;
   utils::statistics::HttpCodes reply_codes_;
-  utils::statistics::RateCounter started_;
-  utils::statistics::RateCounter finished_;
+  // Updated by every request, striped to avoid the cache line ping-pong
+  // between the worker threads. Summed up only when the metrics are written.
+  utils::statistics::StripedRateCounter started_;
+  utils::statistics::StripedRateCounter finished_;
+  utils::statistics::StripedRateCounter deadline_received_;
+  utils::statistics::StripedRateCounter cpu_time_us_;
+  utils::statistics::StripedRateCounter allocated_bytes_;
+  // Rare events
   utils::statistics::RateCounter too_many_requests_in_flight_;
   utils::statistics::RateCounter rate_limit_reached_;
-  utils::statistics::RateCounter deadline_received_;
   utils::statistics::RateCounter cancelled_by_deadline_;
 };
 
@@ -84,6 +96,8 @@ struct HttpHandlerStatisticsSnapshot final {
   utils::statistics::Rate rate_limit_reached;
   utils::statistics::Rate deadline_received;
   utils::statistics::Rate cancelled_by_deadline;
+  utils::statistics::Rate cpu_time_us;
+  utils::statistics::Rate allocated_bytes;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -120,23 +134,51 @@ class ByMethodStatistics {
  public:
   using Snapshot = typename MethodStatistics::Snapshot;
 
+  /// Keeps separate statistics for each of the methods
+  ByMethodStatistics() {
+    for (auto& stats : by_method_) stats = Allocate();
+  }
+
+  /// Keeps separate statistics only for the `methods`, all the other methods
+  /// share a single entry that is not reported.
+  explicit ByMethodStatistics(const std::vector<http::HttpMethod>& methods) {
+    for (const auto method : methods) {
+      by_method_[HttpMethodToIndex(method)] = Allocate();
+    }
+    auto* const other = Allocate();
+    for (auto& stats : by_method_) {
+      if (!stats) stats = other;
+    }
+  }
+
   const MethodStatistics& GetByMethod(http::HttpMethod method) const noexcept {
-    return by_method_[HttpMethodToIndex(method)];
+    return *by_method_[HttpMethodToIndex(method)];
   }
 
   MethodStatistics& ForMethod(http::HttpMethod method) noexcept {
-    return by_method_[HttpMethodToIndex(method)];
+    return *by_method_[HttpMethodToIndex(method)];
   }
 
  private:
-  std::array<MethodStatistics, http::kHandlerMethodsMax + 1> by_method_;
+  MethodStatistics* Allocate() {
+    return storage_.emplace_back(std::make_unique<MethodStatistics>()).get();
+  }
+
+  std::vector<std::unique_ptr<MethodStatistics>> storage_;
+  std::array<MethodStatistics*, http::kHandlerMethodsMax + 1> by_method_{};
 };
 
 class HttpHandlerStatistics final
-    : public ByMethodStatistics<HttpHandlerMethodStatistics> {};
+    : public ByMethodStatistics<HttpHandlerMethodStatistics> {
+ public:
+  using ByMethodStatistics::ByMethodStatistics;
+};
 
 class HttpRequestStatistics final
-    : public ByMethodStatistics<HttpRequestMethodStatistics> {};
+    : public ByMethodStatistics<HttpRequestMethodStatistics> {
+ public:
+  using ByMethodStatistics::ByMethodStatistics;
+};
 
 class HttpHandlerStatisticsScope final {
  public:
@@ -154,6 +196,7 @@ class HttpHandlerStatisticsScope final {
   HttpHandlerStatistics& stats_;
   const http::HttpMethod method_;
   const std::chrono::steady_clock::time_point start_time_;
+  const engine::impl::TaskResourceUsageStopwatch resource_usage_stopwatch_;
   server::http::HttpResponse& response_;
   bool cancelled_by_deadline_{false};
 };
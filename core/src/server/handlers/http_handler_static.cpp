@@ -1,9 +1,16 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <array>
+
+#include <fmt/format.h>
+
+#include <server/http/content_coding.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +40,34 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>>
 )"},
     };
 
+// In order of preference for the same q-value
+constexpr std::array kPrecompressedCodings{
+    http::ContentCoding::kZstd,
+    http::ContentCoding::kBrotli,
+    http::ContentCoding::kGzip,
+};
+
+// If-None-Match uses the weak comparison: W/"x" matches "x"
+bool IsETagMatched(std::string_view if_none_match, std::string_view etag) {
+  while (!if_none_match.empty()) {
+    const auto comma = if_none_match.find(',');
+    auto candidate = if_none_match.substr(0, comma);
+    if_none_match.remove_prefix(
+        comma == std::string_view::npos ? if_none_match.size() : comma + 1);
+
+    while (!candidate.empty() && candidate.front() == ' ') {
+      candidate.remove_prefix(1);
+    }
+    while (!candidate.empty() && candidate.back() == ' ') {
+      candidate.remove_suffix(1);
+    }
+    if (candidate == "*") return true;
+    if (candidate.substr(0, 2) == "W/") candidate.remove_prefix(2);
+    if (candidate == etag) return true;
+  }
+  return false;
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -44,7 +79,8 @@ HttpHandlerStatic::HttpHandlerStatic(
                    .FindComponent<components::FsCache>(
                        config["fs-cache-component"].As<std::string>(
                            "fs-cache-component"))
-                   .GetClient()) {}
+                   .GetClient()),
+      serve_precompressed_(config["serve-precompressed"].As<bool>(false)) {}
 
 std::string HttpHandlerStatic::HandleRequestThrow(
     const http::HttpRequest& request, request::RequestContext&) const {
@@ -52,14 +88,67 @@ std::string HttpHandlerStatic::HandleRequestThrow(
   const auto file = storage_.TryGetFile(request.GetRequestPath());
   if (file) {
     const auto config = config_.GetSnapshot();
-    request.GetHttpResponse().SetContentType(
-        config[kContentTypeMap][file->extension]);
-    return file->data;
+    auto& response = request.GetHttpResponse();
+    response.SetContentType(config[kContentTypeMap][file->extension]);
+
+    auto body = file;
+    if (serve_precompressed_) {
+      body = TryGetPrecompressedFile(request, response);
+      if (!body) body = file;
+    }
+
+    if (!body->etag.empty()) {
+      response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, body->etag);
+      if (IsETagMatched(request.GetHeader(
+                            USERVER_NAMESPACE::http::headers::kIfNoneMatch),
+                        body->etag)) {
+        response.SetStatus(http::HttpStatus::kNotModified);
+        return {};
+      }
+    }
+
+    // The file is shared with the cache, no need to copy it into the response
+    response.AppendBodySegment(body, body->GetContents());
+    return {};
   }
   request.GetResponse().SetStatusNotFound();
   return "File not found";
 }
 
+fs::FileInfoWithDataConstPtr HttpHandlerStatic::TryGetPrecompressedFile(
+    const http::HttpRequest& request, http::HttpResponse& response) const {
+  std::array<http::ContentCoding, kPrecompressedCodings.size()> available{};
+  std::array<fs::FileInfoWithDataConstPtr, kPrecompressedCodings.size()>
+      files;
+  std::size_t available_count = 0;
+
+  const auto& path = request.GetRequestPath();
+  for (const auto coding : kPrecompressedCodings) {
+    auto file = storage_.TryGetFile(
+        fmt::format("{}{}", path, http::GetFileExtension(coding)));
+    if (!file) continue;
+    available[available_count] = coding;
+    files[available_count] = std::move(file);
+    ++available_count;
+  }
+  if (available_count == 0) return {};
+
+  // The response differs by Accept-Encoding, even if it is not compressed
+  http::AddVaryAcceptEncoding(response);
+
+  const auto coding = http::NegotiateContentCoding(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding),
+      utils::span<const http::ContentCoding>{available.data(),
+                                             available_count});
+  for (std::size_t i = 0; i < available_count; ++i) {
+    if (available[i] == coding) {
+      response.SetContentEncoding(std::string{http::ToString(coding)});
+      return files[i];
+    }
+  }
+  return {};
+}
+
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
 type: object
@@ -72,6 +161,12 @@ properties:
         type: string
         description: Name of the FsCache component
         defaultDescription: fs-cache-component
+    serve-precompressed:
+        type: boolean
+        description: |
+            serve file.zst, file.br or file.gz from the cache instead of the
+            file if the client accepts the coding
+        defaultDescription: false
 )");
 }
 
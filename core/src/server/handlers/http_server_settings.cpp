@@ -33,6 +33,23 @@ const dynamic_config::Key<CcCustomStatus> kCcCustomStatus{
 const dynamic_config::Key<bool> kStreamApiEnabled{
     "USERVER_HANDLER_STREAM_API_ENABLED", false};
 
+ResponseCompression Parse(const formats::json::Value& value,
+                          formats::parse::To<ResponseCompression>) {
+  const ResponseCompression defaults;
+  return ResponseCompression{
+      value["enabled"].As<bool>(defaults.enabled),
+      value["min-size"].As<std::size_t>(defaults.min_size),
+      value["gzip-level"].As<int>(defaults.gzip_level),
+      value["zstd-level"].As<int>(defaults.zstd_level),
+      value["brotli-level"].As<int>(defaults.brotli_level),
+  };
+}
+
+const dynamic_config::Key<ResponseCompression> kResponseCompression{
+    "USERVER_HTTP_RESPONSE_COMPRESSION",
+    dynamic_config::DefaultAsJsonString{"{}"},
+};
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
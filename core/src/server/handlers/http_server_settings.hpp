@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -27,6 +28,19 @@ extern const dynamic_config::Key<CcCustomStatus> kCcCustomStatus;
 
 extern const dynamic_config::Key<bool> kStreamApiEnabled;
 
+struct ResponseCompression final {
+  bool enabled{false};
+  std::size_t min_size{1024};
+  int gzip_level{6};
+  int zstd_level{1};
+  int brotli_level{4};
+};
+
+ResponseCompression Parse(const formats::json::Value& value,
+                          formats::parse::To<ResponseCompression>);
+
+extern const dynamic_config::Key<ResponseCompression> kResponseCompression;
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/server/handlers/server_monitor.hpp>
 
+#include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/components/component.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/formats/json/serialize.hpp>
@@ -30,6 +31,28 @@ enum class impl::StatsFormat {
   kSolomon,
 };
 
+// Responses for different formats and filters, there are only a few of them
+class impl::RenderedMetricsCache final {
+ public:
+  explicit RenderedMetricsCache(std::chrono::milliseconds ttl)
+      : cache_(kWays, kWaySize) {
+    cache_.SetMaxLifetime(ttl);
+  }
+
+  using Value = std::shared_ptr<const std::string>;
+
+  template <typename RenderFunc>
+  Value Get(const std::string& key, RenderFunc render) {
+    return cache_.Get(key, render);
+  }
+
+ private:
+  static constexpr std::size_t kWays = 1;
+  static constexpr std::size_t kWaySize = 16;
+
+  cache::ExpirableLruCache<std::string, Value> cache_;
+};
+
 namespace {
 
 using impl::StatsFormat;
@@ -58,6 +81,61 @@ std::optional<StatsFormat> ParseFormat(std::string_view format) {
                   format, kToFormat.DescribeFirst())});
 }
 
+std::string_view GetContentType(StatsFormat format) {
+  switch (format) {
+    case StatsFormat::kJson:
+    case StatsFormat::kSolomon:
+    case StatsFormat::kInternal:
+      return "application/json";
+    case StatsFormat::kGraphite:
+    case StatsFormat::kPrometheus:
+    case StatsFormat::kPrometheusUntyped:
+    case StatsFormat::kPretty:
+      return "text/plain; charset=utf-8";
+  }
+
+  UINVARIANT(false, "Unexpected 'format' value");
+}
+
+std::string RenderMetrics(
+    const utils::statistics::Storage& storage,
+    const std::unordered_map<std::string, std::string>& common_labels,
+    StatsFormat format, const utils::statistics::Request& request) {
+  switch (format) {
+    case StatsFormat::kGraphite:
+      return utils::statistics::ToGraphiteFormat(storage, request);
+
+    case StatsFormat::kPrometheus:
+      return utils::statistics::ToPrometheusFormat(storage, request);
+
+    case StatsFormat::kPrometheusUntyped:
+      return utils::statistics::ToPrometheusFormatUntyped(storage, request);
+
+    case StatsFormat::kJson:
+      return utils::statistics::ToJsonFormat(storage, request);
+
+    case StatsFormat::kPretty:
+      return utils::statistics::ToPrettyFormat(storage, request);
+
+    case StatsFormat::kSolomon:
+      return utils::statistics::ToSolomonFormat(storage, common_labels,
+                                                request);
+
+    case StatsFormat::kInternal:
+      const auto json = storage.GetAsJson();
+      UASSERT(utils::statistics::AreAllMetricsNumbers(json));
+      return formats::json::ToString(json);
+  }
+
+  UINVARIANT(false, "Unexpected 'format' value");
+}
+
+std::unique_ptr<impl::RenderedMetricsCache> MakeRenderedMetricsCache(
+    std::chrono::milliseconds ttl) {
+  if (ttl <= std::chrono::milliseconds::zero()) return nullptr;
+  return std::make_unique<impl::RenderedMetricsCache>(ttl);
+}
+
 }  // namespace
 
 ServerMonitor::ServerMonitor(
@@ -68,7 +146,11 @@ ServerMonitor::ServerMonitor(
           component_context.FindComponent<components::StatisticsStorage>()
               .GetStorage()),
       common_labels_{config["common-labels"].As<CommonLabels>({})},
-      default_format_{ParseFormat(config["format"].As<std::string>({}))} {}
+      default_format_{ParseFormat(config["format"].As<std::string>({}))},
+      rendered_cache_{MakeRenderedMetricsCache(
+          config["cache-ttl"].As<std::chrono::milliseconds>(0))} {}
+
+ServerMonitor::~ServerMonitor() = default;
 
 std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
                                               request::RequestContext&) const {
@@ -107,42 +189,18 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
                     : Request::MakeWithPath(path, std::move(common_labels),
                                             std::move(labels)));
 
-  request.GetHttpResponse().SetContentType("text/plain; charset=utf-8");
-  switch (format) {
-    case StatsFormat::kGraphite:
-      return utils::statistics::ToGraphiteFormat(statistics_storage_,
-                                                 statistics_request);
-
-    case StatsFormat::kPrometheus:
-      return utils::statistics::ToPrometheusFormat(statistics_storage_,
-                                                   statistics_request);
-
-    case StatsFormat::kPrometheusUntyped:
-      return utils::statistics::ToPrometheusFormatUntyped(statistics_storage_,
-                                                          statistics_request);
-
-    case StatsFormat::kJson:
-      request.GetHttpResponse().SetContentType("application/json");
-      return utils::statistics::ToJsonFormat(statistics_storage_,
-                                             statistics_request);
-
-    case StatsFormat::kPretty:
-      return utils::statistics::ToPrettyFormat(statistics_storage_,
-                                               statistics_request);
-
-    case StatsFormat::kSolomon:
-      request.GetHttpResponse().SetContentType("application/json");
-      return utils::statistics::ToSolomonFormat(
-          statistics_storage_, common_labels_, statistics_request);
-
-    case StatsFormat::kInternal:
-      request.GetHttpResponse().SetContentType("application/json");
-      const auto json = statistics_storage_.GetAsJson();
-      UASSERT(utils::statistics::AreAllMetricsNumbers(json));
-      return formats::json::ToString(json);
+  request.GetHttpResponse().SetContentType(GetContentType(format));
+  if (!rendered_cache_) {
+    return RenderMetrics(statistics_storage_, common_labels_, format,
+                         statistics_request);
   }
 
-  UINVARIANT(false, "Unexpected 'format' value");
+  const auto key = fmt::format("{}\n{}\n{}\n{}", static_cast<int>(format),
+                               path, prefix, labels_json);
+  return *rendered_cache_->Get(key, [&](const std::string&) {
+    return std::make_shared<const std::string>(RenderMetrics(
+        statistics_storage_, common_labels_, format, statistics_request));
+  });
 }
 
 std::string ServerMonitor::GetResponseDataForLogging(const http::HttpRequest&,
@@ -165,6 +223,12 @@ properties:
             added to each metric.
         additionalProperties: true
         properties: {}
+    cache-ttl:
+        type: string
+        description: |
+            Reuse the rendered response for the requests with the same
+            arguments during this period, 0 disables the caching
+        defaultDescription: 0s
     format:
         type: string
         description: Default metrics format. Either static option or URL parameter has to be provided.
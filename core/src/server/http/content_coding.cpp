@@ -0,0 +1,148 @@
+#include <server/http/content_coding.hpp>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+constexpr double kNotListed = -1;
+
+std::string_view Trim(std::string_view str) {
+  constexpr std::string_view kSpaces = " \t";
+  const auto begin = str.find_first_not_of(kSpaces);
+  if (begin == std::string_view::npos) return {};
+  return str.substr(begin, str.find_last_not_of(kSpaces) - begin + 1);
+}
+
+// Parses "q=0.5" of the coding parameters, malformed values make the coding
+// unacceptable
+double ParseQuality(const std::vector<std::string_view>& params) {
+  for (const auto raw_param : params) {
+    const auto param = Trim(raw_param);
+    if (param.size() < 2 || (param[0] != 'q' && param[0] != 'Q') ||
+        param[1] != '=') {
+      continue;
+    }
+
+    const std::string value{Trim(param.substr(2))};
+    char* end = nullptr;
+    const auto quality = std::strtod(value.c_str(), &end);
+    if (value.empty() || end != value.c_str() + value.size() || quality < 0 ||
+        quality > 1) {
+      return 0;
+    }
+    return quality;
+  }
+  return 1;
+}
+
+bool IsCodingName(std::string_view name, ContentCoding coding) {
+  const utils::StrIcaseEqual equal;
+  if (equal(name, ToString(coding))) return true;
+  // RFC 9110, 8.4.1.3
+  return coding == ContentCoding::kGzip && equal(name, "x-gzip");
+}
+
+}  // namespace
+
+std::string_view ToString(ContentCoding coding) {
+  switch (coding) {
+    case ContentCoding::kIdentity:
+      return "identity";
+    case ContentCoding::kGzip:
+      return "gzip";
+    case ContentCoding::kZstd:
+      return "zstd";
+    case ContentCoding::kBrotli:
+      return "br";
+  }
+  UINVARIANT(false, "Unexpected content coding");
+}
+
+std::string_view GetFileExtension(ContentCoding coding) {
+  switch (coding) {
+    case ContentCoding::kIdentity:
+      return "";
+    case ContentCoding::kGzip:
+      return ".gz";
+    case ContentCoding::kZstd:
+      return ".zst";
+    case ContentCoding::kBrotli:
+      return ".br";
+  }
+  UINVARIANT(false, "Unexpected content coding");
+}
+
+ContentCoding NegotiateContentCoding(std::string_view accept_encoding,
+                                     utils::span<const ContentCoding> offered) {
+  struct AcceptedCoding final {
+    std::string_view name;
+    double quality;
+  };
+
+  std::vector<AcceptedCoding> accepted;
+  for (const auto item :
+       utils::text::SplitIntoStringViewVector(accept_encoding, ",")) {
+    auto params = utils::text::SplitIntoStringViewVector(item, ";");
+    if (params.empty() || Trim(params.front()).empty()) continue;
+    const auto name = Trim(params.front());
+    params.erase(params.begin());
+    accepted.push_back({name, ParseQuality(params)});
+  }
+
+  auto best = ContentCoding::kIdentity;
+  double best_quality = 0;
+  for (const auto coding : offered) {
+    double quality = kNotListed;
+    double any_quality = kNotListed;
+    for (const auto& item : accepted) {
+      if (IsCodingName(item.name, coding)) {
+        quality = item.quality;
+      } else if (item.name == "*") {
+        any_quality = item.quality;
+      }
+    }
+
+    if (quality == kNotListed) quality = any_quality;
+    if (quality > best_quality) {
+      best = coding;
+      best_quality = quality;
+    }
+  }
+  return best;
+}
+
+void AddVaryAcceptEncoding(HttpResponse& response) {
+  constexpr std::string_view kAcceptEncoding = "Accept-Encoding";
+
+  const auto& vary =
+      response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+  if (vary.empty()) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       std::string{kAcceptEncoding});
+    return;
+  }
+
+  const utils::StrIcaseEqual equal;
+  for (const auto item : utils::text::SplitIntoStringViewVector(vary, ",")) {
+    const auto name = Trim(item);
+    if (name == "*" || equal(name, kAcceptEncoding)) return;
+  }
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                     vary + ", " + std::string{kAcceptEncoding});
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
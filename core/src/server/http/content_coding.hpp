@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string_view>
+
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpResponse;
+
+/// Content codings of the response body supported by the server
+enum class ContentCoding {
+  kIdentity,
+  kGzip,
+  kZstd,
+  kBrotli,
+};
+
+/// Value of the Content-Encoding header for the coding
+std::string_view ToString(ContentCoding coding);
+
+/// Extension of a precompressed file, e.g. ".gz" for gzip
+std::string_view GetFileExtension(ContentCoding coding);
+
+/// Picks the coding with the highest q-value in the Accept-Encoding header
+/// among the `offered` ones, the ties go to the first offered coding.
+/// Returns ContentCoding::kIdentity if none of the offered codings are
+/// acceptable.
+ContentCoding NegotiateContentCoding(std::string_view accept_encoding,
+                                     utils::span<const ContentCoding> offered);
+
+/// Adds "Accept-Encoding" to the Vary header of the response
+void AddVaryAcceptEncoding(HttpResponse& response);
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include <server/http/content_coding.hpp>
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::ContentCoding;
+
+constexpr std::array kOffered{
+    ContentCoding::kZstd,
+    ContentCoding::kBrotli,
+    ContentCoding::kGzip,
+};
+
+ContentCoding Negotiate(std::string_view accept_encoding) {
+  return server::http::NegotiateContentCoding(accept_encoding, kOffered);
+}
+
+}  // namespace
+
+TEST(ContentCoding, Negotiate) {
+  EXPECT_EQ(Negotiate(""), ContentCoding::kIdentity);
+  EXPECT_EQ(Negotiate("identity"), ContentCoding::kIdentity);
+  EXPECT_EQ(Negotiate("deflate"), ContentCoding::kIdentity);
+
+  EXPECT_EQ(Negotiate("gzip"), ContentCoding::kGzip);
+  EXPECT_EQ(Negotiate("X-GZIP"), ContentCoding::kGzip);
+  EXPECT_EQ(Negotiate("gzip, deflate, br"), ContentCoding::kBrotli);
+  EXPECT_EQ(Negotiate("gzip, deflate, br, zstd"), ContentCoding::kZstd);
+  EXPECT_EQ(Negotiate(" gzip ;q=1 , br ; q=0.5"), ContentCoding::kGzip);
+  EXPECT_EQ(Negotiate("*"), ContentCoding::kZstd);
+  EXPECT_EQ(Negotiate("zstd;q=0, *;q=0.1"), ContentCoding::kBrotli);
+}
+
+TEST(ContentCoding, NegotiateRejected) {
+  EXPECT_EQ(Negotiate("gzip;q=0"), ContentCoding::kIdentity);
+  EXPECT_EQ(Negotiate("gzip;q=0.000"), ContentCoding::kIdentity);
+  EXPECT_EQ(Negotiate("*;q=0"), ContentCoding::kIdentity);
+  EXPECT_EQ(Negotiate("gzip;q=2"), ContentCoding::kIdentity);
+  EXPECT_EQ(Negotiate("gzip;q=abc, br;q=0.1"), ContentCoding::kBrotli);
+}
+
+TEST(ContentCoding, NegotiateOffered) {
+  constexpr std::array kGzipOnly{ContentCoding::kGzip};
+  EXPECT_EQ(server::http::NegotiateContentCoding("br, zstd", kGzipOnly),
+            ContentCoding::kIdentity);
+  EXPECT_EQ(server::http::NegotiateContentCoding("br, gzip;q=0.5", kGzipOnly),
+            ContentCoding::kGzip);
+  EXPECT_EQ(server::http::NegotiateContentCoding("gzip", {}),
+            ContentCoding::kIdentity);
+}
+
+TEST(ContentCoding, ToString) {
+  EXPECT_EQ(server::http::ToString(ContentCoding::kBrotli), "br");
+  EXPECT_EQ(server::http::GetFileExtension(ContentCoding::kZstd), ".zst");
+}
+
+USERVER_NAMESPACE_END
@@ -9,9 +9,8 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/overloaded.hpp>
 
-#include <server/http/fixed_path_index.hpp>
 #include <server/http/handler_methods.hpp>
-#include <server/http/wildcard_path_index.hpp>
+#include <server/http/path_index.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -36,21 +35,14 @@ class HandlerInfoIndex::HandlerInfoIndexImpl final {
 
  private:
   HandlerList handler_list_;
-  impl::FixedPathIndex fixed_path_index_;
-  impl::WildcardPathIndex wildcard_path_index_;
+  impl::PathIndex path_index_;
   FallbackHandlersStorage fallback_handlers_{};
 };
 
 void HandlerInfoIndex::HandlerInfoIndexImpl::AddHandler(
     const handlers::HttpHandlerBase& handler,
     engine::TaskProcessor& task_processor) {
-  const auto& path = std::get<std::string>(handler.GetConfig().path);
-  if (!impl::HasWildcardSpecificSymbols(path) &&
-      (path.empty() || path.back() != '*')) {
-    fixed_path_index_.AddHandler(handler, task_processor);
-  } else {
-    wildcard_path_index_.AddHandler(handler, task_processor);
-  }
+  path_index_.AddHandler(handler, task_processor);
   handler_list_.emplace_back(&handler);
 }
 
@@ -62,10 +54,7 @@ HandlerInfoIndex::HandlerInfoIndexImpl::GetHandlers() const {
 MatchRequestResult HandlerInfoIndex::HandlerInfoIndexImpl::MatchRequest(
     HttpMethod method, const std::string& path) const {
   MatchRequestResult match_result;
-  if (fixed_path_index_.MatchRequest(method, path, match_result))
-    return match_result;
-
-  wildcard_path_index_.MatchRequest(method, path, match_result);
+  path_index_.MatchRequest(method, path, match_result);
   return match_result;
 }
 
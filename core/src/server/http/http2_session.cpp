@@ -0,0 +1,686 @@
+#include "http2_session.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/server/request/request_base.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+#include <server/http/http_cached_date.hpp>
+#include <server/http/precomputed_headers.hpp>
+
+#include "http_request_impl.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+constexpr std::uint32_t kMaxConcurrentStreams = 100;
+constexpr std::size_t kMaxOutBufferSize = 64 * 1024;
+constexpr std::size_t kFrameHeaderSize = 9;
+
+constexpr std::string_view kDefaultContentType = "application/octet-stream";
+
+// RFC 9113 8.2.2: connection-specific header fields must not be sent
+bool IsConnectionSpecificHeader(std::string_view name) {
+  return utils::StrIcaseEqual{}(name, "connection") ||
+         utils::StrIcaseEqual{}(name, "keep-alive") ||
+         utils::StrIcaseEqual{}(name, "proxy-connection") ||
+         utils::StrIcaseEqual{}(name, "transfer-encoding") ||
+         utils::StrIcaseEqual{}(name, "upgrade");
+}
+
+bool IsBodyForbiddenForStatus(HttpStatus status) {
+  return status == HttpStatus::kNoContent ||
+         status == HttpStatus::kNotModified ||
+         (static_cast<int>(status) >= 100 && static_cast<int>(status) < 200);
+}
+
+std::string ToLowerAscii(std::string_view value) {
+  std::string result{value};
+  for (auto& c : result) {
+    if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+  }
+  return result;
+}
+
+nghttp2_nv MakeNv(std::string_view name, std::string_view value) {
+  // nghttp2 copies the data in nghttp2_submit_response()
+  return {reinterpret_cast<std::uint8_t*>(const_cast<char*>(name.data())),
+          reinterpret_cast<std::uint8_t*>(const_cast<char*>(value.data())),
+          name.size(), value.size(), NGHTTP2_NV_FLAG_NONE};
+}
+
+}  // namespace
+
+struct Http2Session::Stream final {
+  Stream(const HttpRequestConstructor::Config& config,
+         const HandlerInfoIndex& handler_info_index,
+         request::ResponseDataAccounter& data_accounter,
+         HttpRequestPool& request_pool, net::ParserStats& stats)
+      : constructor(config, handler_info_index, data_accounter, buffers,
+                    &request_pool),
+        stats(stats) {
+    stats.parsing_request_count.Add(1);
+  }
+
+  ~Stream() { stats.parsing_request_count.Subtract(1); }
+
+  // nghttp2 passes the whole headers, the buffers are not reused
+  RequestBuffers buffers;
+  HttpRequestConstructor constructor;
+  net::ParserStats& stats;
+  std::string authority;
+  bool url_complete{false};
+  bool headers_complete{false};
+  // The rest of the request is skipped, the constructor knows the error
+  bool failed{false};
+};
+
+struct Http2Session::ResponseSource final {
+  ResponseSource(std::int32_t stream_id,
+                 std::shared_ptr<request::RequestBase> request)
+      : stream_id(stream_id), request(std::move(request)) {}
+
+  HttpResponse& GetResponse() const {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    return static_cast<HttpResponse&>(request->GetResponse());
+  }
+
+  const std::int32_t stream_id;
+  const std::shared_ptr<request::RequestBase> request;
+  bool is_submitted{false};
+  // The peer has reset the stream before the response was submitted
+  bool is_closed{false};
+  // END_STREAM has been sent
+  bool is_sent{false};
+  std::size_t bytes_sent{0};
+
+  bool is_body_streamed{false};
+  // The data provider waits for AppendResponseBody()
+  bool awaits_body_chunks{false};
+  bool is_body_complete{false};
+  // A streamed body keeps the unsent part of the chunks at the end
+  std::string body_part{};
+  std::string_view body{};
+  std::vector<std::string_view> body_segments{};
+  std::size_t next_body_segment{0};
+};
+
+bool Http2Session::IsConnectionPreface(std::string_view data) noexcept {
+  if (data.empty()) return false;
+  const auto size = std::min(data.size(), kConnectionPreface.size());
+  return data.substr(0, size) == kConnectionPreface.substr(0, size);
+}
+
+Http2Session::Http2Session(const HandlerInfoIndex& handler_info_index,
+                           const request::HttpRequestConfig& request_config,
+                           OnNewRequestCb&& on_new_request_cb,
+                           OnResponseEventCb&& on_response_event_cb,
+                           net::ParserStats& stats,
+                           request::ResponseDataAccounter& data_accounter,
+                           engine::io::RwBase& socket)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      on_response_event_cb_(std::move(on_response_event_cb)),
+      stats_(stats),
+      data_accounter_(data_accounter),
+      socket_(socket),
+      request_pool_(std::make_shared<HttpRequestPool>()),
+      session_(nullptr, &nghttp2_session_del) {
+  nghttp2_session* session = nullptr;
+  const auto create_result =
+      nghttp2_session_server_new(&session, &GetCallbacks(), this);
+  if (create_result != 0) {
+    throw std::runtime_error(fmt::format("nghttp2_session_server_new failed: {}",
+                                         nghttp2_strerror(create_result)));
+  }
+  session_.reset(session);
+
+  const std::array<nghttp2_settings_entry, 1> settings{
+      {{NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, kMaxConcurrentStreams}}};
+  const auto settings_result = nghttp2_submit_settings(
+      session_.get(), NGHTTP2_FLAG_NONE, settings.data(), settings.size());
+  if (settings_result != 0) {
+    throw std::runtime_error(fmt::format("nghttp2_submit_settings failed: {}",
+                                         nghttp2_strerror(settings_result)));
+  }
+}
+
+Http2Session::~Http2Session() = default;
+
+bool Http2Session::Parse(const char* data, size_t size) {
+  const auto result = nghttp2_session_mem_recv(
+      session_.get(), reinterpret_cast<const std::uint8_t*>(data), size);
+  if (result < 0) {
+    LOG_WARNING() << "HTTP/2 session error: "
+                  << nghttp2_strerror(static_cast<int>(result));
+    Flush();
+    return false;
+  }
+  Flush();
+  return nghttp2_session_want_read(session_.get()) != 0;
+}
+
+void Http2Session::SendResponse(request::RequestBase& request) {
+  auto* source = FindResponse(request);
+  UINVARIANT(source, "The request was not received by this HTTP/2 session");
+  UASSERT(!source->is_submitted);
+  source->is_submitted = true;
+
+  if (source->is_closed) {
+    finished_responses_.push_back(source);
+  } else {
+    try {
+      SubmitResponse(*source);
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to submit HTTP/2 response: " << ex;
+      // The response is reported as failed once the stream is closed
+      nghttp2_submit_rst_stream(session_.get(), NGHTTP2_FLAG_NONE,
+                                source->stream_id, NGHTTP2_INTERNAL_ERROR);
+    }
+  }
+  Flush();
+}
+
+void Http2Session::AppendResponseBody(const request::RequestBase& request,
+                                      std::string_view chunk) {
+  auto* source = FindResponse(request);
+  // The stream could have been reset already
+  if (!source) return;
+
+  if (!source->awaits_body_chunks) {
+    // E.g. the response to a HEAD request, the body is dropped
+    ReportResponseEvent(*source, ResponseEvent::kBodyWanted);
+    return;
+  }
+
+  auto& part = source->body_part;
+  part.erase(0, part.size() - source->body.size());
+  part.append(chunk);
+  source->body = part;
+  if (source->body.empty()) {
+    ReportResponseEvent(*source, ResponseEvent::kBodyWanted);
+    return;
+  }
+  nghttp2_session_resume_data(session_.get(), source->stream_id);
+  Flush();
+}
+
+void Http2Session::FinishResponseBody(const request::RequestBase& request) {
+  auto* source = FindResponse(request);
+  if (!source || !source->awaits_body_chunks) return;
+
+  source->is_body_complete = true;
+  nghttp2_session_resume_data(session_.get(), source->stream_id);
+  Flush();
+}
+
+bool Http2Session::PopResponseBody(request::RequestBase& request,
+                                   std::string& chunk) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+  auto& response = static_cast<HttpResponse&>(request.GetResponse());
+  return response.body_stream_ && response.body_stream_->Pop(chunk);
+}
+
+int Http2Session::OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame,
+                                 void* user_data) {
+  auto* http2_session = static_cast<Http2Session*>(user_data);
+  UASSERT(http2_session != nullptr);
+  return http2_session->OnBeginHeadersImpl(*frame);
+}
+
+int Http2Session::OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                           const std::uint8_t* name, size_t namelen,
+                           const std::uint8_t* value, size_t valuelen,
+                           std::uint8_t, void* user_data) {
+  auto* http2_session = static_cast<Http2Session*>(user_data);
+  UASSERT(http2_session != nullptr);
+  return http2_session->OnHeaderImpl(
+      *frame, {reinterpret_cast<const char*>(name), namelen},
+      {reinterpret_cast<const char*>(value), valuelen});
+}
+
+int Http2Session::OnDataChunkRecv(nghttp2_session*, std::uint8_t,
+                                  std::int32_t stream_id,
+                                  const std::uint8_t* data, size_t len,
+                                  void* user_data) {
+  auto* http2_session = static_cast<Http2Session*>(user_data);
+  UASSERT(http2_session != nullptr);
+  return http2_session->OnDataChunkRecvImpl(
+      stream_id, {reinterpret_cast<const char*>(data), len});
+}
+
+int Http2Session::OnFrameRecv(nghttp2_session*, const nghttp2_frame* frame,
+                              void* user_data) {
+  auto* http2_session = static_cast<Http2Session*>(user_data);
+  UASSERT(http2_session != nullptr);
+  return http2_session->OnFrameRecvImpl(*frame);
+}
+
+int Http2Session::OnFrameSend(nghttp2_session*, const nghttp2_frame* frame,
+                              void* user_data) {
+  auto* http2_session = static_cast<Http2Session*>(user_data);
+  UASSERT(http2_session != nullptr);
+  return http2_session->OnFrameSendImpl(*frame);
+}
+
+int Http2Session::OnFrameNotSend(nghttp2_session*, const nghttp2_frame* frame,
+                                 int lib_error_code, void* user_data) {
+  auto* http2_session = static_cast<Http2Session*>(user_data);
+  UASSERT(http2_session != nullptr);
+  LOG_DEBUG() << "HTTP/2 frame for stream " << frame->hd.stream_id
+              << " was not sent: " << nghttp2_strerror(lib_error_code);
+  // nghttp2 closes the stream if it can not be used anymore
+  return 0;
+}
+
+int Http2Session::OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                                std::uint32_t, void* user_data) {
+  auto* http2_session = static_cast<Http2Session*>(user_data);
+  UASSERT(http2_session != nullptr);
+  return http2_session->OnStreamCloseImpl(stream_id);
+}
+
+ssize_t Http2Session::ReadResponseBody(nghttp2_session*, std::int32_t,
+                                       std::uint8_t* buf, size_t length,
+                                       std::uint32_t* data_flags,
+                                       nghttp2_data_source* source,
+                                       void* user_data) {
+  auto* http2_session = static_cast<Http2Session*>(user_data);
+  UASSERT(http2_session != nullptr);
+  UASSERT(source != nullptr && source->ptr != nullptr);
+  return http2_session->ReadResponseBodyImpl(
+      *static_cast<ResponseSource*>(source->ptr), buf, length, *data_flags);
+}
+
+int Http2Session::OnBeginHeadersImpl(const nghttp2_frame& frame) {
+  if (frame.hd.type != NGHTTP2_HEADERS ||
+      frame.headers.cat != NGHTTP2_HCAT_REQUEST) {
+    return 0;
+  }
+
+  LOG_TRACE() << "HTTP/2 stream " << frame.hd.stream_id << " begin";
+  streams_.insert_or_assign(
+      frame.hd.stream_id,
+      std::make_unique<Stream>(request_constructor_config_, handler_info_index_,
+                               data_accounter_, *request_pool_, stats_));
+  return 0;
+}
+
+int Http2Session::OnHeaderImpl(const nghttp2_frame& frame,
+                               std::string_view name, std::string_view value) {
+  if (frame.hd.type != NGHTTP2_HEADERS ||
+      frame.headers.cat != NGHTTP2_HCAT_REQUEST) {
+    // Trailers are ignored, just like in HttpRequestParser
+    return 0;
+  }
+  auto* stream = FindStream(frame.hd.stream_id);
+  if (!stream || stream->failed) return 0;
+
+  LOG_TRACE() << "HTTP/2 stream " << frame.hd.stream_id << " header: '"
+              << name << "': '" << value << '\'';
+  auto& constructor = stream->constructor;
+  try {
+    // nghttp2 guarantees that pseudo-headers come first
+    if (name == ":method") {
+      constructor.SetMethod(HttpMethodFromString(value));
+    } else if (name == ":path") {
+      constructor.AppendUrl(value.data(), value.size());
+    } else if (name == ":authority") {
+      stream->authority = value;
+    } else if (!name.empty() && name.front() == ':') {
+      // :scheme and :protocol are not used
+    } else {
+      if (!CheckUrlComplete(*stream)) return 0;
+      constructor.AppendHeaderField(name.data(), name.size());
+      constructor.AppendHeaderValue(value.data(), value.size());
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append HTTP/2 header: " << ex;
+    stream->failed = true;
+  }
+  return 0;
+}
+
+int Http2Session::OnDataChunkRecvImpl(std::int32_t stream_id,
+                                      std::string_view data) {
+  auto* stream = FindStream(stream_id);
+  if (!stream || stream->failed) return 0;
+
+  try {
+    stream->constructor.AppendBody(data.data(), data.size());
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append HTTP/2 body: " << ex;
+    stream->failed = true;
+  }
+  return 0;
+}
+
+int Http2Session::OnFrameRecvImpl(const nghttp2_frame& frame) {
+  if (frame.hd.type != NGHTTP2_HEADERS && frame.hd.type != NGHTTP2_DATA) {
+    return 0;
+  }
+  auto* stream = FindStream(frame.hd.stream_id);
+  if (!stream) return 0;
+
+  if (frame.hd.type == NGHTTP2_HEADERS &&
+      (frame.hd.flags & NGHTTP2_FLAG_END_HEADERS) &&
+      !stream->headers_complete) {
+    stream->headers_complete = true;
+    if (!stream->failed && CheckUrlComplete(*stream)) {
+      try {
+        stream->constructor.AppendHeaderField("", 0);
+      } catch (const std::exception& ex) {
+        LOG_WARNING() << "can't append HTTP/2 header: " << ex;
+        stream->failed = true;
+      }
+    }
+  }
+
+  if (frame.hd.flags & NGHTTP2_FLAG_END_STREAM) {
+    if (!FinalizeRequest(frame.hd.stream_id)) {
+      return NGHTTP2_ERR_CALLBACK_FAILURE;
+    }
+  }
+  return 0;
+}
+
+int Http2Session::OnFrameSendImpl(const nghttp2_frame& frame) {
+  if (frame.hd.type != NGHTTP2_HEADERS && frame.hd.type != NGHTTP2_DATA) {
+    return 0;
+  }
+  auto* source = FindResponse(frame.hd.stream_id);
+  if (!source) return 0;
+
+  source->bytes_sent += kFrameHeaderSize + frame.hd.length;
+  if (frame.hd.flags & NGHTTP2_FLAG_END_STREAM) source->is_sent = true;
+  return 0;
+}
+
+int Http2Session::OnStreamCloseImpl(std::int32_t stream_id) {
+  // The peer could have reset the stream before sending the whole request
+  streams_.erase(stream_id);
+
+  auto* source = FindResponse(stream_id);
+  if (!source) return 0;
+
+  if (source->is_submitted) {
+    finished_responses_.push_back(source);
+  } else {
+    // The handler is still running, SendResponse() reports the failure
+    source->is_closed = true;
+    ReportResponseEvent(*source, ResponseEvent::kCancelled);
+  }
+  return 0;
+}
+
+ssize_t Http2Session::ReadResponseBodyImpl(ResponseSource& source,
+                                           std::uint8_t* buf, size_t length,
+                                           std::uint32_t& data_flags) {
+  if (source.is_body_streamed && source.body.empty()) {
+    if (source.is_body_complete) {
+      data_flags |= NGHTTP2_DATA_FLAG_EOF;
+      return 0;
+    }
+    // Resumed by AppendResponseBody() or FinishResponseBody()
+    ReportResponseEvent(source, ResponseEvent::kBodyWanted);
+    return NGHTTP2_ERR_DEFERRED;
+  }
+
+  auto& segments = source.body_segments;
+  while (source.body.empty() && source.next_body_segment < segments.size()) {
+    source.body = segments[source.next_body_segment++];
+  }
+
+  const auto size = std::min(length, source.body.size());
+  std::memcpy(buf, source.body.data(), size);
+  source.body.remove_prefix(size);
+  if (!source.is_body_streamed && source.body.empty() &&
+      source.next_body_segment == segments.size()) {
+    data_flags |= NGHTTP2_DATA_FLAG_EOF;
+  }
+  return static_cast<ssize_t>(size);
+}
+
+Http2Session::Stream* Http2Session::FindStream(std::int32_t stream_id) {
+  const auto it = streams_.find(stream_id);
+  return it == streams_.end() ? nullptr : it->second.get();
+}
+
+Http2Session::ResponseSource* Http2Session::FindResponse(
+    std::int32_t stream_id) {
+  return static_cast<ResponseSource*>(
+      nghttp2_session_get_stream_user_data(session_.get(), stream_id));
+}
+
+Http2Session::ResponseSource* Http2Session::FindResponse(
+    const request::RequestBase& request) {
+  const auto it = responses_.find(&request);
+  return it == responses_.end() ? nullptr : it->second.get();
+}
+
+bool Http2Session::CheckUrlComplete(Stream& stream) {
+  if (stream.url_complete) return true;
+  stream.url_complete = true;
+
+  auto& constructor = stream.constructor;
+  constructor.SetHttpMajor(2);
+  constructor.SetHttpMinor(0);
+  try {
+    constructor.ParseUrl();
+    if (!stream.authority.empty()) {
+      const std::string_view kHost = USERVER_NAMESPACE::http::headers::kHost;
+      constructor.AppendHeaderField(kHost.data(), kHost.size());
+      constructor.AppendHeaderValue(stream.authority.data(),
+                                    stream.authority.size());
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't parse HTTP/2 url: " << ex;
+    stream.failed = true;
+    return false;
+  }
+  return true;
+}
+
+bool Http2Session::FinalizeRequest(std::int32_t stream_id) {
+  const auto it = streams_.find(stream_id);
+  if (it == streams_.end()) return true;
+  const auto stream = std::move(it->second);
+  streams_.erase(it);
+
+  if (!stream->failed) CheckUrlComplete(*stream);
+
+  auto request = stream->constructor.Finalize();
+  if (!request) {
+    LOG_ERROR() << "request is null after Finalize()";
+    return false;
+  }
+  auto source = std::make_unique<ResponseSource>(stream_id, request);
+  // The stream exists, we are in its frame callback
+  nghttp2_session_set_stream_user_data(session_.get(), stream_id,
+                                       source.get());
+  responses_.emplace(request.get(), std::move(source));
+  on_new_request_cb_(std::move(request));
+  return true;
+}
+
+void Http2Session::SubmitResponse(ResponseSource& source) {
+  auto& response = source.GetResponse();
+  const auto status = std::to_string(static_cast<int>(response.status_));
+
+  response.headers_.erase(USERVER_NAMESPACE::http::headers::kContentLength);
+
+  const bool is_body_forbidden = IsBodyForbiddenForStatus(response.status_);
+  const bool is_head_request =
+      response.request_.GetMethod() == HttpMethod::kHead;
+  source.is_body_streamed = response.IsBodyStreamed() &&
+                            response.GetData().empty() &&
+                            response.body_segments_.empty();
+  const auto body_size = response.GetBodySize();
+  if (!source.is_body_streamed) {
+    source.body = response.GetData();
+    source.body_segments.reserve(response.body_segments_.size());
+    for (const auto& segment : response.body_segments_) {
+      source.body_segments.push_back(segment.data);
+    }
+  }
+
+  // Names and values must outlive nghttp2_submit_response()
+  std::vector<std::string> storage;
+  storage.reserve(response.headers_.size() + response.cookies_.size() + 1);
+  std::vector<nghttp2_nv> headers;
+  headers.reserve(response.headers_.size() + response.cookies_.size() + 4);
+
+  headers.push_back(MakeNv(":status", status));
+  if (!response.headers_.count(USERVER_NAMESPACE::http::headers::kDate)) {
+    // impl::GetCachedDate() must not cross thread boundaries
+    headers.push_back(MakeNv("date", impl::GetCachedDate()));
+  }
+  if (!response.headers_.count(
+          USERVER_NAMESPACE::http::headers::kContentType)) {
+    headers.push_back(MakeNv("content-type", kDefaultContentType));
+  }
+  if (response.precomputed_headers_) {
+    response.precomputed_headers_->ForEachMissing(
+        response.headers_, [&headers](std::string_view name,
+                                      std::string_view value) {
+          headers.push_back(MakeNv(name, value));
+        });
+  }
+  for (const auto& [name, value] : response.headers_) {
+    if (IsConnectionSpecificHeader(name)) continue;
+    // RFC 9113 8.2: field names must be lowercase
+    headers.push_back(MakeNv(storage.emplace_back(ToLowerAscii(name)),
+                             value));
+  }
+  for (const auto& cookie : response.cookies_) {
+    headers.push_back(
+        MakeNv("set-cookie", storage.emplace_back(cookie.second.ToString())));
+  }
+  if (!is_body_forbidden && !source.is_body_streamed) {
+    headers.push_back(MakeNv(
+        "content-length",
+        storage.emplace_back(fmt::format(FMT_COMPILE("{}"),
+                                         body_size))));
+  }
+
+  if (is_body_forbidden && body_size != 0) {
+    LOG_LIMITED_WARNING()
+        << "Non-empty body provided for response with HTTP code "
+        << static_cast<int>(response.status_)
+        << " which does not allow one, it will be dropped";
+  }
+
+  const bool has_body = !is_body_forbidden && !is_head_request &&
+                        (source.is_body_streamed || body_size != 0);
+  source.awaits_body_chunks = has_body && source.is_body_streamed;
+  nghttp2_data_provider data_provider{};
+  data_provider.source.ptr = &source;
+  data_provider.read_callback = &Http2Session::ReadResponseBody;
+
+  const auto result = nghttp2_submit_response(
+      session_.get(), source.stream_id, headers.data(), headers.size(),
+      has_body ? &data_provider : nullptr);
+  if (result != 0) {
+    source.awaits_body_chunks = false;
+    throw std::runtime_error(fmt::format("nghttp2_submit_response failed: {}",
+                                         nghttp2_strerror(result)));
+  }
+}
+
+void Http2Session::ReportResponseEvent(const ResponseSource& source,
+                                       ResponseEvent event) {
+  if (on_response_event_cb_) on_response_event_cb_(*source.request, event);
+}
+
+void Http2Session::ReportFinishedResponses() {
+  for (auto* finished : std::exchange(finished_responses_, {})) {
+    const auto it = responses_.find(finished->request.get());
+    UASSERT(it != responses_.end());
+    const auto source = std::move(it->second);
+    responses_.erase(it);
+
+    auto& response = source->GetResponse();
+    const auto now = std::chrono::steady_clock::now();
+    if (source->is_sent) {
+      response.SetSent(source->bytes_sent, now);
+      ReportResponseEvent(*source, ResponseEvent::kSent);
+    } else {
+      response.SetSendFailed(now);
+      ReportResponseEvent(*source, ResponseEvent::kFailed);
+    }
+  }
+}
+
+void Http2Session::Flush() {
+  while (true) {
+    const std::uint8_t* data = nullptr;
+    const auto size = nghttp2_session_mem_send(session_.get(), &data);
+    if (size < 0) {
+      throw std::runtime_error(
+          fmt::format("nghttp2_session_mem_send failed: {}",
+                      nghttp2_strerror(static_cast<int>(size))));
+    }
+    if (size == 0) break;
+
+    out_buffer_.append(reinterpret_cast<const char*>(data),
+                       static_cast<std::size_t>(size));
+    if (out_buffer_.size() >= kMaxOutBufferSize) WriteOutBuffer();
+  }
+  WriteOutBuffer();
+  ReportFinishedResponses();
+}
+
+void Http2Session::WriteOutBuffer() {
+  if (out_buffer_.empty()) return;
+  socket_.WriteAll(out_buffer_.data(), out_buffer_.size(), {});
+  out_buffer_.clear();
+}
+
+const nghttp2_session_callbacks& Http2Session::GetCallbacks() {
+  static const auto callbacks = [] {
+    nghttp2_session_callbacks* result = nullptr;
+    if (nghttp2_session_callbacks_new(&result) != 0) {
+      throw std::bad_alloc();
+    }
+    nghttp2_session_callbacks_set_on_begin_headers_callback(
+        result, &Http2Session::OnBeginHeaders);
+    nghttp2_session_callbacks_set_on_header_callback(result,
+                                                     &Http2Session::OnHeader);
+    nghttp2_session_callbacks_set_on_data_chunk_recv_callback(
+        result, &Http2Session::OnDataChunkRecv);
+    nghttp2_session_callbacks_set_on_frame_recv_callback(
+        result, &Http2Session::OnFrameRecv);
+    nghttp2_session_callbacks_set_on_frame_send_callback(
+        result, &Http2Session::OnFrameSend);
+    nghttp2_session_callbacks_set_on_frame_not_send_callback(
+        result, &Http2Session::OnFrameNotSend);
+    nghttp2_session_callbacks_set_on_stream_close_callback(
+        result, &Http2Session::OnStreamClose);
+    return std::unique_ptr<nghttp2_session_callbacks,
+                           void (*)(nghttp2_session_callbacks*)>(
+        result, &nghttp2_session_callbacks_del);
+  }();
+  return *callbacks;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <nghttp2/nghttp2.h>
+
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/engine/io/common.hpp>
+#include <userver/server/request/request_config.hpp>
+
+#include "http_request_constructor.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpResponse;
+
+/// HTTP/2 server side of a single connection (h2c with prior knowledge).
+///
+/// Parses incoming frames into requests, one request per stream, and
+/// serializes responses into the streams the requests came from. Responses
+/// respect the stream and connection flow control windows of the peer and
+/// are written in any order, so a slow handler does not hold up the other
+/// streams.
+///
+/// Not thread safe, all the methods except PopResponseBody() must be called
+/// from the same task.
+class Http2Session final : public request::RequestParser {
+ public:
+  /// What has happened to the response of a request
+  enum class ResponseEvent {
+    /// The streamed body chunks passed so far are consumed
+    kBodyWanted,
+    /// The peer has reset the stream before the response was submitted
+    kCancelled,
+    /// The response is sent completely
+    kSent,
+    /// The response is not sent, e.g. the stream was reset
+    kFailed,
+  };
+
+  using OnNewRequestCb =
+      std::function<void(std::shared_ptr<request::RequestBase>&&)>;
+  using OnResponseEventCb =
+      std::function<void(const request::RequestBase&, ResponseEvent)>;
+
+  static constexpr std::string_view kConnectionPreface =
+      "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+
+  /// Returns true if the first bytes received from a connection look like
+  /// the beginning of the HTTP/2 connection preface.
+  static bool IsConnectionPreface(std::string_view data) noexcept;
+
+  Http2Session(const HandlerInfoIndex& handler_info_index,
+               const request::HttpRequestConfig& request_config,
+               OnNewRequestCb&& on_new_request_cb,
+               OnResponseEventCb&& on_response_event_cb,
+               net::ParserStats& stats,
+               request::ResponseDataAccounter& data_accounter,
+               engine::io::RwBase& socket);
+
+  ~Http2Session() override;
+
+  Http2Session(Http2Session&&) = delete;
+  Http2Session& operator=(Http2Session&&) = delete;
+
+  /// Consumes the received data. Frames that nghttp2 sends in reply
+  /// (SETTINGS ACK, PING ACK, WINDOW_UPDATE, GOAWAY...) are written into the
+  /// socket right away.
+  bool Parse(const char* data, size_t size) override;
+
+  /// Submits the response of a request created by this session and writes
+  /// as much of it as the peer flow control windows allow. The rest goes out
+  /// from the following calls once the peer opens the windows. The end of the
+  /// response is reported to OnResponseEventCb.
+  void SendResponse(request::RequestBase& request);
+
+  /// Passes the next chunk of a streamed response body. The chunk after it is
+  /// expected once ResponseEvent::kBodyWanted is reported.
+  void AppendResponseBody(const request::RequestBase& request,
+                          std::string_view chunk);
+
+  /// Marks the end of a streamed response body
+  void FinishResponseBody(const request::RequestBase& request);
+
+  /// Pops the next chunk of a streamed response body, returns false once the
+  /// body is over or the current task is cancelled. Does not touch the
+  /// session and may be called from the task that forwards the chunks.
+  static bool PopResponseBody(request::RequestBase& request,
+                              std::string& chunk);
+
+ private:
+  struct Stream;
+  struct ResponseSource;
+
+  static int OnBeginHeaders(nghttp2_session* session,
+                            const nghttp2_frame* frame, void* user_data);
+  static int OnHeader(nghttp2_session* session, const nghttp2_frame* frame,
+                      const std::uint8_t* name, size_t namelen,
+                      const std::uint8_t* value, size_t valuelen,
+                      std::uint8_t flags, void* user_data);
+  static int OnDataChunkRecv(nghttp2_session* session, std::uint8_t flags,
+                             std::int32_t stream_id, const std::uint8_t* data,
+                             size_t len, void* user_data);
+  static int OnFrameRecv(nghttp2_session* session, const nghttp2_frame* frame,
+                         void* user_data);
+  static int OnFrameSend(nghttp2_session* session, const nghttp2_frame* frame,
+                         void* user_data);
+  static int OnFrameNotSend(nghttp2_session* session,
+                            const nghttp2_frame* frame, int lib_error_code,
+                            void* user_data);
+  static int OnStreamClose(nghttp2_session* session, std::int32_t stream_id,
+                           std::uint32_t error_code, void* user_data);
+  static ssize_t ReadResponseBody(nghttp2_session* session,
+                                  std::int32_t stream_id, std::uint8_t* buf,
+                                  size_t length, std::uint32_t* data_flags,
+                                  nghttp2_data_source* source, void* user_data);
+
+  int OnBeginHeadersImpl(const nghttp2_frame& frame);
+  int OnHeaderImpl(const nghttp2_frame& frame, std::string_view name,
+                   std::string_view value);
+  int OnDataChunkRecvImpl(std::int32_t stream_id, std::string_view data);
+  int OnFrameRecvImpl(const nghttp2_frame& frame);
+  int OnFrameSendImpl(const nghttp2_frame& frame);
+  int OnStreamCloseImpl(std::int32_t stream_id);
+  ssize_t ReadResponseBodyImpl(ResponseSource& source, std::uint8_t* buf,
+                               size_t length, std::uint32_t& data_flags);
+
+  Stream* FindStream(std::int32_t stream_id);
+  ResponseSource* FindResponse(std::int32_t stream_id);
+  ResponseSource* FindResponse(const request::RequestBase& request);
+  bool CheckUrlComplete(Stream& stream);
+  bool FinalizeRequest(std::int32_t stream_id);
+
+  void SubmitResponse(ResponseSource& source);
+  void ReportResponseEvent(const ResponseSource& source, ResponseEvent event);
+  void ReportFinishedResponses();
+  void Flush();
+  void WriteOutBuffer();
+
+  static const nghttp2_session_callbacks& GetCallbacks();
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+  OnNewRequestCb on_new_request_cb_;
+  OnResponseEventCb on_response_event_cb_;
+  net::ParserStats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+  engine::io::RwBase& socket_;
+  const std::shared_ptr<HttpRequestPool> request_pool_;
+
+  std::unique_ptr<nghttp2_session, void (*)(nghttp2_session*)> session_;
+
+  // Streams with requests that are not received completely yet
+  std::unordered_map<std::int32_t, std::unique_ptr<Stream>> streams_;
+  // Responses of the received requests, from the end of a request until its
+  // stream is closed. nghttp2 keeps pointers to them as the stream user data.
+  std::unordered_map<const request::RequestBase*,
+                     std::unique_ptr<ResponseSource>>
+      responses_;
+  // Closed streams to report once the frames are processed
+  std::vector<ResponseSource*> finished_responses_;
+
+  std::string out_buffer_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,335 @@
+#include <server/http/http2_session.hpp>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <nghttp2/nghttp2.h>
+
+#include <server/http/http_request_impl.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using ResponseEvent = server::http::Http2Session::ResponseEvent;
+using RequestPtr = std::shared_ptr<server::request::RequestBase>;
+
+server::http::Http2Session CreateTestSession(
+    server::http::Http2Session::OnNewRequestCb&& cb,
+    server::http::Http2Session::OnResponseEventCb&& response_cb,
+    engine::io::RwBase& socket) {
+  static const server::http::HandlerInfoIndex kTestHandlerInfoIndex;
+  static constexpr server::request::HttpRequestConfig kTestRequestConfig{
+      /*.max_url_size = */ 8192,
+      /*.max_request_size = */ 1024 * 1024,
+      /*.max_headers_size = */ 65536,
+      /*.parse_args_from_body = */ false,
+      /*.testing_mode = */ true,  // non default value
+      /*.decompress_request = */ false,
+  };
+  static server::net::ParserStats test_stats;
+  static server::request::ResponseDataAccounter test_accounter;
+  return server::http::Http2Session(kTestHandlerInfoIndex, kTestRequestConfig,
+                                    std::move(cb), std::move(response_cb),
+                                    test_stats, test_accounter, socket);
+}
+
+nghttp2_nv MakeNv(std::string_view name, std::string_view value) {
+  return {reinterpret_cast<std::uint8_t*>(const_cast<char*>(name.data())),
+          reinterpret_cast<std::uint8_t*>(const_cast<char*>(value.data())),
+          name.size(), value.size(), NGHTTP2_NV_FLAG_NONE};
+}
+
+server::http::HttpResponse& Respond(server::request::RequestBase& request,
+                                    std::string data) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+  auto& response = static_cast<server::http::HttpResponse&>(
+      request.GetResponse());
+  response.SetData(std::move(data));
+  response.SetReady();
+  return response;
+}
+
+// Minimal nghttp2-based client
+class TestClient final {
+ public:
+  struct Response {
+    std::string status;
+    std::string body;
+    std::vector<std::string> header_names;
+    bool is_closed{false};
+  };
+
+  TestClient() {
+    nghttp2_session_callbacks* callbacks = nullptr;
+    nghttp2_session_callbacks_new(&callbacks);
+    nghttp2_session_callbacks_set_on_header_callback(callbacks, &OnHeader);
+    nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks,
+                                                              &OnData);
+    nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks,
+                                                         &OnFrameRecv);
+    nghttp2_session_callbacks_set_on_stream_close_callback(callbacks,
+                                                           &OnStreamClose);
+    nghttp2_session_client_new(&session_, callbacks, this);
+    nghttp2_session_callbacks_del(callbacks);
+    nghttp2_submit_settings(session_, NGHTTP2_FLAG_NONE, nullptr, 0);
+  }
+
+  ~TestClient() { nghttp2_session_del(session_); }
+
+  std::int32_t SubmitGet(std::string_view path) {
+    const std::array<nghttp2_nv, 4> headers{
+        MakeNv(":method", "GET"), MakeNv(":scheme", "http"),
+        MakeNv(":authority", "localhost"), MakeNv(":path", path)};
+    return nghttp2_submit_request(session_, nullptr, headers.data(),
+                                  headers.size(), nullptr, nullptr);
+  }
+
+  void SubmitPing() {
+    nghttp2_submit_ping(session_, NGHTTP2_FLAG_NONE, nullptr);
+  }
+
+  void SubmitReset(std::int32_t stream_id) {
+    nghttp2_submit_rst_stream(session_, NGHTTP2_FLAG_NONE, stream_id,
+                              NGHTTP2_CANCEL);
+  }
+
+  std::string Send() {
+    std::string result;
+    const std::uint8_t* data = nullptr;
+    while (const auto size = nghttp2_session_mem_send(session_, &data)) {
+      result.append(reinterpret_cast<const char*>(data), size);
+    }
+    return result;
+  }
+
+  template <typename Predicate>
+  void ReceiveUntil(engine::io::Socket& socket, engine::Deadline deadline,
+                    Predicate predicate) {
+    std::array<char, 4096> buffer{};
+    while (!predicate()) {
+      const auto size = socket.RecvSome(buffer.data(), buffer.size(), deadline);
+      ASSERT_NE(size, 0);
+      ASSERT_GE(nghttp2_session_mem_recv(
+                    session_, reinterpret_cast<std::uint8_t*>(buffer.data()),
+                    size),
+                0);
+    }
+  }
+
+  void ReceiveResponse(engine::io::Socket& socket, engine::Deadline deadline,
+                       std::int32_t stream_id) {
+    ReceiveUntil(socket, deadline,
+                 [this, stream_id] { return responses_[stream_id].is_closed; });
+  }
+
+  const Response& GetResponse(std::int32_t stream_id) {
+    return responses_[stream_id];
+  }
+  std::size_t GetPingAcks() const { return ping_acks_; }
+
+ private:
+  static int OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                      const std::uint8_t* name, size_t namelen,
+                      const std::uint8_t* value, size_t valuelen, std::uint8_t,
+                      void* user_data) {
+    auto& response =
+        static_cast<TestClient*>(user_data)->responses_[frame->hd.stream_id];
+    const std::string_view name_view{reinterpret_cast<const char*>(name),
+                                     namelen};
+    if (name_view == ":status") {
+      response.status.assign(reinterpret_cast<const char*>(value), valuelen);
+    }
+    response.header_names.emplace_back(name_view);
+    return 0;
+  }
+
+  static int OnData(nghttp2_session*, std::uint8_t, std::int32_t stream_id,
+                    const std::uint8_t* data, size_t len, void* user_data) {
+    static_cast<TestClient*>(user_data)->responses_[stream_id].body.append(
+        reinterpret_cast<const char*>(data), len);
+    return 0;
+  }
+
+  static int OnFrameRecv(nghttp2_session*, const nghttp2_frame* frame,
+                         void* user_data) {
+    if (frame->hd.type == NGHTTP2_PING &&
+        (frame->hd.flags & NGHTTP2_FLAG_ACK)) {
+      ++static_cast<TestClient*>(user_data)->ping_acks_;
+    }
+    return 0;
+  }
+
+  static int OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                           std::uint32_t, void* user_data) {
+    static_cast<TestClient*>(user_data)->responses_[stream_id].is_closed = true;
+    return 0;
+  }
+
+  nghttp2_session* session_{nullptr};
+  std::map<std::int32_t, Response> responses_;
+  std::size_t ping_acks_{0};
+};
+
+}  // namespace
+
+TEST(Http2Session, ConnectionPreface) {
+  using server::http::Http2Session;
+  EXPECT_TRUE(Http2Session::IsConnectionPreface("PRI * HTTP/2.0\r\n"));
+  EXPECT_TRUE(
+      Http2Session::IsConnectionPreface(Http2Session::kConnectionPreface));
+  EXPECT_FALSE(Http2Session::IsConnectionPreface("POST / HTTP/1.1\r\n"));
+  EXPECT_FALSE(Http2Session::IsConnectionPreface(""));
+}
+
+UTEST(Http2Session, RequestResponse) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  auto [server_socket, client_socket] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+  std::vector<RequestPtr> requests;
+  std::vector<ResponseEvent> events;
+  auto session = CreateTestSession(
+      [&requests](RequestPtr&& request) {
+        requests.push_back(std::move(request));
+      },
+      [&events](const server::request::RequestBase&, ResponseEvent event) {
+        events.push_back(event);
+      },
+      server_socket);
+
+  TestClient test_client;
+  const auto stream_id = test_client.SubmitGet("/foo?arg=value");
+  const auto request_data = test_client.Send();
+  ASSERT_TRUE(server::http::Http2Session::IsConnectionPreface(request_data));
+  ASSERT_TRUE(session.Parse(request_data.data(), request_data.size()));
+
+  ASSERT_EQ(requests.size(), 1);
+  auto& request =
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      static_cast<server::http::HttpRequestImpl&>(*requests.front());
+  EXPECT_EQ(request.GetMethod(), server::http::HttpMethod::kGet);
+  EXPECT_EQ(request.GetRequestPath(), "/foo");
+  EXPECT_EQ(request.GetArg("arg"), "value");
+  EXPECT_EQ(request.GetHeader(http::headers::kHost), "localhost");
+  EXPECT_EQ(request.GetHttpMajor(), 2);
+
+  auto& response = request.GetHttpResponse();
+  response.SetStatus(server::http::HttpStatus::kCreated);
+  response.SetHeader(std::string{"X-Test-Header"}, "value");
+  response.SetHeader(http::headers::kConnection, "keep-alive");
+  response.SetData("test data");
+  response.SetReady();
+  session.SendResponse(request);
+  EXPECT_TRUE(response.IsSent());
+  EXPECT_EQ(events, std::vector<ResponseEvent>{ResponseEvent::kSent});
+
+  test_client.ReceiveResponse(client_socket, test_deadline, stream_id);
+  const auto& client_response = test_client.GetResponse(stream_id);
+  EXPECT_EQ(client_response.status, "201");
+  EXPECT_EQ(client_response.body, "test data");
+
+  const auto& header_names = client_response.header_names;
+  EXPECT_NE(std::find(header_names.begin(), header_names.end(),
+                      "x-test-header"),
+            header_names.end());
+  EXPECT_EQ(std::find(header_names.begin(), header_names.end(), "connection"),
+            header_names.end());
+}
+
+UTEST(Http2Session, ResponsesOutOfOrder) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  auto [server_socket, client_socket] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+  std::vector<RequestPtr> requests;
+  auto session = CreateTestSession(
+      [&requests](RequestPtr&& request) {
+        requests.push_back(std::move(request));
+      },
+      {}, server_socket);
+
+  TestClient test_client;
+  const auto first_id = test_client.SubmitGet("/first");
+  const auto second_id = test_client.SubmitGet("/second");
+  auto data = test_client.Send();
+  ASSERT_TRUE(session.Parse(data.data(), data.size()));
+  ASSERT_EQ(requests.size(), 2);
+
+  // Control frames are answered while both responses are pending
+  test_client.SubmitPing();
+  data = test_client.Send();
+  ASSERT_TRUE(session.Parse(data.data(), data.size()));
+  test_client.ReceiveUntil(client_socket, test_deadline,
+                           [&] { return test_client.GetPingAcks() == 1; });
+
+  // The second response does not wait for the first one
+  auto& second_response = Respond(*requests[1], "second");
+  session.SendResponse(*requests[1]);
+  EXPECT_TRUE(second_response.IsSent());
+  test_client.ReceiveResponse(client_socket, test_deadline, second_id);
+  EXPECT_EQ(test_client.GetResponse(second_id).body, "second");
+  EXPECT_FALSE(test_client.GetResponse(first_id).is_closed);
+
+  // New streams are accepted while the first one is pending
+  const auto third_id = test_client.SubmitGet("/third");
+  data = test_client.Send();
+  ASSERT_TRUE(session.Parse(data.data(), data.size()));
+  ASSERT_EQ(requests.size(), 3);
+
+  Respond(*requests[2], "third");
+  session.SendResponse(*requests[2]);
+  Respond(*requests[0], "first");
+  session.SendResponse(*requests[0]);
+  test_client.ReceiveResponse(client_socket, test_deadline, third_id);
+  test_client.ReceiveResponse(client_socket, test_deadline, first_id);
+  EXPECT_EQ(test_client.GetResponse(third_id).body, "third");
+  EXPECT_EQ(test_client.GetResponse(first_id).body, "first");
+}
+
+UTEST(Http2Session, StreamResetByPeer) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  auto [server_socket, client_socket] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+  std::vector<RequestPtr> requests;
+  std::vector<ResponseEvent> events;
+  auto session = CreateTestSession(
+      [&requests](RequestPtr&& request) {
+        requests.push_back(std::move(request));
+      },
+      [&events](const server::request::RequestBase&, ResponseEvent event) {
+        events.push_back(event);
+      },
+      server_socket);
+
+  TestClient test_client;
+  const auto stream_id = test_client.SubmitGet("/slow");
+  auto data = test_client.Send();
+  ASSERT_TRUE(session.Parse(data.data(), data.size()));
+  ASSERT_EQ(requests.size(), 1);
+
+  test_client.SubmitReset(stream_id);
+  data = test_client.Send();
+  ASSERT_TRUE(session.Parse(data.data(), data.size()));
+  EXPECT_EQ(events, std::vector<ResponseEvent>{ResponseEvent::kCancelled});
+
+  auto& response = Respond(*requests.front(), "late");
+  session.SendResponse(*requests.front());
+  EXPECT_TRUE(response.IsSent());
+  EXPECT_EQ(response.BytesSent(), 0);
+  EXPECT_EQ(events, (std::vector<ResponseEvent>{ResponseEvent::kCancelled,
+                                                 ResponseEvent::kFailed}));
+}
+
+USERVER_NAMESPACE_END
@@ -23,13 +23,17 @@ std::string MakeHttpDate(std::chrono::system_clock::time_point date) {
 
 constexpr size_t kMaxDateHeaderLength = 128;
 
+constexpr std::string_view kDateHeaderPrefix = "Date: ";
+constexpr std::string_view kCrlf = "\r\n";
+
+// Keeps the whole header line, the date is a part of it
 struct LocalTimeCache final {
   std::chrono::seconds last_second{0};
-  std::size_t last_time_string_size{};
-  char last_time_string[kMaxDateHeaderLength]{};
+  std::size_t last_header_size{};
+  char last_header[kMaxDateHeaderLength]{};
 };
 
-std::string_view GetCachedDate() {
+std::string_view GetCachedDateHeader() {
   static compiler::ThreadLocal local_cache = [] { return LocalTimeCache{}; };
   auto cache = local_cache.Use();
 
@@ -41,14 +45,26 @@ std::string_view GetCachedDate() {
 
     const auto time_str = impl::MakeHttpDate(now);
     // this should never fire, but is left for some convenience
-    UASSERT(time_str.size() <= kMaxDateHeaderLength);
-
-    std::memcpy(cache->last_time_string, time_str.c_str(), time_str.size());
-    cache->last_time_string_size = time_str.size();
+    UASSERT(kDateHeaderPrefix.size() + time_str.size() + kCrlf.size() <=
+            kMaxDateHeaderLength);
+
+    char* data = cache->last_header;
+    for (const std::string_view part : {kDateHeaderPrefix,
+                                        std::string_view{time_str}, kCrlf}) {
+      std::memcpy(data, part.data(), part.size());
+      data += part.size();
+    }
+    cache->last_header_size = data - cache->last_header;
   }
 
-  return std::string_view{cache->last_time_string,
-                          cache->last_time_string_size};
+  return std::string_view{cache->last_header, cache->last_header_size};
+}
+
+std::string_view GetCachedDate() {
+  auto header = GetCachedDateHeader();
+  header.remove_prefix(kDateHeaderPrefix.size());
+  header.remove_suffix(kCrlf.size());
+  return header;
 }
 
 }  // namespace impl
@@ -24,6 +24,13 @@ std::string MakeHttpDate(std::chrono::system_clock::time_point date);
 /// it's UB. You are not expected to use this function directly.
 std::string_view GetCachedDate();
 
+/// @brief Returns string_view of the whole "Date: <current date>\r\n" header
+/// line, composed once a second.
+///
+/// @note Resulting string_view should not cross thread boundaries, otherwise
+/// it's UB. You are not expected to use this function directly.
+std::string_view GetCachedDateHeader();
+
 }  // namespace impl
 
 /// @brief Appends http-formatted current date (with timezone in UTC) to
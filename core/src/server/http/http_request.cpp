@@ -2,6 +2,7 @@
 
 #include <server/http/http_request_impl.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -172,6 +173,12 @@ const HttpRequest::CookiesMap& HttpRequest::RequestCookies() const {
   return impl_.GetCookies();
 }
 
+bool HttpRequest::IsBodyStreamed() const { return impl_.IsBodyStreamed(); }
+
+RequestBodyStream& HttpRequest::GetBodyStream() const {
+  return impl_.GetBodyStream();
+}
+
 void HttpRequest::SetRequestBody(std::string body) {
   impl_.SetRequestBody(std::move(body));
 }  // namespace server::http
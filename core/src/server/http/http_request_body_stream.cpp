@@ -0,0 +1,47 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+RequestBodyStreamError::RequestBodyStreamError(HttpStatus status,
+                                               std::string message)
+    : CustomHandlerException(status == HttpStatus::kPayloadTooLarge
+                                 ? handlers::HandlerErrorCode::kPayloadTooLarge
+                                 : handlers::HandlerErrorCode::kClientError,
+                             status,
+                             handlers::InternalMessage{std::move(message)}) {}
+
+RequestBodyStream::RequestBodyStream(
+    Queue::Consumer&& queue_consumer, const std::atomic<bool>& is_body_received,
+    const std::atomic<HttpStatus>& error_status)
+    : queue_consumer_(std::move(queue_consumer)),
+      is_body_received_(is_body_received),
+      error_status_(error_status) {}
+
+bool RequestBodyStream::ReadChunk(std::string& chunk,
+                                  engine::Deadline deadline) {
+  if (is_read_) return false;
+
+  if (queue_consumer_.Pop(chunk, deadline)) return true;
+
+  // The flag is set after the last chunk is pushed
+  if (!is_body_received_.load()) {
+    if (deadline.IsReached()) {
+      throw RequestBodyStreamError(
+          HttpStatus::kRequestTimeout,
+          "deadline reached while waiting for the request body");
+    }
+    throw RequestBodyStreamError(error_status_.load(),
+                                 "request body was not received completely");
+  }
+
+  // Pop() might have been interrupted by the deadline before the last chunks
+  if (queue_consumer_.PopNoblock(chunk)) return true;
+  is_read_ = true;
+  return false;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,143 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <string>
+
+#include <server/http/http_request_impl.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::RequestBodyStream;
+
+class StreamedRequest final {
+ public:
+  StreamedRequest() : queue_(RequestBodyStream::Queue::Create(4)) {
+    request_.SetBodyStream(queue_->GetConsumer());
+  }
+
+  server::http::HttpRequestImpl& GetRequest() { return request_; }
+
+  RequestBodyStream::Queue::Producer GetProducer() {
+    return queue_->GetProducer();
+  }
+
+ private:
+  server::request::ResponseDataAccounter accounter_;
+  server::http::HttpRequestImpl request_{accounter_};
+  std::shared_ptr<RequestBodyStream::Queue> queue_;
+};
+
+std::string ReadAll(RequestBodyStream& stream) {
+  std::string body;
+  std::string chunk;
+  while (stream.ReadChunk(chunk, engine::Deadline{})) body += chunk;
+  return body;
+}
+
+}  // namespace
+
+UTEST(RequestBodyStream, ReadChunks) {
+  StreamedRequest streamed;
+  auto& request = streamed.GetRequest();
+  ASSERT_TRUE(request.IsBodyStreamed());
+
+  auto producer_task = engine::AsyncNoSpan([&] {
+    auto producer = streamed.GetProducer();
+    for (const auto* chunk : {"ab", "cd", "ef"}) {
+      // The queue holds 4 bytes, the producer waits for the reader
+      ASSERT_TRUE(producer.Push(chunk, engine::Deadline{}));
+    }
+    request.SetBodyReceived();
+  });
+
+  auto& stream = request.GetBodyStream();
+  EXPECT_EQ(ReadAll(stream), "abcdef");
+  EXPECT_TRUE(stream.IsComplete());
+  EXPECT_TRUE(request.RequestBody().empty());
+  producer_task.Get();
+}
+
+UTEST(RequestBodyStream, Incomplete) {
+  StreamedRequest streamed;
+  auto& request = streamed.GetRequest();
+
+  {
+    auto producer = streamed.GetProducer();
+    ASSERT_TRUE(producer.Push("ab", engine::Deadline{}));
+  }
+
+  auto& stream = request.GetBodyStream();
+  std::string chunk;
+  ASSERT_TRUE(stream.ReadChunk(chunk, engine::Deadline{}));
+  EXPECT_EQ(chunk, "ab");
+  EXPECT_THROW(stream.ReadChunk(chunk, engine::Deadline{}),
+               server::http::RequestBodyStreamError);
+  EXPECT_FALSE(stream.IsComplete());
+}
+
+UTEST(RequestBodyStream, ErrorStatus) {
+  for (const auto status : {server::http::HttpStatus::kRequestTimeout,
+                            server::http::HttpStatus::kPayloadTooLarge}) {
+    StreamedRequest streamed;
+    auto& request = streamed.GetRequest();
+    request.SetBodyStreamErrorStatus(status);
+    streamed.GetProducer();
+
+    std::string chunk;
+    try {
+      request.GetBodyStream().ReadChunk(chunk, engine::Deadline{});
+      ADD_FAILURE() << "the body is incomplete";
+    } catch (const server::http::RequestBodyStreamError& e) {
+      EXPECT_EQ(server::http::GetHttpStatus(e), status);
+    }
+  }
+
+  StreamedRequest streamed;
+  streamed.GetProducer();
+  std::string chunk;
+  try {
+    streamed.GetRequest().GetBodyStream().ReadChunk(chunk, engine::Deadline{});
+    ADD_FAILURE() << "the body is incomplete";
+  } catch (const server::http::RequestBodyStreamError& e) {
+    EXPECT_EQ(server::http::GetHttpStatus(e),
+              server::http::HttpStatus::kBadRequest);
+  }
+}
+
+UTEST(RequestBodyStream, Deadline) {
+  StreamedRequest streamed;
+  auto producer = streamed.GetProducer();
+
+  std::string chunk;
+  try {
+    streamed.GetRequest().GetBodyStream().ReadChunk(
+        chunk, engine::Deadline::FromDuration(std::chrono::milliseconds{10}));
+    ADD_FAILURE() << "the deadline is reached";
+  } catch (const server::http::RequestBodyStreamError& e) {
+    EXPECT_EQ(server::http::GetHttpStatus(e),
+              server::http::HttpStatus::kRequestTimeout);
+  }
+}
+
+UTEST(RequestBodyStream, AbandonedByHandler) {
+  StreamedRequest streamed;
+  auto producer = streamed.GetProducer();
+  ASSERT_TRUE(producer.Push("abcd", engine::Deadline{}));
+
+  // The rest of the body is dropped without waiting
+  streamed.GetRequest().ResetBodyStream();
+  EXPECT_FALSE(streamed.GetRequest().IsBodyStreamed());
+  EXPECT_FALSE(producer.Push("ef", engine::Deadline{}));
+}
+
+TEST(RequestBodyStream, NotStreamed) {
+  server::request::ResponseDataAccounter accounter;
+  const server::http::HttpRequestImpl request{accounter};
+  EXPECT_FALSE(request.IsBodyStreamed());
+  EXPECT_THROW(request.GetBodyStream(), std::logic_error);
+}
+
+USERVER_NAMESPACE_END
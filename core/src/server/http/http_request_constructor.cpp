@@ -3,7 +3,10 @@
 #include <http_parser.h>
 
 #include <algorithm>
+#include <utility>
 
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -19,6 +22,9 @@ namespace server::http {
 
 namespace {
 
+// Body chunks that are received but not yet read by the handler
+constexpr std::size_t kBodyStreamQueueSize = 256 * 1024;
+
 inline void Strip(const char*& begin, const char*& end) {
   while (begin < end && isspace(*begin)) ++begin;
   while (begin < end && isspace(end[-1])) --end;
@@ -38,7 +44,7 @@ void StripDuplicateStartingSlashes(std::string& s) {
     return;
   }
 
-  s = s.substr(non_slash_pos - 1);
+  s.erase(0, non_slash_pos - 1);
 }
 
 }  // namespace
@@ -49,10 +55,18 @@ struct HttpRequestConstructor::HttpParserUrl {
 
 HttpRequestConstructor::HttpRequestConstructor(
     Config config, const HandlerInfoIndex& handler_info_index,
-    request::ResponseDataAccounter& data_accounter)
+    request::ResponseDataAccounter& data_accounter, RequestBuffers& buffers,
+    HttpRequestPool* request_pool)
     : config_(config),
       handler_info_index_(handler_info_index),
-      request_(std::make_shared<HttpRequestImpl>(data_accounter)) {}
+      buffers_(buffers),
+      request_(request_pool
+                   ? request_pool->CreateRequest(data_accounter)
+                   : std::make_shared<HttpRequestImpl>(data_accounter)) {
+  // The previous request may have been interrupted by an error
+  buffers_.header_field.clear();
+  buffers_.header_value.clear();
+}
 
 HttpRequestConstructor::~HttpRequestConstructor() = default;
 
@@ -91,7 +105,7 @@ void HttpRequestConstructor::ParseUrl() {
     const auto& str_info = parsed_url_pimpl_->parsed_url
                                .field_data[http_parser_url_fields::UF_PATH];
 
-    request_->request_path_ = request_->url_.substr(str_info.off, str_info.len);
+    request_->request_path_.assign(request_->url_, str_info.off, str_info.len);
     StripDuplicateStartingSlashes(request_->request_path_);
     LOG_TRACE() << "path='" << request_->request_path_ << '\'';
   } else {
@@ -121,6 +135,7 @@ void HttpRequestConstructor::ParseUrl() {
     config_.parse_args_from_body =
         handler_config.request_config.parse_args_from_body;
     if (handler_config.decompress_request) config_.decompress_request = true;
+    request_body_stream_ = handler_config.request_body_stream;
 
     request_->SetTaskProcessor(handler_info->task_processor);
     request_->SetHttpHandler(handler_info->handler);
@@ -152,7 +167,7 @@ void HttpRequestConstructor::AppendHeaderField(const char* data, size_t size) {
   AccountHeadersSize(size);
   AccountRequestSize(size);
 
-  header_field_.append(data, size);
+  buffers_.header_field.append(data, size);
 }
 
 void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
@@ -162,25 +177,90 @@ void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
   AccountHeadersSize(size);
   AccountRequestSize(size);
 
-  header_value_.append(data, size);
+  buffers_.header_value.append(data, size);
 }
 
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
   AccountRequestSize(size);
-  request_->request_body_.append(data, size);
+  if (!is_body_stream_started_) {
+    request_->request_body_.append(data, size);
+    return;
+  }
+  // The handler is done with the request, the rest of the body is dropped
+  if (!body_stream_producer_) return;
+
+  // Blocks the connection until the handler reads the previous chunks
+  while (size > 0) {
+    const auto chunk_size = std::min(size, kBodyStreamQueueSize);
+    if (!body_stream_producer_->Push(
+            std::string{data, chunk_size},
+            engine::Deadline::FromDuration(body_stream_push_timeout_))) {
+      if (body_stream_producer_->Queue()->NoMoreConsumers()) {
+        body_stream_producer_.reset();
+        return;
+      }
+
+      const bool is_cancelled = engine::current_task::ShouldCancel();
+      FailBodyStream(HttpStatus::kRequestTimeout);
+      utils::LogErrorAndThrow(
+          is_cancelled
+              ? "connection is closed while waiting for the handler to read "
+                "the request body"
+              : "handler did not read the request body for " +
+                    std::to_string(body_stream_push_timeout_.count()) +
+                    "ms, url: " + request_->GetUrl());
+    }
+    data += chunk_size;
+    size -= chunk_size;
+  }
 }
 
 void HttpRequestConstructor::SetIsFinal(bool is_final) {
   request_->is_final_ = is_final;
 }
 
+bool HttpRequestConstructor::CanStreamBody() const {
+  return request_body_stream_ && url_parsed_ && status_ == Status::kOk;
+}
+
+std::shared_ptr<request::RequestBase> HttpRequestConstructor::StartBodyStream(
+    std::chrono::milliseconds push_timeout) {
+  UASSERT(CanStreamBody());
+  UASSERT(!is_body_stream_started_);
+  LOG_TRACE() << "method=" << request_->GetMethodStr() << ", streamed body";
+
+  FinalizeImpl();
+
+  CheckStatus();
+
+  const auto queue = RequestBodyStream::Queue::Create(kBodyStreamQueueSize);
+  request_->SetBodyStream(queue->GetConsumer());
+  body_stream_producer_.emplace(queue->GetProducer());
+  is_body_stream_started_ = true;
+  body_stream_push_timeout_ = push_timeout;
+  return request_;
+}
+
+void HttpRequestConstructor::SetBodyReceived() {
+  request_->SetBodyReceived();
+}
+
 std::shared_ptr<request::RequestBase> HttpRequestConstructor::Finalize() {
+  if (is_body_stream_started_) {
+    // The handler is already started, the end of the queue is the end of
+    // the body for it
+    body_stream_producer_.reset();
+    return std::move(request_);
+  }
+
   LOG_TRACE() << "method=" << request_->GetMethodStr();
 
   FinalizeImpl();
 
   CheckStatus();
 
+  if (request_body_stream_ && status_ == Status::kOk) StreamWholeBody();
+
   return std::move(request_);  // request_ is left empty
 }
 
@@ -197,7 +277,8 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   try {
     ParseArgs(*parsed_url_pimpl_);
-    if (config_.parse_args_from_body) {
+    // The streamed body is not available to the constructor
+    if (config_.parse_args_from_body && !request_body_stream_) {
       if (!config_.decompress_request || !request_->IsBodyCompressed())
         ParseArgs(request_->request_body_.data(),
                   request_->request_body_.size());
@@ -227,7 +308,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   const auto& content_type =
       request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
-  if (IsMultipartFormDataContentType(content_type)) {
+  if (!request_body_stream_ && IsMultipartFormDataContentType(content_type)) {
     if (!ParseMultipartFormData(content_type, request_->RequestBody(),
                                 request_->form_data_args_)) {
       SetStatus(Status::kParseMultipartFormDataError);
@@ -235,6 +316,21 @@ void HttpRequestConstructor::FinalizeImpl() {
   }
 }
 
+void HttpRequestConstructor::StreamWholeBody() {
+  // E.g. HTTP/2 requests are handled after the whole body is received, it is
+  // passed to the handler as a single chunk
+  const auto queue = RequestBodyStream::Queue::Create();
+  request_->SetBodyStream(queue->GetConsumer());
+
+  auto producer = queue->GetProducer();
+  if (!request_->request_body_.empty()) {
+    [[maybe_unused]] const bool success = producer.PushNoblock(
+        std::exchange(request_->request_body_, std::string{}));
+    UASSERT(success);
+  }
+  request_->SetBodyReceived();
+}
+
 void HttpRequestConstructor::ParseArgs(const HttpParserUrl& url) {
   if (url.parsed_url.field_set & (1 << http_parser_url_fields::UF_QUERY)) {
     const auto& str_info =
@@ -257,8 +353,10 @@ void HttpRequestConstructor::AddHeader() {
   UASSERT(header_field_flag_);
 
   try {
-    request_->headers_.InsertOrAppend(std::move(header_field_),
-                                      std::move(header_value_));
+    // Copies are allocated with the exact size and the buffers keep their
+    // capacity for the next headers
+    request_->headers_.InsertOrAppend(std::string{buffers_.header_field},
+                                      std::string{buffers_.header_value});
   } catch (const USERVER_NAMESPACE::http::headers::HeaderMap::
                TooManyHeadersException&) {
     SetStatus(Status::kHeadersTooLarge);
@@ -266,8 +364,8 @@ void HttpRequestConstructor::AddHeader() {
         "HeaderMap reached its maximum capacity, already contains {} headers",
         request_->headers_.size()));
   }
-  header_field_.clear();
-  header_value_.clear();
+  buffers_.header_field.clear();
+  buffers_.header_value.clear();
 }
 
 void HttpRequestConstructor::ParseCookies() {
@@ -322,6 +420,7 @@ void HttpRequestConstructor::AccountRequestSize(size_t size) {
   request_size_ += size;
   if (request_size_ > config_.max_request_size) {
     SetStatus(Status::kRequestTooLarge);
+    if (is_body_stream_started_) FailBodyStream(HttpStatus::kPayloadTooLarge);
     utils::LogErrorAndThrow(
         "request is too large, " + std::to_string(request_size_) + ">" +
         std::to_string(config_.max_request_size) +
@@ -356,6 +455,14 @@ void HttpRequestConstructor::AccountHeadersSize(size_t size) {
   }
 }
 
+void HttpRequestConstructor::FailBodyStream(HttpStatus status) {
+  UASSERT(is_body_stream_started_);
+  // The handler sees the end of the queue before the end of the body and
+  // fails with the status
+  request_->SetBodyStreamErrorStatus(status);
+  body_stream_producer_.reset();
+}
+
 void HttpRequestConstructor::CheckStatus() const {
   switch (status_) {
     case Status::kOk:
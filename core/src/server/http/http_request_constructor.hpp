@@ -1,9 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <string>
 
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/request/request_config.hpp>
 
 #include <server/request/request_constructor.hpp>
@@ -15,6 +19,15 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
 
+/// Buffers for the header names and values that are accumulated from the
+/// chunks of the parser. They are owned by the connection and reused by its
+/// next requests, so the chunks are appended without reallocations once the
+/// buffers have grown to the size of the longest header.
+struct RequestBuffers final {
+  std::string header_field;
+  std::string header_value;
+};
+
 class HttpRequestConstructor final : public request::RequestConstructor {
  public:
   enum class Status {
@@ -35,7 +48,9 @@ class HttpRequestConstructor final : public request::RequestConstructor {
 
   HttpRequestConstructor(Config config,
                          const HandlerInfoIndex& handler_info_index,
-                         request::ResponseDataAccounter& data_accounter);
+                         request::ResponseDataAccounter& data_accounter,
+                         RequestBuffers& buffers,
+                         HttpRequestPool* request_pool = nullptr);
 
   ~HttpRequestConstructor() override;
 
@@ -54,12 +69,31 @@ class HttpRequestConstructor final : public request::RequestConstructor {
 
   void SetIsFinal(bool is_final);
 
+  /// Whether the handler of the request reads its body with
+  /// RequestBodyStream and may be started once the headers are parsed
+  bool CanStreamBody() const;
+
+  /// Returns the request to start its handler, the following body chunks are
+  /// passed to the handler by AppendBody(). Finalize() must still be called
+  /// after the end of the message.
+  ///
+  /// AppendBody() waits for the handler to read the previous chunks for at
+  /// most `push_timeout` per chunk. Then the request fails with 408 and
+  /// AppendBody() throws, so that the connection stops reading requests.
+  std::shared_ptr<request::RequestBase> StartBodyStream(
+      std::chrono::milliseconds push_timeout);
+
+  /// Marks the streamed body as complete, it is reported as incomplete to the
+  /// handler if Finalize() is called without it
+  void SetBodyReceived();
+
   std::shared_ptr<request::RequestBase> Finalize() override;
 
  private:
   struct HttpParserUrl;
 
   void FinalizeImpl();
+  void StreamWholeBody();
 
   void ParseArgs(const HttpParserUrl& url);
   void ParseArgs(const char* data, size_t size);
@@ -70,6 +104,7 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void AccountRequestSize(size_t size);
   void AccountUrlSize(size_t size);
   void AccountHeadersSize(size_t size);
+  void FailBodyStream(HttpStatus status);
 
   void CheckStatus() const;
 
@@ -77,8 +112,7 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   const HandlerInfoIndex& handler_info_index_;
 
   utils::FastPimpl<HttpParserUrl, 60, 8> parsed_url_pimpl_;
-  std::string header_field_;
-  std::string header_value_;
+  RequestBuffers& buffers_;
   bool header_field_flag_ = false;
   bool header_value_flag_ = false;
 
@@ -87,8 +121,12 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   size_t headers_size_ = 0;
   bool url_parsed_ = false;
   Status status_ = Status::kOk;
+  bool request_body_stream_ = false;
 
   std::shared_ptr<HttpRequestImpl> request_;
+  bool is_body_stream_started_ = false;
+  std::chrono::milliseconds body_stream_push_timeout_{};
+  std::optional<RequestBodyStream::Queue::Producer> body_stream_producer_;
 };
 
 }  // namespace server::http
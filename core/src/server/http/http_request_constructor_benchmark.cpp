@@ -1,6 +1,11 @@
 #include <benchmark/benchmark.h>
 
+#include <memory>
+#include <string_view>
+#include <utility>
+
 #include <server/http/http_request_constructor.hpp>
+#include <server/http/http_request_pool.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,9 +21,48 @@ void http_request_constructor_url_decode(benchmark::State& state) {
   for ([[maybe_unused]] auto _ : state)
     benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
 }
+
+constexpr std::string_view kUrl = "/v1/orders/retrieve?order_id=5f1e";
+
+constexpr std::pair<std::string_view, std::string_view> kHeaders[] = {
+    {"Host", "orders.internal.example.com:8080"},
+    {"User-Agent", "userver/2.0 (Linux x86_64)"},
+    {"Accept", "application/json"},
+    {"Accept-Encoding", "gzip, zstd"},
+    {"Content-Type", "application/json; charset=utf-8"},
+    {"X-YaRequestId", "3c2fa0b1e8d44a4f9c6d2a7b58e1f0d3"},
+    {"X-YaTraceId", "b2f8a6d01c4e4d3a8f5e7c9b1a2d3e4f"},
+    {"Cookie", "session=0123456789abcdef; lang=en"},
+};
+
+void http_request_constructor_construct(benchmark::State& state) {
+  const server::http::HandlerInfoIndex handler_info_index;
+  const server::http::HttpRequestConstructor::Config config{};
+  server::request::ResponseDataAccounter data_accounter;
+  server::http::RequestBuffers buffers;
+  const auto pool = state.range(0)
+                        ? std::make_shared<server::http::HttpRequestPool>()
+                        : nullptr;
+
+  for ([[maybe_unused]] auto _ : state) {
+    server::http::HttpRequestConstructor constructor{
+        config, handler_info_index, data_accounter, buffers, pool.get()};
+    constructor.SetMethod(server::http::HttpMethod::kGet);
+    constructor.AppendUrl(kUrl.data(), kUrl.size());
+    constructor.ParseUrl();
+    for (const auto& [name, value] : kHeaders) {
+      constructor.AppendHeaderField(name.data(), name.size());
+      constructor.AppendHeaderValue(value.data(), value.size());
+    }
+    constructor.AppendHeaderField("", 0);
+    benchmark::DoNotOptimize(constructor.Finalize());
+  }
+}
+
 }  // namespace
 BENCHMARK(http_request_constructor_url_decode)
     ->RangeMultiplier(2)
     ->Range(1, 1024);
+BENCHMARK(http_request_constructor_construct)->Arg(0)->Arg(1);
 
 USERVER_NAMESPACE_END
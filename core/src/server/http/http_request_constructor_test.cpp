@@ -1,10 +1,34 @@
 #include <userver/utest/utest.hpp>
 
 #include <server/http/http_request_constructor.hpp>
+#include <server/http/http_request_pool.hpp>
 #include <userver/http/parser/http_request_parse_args.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+std::shared_ptr<server::http::HttpRequestImpl> ConstructRequest(
+    server::http::HttpRequestPool& pool, std::string_view url,
+    std::string_view header) {
+  static const server::http::HandlerInfoIndex kHandlerInfoIndex;
+  static server::request::ResponseDataAccounter data_accounter;
+  server::http::RequestBuffers buffers;
+
+  server::http::HttpRequestConstructor constructor{
+      {}, kHandlerInfoIndex, data_accounter, buffers, &pool};
+  constructor.SetMethod(server::http::HttpMethod::kGet);
+  constructor.AppendUrl(url.data(), url.size());
+  constructor.ParseUrl();
+  constructor.AppendHeaderField(header.data(), header.size());
+  constructor.AppendHeaderValue("value", 5);
+  constructor.AppendHeaderField("", 0);
+  return std::static_pointer_cast<server::http::HttpRequestImpl>(
+      constructor.Finalize());
+}
+
+}  // namespace
+
 TEST(HttpRequestConstructor, DecodeUrl) {
   std::string str = "Some+String%20x%30";
   EXPECT_EQ("Some String x0", http::parser::UrlDecode(str));
@@ -15,4 +39,31 @@ TEST(HttpRequestConstructor, DecodeUrlPlus) {
   EXPECT_EQ("Some String", http::parser::UrlDecode(str));
 }
 
+UTEST(HttpRequestConstructor, RecycledRequest) {
+  auto pool = std::make_shared<server::http::HttpRequestPool>();
+
+  auto request = ConstructRequest(*pool, "/first?arg=1", "X-First");
+  const auto* first_address = request.get();
+  EXPECT_EQ(request->GetUrl(), "/first?arg=1");
+  EXPECT_TRUE(request->HasHeader("X-First"));
+  request.reset();
+
+  request = ConstructRequest(*pool, "/second", "X-Second");
+  EXPECT_EQ(request.get(), first_address);
+  EXPECT_EQ(request->GetUrl(), "/second");
+  EXPECT_EQ(request->GetRequestPath(), "/second");
+  EXPECT_EQ(request->HeaderCount(), 1);
+  EXPECT_FALSE(request->HasHeader("X-First"));
+  EXPECT_TRUE(request->HasHeader("X-Second"));
+
+  auto other_request = ConstructRequest(*pool, "/third", "X-Third");
+  EXPECT_NE(other_request.get(), first_address);
+
+  // Requests may outlive the connection with the pool
+  pool.reset();
+  request.reset();
+  EXPECT_EQ(other_request->GetUrl(), "/third");
+  other_request.reset();
+}
+
 USERVER_NAMESPACE_END
@@ -15,6 +15,7 @@
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/task_inherited_request.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include "http_request_impl.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -32,6 +33,8 @@ engine::TaskWithResult<void> StartFailsafeTask(
   static handlers::HttpRequestStatistics dummy_statistics;
 
   http_request.SetHttpHandlerStatistics(dummy_statistics);
+  // The streamed body is not read, the connection discards it
+  http_request.ResetBodyStream();
 
   return engine::AsyncNoSpan([request = std::move(request), handler]() {
     request->SetTaskStartTime();
@@ -50,13 +53,14 @@ HttpRequestHandler::HttpRequestHandler(
     bool is_monitor, std::string server_name)
     : add_handler_disabled_(false),
       is_monitor_(is_monitor),
-      server_name_(std::move(server_name)),
       rate_limit_(utils::TokenBucket::MakeUnbounded()),
       metrics_(component_context.FindComponent<components::StatisticsStorage>()
                    .GetMetricsStorage()),
       config_source_(
           component_context.FindComponent<components::DynamicConfig>()
               .GetSource()) {
+  server_headers_.Add(USERVER_NAMESPACE::http::headers::kServer, server_name);
+
   auto& logging_component =
       component_context.FindComponent<components::Logging>();
 
@@ -89,8 +93,7 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
       static_cast<const http::HttpRequestImpl&>(*request);
 
   auto& http_response = http_request.GetHttpResponse();
-  http_response.SetHeader(USERVER_NAMESPACE::http::headers::kServer,
-                          server_name_);
+  http_response.SetPrecomputedHeaders(server_headers_);
   if (http_response.IsReady()) {
     // Request is broken somehow, user handler must not be called
     request->SetTaskCreateTime();
@@ -137,6 +140,8 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
       metrics_->GetMetric(kCcStatusCodeIsCustom) = 0;
     }
 
+    cc_throttled_tp_.store(std::chrono::steady_clock::now(),
+                           std::memory_order_relaxed);
     SetThrottleReason(
         http_response, "congestion-control",
         std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kCC});
@@ -170,6 +175,13 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
 
     request->SetTaskStartTime();
 
+    // The connection discards the rest of the streamed body once the handler
+    // is finished
+    const utils::FastScopeGuard body_stream_guard{[&request]() noexcept {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      static_cast<HttpRequestImpl&>(*request).ResetBodyStream();
+    }};
+
     request::RequestContext context;
     handler->HandleRequest(*request, context);
 
@@ -239,6 +251,17 @@ void HttpRequestHandler::SetRpsRatelimit(std::optional<size_t> rps) {
   }
 }
 
+bool HttpRequestHandler::IsThrottledByCongestionControl() const noexcept {
+  // Requests are throttled in bursts once the token bucket is empty, a second
+  // covers the gaps between the bursts
+  constexpr std::chrono::seconds kThrottledPeriod{1};
+
+  if (rate_limit_.IsUnbounded()) return false;
+  return std::chrono::steady_clock::now() -
+             cc_throttled_tp_.load(std::memory_order_relaxed) <
+         kThrottledPeriod;
+}
+
 void HttpRequestHandler::SetRpsRatelimitStatusCode(HttpStatus status_code) {
   LOG_DEBUG() << "CC status code changed to " << static_cast<int>(status_code);
   cc_status_code_ = status_code;
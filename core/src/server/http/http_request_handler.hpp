@@ -2,6 +2,7 @@
 
 #include <optional>
 
+#include <server/http/precomputed_headers.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/engine/mutex.hpp>
@@ -50,6 +51,10 @@ class HttpRequestHandler final : public RequestHandlerBase {
 
   void SetRpsRatelimitStatusCode(HttpStatus status_code);
 
+  /// Returns true if the congestion control limit is set and has rejected
+  /// some requests recently
+  bool IsThrottledByCongestionControl() const noexcept;
+
  private:
   logging::LoggerPtr logger_access_;
   logging::LoggerPtr logger_access_tskv_;
@@ -62,11 +67,14 @@ class HttpRequestHandler final : public RequestHandlerBase {
 
   std::atomic<bool> add_handler_disabled_;
   const bool is_monitor_;
-  const std::string server_name_;
+  // Server header for the requests without a handler, the handlers have
+  // their own blocks
+  impl::PrecomputedHeaders server_headers_;
   NewRequestHook new_request_hook_;
   mutable utils::TokenBucket rate_limit_;
   std::atomic<HttpStatus> cc_status_code_{HttpStatus::kTooManyRequests};
   std::chrono::steady_clock::time_point cc_enabled_tp_;
+  mutable std::atomic<std::chrono::steady_clock::time_point> cc_throttled_tp_{};
   utils::statistics::MetricsStoragePtr metrics_;
   dynamic_config::Source config_source_;
 };
@@ -74,16 +74,35 @@ namespace server::http {
 // Use hash_function() magic to pass out the same RNG seed among all
 // unordered_maps because we don't need different seeds and want to avoid its
 // overhead.
-HttpRequestImpl::HttpRequestImpl(request::ResponseDataAccounter& data_accounter)
-    : form_data_args_(kZeroAllocationBucketCount,
+HttpRequestImpl::HttpRequestImpl(request::ResponseDataAccounter& data_accounter,
+                                 std::shared_ptr<HttpRequestPool> pool)
+    : HttpRequestImpl(data_accounter, pool,
+                      pool ? pool->TakeStorage() : RecycledRequestStorage{}) {}
+
+HttpRequestImpl::HttpRequestImpl(request::ResponseDataAccounter& data_accounter,
+                                 std::shared_ptr<HttpRequestPool> pool,
+                                 RecycledRequestStorage&& storage)
+    : pool_(std::move(pool)),
+      url_(std::move(storage.url)),
+      request_path_(std::move(storage.request_path)),
+      request_body_(std::move(storage.request_body)),
+      form_data_args_(kZeroAllocationBucketCount,
                       request_args_.hash_function()),
       path_args_by_name_index_(kZeroAllocationBucketCount,
                                request_args_.hash_function()),
-      headers_(kBucketCount),
+      headers_(std::move(storage.headers)),
       cookies_(kZeroAllocationBucketCount, request_args_.hash_function()),
-      response_(*this, data_accounter, StartTime(), cookies_.hash_function()) {}
+      response_(*this, data_accounter, StartTime(), cookies_.hash_function()) {
+  // A no-op for the recycled headers
+  headers_.reserve(kBucketCount);
+}
 
-HttpRequestImpl::~HttpRequestImpl() = default;
+HttpRequestImpl::~HttpRequestImpl() {
+  if (pool_) {
+    pool_->RecycleStorage({std::move(url_), std::move(request_path_),
+                           std::move(request_body_), std::move(headers_)});
+  }
+}
 
 std::chrono::duration<double> HttpRequestImpl::GetRequestTime() const {
   return GetResponse().SentTime() - StartTime();
@@ -273,6 +292,23 @@ bool HttpRequestImpl::IsBodyCompressed() const {
   return !encoding.empty() && encoding != "identity";
 }
 
+RequestBodyStream& HttpRequestImpl::GetBodyStream() const {
+  if (!body_stream_) {
+    throw std::logic_error(
+        "Request body is not streamed, enable 'request-body-stream' in the "
+        "config of the handler");
+  }
+  return *body_stream_;
+}
+
+void HttpRequestImpl::SetBodyStream(
+    RequestBodyStream::Queue::Consumer&& queue_consumer) {
+  UASSERT(!body_stream_);
+  body_stream_.emplace(
+      RequestBodyStream{std::move(queue_consumer), is_body_received_,
+                        body_stream_error_status_});
+}
+
 void HttpRequestImpl::DoUpgrade(std::unique_ptr<engine::io::RwBase>&& socket,
                                 engine::io::Sockaddr&& peer_name) const {
   upgrade_websocket_cb_(std::move(socket), std::move(peer_name));
@@ -308,6 +344,7 @@ void HttpRequestImpl::MarkAsInternalServerError() const {
   // TODO : refactor, this being here is a bit ridiculous
   response_.SetStatus(http::HttpStatus::kInternalServerError);
   response_.SetData({});
+  response_.ClearBodySegments();
   response_.ClearHeaders();
 }
 
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -10,12 +12,15 @@
 
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 #include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/str_icase.hpp>
 
+#include <server/http/http_request_pool.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server {
@@ -28,7 +33,10 @@ namespace http {
 
 class HttpRequestImpl final : public request::RequestBase {
  public:
-  HttpRequestImpl(request::ResponseDataAccounter& data_accounter);
+  /// Containers of the request are taken from the pool and are returned to
+  /// it on destruction, if the pool is set
+  explicit HttpRequestImpl(request::ResponseDataAccounter& data_accounter,
+                           std::shared_ptr<HttpRequestPool> pool = {});
   ~HttpRequestImpl() override;
 
   const HttpMethod& GetMethod() const { return method_; }
@@ -91,6 +99,22 @@ class HttpRequestImpl final : public request::RequestBase {
 
   bool IsBodyCompressed() const;
 
+  bool IsBodyStreamed() const { return body_stream_.has_value(); }
+  RequestBodyStream& GetBodyStream() const;
+  void SetBodyStream(RequestBodyStream::Queue::Consumer&& queue_consumer);
+  /// Must be called after the last chunk is pushed and before the producer
+  /// of the stream is released
+  void SetBodyReceived() { is_body_received_ = true; }
+  /// The status of the RequestBodyStreamError for an incomplete body, must be
+  /// set before the producer of the stream is released
+  void SetBodyStreamErrorStatus(HttpStatus status) {
+    body_stream_error_status_ = status;
+  }
+
+  /// Called once the handler is done with the request, the rest of the
+  /// streamed body is discarded by the connection
+  void ResetBodyStream() { body_stream_.reset(); }
+
   bool IsFinal() const override { return is_final_; }
 
   using UpgradeCallback = std::function<void(
@@ -139,6 +163,11 @@ class HttpRequestImpl final : public request::RequestBase {
   friend class HttpRequestConstructor;
 
  private:
+  HttpRequestImpl(request::ResponseDataAccounter& data_accounter,
+                  std::shared_ptr<HttpRequestPool> pool,
+                  RecycledRequestStorage&& storage);
+
+  std::shared_ptr<HttpRequestPool> pool_;
   HttpMethod method_{HttpMethod::kUnknown};
   unsigned short http_major_{1};
   unsigned short http_minor_{1};
@@ -158,6 +187,9 @@ class HttpRequestImpl final : public request::RequestBase {
   HttpRequest::HeadersMap headers_;
   HttpRequest::CookiesMap cookies_;
   bool is_final_{false};
+  std::atomic<bool> is_body_received_{false};
+  std::atomic<HttpStatus> body_stream_error_status_{HttpStatus::kBadRequest};
+  mutable std::optional<RequestBodyStream> body_stream_;
   UpgradeCallback upgrade_websocket_cb_;
 
   mutable HttpResponse response_;
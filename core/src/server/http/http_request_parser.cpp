@@ -53,10 +53,15 @@ HttpRequestParser::HttpRequestParser(
     const HandlerInfoIndex& handler_info_index,
     const request::HttpRequestConfig& request_config,
     OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
-    request::ResponseDataAccounter& data_accounter)
+    request::ResponseDataAccounter& data_accounter,
+    OnNewRequestCb&& on_body_stream_cb,
+    std::chrono::milliseconds body_stream_timeout)
     : handler_info_index_(handler_info_index),
       request_constructor_config_{request_config},
       on_new_request_cb_(std::move(on_new_request_cb)),
+      on_body_stream_cb_(std::move(on_body_stream_cb)),
+      body_stream_timeout_(body_stream_timeout),
+      request_pool_(std::make_shared<HttpRequestPool>()),
       stats_(stats),
       data_accounter_(data_accounter) {
   llhttp_init(&parser_, HTTP_REQUEST, &parser_settings);
@@ -182,6 +187,10 @@ int HttpRequestParser::OnHeadersCompleteImpl(llhttp_t* p) {
     return -1;
   }
   LOG_TRACE() << "headers complete";
+  if (on_body_stream_cb_ && request_constructor_->CanStreamBody()) {
+    on_body_stream_cb_(
+        request_constructor_->StartBodyStream(body_stream_timeout_));
+  }
   return 0;
 }
 
@@ -206,6 +215,7 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
   request_constructor_->SetIsFinal(!llhttp_should_keep_alive(p));
   if (!CheckUrlComplete(p)) return -1;
   LOG_TRACE() << "message complete";
+  request_constructor_->SetBodyReceived();
   if (!FinalizeRequest()) return -1;
   return 0;
 }
@@ -213,7 +223,8 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
 void HttpRequestParser::CreateRequestConstructor() {
   stats_.parsing_request_count.Add(1);
   request_constructor_.emplace(request_constructor_config_, handler_info_index_,
-                               data_accounter_);
+                               data_accounter_, request_buffers_,
+                               request_pool_.get());
   url_complete_ = false;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -23,10 +24,18 @@ class HttpRequestParser final : public request::RequestParser {
   using OnNewRequestCb =
       std::function<void(std::shared_ptr<request::RequestBase>&&)>;
 
+  /// @param on_body_stream_cb is called once the headers are parsed for the
+  /// requests with streamed bodies, the same request is passed to
+  /// on_new_request_cb after the end of its body. If it is not set, the body
+  /// is passed to the handler as a single chunk.
+  /// @param body_stream_timeout how long the parsing waits for the handler to
+  /// read a chunk of the streamed body, the request fails with 408 then
   HttpRequestParser(const HandlerInfoIndex& handler_info_index,
                     const request::HttpRequestConfig& request_config,
                     OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
-                    request::ResponseDataAccounter& data_accounter);
+                    request::ResponseDataAccounter& data_accounter,
+                    OnNewRequestCb&& on_body_stream_cb = {},
+                    std::chrono::milliseconds body_stream_timeout = {});
 
   HttpRequestParser(HttpRequestParser&&) = delete;
   HttpRequestParser& operator=(HttpRequestParser&&) = delete;
@@ -63,8 +72,12 @@ class HttpRequestParser final : public request::RequestParser {
   bool url_complete_ = false;
 
   OnNewRequestCb on_new_request_cb_;
+  OnNewRequestCb on_body_stream_cb_;
+  const std::chrono::milliseconds body_stream_timeout_;
 
   llhttp_t parser_{};
+  RequestBuffers request_buffers_;
+  const std::shared_ptr<HttpRequestPool> request_pool_;
   std::optional<HttpRequestConstructor> request_constructor_;
 
   static const llhttp_settings_t parser_settings;
@@ -2,6 +2,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <utils/gbench_allocations.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -41,6 +43,7 @@ void http_request_parser_parse_benchmark_small(benchmark::State& state) {
   auto parser = CreateBenchmarkParser(
       [](std::shared_ptr<server::request::RequestBase>&&) {});
 
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     parser.Parse(kHttpRequestDataSmall.data(), kHttpRequestDataSmall.size());
   }
@@ -50,6 +53,7 @@ void http_request_parser_parse_benchmark_middle(benchmark::State& state) {
   auto parser = CreateBenchmarkParser(
       [](std::shared_ptr<server::request::RequestBase>&&) {});
 
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     parser.Parse(kHttpRequestDataMiddle.data(), kHttpRequestDataMiddle.size());
   }
@@ -66,6 +70,7 @@ void http_request_parser_parse_benchmark_large_url(benchmark::State& state) {
   const std::string http_request_data =
       fmt::format("GET {} HTTP/1.1\r\n\r\n", large_url);
 
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     parser.Parse(http_request_data.data(), http_request_data.size());
   }
@@ -84,6 +89,7 @@ void http_request_parser_parse_benchmark_large_body(benchmark::State& state) {
       "Content-Length: {}\r\n\r\n{}",
       large_body.size(), large_body);
 
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     parser.Parse(http_request_data.data(), http_request_data.size());
   }
@@ -102,6 +108,7 @@ void http_request_parser_parse_benchmark_many_headers(benchmark::State& state) {
       "{}\r\n\r\n",
       headers);
 
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     parser.Parse(http_request_data.data(), http_request_data.size());
   }
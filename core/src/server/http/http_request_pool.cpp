@@ -0,0 +1,130 @@
+#include <server/http/http_request_pool.hpp>
+
+#include <new>
+#include <utility>
+
+#include <server/http/http_request_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+// Pipelined and HTTP/2 requests of a connection are handled concurrently
+constexpr std::size_t kMaxPooled = 8;
+
+// Bodies are rarely large, keeping a large buffer per connection is a waste
+constexpr std::size_t kMaxRecycledBodyCapacity = 64 * 1024;
+
+template <typename T>
+class RequestAllocator final {
+ public:
+  using value_type = T;
+
+  static_assert(alignof(T) <= alignof(std::max_align_t));
+
+  explicit RequestAllocator(std::shared_ptr<HttpRequestPool> pool) noexcept
+      : pool_(std::move(pool)) {}
+
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  RequestAllocator(const RequestAllocator<U>& other) noexcept
+      : pool_(other.GetPool()) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(pool_->AllocateBlock(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    pool_->DeallocateBlock(ptr, n * sizeof(T));
+  }
+
+  const std::shared_ptr<HttpRequestPool>& GetPool() const noexcept {
+    return pool_;
+  }
+
+  template <typename U>
+  bool operator==(const RequestAllocator<U>& other) const noexcept {
+    return pool_ == other.GetPool();
+  }
+
+  template <typename U>
+  bool operator!=(const RequestAllocator<U>& other) const noexcept {
+    return pool_ != other.GetPool();
+  }
+
+ private:
+  std::shared_ptr<HttpRequestPool> pool_;
+};
+
+}  // namespace
+
+HttpRequestPool::HttpRequestPool() {
+  blocks_.reserve(kMaxPooled);
+  storages_.reserve(kMaxPooled);
+}
+
+HttpRequestPool::~HttpRequestPool() {
+  for (void* block : blocks_) ::operator delete(block);
+}
+
+std::shared_ptr<HttpRequestImpl> HttpRequestPool::CreateRequest(
+    request::ResponseDataAccounter& data_accounter) {
+  auto self = shared_from_this();
+  return std::allocate_shared<HttpRequestImpl>(
+      RequestAllocator<HttpRequestImpl>{self}, data_accounter, self);
+}
+
+RecycledRequestStorage HttpRequestPool::TakeStorage() {
+  const std::lock_guard lock{mutex_};
+  if (storages_.empty()) return {};
+
+  auto storage = std::move(storages_.back());
+  storages_.pop_back();
+  return storage;
+}
+
+void HttpRequestPool::RecycleStorage(
+    RecycledRequestStorage&& storage) noexcept {
+  storage.url.clear();
+  storage.request_path.clear();
+  if (storage.request_body.capacity() > kMaxRecycledBodyCapacity) {
+    storage.request_body = std::string{};
+  } else {
+    storage.request_body.clear();
+  }
+  storage.headers.clear();
+
+  const std::lock_guard lock{mutex_};
+  // No reallocation, the capacity is reserved
+  if (storages_.size() < kMaxPooled) storages_.push_back(std::move(storage));
+}
+
+void* HttpRequestPool::AllocateBlock(std::size_t size) {
+  {
+    const std::lock_guard lock{mutex_};
+    if (block_size_ == 0) block_size_ = size;
+    if (size == block_size_ && !blocks_.empty()) {
+      void* block = blocks_.back();
+      blocks_.pop_back();
+      return block;
+    }
+  }
+  return ::operator new(size);
+}
+
+void HttpRequestPool::DeallocateBlock(void* ptr, std::size_t size) noexcept {
+  {
+    const std::lock_guard lock{mutex_};
+    if (size == block_size_ && blocks_.size() < kMaxPooled) {
+      blocks_.push_back(ptr);
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <userver/server/http/http_request.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::request {
+class ResponseDataAccounter;
+}  // namespace server::request
+
+namespace server::http {
+
+class HttpRequestImpl;
+
+/// Containers of a request that keep their capacity when recycled
+struct RecycledRequestStorage final {
+  std::string url;
+  std::string request_path;
+  std::string request_body;
+  HttpRequest::HeadersMap headers;
+};
+
+/// @brief Recycles the memory of the requests of a connection.
+///
+/// Each request is still constructed anew, so nothing of a request leaks into
+/// the next one. What is reused is the memory block of HttpRequestImpl with
+/// its HttpResponse and the shared_ptr control block, and the capacity of the
+/// URL, path, body and headers containers. A few requests are kept for the
+/// pipelined and HTTP/2 requests.
+///
+/// Requests hold the pool, so they may outlive the connection, and may be
+/// destroyed on any thread.
+class HttpRequestPool final
+    : public std::enable_shared_from_this<HttpRequestPool> {
+ public:
+  HttpRequestPool();
+  ~HttpRequestPool();
+
+  HttpRequestPool(const HttpRequestPool&) = delete;
+  HttpRequestPool& operator=(const HttpRequestPool&) = delete;
+
+  /// Creates a request, taking the memory from the pool if possible
+  std::shared_ptr<HttpRequestImpl> CreateRequest(
+      request::ResponseDataAccounter& data_accounter);
+
+  /// @returns the containers of a destroyed request or the empty ones
+  RecycledRequestStorage TakeStorage();
+
+  /// Keeps the containers of a destroyed request for the next ones
+  void RecycleStorage(RecycledRequestStorage&& storage) noexcept;
+
+  /// @{
+  /// Memory of the requests, used by the allocator of CreateRequest()
+  void* AllocateBlock(std::size_t size);
+  void DeallocateBlock(void* ptr, std::size_t size) noexcept;
+  /// @}
+
+ private:
+  std::mutex mutex_;
+  std::size_t block_size_{0};
+  std::vector<void*> blocks_;
+  std::vector<RecycledRequestStorage> storages_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
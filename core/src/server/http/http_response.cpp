@@ -18,6 +18,7 @@
 #include <userver/utils/small_string.hpp>
 
 #include <server/http/http_cached_date.hpp>
+#include <server/http/precomputed_headers.hpp>
 
 #include "http_request_impl.hpp"
 
@@ -256,6 +257,35 @@ const Cookie& HttpResponse::GetCookie(std::string_view cookie_name) const {
   return cookies_.at(cookie_name.data());
 }
 
+void HttpResponse::AppendBodySegment(std::shared_ptr<const void> owner,
+                                     std::string_view data) {
+  if (data.empty()) return;
+  body_segments_.push_back(BodySegment{std::move(owner), data});
+}
+
+void HttpResponse::AppendBodySegment(std::shared_ptr<const std::string> data) {
+  UASSERT(data);
+  const std::string_view view = *data;
+  AppendBodySegment(std::move(data), view);
+}
+
+void HttpResponse::ClearBodySegments() { body_segments_.clear(); }
+
+std::size_t HttpResponse::GetBodySize() const {
+  std::size_t size = GetData().size();
+  for (const auto& segment : body_segments_) size += segment.data.size();
+  return size;
+}
+
+void HttpResponse::SetPrecomputedHeaders(
+    const impl::PrecomputedHeaders& headers) {
+  if (headers_end_.IsReady()) {
+    // Attempt to set headers for Stream'ed response after it is already set
+    return;
+  }
+  precomputed_headers_ = &headers;
+}
+
 void HttpResponse::SetHeadersEnd() { headers_end_.Send(); }
 
 bool HttpResponse::WaitForHeadersEnd() { return headers_end_.WaitForEvent(); }
@@ -280,14 +310,16 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
   headers_.erase(USERVER_NAMESPACE::http::headers::kContentLength);
   const auto end = headers_.end();
   if (headers_.find(USERVER_NAMESPACE::http::headers::kDate) == end) {
-    impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kDate,
-                       // impl::GetCachedDate() must not cross thread boundaries
-                       impl::GetCachedDate());
+    // impl::GetCachedDateHeader() must not cross thread boundaries
+    header.append(impl::GetCachedDateHeader());
   }
   if (headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentType,
                        kDefaultContentType);
   }
+  if (precomputed_headers_) {
+    precomputed_headers_->OutputInHttpFormat(headers_, header);
+  }
   headers_.OutputInHttpFormat(header);
   if (headers_.find(USERVER_NAMESPACE::http::headers::kConnection) == end) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kConnection,
@@ -316,7 +348,7 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
   std::size_t sent_bytes{};
 
-  if (IsBodyStreamed() && GetData().empty()) {
+  if (IsBodyStreamed() && GetData().empty() && body_segments_.empty()) {
     sent_bytes = SetBodyStreamed(socket, header);
   } else {
     // e.g. a CustomHandlerException
@@ -332,14 +364,15 @@ std::size_t HttpResponse::SetBodyNotStreamed(
   const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
   const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
   const auto& data = GetData();
+  const auto body_size = GetBodySize();
 
   if (!is_body_forbidden) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentLength,
-                       fmt::format(FMT_COMPILE("{}"), data.size()));
+                       fmt::format(FMT_COMPILE("{}"), body_size));
   }
   header.append(kCrlf);
 
-  if (is_body_forbidden && !data.empty()) {
+  if (is_body_forbidden && body_size != 0) {
     LOG_LIMITED_WARNING()
         << "Non-empty body provided for response with HTTP code "
         << static_cast<int>(status_)
@@ -347,7 +380,19 @@ std::size_t HttpResponse::SetBodyNotStreamed(
   }
 
   ssize_t sent_bytes = 0;
-  if (!is_head_request && !is_body_forbidden) {
+  if (!is_head_request && !is_body_forbidden && !body_segments_.empty()) {
+    // Body segments are sent right from their owners' memory with a single
+    // writev where the socket supports it
+    std::vector<engine::io::IoData> io_data;
+    io_data.reserve(body_segments_.size() + 2);
+    io_data.push_back({header.data(), header.size()});
+    if (!data.empty()) io_data.push_back({data.data(), data.size()});
+    for (const auto& segment : body_segments_) {
+      io_data.push_back({segment.data.data(), segment.data.size()});
+    }
+    sent_bytes =
+        socket.WriteAll(io_data.data(), io_data.size(), engine::Deadline{});
+  } else if (!is_head_request && !is_body_forbidden) {
     sent_bytes = socket.WriteAll(
         {{header.data(), header.size()}, {data.data(), data.size()}},
         engine::Deadline{});
@@ -3,12 +3,14 @@
 #include <fmt/compile.h>
 #include <sstream>
 
+#include <userver/engine/io/common.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/utils/small_string.hpp>
 
 #include <server/http/http_request_impl.hpp>
+#include <server/http/precomputed_headers.hpp>
 #include <userver/server/request/response_base.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -148,11 +150,123 @@ void HttpResponseSetHeaderBenchmark(benchmark::State& state) {
   }
 }
 
+// Accepts everything and touches nothing, leaving only the response
+// serialization and body copying costs in the measurements
+class NullStream final : public engine::io::RwBase {
+ public:
+  bool IsValid() const override { return true; }
+
+  bool WaitReadable(engine::Deadline) override { return false; }
+
+  size_t ReadSome(void*, size_t, engine::Deadline) override { return 0; }
+
+  size_t ReadAll(void*, size_t, engine::Deadline) override { return 0; }
+
+  bool WaitWriteable(engine::Deadline) override { return true; }
+
+  size_t WriteAll(const void*, size_t len, engine::Deadline) override {
+    return len;
+  }
+
+  size_t WriteAll(const engine::io::IoData* list, std::size_t list_size,
+                  engine::Deadline) override {
+    size_t result = 0;
+    for (std::size_t i = 0; i < list_size; ++i) result += list[i].len;
+    return result;
+  }
+};
+
+// A body shared with some cache, e.g. a file from fs::FsCacheClient
+std::shared_ptr<const std::string> MakeSharedBody(benchmark::State& state) {
+  return std::make_shared<const std::string>(state.range(0), 'a');
+}
+
+void http_response_send_copied_body(benchmark::State& state) {
+  const auto body = MakeSharedBody(state);
+  server::request::ResponseDataAccounter accounter{};
+  NullStream stream;
+
+  for ([[maybe_unused]] auto _ : state) {
+    const server::http::HttpRequestImpl request_impl{accounter};
+    auto& response = request_impl.GetHttpResponse();
+    response.SetData(*body);
+    response.SendResponse(stream);
+    benchmark::DoNotOptimize(response.BytesSent());
+  }
+  state.SetBytesProcessed(state.iterations() * body->size());
+}
+
+void http_response_send_body_segment(benchmark::State& state) {
+  const auto body = MakeSharedBody(state);
+  server::request::ResponseDataAccounter accounter{};
+  NullStream stream;
+
+  for ([[maybe_unused]] auto _ : state) {
+    const server::http::HttpRequestImpl request_impl{accounter};
+    auto& response = request_impl.GetHttpResponse();
+    response.AppendBodySegment(body);
+    response.SendResponse(stream);
+    benchmark::DoNotOptimize(response.BytesSent());
+  }
+  state.SetBytesProcessed(state.iterations() * body->size());
+}
+
+constexpr std::string_view kServerName =
+    "userver/2.0 (20240601120000; rv:e20945c83fd)";
+constexpr std::string_view kServerHostname = "some-service-sas-01.example.net";
+
+// The headers that are the same for all the responses of a handler, set one
+// by one per request
+void http_response_send_handler_headers(benchmark::State& state) {
+  server::request::ResponseDataAccounter accounter{};
+  NullStream stream;
+
+  for ([[maybe_unused]] auto _ : state) {
+    const server::http::HttpRequestImpl request_impl{accounter};
+    auto& response = request_impl.GetHttpResponse();
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kServer,
+                       std::string{kServerName});
+    response.SetHeader(
+        USERVER_NAMESPACE::http::headers::kXYaTaxiServerHostname,
+        std::string{kServerHostname});
+    response.SetData("{}");
+    response.SendResponse(stream);
+    benchmark::DoNotOptimize(response.BytesSent());
+  }
+}
+
+// The same headers formatted once into a block
+void http_response_send_precomputed_headers(benchmark::State& state) {
+  server::http::impl::PrecomputedHeaders precomputed;
+  precomputed.Add(USERVER_NAMESPACE::http::headers::kServer, kServerName);
+  precomputed.Add(USERVER_NAMESPACE::http::headers::kXYaTaxiServerHostname,
+                  kServerHostname);
+  server::request::ResponseDataAccounter accounter{};
+  NullStream stream;
+
+  for ([[maybe_unused]] auto _ : state) {
+    const server::http::HttpRequestImpl request_impl{accounter};
+    auto& response = request_impl.GetHttpResponse();
+    response.SetPrecomputedHeaders(precomputed);
+    response.SetData("{}");
+    response.SendResponse(stream);
+    benchmark::DoNotOptimize(response.BytesSent());
+  }
+}
+
 }  // namespace
 
 BENCHMARK(http_headers_serialization_inplace);
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
 BENCHMARK(HttpResponseSetHeaderBenchmark);
+BENCHMARK(http_response_send_copied_body)
+    ->RangeMultiplier(8)
+    ->Range(1024, 1 << 20);
+BENCHMARK(http_response_send_body_segment)
+    ->RangeMultiplier(8)
+    ->Range(1024, 1 << 20);
+BENCHMARK(http_response_send_handler_headers);
+BENCHMARK(http_response_send_precomputed_headers);
 
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <gmock/gmock.h>
 
 #include <server/http/http_request_impl.hpp>
+#include <server/http/precomputed_headers.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/internal/net/net_listener.hpp>
@@ -46,6 +47,72 @@ UTEST(HttpResponse, Smoke) {
             fmt::format("\r\n\r\n{}", kBody));
 }
 
+UTEST(HttpResponse, BodySegments) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+
+  response.SetData("data;");
+  response.AppendBodySegment(std::make_shared<const std::string>("first;"));
+  const auto owner = std::make_shared<const std::string>("_second_");
+  response.AppendBodySegment(owner, std::string_view{*owner}.substr(1, 6));
+  EXPECT_EQ(response.GetBodySize(), 17);
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::vector<char> buffer(4096, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+  const std::string_view reply{buffer.data(), reply_size};
+  EXPECT_TRUE(reply.find(fmt::format("\r\n{}: 17\r\n",
+                                     http::headers::kContentLength)) !=
+              std::string_view::npos);
+  EXPECT_EQ(reply.substr(reply.size() - 21), "\r\n\r\ndata;first;second");
+}
+
+UTEST(HttpResponse, PrecomputedHeaders) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  server::http::impl::PrecomputedHeaders precomputed;
+  precomputed.Add(http::headers::kServer, "userver/test");
+  precomputed.Add(http::headers::kXYaTaxiServerHostname, "host");
+  EXPECT_THROW(precomputed.Add(http::headers::kServer, "bad\r\nvalue"),
+               std::runtime_error);
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+  response.SetPrecomputedHeaders(precomputed);
+  response.SetHeader(http::headers::kXYaTaxiServerHostname, "overridden");
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::vector<char> buffer(4096, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+  const std::string_view reply{buffer.data(), reply_size};
+  EXPECT_NE(reply.find("\r\nDate: "), std::string_view::npos);
+  EXPECT_NE(reply.find("\r\nServer: userver/test\r\n"),
+            std::string_view::npos);
+  EXPECT_NE(reply.find("\r\nX-YaTaxi-Server-Hostname: overridden\r\n"),
+            std::string_view::npos);
+  EXPECT_EQ(reply.find("host"), std::string_view::npos);
+}
+
 UTEST(HttpResponse, AccounterLifetimeIfNotSent) {
   auto accounter = std::make_unique<server::request::ResponseDataAccounter>();
   const server::http::HttpRequestImpl request{*accounter};
@@ -5,6 +5,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <algorithm>
 #include <array>
 
 USERVER_NAMESPACE_BEGIN
@@ -262,40 +263,19 @@ bool ParseMultipartFormDataHeaders(std::string_view& body,
   return SkipCrLf(body, crlf);
 }
 
-size_t FindBoundaryEnd(std::string_view body, std::string_view boundary,
-                       std::string_view crlf) {
-  size_t pos = 0;
-  while (pos < body.size()) {
-    if (body[pos] == crlf.front()) {
-      if (pos + crlf.size() < body.size() &&
-          body.substr(pos, crlf.size()) == crlf) {
-        pos += crlf.size();
-        if (pos < body.size() && body[pos] == '-') {
-          ++pos;
-          if (pos < body.size() && body[pos] == '-') {
-            ++pos;
-            size_t idx = 0;
-            while (idx < boundary.size() && pos + idx < body.size() &&
-                   body[pos + idx] == boundary[idx])
-              ++idx;
-            pos += idx;
-            if (idx == boundary.size()) return pos;
-          }
-        }
-      } else
-        ++pos;
-    } else
-      ++pos;
-  }
-  return std::string_view::npos;
+// Returns the position past the first "<crlf>--<boundary>" delimiter.
+// std::string_view::find() locates the candidates with memchr(), so the
+// content of large parts is scanned with vector instructions.
+size_t FindBoundaryEnd(std::string_view body, std::string_view delimiter) {
+  const auto pos = body.find(delimiter);
+  return pos == std::string_view::npos ? pos : pos + delimiter.size();
 }
 
 bool ParseMultipartFormDataValue(std::string_view& body,
-                                 std::string_view boundary,
+                                 std::string_view delimiter,
                                  FormDataArgInfo&& arg_info,
                                  std::optional<std::string>& charset,
-                                 FormDataArgs& form_data_args,
-                                 std::string_view crlf) {
+                                 FormDataArgs& form_data_args) {
   static const std::string kCharset = "_charset_";
 
   if (arg_info.arg.content_disposition.empty()) {
@@ -303,12 +283,12 @@ bool ParseMultipartFormDataValue(std::string_view& body,
     return false;
   }
 
-  size_t pos = FindBoundaryEnd(body, boundary, crlf);
+  const size_t pos = FindBoundaryEnd(body, delimiter);
   if (pos == std::string_view::npos) {
     LOG_WARNING() << "Unexpected end of form-data part value";
     return false;
   }
-  arg_info.arg.value = body.substr(0, pos - boundary.size() - 2 - crlf.size());
+  arg_info.arg.value = body.substr(0, pos - delimiter.size());
   if (arg_info.name == kCharset) {
     charset = arg_info.arg.value;
   } else {
@@ -328,15 +308,23 @@ bool ParseMultipartFormDataBody(std::string_view body,
                                 bool strict_cr_lf) {
   LOG_TRACE() << "body=" << body << ", body.size()=" << body.size();
   std::string_view crlf = "\r\n";
-  if (boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
-      body.substr(2, boundary.size()) == boundary) {
+  const bool starts_with_boundary =
+      boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
+      body.substr(2, boundary.size()) == boundary;
+  if (starts_with_boundary) {
     body.remove_prefix(2 + boundary.size());
-    if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
   } else {
-    while (!body.empty() && body.front() != kCr && body.front() != kLf)
-      body.remove_prefix(1);
-    if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
-    size_t pos = FindBoundaryEnd(body, boundary, crlf);
+    // Skip the preamble up to the line break before the first delimiter
+    body.remove_prefix(std::min(body.find_first_of("\r\n"), body.size()));
+  }
+  if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
+
+  std::string delimiter;
+  delimiter.reserve(crlf.size() + 2 + boundary.size());
+  delimiter.append(crlf).append("--").append(boundary);
+
+  if (!starts_with_boundary) {
+    const size_t pos = FindBoundaryEnd(body, delimiter);
     if (pos == std::string_view::npos) {
       LOG_WARNING() << "Unexpected request body end";
       return false;
@@ -381,8 +369,8 @@ bool ParseMultipartFormDataBody(std::string_view body,
     if (!ParseMultipartFormDataHeaders(body, arg_info, crlf)) return false;
     LOG_TRACE() << "ParseMultipartFormDataHeaders finished, body=" << body
                 << ", body.size()=" << body.size();
-    if (!ParseMultipartFormDataValue(body, boundary, std::move(arg_info),
-                                     charset, form_data_args, crlf)) {
+    if (!ParseMultipartFormDataValue(body, delimiter, std::move(arg_info),
+                                     charset, form_data_args)) {
       return false;
     }
   }
@@ -0,0 +1,57 @@
+#include <server/http/multipart_form_data_parser.hpp>
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kBoundary =
+    "------------------------8099aaf9723cd601";
+
+std::string MakeContentType() {
+  return "multipart/form-data; boundary=" + std::string{kBoundary};
+}
+
+// A few text fields and a file of the given size with line breaks and
+// hyphens in it, like in a typical upload form
+std::string MakeBody(std::size_t file_size) {
+  std::string body;
+  for (const auto* name : {"title", "description", "tags"}) {
+    body.append("--").append(kBoundary).append("\r\n");
+    body.append("Content-Disposition: form-data; name=\"")
+        .append(name)
+        .append("\"\r\n\r\n");
+    body.append("value of the ").append(name).append(" field\r\n");
+  }
+
+  body.append("--").append(kBoundary).append("\r\n");
+  body.append(
+      "Content-Disposition: form-data; name=\"file\"; "
+      "filename=\"report.csv\"\r\n"
+      "Content-Type: text/csv\r\n\r\n");
+  constexpr std::string_view kLine = "2023-10-01,order-42,-17.5,done\r\n";
+  while (body.size() < file_size) body.append(kLine);
+  body.append("\r\n--").append(kBoundary).append("--\r\n");
+  return body;
+}
+
+}  // namespace
+
+void multipart_form_data_parse(benchmark::State& state) {
+  const auto content_type = MakeContentType();
+  const auto body = MakeBody(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    server::http::FormDataArgs args;
+    benchmark::DoNotOptimize(
+        server::http::ParseMultipartFormData(content_type, body, args));
+    benchmark::DoNotOptimize(args);
+  }
+  state.SetBytesProcessed(state.iterations() * body.size());
+}
+
+BENCHMARK(multipart_form_data_parse)->Range(1 << 10, 16 << 20);
+
+USERVER_NAMESPACE_END
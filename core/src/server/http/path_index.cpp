@@ -0,0 +1,151 @@
+#include <server/http/path_index.hpp>
+
+#include <stdexcept>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+namespace {
+
+constexpr char kWildcardStart = '{';
+constexpr char kWildcardFinish = '}';
+
+std::string ExtractWildcardName(std::string_view str) {
+  if (str.empty() || str.front() != kWildcardStart ||
+      str.back() != kWildcardFinish) {
+    throw std::runtime_error("Incorrect wildcard '" + std::string{str} + '\'');
+  }
+
+  return std::string{str.substr(1, str.size() - 2)};
+}
+
+void FillArgsFromPath(std::string_view path,
+                      const std::vector<PathItem>& wildcards,
+                      std::size_t any_suffix_index,
+                      MatchRequestResult& match_result) {
+  auto wildcard_it = wildcards.begin();
+  std::size_t pos = 0;
+  for (std::size_t index = 0;; ++index) {
+    const auto slash = path.find('/', pos);
+    const auto segment = path.substr(pos, slash - pos);
+
+    if (index >= any_suffix_index) {
+      match_result.args_from_path.emplace_back(std::string{},
+                                               std::string{segment});
+    } else if (wildcard_it != wildcards.end() && wildcard_it->index == index) {
+      match_result.args_from_path.emplace_back(wildcard_it->name,
+                                               std::string{segment});
+      ++wildcard_it;
+    } else if (wildcard_it == wildcards.end() &&
+               any_suffix_index == PathTrieMatch::kNoAnySuffix) {
+      break;
+    }
+
+    if (slash == std::string_view::npos) break;
+    pos = slash + 1;
+  }
+}
+
+}  // namespace
+
+void PathIndex::AddHandler(const handlers::HttpHandlerBase& handler,
+                           engine::TaskProcessor& task_processor) {
+  const auto& path = std::get<std::string>(handler.GetConfig().path);
+  AddHandler(path, handler, task_processor);
+
+  auto url_trailing_slash = handler.GetConfig().url_trailing_slash;
+  if (url_trailing_slash == handlers::UrlTrailingSlashOption::kBoth &&
+      !path.empty()) {
+    if (path.back() == '/') {
+      if (path.size() > 1) {
+        if (path[path.size() - 2] == '/')
+          throw std::runtime_error(
+              "can't use 'url_trailing_slash' option with path ends with '//'");
+        AddHandler(path.substr(0, path.size() - 1), handler, task_processor);
+      }
+    } else if (path.back() == '*') {
+      if (path.size() > 1 && path[path.size() - 2] == '/') {
+        // ends with '/*' but not with '//*'
+        if (path.size() > 2 && path[path.size() - 3] == '/')
+          throw std::runtime_error(
+              "can't use 'url_trailing_slash' option with path ends with "
+              "'//*'");
+        AddHandler(path.substr(0, path.size() - 2), handler, task_processor);
+      } else {
+        throw std::runtime_error("incorrect path: '" + path +
+                                 "': trailing '*' allowed after '/' only");
+      }
+    } else {
+      AddHandler(path + '/', handler, task_processor);
+    }
+  }
+
+  // Handlers are added only before the server start, so the trie is cheap to
+  // rebuild for each of them
+  trie_.Compile();
+}
+
+bool PathIndex::MatchRequest(HttpMethod method, std::string_view path,
+                             MatchRequestResult& match_result) const {
+  return trie_.Match(path, [&](const HandlerMethodIndex& handler_method_index,
+                               const PathTrieMatch& match) {
+    const auto* handler_info_data =
+        handler_method_index.GetHandlerInfoData(method);
+    if (!handler_info_data) {
+      match_result.status = MatchRequestResult::Status::kMethodNotAllowed;
+      return false;
+    }
+
+    match_result.handler_info = &handler_info_data->handler_info;
+    match_result.matched_path_length = match.matched_path_length;
+    FillArgsFromPath(path, handler_info_data->wildcards,
+                     match.any_suffix_index, match_result);
+    match_result.status = MatchRequestResult::Status::kOk;
+    return true;
+  });
+}
+
+void PathIndex::AddHandler(const std::string& path,
+                           const handlers::HttpHandlerBase& handler,
+                           engine::TaskProcessor& task_processor) {
+  std::vector<PathItem> path_wildcards;
+  std::unordered_set<std::string> wildcard_names;
+  try {
+    std::size_t pos = 0;
+    for (std::size_t index = 0;; ++index) {
+      const auto slash = path.find('/', pos);
+      const auto path_elem = std::string_view{path}.substr(pos, slash - pos);
+      if (HasWildcardSpecificSymbols(path_elem)) {
+        path_wildcards.push_back(
+            ExtractWildcardPathItem(index, path_elem, wildcard_names));
+      }
+
+      if (slash == std::string::npos) break;
+      pos = slash + 1;
+    }
+  } catch (const std::exception& ex) {
+    throw std::runtime_error("Failed to process handler path '" + path +
+                             "': " + ex.what());
+  }
+
+  trie_.Emplace(path).AddHandler(handler, task_processor,
+                                 std::move(path_wildcards));
+}
+
+PathItem PathIndex::ExtractWildcardPathItem(
+    size_t index, std::string_view path_elem,
+    std::unordered_set<std::string>& wildcard_names) {
+  auto wildcard_name = ExtractWildcardName(path_elem);
+  if (!wildcard_name.empty()) {
+    auto res = wildcard_names.emplace(wildcard_name);
+    if (!res.second) {
+      throw std::runtime_error("duplicate wildcard name: '" + wildcard_name +
+                               '\'');
+    }
+  }
+  return PathItem{index, std::move(wildcard_name)};
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <server/http/handler_info_index.hpp>
 #include <server/http/handler_method_index.hpp>
+#include <server/http/path_trie.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_method.hpp>
 
@@ -14,18 +17,26 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::http::impl {
 
-class FixedPathIndex final {
+/// Index of the handlers by the paths with fixed segments, wildcards and
+/// the trailing '*'. Fixed paths take precedence over the wildcard ones.
+class PathIndex final {
  public:
   void AddHandler(const handlers::HttpHandlerBase& handler,
                   engine::TaskProcessor& task_processor);
-  bool MatchRequest(HttpMethod method, const std::string& path,
+
+  bool MatchRequest(HttpMethod method, std::string_view path,
                     MatchRequestResult& match_result) const;
 
  private:
-  void AddHandler(std::string path, const handlers::HttpHandlerBase& handler,
+  void AddHandler(const std::string& path,
+                  const handlers::HttpHandlerBase& handler,
                   engine::TaskProcessor& task_processor);
 
-  std::unordered_map<std::string, HandlerMethodIndex> handler_method_index_map_;
+  static PathItem ExtractWildcardPathItem(
+      size_t index, std::string_view path_elem,
+      std::unordered_set<std::string>& wildcard_names);
+
+  PathTrie<HandlerMethodIndex> trie_;
 };
 
 }  // namespace server::http::impl
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+inline bool HasWildcardSpecificSymbols(std::string_view path) {
+  return path.find_first_of("{}") != std::string_view::npos;
+}
+
+/// Result of a successful PathTrie::Match() for a route
+struct PathTrieMatch final {
+  static constexpr std::size_t kNoAnySuffix =
+      std::numeric_limits<std::size_t>::max();
+
+  /// Length of the path prefix matched by the route
+  std::size_t matched_path_length{0};
+
+  /// Index of the path segment matched by the trailing '*' of the route,
+  /// kNoAnySuffix if the whole path is matched
+  std::size_t any_suffix_index{kNoAnySuffix};
+};
+
+/// @brief Trie of the handler paths split into segments by '/'.
+///
+/// Segments of a route are either fixed strings or wildcards ("{name}"), a
+/// fixed "*" segment also matches any non-empty suffix of the path. Routes
+/// are added with Emplace() and Compile() flattens the trie into a vector of
+/// nodes, merging the chains of the fixed segments into a single edge. Match()
+/// walks the compiled trie over the path without splitting it or allocating.
+///
+/// On each segment the fixed edge is tried first, then the wildcard and then
+/// the '*' suffixes from the longest to the shortest one. Visitor may reject
+/// a matched route to continue the search, e.g. if the method is not allowed.
+template <typename Value>
+class PathTrie final {
+ public:
+  PathTrie() = default;
+
+  // Compiled nodes point to the values
+  PathTrie(const PathTrie&) = delete;
+  PathTrie(PathTrie&&) = default;
+  PathTrie& operator=(const PathTrie&) = delete;
+  PathTrie& operator=(PathTrie&&) = default;
+
+  /// Returns the value of the route, default constructs it on the first call.
+  /// Compile() must be called after the last route is added.
+  Value& Emplace(std::string_view route);
+
+  /// Rebuilds the trie used by Match() from the added routes
+  void Compile();
+
+  /// Calls `visitor(const Value&, const PathTrieMatch&)` for the routes
+  /// matching the path in the order of preference until it returns true.
+  /// @returns whether any route was accepted by the visitor
+  template <typename Visitor>
+  bool Match(std::string_view path, Visitor&& visitor) const;
+
+ private:
+  static constexpr std::uint32_t kNoNode =
+      std::numeric_limits<std::uint32_t>::max();
+
+  struct BuildNode final {
+    std::map<std::string, BuildNode, std::less<>> fixed;
+    std::unique_ptr<BuildNode> wildcard;
+    std::optional<Value> value;
+  };
+
+  struct Edge final {
+    std::string label;
+    std::size_t first_segment_size{0};
+    std::size_t segments{0};
+    std::uint32_t child{kNoNode};
+  };
+
+  struct Node final {
+    std::uint32_t edges_begin{0};
+    std::uint32_t edges_end{0};
+    std::uint32_t wildcard{kNoNode};
+    std::uint32_t any_suffix{kNoNode};
+    const Value* value{nullptr};
+  };
+
+  template <typename Visitor>
+  struct MatchContext final {
+    std::string_view path;
+    std::size_t segments;
+    Visitor& visitor;
+  };
+
+  std::uint32_t CompileNode(const BuildNode& build_node);
+
+  template <typename Visitor>
+  bool MatchNode(std::uint32_t node_index, std::size_t pos,
+                 std::size_t segment_index,
+                 MatchContext<Visitor>& context) const;
+
+  template <typename Visitor>
+  bool MatchAnySuffix(std::uint32_t node_index, std::size_t pos,
+                      std::size_t segment_index,
+                      MatchContext<Visitor>& context) const;
+
+  static bool IsAnySuffix(std::string_view segment) { return segment == "*"; }
+
+  BuildNode root_;
+  std::vector<Node> nodes_;
+  std::vector<Edge> edges_;
+};
+
+template <typename Value>
+Value& PathTrie<Value>::Emplace(std::string_view route) {
+  BuildNode* node = &root_;
+  std::size_t pos = 0;
+  while (true) {
+    const auto slash = route.find('/', pos);
+    const auto segment = route.substr(pos, slash - pos);
+    if (HasWildcardSpecificSymbols(segment)) {
+      if (!node->wildcard) node->wildcard = std::make_unique<BuildNode>();
+      node = node->wildcard.get();
+    } else {
+      auto it = node->fixed.find(segment);
+      if (it == node->fixed.end()) {
+        it = node->fixed.emplace(std::string{segment}, BuildNode{}).first;
+      }
+      node = &it->second;
+    }
+
+    if (slash == std::string_view::npos) break;
+    pos = slash + 1;
+  }
+
+  if (!node->value) node->value.emplace();
+  return *node->value;
+}
+
+template <typename Value>
+void PathTrie<Value>::Compile() {
+  nodes_.clear();
+  edges_.clear();
+  CompileNode(root_);
+}
+
+template <typename Value>
+std::uint32_t PathTrie<Value>::CompileNode(const BuildNode& build_node) {
+  const auto index = static_cast<std::uint32_t>(nodes_.size());
+  nodes_.emplace_back();
+  nodes_[index].value = build_node.value ? &*build_node.value : nullptr;
+
+  // Edges of a node are stored contiguously, so the children are compiled
+  // after all the edges are added. std::map keeps the edges ordered by the
+  // first segment for the lookup.
+  std::vector<const BuildNode*> children;
+  const auto edges_begin = static_cast<std::uint32_t>(edges_.size());
+  for (const auto& [segment, first_child] : build_node.fixed) {
+    Edge edge;
+    edge.label = segment;
+    edge.first_segment_size = segment.size();
+    edge.segments = 1;
+
+    const BuildNode* child = &first_child;
+    while (!IsAnySuffix(segment) && !child->value && !child->wildcard &&
+           child->fixed.size() == 1 &&
+           !IsAnySuffix(child->fixed.begin()->first)) {
+      edge.label += '/';
+      edge.label += child->fixed.begin()->first;
+      ++edge.segments;
+      child = &child->fixed.begin()->second;
+    }
+
+    edges_.push_back(std::move(edge));
+    children.push_back(child);
+  }
+  const auto edges_end = static_cast<std::uint32_t>(edges_.size());
+  nodes_[index].edges_begin = edges_begin;
+  nodes_[index].edges_end = edges_end;
+
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    const auto child_index = CompileNode(*children[i]);
+    auto& edge = edges_[edges_begin + i];
+    edge.child = child_index;
+    if (edge.segments == 1 && IsAnySuffix(edge.label)) {
+      nodes_[index].any_suffix = child_index;
+    }
+  }
+
+  if (build_node.wildcard) {
+    const auto wildcard_index = CompileNode(*build_node.wildcard);
+    nodes_[index].wildcard = wildcard_index;
+  }
+  return index;
+}
+
+template <typename Value>
+template <typename Visitor>
+bool PathTrie<Value>::Match(std::string_view path, Visitor&& visitor) const {
+  if (nodes_.empty()) return false;
+
+  const auto slashes = std::count(path.begin(), path.end(), '/');
+  MatchContext<Visitor> context{
+      path, static_cast<std::size_t>(slashes) + 1, visitor};
+  return MatchNode(0, 0, 0, context);
+}
+
+template <typename Value>
+template <typename Visitor>
+bool PathTrie<Value>::MatchNode(std::uint32_t node_index, std::size_t pos,
+                                std::size_t segment_index,
+                                MatchContext<Visitor>& context) const {
+  const auto& node = nodes_[node_index];
+  const auto path = context.path;
+
+  // pos is past the end of the path once its last segment is consumed
+  if (pos > path.size()) {
+    return node.value &&
+           context.visitor(
+               std::as_const(*node.value),
+               PathTrieMatch{path.size(), PathTrieMatch::kNoAnySuffix});
+  }
+
+  const auto rest = path.substr(pos);
+  const auto segment = rest.substr(0, rest.find('/'));
+
+  const auto edges_begin = edges_.begin() + node.edges_begin;
+  const auto edges_end = edges_.begin() + node.edges_end;
+  const auto edge_it =
+      std::lower_bound(edges_begin, edges_end, segment,
+                       [](const Edge& edge, std::string_view value) {
+                         return std::string_view{edge.label}.substr(
+                                    0, edge.first_segment_size) < value;
+                       });
+  if (edge_it != edges_end && edge_it->first_segment_size == segment.size()) {
+    const std::string_view label{edge_it->label};
+    if (rest.substr(0, label.size()) == label &&
+        (rest.size() == label.size() || rest[label.size()] == '/') &&
+        MatchNode(edge_it->child, pos + label.size() + 1,
+                  segment_index + edge_it->segments, context)) {
+      return true;
+    }
+  }
+
+  if (node.wildcard != kNoNode &&
+      MatchNode(node.wildcard, pos + segment.size() + 1, segment_index + 1,
+                context)) {
+    return true;
+  }
+
+  return node.any_suffix != kNoNode &&
+         MatchAnySuffix(node.any_suffix, pos, segment_index, context);
+}
+
+template <typename Value>
+template <typename Visitor>
+bool PathTrie<Value>::MatchAnySuffix(std::uint32_t node_index, std::size_t pos,
+                                     std::size_t segment_index,
+                                     MatchContext<Visitor>& context) const {
+  // Wildcards may follow the '*', the longest route that is not longer than
+  // the path wins
+  const Value* value = nullptr;
+  for (auto segments = segment_index + 1; node_index != kNoNode;
+       node_index = nodes_[node_index].wildcard, ++segments) {
+    if (segments > context.segments) break;
+    if (nodes_[node_index].value) value = nodes_[node_index].value;
+  }
+
+  UASSERT(segment_index < context.segments);
+  return value && context.visitor(std::as_const(*value),
+                                  PathTrieMatch{pos, segment_index});
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
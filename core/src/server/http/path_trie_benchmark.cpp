@@ -0,0 +1,91 @@
+#include <server/http/path_trie.hpp>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathTrie;
+using server::http::impl::PathTrieMatch;
+
+constexpr std::string_view kResources[] = {
+    "orders",   "users",    "drivers",  "payments", "cards",
+    "invoices", "routes",   "zones",    "tariffs",  "promocodes",
+    "reviews",  "messages", "settings", "devices",  "documents",
+};
+
+constexpr std::string_view kVersions[] = {"v1", "v2", "4.0", "internal"};
+
+constexpr std::string_view kSuffixes[] = {
+    "/list",
+    "/search",
+    "/bulk-retrieve",
+    "/{id}",
+    "/{id}/history",
+    "/{id}/items/{item_id}",
+    "/{id}/items/{item_id}/status",
+    "/{id}/files/*",
+    "/updates",
+    "/stats/{period}",
+};
+
+// 600 handlers with the same layout as in a typical service
+PathTrie<int> MakeRoutes() {
+  PathTrie<int> trie;
+  int handler = 0;
+  for (const auto version : kVersions) {
+    for (const auto resource : kResources) {
+      for (const auto suffix : kSuffixes) {
+        trie.Emplace(fmt::format("/{}/{}{}", version, resource, suffix)) =
+            handler++;
+      }
+    }
+  }
+  trie.Emplace("/ping") = handler++;
+  trie.Emplace("/static/*") = handler++;
+  trie.Compile();
+  return trie;
+}
+
+void RunMatch(benchmark::State& state, std::string_view path) {
+  const auto trie = MakeRoutes();
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        trie.Match(path, [](int handler, const PathTrieMatch& match) {
+          benchmark::DoNotOptimize(handler);
+          benchmark::DoNotOptimize(match);
+          return true;
+        }));
+  }
+}
+
+}  // namespace
+
+void path_trie_match_fixed(benchmark::State& state) {
+  RunMatch(state, "/4.0/promocodes/bulk-retrieve");
+}
+
+void path_trie_match_wildcards(benchmark::State& state) {
+  RunMatch(state,
+           "/internal/documents/e0c1e5f286a24b5da1e2/items/7f9b2c/status");
+}
+
+void path_trie_match_any_suffix(benchmark::State& state) {
+  RunMatch(state, "/v2/devices/f286a24b/files/2023/10/report.pdf");
+}
+
+void path_trie_match_not_found(benchmark::State& state) {
+  RunMatch(state, "/v3/orders/e0c1e5f286a24b5da1e2/items");
+}
+
+BENCHMARK(path_trie_match_fixed);
+BENCHMARK(path_trie_match_wildcards);
+BENCHMARK(path_trie_match_any_suffix);
+BENCHMARK(path_trie_match_not_found);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,169 @@
+#include <server/http/path_trie.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathTrie;
+using server::http::impl::PathTrieMatch;
+
+struct MatchResult {
+  std::string route;
+  std::size_t matched_path_length{0};
+  std::size_t any_suffix_index{PathTrieMatch::kNoAnySuffix};
+};
+
+class TestTrie final {
+ public:
+  TestTrie(std::initializer_list<std::string_view> routes) {
+    for (const auto route : routes) trie_.Emplace(route) = std::string{route};
+    trie_.Compile();
+  }
+
+  std::optional<MatchResult> Match(std::string_view path) const {
+    std::optional<MatchResult> result;
+    trie_.Match(path, [&](const std::string& route,
+                          const PathTrieMatch& match) {
+      result.emplace(MatchResult{route, match.matched_path_length,
+                                 match.any_suffix_index});
+      return true;
+    });
+    return result;
+  }
+
+  std::vector<std::string> MatchAll(std::string_view path) const {
+    std::vector<std::string> routes;
+    trie_.Match(path, [&](const std::string& route, const PathTrieMatch&) {
+      routes.push_back(route);
+      return false;
+    });
+    return routes;
+  }
+
+ private:
+  PathTrie<std::string> trie_;
+};
+
+std::string MatchedRoute(const TestTrie& trie, std::string_view path) {
+  const auto result = trie.Match(path);
+  return result ? result->route : "<none>";
+}
+
+}  // namespace
+
+TEST(PathTrie, Empty) {
+  PathTrie<int> trie;
+  EXPECT_FALSE(trie.Match("/", [](int, const PathTrieMatch&) { return true; }));
+  trie.Compile();
+  EXPECT_FALSE(trie.Match("/", [](int, const PathTrieMatch&) { return true; }));
+}
+
+TEST(PathTrie, Fixed) {
+  const TestTrie trie{"/", "/ping", "/v1/orders/list", "/v1/orders",
+                             "/v1/orders/", ""};
+
+  EXPECT_EQ(MatchedRoute(trie, "/"), "/");
+  EXPECT_EQ(MatchedRoute(trie, ""), "");
+  EXPECT_EQ(MatchedRoute(trie, "/ping"), "/ping");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/orders/list"), "/v1/orders/list");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/orders"), "/v1/orders");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/orders/"), "/v1/orders/");
+
+  EXPECT_EQ(MatchedRoute(trie, "/pin"), "<none>");
+  EXPECT_EQ(MatchedRoute(trie, "/pings"), "<none>");
+  EXPECT_EQ(MatchedRoute(trie, "/ping/"), "<none>");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/orders/lis"), "<none>");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/orders/list/"), "<none>");
+  EXPECT_EQ(MatchedRoute(trie, "//"), "<none>");
+
+  const auto result = trie.Match("/v1/orders/list");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->matched_path_length, 15);
+  EXPECT_EQ(result->any_suffix_index, PathTrieMatch::kNoAnySuffix);
+}
+
+TEST(PathTrie, Wildcards) {
+  const TestTrie trie{"/v1/{id}", "/v1/{id}/items/{item}",
+                             "/v1/{id}/", "/{a}/{b}/{c}"};
+
+  EXPECT_EQ(MatchedRoute(trie, "/v1/123"), "/v1/{id}");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/"), "/v1/{id}");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/123/"), "/v1/{id}/");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/123/items/4"), "/v1/{id}/items/{item}");
+  EXPECT_EQ(MatchedRoute(trie, "/v2/123/items"), "/{a}/{b}/{c}");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/123/item"), "/{a}/{b}/{c}");
+  EXPECT_EQ(MatchedRoute(trie, "/v1/123/items/4/"), "<none>");
+  EXPECT_EQ(MatchedRoute(trie, "/v1"), "<none>");
+}
+
+TEST(PathTrie, FixedBeforeWildcard) {
+  const TestTrie trie{"/a/{x}", "/{y}/b", "/a/b/{z}", "/a/b/c"};
+
+  EXPECT_EQ(MatchedRoute(trie, "/a/b"), "/a/{x}");
+  EXPECT_EQ(MatchedRoute(trie, "/c/b"), "/{y}/b");
+  EXPECT_EQ(MatchedRoute(trie, "/a/b/c"), "/a/b/c");
+  EXPECT_EQ(MatchedRoute(trie, "/a/b/d"), "/a/b/{z}");
+
+  EXPECT_EQ(trie.MatchAll("/a/b"),
+            (std::vector<std::string>{"/a/{x}", "/{y}/b"}));
+}
+
+TEST(PathTrie, AnySuffix) {
+  const TestTrie trie{"/static/*", "/static/img/*", "/static/img/logo",
+                             "/{x}/*", "/api/*/{tail}"};
+
+  EXPECT_EQ(MatchedRoute(trie, "/static/index.html"), "/static/*");
+  EXPECT_EQ(MatchedRoute(trie, "/static/img/a/b.png"), "/static/img/*");
+  EXPECT_EQ(MatchedRoute(trie, "/static/img/logo"), "/static/img/logo");
+  EXPECT_EQ(MatchedRoute(trie, "/static/img/"), "/static/img/*");
+  EXPECT_EQ(MatchedRoute(trie, "/static/img"), "/static/*");
+  EXPECT_EQ(MatchedRoute(trie, "/static"), "<none>");
+  EXPECT_EQ(MatchedRoute(trie, "/other/a/b"), "/{x}/*");
+  EXPECT_EQ(MatchedRoute(trie, "/api/a"), "/{x}/*");
+  EXPECT_EQ(MatchedRoute(trie, "/api/a/b"), "/api/*/{tail}");
+  EXPECT_EQ(MatchedRoute(trie, "/api/a/b/c"), "/api/*/{tail}");
+
+  EXPECT_EQ(trie.MatchAll("/static/img/logo"),
+            (std::vector<std::string>{"/static/img/logo", "/static/img/*",
+                                      "/static/*", "/{x}/*"}));
+
+  auto result = trie.Match("/static/img/a/b.png");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->matched_path_length, 12);
+  EXPECT_EQ(result->any_suffix_index, 3);
+
+  result = trie.Match("/other/a/b");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->matched_path_length, 7);
+  EXPECT_EQ(result->any_suffix_index, 2);
+}
+
+TEST(PathTrie, AsteriskMatchesLiterally) {
+  const TestTrie trie{"/a/*/b", "/a/{x}"};
+
+  EXPECT_EQ(MatchedRoute(trie, "/a/*/b"), "/a/*/b");
+  EXPECT_EQ(MatchedRoute(trie, "/a/*"), "/a/{x}");
+  EXPECT_EQ(MatchedRoute(trie, "/a/c/b"), "<none>");
+}
+
+TEST(PathTrie, EmplaceReturnsSameValue) {
+  PathTrie<int> trie;
+  trie.Emplace("/a/{x}") = 1;
+  trie.Emplace("/a/{y}") += 1;
+  trie.Compile();
+
+  int value = 0;
+  EXPECT_TRUE(trie.Match("/a/b", [&](int route_value, const PathTrieMatch&) {
+    value = route_value;
+    return true;
+  }));
+  EXPECT_EQ(value, 2);
+}
+
+USERVER_NAMESPACE_END
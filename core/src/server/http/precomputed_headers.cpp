@@ -0,0 +1,70 @@
+#include <server/http/precomputed_headers.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <userver/utils/small_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+constexpr std::string_view kCrlf = "\r\n";
+constexpr std::string_view kKeyValueHeaderSeparator = ": ";
+
+std::string ToLowerAscii(std::string_view value) {
+  std::string result{value};
+  for (auto& c : result) {
+    if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+  }
+  return result;
+}
+
+}  // namespace
+
+void PrecomputedHeaders::Add(
+    const USERVER_NAMESPACE::http::headers::PredefinedHeader& name,
+    std::string_view value) {
+  const auto is_invalid = [](char c) {
+    const auto code = static_cast<unsigned char>(c);
+    return code < 32 || code == 127;
+  };
+  if (std::any_of(value.begin(), value.end(), is_invalid)) {
+    throw std::runtime_error(
+        "invalid character in the value of precomputed header '" +
+        std::string{name} + "'");
+  }
+
+  Entry entry{name, ToLowerAscii(name)};
+  entry.line_offset = block_.size();
+  block_.append(std::string_view{name}).append(kKeyValueHeaderSeparator);
+  entry.value_offset = block_.size();
+  entry.value_size = value.size();
+  block_.append(value).append(kCrlf);
+  entry.line_size = block_.size() - entry.line_offset;
+  entries_.push_back(std::move(entry));
+}
+
+void PrecomputedHeaders::OutputInHttpFormat(
+    const USERVER_NAMESPACE::http::headers::HeaderMap& headers,
+    USERVER_NAMESPACE::http::headers::HeadersString& header) const {
+  const auto is_overridden = [&headers](const Entry& entry) {
+    return headers.find(entry.name) != headers.end();
+  };
+
+  if (headers.empty() ||
+      std::none_of(entries_.begin(), entries_.end(), is_overridden)) {
+    header.append(block_);
+    return;
+  }
+
+  for (const auto& entry : entries_) {
+    if (!is_overridden(entry)) header.append(GetLine(entry));
+  }
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
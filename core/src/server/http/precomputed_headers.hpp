@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/http/header_map.hpp>
+#include <userver/http/predefined_header.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// @brief Response headers that are the same for all the responses of a
+/// handler, formatted once into a single block.
+///
+/// The headers set with HttpResponse::SetHeader() take precedence over the
+/// precomputed ones.
+class PrecomputedHeaders final {
+ public:
+  /// @throws std::runtime_error if the value is not a valid header value
+  void Add(const USERVER_NAMESPACE::http::headers::PredefinedHeader& name,
+           std::string_view value);
+
+  /// Appends the headers missing from `headers` in HTTP/1.1 format, usually
+  /// with a single copy of the block
+  void OutputInHttpFormat(
+      const USERVER_NAMESPACE::http::headers::HeaderMap& headers,
+      USERVER_NAMESPACE::http::headers::HeadersString& header) const;
+
+  /// Calls `func(lowercase_name, value)` for the headers missing from
+  /// `headers`, the names are ready for HTTP/2
+  template <typename Func>
+  void ForEachMissing(
+      const USERVER_NAMESPACE::http::headers::HeaderMap& headers,
+      Func&& func) const {
+    for (const auto& entry : entries_) {
+      if (headers.find(entry.name) != headers.end()) continue;
+      func(std::string_view{entry.lowercase_name}, GetValue(entry));
+    }
+  }
+
+ private:
+  struct Entry final {
+    USERVER_NAMESPACE::http::headers::PredefinedHeader name;
+    std::string lowercase_name;
+    // "Name: value\r\n" line in block_
+    std::size_t line_offset{0};
+    std::size_t line_size{0};
+    std::size_t value_offset{0};
+    std::size_t value_size{0};
+  };
+
+  std::string_view GetLine(const Entry& entry) const {
+    return std::string_view{block_}.substr(entry.line_offset, entry.line_size);
+  }
+
+  std::string_view GetValue(const Entry& entry) const {
+    return std::string_view{block_}.substr(entry.value_offset,
+                                           entry.value_size);
+  }
+
+  std::string block_;
+  std::vector<Entry> entries_;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
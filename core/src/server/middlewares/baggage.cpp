@@ -21,8 +21,8 @@ void SetUpBaggage(const http::HttpRequest& http_request,
     if (!baggage_header.empty()) {
       LOG_DEBUG() << "Got baggage header: " << baggage_header;
       const auto& baggage_settings = config_snapshot[baggage::kBaggageSettings];
-      auto baggage = baggage::TryMakeBaggage(std::move(baggage_header),
-                                             baggage_settings.allowed_keys);
+      auto baggage = baggage::TryMakeBaggage(
+          std::move(baggage_header), baggage_settings.shared_allowed_keys);
       if (baggage) {
         baggage::kInheritedBaggage.Set(std::move(*baggage));
       }
@@ -0,0 +1,95 @@
+#include <server/middlewares/compression.hpp>
+
+#include <array>
+
+#include <compression/brotli.hpp>
+#include <compression/gzip.hpp>
+#include <server/handlers/http_server_settings.hpp>
+#include <server/http/content_coding.hpp>
+#include <server/request/internal_request_context.hpp>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/server/request/request_context.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+// In order of preference for the same q-value
+constexpr std::array kOfferedCodings{
+    http::ContentCoding::kZstd,
+    http::ContentCoding::kBrotli,
+    http::ContentCoding::kGzip,
+};
+
+std::string Compress(std::string_view data, http::ContentCoding coding,
+                     const handlers::ResponseCompression& config) {
+  switch (coding) {
+    case http::ContentCoding::kGzip:
+      return compression::gzip::Compress(data, config.gzip_level);
+    case http::ContentCoding::kZstd:
+      return compression::zstd::Compress(data, config.zstd_level);
+    case http::ContentCoding::kBrotli:
+      return compression::brotli::Compress(data, config.brotli_level);
+    case http::ContentCoding::kIdentity:
+      break;
+  }
+  UINVARIANT(false, "Unexpected content coding");
+}
+
+void CompressResponseBody(const http::HttpRequest& request,
+                          const handlers::ResponseCompression& config) {
+  auto& response = request.GetHttpResponse();
+  const auto& body = response.GetData();
+
+  // Streamed bodies are sent as they are produced and the body segments are
+  // shared with their owners, e.g. the precompressed static files
+  if (response.IsBodyStreamed() || body.size() != response.GetBodySize() ||
+      body.size() < config.min_size ||
+      response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding)) {
+    return;
+  }
+
+  http::AddVaryAcceptEncoding(response);
+  const auto coding = http::NegotiateContentCoding(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding),
+      kOfferedCodings);
+  if (coding == http::ContentCoding::kIdentity) return;
+
+  std::string compressed;
+  try {
+    compressed = Compress(body, coding, config);
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to compress the response body with "
+                  << http::ToString(coding) << ": " << e;
+    return;
+  }
+  if (compressed.size() >= body.size()) return;
+
+  response.SetData(std::move(compressed));
+  response.SetContentEncoding(std::string{http::ToString(coding)});
+}
+
+}  // namespace
+
+Compression::Compression(const handlers::HttpHandlerBase&) {}
+
+void Compression::HandleRequest(http::HttpRequest& request,
+                                request::RequestContext& context) const {
+  Next(request, context);
+
+  const auto& config = context.GetInternalContext()
+                           .GetConfigSnapshot()[handlers::kResponseCompression];
+  if (config.enabled) CompressResponseBody(request, config);
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+/// Compresses the response body with one of the codings of the
+/// Accept-Encoding header of the request, see
+/// @ref USERVER_HTTP_RESPONSE_COMPRESSION
+class Compression final : public HttpMiddlewareBase {
+ public:
+  static constexpr std::string_view kName = builtin::kCompression;
+
+  explicit Compression(const handlers::HttpHandlerBase&);
+
+ private:
+  void HandleRequest(http::HttpRequest& request,
+                     request::RequestContext& context) const override;
+};
+
+using CompressionFactory = SimpleHttpMiddlewareFactory<Compression>;
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
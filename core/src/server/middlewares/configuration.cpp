@@ -8,6 +8,7 @@
 
 #include <server/middlewares/auth.hpp>
 #include <server/middlewares/baggage.hpp>
+#include <server/middlewares/compression.hpp>
 #include <server/middlewares/deadline_propagation.hpp>
 #include <server/middlewares/decompression.hpp>
 #include <server/middlewares/exceptions_handling.hpp>
@@ -25,6 +26,9 @@ MiddlewaresList DefaultPipeline() {
   return {
       // Metrics should go before everything else, basically.
       std::string{builtin::kHandlerMetrics},
+      // Compression should go before Tracing, so that the uncompressed
+      // response body is logged
+      std::string{builtin::kCompression},
       // Tracing should go before UnknownExceptionsHandlingMiddleware because it
       // adds some headers, which otherwise might be cleared
       std::string{builtin::kTracing},
@@ -56,6 +60,7 @@ MiddlewaresList DefaultPipeline() {
 components::ComponentList DefaultMiddlewareComponents() {
   return MinimalMiddlewareComponents()
       .Append<HandlerMetricsFactory>()
+      .Append<CompressionFactory>()
       .Append<TracingFactory>()
       .Append<BaggageFactory>()
       .Append<RateLimitFactory>()
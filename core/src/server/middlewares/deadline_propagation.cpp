@@ -65,6 +65,7 @@ void SetFormattedErrorResponse(
     http::HttpResponse& http_response,
     handlers::FormattedErrorData&& formatted_error_data) {
   http_response.SetData(std::move(formatted_error_data.external_body));
+  http_response.ClearBodySegments();
   if (formatted_error_data.content_type) {
     http_response.SetContentType(*std::move(formatted_error_data.content_type));
   }
@@ -1,5 +1,6 @@
 #include <server/middlewares/decompression.hpp>
 
+#include <compression/brotli.hpp>
 #include <compression/gzip.hpp>
 #include <userver/compression/zstd.hpp>
 
@@ -37,7 +38,9 @@ void Decompression::HandleRequest(http::HttpRequest& request,
 }
 
 bool Decompression::DecompressRequestBody(http::HttpRequest& request) const {
-  if (!decompress_request_ || !request.IsBodyCompressed()) {
+  // Streamed body chunks are passed to the handler as is
+  if (!decompress_request_ || !request.IsBodyCompressed() ||
+      request.IsBodyStreamed()) {
     return true;
   }
 
@@ -57,6 +60,8 @@ bool Decompression::DecompressRequestBody(http::HttpRequest& request) const {
       function_ptr = &compression::gzip::Decompress;
     } else if (content_encoding == "zstd") {
       function_ptr = &compression::zstd::Decompress;
+    } else if (content_encoding == "br") {
+      function_ptr = &compression::brotli::Decompress;
     }
 
     if (function_ptr) {
@@ -111,7 +116,7 @@ void SetAcceptEncoding::SetResponseAcceptEncoding(
   // User didn't set Accept-Encoding, let us do that
   if (!response.HasHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding)) {
     response.SetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding,
-                       "gzip, zstd, identity");
+                       "gzip, zstd, br, identity");
   }
 }
 
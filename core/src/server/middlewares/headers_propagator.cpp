@@ -25,8 +25,12 @@ void HeadersPropagator::HandleRequest(http::HttpRequest& request,
     }
     headers_to_propagate.emplace(header_name, request.GetHeader(header_name));
   }
-  USERVER_NAMESPACE::server::request::SetTaskInheritedHeaders(
-      headers_to_propagate);
+  // The headers are copied once per incoming request, the outgoing requests
+  // of all its subtasks share them via the inherited variable
+  if (!headers_to_propagate.empty()) {
+    USERVER_NAMESPACE::server::request::SetTaskInheritedHeaders(
+        std::move(headers_to_propagate));
+  }
   Next(request, context);
 }
 HeadersPropagatorFactory::HeadersPropagatorFactory(
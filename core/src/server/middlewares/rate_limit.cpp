@@ -2,15 +2,80 @@
 
 #include <server/handlers/http_handler_base_statistics.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/server/handlers/exceptions.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::middlewares {
 
+// Counts the requests for the controller and keeps the limit it sets
+class RateLimit::AdaptiveConcurrencyLimit final
+    : public USERVER_NAMESPACE::congestion_control::v2::Sensor,
+      public USERVER_NAMESPACE::congestion_control::Limiter {
+ public:
+  static constexpr std::size_t kNoLimit =
+      std::numeric_limits<std::size_t>::max();
+
+  AdaptiveConcurrencyLimit(
+      const std::string& name,
+      const USERVER_NAMESPACE::congestion_control::v2::GradientConfig& config)
+      : controller_(name, *this, *this, stats_, config) {
+    controller_.Start();
+  }
+
+  ~AdaptiveConcurrencyLimit() override { controller_.Stop(); }
+
+  // On success the request must be finished with Finish()
+  bool TryStart() noexcept {
+    if (++in_flight_ > limit_.load(std::memory_order_relaxed)) {
+      --in_flight_;
+      return false;
+    }
+    return true;
+  }
+
+  void Finish(std::chrono::steady_clock::duration timing) noexcept {
+    --in_flight_;
+    timings_sum_us_ +=
+        std::chrono::duration_cast<std::chrono::microseconds>(timing).count();
+    ++finished_;
+  }
+
+  std::size_t GetLimit() const noexcept { return limit_; }
+
+  Data GetCurrent() override {
+    Data data;
+    data.total = finished_.exchange(0);
+    const auto timings_sum_us = timings_sum_us_.exchange(0);
+    if (data.total) data.timings_avg_ms = timings_sum_us / data.total / 1000;
+    data.current_load = in_flight_;
+    return data;
+  }
+
+  void SetLimit(
+      const USERVER_NAMESPACE::congestion_control::Limit& new_limit) override {
+    limit_ = new_limit.load_limit.value_or(kNoLimit);
+  }
+
+ private:
+  std::atomic<std::size_t> in_flight_{0};
+  std::atomic<std::size_t> finished_{0};
+  std::atomic<std::size_t> timings_sum_us_{0};
+  std::atomic<std::size_t> limit_{kNoLimit};
+
+  USERVER_NAMESPACE::congestion_control::v2::Stats stats_;
+  USERVER_NAMESPACE::congestion_control::v2::GradientController controller_;
+};
+
 RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
     : rate_limit_{utils::TokenBucket::MakeUnbounded()},
       statistics_{handler.GetHandlerStatistics()},
@@ -26,15 +91,51 @@ RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
     rate_limit_.SetRefillPolicy(
         {1, utils::TokenBucket::Duration{std::chrono::seconds(1)} / max_rps});
   }
+
+  const auto& adaptive_config = handler.GetConfig().adaptive_concurrency_limit;
+  if (adaptive_config) {
+    adaptive_limit_ = std::make_unique<AdaptiveConcurrencyLimit>(
+        "handler " + handler.HandlerName(), *adaptive_config);
+  }
 }
 
+RateLimit::~RateLimit() = default;
+
 void RateLimit::HandleRequest(http::HttpRequest& request,
                               request::RequestContext& context) const {
-  if (CheckRateLimit(request)) {
+  if (!CheckRateLimit(request)) return;
+
+  if (adaptive_limit_) {
+    HandleWithAdaptiveLimit(request, context);
+  } else {
     Next(request, context);
   }
 }
 
+void RateLimit::HandleWithAdaptiveLimit(
+    http::HttpRequest& request, request::RequestContext& context) const {
+  if (!adaptive_limit_->TryStart()) {
+    auto& http_response = request.GetHttpResponse();
+    auto log_reason = fmt::format("reached adaptive concurrency limit={}",
+                                  adaptive_limit_->GetLimit());
+    SetThrottleReason(
+        http_response, std::move(log_reason),
+        std::string{
+            USERVER_NAMESPACE::http::headers::ratelimit_reason::kInFlight});
+    statistics_.ForMethod(request.GetMethod())
+        .IncrementTooManyRequestsInFlight();
+
+    FailProcessingAndSetResponse(request);
+    return;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const utils::FastScopeGuard finish_guard{[this, start]() noexcept {
+    adaptive_limit_->Finish(std::chrono::steady_clock::now() - start);
+  }};
+  Next(request, context);
+}
+
 bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
   auto& statistics = statistics_.ForMethod(request.GetMethod());
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 
 #include <userver/server/middlewares/builtin.hpp>
@@ -20,12 +21,19 @@ class RateLimit final : public HttpMiddlewareBase {
 
   explicit RateLimit(const handlers::HttpHandlerBase&);
 
+  ~RateLimit() override;
+
  private:
+  class AdaptiveConcurrencyLimit;
+
   void HandleRequest(http::HttpRequest& request,
                      request::RequestContext& context) const override;
 
   bool CheckRateLimit(const http::HttpRequest& request) const;
 
+  void HandleWithAdaptiveLimit(http::HttpRequest& request,
+                               request::RequestContext& context) const;
+
   void FailProcessingAndSetResponse(const http::HttpRequest& request) const;
 
   mutable utils::TokenBucket rate_limit_;
@@ -33,6 +41,7 @@ class RateLimit final : public HttpMiddlewareBase {
 
   std::optional<std::size_t> max_requests_per_second_;
   std::optional<std::size_t> max_requests_in_flight_;
+  std::unique_ptr<AdaptiveConcurrencyLimit> adaptive_limit_;
 
   const handlers::HttpHandlerBase& handler_;
 };
@@ -0,0 +1,87 @@
+#include <server/net/coalescing_writer.hpp>
+
+#include <vector>
+
+#include <userver/engine/io/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+CoalescingWriter::CoalescingWriter(engine::io::RwBase& stream)
+    : stream_(stream) {}
+
+bool CoalescingWriter::IsValid() const { return stream_.IsValid(); }
+
+bool CoalescingWriter::WaitReadable(engine::Deadline deadline) {
+  return stream_.WaitReadable(deadline);
+}
+
+size_t CoalescingWriter::ReadSome(void* buf, size_t len,
+                                  engine::Deadline deadline) {
+  return stream_.ReadSome(buf, len, deadline);
+}
+
+size_t CoalescingWriter::ReadAll(void* buf, size_t len,
+                                 engine::Deadline deadline) {
+  return stream_.ReadAll(buf, len, deadline);
+}
+
+bool CoalescingWriter::WaitWriteable(engine::Deadline deadline) {
+  return stream_.WaitWriteable(deadline);
+}
+
+size_t CoalescingWriter::WriteAll(const void* buf, size_t len,
+                                  engine::Deadline deadline) {
+  const engine::io::IoData io_data{buf, len};
+  return WriteAll(&io_data, 1, deadline);
+}
+
+size_t CoalescingWriter::WriteAll(
+    std::initializer_list<engine::io::IoData> list, engine::Deadline deadline) {
+  return WriteAll(list.begin(), list.size(), deadline);
+}
+
+size_t CoalescingWriter::WriteAll(const engine::io::IoData* list,
+                                  std::size_t list_size,
+                                  engine::Deadline deadline) {
+  std::size_t total_size = 0;
+  for (std::size_t i = 0; i < list_size; ++i) total_size += list[i].len;
+
+  if (buffer_.size() + total_size <= kMaxBufferSize) {
+    for (std::size_t i = 0; i < list_size; ++i) {
+      buffer_.append(static_cast<const char*>(list[i].data), list[i].len);
+    }
+    return total_size;
+  }
+
+  // Too big to be buffered, send it along with the buffered data
+  std::vector<engine::io::IoData> io_data;
+  io_data.reserve(list_size + 1);
+  if (!buffer_.empty()) io_data.push_back({buffer_.data(), buffer_.size()});
+  io_data.insert(io_data.end(), list, list + list_size);
+
+  const auto buffered_size = buffer_.size();
+  const auto sent = stream_.WriteAll(io_data.data(), io_data.size(), deadline);
+  buffer_.clear();
+  if (sent < buffered_size + total_size) {
+    throw engine::io::IoException("Connection closed by peer while sending");
+  }
+  return total_size;
+}
+
+bool CoalescingWriter::Flush(engine::Deadline deadline) {
+  if (buffer_.empty()) return false;
+
+  const auto sent = stream_.WriteAll(buffer_.data(), buffer_.size(), deadline);
+  const auto buffered_size = buffer_.size();
+  buffer_.clear();
+  if (sent < buffered_size) {
+    throw engine::io::IoException("Connection closed by peer while sending");
+  }
+  return true;
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <userver/engine/io/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+/// Buffers small writes to the underlying stream until Flush(), so that
+/// several pipelined responses go out with a single syscall. Writes that do
+/// not fit into the buffer are sent right away, together with the buffered
+/// data. Reading is passed through to the underlying stream.
+class CoalescingWriter final : public engine::io::RwBase {
+ public:
+  static constexpr std::size_t kMaxBufferSize = 64 * 1024;
+
+  explicit CoalescingWriter(engine::io::RwBase& stream);
+
+  CoalescingWriter(CoalescingWriter&&) = delete;
+  CoalescingWriter& operator=(CoalescingWriter&&) = delete;
+
+  bool IsValid() const override;
+
+  [[nodiscard]] bool WaitReadable(engine::Deadline deadline) override;
+
+  [[nodiscard]] size_t ReadSome(void* buf, size_t len,
+                                engine::Deadline deadline) override;
+
+  [[nodiscard]] size_t ReadAll(void* buf, size_t len,
+                               engine::Deadline deadline) override;
+
+  [[nodiscard]] bool WaitWriteable(engine::Deadline deadline) override;
+
+  [[nodiscard]] size_t WriteAll(const void* buf, size_t len,
+                                engine::Deadline deadline) override;
+
+  [[nodiscard]] size_t WriteAll(std::initializer_list<engine::io::IoData> list,
+                                engine::Deadline deadline) override;
+
+  [[nodiscard]] size_t WriteAll(const engine::io::IoData* list,
+                                std::size_t list_size,
+                                engine::Deadline deadline) override;
+
+  /// Sends the buffered data, returns false if there was nothing to send.
+  bool Flush(engine::Deadline deadline);
+
+  bool IsEmpty() const noexcept { return buffer_.empty(); }
+
+ private:
+  engine::io::RwBase& stream_;
+  std::string buffer_;
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
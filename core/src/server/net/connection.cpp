@@ -1,15 +1,20 @@
 #include "connection.hpp"
 
+#include <algorithm>
 #include <array>
+#include <optional>
 #include <system_error>
+#include <utility>
 #include <vector>
 
 #include <server/http/request_handler_base.hpp>
+#include <server/net/coalescing_writer.hpp>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/exception.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/wait_any.hpp>
 #include <userver/logging/log.hpp>
@@ -21,6 +26,34 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+struct Connection::Http2Event final {
+  enum class Type {
+    // Bytes received from the peer, empty once the peer closed the connection
+    kData,
+    // The handler has finished or has set the headers of a streamed body
+    kResponseReady,
+    kBodyChunk,
+    kBodyEnd,
+  };
+
+  Type type{Type::kData};
+  std::shared_ptr<request::RequestBase> request{};
+  std::string data{};
+};
+
+struct Connection::Http2Stream final {
+  explicit Http2Stream(std::shared_ptr<request::RequestBase>&& request)
+      : request(std::move(request)) {}
+
+  const std::shared_ptr<request::RequestBase> request;
+  // Sent once the session has consumed the chunks of a streamed body
+  engine::SingleConsumerEvent body_wanted;
+  engine::TaskWithResult<void> request_task;
+  // Waits for the handler and forwards the streamed body to the session loop,
+  // destroyed first
+  engine::TaskWithResult<void> task;
+};
+
 Connection::Connection(
     const ConnectionConfig& config,
     const request::HttpRequestConfig& handler_defaults_config,
@@ -44,6 +77,8 @@ Connection::Connection(
   ++stats_->connections_created;
 }
 
+Connection::~Connection() = default;
+
 void Connection::Process() {
   LOG_TRACE() << "Starting socket listener for fd " << Fd();
 
@@ -67,6 +102,12 @@ void Connection::Shutdown() noexcept {
                  "requests) for fd "
               << Fd();
 
+  if (body_stream_task_) {
+    // The connection was closed before the end of the body
+    body_stream_task_.reset();
+    stats_->active_request_count.Subtract(1);
+  }
+  http2_session_.reset();
   peer_socket_.reset();
 
   --stats_->active_connections;
@@ -78,13 +119,24 @@ void Connection::ListenForRequests() noexcept {
 
   try {
     std::vector<RequestBasePtr> pending_requests;
-
-    http::HttpRequestParser request_parser(
-        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
-        [&pending_requests](RequestBasePtr&& request_ptr) {
-          pending_requests.push_back(std::move(request_ptr));
-        },
-        stats_->parser_stats, data_accounter_);
+    const auto on_new_request = [&pending_requests](
+                                    RequestBasePtr&& request_ptr) {
+      pending_requests.push_back(std::move(request_ptr));
+    };
+    const auto on_http2_response_event =
+        [this](const request::RequestBase& request,
+               http::Http2Session::ResponseEvent event) {
+          OnHttp2ResponseEvent(request, event);
+        };
+    const auto on_body_stream = [this](RequestBasePtr&& request_ptr) {
+      UASSERT(!body_stream_task_);
+      body_stream_task_.emplace(StartRequestTask(request_ptr));
+      body_stream_request_ = request_ptr.get();
+    };
+
+    // The protocol is chosen by the first bytes received
+    std::optional<http::HttpRequestParser> http1_parser;
+    request::RequestParser* request_parser = nullptr;
 
     pending_data_.resize(config_.in_buffer_size);
     while (is_accepting_requests_) {
@@ -127,8 +179,30 @@ void Connection::ListenForRequests() noexcept {
                     << Getpeername() << " on fd " << Fd();
       }
 
+      if (!request_parser) {
+        // The HTTP/2 session reads and writes the socket concurrently, which
+        // TlsWrapper does not allow
+        if (config_.http2_enabled &&
+            dynamic_cast<engine::io::Socket*>(peer_socket_.get()) &&
+            http::Http2Session::IsConnectionPreface(
+                {pending_data_.data(), pending_data_size_})) {
+          LOG_TRACE() << "HTTP/2 connection from " << Getpeername()
+                      << " on fd " << Fd();
+          http2_session_ = std::make_unique<http::Http2Session>(
+              request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+              on_new_request, on_http2_response_event, stats_->parser_stats,
+              data_accounter_, *peer_socket_);
+          request_parser = http2_session_.get();
+        } else {
+          request_parser = &http1_parser.emplace(
+              request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+              on_new_request, stats_->parser_stats, data_accounter_,
+              on_body_stream, config_.keepalive_timeout);
+        }
+      }
+
       bool should_stop_accepting_requests = false;
-      if (!request_parser.Parse(pending_data_.data(), pending_data_size_)) {
+      if (!request_parser->Parse(pending_data_.data(), pending_data_size_)) {
         LOG_DEBUG() << "Malformed request from " << Getpeername() << " on fd "
                     << Fd();
 
@@ -137,10 +211,21 @@ void Connection::ListenForRequests() noexcept {
       }
       pending_data_size_ = 0;
 
-      for (auto&& request : pending_requests) {
-        ProcessRequest(std::move(request));
+      if (http2_session_) {
+        if (should_stop_accepting_requests) is_accepting_requests_ = false;
+        ServeHttp2(pending_requests);
+        break;
+      }
+
+      if (config_.pipeline_concurrency > 1 && pending_requests.size() > 1) {
+        ProcessPipelinedRequests(pending_requests);
+        pending_requests.resize(0);
+      } else {
+        for (auto&& request : pending_requests) {
+          ProcessRequest(std::move(request));
+        }
+        pending_requests.resize(0);
       }
-      pending_requests.resize(0);
       if (should_stop_accepting_requests) is_accepting_requests_ = false;
     }
 
@@ -170,8 +255,6 @@ void Connection::ProcessRequest(
     is_accepting_requests_ = false;
   }
 
-  stats_->active_request_count.Add(1);
-
   auto task = HandleQueueItem(request_ptr);
   SendResponse(*request_ptr);
 
@@ -179,6 +262,295 @@ void Connection::ProcessRequest(
     request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
 }
 
+void Connection::ProcessPipelinedRequests(
+    std::vector<std::shared_ptr<request::RequestBase>>& requests) {
+  const auto is_upgrade = [](const auto& request) {
+    return request->IsUpgradeWebsocket();
+  };
+  if (std::any_of(requests.begin(), requests.end(), is_upgrade)) {
+    // The socket is handed over to the upgraded request, nothing to coalesce
+    for (auto&& request : requests) ProcessRequest(std::move(request));
+    return;
+  }
+
+  // Up to pipeline_concurrency requests are handled at once. Responses are
+  // still sent in the order of requests, and the responses of the requests
+  // that are already handled are buffered to go out with a single write.
+  CoalescingWriter writer{*peer_socket_};
+  std::size_t buffered_responses = 0;
+  const auto flush = [&] {
+    try {
+      if (writer.Flush(engine::Deadline{})) {
+        stats_->response_writes_count.Add(1);
+        stats_->responses_coalesced_count.Add(buffered_responses - 1);
+      }
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Error while sending pipelined responses: " << ex;
+      // Do not try to send the following responses
+      is_response_chain_valid_ = false;
+    }
+    buffered_responses = 0;
+  };
+
+  std::vector<engine::TaskWithResult<void>> request_tasks;
+  request_tasks.reserve(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    while (request_tasks.size() < requests.size() &&
+           request_tasks.size() < i + config_.pipeline_concurrency) {
+      const auto& request = requests[request_tasks.size()];
+      if (request->IsFinal()) is_accepting_requests_ = false;
+      request_tasks.push_back(StartRequestTask(request));
+    }
+
+    auto& request = *requests[i];
+    WaitQueueItem(request, request_tasks[i]);
+    if (request.GetResponse().IsBodyStreamed()) {
+      // Streamed body chunks must not wait for the following responses
+      flush();
+      SendResponse(request);
+      continue;
+    }
+
+    SendResponse(request, is_response_chain_valid_ ? &writer : nullptr);
+    ++buffered_responses;
+    if (i + 1 == requests.size() || !request_tasks[i + 1].IsFinished()) {
+      flush();
+    }
+  }
+}
+
+void Connection::ServeHttp2(
+    std::vector<std::shared_ptr<request::RequestBase>>& pending_requests) {
+  // Only this task uses the session. The socket is read by a separate task
+  // and the handlers of the streams run concurrently, they all report to this
+  // task through the queue. So SETTINGS, PING and new streams are processed
+  // while the handlers run, and each response is submitted once it is ready.
+  const auto events = Http2EventQueue::Create();
+  auto consumer = events->GetConsumer();
+  auto reader_task =
+      engine::AsyncNoSpan([this, producer = events->GetProducer()]() mutable {
+        ReadHttp2Data(producer);
+      });
+  const utils::FastScopeGuard streams_guard{
+      [this]() noexcept { AbortHttp2Streams(); }};
+
+  const auto start_pending_streams = [&] {
+    for (auto&& request : std::exchange(pending_requests, {})) {
+      StartHttp2Stream(std::move(request), *events);
+    }
+  };
+  start_pending_streams();
+
+  while (is_accepting_requests_ || !http2_streams_.empty()) {
+    auto& finishing = http2_finishing_streams_;
+    finishing.erase(
+        std::remove_if(finishing.begin(), finishing.end(),
+                       [](const auto& stream) {
+                         return stream->task.IsFinished() &&
+                                stream->request_task.IsFinished();
+                       }),
+        finishing.end());
+
+    // After a session error the in-flight streams get the keepalive timeout
+    // to finish, as the peer flow control windows are not updated anymore
+    const auto deadline =
+        is_accepting_requests_ && !http2_streams_.empty()
+            ? engine::Deadline{}
+            : engine::Deadline::FromDuration(config_.keepalive_timeout);
+    std::unique_ptr<Http2Event> event;
+    if (!consumer.Pop(event, deadline)) {
+      if (!engine::current_task::ShouldCancel()) {
+        LOG_INFO() << "Closing idle connection on timeout";
+      }
+      return;
+    }
+
+    switch (event->type) {
+      case Http2Event::Type::kData:
+        if (event->data.empty()) {
+          LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
+                      << " closed connection";
+          return;
+        }
+        if (!is_accepting_requests_) break;
+
+        LOG_TRACE() << "Received " << event->data.size() << " byte(s) from "
+                    << Getpeername() << " on fd " << Fd();
+        if (!http2_session_->Parse(event->data.data(), event->data.size())) {
+          LOG_DEBUG() << "HTTP/2 session with " << Getpeername() << " on fd "
+                      << Fd() << " is over";
+          is_accepting_requests_ = false;
+        }
+        start_pending_streams();
+        break;
+      case Http2Event::Type::kResponseReady:
+        event->request->SetStartSendResponseTime();
+        http2_session_->SendResponse(*event->request);
+        break;
+      case Http2Event::Type::kBodyChunk:
+        http2_session_->AppendResponseBody(*event->request, event->data);
+        break;
+      case Http2Event::Type::kBodyEnd:
+        http2_session_->FinishResponseBody(*event->request);
+        break;
+    }
+  }
+}
+
+void Connection::ReadHttp2Data(Http2EventQueue::Producer& producer) noexcept {
+  while (true) {
+    auto event = std::make_unique<Http2Event>();
+    event->data.resize(config_.in_buffer_size);
+    try {
+      event->data.resize(peer_socket_->ReadSome(
+          event->data.data(), event->data.size(), engine::Deadline{}));
+    } catch (const std::exception& ex) {
+      if (engine::current_task::ShouldCancel()) return;
+      LOG_INFO() << "Error while receiving from peer " << Getpeername()
+                 << " on fd " << Fd() << ": " << ex;
+      event->data.clear();
+    }
+
+    const bool is_closed = event->data.empty();
+    if (!producer.Push(std::move(event)) || is_closed) return;
+  }
+}
+
+void Connection::StartHttp2Stream(
+    std::shared_ptr<request::RequestBase>&& request, Http2EventQueue& events) {
+  const auto* request_ptr = request.get();
+  auto stream = std::make_unique<Http2Stream>(std::move(request));
+  stream->request_task = StartRequestTask(stream->request);
+  stream->task = engine::AsyncNoSpan(
+      [&stream = *stream, producer = events.GetProducer()]() mutable {
+        RunHttp2Stream(stream, producer);
+      });
+  http2_streams_.emplace(request_ptr, std::move(stream));
+}
+
+void Connection::RunHttp2Stream(Http2Stream& stream,
+                                Http2EventQueue::Producer& producer) noexcept {
+  auto& request = *stream.request;
+  auto& response = request.GetResponse();
+  auto& request_task = stream.request_task;
+
+  const auto push = [&](Http2Event::Type type, std::string data = {}) {
+    // The session loop has to see the response of a reset stream too
+    engine::TaskCancellationBlocker blocker;
+    return producer.Push(
+        std::make_unique<Http2Event>(
+            Http2Event{type, stream.request, std::move(data)}),
+        engine::Deadline{});
+  };
+
+  try {
+    if (response.IsBodyStreamed()) {
+      response.WaitForHeadersEnd();
+    } else {
+      request_task.Wait();
+    }
+  } catch (const engine::WaitInterruptedException&) {
+    // Handled below
+  }
+
+  if (engine::current_task::ShouldCancel()) {
+    // The peer has reset the stream or the connection is being closed
+    request_task.SyncCancel();
+  }
+  if (request_task.IsFinished()) {
+    engine::TaskCancellationBlocker blocker;
+    try {
+      request_task.Get();
+    } catch (const engine::TaskCancelledException& e) {
+      LOG_LIMITED_WARNING() << "Handler task was cancelled with reason: "
+                            << ToString(e.Reason());
+      if (!response.IsReady()) {
+        response.SetReady();
+        response.SetStatusServiceUnavailable();
+      }
+    } catch (const std::exception& e) {
+      LOG_WARNING() << "Request failed with unhandled exception: " << e;
+      request.MarkAsInternalServerError();
+    }
+  }
+
+  if (!push(Http2Event::Type::kResponseReady) || !response.IsBodyStreamed()) {
+    return;
+  }
+
+  std::string chunk;
+  while (http::Http2Session::PopResponseBody(request, chunk)) {
+    if (!push(Http2Event::Type::kBodyChunk, std::move(chunk))) return;
+    chunk.clear();
+    // Waits for the peer to accept the chunk, so that the handler is slowed
+    // down by the flow control windows
+    if (!stream.body_wanted.WaitForEvent()) return;
+  }
+  // A truncated body must not look complete
+  if (engine::current_task::ShouldCancel()) return;
+  push(Http2Event::Type::kBodyEnd);
+}
+
+void Connection::OnHttp2ResponseEvent(
+    const request::RequestBase& request,
+    http::Http2Session::ResponseEvent event) {
+  using ResponseEvent = http::Http2Session::ResponseEvent;
+
+  const auto it = http2_streams_.find(&request);
+  if (it == http2_streams_.end()) return;
+  auto& stream = *it->second;
+
+  switch (event) {
+    case ResponseEvent::kBodyWanted:
+      stream.body_wanted.Send();
+      break;
+    case ResponseEvent::kCancelled:
+      // The stream task stops the handler and passes on the response, that
+      // is then reported as failed
+      stream.task.RequestCancel();
+      break;
+    case ResponseEvent::kSent:
+    case ResponseEvent::kFailed:
+      FinishHttp2Stream(request);
+      break;
+  }
+}
+
+void Connection::FinishHttp2Stream(const request::RequestBase& request) {
+  const auto it = http2_streams_.find(&request);
+  UASSERT(it != http2_streams_.end());
+  auto stream = std::move(it->second);
+  http2_streams_.erase(it);
+
+  FinishRequest(*stream->request);
+  if (!stream->task.IsFinished() || !stream->request_task.IsFinished()) {
+    // E.g. the streamed body of a reset stream is still being produced
+    stream->task.RequestCancel();
+    stream->request_task.RequestCancel();
+    http2_finishing_streams_.push_back(std::move(stream));
+  }
+}
+
+void Connection::AbortHttp2Streams() noexcept {
+  for (auto& [request_ptr, stream] : http2_streams_) {
+    stream->task.RequestCancel();
+    stream->request_task.RequestCancel();
+  }
+  for (auto& [request_ptr, stream] : http2_streams_) {
+    // The response may be used once the handler is stopped
+    stream->task.SyncCancel();
+    stream->request_task.SyncCancel();
+
+    auto& response = stream->request->GetResponse();
+    if (!response.IsSent()) {
+      response.SetSendFailed(std::chrono::steady_clock::now());
+    }
+    FinishRequest(*stream->request);
+  }
+  http2_streams_.clear();
+  http2_finishing_streams_.clear();
+}
+
 bool Connection::ReadSome() {
   if (pending_data_size_ == pending_data_.size()) return true;
 
@@ -200,21 +572,41 @@ bool Connection::ReadSome() {
   return true;
 }
 
+engine::TaskWithResult<void> Connection::StartRequestTask(
+    const std::shared_ptr<request::RequestBase>& request) {
+  if (body_stream_task_ && body_stream_request_ == request.get()) {
+    // Started once the headers were received
+    auto request_task = std::move(*body_stream_task_);
+    body_stream_task_.reset();
+    body_stream_request_ = nullptr;
+    return request_task;
+  }
+
+  stats_->active_request_count.Add(1);
+  return request_handler_.StartRequestTask(request);
+}
+
 engine::TaskWithResult<void> Connection::HandleQueueItem(
     const std::shared_ptr<request::RequestBase>& request) noexcept {
-  auto request_task = request_handler_.StartRequestTask(request);
+  auto request_task = StartRequestTask(request);
+  WaitQueueItem(*request, request_task);
+  return request_task;
+}
 
+void Connection::WaitQueueItem(
+    request::RequestBase& request,
+    engine::TaskWithResult<void>& request_task) noexcept {
   if (engine::current_task::IsCancelRequested()) {
     // We could've packed all remaining requests into a vector and cancel them
     // in parallel. But pipelining is almost never used so why bother.
     request_task.SyncCancel();
     LOG_DEBUG() << "Request processing interrupted";
     is_response_chain_valid_ = false;
-    return request_task;  // avoids throwing and catching exception down below
+    return;  // avoids throwing and catching exception down below
   }
 
   try {
-    auto& response = request->GetResponse();
+    auto& response = request.GetResponse();
     if (response.IsBodyStreamed()) {
       // TODO: wait for TCP connection closure too
       response.WaitForHeadersEnd();
@@ -255,7 +647,7 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(
                    : logging::Level::kError;
     LOG_LIMITED(lvl) << "Handler task was cancelled with reason: "
                      << ToString(reason);
-    auto& response = request->GetResponse();
+    auto& response = request.GetResponse();
     if (!response.IsReady()) {
       response.SetReady();
       response.SetStatusServiceUnavailable();
@@ -265,19 +657,23 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(
     is_response_chain_valid_ = false;
   } catch (const std::exception& e) {
     LOG_WARNING() << "Request failed with unhandled exception: " << e;
-    request->MarkAsInternalServerError();
+    request.MarkAsInternalServerError();
   }
-  return request_task;
 }
 
 void Connection::SendResponse(request::RequestBase& request) {
+  SendResponse(request, is_response_chain_valid_ ? peer_socket_.get() : nullptr);
+}
+
+void Connection::SendResponse(request::RequestBase& request,
+                              engine::io::RwBase* socket) {
   auto& response = request.GetResponse();
   UASSERT(!response.IsSent());
   request.SetStartSendResponseTime();
-  if (is_response_chain_valid_ && peer_socket_) {
+  if (socket) {
     try {
       // Might be a stream reading or a fully constructed response
-      response.SendResponse(*peer_socket_);
+      response.SendResponse(*socket);
     } catch (const engine::io::IoSystemError& ex) {
       // working with raw values because std::errc compares error_category
       // default_error_category() fixed only in GCC 9.1 (PR libstdc++/60555)
@@ -294,6 +690,10 @@ void Connection::SendResponse(request::RequestBase& request) {
   } else {
     response.SetSendFailed(std::chrono::steady_clock::now());
   }
+  FinishRequest(request);
+}
+
+void Connection::FinishRequest(request::RequestBase& request) {
   request.SetFinishSendResponseTime();
   stats_->active_request_count.Subtract(1);
   stats_->requests_processed_count.Add(1);
@@ -1,14 +1,19 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include <server/http/http2_session.hpp>
 #include <server/http/http_request_parser.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <server/net/connection_config.hpp>
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
 
+#include <userver/concurrent/mpsc_queue.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/server/request/request_config.hpp>
@@ -29,6 +34,8 @@ class Connection final {
              std::shared_ptr<Stats> stats,
              request::ResponseDataAccounter& data_accounter);
 
+  ~Connection();
+
   void Process();
 
   int Fd() const;
@@ -40,10 +47,35 @@ class Connection final {
 
   void ListenForRequests() noexcept;
   void ProcessRequest(std::shared_ptr<request::RequestBase>&& request_ptr);
-
+  void ProcessPipelinedRequests(
+      std::vector<std::shared_ptr<request::RequestBase>>& pending_requests);
+
+  struct Http2Event;
+  struct Http2Stream;
+  using Http2EventQueue = concurrent::MpscQueue<std::unique_ptr<Http2Event>>;
+
+  void ServeHttp2(
+      std::vector<std::shared_ptr<request::RequestBase>>& pending_requests);
+  void ReadHttp2Data(Http2EventQueue::Producer& producer) noexcept;
+  void StartHttp2Stream(std::shared_ptr<request::RequestBase>&& request,
+                        Http2EventQueue& events);
+  static void RunHttp2Stream(Http2Stream& stream,
+                             Http2EventQueue::Producer& producer) noexcept;
+  void OnHttp2ResponseEvent(const request::RequestBase& request,
+                            http::Http2Session::ResponseEvent event);
+  void FinishHttp2Stream(const request::RequestBase& request);
+  void AbortHttp2Streams() noexcept;
+
+  engine::TaskWithResult<void> StartRequestTask(
+      const std::shared_ptr<request::RequestBase>& request);
   engine::TaskWithResult<void> HandleQueueItem(
       const std::shared_ptr<request::RequestBase>& request) noexcept;
+  void WaitQueueItem(request::RequestBase& request,
+                     engine::TaskWithResult<void>& request_task) noexcept;
   void SendResponse(request::RequestBase& request);
+  void SendResponse(request::RequestBase& request,
+                    engine::io::RwBase* socket);
+  void FinishRequest(request::RequestBase& request);
 
   std::string Getpeername() const;
 
@@ -56,9 +88,22 @@ class Connection final {
   const std::shared_ptr<Stats> stats_;
   request::ResponseDataAccounter& data_accounter_;
 
+  // Set if the peer has started the connection with the HTTP/2 preface
+  std::unique_ptr<http::Http2Session> http2_session_;
+  // Streams with running handlers or unsent responses
+  std::unordered_map<const request::RequestBase*, std::unique_ptr<Http2Stream>>
+      http2_streams_;
+  // Streams that are finished while their tasks are still being cancelled
+  std::vector<std::unique_ptr<Http2Stream>> http2_finishing_streams_;
+
   engine::io::Sockaddr remote_address_;
   std::string peer_name_;
 
+  // The handler of a request with the streamed body runs while the body is
+  // being received
+  const request::RequestBase* body_stream_request_{nullptr};
+  std::optional<engine::TaskWithResult<void>> body_stream_task_;
+
   std::vector<char> pending_data_{};
   size_t pending_data_size_{0};
 
@@ -1,5 +1,7 @@
 #include <server/net/connection_config.hpp>
 
+#include <stdexcept>
+
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -20,6 +22,13 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value,
           config.keepalive_timeout);
   config.abort_check_delay = utils::StringToDuration(
       value["stream_close_check_delay"].As<std::string>("20ms"));
+  config.http2_enabled =
+      value["http2_enabled"].As<bool>(config.http2_enabled);
+  config.pipeline_concurrency =
+      value["pipeline_concurrency"].As<size_t>(config.pipeline_concurrency);
+  if (config.pipeline_concurrency == 0) {
+    throw std::runtime_error("pipeline_concurrency must be positive");
+  }
 
   return config;
 }
@@ -14,6 +14,8 @@ struct ConnectionConfig {
   size_t requests_queue_size_threshold = 100;
   std::chrono::seconds keepalive_timeout{10 * 60};
   std::chrono::milliseconds abort_check_delay{20};
+  bool http2_enabled = false;
+  size_t pipeline_concurrency = 1;
 };
 
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
@@ -9,6 +9,7 @@
 #include <userver/clients/http/client.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/internal/net/net_listener.hpp>
 
 #include <userver/utest/http_client.hpp>
 #include <userver/utest/utest.hpp>
@@ -274,6 +275,66 @@ UTEST(ServerNetConnection, KeepAlive) {
   EXPECT_EQ(handler.asyncs_finished, 2);
 }
 
+UTEST(ServerNetConnection, PipelinedRequests) {
+  constexpr std::size_t kRequests = 5;
+  constexpr std::string_view kRequest = "GET / HTTP/1.1\r\n\r\n";
+  constexpr std::string_view kResponseStart = "HTTP/1.1 404 ";
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.pipeline_concurrency = 3;
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto task = engine::AsyncNoSpan([&, peer = std::move(server)]() mutable {
+    net::Connection connection(
+        config.connection_config, config.handler_defaults,
+        std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+        stats, data_accounter);
+
+    connection.Process();
+  });
+
+  std::string requests;
+  for (std::size_t i = 0; i < kRequests; ++i) requests += kRequest;
+  ASSERT_EQ(client.SendAll(requests.data(), requests.size(), test_deadline),
+            requests.size());
+
+  std::string responses;
+  std::size_t responses_count = 0;
+  while (responses_count < kRequests) {
+    std::array<char, 4096> buffer{};
+    const auto size = client.RecvSome(buffer.data(), buffer.size(),
+                                      test_deadline);
+    ASSERT_NE(size, 0);
+    responses.append(buffer.data(), size);
+
+    responses_count = 0;
+    for (auto pos = responses.find(kResponseStart); pos != std::string::npos;
+         pos = responses.find(kResponseStart, pos + 1)) {
+      ++responses_count;
+    }
+  }
+  EXPECT_EQ(responses_count, kRequests);
+  EXPECT_EQ(handler.asyncs_finished, kRequests);
+
+  task.RequestCancel();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+
+  // Responses are coalesced only if the handlers happen to be fast enough.
+  // Each pipelined response is accounted either as a write or as a coalesced
+  // one, though the kernel could have split the requests between reads.
+  ASSERT_GE(stats->response_writes_count.Read(), 1);
+  EXPECT_LE(stats->response_writes_count.Read() +
+                stats->responses_coalesced_count.Read(),
+            kRequests);
+}
+
 UTEST(ServerNetConnection, CancelMultipleInFlight) {
   constexpr std::size_t kInFlightRequests = 10;
   constexpr std::size_t kMaxAttempts = 10;
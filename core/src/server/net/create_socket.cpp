@@ -1,5 +1,11 @@
 #include "create_socket.hpp"
 
+#ifdef __linux__
+#include <linux/filter.h>
+#include <sys/socket.h>
+#endif
+
+#include <iterator>
 #include <string>
 
 #include <fmt/format.h>
@@ -8,7 +14,9 @@
 #include <userver/engine/io/socket.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
+#include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,8 +43,32 @@ engine::io::Socket CreateUnixSocket(const std::string& path, int backlog) {
   return socket;
 }
 
+// All the listener shards bind to the same port with SO_REUSEPORT. By default
+// the kernel selects the shard for a new connection by the hash of the
+// addresses. The filter selects the shard with the index of the CPU that
+// received the connection instead, the kernel falls back to the hash if there
+// are less shards than CPUs.
+void AttachCpuSteeringFilter(engine::io::Socket& socket) {
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+  sock_filter code[] = {
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  };
+  const sock_fprog program{std::size(code), code};
+  utils::CheckSyscall(
+      ::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program,
+                   sizeof(program)),
+      "attaching the reuseport CPU filter, fd={}", socket.Fd());
+#else
+  (void)socket;
+  LOG_WARNING() << "SO_ATTACH_REUSEPORT_CBPF is not supported, "
+                   "'shards-cpu-steering' is ignored";
+#endif
+}
+
 engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port,
-                                    int backlog) {
+                                    int backlog, bool cpu_steering) {
   std::vector<engine::io::Sockaddr> addrs;
 
   try {
@@ -60,6 +92,7 @@ engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port,
   engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
   socket.Bind(addr);
   socket.Listen(backlog);
+  if (cpu_steering) AttachCpuSteeringFilter(socket);
   return socket;
 }
 
@@ -67,7 +100,8 @@ engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port,
 
 engine::io::Socket CreateSocket(const ListenerConfig& config) {
   if (config.unix_socket_path.empty())
-    return CreateIpv6Socket(config.address, config.port, config.backlog);
+    return CreateIpv6Socket(config.address, config.port, config.backlog,
+                            config.shards_cpu_steering);
   else
     return CreateUnixSocket(config.unix_socket_path, config.backlog);
 }
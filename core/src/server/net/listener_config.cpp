@@ -22,7 +22,12 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   config.unix_socket_path = value["unix-socket"].As<std::string>("");
   config.max_connections =
       value["max_connections"].As<size_t>(config.max_connections);
+  config.shed_connections_on_overload =
+      value["shed-connections-on-overload"].As<bool>(
+          config.shed_connections_on_overload);
   config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
+  config.shards_cpu_steering =
+      value["shards-cpu-steering"].As<bool>(config.shards_cpu_steering);
   config.task_processor = value["task_processor"].As<std::string>();
   config.backlog = value["backlog"].As<int>(config.backlog);
 
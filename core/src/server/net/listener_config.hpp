@@ -22,7 +22,9 @@ struct ListenerConfig {
   std::string address = "::";
   int backlog = 1024;  // truncated to net.core.somaxconn
   size_t max_connections = 32768;
+  bool shed_connections_on_overload{false};
   std::optional<size_t> shards;
+  bool shards_cpu_steering{false};
   std::string task_processor;
 
   bool tls{false};
@@ -77,6 +77,16 @@ void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
     return;
   }
 
+  if (endpoint_info_->listener_config.shed_connections_on_overload &&
+      endpoint_info_->request_handler.IsThrottledByCongestionControl()) {
+    // Dropping the connection before the TLS handshake and the parsing of
+    // the requests is the cheapest way to reject them
+    LOG_LIMITED_WARNING() << endpoint_info_->GetDescription()
+                          << " is overloaded, dropping connection #"
+                          << new_connection_count;
+    return;
+  }
+
   LOG_DEBUG() << "Accepted connection #" << new_connection_count << '/'
               << endpoint_info_->listener_config.max_connections;
 
@@ -39,6 +39,8 @@ struct Stats {
   ParserStats parser_stats;
   concurrent::StripedCounter active_request_count;
   concurrent::StripedCounter requests_processed_count;
+  concurrent::StripedCounter response_writes_count;
+  concurrent::StripedCounter responses_coalesced_count;
 };
 
 struct StatsAggregation final {
@@ -50,7 +52,9 @@ struct StatsAggregation final {
         connections_closed{stats.connections_closed.load()},
         parser_stats{stats.parser_stats},
         active_request_count{stats.active_request_count.NonNegativeRead()},
-        requests_processed_count{stats.requests_processed_count.Read()} {}
+        requests_processed_count{stats.requests_processed_count.Read()},
+        response_writes_count{stats.response_writes_count.Read()},
+        responses_coalesced_count{stats.responses_coalesced_count.Read()} {}
 
   StatsAggregation& operator+=(const StatsAggregation& other) {
     active_connections += other.active_connections;
@@ -60,6 +64,8 @@ struct StatsAggregation final {
     parser_stats += other.parser_stats;
     active_request_count += other.active_request_count;
     requests_processed_count += other.requests_processed_count;
+    response_writes_count += other.response_writes_count;
+    responses_coalesced_count += other.responses_coalesced_count;
 
     return *this;
   }
@@ -72,6 +78,10 @@ struct StatsAggregation final {
   ParserStatsAggregation parser_stats;
   std::size_t active_request_count{0};
   std::size_t requests_processed_count{0};
+  // writes of pipelined responses and the responses that shared a write with
+  // a preceding one
+  std::size_t response_writes_count{0};
+  std::size_t responses_coalesced_count{0};
 };
 
 }  // namespace server::net
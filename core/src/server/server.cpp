@@ -64,6 +64,13 @@ void PortInfo::Init(const ServerConfig& config,
   const auto& event_thread_pool = task_processor.EventThreadPool();
   size_t listener_shards = listener_config.shards ? *listener_config.shards
                                                   : event_thread_pool.GetSize();
+  if (!listener_config.unix_socket_path.empty() && listener_shards > 1) {
+    // Each shard recreates the socket file, only the last one would accept
+    // the connections
+    LOG_INFO() << "Unix socket listeners are not sharded, ignoring shards="
+               << listener_shards;
+    listener_shards = 1;
+  }
 
   listeners_.reserve(listener_shards);
   while (listener_shards--) {
@@ -363,6 +370,9 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
     request_stats["avg-lifetime-ms"] = pimpl->GetAvgRequestTimeMs().count();
     request_stats["processed"] = server_stats.requests_processed_count;
     request_stats["parsing"] = server_stats.parser_stats.parsing_request_count;
+    request_stats["pipelined-writes"] = server_stats.response_writes_count;
+    request_stats["pipelined-coalesced"] =
+        server_stats.responses_coalesced_count;
   }
 }
 
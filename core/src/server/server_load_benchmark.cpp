@@ -0,0 +1,252 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/components/component.hpp>
+#include <userver/components/component_base.hpp>
+#include <userver/components/minimal_server_component_list.hpp>
+#include <userver/components/run.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/server/component.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Drives a full components::Server in the same process: the listener, the
+// HTTP/1.1 parser, the handler with its middlewares and the response. The
+// load is generated by coroutines over keep-alive loopback connections.
+
+constexpr auto kIoTimeout = std::chrono::seconds{10};
+
+constexpr std::string_view kStaticConfig = R"(
+components_manager:
+  coro_pool:
+    initial_size: 500
+    max_size: 5000
+  default_task_processor: main-task-processor
+  event_thread_pool:
+    threads: 2
+  task_processors:
+    fs-task-processor:
+      worker_threads: 1
+    main-task-processor:
+      worker_threads: 4
+  components:
+    logging:
+      fs-task-processor: fs-task-processor
+      loggers:
+        default:
+          file_path: '@null'
+          level: error
+    dynamic-config:
+      defaults: {{}}
+    server:
+      listener:
+        port: {}
+        task_processor: main-task-processor
+    handler-echo:
+      path: /echo
+      method: POST
+      task_processor: main-task-processor
+)";
+
+struct LoadSettings final {
+  benchmark::State* state{nullptr};
+  std::uint16_t port{0};
+  std::size_t concurrency{0};
+  std::size_t body_size{0};
+};
+
+// A components::Run is configured only by the static config, the benchmark
+// hands its settings to LoadGenerator through this variable
+LoadSettings load_settings;
+
+class EchoHandler final : public server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName = "handler-echo";
+
+  using HttpHandlerBase::HttpHandlerBase;
+
+  std::string HandleRequestThrow(const server::http::HttpRequest& request,
+                                 server::request::RequestContext&) const final {
+    return request.RequestBody();
+  }
+};
+
+class Client final {
+ public:
+  Client(std::uint16_t port, std::size_t body_size)
+      : socket_(engine::io::AddrDomain::kInet6,
+                engine::io::SocketType::kStream),
+        request_(fmt::format("POST /echo HTTP/1.1\r\nHost: localhost\r\n"
+                             "Content-Length: {}\r\n\r\n{}",
+                             body_size, std::string(body_size, 'a'))) {
+    auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+    addr.SetPort(port);
+    socket_.Connect(addr, engine::Deadline::FromDuration(kIoTimeout));
+  }
+
+  void Roundtrip() {
+    const auto deadline = engine::Deadline::FromDuration(kIoTimeout);
+    if (socket_.SendAll(request_.data(), request_.size(), deadline) !=
+        request_.size()) {
+      throw std::runtime_error("Failed to send a request");
+    }
+
+    constexpr std::string_view kHeadersEnd = "\r\n\r\n";
+    constexpr std::string_view kContentLength = "\r\nContent-Length: ";
+    std::size_t headers_end = 0;
+    while ((headers_end = buffer_.find(kHeadersEnd)) == std::string::npos) {
+      Receive(deadline);
+    }
+    if (buffer_.compare(0, 12, "HTTP/1.1 200") != 0) {
+      throw std::runtime_error("Unexpected response: " +
+                               buffer_.substr(0, headers_end));
+    }
+
+    std::size_t content_length = 0;
+    const auto length_pos = buffer_.find(kContentLength);
+    if (length_pos != std::string::npos && length_pos < headers_end) {
+      content_length =
+          std::stoul(buffer_.substr(length_pos + kContentLength.size()));
+    }
+
+    const auto response_size =
+        headers_end + kHeadersEnd.size() + content_length;
+    while (buffer_.size() < response_size) Receive(deadline);
+    buffer_.erase(0, response_size);
+  }
+
+ private:
+  void Receive(engine::Deadline deadline) {
+    char chunk[16 * 1024];
+    const auto size = socket_.RecvSome(chunk, sizeof(chunk), deadline);
+    if (size == 0) throw std::runtime_error("Connection closed by the server");
+    buffer_.append(chunk, size);
+  }
+
+  engine::io::Socket socket_;
+  const std::string request_;
+  std::string buffer_;
+};
+
+class LoadGenerator final : public components::ComponentBase {
+ public:
+  static constexpr std::string_view kName = "load-generator";
+
+  LoadGenerator(const components::ComponentConfig& config,
+                const components::ComponentContext& context)
+      : ComponentBase(config, context) {
+    // The load starts after the server starts listening
+    context.FindComponent<components::Server>();
+  }
+
+  void OnAllComponentsLoaded() override {
+    auto& state = *load_settings.state;
+    std::vector<Client> clients;
+    clients.reserve(load_settings.concurrency);
+    for (std::size_t i = 0; i < load_settings.concurrency; ++i) {
+      clients.emplace_back(load_settings.port, load_settings.body_size);
+    }
+
+    std::vector<std::chrono::steady_clock::duration> latencies;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(clients.size());
+    for ([[maybe_unused]] auto _ : state) {
+      const auto iteration_latencies_begin = latencies.size();
+      latencies.resize(latencies.size() + clients.size());
+      for (std::size_t i = 0; i < clients.size(); ++i) {
+        tasks.push_back(utils::Async("load-client", [&, i] {
+          const auto start = std::chrono::steady_clock::now();
+          clients[i].Roundtrip();
+          latencies[iteration_latencies_begin + i] =
+              std::chrono::steady_clock::now() - start;
+        }));
+      }
+      engine::WaitAllChecked(tasks);
+      tasks.clear();
+    }
+
+    ReportLatencies(state, latencies);
+  }
+
+ private:
+  static void ReportLatencies(
+      benchmark::State& state,
+      std::vector<std::chrono::steady_clock::duration>& latencies) {
+    state.counters["rps"] = benchmark::Counter(
+        static_cast<double>(latencies.size()), benchmark::Counter::kIsRate);
+    if (latencies.empty()) return;
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile_us = [&latencies](double percentile) {
+      const auto index = static_cast<std::size_t>(
+          percentile / 100 * static_cast<double>(latencies.size() - 1));
+      return static_cast<double>(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              latencies[index])
+              .count());
+    };
+    state.counters["p50_us"] = percentile_us(50);
+    state.counters["p90_us"] = percentile_us(90);
+    state.counters["p99_us"] = percentile_us(99);
+    state.counters["p99.9_us"] = percentile_us(99.9);
+  }
+};
+
+std::uint16_t FindFreePort() {
+  std::uint16_t result{};
+  engine::RunStandalone([&result] {
+    const internal::net::TcpListener listener{};
+    result = listener.Port();
+  });
+  return result;
+}
+
+}  // namespace
+
+template <>
+inline constexpr auto components::kConfigFileMode<LoadGenerator> =
+    components::ConfigFileMode::kNotRequired;
+
+// Arguments: the number of concurrent keep-alive connections, the size of the
+// request and response bodies
+void server_load_echo(benchmark::State& state) {
+  load_settings = LoadSettings{&state, FindFreePort(),
+                               static_cast<std::size_t>(state.range(0)),
+                               static_cast<std::size_t>(state.range(1))};
+
+  components::RunOnce(
+      components::InMemoryConfig{fmt::format(kStaticConfig,
+                                             load_settings.port)},
+      components::MinimalServerComponentList()
+          .Append<EchoHandler>()
+          .Append<LoadGenerator>());
+
+  load_settings = LoadSettings{};
+}
+BENCHMARK(server_load_echo)
+    ->Args({1, 16})
+    ->Args({16, 16})
+    ->Args({64, 16})
+    ->Args({16, 4096})
+    ->Args({64, 4096})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+USERVER_NAMESPACE_END
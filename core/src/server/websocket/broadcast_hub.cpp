@@ -0,0 +1,274 @@
+#include <userver/server/websocket/broadcast_hub.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_set>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <userver/concurrent/mpsc_queue.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/shared_mutex.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/striped_rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+namespace impl {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Delivery final {
+  std::shared_ptr<const PreparedMessage> message;
+  Clock::time_point published_at;
+};
+
+// MpscQueue keeps the order of the messages pushed from different tasks,
+// a connection receives the messages in the order they were published
+using DeliveryQueue = concurrent::MpscQueue<std::unique_ptr<Delivery>>;
+
+using Percentile = utils::statistics::Percentile<2048, unsigned int, 120>;
+using Timings = utils::statistics::RecentPeriod<Percentile, Percentile,
+                                                utils::datetime::SteadyClock>;
+
+}  // namespace
+
+struct HubStatistics final {
+  utils::statistics::StripedRateCounter published;
+  utils::statistics::StripedRateCounter queued;
+  utils::statistics::StripedRateCounter sent;
+  utils::statistics::StripedRateCounter dropped;
+  Timings delivery_timings;
+};
+
+struct ShardData final {
+  std::unordered_set<HubSubscriber*> subscribers;
+  utils::impl::TransparentMap<std::string, std::unordered_set<HubSubscriber*>>
+      topics;
+};
+
+using Shard = concurrent::Variable<ShardData, engine::SharedMutex>;
+
+struct BroadcastHubImpl final {
+  BroadcastHubImpl(engine::TaskProcessor& task_processor,
+                   const BroadcastHub::Config& config)
+      : task_processor(task_processor),
+        config(config),
+        shards(config.shards_count ? config.shards_count
+                                   : task_processor.GetWorkerCount()) {}
+
+  std::size_t FanOut(Shard& shard, std::string_view topic,
+                     const std::shared_ptr<const PreparedMessage>& message,
+                     Clock::time_point published_at);
+
+  engine::TaskProcessor& task_processor;
+  const BroadcastHub::Config config;
+  utils::FixedArray<Shard> shards;
+  std::atomic<std::size_t> next_shard{0};
+  HubStatistics stats;
+};
+
+struct HubSubscriber final {
+  HubSubscriber(BroadcastHubImpl& hub, WebSocketConnection& connection)
+      : shard(hub.shards[hub.next_shard++ % hub.shards.size()]),
+        queue(DeliveryQueue::Create(hub.config.max_queue_size)),
+        producer(queue->GetMultiProducer()) {
+    writer = engine::CriticalAsyncNoSpan(
+        hub.task_processor,
+        [&connection, &stats = hub.stats, consumer = queue->GetConsumer()] {
+          std::unique_ptr<Delivery> delivery;
+          try {
+            while (consumer.Pop(delivery)) {
+              connection.SendPrepared(*delivery->message);
+              ++stats.sent;
+              stats.delivery_timings.GetCurrentCounter().Account(
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                      Clock::now() - delivery->published_at)
+                      .count());
+            }
+          } catch (const std::exception& e) {
+            // The messages are dropped until the connection is unregistered
+            LOG_DEBUG() << "Failed to send a broadcast message to "
+                        << connection.RemoteAddr().PrimaryAddressString()
+                        << ": " << e;
+          }
+        });
+    auto data = shard.UniqueLock();
+    data->subscribers.insert(this);
+  }
+
+  ~HubSubscriber() {
+    {
+      auto data = shard.UniqueLock();
+      for (const auto& topic : topics) {
+        const auto it = utils::impl::FindTransparent(data->topics, topic);
+        UASSERT(it != data->topics.end());
+        it->second.erase(this);
+        if (it->second.empty()) data->topics.erase(it);
+      }
+      data->subscribers.erase(this);
+    }
+    // Nobody pushes to the queue any more
+    writer.SyncCancel();
+  }
+
+  Shard& shard;
+  std::shared_ptr<DeliveryQueue> queue;
+  DeliveryQueue::MultiProducer producer;
+  engine::TaskWithResult<void> writer;
+  // Accessed only by the owner of the Connection
+  utils::impl::TransparentSet<std::string> topics;
+};
+
+std::size_t BroadcastHubImpl::FanOut(
+    Shard& shard, std::string_view topic,
+    const std::shared_ptr<const PreparedMessage>& message,
+    Clock::time_point published_at) {
+  const auto data = shard.SharedLock();
+  const auto* subscribers =
+      utils::impl::FindTransparentOrNullptr(data->topics, topic);
+  if (!subscribers) return 0;
+
+  std::size_t queued = 0;
+  for (auto* subscriber : *subscribers) {
+    if (subscriber->producer.PushNoblock(
+            std::make_unique<Delivery>(Delivery{message, published_at}))) {
+      ++queued;
+    }
+  }
+  stats.queued.Add({queued});
+  stats.dropped.Add({subscribers->size() - queued});
+  return queued;
+}
+
+}  // namespace impl
+
+BroadcastHub::Connection::Connection(
+    std::unique_ptr<impl::HubSubscriber>&& subscriber)
+    : subscriber_(std::move(subscriber)) {}
+
+BroadcastHub::Connection::Connection(Connection&&) noexcept = default;
+
+BroadcastHub::Connection& BroadcastHub::Connection::operator=(
+    Connection&&) noexcept = default;
+
+BroadcastHub::Connection::~Connection() = default;
+
+void BroadcastHub::Connection::Subscribe(std::string topic) {
+  UASSERT(subscriber_);
+  const auto [it, inserted] = subscriber_->topics.insert(std::move(topic));
+  if (!inserted) return;
+
+  auto data = subscriber_->shard.UniqueLock();
+  data->topics[*it].insert(subscriber_.get());
+}
+
+void BroadcastHub::Connection::Unsubscribe(std::string_view topic) {
+  UASSERT(subscriber_);
+  const auto it = utils::impl::FindTransparent(subscriber_->topics, topic);
+  if (it == subscriber_->topics.end()) return;
+
+  {
+    auto data = subscriber_->shard.UniqueLock();
+    const auto topic_it = utils::impl::FindTransparent(data->topics, topic);
+    UASSERT(topic_it != data->topics.end());
+    topic_it->second.erase(subscriber_.get());
+    if (topic_it->second.empty()) data->topics.erase(topic_it);
+  }
+  subscriber_->topics.erase(it);
+}
+
+BroadcastHub::BroadcastHub(engine::TaskProcessor& task_processor,
+                           const Config& config)
+    : impl_(std::make_unique<impl::BroadcastHubImpl>(task_processor, config)) {
+}
+
+BroadcastHub::~BroadcastHub() {
+  for (const auto& shard : impl_->shards) {
+    [[maybe_unused]] const auto data = shard.SharedLock();
+    UASSERT_MSG(data->subscribers.empty(),
+                "BroadcastHub is destroyed before its connections");
+  }
+}
+
+BroadcastHub::Connection BroadcastHub::Connect(
+    WebSocketConnection& connection) {
+  return Connection{std::make_unique<impl::HubSubscriber>(*impl_, connection)};
+}
+
+std::size_t BroadcastHub::Publish(std::string_view topic,
+                                  const Message& message) {
+  websocket::Config config;
+  config.fragment_size = impl_->config.fragment_size;
+  return Publish(topic,
+                 std::make_shared<const PreparedMessage>(message, config));
+}
+
+std::size_t BroadcastHub::Publish(
+    std::string_view topic, std::shared_ptr<const PreparedMessage> message) {
+  UINVARIANT(message, "Publishing an empty message");
+  ++impl_->stats.published;
+  const auto published_at = impl::Clock::now();
+
+  auto& shards = impl_->shards;
+  std::vector<engine::TaskWithResult<std::size_t>> tasks;
+  tasks.reserve(shards.size() - 1);
+  for (std::size_t i = 1; i < shards.size(); ++i) {
+    tasks.push_back(engine::CriticalAsyncNoSpan(
+        impl_->task_processor, [this, &shard = shards[i], topic, &message,
+                                published_at] {
+          return impl_->FanOut(shard, topic, message, published_at);
+        }));
+  }
+
+  std::size_t queued =
+      impl_->FanOut(shards[0], topic, message, published_at);
+  for (auto& task : tasks) queued += task.Get();
+  return queued;
+}
+
+void BroadcastHub::WriteStatistics(utils::statistics::Writer& writer) const {
+  std::size_t connections = 0;
+  std::size_t subscriptions = 0;
+  std::size_t queue_size = 0;
+  std::size_t max_queue_size = 0;
+  for (const auto& shard : impl_->shards) {
+    const auto data = shard.SharedLock();
+    connections += data->subscribers.size();
+    for (const auto& [topic, subscribers] : data->topics) {
+      subscriptions += subscribers.size();
+    }
+    for (const auto* subscriber : data->subscribers) {
+      const auto size = subscriber->queue->GetSizeApproximate();
+      queue_size += size;
+      max_queue_size = std::max(max_queue_size, size);
+    }
+  }
+
+  const auto& stats = impl_->stats;
+  writer["connections"] = connections;
+  writer["subscriptions"] = subscriptions;
+  writer["queue"]["size"] = queue_size;
+  writer["queue"]["max-size"] = max_queue_size;
+  writer["messages"]["published"] = stats.published;
+  writer["messages"]["queued"] = stats.queued;
+  writer["messages"]["sent"] = stats.sent;
+  writer["messages"]["dropped"] = stats.dropped;
+  writer["delivery-timings"] = stats.delivery_timings;
+}
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,170 @@
+#include <userver/server/websocket/broadcast_hub.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_base.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::websocket::BroadcastHub;
+using server::websocket::Message;
+using server::websocket::PreparedMessage;
+
+class FakeConnection final : public server::websocket::WebSocketConnection {
+ public:
+  void Recv(Message&) override {}
+  void Send(const Message&) override {}
+  void SendText(std::string_view) override {}
+  void SendBatch(utils::span<const Message>) override {}
+
+  void SendPrepared(const PreparedMessage& message) override {
+    if (block_sends_) {
+      send_started_.Send();
+      [[maybe_unused]] const bool unblocked = unblock_.WaitForEvent();
+    }
+    const std::lock_guard lock(mutex_);
+    received_.push_back(&message);
+  }
+
+  void Close(server::websocket::CloseStatus) override {}
+
+  const engine::io::Sockaddr& RemoteAddr() const override { return addr_; }
+
+  void AddFinalTags(tracing::Span&) const override {}
+  void AddStatistics(server::websocket::Statistics&) const override {}
+
+  // Makes the first send wait for Unblock()
+  void BlockSends() { block_sends_ = true; }
+  void WaitForSendStarted() { ASSERT_TRUE(send_started_.WaitForEvent()); }
+  void Unblock() {
+    block_sends_ = false;
+    unblock_.Send();
+  }
+
+  std::vector<const PreparedMessage*> WaitForMessages(std::size_t count) {
+    while (true) {
+      {
+        const std::lock_guard lock(mutex_);
+        if (received_.size() >= count) return received_;
+      }
+      engine::SleepFor(std::chrono::milliseconds{1});
+    }
+  }
+
+  std::size_t ReceivedCount() {
+    const std::lock_guard lock(mutex_);
+    return received_.size();
+  }
+
+ protected:
+  void DoSendBinary(utils::span<const std::byte>) override {}
+
+ private:
+  const engine::io::Sockaddr addr_;
+  engine::Mutex mutex_;
+  std::vector<const PreparedMessage*> received_;
+  std::atomic<bool> block_sends_{false};
+  engine::SingleConsumerEvent send_started_;
+  engine::SingleConsumerEvent unblock_;
+};
+
+BroadcastHub::Config MakeConfig(std::size_t shards_count) {
+  BroadcastHub::Config config;
+  config.shards_count = shards_count;
+  return config;
+}
+
+std::shared_ptr<const PreparedMessage> MakeMessage(std::string data) {
+  return std::make_shared<const PreparedMessage>(
+      Message{std::move(data), {}, true});
+}
+
+}  // namespace
+
+UTEST_MT(WebsocketBroadcastHub, FanOut, 4) {
+  BroadcastHub hub{engine::current_task::GetTaskProcessor(), MakeConfig(4)};
+
+  std::vector<FakeConnection> fakes(10);
+  std::vector<BroadcastHub::Connection> connections;
+  for (std::size_t i = 0; i < fakes.size(); ++i) {
+    connections.push_back(hub.Connect(fakes[i]));
+    connections.back().Subscribe(i % 2 ? "odd" : "even");
+    connections.back().Subscribe("all");
+  }
+
+  const auto odd = MakeMessage("odd");
+  const auto all = MakeMessage("all");
+  EXPECT_EQ(hub.Publish("odd", odd), 5);
+  EXPECT_EQ(hub.Publish("all", all), 10);
+  EXPECT_EQ(hub.Publish("nobody", MakeMessage("nobody")), 0);
+
+  for (std::size_t i = 0; i < fakes.size(); ++i) {
+    const auto received = fakes[i].WaitForMessages(i % 2 ? 2 : 1);
+    // All the connections share the single encoded message
+    EXPECT_EQ(received.back(), all.get());
+    if (i % 2) {
+      EXPECT_EQ(received.front(), odd.get());
+    }
+  }
+
+  connections[1].Unsubscribe("odd");
+  EXPECT_EQ(hub.Publish("odd", odd), 4);
+  connections.clear();
+  EXPECT_EQ(hub.Publish("all", all), 0);
+}
+
+UTEST_MT(WebsocketBroadcastHub, Order, 4) {
+  BroadcastHub hub{engine::current_task::GetTaskProcessor(), MakeConfig(4)};
+  FakeConnection fake;
+  auto connection = hub.Connect(fake);
+  connection.Subscribe("topic");
+
+  std::vector<std::shared_ptr<const PreparedMessage>> messages;
+  for (int i = 0; i < 100; ++i) {
+    messages.push_back(MakeMessage(std::to_string(i)));
+    ASSERT_EQ(hub.Publish("topic", messages.back()), 1);
+  }
+
+  const auto received = fake.WaitForMessages(messages.size());
+  for (std::size_t i = 0; i < messages.size(); ++i) {
+    EXPECT_EQ(received[i], messages[i].get());
+  }
+}
+
+UTEST(WebsocketBroadcastHub, SlowConsumer) {
+  auto config = MakeConfig(1);
+  config.max_queue_size = 2;
+  BroadcastHub hub{engine::current_task::GetTaskProcessor(), config};
+
+  FakeConnection slow;
+  slow.BlockSends();
+  FakeConnection fast;
+  auto slow_connection = hub.Connect(slow);
+  slow_connection.Subscribe("topic");
+  auto fast_connection = hub.Connect(fast);
+  fast_connection.Subscribe("topic");
+
+  const auto message = MakeMessage("message");
+  EXPECT_EQ(hub.Publish("topic", message), 2);
+  slow.WaitForSendStarted();
+
+  // The slow connection queue is full after two more messages
+  EXPECT_EQ(hub.Publish("topic", message), 2);
+  EXPECT_EQ(hub.Publish("topic", message), 2);
+  EXPECT_EQ(hub.Publish("topic", message), 1);
+  EXPECT_EQ(fast.WaitForMessages(4).size(), 4);
+
+  slow.Unblock();
+  EXPECT_EQ(slow.WaitForMessages(3).size(), 3);
+  engine::SleepFor(std::chrono::milliseconds{10});
+  EXPECT_EQ(slow.ReceivedCount(), 3);
+}
+
+USERVER_NAMESPACE_END
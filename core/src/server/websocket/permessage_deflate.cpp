@@ -0,0 +1,224 @@
+#include <server/websocket/permessage_deflate.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <zlib.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+constexpr std::string_view kServerNoContextTakeover =
+    "server_no_context_takeover";
+constexpr std::string_view kClientNoContextTakeover =
+    "client_no_context_takeover";
+constexpr std::string_view kServerMaxWindowBits = "server_max_window_bits";
+constexpr std::string_view kClientMaxWindowBits = "client_max_window_bits";
+
+constexpr int kMaxWindowBits = 15;
+// zlib silently uses 9 bits window for the raw deflate streams with 8 bits
+constexpr int kMinServerWindowBits = 9;
+constexpr int kMinClientWindowBits = 8;
+
+// The tail of the deflate block flushed with Z_SYNC_FLUSH, it is not sent
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.1
+constexpr std::string_view kSyncFlushTail{"\x00\x00\xff\xff", 4};
+
+constexpr std::size_t kMinDecompressBufferSize = 1024;
+
+std::string_view Trim(std::string_view str) {
+  const auto begin = str.find_first_not_of(" \t");
+  if (begin == std::string_view::npos) return {};
+  const auto end = str.find_last_not_of(" \t");
+  return str.substr(begin, end - begin + 1);
+}
+
+std::optional<int> ParseWindowBits(std::string_view value, int min_bits) {
+  if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+    value = value.substr(1, value.size() - 2);
+  }
+  if (value.empty() || value.size() > 2 || value.front() == '0' ||
+      !std::all_of(value.begin(), value.end(),
+                   [](char c) { return c >= '0' && c <= '9'; })) {
+    return std::nullopt;
+  }
+
+  int bits = 0;
+  for (const char c : value) bits = bits * 10 + (c - '0');
+  if (bits < min_bits || bits > kMaxWindowBits) return std::nullopt;
+  return bits;
+}
+
+// Parses "permessage-deflate; param; param=value" extension offer
+std::optional<DeflateParams> ParseOffer(std::string_view offer) {
+  auto pos = offer.find(';');
+  if (!utils::StrIcaseEqual{}(Trim(offer.substr(0, pos)), kExtensionName)) {
+    return std::nullopt;
+  }
+
+  DeflateParams params;
+  bool has_client_max_window_bits = false;
+  while (pos != std::string_view::npos) {
+    offer.remove_prefix(pos + 1);
+    pos = offer.find(';');
+    const auto param = Trim(offer.substr(0, pos));
+    const auto equals_pos = param.find('=');
+    const auto name = Trim(param.substr(0, equals_pos));
+    const auto value = equals_pos == std::string_view::npos
+                           ? std::optional<std::string_view>{}
+                           : Trim(param.substr(equals_pos + 1));
+
+    // Duplicate parameters make the offer invalid
+    if (name == kServerNoContextTakeover && !value &&
+        !params.server_no_context_takeover) {
+      params.server_no_context_takeover = true;
+    } else if (name == kClientNoContextTakeover && !value &&
+               !params.client_no_context_takeover) {
+      params.client_no_context_takeover = true;
+    } else if (name == kServerMaxWindowBits && value &&
+               !params.server_max_window_bits) {
+      params.server_max_window_bits =
+          ParseWindowBits(*value, kMinServerWindowBits);
+      if (!params.server_max_window_bits) return std::nullopt;
+    } else if (name == kClientMaxWindowBits && !has_client_max_window_bits) {
+      // The client may use a smaller window, the server always decompresses
+      // with the largest one
+      has_client_max_window_bits = true;
+      if (value && !ParseWindowBits(*value, kMinClientWindowBits)) {
+        return std::nullopt;
+      }
+    } else {
+      return std::nullopt;
+    }
+  }
+  return params;
+}
+
+}  // namespace
+
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions) {
+  while (!extensions.empty()) {
+    const auto pos = extensions.find(',');
+    if (auto params = ParseOffer(extensions.substr(0, pos))) return params;
+    if (pos == std::string_view::npos) break;
+    extensions.remove_prefix(pos + 1);
+  }
+  return std::nullopt;
+}
+
+std::string MakeDeflateResponse(const DeflateParams& params) {
+  std::string response{kExtensionName};
+  if (params.server_no_context_takeover) {
+    response.append("; ").append(kServerNoContextTakeover);
+  }
+  if (params.client_no_context_takeover) {
+    response.append("; ").append(kClientNoContextTakeover);
+  }
+  if (params.server_max_window_bits) {
+    response.append("; ")
+        .append(kServerMaxWindowBits)
+        .append("=")
+        .append(std::to_string(*params.server_max_window_bits));
+  }
+  return response;
+}
+
+struct MessageDeflate::Streams final {
+  z_stream deflate{};
+  z_stream inflate{};
+};
+
+MessageDeflate::MessageDeflate(const DeflateParams& params)
+    : params_(params), streams_(std::make_unique<Streams>()) {
+  // Negative window bits are for the raw deflate stream without a header
+  const int window_bits =
+      params.server_max_window_bits.value_or(kMaxWindowBits);
+  if (deflateInit2(&streams_->deflate, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                   -window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+    throw std::runtime_error("deflateInit2() failed");
+  }
+  if (inflateInit2(&streams_->inflate, -kMaxWindowBits) != Z_OK) {
+    deflateEnd(&streams_->deflate);
+    throw std::runtime_error("inflateInit2() failed");
+  }
+}
+
+MessageDeflate::~MessageDeflate() {
+  deflateEnd(&streams_->deflate);
+  inflateEnd(&streams_->inflate);
+}
+
+void MessageDeflate::Compress(utils::span<const std::byte> data,
+                              std::string& compressed) {
+  auto& stream = streams_->deflate;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  stream.next_in =
+      reinterpret_cast<Bytef*>(const_cast<std::byte*>(data.data()));
+  stream.avail_in = static_cast<uInt>(data.size());
+  UASSERT(stream.avail_in == data.size());
+
+  std::size_t size = compressed.size();
+  compressed.resize(size + deflateBound(&stream, data.size()) +
+                    kSyncFlushTail.size());
+  while (true) {
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data() + size);
+    stream.avail_out = static_cast<uInt>(compressed.size() - size);
+    [[maybe_unused]] const int result = deflate(&stream, Z_SYNC_FLUSH);
+    UASSERT(result == Z_OK || result == Z_BUF_ERROR);
+    size = compressed.size() - stream.avail_out;
+    // Everything is flushed if there is some space left
+    if (stream.avail_out != 0) break;
+    compressed.resize(compressed.size() * 2);
+  }
+
+  UASSERT(std::string_view{compressed}.substr(0, size).substr(
+              size - kSyncFlushTail.size()) == kSyncFlushTail);
+  compressed.resize(size - kSyncFlushTail.size());
+
+  if (params_.server_no_context_takeover) deflateReset(&stream);
+}
+
+bool MessageDeflate::Decompress(std::string& payload, std::size_t max_size) {
+  payload.append(kSyncFlushTail);
+
+  auto& stream = streams_->inflate;
+  stream.next_in = reinterpret_cast<Bytef*>(payload.data());
+  stream.avail_in = static_cast<uInt>(payload.size());
+
+  std::size_t size = 0;
+  buffer_.resize(std::min(
+      max_size + 1, std::max(kMinDecompressBufferSize, payload.size() * 4)));
+  while (true) {
+    stream.next_out = reinterpret_cast<Bytef*>(buffer_.data() + size);
+    stream.avail_out = static_cast<uInt>(buffer_.size() - size);
+    const int result = inflate(&stream, Z_SYNC_FLUSH);
+    size = buffer_.size() - stream.avail_out;
+
+    if (result == Z_STREAM_END) {
+      // The peer has finished the stream with BFINAL block
+      inflateReset(&stream);
+      break;
+    }
+    if (result != Z_OK && result != Z_BUF_ERROR) return false;
+    if (size > max_size) return false;
+    if (stream.avail_in == 0 && stream.avail_out != 0) break;
+    buffer_.resize(std::min(max_size + 1, buffer_.size() * 2));
+  }
+  if (size > max_size) return false;
+
+  // Both buffers keep their capacity for the next messages
+  buffer_.resize(size);
+  payload.swap(buffer_);
+  return true;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+/// Parameters of the permessage-deflate extension
+/// https://datatracker.ietf.org/doc/html/rfc7692#section-7.1
+struct DeflateParams final {
+  bool server_no_context_takeover{false};
+  bool client_no_context_takeover{false};
+  std::optional<int> server_max_window_bits;
+};
+
+/// Returns the parameters of the first permessage-deflate offer from the
+/// Sec-WebSocket-Extensions request header that the server supports
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions);
+
+/// Returns the value of Sec-WebSocket-Extensions response header
+std::string MakeDeflateResponse(const DeflateParams& params);
+
+/// @brief Compression state of a connection.
+///
+/// The sliding windows are kept between the messages unless the peer asked
+/// for no context takeover, so the repeating parts of small messages are
+/// compressed to a few bytes.
+class MessageDeflate final {
+ public:
+  explicit MessageDeflate(const DeflateParams& params);
+  ~MessageDeflate();
+
+  MessageDeflate(MessageDeflate&&) = delete;
+  MessageDeflate& operator=(MessageDeflate&&) = delete;
+
+  /// Compresses the payload of a message to send it with RSV1 bit set
+  void Compress(utils::span<const std::byte> data, std::string& compressed);
+
+  /// Decompresses the received message payload in place.
+  /// @returns false if the payload is not a valid deflate stream or is larger
+  /// than max_size after decompression
+  bool Decompress(std::string& payload, std::size_t max_size);
+
+ private:
+  struct Streams;
+
+  const DeflateParams params_;
+  std::unique_ptr<Streams> streams_;
+  std::string buffer_;
+};
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,122 @@
+#include <server/websocket/permessage_deflate.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::websocket::impl::DeflateParams;
+using server::websocket::impl::MakeDeflateResponse;
+using server::websocket::impl::MessageDeflate;
+using server::websocket::impl::NegotiateDeflate;
+
+utils::span<const std::byte> AsBytes(std::string_view data) {
+  return utils::as_bytes(utils::span<const char>{data.data(), data.size()});
+}
+
+std::string Negotiated(std::string_view extensions) {
+  const auto params = NegotiateDeflate(extensions);
+  return params ? MakeDeflateResponse(*params) : "<declined>";
+}
+
+}  // namespace
+
+TEST(WebsocketPermessageDeflate, Negotiate) {
+  EXPECT_EQ(Negotiated("permessage-deflate"), "permessage-deflate");
+  EXPECT_EQ(Negotiated("permessage-deflate; client_max_window_bits"),
+            "permessage-deflate");
+  EXPECT_EQ(Negotiated("Permessage-Deflate ;server_no_context_takeover"),
+            "permessage-deflate; server_no_context_takeover");
+  EXPECT_EQ(Negotiated("permessage-deflate; client_no_context_takeover; "
+                       "server_max_window_bits=\"10\""),
+            "permessage-deflate; client_no_context_takeover; "
+            "server_max_window_bits=10");
+  EXPECT_EQ(Negotiated("x-webkit-deflate-frame, permessage-deflate; "
+                       "server_max_window_bits=8, permessage-deflate"),
+            "permessage-deflate");
+
+  EXPECT_EQ(Negotiated(""), "<declined>");
+  EXPECT_EQ(Negotiated("x-webkit-deflate-frame"), "<declined>");
+  EXPECT_EQ(Negotiated("permessage-deflate; unknown"), "<declined>");
+  EXPECT_EQ(Negotiated("permessage-deflate; server_max_window_bits"),
+            "<declined>");
+  EXPECT_EQ(Negotiated("permessage-deflate; server_max_window_bits=16"),
+            "<declined>");
+  EXPECT_EQ(Negotiated("permessage-deflate; server_no_context_takeover; "
+                       "server_no_context_takeover"),
+            "<declined>");
+}
+
+TEST(WebsocketPermessageDeflate, RoundTrip) {
+  MessageDeflate server{DeflateParams{}};
+  MessageDeflate client{DeflateParams{}};
+
+  const std::string message =
+      R"({"type":"price","symbol":"ABC","bid":10.25,"ask":10.27})";
+  std::size_t first_size = 0;
+  for (int i = 0; i < 3; ++i) {
+    std::string compressed;
+    server.Compress(AsBytes(message), compressed);
+    ASSERT_FALSE(compressed.empty());
+    if (i == 0) first_size = compressed.size();
+
+    ASSERT_TRUE(client.Decompress(compressed, 1024));
+    EXPECT_EQ(compressed, message);
+  }
+
+  // The sliding window makes the repeated messages much smaller
+  std::string compressed;
+  server.Compress(AsBytes(message), compressed);
+  EXPECT_LT(compressed.size() * 3, first_size);
+}
+
+TEST(WebsocketPermessageDeflate, RfcExample) {
+  // https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.3.1
+  std::string payload = "\xf2\x48\xcd\xc9\xc9\x07\x00";
+  MessageDeflate client{DeflateParams{}};
+  ASSERT_TRUE(client.Decompress(payload, 1024));
+  EXPECT_EQ(payload, "Hello");
+}
+
+TEST(WebsocketPermessageDeflate, NoContextTakeover) {
+  DeflateParams params;
+  params.server_no_context_takeover = true;
+  MessageDeflate server{params};
+
+  const std::string message(200, 'a');
+  std::string first;
+  server.Compress(AsBytes(message), first);
+  std::string second;
+  server.Compress(AsBytes(message), second);
+  EXPECT_EQ(first, second);
+
+  // Each message can be decompressed separately
+  MessageDeflate client{DeflateParams{}};
+  ASSERT_TRUE(client.Decompress(second, 1024));
+  EXPECT_EQ(second, message);
+}
+
+TEST(WebsocketPermessageDeflate, DecompressLimits) {
+  MessageDeflate server{DeflateParams{}};
+  const std::string message(100000, 'x');
+  std::string compressed;
+  server.Compress(AsBytes(message), compressed);
+  EXPECT_LT(compressed.size(), 1000);
+
+  MessageDeflate small_client{DeflateParams{}};
+  auto payload = compressed;
+  EXPECT_FALSE(small_client.Decompress(payload, message.size() - 1));
+
+  MessageDeflate client{DeflateParams{}};
+  payload = compressed;
+  ASSERT_TRUE(client.Decompress(payload, message.size()));
+  EXPECT_EQ(payload, message);
+
+  std::string garbage = "\xff\xff\xff garbage";
+  EXPECT_FALSE(MessageDeflate{DeflateParams{}}.Decompress(garbage, 1024));
+}
+
+USERVER_NAMESPACE_END
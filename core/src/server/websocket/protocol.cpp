@@ -61,7 +61,7 @@ namespace frames {
 
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     utils::span<const std::byte> data, bool is_text,
-    Continuation is_continuation, Final is_final) {
+    Continuation is_continuation, Final is_final, Compressed is_compressed) {
   boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
   frame.resize(sizeof(WSHeader));
@@ -74,6 +74,10 @@ boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
   hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
   hdr->bits.opcode = is_text ? kText : kBinary;
   if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+  if (is_compressed == Compressed::kYes) {
+    UASSERT(is_continuation == Continuation::kNo);
+    hdr->bits.reserved = kReservedCompressed;
+  }
 
   if (data.size() <= 125) {
     hdr->bits.payloadLen = data.size();
@@ -178,6 +182,13 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
     return CloseStatus::kProtocolError;
   }
 
+  const bool is_compressed = hdr.bits.reserved & kReservedCompressed;
+  if (is_compressed && hdr.bits.opcode != kText &&
+      hdr.bits.opcode != kBinary) {
+    // only the first frame of a data message may be marked as compressed
+    return CloseStatus::kProtocolError;
+  }
+
   if (payload_len + frame.payload->size() > max_payload_size)
     return CloseStatus::kTooBigData;
 
@@ -224,6 +235,8 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
       frame.is_text = true;
       [[fallthrough]];
     case kBinary:
+      frame.is_compressed = is_compressed;
+      [[fallthrough]];
     case kContinuation:
       frame.waiting_continuation = !fin;
       break;
@@ -1,5 +1,8 @@
 #include <userver/server/websocket/server.hpp>
 
+#include <deque>
+#include <vector>
+
 #include <userver/components/component.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
@@ -14,14 +17,38 @@ USERVER_NAMESPACE_BEGIN
 namespace server::websocket {
 
 namespace {
-inline void SendExactly(engine::io::WritableBase& writable,
-                        utils::span<const char> data1,
-                        utils::span<const std::byte> data2) {
-  if (writable.WriteAll(
-          {{data1.data(), data1.size()}, {data2.data(), data2.size()}}, {}) !=
-      data1.size() + data2.size())
-    throw(engine::io::IoException() << "Socket closed during transfer");
-}
+
+// Frames of one or more messages that are written to the socket with a
+// single vectored write
+class FrameBatch final {
+ public:
+  // Data of the returned buffer is alive until the batch is destroyed
+  std::string& MakeBuffer() { return buffers_.emplace_back(); }
+
+  void Add(utils::span<const char> data) {
+    if (data.empty()) return;
+    chunks_.push_back({data.data(), data.size()});
+    size_ += data.size();
+  }
+
+  void Add(utils::span<const std::byte> data) {
+    if (data.empty()) return;
+    chunks_.push_back({data.data(), data.size()});
+    size_ += data.size();
+  }
+
+  void Write(engine::io::WritableBase& writable) const {
+    if (chunks_.empty()) return;
+    if (writable.WriteAll(chunks_.data(), chunks_.size(), {}) != size_)
+      throw(engine::io::IoException() << "Socket closed during transfer");
+  }
+
+ private:
+  // std::deque does not move the strings, so the chunks stay valid
+  std::deque<std::string> buffers_;
+  std::vector<engine::io::IoData> chunks_;
+  std::size_t size_{0};
+};
 
 Message CloseMessage(CloseStatus status) { return {{}, status, false}; }
 
@@ -29,16 +56,29 @@ utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) {
   return utils::as_bytes(span);
 }
 
-}  // namespace
-
-Config Parse(const yaml_config::YamlConfig& config,
-             formats::parse::To<Config>) {
-  return {
-      config["max-remote-payload"].As<unsigned>(65536),
-      config["fragment-size"].As<unsigned>(65536),
-  };
+template <typename OnFrame>
+void SplitToFrames(utils::span<const std::byte> data, bool is_text,
+                   impl::frames::Compressed is_compressed,
+                   unsigned fragment_size, OnFrame on_frame) {
+  auto continuation = impl::frames::Continuation::kNo;
+  while (data.size() > fragment_size && fragment_size > 0) {
+    const auto fragment = data.first(fragment_size);
+    on_frame(impl::frames::DataFrameHeader(fragment, is_text, continuation,
+                                           impl::frames::Final::kNo,
+                                           is_compressed),
+             fragment);
+    continuation = impl::frames::Continuation::kYes;
+    is_compressed = impl::frames::Compressed::kNo;
+    data = data.last(data.size() - fragment_size);
+  }
+  on_frame(impl::frames::DataFrameHeader(data, is_text, continuation,
+                                         impl::frames::Final::kYes,
+                                         is_compressed),
+           data);
 }
 
+}  // namespace
+
 class WebSocketConnectionImpl final : public WebSocketConnection {
  public:
  private:
@@ -64,55 +104,72 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
 
   Config config;
 
+  // Compression contexts are shared by all the messages of the connection,
+  // so the messages are compressed under write_mutex_ in the order they are
+  // written to the socket.
+  std::optional<impl::MessageDeflate> deflate_;
+
  public:
-  WebSocketConnectionImpl(std::unique_ptr<engine::io::RwBase> io_,
-                          const engine::io::Sockaddr& remote_addr,
-                          const Config& server_config)
-      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+  WebSocketConnectionImpl(
+      std::unique_ptr<engine::io::RwBase> io_,
+      const engine::io::Sockaddr& remote_addr, const Config& server_config,
+      const std::optional<impl::DeflateParams>& deflate_params)
+      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {
+    if (deflate_params) deflate_.emplace(*deflate_params);
+  }
 
   ~WebSocketConnectionImpl() override {
     LOG_TRACE() << "Websocket connection closed";
   }
 
-  void SendExtended(MessageExtended& message) {
+  void AddFrames(FrameBatch& batch, const MessageExtended& message) {
     stats_.msg_sent++;
     stats_.bytes_sent += message.data.size();
 
-    const std::unique_lock lock(write_mutex_);
-
     LOG_TRACE() << "Write message " << message.data.size() << " bytes";
     if (message.opcode == impl::WSOpcodes::kPing) {
-      SendExactly(*io, impl::frames::PingFrame(), {});
+      batch.Add(impl::frames::PingFrame());
     } else if (message.opcode == impl::WSOpcodes::kPong) {
       const auto control_frame =
           impl::frames::MakeControlFrame(impl::WSOpcodes::kPong, message.data);
-      SendExactly(*io, control_frame, message.data);
+      auto& control_frame_buffer = batch.MakeBuffer();
+      control_frame_buffer.assign(control_frame.begin(), control_frame.end());
+      batch.Add(control_frame_buffer);
+      batch.Add(message.data);
     } else if (message.close_status.has_value()) {
-      const auto close_frame = impl::frames::CloseFrame(
+      auto& close_frame = batch.MakeBuffer();
+      close_frame = impl::frames::CloseFrame(
           static_cast<int>(message.close_status.value()));
-      SendExactly(*io, close_frame, {});
+      batch.Add(close_frame);
     } else if (!message.data.empty()) {
       utils::span<const std::byte> data_to_send{message.data};
-      auto continuation = impl::frames::Continuation::kNo;
-      while (data_to_send.size() > config.fragment_size &&
-             config.fragment_size > 0) {
-        const auto data_frame_header = impl::frames::DataFrameHeader(
-            data_to_send.first(config.fragment_size),
-            message.opcode == impl::WSOpcodes::kText, continuation,
-            impl::frames::Final::kNo);
-        SendExactly(*io, data_frame_header,
-                    data_to_send.first(config.fragment_size));
-        continuation = impl::frames::Continuation::kYes;
-        data_to_send =
-            data_to_send.last(data_to_send.size() - config.fragment_size);
+      auto is_compressed = impl::frames::Compressed::kNo;
+      if (deflate_) {
+        auto& compressed = batch.MakeBuffer();
+        deflate_->Compress(data_to_send, compressed);
+        data_to_send = MakeBinarySpan(compressed);
+        is_compressed = impl::frames::Compressed::kYes;
       }
-      const auto data_frame_header = impl::frames::DataFrameHeader(
-          data_to_send, message.opcode == impl::WSOpcodes::kText, continuation,
-          impl::frames::Final::kYes);
-      SendExactly(*io, data_frame_header, data_to_send);
+
+      SplitToFrames(
+          data_to_send, message.opcode == impl::WSOpcodes::kText,
+          is_compressed, config.fragment_size,
+          [&batch](const auto& header, utils::span<const std::byte> data) {
+            auto& header_buffer = batch.MakeBuffer();
+            header_buffer.assign(header.begin(), header.end());
+            batch.Add(header_buffer);
+            batch.Add(data);
+          });
     }
   }
 
+  void SendExtended(const MessageExtended& message) {
+    FrameBatch batch;
+    const std::unique_lock lock(write_mutex_);
+    AddFrames(batch, message);
+    batch.Write(*io);
+  }
+
   void Send(const Message& message) override {
     MessageExtended mext{
         MakeBinarySpan(message.data),
@@ -121,6 +178,28 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
     SendExtended(mext);
   }
 
+  void SendBatch(utils::span<const Message> messages) override {
+    FrameBatch batch;
+    const std::unique_lock lock(write_mutex_);
+    for (const auto& message : messages) {
+      AddFrames(batch, {MakeBinarySpan(message.data),
+                        message.is_text ? impl::WSOpcodes::kText
+                                        : impl::WSOpcodes::kBinary,
+                        message.close_status});
+    }
+    batch.Write(*io);
+  }
+
+  void SendPrepared(const PreparedMessage& message) override {
+    stats_.msg_sent++;
+    stats_.bytes_sent += message.payload_size_;
+
+    FrameBatch batch;
+    batch.Add(message.frames_);
+    const std::unique_lock lock(write_mutex_);
+    batch.Write(*io);
+  }
+
   void SendText(std::string_view message) override {
     MessageExtended mext{MakeBinarySpan(message), impl::WSOpcodes::kText, {}};
     SendExtended(mext);
@@ -149,9 +228,7 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
             frame_.is_text, frame_.closed, frame_.payload->size(), status,
             frame_.waiting_continuation);
         if (status != 0) {
-          MessageExtended close_msg{{}, impl::WSOpcodes::kClose, status_raw};
-          SendExtended(close_msg);
-          msg = CloseMessage(status_raw);
+          CloseOnError(msg, status_raw);
           return;
         }
 
@@ -175,6 +252,18 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
         }
         if (frame_.waiting_continuation) continue;
 
+        if (frame_.is_compressed) {
+          if (!deflate_) {
+            // RSV1 bit is set without negotiated permessage-deflate
+            CloseOnError(msg, CloseStatus::kProtocolError);
+            return;
+          }
+          if (!deflate_->Decompress(msg.data, config.max_remote_payload)) {
+            CloseOnError(msg, CloseStatus::kBadMessageData);
+            return;
+          }
+        }
+
         msg.is_text = frame_.is_text;
         stats_.msg_recv++;
         stats_.bytes_recv += msg.data.size();
@@ -186,6 +275,11 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
     }
   }
 
+  void CloseOnError(Message& msg, CloseStatus status) {
+    SendExtended({{}, impl::WSOpcodes::kClose, status});
+    msg = CloseMessage(status);
+  }
+
   void Close(CloseStatus status_code) override {
     Send(CloseMessage(status_code));
   }
@@ -217,10 +311,22 @@ WebSocketConnection::~WebSocketConnection() = default;
 std::shared_ptr<WebSocketConnection> MakeWebSocket(
     std::unique_ptr<engine::io::RwBase>&& socket,
     engine::io::Sockaddr&& peer_name, const Config& config) {
+  return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config,
+                             std::nullopt);
+}
+
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateParams>& deflate_params) {
   return std::make_shared<WebSocketConnectionImpl>(
-      std::move(socket), std::move(peer_name), config);
+      std::move(socket), std::move(peer_name), config, deflate_params);
 }
 
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
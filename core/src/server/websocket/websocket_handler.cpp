@@ -73,14 +73,25 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
   response.SetHeader(USERVER_NAMESPACE::http::headers::kWebsocketAccept,
                      websocket::impl::WebsocketSecAnswer(secWebsocketKey));
 
+  std::optional<impl::DeflateParams> deflate_params;
+  if (config_.permessage_deflate) {
+    deflate_params = impl::NegotiateDeflate(request.GetHeader(
+        USERVER_NAMESPACE::http::headers::kWebsocketExtensions));
+    if (deflate_params) {
+      response.SetHeader(
+          USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+          impl::MakeDeflateResponse(*deflate_params));
+    }
+  }
+
   request.SetUpgradeWebsocket(
       [context = std::make_shared<server::request::RequestContext>(
            std::move(context)),
-       this](std::unique_ptr<engine::io::RwBase> socket,
+       deflate_params, this](std::unique_ptr<engine::io::RwBase> socket,
              engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket),
-                                           std::move(peer_name), config_);
+        auto ws = impl::MakeWebSocket(std::move(socket), std::move(peer_name),
+                                      config_, deflate_params);
         try {
           Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -116,6 +127,12 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    permessage-deflate:
+        type: boolean
+        description: |
+            compress the messages with permessage-deflate extension if the
+            client supports it
+        defaultDescription: false
 )");
 }
 
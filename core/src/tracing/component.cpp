@@ -5,6 +5,8 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <tracing/tail_sampling.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace components {
@@ -21,6 +23,9 @@ Tracer::Tracer(const ComponentConfig& config, const ComponentContext&) {
   } else {
     throw std::runtime_error("Tracer type is not supported: " + tracer_type);
   }
+
+  tracing::impl::SetTailSamplingConfig(
+      config["tail-sampling"].As<tracing::impl::TailSamplingConfig>({}));
 }
 
 yaml_config::Schema Tracer::GetStaticConfigSchema() {
@@ -37,6 +42,30 @@ properties:
         type: string
         description: type of the tracer to trace, currently supported only 'native'
         defaultDescription: 'native'
+    tail-sampling:
+        type: object
+        description: buffer the spans of a trace until its root span ends and log only the interesting traces
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: enable the tail-based sampling of the spans
+                defaultDescription: false
+            slow-threshold:
+                type: string
+                description: traces at least this long are always logged
+                defaultDescription: 1s
+            sample-percent:
+                type: number
+                description: percentage of the traces without errors and faster than slow-threshold to log
+                defaultDescription: 5
+                minimum: 0
+                maximum: 100
+            max-spans-per-trace:
+                type: integer
+                description: span records of a trace over this limit are dropped
+                defaultDescription: 1000
+                minimum: 1
 )");
 }
 
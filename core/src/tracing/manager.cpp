@@ -118,7 +118,7 @@ void OpenTelemetryFillWithTracingContext(const tracing::Span& span, T& target,
     traceflags = data->traceflags;
   }
   auto traceparent_result = opentelemetry::BuildTraceParentHeader(
-      span.GetTraceId(), span.GetSpanId(), traceflags);
+      span.GetTraceIdView(), span.GetSpanIdView(), traceflags);
 
   if (!traceparent_result.has_value()) {
     LOG_LIMITED(log_level) << fmt::format(
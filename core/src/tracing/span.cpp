@@ -1,5 +1,6 @@
 #include <tracing/span_impl.hpp>
 
+#include <thread>
 #include <type_traits>
 
 #include <fmt/compile.h>
@@ -7,14 +8,14 @@
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <utils/impl/random_pool.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/encoding/hex.hpp>
-#include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -27,6 +28,8 @@ using RealMilliseconds = std::chrono::duration<double, std::milli>;
 
 constexpr std::string_view kStopWatchTag = "stopwatch_name";
 constexpr std::string_view kTotalTimeTag = "total_time";
+constexpr std::string_view kCpuTimeTag = "cpu_time_us";
+constexpr std::string_view kAllocatedBytesTag = "allocated_bytes";
 constexpr std::string_view kTimeUnitsTag = "stopwatch_units";
 constexpr std::string_view kStartTimestampTag = "start_timestamp";
 
@@ -61,16 +64,114 @@ TsBuffer StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
-std::string GenerateSpanId() {
-  std::uniform_int_distribution<std::uint64_t> dist;
-  const auto random_value = utils::WithDefaultRandom(dist);
+constexpr std::string_view kHexDigits = "0123456789abcdef";
 
-  static_assert(sizeof(random_value) == 8);
-  return utils::encoding::ToHex(&random_value, 8);
+// The blocks of the freed Span::Impl, linked through their first bytes
+struct FreeImplBlock final {
+  FreeImplBlock* next;
+};
+
+constexpr std::size_t kMaxCachedImplBlocks = 16;
+
+struct ImplBlocksCache final {
+  ~ImplBlocksCache();
+
+  FreeImplBlock* head{nullptr};
+  std::size_t size{0};
+};
+
+// Trivially destructible, so it is safe to read while the thread_local
+// objects are being destroyed
+thread_local bool is_impl_blocks_cache_destroyed = false;
+thread_local ImplBlocksCache impl_blocks_cache;
+
+ImplBlocksCache::~ImplBlocksCache() {
+  is_impl_blocks_cache_destroyed = true;
+  while (head) {
+    ::operator delete(std::exchange(head, head->next));
+  }
 }
 
+static_assert(sizeof(Span::Impl) >= sizeof(FreeImplBlock));
+static_assert(alignof(Span::Impl) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
 }  // namespace
 
+namespace impl {
+
+void* AllocateSpanImplStorage() {
+  if (!is_impl_blocks_cache_destroyed) {
+    auto& cache = impl_blocks_cache;
+    if (cache.head) {
+      --cache.size;
+      return std::exchange(cache.head, cache.head->next);
+    }
+  }
+  return ::operator new(sizeof(Span::Impl));
+}
+
+void DeallocateSpanImplStorage(void* storage) noexcept {
+  if (!is_impl_blocks_cache_destroyed) {
+    auto& cache = impl_blocks_cache;
+    if (cache.size < kMaxCachedImplBlocks) {
+      cache.head = new (storage) FreeImplBlock{cache.head};
+      ++cache.size;
+      return;
+    }
+  }
+  ::operator delete(storage);
+}
+
+}  // namespace impl
+
+void DeleteImpl(Span::Impl* impl) noexcept {
+  impl->~Impl();
+  impl::DeallocateSpanImplStorage(impl);
+}
+
+std::string_view Span::Impl::LazyId::Get(Generator generate) const noexcept {
+  auto state = state_.load(std::memory_order_acquire);
+  if (state == State::kPending &&
+      state_.compare_exchange_strong(state, State::kGenerating,
+                                     std::memory_order_acquire)) {
+    generate(value_);
+    state_.store(State::kReady, std::memory_order_release);
+    return value_;
+  }
+  while (state != State::kReady) {
+    std::this_thread::yield();
+    state = state_.load(std::memory_order_acquire);
+  }
+  return value_;
+}
+
+void Span::Impl::LazyId::Set(std::string_view id) {
+  value_ = id;
+  state_.store(State::kReady, std::memory_order_release);
+}
+
+void Span::Impl::GenerateTraceId(Id& id) noexcept {
+  id = std::string_view{utils::generators::GenerateUuid()};
+}
+
+void Span::Impl::GenerateSpanId(Id& id) noexcept {
+  const auto random_value = [] {
+    auto pool = utils::impl::UseLocalRandomPool();
+    return pool->Next();
+  }();
+
+  static_assert(sizeof(random_value) == 8);
+  // Same digits as utils::encoding::ToHex, without a temporary std::string
+  id.resize_and_overwrite(16, [&random_value](char* data, std::size_t) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&random_value);
+    for (std::size_t i = 0; i < sizeof(random_value); ++i) {
+      data[2 * i] = kHexDigits[bytes[i] >> 4];
+      data[2 * i + 1] = kHexDigits[bytes[i] & 0xf];
+    }
+    return 16;
+  });
+}
+
 Span::Impl::Impl(std::string name, ReferenceType reference_type,
                  logging::Level log_level,
                  utils::impl::SourceLocation source_location)
@@ -86,30 +187,44 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
       tracer_(std::move(tracer)),
       start_system_time_(std::chrono::system_clock::now()),
       start_steady_time_(std::chrono::steady_clock::now()),
-      trace_id_(parent ? parent->GetTraceId()
-                       : utils::generators::GenerateUuid()),
-      span_id_(GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
       reference_type_(reference_type),
       source_location_(source_location) {
   if (parent) {
+    trace_id_.Set(parent->GetTraceId());
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
+    sampling_buffer_ = parent->sampling_buffer_;
+  } else {
+    sampling_buffer_ = impl::MakeTailSamplingBuffer();
+    is_sampling_root_ = sampling_buffer_ != nullptr;
   }
 }
 
 Span::Impl::~Impl() {
-  if (!ShouldLog()) {
-    return;
+  if (sampling_buffer_ && HasError()) {
+    sampling_buffer_->MarkAsError();
   }
 
-  {
+  if (ShouldLog()) {
     const DetachLocalSpansScope ignore_local_span;
-    logging::LogHelper lh{logging::GetDefaultLogger(), log_level_,
-                          source_location_};
+    logging::LogHelper lh{sampling_buffer_
+                              ? *sampling_buffer_
+                              : logging::GetDefaultLogger(),
+                          log_level_, source_location_};
     lh.MarkAsTrace(logging::LogHelper::InternalTag{});
     std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
   }
+
+  if (is_sampling_root_) {
+    try {
+      sampling_buffer_->Finish(std::chrono::steady_clock::now() -
+                               start_steady_time_);
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false, fmt::format("Failed to log a sampled trace: {}",
+                                     e.what()));
+    }
+  }
 }
 
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
@@ -129,6 +244,15 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   writer.PutTag(kTimeUnitsTag, "ms");
   writer.PutTag(kStartTimestampTag, timestamp_buffer.ToStringView());
 
+  if (const auto resource_usage = resource_usage_stopwatch_.GetElapsed()) {
+    writer.PutTag(
+        kCpuTimeTag,
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            resource_usage->cpu_time)
+            .count());
+    writer.PutTag(kAllocatedBytesTag, resource_usage->allocated_bytes);
+  }
+
   time_storage_.MergeInto(writer);
 
   if (log_extra_local_) {
@@ -144,14 +268,32 @@ void Span::Impl::LogTo(logging::impl::TagWriter writer) {
   tracer_->LogSpanContextTo(*this, writer);
 }
 
-void Span::Impl::DetachFromCoroStack() { unlink(); }
+void Span::Impl::DetachFromCoroStack() {
+  if (!is_linked()) return;
+  unlink();
+
+  // The span could have been on a stack of another task, so check the stack
+  // of the current one
+  auto* const context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (context && context->HasLocalStorage()) {
+    const auto* spans_ptr = task_local_spans.GetOptional();
+    if (!spans_ptr || spans_ptr->empty()) context->GetProfilerLabel().Clear();
+  }
+}
 
 void Span::Impl::AttachToCoroStack() {
   UASSERT(!is_linked());
-  task_local_spans->push_back(*this);
+  auto& spans = *task_local_spans;
+  spans.push_back(*this);
+  if (&spans.front() == this) {
+    // The root span names the work of the task in the CPU profiles
+    engine::current_task::GetCurrentTaskContext().GetProfilerLabel().Set(
+        name_);
+  }
 }
 
-std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
+std::string_view Span::Impl::GetParentIdForLogging(
+    const Span::Impl* parent) {
   if (!parent) return {};
 
   if (!parent->is_linked()) {
@@ -187,9 +329,24 @@ bool Span::Impl::ShouldLog() const {
          local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
 }
 
+bool Span::Impl::HasError() const {
+  if (log_level_ >= logging::Level::kError &&
+      log_level_ != logging::Level::kNone) {
+    return true;
+  }
+
+  // LogExtra::Value stores `AddTag(kErrorFlag, true)` as int
+  const auto is_error_flag = [](const logging::LogExtra& log_extra) {
+    const auto* const flag = std::get_if<int>(&log_extra.GetValue(kErrorFlag));
+    return flag && *flag != 0;
+  };
+  return is_error_flag(log_extra_inheritable_) ||
+         (log_extra_local_ && is_error_flag(*log_extra_local_));
+}
+
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
   if (do_delete) {
-    std::default_delete<Impl>{}(impl);
+    DeleteImpl(impl);
   }
 }
 
@@ -269,8 +426,8 @@ Span* Span::CurrentSpanUnchecked() {
 Span Span::MakeSpan(std::string name, std::string_view trace_id,
                     std::string_view parent_span_id) {
   Span span(std::move(name));
-  if (!trace_id.empty()) span.pimpl_->SetTraceId(std::string{trace_id});
-  span.pimpl_->SetParentId(std::string{parent_span_id});
+  if (!trace_id.empty()) span.pimpl_->SetTraceId(trace_id);
+  span.pimpl_->SetParentId(parent_span_id);
   return span;
 }
 
@@ -279,8 +436,8 @@ Span Span::MakeSpan(std::string name, std::string_view trace_id,
   Span span(Tracer::GetTracer(), std::move(name), nullptr,
             ReferenceType::kChild);
   span.SetLink(std::move(link));
-  if (!trace_id.empty()) span.pimpl_->SetTraceId(std::string{trace_id});
-  span.pimpl_->SetParentId(std::string{parent_span_id});
+  if (!trace_id.empty()) span.pimpl_->SetTraceId(trace_id);
+  span.pimpl_->SetParentId(parent_span_id);
   return span;
 }
 
@@ -392,11 +549,29 @@ std::chrono::system_clock::time_point Span::GetStartSystemTime() const {
   return pimpl_->start_system_time_;
 }
 
-const std::string& Span::GetTraceId() const { return pimpl_->GetTraceId(); }
+std::string Span::GetTraceId() const {
+  return std::string{pimpl_->GetTraceId()};
+}
+
+std::string Span::GetSpanId() const {
+  return std::string{pimpl_->GetSpanId()};
+}
+
+std::string Span::GetParentId() const {
+  return std::string{pimpl_->GetParentId()};
+}
 
-const std::string& Span::GetSpanId() const { return pimpl_->GetSpanId(); }
+std::string_view Span::GetTraceIdView() const noexcept {
+  return pimpl_->GetTraceId();
+}
 
-const std::string& Span::GetParentId() const { return pimpl_->GetParentId(); }
+std::string_view Span::GetSpanIdView() const noexcept {
+  return pimpl_->GetSpanId();
+}
+
+std::string_view Span::GetParentIdView() const noexcept {
+  return pimpl_->GetParentId();
+}
 
 ScopeTime::Duration Span::GetTotalDuration(
     const std::string& scope_name) const {
@@ -33,7 +33,11 @@ void SpanBuilder::SetTraceId(std::string trace_id) {
   pimpl_->SetTraceId(std::move(trace_id));
 }
 
-const std::string& SpanBuilder::GetTraceId() const noexcept {
+std::string SpanBuilder::GetTraceId() const {
+  return std::string{pimpl_->GetTraceId()};
+}
+
+std::string_view SpanBuilder::GetTraceIdView() const noexcept {
   return pimpl_->GetTraceId();
 }
 
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <list>
+#include <new>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -17,7 +20,10 @@
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
+#include <userver/utils/small_string.hpp>
 
+#include <engine/task/resource_usage.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <tracing/time_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -41,8 +47,6 @@ class Span::Impl
        ReferenceType reference_type, logging::Level log_level,
        utils::impl::SourceLocation source_location);
 
-  Impl(Impl&&) = default;
-
   ~Impl();
 
   impl::TimeStorage& GetTimeStorage() { return time_storage_; }
@@ -54,17 +58,17 @@ class Span::Impl
   // Add the context of this Span a non-Span-specific log record
   void LogTo(logging::impl::TagWriter writer);
 
-  const std::string& GetTraceId() const& noexcept { return trace_id_; }
-  const std::string& GetSpanId() const& noexcept { return span_id_; }
-  const std::string& GetParentId() const& noexcept { return parent_id_; }
-
-  std::string GetTraceId() && noexcept { return std::move(trace_id_); }
-  std::string GetSpanId() && noexcept { return std::move(span_id_); }
-  std::string GetParentId() && noexcept { return std::move(parent_id_); }
+  std::string_view GetTraceId() const noexcept {
+    return trace_id_.Get(&GenerateTraceId);
+  }
+  std::string_view GetSpanId() const noexcept {
+    return span_id_.Get(&GenerateSpanId);
+  }
+  std::string_view GetParentId() const noexcept { return parent_id_; }
 
-  void SetTraceId(std::string&& id) noexcept { trace_id_ = std::move(id); }
-  void SetSpanId(std::string&& id) noexcept { span_id_ = std::move(id); }
-  void SetParentId(std::string&& id) noexcept { parent_id_ = std::move(id); }
+  void SetTraceId(std::string_view id) { trace_id_.Set(id); }
+  void SetSpanId(std::string_view id) { span_id_.Set(id); }
+  void SetParentId(std::string_view id) { parent_id_ = id; }
 
   ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
@@ -72,8 +76,35 @@ class Span::Impl
   void AttachToCoroStack();
 
  private:
-  static std::string GetParentIdForLogging(const Span::Impl* parent);
+  // Fits the 32 hex digits of a UUID-based trace id, so that neither the
+  // generated nor the inherited ids allocate
+  using Id = utils::SmallString<32>;
+
+  // Generated on the first access unless set before, so the spans that are
+  // neither logged nor propagated do not pay for their ids. The first access
+  // may come from several tasks at once, e.g. via CreateChild().
+  class LazyId final {
+   public:
+    using Generator = void (*)(Id&) noexcept;
+
+    std::string_view Get(Generator generate) const noexcept;
+
+    // Must not race with Get()
+    void Set(std::string_view id);
+
+   private:
+    enum class State : std::uint8_t { kPending, kGenerating, kReady };
+
+    mutable Id value_;
+    mutable std::atomic<State> state_{State::kPending};
+  };
+
+  static void GenerateTraceId(Id& id) noexcept;
+  static void GenerateSpanId(Id& id) noexcept;
+
+  static std::string_view GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
+  bool HasError() const;
 
   const std::string name_;
   const bool is_no_log_span_;
@@ -90,13 +121,18 @@ class Span::Impl
 
   const std::chrono::system_clock::time_point start_system_time_;
   const std::chrono::steady_clock::time_point start_steady_time_;
+  const engine::impl::TaskResourceUsageStopwatch resource_usage_stopwatch_;
 
-  std::string trace_id_;
-  std::string span_id_;
-  std::string parent_id_;
+  LazyId trace_id_;
+  LazyId span_id_;
+  Id parent_id_;
   const ReferenceType reference_type_;
   utils::impl::SourceLocation source_location_;
 
+  // Shared by all the spans of a local trace, see tracing/tail_sampling.hpp
+  std::shared_ptr<impl::TailSamplingBuffer> sampling_buffer_;
+  bool is_sampling_root_{false};
+
   friend class Span;
   friend class SpanBuilder;
   friend class TagScope;
@@ -110,11 +146,29 @@ using SpanStack =
 
 const Span::Impl* GetParentSpanImpl();
 
+namespace impl {
+
+// Span::Impl is large because of the inline tags storage, the freed blocks
+// are cached per thread to keep the span creation off the allocator
+void* AllocateSpanImplStorage();
+void DeallocateSpanImplStorage(void* storage) noexcept;
+
+}  // namespace impl
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-  return new Span::Impl(std::forward<Args>(args)...);
+  void* const storage = impl::AllocateSpanImplStorage();
+  try {
+    return new (storage) Span::Impl(std::forward<Args>(args)...);
+  } catch (...) {
+    impl::DeallocateSpanImplStorage(storage);
+    throw;
+  }
 }
 
+// Destroys a Span::Impl returned by AllocateImpl()
+void DeleteImpl(Span::Impl* impl) noexcept;
+
 class DetachLocalSpansScope final {
  public:
   DetachLocalSpansScope() noexcept;
@@ -4,11 +4,15 @@
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/tail_sampling.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/regex.hpp>
 #include <userver/utils/text_light.hpp>
 
@@ -136,6 +140,22 @@ UTEST_F(Span, NonInheritTag) {
   EXPECT_THAT(GetStreamString(), Not(HasSubstr("k=v")));
 }
 
+UTEST_F(Span, LogExtraOverridesInheritTag) {
+  tracing::Span span("span_name");
+  span.AddTag("k", "span");
+  span.AddTagFrozen("frozen", "span");
+
+  LOG_INFO() << "inside"
+             << logging::LogExtra{{"k", "record"}, {"frozen", "record"}};
+  logging::LogFlush();
+
+  const auto log = GetStreamString();
+  EXPECT_THAT(log, HasSubstr("k=record"));
+  EXPECT_THAT(log, Not(HasSubstr("k=span")));
+  EXPECT_THAT(log, HasSubstr("frozen=span"));
+  EXPECT_THAT(log, Not(HasSubstr("frozen=record")));
+}
+
 UTEST_F(Span, ScopeTime) {
   {
     tracing::Span span("span_name");
@@ -604,4 +624,121 @@ UTEST_F(Span, MakeSpanWithParentIdTraceIdLinkWithExisting) {
   }
 }
 
+UTEST_F(Span, IdsAreStable) {
+  tracing::Span first("first");
+  tracing::Span second("second");
+
+  const std::string span_id{first.GetSpanId()};
+  EXPECT_EQ(span_id.size(), 16);
+  EXPECT_EQ(first.GetSpanId(), span_id);
+  EXPECT_NE(second.GetSpanId(), span_id);
+
+  const std::string trace_id{first.GetTraceId()};
+  EXPECT_FALSE(trace_id.empty());
+  EXPECT_EQ(first.GetTraceId(), trace_id);
+  EXPECT_NE(second.GetTraceId(), trace_id);
+
+  EXPECT_EQ(first.GetSpanIdView(), span_id);
+  EXPECT_EQ(first.GetTraceIdView(), trace_id);
+  EXPECT_EQ(first.GetParentIdView(), first.GetParentId());
+}
+
+UTEST_F_MT(Span, ConcurrentChildrenSeeSameIds, 4) {
+  constexpr std::size_t kTasks = 16;
+
+  for (int i = 0; i < 100; ++i) {
+    const auto parent = tracing::Span::MakeRootSpan("parent");
+
+    std::vector<engine::TaskWithResult<std::string>> tasks;
+    tasks.reserve(kTasks);
+    for (std::size_t j = 0; j < kTasks; ++j) {
+      tasks.push_back(engine::AsyncNoSpan([&parent] {
+        const auto child = parent.CreateChild("child");
+        EXPECT_EQ(child.GetTraceId(), parent.GetTraceId());
+        return std::string{child.GetParentId()};
+      }));
+    }
+    for (auto& task : tasks) {
+      EXPECT_EQ(task.Get(), parent.GetSpanId());
+    }
+  }
+}
+
+namespace {
+
+auto SetTailSampling(double sample_percent,
+                     std::chrono::milliseconds slow_threshold) {
+  tracing::impl::TailSamplingConfig config;
+  config.enabled = true;
+  config.sample_percent = sample_percent;
+  config.slow_threshold = slow_threshold;
+  tracing::impl::SetTailSamplingConfig(config);
+
+  return utils::FastScopeGuard([]() noexcept {
+    tracing::impl::SetTailSamplingConfig({});
+  });
+}
+
+}  // namespace
+
+UTEST_F(Span, TailSamplingDropsTrace) {
+  const auto guard = SetTailSampling(0, std::chrono::hours{1});
+
+  {
+    auto root_span = tracing::Span::MakeRootSpan("sampled_root");
+    tracing::Span child("sampled_child");
+    LOG_INFO() << "not a span record";
+  }
+  logging::LogFlush();
+
+  EXPECT_THAT(GetStreamString(), HasSubstr("not a span record"));
+  EXPECT_THAT(GetStreamString(), Not(HasSubstr("sampled_root")));
+  EXPECT_THAT(GetStreamString(), Not(HasSubstr("sampled_child")));
+}
+
+UTEST_F(Span, TailSamplingKeepsErrorTrace) {
+  const auto guard = SetTailSampling(0, std::chrono::hours{1});
+
+  {
+    auto root_span = tracing::Span::MakeRootSpan("sampled_root");
+    {
+      tracing::Span child("sampled_child");
+      child.AddNonInheritableTag(tracing::kErrorFlag, true);
+    }
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("sampled_child")));
+  }
+  logging::LogFlush();
+
+  EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_root"));
+  EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_child"));
+}
+
+UTEST_F(Span, TailSamplingKeepsSlowTrace) {
+  const auto guard = SetTailSampling(0, std::chrono::milliseconds{1});
+
+  {
+    auto root_span = tracing::Span::MakeRootSpan("sampled_root");
+    tracing::Span child("sampled_child");
+    engine::SleepFor(std::chrono::milliseconds{2});
+  }
+  logging::LogFlush();
+
+  EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_root"));
+  EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_child"));
+}
+
+UTEST_F(Span, TailSamplingKeepsSampledTrace) {
+  const auto guard = SetTailSampling(100, std::chrono::hours{1});
+
+  {
+    auto root_span = tracing::Span::MakeRootSpan("sampled_root");
+    tracing::Span child("sampled_child");
+  }
+  logging::LogFlush();
+
+  EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_root"));
+  EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_child"));
+}
+
 USERVER_NAMESPACE_END
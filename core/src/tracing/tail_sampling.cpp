@@ -0,0 +1,139 @@
+#include <tracing/tail_sampling.hpp>
+
+#include <random>
+#include <stdexcept>
+
+#include <userver/logging/impl/tag_writer.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+
+auto& GlobalTailSamplingConfig() {
+  static rcu::Variable<TailSamplingConfig> config{};
+  return config;
+}
+
+void ForwardToDefaultLogger(logging::Level level, std::string_view msg,
+                            bool is_trace) {
+  auto& logger = logging::GetDefaultLogger();
+  if (is_trace) {
+    logger.Trace(level, msg);
+  } else {
+    logger.Log(level, msg);
+  }
+}
+
+}  // namespace
+
+TailSamplingConfig Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<TailSamplingConfig>) {
+  TailSamplingConfig config;
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.slow_threshold = value["slow-threshold"].As<std::chrono::milliseconds>(
+      config.slow_threshold);
+  config.sample_percent =
+      value["sample-percent"].As<double>(config.sample_percent);
+  config.max_spans_per_trace =
+      value["max-spans-per-trace"].As<std::size_t>(config.max_spans_per_trace);
+
+  if (config.sample_percent < 0 || config.sample_percent > 100) {
+    throw std::runtime_error(
+        "Invalid tail-sampling.sample-percent, must be in [0, 100]");
+  }
+  return config;
+}
+
+void SetTailSamplingConfig(const TailSamplingConfig& config) {
+  GlobalTailSamplingConfig().Assign(config);
+}
+
+TailSamplingBuffer::TailSamplingBuffer(logging::Format format,
+                                       const TailSamplingConfig& config)
+    : LoggerBase(format), config_(config) {
+  // Levels are checked by the spans themselves
+  SetLevel(logging::Level::kTrace);
+}
+
+void TailSamplingBuffer::Log(logging::Level level, std::string_view msg) {
+  DoLog(level, msg, false);
+}
+
+void TailSamplingBuffer::Trace(logging::Level level, std::string_view msg) {
+  DoLog(level, msg, true);
+}
+
+void TailSamplingBuffer::PrependCommonTags(
+    logging::impl::TagWriter writer) const {
+  logging::GetDefaultLogger().PrependCommonTags(writer);
+}
+
+void TailSamplingBuffer::MarkAsError() noexcept { has_error_ = true; }
+
+void TailSamplingBuffer::Finish(
+    std::chrono::steady_clock::duration root_duration) {
+  std::vector<Record> records;
+  {
+    const std::lock_guard lock{mutex_};
+    UASSERT(state_ == State::kBuffering);
+    if (!ShouldKeep(root_duration)) {
+      state_ = State::kDropped;
+      records_.clear();
+      return;
+    }
+    state_ = State::kKept;
+    records = std::move(records_);
+  }
+
+  for (const auto& record : records) {
+    ForwardToDefaultLogger(record.level, record.payload, record.is_trace);
+  }
+}
+
+void TailSamplingBuffer::DoLog(logging::Level level, std::string_view msg,
+                               bool is_trace) {
+  {
+    const std::lock_guard lock{mutex_};
+    switch (state_) {
+      case State::kBuffering:
+        if (records_.size() < config_.max_spans_per_trace) {
+          records_.push_back(Record{level, is_trace, std::string{msg}});
+        }
+        return;
+      case State::kDropped:
+        return;
+      case State::kKept:
+        break;
+    }
+  }
+
+  // A span that outlived the root span of a kept trace
+  ForwardToDefaultLogger(level, msg, is_trace);
+}
+
+bool TailSamplingBuffer::ShouldKeep(
+    std::chrono::steady_clock::duration root_duration) const {
+  if (has_error_ || root_duration >= config_.slow_threshold) return true;
+
+  std::uniform_real_distribution<double> dist{0.0, 100.0};
+  return utils::WithDefaultRandom(dist) < config_.sample_percent;
+}
+
+std::shared_ptr<TailSamplingBuffer> MakeTailSamplingBuffer() {
+  const auto config = GlobalTailSamplingConfig().Read();
+  if (!config->enabled) return nullptr;
+
+  return std::make_shared<TailSamplingBuffer>(
+      logging::GetDefaultLogger().GetFormat(), *config);
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+// With the tail-based sampling, records of all the spans of a local trace are
+// buffered in memory until the local root span ends. The trace is then either
+// logged in full, or dropped.
+struct TailSamplingConfig final {
+  bool enabled{false};
+  // Traces at least this long are always logged
+  std::chrono::milliseconds slow_threshold{std::chrono::seconds{1}};
+  // Percentage of the rest of the traces to log, 0..100
+  double sample_percent{5.0};
+  // Records of a single trace over this limit are dropped
+  std::size_t max_spans_per_trace{1000};
+};
+
+TailSamplingConfig Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<TailSamplingConfig>);
+
+void SetTailSamplingConfig(const TailSamplingConfig& config);
+
+/// Buffers the span records of a single trace. Span records are written into
+/// the buffer as into a logger, the buffer forwards them to the default logger
+/// if the trace is kept. Thread-safe, the spans of a trace may end in
+/// different tasks.
+class TailSamplingBuffer final : public logging::impl::LoggerBase {
+ public:
+  TailSamplingBuffer(logging::Format format, const TailSamplingConfig& config);
+
+  void Log(logging::Level level, std::string_view msg) override;
+  void Trace(logging::Level level, std::string_view msg) override;
+  void PrependCommonTags(logging::impl::TagWriter writer) const override;
+
+  /// Traces with errors are always kept
+  void MarkAsError() noexcept;
+
+  /// Called at the end of the root span, after its own record was written
+  void Finish(std::chrono::steady_clock::duration root_duration);
+
+ private:
+  enum class State { kBuffering, kKept, kDropped };
+
+  struct Record final {
+    logging::Level level;
+    bool is_trace;
+    std::string payload;
+  };
+
+  void DoLog(logging::Level level, std::string_view msg, bool is_trace);
+  bool ShouldKeep(std::chrono::steady_clock::duration root_duration) const;
+
+  const TailSamplingConfig config_;
+  std::atomic<bool> has_error_{false};
+
+  std::mutex mutex_;
+  State state_{State::kBuffering};
+  std::vector<Record> records_;
+};
+
+/// Returns nullptr if the tail-based sampling is disabled
+std::shared_ptr<TailSamplingBuffer> MakeTailSamplingBuffer();
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,8 @@
 #include <userver/logging/null_logger.hpp>
 #include <userver/tracing/tracer.hpp>
 
+#include <utils/gbench_allocations.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -12,12 +14,38 @@ void tracing_noop_ctr(benchmark::State& state) {
   engine::RunStandalone([&] {
     auto tracer = tracing::MakeTracer("test_service");
 
+    const utils::bench::AllocationsReporter allocations_reporter{state};
     for ([[maybe_unused]] auto _ : state)
       benchmark::DoNotOptimize(tracer->CreateSpanWithoutParent("name"));
   });
 }
 BENCHMARK(tracing_noop_ctr);
 
+void tracing_child_ctr(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    auto tracer = tracing::MakeTracer("test_service");
+    const auto parent = tracer->CreateSpanWithoutParent("parent");
+
+    // The child copies the trace id and the parent span id
+    const utils::bench::AllocationsReporter allocations_reporter{state};
+    for ([[maybe_unused]] auto _ : state)
+      benchmark::DoNotOptimize(parent.CreateChild("name"));
+  });
+}
+BENCHMARK(tracing_child_ctr);
+
+void tracing_make_span_ctr(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    // An incoming request with the ids in its headers
+    const utils::bench::AllocationsReporter allocations_reporter{state};
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(tracing::Span::MakeSpan(
+          "name", "1234567890abcdef1234567890abcdef", "1234567890abcdef"));
+    }
+  });
+}
+BENCHMARK(tracing_make_span_ctr);
+
 void tracing_happy_log(benchmark::State& state) {
   logging::DefaultLoggerGuard guard{logging::MakeNullLogger()};
 
@@ -44,6 +72,7 @@ tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
 void tracing_opentracing_ctr(benchmark::State& state) {
   engine::RunStandalone([&] {
     auto tracer = tracing::MakeTracer("test_service");
+    const utils::bench::AllocationsReporter allocations_reporter{state};
     for ([[maybe_unused]] auto _ : state) {
       benchmark::DoNotOptimize(GetSpanWithOpentracingHttpTags(tracer));
     }
@@ -3,6 +3,7 @@
 #include <tracing/span_impl.hpp>
 #include <userver/baggage/baggage_manager.hpp>
 #include <userver/engine/task/inherited_variable.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
 #include <userver/tracing/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -42,6 +43,15 @@ void SpanWrapCall::DoBeforeInvoke() {
 
 SpanWrapCall::~SpanWrapCall() = default;
 
+engine::impl::TaskConfig MakeInheritingTaskConfig(
+    engine::TaskProcessor& task_processor, engine::Deadline deadline) {
+  return {task_processor, engine::Task::Importance::kNormal,
+          engine::Task::WaitMode::kSingleWaiter, deadline,
+          engine::current_task::IsTaskProcessorThread()
+              ? server::request::GetTaskInheritedDeadline()
+              : engine::Deadline{}};
+}
+
 }  // namespace utils::impl
 
 USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utest/utest.hpp>
 
 #include <engine/ev/thread_control.hpp>
@@ -32,6 +33,37 @@ UTEST(UtilsAsync, WithPassedDeadline) {
   UEXPECT_THROW(task.Get(), engine::TaskCancelledException);
 }
 
+UTEST(UtilsAsync, WithPassedDeadlineDoesNotStart) {
+  bool started = false;
+  auto task = utils::Async(
+      "async", engine::Deadline::FromDuration(std::chrono::seconds(-1)),
+      [&started] { started = true; });
+  UEXPECT_THROW(task.Get(), engine::TaskCancelledException);
+  EXPECT_FALSE(started);
+}
+
+UTEST(UtilsAsync, PassedInheritedDeadlineDoesNotStart) {
+  server::request::kTaskInheritedData.Set({
+      "handler",
+      "GET",
+      std::chrono::steady_clock::now(),
+      engine::Deadline::Passed(),
+  });
+
+  bool started = false;
+  auto task = utils::Async("async", [&started] { started = true; });
+  UEXPECT_THROW(task.Get(), engine::TaskCancelledException);
+  EXPECT_FALSE(started);
+
+  // Critical tasks start regardless of the deadline
+  EXPECT_EQ(utils::CriticalAsync("critical", [] { return 1; }).Get(), 1);
+
+  {
+    const server::request::DeadlinePropagationBlocker blocker;
+    EXPECT_EQ(utils::Async("blocked", [] { return 2; }).Get(), 2);
+  }
+}
+
 UTEST(UtilsAsync, WithDeadlineCancellationPoint) {
   auto task = utils::Async(
       "async", engine::Deadline::FromDuration(std::chrono::milliseconds(42)),
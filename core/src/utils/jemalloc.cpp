@@ -6,6 +6,10 @@
 #include <cerrno>
 #endif
 
+#include <sys/types.h>
+
+#include <fmt/format.h>
+
 #include <userver/utils/thread_name.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -36,6 +40,34 @@ std::error_code MallCtl(const char* name) {
   return MakeErrorCode(rc);
 }
 
+template <typename T>
+std::error_code MallCtlRead(const char* name, T& value) {
+  std::size_t size = sizeof(value);
+  int rc = mallctl(name, &value, &size, nullptr, 0);
+  return MakeErrorCode(rc);
+}
+
+// The stats are cached by jemalloc until the epoch is advanced
+std::error_code RefreshStats() {
+  return MallCtl<std::uint64_t>("epoch", 1);
+}
+
+std::error_code SetDecay(std::string_view kind,
+                         std::chrono::milliseconds decay) {
+  const auto decay_ms = static_cast<ssize_t>(decay.count());
+  auto ec = MallCtl(fmt::format("arenas.{}_decay_ms", kind).c_str(), decay_ms);
+  if (ec) return ec;
+
+  unsigned arenas_count = 0;
+  ec = MallCtlRead("arenas.narenas", arenas_count);
+  if (ec) return ec;
+  for (unsigned i = 0; i < arenas_count; ++i) {
+    // The arenas may be not initialized yet, those get the default
+    MallCtl(fmt::format("arena.{}.{}_decay_ms", i, kind).c_str(), decay_ms);
+  }
+  return {};
+}
+
 void MallocStatPrintCb(void* data, const char* msg) {
   auto* s = static_cast<std::string*>(data);
   *s += msg;
@@ -68,6 +100,71 @@ std::error_code StopBgThreads() {
   return MallCtl<bool>("background_thread", false);
 }
 
+const std::uint64_t* GetThreadAllocatedBytesCounter() noexcept {
+  std::uint64_t* counter = nullptr;
+  std::size_t size = sizeof(counter);
+  if (mallctl("thread.allocatedp", &counter, &size, nullptr, 0) != 0) {
+    return nullptr;
+  }
+  return counter;
+}
+
+std::error_code GetMemoryStats(MemoryStats& stats) {
+  auto ec = RefreshStats();
+  if (ec) return ec;
+
+  for (auto [name, field] : {
+           std::pair{"stats.allocated", &stats.allocated},
+           std::pair{"stats.active", &stats.active},
+           std::pair{"stats.metadata", &stats.metadata},
+           std::pair{"stats.resident", &stats.resident},
+           std::pair{"stats.mapped", &stats.mapped},
+           std::pair{"stats.retained", &stats.retained},
+       }) {
+    ec = MallCtlRead(name, *field);
+    if (ec) return ec;
+  }
+  return {};
+}
+
+std::error_code GetArenaStats(unsigned arena_index, ArenaStats& stats) {
+  auto ec = RefreshStats();
+  if (ec) return ec;
+
+  std::size_t page_size = 0;
+  ec = MallCtlRead("arenas.page", page_size);
+  if (ec) return ec;
+
+  for (auto [name, field] : {
+           std::pair{"pactive", &stats.active_bytes},
+           std::pair{"pdirty", &stats.dirty_bytes},
+           std::pair{"pmuzzy", &stats.muzzy_bytes},
+       }) {
+    std::size_t pages = 0;
+    ec = MallCtlRead(
+        fmt::format("stats.arenas.{}.{}", arena_index, name).c_str(), pages);
+    if (ec) return ec;
+    *field = pages * page_size;
+  }
+  return {};
+}
+
+std::error_code CreateArena(unsigned& arena_index) {
+  return MallCtlRead("arenas.create", arena_index);
+}
+
+std::error_code SetThreadArena(unsigned arena_index) {
+  return MallCtl("thread.arena", arena_index);
+}
+
+std::error_code SetDirtyDecay(std::chrono::milliseconds decay) {
+  return SetDecay("dirty", decay);
+}
+
+std::error_code SetMuzzyDecay(std::chrono::milliseconds decay) {
+  return SetDecay("muzzy", decay);
+}
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <system_error>
 
@@ -22,6 +25,45 @@ std::error_code EnableBgThreads();
 // blocking
 std::error_code StopBgThreads();
 
+// Pointer to the monotonic counter of bytes allocated by the current thread,
+// nullptr if jemalloc is not available
+const std::uint64_t* GetThreadAllocatedBytesCounter() noexcept;
+
+// Totals of the process, consult `stats.*` of jemalloc(3)
+struct MemoryStats {
+  std::size_t allocated{0};
+  std::size_t active{0};
+  std::size_t metadata{0};
+  std::size_t resident{0};
+  std::size_t mapped{0};
+  std::size_t retained{0};
+};
+
+// Refreshes the cached jemalloc stats
+std::error_code GetMemoryStats(MemoryStats& stats);
+
+struct ArenaStats {
+  // Pages of the active allocations
+  std::size_t active_bytes{0};
+  // Free pages that are not purged yet, the fragmentation of the arena
+  std::size_t dirty_bytes{0};
+  std::size_t muzzy_bytes{0};
+};
+
+// Refreshes the cached jemalloc stats
+std::error_code GetArenaStats(unsigned arena_index, ArenaStats& stats);
+
+std::error_code CreateArena(unsigned& arena_index);
+
+// The allocations of the current thread are served by the arena from now on
+std::error_code SetThreadArena(unsigned arena_index);
+
+// Applies to all the existing arenas and is the default for the new ones,
+// -1ms disables the purging
+std::error_code SetDirtyDecay(std::chrono::milliseconds decay);
+
+std::error_code SetMuzzyDecay(std::chrono::milliseconds decay);
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,115 @@
+#include <userver/utils/parallel_for_each.hpp>
+
+#include <atomic>
+#include <deque>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/local_variable.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kElementsCount = 1000;
+
+std::vector<int> MakeElements(std::size_t count) {
+  std::vector<int> elements(count);
+  std::iota(elements.begin(), elements.end(), 0);
+  return elements;
+}
+
+}  // namespace
+
+UTEST_MT(ParallelForEach, ProcessesEachElementOnce, 4) {
+  auto elements = MakeElements(kElementsCount);
+  std::vector<std::atomic<int>> calls(kElementsCount);
+
+  utils::ParallelForEach("for-each", elements, 4,
+                         [&calls](int element) { ++calls[element]; });
+
+  for (const auto& count : calls) ASSERT_EQ(count.load(), 1);
+}
+
+UTEST(ParallelForEach, Empty) {
+  std::vector<int> elements;
+  utils::ParallelForEach("for-each", elements, 4,
+                         [](int) { FAIL() << "No elements to process"; });
+}
+
+UTEST(ParallelForEach, InlineFastPath) {
+  static engine::TaskLocalVariable<bool> is_caller;
+  *is_caller = true;
+  const auto elements = MakeElements(10);
+
+  // No tasks are started, so all the elements are processed in this task
+  utils::ParallelForEach("for-each", elements, 1,
+                         [](int) { EXPECT_TRUE(*is_caller); });
+}
+
+UTEST_MT(ParallelForEach, BoundedParallelism, 4) {
+  constexpr std::size_t kMaxParallelism = 2;
+  const auto elements = MakeElements(100);
+  std::atomic<std::size_t> running{0};
+  std::atomic<std::size_t> max_running{0};
+
+  utils::ParallelForEach("for-each", elements, kMaxParallelism, [&](int) {
+    const auto now_running = ++running;
+    auto old_max = max_running.load();
+    while (old_max < now_running &&
+           !max_running.compare_exchange_weak(old_max, now_running)) {
+    }
+    engine::Yield();
+    --running;
+  });
+
+  EXPECT_LE(max_running.load(), kMaxParallelism);
+}
+
+UTEST_MT(ParallelForEach, FailureStopsSiblings, 4) {
+  const auto elements = MakeElements(kElementsCount);
+  std::atomic<std::size_t> processed{0};
+
+  UEXPECT_THROW(utils::ParallelForEach("for-each", elements, 4,
+                                       [&processed](int element) {
+                                         if (element == 10) {
+                                           throw std::runtime_error("failure");
+                                         }
+                                         ++processed;
+                                         engine::Yield();
+                                       }),
+                std::runtime_error);
+  EXPECT_LT(processed.load(), kElementsCount - 1);
+}
+
+UTEST_MT(ParallelTransform, KeepsOrder, 4) {
+  const std::deque<int> elements{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+  const auto results = utils::ParallelTransform(
+      "transform", elements, 3,
+      [](int element) { return std::to_string(element * element); });
+
+  ASSERT_EQ(results.size(), elements.size());
+  for (std::size_t i = 0; i < elements.size(); ++i) {
+    EXPECT_EQ(results[i], std::to_string(elements[i] * elements[i]));
+  }
+}
+
+UTEST(ParallelForEach, Sample) {
+  /// [Sample utils::ParallelForEach usage]
+  const std::vector<std::string> keys{"a", "b", "c", "d", "e"};
+  std::atomic<std::size_t> total_size{0};
+
+  // At most 2 tasks fetch the keys at any moment
+  utils::ParallelForEach("fetch-keys", keys, 2, [&](const std::string& key) {
+    total_size += key.size();
+  });
+  EXPECT_EQ(total_size.load(), 5);
+  /// [Sample utils::ParallelForEach usage]
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/utils/periodic_task.hpp>
 
 #include <random>
+#include <shared_mutex>
 
 #include <fmt/format.h>
 
@@ -114,18 +115,38 @@ bool PeriodicTask::IsRunning() const { return task_.IsValid(); }
 
 void PeriodicTask::Run() {
   bool skip_step = false;
+  bool spread_first_wait = false;
   {
     auto settings = settings_.Read();
     if (!(settings->flags & Flags::kNow)) {
       skip_step = true;
+      spread_first_wait = static_cast<bool>(settings->flags & Flags::kSpread);
     }
   }
 
+  auto scheduled = std::chrono::steady_clock::now();
+
   while (!engine::current_task::ShouldCancel()) {
     const auto before = std::chrono::steady_clock::now();
     bool no_exception = true;
 
     if (!std::exchange(skip_step, false)) {
+      std::shared_lock<engine::CancellableSemaphore> step_lock;
+      {
+        const auto settings = settings_.Read();
+        auto* const step_semaphore = settings->step_semaphore;
+        if (step_semaphore) {
+          // Fails only if the task is cancelled
+          if (!step_semaphore->try_lock_shared_until(engine::Deadline{})) {
+            break;
+          }
+          step_lock = std::shared_lock(*step_semaphore, std::adopt_lock);
+        }
+      }
+
+      last_schedule_lag_ =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::steady_clock::now() - scheduled);
       no_exception = Step();
     }
 
@@ -135,6 +156,10 @@ void PeriodicTask::Run() {
 
     if (!no_exception) period = exception_period;
 
+    if (std::exchange(spread_first_wait, false) && period.count() > 0) {
+      period = std::chrono::milliseconds{utils::RandRange(period.count())};
+    }
+
     std::chrono::steady_clock::time_point start;
     if (settings->flags & Flags::kStrong) {
       start = before;
@@ -142,8 +167,10 @@ void PeriodicTask::Run() {
       start = std::chrono::steady_clock::now();
     }
 
-    while (changed_event_.WaitForEventUntil(start + MutatePeriod(period))) {
+    scheduled = start + MutatePeriod(period);
+    while (changed_event_.WaitForEventUntil(scheduled)) {
       if (should_force_step_.exchange(false)) {
+        scheduled = std::chrono::steady_clock::now();
         break;
       }
       // The config variable value has been changed, reload
@@ -151,6 +178,7 @@ void PeriodicTask::Run() {
       period = settings->period;
       const auto exception_period = settings->exception_period.value_or(period);
       if (!no_exception) period = exception_period;
+      scheduled = start + MutatePeriod(period);
     }
   }
 }
@@ -240,6 +268,10 @@ PeriodicTask::Settings PeriodicTask::GetCurrentSettings() const {
   return *settings_ptr;
 }
 
+std::chrono::milliseconds PeriodicTask::GetLastScheduleLag() const {
+  return last_schedule_lag_.load();
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
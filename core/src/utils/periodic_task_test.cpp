@@ -1,10 +1,14 @@
 #include <userver/utest/utest.hpp>
 
+#include <atomic>
+#include <shared_mutex>
+
 #include <boost/algorithm/string/split.hpp>
 
 #include <logging/logging_test.hpp>
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/periodic_task.hpp>
@@ -194,6 +198,49 @@ UTEST(PeriodicTask, NotNow) {
   task.Stop();
 }
 
+UTEST(PeriodicTask, StepSemaphore) {
+  engine::CancellableSemaphore semaphore{1};
+  std::atomic<int> running{0};
+  std::atomic<int> max_running{0};
+  std::atomic<int> steps{0};
+
+  utils::PeriodicTask::Settings settings{1ms};
+  settings.step_semaphore = &semaphore;
+  const auto step = [&] {
+    const auto now_running = ++running;
+    if (now_running > max_running) max_running = now_running;
+    engine::SleepFor(5ms);
+    --running;
+    ++steps;
+  };
+
+  utils::PeriodicTask first("first", settings, step);
+  utils::PeriodicTask second("second", settings, step);
+  while (steps < 10) engine::SleepFor(1ms);
+  first.Stop();
+  second.Stop();
+
+  EXPECT_EQ(max_running, 1);
+}
+
+UTEST(PeriodicTask, ScheduleLag) {
+  SimpleTaskData simple;
+  engine::CancellableSemaphore semaphore{1};
+  constexpr auto kLag = 50ms;
+
+  utils::PeriodicTask::Settings settings{1ms, utils::PeriodicTask::Flags::kNow};
+  settings.step_semaphore = &semaphore;
+  std::shared_lock lock(semaphore);
+  utils::PeriodicTask task("task", settings, simple.GetTaskFunction());
+  engine::SleepFor(kLag);
+  lock.unlock();
+
+  EXPECT_TRUE(simple.WaitFor(utest::kMaxTestWaitTime,
+                             [&simple] { return simple.GetCount() > 0; }));
+  EXPECT_GE(task.GetLastScheduleLag(), kLag / 2);
+  task.Stop();
+}
+
 UTEST(PeriodicTask, ExceptionPeriod) {
   SimpleTaskData simple;
   simple.throw_exception = true;
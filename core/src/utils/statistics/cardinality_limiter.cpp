@@ -0,0 +1,154 @@
+#include <utils/statistics/cardinality_limiter.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+namespace {
+
+// Values of different kinds should not share a path, the first one wins then
+MetricValue Sum(const MetricValue& lhs, const MetricValue& rhs) {
+  return lhs.Visit([&rhs](auto left) {
+    return rhs.Visit([left](auto right) -> MetricValue {
+      using Left = decltype(left);
+      using Right = decltype(right);
+      if constexpr (std::is_same_v<Left, Rate> &&
+                    std::is_same_v<Right, Rate>) {
+        auto sum = left;
+        sum += right;
+        return sum;
+      } else if constexpr (std::is_same_v<Left, std::int64_t> &&
+                           std::is_same_v<Right, std::int64_t>) {
+        return left + right;
+      } else if constexpr (std::is_arithmetic_v<Left> &&
+                           std::is_arithmetic_v<Right>) {
+        return static_cast<double>(left) + static_cast<double>(right);
+      } else {
+        return left;
+      }
+    });
+  });
+}
+
+std::vector<double> GetBounds(HistogramView histogram) {
+  std::vector<double> bounds(histogram.GetBucketCount());
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    bounds[i] = histogram.GetUpperBoundAt(i);
+  }
+  return bounds;
+}
+
+}  // namespace
+
+CardinalityLimiter::CardinalityLimiter(BaseFormatBuilder& out,
+                                       const CardinalityLimits& limits,
+                                       const Request& request)
+    : out_(out), limits_(limits), request_(request) {}
+
+void CardinalityLimiter::HandleMetric(std::string_view path,
+                                      LabelsSpan labels,
+                                      const MetricValue& value) {
+  auto* state = utils::impl::FindTransparentOrNullptr(paths_, path);
+  if (!state) {
+    state = &paths_.emplace(std::string{path},
+                            PathState{limits_.GetLimit(path)})
+                 .first->second;
+  }
+
+  if (state->limit == 0 || state->series < state->limit) {
+    ++state->series;
+    out_.HandleMetric(path, labels, value);
+    return;
+  }
+
+  ++state->dropped;
+  auto& series = GetOverflowSeries(path, labels);
+  if (!series.has_value) {
+    series.has_value = true;
+    if (value.IsHistogram()) {
+      series.histogram_bounds = GetBounds(value.AsHistogram());
+      series.histogram.emplace(series.histogram_bounds);
+      series.histogram->Add(value.AsHistogram());
+    } else {
+      series.value = value;
+    }
+  } else if (series.histogram) {
+    // Histograms with other bounds can not be merged
+    if (value.IsHistogram() &&
+        GetBounds(value.AsHistogram()) == series.histogram_bounds) {
+      series.histogram->Add(value.AsHistogram());
+    }
+  } else {
+    series.value = Sum(series.value, value);
+  }
+}
+
+void CardinalityLimiter::Flush() {
+  std::vector<LabelView> labels;
+  for (const auto& series : overflow_series_) {
+    labels.clear();
+    for (const auto& label : series.labels) labels.emplace_back(label);
+    const auto value = series.histogram
+                           ? MetricValue{series.histogram->GetView()}
+                           : series.value;
+    out_.HandleMetric(series.path, LabelsSpan{labels}, value);
+  }
+
+  for (const auto& [path, state] : paths_) {
+    if (state.dropped == 0) continue;
+    LOG_LIMITED_WARNING() << "Metric path '" << path << "' has more than "
+                          << state.limit << " series, " << state.dropped
+                          << " series are aggregated into the overflow ones";
+  }
+}
+
+CardinalityLimiter::OverflowSeries& CardinalityLimiter::GetOverflowSeries(
+    std::string_view path, LabelsSpan labels) {
+  std::string key{path};
+  std::vector<Label> overflow_labels;
+  overflow_labels.reserve(labels.size() + 1);
+  bool is_aggregated = false;
+  for (const auto& label : labels) {
+    const auto value =
+        IsKeptLabel(label.Name()) ? label.Value() : kOverflowLabelValue;
+    is_aggregated = is_aggregated || value == kOverflowLabelValue;
+    key.push_back('\n');
+    key.append(label.Name()).push_back('=');
+    key.append(value);
+    overflow_labels.emplace_back(std::string{label.Name()},
+                                 std::string{value});
+  }
+  // Otherwise the overflow series would have the labels of a written one
+  if (!is_aggregated) {
+    key.append("\noverflow");
+    overflow_labels.emplace_back("overflow",
+                                 std::string{kOverflowLabelValue});
+  }
+
+  const auto [it, inserted] =
+      overflow_indices_.emplace(std::move(key), overflow_series_.size());
+  if (inserted) {
+    auto& series = overflow_series_.emplace_back();
+    series.path = std::string{path};
+    series.labels = std::move(overflow_labels);
+    return series;
+  }
+  return overflow_series_[it->second];
+}
+
+bool CardinalityLimiter::IsKeptLabel(std::string_view name) const {
+  const auto& keep = limits_.keep_labels;
+  const auto& common = request_.add_labels;
+  return std::find(keep.begin(), keep.end(), name) != keep.end() ||
+         std::any_of(common.begin(), common.end(),
+                     [name](const auto& label) { return label.first == name; });
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
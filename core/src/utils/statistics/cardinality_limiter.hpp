@@ -0,0 +1,58 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/statistics/cardinality_limits.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+/// Passes the series to the `out` up to the limits of their paths and sums
+/// the rest into the overflow series, which are written by Flush()
+class CardinalityLimiter final : public BaseFormatBuilder {
+ public:
+  CardinalityLimiter(BaseFormatBuilder& out, const CardinalityLimits& limits,
+                     const Request& request);
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override;
+
+  /// Writes the overflow series and logs the paths that exceeded the limits
+  void Flush();
+
+ private:
+  struct PathState {
+    std::size_t limit{0};
+    std::size_t series{0};
+    std::size_t dropped{0};
+  };
+
+  struct OverflowSeries {
+    std::string path;
+    std::vector<Label> labels;
+    bool has_value{false};
+    MetricValue value;
+    std::vector<double> histogram_bounds;
+    std::optional<HistogramAggregator> histogram;
+  };
+
+  OverflowSeries& GetOverflowSeries(std::string_view path, LabelsSpan labels);
+  bool IsKeptLabel(std::string_view name) const;
+
+  BaseFormatBuilder& out_;
+  const CardinalityLimits& limits_;
+  const Request& request_;
+  utils::impl::TransparentMap<std::string, PathState> paths_;
+  utils::impl::TransparentMap<std::string, std::size_t> overflow_indices_;
+  std::vector<OverflowSeries> overflow_series_;
+};
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
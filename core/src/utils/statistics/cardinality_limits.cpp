@@ -0,0 +1,47 @@
+#include <userver/utils/statistics/cardinality_limits.hpp>
+
+#include <algorithm>
+
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+std::size_t CardinalityLimits::GetLimit(std::string_view path) const {
+  const std::string* longest_prefix = nullptr;
+  std::size_t limit = max_series_per_path;
+  for (const auto& [prefix, prefix_limit] : prefix_limits) {
+    if (longest_prefix && prefix.size() <= longest_prefix->size()) continue;
+    if (!utils::text::StartsWith(path, prefix)) continue;
+    // Whole path segments only, `http` is not a prefix of `httpclient`
+    if (path.size() != prefix.size() && path[prefix.size()] != '.') continue;
+    longest_prefix = &prefix;
+    limit = prefix_limit;
+  }
+  return limit;
+}
+
+bool CardinalityLimits::IsUnlimited() const {
+  return max_series_per_path == 0 &&
+         std::all_of(prefix_limits.begin(), prefix_limits.end(),
+                     [](const auto& item) { return item.second == 0; });
+}
+
+CardinalityLimits Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<CardinalityLimits>) {
+  CardinalityLimits limits;
+  limits.max_series_per_path =
+      value["max-series-per-path"].As<std::size_t>(limits.max_series_per_path);
+  limits.prefix_limits =
+      value["prefixes"].As<std::unordered_map<std::string, std::size_t>>({});
+  limits.keep_labels =
+      value["keep-labels"].As<std::vector<std::string>>({});
+  return limits;
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
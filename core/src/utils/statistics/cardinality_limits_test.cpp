@@ -0,0 +1,96 @@
+#include <userver/utils/statistics/cardinality_limits.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using utils::statistics::Snapshot;
+
+const std::string kOverflow{utils::statistics::kOverflowLabelValue};
+
+void WriteDestinations(utils::statistics::Writer& writer) {
+  for (int i = 0; i < 10; ++i) {
+    const auto url = fmt::format("http://example.com/items/{}", i);
+    const auto code = i % 2 ? "200" : "500";
+    writer["requests"].ValueWithLabels(
+        utils::statistics::Rate{static_cast<std::uint64_t>(i)},
+        {{"http_destination", url}, {"http_code", code}});
+    writer["timings"].ValueWithLabels(
+        i, {{"http_destination", url}, {"http_code", code}});
+  }
+  writer["total"] = 45;
+}
+
+}  // namespace
+
+TEST(CardinalityLimits, GetLimit) {
+  utils::statistics::CardinalityLimits limits;
+  limits.max_series_per_path = 100;
+  limits.prefix_limits = {{"http", 10}, {"http.handler", 5}, {"pg", 0}};
+
+  EXPECT_EQ(limits.GetLimit("cache.size"), 100);
+  EXPECT_EQ(limits.GetLimit("http"), 10);
+  EXPECT_EQ(limits.GetLimit("http.timings"), 10);
+  EXPECT_EQ(limits.GetLimit("http.handler.timings"), 5);
+  EXPECT_EQ(limits.GetLimit("httpclient.timings"), 100);
+  EXPECT_EQ(limits.GetLimit("pg.timings"), 0);
+  EXPECT_FALSE(limits.IsUnlimited());
+  EXPECT_TRUE(utils::statistics::CardinalityLimits{}.IsUnlimited());
+}
+
+UTEST(CardinalityLimits, Overflow) {
+  utils::statistics::Storage storage;
+  const auto entry = storage.RegisterWriter("client", &WriteDestinations);
+
+  utils::statistics::CardinalityLimits limits;
+  limits.max_series_per_path = 4;
+  limits.prefix_limits = {{"client.timings", 0}};
+  limits.keep_labels = {"http_code"};
+  storage.SetCardinalityLimits(limits);
+
+  const Snapshot snapshot{storage, "client"};
+  // The first 4 series are intact
+  EXPECT_EQ(snapshot
+                .SingleMetric("requests",
+                              {{"http_destination",
+                                "http://example.com/items/3"}})
+                .AsRate(),
+            3);
+  EXPECT_FALSE(snapshot.SingleMetricOptional(
+      "requests", {{"http_destination", "http://example.com/items/4"}}));
+  // 4, 6, 8 and 5, 7, 9 are summed by their kept labels
+  EXPECT_EQ(snapshot
+                .SingleMetric("requests",
+                              {{"http_destination", kOverflow},
+                               {"http_code", "500"}})
+                .AsRate(),
+            18);
+  EXPECT_EQ(snapshot
+                .SingleMetric("requests",
+                              {{"http_destination", kOverflow},
+                               {"http_code", "200"}})
+                .AsRate(),
+            21);
+  // Unlimited prefix
+  EXPECT_EQ(snapshot
+                .SingleMetric("timings",
+                              {{"http_destination",
+                                "http://example.com/items/9"}})
+                .AsInt(),
+            9);
+  EXPECT_EQ(snapshot.SingleMetric("total").AsInt(), 45);
+
+  storage.SetCardinalityLimits({});
+  EXPECT_TRUE(Snapshot(storage, "client")
+                  .SingleMetricOptional(
+                      "requests",
+                      {{"http_destination", "http://example.com/items/4"}}));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,135 @@
+#include <userver/utils/statistics/changed_metrics_filter.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <variant>
+
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+using StoredValue = std::variant<std::int64_t, double, Rate, Histogram>;
+
+struct StoredMetric final {
+  StoredValue value;
+  std::uint64_t generation{0};
+};
+
+bool IsSame(const StoredValue& stored, const MetricValue& value) {
+  return value.Visit(utils::Overloaded{
+      [&](HistogramView histogram) {
+        const auto* stored_histogram = std::get_if<Histogram>(&stored);
+        return stored_histogram && stored_histogram->GetView() == histogram;
+      },
+      [&](auto x) {
+        const auto* stored_x = std::get_if<decltype(x)>(&stored);
+        return stored_x && *stored_x == x;
+      },
+  });
+}
+
+StoredValue MakeStoredValue(const MetricValue& value) {
+  return value.Visit(utils::Overloaded{
+      [](HistogramView histogram) -> StoredValue {
+        return Histogram{histogram};
+      },
+      [](auto x) -> StoredValue { return x; },
+  });
+}
+
+}  // namespace
+
+struct ChangedMetricsFilter::Impl final {
+  std::unordered_map<std::string, StoredMetric> metrics;
+  std::uint64_t generation{0};
+  // Reused to avoid allocations on lookups of the known metrics
+  std::string key_buffer;
+};
+
+namespace {
+
+class FilteringBuilder final : public BaseFormatBuilder {
+ public:
+  FilteringBuilder(std::unordered_map<std::string, StoredMetric>& metrics,
+                   std::uint64_t generation, std::string& key_buffer,
+                   BaseFormatBuilder& out)
+      : metrics_(metrics),
+        generation_(generation),
+        key_buffer_(key_buffer),
+        out_(out) {}
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override {
+    key_buffer_.assign(path);
+    for (const auto& label : labels) {
+      key_buffer_.push_back('\0');
+      key_buffer_.append(label.Name());
+      key_buffer_.push_back('\0');
+      key_buffer_.append(label.Value());
+    }
+
+    auto it = metrics_.find(key_buffer_);
+    if (it != metrics_.end() && IsSame(it->second.value, value)) {
+      it->second.generation = generation_;
+      return;
+    }
+
+    out_.HandleMetric(path, labels, value);
+    if (it == metrics_.end()) {
+      it = metrics_.emplace(key_buffer_, StoredMetric{}).first;
+    }
+    it->second.value = MakeStoredValue(value);
+    it->second.generation = generation_;
+  }
+
+ private:
+  std::unordered_map<std::string, StoredMetric>& metrics_;
+  const std::uint64_t generation_;
+  std::string& key_buffer_;
+  BaseFormatBuilder& out_;
+};
+
+}  // namespace
+
+ChangedMetricsFilter::ChangedMetricsFilter() : impl_(std::make_unique<Impl>()) {}
+
+ChangedMetricsFilter::ChangedMetricsFilter(ChangedMetricsFilter&&) noexcept =
+    default;
+
+ChangedMetricsFilter& ChangedMetricsFilter::operator=(
+    ChangedMetricsFilter&&) noexcept = default;
+
+ChangedMetricsFilter::~ChangedMetricsFilter() = default;
+
+void ChangedMetricsFilter::VisitChangedMetrics(const Storage& storage,
+                                               BaseFormatBuilder& out,
+                                               const Request& request) {
+  UASSERT(impl_);
+  const auto generation = ++impl_->generation;
+  FilteringBuilder builder{impl_->metrics, generation, impl_->key_buffer, out};
+  storage.VisitMetrics(builder, request);
+
+  // Forget the metrics that were not reported during this visit
+  for (auto it = impl_->metrics.begin(); it != impl_->metrics.end();) {
+    if (it->second.generation != generation) {
+      it = impl_->metrics.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void ChangedMetricsFilter::Reset() noexcept {
+  UASSERT(impl_);
+  impl_->metrics.clear();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
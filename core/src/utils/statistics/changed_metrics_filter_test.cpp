@@ -0,0 +1,122 @@
+#include <userver/utils/statistics/changed_metrics_filter.hpp>
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class PathsCollector final : public utils::statistics::BaseFormatBuilder {
+ public:
+  void HandleMetric(std::string_view path,
+                    utils::statistics::LabelsSpan labels,
+                    const utils::statistics::MetricValue&) override {
+    std::string result{path};
+    for (const auto& label : labels) {
+      result += fmt::format(";{}={}", label.Name(), label.Value());
+    }
+    paths_.push_back(std::move(result));
+  }
+
+  std::vector<std::string> ExtractPaths() { return std::move(paths_); }
+
+ private:
+  std::vector<std::string> paths_;
+};
+
+using Paths = std::vector<std::string>;
+
+}  // namespace
+
+UTEST(ChangedMetricsFilter, Sample) {
+  /// [Sample]
+  utils::statistics::Storage storage;
+  int value = 1;
+  auto holder =
+      storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) {
+        writer["changing"] = value;
+        writer["constant"] = 42;
+      });
+
+  utils::statistics::ChangedMetricsFilter filter;
+  PathsCollector out;
+
+  // The first visit passes all the metrics
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths(), (Paths{"test.changing", "test.constant"}));
+
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths(), Paths{});
+
+  value = 2;
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths(), Paths{"test.changing"});
+  /// [Sample]
+}
+
+UTEST(ChangedMetricsFilter, LabelsAndTypes) {
+  utils::statistics::Storage storage;
+  const std::vector<double> bounds{1, 10};
+  utils::statistics::Histogram histogram{bounds};
+  std::int64_t integer = 1;
+  double floating = 1.0;
+  auto holder =
+      storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) {
+        writer["int"].ValueWithLabels(integer, {"label", "a"});
+        writer["int"].ValueWithLabels(integer, {"label", "b"});
+        writer["float"] = floating;
+        writer["rate"] = utils::statistics::Rate{42};
+        writer["hist"] = histogram;
+      });
+
+  utils::statistics::ChangedMetricsFilter filter;
+  PathsCollector out;
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths().size(), 5);
+
+  histogram.Account(5);
+  floating = 2.0;
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths(), (Paths{"test.float", "test.hist"}));
+
+  integer = 2;
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths(),
+            (Paths{"test.int;label=a", "test.int;label=b"}));
+}
+
+UTEST(ChangedMetricsFilter, ReappearedAndReset) {
+  utils::statistics::Storage storage;
+  bool write_optional = true;
+  auto holder =
+      storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) {
+        writer["constant"] = 1;
+        if (write_optional) writer["optional"] = 1;
+      });
+
+  utils::statistics::ChangedMetricsFilter filter;
+  PathsCollector out;
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths().size(), 2);
+
+  write_optional = false;
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths(), Paths{});
+
+  write_optional = true;
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths(), Paths{"test.optional"});
+
+  filter.Reset();
+  filter.VisitChangedMetrics(storage, out);
+  EXPECT_EQ(out.ExtractPaths(), (Paths{"test.constant", "test.optional"}));
+}
+
+USERVER_NAMESPACE_END
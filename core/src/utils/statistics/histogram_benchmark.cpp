@@ -1,10 +1,15 @@
 #include <userver/utils/statistics/histogram.hpp>
 
+#include <cmath>
+
 #include <benchmark/benchmark.h>
 #include <boost/range/irange.hpp>
 
 #include <userver/utils/algo.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+#include <userver/utils/statistics/percentile.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -35,4 +40,110 @@ void HistogramAccount(benchmark::State& state) {
 // poorly (fixed).
 BENCHMARK(HistogramAccount)->DenseRange(10, 50, 10);
 
+namespace {
+
+// Latencies in milliseconds from 1/8ms to 2^15ms (~33s)
+template <int Schema>
+using LatencyHistogram = utils::statistics::LogLinearHistogram<Schema, -3, 15>;
+
+using LatencyPercentile = utils::statistics::Percentile<2048, std::uint32_t>;
+
+template <typename AnyHistogram>
+std::vector<double> GetBounds(const AnyHistogram& histogram) {
+  const auto view = histogram.GetView();
+  std::vector<double> bounds;
+  for (std::size_t i = 0; i < view.GetBucketCount(); ++i) {
+    bounds.push_back(view.GetUpperBoundAt(i));
+  }
+  return bounds;
+}
+
+std::vector<double> MakeLatencies() {
+  auto values = std::vector<double>(1024);
+  for (auto& value : values) {
+    value = std::exp2(utils::RandRange(-4.0, 16.0));
+  }
+  return values;
+}
+
+}  // namespace
+
+template <int Schema>
+void LogLinearHistogramAccount(benchmark::State& state) {
+  const auto values = Launder(MakeLatencies());
+  LatencyHistogram<Schema> histogram;
+
+  while (state.KeepRunningBatch(values.size())) {
+    for (const auto value : values) {
+      histogram.Account(value);
+    }
+  }
+}
+BENCHMARK_TEMPLATE(LogLinearHistogramAccount, 1);
+BENCHMARK_TEMPLATE(LogLinearHistogramAccount, 2);
+BENCHMARK_TEMPLATE(LogLinearHistogramAccount, 4);
+
+// Histogram with the same bounds as LogLinearHistogram
+template <int Schema>
+void HistogramAccountLogBounds(benchmark::State& state) {
+  const auto values = Launder(MakeLatencies());
+  utils::statistics::Histogram histogram{
+      GetBounds(LatencyHistogram<Schema>{})};
+
+  while (state.KeepRunningBatch(values.size())) {
+    for (const auto value : values) {
+      histogram.Account(value);
+    }
+  }
+}
+BENCHMARK_TEMPLATE(HistogramAccountLogBounds, 1);
+BENCHMARK_TEMPLATE(HistogramAccountLogBounds, 2);
+BENCHMARK_TEMPLATE(HistogramAccountLogBounds, 4);
+
+// Merging of epochs in RecentPeriod or of per-handler metrics
+template <int Schema>
+void LogLinearHistogramAdd(benchmark::State& state) {
+  LatencyHistogram<Schema> histogram;
+  for (const auto value : MakeLatencies()) histogram.Account(value);
+
+  for ([[maybe_unused]] auto _ : state) {
+    LatencyHistogram<Schema> result;
+    result += histogram;
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK_TEMPLATE(LogLinearHistogramAdd, 1);
+BENCHMARK_TEMPLATE(LogLinearHistogramAdd, 2);
+BENCHMARK_TEMPLATE(LogLinearHistogramAdd, 4);
+
+template <int Schema>
+void HistogramAggregatorAdd(benchmark::State& state) {
+  const auto bounds = GetBounds(LatencyHistogram<Schema>{});
+  utils::statistics::Histogram histogram{bounds};
+  for (const auto value : MakeLatencies()) histogram.Account(value);
+
+  for ([[maybe_unused]] auto _ : state) {
+    utils::statistics::HistogramAggregator result{bounds};
+    result.Add(histogram.GetView());
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK_TEMPLATE(HistogramAggregatorAdd, 1);
+BENCHMARK_TEMPLATE(HistogramAggregatorAdd, 2);
+BENCHMARK_TEMPLATE(HistogramAggregatorAdd, 4);
+
+void PercentileAdd(benchmark::State& state) {
+  LatencyPercentile percentile;
+  for (const auto value : MakeLatencies()) {
+    percentile.Account(static_cast<std::size_t>(value));
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    LatencyPercentile result;
+    result.Add(percentile);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(PercentileAdd);
+
 USERVER_NAMESPACE_END
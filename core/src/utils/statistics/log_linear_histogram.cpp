@@ -0,0 +1,53 @@
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+
+#include <cmath>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl::log_linear {
+
+namespace {
+
+// Border of the bucket `index` within [1, 2]. The last border is exactly 2.
+double GetSubBucketBorder(int schema, std::size_t index) {
+  return std::exp2(static_cast<double>(index) / (std::size_t{1} << schema));
+}
+
+}  // namespace
+
+void FillSubBucketTable(int schema, utils::span<double> borders,
+                        utils::span<std::uint16_t> indices) {
+  const auto slice_count = std::size_t{2} << schema;
+  UASSERT(borders.size() == slice_count);
+  UASSERT(indices.size() == slice_count);
+
+  std::size_t index = 0;
+  for (std::size_t slice = 0; slice < slice_count; ++slice) {
+    const auto slice_start =
+        1.0 + static_cast<double>(slice) / static_cast<double>(slice_count);
+    while (GetSubBucketBorder(schema, index) < slice_start) ++index;
+    borders[slice] = GetSubBucketBorder(schema, index);
+    indices[slice] = static_cast<std::uint16_t>(index);
+  }
+}
+
+void FillUpperBounds(int schema, int min_power_of_two,
+                     utils::span<double> upper_bounds) {
+  const auto buckets_per_power = std::size_t{1} << schema;
+  UASSERT((upper_bounds.size() - 1) % buckets_per_power == 0);
+
+  for (std::size_t i = 0; i < upper_bounds.size(); ++i) {
+    const auto power_of_two =
+        min_power_of_two + static_cast<int>(i / buckets_per_power);
+    // Same rounding as the borders used in Account, so that the values equal
+    // to a bound fall into the bucket with that bound.
+    upper_bounds[i] = std::ldexp(
+        GetSubBucketBorder(schema, i % buckets_per_power), power_of_two);
+  }
+}
+
+}  // namespace utils::statistics::impl::log_linear
+
+USERVER_NAMESPACE_END
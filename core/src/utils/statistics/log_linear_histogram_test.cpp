@@ -0,0 +1,173 @@
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Buckets: 1, 1.41, 2, 2.83, 4, 5.66, 8
+using SmallHistogram = utils::statistics::LogLinearHistogram<1, 0, 3>;
+
+std::vector<double> GetBounds(utils::statistics::HistogramView view) {
+  std::vector<double> bounds;
+  for (std::size_t i = 0; i < view.GetBucketCount(); ++i) {
+    bounds.push_back(view.GetUpperBoundAt(i));
+  }
+  return bounds;
+}
+
+void AccountSome(SmallHistogram& histogram) {
+  histogram.Account(0.5);
+  histogram.Account(1.2);
+  histogram.Account(2);
+  histogram.Account(2.1, 3);
+  histogram.Account(8);
+  histogram.Account(9);
+}
+
+}  // namespace
+
+UTEST(StatisticsLogLinearHistogram, Account) {
+  SmallHistogram histogram;
+  AccountSome(histogram);
+
+  const auto view = histogram.GetView();
+  EXPECT_EQ(view.GetBucketCount(), SmallHistogram::kBucketCount);
+  EXPECT_EQ(fmt::to_string(view),
+            "[1]=1,[1.4142135623730951]=1,[2]=1,[2.8284271247461903]=3,[4]=0,"
+            "[5.656854249492381]=0,[8]=1,[inf]=1");
+  EXPECT_EQ(view.GetTotalCount(), 8);
+}
+
+UTEST(StatisticsLogLinearHistogram, SpecialValues) {
+  SmallHistogram histogram;
+  histogram.Account(0);
+  histogram.Account(-1);
+  histogram.Account(std::numeric_limits<double>::quiet_NaN());
+  histogram.Account(std::numeric_limits<double>::denorm_min());
+  histogram.Account(std::numeric_limits<double>::infinity(), 2);
+
+  const auto view = histogram.GetView();
+  EXPECT_EQ(view.GetValueAt(0), 4);
+  EXPECT_EQ(view.GetValueAtInf(), 2);
+  EXPECT_EQ(view.GetTotalCount(), 6);
+}
+
+UTEST(StatisticsLogLinearHistogram, NativeHistogramBounds) {
+  using Histogram = utils::statistics::LogLinearHistogram<3, -4, 10>;
+  const Histogram histogram;
+  const auto view = histogram.GetView();
+
+  ASSERT_EQ(view.GetBucketCount(), 14 * 8 + 1);
+  for (std::size_t i = 0; i < view.GetBucketCount(); ++i) {
+    const auto native_index = static_cast<int>(i) - 4 * 8;
+    EXPECT_DOUBLE_EQ(view.GetUpperBoundAt(i), std::exp2(native_index / 8.0));
+  }
+}
+
+UTEST(StatisticsLogLinearHistogram, MatchesHistogram) {
+  using Histogram = utils::statistics::LogLinearHistogram<4, -3, 12>;
+  Histogram histogram;
+  utils::statistics::Histogram expected{GetBounds(histogram.GetView())};
+
+  for (int i = 0; i < 100000; ++i) {
+    const auto value = std::exp2(utils::RandRange(-4.0, 13.0));
+    histogram.Account(value);
+    expected.Account(value);
+  }
+  // Values on the bucket borders fall into the lower bucket
+  for (const auto bound : GetBounds(histogram.GetView())) {
+    histogram.Account(bound);
+    expected.Account(bound);
+  }
+
+  EXPECT_EQ(histogram.GetView(), expected.GetView());
+}
+
+UTEST(StatisticsLogLinearHistogram, AddAndReset) {
+  SmallHistogram histogram1;
+  AccountSome(histogram1);
+  SmallHistogram histogram2;
+  AccountSome(histogram2);
+  AccountSome(histogram2);
+
+  histogram1 += histogram2;
+  EXPECT_EQ(histogram1.GetView().GetTotalCount(), 24);
+  EXPECT_EQ(histogram1.GetView().GetValueAt(3), 9);
+  EXPECT_EQ(histogram1.GetView().GetValueAtInf(), 3);
+
+  ResetMetric(histogram1);
+  const SmallHistogram zero_histogram;
+  EXPECT_EQ(histogram1.GetView(), zero_histogram.GetView());
+}
+
+UTEST(StatisticsLogLinearHistogram, Downscale) {
+  utils::statistics::LogLinearHistogram<3, 0, 3> histogram;
+  histogram.Account(1.1);
+  histogram.Account(1.9);
+  histogram.Account(2.5);
+  histogram.Account(100);
+
+  const SmallHistogram coarse;
+  utils::statistics::HistogramAggregator aggregator{
+      GetBounds(coarse.GetView())};
+  aggregator.Add(histogram.GetView());
+  EXPECT_EQ(fmt::to_string(aggregator.GetView()),
+            "[1]=0,[1.4142135623730951]=1,[2]=1,[2.8284271247461903]=1,[4]=0,"
+            "[5.656854249492381]=0,[8]=0,[inf]=1");
+}
+
+UTEST(StatisticsLogLinearHistogram, RecentPeriod) {
+  /// [RecentPeriod]
+  // Latencies in milliseconds from 1/8ms to 2^15ms (~33s), 4 buckets per
+  // power of two
+  using Timings = utils::statistics::LogLinearHistogram<2, -3, 15>;
+  utils::statistics::RecentPeriod<Timings, Timings> timings;
+
+  timings.GetCurrentCounter().Account(42.0);
+
+  utils::statistics::Storage storage;
+  auto holder =
+      storage.RegisterWriter("timings", [&](utils::statistics::Writer& writer) {
+        writer = timings.GetStatsForPeriod(std::chrono::seconds{60}, true);
+      });
+  /// [RecentPeriod]
+
+  const utils::statistics::Snapshot snapshot{storage};
+  const auto view = snapshot.SingleMetric("timings").AsHistogram();
+  EXPECT_EQ(view.GetBucketCount(), Timings::kBucketCount);
+  EXPECT_EQ(view.GetTotalCount(), 1);
+}
+
+UTEST(StatisticsLogLinearHistogram, Prometheus) {
+  utils::statistics::LogLinearHistogram<0, 0, 2> histogram;
+  histogram.Account(3);
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+  constexpr std::string_view expected = R"(# TYPE test histogram
+test_bucket{le="1"} 0
+test_bucket{le="2"} 0
+test_bucket{le="4"} 1
+test_bucket{le="+Inf"} 1
+test_count{} 1
+)";
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage), expected);
+}
+
+USERVER_NAMESPACE_END
@@ -1,16 +1,16 @@
 #include <userver/utils/statistics/storage.hpp>
 
 #include <algorithm>
+#include <optional>
 #include <utility>
 
-#include <boost/container/small_vector.hpp>
-
 #include <userver/formats/common/utils.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/text_light.hpp>
 #include <utils/statistics/value_builder_helpers.hpp>
 
+#include <utils/statistics/cardinality_limiter.hpp>
 #include <utils/statistics/entry_impl.hpp>
 #include <utils/statistics/visitation.hpp>
 #include <utils/statistics/writer_state.hpp>
@@ -118,31 +118,32 @@ formats::json::Value Storage::GetAsJson() const {
 
 void Storage::VisitMetrics(BaseFormatBuilder& out,
                            const Request& request) const {
+  std::shared_ptr<const CardinalityLimits> limits;
   {
-    impl::WriterState state{out, request, {}, {}};
+    std::shared_lock lock(mutex_);
+    limits = cardinality_limits_;
+  }
+  std::optional<impl::CardinalityLimiter> limiter;
+  if (limits) limiter.emplace(out, *limits, request);
+  BaseFormatBuilder& builder = limiter ? *limiter : out;
+
+  {
+    impl::WriterState state{builder, request, {}, {}};
     for (const auto& [name, value] : request.add_labels) {
       state.add_labels.emplace_back(name, value);
     }
 
-    boost::container::small_vector<LabelView, 16> labels_vector;
-
     std::shared_lock lock(mutex_);
     for (const auto& entry : metrics_sources_) {
       if (!entry.writer) {
         continue;
       }
 
-      labels_vector.clear();
-      labels_vector.reserve(entry.writer_labels.size());
-      for (const auto& l : entry.writer_labels) {
-        labels_vector.emplace_back(l);
-      }
-
+      const LabelsSpan labels{entry.writer_label_views};
       try {
-        auto writer =
-            (entry.prefix_path.empty()
-                 ? Writer{state, LabelsSpan{labels_vector}}
-                 : Writer{state, LabelsSpan{labels_vector}}[entry.prefix_path]);
+        auto writer = (entry.prefix_path.empty()
+                           ? Writer{state, labels}
+                           : Writer{state, labels}[entry.prefix_path]);
         if (writer) {
           LOG_DEBUG() << "Getting statistics for prefix=" << entry.prefix_path;
           entry.writer(writer);
@@ -157,7 +158,17 @@ void Storage::VisitMetrics(BaseFormatBuilder& out,
     }
   }
 
-  statistics::VisitMetrics(out, GetAsJson(), request);
+  statistics::VisitMetrics(builder, GetAsJson(), request);
+  if (limiter) limiter->Flush();
+}
+
+void Storage::SetCardinalityLimits(CardinalityLimits limits) {
+  std::shared_ptr<const CardinalityLimits> new_limits;
+  if (!limits.IsUnlimited()) {
+    new_limits = std::make_shared<const CardinalityLimits>(std::move(limits));
+  }
+  std::lock_guard lock(mutex_);
+  cardinality_limits_ = std::move(new_limits);
 }
 
 void Storage::StopRegisteringExtenders() { may_register_extenders_ = false; }
@@ -165,13 +176,13 @@ void Storage::StopRegisteringExtenders() { may_register_extenders_ = false; }
 Entry Storage::RegisterWriter(std::string prefix, WriterFunc func,
                               std::vector<Label> add_labels) {
   return DoRegisterExtender(impl::MetricsSource{
-      std::move(prefix), {}, {}, std::move(func), std::move(add_labels)});
+      std::move(prefix), {}, {}, std::move(func), std::move(add_labels), {}});
 }
 
 Entry Storage::RegisterExtender(std::string prefix, ExtenderFunc func) {
   auto prefix_split = formats::common::SplitPathString(prefix);
   return DoRegisterExtender(impl::MetricsSource{
-      std::move(prefix), std::move(prefix_split), std::move(func), {}, {}});
+      std::move(prefix), std::move(prefix_split), std::move(func), {}, {}, {}});
 }
 
 Entry Storage::DoRegisterExtender(impl::MetricsSource&& source) {
@@ -182,6 +193,11 @@ Entry Storage::DoRegisterExtender(impl::MetricsSource&& source) {
   std::lock_guard lock(mutex_);
   const auto res =
       metrics_sources_.insert(metrics_sources_.end(), std::move(source));
+  // The list node never moves, so the views stay valid until unregistering
+  res->writer_label_views.reserve(res->writer_labels.size());
+  for (const auto& label : res->writer_labels) {
+    res->writer_label_views.emplace_back(label);
+  }
   return Entry(Entry::Impl{this, res});
 }
 
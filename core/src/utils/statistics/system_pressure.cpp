@@ -0,0 +1,201 @@
+#include <utils/statistics/system_pressure.hpp>
+
+#include <algorithm>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+namespace {
+
+// Calls `func(line)` for each non-empty line of the `data`
+template <typename Func>
+void ForEachLine(std::string_view data, Func func) {
+  while (!data.empty()) {
+    const auto line_end = std::min(data.find('\n'), data.size());
+    const auto line = data.substr(0, line_end);
+    data.remove_prefix(std::min(line_end + 1, data.size()));
+    if (!line.empty()) func(line);
+  }
+}
+
+// Parses `avg10=0.00 avg60=0.00 avg300=0.00 total=0`
+PressureStall ParsePressureStall(std::string_view fields) {
+  PressureStall result;
+  while (!fields.empty()) {
+    const auto field_end = std::min(fields.find(' '), fields.size());
+    const auto field = fields.substr(0, field_end);
+    fields.remove_prefix(std::min(field_end + 1, fields.size()));
+
+    const auto eq_pos = field.find('=');
+    if (eq_pos == std::string_view::npos) continue;
+    const auto key = field.substr(0, eq_pos);
+    const auto value = field.substr(eq_pos + 1);
+
+    if (key == "avg10") {
+      result.avg10 = utils::FromString<double>(value);
+    } else if (key == "avg60") {
+      result.avg60 = utils::FromString<double>(value);
+    } else if (key == "avg300") {
+      result.avg300 = utils::FromString<double>(value);
+    } else if (key == "total") {
+      result.total_us = utils::FromString<std::uint64_t>(value);
+    }
+  }
+  return result;
+}
+
+#ifdef __linux__
+constexpr std::string_view kCgroupV2Root = "/sys/fs/cgroup";
+
+std::optional<std::string> TryReadFile(const std::string& path) {
+  if (!fs::blocking::FileExists(path)) return std::nullopt;
+  try {
+    return fs::blocking::ReadFileContents(path);
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_DEBUG() << "Could not read " << path << ": " << ex;
+    return std::nullopt;
+  }
+}
+
+template <typename Parser>
+auto TryParseFile(const std::string& path, Parser parser)
+    -> decltype(parser(std::string_view{})) {
+  const auto data = TryReadFile(path);
+  if (!data) return std::nullopt;
+  try {
+    return parser(*data);
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_DEBUG() << "Could not parse " << path << ": " << ex;
+    return std::nullopt;
+  }
+}
+
+std::optional<std::string> GetSelfCgroupDirectory() {
+  const auto data = TryReadFile("/proc/self/cgroup");
+  if (!data) return std::nullopt;
+  const auto path = ParseCgroupV2Path(*data);
+  if (!path) return std::nullopt;
+  return fmt::format("{}{}", kCgroupV2Root, *path == "/" ? "" : *path);
+}
+
+// The root cgroup has no pressure files, the system wide ones are used then
+std::optional<Pressure> GetPressure(
+    const std::optional<std::string>& cgroup_directory,
+    std::string_view resource) {
+  if (cgroup_directory) {
+    auto result = TryParseFile(
+        fmt::format("{}/{}.pressure", *cgroup_directory, resource),
+        ParsePressure);
+    if (result) return result;
+  }
+  return TryParseFile(fmt::format("/proc/pressure/{}", resource),
+                      ParsePressure);
+}
+#endif
+
+void DumpPressure(Writer writer, const Pressure& pressure) {
+  const auto dump_stall = [](Writer writer, const PressureStall& stall) {
+    writer["avg10"] = stall.avg10;
+    writer["avg60"] = stall.avg60;
+    writer["avg300"] = stall.avg300;
+    writer["total_us"] = stall.total_us;
+  };
+  dump_stall(writer["some"], pressure.some);
+  if (pressure.full) dump_stall(writer["full"], *pressure.full);
+}
+
+}  // namespace
+
+std::optional<Pressure> ParsePressure(std::string_view data) {
+  static constexpr std::string_view kSomePrefix = "some ";
+  static constexpr std::string_view kFullPrefix = "full ";
+
+  std::optional<Pressure> result;
+  std::optional<PressureStall> full;
+  ForEachLine(data, [&](std::string_view line) {
+    if (line.substr(0, kSomePrefix.size()) == kSomePrefix) {
+      result.emplace();
+      result->some = ParsePressureStall(line.substr(kSomePrefix.size()));
+    } else if (line.substr(0, kFullPrefix.size()) == kFullPrefix) {
+      full = ParsePressureStall(line.substr(kFullPrefix.size()));
+    }
+  });
+  if (result) result->full = full;
+  return result;
+}
+
+std::optional<CgroupCpuThrottling> ParseCgroupCpuThrottling(
+    std::string_view data) {
+  CgroupCpuThrottling result;
+  bool has_periods = false;
+  ForEachLine(data, [&](std::string_view line) {
+    const auto space_pos = line.find(' ');
+    if (space_pos == std::string_view::npos) return;
+    const auto key = line.substr(0, space_pos);
+    const auto value = line.substr(space_pos + 1);
+
+    if (key == "nr_periods") {
+      result.nr_periods = utils::FromString<std::uint64_t>(value);
+      has_periods = true;
+    } else if (key == "nr_throttled") {
+      result.nr_throttled = utils::FromString<std::uint64_t>(value);
+    } else if (key == "throttled_usec") {
+      result.throttled_us = utils::FromString<std::uint64_t>(value);
+    }
+  });
+  if (!has_periods) return std::nullopt;
+  return result;
+}
+
+std::optional<std::string_view> ParseCgroupV2Path(std::string_view data) {
+  static constexpr std::string_view kV2Prefix = "0::";
+
+  std::optional<std::string_view> result;
+  ForEachLine(data, [&](std::string_view line) {
+    if (line.substr(0, kV2Prefix.size()) == kV2Prefix) {
+      result = line.substr(kV2Prefix.size());
+    }
+  });
+  return result;
+}
+
+void DumpMetric(Writer& writer, const SystemPressure& pressure) {
+  if (pressure.cpu) DumpPressure(writer["cpu"], *pressure.cpu);
+  if (pressure.memory) DumpPressure(writer["memory"], *pressure.memory);
+  if (pressure.cpu_throttling) {
+    auto throttling = writer["cpu_throttling"];
+    throttling["nr_periods"] = pressure.cpu_throttling->nr_periods;
+    throttling["nr_throttled"] = pressure.cpu_throttling->nr_throttled;
+    throttling["throttled_us"] = pressure.cpu_throttling->throttled_us;
+  }
+}
+
+static_assert(kHasWriterSupport<SystemPressure>);
+
+SystemPressure GetSelfSystemPressure() {
+  SystemPressure result;
+#ifdef __linux__
+  const auto cgroup_directory = GetSelfCgroupDirectory();
+  result.cpu = GetPressure(cgroup_directory, "cpu");
+  result.memory = GetPressure(cgroup_directory, "memory");
+  if (cgroup_directory) {
+    result.cpu_throttling =
+        TryParseFile(fmt::format("{}/cpu.stat", *cgroup_directory),
+                     ParseCgroupCpuThrottling);
+  }
+#endif
+  return result;
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+/// A line of a Linux PSI file, see
+/// https://docs.kernel.org/accounting/psi.html
+struct PressureStall {
+  double avg10{0};
+  double avg60{0};
+  double avg300{0};
+  std::uint64_t total_us{0};
+};
+
+/// Contents of `/proc/pressure/<resource>` or `<cgroup>/<resource>.pressure`
+struct Pressure {
+  PressureStall some;
+  /// Missing for the system wide CPU pressure on the old kernels
+  std::optional<PressureStall> full;
+};
+
+/// Throttling counters of the cgroup v2 `cpu.stat`
+struct CgroupCpuThrottling {
+  std::uint64_t nr_periods{0};
+  std::uint64_t nr_throttled{0};
+  std::uint64_t throttled_us{0};
+};
+
+/// Pressure of the cgroup of the process, or of the whole system if
+/// the cgroup v2 files are not available. All fields are empty on the systems
+/// without PSI support.
+struct SystemPressure {
+  std::optional<Pressure> cpu;
+  std::optional<Pressure> memory;
+  std::optional<CgroupCpuThrottling> cpu_throttling;
+};
+
+/// Returns std::nullopt if the `data` has no `some` line
+std::optional<Pressure> ParsePressure(std::string_view data);
+
+/// Returns std::nullopt if the `data` has no throttling counters, e.g. the
+/// cgroup has no CPU quota controller enabled
+std::optional<CgroupCpuThrottling> ParseCgroupCpuThrottling(
+    std::string_view data);
+
+/// Returns the cgroup v2 path of the `0::<path>` line of `/proc/self/cgroup`
+std::optional<std::string_view> ParseCgroupV2Path(std::string_view data);
+
+void DumpMetric(Writer& writer, const SystemPressure& pressure);
+
+/// Reads the files, does blocking IO
+SystemPressure GetSelfSystemPressure();
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <utils/statistics/system_pressure.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using utils::statistics::impl::ParseCgroupCpuThrottling;
+using utils::statistics::impl::ParseCgroupV2Path;
+using utils::statistics::impl::ParsePressure;
+
+}  // namespace
+
+TEST(SystemPressure, Pressure) {
+  const auto pressure = ParsePressure(
+      "some avg10=1.25 avg60=0.50 avg300=0.00 total=123456\n"
+      "full avg10=0.75 avg60=0.25 avg300=0.00 total=1234\n");
+  ASSERT_TRUE(pressure);
+  EXPECT_DOUBLE_EQ(pressure->some.avg10, 1.25);
+  EXPECT_DOUBLE_EQ(pressure->some.avg60, 0.5);
+  EXPECT_DOUBLE_EQ(pressure->some.avg300, 0);
+  EXPECT_EQ(pressure->some.total_us, 123456);
+  ASSERT_TRUE(pressure->full);
+  EXPECT_DOUBLE_EQ(pressure->full->avg10, 0.75);
+  EXPECT_EQ(pressure->full->total_us, 1234);
+}
+
+TEST(SystemPressure, PressureWithoutFull) {
+  const auto pressure =
+      ParsePressure("some avg10=0.00 avg60=0.00 avg300=0.00 total=42\n");
+  ASSERT_TRUE(pressure);
+  EXPECT_EQ(pressure->some.total_us, 42);
+  EXPECT_FALSE(pressure->full);
+
+  EXPECT_FALSE(ParsePressure(""));
+}
+
+TEST(SystemPressure, CgroupCpuThrottling) {
+  const auto throttling = ParseCgroupCpuThrottling(
+      "usage_usec 8000000\n"
+      "user_usec 6000000\n"
+      "system_usec 2000000\n"
+      "nr_periods 100\n"
+      "nr_throttled 25\n"
+      "throttled_usec 500000\n"
+      "nr_bursts 0\n"
+      "burst_usec 0\n");
+  ASSERT_TRUE(throttling);
+  EXPECT_EQ(throttling->nr_periods, 100);
+  EXPECT_EQ(throttling->nr_throttled, 25);
+  EXPECT_EQ(throttling->throttled_us, 500000);
+
+  // No CPU quota controller
+  EXPECT_FALSE(ParseCgroupCpuThrottling("usage_usec 8000000\n"));
+}
+
+TEST(SystemPressure, CgroupV2Path) {
+  EXPECT_EQ(ParseCgroupV2Path("0::/system.slice/service.scope\n"),
+            "/system.slice/service.scope");
+  EXPECT_EQ(ParseCgroupV2Path("12:cpu,cpuacct:/docker/abc\n0::/\n"), "/");
+  EXPECT_FALSE(ParseCgroupV2Path("12:cpu,cpuacct:/docker/abc\n"));
+}
+
+USERVER_NAMESPACE_END
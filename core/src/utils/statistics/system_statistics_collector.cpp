@@ -4,6 +4,8 @@
 #include <userver/components/statistics_storage.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
+#include <utils/jemalloc.hpp>
+#include <utils/statistics/system_pressure.hpp>
 #include <utils/statistics/system_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,6 +16,8 @@ SystemStatisticsCollector::SystemStatisticsCollector(
     const ComponentConfig& config, const ComponentContext& context)
     : ComponentBase(config, context),
       with_nginx_(config["with-nginx"].As<bool>(false)),
+      with_pressure_(config["with-pressure"].As<bool>(false)),
+      with_jemalloc_(config["with-jemalloc"].As<bool>(false)),
       fs_task_processor_(context.GetTaskProcessor(
           config["fs-task-processor"].As<std::string>())) {
   statistics_holder_ =
@@ -37,6 +41,22 @@ void SystemStatisticsCollector::ExtendStatistics(
           utils::statistics::impl::GetSystemStatisticsByExeName("nginx"),
           {"application", "nginx"});
     }
+    if (with_pressure_) {
+      writer["system_pressure"] =
+          utils::statistics::impl::GetSelfSystemPressure();
+    }
+    if (with_jemalloc_) {
+      utils::jemalloc::MemoryStats stats;
+      if (!utils::jemalloc::GetMemoryStats(stats)) {
+        auto jemalloc = writer["jemalloc"];
+        jemalloc["allocated_bytes"] = stats.allocated;
+        jemalloc["active_bytes"] = stats.active;
+        jemalloc["metadata_bytes"] = stats.metadata;
+        jemalloc["resident_bytes"] = stats.resident;
+        jemalloc["mapped_bytes"] = stats.mapped;
+        jemalloc["retained_bytes"] = stats.retained;
+      }
+    }
   }).Get();
 }
 
@@ -53,6 +73,14 @@ properties:
         type: boolean
         description: Whether to collect and report nginx processes statistics
         defaultDescription: false
+    with-pressure:
+        type: boolean
+        description: Whether to report the Linux PSI and the cgroup v2 CPU throttling of the process
+        defaultDescription: false
+    with-jemalloc:
+        type: boolean
+        description: Whether to report the jemalloc memory totals
+        defaultDescription: false
 )");
 }
 
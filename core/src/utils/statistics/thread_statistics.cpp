@@ -5,9 +5,17 @@
 
 #include <pthread.h>
 #include <sys/resource.h>  // for RUSAGE_THREAD
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <fmt/format.h>
 
+#include <userver/fs/blocking/read.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -37,6 +45,80 @@ ThreadCpuUsage GetCurrentThreadCpuUsage() {
 #endif
 }
 
+ThreadSchedulerStats& ThreadSchedulerStats::operator+=(
+    const ThreadSchedulerStats& other) noexcept {
+  run_time += other.run_time;
+  run_queue_wait_time += other.run_queue_wait_time;
+  timeslices += other.timeslices;
+  voluntary_context_switches += other.voluntary_context_switches;
+  involuntary_context_switches += other.involuntary_context_switches;
+  return *this;
+}
+
+std::int64_t GetCurrentThreadOsId() noexcept {
+#ifdef __linux__
+  return static_cast<std::int64_t>(::syscall(SYS_gettid));
+#else
+  return -1;
+#endif
+}
+
+ThreadSchedulerStats GetThreadSchedulerStats(std::int64_t thread_os_id) {
+  ThreadSchedulerStats stats;
+#ifdef __linux__
+  if (thread_os_id < 0) return stats;
+
+  const auto task_path = fmt::format("/proc/self/task/{}", thread_os_id);
+  try {
+    ParseSchedstat(fs::blocking::ReadFileContents(task_path + "/schedstat"),
+                   stats);
+    ParseThreadStatus(fs::blocking::ReadFileContents(task_path + "/status"),
+                      stats);
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_DEBUG() << "Could not get scheduler stats from " << task_path
+                        << ": " << ex;
+  }
+#endif
+  return stats;
+}
+
+void ParseSchedstat(std::string_view data, ThreadSchedulerStats& stats) {
+  // `<run time ns> <run queue wait time ns> <timeslices>`
+  const auto next_field = [&data] {
+    const auto field_end = std::min(data.find_first_of(" \n"), data.size());
+    const auto field = data.substr(0, field_end);
+    data.remove_prefix(std::min(field_end + 1, data.size()));
+    return utils::FromString<std::uint64_t>(field);
+  };
+  stats.run_time = std::chrono::nanoseconds{next_field()};
+  stats.run_queue_wait_time = std::chrono::nanoseconds{next_field()};
+  stats.timeslices = next_field();
+}
+
+void ParseThreadStatus(std::string_view data, ThreadSchedulerStats& stats) {
+  static constexpr std::string_view kVoluntaryHeader =
+      "voluntary_ctxt_switches:";
+  static constexpr std::string_view kNonvoluntaryHeader =
+      "nonvoluntary_ctxt_switches:";
+
+  while (!data.empty()) {
+    const auto line_end = std::min(data.find('\n'), data.size());
+    const auto line = data.substr(0, line_end);
+    data.remove_prefix(std::min(line_end + 1, data.size()));
+
+    const auto parse_if_matches = [line](std::uint64_t& field,
+                                         std::string_view header) {
+      if (line.substr(0, header.size()) != header) return;
+      auto value = line.substr(header.size());
+      value.remove_prefix(std::min(value.find_first_not_of(" \t"),
+                                   value.size()));
+      field = utils::FromString<std::uint64_t>(value);
+    };
+    parse_if_matches(stats.voluntary_context_switches, kVoluntaryHeader);
+    parse_if_matches(stats.involuntary_context_switches, kNonvoluntaryHeader);
+  }
+}
+
 }  // namespace impl
 
 ThreadCpuStatsStorage::ThreadCpuStatsStorage(
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <string_view>
 #include <thread>
 #include <vector>
 
@@ -25,6 +26,34 @@ struct ThreadCpuUsage final {
 
 ThreadCpuUsage GetCurrentThreadCpuUsage();
 
+/// OS scheduler stats of a thread, consult proc(5) for `schedstat` and
+/// `status` of `/proc/<pid>/task/<tid>`.
+struct ThreadSchedulerStats final {
+  /// Time spent on a CPU.
+  std::chrono::nanoseconds run_time{};
+  /// Time spent runnable in the run queue, waiting for a CPU.
+  std::chrono::nanoseconds run_queue_wait_time{};
+  /// Number of times the thread was given a CPU.
+  std::uint64_t timeslices{0};
+  std::uint64_t voluntary_context_switches{0};
+  /// Preemptions by the OS, e.g. by the other threads on the same CPU.
+  std::uint64_t involuntary_context_switches{0};
+
+  ThreadSchedulerStats& operator+=(const ThreadSchedulerStats& other) noexcept;
+};
+
+/// Returns the OS id of the current thread, -1 if the OS has no thread ids
+/// in the procfs.
+std::int64_t GetCurrentThreadOsId() noexcept;
+
+/// Returns zero stats for the unknown threads and on the systems without
+/// procfs. Reads procfs, which does not block on IO.
+ThreadSchedulerStats GetThreadSchedulerStats(std::int64_t thread_os_id);
+
+void ParseSchedstat(std::string_view data, ThreadSchedulerStats& stats);
+
+void ParseThreadStatus(std::string_view data, ThreadSchedulerStats& stats);
+
 }  // namespace impl
 
 using Percent = std::uint8_t;
@@ -0,0 +1,39 @@
+#include <utils/statistics/thread_statistics.hpp>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(ThreadSchedulerStats, ParseSchedstat) {
+  utils::statistics::impl::ThreadSchedulerStats stats;
+  utils::statistics::impl::ParseSchedstat("123456789 98765 42\n", stats);
+  EXPECT_EQ(stats.run_time, std::chrono::nanoseconds{123456789});
+  EXPECT_EQ(stats.run_queue_wait_time, std::chrono::nanoseconds{98765});
+  EXPECT_EQ(stats.timeslices, 42);
+}
+
+TEST(ThreadSchedulerStats, ParseThreadStatus) {
+  utils::statistics::impl::ThreadSchedulerStats stats;
+  utils::statistics::impl::ParseThreadStatus(
+      "Name:\tmain-worker_0\n"
+      "State:\tS (sleeping)\n"
+      "voluntary_ctxt_switches:\t1000\n"
+      "nonvoluntary_ctxt_switches:\t25\n",
+      stats);
+  EXPECT_EQ(stats.voluntary_context_switches, 1000);
+  EXPECT_EQ(stats.involuntary_context_switches, 25);
+}
+
+TEST(ThreadSchedulerStats, CurrentThread) {
+  const auto stats = utils::statistics::impl::GetThreadSchedulerStats(
+      utils::statistics::impl::GetCurrentThreadOsId());
+  // The kernel may be built without the scheduler stats
+  if (fs::blocking::FileExists("/proc/self/schedstat")) {
+    EXPECT_GT(stats.timeslices, 0);
+  } else {
+    EXPECT_EQ(stats.timeslices, 0);
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,15 @@
 
 #include <unistd.h>
 
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/text_light.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::sys_info {
@@ -12,6 +21,61 @@ std::size_t GetPageSize() {
   return kPageSize;
 }
 
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list) {
+  std::vector<std::size_t> result;
+
+  const auto parse_cpu = [cpu_list](std::string_view cpu) {
+    try {
+      return utils::FromString<std::size_t>(cpu);
+    } catch (const std::exception& ex) {
+      throw std::runtime_error(
+          fmt::format("Malformed CPU list '{}': {}", cpu_list, ex.what()));
+    }
+  };
+
+  const auto trimmed = utils::text::Trim(std::string{cpu_list});
+  std::string_view rest = trimmed;
+  while (!rest.empty()) {
+    const auto comma = rest.find(',');
+    const auto range = rest.substr(0, comma);
+    rest = (comma == std::string_view::npos) ? std::string_view{}
+                                             : rest.substr(comma + 1);
+
+    const auto dash = range.find('-');
+    if (dash == std::string_view::npos) {
+      result.push_back(parse_cpu(range));
+      continue;
+    }
+
+    const auto first = parse_cpu(range.substr(0, dash));
+    const auto last = parse_cpu(range.substr(dash + 1));
+    if (first > last) {
+      throw std::runtime_error(
+          fmt::format("Malformed CPU list '{}': bad range", cpu_list));
+    }
+    for (auto cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+  }
+
+  return result;
+}
+
+std::vector<std::size_t> GetNumaNodeCpus(std::size_t numa_node) {
+  const auto path =
+      fmt::format("/sys/devices/system/node/node{}/cpulist", numa_node);
+  if (!fs::blocking::FileExists(path)) {
+    throw std::runtime_error(
+        fmt::format("NUMA node {} does not exist: '{}' is missing", numa_node,
+                    path));
+  }
+
+  auto cpus = ParseCpuList(fs::blocking::ReadFileContents(path));
+  if (cpus.empty()) {
+    throw std::runtime_error(
+        fmt::format("NUMA node {} has no CPUs", numa_node));
+  }
+  return cpus;
+}
+
 }  // namespace utils::sys_info
 
 USERVER_NAMESPACE_END
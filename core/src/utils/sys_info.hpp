@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstddef>
+#include <string_view>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -8,6 +10,14 @@ namespace utils::sys_info {
 
 std::size_t GetPageSize();
 
-}
+/// Parses the Linux CPU list format, for example "0-3,8,10-11".
+/// @throws std::runtime_error on malformed input
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list);
+
+/// Returns the CPUs of the NUMA node, as reported by sysfs.
+/// @throws std::runtime_error if the node does not exist
+std::vector<std::size_t> GetNumaNodeCpus(std::size_t numa_node);
+
+}  // namespace utils::sys_info
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,27 @@
+#include <utils/sys_info.hpp>
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(SysInfo, ParseCpuList) {
+  using utils::sys_info::ParseCpuList;
+  using Cpus = std::vector<std::size_t>;
+
+  EXPECT_EQ(ParseCpuList(""), Cpus{});
+  EXPECT_EQ(ParseCpuList("3\n"), Cpus{3});
+  EXPECT_EQ(ParseCpuList("0-3"), (Cpus{0, 1, 2, 3}));
+  EXPECT_EQ(ParseCpuList("0-1,4,6-7\n"), (Cpus{0, 1, 4, 6, 7}));
+
+  EXPECT_THROW(ParseCpuList("3-1"), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("a"), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("1,,2"), std::runtime_error);
+}
+
+TEST(SysInfo, NumaNodeMissing) {
+  EXPECT_THROW(utils::sys_info::GetNumaNodeCpus(100500), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
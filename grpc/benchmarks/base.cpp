@@ -1,3 +1,5 @@
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -24,6 +26,8 @@ namespace ugrpc {
 
 namespace {
 
+constexpr std::string_view kBufferedStreamName = "buffered";
+
 class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
  public:
   void SayHello(SayHelloCall& call,
@@ -35,6 +39,7 @@ class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
 
   void ReadMany(ReadManyCall& call,
                 sample::ugrpc::StreamGreetingRequest&& request) override {
+    if (request.name() == kBufferedStreamName) call.EnableWriteBuffering();
     sample::ugrpc::StreamGreetingResponse response;
     response.set_name("Hello again " + request.name());
     for (int i = 0; i < request.number(); ++i) {
@@ -220,6 +225,34 @@ void BatchOfNewClient(benchmark::State& state) {
 
 BENCHMARK(BatchOfNewClient)->DenseRange(1, 8)->Unit(benchmark::kMillisecond);
 
+// Arg is whether the server buffers the writes of the stream
+void ResponseStream(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    static constexpr int kMessagesCount = 1000;
+    GrpcClientTest client_factory;
+    auto client =
+        client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::StreamGreetingRequest out;
+    out.set_name(state.range(0) ? std::string{kBufferedStreamName}
+                                : std::string{"userver"});
+    out.set_number(kMessagesCount);
+    sample::ugrpc::StreamGreetingResponse in;
+
+    for (auto _ : state) {
+      auto stream = client.ReadMany(out);
+      while (stream.Read(in)) {
+      }
+    }
+
+    state.counters["messages"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * kMessagesCount,
+        benchmark::Counter::kIsRate);
+  });
+}
+
+BENCHMARK(ResponseStream)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
 }  // namespace ugrpc
 
 USERVER_NAMESPACE_END
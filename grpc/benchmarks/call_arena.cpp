@@ -0,0 +1,41 @@
+#include <string>
+
+#include <userver/ugrpc/server/impl/call_arena.hpp>
+
+#include <tests/messages.pb.h>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeSerializedBatch() {
+  static constexpr int kGreetingsCount = 64;
+  sample::ugrpc::GreetingBatch batch;
+  for (int i = 0; i < kGreetingsCount; ++i) {
+    auto& greeting = *batch.add_greetings();
+    greeting.set_number(i);
+    greeting.set_name("userver greeting " + std::to_string(i));
+  }
+  return batch.SerializeAsString();
+}
+
+}  // namespace
+
+// Arg is the initial block size of the arena, 0 parses into a heap message
+void CallArenaParse(benchmark::State& state) {
+  const auto serialized = MakeSerializedBatch();
+  const auto initial_block_size = static_cast<std::size_t>(state.range(0));
+
+  for (auto _ : state) {
+    ugrpc::server::impl::CallArena arena{initial_block_size};
+    ugrpc::server::impl::ArenaMessage<sample::ugrpc::GreetingBatch> message{
+        arena.Get()};
+    benchmark::DoNotOptimize(message->ParseFromString(serialized));
+  }
+}
+
+BENCHMARK(CallArenaParse)->Arg(0)->Arg(1024)->Arg(16 * 1024);
+
+USERVER_NAMESPACE_END
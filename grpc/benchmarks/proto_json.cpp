@@ -0,0 +1,67 @@
+#include <string>
+
+#include <userver/ugrpc/proto_json.hpp>
+
+#include <tests/messages.pb.h>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+sample::ugrpc::GreetingBatch MakeBatch() {
+  static constexpr int kGreetingsCount = 64;
+  sample::ugrpc::GreetingBatch batch;
+  for (int i = 0; i < kGreetingsCount; ++i) {
+    auto& greeting = *batch.add_greetings();
+    greeting.set_number(i);
+    greeting.set_name("userver greeting " + std::to_string(i));
+  }
+  return batch;
+}
+
+}  // namespace
+
+void ProtoToJsonLibrary(benchmark::State& state) {
+  const auto batch = MakeBatch();
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(ugrpc::MessageToJson(batch));
+  }
+}
+
+void ProtoToJsonStringBuilder(benchmark::State& state) {
+  const auto batch = MakeBatch();
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::StringBuilder sw;
+    ugrpc::MessageToJson(batch, sw);
+    benchmark::DoNotOptimize(formats::json::FromString(sw.GetStringView()));
+  }
+}
+
+void JsonToProtoLibrary(benchmark::State& state) {
+  const auto json = ugrpc::MessageToJson(MakeBatch());
+  for ([[maybe_unused]] auto _ : state) {
+    sample::ugrpc::GreetingBatch batch;
+    const auto status = google::protobuf::util::JsonStringToMessage(
+        formats::json::ToString(json), &batch);
+    benchmark::DoNotOptimize(status);
+    benchmark::DoNotOptimize(batch);
+  }
+}
+
+void JsonToProtoDirect(benchmark::State& state) {
+  const auto json = ugrpc::MessageToJson(MakeBatch());
+  for ([[maybe_unused]] auto _ : state) {
+    sample::ugrpc::GreetingBatch batch;
+    ugrpc::JsonToMessage(json, batch);
+    benchmark::DoNotOptimize(batch);
+  }
+}
+
+BENCHMARK(ProtoToJsonLibrary);
+BENCHMARK(ProtoToJsonStringBuilder);
+BENCHMARK(JsonToProtoLibrary);
+BENCHMARK(JsonToProtoDirect);
+
+USERVER_NAMESPACE_END
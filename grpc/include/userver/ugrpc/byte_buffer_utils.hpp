@@ -33,6 +33,17 @@ grpc::ByteBuffer SerializeToByteBuffer(
 bool ParseFromByteBuffer(grpc::ByteBuffer&& buffer,
                          ::google::protobuf::Message& message);
 
+/// @brief Parse a Protobuf message from the wire format, keeping @a buffer
+/// intact.
+///
+/// Copies of `grpc::ByteBuffer` share the slices instead of copying the bytes,
+/// so a proxy may inspect a message and still forward the original buffer
+/// without reserializing it.
+/// @returns `true` on success, `false` if @a buffer does not contain a valid
+/// message, according to the derived type of @a message
+bool ParseFromByteBuffer(const grpc::ByteBuffer& buffer,
+                         ::google::protobuf::Message& message);
+
 }  // namespace ugrpc
 
 USERVER_NAMESPACE_END
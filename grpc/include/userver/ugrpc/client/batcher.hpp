@@ -0,0 +1,138 @@
+#pragma once
+
+/// @file userver/ugrpc/client/batcher.hpp
+/// @brief @copybrief ugrpc::client::UnaryBatcher
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// Settings of @ref ugrpc::client::UnaryBatcher
+struct BatcherSettings final {
+  /// A batch is sent as soon as it has that many requests
+  std::size_t max_batch_size{100};
+
+  /// The time the first request of a batch waits for the other ones
+  std::chrono::milliseconds max_delay{1};
+};
+
+/// @brief Packs concurrent unary requests into batch RPCs.
+///
+/// Useful for clients that send lots of tiny requests to the same backend,
+/// when the backend has a method that handles many requests at once. The
+/// requests made concurrently via Call() are collected into a batch, which is
+/// sent by the `batch_func` after BatcherSettings::max_delay or as soon as it
+/// has BatcherSettings::max_batch_size requests. The per-call overhead of the
+/// RPC is paid once per batch.
+///
+/// `batch_func` must return exactly one response per request, in the order of
+/// the requests. An exception thrown from `batch_func` is rethrown from Call()
+/// of all the requests of the batch.
+///
+/// The batch RPCs are performed in background tasks, so the deadline of a
+/// caller is not propagated to them: set the timeout of the batch RPC in
+/// `batch_func`. The tasks are cancelled and waited for in the destructor of
+/// the batcher, and the callers get engine::BrokenPromiseException then.
+///
+/// ## Example usage
+///
+/// @snippet grpc/tests/batcher_test.cpp  sample
+template <typename Request, typename Response>
+class UnaryBatcher final {
+ public:
+  using BatchFunc =
+      std::function<std::vector<Response>(std::vector<Request>&&)>;
+
+  UnaryBatcher(BatchFunc batch_func, BatcherSettings settings)
+      : batch_func_(std::move(batch_func)), settings_(settings) {}
+
+  UnaryBatcher(const UnaryBatcher&) = delete;
+  UnaryBatcher& operator=(const UnaryBatcher&) = delete;
+
+  /// Adds the request to the current batch and waits for its response
+  Response Call(Request request) {
+    std::shared_ptr<Batch> batch;
+    bool is_new_batch = false;
+    engine::Future<Response> future;
+    {
+      std::lock_guard lock(mutex_);
+      if (!current_batch_) {
+        current_batch_ = std::make_shared<Batch>();
+        is_new_batch = true;
+      }
+      batch = current_batch_;
+      batch->requests.push_back(std::move(request));
+      future = batch->promises.emplace_back().get_future();
+
+      if (batch->requests.size() >= settings_.max_batch_size) {
+        current_batch_.reset();
+        batch->is_full.Send();
+      }
+    }
+
+    if (is_new_batch) {
+      tasks_.AsyncDetach("ugrpc-batch",
+                         [this, batch = std::move(batch)] { Send(*batch); });
+    }
+    return future.get();
+  }
+
+ private:
+  struct Batch final {
+    std::vector<Request> requests;
+    std::vector<engine::Promise<Response>> promises;
+    engine::SingleConsumerEvent is_full;
+  };
+
+  void Send(Batch& batch) {
+    [[maybe_unused]] const bool is_full =
+        batch.is_full.WaitForEventFor(settings_.max_delay);
+    {
+      std::lock_guard lock(mutex_);
+      if (current_batch_.get() == &batch) current_batch_.reset();
+    }
+
+    // No more requests are added to the batch
+    try {
+      auto responses = batch_func_(std::move(batch.requests));
+      if (responses.size() != batch.promises.size()) {
+        throw std::runtime_error(fmt::format(
+            "Batch RPC returned {} responses for {} requests",
+            responses.size(), batch.promises.size()));
+      }
+      for (std::size_t i = 0; i < responses.size(); ++i) {
+        batch.promises[i].set_value(std::move(responses[i]));
+      }
+    } catch (const std::exception&) {
+      for (auto& promise : batch.promises) {
+        promise.set_exception(std::current_exception());
+      }
+    }
+  }
+
+  const BatchFunc batch_func_;
+  const BatcherSettings settings_;
+  engine::Mutex mutex_;
+  std::shared_ptr<Batch> current_batch_;
+  concurrent::BackgroundTaskStorage tasks_;
+};
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 /// @brief @copybrief ugrpc::client::ClientFactory
 
 #include <cstddef>
+#include <string_view>
 
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/security/credentials.h>
@@ -20,12 +21,26 @@
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/middlewares/base.hpp>
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
+/// @brief The endpoint of the clients that call the gRPC server of the same
+/// binary through the in-process transport: the calls skip HTTP/2 framing
+/// and the network stack.
+///
+/// Requires ClientFactorySettings::in_process_channel_factory, which
+/// ugrpc::client::ClientFactoryComponent sets up when the service has a
+/// ugrpc::server::ServerComponent. The channels are made when creating a
+/// client and only after the server has started, so such clients should be
+/// created in `OnAllComponentsLoaded` of a component depending on the
+/// ClientFactoryComponent, or later.
+inline constexpr std::string_view kInProcessEndpoint =
+    impl::ChannelCache::kInProcessEndpoint;
+
 /// Settings relating to the ClientFactory
 struct ClientFactorySettings final {
   /// gRPC channel credentials, none by default
@@ -48,6 +63,10 @@ struct ClientFactorySettings final {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// Makes the channels of the clients with @ref kInProcessEndpoint, usually
+  /// via ugrpc::server::Server::MakeInProcessChannel
+  impl::InProcessChannelFactory in_process_channel_factory{};
 };
 
 /// @ingroup userver_clients
@@ -64,6 +83,16 @@ class ClientFactory final {
                 testsuite::GrpcControl& testsuite_grpc,
                 dynamic_config::Source source);
 
+  /// @brief The RPCs of the clients are spread over the `queues`, see
+  /// ugrpc::impl::GetQueueForCurrentThread
+  ClientFactory(ClientFactorySettings&& settings,
+                engine::TaskProcessor& channel_task_processor,
+                MiddlewareFactories mws,
+                const ugrpc::impl::CompletionQueues& queues,
+                utils::statistics::Storage& statistics_storage,
+                testsuite::GrpcControl& testsuite_grpc,
+                dynamic_config::Source source);
+
   template <typename Client>
   Client MakeClient(const std::string& client_name,
                     const std::string& endpoint);
@@ -74,7 +103,7 @@ class ClientFactory final {
 
   engine::TaskProcessor& channel_task_processor_;
   MiddlewareFactories mws_;
-  grpc::CompletionQueue& queue_;
+  const ugrpc::impl::CompletionQueues queues_;
   impl::ChannelCache channel_cache_;
   std::unordered_map<std::string, std::unique_ptr<impl::ChannelCache>>
       client_channel_cache_;
@@ -90,7 +119,7 @@ Client ClientFactory::MakeClient(const std::string& client_name,
       client_name,
       endpoint,
       impl::InstantiateMiddlewares(mws_, client_name),
-      queue_,
+      queues_,
       client_statistics_storage_,
       GetChannel(client_name, endpoint),
       config_source_,
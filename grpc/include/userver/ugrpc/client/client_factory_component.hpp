@@ -3,7 +3,10 @@
 /// @file userver/ugrpc/client/client_factory_component.hpp
 /// @brief @copybrief ugrpc::client::ClientFactoryComponent
 
+#include <optional>
+
 #include <userver/components/component_base.hpp>
+#include <userver/utils/fixed_array.hpp>
 
 #include <userver/ugrpc/client/client_factory.hpp>
 #include <userver/ugrpc/client/queue_holder.hpp>
@@ -33,6 +36,10 @@ namespace ugrpc::client {
 /// service config should be distributed via the name resolution process.
 /// We allow setting default service_config: pass desired JSON literal
 /// to `default-service-config` parameter
+///
+/// If the service has a ugrpc::server::ServerComponent, the clients with the
+/// ugrpc::client::kInProcessEndpoint endpoint call that server through the
+/// in-process transport.
 
 // clang-format off
 
@@ -46,7 +53,8 @@ namespace ugrpc::client {
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// auth-type | authentication method, see above | -
 /// default-service-config | default service config, see above | -
-/// channel-count | Number of underlying grpc::Channel objects | 1
+/// channel-count | Number of underlying grpc::Channel objects, an RPC uses the channel with the least RPCs in flight | 1
+/// completion-queue-count | Number of completion queues if there is no gRPC server, otherwise the server queues are used | 1
 /// middlewares | middlewares names to use | []
 ///
 ///
@@ -68,7 +76,7 @@ class ClientFactoryComponent final : public components::ComponentBase {
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
-  std::optional<QueueHolder> queue_;
+  std::optional<utils::FixedArray<QueueHolder>> queues_;
   std::optional<ClientFactory> factory_;
 };
 
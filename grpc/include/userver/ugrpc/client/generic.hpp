@@ -54,6 +54,10 @@ struct GenericOptions {
 /// message hooks are called, meaning that there won't be any logs of messages
 /// from the default middleware.
 ///
+/// The request is sent without reserialization or flattening: the slices of
+/// `grpc::ByteBuffer` are shared with the call, so a buffer received by
+/// @ref ugrpc::server::GenericServiceBase can be forwarded at no copying cost.
+///
 /// There are no per-call-name metrics by default,
 /// for details see @ref GenericOptions::metrics_call_name.
 ///
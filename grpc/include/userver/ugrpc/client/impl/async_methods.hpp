@@ -79,6 +79,8 @@ class RpcData final {
 
   const Middlewares& GetMiddlewares() const noexcept;
 
+  const std::optional<CompressionSettings>& GetCompression() const noexcept;
+
   void ResetSpan() noexcept;
 
   ugrpc::impl::RpcStatisticsScope& GetStatsScope() noexcept;
@@ -146,6 +148,8 @@ class RpcData final {
   grpc::CompletionQueue& queue_;
   RpcConfigValues config_values_;
   const Middlewares& mws_;
+  ChannelLoadScope channel_load_;
+  std::optional<CompressionSettings> compression_;
 
   // This data is common for all types of grpc calls - unary and streaming
   // However, in unary call the call is finished as soon as grpc core
@@ -192,6 +196,21 @@ void StartCall(GrpcStream& stream, RpcData& data) {
   CheckOk(data, Wait(start_call, data.GetContext()), "StartCall");
 }
 
+/// Sets the compression algorithm of a stream, must be called before the call
+/// is started. Small messages are not compressed by ApplyMinMessageSize().
+void SetupCompression(RpcData& data);
+
+/// Sets the compression algorithm of a call with a single request, unless the
+/// request is too small
+template <typename Request>
+void SetupCompression(RpcData& data, const Request& request) {
+  const auto& compression = data.GetCompression();
+  if (compression && ugrpc::impl::ShouldCompress(
+                         compression, ugrpc::impl::GetMessageSize(request))) {
+    SetupCompression(data);
+  }
+}
+
 void PrepareFinish(RpcData& data);
 
 void ProcessFinishResult(RpcData& data,
@@ -27,18 +27,21 @@ struct CallParams {
   std::unique_ptr<grpc::ClientContext> context;
   ugrpc::impl::MethodStatistics& statistics;
   const Middlewares& mws;
+  ChannelLoadScope channel_load;
+  std::optional<CompressionSettings> compression;
 };
 
 CallParams CreateCallParams(const ClientData& client_data,
                             std::size_t method_id,
                             std::unique_ptr<grpc::ClientContext> client_context,
                             const dynamic_config::Key<ClientQos>& client_qos,
-                            const Qos& qos);
+                            const Qos& qos, ChannelLoadScope&& channel_load);
 
 CallParams CreateGenericCallParams(
     const ClientData& client_data, std::string_view call_name,
     std::unique_ptr<grpc::ClientContext> client_context, const Qos& qos,
-    std::optional<std::string_view> metrics_call_name);
+    std::optional<std::string_view> metrics_call_name,
+    ChannelLoadScope&& channel_load);
 
 }  // namespace ugrpc::client::impl
 
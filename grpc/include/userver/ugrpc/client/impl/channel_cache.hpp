@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include <grpcpp/channel.h>
@@ -17,11 +20,33 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
+/// Accounts an RPC in the number of the in-flight RPCs of a channel while
+/// alive
+class ChannelLoadScope final {
+ public:
+  ChannelLoadScope() noexcept = default;
+  explicit ChannelLoadScope(std::atomic<std::uint64_t>& in_flight) noexcept;
+
+  ChannelLoadScope(ChannelLoadScope&&) noexcept;
+  ChannelLoadScope& operator=(ChannelLoadScope&&) noexcept;
+  ~ChannelLoadScope();
+
+ private:
+  std::atomic<std::uint64_t>* in_flight_{nullptr};
+};
+
+using InProcessChannelFactory = std::function<std::shared_ptr<grpc::Channel>(
+    const grpc::ChannelArguments&)>;
+
 class ChannelCache final {
  public:
+  // The channels to this endpoint are made by the InProcessChannelFactory
+  static constexpr std::string_view kInProcessEndpoint = "in-process";
+
   ChannelCache(std::shared_ptr<grpc::ChannelCredentials>&& credentials,
                const grpc::ChannelArguments& channel_args,
-               std::size_t channel_count);
+               std::size_t channel_count,
+               InProcessChannelFactory in_process_factory = {});
 
   ~ChannelCache();
 
@@ -36,9 +61,12 @@ class ChannelCache final {
     CountedChannel(const std::string& endpoint,
                    const std::shared_ptr<grpc::ChannelCredentials>& credentials,
                    const grpc::ChannelArguments& channel_args,
-                   std::size_t count);
+                   std::size_t count,
+                   const InProcessChannelFactory& in_process_factory);
 
     utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
+    // Shared by all the clients of the endpoint
+    utils::FixedArray<std::atomic<std::uint64_t>> in_flight;
     std::uint64_t counter{0};
   };
 
@@ -47,6 +75,7 @@ class ChannelCache final {
   const std::shared_ptr<grpc::ChannelCredentials> credentials_;
   const grpc::ChannelArguments channel_args_;
   const std::size_t channel_count_;
+  const InProcessChannelFactory in_process_factory_;
   concurrent::Variable<Map> channels_;
 };
 
@@ -67,6 +96,14 @@ class ChannelCache::Token final {
   const std::shared_ptr<grpc::Channel>& GetChannel(std::size_t index) const
       noexcept;
 
+  // Returns the index of the channel with the least number of the RPCs in
+  // flight, the ties are broken randomly
+  std::size_t GetLeastLoadedChannel() const noexcept;
+
+  ChannelLoadScope MakeLoadScope(std::size_t index) const noexcept;
+
+  std::uint64_t GetInFlightCount(std::size_t index) const noexcept;
+
  private:
   ChannelCache* cache_{nullptr};
   const std::string* endpoint_{nullptr};
@@ -12,10 +12,10 @@
 #include <userver/testsuite/grpc_control.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/utils/fixed_array.hpp>
-#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,7 +29,7 @@ struct ClientParams final {
   std::string client_name;
   std::string endpoint;
   Middlewares mws;
-  grpc::CompletionQueue& queue;
+  ugrpc::impl::CompletionQueues queues;
   ugrpc::impl::StatisticsStorage& statistics_storage;
   impl::ChannelCache::Token channel_token;
   const dynamic_config::Source config_source;
@@ -67,12 +67,24 @@ class ClientData final {
   ClientData& operator=(const ClientData&) = delete;
 
   template <typename Service>
-  Stub<Service>& NextStub() const {
-    return *static_cast<Stub<Service>*>(
-        stubs_[utils::RandRange(stubs_.size())].get());
+  struct ChosenStub final {
+    Stub<Service>& stub;
+    ChannelLoadScope load;
+  };
+
+  /// Chooses the stub of the least loaded channel. The RPC should keep `load`
+  /// alive to be accounted in the load of the channel.
+  template <typename Service>
+  ChosenStub<Service> NextStub() const {
+    const auto index = params_.channel_token.GetLeastLoadedChannel();
+    return {*static_cast<Stub<Service>*>(stubs_[index].get()),
+            params_.channel_token.MakeLoadScope(index)};
   }
 
-  grpc::CompletionQueue& GetQueue() const { return params_.queue; }
+  /// The queue for a new RPC, see ugrpc::impl::GetQueueForCurrentThread
+  grpc::CompletionQueue& GetQueue() const {
+    return ugrpc::impl::GetQueueForCurrentThread(params_.queues);
+  }
 
   dynamic_config::Snapshot GetConfigSnapshot() const {
     return params_.config_source.GetSnapshot();
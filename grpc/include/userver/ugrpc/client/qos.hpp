@@ -8,6 +8,7 @@
 #include <grpcpp/client_context.h>
 
 #include <userver/formats/json_fwd.hpp>
+#include <userver/ugrpc/compression.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,6 +20,9 @@ namespace ugrpc::client {
 
 struct Qos final {
   std::optional<std::chrono::milliseconds> timeout;
+
+  /// Compression of the request messages, see ugrpc::CompressionSettings
+  std::optional<CompressionSettings> compression;
 };
 
 Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>);
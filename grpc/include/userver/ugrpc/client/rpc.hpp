@@ -479,6 +479,7 @@ UnaryCall<Response>::UnaryCall(impl::CallParams&& params,
   if constexpr (std::is_base_of_v<::google::protobuf::Message, Request>) {
     req_message = &req;
   }
+  impl::SetupCompression(GetData(), req);
   impl::CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
@@ -518,6 +519,7 @@ InputStream<Response>::InputStream(impl::CallParams&& params,
   if constexpr (std::is_base_of_v<::google::protobuf::Message, Request>) {
     req_message = &req;
   }
+  impl::SetupCompression(GetData(), req);
   impl::CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
@@ -547,6 +549,7 @@ OutputStream<Request, Response>::OutputStream(impl::CallParams&& params,
                                               PrepareFunc prepare_func)
     : CallAnyBase(std::move(params)),
       final_response_(std::make_unique<Response>()) {
+  impl::SetupCompression(GetData());
   impl::CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
@@ -563,6 +566,8 @@ bool OutputStream<Request, Response>::Write(const Request& request) {
   // Don't buffer writes, otherwise in an event subscription scenario, events
   // may never actually be delivered
   grpc::WriteOptions write_options{};
+  ugrpc::impl::ApplyMinMessageSize(write_options, GetData().GetCompression(),
+                                   request);
 
   return impl::Write(*stream_, request, write_options, GetData());
 }
@@ -572,6 +577,8 @@ void OutputStream<Request, Response>::WriteAndCheck(const Request& request) {
   // Don't buffer writes, otherwise in an event subscription scenario, events
   // may never actually be delivered
   grpc::WriteOptions write_options{};
+  ugrpc::impl::ApplyMinMessageSize(write_options, GetData().GetCompression(),
+                                   request);
 
   if (!impl::Write(*stream_, request, write_options, GetData())) {
     impl::Finish(*stream_, GetData(), true);
@@ -596,6 +603,7 @@ template <typename PrepareFunc>
 BidirectionalStream<Request, Response>::BidirectionalStream(
     impl::CallParams&& params, PrepareFunc prepare_func)
     : CallAnyBase(std::move(params)) {
+  impl::SetupCompression(GetData());
   impl::CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
@@ -623,6 +631,8 @@ template <typename Request, typename Response>
 bool BidirectionalStream<Request, Response>::Write(const Request& request) {
   // Don't buffer writes, optimize for ping-pong-style interaction
   grpc::WriteOptions write_options{};
+  ugrpc::impl::ApplyMinMessageSize(write_options, GetData().GetCompression(),
+                                   request);
 
   return impl::Write(*stream_, request, write_options, GetData());
 }
@@ -632,6 +642,8 @@ void BidirectionalStream<Request, Response>::WriteAndCheck(
     const Request& request) {
   // Don't buffer writes, optimize for ping-pong-style interaction
   grpc::WriteOptions write_options{};
+  ugrpc::impl::ApplyMinMessageSize(write_options, GetData().GetCompression(),
+                                   request);
 
   impl::WriteAndCheck(*stream_, request, write_options, GetData());
 }
@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file userver/ugrpc/client/sharded_client.hpp
+/// @brief @copybrief ugrpc::client::ShardedClient
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/clients/sharding/balancer.hpp>
+#include <userver/rcu/rcu_map.hpp>
+
+#include <userver/ugrpc/client/client_factory.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @ingroup userver_clients
+///
+/// @brief Client-side sharding of the RPCs between the backends of a
+/// clients::sharding::ConsistentHashBalancer.
+///
+/// The RPCs with the same hash key go to the same backend. A client with its
+/// own channel is created by the ClientFactory for every backend on the first
+/// use; the clients of the backends that are gone from the balancer are
+/// dropped once a new backend appears.
+///
+/// @par Usage synopsis
+/// @code
+/// balancer_.StartRefresh(
+///     "greeter-sharding",
+///     clients::sharding::MakeDnsMembershipSource(resolver, "greeter", 8080),
+///     std::chrono::seconds{10});
+/// ugrpc::client::ShardedClient<api::GreeterServiceClient> greeters{
+///     client_factory, "greeter", balancer_};
+///
+/// auto call = greeters.ForKey(request.name())->SayHello(request);
+/// @endcode
+template <typename Client>
+class ShardedClient final {
+ public:
+  /// `factory` and `balancer` must outlive the ShardedClient
+  ShardedClient(ClientFactory& factory, std::string client_name,
+                const clients::sharding::ConsistentHashBalancer& balancer)
+      : factory_(factory),
+        client_name_(std::move(client_name)),
+        balancer_(balancer) {}
+
+  /// @brief Returns the client of the backend of the `key`.
+  /// @throws clients::sharding::NoBackendsError if there are no backends
+  std::shared_ptr<const Client> ForKey(std::string_view key) {
+    return ForEndpoint(balancer_.Pick(key));
+  }
+
+  /// @brief Returns the client of the `endpoint`, e.g. one of the
+  /// clients::sharding::ConsistentHashBalancer::PickReplicas() for a retry.
+  std::shared_ptr<const Client> ForEndpoint(const std::string& endpoint) {
+    if (auto client = clients_.Get(endpoint)) return client;
+
+    auto [client, inserted] = clients_.TryEmplace(
+        endpoint, factory_.MakeClient<Client>(client_name_, endpoint));
+    if (inserted) DropRemovedBackends();
+    return client;
+  }
+
+ private:
+  void DropRemovedBackends() {
+    const auto backends = balancer_.GetBackends();
+    std::vector<std::string> removed;
+    for (const auto& [endpoint, client] : clients_) {
+      if (!std::binary_search(backends.begin(), backends.end(), endpoint)) {
+        removed.push_back(endpoint);
+      }
+    }
+    for (const auto& endpoint : removed) clients_.Erase(endpoint);
+  }
+
+  ClientFactory& factory_;
+  const std::string client_name_;
+  const clients::sharding::ConsistentHashBalancer& balancer_;
+  rcu::RcuMap<std::string, const Client> clients_;
+};
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
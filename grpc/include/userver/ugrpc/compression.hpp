@@ -0,0 +1,95 @@
+#pragma once
+
+/// @file userver/ugrpc/compression.hpp
+/// @brief @copybrief ugrpc::CompressionSettings
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+#include <google/protobuf/message.h>
+#include <grpc/compression.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/impl/codegen/call_op_set.h>
+
+#include <userver/formats/json_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+/// @brief Compression of the messages of a gRPC method.
+///
+/// gRPC implements the `gzip` and `deflate` algorithms, `zstd` is not
+/// supported by the gRPC core. The messages are compressed by gRPC on each
+/// send, a generic service may keep the responses it sends repeatedly as
+/// serialized `grpc::ByteBuffer`s (see ugrpc::SerializeToByteBuffer) to skip
+/// the serialization, but not the compression.
+///
+/// Set per method in dynamic config, by the `compression` field of
+/// ugrpc::client::Qos for the requests and by
+/// `USERVER_GRPC_SERVER_COMPRESSION` for the responses:
+/// @code{.json}
+/// {
+///   "__default__": {"level": "low", "min-message-size": 1024},
+///   "my.package.MyService/BigMethod": {"level": "high"}
+/// }
+/// @endcode
+struct CompressionSettings final {
+  /// The algorithm, `gzip` or `deflate`. A server uses it only if `level` is
+  /// not set, and compresses the responses with it even if the client does
+  /// not support it.
+  std::optional<grpc_compression_algorithm> algorithm;
+
+  /// Server only: `low`, `medium` or `high`. The server chooses the algorithm
+  /// for the level among the ones supported by the client.
+  std::optional<grpc_compression_level> level;
+
+  /// Messages of a smaller serialized size are sent uncompressed, compressing
+  /// them rarely pays off
+  std::size_t min_message_size{0};
+};
+
+bool operator==(const CompressionSettings& lhs,
+                const CompressionSettings& rhs) noexcept;
+
+CompressionSettings Parse(const formats::json::Value& value,
+                          formats::parse::To<CompressionSettings>);
+
+formats::json::Value Serialize(const CompressionSettings& settings,
+                               formats::serialize::To<formats::json::Value>);
+
+namespace impl {
+
+template <typename Message>
+std::size_t GetMessageSize(const Message& message) {
+  if constexpr (std::is_base_of_v<google::protobuf::Message, Message>) {
+    return message.ByteSizeLong();
+  } else {
+    static_assert(std::is_same_v<Message, grpc::ByteBuffer>);
+    return message.Length();
+  }
+}
+
+/// Whether a message of the size should be compressed with the settings
+inline bool ShouldCompress(const std::optional<CompressionSettings>& settings,
+                           std::size_t message_size) noexcept {
+  return settings && message_size >= settings->min_message_size;
+}
+
+/// Disables the compression of the message, if it is too small
+template <typename Message>
+void ApplyMinMessageSize(grpc::WriteOptions& options,
+                         const std::optional<CompressionSettings>& settings,
+                         const Message& message) {
+  if (settings && settings->min_message_size != 0 &&
+      !ShouldCompress(settings, GetMessageSize(message))) {
+    options.set_no_compression();
+  }
+}
+
+}  // namespace impl
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
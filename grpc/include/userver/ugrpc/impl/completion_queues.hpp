@@ -12,6 +12,13 @@ struct CompletionQueues final {
   std::vector<grpc::CompletionQueue*> queues;
 };
 
+/// @brief Returns the queue for the RPCs started on the current thread.
+///
+/// The threads are spread over the queues round-robin, the RPCs of each
+/// engine worker thread always go through the same queue.
+grpc::CompletionQueue& GetQueueForCurrentThread(
+    const CompletionQueues& queues) noexcept;
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
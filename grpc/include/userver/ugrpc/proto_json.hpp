@@ -4,11 +4,14 @@
 /// @brief Utilities for conversion Protobuf -> Json
 /// @ingroup userver_formats_serialize userver_formats_parse
 
+#include <type_traits>
+
 #include <google/protobuf/struct.pb.h>
 #include <google/protobuf/util/json_util.h>
 
 #include <userver/formats/json.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +21,26 @@ namespace ugrpc {
 /// @throws SerializationError
 formats::json::Value MessageToJson(const google::protobuf::Message& message);
 
+/// @brief Writes the JSON representation of protobuf message into `sw`
+///
+/// Faster than ToJsonString or MessageToJson, as the message is written
+/// directly into the builder using the field tables precomputed per message
+/// type. Fields are printed the same way the other functions do, well-known
+/// types (`google.protobuf.*`) are converted by the protobuf library.
+/// Extensions of proto2 messages are not written.
+/// @throws formats::json::Exception
+void MessageToJson(const google::protobuf::Message& message,
+                   formats::json::StringBuilder& sw);
+
+/// @brief Fills protobuf message from its JSON representation
+///
+/// The counterpart of MessageToJson, that does not build an intermediate
+/// JSON string for the protobuf library. Fields are looked up both by their
+/// JSON and proto names, unknown fields are an error.
+/// @throws formats::json::Exception
+void JsonToMessage(const formats::json::Value& json,
+                   google::protobuf::Message& message);
+
 /// @brief Converts message to human readable string
 std::string ToString(const google::protobuf::Message& message);
 
@@ -32,6 +55,12 @@ namespace formats::serialize {
 json::Value Serialize(const google::protobuf::Message& message,
                       To<json::Value>);
 
+template <typename Message>
+std::enable_if_t<std::is_base_of_v<google::protobuf::Message, Message>>
+WriteToStream(const Message& message, json::StringBuilder& sw) {
+  ugrpc::MessageToJson(message, sw);
+}
+
 }  // namespace formats::serialize
 
 namespace formats::parse {
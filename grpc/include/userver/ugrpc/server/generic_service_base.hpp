@@ -32,6 +32,13 @@ namespace ugrpc::server {
 /// message hooks are called, meaning that there won't be any logs of messages
 /// from the default middleware.
 ///
+/// The messages are never parsed or serialized by userver: `grpc::ByteBuffer`
+/// received from the call may be passed to @ref ugrpc::client::GenericClient
+/// as is, both of them (and their copies) only reference the received slices.
+/// Code that needs some fields of a message may parse it lazily with
+/// @ref ugrpc::ParseFromByteBuffer taking a `const grpc::ByteBuffer&`, which
+/// keeps the buffer intact for forwarding.
+///
 /// Statically-typed services, if registered, take priority over generic
 /// services. It only makes sense to register at most 1 generic service.
 ///
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include <google/protobuf/arena.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+/// @brief Per-call protobuf arena for the request and response messages
+///
+/// The initial block of the arena is taken from a thread-local cache and is
+/// returned there after the call, so the messages of a call that fit into the
+/// initial block are created without any allocations.
+class CallArena final {
+ public:
+  /// @param initial_block_size the arena is disabled if `0`
+  explicit CallArena(std::size_t initial_block_size);
+
+  CallArena(CallArena&&) = delete;
+  CallArena& operator=(CallArena&&) = delete;
+  ~CallArena();
+
+  /// @returns the arena or `nullptr` if the arena is disabled
+  google::protobuf::Arena* Get() noexcept {
+    return arena_ ? &*arena_ : nullptr;
+  }
+
+ private:
+  const std::size_t initial_block_size_;
+  std::unique_ptr<char[]> initial_block_;
+  std::optional<google::protobuf::Arena> arena_;
+};
+
+/// @brief Owner of a message created on a (possibly disabled) CallArena
+template <typename Message>
+class ArenaMessage final {
+ public:
+  explicit ArenaMessage(google::protobuf::Arena* arena)
+      : message_(google::protobuf::Arena::CreateMessage<Message>(arena)) {}
+
+  ArenaMessage(ArenaMessage&&) = delete;
+  ArenaMessage& operator=(ArenaMessage&&) = delete;
+
+  ~ArenaMessage() {
+    // Messages on the arena are destroyed with the arena
+    if (!message_->GetArena()) delete message_;
+  }
+
+  Message& operator*() noexcept { return *message_; }
+  Message* operator->() noexcept { return message_; }
+
+ private:
+  Message* const message_;
+};
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <optional>
 #include <string_view>
 
 #include <grpcpp/completion_queue.h>
+#include <google/protobuf/arena.h>
 #include <grpcpp/server_context.h>
 
 #include <userver/dynamic_config/snapshot.hpp>
@@ -10,6 +12,7 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/any_storage.hpp>
 
+#include <userver/ugrpc/compression.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
 #include <userver/ugrpc/server/storage_context.hpp>
@@ -33,6 +36,8 @@ struct CallParams {
   tracing::Span& call_span;
   utils::AnyStorage<StorageContext>& storage_context;
   const Middlewares& middlewares;
+  google::protobuf::Arena* arena;
+  std::optional<CompressionSettings> compression;
 };
 
 }  // namespace ugrpc::server::impl
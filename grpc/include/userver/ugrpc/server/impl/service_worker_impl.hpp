@@ -29,6 +29,7 @@
 #include <userver/ugrpc/impl/statistics_scope.hpp>
 #include <userver/ugrpc/server/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/server/impl/async_service.hpp>
+#include <userver/ugrpc/server/impl/call_arena.hpp>
 #include <userver/ugrpc/server/impl/call_params.hpp>
 #include <userver/ugrpc/server/impl/call_traits.hpp>
 #include <userver/ugrpc/server/impl/error_code.hpp>
@@ -62,6 +63,9 @@ void ParseGenericCallName(std::string_view generic_call_name,
                           std::string_view& service_name,
                           std::string_view& method_name);
 
+std::optional<CompressionSettings> GetCompression(
+    const dynamic_config::Snapshot& config, std::string_view call_name);
+
 /// Per-gRPC-service data
 template <typename GrpcppService>
 struct ServiceData final {
@@ -123,7 +127,7 @@ class CallData final {
 
     // the request for an incoming RPC must be performed synchronously
     method_data_.service_data.async_service.template Prepare<CallTraits>(
-        method_data_.method_id, context_, initial_request_, raw_responder_,
+        method_data_.method_id, context_, GetInitialRequest(), raw_responder_,
         queue, queue, prepare_.GetTag());
 
     // Note: we ignore task cancellations here. Even if notify_when_done has
@@ -164,6 +168,26 @@ class CallData final {
   using InitialRequest = typename CallTraits::InitialRequest;
   using RawCall = typename CallTraits::RawCall;
   using Call = typename CallTraits::Call;
+  using InitialRequestHolder =
+      std::conditional_t<std::is_same_v<InitialRequest, NoInitialRequest>,
+                         NoInitialRequest, ArenaMessage<InitialRequest>>;
+
+  static InitialRequestHolder MakeInitialRequest(
+      google::protobuf::Arena* arena) {
+    if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
+      return {};
+    } else {
+      return InitialRequestHolder{arena};
+    }
+  }
+
+  InitialRequest& GetInitialRequest() {
+    if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
+      return initial_request_;
+    } else {
+      return *initial_request_;
+    }
+  }
 
   void HandleRpc() {
     auto call_name = method_data_.call_name;
@@ -186,30 +210,31 @@ class CallData final {
     auto& statistics_storage =
         method_data_.service_data.settings.statistics_storage;
     utils::AnyStorage<StorageContext> storage_context;
+    const auto config =
+        method_data_.service_data.settings.config_source.GetSnapshot();
     Call responder(
         CallParams{context_, call_name, service_name, method_name,
                    statistics_scope, statistics_storage, *access_tskv_logger,
-                   span_->Get(), storage_context, middlewares},
+                   span_->Get(), storage_context, middlewares, arena_.Get(),
+                   GetCompression(config, call_name)},
         raw_responder_);
     auto do_call = [&] {
       if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
         (method_data_.service.*(method_data_.service_method))(responder);
       } else {
         (method_data_.service.*(method_data_.service_method))(
-            responder, std::move(initial_request_));
+            responder, std::move(*initial_request_));
       }
     };
 
     try {
       ::google::protobuf::Message* initial_request = nullptr;
       if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-        initial_request = &initial_request_;
+        initial_request = &*initial_request_;
       }
 
       MiddlewareCallContext middleware_context(
-          middlewares, responder, do_call,
-          method_data_.service_data.settings.config_source.GetSnapshot(),
-          initial_request);
+          middlewares, responder, do_call, config, initial_request);
       responder.RunMiddlewarePipeline(utils::impl::InternalTag{},
                                       middleware_context);
     } catch (
@@ -229,7 +254,10 @@ class CallData final {
   MethodData<GrpcppService, CallTraits> method_data_;
 
   typename CallTraits::ContextType context_{};
-  InitialRequest initial_request_{};
+  // 'arena_' must outlive the messages created on it
+  CallArena arena_{
+      method_data_.service_data.settings.message_arena_initial_block_size};
+  InitialRequestHolder initial_request_ = MakeInitialRequest(arena_.Get());
   RawCall raw_responder_{&context_};
   ugrpc::impl::AsyncMethodInvocation prepare_;
   std::optional<tracing::InPlaceSpan> span_{};
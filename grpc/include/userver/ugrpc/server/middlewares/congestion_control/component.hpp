@@ -13,9 +13,28 @@ namespace ugrpc::server::middlewares::congestion_control {
 
 class Middleware;
 
+// clang-format off
+
 /// @ingroup userver_components userver_base_classes
 ///
-/// @brief Component for gRPC server logging
+/// @brief Component for gRPC server congestion control
+///
+/// Besides the global RPS limit of the congestion control, the calls of the
+/// methods listed in `methods` may be limited individually. A call is rejected
+/// with RESOURCE_EXHAUSTED if the method already has `max-concurrent-calls`
+/// calls in flight, or, with `reject-by-deadline`, if its remaining deadline is
+/// shorter than the median duration of the calls of the method, so that it
+/// would most likely time out anyway.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// methods | per-method settings, the keys are the full call names, e.g. `sample.ugrpc.UnitTestService/SayHello` | {}
+/// methods.*.max-concurrent-calls | calls above the limit are rejected, 0 for no limit | 0
+/// methods.*.reject-by-deadline | reject the calls with the remaining deadline shorter than the median call duration | false
+
+// clang-format on
+
 class Component final : public MiddlewareComponentBase {
  public:
   /// @ingroup userver_component_names
@@ -9,6 +9,7 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <userver/ugrpc/compression.hpp>
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
 #include <userver/ugrpc/impl/span.hpp>
@@ -17,6 +18,7 @@
 #include <userver/ugrpc/server/impl/async_methods.hpp>
 #include <userver/ugrpc/server/impl/call_params.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
+#include <userver/ugrpc/server/write_buffering.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -72,6 +74,14 @@ class CallAnyBase {
   /// @brief Get RPCs kind of method
   CallKind GetCallKind() const { return call_kind_; }
 
+  /// @brief Protobuf arena of the RPC, `nullptr` if the arena is disabled by
+  /// the `message-arena-initial-block-size` option of the server.
+  ///
+  /// The request messages are created on the arena. Responses and stream
+  /// messages created with `google::protobuf::Arena::CreateMessage` on it
+  /// live until the end of the RPC and are freed all at once.
+  google::protobuf::Arena* GetArena() { return params_.arena; }
+
   /// @brief Returns call context for storing per-call custom data
   ///
   /// The context can be used to pass data from server middleware to client
@@ -131,6 +141,24 @@ class CallAnyBase {
 
   void ApplyResponseHook(google::protobuf::Message* response);
 
+  const std::optional<CompressionSettings>& GetCompression() const {
+    return params_.compression;
+  }
+
+  /// Sets the compression of the responses, must be called before the
+  /// initial metadata is sent
+  void SetupCompression();
+
+  /// Sets the compression of the single response, unless it is too small
+  template <typename Response>
+  void SetupCompression(const Response& response) {
+    if (params_.compression &&
+        ugrpc::impl::ShouldCompress(params_.compression,
+                                    ugrpc::impl::GetMessageSize(response))) {
+      SetupCompression();
+    }
+  }
+
  private:
   impl::CallParams params_;
   CallKind call_kind_;
@@ -260,6 +288,11 @@ class OutputStream final : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(Response&& response);
 
+  /// @brief Allow gRPC to coalesce the following small messages, see
+  /// @ref WriteBufferingSettings. Improves the throughput of streams that
+  /// write lots of messages in a row.
+  void EnableWriteBuffering(const WriteBufferingSettings& settings = {});
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -310,6 +343,7 @@ class OutputStream final : public CallAnyBase {
 
   impl::RawWriter<Response>& stream_;
   State state_{State::kNew};
+  impl::WriteBuffering write_buffering_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -343,6 +377,11 @@ class BidirectionalStream : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(Response&& response);
 
+  /// @brief Allow gRPC to coalesce the following small messages, see
+  /// @ref WriteBufferingSettings. Improves the throughput of streams that
+  /// write lots of messages in a row.
+  void EnableWriteBuffering(const WriteBufferingSettings& settings = {});
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -392,6 +431,7 @@ class BidirectionalStream : public CallAnyBase {
   impl::RawReaderWriter<Request, Response>& stream_;
   bool are_reads_done_{false};
   bool is_finished_{false};
+  impl::WriteBuffering write_buffering_;
 };
 
 // ========================== Implementation follows ==========================
@@ -422,6 +462,7 @@ void UnaryCall<Response>::Finish(Response& response) {
   is_finished_ = true;
 
   ApplyResponseHook(&response);
+  SetupCompression(response);
 
   LogFinish(grpc::Status::OK);
   impl::Finish(stream_, response, grpc::Status::OK, GetCallName());
@@ -487,6 +528,7 @@ void InputStream<Request, Response>::Finish(Response& response) {
   LogFinish(status);
 
   ApplyResponseHook(&response);
+  SetupCompression(response);
 
   impl::Finish(stream_, response, status, GetCallName());
   GetStatistics().OnExplicitFinish(status.error_code());
@@ -516,7 +558,9 @@ OutputStream<Response>::OutputStream(impl::CallParams&& call_params,
                                      impl::RawWriter<Response>& stream)
     : CallAnyBase(utils::impl::InternalTag{}, std::move(call_params),
                   CallKind::kResponseStream),
-      stream_(stream) {}
+      stream_(stream) {
+  SetupCompression();
+}
 
 template <typename Response>
 OutputStream<Response>::~OutputStream() {
@@ -539,15 +583,22 @@ void OutputStream<Response>::Write(Response& response) {
   // streams
   impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
 
-  // Don't buffer writes, otherwise in an event subscription scenario, events
-  // may never actually be delivered
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes unless asked to, otherwise in an event subscription
+  // scenario, events may never actually be delivered
+  auto write_options = write_buffering_.MakeWriteOptions(response);
 
   ApplyResponseHook(&response);
+  ugrpc::impl::ApplyMinMessageSize(write_options, GetCompression(), response);
 
   impl::Write(stream_, response, write_options, GetCallName());
 }
 
+template <typename Response>
+void OutputStream<Response>::EnableWriteBuffering(
+    const WriteBufferingSettings& settings) {
+  write_buffering_.Enable(settings);
+}
+
 template <typename Response>
 void OutputStream<Response>::Finish() {
   UINVARIANT(state_ != State::kFinished,
@@ -592,6 +643,7 @@ void OutputStream<Response>::WriteAndFinish(Response& response) {
   LogFinish(status);
 
   ApplyResponseHook(&response);
+  ugrpc::impl::ApplyMinMessageSize(write_options, GetCompression(), response);
 
   impl::WriteAndFinish(stream_, response, write_options, status, GetCallName());
   GetStatistics().OnExplicitFinish(grpc::StatusCode::OK);
@@ -609,7 +661,9 @@ BidirectionalStream<Request, Response>::BidirectionalStream(
     impl::RawReaderWriter<Request, Response>& stream)
     : CallAnyBase(utils::impl::InternalTag{}, std::move(call_params),
                   CallKind::kBidirectionalStream),
-      stream_(stream) {}
+      stream_(stream) {
+  SetupCompression();
+}
 
 template <typename Request, typename Response>
 BidirectionalStream<Request, Response>::~BidirectionalStream() {
@@ -643,12 +697,14 @@ template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Write(Response& response) {
   UINVARIANT(!is_finished_, "'Write' called on a finished stream");
 
-  // Don't buffer writes, optimize for ping-pong-style interaction
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes unless asked to, optimize for ping-pong-style
+  // interaction
+  auto write_options = write_buffering_.MakeWriteOptions(response);
 
   if constexpr (std::is_base_of_v<google::protobuf::Message, Response>) {
     ApplyResponseHook(&response);
   }
+  ugrpc::impl::ApplyMinMessageSize(write_options, GetCompression(), response);
 
   try {
     impl::Write(stream_, response, write_options, GetCallName());
@@ -658,6 +714,12 @@ void BidirectionalStream<Request, Response>::Write(Response& response) {
   }
 }
 
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::EnableWriteBuffering(
+    const WriteBufferingSettings& settings) {
+  write_buffering_.Enable(settings);
+}
+
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Finish() {
   UINVARIANT(!is_finished_, "'Finish' called on a finished stream");
@@ -703,6 +765,7 @@ void BidirectionalStream<Request, Response>::WriteAndFinish(
   if constexpr (std::is_base_of_v<google::protobuf::Message, Response>) {
     ApplyResponseHook(&response);
   }
+  ugrpc::impl::ApplyMinMessageSize(write_options, GetCompression(), response);
 
   impl::WriteAndFinish(stream_, response, write_options, status, GetCallName());
   GetStatistics().OnExplicitFinish(status.error_code());
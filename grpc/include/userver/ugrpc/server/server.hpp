@@ -7,8 +7,10 @@
 #include <memory>
 #include <unordered_map>
 
+#include <grpcpp/channel.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/server_builder.h>
+#include <grpcpp/support/channel_arguments.h>
 
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -19,6 +21,7 @@
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
 #include <userver/ugrpc/server/service_base.hpp>
@@ -57,6 +60,10 @@ struct ServerConfig final {
 
   /// 'access-tskv.log' logger
   logging::LoggerPtr access_tskv_logger{logging::MakeNullLogger()};
+
+  /// Size of the initial block of the per-call protobuf arena, the request
+  /// messages are created on the arena. If `0`, the arena is not used.
+  std::size_t message_arena_initial_block_size{0};
 };
 
 /// @brief Manages the gRPC server
@@ -98,6 +105,18 @@ class Server final
   /// usually no more than one instance per program.
   grpc::CompletionQueue& GetCompletionQueue() noexcept;
 
+  /// @returns all the completion queues of the server, for spreading the
+  /// RPCs of clients over them
+  /// @note The same restrictions as for @ref GetCompletionQueue apply
+  const ugrpc::impl::CompletionQueues& GetCompletionQueues() noexcept;
+
+  /// @returns a channel to this server that does not use the network stack,
+  /// for the clients in the same binary
+  /// @note Only available after 'Start' has returned
+  /// @see ugrpc::client::kInProcessEndpoint
+  std::shared_ptr<grpc::Channel> MakeInProcessChannel(
+      const grpc::ChannelArguments& channel_args);
+
   /// @brief Start accepting requests
   /// @note Must be called at most once after all the services are registered
   void Start();
@@ -33,6 +33,7 @@ struct ServiceDefaults;
 /// channel-args | a map of channel arguments, see gRPC Core docs | {}
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// enable-channelz | initialize service with runtime info about gRPC connections | false
+/// message-arena-initial-block-size | initial block size of the per-call protobuf arena for requests, 0 to disable the arena | 0
 /// service-defaults | default config values for gRPC services, see config schema | {}
 ///
 /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
@@ -0,0 +1,64 @@
+#pragma once
+
+/// @file userver/ugrpc/server/write_buffering.hpp
+/// @brief @copybrief ugrpc::server::WriteBufferingSettings
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+#include <grpcpp/impl/codegen/call_op_set.h>
+
+#include <userver/ugrpc/compression.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+/// @brief Coalescing of the small messages of a response stream.
+///
+/// By default every message of a stream is sent to the network right away.
+/// With buffering enabled the messages are written with
+/// `grpc::WriteOptions::set_buffer_hint`, so gRPC may send several of them at
+/// once, until the total size of the buffered messages reaches
+/// `max_buffered_bytes` or `max_delay` passes since the first of them.
+///
+/// The thresholds are checked on writes, the buffered messages are also sent
+/// on finishing the stream. A stream that pauses between messages (e.g.
+/// an event subscription) delays the buffered messages until the next write,
+/// so it should not enable buffering.
+struct WriteBufferingSettings final {
+  /// The buffered messages are sent as soon as their size reaches the limit
+  std::size_t max_buffered_bytes{64 * 1024};
+
+  /// The buffered messages are sent at the first write after the delay
+  std::chrono::milliseconds max_delay{5};
+};
+
+namespace impl {
+
+class WriteBuffering final {
+ public:
+  void Enable(const WriteBufferingSettings& settings) noexcept;
+
+  /// Returns the options of the next write of the stream
+  template <typename Message>
+  grpc::WriteOptions MakeWriteOptions(const Message& message) {
+    if (!settings_) return {};
+    return MakeBufferedWriteOptions(ugrpc::impl::GetMessageSize(message));
+  }
+
+ private:
+  grpc::WriteOptions MakeBufferedWriteOptions(
+      std::size_t message_size) noexcept;
+
+  std::optional<WriteBufferingSettings> settings_;
+  std::size_t buffered_bytes_{0};
+  std::chrono::steady_clock::time_point first_buffered_time_{};
+};
+
+}  // namespace impl
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -57,6 +57,14 @@ class ServiceBase {
     return client_factory_->MakeClient<Client>("test", *endpoint_);
   }
 
+  /// @returns a client for the specified gRPC service, connected to the server
+  /// through the in-process transport.
+  template <typename Client>
+  Client MakeInProcessClient() {
+    return client_factory_->MakeClient<Client>(
+        "test", std::string{client::kInProcessEndpoint});
+  }
+
   /// @returns the stored @ref server::Server for advanced tweaking.
   server::Server& GetServer() noexcept;
 
@@ -1,5 +1,7 @@
 #include <userver/ugrpc/byte_buffer_utils.hpp>
 
+#include <utility>
+
 #include <fmt/format.h>
 #include <grpcpp/support/proto_buffer_reader.h>
 #include <grpcpp/support/proto_buffer_writer.h>
@@ -35,6 +37,13 @@ bool ParseFromByteBuffer(grpc::ByteBuffer&& buffer,
   return message.ParseFromZeroCopyStream(&reader);
 }
 
+bool ParseFromByteBuffer(const grpc::ByteBuffer& buffer,
+                         ::google::protobuf::Message& message) {
+  // The copy only references the slices of the buffer
+  grpc::ByteBuffer shared_buffer{buffer};
+  return ParseFromByteBuffer(std::move(shared_buffer), message);
+}
+
 }  // namespace ugrpc
 
 USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <stdexcept>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -26,13 +27,25 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
                              utils::statistics::Storage& statistics_storage,
                              testsuite::GrpcControl& testsuite_grpc,
                              dynamic_config::Source source)
+    : ClientFactory(std::move(settings), channel_task_processor,
+                    std::move(mws), ugrpc::impl::CompletionQueues{{&queue}},
+                    statistics_storage, testsuite_grpc, source) {}
+
+ClientFactory::ClientFactory(ClientFactorySettings&& settings,
+                             engine::TaskProcessor& channel_task_processor,
+                             MiddlewareFactories mws,
+                             const ugrpc::impl::CompletionQueues& queues,
+                             utils::statistics::Storage& statistics_storage,
+                             testsuite::GrpcControl& testsuite_grpc,
+                             dynamic_config::Source source)
     : channel_task_processor_(channel_task_processor),
       mws_(mws),
-      queue_(queue),
+      queues_(queues),
       channel_cache_(testsuite_grpc.IsTlsEnabled()
                          ? settings.credentials
                          : grpc::InsecureChannelCredentials(),
-                     settings.channel_args, settings.channel_count),
+                     settings.channel_args, settings.channel_count,
+                     settings.in_process_channel_factory),
       client_statistics_storage_(statistics_storage,
                                  ugrpc::impl::StatisticsDomain::kClient),
       config_source_(source),
@@ -46,7 +59,8 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
         std::make_unique<impl::ChannelCache>(
             testsuite_grpc.IsTlsEnabled() ? creds
                                           : grpc::InsecureChannelCredentials(),
-            settings.channel_args, settings.channel_count));
+            settings.channel_args, settings.channel_count,
+            settings.in_process_channel_factory));
   }
 }
 
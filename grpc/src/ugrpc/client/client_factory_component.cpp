@@ -37,13 +37,18 @@ ClientFactoryComponent::ClientFactoryComponent(
   auto& task_processor =
       context.GetTaskProcessor(config["task-processor"].As<std::string>());
 
-  grpc::CompletionQueue* queue = nullptr;
+  ugrpc::impl::CompletionQueues queues;
+  impl::InProcessChannelFactory in_process_channel_factory;
   if (auto* const server =
           context.FindComponentOptional<ugrpc::server::ServerComponent>()) {
-    queue = &server->GetServer().GetCompletionQueue();
+    queues = server->GetServer().GetCompletionQueues();
+    in_process_channel_factory =
+        [&server = server->GetServer()](const grpc::ChannelArguments& args) {
+          return server.MakeInProcessChannel(args);
+        };
   } else {
-    queue_.emplace();
-    queue = &queue_->GetQueue();
+    queues_.emplace(config["completion-queue-count"].As<std::size_t>(1));
+    for (auto& queue : *queues_) queues.queues.push_back(&queue.GetQueue());
   }
 
   auto& statistics_storage =
@@ -64,9 +69,10 @@ ClientFactoryComponent::ClientFactoryComponent(
   auto factory_config = config.As<impl::ClientFactoryConfig>();
 
   const auto* secdist = GetSecdist(context);
-  factory_.emplace(MakeFactorySettings(std::move(factory_config), secdist),
-                   task_processor, mws, *queue, statistics_storage,
-                   testsuite_grpc, config_source);
+  auto settings = MakeFactorySettings(std::move(factory_config), secdist);
+  settings.in_process_channel_factory = std::move(in_process_channel_factory);
+  factory_.emplace(std::move(settings), task_processor, mws, queues,
+                   statistics_storage, testsuite_grpc, config_source);
 }
 
 ClientFactory& ClientFactoryComponent::GetFactory() { return *factory_; }
@@ -119,6 +125,14 @@ properties:
         description: |
             Number of channels created for each endpoint.
         defaultDescription: 1
+    completion-queue-count:
+        type: integer
+        description: |
+            Number of completion queues for the RPCs of the clients, each
+            queue is polled by its own thread. Used only if there is no gRPC
+            server component, otherwise the queues of the server are used.
+        defaultDescription: 1
+        minimum: 1
     middlewares:
         type: array
         items:
@@ -28,12 +28,14 @@ client::UnaryCall<grpc::ByteBuffer> GenericClient::UnaryCall(
     std::string_view call_name, const grpc::ByteBuffer& request,
     std::unique_ptr<grpc::ClientContext> context,
     const GenericOptions& generic_options) const {
-  auto& stub = impl_.NextStub<GenericStubService>();
+  auto chosen_stub = impl_.NextStub<GenericStubService>();
+  auto& stub = chosen_stub.stub;
   auto grpcpp_call_name = utils::StrCat<grpc::string>("/", call_name);
   return {
       impl::CreateGenericCallParams(impl_, call_name, std::move(context),
                                     generic_options.qos,
-                                    generic_options.metrics_call_name),
+                                    generic_options.metrics_call_name,
+                                    std::move(chosen_stub.load)),
       [&stub, &grpcpp_call_name](grpc::ClientContext* context,
                                  const grpc::ByteBuffer& request,
                                  grpc::CompletionQueue* cq) {
@@ -34,9 +34,9 @@ void SetupSpan(std::optional<tracing::InPlaceSpan>& span_holder,
   span.DetachFromCoroStack();
 
   context.AddMetadata(ugrpc::impl::kXYaTraceId,
-                      ugrpc::impl::ToGrpcString(span.GetTraceId()));
+                      ugrpc::impl::ToGrpcString(span.GetTraceIdView()));
   context.AddMetadata(ugrpc::impl::kXYaSpanId,
-                      ugrpc::impl::ToGrpcString(span.GetSpanId()));
+                      ugrpc::impl::ToGrpcString(span.GetSpanIdView()));
   context.AddMetadata(ugrpc::impl::kXYaRequestId,
                       ugrpc::impl::ToGrpcString(span.GetLink()));
 }
@@ -93,7 +93,9 @@ RpcData::RpcData(impl::CallParams&& params)
       stats_scope_(params.statistics),
       queue_(params.queue),
       config_values_(params.config),
-      mws_(params.mws) {
+      mws_(params.mws),
+      channel_load_(std::move(params.channel_load)),
+      compression_(std::move(params.compression)) {
   UASSERT(context_);
   UASSERT(!client_name_.empty());
   SetupSpan(span_, *context_, call_name_.Get());
@@ -134,6 +136,11 @@ const Middlewares& RpcData::GetMiddlewares() const noexcept {
   return mws_;
 }
 
+const std::optional<CompressionSettings>& RpcData::GetCompression()
+    const noexcept {
+  return compression_;
+}
+
 std::string_view RpcData::GetCallName() const noexcept {
   UASSERT(context_);
   return call_name_.Get();
@@ -257,6 +264,14 @@ void CheckOk(RpcData& data, AsyncMethodInvocation::WaitStatus status,
   }
 }
 
+void SetupCompression(RpcData& data) {
+  const auto& compression = data.GetCompression();
+  // gRPC clients do not support compression levels
+  if (compression && compression->algorithm) {
+    data.GetContext().set_compression_algorithm(*compression->algorithm);
+  }
+}
+
 void PrepareFinish(RpcData& data) {
   UINVARIANT(!data.IsFinished(), "'Finish' called on a finished call");
   data.SetFinished();
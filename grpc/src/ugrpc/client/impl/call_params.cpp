@@ -25,7 +25,7 @@ CallParams CreateCallParams(const ClientData& client_data,
                             std::size_t method_id,
                             std::unique_ptr<grpc::ClientContext> client_context,
                             const dynamic_config::Key<ClientQos>& client_qos,
-                            const Qos& qos) {
+                            const Qos& qos, ChannelLoadScope&& channel_load) {
   const auto& metadata = client_data.GetMetadata();
   const auto call_name = metadata.method_full_names[method_id];
   const auto method_name =
@@ -37,8 +37,8 @@ CallParams CreateCallParams(const ClientData& client_data,
   ApplyQos(*client_context, qos, client_data.GetTestsuiteControl());
 
   // If user qos was empty update timeout from config
-  ApplyQos(*client_context, config[client_qos][method_name],
-           client_data.GetTestsuiteControl());
+  const auto& config_qos = config[client_qos][method_name];
+  ApplyQos(*client_context, config_qos, client_data.GetTestsuiteControl());
 
   return CallParams{
       client_data.GetClientName(),  //
@@ -48,13 +48,16 @@ CallParams CreateCallParams(const ClientData& client_data,
       std::move(client_context),
       client_data.GetStatistics(method_id),
       client_data.GetMiddlewares(),
+      std::move(channel_load),
+      qos.compression ? qos.compression : config_qos.compression,
   };
 }
 
 CallParams CreateGenericCallParams(
     const ClientData& client_data, std::string_view call_name,
     std::unique_ptr<grpc::ClientContext> client_context, const Qos& qos,
-    std::optional<std::string_view> metrics_call_name) {
+    std::optional<std::string_view> metrics_call_name,
+    ChannelLoadScope&& channel_load) {
   CheckValidCallName(call_name);
   if (metrics_call_name) {
     CheckValidCallName(*metrics_call_name);
@@ -71,6 +74,8 @@ CallParams CreateGenericCallParams(
       std::move(client_context),
       client_data.GetGenericStatistics(metrics_call_name.value_or(call_name)),
       client_data.GetMiddlewares(),
+      std::move(channel_load),
+      qos.compression,
   };
 }
 
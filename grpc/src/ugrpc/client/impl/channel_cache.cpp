@@ -7,6 +7,7 @@
 #include <grpcpp/security/credentials.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
 #include <ugrpc/impl/to_string.hpp>
 
@@ -14,6 +15,25 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
+ChannelLoadScope::ChannelLoadScope(
+    std::atomic<std::uint64_t>& in_flight) noexcept
+    : in_flight_(&in_flight) {
+  in_flight_->fetch_add(1, std::memory_order_relaxed);
+}
+
+ChannelLoadScope::ChannelLoadScope(ChannelLoadScope&& other) noexcept
+    : in_flight_(std::exchange(other.in_flight_, nullptr)) {}
+
+ChannelLoadScope& ChannelLoadScope::operator=(
+    ChannelLoadScope&& other) noexcept {
+  std::swap(in_flight_, other.in_flight_);
+  return *this;
+}
+
+ChannelLoadScope::~ChannelLoadScope() {
+  if (in_flight_) in_flight_->fetch_sub(1, std::memory_order_relaxed);
+}
+
 ChannelCache::Token::Token(ChannelCache& cache, const std::string& endpoint,
                            CountedChannel& counted_channel) noexcept
     : cache_(&cache), endpoint_(&endpoint), counted_channel_(&counted_channel) {
@@ -55,24 +75,71 @@ std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
   return counted_channel_->channels.size();
 }
 
+std::size_t ChannelCache::Token::GetLeastLoadedChannel() const noexcept {
+  UASSERT(counted_channel_);
+  const auto& in_flight = counted_channel_->in_flight;
+  const auto count = in_flight.size();
+  if (count == 1) return 0;
+
+  // Starting from a random channel spreads the RPCs of an idle pool
+  const auto start = utils::RandRange(count);
+  auto best = start;
+  auto best_load = in_flight[start].load(std::memory_order_relaxed);
+  for (std::size_t i = 1; i < count && best_load != 0; ++i) {
+    const auto index = (start + i) % count;
+    const auto load = in_flight[index].load(std::memory_order_relaxed);
+    if (load < best_load) {
+      best = index;
+      best_load = load;
+    }
+  }
+  return best;
+}
+
+ChannelLoadScope ChannelCache::Token::MakeLoadScope(
+    std::size_t index) const noexcept {
+  UASSERT(counted_channel_);
+  UASSERT(index < counted_channel_->in_flight.size());
+  return ChannelLoadScope{counted_channel_->in_flight[index]};
+}
+
+std::uint64_t ChannelCache::Token::GetInFlightCount(
+    std::size_t index) const noexcept {
+  UASSERT(counted_channel_);
+  UASSERT(index < counted_channel_->in_flight.size());
+  return counted_channel_->in_flight[index].load(std::memory_order_relaxed);
+}
+
 ChannelCache::CountedChannel::CountedChannel(
     const std::string& endpoint,
     const std::shared_ptr<grpc::ChannelCredentials>& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t count) {
-  const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
-  channels = utils::GenerateFixedArray(count, [&](std::size_t) {
-    return grpc::CreateCustomChannel(endpoint_string, credentials,
-                                     channel_args);
-  });
+    const grpc::ChannelArguments& channel_args, std::size_t count,
+    const InProcessChannelFactory& in_process_factory)
+    : in_flight(count, 0) {
+  if (endpoint == kInProcessEndpoint) {
+    UINVARIANT(in_process_factory,
+               "In-process channels require a gRPC server in the same "
+               "ClientFactory setup");
+    channels = utils::GenerateFixedArray(
+        count, [&](std::size_t) { return in_process_factory(channel_args); });
+  } else {
+    const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
+    channels = utils::GenerateFixedArray(count, [&](std::size_t) {
+      return grpc::CreateCustomChannel(endpoint_string, credentials,
+                                       channel_args);
+    });
+  }
   UASSERT(count > 0);
 }
 
 ChannelCache::ChannelCache(
     std::shared_ptr<grpc::ChannelCredentials>&& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t channel_count)
+    const grpc::ChannelArguments& channel_args, std::size_t channel_count,
+    InProcessChannelFactory in_process_factory)
     : credentials_(std::move(credentials)),
       channel_args_(channel_args),
-      channel_count_(channel_count) {
+      channel_count_(channel_count),
+      in_process_factory_(std::move(in_process_factory)) {
   UINVARIANT(channel_count > 0, "Channels count must be greater than zero");
 }
 
@@ -80,8 +147,9 @@ ChannelCache::~ChannelCache() = default;
 
 ChannelCache::Token ChannelCache::Get(const std::string& endpoint) {
   auto channels = channels_.Lock();
-  const auto [it, _] = channels->try_emplace(endpoint, endpoint, credentials_,
-                                             channel_args_, channel_count_);
+  const auto [it, _] =
+      channels->try_emplace(endpoint, endpoint, credentials_, channel_args_,
+                            channel_count_, in_process_factory_);
   return {*this, it->first, it->second};
 }
 
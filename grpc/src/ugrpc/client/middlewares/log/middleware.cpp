@@ -1,6 +1,6 @@
 #include "middleware.hpp"
 
-#include <userver/utils/log.hpp>
+#include <ugrpc/impl/protobuf_utils.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -12,10 +12,8 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
   const auto* request = context.GetInitialRequest();
   if (request) {
     LOG(settings_.log_level)
-        << "gRPC message: " << [request, this]() -> std::string {
-      const auto& str = request->Utf8DebugString();
-      return utils::log::ToLimitedUtf8(str, settings_.max_msg_size);
-    }();
+        << "gRPC message: "
+        << ugrpc::impl::ToLimitedDebugString(*request, settings_.max_msg_size);
   }
   context.Next();
 }
@@ -20,6 +20,8 @@ Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>) {
   if (ms) {
     result.timeout = std::chrono::milliseconds{*ms};
   }
+  result.compression =
+      value["compression"].As<std::optional<CompressionSettings>>();
   return result;
 }
 
@@ -27,6 +29,7 @@ formats::json::Value Serialize(const Qos& qos,
                                formats::serialize::To<formats::json::Value>) {
   formats::json::ValueBuilder result{formats::common::Type::kObject};
   result["timeout-ms"] = qos.timeout;
+  result["compression"] = qos.compression;
   return result.ExtractValue();
 }
 
@@ -0,0 +1,72 @@
+#include <userver/ugrpc/compression.hpp>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace {
+
+constexpr utils::TrivialBiMap kAlgorithmMap([](auto selector) {
+  return selector()
+      .template Type<grpc_compression_algorithm, std::string_view>()
+      .Case(GRPC_COMPRESS_NONE, "none")
+      .Case(GRPC_COMPRESS_DEFLATE, "deflate")
+      .Case(GRPC_COMPRESS_GZIP, "gzip");
+});
+
+constexpr utils::TrivialBiMap kLevelMap([](auto selector) {
+  return selector()
+      .template Type<grpc_compression_level, std::string_view>()
+      .Case(GRPC_COMPRESS_LEVEL_NONE, "none")
+      .Case(GRPC_COMPRESS_LEVEL_LOW, "low")
+      .Case(GRPC_COMPRESS_LEVEL_MED, "medium")
+      .Case(GRPC_COMPRESS_LEVEL_HIGH, "high");
+});
+
+}  // namespace
+
+bool operator==(const CompressionSettings& lhs,
+                const CompressionSettings& rhs) noexcept {
+  return lhs.algorithm == rhs.algorithm && lhs.level == rhs.level &&
+         lhs.min_message_size == rhs.min_message_size;
+}
+
+CompressionSettings Parse(const formats::json::Value& value,
+                          formats::parse::To<CompressionSettings>) {
+  CompressionSettings result;
+  if (!value["algorithm"].IsMissing()) {
+    result.algorithm =
+        utils::ParseFromValueString(value["algorithm"], kAlgorithmMap);
+  }
+  if (!value["level"].IsMissing()) {
+    result.level = utils::ParseFromValueString(value["level"], kLevelMap);
+  }
+  result.min_message_size =
+      value["min-message-size"].As<std::size_t>(result.min_message_size);
+  return result;
+}
+
+formats::json::Value Serialize(const CompressionSettings& settings,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder result{formats::common::Type::kObject};
+  if (settings.algorithm) {
+    result["algorithm"] = std::string{
+        utils::impl::EnumToStringView(*settings.algorithm, kAlgorithmMap)};
+  }
+  if (settings.level) {
+    result["level"] = std::string{
+        utils::impl::EnumToStringView(*settings.level, kLevelMap)};
+  }
+  result["min-message-size"] = settings.min_message_size;
+  return result.ExtractValue();
+}
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,32 @@
+#include <userver/ugrpc/impl/completion_queues.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+namespace {
+
+std::size_t GetCurrentThreadIndex() noexcept {
+  static std::atomic<std::size_t> next_thread_index{0};
+  thread_local const std::size_t thread_index =
+      next_thread_index.fetch_add(1, std::memory_order_relaxed);
+  return thread_index;
+}
+
+}  // namespace
+
+grpc::CompletionQueue& GetQueueForCurrentThread(
+    const CompletionQueues& queues) noexcept {
+  UASSERT(!queues.queues.empty());
+  if (queues.queues.size() == 1) return *queues.queues.front();
+  return *queues.queues[GetCurrentThreadIndex() % queues.queues.size()];
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
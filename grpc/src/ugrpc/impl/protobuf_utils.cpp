@@ -0,0 +1,80 @@
+#include <ugrpc/impl/protobuf_utils.hpp>
+
+#include <algorithm>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/text_format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/log.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+namespace {
+
+constexpr std::size_t kMinBlockSize = 64;
+
+// Writes into the string until it reaches the limit, then fails the writes,
+// which makes TextFormat::Printer stop producing the text
+class LimitedStringOutputStream final
+    : public google::protobuf::io::ZeroCopyOutputStream {
+ public:
+  LimitedStringOutputStream(std::string& output, std::size_t limit)
+      : output_(output), limit_(limit) {}
+
+  bool Next(void** data, int* size) override {
+    const auto old_size = output_.size();
+    if (old_size >= limit_) return false;
+
+    const auto new_size =
+        std::min(limit_, std::max(old_size * 2, kMinBlockSize));
+    output_.resize(new_size);
+    *data = output_.data() + old_size;
+    *size = static_cast<int>(new_size - old_size);
+    return true;
+  }
+
+  void BackUp(int count) override {
+    UASSERT(count >= 0 && static_cast<std::size_t>(count) <= output_.size());
+    output_.resize(output_.size() - static_cast<std::size_t>(count));
+  }
+
+  google::protobuf::int64 ByteCount() const override {
+    return static_cast<google::protobuf::int64>(output_.size());
+  }
+
+ private:
+  std::string& output_;
+  const std::size_t limit_;
+};
+
+}  // namespace
+
+std::string ToLimitedDebugString(const google::protobuf::Message& message,
+                                 std::size_t limit) {
+  google::protobuf::TextFormat::Printer printer;
+  printer.SetUseUtf8StringEscaping(true);
+
+  // One extra byte tells whether the text was truncated
+  std::string result;
+  {
+    LimitedStringOutputStream stream{result, limit + 1};
+    printer.Print(message, &stream);
+  }
+  if (result.size() <= limit) return utils::log::ToLimitedUtf8(result, limit);
+
+  // The total size is unknown as the formatting has been stopped
+  std::string_view view{result.data(), limit};
+  utils::text::utf8::TrimViewTruncatedEnding(view);
+  return fmt::format("{}...(truncated)", view);
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
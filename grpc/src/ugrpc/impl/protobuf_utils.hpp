@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <google/protobuf/message.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+// Same as `utils::log::ToLimitedUtf8(message.Utf8DebugString(), limit)`, but
+// stops writing the text once the limit is reached instead of formatting the
+// whole message
+std::string ToLimitedDebugString(const google::protobuf::Message& message,
+                                 std::size_t limit);
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
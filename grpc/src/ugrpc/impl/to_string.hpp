@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string_view>
 #include <type_traits>
 
 #include <grpcpp/support/config.h>
@@ -25,6 +26,10 @@ inline grpc::string ToGrpcString(grpc::string_ref str) {
   return {str.data(), str.size()};
 }
 
+inline grpc::string ToGrpcString(std::string_view str) {
+  return {str.data(), str.size()};
+}
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,22 @@
 #include <userver/ugrpc/proto_json.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <google/protobuf/descriptor.h>
 #include <grpcpp/support/config.h>
 #include <boost/container/small_vector.hpp>
 
+#include <userver/compiler/thread_local.hpp>
+#include <userver/crypto/base64.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,12 +33,502 @@ const google::protobuf::util::JsonPrintOptions kOptions = []() {
 #endif
   return options;
 }();
+
+using google::protobuf::Descriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+
+struct FieldInfo final {
+  const FieldDescriptor* field;
+  bool has_presence;
+};
+
+/// Everything needed to convert a message of some type, computed once per type
+struct FieldTable final {
+  explicit FieldTable(const Descriptor& descriptor)
+      : is_well_known(descriptor.file()->package() == "google.protobuf") {
+    fields.reserve(descriptor.field_count());
+    for (int i = 0; i < descriptor.field_count(); ++i) {
+      const auto* field = descriptor.field(i);
+      fields.push_back({field, field->has_presence()});
+      by_name.emplace(field->json_name(), field);
+      by_name.emplace(field->name(), field);
+    }
+  }
+
+  // Converted by the protobuf library, as they have special JSON mappings
+  bool is_well_known;
+  std::vector<FieldInfo> fields;
+  utils::impl::TransparentMap<std::string, const FieldDescriptor*> by_name;
+};
+
+class FieldTables final {
+ public:
+  const FieldTable& Get(const Descriptor& descriptor) {
+    // Descriptors of generated messages live till the end of the program,
+    // and the references to the map values survive rehashing.
+    auto it = tables_.find(&descriptor);
+    if (it == tables_.end()) {
+      it = tables_.try_emplace(&descriptor, descriptor).first;
+    }
+    return it->second;
+  }
+
+ private:
+  std::unordered_map<const Descriptor*, FieldTable> tables_;
+};
+
+// Per-thread tables do not need any synchronization on lookups
+compiler::ThreadLocal local_field_tables = [] { return FieldTables{}; };
+
+bool IsNullValue(const FieldDescriptor& field) {
+  return field.cpp_type() == FieldDescriptor::CPPTYPE_ENUM &&
+         field.enum_type()->full_name() == "google.protobuf.NullValue";
+}
+
+bool IsBytes(const FieldDescriptor& field) {
+  return field.type() == FieldDescriptor::TYPE_BYTES;
+}
+
+void WriteDouble(double value, formats::json::StringBuilder& sw) {
+  if (std::isnan(value)) {
+    sw.WriteString("NaN");
+  } else if (std::isinf(value)) {
+    sw.WriteString(value > 0 ? "Infinity" : "-Infinity");
+  } else {
+    sw.WriteDouble(value);
+  }
+}
+
+void WriteFloat(float value, formats::json::StringBuilder& sw) {
+  if (!std::isfinite(value)) {
+    WriteDouble(value, sw);
+    return;
+  }
+  // The shortest representation of float, e.g. `0.1` for 0.1f and not
+  // `0.10000000149011612`
+  sw.WriteDouble(utils::FromString<double>(fmt::format("{}", value)));
+}
+
+void WriteMessage(FieldTables& tables, const Message& message,
+                  formats::json::StringBuilder& sw);
+
+// `index` is ignored for singular fields
+void WriteValue(FieldTables& tables, const Message& message,
+                const FieldDescriptor& field, int index,
+                formats::json::StringBuilder& sw) {
+  const auto& reflection = *message.GetReflection();
+  const bool repeated = field.is_repeated();
+  switch (field.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      sw.WriteInt64(repeated
+                        ? reflection.GetRepeatedInt32(message, &field, index)
+                        : reflection.GetInt32(message, &field));
+      break;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      sw.WriteUInt64(repeated
+                         ? reflection.GetRepeatedUInt32(message, &field, index)
+                         : reflection.GetUInt32(message, &field));
+      break;
+    // 64-bit integers are strings in JSON, as they do not fit into double
+    case FieldDescriptor::CPPTYPE_INT64:
+      sw.WriteString(std::to_string(
+          repeated ? reflection.GetRepeatedInt64(message, &field, index)
+                   : reflection.GetInt64(message, &field)));
+      break;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      sw.WriteString(std::to_string(
+          repeated ? reflection.GetRepeatedUInt64(message, &field, index)
+                   : reflection.GetUInt64(message, &field)));
+      break;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      WriteDouble(repeated
+                      ? reflection.GetRepeatedDouble(message, &field, index)
+                      : reflection.GetDouble(message, &field),
+                  sw);
+      break;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      WriteFloat(repeated ? reflection.GetRepeatedFloat(message, &field, index)
+                          : reflection.GetFloat(message, &field),
+                 sw);
+      break;
+    case FieldDescriptor::CPPTYPE_BOOL:
+      sw.WriteBool(repeated ? reflection.GetRepeatedBool(message, &field, index)
+                            : reflection.GetBool(message, &field));
+      break;
+    case FieldDescriptor::CPPTYPE_ENUM: {
+      if (IsNullValue(field)) {
+        sw.WriteNull();
+        break;
+      }
+      const int number =
+          repeated ? reflection.GetRepeatedEnumValue(message, &field, index)
+                   : reflection.GetEnumValue(message, &field);
+      const auto* value = field.enum_type()->FindValueByNumber(number);
+      if (value) {
+        sw.WriteString(value->name());
+      } else {
+        sw.WriteInt64(number);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_STRING: {
+      std::string scratch;
+      const auto& value =
+          repeated ? reflection.GetRepeatedStringReference(message, &field,
+                                                           index, &scratch)
+                   : reflection.GetStringReference(message, &field, &scratch);
+      if (IsBytes(field)) {
+        sw.WriteString(crypto::base64::Base64Encode(value));
+      } else {
+        sw.WriteString(value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      WriteMessage(tables,
+                   repeated ? reflection.GetRepeatedMessage(message, &field,
+                                                            index)
+                            : reflection.GetMessage(message, &field),
+                   sw);
+      break;
+  }
+}
+
+std::string MapKeyToString(const Message& entry, const FieldDescriptor& key) {
+  const auto& reflection = *entry.GetReflection();
+  switch (key.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      return std::to_string(reflection.GetInt32(entry, &key));
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return std::to_string(reflection.GetUInt32(entry, &key));
+    case FieldDescriptor::CPPTYPE_INT64:
+      return std::to_string(reflection.GetInt64(entry, &key));
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return std::to_string(reflection.GetUInt64(entry, &key));
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return reflection.GetBool(entry, &key) ? "true" : "false";
+    case FieldDescriptor::CPPTYPE_STRING:
+      return reflection.GetString(entry, &key);
+    default:
+      UINVARIANT(false, "Invalid type of a map key");
+  }
+}
+
+void WriteMap(FieldTables& tables, const Message& message,
+              const FieldDescriptor& field, formats::json::StringBuilder& sw) {
+  const auto& reflection = *message.GetReflection();
+  const auto& key = *field.message_type()->map_key();
+  const auto& value = *field.message_type()->map_value();
+
+  const formats::json::StringBuilder::ObjectGuard guard{sw};
+  const int size = reflection.FieldSize(message, &field);
+  for (int i = 0; i < size; ++i) {
+    const auto& entry = reflection.GetRepeatedMessage(message, &field, i);
+    sw.Key(MapKeyToString(entry, key));
+    WriteValue(tables, entry, value, -1, sw);
+  }
+}
+
+void WriteMessage(FieldTables& tables, const Message& message,
+                  formats::json::StringBuilder& sw) {
+  const auto& table = tables.Get(*message.GetDescriptor());
+  if (table.is_well_known) {
+    sw.WriteRawString(ToJsonString(message));
+    return;
+  }
+
+  const auto& reflection = *message.GetReflection();
+  const formats::json::StringBuilder::ObjectGuard guard{sw};
+  for (const auto& [field, has_presence] : table.fields) {
+    if (field->is_map()) {
+      sw.Key(field->json_name());
+      WriteMap(tables, message, *field, sw);
+    } else if (field->is_repeated()) {
+      sw.Key(field->json_name());
+      const formats::json::StringBuilder::ArrayGuard array_guard{sw};
+      const int size = reflection.FieldSize(message, field);
+      for (int i = 0; i < size; ++i) {
+        WriteValue(tables, message, *field, i, sw);
+      }
+    } else if (!has_presence || reflection.HasField(message, field)) {
+      // Fields without presence are written even if they have default values
+      sw.Key(field->json_name());
+      WriteValue(tables, message, *field, -1, sw);
+    }
+  }
+}
+
+[[noreturn]] void ThrowParseError(const formats::json::Value& json,
+                                  std::string_view what) {
+  throw formats::json::Exception(
+      fmt::format("Cannot convert json to protobuf at '{}': {}", json.GetPath(),
+                  what));
+}
+
+template <typename T>
+T ParseNumber(const formats::json::Value& json) {
+  try {
+    if (json.IsString()) return utils::FromString<T>(json.As<std::string>());
+    return json.As<T>();
+  } catch (const std::exception& ex) {
+    ThrowParseError(json, ex.what());
+  }
+}
+
+template <typename T>
+T ParseFloatingPoint(const formats::json::Value& json) {
+  if (json.IsString()) {
+    const auto value = json.As<std::string>();
+    if (value == "NaN") return std::numeric_limits<T>::quiet_NaN();
+    if (value == "Infinity") return std::numeric_limits<T>::infinity();
+    if (value == "-Infinity") return -std::numeric_limits<T>::infinity();
+  }
+  return static_cast<T>(ParseNumber<double>(json));
+}
+
+int ParseEnum(const formats::json::Value& json, const FieldDescriptor& field) {
+  if (IsNullValue(field)) return 0;
+  if (!json.IsString()) return ParseNumber<int>(json);
+
+  const auto name = json.As<std::string>();
+  const auto* value = field.enum_type()->FindValueByName(name);
+  if (!value) {
+    ThrowParseError(json, fmt::format("unknown value '{}' of enum {}", name,
+                                      field.enum_type()->full_name()));
+  }
+  return value->number();
+}
+
+std::string ParseString(const formats::json::Value& json,
+                        const FieldDescriptor& field) {
+  if (!json.IsString()) ThrowParseError(json, "expected a string");
+  auto value = json.As<std::string>();
+  if (!IsBytes(field)) return value;
+
+  try {
+    return crypto::base64::Base64Decode(value);
+  } catch (const std::exception& ex) {
+    ThrowParseError(json, ex.what());
+  }
+}
+
+void ParseMessage(FieldTables& tables, const formats::json::Value& json,
+                  Message& message);
+
+void ParseValue(FieldTables& tables, const formats::json::Value& json,
+                Message& message, const FieldDescriptor& field) {
+  const auto& reflection = *message.GetReflection();
+  const bool repeated = field.is_repeated();
+  switch (field.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32: {
+      const auto value = ParseNumber<std::int32_t>(json);
+      if (repeated) {
+        reflection.AddInt32(&message, &field, value);
+      } else {
+        reflection.SetInt32(&message, &field, value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_UINT32: {
+      const auto value = ParseNumber<std::uint32_t>(json);
+      if (repeated) {
+        reflection.AddUInt32(&message, &field, value);
+      } else {
+        reflection.SetUInt32(&message, &field, value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_INT64: {
+      const auto value = ParseNumber<std::int64_t>(json);
+      if (repeated) {
+        reflection.AddInt64(&message, &field, value);
+      } else {
+        reflection.SetInt64(&message, &field, value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_UINT64: {
+      const auto value = ParseNumber<std::uint64_t>(json);
+      if (repeated) {
+        reflection.AddUInt64(&message, &field, value);
+      } else {
+        reflection.SetUInt64(&message, &field, value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_DOUBLE: {
+      const auto value = ParseFloatingPoint<double>(json);
+      if (repeated) {
+        reflection.AddDouble(&message, &field, value);
+      } else {
+        reflection.SetDouble(&message, &field, value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_FLOAT: {
+      const auto value = ParseFloatingPoint<float>(json);
+      if (repeated) {
+        reflection.AddFloat(&message, &field, value);
+      } else {
+        reflection.SetFloat(&message, &field, value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_BOOL: {
+      if (!json.IsBool()) ThrowParseError(json, "expected a bool");
+      const auto value = json.As<bool>();
+      if (repeated) {
+        reflection.AddBool(&message, &field, value);
+      } else {
+        reflection.SetBool(&message, &field, value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_ENUM: {
+      const auto value = ParseEnum(json, field);
+      if (repeated) {
+        reflection.AddEnumValue(&message, &field, value);
+      } else {
+        reflection.SetEnumValue(&message, &field, value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_STRING: {
+      auto value = ParseString(json, field);
+      if (repeated) {
+        reflection.AddString(&message, &field, std::move(value));
+      } else {
+        reflection.SetString(&message, &field, std::move(value));
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      ParseMessage(tables, json,
+                   repeated ? *reflection.AddMessage(&message, &field)
+                            : *reflection.MutableMessage(&message, &field));
+      break;
+  }
+}
+
+void ParseMapKey(const formats::json::Value& json, std::string_view name,
+                 Message& entry, const FieldDescriptor& key) {
+  const auto& reflection = *entry.GetReflection();
+  try {
+    switch (key.cpp_type()) {
+      case FieldDescriptor::CPPTYPE_INT32:
+        reflection.SetInt32(&entry, &key,
+                            utils::FromString<std::int32_t>(name));
+        break;
+      case FieldDescriptor::CPPTYPE_UINT32:
+        reflection.SetUInt32(&entry, &key,
+                             utils::FromString<std::uint32_t>(name));
+        break;
+      case FieldDescriptor::CPPTYPE_INT64:
+        reflection.SetInt64(&entry, &key,
+                            utils::FromString<std::int64_t>(name));
+        break;
+      case FieldDescriptor::CPPTYPE_UINT64:
+        reflection.SetUInt64(&entry, &key,
+                             utils::FromString<std::uint64_t>(name));
+        break;
+      case FieldDescriptor::CPPTYPE_BOOL:
+        if (name != "true" && name != "false") {
+          ThrowParseError(json, fmt::format("invalid bool key '{}'", name));
+        }
+        reflection.SetBool(&entry, &key, name == "true");
+        break;
+      case FieldDescriptor::CPPTYPE_STRING:
+        reflection.SetString(&entry, &key, std::string{name});
+        break;
+      default:
+        UINVARIANT(false, "Invalid type of a map key");
+    }
+  } catch (const formats::json::Exception&) {
+    throw;
+  } catch (const std::exception& ex) {
+    ThrowParseError(json, ex.what());
+  }
+}
+
+void ParseMap(FieldTables& tables, const formats::json::Value& json,
+              Message& message, const FieldDescriptor& field) {
+  if (!json.IsObject()) ThrowParseError(json, "expected an object");
+  const auto& reflection = *message.GetReflection();
+  const auto& key = *field.message_type()->map_key();
+  const auto& value = *field.message_type()->map_value();
+
+  for (auto it = json.begin(); it != json.end(); ++it) {
+    auto& entry = *reflection.AddMessage(&message, &field);
+    ParseMapKey(*it, it.GetName(), entry, key);
+    ParseValue(tables, *it, entry, value);
+  }
+}
+
+void ParseWellKnown(const formats::json::Value& json, Message& message) {
+  const auto status = google::protobuf::util::JsonStringToMessage(
+      formats::json::ToString(json), &message);
+  if (!status.ok()) ThrowParseError(json, std::string{status.message()});
+}
+
+void ParseMessage(FieldTables& tables, const formats::json::Value& json,
+                  Message& message) {
+  const auto& table = tables.Get(*message.GetDescriptor());
+  if (table.is_well_known) {
+    ParseWellKnown(json, message);
+    return;
+  }
+  if (!json.IsObject()) ThrowParseError(json, "expected an object");
+
+  for (auto it = json.begin(); it != json.end(); ++it) {
+    const auto name = it.GetName();
+    const auto* const* field =
+        utils::impl::FindTransparentOrNullptr(table.by_name, name);
+    if (!field) {
+      ThrowParseError(json, fmt::format("unknown field '{}' of {}", name,
+                                        message.GetTypeName()));
+    }
+
+    const auto& value = *it;
+    // null means the default value, except for google.protobuf.Value
+    if (value.IsNull() && !IsNullValue(**field) &&
+        !((*field)->message_type() &&
+          (*field)->message_type()->full_name() == "google.protobuf.Value")) {
+      continue;
+    }
+
+    if ((*field)->is_map()) {
+      ParseMap(tables, value, message, **field);
+    } else if ((*field)->is_repeated()) {
+      if (!value.IsArray()) ThrowParseError(value, "expected an array");
+      for (const auto& item : value) {
+        ParseValue(tables, item, message, **field);
+      }
+    } else {
+      ParseValue(tables, value, message, **field);
+    }
+  }
+}
+
 }  // namespace
 
 formats::json::Value MessageToJson(const google::protobuf::Message& message) {
   return formats::json::FromString(ToJsonString(message));
 }
 
+void MessageToJson(const google::protobuf::Message& message,
+                   formats::json::StringBuilder& sw) {
+  auto tables = local_field_tables.Use();
+  WriteMessage(*tables, message, sw);
+}
+
+void JsonToMessage(const formats::json::Value& json,
+                   google::protobuf::Message& message) {
+  auto tables = local_field_tables.Use();
+  ParseMessage(*tables, json, message);
+}
+
 std::string ToString(const google::protobuf::Message& message) {
   return message.DebugString();
 }
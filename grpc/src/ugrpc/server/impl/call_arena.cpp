@@ -0,0 +1,77 @@
+#include <userver/ugrpc/server/impl/call_arena.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+namespace {
+
+// Blocks freed on a thread are reused by the calls that start on it. The
+// number of cached blocks is bounded, as calls may migrate between threads.
+constexpr std::size_t kMaxCachedBlocks = 16;
+
+class ArenaBlockCache final {
+ public:
+  std::unique_ptr<char[]> Acquire(std::size_t block_size) {
+    if (block_size != block_size_) {
+      blocks_.clear();
+      block_size_ = block_size;
+    }
+    if (blocks_.empty()) return std::unique_ptr<char[]>(new char[block_size]);
+
+    auto block = std::move(blocks_.back());
+    blocks_.pop_back();
+    return block;
+  }
+
+  void Release(std::unique_ptr<char[]>&& block, std::size_t block_size) {
+    if (block_size != block_size_ || blocks_.size() >= kMaxCachedBlocks) {
+      return;
+    }
+    blocks_.push_back(std::move(block));
+  }
+
+ private:
+  std::size_t block_size_{0};
+  std::vector<std::unique_ptr<char[]>> blocks_;
+};
+
+ArenaBlockCache& GetBlockCache() {
+  thread_local ArenaBlockCache cache;
+  return cache;
+}
+
+google::protobuf::ArenaOptions MakeArenaOptions(std::size_t initial_block_size,
+                                                char* initial_block) {
+  google::protobuf::ArenaOptions options;
+  options.initial_block = initial_block;
+  options.initial_block_size = initial_block_size;
+  options.start_block_size = initial_block_size;
+  options.max_block_size = std::max(options.max_block_size, initial_block_size);
+  return options;
+}
+
+}  // namespace
+
+CallArena::CallArena(std::size_t initial_block_size)
+    : initial_block_size_(initial_block_size) {
+  if (initial_block_size_ == 0) return;
+
+  initial_block_ = GetBlockCache().Acquire(initial_block_size_);
+  arena_.emplace(MakeArenaOptions(initial_block_size_, initial_block_.get()));
+}
+
+CallArena::~CallArena() {
+  if (!arena_) return;
+
+  arena_.reset();
+  GetBlockCache().Release(std::move(initial_block_), initial_block_size_);
+}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
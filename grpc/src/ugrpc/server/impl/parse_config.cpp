@@ -103,6 +103,8 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value,
   config.native_log_level =
       value["native-log-level"].As<logging::Level>(logging::Level::kError);
   config.enable_channelz = value["enable-channelz"].As<bool>(false);
+  config.message_arena_initial_block_size =
+      value["message-arena-initial-block-size"].As<std::size_t>(0);
 
   const auto logger_name = value["access-tskv-logger"];
   if (!logger_name.IsMissing()) {
@@ -9,6 +9,10 @@ namespace ugrpc::server::impl {
 const dynamic_config::Key<bool> kServerCancelTaskByDeadline{
     "USERVER_GRPC_SERVER_CANCEL_TASK_BY_DEADLINE", true};
 
+const dynamic_config::Key<ServerCompression> kServerCompression{
+    "USERVER_GRPC_SERVER_COMPRESSION",
+    dynamic_config::DefaultAsJsonString{"{}"}};
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/value.hpp>
+#include <userver/ugrpc/compression.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -8,6 +10,11 @@ namespace ugrpc::server::impl {
 
 extern const dynamic_config::Key<bool> kServerCancelTaskByDeadline;
 
+/// Compression of the responses by the call name
+using ServerCompression = dynamic_config::ValueDict<CompressionSettings>;
+
+extern const dynamic_config::Key<ServerCompression> kServerCompression;
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -93,9 +93,9 @@ void SetupSpan(std::optional<tracing::InPlaceSpan>& span_holder,
   }
 
   context.AddInitialMetadata(ugrpc::impl::kXYaTraceId,
-                             ugrpc::impl::ToGrpcString(span.GetTraceId()));
+                             ugrpc::impl::ToGrpcString(span.GetTraceIdView()));
   context.AddInitialMetadata(ugrpc::impl::kXYaSpanId,
-                             ugrpc::impl::ToGrpcString(span.GetSpanId()));
+                             ugrpc::impl::ToGrpcString(span.GetSpanIdView()));
   context.AddInitialMetadata(ugrpc::impl::kXYaRequestId,
                              ugrpc::impl::ToGrpcString(span.GetLink()));
 }
@@ -115,6 +115,11 @@ void ParseGenericCallName(std::string_view generic_call_name,
   method_name = generic_call_name.substr(slash_pos + 1);
 }
 
+std::optional<CompressionSettings> GetCompression(
+    const dynamic_config::Snapshot& config, std::string_view call_name) {
+  return config[kServerCompression].GetOptional(call_name);
+}
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#include <userver/ugrpc/server/write_buffering.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+void WriteBuffering::Enable(const WriteBufferingSettings& settings) noexcept {
+  settings_.emplace(settings);
+}
+
+grpc::WriteOptions WriteBuffering::MakeBufferedWriteOptions(
+    std::size_t message_size) noexcept {
+  UASSERT(settings_);
+  grpc::WriteOptions options{};
+
+  const auto now = std::chrono::steady_clock::now();
+  if (buffered_bytes_ == 0) first_buffered_time_ = now;
+  buffered_bytes_ += message_size;
+
+  if (buffered_bytes_ >= settings_->max_buffered_bytes ||
+      now - first_buffered_time_ >= settings_->max_delay) {
+    // The message is written without the hint, which sends all the buffered
+    // messages along with it
+    buffered_bytes_ = 0;
+  } else {
+    options.set_buffer_hint();
+  }
+  return options;
+}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
@@ -11,10 +11,27 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::middlewares::congestion_control {
 
+namespace {
+
+MethodsSettings ParseMethodsSettings(const yaml_config::YamlConfig& methods) {
+  MethodsSettings result;
+  for (const auto& [call_name, value] : Items(methods)) {
+    MethodSettings settings;
+    settings.max_concurrent_calls =
+        value["max-concurrent-calls"].As<std::size_t>(0);
+    settings.reject_by_deadline = value["reject-by-deadline"].As<bool>(false);
+    result.emplace(call_name, settings);
+  }
+  return result;
+}
+
+}  // namespace
+
 Component::Component(const components::ComponentConfig& config,
                      const components::ComponentContext& context)
     : MiddlewareComponentBase(config, context),
-      middleware_(std::make_shared<Middleware>()) {
+      middleware_(std::make_shared<Middleware>(
+          ParseMethodsSettings(config["methods"]))) {
   auto& cc_component =
       context.FindComponent<USERVER_NAMESPACE::congestion_control::Component>();
 
@@ -35,7 +52,32 @@ yaml_config::Schema Component::GetStaticConfigSchema() {
 type: object
 description: gRPC service congestion control middleware component
 additionalProperties: false
-properties: {}
+properties:
+    methods:
+        type: object
+        description: |
+            per-method admission settings, the keys are the full call names,
+            e.g. 'sample.ugrpc.UnitTestService/SayHello'
+        defaultDescription: '{}'
+        additionalProperties:
+            type: object
+            description: admission settings of the method
+            additionalProperties: false
+            properties:
+                max-concurrent-calls:
+                    type: integer
+                    description: |
+                        calls above the limit are rejected with
+                        RESOURCE_EXHAUSTED, 0 for no limit
+                    defaultDescription: 0
+                    minimum: 0
+                reject-by-deadline:
+                    type: boolean
+                    description: |
+                        reject the calls with the remaining deadline shorter
+                        than the median duration of the calls of the method
+                    defaultDescription: false
+        properties: {}
 )");
 }
 
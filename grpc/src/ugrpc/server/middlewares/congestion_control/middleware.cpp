@@ -1,5 +1,10 @@
 #include "middleware.hpp"
 
+#include <algorithm>
+
+#include <userver/ugrpc/impl/deadline_timepoint.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::middlewares::congestion_control {
@@ -21,8 +26,43 @@ bool CheckRatelimit(utils::TokenBucket& rate_limit,
   return false;
 }
 
+void Reject(CallAnyBase& call, const char* reason) {
+  LOG_LIMITED_WARNING() << "Request rejected (congestion control, " << reason
+                        << "), service/method=" << call.GetCallName();
+  call.FinishWithError(
+      grpc::Status{grpc::StatusCode::RESOURCE_EXHAUSTED,
+                   std::string{"Congestion control: "} + reason});
+}
+
 }  // namespace
 
+std::chrono::microseconds DurationMedian::Get() const noexcept {
+  return std::chrono::microseconds{median_us_.load(std::memory_order_relaxed)};
+}
+
+void DurationMedian::Account(std::chrono::microseconds duration) noexcept {
+  const auto sample = std::max<std::int64_t>(duration.count(), 1);
+  // Concurrent updates may be lost, that only slows down the convergence
+  auto median = median_us_.load(std::memory_order_relaxed);
+  if (median == 0) {
+    median = sample;
+  } else {
+    const auto step = std::max<std::int64_t>(median / 32, 1);
+    if (sample > median) {
+      median += step;
+    } else if (sample < median) {
+      median = std::max<std::int64_t>(median - step, 1);
+    }
+  }
+  median_us_.store(median, std::memory_order_relaxed);
+}
+
+Middleware::Middleware(const MethodsSettings& methods) {
+  for (const auto& [call_name, settings] : methods) {
+    methods_.try_emplace(call_name, settings);
+  }
+}
+
 void Middleware::SetLimit(std::optional<size_t> new_limit) {
   if (new_limit) {
     const auto rps_val = *new_limit;
@@ -49,7 +89,41 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
     return;
   }
 
+  auto* method =
+      utils::impl::FindTransparentOrNullptr(methods_, call.GetCallName());
+  if (!method) {
+    context.Next();
+    return;
+  }
+
+  if (method->settings.reject_by_deadline) {
+    // The remaining deadline already excludes the time the call has waited
+    // for its task to start
+    const auto remaining = ugrpc::impl::ExtractDeadlineDuration(
+        call.GetContext().raw_deadline());
+    const auto median = method->duration.Get();
+    if (median.count() != 0 && remaining < median) {
+      Reject(call, "deadline is shorter than the median call duration");
+      return;
+    }
+  }
+
+  const auto in_flight =
+      method->in_flight.fetch_add(1, std::memory_order_relaxed) + 1;
+  const utils::FastScopeGuard in_flight_guard{[method]() noexcept {
+    method->in_flight.fetch_sub(1, std::memory_order_relaxed);
+  }};
+  const auto limit = method->settings.max_concurrent_calls;
+  if (limit != 0 && in_flight > limit) {
+    Reject(call, "concurrent calls limit exceeded");
+    return;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
   context.Next();
+  method->duration.Account(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start));
 }
 
 }  // namespace ugrpc::server::middlewares::congestion_control
@@ -1,23 +1,65 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
 #include <userver/server/congestion_control/limiter.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/token_bucket.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::middlewares::congestion_control {
 
+struct MethodSettings final {
+  // 0 means no limit
+  std::size_t max_concurrent_calls{0};
+  bool reject_by_deadline{false};
+};
+
+// Keys are the full call names, e.g. "sample.ugrpc.UnitTestService/SayHello"
+using MethodsSettings = std::unordered_map<std::string, MethodSettings>;
+
+// Streaming estimate of the median call duration: every sample moves the
+// estimate towards itself by a small fraction of the estimate
+class DurationMedian final {
+ public:
+  // Returns zero until the first sample
+  std::chrono::microseconds Get() const noexcept;
+
+  void Account(std::chrono::microseconds duration) noexcept;
+
+ private:
+  std::atomic<std::int64_t> median_us_{0};
+};
+
 class Middleware final
     : public MiddlewareBase,
       public USERVER_NAMESPACE::server::congestion_control::Limitee {
  public:
+  explicit Middleware(const MethodsSettings& methods = {});
+
   void Handle(MiddlewareCallContext& context) const override;
 
   void SetLimit(std::optional<size_t> new_limit) override;
 
  private:
+  struct MethodState final {
+    explicit MethodState(const MethodSettings& settings) : settings(settings) {}
+
+    const MethodSettings settings;
+    std::atomic<std::size_t> in_flight{0};
+    DurationMedian duration;
+  };
+
   mutable utils::TokenBucket rate_limit_{utils::TokenBucket::MakeUnbounded()};
+  // The calls of the other methods are not tracked
+  mutable utils::impl::TransparentMap<std::string, MethodState> methods_;
 };
 
 }  // namespace ugrpc::server::middlewares::congestion_control
@@ -56,13 +56,18 @@ void Middleware::CallRequestHook(const MiddlewareCallContext& context,
                                  google::protobuf::Message& request) {
   auto& storage = context.GetCall().GetStorageContext();
   auto& span = context.GetCall().GetSpan();
+
+  const bool is_first_request = storage.Get(kIsFirstRequest);
+  if (is_first_request) storage.Set(kIsFirstRequest, false);
+
+  // Don't format the message for a record that is not written
+  if (!logging::ShouldLog(span.GetLogLevel())) return;
+
   logging::LogExtra log_extra{
       {"grpc_type", "request"},
       {"body", GetMessageForLogging(request, settings_)}};
 
-  if (storage.Get(kIsFirstRequest)) {
-    storage.Set(kIsFirstRequest, false);
-
+  if (is_first_request) {
     const auto call_kind = context.GetCall().GetCallKind();
     if (!IsRequestStream(call_kind)) {
       log_extra.Extend("type", "request");
@@ -75,12 +80,16 @@ void Middleware::CallResponseHook(const MiddlewareCallContext& context,
                                   google::protobuf::Message& response) {
   auto& span = context.GetCall().GetSpan();
   const auto call_kind = context.GetCall().GetCallKind();
+  // Don't format the message if neither the span nor the record is written
+  const bool should_log = logging::ShouldLog(span.GetLogLevel());
 
   if (!IsResponseStream(call_kind)) {
     span.AddTag("grpc_type", "response");
-    span.AddNonInheritableTag("body",
-                              GetMessageForLogging(response, settings_));
-  } else {
+    if (should_log) {
+      span.AddNonInheritableTag("body",
+                                GetMessageForLogging(response, settings_));
+    }
+  } else if (should_log) {
     logging::LogExtra log_extra{
         {"grpc_type", "response"},
         {"body", GetMessageForLogging(response, settings_)}};
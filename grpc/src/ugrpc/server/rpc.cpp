@@ -181,6 +181,16 @@ std::string_view CallAnyBase::GetMethodName() const {
   return params_.method_name;
 }
 
+void CallAnyBase::SetupCompression() {
+  const auto& compression = params_.compression;
+  if (!compression) return;
+  if (compression->level) {
+    params_.context.set_compression_level(*compression->level);
+  } else if (compression->algorithm) {
+    params_.context.set_compression_algorithm(*compression->algorithm);
+  }
+}
+
 }  // namespace ugrpc::server
 
 USERVER_NAMESPACE_END
@@ -89,6 +89,11 @@ class Server::Impl final {
 
   grpc::CompletionQueue& GetCompletionQueue() noexcept;
 
+  const ugrpc::impl::CompletionQueues& GetCompletionQueues() noexcept;
+
+  std::shared_ptr<grpc::Channel> MakeInProcessChannel(
+      const grpc::ChannelArguments& channel_args);
+
   void Start();
 
   int GetPort() const noexcept;
@@ -127,6 +132,7 @@ class Server::Impl final {
   ugrpc::impl::StatisticsStorage statistics_storage_;
   const dynamic_config::Source config_source_;
   logging::LoggerPtr access_tskv_logger_;
+  const std::size_t message_arena_initial_block_size_;
 };
 
 Server::Impl::Impl(ServerConfig&& config,
@@ -135,7 +141,9 @@ Server::Impl::Impl(ServerConfig&& config,
     : statistics_storage_(statistics_storage,
                           ugrpc::impl::StatisticsDomain::kServer),
       config_source_(config_source),
-      access_tskv_logger_(std::move(config.access_tskv_logger)) {
+      access_tskv_logger_(std::move(config.access_tskv_logger)),
+      message_arena_initial_block_size_(
+          config.message_arena_initial_block_size) {
   LOG_INFO() << "Configuring the gRPC server";
   ugrpc::impl::SetupNativeLogging();
   ugrpc::impl::UpdateNativeLogLevel(config.native_log_level);
@@ -204,6 +212,7 @@ impl::ServiceSettings Server::Impl::MakeServiceSettings(
       std::move(config.middlewares),
       access_tskv_logger_,
       config_source_,
+      message_arena_initial_block_size_,
   };
 }
 
@@ -247,6 +256,21 @@ grpc::CompletionQueue& Server::Impl::GetCompletionQueue() noexcept {
   return *queue_->GetQueues().queues[0];
 }
 
+const ugrpc::impl::CompletionQueues&
+Server::Impl::GetCompletionQueues() noexcept {
+  UASSERT(state_ == State::kConfiguration || state_ == State::kActive);
+  return queue_->GetQueues();
+}
+
+std::shared_ptr<grpc::Channel> Server::Impl::MakeInProcessChannel(
+    const grpc::ChannelArguments& channel_args) {
+  std::lock_guard lock(configuration_mutex_);
+  UINVARIANT(state_ == State::kActive && server_,
+             "In-process channels can only be made after the gRPC server has "
+             "started");
+  return server_->InProcessChannel(channel_args);
+}
+
 void Server::Impl::Start() {
   std::lock_guard lock(configuration_mutex_);
   UASSERT(state_ == State::kConfiguration);
@@ -363,6 +387,15 @@ grpc::CompletionQueue& Server::GetCompletionQueue() noexcept {
   return impl_->GetCompletionQueue();
 }
 
+const ugrpc::impl::CompletionQueues& Server::GetCompletionQueues() noexcept {
+  return impl_->GetCompletionQueues();
+}
+
+std::shared_ptr<grpc::Channel> Server::MakeInProcessChannel(
+    const grpc::ChannelArguments& channel_args) {
+  return impl_->MakeInProcessChannel(channel_args);
+}
+
 void Server::Start() { return impl_->Start(); }
 
 int Server::GetPort() const noexcept { return impl_->GetPort(); }
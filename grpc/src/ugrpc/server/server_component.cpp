@@ -80,6 +80,12 @@ properties:
     enable-channelz:
         type: boolean
         description: enable channelz
+    message-arena-initial-block-size:
+        type: integer
+        description: |
+            size in bytes of the initial block of the per-call protobuf arena
+            for the request messages, 0 disables the arena
+        minimum: 0
     service-defaults:
         type: object
         description: omitted options for service components will default to the corresponding option from here
@@ -65,9 +65,15 @@ void ServiceBase::StartServer(
   adding_middlewares_allowed_ = false;
   server_.Start();
   endpoint_ = fmt::format("[::1]:{}", server_.GetPort());
+  if (!client_factory_settings.in_process_channel_factory) {
+    client_factory_settings.in_process_channel_factory =
+        [this](const grpc::ChannelArguments& channel_args) {
+          return server_.MakeInProcessChannel(channel_args);
+        };
+  }
   client_factory_.emplace(std::move(client_factory_settings),
                           engine::current_task::GetTaskProcessor(),
-                          middleware_factories_, server_.GetCompletionQueue(),
+                          middleware_factories_, server_.GetCompletionQueues(),
                           statistics_storage_, testsuite_,
                           config_storage_.GetSource());
 }
@@ -0,0 +1,69 @@
+#include <userver/utest/utest.hpp>
+
+#include <google/protobuf/arena.h>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kInitialBlockSize = 4096;
+
+ugrpc::server::ServerConfig MakeServerConfig(std::size_t initial_block_size) {
+  ugrpc::server::ServerConfig config;
+  config.port = 0;
+  config.message_arena_initial_block_size = initial_block_size;
+  return config;
+}
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    auto* arena = call.GetArena();
+    EXPECT_EQ(request.GetArena(), arena);
+
+    auto* response = google::protobuf::Arena::CreateMessage<
+        sample::ugrpc::GreetingResponse>(arena);
+    response->set_name("Hello " + request.name());
+    call.Finish(*response);
+    if (!arena) delete response;
+  }
+};
+
+class GrpcArenaTest : public ugrpc::tests::ServiceFixture<UnitTestService> {
+ protected:
+  GrpcArenaTest()
+      : ugrpc::tests::ServiceFixture<UnitTestService>(
+            MakeServerConfig(kInitialBlockSize)) {}
+};
+
+class GrpcNoArenaTest : public ugrpc::tests::ServiceFixture<UnitTestService> {
+ protected:
+  GrpcNoArenaTest()
+      : ugrpc::tests::ServiceFixture<UnitTestService>(MakeServerConfig(0)) {}
+};
+
+void CheckSayHello(sample::ugrpc::UnitTestServiceClient& client) {
+  sample::ugrpc::GreetingRequest out;
+  out.set_name(std::string(kInitialBlockSize * 2, 'a'));
+  const auto in = client.SayHello(out).Finish();
+  EXPECT_EQ(in.name(), "Hello " + out.name());
+}
+
+}  // namespace
+
+UTEST_F(GrpcArenaTest, RequestOnArena) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  for (int i = 0; i < 3; ++i) CheckSayHello(client);
+}
+
+UTEST_F(GrpcNoArenaTest, RequestOnHeap) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  CheckSayHello(client);
+}
+
+USERVER_NAMESPACE_END
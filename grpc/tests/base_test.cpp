@@ -181,6 +181,70 @@ UTEST_F(GrpcClientTest, UnaryRPCDefaultContext) {
   EXPECT_EQ("Hello " + out.name(), in.name());
 }
 
+UTEST_F(GrpcClientTest, InProcessUnaryRPC) {
+  auto client = MakeInProcessClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::GreetingRequest out;
+  out.set_name("userver");
+  auto call = client.SayHello(out, PrepareClientContext());
+
+  sample::ugrpc::GreetingResponse in;
+  UEXPECT_NO_THROW(in = call.Finish());
+  CheckClientContext(call.GetContext());
+  EXPECT_EQ("Hello " + out.name(), in.name());
+}
+
+UTEST_F(GrpcClientTest, InProcessBidirectionalStream) {
+  auto client = MakeInProcessClient<sample::ugrpc::UnitTestServiceClient>();
+  auto bs = client.Chat(PrepareClientContext());
+
+  sample::ugrpc::StreamGreetingRequest out{};
+  out.set_name("userver");
+  sample::ugrpc::StreamGreetingResponse in;
+
+  for (auto i = 0; i < 42; ++i) {
+    out.set_number(i);
+    EXPECT_TRUE(bs.Write(out));
+    EXPECT_TRUE(bs.Read(in));
+    EXPECT_EQ(in.number(), i + 1);
+  }
+  EXPECT_TRUE(bs.WritesDone());
+  EXPECT_FALSE(bs.Read(in));
+  CheckClientContext(bs.GetContext());
+}
+
+ugrpc::server::ServerConfig MakeMultipleQueuesServerConfig() {
+  ugrpc::server::ServerConfig config;
+  config.port = 0;
+  config.completion_queue_num = 4;
+  return config;
+}
+
+class GrpcMultipleQueuesTest
+    : public ugrpc::tests::ServiceFixture<UnitTestService> {
+ protected:
+  GrpcMultipleQueuesTest()
+      : ugrpc::tests::ServiceFixture<UnitTestService>(
+            MakeMultipleQueuesServerConfig()) {}
+};
+
+UTEST_F_MT(GrpcMultipleQueuesTest, ConcurrentUnaryRPC, 4) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  std::vector<engine::TaskWithResult<void>> tasks;
+
+  // Client calls of different worker threads use different completion queues
+  for (std::size_t i = 0; i < GetThreadCount() * 4; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&client] {
+      sample::ugrpc::GreetingRequest out;
+      out.set_name("default_context");
+      for (int j = 0; j < 10; ++j) {
+        const auto in = client.SayHello(out).Finish();
+        EXPECT_EQ("Hello " + out.name(), in.name());
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+}
+
 UTEST_F(GrpcClientTest, InputStream) {
   auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
   sample::ugrpc::StreamGreetingRequest out;
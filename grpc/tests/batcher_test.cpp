@@ -0,0 +1,120 @@
+#include <userver/ugrpc/client/batcher.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    while (call.Read(request)) {
+      sample::ugrpc::StreamGreetingResponse response;
+      response.set_number(request.number());
+      response.set_name("Hello " + request.name());
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+using GrpcBatcherTest = ugrpc::tests::ServiceFixture<UnitTestService>;
+
+using Batcher = ugrpc::client::UnaryBatcher<std::string, std::string>;
+
+}  // namespace
+
+UTEST_F_MT(GrpcBatcherTest, BatchRpc, 2) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  /// [sample]
+  ugrpc::client::BatcherSettings settings;
+  settings.max_batch_size = 10;
+  settings.max_delay = std::chrono::milliseconds{5};
+
+  // Every batch of names is sent over a single Chat RPC
+  Batcher batcher{[&client](std::vector<std::string>&& names) {
+                    auto chat = client.Chat();
+                    sample::ugrpc::StreamGreetingRequest request;
+                    for (auto& name : names) {
+                      request.set_name(std::move(name));
+                      chat.WriteAndCheck(request);
+                    }
+                    [[maybe_unused]] const bool done = chat.WritesDone();
+
+                    std::vector<std::string> responses;
+                    sample::ugrpc::StreamGreetingResponse response;
+                    while (chat.Read(response)) {
+                      responses.push_back(response.name());
+                    }
+                    return responses;
+                  },
+                  settings};
+
+  const auto response = batcher.Call("userver");
+  /// [sample]
+  EXPECT_EQ(response, "Hello userver");
+}
+
+UTEST_MT(UnaryBatcher, FullBatchIsSentImmediately, 4) {
+  constexpr std::size_t kBatchSize = 5;
+  std::atomic<int> batches{0};
+  Batcher batcher{[&batches](std::vector<std::string>&& requests) {
+                    EXPECT_EQ(requests.size(), kBatchSize);
+                    ++batches;
+                    for (auto& request : requests) request += "!";
+                    return std::move(requests);
+                  },
+                  {kBatchSize, utest::kMaxTestWaitTime}};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kBatchSize * 2; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&batcher, i] {
+      const auto request = std::to_string(i);
+      EXPECT_EQ(batcher.Call(request), request + "!");
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+  EXPECT_EQ(batches, 2);
+}
+
+UTEST(UnaryBatcher, BatchIsSentAfterDelay) {
+  Batcher batcher{[](std::vector<std::string>&& requests) {
+                    EXPECT_EQ(requests.size(), 1u);
+                    return std::move(requests);
+                  },
+                  {100, std::chrono::milliseconds{10}}};
+  EXPECT_EQ(batcher.Call("request"), "request");
+}
+
+UTEST(UnaryBatcher, ErrorIsPropagated) {
+  Batcher batcher{[](std::vector<std::string>&&) -> std::vector<std::string> {
+                    throw std::runtime_error("batch failed");
+                  },
+                  {100, std::chrono::milliseconds{10}}};
+  UEXPECT_THROW_MSG(batcher.Call("request"), std::runtime_error,
+                    "batch failed");
+}
+
+UTEST(UnaryBatcher, WrongResponsesCount) {
+  Batcher batcher{[](std::vector<std::string>&&) {
+                    return std::vector<std::string>{};
+                  },
+                  {100, std::chrono::milliseconds{10}}};
+  UEXPECT_THROW(batcher.Call("request"), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
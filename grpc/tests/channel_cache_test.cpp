@@ -0,0 +1,63 @@
+#include <userver/utest/utest.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <grpcpp/security/credentials.h>
+
+#include <userver/ugrpc/client/impl/channel_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kChannelCount = 3;
+const std::string kEndpoint = "[::1]:1";
+
+ugrpc::client::impl::ChannelCache MakeChannelCache() {
+  return ugrpc::client::impl::ChannelCache{grpc::InsecureChannelCredentials(),
+                                           grpc::ChannelArguments{},
+                                           kChannelCount};
+}
+
+}  // namespace
+
+UTEST(ChannelCache, LeastLoadedChannel) {
+  auto cache = MakeChannelCache();
+  auto token = cache.Get(kEndpoint);
+  ASSERT_EQ(token.GetChannelCount(), kChannelCount);
+
+  std::vector<ugrpc::client::impl::ChannelLoadScope> rpcs;
+  for (std::size_t i = 0; i < kChannelCount * 2; ++i) {
+    const auto index = token.GetLeastLoadedChannel();
+    EXPECT_EQ(token.GetInFlightCount(index), i / kChannelCount);
+    rpcs.push_back(token.MakeLoadScope(index));
+  }
+  for (std::size_t i = 0; i < kChannelCount; ++i) {
+    EXPECT_EQ(token.GetInFlightCount(i), 2u);
+  }
+
+  rpcs.erase(rpcs.begin());
+  const auto index = token.GetLeastLoadedChannel();
+  EXPECT_EQ(token.GetInFlightCount(index), 1u);
+
+  rpcs.clear();
+  for (std::size_t i = 0; i < kChannelCount; ++i) {
+    EXPECT_EQ(token.GetInFlightCount(i), 0u);
+  }
+}
+
+UTEST(ChannelCache, LoadIsSharedByClients) {
+  auto cache = MakeChannelCache();
+  auto first = cache.Get(kEndpoint);
+  auto second = cache.Get(kEndpoint);
+
+  std::optional<ugrpc::client::impl::ChannelLoadScope> rpc;
+  rpc.emplace(first.MakeLoadScope(1));
+  EXPECT_EQ(second.GetInFlightCount(1), 1u);
+
+  rpc.reset();
+  EXPECT_EQ(second.GetInFlightCount(1), 0u);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,161 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <string>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/ugrpc/compression.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <ugrpc/server/impl/server_configs.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMinMessageSize = 100;
+
+ugrpc::CompressionSettings MakeSettings() {
+  ugrpc::CompressionSettings settings;
+  settings.algorithm = GRPC_COMPRESS_GZIP;
+  settings.min_message_size = kMinMessageSize;
+  return settings;
+}
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+    is_compressed = call.GetContext().compression_algorithm() ==
+                    GRPC_COMPRESS_GZIP;
+    finished.Send();
+  }
+
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (call.Read(request)) {
+      response.set_number(request.number());
+      response.set_name("Hello " + request.name());
+      call.Write(response);
+    }
+    call.Finish();
+  }
+
+  std::atomic<bool> is_compressed{false};
+  engine::SingleConsumerEvent finished;
+};
+
+class GrpcCompression : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  GrpcCompression() {
+    ExtendDynamicConfig({
+        {ugrpc::server::impl::kServerCompression,
+         ugrpc::server::impl::ServerCompression{
+             {"sample.ugrpc.UnitTestService/SayHello", MakeSettings()},
+             {"sample.ugrpc.UnitTestService/Chat", MakeSettings()},
+         }},
+    });
+    RegisterService(service_);
+    StartServer();
+  }
+
+  ~GrpcCompression() override { StopServer(); }
+
+  UnitTestService service_;
+};
+
+ugrpc::client::Qos MakeQos() {
+  ugrpc::client::Qos qos;
+  qos.compression = MakeSettings();
+  return qos;
+}
+
+}  // namespace
+
+TEST(Compression, Parse) {
+  const auto json = formats::json::FromString(R"(
+    {"algorithm": "gzip", "level": "high", "min-message-size": 1024}
+  )");
+  const auto settings = json.As<ugrpc::CompressionSettings>();
+  EXPECT_EQ(settings.algorithm, GRPC_COMPRESS_GZIP);
+  EXPECT_EQ(settings.level, GRPC_COMPRESS_LEVEL_HIGH);
+  EXPECT_EQ(settings.min_message_size, 1024);
+  EXPECT_EQ(formats::json::ValueBuilder{settings}
+                .ExtractValue()
+                .As<ugrpc::CompressionSettings>(),
+            settings);
+
+  const auto defaults =
+      formats::json::FromString("{}").As<ugrpc::CompressionSettings>();
+  EXPECT_EQ(defaults, ugrpc::CompressionSettings{});
+
+  UEXPECT_THROW(formats::json::FromString(R"({"algorithm": "zstd"})")
+                    .As<ugrpc::CompressionSettings>(),
+                formats::json::Exception);
+}
+
+TEST(Compression, MinMessageSize) {
+  sample::ugrpc::GreetingResponse message;
+  message.set_name(std::string(kMinMessageSize, 'a'));
+  sample::ugrpc::GreetingResponse small_message;
+
+  grpc::WriteOptions options;
+  ugrpc::impl::ApplyMinMessageSize(options, std::nullopt, small_message);
+  EXPECT_FALSE(options.get_no_compression());
+  ugrpc::impl::ApplyMinMessageSize(options, MakeSettings(), message);
+  EXPECT_FALSE(options.get_no_compression());
+  ugrpc::impl::ApplyMinMessageSize(options, MakeSettings(), small_message);
+  EXPECT_TRUE(options.get_no_compression());
+}
+
+UTEST_F(GrpcCompression, UnaryCall) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::GreetingRequest request;
+  request.set_name(std::string(kMinMessageSize, 'a'));
+
+  auto response = client
+                      .SayHello(request,
+                                std::make_unique<grpc::ClientContext>(),
+                                MakeQos())
+                      .Finish();
+  EXPECT_EQ(response.name(), "Hello " + request.name());
+  ASSERT_TRUE(service_.finished.WaitForEvent());
+  EXPECT_TRUE(service_.is_compressed);
+
+  // Small responses are not compressed
+  request.set_name("small");
+  response = client.SayHello(request).Finish();
+  EXPECT_EQ(response.name(), "Hello small");
+  ASSERT_TRUE(service_.finished.WaitForEvent());
+  EXPECT_FALSE(service_.is_compressed);
+}
+
+UTEST_F(GrpcCompression, BidirectionalStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto stream =
+      client.Chat(std::make_unique<grpc::ClientContext>(), MakeQos());
+
+  sample::ugrpc::StreamGreetingRequest request;
+  sample::ugrpc::StreamGreetingResponse response;
+  for (const auto size : {std::size_t{1}, kMinMessageSize * 10}) {
+    request.set_name(std::string(size, 'a'));
+    request.set_number(size);
+    ASSERT_TRUE(stream.Write(request));
+    ASSERT_TRUE(stream.Read(response));
+    EXPECT_EQ(response.number(), size);
+    EXPECT_EQ(response.name(), "Hello " + request.name());
+  }
+  ASSERT_TRUE(stream.WritesDone());
+  EXPECT_FALSE(stream.Read(response));
+}
+
+USERVER_NAMESPACE_END
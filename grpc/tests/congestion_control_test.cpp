@@ -0,0 +1,130 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <ugrpc/server/middlewares/congestion_control/middleware.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace cc = ugrpc::server::middlewares::congestion_control;
+
+constexpr std::string_view kSayHello = "sample.ugrpc.UnitTestService/SayHello";
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    if (request.name() == "block") {
+      started.Send();
+      EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+    } else if (request.name() == "slow") {
+      engine::SleepFor(100ms);
+    }
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+  engine::SingleConsumerEvent started;
+  engine::SingleConsumerEvent release;
+};
+
+class GrpcCongestionControl : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  explicit GrpcCongestionControl(const cc::MethodSettings& settings) {
+    AddServerMiddleware(std::make_shared<cc::Middleware>(
+        cc::MethodsSettings{{std::string{kSayHello}, settings}}));
+    RegisterService(service_);
+    StartServer();
+    client_.emplace(MakeClient<sample::ugrpc::UnitTestServiceClient>());
+  }
+
+  ~GrpcCongestionControl() override {
+    client_.reset();
+    StopServer();
+  }
+
+  sample::ugrpc::GreetingResponse SayHello(
+      std::string name, std::unique_ptr<grpc::ClientContext> context =
+                            std::make_unique<grpc::ClientContext>()) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(std::move(name));
+    return client_->SayHello(request, std::move(context)).Finish();
+  }
+
+  UnitTestService& GetService() { return service_; }
+
+ private:
+  UnitTestService service_;
+  std::optional<sample::ugrpc::UnitTestServiceClient> client_;
+};
+
+cc::MethodSettings MakeConcurrencyLimit() {
+  cc::MethodSettings settings;
+  settings.max_concurrent_calls = 1;
+  return settings;
+}
+
+cc::MethodSettings MakeDeadlineAdmission() {
+  cc::MethodSettings settings;
+  settings.reject_by_deadline = true;
+  return settings;
+}
+
+class GrpcCongestionControlConcurrency : public GrpcCongestionControl {
+ protected:
+  GrpcCongestionControlConcurrency()
+      : GrpcCongestionControl(MakeConcurrencyLimit()) {}
+};
+
+class GrpcCongestionControlDeadline : public GrpcCongestionControl {
+ protected:
+  GrpcCongestionControlDeadline()
+      : GrpcCongestionControl(MakeDeadlineAdmission()) {}
+};
+
+}  // namespace
+
+UTEST_F(GrpcCongestionControlConcurrency, RejectsAboveLimit) {
+  auto blocked = engine::AsyncNoSpan([this] { return SayHello("block"); });
+  ASSERT_TRUE(GetService().started.WaitForEventFor(utest::kMaxTestWaitTime));
+
+  UEXPECT_THROW(SayHello("userver"), ugrpc::client::ResourceExhaustedError);
+
+  GetService().release.Send();
+  EXPECT_EQ(blocked.Get().name(), "Hello block");
+  EXPECT_EQ(SayHello("userver").name(), "Hello userver");
+}
+
+UTEST_F(GrpcCongestionControlDeadline, RejectsShortDeadline) {
+  // Calls without a deadline are always admitted
+  EXPECT_EQ(SayHello("slow").name(), "Hello slow");
+
+  auto context = std::make_unique<grpc::ClientContext>();
+  context->set_deadline(engine::Deadline::FromDuration(10ms));
+  UEXPECT_THROW(SayHello("fast", std::move(context)),
+                ugrpc::client::ResourceExhaustedError);
+
+  context = std::make_unique<grpc::ClientContext>();
+  context->set_deadline(
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime));
+  EXPECT_EQ(SayHello("fast", std::move(context)).name(), "Hello fast");
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include <userver/ugrpc/client/generic.hpp>
 
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include <ugrpc/client/middlewares/log/middleware.hpp>
 #include <userver/ugrpc/byte_buffer_utils.hpp>
@@ -123,4 +125,27 @@ UTEST_F(GenericClientLoggingTest, Logs) {
   EXPECT_EQ(span_log.GetTagOptional("grpc_code"), "OK") << span_log;
 }
 
+UTEST(ByteBuffer, ParseKeepsSlicesShared) {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name(std::string(1000, 'a'));
+  // A small block size makes the buffer consist of several slices
+  const auto buffer = ugrpc::SerializeToByteBuffer(request, 64);
+
+  sample::ugrpc::GreetingRequest parsed;
+  ASSERT_TRUE(ugrpc::ParseFromByteBuffer(buffer, parsed));
+  EXPECT_EQ(parsed.name(), request.name());
+
+  // The buffer is still usable for forwarding, its copies share the slices
+  const grpc::ByteBuffer forwarded{buffer};
+  std::vector<grpc::Slice> slices;
+  std::vector<grpc::Slice> forwarded_slices;
+  ASSERT_TRUE(buffer.Dump(&slices).ok());
+  ASSERT_TRUE(forwarded.Dump(&forwarded_slices).ok());
+  ASSERT_GT(slices.size(), 1u);
+  ASSERT_EQ(slices.size(), forwarded_slices.size());
+  for (std::size_t i = 0; i < slices.size(); ++i) {
+    EXPECT_EQ(slices[i].begin(), forwarded_slices[i].begin());
+  }
+}
+
 USERVER_NAMESPACE_END
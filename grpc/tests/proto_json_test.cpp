@@ -0,0 +1,111 @@
+#include <userver/ugrpc/proto_json.hpp>
+
+#include <cmath>
+
+#include <google/protobuf/util/message_differencer.h>
+
+#include <userver/formats/json/inline.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <tests/messages.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+sample::ugrpc::JsonMessage MakeMessage() {
+  sample::ugrpc::JsonMessage message;
+  message.set_int32_value(-42);
+  message.set_int64_value(1LL << 60);
+  message.set_uint64_value(18446744073709551615ULL);
+  message.set_double_value(0.5);
+  message.set_float_value(0.1f);
+  message.set_bool_value(true);
+  message.set_string_value("\"quoted\"\n");
+  message.set_bytes_value(std::string{"\0\1\2", 3});
+  message.set_kind(sample::ugrpc::JsonMessage::KIND_FIRST);
+  message.add_names("a");
+  message.add_names("b");
+  (*message.mutable_counters())["first"] = 1;
+  (*message.mutable_counters())["second"] = 2;
+  message.mutable_greeting()->set_name("userver");
+  message.add_greetings()->set_number(1);
+  message.set_second(0);
+  return message;
+}
+
+formats::json::Value WriteJson(const google::protobuf::Message& message) {
+  formats::json::StringBuilder sw;
+  WriteToStream(message, sw);
+  return formats::json::FromString(sw.GetStringView());
+}
+
+}  // namespace
+
+TEST(ProtoJson, WriteMatchesProtobuf) {
+  const auto message = MakeMessage();
+  EXPECT_EQ(WriteJson(message), ugrpc::MessageToJson(message));
+}
+
+TEST(ProtoJson, WriteDefaultValues) {
+  const sample::ugrpc::JsonMessage message;
+  const auto json = WriteJson(message);
+  EXPECT_EQ(json, ugrpc::MessageToJson(message));
+
+  // Fields without presence are written, the unset ones are skipped
+  EXPECT_EQ(json["int64Value"].As<std::string>(), "0");
+  EXPECT_EQ(json["names"], formats::json::MakeArray());
+  EXPECT_FALSE(json.HasMember("greeting"));
+  EXPECT_FALSE(json.HasMember("first"));
+}
+
+TEST(ProtoJson, RoundTrip) {
+  const auto message = MakeMessage();
+  sample::ugrpc::JsonMessage parsed;
+  ugrpc::JsonToMessage(WriteJson(message), parsed);
+  EXPECT_TRUE(
+      google::protobuf::util::MessageDifferencer::Equals(message, parsed))
+      << parsed.DebugString();
+}
+
+TEST(ProtoJson, ParseAlternativeForms) {
+  const auto json = formats::json::MakeObject(
+      "int64_value", 42, "double_value", "NaN", "kind", 1, "string_value",
+      formats::json::Value{}, "counters", formats::json::MakeObject("key", "7"));
+
+  sample::ugrpc::JsonMessage message;
+  ugrpc::JsonToMessage(json, message);
+  EXPECT_EQ(message.int64_value(), 42);
+  EXPECT_TRUE(std::isnan(message.double_value()));
+  EXPECT_EQ(message.kind(), sample::ugrpc::JsonMessage::KIND_FIRST);
+  EXPECT_EQ(message.string_value(), "");
+  EXPECT_EQ(message.counters().at("key"), 7);
+}
+
+TEST(ProtoJson, ParseErrors) {
+  sample::ugrpc::JsonMessage message;
+  UEXPECT_THROW(ugrpc::JsonToMessage(
+                    formats::json::MakeObject("unknown", 1), message),
+                formats::json::Exception);
+  UEXPECT_THROW(ugrpc::JsonToMessage(
+                    formats::json::MakeObject("kind", "KIND_UNKNOWN"), message),
+                formats::json::Exception);
+  UEXPECT_THROW(ugrpc::JsonToMessage(
+                    formats::json::MakeObject("int32Value", "abc"), message),
+                formats::json::Exception);
+  UEXPECT_THROW(ugrpc::JsonToMessage(formats::json::MakeArray(), message),
+                formats::json::Exception);
+}
+
+TEST(ProtoJson, WellKnownTypes) {
+  const auto json = formats::json::MakeObject(
+      "number", 1.5, "list", formats::json::MakeArray("a", true),
+      "null", formats::json::Value{});
+
+  google::protobuf::Struct message;
+  ugrpc::JsonToMessage(json, message);
+  EXPECT_EQ(message.fields().at("number").number_value(), 1.5);
+  EXPECT_EQ(WriteJson(message), json);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,115 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <string>
+
+#include <userver/ugrpc/server/write_buffering.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kMessagesCount = 1000;
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    ugrpc::server::WriteBufferingSettings settings;
+    settings.max_buffered_bytes = 1024;
+    call.EnableWriteBuffering(settings);
+
+    sample::ugrpc::StreamGreetingResponse response;
+    response.set_name("Hello again " + request.name());
+    for (int i = 0; i < request.number(); ++i) {
+      response.set_number(i);
+      call.Write(response);
+    }
+    call.Finish();
+  }
+
+  void Chat(ChatCall& call) override {
+    call.EnableWriteBuffering();
+
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (call.Read(request)) {
+      response.set_number(request.number());
+      response.set_name("Hello " + request.name());
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+using GrpcWriteBuffering = ugrpc::tests::ServiceFixture<UnitTestService>;
+
+}  // namespace
+
+UTEST_F(GrpcWriteBuffering, ResponseStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::StreamGreetingRequest out;
+  out.set_name("userver");
+  out.set_number(kMessagesCount);
+  auto is = client.ReadMany(out);
+
+  sample::ugrpc::StreamGreetingResponse in;
+  for (int i = 0; i < kMessagesCount; ++i) {
+    ASSERT_TRUE(is.Read(in));
+    EXPECT_EQ(in.number(), i);
+    EXPECT_EQ(in.name(), "Hello again userver");
+  }
+  EXPECT_FALSE(is.Read(in));
+}
+
+UTEST_F(GrpcWriteBuffering, BidirectionalStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto chat = client.Chat();
+
+  sample::ugrpc::StreamGreetingRequest out;
+  out.set_name("userver");
+  for (int i = 0; i < kMessagesCount; ++i) {
+    out.set_number(i);
+    chat.WriteAndCheck(out);
+  }
+  EXPECT_TRUE(chat.WritesDone());
+
+  // The last buffered responses are sent on Finish
+  sample::ugrpc::StreamGreetingResponse in;
+  for (int i = 0; i < kMessagesCount; ++i) {
+    ASSERT_TRUE(chat.Read(in));
+    EXPECT_EQ(in.number(), i);
+  }
+  EXPECT_FALSE(chat.Read(in));
+}
+
+TEST(WriteBuffering, Thresholds) {
+  ugrpc::server::impl::WriteBuffering buffering;
+  sample::ugrpc::GreetingResponse message;
+  message.set_name(std::string(100, 'a'));
+
+  EXPECT_FALSE(buffering.MakeWriteOptions(message).get_buffer_hint());
+
+  ugrpc::server::WriteBufferingSettings settings;
+  settings.max_buffered_bytes = message.ByteSizeLong() * 3;
+  settings.max_delay = std::chrono::hours{1};
+  buffering.Enable(settings);
+
+  EXPECT_TRUE(buffering.MakeWriteOptions(message).get_buffer_hint());
+  EXPECT_TRUE(buffering.MakeWriteOptions(message).get_buffer_hint());
+  // Reaches the bytes threshold
+  EXPECT_FALSE(buffering.MakeWriteOptions(message).get_buffer_hint());
+  EXPECT_TRUE(buffering.MakeWriteOptions(message).get_buffer_hint());
+
+  settings.max_delay = 0ms;
+  buffering.Enable(settings);
+  EXPECT_FALSE(buffering.MakeWriteOptions(message).get_buffer_hint());
+}
+
+USERVER_NAMESPACE_END
@@ -41,6 +41,8 @@ class Consumer;
 /// enable_auto_commit                 | whether to automatically and periodically commit offsets | false
 /// auto_offset_reset                  | action to take when there is no initial offset in offset store | --
 /// max_batch_size                     | maximum batch size for one callback call | --
+/// max_concurrent_partitions          | if greater than 1, the messages of each partition of a batch are processed by a separate concurrent callback call | 1
+/// lean_batch_mode                    | if true, the messages are logged only once per polled batch, not each one | false
 /// env_pod_name                       | environment variable to substitute `{pod_name}` substring in `group_id` | none
 /// security_protocol                  | protocol used to communicate with brokers | --
 /// sasl_mechanisms                    | SASL mechanism to use for authentication | none
@@ -34,6 +34,7 @@ namespace kafka {
 /// delivery_timeout_ms      | time a produced message waits for successful delivery | --
 /// queue_buffering_max_ms   | delay to wait for messages to be transmitted to broker | --
 /// enable_idempotence       | whether to make producer idempotent | false
+/// transactional_id         | enables the transactions API, must be unique for each producer instance | none
 /// poll_timeout_ms          | time in milliseconds producer waits for new delivery events | 10
 /// send_retries_count       | how many times producer retries transient delivery errors | 5
 /// security_protocol        | protocol used to communicate with brokers | --
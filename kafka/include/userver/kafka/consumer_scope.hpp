@@ -8,6 +8,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace kafka {
 
+class Producer;
+
 namespace impl {
 
 class Consumer;
@@ -44,7 +46,9 @@ class Consumer;
 /// connection errors.
 ///
 /// @note Each `ConsumerScope` instance is not thread-safe. To speed up the topic
-/// messages processing, create more consumers with the same `group_id`.
+/// messages processing, create more consumers with the same `group_id`, or
+/// set `max_concurrent_partitions` static option to process the messages of
+/// different partitions concurrently.
 ///
 /// @see https://docs.confluent.io/platform/current/clients/consumer.html for
 /// basic consumer concepts
@@ -69,6 +73,10 @@ class ConsumerScope final {
   /// @warning If callback throws, it called over and over again with the batch
   /// with the same messages, until successful invocation.
   /// Though, user should consider idempotent message processing mechanism
+  /// @note If `max_concurrent_partitions` is greater than 1, the callback is
+  /// called concurrently, each call with messages of one partition. If some
+  /// calls throw, the offsets of the successfully processed partitions are
+  /// committed, and only the messages of the failed partitions come again.
   using Callback = std::function<void(MessageBatchView)>;
 
   /// @brief Stops the consumer (if not yet stopped).
@@ -111,10 +119,14 @@ class ConsumerScope final {
   /// `enable_auto_commit: true` in the static config. But read Kafka
   /// documentation carefully before to understand what auto commitment
   /// mechanism actually mean
+  ///
+  /// @note To commit the offsets atomically with the messages produced while
+  /// processing the batch, use `Producer::SendOffsetsToTransaction` instead
   void AsyncCommit();
 
  private:
   friend class impl::Consumer;
+  friend class Producer;
 
   explicit ConsumerScope(impl::Consumer& consumer) noexcept;
 
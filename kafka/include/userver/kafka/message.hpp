@@ -2,6 +2,8 @@
 
 #include <chrono>
 #include <optional>
+#include <string>
+#include <string_view>
 
 #include <userver/utils/fast_pimpl.hpp>
 #include <userver/utils/span.hpp>
@@ -17,10 +19,13 @@ class ConsumerImpl;
 }  // namespace impl
 
 /// @brief RAII wrapper for polled message data.
+///
+/// Key, payload and headers are not copied: the views point straight into
+/// the `librdkafka` message buffers and are valid while the `Message` lives.
 /// @note All `Message` instances must be destroyed before `Consumer` stop
 class Message final {
   struct Data;
-  using DataStorage = utils::FastPimpl<Data, 16 + 32 + 16, 8>;
+  using DataStorage = utils::FastPimpl<Data, 16 + 8, 8>;
 
  public:
   ~Message();
@@ -34,6 +39,11 @@ class Message final {
   int GetPartition() const;
   std::int64_t GetOffset() const;
 
+  /// @brief Returns the value of the last header with the `name`, or
+  /// `std::nullopt` if the message has no such header.
+  /// @note Headers are decoded by `librdkafka` only on the first access
+  std::optional<std::string_view> GetHeader(std::string_view name) const;
+
  private:
   friend class impl::ConsumerImpl;
 
@@ -2,10 +2,15 @@
 
 #include <chrono>
 #include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/kafka/message.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +24,23 @@ class ProducerImpl;
 
 }  // namespace impl
 
+class ConsumerScope;
+
+/// @brief Message sent with `Producer::SendBatch`.
+struct ProducerMessage final {
+  std::string key;
+  std::string payload;
+
+  /// If not set, partition is chosen by internal Kafka partitioner
+  std::optional<std::uint32_t> partition{};
+};
+
+/// @brief Delivery outcome of a message sent with `Producer::SendBatch`.
+enum class DeliveryStatus {
+  kDelivered,
+  kFailed,
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Apache Kafka Producer Client.
@@ -40,6 +62,35 @@ class ProducerImpl;
 /// @remark Destructor may block for no more than a couple of seconds to ensure
 /// all sent messages are properly delivered
 ///
+/// ## Transactions
+///
+/// If `transactional_id` is set in the static config, the messages may be
+/// sent within transactions: either all messages of a transaction are
+/// visible to the `read_committed` consumers, or none. Together with
+/// `Producer::SendOffsetsToTransaction` that gives the exactly-once
+/// consume-transform-produce pipeline: the consumed batch offsets are
+/// committed only with the messages produced while processing the batch.
+///
+/// @code
+/// consumer_.Start([this](kafka::MessageBatchView messages) {
+///   producer_.BeginTransaction();
+///   try {
+///     auto sent = producer_.SendBatch("output", Transform(messages)).Get();
+///     // check the delivery statuses in `sent`
+///     producer_.SendOffsetsToTransaction(consumer_, messages);
+///     producer_.CommitTransaction();
+///   } catch (const std::exception&) {
+///     producer_.AbortTransaction();
+///     throw;
+///   }
+/// });
+/// @endcode
+///
+/// Larger batches make larger transactions, which amortize the commit cost.
+///
+/// @warning Only one transaction may be in progress at a time, the
+/// transactions methods must not be called concurrently
+///
 /// @see https://docs.confluent.io/platform/current/clients/producer.html
 class Producer final {
  public:
@@ -110,6 +161,48 @@ class Producer final {
       std::string topic_name, std::string key, std::string message,
       std::optional<std::uint32_t> partition = std::nullopt) const;
 
+  /// @brief Sends all the `messages` to topic `topic_name` and returns the
+  /// task which waits for the delivery of all of them.
+  ///
+  /// Unlike sending each message with `Producer::SendAsync`, all the
+  /// messages are enqueued and waited for in a single task, so the high
+  /// throughput producing is not limited by the tasks creation.
+  ///
+  /// The task result contains the delivery status of each message, in
+  /// the order of the `messages`. Messages failed with transient errors are
+  /// retried like in `Producer::Send`.
+  ///
+  /// @warning The order the messages are written to partition may differ
+  /// from the order of the `messages` if some of them are retried
+  [[nodiscard]] engine::TaskWithResult<std::vector<DeliveryStatus>> SendBatch(
+      std::string topic_name, std::vector<ProducerMessage> messages) const;
+
+  /// @brief Begins a new transaction. All messages sent before the
+  /// `Producer::CommitTransaction` or `Producer::AbortTransaction` belong to
+  /// the transaction.
+  /// @throws std::runtime_error if `transactional_id` is not configured or
+  /// the transaction cannot be started
+  void BeginTransaction();
+
+  /// @brief Adds the offsets next to the `messages` to the current
+  /// transaction, so that they are committed to the consumer group of
+  /// `consumer_scope` with the transaction.
+  ///
+  /// @note Must be called from the `consumer_scope` callback, with the
+  /// messages of that callback. Do not call `ConsumerScope::AsyncCommit` or
+  /// enable `enable_auto_commit` for that consumer.
+  void SendOffsetsToTransaction(ConsumerScope& consumer_scope,
+                                MessageBatchView messages);
+
+  /// @brief Commits the current transaction, waiting for all its messages to
+  /// be delivered. If the transaction cannot be committed, it is aborted.
+  /// @throws std::runtime_error if the transaction is not committed
+  void CommitTransaction();
+
+  /// @brief Aborts the current transaction. Its messages are never visible to
+  /// the `read_committed` consumers.
+  void AbortTransaction();
+
   /// @brief Dumps per topic messages produce statistics.
   /// @see impl/stats.hpp
   void DumpMetric(utils::statistics::Writer& writer) const;
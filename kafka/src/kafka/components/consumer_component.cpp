@@ -23,6 +23,8 @@ ConsumerComponent::ConsumerComponent(
                 config["poll_timeout"].As<std::chrono::milliseconds>(
                     impl::Consumer::kDefaultPollTimeout),
                 config["enable_auto_commit"].As<bool>(false),
+                config["max_concurrent_partitions"].As<std::size_t>(1),
+                config["lean_batch_mode"].As<bool>(false),
                 context.GetTaskProcessor("consumer-task-processor"),
                 context.GetTaskProcessor("main-task-processor")) {
   auto& storage =
@@ -96,6 +98,20 @@ properties:
     max_batch_size:
         type: integer
         description: maximum batch size for one callback call
+    max_concurrent_partitions:
+        type: integer
+        description: |
+            if greater than 1, the messages of each partition
+            of a polled batch are passed to a separate callback call,
+            and up to that many calls run concurrently
+        defaultDescription: 1
+        minimum: 1
+    lean_batch_mode:
+        type: boolean
+        description: |
+            if true, the messages are logged only once per polled batch,
+            not each one. Useful for high-volume topics with small messages
+        defaultDescription: false
     security_protocol:
         type: string
         description: protocol used to communicate with brokers
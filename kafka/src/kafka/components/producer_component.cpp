@@ -52,6 +52,12 @@ properties:
         type: boolean
         description: whether to make producer idempotent
         defaultDescription: false
+    transactional_id:
+        type: string
+        description: |
+            enables the transactions API of the producer.
+            Must be unique for each producer instance
+        defaultDescription: none
     poll_timeout_ms:
         type: integer
         description: time in milliseconds producer waits for new delivery events
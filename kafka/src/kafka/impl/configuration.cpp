@@ -50,6 +50,7 @@ constexpr std::string_view kPodNameSubstr = "{pod_name}";
 constexpr std::string_view kDeliveryTimeoutField = "delivery_timeout_ms";
 constexpr std::string_view kQueueBufferingMaxMsField = "queue_buffering_max_ms";
 constexpr std::string_view kEnableIdempotenceField = "enable_idempotence";
+constexpr std::string_view kTransactionalIdField = "transactional_id";
 
 template <class SupportedList>
 bool IsSupportedOption(const SupportedList& supported_options,
@@ -167,12 +168,15 @@ Configuration::~Configuration() {
 
 Configuration::Configuration(Configuration&& other) noexcept
     : component_name_(std::move(other.component_name_)),
+      is_transactional_(other.is_transactional_),
       conf_(std::exchange(other.conf_, nullptr)) {}
 
 const std::string& Configuration::GetComponentName() const {
   return component_name_;
 }
 
+bool Configuration::IsTransactional() const { return is_transactional_; }
+
 rd_kafka_conf_s* Configuration::Release() {
   return std::exchange(conf_, nullptr);
 }
@@ -245,6 +249,13 @@ void Configuration::SetProducerOptions(
                 config[kQueueBufferingMaxMsField].As<std::string>());
   ConfSetOption(conf_, "enable.idempotence",
                 config[kEnableIdempotenceField].As<std::string>("false"));
+
+  if (config.HasMember(kTransactionalIdField)) {
+    /// @note `librdkafka` enables idempotence for transactional producers
+    ConfSetOption(conf_, "transactional.id",
+                  config[kTransactionalIdField].As<std::string>());
+    is_transactional_ = true;
+  }
 }
 
 }  // namespace kafka::impl
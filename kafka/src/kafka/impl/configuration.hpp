@@ -35,6 +35,9 @@ class Configuration final {
 
   const std::string& GetComponentName() const;
 
+  /// @brief Whether the producer `transactional_id` is configured.
+  bool IsTransactional() const;
+
   /// @brief Releases stored `rd_kafka_conf_t` pointer to be passed as a
   /// parameter of `rd_kafka_new` function that takes ownership on
   /// configuration.
@@ -50,6 +53,7 @@ class Configuration final {
 
  private:
   std::string component_name_;
+  bool is_transactional_{false};
 
   // Pointer to `conf_` must be released and passed to `rd_kafka_new`
   rd_kafka_conf_t* conf_;
@@ -1,7 +1,11 @@
 #include <kafka/impl/consumer.hpp>
 
+#include <shared_mutex>
 #include <string_view>
+#include <vector>
 
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/tracing/span.hpp>
@@ -20,6 +24,8 @@ Consumer::Consumer(std::unique_ptr<Configuration> configuration,
                    std::size_t max_batch_size,
                    std::chrono::milliseconds poll_timeout,
                    bool enable_auto_commit,
+                   std::size_t max_concurrent_partitions,
+                   bool lean_batch_mode,
                    engine::TaskProcessor& consumer_task_processor,
                    engine::TaskProcessor& main_task_processor)
     : component_name_(configuration->GetComponentName()),
@@ -27,9 +33,11 @@ Consumer::Consumer(std::unique_ptr<Configuration> configuration,
       max_batch_size_(max_batch_size),
       poll_timeout(poll_timeout),
       enable_auto_commit_(enable_auto_commit),
+      max_concurrent_partitions_(max_concurrent_partitions),
       consumer_task_processor_(consumer_task_processor),
       main_task_processor_(main_task_processor),
-      consumer_(std::make_unique<ConsumerImpl>(std::move(configuration))) {}
+      consumer_(std::make_unique<ConsumerImpl>(std::move(configuration),
+                                               lean_batch_mode)) {}
 
 Consumer::~Consumer() {
   static constexpr std::string_view kErrShutdownFailed{
@@ -74,27 +82,19 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
           }
           TESTPOINT(fmt::format("tp_{}_polled", component_name_), {});
 
-          auto batch_processing_task =
-              utils::Async(main_task_processor_, "messages_processing",
-                           callback, utils::span{polled_messages});
-          try {
-            batch_processing_task.Get();
-
-            consumer_->AccountMessageBatchProcessingSucceeded(polled_messages);
+          const bool processed =
+              max_concurrent_partitions_ > 1
+                  ? ProcessPartitionsConcurrently(callback, polled_messages)
+                  : utils::Async(main_task_processor_, "messages_processing",
+                                 [this, &callback, &polled_messages] {
+                                   return ProcessBatch(callback,
+                                                       polled_messages);
+                                 })
+                        .Get();
+
+          if (processed) {
             TESTPOINT(fmt::format("tp_{}", component_name_), {});
-          } catch (const std::exception& e) {
-            consumer_->AccountMessageBatchProcessingFailed(polled_messages);
-
-            const std::string error_text = e.what();
-            LOG_ERROR() << fmt::format(
-                "Messages processing failed in consumer: {}", error_text);
-            TESTPOINT(fmt::format("tp_error_{}", component_name_),
-                      [&error_text] {
-                        formats::json::ValueBuilder error_json;
-                        error_json["error"] = error_text;
-                        return error_json.ExtractValue();
-                      }());
-
+          } else {
             /// @note Messages must be destroyed, otherwise consumer won't stop
             /// and block forever
             polled_messages.clear();
@@ -108,6 +108,61 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
       });
 }
 
+bool Consumer::ProcessBatch(const ConsumerScope::Callback& callback,
+                            MessageBatchView batch) {
+  try {
+    callback(batch);
+
+    consumer_->AccountMessageBatchProcessingSucceeded(batch);
+    return true;
+  } catch (const std::exception& e) {
+    consumer_->AccountMessageBatchProcessingFailed(batch);
+
+    const std::string error_text = e.what();
+    LOG_ERROR() << fmt::format("Messages processing failed in consumer: {}",
+                               error_text);
+    TESTPOINT(fmt::format("tp_error_{}", component_name_), [&error_text] {
+      formats::json::ValueBuilder error_json;
+      error_json["error"] = error_text;
+      return error_json.ExtractValue();
+    }());
+    return false;
+  }
+}
+
+bool Consumer::ProcessPartitionsConcurrently(
+    const ConsumerScope::Callback& callback, std::vector<Message>& batch) {
+  const auto partitions = SplitByPartitions(batch);
+
+  engine::Semaphore concurrency{max_concurrent_partitions_};
+  std::vector<engine::TaskWithResult<bool>> tasks;
+  tasks.reserve(partitions.size());
+  for (const auto partition : partitions) {
+    tasks.push_back(utils::Async(
+        main_task_processor_, "partition_messages_processing",
+        [this, &callback, &concurrency, partition] {
+          const std::shared_lock lock{concurrency};
+          return ProcessBatch(callback, partition);
+        }));
+  }
+
+  std::vector<MessageBatchView> processed_partitions;
+  for (std::size_t i = 0; i < tasks.size(); ++i) {
+    if (tasks[i].Get()) {
+      processed_partitions.push_back(partitions[i]);
+    }
+  }
+
+  if (processed_partitions.size() == partitions.size()) {
+    return true;
+  }
+
+  /// @note Some partitions failed and are going to be polled again from the
+  /// last committed offsets. The processed ones must not come again.
+  consumer_->CommitProcessed(processed_partitions);
+  return false;
+}
+
 void Consumer::AsyncCommit() {
   UINVARIANT(processing_.load(), "Message processing is not currently started");
 
@@ -125,6 +180,19 @@ void Consumer::AsyncCommit() {
   }).Get();
 }
 
+std::shared_ptr<const rd_kafka_consumer_group_metadata_s>
+Consumer::GetGroupMetadata() {
+  UINVARIANT(processing_.load(), "Message processing is not currently started");
+
+  return utils::Async(consumer_task_processor_, "consumer_group_metadata",
+                      [this] {
+                        ExtendCurrentSpan();
+
+                        return consumer_->GetGroupMetadata();
+                      })
+      .Get();
+}
+
 void Consumer::Stop() noexcept {
   if (processing_.load() && poll_task_.IsValid()) {
     LOG_INFO() << "Consumer stopping";
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/kafka/consumer_scope.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
+struct rd_kafka_consumer_group_metadata_s;
+
 USERVER_NAMESPACE_BEGIN
 
 namespace kafka::impl {
@@ -29,12 +32,18 @@ class Consumer final {
   /// @param poll_timeout is a timeout for one message batch polling loop
   /// @param enable_auto_commit enables automatic periodically offsets
   /// committing. Note: if enabled, `AsyncCommit` should not be called manually
+  /// @param max_concurrent_partitions if greater than 1, the messages of each
+  /// partition of a polled batch are processed by a separate callback call,
+  /// no more than `max_concurrent_partitions` calls at once
+  /// @param lean_batch_mode disables the per message logs, which dominate the
+  /// polling CPU consumption on high-volume topics with small messages
   /// @param consumer_task_processor -- task processor for message batches
   /// polling
   /// All callbacks are invoked in `main_task_processor`
   Consumer(std::unique_ptr<Configuration> configuration,
            const std::vector<std::string>& topics, std::size_t max_batch_size,
            std::chrono::milliseconds poll_timeout, bool enable_auto_commit,
+           std::size_t max_concurrent_partitions, bool lean_batch_mode,
            engine::TaskProcessor& consumer_task_processor,
            engine::TaskProcessor& main_task_processor);
 
@@ -52,6 +61,11 @@ class Consumer final {
   /// @see impl/stats.hpp
   void DumpMetric(utils::statistics::Writer& writer) const;
 
+  /// @brief Returns the consumer group metadata, required to commit the
+  /// consumer offsets within a producer transaction.
+  /// @note Must be called while the message processing is started
+  std::shared_ptr<const rd_kafka_consumer_group_metadata_s> GetGroupMetadata();
+
  private:
   friend class kafka::ConsumerScope;
 
@@ -70,6 +84,19 @@ class Consumer final {
   /// @brief Adds consumer name to current span.
   void ExtendCurrentSpan() const;
 
+  /// @brief Calls `callback` in the current task and accounts the result.
+  /// @returns false if `callback` has thrown
+  bool ProcessBatch(const ConsumerScope::Callback& callback,
+                    MessageBatchView batch);
+
+  /// @brief Processes the messages of each partition of `batch` concurrently,
+  /// the messages of a partition are processed in order. If some partitions
+  /// fail, commits the offsets of the processed ones, so that only the
+  /// failed partitions are polled again after the resubscription.
+  /// @returns false if processing of any partition has failed
+  bool ProcessPartitionsConcurrently(const ConsumerScope::Callback& callback,
+                                     std::vector<Message>& batch);
+
  private:
   std::atomic<bool> processing_{false};
 
@@ -79,6 +106,7 @@ class Consumer final {
   const std::size_t max_batch_size_{};
   const std::chrono::milliseconds poll_timeout{};
   const bool enable_auto_commit_{};
+  const std::size_t max_concurrent_partitions_{};
 
   engine::TaskProcessor& consumer_task_processor_;
   engine::TaskProcessor& main_task_processor_;
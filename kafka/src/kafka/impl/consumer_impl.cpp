@@ -1,6 +1,9 @@
 #include <kafka/impl/consumer_impl.hpp>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <numeric>
 
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/testpoint.hpp>
@@ -40,17 +43,16 @@ std::optional<std::chrono::milliseconds> RetrieveTimestamp(
 }  // namespace
 
 struct Message::Data final {
-  Data(MessageHolder message_holder)
-      : message(std::move(message_holder)),
-        topic(rd_kafka_topic_name(message->rkt)),
-        timestamp(RetrieveTimestamp(message.get())) {}
+  Data(MessageHolder message_holder, const std::string& topic)
+      : message(std::move(message_holder)), topic(topic) {}
 
   Data(Data&& other) = default;
 
   MessageHolder message;
 
-  const std::string topic;
-  std::optional<std::chrono::milliseconds> timestamp;
+  /// @note points to the consumer's topic names cache, see
+  /// `ConsumerImpl::GetTopicName`
+  const std::string& topic;
 };
 
 Message::~Message() = default;
@@ -74,13 +76,36 @@ std::string_view Message::GetPayload() const {
 }
 
 std::optional<std::chrono::milliseconds> Message::GetTimestamp() const {
-  return data_->timestamp;
+  return RetrieveTimestamp(data_->message.get());
 }
 
 int Message::GetPartition() const { return data_->message->partition; }
 
 std::int64_t Message::GetOffset() const { return data_->message->offset; }
 
+std::optional<std::string_view> Message::GetHeader(
+    std::string_view name) const {
+  rd_kafka_headers_t* headers = nullptr;
+  if (rd_kafka_message_headers(data_->message.get(), &headers) !=
+      RD_KAFKA_RESP_ERR_NO_ERROR) {
+    return std::nullopt;
+  }
+
+  std::optional<std::string_view> header_value;
+  const char* header_name = nullptr;
+  const void* value = nullptr;
+  std::size_t value_size = 0;
+  for (std::size_t i = 0; rd_kafka_header_get_all(headers, i, &header_name,
+                                                  &value, &value_size) ==
+                          RD_KAFKA_RESP_ERR_NO_ERROR;
+       ++i) {
+    if (header_name == name) {
+      header_value.emplace(static_cast<const char*>(value), value_size);
+    }
+  }
+  return header_value;
+}
+
 Message::Message(Message::DataStorage data) : data_(std::move(data)) {}
 
 namespace impl {
@@ -151,8 +176,59 @@ void CallTestpoints(const rd_kafka_topic_partition_list_t* list,
   }
 }
 
+/// @brief Calls `func(topic, messages)` for each run of consecutive messages
+/// of the same topic, so that the per topic work is done once per run.
+template <typename Func>
+void ForEachTopicRun(MessageBatchView batch, Func func) {
+  std::size_t begin = 0;
+  for (std::size_t i = 1; i <= batch.size(); ++i) {
+    /// @note topic names are cached, the messages of a topic share one
+    if (i == batch.size() || &batch[begin].GetTopic() != &batch[i].GetTopic()) {
+      func(batch[begin].GetTopic(), batch.subspan(begin, i - begin));
+      begin = i;
+    }
+  }
+}
+
+bool IsSamePartition(const Message& lhs, const Message& rhs) {
+  return lhs.GetPartition() == rhs.GetPartition() &&
+         lhs.GetTopic() == rhs.GetTopic();
+}
+
 }  // namespace
 
+std::vector<MessageBatchView> SplitByPartitions(std::vector<Message>& batch) {
+  std::vector<std::size_t> order(batch.size());
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::stable_sort(order.begin(), order.end(),
+                   [&batch](std::size_t lhs, std::size_t rhs) {
+                     const auto& lhs_topic = batch[lhs].GetTopic();
+                     const auto& rhs_topic = batch[rhs].GetTopic();
+                     if (lhs_topic != rhs_topic) {
+                       return lhs_topic < rhs_topic;
+                     }
+                     return batch[lhs].GetPartition() <
+                            batch[rhs].GetPartition();
+                   });
+
+  std::vector<Message> grouped;
+  grouped.reserve(batch.size());
+  for (const auto index : order) {
+    grouped.push_back(std::move(batch[index]));
+  }
+  batch = std::move(grouped);
+
+  std::vector<MessageBatchView> partitions;
+  std::size_t begin = 0;
+  for (std::size_t i = 1; i <= batch.size(); ++i) {
+    if (i == batch.size() || !IsSamePartition(batch[begin], batch[i])) {
+      partitions.push_back(MessageBatchView{batch}.subspan(begin, i - begin));
+      begin = i;
+    }
+  }
+  return partitions;
+}
+
 ConsumerImpl::ConfHolder::ConfHolder(rd_kafka_conf_t* conf)
     : handle_(conf, &rd_kafka_conf_destroy) {}
 
@@ -179,10 +255,30 @@ ConsumerImpl::ConsumerHolder::ConsumerHolder(
 
   /// @note makes available to call `rd_kafka_consumer_poll`
   rd_kafka_poll_set_consumer(Handle());
+
+  /// @note the main queue with the callbacks is forwarded to the consumer
+  /// queue, so the notifications come for them too
+  queue_ = QueueHolder{rd_kafka_queue_get_consumer(Handle()),
+                       rd_kafka_queue_destroy};
+  static constexpr char kEventPayload = 1;
+  rd_kafka_queue_io_event_enable(queue_.get(), queue_events_.writer.Fd(),
+                                 &kEventPayload, sizeof(kEventPayload));
 }
 
 rd_kafka_t* ConsumerImpl::ConsumerHolder::Handle() { return handle_.get(); }
 
+bool ConsumerImpl::ConsumerHolder::WaitEvents(engine::Deadline deadline) {
+  if (!queue_events_.reader.WaitReadable(deadline)) {
+    return false;
+  }
+
+  /// @note drains the notifications, the events are taken by the polls
+  std::array<char, 64> payloads{};
+  [[maybe_unused]] const auto read_size =
+      queue_events_.reader.ReadSome(payloads.data(), payloads.size(), deadline);
+  return true;
+}
+
 void ConsumerImpl::AssignPartitions(
     const rd_kafka_topic_partition_list_t* partitions) {
   LOG_INFO() << "Assigning new partitions to consumer";
@@ -287,8 +383,10 @@ void ConsumerImpl::OffsetCommitCallbackProxy(
       /*skip_invalid_offsets=*/true);
 }
 
-ConsumerImpl::ConsumerImpl(std::unique_ptr<Configuration> configuration)
+ConsumerImpl::ConsumerImpl(std::unique_ptr<Configuration> configuration,
+                           bool lean_batch_mode)
     : component_name_(configuration->GetComponentName()),
+      lean_batch_mode_(lean_batch_mode),
       conf_([this, configuration = std::move(configuration)] {
         rd_kafka_conf_t* conf = configuration->Release();
         rd_kafka_conf_set_opaque(conf, this);
@@ -302,6 +400,8 @@ ConsumerImpl::ConsumerImpl(std::unique_ptr<Configuration> configuration)
 ConsumerImpl::~ConsumerImpl() = default;
 
 void ConsumerImpl::Subscribe(const std::vector<std::string>& topics) {
+  /// @note topic handles of the previous consumer are not valid anymore
+  topic_names_.clear();
   consumer_.emplace(conf_.MakeConfCopy());
 
   TopicPartitionsListHolder topic_partitions_list{
@@ -342,33 +442,72 @@ void ConsumerImpl::AsyncCommit() {
   rd_kafka_commit(consumer_->Handle(), nullptr, /*async=*/1);
 }
 
-std::optional<Message> ConsumerImpl::PollMessage(engine::Deadline deadline) {
-  if (deadline.IsReached()) {
-    return std::nullopt;
+void ConsumerImpl::CommitProcessed(
+    const std::vector<MessageBatchView>& partitions_batches) {
+  if (partitions_batches.empty()) {
+    return;
   }
 
-  const auto poll_timeout{std::chrono::duration_cast<std::chrono::milliseconds>(
-      deadline.TimeLeft())};
+  TopicPartitionsListHolder offsets{
+      rd_kafka_topic_partition_list_new(partitions_batches.size()),
+      &rd_kafka_topic_partition_list_destroy};
+  for (const auto batch : partitions_batches) {
+    UASSERT(!batch.empty());
+    const auto& last_message = batch[batch.size() - 1];
+    auto* topic_partition = rd_kafka_topic_partition_list_add(
+        offsets.get(), last_message.GetTopic().c_str(),
+        last_message.GetPartition());
+    /// @note committed offset is the offset of the next message to consume
+    topic_partition->offset = last_message.GetOffset() + 1;
+  }
 
-  LOG_DEBUG() << fmt::format("Polling message for {}ms", poll_timeout.count());
+  const auto err =
+      rd_kafka_commit(consumer_->Handle(), offsets.get(), /*async=*/0);
+  if (err != RD_KAFKA_RESP_ERR_NO_ERROR) {
+    LOG_ERROR() << fmt::format("Failed to commit processed offsets: {}",
+                               rd_kafka_err2str(err));
+  }
+}
 
-  MessageHolder message{
-      rd_kafka_consumer_poll(consumer_->Handle(),
-                             static_cast<int>(poll_timeout.count())),
-      &rd_kafka_message_destroy};
+std::shared_ptr<const rd_kafka_consumer_group_metadata_t>
+ConsumerImpl::GetGroupMetadata() {
+  return {rd_kafka_consumer_group_metadata(consumer_->Handle()),
+          &rd_kafka_consumer_group_metadata_destroy};
+}
 
-  if (message == nullptr) {
+std::optional<Message> ConsumerImpl::PollMessage(engine::Deadline deadline) {
+  if (deadline.IsReached()) {
     return std::nullopt;
   }
+
+  MessageHolder message{nullptr, &rd_kafka_message_destroy};
+  while (true) {
+    /// @note zero timeout makes the poll non-blocking: it serves the ready
+    /// callbacks and takes a message, if there is one
+    message.reset(
+        rd_kafka_consumer_poll(consumer_->Handle(), /*timeout_ms=*/0));
+    if (message != nullptr) {
+      break;
+    }
+
+    /// @note the queue notifies only on becoming non-empty, and it has been
+    /// drained by the poll above
+    if (!consumer_->WaitEvents(deadline)) {
+      return std::nullopt;
+    }
+  }
   if (message->err != RD_KAFKA_RESP_ERR_NO_ERROR) {
     LOG_WARNING() << fmt::format("Consumed message with error: {}",
                                  rd_kafka_err2str(message->err));
     return std::nullopt;
   }
 
-  Message polled_message{Message::DataStorage{std::move(message)}};
+  const auto& topic = GetTopicName(message->rkt);
+  Message polled_message{Message::DataStorage{std::move(message), topic}};
 
-  AccountPolledMessageStat(polled_message);
+  if (lean_batch_mode_) {
+    return polled_message;
+  }
 
   LOG_INFO() << fmt::format(
       "Message from kafka topic '{}' received by key '{}' with "
@@ -392,6 +531,7 @@ ConsumerImpl::MessageBatch ConsumerImpl::PollBatch(std::size_t max_batch_size,
   }
 
   if (!batch.empty()) {
+    AccountPolledBatchStat(batch);
     LOG_INFO() << fmt::format("Polled batch of {} messages", batch.size());
   }
 
@@ -405,43 +545,60 @@ std::shared_ptr<TopicStats> ConsumerImpl::GetTopicStats(
   return stats_.topics_stats[topic];
 }
 
-void ConsumerImpl::AccountPolledMessageStat(const Message& polled_message) {
-  auto topic_stats = GetTopicStats(polled_message.GetTopic());
-  ++topic_stats->messages_counts.messages_total;
-
-  const auto message_timestamp = polled_message.GetTimestamp();
-  if (message_timestamp) {
-    const auto take_time = std::chrono::system_clock::now().time_since_epoch();
-    const auto ms_duration =
-        std::chrono::duration_cast<std::chrono::milliseconds>(
-            take_time - message_timestamp.value())
-            .count();
-    topic_stats->avg_ms_spent_time.GetCurrentCounter().Account(ms_duration);
-  } else {
-    LOG_WARNING() << fmt::format(
-        "No timestamp in messages to topic '{}' by key '{}'",
-        polled_message.GetTopic(), polled_message.GetKey());
+const std::string& ConsumerImpl::GetTopicName(const rd_kafka_topic_t* topic) {
+  auto it = topic_names_.find(topic);
+  if (it == topic_names_.end()) {
+    it = topic_names_.emplace(topic, rd_kafka_topic_name(topic)).first;
   }
+  return it->second;
 }
+
+void ConsumerImpl::AccountPolledBatchStat(MessageBatchView batch) {
+  const auto take_time = std::chrono::system_clock::now().time_since_epoch();
+  ForEachTopicRun(batch, [this, take_time](const std::string& topic,
+                                           MessageBatchView messages) {
+    auto topic_stats = GetTopicStats(topic);
+    topic_stats->messages_counts.messages_total += messages.size();
+
+    auto& spent_time = topic_stats->avg_ms_spent_time.GetCurrentCounter();
+    for (const auto& message : messages) {
+      const auto message_timestamp = message.GetTimestamp();
+      if (message_timestamp) {
+        const auto ms_duration =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                take_time - message_timestamp.value())
+                .count();
+        spent_time.Account(ms_duration);
+      } else if (!lean_batch_mode_) {
+        LOG_WARNING() << fmt::format(
+            "No timestamp in messages to topic '{}' by key '{}'", topic,
+            message.GetKey());
+      }
+    }
+  });
+}
+
 void ConsumerImpl::AccountMessageProcessingSucceeded(const Message& message) {
   ++GetTopicStats(message.GetTopic())->messages_counts.messages_success;
 }
 
 void ConsumerImpl::AccountMessageBatchProcessingSucceeded(
-    const MessageBatch& batch) {
-  for (const auto& message : batch) {
-    AccountMessageProcessingSucceeded(message);
-  }
+    MessageBatchView batch) {
+  ForEachTopicRun(batch, [this](const std::string& topic,
+                                MessageBatchView messages) {
+    GetTopicStats(topic)->messages_counts.messages_success += messages.size();
+  });
 }
 void ConsumerImpl::AccountMessageProcessingFailed(const Message& message) {
   ++GetTopicStats(message.GetTopic())->messages_counts.messages_error;
 }
 
 void ConsumerImpl::AccountMessageBatchProcessingFailed(
-    const MessageBatch& batch) {
-  for (const auto& message : batch) {
-    AccountMessageProcessingFailed(message);
-  }
+    MessageBatchView batch) {
+  ForEachTopicRun(batch, [this](const std::string& topic,
+                                MessageBatchView messages) {
+    GetTopicStats(topic)->messages_counts.messages_error += messages.size();
+  });
 }
 
 }  // namespace impl
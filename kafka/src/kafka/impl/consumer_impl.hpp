@@ -1,9 +1,12 @@
 #pragma once
 
 #include <optional>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/kafka/message.hpp>
 
 #include <kafka/impl/stats.hpp>
@@ -17,6 +20,11 @@ namespace kafka::impl {
 class Configuration;
 struct TopicStats;
 
+/// @brief Reorders `batch` so that the messages of each partition are
+/// contiguous, keeping their order within the partition.
+/// @returns views of the messages of each partition
+std::vector<MessageBatchView> SplitByPartitions(std::vector<Message>& batch);
+
 /// @brief Consumer implementation based on `librdkafka`.
 /// @warning All methods calls the `librdkafka` functions that very often uses
 /// pthread mutexes. Hence, all methods must not be called in main task
@@ -25,7 +33,10 @@ class ConsumerImpl final {
   using MessageBatch = std::vector<Message>;
 
  public:
-  explicit ConsumerImpl(std::unique_ptr<Configuration> configuration);
+  /// @param lean_batch_mode disables the per message logging, only the
+  /// per batch logs are written
+  ConsumerImpl(std::unique_ptr<Configuration> configuration,
+               bool lean_batch_mode);
 
   ~ConsumerImpl();
 
@@ -47,9 +58,19 @@ class ConsumerImpl final {
   /// @brief Schedules the commitment task.
   void AsyncCommit();
 
+  /// @brief Synchronously commits the offsets next to the last messages of
+  /// the `partitions_batches`, each batch holding messages of one partition.
+  void CommitProcessed(const std::vector<MessageBatchView>& partitions_batches);
+
+  /// @brief Returns the consumer group metadata, required to commit the
+  /// consumer offsets within a producer transaction.
+  std::shared_ptr<const rd_kafka_consumer_group_metadata_t> GetGroupMetadata();
+
   /// @brief Polls the message until `deadline` is reached.
   /// If no message polled, returns `std::nullopt`
   /// @note Must be called periodically to maintain consumer group membership
+  /// @note Does not block the thread while waiting: the task sleeps until
+  /// `librdkafka` notifies that the consumer queue has new events
   std::optional<Message> PollMessage(engine::Deadline deadline);
 
   /// @brief Effectively calls `PollMessage` until `deadline` is reached
@@ -59,9 +80,9 @@ class ConsumerImpl final {
   const Stats& GetStats() const;
 
   void AccountMessageProcessingSucceeded(const Message& message);
-  void AccountMessageBatchProcessingSucceeded(const MessageBatch& batch);
+  void AccountMessageBatchProcessingSucceeded(MessageBatchView batch);
   void AccountMessageProcessingFailed(const Message& message);
-  void AccountMessageBatchProcessingFailed(const MessageBatch& batch);
+  void AccountMessageBatchProcessingFailed(MessageBatchView batch);
 
   void ErrorCallbackProxy(int error_code, const char* reason);
 
@@ -86,12 +107,20 @@ class ConsumerImpl final {
  private:
   std::shared_ptr<TopicStats> GetTopicStats(const std::string& topic);
 
-  void AccountPolledMessageStat(const Message& polled_message);
+  /// @brief Returns the cached name of the `topic`, so that messages do not
+  /// copy it.
+  const std::string& GetTopicName(const rd_kafka_topic_t* topic);
+
+  void AccountPolledBatchStat(MessageBatchView batch);
 
  private:
   const std::string component_name_;
+  const bool lean_batch_mode_;
   Stats stats_;
 
+  /// @note entries must outlive the polled messages, cleared on subscription
+  std::unordered_map<const rd_kafka_topic_t*, std::string> topic_names_;
+
   class ConsumerHolder;
   class ConfHolder final {
     using HandleHolder =
@@ -129,10 +158,21 @@ class ConsumerImpl final {
 
     rd_kafka_t* Handle();
 
+    /// @brief Waits until the consumer queue gets new events.
+    /// @returns false if `deadline` is reached or the task is cancelled
+    bool WaitEvents(engine::Deadline deadline);
+
    private:
     using HandleHolder =
         std::unique_ptr<rd_kafka_t, decltype(&rd_kafka_destroy)>;
+    using QueueHolder =
+        std::unique_ptr<rd_kafka_queue_t, decltype(&rd_kafka_queue_destroy)>;
+
+    /// @note `librdkafka` writes to the pipe each time the consumer queue
+    /// becomes non-empty, so the pipe must outlive the handle
+    engine::io::Pipe queue_events_;
     HandleHolder handle_{nullptr, rd_kafka_destroy};
+    QueueHolder queue_{nullptr, rd_kafka_queue_destroy};
   };
   std::optional<ConsumerHolder> consumer_;
 };
@@ -1,5 +1,7 @@
 #include <kafka/impl/delivery_waiter.hpp>
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace kafka::impl {
@@ -30,24 +32,87 @@ bool DeliveryResult::IsSuccess() const {
           *message_status_ == RD_KAFKA_MSG_STATUS_PERSISTED);
 }
 
-DeliveryWaiter::DeliveryWaiter(std::uint32_t current_retry,
+DeliveryHandle::DeliveryHandle(std::uint32_t current_retry,
                                std::uint32_t max_retries)
     : current_retry_(current_retry), max_retries_(max_retries) {}
 
-engine::Future<DeliveryResult> DeliveryWaiter::GetFuture() {
-  return wait_handle_.get_future();
+bool DeliveryHandle::FirstSend() const { return current_retry_ == 0; }
+
+bool DeliveryHandle::LastRetry() const {
+  return current_retry_ == max_retries_;
 }
 
-bool DeliveryWaiter::FirstSend() const { return current_retry_ == 0; }
+DeliveryWaiter::DeliveryWaiter(std::uint32_t current_retry,
+                               std::uint32_t max_retries)
+    : DeliveryHandle(current_retry, max_retries) {}
 
-bool DeliveryWaiter::LastRetry() const {
-  return current_retry_ == max_retries_;
+engine::Future<DeliveryResult> DeliveryWaiter::GetFuture() {
+  return wait_handle_.get_future();
 }
 
 void DeliveryWaiter::SetDeliveryResult(DeliveryResult delivery_result) {
   wait_handle_.set_value(std::move(delivery_result));
 }
 
+namespace {
+
+class BatchMessageHandle final : public DeliveryHandle {
+ public:
+  BatchMessageHandle(std::shared_ptr<BatchDeliveryWaiter> waiter,
+                     std::size_t index, std::uint32_t current_retry,
+                     std::uint32_t max_retries)
+      : DeliveryHandle(current_retry, max_retries),
+        waiter_(std::move(waiter)),
+        index_(index) {}
+
+  void SetDeliveryResult(DeliveryResult delivery_result) override {
+    waiter_->SetDeliveryResult(index_, std::move(delivery_result));
+  }
+
+ private:
+  /// @note shared, because the waiting task may be cancelled before all the
+  /// delivery reports come
+  const std::shared_ptr<BatchDeliveryWaiter> waiter_;
+  const std::size_t index_;
+};
+
+}  // namespace
+
+BatchDeliveryWaiter::BatchDeliveryWaiter(std::size_t messages_count)
+    : results_(messages_count), remaining_(messages_count) {
+  if (messages_count == 0) {
+    wait_handle_.set_value();
+  }
+}
+
+engine::Future<void> BatchDeliveryWaiter::GetFuture() {
+  return wait_handle_.get_future();
+}
+
+std::unique_ptr<DeliveryHandle> BatchDeliveryWaiter::MakeHandle(
+    std::shared_ptr<BatchDeliveryWaiter> waiter, std::size_t index,
+    std::uint32_t current_retry, std::uint32_t max_retries) {
+  UASSERT(waiter && index < waiter->results_.size());
+  return std::make_unique<BatchMessageHandle>(std::move(waiter), index,
+                                              current_retry, max_retries);
+}
+
+void BatchDeliveryWaiter::SetDeliveryResult(std::size_t index,
+                                            DeliveryResult delivery_result) {
+  UASSERT(!results_[index].has_value());
+  results_[index].emplace(std::move(delivery_result));
+
+  /// @note acq_rel makes all the results visible to the last setter, and it
+  /// publishes them to the waiter with the promise
+  if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    wait_handle_.set_value();
+  }
+}
+
+std::vector<std::optional<DeliveryResult>>& BatchDeliveryWaiter::GetResults() {
+  return results_;
+}
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
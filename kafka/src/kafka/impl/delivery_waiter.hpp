@@ -1,6 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
 
 #include <userver/engine/future.hpp>
 
@@ -31,27 +35,66 @@ class DeliveryResult {
   const std::optional<rd_kafka_msg_status_t> message_status_;
 };
 
-/// @brief State for waiting delivery callback invoked after producer send
-/// called
-class DeliveryWaiter {
+/// @brief State passed as the `opaque` of a produced message. Its
+/// `SetDeliveryResult` is called by the delivery report callback, which
+/// then destroys the handle
+class DeliveryHandle {
  public:
-  DeliveryWaiter(std::uint32_t current_retry, std::uint32_t max_retries);
+  DeliveryHandle(std::uint32_t current_retry, std::uint32_t max_retries);
 
-  engine::Future<DeliveryResult> GetFuture();
+  virtual ~DeliveryHandle() = default;
 
   bool FirstSend() const;
 
   bool LastRetry() const;
 
-  void SetDeliveryResult(DeliveryResult delivery_result);
+  virtual void SetDeliveryResult(DeliveryResult delivery_result) = 0;
 
  private:
   const std::uint32_t current_retry_;
   const std::uint32_t max_retries_;
+};
+
+/// @brief State for waiting delivery callback invoked after producer send
+/// called
+class DeliveryWaiter final : public DeliveryHandle {
+ public:
+  DeliveryWaiter(std::uint32_t current_retry, std::uint32_t max_retries);
+
+  engine::Future<DeliveryResult> GetFuture();
 
+  void SetDeliveryResult(DeliveryResult delivery_result) override;
+
+ private:
   engine::Promise<DeliveryResult> wait_handle_;
 };
 
+/// @brief State for waiting the delivery of all messages of a batch with a
+/// single future
+class BatchDeliveryWaiter final {
+ public:
+  explicit BatchDeliveryWaiter(std::size_t messages_count);
+
+  /// @brief Future becomes ready when all the messages results are set
+  engine::Future<void> GetFuture();
+
+  /// @brief Makes the handle to pass as the `opaque` of the message with
+  /// `index` in the batch
+  static std::unique_ptr<DeliveryHandle> MakeHandle(
+      std::shared_ptr<BatchDeliveryWaiter> waiter, std::size_t index,
+      std::uint32_t current_retry, std::uint32_t max_retries);
+
+  void SetDeliveryResult(std::size_t index, DeliveryResult delivery_result);
+
+  /// @note Must be called only after the future is ready
+  std::vector<std::optional<DeliveryResult>>& GetResults();
+
+ private:
+  std::vector<std::optional<DeliveryResult>> results_;
+  std::atomic<std::size_t> remaining_;
+  engine::Promise<void> wait_handle_;
+};
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
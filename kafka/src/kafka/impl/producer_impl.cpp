@@ -8,6 +8,9 @@
 #include <kafka/impl/error_buffer.hpp>
 #include <kafka/impl/stats.hpp>
 
+#include <algorithm>
+#include <map>
+#include <numeric>
 #include <utility>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +37,25 @@ void DeliveryReportCallback(rd_kafka_t* producer,
   static_cast<ProducerImpl*>(opaque_ptr)->DeliveryReportCallbackProxy(message);
 }
 
+using ErrorHolder =
+    std::unique_ptr<rd_kafka_error_t, decltype(&rd_kafka_error_destroy)>;
+
+using TopicPartitionsListHolder =
+    std::unique_ptr<rd_kafka_topic_partition_list_t,
+                    decltype(&rd_kafka_topic_partition_list_destroy)>;
+
+/// @note -1 timeout makes `librdkafka` wait for `transaction.timeout.ms`
+constexpr int kTransactionTimeoutMs = -1;
+
+void ThrowIfError(ErrorHolder error, std::string_view operation) {
+  if (error == nullptr) {
+    return;
+  }
+
+  throw std::runtime_error{fmt::format("Failed to {}: {}", operation,
+                                       rd_kafka_error_string(error.get()))};
+}
+
 std::chrono::milliseconds GetMessageLatencySeconds(
     const rd_kafka_message_t* message) {
   const std::chrono::microseconds message_latency_micro{
@@ -103,7 +125,7 @@ void ProducerImpl::DeliveryReportCallbackProxy(
 
   const char* topic_name = rd_kafka_topic_name(message->rkt);
 
-  auto* complete_handle = static_cast<DeliveryWaiter*>(message->_private);
+  auto* complete_handle = static_cast<DeliveryHandle*>(message->_private);
 
   auto& topic_stats = stats_.topics_stats[topic_name];
   if (complete_handle->FirstSend()) {
@@ -143,7 +165,8 @@ void ProducerImpl::DeliveryReportCallbackProxy(
 }
 
 ProducerImpl::ProducerImpl(std::unique_ptr<Configuration> configuration)
-    : producer_([this, configuration = std::move(configuration)] {
+    : is_transactional_(configuration->IsTransactional()),
+      producer_([this, configuration = std::move(configuration)] {
         rd_kafka_conf_t* conf = configuration->Release();
         rd_kafka_conf_set_opaque(conf, this);
         rd_kafka_conf_set_error_cb(conf, &ErrorCallback);
@@ -183,6 +206,154 @@ void ProducerImpl::Send(const std::string& topic_name, std::string_view key,
   }
 }
 
+std::vector<DeliveryStatus> ProducerImpl::SendBatch(
+    const std::string& topic_name, utils::span<const ProducerMessage> messages,
+    const std::uint32_t max_retries) const {
+  LOG_INFO() << fmt::format(
+      "Batch of {} messages to topic '{}' is requested to send",
+      messages.size(), topic_name);
+
+  std::vector<DeliveryStatus> statuses(messages.size(),
+                                       DeliveryStatus::kFailed);
+  std::vector<std::size_t> pending(messages.size());
+  std::iota(pending.begin(), pending.end(), std::size_t{0});
+
+  for (std::uint32_t current_retry = 0;
+       !pending.empty() && current_retry <= max_retries; ++current_retry) {
+    auto waiter = std::make_shared<BatchDeliveryWaiter>(pending.size());
+    auto wait_handle = waiter->GetFuture();
+
+    std::size_t enqueue_failures = 0;
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+      const auto& message = messages[pending[i]];
+      auto handle = BatchDeliveryWaiter::MakeHandle(waiter, i, current_retry,
+                                                    max_retries);
+      const auto enqueue_error = Enqueue(topic_name, message.key,
+                                         message.payload, message.partition,
+                                         handle.get());
+      if (enqueue_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+        ++enqueue_failures;
+        handle->SetDeliveryResult(DeliveryResult{enqueue_error});
+      } else {
+        /// @note the delivery report callback owns the handle now
+        [[maybe_unused]] auto* _ = handle.release();
+      }
+    }
+    if (enqueue_failures != 0) {
+      LOG_WARNING() << fmt::format(
+          "Failed to enqueue {} messages of batch to Kafka local queue",
+          enqueue_failures);
+    }
+
+    /// wait until delivery report callback is invoked for all the messages:
+    /// @see DeliveryCallbackProxy
+    wait_handle.get();
+
+    std::vector<std::size_t> retried;
+    auto& results = waiter->GetResults();
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+      const auto& result = *results[i];
+      if (result.IsSuccess()) {
+        statuses[pending[i]] = DeliveryStatus::kDelivered;
+      } else if (current_retry != max_retries && result.IsRetryable()) {
+        retried.push_back(pending[i]);
+      }
+    }
+
+    if (!retried.empty()) {
+      LOG_WARNING() << fmt::format(
+          "Send requests of {} messages of batch failed, but errors may be "
+          "transient, retrying... (retries left: {})",
+          retried.size(), max_retries - current_retry);
+    }
+    pending = std::move(retried);
+  }
+
+  return statuses;
+}
+
+void ProducerImpl::BeginTransaction() {
+  if (!is_transactional_) {
+    throw std::runtime_error{
+        "Transactions require `transactional_id` in producer config"};
+  }
+
+  if (!transactions_initialized_) {
+    ThrowIfError({rd_kafka_init_transactions(producer_.Handle(),
+                                             kTransactionTimeoutMs),
+                  &rd_kafka_error_destroy},
+                 "init transactions");
+    transactions_initialized_ = true;
+    LOG_INFO() << "Producer transactions initialized";
+  }
+
+  ThrowIfError({rd_kafka_begin_transaction(producer_.Handle()),
+                &rd_kafka_error_destroy},
+               "begin transaction");
+}
+
+void ProducerImpl::SendOffsetsToTransaction(
+    const rd_kafka_consumer_group_metadata_s* group_metadata,
+    MessageBatchView messages) {
+  std::map<std::pair<std::string_view, int>, std::int64_t> next_offsets;
+  for (const auto& message : messages) {
+    auto& offset =
+        next_offsets[{message.GetTopic(), message.GetPartition()}];
+    /// @note committed offset is the offset of the next message to consume
+    offset = std::max(offset, message.GetOffset() + 1);
+  }
+
+  TopicPartitionsListHolder offsets{
+      rd_kafka_topic_partition_list_new(next_offsets.size()),
+      &rd_kafka_topic_partition_list_destroy};
+  for (const auto& [topic_partition, offset] : next_offsets) {
+    // topic names of the messages are null-terminated std::string
+    auto* partition_offset = rd_kafka_topic_partition_list_add(
+        offsets.get(), topic_partition.first.data(), topic_partition.second);
+    partition_offset->offset = offset;
+  }
+
+  ThrowIfError({rd_kafka_send_offsets_to_transaction(
+                    producer_.Handle(), offsets.get(), group_metadata,
+                    kTransactionTimeoutMs),
+                &rd_kafka_error_destroy},
+               "send offsets to transaction");
+}
+
+void ProducerImpl::CommitTransaction(const std::uint32_t max_retries) {
+  for (std::uint32_t current_retry = 0;; ++current_retry) {
+    ErrorHolder error{
+        rd_kafka_commit_transaction(producer_.Handle(), kTransactionTimeoutMs),
+        &rd_kafka_error_destroy};
+    if (error == nullptr) {
+      LOG_INFO() << "Transaction committed";
+      return;
+    }
+
+    if (rd_kafka_error_txn_requires_abort(error.get())) {
+      LOG_WARNING() << fmt::format("Transaction requires abort: {}",
+                                   rd_kafka_error_string(error.get()));
+      AbortTransaction();
+    } else if (rd_kafka_error_is_retriable(error.get()) &&
+               current_retry < max_retries) {
+      LOG_WARNING() << fmt::format(
+          "Transaction commit failed, but error may be transient, "
+          "retrying... (retries left: {})",
+          max_retries - current_retry);
+      continue;
+    }
+    ThrowIfError(std::move(error), "commit transaction");
+  }
+}
+
+void ProducerImpl::AbortTransaction() {
+  ThrowIfError({rd_kafka_abort_transaction(producer_.Handle(),
+                                           kTransactionTimeoutMs),
+                &rd_kafka_error_destroy},
+               "abort transaction");
+  LOG_INFO() << "Transaction aborted";
+}
+
 void ProducerImpl::Poll(std::chrono::milliseconds poll_timeout) const {
   rd_kafka_poll(producer_.Handle(), static_cast<int>(poll_timeout.count()));
 }
@@ -196,6 +367,27 @@ DeliveryResult ProducerImpl::SendImpl(const std::string& topic_name,
   auto waiter = std::make_unique<DeliveryWaiter>(current_retry, max_retries);
   auto wait_handle = waiter->GetFuture();
 
+  const rd_kafka_resp_err_t enqueue_error =
+      Enqueue(topic_name, key, message, partition, waiter.get());
+  if (enqueue_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+    LOG_WARNING() << fmt::format(
+        "Failed to enqueue message to Kafka local queue: {}",
+        rd_kafka_err2str(enqueue_error));
+
+    return DeliveryResult{enqueue_error};
+  }
+  /// @note the delivery report callback owns the `waiter` now
+  [[maybe_unused]] auto* _ = waiter.release();
+
+  /// wait until delivery report callback is invoked:
+  /// @see DeliveryCallbackProxy
+  return wait_handle.get();
+}
+
+rd_kafka_resp_err_t ProducerImpl::Enqueue(
+    const std::string& topic_name, std::string_view key,
+    std::string_view message, std::optional<std::uint32_t> partition,
+    DeliveryHandle* handle) const {
   /// `rd_kafka_producev` does not block at all. It only enqueues
   /// the message to the local queue to be send in future by `librdkafka`
   /// internal thread
@@ -207,9 +399,8 @@ DeliveryResult ProducerImpl::SendImpl(const std::string& topic_name,
   /// https://github.com/confluentinc/librdkafka/blob/master/src/rdkafka.h#L4698
   /// for understanding of `msgflags` argument
   ///
-  /// It is safe to release the `waiter` because (i)
-  /// `rd_kafka_producev` does not throws, therefore it owns the `waiter`,
-  /// (ii) delivery report callback fries its memory
+  /// If enqueue succeeds, `librdkafka` owns the `handle` and the delivery
+  /// report callback fries its memory
   ///
   /// const qualifier remove for `message` is required because of
   /// the `librdkafka` API requirements. If `msgflags` set to
@@ -221,31 +412,21 @@ DeliveryResult ProducerImpl::SendImpl(const std::string& topic_name,
 #pragma clang diagnostic ignored "-Wgnu-statement-expression"
 #endif
 
-  // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks,cppcoreguidelines-pro-type-const-cast)
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
   const rd_kafka_resp_err_t enqueue_error = rd_kafka_producev(
       producer_.Handle(), RD_KAFKA_V_TOPIC(topic_name.c_str()),
       RD_KAFKA_V_KEY(key.data(), key.size()),
       RD_KAFKA_V_VALUE(const_cast<char*>(message.data()), message.size()),
       RD_KAFKA_V_MSGFLAGS(0),
       RD_KAFKA_V_PARTITION(partition.value_or(RD_KAFKA_PARTITION_UA)),
-      RD_KAFKA_V_OPAQUE(waiter.release()), RD_KAFKA_V_END);
-  // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks,cppcoreguidelines-pro-type-const-cast)
+      RD_KAFKA_V_OPAQUE(handle), RD_KAFKA_V_END);
+  // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
 
 #ifdef __clang__
 #pragma clang diagnostic pop
 #endif
 
-  if (enqueue_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
-    LOG_WARNING() << fmt::format(
-        "Failed to enqueue message to Kafka local queue: {}",
-        rd_kafka_err2str(enqueue_error));
-
-    return DeliveryResult{enqueue_error};
-  }
-
-  /// wait until delivery report callback is invoked:
-  /// @see DeliveryCallbackProxy
-  return wait_handle.get();
+  return enqueue_error;
 }
 
 const Stats& ProducerImpl::GetStats() const { return stats_; }
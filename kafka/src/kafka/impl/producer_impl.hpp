@@ -4,6 +4,11 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <vector>
+
+#include <userver/kafka/message.hpp>
+#include <userver/kafka/producer.hpp>
+#include <userver/utils/span.hpp>
 
 #include <kafka/impl/delivery_waiter.hpp>
 #include <kafka/impl/stats.hpp>
@@ -29,6 +34,35 @@ class ProducerImpl final {
             std::string_view message, std::optional<std::uint32_t> partition,
             std::uint32_t max_retries) const;
 
+  /// @brief Sends all the `messages` and waits for their delivery with a
+  /// single future. Retries the transiently failed messages all together.
+  /// @returns delivery statuses of the `messages`
+  std::vector<DeliveryStatus> SendBatch(
+      const std::string& topic_name,
+      utils::span<const ProducerMessage> messages,
+      std::uint32_t max_retries) const;
+
+  /// @brief Begins a new transaction, initializing the producer transactions
+  /// on the first call.
+  /// @throws std::runtime_error if producer is not transactional or the
+  /// transaction cannot be started
+  void BeginTransaction();
+
+  /// @brief Adds the offsets next to the `messages` to the current transaction,
+  /// so that they are committed to the consumer group with the transaction.
+  void SendOffsetsToTransaction(
+      const rd_kafka_consumer_group_metadata_s* group_metadata,
+      MessageBatchView messages);
+
+  /// @brief Commits the current transaction, retrying the retriable errors
+  /// at most `max_retries` times. If the transaction cannot be committed,
+  /// aborts it.
+  /// @throws std::runtime_error if the transaction is not committed
+  void CommitTransaction(std::uint32_t max_retries);
+
+  /// @brief Aborts the current transaction, purging its messages.
+  void AbortTransaction();
+
   /// @brief Polls for delivery events for `poll_timeout_` milliseconds
   void Poll(std::chrono::milliseconds poll_timeout) const;
 
@@ -49,9 +83,19 @@ class ProducerImpl final {
                           std::uint32_t current_retry,
                           std::uint32_t max_retries) const;
 
+  /// @brief Enqueues the message without waiting for its delivery.
+  /// @note Takes the ownership of the `handle` iff enqueue succeeds
+  rd_kafka_resp_err_t Enqueue(const std::string& topic_name,
+                              std::string_view key, std::string_view message,
+                              std::optional<std::uint32_t> partition,
+                              DeliveryHandle* handle) const;
+
  private:
   Stats stats_;
 
+  const bool is_transactional_;
+  bool transactions_initialized_{false};
+
   class ProducerHolder final {
    public:
     ProducerHolder(rd_kafka_conf_t* conf);
@@ -6,7 +6,10 @@
 #include <userver/utils/async.hpp>
 #include <userver/utils/text_light.hpp>
 
+#include <userver/kafka/consumer_scope.hpp>
+
 #include <kafka/impl/configuration.hpp>
+#include <kafka/impl/consumer.hpp>
 #include <kafka/impl/producer_impl.hpp>
 #include <kafka/impl/stats.hpp>
 
@@ -99,6 +102,74 @@ engine::TaskWithResult<void> Producer::SendAsync(
       });
 }
 
+engine::TaskWithResult<std::vector<DeliveryStatus>> Producer::SendBatch(
+    std::string topic_name, std::vector<ProducerMessage> messages) const {
+  InitProducerAndStartPollingIfFirstSend();
+
+  return utils::Async(
+      producer_task_processor_, "producer_send_batch",
+      [this, topic_name = std::move(topic_name),
+       messages = std::move(messages)] {
+        ExtendCurrentSpan();
+
+        auto statuses =
+            producer_->SendBatch(topic_name, messages, send_retries_);
+
+        for (std::size_t i = 0; i < messages.size(); ++i) {
+          if (statuses[i] == DeliveryStatus::kDelivered) {
+            SendToTestPoint(topic_name, messages[i].key, messages[i].payload);
+          }
+        }
+
+        return statuses;
+      });
+}
+
+void Producer::BeginTransaction() {
+  InitProducerAndStartPollingIfFirstSend();
+
+  utils::Async(producer_task_processor_, "producer_begin_transaction", [this] {
+    ExtendCurrentSpan();
+
+    producer_->BeginTransaction();
+  }).Get();
+}
+
+void Producer::SendOffsetsToTransaction(ConsumerScope& consumer_scope,
+                                        MessageBatchView messages) {
+  InitProducerAndStartPollingIfFirstSend();
+
+  const auto group_metadata = consumer_scope.consumer_.GetGroupMetadata();
+  utils::Async(producer_task_processor_, "producer_send_offsets",
+               [this, &group_metadata, messages] {
+                 ExtendCurrentSpan();
+
+                 producer_->SendOffsetsToTransaction(group_metadata.get(),
+                                                     messages);
+               })
+      .Get();
+}
+
+void Producer::CommitTransaction() {
+  InitProducerAndStartPollingIfFirstSend();
+
+  utils::Async(producer_task_processor_, "producer_commit_transaction", [this] {
+    ExtendCurrentSpan();
+
+    producer_->CommitTransaction(send_retries_);
+  }).Get();
+}
+
+void Producer::AbortTransaction() {
+  InitProducerAndStartPollingIfFirstSend();
+
+  utils::Async(producer_task_processor_, "producer_abort_transaction", [this] {
+    ExtendCurrentSpan();
+
+    producer_->AbortTransaction();
+  }).Get();
+}
+
 void Producer::DumpMetric(utils::statistics::Writer& writer) const {
   if (!first_send_.load()) {
     impl::DumpMetric(writer, producer_->GetStats());
@@ -4,6 +4,10 @@
 /// @brief @copybrief components::MongoCache
 
 #include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -11,13 +15,20 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/cache/mongo_cache_type_traits.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/binary.hpp>
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
 #include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -30,10 +41,29 @@ inline const std::string kFetchAndParseStage = "fetch_and_parse";
 inline constexpr std::chrono::milliseconds kCpuRelaxThreshold{10};
 inline constexpr std::chrono::milliseconds kCpuRelaxInterval{2};
 
+inline constexpr std::chrono::milliseconds kChangeStreamMaxAwaitTime{50};
+
 namespace impl {
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 
+std::size_t GetMongoCacheFullUpdateParallelRanges(const ComponentConfig&);
+
+bool GetMongoCacheChangeStreamsEnabled(const ComponentConfig&);
+
+/// True for the events after which the change stream can not be resumed
+bool IsChangeStreamInvalidated(std::string_view operation_type);
+
+inline constexpr std::size_t kFullUpdateSamplesPerRange = 100;
+
+inline std::string GetIdForLog(const formats::bson::Document& doc) {
+  return doc["_id"].ConvertTo<std::string>();
+}
+
+inline std::string GetIdForLog(formats::bson::DocumentView doc) {
+  return GetIdForLog(doc.ToDocument());
+}
+
 }
 
 // clang-format off
@@ -52,6 +82,44 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// update-correction | adjusts incremental updates window to overlap with previous update | 0
+/// full-update-parallel-ranges | number of `_id` ranges to read concurrently on full updates, 1 disables the splitting | 1
+/// change-streams | apply the change events of the collection on incremental updates instead of querying the update field | false
+///
+/// ### Parallel full updates
+/// With `full-update-parallel-ranges` greater than 1 a full update first
+/// samples the collection to split it into that many `_id` ranges of about
+/// the same size, then fetches and parses the ranges concurrently, each over
+/// its own connection. Parsed objects are merged into the cache in range
+/// order. If the sample yields fewer than two ranges, e.g. for a small
+/// collection, a single cursor is used as usual.
+///
+/// The mode requires the default find operation and `_id` values of the same
+/// BSON type across the collection, as range queries only match a single type.
+///
+/// ### Change streams
+/// With `change-streams: true` an incremental update reads the change events
+/// of the collection that happened since the previous update and applies
+/// them to a copy of the cache, instead of scanning the `kMongoUpdateFieldName`
+/// index. Deleted documents are removed from the cache as well. A full update
+/// remembers the position of the stream before loading the collection, so
+/// the changes made during the load are applied by the next incremental
+/// update. If the stream can not be resumed, e.g. after the collection was
+/// dropped or renamed, a full update is made instead.
+///
+/// The position is stored in the cache dumps, so an incremental update right
+/// after a restart from a dump does not load the whole collection. The dumps
+/// of the mode are not compatible with the ones written without it.
+///
+/// The mode requires a replica set or a sharded cluster, the default find
+/// operation and the following function in traits to get the cache key from
+/// the `documentKey` of the delete events:
+///
+/// ```
+///   static KeyType GetKeyFromDocumentKey(
+///       const formats::bson::Document& document_key) {
+///     return document_key["_id"].As<KeyType>();
+///   }
+/// ```
 ///
 /// ## Traits example:
 /// All fields below (except for function overrides) are mandatory.
@@ -89,6 +157,11 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   static ObjectType DeserializeObject(const formats::bson::Document& doc) {
 ///     return doc["value"].As<ObjectType>();
 ///   }
+///   // or, to parse the documents in place in the driver reply buffer
+///   // without copying them
+///   static ObjectType DeserializeObject(formats::bson::DocumentView doc) {
+///     return {doc["name"].As<std::string>(), doc["value"].As<int>()};
+///   }
 ///   // (default implementation calls doc.As<ObjectType>())
 ///   // For using default implementation
 ///   static constexpr bool kUseDefaultDeserializeObject = true;
@@ -134,13 +207,27 @@ class MongoCache
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  // Position of the change stream for the cache contents at `data`
+  struct ChangeStreamState {
+    const typename MongoCacheTraits::DataType* data{nullptr};
+    std::optional<formats::bson::Document> resume_token;
+  };
+
   void Update(cache::UpdateType type,
               const std::chrono::system_clock::time_point& last_update,
               const std::chrono::system_clock::time_point& now,
               cache::UpdateStatisticsScope& stats_scope) override;
 
+  void WriteContents(dump::Writer& writer,
+                     const typename MongoCacheTraits::DataType& contents)
+      const override;
+
+  std::unique_ptr<const typename MongoCacheTraits::DataType> ReadContents(
+      dump::Reader& reader) const override;
+
+  template <typename DocumentType>
   typename MongoCacheTraits::ObjectType DeserializeObject(
-      const formats::bson::Document& doc) const;
+      const DocumentType& doc) const;
 
   storages::mongo::operations::Find GetFindOperation(
       cache::UpdateType type,
@@ -151,10 +238,34 @@ class MongoCache
   std::unique_ptr<typename MongoCacheTraits::DataType> GetData(
       cache::UpdateType type);
 
+  std::vector<formats::bson::Value> GetFullUpdateSplitPoints();
+
+  void FullUpdateParallel(
+      const std::vector<formats::bson::Value>& split_points,
+      cache::UpdateStatisticsScope& stats_scope,
+      std::optional<formats::bson::Document> resume_token);
+
+  storages::mongo::ChangeStream OpenChangeStream(
+      std::optional<formats::bson::Document> resume_token);
+
+  // Returns false if a full update is required
+  bool ChangeStreamUpdate(cache::UpdateStatisticsScope& stats_scope);
+
+  void SetData(std::unique_ptr<typename MongoCacheTraits::DataType> data,
+               std::optional<formats::bson::Document> resume_token);
+
+  static void InsertObject(typename MongoCacheTraits::DataType& data,
+                           typename MongoCacheTraits::ObjectType&& object,
+                           cache::UpdateType type);
+
   const std::shared_ptr<CollectionsType> mongo_collections_;
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
+  const std::size_t full_update_parallel_ranges_;
+  const bool change_streams_enabled_;
   std::size_t cpu_relax_iterations_{0};
+  // Updated by Update() and ReadContents(), read by WriteContents()
+  mutable concurrent::Variable<ChangeStreamState> change_stream_state_;
 };
 
 template <class MongoCacheTraits>
@@ -172,7 +283,10 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
               .template GetCollectionForLibrary<CollectionsType>()),
       mongo_collection_(std::addressof(
           mongo_collections_.get()->*MongoCacheTraits::kMongoCollectionsField)),
-      correction_(impl::GetMongoCacheUpdateCorrection(config)) {
+      correction_(impl::GetMongoCacheUpdateCorrection(config)),
+      full_update_parallel_ranges_(
+          impl::GetMongoCacheFullUpdateParallelRanges(config)),
+      change_streams_enabled_(impl::GetMongoCacheChangeStreamsEnabled(config)) {
   [[maybe_unused]] mongo_cache::impl::CheckTraits<MongoCacheTraits>
       check_traits;
 
@@ -192,6 +306,21 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
         "config for '{}' cache",
         components::GetCurrentComponentName(config)));
   }
+  if (full_update_parallel_ranges_ > 1 &&
+      !mongo_cache::impl::kHasDefaultFindOperation<MongoCacheTraits>) {
+    throw std::logic_error(fmt::format(
+        "Parallel full updates are requested in config but traits of '{}' "
+        "cache override the find operation",
+        components::GetCurrentComponentName(config)));
+  }
+  if (change_streams_enabled_ &&
+      (!mongo_cache::impl::kHasDefaultFindOperation<MongoCacheTraits> ||
+       !mongo_cache::impl::kHasKeyFromDocumentKey<MongoCacheTraits>)) {
+    throw std::logic_error(fmt::format(
+        "Change streams are requested in config but traits of '{}' cache "
+        "override the find operation or do not specify GetKeyFromDocumentKey",
+        components::GetCurrentComponentName(config)));
+  }
 
   this->StartPeriodicUpdates();
 }
@@ -209,6 +338,24 @@ void MongoCache<MongoCacheTraits>::Update(
     cache::UpdateStatisticsScope& stats_scope) {
   namespace sm = storages::mongo;
 
+  std::optional<formats::bson::Document> resume_token;
+  if (change_streams_enabled_) {
+    if (type == cache::UpdateType::kIncremental) {
+      if (ChangeStreamUpdate(stats_scope)) return;
+      type = cache::UpdateType::kFull;
+    }
+    // The changes made during the load are applied on the next update
+    resume_token = OpenChangeStream(std::nullopt).GetResumeToken();
+  }
+
+  if (type == cache::UpdateType::kFull && full_update_parallel_ranges_ > 1) {
+    const auto split_points = GetFullUpdateSplitPoints();
+    if (!split_points.empty()) {
+      FullUpdateParallel(split_points, stats_scope, std::move(resume_token));
+      return;
+    }
+  }
+
   const auto* collection = mongo_collection_;
   auto find_op = GetFindOperation(type, last_update, now, correction_);
   auto cursor = collection->Execute(find_op);
@@ -228,7 +375,7 @@ void MongoCache<MongoCacheTraits>::Update(
   utils::CpuRelax relax{cpu_relax_iterations_, &scope};
   std::size_t doc_count = 0;
 
-  for (const auto& doc : cursor) {
+  const auto process_document = [&](const auto& doc) {
     ++doc_count;
 
     relax.Relax();
@@ -236,25 +383,23 @@ void MongoCache<MongoCacheTraits>::Update(
     stats_scope.IncreaseDocumentsReadCount(1);
 
     try {
-      auto object = DeserializeObject(doc);
-      auto key = (object.*MongoCacheTraits::kKeyField);
-
-      if (type == cache::UpdateType::kIncremental ||
-          new_cache->count(key) == 0) {
-        (*new_cache)[key] = std::move(object);
-      } else {
-        LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
-                            << MongoCacheTraits::kName << ", key=" << key;
-      }
+      InsertObject(*new_cache, DeserializeObject(doc), type);
     } catch (const std::exception& e) {
       LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
-                          << MongoCacheTraits::kName << ", _id="
-                          << doc["_id"].template ConvertTo<std::string>()
+                          << MongoCacheTraits::kName
+                          << ", _id=" << impl::GetIdForLog(doc)
                           << ", what(): " << e;
       stats_scope.IncreaseDocumentsParseFailures(1);
 
       if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
     }
+  };
+
+  if constexpr (mongo_cache::impl::kHasDocumentViewDeserializeObject<
+                    MongoCacheTraits>) {
+    cursor.ForEachView(process_document);
+  } else {
+    for (const auto& doc : cursor) process_document(doc);
   }
 
   const auto elapsed_time = scope.ElapsedTotal(kFetchAndParseStage);
@@ -270,20 +415,20 @@ void MongoCache<MongoCacheTraits>::Update(
   scope.Reset();
 
   const auto size = new_cache->size();
-  this->Set(std::move(new_cache));
+  SetData(std::move(new_cache), std::move(resume_token));
   stats_scope.Finish(size);
 }
 
 template <class MongoCacheTraits>
+template <typename DocumentType>
 typename MongoCacheTraits::ObjectType
-MongoCache<MongoCacheTraits>::DeserializeObject(
-    const formats::bson::Document& doc) const {
+MongoCache<MongoCacheTraits>::DeserializeObject(const DocumentType& doc) const {
   if constexpr (mongo_cache::impl::kHasDeserializeObject<MongoCacheTraits>) {
     return MongoCacheTraits::DeserializeObject(doc);
   }
   if constexpr (mongo_cache::impl::kHasDefaultDeserializeObject<
                     MongoCacheTraits>) {
-    return doc.As<typename MongoCacheTraits::ObjectType>();
+    return doc.template As<typename MongoCacheTraits::ObjectType>();
   }
   UASSERT_MSG(false,
               "No deserialize operation defined but DeserializeObject invoked");
@@ -336,6 +481,290 @@ MongoCache<MongoCacheTraits>::GetData(cache::UpdateType type) {
   }
 }
 
+template <class MongoCacheTraits>
+std::vector<formats::bson::Value>
+MongoCache<MongoCacheTraits>::GetFullUpdateSplitPoints() {
+  namespace bson = formats::bson;
+  namespace sm = storages::mongo;
+
+  const auto buckets = static_cast<std::int64_t>(full_update_parallel_ranges_);
+  const auto sample_size =
+      buckets * static_cast<std::int64_t>(impl::kFullUpdateSamplesPerRange);
+  sm::operations::Aggregate aggregate(bson::MakeArray(
+      bson::MakeDoc("$sample", bson::MakeDoc("size", sample_size)),
+      bson::MakeDoc("$bucketAuto",
+                    bson::MakeDoc("groupBy", "$_id", "buckets", buckets))));
+  if (MongoCacheTraits::kIsSecondaryPreferred) {
+    aggregate.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+
+  // Aggregations may write with $out, so they need a non-const collection
+  auto collection = *mongo_collection_;
+
+  // Buckets are sorted by _id, the lower bound of the first one is skipped
+  // to leave the first range unbounded
+  std::vector<bson::Value> split_points;
+  bool is_first = true;
+  for (const auto& bucket : collection.Execute(aggregate)) {
+    if (!is_first) split_points.push_back(bucket["_id"]["min"]);
+    is_first = false;
+  }
+  return split_points;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::FullUpdateParallel(
+    const std::vector<formats::bson::Value>& split_points,
+    cache::UpdateStatisticsScope& stats_scope,
+    std::optional<formats::bson::Document> resume_token) {
+  namespace bson = formats::bson;
+  namespace sm = storages::mongo;
+
+  struct RangeResult {
+    std::vector<typename MongoCacheTraits::ObjectType> objects;
+    std::size_t documents_read{0};
+    std::size_t parse_failures{0};
+  };
+
+  auto scope =
+      tracing::Span::CurrentSpan().CreateScopeTime(kFetchAndParseStage);
+
+  std::vector<engine::TaskWithResult<RangeResult>> tasks;
+  tasks.reserve(split_points.size() + 1);
+  for (std::size_t i = 0; i <= split_points.size(); ++i) {
+    bson::ValueBuilder id_range(bson::ValueBuilder::Type::kObject);
+    if (i > 0) id_range["$gte"] = split_points[i - 1];
+    if (i < split_points.size()) id_range["$lt"] = split_points[i];
+
+    sm::operations::Find find_op(
+        bson::MakeDoc("_id", id_range.ExtractValue()));
+    if (MongoCacheTraits::kIsSecondaryPreferred) {
+      find_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+    }
+
+    tasks.push_back(utils::Async(
+        "mongo_cache_range", [this, find_op = std::move(find_op)] {
+          RangeResult result;
+          utils::CpuRelax relax{cpu_relax_iterations_, nullptr};
+
+          const auto process_document = [&](const auto& doc) {
+            relax.Relax();
+            ++result.documents_read;
+
+            try {
+              result.objects.push_back(DeserializeObject(doc));
+            } catch (const std::exception& e) {
+              LOG_LIMITED_ERROR()
+                  << "Failed to deserialize cache item of cache "
+                  << MongoCacheTraits::kName
+                  << ", _id=" << impl::GetIdForLog(doc) << ", what(): " << e;
+              ++result.parse_failures;
+
+              if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+            }
+          };
+
+          auto cursor = mongo_collection_->Execute(find_op);
+          if constexpr (mongo_cache::impl::kHasDocumentViewDeserializeObject<
+                            MongoCacheTraits>) {
+            cursor.ForEachView(process_document);
+          } else {
+            for (const auto& doc : cursor) process_document(doc);
+          }
+          return result;
+        }));
+  }
+
+  // Cache containers are not concurrent, so only the fetching and parsing
+  // run in parallel, and the objects are merged here
+  auto new_cache = GetData(cache::UpdateType::kFull);
+  utils::CpuRelax relax{cpu_relax_iterations_, &scope};
+  for (auto& task : tasks) {
+    auto result = task.Get();
+    stats_scope.IncreaseDocumentsReadCount(result.documents_read);
+    stats_scope.IncreaseDocumentsParseFailures(result.parse_failures);
+
+    for (auto& object : result.objects) {
+      relax.Relax();
+      InsertObject(*new_cache, std::move(object), cache::UpdateType::kFull);
+    }
+  }
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  SetData(std::move(new_cache), std::move(resume_token));
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+storages::mongo::ChangeStream MongoCache<MongoCacheTraits>::OpenChangeStream(
+    std::optional<formats::bson::Document> resume_token) {
+  namespace sm = storages::mongo;
+
+  sm::operations::Watch watch_op;
+  if (resume_token) {
+    watch_op.SetOption(sm::options::ResumeAfter{std::move(*resume_token)});
+  }
+  watch_op.SetOption(sm::options::FullDocumentUpdateLookup{});
+  watch_op.SetOption(sm::options::MaxAwaitTime{kChangeStreamMaxAwaitTime});
+  return mongo_collection_->Execute(watch_op);
+}
+
+template <class MongoCacheTraits>
+bool MongoCache<MongoCacheTraits>::ChangeStreamUpdate(
+    cache::UpdateStatisticsScope& stats_scope) {
+  std::optional<formats::bson::Document> resume_token;
+  {
+    const auto state = change_stream_state_.Lock();
+    resume_token = state->resume_token;
+  }
+  if (!resume_token) {
+    LOG_INFO() << "No change stream position for cache "
+               << MongoCacheTraits::kName << ", making a full update";
+    return false;
+  }
+
+  storages::mongo::ChangeStream stream =
+      OpenChangeStream(std::move(resume_token));
+  auto scope =
+      tracing::Span::CurrentSpan().CreateScopeTime(kFetchAndParseStage);
+  std::unique_ptr<typename MongoCacheTraits::DataType> new_cache;
+  const auto get_new_cache = [&]() -> auto& {
+    if (!new_cache) new_cache = GetData(cache::UpdateType::kIncremental);
+    return *new_cache;
+  };
+
+  // Events are read until the server has none left, i.e. all the changes
+  // since the last update are applied
+  while (std::optional<formats::bson::Document> event = stream.Next()) {
+    const auto operation_type = (*event)["operationType"].As<std::string>();
+    if (impl::IsChangeStreamInvalidated(operation_type)) {
+      LOG_WARNING() << "Change stream of cache " << MongoCacheTraits::kName
+                    << " is invalidated by '" << operation_type
+                    << "' event, making a full update";
+      return false;
+    }
+
+    if (operation_type == "delete") {
+      if constexpr (mongo_cache::impl::kHasKeyFromDocumentKey<
+                        MongoCacheTraits>) {
+        get_new_cache().erase(MongoCacheTraits::GetKeyFromDocumentKey(
+            (*event)["documentKey"].As<formats::bson::Document>()));
+      }
+      continue;
+    }
+
+    // Insert, update and replace events. The document is missing if it was
+    // deleted before the lookup, its delete event follows.
+    const formats::bson::Value full_document = (*event)["fullDocument"];
+    if (full_document.IsMissing() || full_document.IsNull()) continue;
+
+    const formats::bson::Document doc{full_document};
+    stats_scope.IncreaseDocumentsReadCount(1);
+    try {
+      InsertObject(get_new_cache(), DeserializeObject(doc),
+                   cache::UpdateType::kIncremental);
+    } catch (const std::exception& e) {
+      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                          << MongoCacheTraits::kName
+                          << ", _id=" << impl::GetIdForLog(doc)
+                          << ", what(): " << e;
+      stats_scope.IncreaseDocumentsParseFailures(1);
+
+      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+    }
+  }
+
+  scope.Reset();
+
+  // The token advances past the events that do not pass the filters as well
+  std::optional<formats::bson::Document> new_resume_token =
+      stream.GetResumeToken();
+  if (!new_cache) {
+    {
+      auto state = change_stream_state_.Lock();
+      state->resume_token = std::move(new_resume_token);
+    }
+    LOG_INFO() << "No changes in cache " << MongoCacheTraits::kName;
+    stats_scope.FinishNoChanges();
+    return true;
+  }
+
+  const auto size = new_cache->size();
+  SetData(std::move(new_cache), std::move(new_resume_token));
+  stats_scope.Finish(size);
+  return true;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::SetData(
+    std::unique_ptr<typename MongoCacheTraits::DataType> data,
+    std::optional<formats::bson::Document> resume_token) {
+  if (change_streams_enabled_) {
+    auto state = change_stream_state_.Lock();
+    state->data = data.get();
+    state->resume_token = std::move(resume_token);
+  }
+  this->Set(std::move(data));
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::WriteContents(
+    dump::Writer& writer,
+    const typename MongoCacheTraits::DataType& contents) const {
+  if (change_streams_enabled_) {
+    // An empty position makes the next update after a restart a full one.
+    // It is written if the contents are not the ones the position is for,
+    // e.g. if they were replaced right after being taken for the dump.
+    std::string resume_token;
+    {
+      const auto state = change_stream_state_.Lock();
+      if (state->data == &contents && state->resume_token) {
+        resume_token =
+            formats::bson::ToBinaryString(*state->resume_token).ToString();
+      }
+    }
+    writer.Write(resume_token);
+  }
+  CachingComponentBase<typename MongoCacheTraits::DataType>::WriteContents(
+      writer, contents);
+}
+
+template <class MongoCacheTraits>
+std::unique_ptr<const typename MongoCacheTraits::DataType>
+MongoCache<MongoCacheTraits>::ReadContents(dump::Reader& reader) const {
+  std::optional<formats::bson::Document> resume_token;
+  if (change_streams_enabled_) {
+    const auto binary = reader.Read<std::string>();
+    if (!binary.empty()) resume_token = formats::bson::FromBinaryString(binary);
+  }
+
+  auto contents =
+      CachingComponentBase<typename MongoCacheTraits::DataType>::ReadContents(
+          reader);
+  if (change_streams_enabled_) {
+    auto state = change_stream_state_.Lock();
+    state->data = contents.get();
+    state->resume_token = std::move(resume_token);
+  }
+  return contents;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::InsertObject(
+    typename MongoCacheTraits::DataType& data,
+    typename MongoCacheTraits::ObjectType&& object, cache::UpdateType type) {
+  auto key = (object.*MongoCacheTraits::kKeyField);
+
+  if (type == cache::UpdateType::kIncremental || data.count(key) == 0) {
+    data[key] = std::move(object);
+  } else {
+    LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
+                        << MongoCacheTraits::kName << ", key=" << key;
+  }
+}
+
 namespace impl {
 
 std::string GetMongoCacheSchema();
@@ -11,7 +11,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::bson {
 class Document;
-}
+class DocumentView;
+}  // namespace formats::bson
 
 namespace storages::mongo::operations {
 class Find;
@@ -63,6 +64,15 @@ template <typename T>
 inline constexpr bool kHasCorrectDeserializeObject =
     meta::kIsDetected<HasCorrectDeserializeObject, T>;
 
+template <typename T>
+using HasDocumentViewDeserializeObject =
+    meta::ExpectSame<typename T::ObjectType,
+                     decltype(std::declval<const T&>().DeserializeObject(
+                         std::declval<formats::bson::DocumentView>()))>;
+template <typename T>
+inline constexpr bool kHasDocumentViewDeserializeObject =
+    meta::kIsDetected<HasDocumentViewDeserializeObject, T>;
+
 template <typename T>
 using HasDefaultDeserializeObject = decltype(T::kUseDefaultDeserializeObject);
 template <typename T>
@@ -94,6 +104,15 @@ template <typename T>
 inline constexpr bool kHasDefaultFindOperation =
     meta::kIsDetected<HasDefaultFindOperation, T>;
 
+template <typename T>
+using HasKeyFromDocumentKey =
+    meta::ExpectSame<typename T::KeyType,
+                     decltype(T::GetKeyFromDocumentKey(
+                         std::declval<const formats::bson::Document&>()))>;
+template <typename T>
+inline constexpr bool kHasKeyFromDocumentKey =
+    meta::kIsDetected<HasKeyFromDocumentKey, T>;
+
 template <typename T>
 using HasInvalidDocumentsSkipped = decltype(T::kAreInvalidDocumentsSkipped);
 template <typename T>
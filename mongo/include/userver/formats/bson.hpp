@@ -5,6 +5,7 @@
 
 #include <userver/formats/bson/binary.hpp>
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
 #include <userver/formats/bson/exception.hpp>
 #include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/iterator.hpp>
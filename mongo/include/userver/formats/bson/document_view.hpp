@@ -0,0 +1,173 @@
+#pragma once
+
+/// @file userver/formats/bson/document_view.hpp
+/// @brief @copybrief formats::bson::DocumentView
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include <bson/bson.h>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/formats/parse/to.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+class DocumentView;
+
+/// @brief Non-owning read-only view of a BSON document element.
+///
+/// Values are read in place from the binary the view was created over, no
+/// formats::bson::Value tree is built. The view is only valid while the
+/// binary is alive.
+///
+/// Parsing is customized with
+/// `T Parse(const formats::bson::ValueView&, formats::parse::To<T>)`.
+class ValueView final {
+ public:
+  /// Constructs a missing value
+  ValueView() noexcept;
+
+  /// Element name, empty for missing and top-level values
+  std::string_view GetName() const;
+
+  /// @brief Nested document member access
+  /// @returns missing value if there is no such member
+  /// @throws TypeMismatchException if the value is not a document
+  ValueView operator[](std::string_view name) const;
+
+  /// @brief Parses the value
+  /// @throws MemberMissingException if the value is missing
+  /// @throws TypeMismatchException if the value has an incompatible type
+  template <typename T>
+  T As() const {
+    return Parse(*this, formats::parse::To<T>{});
+  }
+
+  /// Parses the value, returns `default_value` if it is missing or `null`
+  template <typename T>
+  T As(T default_value) const {
+    if (IsMissing() || IsNull()) return default_value;
+    return As<T>();
+  }
+
+  bool IsMissing() const noexcept;
+  bool IsNull() const;
+  bool IsBool() const;
+  bool IsInt32() const;
+  bool IsInt64() const;
+  bool IsDouble() const;
+  bool IsString() const;
+  bool IsDateTime() const;
+  bool IsOid() const;
+  bool IsDocument() const;
+  bool IsArray() const;
+
+  /// @cond
+  /// Native type access, internal use only
+  explicit ValueView(const bson_iter_t& iter) noexcept;
+
+  bson_type_t GetType() const;
+  const bson_iter_t& GetNative() const;
+
+  void CheckNotMissing() const;
+  /// @endcond
+
+ private:
+  bson_iter_t iter_{};
+  bool is_missing_{true};
+};
+
+/// @brief Non-owning read-only view of a BSON document.
+///
+/// Iterates fields in place over the binary, e.g. over a reply buffer of
+/// storages::mongo::Cursor::ForEachView, without copying it. Member access
+/// is a linear scan, so prefer iteration when reading most of the fields.
+///
+/// The view is only valid while the binary is alive.
+class DocumentView final {
+ public:
+  class Iterator final {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = ValueView;
+    using reference = ValueView;
+    using pointer = void;
+
+    Iterator() noexcept = default;
+
+    ValueView operator*() const;
+    Iterator& operator++();
+
+    bool operator==(const Iterator& other) const noexcept;
+    bool operator!=(const Iterator& other) const noexcept;
+
+   private:
+    friend class DocumentView;
+    explicit Iterator(const bson_iter_t& iter);
+
+    bson_iter_t iter_{};
+    bool is_end_{true};
+  };
+
+  /// @brief Views a BSON document binary
+  /// @throws ParseException if the binary is not a BSON document
+  explicit DocumentView(std::string_view binary);
+
+  /// Views an owned document, the document must outlive the view
+  /* implicit */ DocumentView(const Document& document);
+
+  /// @returns missing value if there is no such member
+  ValueView operator[](std::string_view name) const;
+
+  bool HasMember(std::string_view name) const;
+  bool IsEmpty() const;
+
+  Iterator begin() const;
+  Iterator end() const;
+
+  /// Viewed binary
+  std::string_view GetBinary() const;
+
+  /// Copies the viewed document
+  Document ToDocument() const;
+
+ private:
+  bson_iter_t MakeIter() const;
+
+  const std::uint8_t* data_;
+  std::size_t size_;
+};
+
+bool Parse(const ValueView& value, parse::To<bool>);
+
+std::int32_t Parse(const ValueView& value, parse::To<std::int32_t>);
+
+std::int64_t Parse(const ValueView& value, parse::To<std::int64_t>);
+
+double Parse(const ValueView& value, parse::To<double>);
+
+std::string Parse(const ValueView& value, parse::To<std::string>);
+
+/// The string is viewed in place
+std::string_view Parse(const ValueView& value, parse::To<std::string_view>);
+
+std::chrono::system_clock::time_point Parse(
+    const ValueView& value, parse::To<std::chrono::system_clock::time_point>);
+
+Oid Parse(const ValueView& value, parse::To<Oid>);
+
+/// The subdocument is viewed in place
+DocumentView Parse(const ValueView& value, parse::To<DocumentView>);
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,96 @@
+#pragma once
+
+/// @file userver/storages/mongo/bulk_batcher.hpp
+/// @brief @copybrief storages::mongo::BulkBatcher
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/value.hpp>
+#include <userver/storages/mongo/bulk_ops.hpp>
+#include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+/// BulkBatcher settings
+struct BulkBatcherSettings {
+  /// Maximum time for the first queued write to wait for others
+  std::chrono::milliseconds max_delay{1};
+
+  /// Maximum number of writes in a single bulk operation
+  std::size_t max_batch_size{1000};
+
+  /// Write concern of bulk operations
+  options::WriteConcern::Level write_concern{
+      options::WriteConcern::kMajority};
+};
+
+/// Result of a single write coalesced by storages::mongo::BulkBatcher
+struct BatchedWriteResult {
+  /// `_id` of the upserted document, if any
+  std::optional<formats::bson::Value> upserted_id;
+};
+
+/// @brief Coalesces independent writes of concurrent callers into unordered
+/// bulk operations over a single collection.
+///
+/// Each write waits for up to `max_delay` to be sent along with the writes of
+/// other callers, or less if `max_batch_size` writes are queued earlier. A
+/// server error of a write is thrown to its caller only, writes of other
+/// callers in the same batch are not affected. Write concern and network
+/// errors are thrown to all callers of the batch.
+///
+/// As the writes are unordered, callers must not rely on the order of writes
+/// of different callers. Writes of one caller are ordered as long as each
+/// next write is issued after the previous one returns.
+///
+/// @warning Per-write affected documents counters are not available, use
+/// separate operations if they are required.
+class BulkBatcher {
+ public:
+  BulkBatcher(Collection collection, BulkBatcherSettings settings);
+
+  /// Fails the queued writes with storages::mongo::CancelledException
+  ~BulkBatcher();
+
+  BulkBatcher(const BulkBatcher&) = delete;
+  BulkBatcher& operator=(const BulkBatcher&) = delete;
+
+  /// Inserts a single document
+  void InsertOne(formats::bson::Document document);
+
+  /// Replaces a single matching document
+  BatchedWriteResult ReplaceOne(formats::bson::Document selector,
+                                formats::bson::Document replacement,
+                                bool upsert = false);
+
+  /// Updates a single matching document
+  BatchedWriteResult UpdateOne(formats::bson::Document selector,
+                               formats::bson::Document update,
+                               bool upsert = false);
+
+  /// Deletes a single matching document
+  void DeleteOne(formats::bson::Document selector);
+
+  /// @name Prepared sub-operation writers
+  /// @{
+  BatchedWriteResult Write(bulk_ops::InsertOne);
+  BatchedWriteResult Write(bulk_ops::ReplaceOne);
+  BatchedWriteResult Write(bulk_ops::Update);
+  BatchedWriteResult Write(bulk_ops::Delete);
+  /// @}
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
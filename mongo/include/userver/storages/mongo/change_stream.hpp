@@ -0,0 +1,48 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief Stream of the change events of a collection
+///
+/// Holds a connection of the pool until destroyed. The change streams require
+/// a replica set or a sharded cluster.
+class ChangeStream {
+ public:
+  explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+  ~ChangeStream();
+
+  ChangeStream(ChangeStream&&) noexcept;
+  ChangeStream& operator=(ChangeStream&&) noexcept;
+
+  /// @brief Returns the next change event
+  ///
+  /// Returns `std::nullopt` if no event has arrived for options::MaxAwaitTime,
+  /// the stream may be read again afterwards.
+  std::optional<formats::bson::Document> Next();
+
+  /// @brief Returns the token to resume the stream after the last returned
+  /// event with options::ResumeAfter
+  ///
+  /// The token advances even if no events were returned by Next().
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+ private:
+  std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -12,6 +12,7 @@
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/value.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -125,6 +126,13 @@ class Collection {
   template <typename... Options>
   Cursor Aggregate(formats::bson::Value pipeline, Options&&... options);
 
+  /// @brief Opens a change stream of the collection
+  /// @see options::ResumeAfter
+  /// @see options::FullDocumentUpdateLookup
+  /// @see options::MaxAwaitTime
+  template <typename... Options>
+  ChangeStream Watch(Options&&... options) const;
+
   /// Get collection name
   const std::string& GetCollectionName() const;
 
@@ -142,6 +150,7 @@ class Collection {
   WriteResult Execute(const operations::FindAndRemove&);
   WriteResult Execute(operations::Bulk&&);
   Cursor Execute(const operations::Aggregate&);
+  ChangeStream Execute(const operations::Watch&) const;
   void Execute(const operations::Drop&);
   /// @}
  private:
@@ -304,6 +313,13 @@ Cursor Collection::Aggregate(formats::bson::Value pipeline,
   return Execute(aggregate);
 }
 
+template <typename... Options>
+ChangeStream Collection::Watch(Options&&... options) const {
+  operations::Watch watch;
+  (watch.SetOption(std::forward<Options>(options)), ...);
+  return Execute(watch);
+}
+
 }  // namespace storages::mongo
 
 USERVER_NAMESPACE_END
@@ -3,10 +3,12 @@
 /// @file userver/storages/mongo/cursor.hpp
 /// @brief @copybrief storages::mongo::Cursor
 
+#include <functional>
 #include <iterator>
 #include <memory>
 
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -61,6 +63,14 @@ class Cursor {
   Iterator begin();
   Iterator end();
 
+  /// @brief Iterates over the remaining documents without copying them out
+  /// of the driver reply buffer.
+  ///
+  /// A view is only valid during the `func` call, the cursor is exhausted
+  /// afterwards.
+  void ForEachView(
+      const std::function<void(formats::bson::DocumentView)>& func);
+
  private:
   std::unique_ptr<impl::CursorImpl> impl_;
 };
@@ -339,6 +339,34 @@ class Aggregate {
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// @brief Opens a change stream of the collection
+/// @see https://docs.mongodb.com/manual/changeStreams/
+class Watch {
+ public:
+  Watch();
+  /// @param pipeline an array of aggregation stages to filter the events
+  explicit Watch(formats::bson::Value pipeline);
+  ~Watch();
+
+  Watch(const Watch&);
+  Watch(Watch&&) noexcept;
+  Watch& operator=(const Watch&);
+  Watch& operator=(Watch&&) noexcept;
+
+  void SetOption(options::ReadConcern);
+  void SetOption(const options::ResumeAfter&);
+  void SetOption(options::FullDocumentUpdateLookup);
+  void SetOption(const options::MaxAwaitTime&);
+
+ private:
+  friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+  class Impl;
+  static constexpr size_t kSize = 120;
+  static constexpr size_t kAlignment = 8;
+  utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 class Drop {
  public:
   Drop();
@@ -300,6 +300,37 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Specifies the time a change stream waits for new events on the
+/// server before returning an empty batch
+/// @see https://docs.mongodb.com/manual/reference/method/db.collection.watch/
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
+/// @brief Resumes a change stream after the event with the specified token
+/// @see https://docs.mongodb.com/manual/changeStreams/#resume-a-change-stream
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document token)
+      : token_(std::move(token)) {}
+
+  const formats::bson::Document& Value() const { return token_; }
+
+ private:
+  formats::bson::Document token_;
+};
+
+/// @brief Makes a change stream return the current version of the whole
+/// document for the update events
+class FullDocumentUpdateLookup {};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
@@ -12,6 +12,20 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(
   return config["update-correction"].As<std::chrono::milliseconds>(0);
 }
 
+std::size_t GetMongoCacheFullUpdateParallelRanges(
+    const ComponentConfig& config) {
+  return config["full-update-parallel-ranges"].As<std::size_t>(1);
+}
+
+bool GetMongoCacheChangeStreamsEnabled(const ComponentConfig& config) {
+  return config["change-streams"].As<bool>(false);
+}
+
+bool IsChangeStreamInvalidated(std::string_view operation_type) {
+  return operation_type == "invalidate" || operation_type == "drop" ||
+         operation_type == "rename" || operation_type == "dropDatabase";
+}
+
 std::string GetMongoCacheSchema() {
   return R"(
 type: object
@@ -22,6 +36,15 @@ properties:
         type: string
         description: adjusts incremental updates window to overlap with previous update
         defaultDescription: 0
+    full-update-parallel-ranges:
+        type: integer
+        description: number of _id ranges to read concurrently on full updates, 1 disables the splitting
+        defaultDescription: 1
+        minimum: 1
+    change-streams:
+        type: boolean
+        description: apply the change events of the collection on incremental updates instead of querying the update field
+        defaultDescription: false
 )";
 }
 
@@ -2,6 +2,7 @@
 
 #include <userver/cache/update_type.hpp>
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
 #include <userver/storages/mongo/operations.hpp>
 
 #include <gtest/gtest.h>
@@ -14,6 +15,12 @@ struct CorrectDeserializeObject {
   static ObjectType DeserializeObject(const formats::bson::Document&);
 };
 
+struct DocumentViewDeserializeObject {
+  using ObjectType = int;
+
+  static ObjectType DeserializeObject(formats::bson::DocumentView);
+};
+
 struct IncorrectReturnTypeOfDeserializeObject {
   static void DeserializeObject(const formats::bson::Document&);
 };
@@ -53,6 +60,18 @@ struct IncorrectSignatureOfFindOperation {
   static storages::mongo::operations::Find GetFindOperation(int x, int y);
 };
 
+struct CorrectKeyFromDocumentKey {
+  using KeyType = int;
+
+  static KeyType GetKeyFromDocumentKey(const formats::bson::Document&);
+};
+
+struct IncorrectReturnTypeOfKeyFromDocumentKey {
+  using KeyType = int;
+
+  static std::string GetKeyFromDocumentKey(const formats::bson::Document&);
+};
+
 TEST(CheckTraits, DeserializeObject) {
   EXPECT_TRUE(mongo_cache::impl::kHasCorrectDeserializeObject<
               CorrectDeserializeObject>);
@@ -60,6 +79,13 @@ TEST(CheckTraits, DeserializeObject) {
                IncorrectReturnTypeOfDeserializeObject>);
   EXPECT_FALSE(mongo_cache::impl::kHasCorrectDeserializeObject<
                IncorrectSignatureOfFindOperation>);
+
+  EXPECT_TRUE(mongo_cache::impl::kHasCorrectDeserializeObject<
+              DocumentViewDeserializeObject>);
+  EXPECT_TRUE(mongo_cache::impl::kHasDocumentViewDeserializeObject<
+              DocumentViewDeserializeObject>);
+  EXPECT_FALSE(mongo_cache::impl::kHasDocumentViewDeserializeObject<
+               CorrectDeserializeObject>);
 }
 
 TEST(CheckTraits, FindOperation) {
@@ -71,6 +97,15 @@ TEST(CheckTraits, FindOperation) {
                IncorrectSignatureOfFindOperation>);
 }
 
+TEST(CheckTraits, KeyFromDocumentKey) {
+  EXPECT_TRUE(mongo_cache::impl::kHasKeyFromDocumentKey<
+              CorrectKeyFromDocumentKey>);
+  EXPECT_FALSE(mongo_cache::impl::kHasKeyFromDocumentKey<
+               IncorrectReturnTypeOfKeyFromDocumentKey>);
+  EXPECT_FALSE(
+      mongo_cache::impl::kHasKeyFromDocumentKey<CorrectMongoCacheTraits>);
+}
+
 TEST(CheckTraits, CorrectTraits) {
   mongo_cache::impl::CheckTraits<CorrectMongoCacheTraits>{};
 }
@@ -0,0 +1,244 @@
+#include <userver/formats/bson/document_view.hpp>
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include <userver/formats/bson/exception.hpp>
+#include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+namespace {
+
+constexpr std::int64_t kMaxIntDouble{std::int64_t{1}
+                                     << std::numeric_limits<double>::digits};
+
+[[noreturn]] void ThrowTypeMismatch(const ValueView& value,
+                                    bson_type_t expected) {
+  throw TypeMismatchException(value.GetType(), expected, value.GetName());
+}
+
+}  // namespace
+
+ValueView::ValueView() noexcept = default;
+
+ValueView::ValueView(const bson_iter_t& iter) noexcept
+    : iter_(iter), is_missing_(false) {}
+
+std::string_view ValueView::GetName() const {
+  if (is_missing_) return {};
+  return bson_iter_key(&iter_);
+}
+
+ValueView ValueView::operator[](std::string_view name) const {
+  if (is_missing_) return {};
+  if (!IsDocument()) ThrowTypeMismatch(*this, BSON_TYPE_DOCUMENT);
+  return As<DocumentView>()[name];
+}
+
+bool ValueView::IsMissing() const noexcept { return is_missing_; }
+
+bson_type_t ValueView::GetType() const {
+  return is_missing_ ? BSON_TYPE_EOD : bson_iter_type(&iter_);
+}
+
+bool ValueView::IsNull() const { return GetType() == BSON_TYPE_NULL; }
+bool ValueView::IsBool() const { return GetType() == BSON_TYPE_BOOL; }
+bool ValueView::IsInt32() const { return GetType() == BSON_TYPE_INT32; }
+bool ValueView::IsInt64() const { return GetType() == BSON_TYPE_INT64; }
+bool ValueView::IsDouble() const { return GetType() == BSON_TYPE_DOUBLE; }
+bool ValueView::IsString() const { return GetType() == BSON_TYPE_UTF8; }
+bool ValueView::IsDateTime() const {
+  return GetType() == BSON_TYPE_DATE_TIME;
+}
+bool ValueView::IsOid() const { return GetType() == BSON_TYPE_OID; }
+bool ValueView::IsDocument() const { return GetType() == BSON_TYPE_DOCUMENT; }
+bool ValueView::IsArray() const { return GetType() == BSON_TYPE_ARRAY; }
+
+const bson_iter_t& ValueView::GetNative() const { return iter_; }
+
+void ValueView::CheckNotMissing() const {
+  if (is_missing_) throw MemberMissingException(GetName());
+}
+
+DocumentView::Iterator::Iterator(const bson_iter_t& iter)
+    : iter_(iter), is_end_(false) {
+  ++*this;
+}
+
+ValueView DocumentView::Iterator::operator*() const { return ValueView{iter_}; }
+
+DocumentView::Iterator& DocumentView::Iterator::operator++() {
+  if (!bson_iter_next(&iter_)) is_end_ = true;
+  return *this;
+}
+
+bool DocumentView::Iterator::operator==(const Iterator& other) const noexcept {
+  if (is_end_ || other.is_end_) return is_end_ == other.is_end_;
+  return iter_.raw == other.iter_.raw && iter_.off == other.iter_.off;
+}
+
+bool DocumentView::Iterator::operator!=(const Iterator& other) const noexcept {
+  return !(*this == other);
+}
+
+DocumentView::DocumentView(std::string_view binary)
+    : data_(reinterpret_cast<const std::uint8_t*>(binary.data())),
+      size_(binary.size()) {
+  // Only the header is checked, the elements are validated as they are read
+  bson_iter_t iter;
+  if (!bson_iter_init_from_data(&iter, data_, size_)) {
+    throw ParseException("malformed BSON: invalid document length");
+  }
+}
+
+DocumentView::DocumentView(const Document& document)
+    : data_(bson_get_data(document.GetBson().get())),
+      size_(document.GetBson()->len) {}
+
+ValueView DocumentView::operator[](std::string_view name) const {
+  for (const auto& value : *this) {
+    if (value.GetName() == name) return value;
+  }
+  return {};
+}
+
+bool DocumentView::HasMember(std::string_view name) const {
+  return !(*this)[name].IsMissing();
+}
+
+bool DocumentView::IsEmpty() const { return begin() == end(); }
+
+DocumentView::Iterator DocumentView::begin() const {
+  return Iterator{MakeIter()};
+}
+
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+DocumentView::Iterator DocumentView::end() const { return {}; }
+
+std::string_view DocumentView::GetBinary() const {
+  return {reinterpret_cast<const char*>(data_), size_};
+}
+
+Document DocumentView::ToDocument() const {
+  return Document(impl::MutableBson(data_, size_).Extract());
+}
+
+bson_iter_t DocumentView::MakeIter() const {
+  bson_iter_t iter;
+  [[maybe_unused]] const bool is_valid =
+      bson_iter_init_from_data(&iter, data_, size_);
+  UASSERT(is_valid);
+  return iter;
+}
+
+bool Parse(const ValueView& value, parse::To<bool>) {
+  value.CheckNotMissing();
+  if (value.IsBool()) return bson_iter_bool(&value.GetNative());
+  ThrowTypeMismatch(value, BSON_TYPE_BOOL);
+}
+
+std::int32_t Parse(const ValueView& value, parse::To<std::int32_t>) {
+  if (value.IsInt32()) return bson_iter_int32(&value.GetNative());
+  const auto as_int64 = value.As<std::int64_t>();
+  if (as_int64 < std::numeric_limits<std::int32_t>::min() ||
+      as_int64 > std::numeric_limits<std::int32_t>::max()) {
+    throw ConversionException(
+        utils::StrCat("Conversion of ", std::to_string(as_int64),
+                      " to int32 causes overflow"),
+        value.GetName());
+  }
+  return static_cast<std::int32_t>(as_int64);
+}
+
+std::int64_t Parse(const ValueView& value, parse::To<std::int64_t>) {
+  value.CheckNotMissing();
+  if (value.IsInt32()) return bson_iter_int32(&value.GetNative());
+  if (value.IsInt64()) return bson_iter_int64(&value.GetNative());
+  if (value.IsDouble()) {
+    const auto as_double = bson_iter_double(&value.GetNative());
+    double int_part = 0.0;
+    const auto frac_part = std::modf(as_double, &int_part);
+    if (frac_part || std::abs(as_double) >= kMaxIntDouble) {
+      throw ConversionException(
+          utils::StrCat("Conversion ", std::to_string(as_double),
+                        " to integer causes precision change"),
+          value.GetName());
+    }
+    return static_cast<std::int64_t>(as_double);
+  }
+  ThrowTypeMismatch(value, BSON_TYPE_INT64);
+}
+
+double Parse(const ValueView& value, parse::To<double>) {
+  value.CheckNotMissing();
+  if (value.IsDouble()) return bson_iter_double(&value.GetNative());
+  if (value.IsInt32()) return bson_iter_int32(&value.GetNative());
+  if (value.IsInt64()) {
+    const auto as_int = bson_iter_int64(&value.GetNative());
+    if (as_int == std::numeric_limits<std::int64_t>::min() ||
+        std::abs(as_int) > kMaxIntDouble) {
+      throw ConversionException(
+          utils::StrCat("Conversion of ", std::to_string(as_int),
+                        " to double causes precision loss"),
+          value.GetName());
+    }
+    return static_cast<double>(as_int);
+  }
+  ThrowTypeMismatch(value, BSON_TYPE_DOUBLE);
+}
+
+std::string Parse(const ValueView& value, parse::To<std::string>) {
+  return std::string{value.As<std::string_view>()};
+}
+
+std::string_view Parse(const ValueView& value, parse::To<std::string_view>) {
+  value.CheckNotMissing();
+  if (value.IsString()) {
+    std::uint32_t length = 0;
+    const char* str = bson_iter_utf8(&value.GetNative(), &length);
+    return {str, length};
+  }
+  ThrowTypeMismatch(value, BSON_TYPE_UTF8);
+}
+
+std::chrono::system_clock::time_point Parse(
+    const ValueView& value, parse::To<std::chrono::system_clock::time_point>) {
+  value.CheckNotMissing();
+  if (value.IsDateTime()) {
+    return std::chrono::system_clock::time_point{
+        std::chrono::milliseconds{bson_iter_date_time(&value.GetNative())}};
+  }
+  ThrowTypeMismatch(value, BSON_TYPE_DATE_TIME);
+}
+
+Oid Parse(const ValueView& value, parse::To<Oid>) {
+  value.CheckNotMissing();
+  if (value.IsOid()) return *bson_iter_oid(&value.GetNative());
+  ThrowTypeMismatch(value, BSON_TYPE_OID);
+}
+
+DocumentView Parse(const ValueView& value, parse::To<DocumentView>) {
+  value.CheckNotMissing();
+  if (value.IsDocument() || value.IsArray()) {
+    std::uint32_t length = 0;
+    const std::uint8_t* data = nullptr;
+    if (value.IsDocument()) {
+      bson_iter_document(&value.GetNative(), &length, &data);
+    } else {
+      bson_iter_array(&value.GetNative(), &length, &data);
+    }
+    return DocumentView{
+        std::string_view{reinterpret_cast<const char*>(data), length}};
+  }
+  ThrowTypeMismatch(value, BSON_TYPE_DOCUMENT);
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
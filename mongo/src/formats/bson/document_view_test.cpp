@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/bson.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fb = formats::bson;
+
+namespace {
+
+const auto kTimePoint =
+    std::chrono::system_clock::from_time_t(0) + std::chrono::milliseconds{1};
+
+const auto kDoc = fb::MakeDoc("string", "test", "int", 1, "int64",
+                              int64_t{1} << 40, "double", 1.5, "bool", true,
+                              "date", kTimePoint, "null", nullptr, "doc",
+                              fb::MakeDoc("a", 1), "arr", fb::MakeArray(1, 2));
+
+}  // namespace
+
+TEST(BsonDocumentView, Types) {
+  const fb::DocumentView view{kDoc};
+
+  EXPECT_EQ(view["string"].As<std::string_view>(), "test");
+  EXPECT_EQ(view["string"].As<std::string>(), "test");
+  EXPECT_EQ(view["int"].As<int>(), 1);
+  EXPECT_EQ(view["int"].As<int64_t>(), 1);
+  EXPECT_EQ(view["int"].As<double>(), 1.0);
+  EXPECT_EQ(view["int64"].As<int64_t>(), int64_t{1} << 40);
+  EXPECT_EQ(view["double"].As<double>(), 1.5);
+  EXPECT_TRUE(view["bool"].As<bool>());
+  EXPECT_EQ(view["date"].As<std::chrono::system_clock::time_point>(),
+            kTimePoint);
+  EXPECT_TRUE(view["null"].IsNull());
+  EXPECT_EQ(view["doc"]["a"].As<int>(), 1);
+  EXPECT_TRUE(view["doc"]["b"].IsMissing());
+
+  UEXPECT_THROW(view["int64"].As<int>(), fb::ConversionException);
+  UEXPECT_THROW(view["double"].As<int>(), fb::ConversionException);
+  UEXPECT_THROW(view["string"].As<int>(), fb::TypeMismatchException);
+  UEXPECT_THROW(view["missing"].As<int>(), fb::MemberMissingException);
+  UEXPECT_THROW(view["int"]["a"], fb::TypeMismatchException);
+}
+
+TEST(BsonDocumentView, Defaults) {
+  const fb::DocumentView view{kDoc};
+
+  EXPECT_EQ(view["missing"].As<int>(42), 42);
+  EXPECT_EQ(view["null"].As<int>(42), 42);
+  EXPECT_EQ(view["int"].As<int>(42), 1);
+}
+
+TEST(BsonDocumentView, Iteration) {
+  const fb::DocumentView view{kDoc};
+
+  std::vector<std::string_view> names;
+  for (const auto& value : view) names.push_back(value.GetName());
+  EXPECT_EQ(names, (std::vector<std::string_view>{"string", "int", "int64",
+                                                  "double", "bool", "date",
+                                                  "null", "doc", "arr"}));
+
+  std::vector<int> elements;
+  for (const auto& value : view["arr"].As<fb::DocumentView>()) {
+    elements.push_back(value.As<int>());
+  }
+  EXPECT_EQ(elements, (std::vector<int>{1, 2}));
+
+  EXPECT_FALSE(view.IsEmpty());
+  EXPECT_TRUE(fb::DocumentView{fb::Document{}}.IsEmpty());
+}
+
+TEST(BsonDocumentView, Binary) {
+  const auto binary = fb::ToBinaryString(kDoc);
+  const fb::DocumentView view{binary.GetView()};
+
+  EXPECT_EQ(view.GetBinary(), binary.GetView());
+  EXPECT_TRUE(view.HasMember("doc"));
+  EXPECT_FALSE(view.HasMember("missing"));
+  EXPECT_EQ(view.ToDocument(), kDoc);
+
+  UEXPECT_THROW(fb::DocumentView{std::string_view{"\x01"}}, fb::ParseException);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,198 @@
+#include <userver/storages/mongo/bulk_batcher.hpp>
+
+#include <mutex>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/storages/mongo/write_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace {
+
+using SubOperation = std::variant<bulk_ops::InsertOne, bulk_ops::ReplaceOne,
+                                  bulk_ops::Update, bulk_ops::Delete>;
+
+struct PendingWrite {
+  SubOperation subop;
+  engine::Promise<BatchedWriteResult> promise;
+};
+
+std::exception_ptr CaptureError(const MongoError& error, std::string prefix) {
+  try {
+    error.Throw(std::move(prefix));
+  } catch (...) {
+    return std::current_exception();
+  }
+}
+
+std::exception_ptr MakeCancelledError() {
+  // mongo exceptions are move-only, std::make_exception_ptr copies
+  try {
+    throw CancelledException("Bulk batcher is destroyed");
+  } catch (...) {
+    return std::current_exception();
+  }
+}
+
+}  // namespace
+
+class BulkBatcher::Impl {
+ public:
+  Impl(Collection&& collection, BulkBatcherSettings&& settings)
+      : collection_(std::move(collection)),
+        settings_(std::move(settings)),
+        flusher_(engine::CriticalAsyncNoSpan([this] { RunFlusher(); })) {}
+
+  ~Impl() {
+    flusher_.SyncCancel();
+
+    const auto error = MakeCancelledError();
+    for (auto& write : pending_) write.promise.set_exception(error);
+  }
+
+  BatchedWriteResult Write(SubOperation&& subop) {
+    auto future = [&] {
+      const std::lock_guard lock(mutex_);
+      pending_.push_back({std::move(subop), {}});
+      return pending_.back().promise.get_future();
+    }();
+    cv_.NotifyOne();
+    return future.get();
+  }
+
+ private:
+  void RunFlusher() {
+    while (!engine::current_task::ShouldCancel()) {
+      std::vector<PendingWrite> batch;
+      {
+        std::unique_lock lock(mutex_);
+        if (!cv_.Wait(lock, [this] { return !pending_.empty(); })) break;
+
+        // Gives other callers a chance to join the batch
+        [[maybe_unused]] const bool is_full = cv_.WaitUntil(
+            lock, engine::Deadline::FromDuration(settings_.max_delay),
+            [this] { return pending_.size() >= settings_.max_batch_size; });
+        if (engine::current_task::ShouldCancel()) break;
+
+        if (pending_.size() <= settings_.max_batch_size) {
+          batch.swap(pending_);
+        } else {
+          const auto split = pending_.begin() + settings_.max_batch_size;
+          batch.assign(std::make_move_iterator(pending_.begin()),
+                       std::make_move_iterator(split));
+          pending_.erase(pending_.begin(), split);
+        }
+      }
+      Flush(batch);
+    }
+  }
+
+  void Flush(std::vector<PendingWrite>& batch) {
+    operations::Bulk bulk(operations::Bulk::Mode::kUnordered);
+    bulk.SetOption(settings_.write_concern);
+    bulk.SetOption(options::SuppressServerExceptions{});
+    for (const auto& write : batch) {
+      std::visit([&bulk](const auto& subop) { bulk.Append(subop); },
+                 write.subop);
+    }
+
+    try {
+      const auto result = collection_.Execute(std::move(bulk));
+      const auto server_errors = result.ServerErrors();
+      const auto write_concern_errors = result.WriteConcernErrors();
+      auto upserted_ids = result.UpsertedIds();
+
+      for (std::size_t i = 0; i < batch.size(); ++i) {
+        auto& promise = batch[i].promise;
+        if (const auto it = server_errors.find(i); it != server_errors.end()) {
+          promise.set_exception(CaptureError(it->second, "Batched write"));
+        } else if (!write_concern_errors.empty()) {
+          promise.set_exception(
+              CaptureError(write_concern_errors.front(), "Batched write"));
+        } else {
+          BatchedWriteResult write_result;
+          if (const auto it = upserted_ids.find(i); it != upserted_ids.end()) {
+            write_result.upserted_id = std::move(it->second);
+          }
+          promise.set_value(std::move(write_result));
+        }
+      }
+    } catch (const std::exception&) {
+      const auto error = std::current_exception();
+      for (auto& write : batch) write.promise.set_exception(error);
+    }
+  }
+
+  Collection collection_;
+  const BulkBatcherSettings settings_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable cv_;
+  std::vector<PendingWrite> pending_;
+
+  engine::TaskWithResult<void> flusher_;
+};
+
+BulkBatcher::BulkBatcher(Collection collection, BulkBatcherSettings settings)
+    : impl_(std::make_unique<Impl>(std::move(collection),
+                                   std::move(settings))) {}
+
+BulkBatcher::~BulkBatcher() = default;
+
+void BulkBatcher::InsertOne(formats::bson::Document document) {
+  Write(bulk_ops::InsertOne{std::move(document)});
+}
+
+BatchedWriteResult BulkBatcher::ReplaceOne(formats::bson::Document selector,
+                                           formats::bson::Document replacement,
+                                           bool upsert) {
+  bulk_ops::ReplaceOne subop{std::move(selector), std::move(replacement)};
+  if (upsert) subop.SetOption(options::Upsert{});
+  return Write(std::move(subop));
+}
+
+BatchedWriteResult BulkBatcher::UpdateOne(formats::bson::Document selector,
+                                          formats::bson::Document update,
+                                          bool upsert) {
+  bulk_ops::Update subop{bulk_ops::Update::Mode::kSingle, std::move(selector),
+                         std::move(update)};
+  if (upsert) subop.SetOption(options::Upsert{});
+  return Write(std::move(subop));
+}
+
+void BulkBatcher::DeleteOne(formats::bson::Document selector) {
+  Write(bulk_ops::Delete{bulk_ops::Delete::Mode::kSingle, std::move(selector)});
+}
+
+BatchedWriteResult BulkBatcher::Write(bulk_ops::InsertOne subop) {
+  return impl_->Write(std::move(subop));
+}
+
+BatchedWriteResult BulkBatcher::Write(bulk_ops::ReplaceOne subop) {
+  return impl_->Write(std::move(subop));
+}
+
+BatchedWriteResult BulkBatcher::Write(bulk_ops::Update subop) {
+  return impl_->Write(std::move(subop));
+}
+
+BatchedWriteResult BulkBatcher::Write(bulk_ops::Delete subop) {
+  return impl_->Write(std::move(subop));
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,84 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+class BulkBatcher : public MongoPoolFixture {};
+
+mongo::BulkBatcherSettings MakeTestSettings() {
+  mongo::BulkBatcherSettings settings;
+  settings.max_delay = std::chrono::milliseconds{50};
+  settings.max_batch_size = 16;
+  return settings;
+}
+}  // namespace
+
+UTEST_F_MT(BulkBatcher, ConcurrentInserts, 4) {
+  constexpr int kWrites = 100;
+  auto coll = GetDefaultPool().GetCollection("batcher_inserts");
+  mongo::BulkBatcher batcher{coll, MakeTestSettings()};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kWrites);
+  for (int i = 0; i < kWrites; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&batcher, i] {
+      batcher.InsertOne(bson::MakeDoc("_id", i));
+    }));
+  }
+  for (auto& task : tasks) UEXPECT_NO_THROW(task.Get());
+
+  EXPECT_EQ(kWrites, coll.Count({}));
+}
+
+UTEST_F(BulkBatcher, ErrorsAreMappedToCallers) {
+  auto coll = GetDefaultPool().GetCollection("batcher_errors");
+  coll.InsertOne(bson::MakeDoc("_id", 1));
+  mongo::BulkBatcher batcher{coll, MakeTestSettings()};
+
+  auto duplicate = engine::AsyncNoSpan(
+      [&batcher] { batcher.InsertOne(bson::MakeDoc("_id", 1)); });
+  auto fresh = engine::AsyncNoSpan(
+      [&batcher] { batcher.InsertOne(bson::MakeDoc("_id", 2)); });
+
+  UEXPECT_THROW(duplicate.Get(), mongo::DuplicateKeyException);
+  UEXPECT_NO_THROW(fresh.Get());
+  EXPECT_EQ(1, coll.Count(bson::MakeDoc("_id", 2)));
+}
+
+UTEST_F(BulkBatcher, Upsert) {
+  auto coll = GetDefaultPool().GetCollection("batcher_upsert");
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", 1));
+  mongo::BulkBatcher batcher{coll, MakeTestSettings()};
+
+  auto updated = engine::AsyncNoSpan([&batcher] {
+    return batcher.UpdateOne(bson::MakeDoc("_id", 1),
+                             bson::MakeDoc("$set", bson::MakeDoc("x", 2)),
+                             /*upsert=*/true);
+  });
+  auto upserted = engine::AsyncNoSpan([&batcher] {
+    return batcher.UpdateOne(bson::MakeDoc("_id", 2),
+                             bson::MakeDoc("$set", bson::MakeDoc("x", 3)),
+                             /*upsert=*/true);
+  });
+
+  EXPECT_FALSE(updated.Get().upserted_id);
+  const auto upserted_id = upserted.Get().upserted_id;
+  ASSERT_TRUE(upserted_id);
+  EXPECT_EQ(2, upserted_id->As<int>());
+
+  EXPECT_EQ(1, coll.Count(bson::MakeDoc("x", 2)));
+  EXPECT_EQ(1, coll.Count(bson::MakeDoc("x", 3)));
+}
+
+USERVER_NAMESPACE_END
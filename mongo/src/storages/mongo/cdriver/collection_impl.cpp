@@ -15,6 +15,7 @@
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -538,6 +539,20 @@ Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
       std::move(context.stats)));
 }
 
+ChangeStream CDriverCollectionImpl::Execute(
+    const operations::Watch& operation) const {
+  auto context = MakeRequestContext("mongo_watch", operation);
+
+  auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+  const bson_t* native_pipeline_bson_ptr = pipeline_doc.GetBson().get();
+  impl::cdriver::ChangeStreamPtr cdriver_stream(mongoc_collection_watch(
+      context.collection.get(), native_pipeline_bson_ptr,
+      impl::GetNative(operation.impl_->options)));
+  return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+      std::move(context.client), std::move(cdriver_stream),
+      std::move(context.stats)));
+}
+
 void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
   auto context = MakeRequestContext("mongo_drop", operation);
 
@@ -1,6 +1,7 @@
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 
 #include <stdexcept>
+#include <string_view>
 
 #include <bson/bson.h>
 #include <mongoc/mongoc.h>
@@ -59,9 +60,36 @@ void CDriverCursorImpl::Next() {
   if (!IsValid()) throw std::logic_error("Advancing cursor past the end");
 
   current_ = std::nullopt;
+  const auto* current_bson = FetchNext();
+  if (current_bson) {
+    current_ = formats::bson::Document(
+        formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
+  }
+  ReleaseIfExhausted();
+}
+
+void CDriverCursorImpl::ForEachView(
+    const std::function<void(formats::bson::DocumentView)>& func) {
+  if (current_) {
+    func(formats::bson::DocumentView{*current_});
+    current_ = std::nullopt;
+  }
+  while (HasMore()) {
+    // Documents are viewed in the reply buffer of the driver
+    const auto* current_bson = FetchNext();
+    if (current_bson) {
+      func(formats::bson::DocumentView{std::string_view{
+          reinterpret_cast<const char*>(bson_get_data(current_bson)),
+          current_bson->len}});
+    }
+    ReleaseIfExhausted();
+  }
+}
+
+const bson_t* CDriverCursorImpl::FetchNext() {
   if (!HasMore()) {
     UASSERT(!cursor_ && !client_);
-    return;
+    return nullptr;
   }
 
   UASSERT(client_ && cursor_);
@@ -71,11 +99,8 @@ void CDriverCursorImpl::Next() {
   const bson_t* current_bson = nullptr;
   MongoError error;
   while (!mongoc_cursor_error(cursor_.get(), error.GetNative()) && HasMore()) {
-    if (mongoc_cursor_next(cursor_.get(), &current_bson)) {
-      current_ = formats::bson::Document(
-          formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
-      break;
-    }
+    if (mongoc_cursor_next(cursor_.get(), &current_bson)) break;
+    current_bson = nullptr;
   }
   if (batch_num_before == mongoc_cursor_get_batch_num(cursor_.get())) {
     cursor_next_sw.Discard();
@@ -84,13 +109,18 @@ void CDriverCursorImpl::Next() {
   } else {
     cursor_next_sw.AccountError(error.GetKind());
   }
+  if (error) {
+    ReleaseIfExhausted();
+    error.Throw("Error iterating over query results");
+  }
+  return current_bson;
+}
+
+void CDriverCursorImpl::ReleaseIfExhausted() {
   if (!HasMore()) {
     cursor_.reset();
     client_.reset();
   }
-  if (error) {
-    error.Throw("Error iterating over query results");
-  }
 }
 
 }  // namespace storages::mongo::impl::cdriver
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <functional>
 #include <optional>
 
 #include <userver/formats/bson/document.hpp>
@@ -27,7 +28,14 @@ class CDriverCursorImpl final : public CursorImpl {
   const formats::bson::Document& Current() const override;
   void Next() override;
 
+  void ForEachView(
+      const std::function<void(formats::bson::DocumentView)>& func) override;
+
  private:
+  // The returned document is valid until the next call or ReleaseIfExhausted
+  const bson_t* FetchNext();
+  void ReleaseIfExhausted();
+
   std::optional<formats::bson::Document> current_;
   cdriver::CDriverPoolImpl::BoundClientPtr client_;
   cdriver::CursorPtr cursor_;
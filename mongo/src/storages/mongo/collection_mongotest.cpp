@@ -111,6 +111,30 @@ UTEST_F(Collection, Read) {
   EXPECT_EQ(0, other_coll.CountApprox());
 }
 
+UTEST_F(Collection, ReadViews) {
+  constexpr int kDocsCount = 250;
+  auto coll = GetDefaultPool().GetCollection("read_views");
+  for (int i = 0; i < kDocsCount; ++i) {
+    coll.InsertOne(bson::MakeDoc("_id", i, "name", std::to_string(i)));
+  }
+
+  // More than the 101 documents of the first batch, so that the cursor
+  // fetches the next reply while iterating
+  mongo::operations::Find find_op({});
+  find_op.SetOption(
+      mongo::options::Sort{{"_id", mongo::options::Sort::kAscending}});
+  auto cursor = coll.Execute(find_op);
+
+  int count = 0;
+  cursor.ForEachView([&count](bson::DocumentView doc) {
+    EXPECT_EQ(doc["_id"].As<int>(), count);
+    EXPECT_EQ(doc["name"].As<std::string_view>(), std::to_string(count));
+    ++count;
+  });
+  EXPECT_EQ(count, kDocsCount);
+  EXPECT_FALSE(cursor);
+}
+
 UTEST_F(Collection, InsertOne) {
   auto coll = GetDefaultPool().GetCollection("insert_one");
 
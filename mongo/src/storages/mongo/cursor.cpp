@@ -21,6 +21,11 @@ Cursor::Iterator Cursor::begin() { return Iterator(this); }
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 Cursor::Iterator Cursor::end() { return Iterator(nullptr); }
 
+void Cursor::ForEachView(
+    const std::function<void(formats::bson::DocumentView)>& func) {
+  impl_->ForEachView(func);
+}
+
 Cursor::Iterator::Iterator(Cursor* cursor) : cursor_(cursor) {
   if (cursor_ && !cursor_->impl_->IsValid()) cursor_ = nullptr;
 }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <functional>
+
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,6 +18,9 @@ class CursorImpl {
 
   virtual const formats::bson::Document& Current() const = 0;
   virtual void Next() = 0;
+
+  virtual void ForEachView(
+      const std::function<void(formats::bson::DocumentView)>& func) = 0;
 };
 
 }  // namespace storages::mongo::impl
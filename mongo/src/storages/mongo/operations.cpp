@@ -3,6 +3,7 @@
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/utils/assert.hpp>
@@ -647,6 +648,47 @@ void Aggregate::SetOption(const options::MaxServerTime& max_server_time) {
   AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+Watch::Watch() : Watch(formats::bson::MakeArray()) {}
+
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+  if (!impl_->pipeline.IsArray()) {
+    throw InvalidQueryArgumentException(
+        "Change stream pipeline is not an array");
+  }
+}
+
+Watch::~Watch() = default;
+
+Watch::Watch(const Watch& other) = default;
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(options::ReadConcern level) {
+  AppendReadConcern(impl::EnsureBuilder(impl_->options), level);
+}
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+  static const std::string kOptionName = "resumeAfter";
+  impl::EnsureBuilder(impl_->options)
+      .Append(kOptionName, resume_after.Value());
+}
+
+void Watch::SetOption(options::FullDocumentUpdateLookup) {
+  static const std::string kOptionName = "fullDocument";
+  impl::EnsureBuilder(impl_->options).Append(kOptionName, "updateLookup");
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+  static const std::string kOptionName = "maxAwaitTimeMS";
+  if (max_await_time.Value() < std::chrono::milliseconds::zero()) {
+    throw InvalidQueryArgumentException("Max await time cannot be negative");
+  }
+  impl::EnsureBuilder(impl_->options)
+      .Append(kOptionName,
+              static_cast<int64_t>(max_await_time.Value().count()));
+}
+
 Drop::Drop() = default;
 Drop::~Drop() = default;
 
@@ -166,6 +166,16 @@ class Aggregate::Impl {
   std::chrono::milliseconds max_server_time{kNoMaxServerTime};
 };
 
+class Watch::Impl {
+ public:
+  explicit Impl(formats::bson::Value pipeline_)
+      : pipeline(std::move(pipeline_)) {}
+
+  formats::bson::Value pipeline;
+  stats::OperationKey op_key{stats::OpType::kWatch};
+  std::optional<formats::bson::impl::BsonBuilder> options;
+};
+
 class Drop::Impl {
  public:
   Impl() = default;
@@ -10,6 +10,7 @@
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
+#include <userver/utils/from_string.hpp>
 #include <userver/utils/text.hpp>
 
 #include <storages/mongo/dynamic_config.hpp>
@@ -45,11 +46,15 @@ void DropDatabase(storages::mongo::Pool& pool, const std::string& name) {
 const std::string kTestDatabaseNamePrefix = "userver_mongotest_";
 const std::string kTestDatabaseDefaultName = "userver_mongotest_default";
 
-std::string GetTestsuiteMongoUri(const std::string& database) {
+std::uint16_t GetTestsuiteMongoPort() {
   // NOLINTNEXTLINE(concurrency-mt-unsafe)
   const auto* mongo_port_env = std::getenv(kTestsuiteMongosPort);
-  return fmt::format("mongodb://localhost:{}/{}",
-                     mongo_port_env ? mongo_port_env : kDefaultMongoPort,
+  return utils::FromString<std::uint16_t>(mongo_port_env ? mongo_port_env
+                                                         : kDefaultMongoPort);
+}
+
+std::string GetTestsuiteMongoUri(const std::string& database) {
+  return fmt::format("mongodb://localhost:{}/{}", GetTestsuiteMongoPort(),
                      database);
 }
 
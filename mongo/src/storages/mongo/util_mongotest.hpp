@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <unordered_set>
@@ -19,6 +20,8 @@ USERVER_NAMESPACE_BEGIN
 extern const std::string kTestDatabaseNamePrefix;
 extern const std::string kTestDatabaseDefaultName;
 
+std::uint16_t GetTestsuiteMongoPort();
+
 std::string GetTestsuiteMongoUri(const std::string& database);
 
 clients::dns::Resolver MakeDnsResolver();
@@ -0,0 +1,209 @@
+#include <storages/mongo/wire/connection.hpp>
+
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <bson/bson.h>
+#include <mongoc/mongoc.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/formats/bson/value_builder.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/storages/mongo/mongo_error.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::wire {
+namespace {
+
+void RecvExactly(engine::io::Socket& socket, std::string& buffer) {
+  const auto received =
+      socket.RecvAll(buffer.data(), buffer.size(), engine::Deadline{});
+  if (received != buffer.size()) {
+    throw NetworkException("Connection closed by the server");
+  }
+}
+
+template <typename Exception>
+std::exception_ptr MakeExceptionPtr(Exception&& ex) {
+  // mongo exceptions are move-only, std::make_exception_ptr copies
+  try {
+    throw std::forward<Exception>(ex);
+  } catch (...) {
+    return std::current_exception();
+  }
+}
+
+[[noreturn]] void ThrowServerError(const formats::bson::Document& reply) {
+  const auto code = reply["code"].ConvertTo<int64_t>(0);
+  const auto message = reply["errmsg"].ConvertTo<std::string>("");
+
+  MongoError error;
+  bson_set_error(error.GetNative(), MONGOC_ERROR_SERVER,
+                 static_cast<uint32_t>(code), "%s", message.c_str());
+  error.Throw("Command failed");
+}
+
+}  // namespace
+
+Connection::Connection(engine::io::Socket&& socket)
+    : socket_(std::move(socket)),
+      reader_(engine::CriticalAsyncNoSpan([this] { ReadReplies(); })) {}
+
+Connection::~Connection() { reader_.SyncCancel(); }
+
+formats::bson::Document Connection::RunCommand(const std::string& database,
+                                               OpMsg&& message,
+                                               engine::Deadline deadline) {
+  formats::bson::ValueBuilder body{message.body};
+  body["$db"] = database;
+  message.body = body.ExtractValue();
+
+  const auto request_id =
+      next_request_id_.fetch_add(1, std::memory_order_relaxed);
+  const auto data = SerializeOpMsg(request_id, message);
+  if (data.size() > kMaxMessageSize) {
+    throw InvalidQueryArgumentException("Command is too large: ")
+        << data.size() << " bytes";
+  }
+
+  auto reply = AddPending(request_id);
+  try {
+    Send(data, deadline);
+  } catch (const std::exception&) {
+    RemovePending(request_id);
+    throw;
+  }
+
+  switch (reply.wait_until(deadline)) {
+    case engine::FutureStatus::kReady:
+      break;
+    case engine::FutureStatus::kTimeout:
+      // The reply is dropped by the reader when it arrives
+      RemovePending(request_id);
+      throw NetworkException("Timed out waiting for the reply");
+    case engine::FutureStatus::kCancelled:
+      RemovePending(request_id);
+      throw CancelledException("Cancelled waiting for the reply");
+  }
+
+  auto result = reply.get().body;
+  if (!result["ok"].ConvertTo<bool>(false)) ThrowServerError(result);
+  return result;
+}
+
+formats::bson::Document Connection::RunCommand(
+    const std::string& database, const formats::bson::Document& command,
+    engine::Deadline deadline) {
+  OpMsg message;
+  message.body = command;
+  return RunCommand(database, std::move(message), deadline);
+}
+
+bool Connection::IsBroken() const noexcept { return is_broken_; }
+
+std::size_t Connection::InFlightApprox() const {
+  const std::lock_guard lock(pending_mutex_);
+  return pending_.size();
+}
+
+engine::Future<OpMsg> Connection::AddPending(std::int32_t request_id) {
+  const std::lock_guard lock(pending_mutex_);
+  if (failure_) std::rethrow_exception(failure_);
+  return pending_[request_id].get_future();
+}
+
+void Connection::RemovePending(std::int32_t request_id) {
+  const std::lock_guard lock(pending_mutex_);
+  pending_.erase(request_id);
+}
+
+void Connection::Send(const std::string& data, engine::Deadline deadline) {
+  const std::lock_guard lock(send_mutex_);
+  if (IsBroken()) throw NetworkException("Connection is broken");
+
+  try {
+    const auto sent = socket_.SendAll(data.data(), data.size(), deadline);
+    if (sent != data.size()) {
+      throw NetworkException("Connection closed by the server");
+    }
+  } catch (const engine::io::IoInterrupted& ex) {
+    // A partially sent message leaves the stream unusable for everyone
+    const bool is_partial = ex.BytesTransferred() != 0;
+    if (engine::current_task::ShouldCancel()) {
+      if (is_partial) {
+        Fail(MakeExceptionPtr(
+            NetworkException("Send was interrupted by a cancellation")));
+      }
+      throw CancelledException("Cancelled sending the command");
+    }
+    auto error = MakeExceptionPtr(
+        NetworkException("Timed out sending the command"));
+    if (is_partial) Fail(error);
+    std::rethrow_exception(error);
+  } catch (const engine::io::IoException& ex) {
+    auto error = MakeExceptionPtr(NetworkException(ex.what()));
+    Fail(error);
+    std::rethrow_exception(error);
+  } catch (const NetworkException&) {
+    Fail(std::current_exception());
+    throw;
+  }
+}
+
+void Connection::ReadReplies() {
+  try {
+    std::string header_data(kHeaderSize, '\0');
+    std::string payload;
+    while (!engine::current_task::ShouldCancel()) {
+      RecvExactly(socket_, header_data);
+      const auto header = ParseHeader(header_data);
+      payload.resize(header.message_length - kHeaderSize);
+      RecvExactly(socket_, payload);
+      auto reply = ParseOpMsg(payload);
+
+      std::optional<engine::Promise<OpMsg>> promise;
+      {
+        const std::lock_guard lock(pending_mutex_);
+        const auto it = pending_.find(header.response_to);
+        if (it != pending_.end()) {
+          promise.emplace(std::move(it->second));
+          pending_.erase(it);
+        }
+      }
+      if (promise) {
+        promise->set_value(std::move(reply));
+      } else {
+        LOG_DEBUG() << "Dropping the reply to abandoned request "
+                    << header.response_to;
+      }
+    }
+  } catch (const std::exception& ex) {
+    if (!engine::current_task::ShouldCancel()) {
+      LOG_WARNING() << "Mongo connection failed: " << ex;
+    }
+    Fail(MakeExceptionPtr(
+        NetworkException("Connection failed: ") << ex.what()));
+  }
+}
+
+void Connection::Fail(std::exception_ptr error) noexcept {
+  is_broken_ = true;
+
+  std::unordered_map<std::int32_t, engine::Promise<OpMsg>> pending;
+  {
+    const std::lock_guard lock(pending_mutex_);
+    if (!failure_) failure_ = error;
+    pending.swap(pending_);
+  }
+  for (auto& [_, promise] : pending) promise.set_exception(error);
+}
+
+}  // namespace storages::mongo::impl::wire
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <unordered_map>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/document.hpp>
+
+#include <storages/mongo/wire/message.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::wire {
+
+/// MongoDB connection speaking OP_MSG over an engine socket.
+///
+/// Unlike a `mongoc_client_t` the connection is not checked out for the whole
+/// operation: any number of tasks may run commands concurrently. Requests are
+/// pipelined over the socket and the replies read by a background task are
+/// handed to the waiting callers by their `responseTo` request id.
+///
+/// The server executes the commands of a single connection in order, so a slow
+/// command delays the ones sent after it.
+class Connection final {
+ public:
+  /// Takes ownership of a connected socket and starts reading replies
+  explicit Connection(engine::io::Socket&& socket);
+  ~Connection();
+
+  Connection(const Connection&) = delete;
+  Connection& operator=(const Connection&) = delete;
+
+  /// @brief Runs a command against the database and returns its reply
+  /// @throws NetworkException on I/O errors, timeouts and broken connection
+  /// @throws ServerException and its descendants if the reply is not `ok`
+  /// @throws CancelledException if the current task is cancelled
+  formats::bson::Document RunCommand(const std::string& database,
+                                     OpMsg&& message,
+                                     engine::Deadline deadline);
+
+  /// @overload
+  formats::bson::Document RunCommand(const std::string& database,
+                                     const formats::bson::Document& command,
+                                     engine::Deadline deadline);
+
+  /// Whether the connection has failed and must be replaced
+  bool IsBroken() const noexcept;
+
+  /// Number of requests awaiting replies
+  std::size_t InFlightApprox() const;
+
+ private:
+  engine::Future<OpMsg> AddPending(std::int32_t request_id);
+  void RemovePending(std::int32_t request_id);
+  void Send(const std::string& data, engine::Deadline deadline);
+  void ReadReplies();
+  void Fail(std::exception_ptr error) noexcept;
+
+  engine::io::Socket socket_;
+  std::atomic<std::int32_t> next_request_id_{1};
+  std::atomic<bool> is_broken_{false};
+
+  engine::Mutex send_mutex_;
+
+  mutable engine::Mutex pending_mutex_;
+  std::unordered_map<std::int32_t, engine::Promise<OpMsg>> pending_;
+  std::exception_ptr failure_;
+
+  // Must be the last field, it uses all the others
+  engine::TaskWithResult<void> reader_;
+};
+
+}  // namespace storages::mongo::impl::wire
+
+USERVER_NAMESPACE_END
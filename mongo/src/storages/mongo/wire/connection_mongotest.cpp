@@ -0,0 +1,98 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <storages/mongo/wire/connection.hpp>
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/storages/mongo/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace wire = storages::mongo::impl::wire;
+
+namespace {
+
+const std::string kWireTestDatabase = kTestDatabaseNamePrefix + "wire";
+
+engine::Deadline MakeTestDeadline() {
+  return engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+}
+
+engine::io::Socket ConnectToTestsuiteMongo() {
+  auto resolver = MakeDnsResolver();
+  const auto deadline = MakeTestDeadline();
+  for (auto addr : resolver.Resolve("localhost", deadline)) {
+    addr.SetPort(GetTestsuiteMongoPort());
+    engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
+    try {
+      socket.Connect(addr, deadline);
+      return socket;
+    } catch (const engine::io::IoException&) {
+      // try the next address
+    }
+  }
+  throw storages::mongo::NetworkException("Cannot connect to mongo");
+}
+
+}  // namespace
+
+UTEST(MongoWireConnection, Ping) {
+  wire::Connection connection{ConnectToTestsuiteMongo()};
+  const auto reply = connection.RunCommand(
+      "admin", formats::bson::MakeDoc("ping", 1), MakeTestDeadline());
+  EXPECT_EQ(reply["ok"].ConvertTo<double>(), 1.0);
+  EXPECT_FALSE(connection.IsBroken());
+}
+
+UTEST(MongoWireConnection, ServerError) {
+  wire::Connection connection{ConnectToTestsuiteMongo()};
+  UEXPECT_THROW(
+      connection.RunCommand("admin", formats::bson::MakeDoc("nonexistent", 1),
+                            MakeTestDeadline()),
+      storages::mongo::QueryException);
+
+  // Server errors do not break the connection
+  EXPECT_FALSE(connection.IsBroken());
+  UEXPECT_NO_THROW(connection.RunCommand(
+      "admin", formats::bson::MakeDoc("ping", 1), MakeTestDeadline()));
+}
+
+UTEST_MT(MongoWireConnection, Multiplexing, 4) {
+  constexpr int kTasks = 64;
+  wire::Connection connection{ConnectToTestsuiteMongo()};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (int i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&connection, i] {
+      wire::OpMsg insert;
+      insert.body = formats::bson::MakeDoc("insert", "multiplexing");
+      insert.sequences.push_back(
+          {"documents", {formats::bson::MakeDoc("_id", i)}});
+      const auto reply = connection.RunCommand(
+          kWireTestDatabase, std::move(insert), MakeTestDeadline());
+      EXPECT_EQ(reply["n"].ConvertTo<int>(), 1);
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  const auto count = connection.RunCommand(
+      kWireTestDatabase, formats::bson::MakeDoc("count", "multiplexing"),
+      MakeTestDeadline());
+  EXPECT_EQ(count["n"].ConvertTo<int>(), kTasks);
+  EXPECT_EQ(connection.InFlightApprox(), 0u);
+
+  connection.RunCommand(kWireTestDatabase,
+                        formats::bson::MakeDoc("dropDatabase", 1),
+                        MakeTestDeadline());
+}
+
+USERVER_NAMESPACE_END
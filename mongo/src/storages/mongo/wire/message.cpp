@@ -0,0 +1,167 @@
+#include <storages/mongo/wire/message.hpp>
+
+#include <userver/formats/bson/binary.hpp>
+#include <userver/formats/bson/exception.hpp>
+#include <userver/storages/mongo/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::wire {
+namespace {
+
+constexpr char kBodySection = 0;
+constexpr char kDocumentSequenceSection = 1;
+constexpr std::size_t kInt32Size = 4;
+constexpr std::size_t kMinDocumentSize = 5;
+
+// Bits 0-15 are required, the receiver must reject the ones it doesn't know
+constexpr std::uint32_t kRequiredFlagsMask = 0xFFFF;
+constexpr std::uint32_t kKnownRequiredFlags = kChecksumPresent | kMoreToCome;
+
+[[noreturn]] void ThrowMalformed(std::string_view reason) {
+  throw NetworkException("Malformed OP_MSG: ") << reason;
+}
+
+// Wire protocol integers are little-endian
+void AppendUInt32(std::string& out, std::uint32_t value) {
+  for (std::size_t i = 0; i < kInt32Size; ++i) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+void StoreUInt32(std::string& out, std::size_t pos, std::uint32_t value) {
+  for (std::size_t i = 0; i < kInt32Size; ++i) {
+    out[pos + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+  }
+}
+
+std::uint32_t LoadUInt32(std::string_view data, std::size_t pos) {
+  std::uint32_t value = 0;
+  for (std::size_t i = 0; i < kInt32Size; ++i) {
+    value |= std::uint32_t{static_cast<unsigned char>(data[pos + i])}
+             << (8 * i);
+  }
+  return value;
+}
+
+void AppendDocument(std::string& out, const formats::bson::Document& doc) {
+  out.append(formats::bson::ToBinaryString(doc).GetView());
+}
+
+formats::bson::Document ReadDocument(std::string_view data, std::size_t& pos) {
+  if (data.size() - pos < kMinDocumentSize) {
+    ThrowMalformed("truncated document");
+  }
+  const auto size = LoadUInt32(data, pos);
+  if (size < kMinDocumentSize || size > data.size() - pos) {
+    ThrowMalformed("invalid document size");
+  }
+  try {
+    auto doc = formats::bson::FromBinaryString(data.substr(pos, size));
+    pos += size;
+    return doc;
+  } catch (const formats::bson::BsonException& ex) {
+    ThrowMalformed(ex.what());
+  }
+}
+
+DocumentSequence ReadDocumentSequence(std::string_view data, std::size_t& pos) {
+  if (data.size() - pos < kInt32Size) ThrowMalformed("truncated section");
+  const auto size = LoadUInt32(data, pos);
+  if (size < kInt32Size + 1 || size > data.size() - pos) {
+    ThrowMalformed("invalid section size");
+  }
+  const auto section = data.substr(pos + kInt32Size, size - kInt32Size);
+  pos += size;
+
+  const auto identifier_end = section.find('\0');
+  if (identifier_end == std::string_view::npos) {
+    ThrowMalformed("unterminated sequence identifier");
+  }
+  DocumentSequence sequence;
+  sequence.identifier = std::string{section.substr(0, identifier_end)};
+  std::size_t section_pos = identifier_end + 1;
+  while (section_pos < section.size()) {
+    sequence.documents.push_back(ReadDocument(section, section_pos));
+  }
+  return sequence;
+}
+
+}  // namespace
+
+std::string SerializeOpMsg(std::int32_t request_id, const OpMsg& message) {
+  std::string out(kHeaderSize, '\0');
+  AppendUInt32(out, message.flags & ~kChecksumPresent);
+
+  out.push_back(kBodySection);
+  AppendDocument(out, message.body);
+
+  for (const auto& sequence : message.sequences) {
+    out.push_back(kDocumentSequenceSection);
+    const auto size_pos = out.size();
+    AppendUInt32(out, 0);
+    out.append(sequence.identifier);
+    out.push_back('\0');
+    for (const auto& doc : sequence.documents) AppendDocument(out, doc);
+    StoreUInt32(out, size_pos, out.size() - size_pos);
+  }
+
+  StoreUInt32(out, 0, out.size());
+  StoreUInt32(out, 4, request_id);
+  StoreUInt32(out, 8, 0);
+  StoreUInt32(out, 12, kOpMsg);
+  return out;
+}
+
+MessageHeader ParseHeader(std::string_view data) {
+  if (data.size() < kHeaderSize) ThrowMalformed("truncated header");
+
+  MessageHeader header;
+  header.message_length = static_cast<std::int32_t>(LoadUInt32(data, 0));
+  header.request_id = static_cast<std::int32_t>(LoadUInt32(data, 4));
+  header.response_to = static_cast<std::int32_t>(LoadUInt32(data, 8));
+  header.op_code = static_cast<std::int32_t>(LoadUInt32(data, 12));
+
+  if (header.message_length < static_cast<std::int32_t>(kHeaderSize) ||
+      static_cast<std::size_t>(header.message_length) > kMaxMessageSize) {
+    ThrowMalformed("invalid message length");
+  }
+  if (header.op_code != kOpMsg) ThrowMalformed("unexpected opcode");
+  return header;
+}
+
+OpMsg ParseOpMsg(std::string_view data) {
+  if (data.size() < kInt32Size) ThrowMalformed("truncated flags");
+
+  OpMsg message;
+  message.flags = LoadUInt32(data, 0);
+  if (message.flags & kRequiredFlagsMask & ~kKnownRequiredFlags) {
+    ThrowMalformed("unknown required flags");
+  }
+  if (message.flags & kChecksumPresent) {
+    if (data.size() < 2 * kInt32Size) ThrowMalformed("truncated checksum");
+    // CRC-32C is optional to validate, TCP checksums are relied upon
+    data.remove_suffix(kInt32Size);
+  }
+
+  bool has_body = false;
+  std::size_t pos = kInt32Size;
+  while (pos < data.size()) {
+    const auto kind = data[pos++];
+    if (kind == kBodySection) {
+      if (has_body) ThrowMalformed("multiple body sections");
+      message.body = ReadDocument(data, pos);
+      has_body = true;
+    } else if (kind == kDocumentSequenceSection) {
+      message.sequences.push_back(ReadDocumentSequence(data, pos));
+    } else {
+      ThrowMalformed("unknown section kind");
+    }
+  }
+  if (!has_body) ThrowMalformed("missing body section");
+  return message;
+}
+
+}  // namespace storages::mongo::impl::wire
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::wire {
+
+/// OP_MSG opcode
+inline constexpr std::int32_t kOpMsg = 2013;
+
+/// Size of the standard message header
+inline constexpr std::size_t kHeaderSize = 16;
+
+/// Default `maxMessageSizeBytes` of the server
+inline constexpr std::size_t kMaxMessageSize = 48'000'000;
+
+/// OP_MSG flag bits
+enum OpMsgFlags : std::uint32_t {
+  kChecksumPresent = 1U << 0,
+  kMoreToCome = 1U << 1,
+  kExhaustAllowed = 1U << 16,
+};
+
+/// Standard header preceding every wire protocol message
+struct MessageHeader final {
+  std::int32_t message_length{0};
+  std::int32_t request_id{0};
+  std::int32_t response_to{0};
+  std::int32_t op_code{0};
+};
+
+/// Payload type 1 section: a sequence of documents for a command argument,
+/// e.g. `documents` of an `insert`
+struct DocumentSequence final {
+  std::string identifier;
+  std::vector<formats::bson::Document> documents;
+};
+
+/// OP_MSG contents following the header
+struct OpMsg final {
+  std::uint32_t flags{0};
+  formats::bson::Document body;
+  std::vector<DocumentSequence> sequences;
+};
+
+/// Serializes the message with its header, checksums are never sent
+std::string SerializeOpMsg(std::int32_t request_id, const OpMsg& message);
+
+/// @throws NetworkException if the header is malformed
+MessageHeader ParseHeader(std::string_view data);
+
+/// Parses the message contents following the header
+/// @throws NetworkException if the message is malformed
+OpMsg ParseOpMsg(std::string_view data);
+
+}  // namespace storages::mongo::impl::wire
+
+USERVER_NAMESPACE_END
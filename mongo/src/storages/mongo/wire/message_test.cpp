@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+
+#include <storages/mongo/wire/message.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace wire = storages::mongo::impl::wire;
+
+namespace {
+
+std::string_view Payload(const std::string& message) {
+  return std::string_view{message}.substr(wire::kHeaderSize);
+}
+
+}  // namespace
+
+TEST(MongoWire, RoundTrip) {
+  wire::OpMsg message;
+  message.body = formats::bson::MakeDoc("insert", "coll", "ordered", true);
+  message.sequences.push_back(
+      {"documents",
+       {formats::bson::MakeDoc("_id", 1), formats::bson::MakeDoc("_id", 2)}});
+
+  const auto serialized = wire::SerializeOpMsg(42, message);
+  const auto header = wire::ParseHeader(serialized);
+  EXPECT_EQ(header.message_length, static_cast<int>(serialized.size()));
+  EXPECT_EQ(header.request_id, 42);
+  EXPECT_EQ(header.response_to, 0);
+  EXPECT_EQ(header.op_code, wire::kOpMsg);
+
+  const auto parsed = wire::ParseOpMsg(Payload(serialized));
+  EXPECT_EQ(parsed.flags, 0u);
+  EXPECT_EQ(parsed.body, message.body);
+  ASSERT_EQ(parsed.sequences.size(), 1u);
+  EXPECT_EQ(parsed.sequences[0].identifier, "documents");
+  ASSERT_EQ(parsed.sequences[0].documents.size(), 2u);
+  EXPECT_EQ(parsed.sequences[0].documents[1]["_id"].As<int>(), 2);
+}
+
+TEST(MongoWire, Checksum) {
+  wire::OpMsg message;
+  message.body = formats::bson::MakeDoc("ok", 1.0);
+  auto serialized = wire::SerializeOpMsg(1, message);
+  serialized[wire::kHeaderSize] |= static_cast<char>(wire::kChecksumPresent);
+  serialized.append(4, '\xFF');
+
+  const auto parsed = wire::ParseOpMsg(Payload(serialized));
+  EXPECT_EQ(parsed.body, message.body);
+}
+
+TEST(MongoWire, Malformed) {
+  wire::OpMsg message;
+  message.body = formats::bson::MakeDoc("ping", 1);
+  const auto serialized = wire::SerializeOpMsg(1, message);
+
+  UEXPECT_THROW(wire::ParseHeader(std::string_view{serialized}.substr(0, 8)),
+                storages::mongo::NetworkException);
+  UEXPECT_THROW(wire::ParseOpMsg(Payload(serialized).substr(0, 10)),
+                storages::mongo::NetworkException);
+
+  auto unknown_section = serialized;
+  unknown_section[wire::kHeaderSize + 4] = 5;
+  UEXPECT_THROW(wire::ParseOpMsg(Payload(unknown_section)),
+                storages::mongo::NetworkException);
+
+  auto unknown_flag = serialized;
+  unknown_flag[wire::kHeaderSize] |= 1 << 3;
+  UEXPECT_THROW(wire::ParseOpMsg(Payload(unknown_flag)),
+                storages::mongo::NetworkException);
+
+  auto wrong_opcode = serialized;
+  wrong_opcode[12] = 1;
+  UEXPECT_THROW(wire::ParseHeader(wrong_opcode),
+                storages::mongo::NetworkException);
+}
+
+USERVER_NAMESPACE_END
@@ -113,7 +113,12 @@ class Cluster final {
   /// See @ref scripts/docs/en/userver/mysql/supported_types.md for better
   /// understanding of `Container::value_type` requirements.
   ///
-  /// @note Requires MariaDB 10.2.6+ as a server
+  /// @note Uses a single batch execution with MariaDB 10.2.6+ as a server.
+  /// Other servers require an `INSERT ... VALUES (...)` statement, which is
+  /// executed as multi-row inserts of up to 1000 rows each. Outside of a
+  /// transaction these inserts are not atomic together: if one of them fails,
+  /// the rows of the preceding ones stay inserted. Use a transaction (see
+  /// Begin) if all the rows must be inserted atomically.
   ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
@@ -131,7 +136,12 @@ class Cluster final {
   /// See @ref scripts/docs/en/userver/mysql/supported_types.md for better understanding of
   /// `Container::value_type` requirements.
   ///
-  /// @note Requires MariaDB 10.2.6+ as a server
+  /// @note Uses a single batch execution with MariaDB 10.2.6+ as a server.
+  /// Other servers require an `INSERT ... VALUES (...)` statement, which is
+  /// executed as multi-row inserts of up to 1000 rows each. Outside of a
+  /// transaction these inserts are not atomic together: if one of them fails,
+  /// the rows of the preceding ones stay inserted. Use a transaction (see
+  /// Begin) if all the rows must be inserted atomically.
   ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
@@ -153,7 +163,12 @@ class Cluster final {
   /// `MapTo Convert(const Container::value_type&, storages::mysql::convert::To<MapTo>)`
   /// in namespace of `MapTo` or storages::mysql::convert.
   ///
-  /// @note Requires MariaDB 10.2.6+ as a server
+  /// @note Uses a single batch execution with MariaDB 10.2.6+ as a server.
+  /// Other servers require an `INSERT ... VALUES (...)` statement, which is
+  /// executed as multi-row inserts of up to 1000 rows each. Outside of a
+  /// transaction these inserts are not atomic together: if one of them fails,
+  /// the rows of the preceding ones stay inserted. Use a transaction (see
+  /// Begin) if all the rows must be inserted atomically.
   ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
@@ -175,7 +190,12 @@ class Cluster final {
   /// `MapTo Convert(const Container::value_type&, storages::mysql::convert::To<MapTo>)`
   /// in namespace of `MapTo` or storages::mysql::convert.
   ///
-  /// @note Requires MariaDB 10.2.6+ as a server
+  /// @note Uses a single batch execution with MariaDB 10.2.6+ as a server.
+  /// Other servers require an `INSERT ... VALUES (...)` statement, which is
+  /// executed as multi-row inserts of up to 1000 rows each. Outside of a
+  /// transaction these inserts are not atomic together: if one of them fails,
+  /// the rows of the preceding ones stay inserted. Use a transaction (see
+  /// Begin) if all the rows must be inserted atomically.
   ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
@@ -30,6 +30,17 @@ class CursorResultSet final {
   template <typename RowCallback>
   void ForEach(RowCallback&& row_callback, engine::Deadline deadline) &&;
 
+  /// @brief Fetches all the rows from cursor and executes row_callback for
+  /// each of them right after it's fetched, without batching them into
+  /// intermediate containers.
+  ///
+  /// `T` may contain `std::string_view` fields, which point into buffers
+  /// reused between the rows and are only valid until row_callback returns.
+  /// Usable for huge exports, when the rows are converted or serialized
+  /// right away.
+  template <typename RowCallback>
+  void ForEachRow(RowCallback&& row_callback, engine::Deadline deadline) &&;
+
  private:
   StatementResultSet result_set_;
 };
@@ -68,6 +79,22 @@ void CursorResultSet<T>::ForEach(
   }
 }
 
+template <typename T>
+template <typename RowCallback>
+void CursorResultSet<T>::ForEachRow(
+    RowCallback&& row_callback,
+    // TODO : think about separate deadline here
+    [[maybe_unused]] engine::Deadline deadline) && {
+  auto extractor =
+      impl::io::StreamingExtractor<T, RowTag,
+                                   std::remove_reference_t<RowCallback>>{
+          row_callback};
+
+  tracing::ScopeTime fetch{impl::tracing::kFetchScope};
+  while (result_set_.FetchResult(extractor)) {
+  }
+}
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
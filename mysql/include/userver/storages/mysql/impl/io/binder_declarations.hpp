@@ -32,6 +32,15 @@ void BindOutput(mysql::impl::OutputBindingsFwd& binds, std::size_t pos,
                                               ExplicitRef<T>{field});
 }
 
+// Same as BindOutput, but allows std::string_view fields, which are valid until
+// the next row is fetched
+template <typename T>
+void BindOutputView(mysql::impl::OutputBindingsFwd& binds, std::size_t pos,
+                    T& field) {
+  storages::mysql::impl::io::FreestandingBind(binds, pos,
+                                              ExplicitRef<T>{field});
+}
+
 }  // namespace storages::mysql::impl::io
 
 USERVER_NAMESPACE_END
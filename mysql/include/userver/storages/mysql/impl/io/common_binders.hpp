@@ -99,11 +99,11 @@ void FreestandingBind(OutputBindingsFwd& binds, std::size_t pos,
 void FreestandingBind(OutputBindingsFwd& binds, std::size_t pos,
                       ExplicitRef<std::optional<formats::json::Value>> val);
 
-// These 2 should never be called, so we just leave them unimplemented
-void FreestandingBind(OutputBindingsFwd&, std::size_t,
-                      ExplicitRef<std::string_view>);
-void FreestandingBind(OutputBindingsFwd&, std::size_t,
-                      ExplicitRef<std::optional<std::string_view>>);
+// These 2 are only reachable from streaming extraction, see BindOutputView
+void FreestandingBind(OutputBindingsFwd& binds, std::size_t pos,
+                      ExplicitRef<std::string_view> val);
+void FreestandingBind(OutputBindingsFwd& binds, std::size_t pos,
+                      ExplicitRef<std::optional<std::string_view>> val);
 
 void FreestandingBind(OutputBindingsFwd& binds, std::size_t pos,
                       ExplicitRef<std::chrono::system_clock::time_point> val);
@@ -124,6 +124,64 @@ class TypedExtractor final : public ExtractorBase {
   InternalStorageType storage_;
 };
 
+// Binds every row into the same instance of T and passes it to the callback
+// right after it's fetched, so no intermediate container is built.
+// std::string_view fields of T point into per-field buffers, that are reused
+// between the rows.
+template <typename T, typename ExtractionTag, typename RowCallback>
+class StreamingExtractor final : public ExtractorBase {
+ public:
+  explicit StreamingExtractor(RowCallback& row_callback);
+
+  void Reserve(std::size_t) final {}
+
+  impl::bindings::OutputBindings& BindNextRow() final;
+
+  void CommitLastRow() final;
+
+  void RollbackLastRow() final {}
+
+  std::size_t ColumnsCount() const final;
+
+ private:
+  static constexpr std::size_t GetColumnsCount() {
+    if constexpr (std::is_same_v<ExtractionTag, RowTag>) {
+      return boost::pfr::tuple_size_v<T>;
+    } else if constexpr (std::is_same_v<ExtractionTag, FieldTag>) {
+      return 1;
+    } else {
+      static_assert(!sizeof(ExtractionTag), "should be unreachable");
+    }
+  }
+
+  RowCallback& row_callback_;
+  T row_{};
+};
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+StreamingExtractor<T, ExtractionTag, RowCallback>::StreamingExtractor(
+    RowCallback& row_callback)
+    : ExtractorBase{GetColumnsCount()}, row_callback_{row_callback} {}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+impl::bindings::OutputBindings&
+StreamingExtractor<T, ExtractionTag, RowCallback>::BindNextRow() {
+  // Callback is allowed to move from the row, so we start anew every time
+  row_ = T{};
+  return binder_.BindViewsTo(row_, ExtractionTag{});
+}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+void StreamingExtractor<T, ExtractionTag, RowCallback>::CommitLastRow() {
+  row_callback_(std::move(row_));
+}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+std::size_t StreamingExtractor<T, ExtractionTag, RowCallback>::ColumnsCount()
+    const {
+  return GetColumnsCount();
+}
+
 template <typename Container, typename MapFrom, typename ExtractionTag>
 TypedExtractor<Container, MapFrom, ExtractionTag>::TypedExtractor()
     : ExtractorBase{GetColumnsCount()},
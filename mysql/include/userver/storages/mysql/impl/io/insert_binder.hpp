@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include <boost/pfr/core.hpp>
 
@@ -57,6 +58,34 @@ class InsertBinder final : public InsertBinderBase {
 
   std::size_t GetRowsCount() const final { return container_.size(); }
 
+  void BindRows(InputBindingsFwd& binds, std::size_t first_row,
+                std::size_t rows_count) final {
+    UASSERT(first_row == bound_rows_count_);
+    UASSERT(first_row + rows_count <= container_.size());
+
+    if constexpr (kIsMapped) {
+      chunk_rows_.clear();
+      chunk_rows_.reserve(rows_count);
+    }
+
+    for (std::size_t row = 0; row < rows_count; ++row, ++bound_rows_it_) {
+      const Row* row_ptr = nullptr;
+      if constexpr (kIsMapped) {
+        row_ptr = &chunk_rows_.emplace_back(
+            storages::mysql::convert::DoConvert<Row>(*bound_rows_it_));
+      } else {
+        row_ptr = &*bound_rows_it_;
+      }
+
+      boost::pfr::for_each_field(
+          *row_ptr, [&binds, offset = row * kColumnsCount](
+                        const auto& field, std::size_t i) {
+            storages::mysql::impl::io::BindInput(binds, offset + i, field);
+          });
+    }
+    bound_rows_count_ += rows_count;
+  }
+
  private:
   using Row = MapTo;
   static constexpr std::size_t kColumnsCount = boost::pfr::tuple_size_v<Row>;
@@ -114,6 +143,11 @@ class InsertBinder final : public InsertBinderBase {
   const Row* current_row_ptr_;
 
   std::size_t max_row_number_seen_{0};
+
+  // State of BindRows
+  typename Container::const_iterator bound_rows_it_{container_.begin()};
+  std::size_t bound_rows_count_{0};
+  std::vector<Row> chunk_rows_;
 };
 
 template <typename Container, typename MapTo>
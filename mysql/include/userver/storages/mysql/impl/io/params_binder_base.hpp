@@ -17,6 +17,12 @@ class ParamsBinderBase {
 
   virtual std::size_t GetRowsCount() const = 0;
 
+  // Binds `rows_count` rows starting from `first_row` as a single row of
+  // `rows_count * <columns count>` params, for servers without batch execution
+  // support. Rows are expected to be requested sequentially.
+  virtual void BindRows(InputBindingsFwd& binds, std::size_t first_row,
+                        std::size_t rows_count);
+
  protected:
   ~ParamsBinderBase();
 
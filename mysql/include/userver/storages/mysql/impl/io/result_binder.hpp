@@ -36,6 +36,22 @@ class ResultBinder final {
     return GetBinds();
   }
 
+  // Same as BindTo, but allows std::string_view fields
+  template <typename T, typename ExtractionTag>
+  OutputBindingsFwd& BindViewsTo(T& row, ExtractionTag) {
+    if constexpr (std::is_same_v<ExtractionTag, RowTag>) {
+      boost::pfr::for_each_field(
+          row, [&binds = GetBinds()](auto& field, std::size_t i) {
+            storages::mysql::impl::io::BindOutputView(binds, i, field);
+          });
+    } else {
+      static_assert(std::is_same_v<ExtractionTag, FieldTag>);
+      storages::mysql::impl::io::BindOutputView(GetBinds(), 0, row);
+    }
+
+    return GetBinds();
+  }
+
   OutputBindingsFwd& GetBinds();
 
  private:
@@ -157,6 +157,33 @@ class StatementResultSet final {
   template <typename T>
   std::optional<T> AsOptionalSingleField() &&;
 
+  // clang-format off
+  /// @brief Parse statement result set row by row, calling
+  /// `row_callback(T&&)` for each row right after it's fetched.
+  /// `T` is expected to be an aggregate of supported types, which may also
+  /// contain `std::string_view` and `std::optional<std::string_view>` fields.
+  /// Views point into buffers reused between the rows and are only valid until
+  /// `row_callback` returns, so no allocations are made for them.
+  /// See @ref scripts/docs/en/userver/mysql/supported_types.md for better understanding of
+  /// `T` requirements.
+  ///
+  /// UINVARIANTs on columns count mismatch or types mismatch.
+  ///
+  /// @snippet storages/tests/unittests/statement_result_set_mysqltest.cpp uMySQL usage sample - StatementResultSet ForEachRow
+  // clang-format on
+  template <typename T, typename RowCallback>
+  void ForEachRow(RowCallback&& row_callback) &&;
+
+  /// @brief Parse statement result set row by row, calling
+  /// `row_callback(T&&)` for each row right after it's fetched.
+  /// Result set is expected to have a single column, `T` is expected to be
+  /// one of supported types or `std::string_view`, valid until `row_callback`
+  /// returns.
+  ///
+  /// UINVARIANTs on columns count not being equal to 1 or type mismatch.
+  template <typename T, typename RowCallback>
+  void ForEachRow(RowCallback&& row_callback, FieldTag) &&;
+
   // clang-format off
   /// @brief Converts to an interface for on-the-flight mapping
   /// statement result set from `DbType`.
@@ -185,6 +212,9 @@ class StatementResultSet final {
   template <typename T, typename ExtractionTag>
   std::optional<T> DoAsOptionalSingleRow() &&;
 
+  template <typename T, typename ExtractionTag, typename RowCallback>
+  void DoForEachRow(RowCallback&& row_callback) &&;
+
   bool FetchResult(impl::io::ExtractorBase& extractor);
 
   struct Impl;
@@ -322,6 +352,29 @@ std::optional<T> StatementResultSet::AsOptionalSingleField() && {
   return std::move(*this).DoAsOptionalSingleRow<T, FieldTag>();
 }
 
+template <typename T, typename RowCallback>
+void StatementResultSet::ForEachRow(RowCallback&& row_callback) && {
+  std::move(*this).DoForEachRow<T, RowTag>(
+      std::forward<RowCallback>(row_callback));
+}
+
+template <typename T, typename RowCallback>
+void StatementResultSet::ForEachRow(RowCallback&& row_callback, FieldTag) && {
+  std::move(*this).DoForEachRow<T, FieldTag>(
+      std::forward<RowCallback>(row_callback));
+}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+void StatementResultSet::DoForEachRow(RowCallback&& row_callback) && {
+  using Extractor =
+      impl::io::StreamingExtractor<T, ExtractionTag,
+                                   std::remove_reference_t<RowCallback>>;
+  Extractor extractor{row_callback};
+
+  tracing::ScopeTime fetch{impl::tracing::kFetchScope};
+  std::move(*this).FetchResult(extractor);
+}
+
 template <typename Container, typename MapFrom, typename ExtractionTag>
 Container StatementResultSet::DoAsContainerMapped() && {
   static_assert(meta::kIsRange<Container>,
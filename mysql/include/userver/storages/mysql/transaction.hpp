@@ -63,7 +63,9 @@ class Transaction final {
   /// See @ref userver_mysql_types for better understanding of
   /// `Container::value_type` requirements.
   ///
-  /// @note Requires MariaDB 10.2.6+ as a server
+  /// @note Uses a single batch execution with MariaDB 10.2.6+ as a server.
+  /// Other servers require an `INSERT ... VALUES (...)` statement, which is
+  /// executed as multi-row inserts of up to 1000 rows each.
   ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
@@ -82,7 +84,9 @@ class Transaction final {
   /// `MapTo Convert(const Container::value_type&, storages::mysql::convert::To<MapTo>)`
   /// in namespace of `MapTo` or storages::mysql::convert.
   ///
-  /// @note Requires MariaDB 10.2.6+ as a server
+  /// @note Uses a single batch execution with MariaDB 10.2.6+ as a server.
+  /// Other servers require an `INSERT ... VALUES (...)` statement, which is
+  /// executed as multi-row inserts of up to 1000 rows each.
   ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
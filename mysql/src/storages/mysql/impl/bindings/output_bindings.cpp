@@ -198,6 +198,13 @@ void OutputBindings::Bind(std::size_t pos, O<std::string>& val) {
   BindOptionalString(pos, val);
 }
 
+void OutputBindings::Bind(std::size_t pos, std::string_view& val) {
+  BindStringView(pos, val);
+}
+void OutputBindings::Bind(std::size_t pos, O<std::string_view>& val) {
+  BindOptionalStringView(pos, val);
+}
+
 void OutputBindings::Bind(std::size_t pos, formats::json::Value& val) {
   BindJson(pos, val);
 }
@@ -286,6 +293,68 @@ void OutputBindings::OptionalStringBeforeFetch(void* value, MYSQL_BIND& bind,
   }
 }
 
+void OutputBindings::BindStringView(std::size_t pos, std::string_view& val) {
+  auto& string = intermediate_buffers_[pos].string;
+  auto& bind = GetBind(pos);
+  auto& cb = callbacks_[pos];
+
+  bind.buffer_type = MYSQL_TYPE_STRING;
+  bind.buffer = string.data();
+  bind.buffer_length = string.size();
+  bind.length = &bind.length_value;
+  bind.error = &bind.error_value;
+
+  cb.value = &val;
+  cb.before_fetch_cb = &StringViewBeforeFetch;
+  cb.after_fetch_cb = &StringViewAfterFetch;
+}
+
+void OutputBindings::StringViewBeforeFetch(void*, MYSQL_BIND& bind,
+                                           FieldIntermediateBuffer& buffer) {
+  auto& string = buffer.string;
+
+  // The value fits into the buffer otherwise, nothing to do
+  if (bind.error_value) {
+    UASSERT(bind.length_value > string.size());
+    string.resize(bind.length_value);
+    bind.buffer = string.data();
+    bind.buffer_length = bind.length_value;
+  }
+}
+
+void OutputBindings::StringViewAfterFetch(void* value, MYSQL_BIND& bind,
+                                          FieldIntermediateBuffer& buffer) {
+  auto* view = static_cast<std::string_view*>(value);
+  UASSERT(view);
+
+  *view = std::string_view{buffer.string.data(), bind.length_value};
+}
+
+void OutputBindings::BindOptionalStringView(
+    std::size_t pos, std::optional<std::string_view>& val) {
+  BindStringView(pos, val.emplace());
+
+  auto& bind = GetBind(pos);
+  auto& cb = callbacks_[pos];
+
+  bind.is_null = &bind.is_null_value;
+
+  cb.value = &val;
+  cb.after_fetch_cb = &OptionalStringViewAfterFetch;
+}
+
+void OutputBindings::OptionalStringViewAfterFetch(
+    void* value, MYSQL_BIND& bind, FieldIntermediateBuffer& buffer) {
+  auto* optional = static_cast<std::optional<std::string_view>*>(value);
+  UASSERT(optional);
+
+  if (bind.is_null_value) {
+    optional->reset();
+  } else {
+    optional->emplace(buffer.string.data(), bind.length_value);
+  }
+}
+
 void OutputBindings::BindTimePoint(std::size_t pos,
                                    std::chrono::system_clock::time_point& val) {
   auto& date = intermediate_buffers_[pos].time;
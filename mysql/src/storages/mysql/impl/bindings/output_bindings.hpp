@@ -64,15 +64,9 @@ class OutputBindings : public NativeBindsHelper {
   void Bind(std::size_t pos, formats::json::Value& val);
   void Bind(std::size_t pos, O<formats::json::Value>& val);
 
-  // These 2 should never be called, so we just leave them unimplemented
-  void Bind(std::size_t, std::string_view&) {
-    UINVARIANT(false,
-               "std::string_view for output binding should be unreachable");
-  }
-  void Bind(std::size_t, O<std::string_view>&) {
-    UINVARIANT(false,
-               "std::string_view for output binding should be unreachable");
-  }
+  // Only reachable from streaming extraction, see io::BindOutputView
+  void Bind(std::size_t pos, std::string_view& val);
+  void Bind(std::size_t pos, O<std::string_view>& val);
 
   void Bind(std::size_t pos, std::chrono::system_clock::time_point& val);
   void Bind(std::size_t pos, O<std::chrono::system_clock::time_point>& val);
@@ -125,6 +119,24 @@ class OutputBindings : public NativeBindsHelper {
   static void OptionalStringBeforeFetch(void* value, MYSQL_BIND& bind,
                                         FieldIntermediateBuffer&);
 
+  // The special problem of binding string views: they don't own the data, so
+  // we fetch into the intermediate buffer of the field, which outlives the row
+  // and keeps its capacity between rows. Most of the rows fit into it and are
+  // fetched without truncation, so the second fetch and allocations are
+  // avoided. The view is valid until the next row is fetched.
+  void BindStringView(std::size_t pos, std::string_view& val);
+  static void StringViewBeforeFetch(void* value, MYSQL_BIND& bind,
+                                    FieldIntermediateBuffer& buffer);
+  static void StringViewAfterFetch(void* value, MYSQL_BIND& bind,
+                                   FieldIntermediateBuffer& buffer);
+
+  // Same as for string views, but we have to determine whether the field is
+  // null first
+  void BindOptionalStringView(std::size_t pos,
+                              std::optional<std::string_view>& val);
+  static void OptionalStringViewAfterFetch(void* value, MYSQL_BIND& bind,
+                                           FieldIntermediateBuffer& buffer);
+
   // The special problem of binding dates: they are not buffer-wise
   // compatible with C++ types, so we have to store DB date in some
   // storage first, call mysql_stmt_fetch_column and fill the C++ type after
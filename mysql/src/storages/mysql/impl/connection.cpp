@@ -1,5 +1,6 @@
 #include <storages/mysql/impl/connection.hpp>
 
+#include <algorithm>
 // for std::cerr in AbortOnBuggyLibmariadb
 #include <iostream>
 
@@ -11,13 +12,16 @@
 #include <userver/logging/log.hpp>
 #include <userver/tracing/scope_time.hpp>
 
+#include <storages/mysql/impl/bindings/input_bindings.hpp>
 #include <storages/mysql/impl/metadata/native_client_info.hpp>
 #include <storages/mysql/impl/metadata/server_info.hpp>
+#include <storages/mysql/impl/multi_row_insert.hpp>
 #include <storages/mysql/impl/native_interface.hpp>
 #include <storages/mysql/impl/plain_query.hpp>
 #include <storages/mysql/settings/settings.hpp>
 #include <userver/storages/mysql/exceptions.hpp>
 #include <userver/storages/mysql/impl/io/extractor.hpp>
+#include <userver/storages/mysql/impl/io/params_binder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -128,6 +132,11 @@ Connection::~Connection() {
   // We close the connection before resetting statements cache, so that reset
   // doesn't do potentially costly I/O
   Close(engine::Deadline::FromDuration(kDefaultCloseTimeout));
+
+  if (multi_row_tail_statement_.has_value()) {
+    multi_row_tail_statement_->SetDestructionDeadline(
+        engine::Deadline::FromDuration(kDefaultCloseTimeout));
+  }
 }
 
 QueryResult Connection::ExecuteQuery(const std::string& query,
@@ -147,6 +156,11 @@ StatementFetcher Connection::ExecuteStatement(
   auto guard = GetBrokenGuard();
 
   return guard.Execute([&] {
+    if (params.GetRowsCount() > 1 && !SupportsBatchExecution()) {
+      UASSERT(!batch_size.has_value());
+      return ExecuteMultiRowStatement(statement, params, deadline);
+    }
+
     auto& mysql_statement = PrepareStatement(statement, deadline, batch_size);
 
     return mysql_statement.Execute(params, deadline);
@@ -335,6 +349,73 @@ Statement& Connection::PrepareStatement(const std::string& statement,
   return mysql_statement;
 }
 
+bool Connection::SupportsBatchExecution() const {
+  return server_info_.server_type == metadata::ServerInfo::Type::kMariaDB &&
+         server_info_.server_version >= metadata::SemVer{10, 2, 6};
+}
+
+StatementFetcher Connection::ExecuteMultiRowStatement(
+    const std::string& statement, io::ParamsBinderBase& params,
+    engine::Deadline deadline) {
+  const auto rows_count = params.GetRowsCount();
+  const auto columns_count = params.GetBinds().Size();
+  const auto chunk_size = GetMultiRowChunkSize(columns_count);
+
+  // Statement text of full chunks is the same, no need to rebuild it
+  std::optional<std::string> full_chunk_statement;
+
+  std::uint64_t rows_affected = 0;
+  std::optional<std::uint64_t> first_insert_id;
+  for (std::size_t first_row = 0;;) {
+    const auto chunk_rows = std::min(chunk_size, rows_count - first_row);
+
+    io::ParamsBinder chunk_params{chunk_rows * columns_count};
+    params.BindRows(chunk_params.GetBinds(), first_row, chunk_rows);
+
+    Statement* mysql_statement = nullptr;
+    if (chunk_rows == chunk_size) {
+      if (!full_chunk_statement.has_value()) {
+        full_chunk_statement.emplace(
+            BuildMultiRowStatement(statement, chunk_size));
+      }
+      mysql_statement =
+          &PrepareStatement(*full_chunk_statement, deadline, std::nullopt);
+    } else {
+      mysql_statement = &PrepareMultiRowTailStatement(
+          BuildMultiRowStatement(statement, chunk_rows), deadline);
+    }
+
+    auto fetcher = mysql_statement->Execute(chunk_params, deadline);
+    if (!first_insert_id.has_value()) {
+      first_insert_id.emplace(fetcher.LastInsertId());
+    }
+
+    first_row += chunk_rows;
+    if (first_row == rows_count) {
+      fetcher.SetPrecedingBatchResults(rows_affected, *first_insert_id);
+      return fetcher;
+    }
+    rows_affected += fetcher.RowsAffected();
+  }
+}
+
+Statement& Connection::PrepareMultiRowTailStatement(
+    const std::string& statement, engine::Deadline deadline) {
+  if (multi_row_tail_statement_.has_value()) {
+    if (multi_row_tail_statement_->GetStatementText() == statement) {
+      return *multi_row_tail_statement_;
+    }
+
+    multi_row_tail_statement_->SetDestructionDeadline(deadline);
+    multi_row_tail_statement_.reset();
+  }
+
+  auto& mysql_statement =
+      multi_row_tail_statement_.emplace(*this, statement, deadline);
+  mysql_statement.SetNoCursor();
+  return mysql_statement;
+}
+
 }  // namespace storages::mysql::impl
 
 USERVER_NAMESPACE_END
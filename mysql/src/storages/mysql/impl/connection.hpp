@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -87,6 +88,13 @@ class Connection final {
                               engine::Deadline deadline,
                               std::optional<std::size_t> batch_size);
 
+  bool SupportsBatchExecution() const;
+  StatementFetcher ExecuteMultiRowStatement(const std::string& statement,
+                                            io::ParamsBinderBase& params,
+                                            engine::Deadline deadline);
+  Statement& PrepareMultiRowTailStatement(const std::string& statement,
+                                          engine::Deadline deadline);
+
   std::atomic<bool> broken_{false};
 
   Socket socket_;
@@ -95,6 +103,9 @@ class Connection final {
   metadata::ServerInfo server_info_{};
 
   StatementsCache statements_cache_;
+  // The last chunk of a multi-row insert may have any size, caching each size
+  // would evict the useful statements. The last of them is kept here instead.
+  std::optional<Statement> multi_row_tail_statement_;
 };
 
 }  // namespace impl
@@ -113,14 +113,13 @@ void FreestandingBind(OutputBindingsFwd& binds, std::size_t pos,
   binds.Bind(pos, val.Get());
 }
 
-// These 2 should never be called, so we just leave them unimplemented
-void FreestandingBind(OutputBindingsFwd&, std::size_t,
-                      ExplicitRef<std::string_view>) {
-  UINVARIANT(false, "should be unreachable");
-}
-void FreestandingBind(OutputBindingsFwd&, std::size_t,
-                      ExplicitRef<std::optional<std::string_view>>) {
-  UINVARIANT(false, "should be unreachable");
+void FreestandingBind(OutputBindingsFwd& binds, std::size_t pos,
+                      ExplicitRef<std::string_view> val) {
+  binds.Bind(pos, val.Get());
+}
+void FreestandingBind(OutputBindingsFwd& binds, std::size_t pos,
+                      ExplicitRef<std::optional<std::string_view>> val) {
+  binds.Bind(pos, val.Get());
 }
 
 void FreestandingBind(OutputBindingsFwd& binds, std::size_t pos,
@@ -1,5 +1,7 @@
 #include <userver/storages/mysql/impl/io/params_binder_base.hpp>
 
+#include <stdexcept>
+
 #include <storages/mysql/impl/bindings/input_bindings.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,6 +15,10 @@ ParamsBinderBase::ParamsBinderBase(ParamsBinderBase&& other) noexcept
 
 InputBindingsFwd& ParamsBinderBase::GetBinds() { return *binds_impl_; }
 
+void ParamsBinderBase::BindRows(InputBindingsFwd&, std::size_t, std::size_t) {
+  throw std::logic_error{"Params binder doesn't support binding rows"};
+}
+
 ParamsBinderBase::~ParamsBinderBase() = default;
 
 }  // namespace storages::mysql::impl::io
@@ -0,0 +1,137 @@
+#include <storages/mysql/impl/multi_row_insert.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+namespace {
+
+constexpr std::size_t kMaxParamsCount = 65535;
+// Keeps the statements reasonably sized even for a few columns
+constexpr std::size_t kMaxChunkSize = 1000;
+
+bool IsQuote(char c) { return c == '\'' || c == '"' || c == '`'; }
+
+bool IsIdentifierChar(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$';
+}
+
+// Returns the position right after the quoted literal/identifier at `pos`
+std::size_t SkipQuoted(std::string_view statement, std::size_t pos) {
+  const char quote = statement[pos];
+  for (++pos; pos < statement.size(); ++pos) {
+    if (statement[pos] == '\\' && quote != '`') {
+      ++pos;
+    } else if (statement[pos] == quote) {
+      return pos + 1;
+    }
+  }
+  return pos;
+}
+
+// Returns the position of the closing parenthesis for the one at `pos`
+std::optional<std::size_t> FindClosingParenthesis(std::string_view statement,
+                                                  std::size_t pos) {
+  UASSERT(statement[pos] == '(');
+
+  std::size_t depth = 0;
+  while (pos < statement.size()) {
+    const char c = statement[pos];
+    if (IsQuote(c)) {
+      pos = SkipQuoted(statement, pos);
+      continue;
+    }
+
+    if (c == '(') {
+      ++depth;
+    } else if (c == ')' && --depth == 0) {
+      return pos;
+    }
+    ++pos;
+  }
+
+  return std::nullopt;
+}
+
+// Finds [begin, end) of the row tuple following the VALUES keyword
+std::optional<std::pair<std::size_t, std::size_t>> FindValuesTuple(
+    std::string_view statement) {
+  const utils::StrIcaseEqual equal{};
+
+  std::size_t pos = 0;
+  while (pos < statement.size()) {
+    const char c = statement[pos];
+    if (IsQuote(c)) {
+      pos = SkipQuoted(statement, pos);
+      continue;
+    }
+    if (!IsIdentifierChar(c)) {
+      ++pos;
+      continue;
+    }
+
+    const auto word_begin = pos;
+    while (pos < statement.size() && IsIdentifierChar(statement[pos])) ++pos;
+    const auto word = statement.substr(word_begin, pos - word_begin);
+    if (!equal(word, "VALUES") && !equal(word, "VALUE")) continue;
+
+    while (pos < statement.size() &&
+           std::isspace(static_cast<unsigned char>(statement[pos]))) {
+      ++pos;
+    }
+    if (pos == statement.size() || statement[pos] != '(') return std::nullopt;
+
+    const auto tuple_end = FindClosingParenthesis(statement, pos);
+    if (!tuple_end.has_value()) return std::nullopt;
+    return std::make_pair(pos, *tuple_end + 1);
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace
+
+std::size_t GetMultiRowChunkSize(std::size_t columns_count) {
+  UASSERT(columns_count > 0);
+  return std::clamp<std::size_t>(kMaxParamsCount / columns_count, 1,
+                                 kMaxChunkSize);
+}
+
+std::string BuildMultiRowStatement(std::string_view statement,
+                                   std::size_t rows_count) {
+  UASSERT(rows_count > 0);
+
+  const auto tuple = FindValuesTuple(statement);
+  if (!tuple.has_value()) {
+    throw std::logic_error{
+        "Batch execution requires either MariaDB 10.2.6 or later, or an "
+        "'INSERT ... VALUES (...)' statement"};
+  }
+
+  const auto [tuple_begin, tuple_end] = *tuple;
+  const auto row = statement.substr(tuple_begin, tuple_end - tuple_begin);
+
+  std::string result;
+  result.reserve(statement.size() + (row.size() + 2) * (rows_count - 1));
+  result.append(statement.substr(0, tuple_end));
+  for (std::size_t i = 1; i < rows_count; ++i) {
+    result.append(", ");
+    result.append(row);
+  }
+  result.append(statement.substr(tuple_end));
+
+  return result;
+}
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
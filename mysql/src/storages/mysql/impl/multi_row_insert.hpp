@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+// Batch execution (COM_STMT_BULK_EXECUTE) is a MariaDB extension, for other
+// servers batches are sent as multi-row
+// 'INSERT ... VALUES (...), (...), ...' statements instead.
+
+// Maximum count of rows in a single multi-row statement, limited by the
+// protocol limit of 65535 params in a prepared statement.
+std::size_t GetMultiRowChunkSize(std::size_t columns_count);
+
+// Repeats the row tuple of 'INSERT ... VALUES (...)' `rows_count` times,
+// throws std::logic_error if the statement has no such tuple.
+std::string BuildMultiRowStatement(std::string_view statement,
+                                   std::size_t rows_count);
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
@@ -305,6 +305,8 @@ StatementFetcher::~StatementFetcher() {
 
 StatementFetcher::StatementFetcher(StatementFetcher&& other) noexcept
     : parent_statement_deadline_{other.parent_statement_deadline_},
+      preceding_rows_affected_{other.preceding_rows_affected_},
+      first_insert_id_{other.first_insert_id_},
       binds_applied_{other.binds_applied_},
       statement_{std::exchange(other.statement_, nullptr)} {}
 
@@ -376,13 +378,21 @@ std::uint64_t StatementFetcher::RowsAffected() const {
     return 0;
   }
 
-  return rows_affected;
+  return preceding_rows_affected_ + rows_affected;
 }
 
 std::uint64_t StatementFetcher::LastInsertId() const {
+  if (first_insert_id_.has_value()) return *first_insert_id_;
+
   return mysql_stmt_insert_id(statement_->native_statement_.get());
 }
 
+void StatementFetcher::SetPrecedingBatchResults(std::uint64_t rows_affected,
+                                                std::uint64_t first_insert_id) {
+  preceding_rows_affected_ = rows_affected;
+  first_insert_id_.emplace(first_insert_id);
+}
+
 }  // namespace storages::mysql::impl
 
 USERVER_NAMESPACE_END
@@ -41,9 +41,16 @@ class StatementFetcher final {
 
  private:
   friend class Statement;
+  friend class Connection;
   explicit StatementFetcher(Statement& statement);
 
+  // Accounts statements executed before this one as parts of a single batch
+  void SetPrecedingBatchResults(std::uint64_t rows_affected,
+                                std::uint64_t first_insert_id);
+
   engine::Deadline parent_statement_deadline_;
+  std::uint64_t preceding_rows_affected_{0};
+  std::optional<std::uint64_t> first_insert_id_;
   bool binds_applied_{false};
   bool binds_validated_{false};
   Statement* statement_;
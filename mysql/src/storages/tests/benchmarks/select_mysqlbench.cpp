@@ -31,6 +31,41 @@ void select(benchmark::State& state) {
 
 BENCHMARK(select)->Range(1, 256)->RangeMultiplier(2);
 
+void select_for_each_row(benchmark::State& state) {
+  engine::RunStandalone([&state] {
+    tests::ClusterWrapper cluster;
+    tests::TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+    struct InsertRow final {
+      std::int32_t id{};
+      std::string_view value;
+    };
+    std::vector<InsertRow> rows_to_insert;
+    rows_to_insert.reserve(state.range(0));
+    for (int i = 0; i < state.range(0); ++i) {
+      rows_to_insert.push_back({i, "some moderate size string"});
+    }
+    cluster->ExecuteBulk(
+        ClusterHostType::kPrimary,
+        table.FormatWithTableName("INSERT INTO {} VALUES(?, ?)"),
+        rows_to_insert);
+
+    struct Row final {
+      std::int32_t id{};
+      std::string_view value;
+    };
+
+    const auto query = table.FormatWithTableName("SELECT Id, Value FROM {}");
+    for (auto _ : state) {
+      std::size_t total_size = 0;
+      cluster->Execute(ClusterHostType::kPrimary, query)
+          .ForEachRow<Row>(
+              [&total_size](Row&& row) { total_size += row.value.size(); });
+      benchmark::DoNotOptimize(total_size);
+    }
+  });
+}
+BENCHMARK(select_for_each_row)->Range(1000, 100'000);
+
 void select_many_small_columns(benchmark::State& state) {
   engine::TaskProcessorPoolsConfig config{};
   config.defer_events = false;
@@ -47,6 +47,41 @@ UTEST(Cursor, Works) {
   EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cursor, ForEachRow) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  constexpr std::size_t rows_count = 20;
+  std::vector<Row> rows_to_insert;
+  rows_to_insert.reserve(rows_count);
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    rows_to_insert.push_back({static_cast<std::int32_t>(i),
+                              std::string(i * 10, 'a' + i % 26)});
+  }
+  cluster->ExecuteBulk(
+      ClusterHostType::kPrimary,
+      table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+      rows_to_insert);
+
+  struct RowView final {
+    std::int32_t id{};
+    std::string_view value;
+  };
+  std::vector<Row> db_rows;
+  db_rows.reserve(rows_count);
+
+  cluster
+      ->GetCursor<RowView>(
+          ClusterHostType::kPrimary, 7,
+          table.FormatWithTableName("SELECT Id, Value FROM {} ORDER BY Id"))
+      .ForEachRow(
+          [&db_rows](RowView&& row) {
+            db_rows.push_back({row.id, std::string{row.value}});
+          },
+          cluster.GetDeadline());
+  EXPECT_EQ(db_rows, rows_to_insert);
+}
+
 // https://bugs.mysql.com/bug.php?id=109380
 UTEST(Cursor, StatementReuseWorks) {
   ClusterWrapper cluster{};
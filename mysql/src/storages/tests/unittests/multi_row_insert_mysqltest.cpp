@@ -0,0 +1,67 @@
+#include <userver/utest/utest.hpp>
+#include "../utils_mysqltest.hpp"
+
+#include <storages/mysql/impl/multi_row_insert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::tests {
+
+TEST(MultiRowInsert, BuildStatement) {
+  EXPECT_EQ(impl::BuildMultiRowStatement("INSERT INTO t VALUES(?, ?)", 3),
+            "INSERT INTO t VALUES(?, ?), (?, ?), (?, ?)");
+  EXPECT_EQ(impl::BuildMultiRowStatement("INSERT INTO t VALUES(?)", 1),
+            "INSERT INTO t VALUES(?)");
+  EXPECT_EQ(impl::BuildMultiRowStatement(
+                "insert into `values`(a, b) value (?, CONCAT(?, ')')) "
+                "ON DUPLICATE KEY UPDATE a = VALUES(a)",
+                2),
+            "insert into `values`(a, b) value (?, CONCAT(?, ')')), "
+            "(?, CONCAT(?, ')')) ON DUPLICATE KEY UPDATE a = VALUES(a)");
+
+  UEXPECT_THROW(impl::BuildMultiRowStatement("UPDATE t SET a = ?", 2),
+                std::logic_error);
+  UEXPECT_THROW(impl::BuildMultiRowStatement("INSERT INTO t VALUES(?", 2),
+                std::logic_error);
+}
+
+TEST(MultiRowInsert, ChunkSize) {
+  EXPECT_EQ(impl::GetMultiRowChunkSize(1), 1000);
+  EXPECT_EQ(impl::GetMultiRowChunkSize(100), 655);
+  EXPECT_EQ(impl::GetMultiRowChunkSize(100'000), 1);
+}
+
+UTEST(MultiRowInsert, ManyChunks) {
+  ClusterWrapper cluster{};
+  TmpTable table{
+      "Id INT NOT NULL AUTO_INCREMENT, Value INT NOT NULL, PRIMARY KEY(Id)"};
+
+  struct Row final {
+    std::int32_t value{};
+  };
+  std::vector<Row> rows(2500);
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    rows[i].value = static_cast<std::int32_t>(i);
+  }
+
+  const auto res =
+      cluster
+          ->ExecuteBulk(
+              ClusterHostType::kPrimary,
+              table.FormatWithTableName("INSERT INTO {}(Value) VALUES(?)"),
+              rows)
+          .AsExecutionResult();
+  EXPECT_EQ(res.rows_affected, rows.size());
+
+  const auto db_values =
+      table.DefaultExecute("SELECT Value FROM {} ORDER BY Id")
+          .AsVector<std::int32_t>(kFieldTag);
+  ASSERT_EQ(db_values.size(), rows.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    EXPECT_EQ(db_values[i], rows[i].value);
+  }
+}
+
+}  // namespace storages::mysql::tests
+
+USERVER_NAMESPACE_END
@@ -318,6 +318,87 @@ UTEST(StatementResultSet, MapFrom) {
 
 }  // namespace map_from_sample
 
+namespace for_each_row_sample {
+
+/// [uMySQL usage sample - StatementResultSet ForEachRow]
+struct SampleRowView final {
+  std::int32_t id;
+  std::string_view value;
+};
+
+std::size_t PerformForEachRow(const Cluster& cluster) {
+  std::size_t total_size = 0;
+  cluster
+      .Execute(ClusterHostType::kPrimary, "SELECT id, value FROM SampleTable")
+      .ForEachRow<SampleRowView>([&total_size](SampleRowView&& row) {
+        // row.value is only valid in here
+        total_size += row.value.size();
+      });
+
+  return total_size;
+}
+/// [uMySQL usage sample - StatementResultSet ForEachRow]
+
+UTEST(StatementResultSet, ForEachRow) {
+  const ClusterWrapper cluster{};
+
+  PrepareSampleTable(*cluster);
+  const std::string long_value(1000, 'a');
+  cluster->ExecuteBulk(
+      ClusterHostType::kPrimary,
+      "INSERT INTO SampleTable(id, value) VALUES (?, ?)",
+      std::vector<SampleRowView>{
+          {1, "short"}, {2, long_value}, {3, ""}, {4, "a bit longer"}});
+
+  EXPECT_EQ(PerformForEachRow(*cluster), 5 + 1000 + 0 + 12);
+}
+
+UTEST(StatementResultSet, ForEachRowFieldTag) {
+  const ClusterWrapper cluster{};
+
+  PrepareSampleTable(*cluster);
+  const std::vector<std::string> values{"first", std::string(500, 'b'), "",
+                                        "second"};
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    cluster->Execute(ClusterHostType::kPrimary,
+                     "INSERT INTO SampleTable(id, value) VALUES (?, ?)",
+                     static_cast<std::int32_t>(i), values[i]);
+  }
+
+  std::vector<std::string> db_values;
+  cluster
+      ->Execute(ClusterHostType::kPrimary,
+                "SELECT value FROM SampleTable ORDER BY id")
+      .ForEachRow<std::string_view>(
+          [&db_values](std::string_view value) {
+            db_values.emplace_back(value);
+          },
+          kFieldTag);
+  EXPECT_EQ(db_values, values);
+}
+
+UTEST(StatementResultSet, ForEachRowOptionalView) {
+  const ClusterWrapper cluster{};
+  TmpTable table{"Id INT NOT NULL, Value TEXT"};
+  table.DefaultExecute("INSERT INTO {} VALUES(1, 'text'), (2, NULL)");
+
+  struct Row final {
+    std::int32_t id;
+    std::optional<std::string_view> value;
+  };
+  std::vector<std::optional<std::string>> db_values;
+  table.DefaultExecute("SELECT Id, Value FROM {} ORDER BY Id")
+      .ForEachRow<Row>([&db_values](Row&& row) {
+        db_values.push_back(row.value.has_value()
+                                ? std::optional<std::string>{*row.value}
+                                : std::nullopt);
+      });
+  EXPECT_EQ(db_values,
+            (std::vector<std::optional<std::string>>{"text", std::nullopt}));
+}
+
+}  // namespace for_each_row_sample
+
 }  // namespace storages::mysql::tests
 
 USERVER_NAMESPACE_END
@@ -29,6 +29,7 @@ class Logger;
 /// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
 /// max-queue-size | Maximum async queue size | 65535
 /// max-batch-delay | Maximum batch delay | 100ms
+/// max-batch-size | Maximum number of log records or spans in a single export request | 512
 /// service-name | Service name | unknown_service
 /// attributes | Extra attributes for OTLP, object of key/value strings | -
 
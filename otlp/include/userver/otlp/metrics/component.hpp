@@ -0,0 +1,62 @@
+#pragma once
+
+/// @file userver/otlp/metrics/component.hpp
+/// @brief @copybrief otlp::MetricsExporterComponent
+
+#include <memory>
+
+#include <userver/components/component_fwd.hpp>
+#include <userver/components/raw_component_base.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+class MetricsExporter;
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that periodically pushes the metrics of
+/// components::StatisticsStorage to the OTLP collector.
+///
+/// Integer and floating-point metrics are exported as gauges,
+/// utils::statistics::Rate metrics as cumulative monotonic sums,
+/// utils::statistics::Histogram as cumulative explicit-bucket histograms.
+/// A batch that failed to export is dropped and accounted in the
+/// `otlp.metrics-exporter.dropped` metric.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
+/// export-period | Period of the metrics export | 10s
+/// max-batch-size | Maximum number of data points in a single export request | 1000
+/// export-only-changed | Send only the metrics that changed since the previous export, see utils::statistics::ChangedMetricsFilter | false
+/// service-name | Service name | unknown_service
+/// extra-attributes | Extra attributes for OTLP, object of key/value strings | -
+
+// clang-format on
+class MetricsExporterComponent final : public components::RawComponentBase {
+ public:
+  static constexpr std::string_view kName = "otlp-metrics-exporter";
+
+  MetricsExporterComponent(const components::ComponentConfig&,
+                           const components::ComponentContext&);
+
+  ~MetricsExporterComponent() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::unique_ptr<MetricsExporter> exporter_;
+  utils::PeriodicTask export_task_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
@@ -41,6 +41,8 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config,
   logger_config.max_queue_size = config["max-queue-size"].As<size_t>(65535);
   logger_config.max_batch_delay =
       config["max-batch-delay"].As<std::chrono::milliseconds>(100);
+  logger_config.max_batch_size =
+      config["max-batch-size"].As<size_t>(logger_config.max_batch_size);
   logger_config.service_name =
       config["service-name"].As<std::string>("unknown_service");
   logger_config.log_level =
@@ -108,6 +110,10 @@ properties:
     max-batch-delay:
         type: string
         description: max delay between send batches (e.g. 100ms or 1s)
+    max-batch-size:
+        type: integer
+        description: max number of log records or spans in a single export request
+        minimum: 1
     service-name:
         type: string
         description: service name
@@ -13,15 +13,13 @@
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/text_light.hpp>
 
+#include <otlp/resource.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace otlp {
 
 namespace {
-constexpr std::string_view kTelemetrySdkLanguage = "telemetry.sdk.language";
-constexpr std::string_view kTelemetrySdkName = "telemetry.sdk.name";
-constexpr std::string_view kServiceName = "service.name";
-
 const std::string kTimestampFormat = "%Y-%m-%dT%H:%M:%E*S";
 }  // namespace
 
@@ -179,66 +177,45 @@ void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client,
       log_request;
   auto resource_logs = log_request.add_resource_logs();
   auto scope_logs = resource_logs->add_scope_logs();
-  FillAttributes(*resource_logs->mutable_resource());
+  FillResourceAttributes(*resource_logs->mutable_resource(),
+                         config_.service_name, config_.extra_attributes);
 
   ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest
       trace_request;
   auto resource_spans = trace_request.add_resource_spans();
   auto scope_spans = resource_spans->add_scope_spans();
-  FillAttributes(*resource_spans->mutable_resource());
+  FillResourceAttributes(*resource_spans->mutable_resource(),
+                         config_.service_name, config_.extra_attributes);
 
   Action action{};
   while (consumer.Pop(action)) {
+    // Cleared elements are kept by the repeated fields and reused by add_*
     scope_logs->clear_log_records();
     scope_spans->clear_spans();
 
     auto deadline = engine::Deadline::FromDuration(config_.max_batch_delay);
+    std::size_t batch_size = 0;
 
     do {
       std::visit(
           utils::Overloaded{
-              [&scope_spans](
-                  const opentelemetry::proto::trace::v1::Span& action) {
-                auto span = scope_spans->add_spans();
-                *span = action;
+              [&scope_spans](opentelemetry::proto::trace::v1::Span&& action) {
+                *scope_spans->add_spans() = std::move(action);
               },
               [&scope_logs](
-                  const opentelemetry::proto::logs::v1::LogRecord& action) {
-                auto log_records = scope_logs->add_log_records();
-                *log_records = action;
+                  opentelemetry::proto::logs::v1::LogRecord&& action) {
+                *scope_logs->add_log_records() = std::move(action);
               }},
-          action);
-    } while (consumer.Pop(action, deadline));
-
-    DoLog(log_request, log_client);
-    DoTrace(trace_request, trace_client);
-  }
-}
-
-void Logger::FillAttributes(
-    ::opentelemetry::proto::resource::v1::Resource& resource) {
-  {
-    auto* attr = resource.add_attributes();
-    attr->set_key(std::string{kTelemetrySdkLanguage});
-    attr->mutable_value()->set_string_value("cpp");
-  }
-
-  {
-    auto* attr = resource.add_attributes();
-    attr->set_key(std::string{kTelemetrySdkName});
-    attr->mutable_value()->set_string_value("userver");
-  }
-
-  {
-    auto* attr = resource.add_attributes();
-    attr->set_key(std::string{kServiceName});
-    attr->mutable_value()->set_string_value(std::string{config_.service_name});
-  }
-
-  for (const auto& [key, value] : config_.extra_attributes) {
-    auto* attr = resource.add_attributes();
-    attr->set_key(std::string{key});
-    attr->mutable_value()->set_string_value(std::string{value});
+          std::move(action));
+    } while (++batch_size < config_.max_batch_size &&
+             consumer.Pop(action, deadline));
+
+    if (!scope_logs->log_records().empty()) {
+      DoLog(log_request, log_client);
+    }
+    if (!scope_spans->spans().empty()) {
+      DoTrace(trace_request, trace_client);
+    }
   }
 }
 
@@ -255,8 +232,9 @@ void Logger::DoLog(
   } catch (const std::exception& e) {
     std::cerr << "Failed to write down OTLP log(s): " << e.what()
               << typeid(e).name() << "\n";
+    stats_.dropped += utils::statistics::Rate{static_cast<std::uint64_t>(
+        request.resource_logs(0).scope_logs(0).log_records_size())};
   }
-  // TODO: count exceptions
 }
 
 void Logger::DoTrace(
@@ -272,8 +250,9 @@ void Logger::DoTrace(
   } catch (const std::exception& e) {
     std::cerr << "Failed to write down OTLP trace(s): " << e.what()
               << typeid(e).name() << "\n";
+    stats_.dropped += utils::statistics::Rate{static_cast<std::uint64_t>(
+        request.resource_spans(0).scope_spans(0).spans_size())};
   }
-  // TODO: count exceptions
 }
 
 std::string_view Logger::MapAttribute(std::string_view attr) const {
@@ -18,6 +18,8 @@ namespace otlp {
 struct LoggerConfig {
   size_t max_queue_size{10000};
   std::chrono::milliseconds max_batch_delay{};
+  // Max number of log records and spans in a single export
+  size_t max_batch_size{512};
 
   std::string service_name;
   std::unordered_map<std::string, std::string> extra_attributes;
@@ -58,8 +60,6 @@ class Logger final : public logging::impl::LoggerBase {
   void SendingLoop(Queue::Consumer& consumer, LogClient& log_client,
                    TraceClient& trace_client);
 
-  void FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource);
-
   void DoLog(
       const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest&
           request,
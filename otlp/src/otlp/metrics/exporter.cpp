@@ -0,0 +1,185 @@
+#include "exporter.hpp"
+
+#include <userver/logging/log.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/overloaded.hpp>
+
+#include <otlp/resource.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+
+namespace proto_metrics = opentelemetry::proto::metrics::v1;
+
+std::uint64_t ToUnixNano(std::chrono::system_clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+template <typename DataPoint>
+void FillDataPoint(DataPoint& data_point, utils::statistics::LabelsSpan labels,
+                   std::uint64_t start_time_unix_nano,
+                   std::uint64_t time_unix_nano) {
+  for (const auto& label : labels) {
+    auto* attr = data_point.add_attributes();
+    attr->set_key(std::string{label.Name()});
+    attr->mutable_value()->set_string_value(std::string{label.Value()});
+  }
+  data_point.set_start_time_unix_nano(start_time_unix_nano);
+  data_point.set_time_unix_nano(time_unix_nano);
+}
+
+constexpr std::size_t kArenaInitialBlockSize = 256 * 1024;
+
+google::protobuf::ArenaOptions MakeArenaOptions(std::vector<char>& block) {
+  google::protobuf::ArenaOptions options;
+  options.initial_block = block.data();
+  options.initial_block_size = block.size();
+  return options;
+}
+
+std::size_t GetDataPointsCount(
+    const MetricsRequestBuilder::Request& request) noexcept {
+  // Each metric holds a single data point
+  return request.resource_metrics(0).scope_metrics(0).metrics_size();
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const MetricsExporterStatistics& stats) {
+  writer["exported"] = stats.exported;
+  writer["dropped"] = stats.dropped;
+}
+
+MetricsRequestBuilder::MetricsRequestBuilder(
+    google::protobuf::Arena& arena, const MetricsExporterConfig& config,
+    std::chrono::system_clock::time_point start_time,
+    std::chrono::system_clock::time_point now)
+    : arena_(arena),
+      config_(config),
+      start_time_unix_nano_(ToUnixNano(start_time)),
+      time_unix_nano_(ToUnixNano(now)) {}
+
+void MetricsRequestBuilder::HandleMetric(
+    std::string_view path, utils::statistics::LabelsSpan labels,
+    const utils::statistics::MetricValue& value) {
+  auto& metric = AddMetric(path);
+  value.Visit(utils::Overloaded{
+      [&](std::int64_t x) {
+        auto* data_point = metric.mutable_gauge()->add_data_points();
+        FillDataPoint(*data_point, labels, start_time_unix_nano_,
+                      time_unix_nano_);
+        data_point->set_as_int(x);
+      },
+      [&](double x) {
+        auto* data_point = metric.mutable_gauge()->add_data_points();
+        FillDataPoint(*data_point, labels, start_time_unix_nano_,
+                      time_unix_nano_);
+        data_point->set_as_double(x);
+      },
+      [&](utils::statistics::Rate x) {
+        auto* sum = metric.mutable_sum();
+        sum->set_is_monotonic(true);
+        sum->set_aggregation_temporality(
+            proto_metrics::AGGREGATION_TEMPORALITY_CUMULATIVE);
+        auto* data_point = sum->add_data_points();
+        FillDataPoint(*data_point, labels, start_time_unix_nano_,
+                      time_unix_nano_);
+        data_point->set_as_int(static_cast<std::int64_t>(x.value));
+      },
+      [&](utils::statistics::HistogramView x) {
+        auto* histogram = metric.mutable_histogram();
+        histogram->set_aggregation_temporality(
+            proto_metrics::AGGREGATION_TEMPORALITY_CUMULATIVE);
+        auto* data_point = histogram->add_data_points();
+        FillDataPoint(*data_point, labels, start_time_unix_nano_,
+                      time_unix_nano_);
+
+        const auto bucket_count = x.GetBucketCount();
+        data_point->mutable_explicit_bounds()->Reserve(bucket_count);
+        data_point->mutable_bucket_counts()->Reserve(bucket_count + 1);
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+          data_point->add_explicit_bounds(x.GetUpperBoundAt(i));
+          data_point->add_bucket_counts(x.GetValueAt(i));
+        }
+        data_point->add_bucket_counts(x.GetValueAtInf());
+        data_point->set_count(x.GetTotalCount());
+      },
+  });
+}
+
+const std::vector<MetricsRequestBuilder::Request*>&
+MetricsRequestBuilder::GetRequests() const noexcept {
+  return requests_;
+}
+
+proto_metrics::Metric& MetricsRequestBuilder::AddMetric(std::string_view path) {
+  if (!scope_metrics_ || batch_size_ == config_.max_batch_size) {
+    auto* request = google::protobuf::Arena::CreateMessage<Request>(&arena_);
+    auto* resource_metrics = request->add_resource_metrics();
+    FillResourceAttributes(*resource_metrics->mutable_resource(),
+                           config_.service_name, config_.extra_attributes);
+    scope_metrics_ = resource_metrics->add_scope_metrics();
+    requests_.push_back(request);
+    batch_size_ = 0;
+  }
+
+  ++batch_size_;
+  auto* metric = scope_metrics_->add_metrics();
+  metric->set_name(std::string{path});
+  return *metric;
+}
+
+MetricsExporter::MetricsExporter(Client client, MetricsExporterConfig&& config)
+    : client_(std::move(client)),
+      config_(std::move(config)),
+      start_time_(std::chrono::system_clock::now()),
+      arena_block_(kArenaInitialBlockSize),
+      arena_(MakeArenaOptions(arena_block_)) {}
+
+void MetricsExporter::Export(const utils::statistics::Storage& storage) {
+  // Frees all the requests at once, the initial block is reused by the next
+  // export
+  const utils::FastScopeGuard reset_arena(
+      [this]() noexcept { arena_.Reset(); });
+
+  MetricsRequestBuilder builder{arena_, config_, start_time_,
+                                std::chrono::system_clock::now()};
+  if (config_.export_only_changed) {
+    changed_metrics_filter_.VisitChangedMetrics(storage, builder);
+  } else {
+    storage.VisitMetrics(builder);
+  }
+
+  for (const auto* request : builder.GetRequests()) {
+    const auto data_points = utils::statistics::Rate{
+        static_cast<std::uint64_t>(GetDataPointsCount(*request))};
+    try {
+      auto call = client_.Export(*request);
+      auto response = call.Finish();
+      stats_.exported += data_points;
+    } catch (const ugrpc::client::RpcCancelledError&) {
+      throw;
+    } catch (const std::exception& e) {
+      LOG_LIMITED_WARNING() << "Failed to export OTLP metrics: " << e;
+      stats_.dropped += data_points;
+      // The dropped metrics are sent by the next export even if unchanged
+      changed_metrics_filter_.Reset();
+    }
+  }
+}
+
+const MetricsExporterStatistics& MetricsExporter::GetStatistics()
+    const noexcept {
+  return stats_;
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
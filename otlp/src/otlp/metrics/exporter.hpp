@@ -0,0 +1,106 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+
+#include <opentelemetry/proto/collector/metrics/v1/metrics_service_client.usrv.pb.hpp>
+
+#include <userver/utils/statistics/changed_metrics_filter.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+struct MetricsExporterConfig {
+  // Max number of data points in a single export
+  std::size_t max_batch_size{1000};
+  // Send only the metrics that changed since the previous export
+  bool export_only_changed{false};
+
+  std::string service_name;
+  std::unordered_map<std::string, std::string> extra_attributes;
+};
+
+struct MetricsExporterStatistics final {
+  // Data points
+  utils::statistics::RateCounter exported;
+  utils::statistics::RateCounter dropped;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const MetricsExporterStatistics& stats);
+
+/// Converts utils::statistics metrics into export requests, each holding at
+/// most `max_batch_size` data points. The requests are allocated on the arena.
+///
+/// Mapping: integer and floating-point metrics are gauges, utils::statistics
+/// Rate metrics are cumulative monotonic sums, histograms are cumulative
+/// explicit-bucket histograms.
+class MetricsRequestBuilder final
+    : public utils::statistics::BaseFormatBuilder {
+ public:
+  using Request = opentelemetry::proto::collector::metrics::v1::
+      ExportMetricsServiceRequest;
+
+  MetricsRequestBuilder(google::protobuf::Arena& arena,
+                        const MetricsExporterConfig& config,
+                        std::chrono::system_clock::time_point start_time,
+                        std::chrono::system_clock::time_point now);
+
+  void HandleMetric(std::string_view path,
+                    utils::statistics::LabelsSpan labels,
+                    const utils::statistics::MetricValue& value) override;
+
+  const std::vector<Request*>& GetRequests() const noexcept;
+
+ private:
+  opentelemetry::proto::metrics::v1::Metric& AddMetric(std::string_view path);
+
+  google::protobuf::Arena& arena_;
+  const MetricsExporterConfig& config_;
+  const std::uint64_t start_time_unix_nano_;
+  const std::uint64_t time_unix_nano_;
+
+  std::vector<Request*> requests_;
+  opentelemetry::proto::metrics::v1::ScopeMetrics* scope_metrics_{nullptr};
+  std::size_t batch_size_{0};
+};
+
+/// Pushes the metrics of utils::statistics::Storage to the OTLP collector.
+/// Not thread-safe.
+class MetricsExporter final {
+ public:
+  using Client = opentelemetry::proto::collector::metrics::v1::
+      MetricsServiceClient;
+
+  MetricsExporter(Client client, MetricsExporterConfig&& config);
+
+  /// Sends all the metrics of the storage, or only the changed ones if
+  /// `export_only_changed` is set. A failed batch is dropped, and the next
+  /// export sends all the metrics again.
+  void Export(const utils::statistics::Storage& storage);
+
+  const MetricsExporterStatistics& GetStatistics() const noexcept;
+
+ private:
+  MetricsExporterStatistics stats_;
+  Client client_;
+  const MetricsExporterConfig config_;
+  const std::chrono::system_clock::time_point start_time_;
+  utils::statistics::ChangedMetricsFilter changed_metrics_filter_;
+  // The requests are allocated on the arena, that is reset after each export
+  std::vector<char> arena_block_;
+  google::protobuf::Arena arena_;
+};
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
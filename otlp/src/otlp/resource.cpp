@@ -0,0 +1,46 @@
+#include "resource.hpp"
+
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+constexpr std::string_view kTelemetrySdkLanguage = "telemetry.sdk.language";
+constexpr std::string_view kTelemetrySdkName = "telemetry.sdk.name";
+constexpr std::string_view kServiceName = "service.name";
+}  // namespace
+
+void FillResourceAttributes(
+    ::opentelemetry::proto::resource::v1::Resource& resource,
+    const std::string& service_name,
+    const std::unordered_map<std::string, std::string>& extra_attributes) {
+  {
+    auto* attr = resource.add_attributes();
+    attr->set_key(std::string{kTelemetrySdkLanguage});
+    attr->mutable_value()->set_string_value("cpp");
+  }
+
+  {
+    auto* attr = resource.add_attributes();
+    attr->set_key(std::string{kTelemetrySdkName});
+    attr->mutable_value()->set_string_value("userver");
+  }
+
+  {
+    auto* attr = resource.add_attributes();
+    attr->set_key(std::string{kServiceName});
+    attr->mutable_value()->set_string_value(service_name);
+  }
+
+  for (const auto& [key, value] : extra_attributes) {
+    auto* attr = resource.add_attributes();
+    attr->set_key(std::string{key});
+    attr->mutable_value()->set_string_value(std::string{value});
+  }
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
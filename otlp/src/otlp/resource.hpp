@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include <opentelemetry/proto/resource/v1/resource.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+/// Fills the attributes of the resource, that are common for the logs, the
+/// traces and the metrics of the service
+void FillResourceAttributes(
+    ::opentelemetry::proto::resource::v1::Resource& resource,
+    const std::string& service_name,
+    const std::unordered_map<std::string, std::string>& extra_attributes);
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#include <userver/utest/utest.hpp>
+
+#include <google/protobuf/arena.h>
+
+#include <otlp/metrics/exporter.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace proto_metrics = opentelemetry::proto::metrics::v1;
+
+const proto_metrics::Metric* FindMetric(
+    const std::vector<otlp::MetricsRequestBuilder::Request*>& requests,
+    std::string_view name) {
+  for (const auto* request : requests) {
+    for (const auto& metric :
+         request->resource_metrics(0).scope_metrics(0).metrics()) {
+      if (metric.name() == name) return &metric;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+UTEST(OtlpMetricsRequestBuilder, Basic) {
+  utils::statistics::Storage storage;
+  const double bounds[] = {1, 10};
+  utils::statistics::Histogram histogram{bounds};
+  histogram.Account(5);
+  histogram.Account(50);
+
+  const auto entry = storage.RegisterWriter(
+      "test", [&histogram](utils::statistics::Writer& writer) {
+        writer["int"].ValueWithLabels(42, {{"label", "value"}});
+        writer["double"] = 1.5;
+        writer["rate"] = utils::statistics::Rate{7};
+        writer["histogram"] = histogram;
+      });
+
+  otlp::MetricsExporterConfig config;
+  config.max_batch_size = 3;
+  config.service_name = "test-service";
+
+  google::protobuf::Arena arena;
+  const auto start = std::chrono::system_clock::now();
+  otlp::MetricsRequestBuilder builder{arena, config, start, start};
+  storage.VisitMetrics(builder);
+
+  // 4 data points with at most 3 per request
+  ASSERT_EQ(builder.GetRequests().size(), 2);
+
+  const auto* int_metric = FindMetric(builder.GetRequests(), "test.int");
+  ASSERT_TRUE(int_metric);
+  ASSERT_EQ(int_metric->gauge().data_points_size(), 1);
+  const auto& int_point = int_metric->gauge().data_points(0);
+  EXPECT_EQ(int_point.as_int(), 42);
+  ASSERT_EQ(int_point.attributes_size(), 1);
+  EXPECT_EQ(int_point.attributes(0).key(), "label");
+  EXPECT_EQ(int_point.attributes(0).value().string_value(), "value");
+
+  const auto* double_metric = FindMetric(builder.GetRequests(), "test.double");
+  ASSERT_TRUE(double_metric);
+  EXPECT_EQ(double_metric->gauge().data_points(0).as_double(), 1.5);
+
+  const auto* rate_metric = FindMetric(builder.GetRequests(), "test.rate");
+  ASSERT_TRUE(rate_metric);
+  EXPECT_TRUE(rate_metric->sum().is_monotonic());
+  EXPECT_EQ(rate_metric->sum().aggregation_temporality(),
+            proto_metrics::AGGREGATION_TEMPORALITY_CUMULATIVE);
+  EXPECT_EQ(rate_metric->sum().data_points(0).as_int(), 7);
+
+  const auto* histogram_metric =
+      FindMetric(builder.GetRequests(), "test.histogram");
+  ASSERT_TRUE(histogram_metric);
+  const auto& histogram_point = histogram_metric->histogram().data_points(0);
+  EXPECT_EQ(histogram_point.count(), 2);
+  ASSERT_EQ(histogram_point.explicit_bounds_size(), 2);
+  EXPECT_EQ(histogram_point.explicit_bounds(1), 10);
+  ASSERT_EQ(histogram_point.bucket_counts_size(), 3);
+  EXPECT_EQ(histogram_point.bucket_counts(0), 0);
+  EXPECT_EQ(histogram_point.bucket_counts(1), 1);
+  EXPECT_EQ(histogram_point.bucket_counts(2), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -6,10 +6,12 @@
 #include <userver/cache/base_postgres_cache_fwd.hpp>
 
 #include <chrono>
+#include <deque>
 #include <map>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -17,6 +19,8 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/component.hpp>
@@ -66,6 +70,8 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// full-update-chunk-size | `chunk-size` for full updates, each chunk is parsed and merged into the new cache data before the next one is fetched, so the memory overhead of the update is bounded by the chunk size rather than the table size | value of `chunk-size`
+/// parse-tasks-count | number of fetched chunks that are parsed by separate tasks in parallel with fetching the next chunks, 0 to parse the chunks one by one in the updating task | 0
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -97,6 +103,27 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Container With Write Notification Example
 ///
+/// @section pg_cc_logical_replication Updates from the logical replication
+///
+/// Incremental updates poll the table by `kUpdatedField`, so the cache lags
+/// behind the table by the update interval and every poll costs a query even
+/// if nothing has changed. A cache that must follow the table closely may
+/// instead receive the changes pushed by the server via
+/// storages::postgres::LogicalReplicationStream:
+///
+/// 1. create a publication for the table and a logical replication slot with
+///    the `pgoutput` plugin, the slot keeps the changes until they are
+///    confirmed;
+/// 2. load the full snapshot, e.g. by a full update of the cache;
+/// 3. run the stream in a background task and apply each change to the cache
+///    data in storages::postgres::LogicalReplicationHandler.
+///
+/// The changes made during the snapshot load are received again, and after a
+/// reconnect the server resends the transactions that were not confirmed
+/// yet, so the handler should apply the changes idempotently, e.g. insert or
+/// replace by the primary key. Full updates may be kept with a long interval
+/// to recover from the changes missed while the slot was dropped.
+///
 /// @section pg_cc_forward_declaration Forward Declaration
 ///
 /// To forward declare a cache you can forward declare a trait and
@@ -415,11 +442,26 @@ class PostgreCache final
 
   bool MayReturnNull() const override;
 
+  struct ParsedChunk {
+    std::vector<ValueType> values;
+    std::size_t parse_failures{0};
+  };
+
   CachedData GetDataSnapshot(cache::UpdateType type, tracing::ScopeTime& scope);
   void CacheResults(storages::postgres::ResultSet res, CachedData& data_cache,
                     cache::UpdateStatisticsScope& stats_scope,
                     tracing::ScopeTime& scope);
 
+  std::size_t FetchAndParsePipelined(storages::postgres::Portal& portal,
+                                     std::size_t chunk_size,
+                                     CachedData& data_cache,
+                                     cache::UpdateStatisticsScope& stats_scope,
+                                     tracing::ScopeTime& scope);
+  ParsedChunk ParseChunk(storages::postgres::ResultSet res) const;
+  void MergeChunk(ParsedChunk&& chunk, CachedData& data_cache,
+                  cache::UpdateStatisticsScope& stats_scope,
+                  tracing::ScopeTime& scope);
+
   static storages::postgres::Query GetAllQuery();
   static storages::postgres::Query GetDeltaQuery();
 
@@ -431,6 +473,8 @@ class PostgreCache final
   const std::chrono::milliseconds full_update_timeout_;
   const std::chrono::milliseconds incremental_update_timeout_;
   const std::size_t chunk_size_;
+  const std::size_t full_update_chunk_size_;
+  const std::size_t parse_tasks_count_;
   std::size_t cpu_relax_iterations_parse_{0};
   std::size_t cpu_relax_iterations_copy_{0};
 };
@@ -450,10 +494,14 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
           config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
               pg_cache::detail::kDefaultIncrementalUpdateTimeout)},
       chunk_size_{config["chunk-size"].As<size_t>(
-          pg_cache::detail::kDefaultChunkSize)} {
+          pg_cache::detail::kDefaultChunkSize)},
+      full_update_chunk_size_{
+          config["full-update-chunk-size"].As<size_t>(chunk_size_)},
+      parse_tasks_count_{config["parse-tasks-count"].As<size_t>(0)} {
   UINVARIANT(
-      !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
-      "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
+      (!chunk_size_ && !full_update_chunk_size_) ||
+          storages::postgres::Portal::IsSupportedByDriver(),
+      "Either set 'chunk-size' and 'full-update-chunk-size' to 0, or enable PostgreSQL portals by building "
       "the framework with CMake option USERVER_FEATURE_PATCH_LIBPQ set to ON.");
 
   if (this->GetAllowedUpdateTypes() ==
@@ -575,23 +623,31 @@ void PostgreCache<PostgreCachePolicy>::Update(
 
   scope.Reset(std::string{pg_cache::detail::kFetchStage});
 
+  const auto chunk_size = (type == cache::UpdateType::kFull)
+                              ? full_update_chunk_size_
+                              : chunk_size_;
   size_t changes = 0;
   // Iterate clusters
   for (auto& cluster : clusters_) {
-    if (chunk_size_ > 0) {
+    if (chunk_size > 0) {
       auto trx = cluster->Begin(
           kClusterHostTypeFlags, pg::Transaction::RO,
           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff});
       auto portal =
           trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
-      while (portal) {
-        scope.Reset(std::string{pg_cache::detail::kFetchStage});
-        auto res = portal.Fetch(chunk_size_);
-        stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-        scope.Reset(std::string{pg_cache::detail::kParseStage});
-        CacheResults(res, data_cache, stats_scope, scope);
-        changes += res.Size();
+      if (parse_tasks_count_ > 0) {
+        changes += FetchAndParsePipelined(portal, chunk_size, data_cache,
+                                          stats_scope, scope);
+      } else {
+        while (portal) {
+          scope.Reset(std::string{pg_cache::detail::kFetchStage});
+          auto res = portal.Fetch(chunk_size);
+          stats_scope.IncreaseDocumentsReadCount(res.Size());
+
+          scope.Reset(std::string{pg_cache::detail::kParseStage});
+          CacheResults(res, data_cache, stats_scope, scope);
+          changes += res.Size();
+        }
       }
       trx.Commit();
     } else {
@@ -682,6 +738,86 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
   }
 }
 
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::FetchAndParsePipelined(
+    storages::postgres::Portal& portal, std::size_t chunk_size,
+    CachedData& data_cache, cache::UpdateStatisticsScope& stats_scope,
+    tracing::ScopeTime& scope) {
+  std::size_t changes = 0;
+  // The chunks are parsed in parallel, but are merged in the fetch order, so
+  // that the later rows overwrite the earlier ones as usual
+  std::deque<engine::TaskWithResult<ParsedChunk>> parse_tasks;
+
+  const auto merge_first_chunk = [&] {
+    scope.Reset(std::string{pg_cache::detail::kParseStage});
+    auto chunk = parse_tasks.front().Get();
+    parse_tasks.pop_front();
+    MergeChunk(std::move(chunk), data_cache, stats_scope, scope);
+  };
+
+  while (portal) {
+    scope.Reset(std::string{pg_cache::detail::kFetchStage});
+    auto res = portal.Fetch(chunk_size);
+    stats_scope.IncreaseDocumentsReadCount(res.Size());
+    changes += res.Size();
+
+    parse_tasks.push_back(engine::AsyncNoSpan(
+        [this, res = std::move(res)]() mutable {
+          return ParseChunk(std::move(res));
+        }));
+    if (parse_tasks.size() > parse_tasks_count_) merge_first_chunk();
+  }
+
+  while (!parse_tasks.empty()) merge_first_chunk();
+  return changes;
+}
+
+template <typename PostgreCachePolicy>
+typename PostgreCache<PostgreCachePolicy>::ParsedChunk
+PostgreCache<PostgreCachePolicy>::ParseChunk(
+    storages::postgres::ResultSet res) const {
+  ParsedChunk chunk;
+  chunk.values.reserve(res.Size());
+
+  auto values = res.AsSetOf<RawValueType>(storages::postgres::kRowTag);
+  utils::CpuRelax relax{cpu_relax_iterations_parse_, nullptr};
+  for (auto p = values.begin(); p != values.end(); ++p) {
+    relax.Relax();
+    try {
+      chunk.values.push_back(
+          pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p));
+    } catch (const std::exception& e) {
+      ++chunk.parse_failures;
+      LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
+                  << compiler::GetTypeName<ValueType>() << "': " << e.what();
+    }
+  }
+  return chunk;
+}
+
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::MergeChunk(
+    ParsedChunk&& chunk, CachedData& data_cache,
+    cache::UpdateStatisticsScope& stats_scope, tracing::ScopeTime& scope) {
+  if (chunk.parse_failures > 0) {
+    stats_scope.IncreaseDocumentsParseFailures(chunk.parse_failures);
+  }
+
+  utils::CpuRelax relax{cpu_relax_iterations_parse_, &scope};
+  for (auto& value : chunk.values) {
+    relax.Relax();
+    try {
+      using pg_cache::detail::CacheInsertOrAssign;
+      CacheInsertOrAssign(*data_cache, std::move(value),
+                          PostgreCachePolicy::kKeyMember);
+    } catch (const std::exception& e) {
+      stats_scope.IncreaseDocumentsParseFailures(1);
+      LOG_ERROR() << "Error inserting data row in cache '" << kName
+                  << "': " << e.what();
+    }
+  }
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::CachedData
 PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type,
@@ -693,7 +829,17 @@ PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type,
                                              scope);
     }
   }
-  return std::make_unique<DataType>();
+  auto data = std::make_unique<DataType>();
+  if constexpr (meta::kIsReservable<DataType>) {
+    // The new data is usually about as large as the current one, reserving
+    // avoids keeping the old and the new buckets during rehashes
+    if (type == cache::UpdateType::kFull) {
+      if (const auto current = this->GetUnsafe()) {
+        data->reserve(current->size());
+      }
+    }
+  }
+  return data;
 }
 
 namespace impl {
@@ -16,6 +16,8 @@
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/database.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/logical_replication.hpp>
+#include <userver/storages/postgres/notification_hub.hpp>
 #include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query.hpp>
@@ -196,6 +198,10 @@ class Cluster {
 
   /// @brief Execute a statement with stored arguments and specified host
   /// selection rules.
+  ///
+  /// If storages::postgres::MultiplexingSettings are enabled and the host
+  /// selection rules do not include ClusterHostType::kMaster, the statement is
+  /// pipelined with statements of other coroutines over a shared connection.
   ResultSet Execute(ClusterHostTypeFlags flags, const Query& query,
                     const ParameterStore& store);
 
@@ -208,9 +214,21 @@ class Cluster {
 
   /// @brief Listen for notifications on channel
   /// @warning Each NotifyScope owns a single connection taken from the pool,
-  /// which effectively decreases the number of usable connections
+  /// which effectively decreases the number of usable connections. Consider
+  /// GetNotificationHub() for listening to many channels.
   NotifyScope Listen(std::string_view channel, OptionalCommandControl = {});
 
+  /// @brief Returns the hub that delivers notifications of many channels over
+  /// a single connection
+  /// @see storages::postgres::NotificationHub
+  NotificationHub& GetNotificationHub();
+
+  /// @brief Creates a stream of the table changes of the master host
+  /// @warning The stream must not outlive the cluster
+  /// @see storages::postgres::LogicalReplicationStream
+  LogicalReplicationStream MakeLogicalReplicationStream(
+      LogicalReplicationSettings settings);
+
   /// Replaces globally updated command control with a static user-provided one
   void SetDefaultCommandControl(CommandControl);
 
@@ -44,6 +44,11 @@ enum class ClusterHostType {
 
   /// Chooses a host with the lowest RTT
   kNearest = 0x10,
+
+  /// Chooses a host with the lowest expected latency, estimated from the
+  /// observed statement execution times and the number of requests in flight,
+  /// see storages::postgres::HostBalancingSettings
+  kLeastLoaded = 0x20,
   /// @}
 };
 
@@ -54,7 +59,8 @@ constexpr ClusterHostTypeFlags kClusterHostRolesMask{
     ClusterHostType::kSlave};
 
 constexpr ClusterHostTypeFlags kClusterHostStrategyMask{
-    ClusterHostType::kRoundRobin, ClusterHostType::kNearest};
+    ClusterHostType::kRoundRobin, ClusterHostType::kNearest,
+    ClusterHostType::kLeastLoaded};
 
 std::string ToString(ClusterHostType);
 std::string ToString(ClusterHostTypeFlags);
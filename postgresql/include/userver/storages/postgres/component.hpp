@@ -128,6 +128,7 @@ namespace components {
 /// ignore_unused_query_params| disable check for not-NULL query params that are not used in query          | false
 /// monitoring-dbalias      | name of the database for monitorings                                          | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                                          | 200
+/// prepared-statements-warmup | number of the most used statements of the pool to prepare on new connections | 0
 /// max_statement_metrics   | limit of exported metrics for named statements                                | 0
 /// min_pool_size           | number of connections created initially                                       | 4
 /// max_pool_size           | maximum number of created connections for "connlimit_mode: manual"            | 15
@@ -135,6 +136,12 @@ namespace components {
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings                | --
+/// multiplexing.enabled    | pipeline read-only Cluster::Execute statements with a storages::postgres::ParameterStore from concurrent coroutines over a few shared connections, see storages::postgres::MultiplexingSettings | false
+/// multiplexing.connections | maximum number of connections of each host used for multiplexing             | 4
+/// multiplexing.max-batch-size | maximum number of statements in a single pipeline                         | 64
+/// host-balancing.default-strategy | `round-robin` or `least-loaded` host selection for the requests that do not specify a storages::postgres::ClusterHostType strategy, see storages::postgres::HostBalancingSettings | round-robin
+/// host-balancing.cross-dc-penalty | added to the expected latency of the hosts in other datacenters by the `least-loaded` strategy | 0ms
+/// host-balancing.cross-dc-rtt-threshold | a host is considered to be in another datacenter if its roundtrip time exceeds the one of the nearest host by more than this value | 2ms
 
 // clang-format on
 
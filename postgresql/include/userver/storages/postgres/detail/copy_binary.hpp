@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/traits.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Appends the next chunk of COPY data to the buffer, leaves the buffer empty
+/// after the last chunk
+using CopyInFiller = std::function<void(std::vector<char>& buffer)>;
+
+/// Receives a single COPY data message, that is a row or the trailer
+using CopyOutConsumer = std::function<void(std::string_view data)>;
+
+/// @brief PostgreSQL binary COPY format
+/// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+namespace copy {
+
+/// Rows are buffered until the chunk size is reached and then sent at once
+inline constexpr std::size_t kChunkSize = 64 * 1024;
+
+/// Field count of the end-of-data trailer
+inline constexpr Smallint kTrailer = -1;
+
+void WriteHeader(std::vector<char>& buffer);
+void WriteTrailer(std::vector<char>& buffer);
+
+/// Returns the data that follows the header, throws InvalidBinaryBuffer if
+/// the header is invalid
+std::string_view SkipHeader(std::string_view data);
+
+template <typename Row>
+void WriteRow(const UserTypes& types, std::vector<char>& buffer,
+              const Row& row) {
+  if constexpr (io::traits::kIsRowType<Row>) {
+    using RowType = io::RowType<Row>;
+    io::WriteBuffer(types, buffer, static_cast<Smallint>(RowType::size));
+    std::apply(
+        [&types, &buffer](const auto&... fields) {
+          (io::WriteRawBinary(types, buffer, fields), ...);
+        },
+        RowType::GetTuple(row));
+  } else {
+    io::WriteBuffer(types, buffer, Smallint{1});
+    io::WriteRawBinary(types, buffer, row);
+  }
+}
+
+template <typename T>
+void ReadField(io::FieldBuffer& buffer, T& value,
+               const io::TypeBufferCategory& categories) {
+  // There are no type oids in COPY data, so the parser category is trusted
+  using Parser = typename io::traits::IO<T>::ParserType;
+  buffer.ReadRaw(value, categories, io::traits::kParserBufferCategory<Parser>);
+}
+
+/// Returns false if the data is the end-of-data trailer
+template <typename Row>
+bool ReadRow(std::string_view data, Row& row,
+             const io::TypeBufferCategory& categories) {
+  io::FieldBuffer buffer{false, io::BufferCategory::kPlainBuffer, data.size(),
+                         reinterpret_cast<const std::uint8_t*>(data.data())};
+  Smallint field_count{0};
+  buffer.Read(field_count, io::BufferCategory::kPlainBuffer);
+  if (field_count == kTrailer) return false;
+
+  if constexpr (io::traits::kIsRowType<Row>) {
+    using RowType = io::RowType<Row>;
+    if (field_count != static_cast<Smallint>(RowType::size)) {
+      throw FieldTupleMismatch(field_count, RowType::size);
+    }
+    std::apply(
+        [&buffer, &categories](auto&... fields) {
+          (ReadField(buffer, fields, categories), ...);
+        },
+        RowType::GetTuple(row));
+  } else {
+    if (field_count != 1) throw FieldTupleMismatch(field_count, 1);
+    ReadField(buffer, row, categories);
+  }
+  return true;
+}
+
+}  // namespace copy
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <string>
 #include <vector>
 
 #include <userver/storages/postgres/io/nullable_traits.hpp>
@@ -44,6 +46,14 @@ class QueryParameters {
   const int* formats_ = nullptr;
 };
 
+/// Parameters are always sent in the binary format
+template <std::size_t ParamsCount>
+constexpr std::array<int, ParamsCount> MakeBinaryFormats() {
+  std::array<int, ParamsCount> formats{};
+  for (auto& format : formats) format = io::kPgBinaryDataFormat;
+  return formats;
+}
+
 template <std::size_t ParamsCount>
 class StaticQueryParameters {
  public:
@@ -57,7 +67,7 @@ class StaticQueryParameters {
   const char* const* ParamBuffers() const { return param_buffers; }
   const Oid* ParamTypesBuffer() const { return param_types; }
   const int* ParamLengthsBuffer() const { return param_lengths; }
-  const int* ParamFormatsBuffer() const { return param_formats; }
+  const int* ParamFormatsBuffer() const { return kParamFormats.data(); }
 
   template <typename T>
   void Write(std::size_t index, const UserTypes& types, const T& arg) {
@@ -94,7 +104,6 @@ class StaticQueryParameters {
                      std::true_type) {
     using NullDetector = io::traits::GetSetNull<T>;
     if (NullDetector::IsNull(arg)) {
-      param_formats[index] = io::kPgBinaryDataFormat;
       param_lengths[index] = io::kPgNullBufferSize;
       param_buffers[index] = nullptr;
     } else {
@@ -105,30 +114,44 @@ class StaticQueryParameters {
   template <typename T>
   void WriteNullable(std::size_t index, const UserTypes& types, const T& arg,
                      std::false_type) {
-    param_formats[index] = io::kPgBinaryDataFormat;
-    auto& buffer = parameters[index];
+    const auto* data_before = buffer.data();
+    const auto offset = buffer.size();
     io::WriteBuffer(types, buffer, arg);
-    auto size = buffer.size();
+    if (buffer.data() != data_before) UpdateParamBuffers();
+
+    const auto size = buffer.size() - offset;
+    param_offsets[index] = offset;
     param_lengths[index] = size;
     if (size == 0) {
       param_buffers[index] = empty_buffer;
     } else {
-      param_buffers[index] = buffer.data();
+      param_buffers[index] = buffer.data() + offset;
+    }
+  }
+
+  // The buffer was reallocated, point the written parameters to the new one
+  void UpdateParamBuffers() {
+    for (std::size_t i = 0; i < ParamsCount; ++i) {
+      if (param_buffers[i] && param_lengths[i] > 0) {
+        param_buffers[i] = buffer.data() + param_offsets[i];
+      }
     }
   }
 
   using OidList = Oid[ParamsCount];
   using BufferType = std::string;
-  using ParameterList = BufferType[ParamsCount];
   using IntList = int[ParamsCount];
 
   static constexpr const char* empty_buffer = "";
+  static constexpr auto kParamFormats = MakeBinaryFormats<ParamsCount>();
 
-  ParameterList parameters{};
+  // A single buffer for all the parameters to avoid an allocation per
+  // parameter
+  BufferType buffer;
   OidList param_types{};
   const char* param_buffers[ParamsCount]{};
+  std::size_t param_offsets[ParamsCount]{};
   IntList param_lengths{};
-  IntList param_formats{};
 };
 
 template <>
@@ -184,6 +207,7 @@ class DynamicQueryParameters {
       param_formats.push_back(io::kPgBinaryDataFormat);
       param_lengths.push_back(io::kPgNullBufferSize);
       param_buffers.push_back(nullptr);
+      param_offsets.push_back(0);
     } else {
       WriteNullable(types, arg, std::false_type{});
     }
@@ -192,27 +216,42 @@ class DynamicQueryParameters {
   template <typename T>
   void WriteNullable(const UserTypes& types, const T& arg, std::false_type) {
     param_formats.push_back(io::kPgBinaryDataFormat);
-    auto& buffer = parameters.emplace_back();
+    const auto* data_before = buffer.data();
+    const auto offset = buffer.size();
     io::WriteBuffer(types, buffer, arg);
-    auto size = buffer.size();
+    if (buffer.data() != data_before) UpdateParamBuffers();
+
+    const auto size = buffer.size() - offset;
+    param_offsets.push_back(offset);
     param_lengths.push_back(size);
     if (size == 0) {
       param_buffers.push_back(empty_buffer);
     } else {
-      param_buffers.push_back(buffer.data());
+      param_buffers.push_back(buffer.data() + offset);
+    }
+  }
+
+  // The buffer was reallocated, point the written parameters to the new one
+  void UpdateParamBuffers() {
+    for (std::size_t i = 0; i < param_buffers.size(); ++i) {
+      if (param_buffers[i] && param_lengths[i] > 0) {
+        param_buffers[i] = buffer.data() + param_offsets[i];
+      }
     }
   }
 
   using OidList = std::vector<Oid>;
   using BufferType = std::vector<char>;
-  using ParameterList = std::vector<BufferType>;
   using IntList = std::vector<int>;
 
   static constexpr const char* empty_buffer = "";
 
-  ParameterList parameters;  // TODO Replace with a single buffer
+  // A single buffer for all the parameters to avoid an allocation per
+  // parameter. Pointers to its data survive a move of the parameters.
+  BufferType buffer;
   OidList param_types;
   std::vector<const char*> param_buffers;
+  std::vector<std::size_t> param_offsets;
   IntList param_lengths;
   IntList param_formats;
 };
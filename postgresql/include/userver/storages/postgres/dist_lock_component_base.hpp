@@ -49,6 +49,7 @@ namespace storages::postgres {
 /// lock-ttl       | TTL of the lock; must be at least as long as the duration between subsequent cancellation checks, otherwise brain split is possible | --
 /// pg-timeout     | timeout, must be less than lock-ttl/2 | --
 /// restart-delay  | how much time to wait after failed task restart | 100ms
+/// batch-acquire  | acquire and prolong the lock in a single statement with the other locks of the same table and cluster that have this option set | false
 /// autostart      | if true, start automatically after component load | false
 /// task-processor | the name of the TaskProcessor for running DoWork | main-task-processor
 /// testsuite-support | Enable testsuite support | false
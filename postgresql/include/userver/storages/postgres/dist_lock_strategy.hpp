@@ -3,6 +3,9 @@
 /// @file userver/storages/postgres/dist_lock_strategy.hpp
 /// @brief @copybrief storages::postgres::DistLockStrategy
 
+#include <memory>
+#include <string>
+
 #include <userver/dist_lock/dist_lock_settings.hpp>
 #include <userver/dist_lock/dist_lock_strategy.hpp>
 #include <userver/engine/deadline.hpp>
@@ -13,12 +16,28 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+namespace detail {
+class DistLockBatcher;
+}  // namespace detail
+
+/// Whether the lock is acquired and prolonged by a statement of its own
+enum class DistLockBatching {
+  /// Each Acquire sends its own statement
+  kDisabled,
+  /// The concurrent Acquire calls of the locks of the same table and cluster
+  /// in the process are sent in a single statement
+  kEnabled,
+};
+
 /// Postgres distributed locking strategy
 class DistLockStrategy final : public dist_lock::DistLockStrategyBase {
  public:
   DistLockStrategy(ClusterPtr cluster, const std::string& table,
                    const std::string& lock_name,
-                   const dist_lock::DistLockSettings& settings);
+                   const dist_lock::DistLockSettings& settings,
+                   DistLockBatching batching = DistLockBatching::kDisabled);
+
+  ~DistLockStrategy() override;
 
   void Acquire(std::chrono::milliseconds lock_ttl,
                const std::string& locker_id) override;
@@ -34,6 +53,7 @@ class DistLockStrategy final : public dist_lock::DistLockStrategyBase {
   const std::string release_query_;
   const std::string lock_name_;
   const std::string owner_prefix_;
+  const std::shared_ptr<detail::DistLockBatcher> batcher_;
 };
 
 }  // namespace storages::postgres
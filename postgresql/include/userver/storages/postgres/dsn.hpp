@@ -41,6 +41,10 @@ std::string DsnCutPassword(const Dsn& dsn);
 /// Return DSN string with password contents masked
 std::string DsnMaskPassword(const Dsn& dsn);
 
+/// Return DSN with the option set to the value, other options are kept
+Dsn DsnWithOption(const Dsn& dsn, const std::string& keyword,
+                  const std::string& value);
+
 std::string EscapeHostName(const std::string& hostname, char escape_char = '_');
 
 /// Return DSN string with hosts resolved as hostaddr values
@@ -148,6 +148,7 @@ namespace storages::postgres {
  *       - ConnectionTimeoutError
  *     - ConnectionBusy
  *     - ConnectionInterrupted
+ *     - ReplicationProtocolError
  *     - PoolError
  *     - ClusterError
  *     - InvalidConfig
@@ -263,6 +264,11 @@ class ConnectionInterrupted : public RuntimeError {
   using RuntimeError::RuntimeError;
 };
 
+/// @brief A malformed or unexpected message in a logical replication stream.
+class ReplicationProtocolError : public RuntimeError {
+  using RuntimeError::RuntimeError;
+};
+
 //@}
 
 //@{
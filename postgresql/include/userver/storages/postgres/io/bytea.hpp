@@ -12,6 +12,7 @@
 #include <userver/storages/postgres/io/buffer_io.hpp>
 #include <userver/storages/postgres/io/buffer_io_base.hpp>
 #include <userver/storages/postgres/io/type_mapping.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -32,9 +33,28 @@ template <typename... VectorArgs>
 struct IsByteaCompatible<std::vector<unsigned char, VectorArgs...>>
     : std::true_type {};
 
+template <>
+struct IsByteaCompatible<USERVER_NAMESPACE::utils::span<const char>>
+    : std::true_type {};
+template <>
+struct IsByteaCompatible<USERVER_NAMESPACE::utils::span<const unsigned char>>
+    : std::true_type {};
+
 template <typename T>
 inline constexpr bool kIsByteaCompatible = IsByteaCompatible<T>::value;
 
+/// Types that point into the result set buffer instead of copying the data
+template <typename T>
+struct IsByteaView : std::false_type {};
+template <>
+struct IsByteaView<std::string_view> : std::true_type {};
+template <typename T>
+struct IsByteaView<USERVER_NAMESPACE::utils::span<const T>> : std::true_type {
+};
+
+template <typename T>
+inline constexpr bool kIsByteaView = IsByteaView<T>::value;
+
 template <typename T>
 using EnableIfByteaCompatible = std::enable_if_t<IsByteaCompatible<T>{}>;
 
@@ -112,10 +132,13 @@ struct BufferParser<
   using ByteaType = postgres::detail::ByteaRefWrapper<ByteContainer>;
 
   void operator()(const FieldBuffer& buffer) {
-    if constexpr (std::is_same<typename ByteaType::BytesType,
-                               std::string_view>{}) {
-      this->value.bytes = std::string_view{
-          reinterpret_cast<const char*>(buffer.buffer), buffer.length};
+    using BytesType = typename ByteaType::BytesType;
+    if constexpr (traits::kIsByteaView<BytesType>) {
+      using CharType = std::remove_const_t<
+          std::remove_pointer_t<decltype(std::declval<BytesType>().data())>>;
+      this->value.bytes =
+          BytesType{reinterpret_cast<const CharType*>(buffer.buffer),
+                    buffer.length};
     } else {
       this->value.bytes.resize(buffer.length);
       std::copy(buffer.buffer, buffer.buffer + buffer.length,
@@ -150,7 +173,6 @@ struct BufferFormatter<
 
   template <typename Buffer>
   void operator()(const UserTypes&, Buffer& buf) const {
-    buf.reserve(buf.size() + this->value.bytes.size());
     buf.insert(buf.end(), this->value.bytes.begin(), this->value.bytes.end());
   }
 };
@@ -37,8 +37,7 @@ struct BufferFormatter<const char*> {
     while (n > 0 && c[n - 1] == '\0') {
       --n;
     }
-    buf.reserve(buf.size() + n);
-    std::copy(c, c + n, std::back_inserter(buf));
+    buf.insert(buf.end(), c, c + n);
   }
 };
 //@}
@@ -0,0 +1,226 @@
+#pragma once
+
+/// @file userver/storages/postgres/logical_replication.hpp
+/// @brief Logical replication stream of table changes
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/buffer_io.hpp>
+#include <userver/storages/postgres/io/nullable_traits.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+class ConnectionPool;
+}
+
+/// Position in the write-ahead log
+using ReplicationLsn = std::uint64_t;
+
+struct LogicalReplicationSettings {
+  /// Name of a logical replication slot created with the `pgoutput` plugin,
+  /// e.g. by `SELECT pg_create_logical_replication_slot('slot', 'pgoutput')`
+  std::string slot_name;
+  /// Names of the publications to receive the changes of, e.g. created by
+  /// `CREATE PUBLICATION pub FOR TABLE my_table`
+  std::vector<std::string> publications;
+  /// Interval of the status updates that confirm the received changes to the
+  /// server
+  std::chrono::milliseconds status_interval{std::chrono::seconds{10}};
+  /// Timeout of connecting and starting the replication
+  std::chrono::milliseconds connect_timeout{std::chrono::seconds{5}};
+};
+
+struct ReplicationColumn {
+  std::string name;
+  Oid type_oid{kInvalidOid};
+  /// The column is a part of the replica identity of the table, e.g. of the
+  /// primary key
+  bool is_key{false};
+};
+
+/// Table description, sent by the server before the first change of the table
+struct ReplicationRelation {
+  Oid oid{kInvalidOid};
+  std::string schema;
+  std::string name;
+  std::vector<ReplicationColumn> columns;
+};
+
+/// @brief Column values of a changed row.
+///
+/// Values are valid only until the handler call returns. Values of the types
+/// known to the driver are parsed with the same io::traits as the query
+/// results; user defined types are not supported.
+class ReplicationTuple final {
+ public:
+  enum class ValueKind : char {
+    kNull = 'n',
+    /// An unchanged TOASTed value, the actual value is not sent
+    kUnchanged = 'u',
+    kText = 't',
+    kBinary = 'b',
+  };
+
+  struct Value {
+    ValueKind kind{ValueKind::kNull};
+    std::string_view data;
+  };
+
+  /// @cond
+  ReplicationTuple(const ReplicationRelation& relation,
+                   std::vector<Value>&& values);
+  /// @endcond
+
+  std::size_t Size() const { return values_.size(); }
+
+  bool IsNull(std::size_t index) const;
+
+  /// True if the value was not changed and is not sent by the server
+  bool IsUnchanged(std::size_t index) const;
+
+  /// @throws FieldNameDoesntExist if the table has no such column
+  std::size_t IndexOf(std::string_view column) const;
+
+  /// Raw value as it is sent by the server
+  /// @throws FieldIndexOutOfBounds
+  const Value& GetValue(std::size_t index) const;
+
+  /// @brief Parses the value of the column.
+  /// @throws FieldValueIsNull if the value is null and the C++ type is not
+  /// nullable
+  /// @throws InvalidBinaryBuffer if the value was not sent in binary format,
+  /// e.g. it is an unchanged TOASTed value
+  template <typename T>
+  T As(std::size_t index) const;
+
+  /// @overload
+  template <typename T>
+  T As(std::string_view column) const {
+    return As<T>(IndexOf(column));
+  }
+
+ private:
+  io::FieldBuffer GetBuffer(std::size_t index) const;
+  static const io::TypeBufferCategory& GetTypeBufferCategories();
+
+  const ReplicationRelation* relation_;
+  std::vector<Value> values_;
+};
+
+/// @brief Receives the decoded changes of the committed transactions.
+///
+/// The changes of a transaction are delivered between OnBegin() and
+/// OnCommit() in the commit order of the server. All the methods are called
+/// from the task that runs LogicalReplicationStream::Run().
+class LogicalReplicationHandler {
+ public:
+  virtual ~LogicalReplicationHandler() = default;
+
+  virtual void OnBegin(ReplicationLsn /*final_lsn*/) {}
+
+  virtual void OnInsert(const ReplicationRelation& relation,
+                        const ReplicationTuple& new_tuple) = 0;
+
+  /// `old_tuple` is set if the replica identity of the table is `FULL` or
+  /// the key columns were changed
+  virtual void OnUpdate(const ReplicationRelation& relation,
+                        const ReplicationTuple* old_tuple,
+                        const ReplicationTuple& new_tuple) = 0;
+
+  /// `old_tuple` has the key columns, or all the columns if the replica
+  /// identity of the table is `FULL`
+  virtual void OnDelete(const ReplicationRelation& relation,
+                        const ReplicationTuple& old_tuple) = 0;
+
+  virtual void OnTruncate(
+      const std::vector<const ReplicationRelation*>& /*relations*/) {}
+
+  /// Called after all the changes of the transaction are delivered. The
+  /// transaction is confirmed to the server after this call returns.
+  virtual void OnCommit(ReplicationLsn /*end_lsn*/) {}
+};
+
+/// @brief Streams the changes of the tables from the master host using the
+/// logical replication protocol and the `pgoutput` plugin.
+///
+/// Obtained via storages::postgres::Cluster::MakeLogicalReplicationStream().
+/// Uses a dedicated connection outside of the pool.
+///
+/// The server keeps the position of the slot and resends all the transactions
+/// that were not confirmed yet after a reconnect, so the handler may receive
+/// a transaction more than once and must apply the changes idempotently, e.g.
+/// by a primary key. A cache that loads the full snapshot first should create
+/// the slot before the load, so that the changes made during the load are
+/// not lost.
+///
+/// Requires PostgreSQL 14 or newer with `wal_level = logical`.
+///
+/// @par Usage synopsis
+/// @code
+/// auto stream = cluster.MakeLogicalReplicationStream(
+///     {"my_cache_slot", {"my_cache_publication"}});
+/// task_ = utils::Async("replication", [&stream, &handler] {
+///   stream.Run(handler);
+/// });
+/// @endcode
+class LogicalReplicationStream final {
+ public:
+  /// @cond
+  using MasterPoolGetter =
+      std::function<std::shared_ptr<detail::ConnectionPool>()>;
+
+  LogicalReplicationStream(MasterPoolGetter get_master_pool,
+                           LogicalReplicationSettings settings);
+  /// @endcond
+
+  LogicalReplicationStream(LogicalReplicationStream&&) noexcept;
+  LogicalReplicationStream& operator=(LogicalReplicationStream&&) noexcept;
+  ~LogicalReplicationStream();
+
+  /// @brief Receives the changes and calls the handler until the current task
+  /// is cancelled.
+  ///
+  /// Reconnects on errors, including the exceptions thrown by the handler;
+  /// the transaction that failed in the handler is received again.
+  void Run(LogicalReplicationHandler& handler);
+
+  /// End position of the last transaction committed by the handler, zero if
+  /// there is none yet
+  ReplicationLsn GetCommittedLsn() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+template <typename T>
+T ReplicationTuple::As(std::size_t index) const {
+  const auto buffer = GetBuffer(index);
+  T value{};
+  if (buffer.is_null) {
+    if constexpr (io::traits::kIsNullable<T>) {
+      io::traits::GetSetNull<T>::SetNull(value);
+      return value;
+    } else {
+      throw FieldValueIsNull{index, relation_->columns[index].name, value};
+    }
+  }
+  io::ReadBuffer(buffer, value, GetTypeBufferCategories());
+  return value;
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,93 @@
+#pragma once
+
+/// @file userver/storages/postgres/notification_hub.hpp
+/// @brief Multiplexed asynchronous notifications
+
+#include <functional>
+#include <memory>
+#include <string_view>
+
+#include <userver/concurrent/async_event_source.hpp>
+#include <userver/storages/postgres/notify.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+class ConnectionPool;
+}
+
+/// @brief Delivers notifications of many channels over a single connection.
+///
+/// Unlike storages::postgres::NotifyScope, that exclusively holds a connection
+/// per channel, the hub executes LISTEN for all the subscribed channels on a
+/// single connection to the master host and dispatches the notifications to
+/// subscribers via concurrent::AsyncEventChannel. Obtained via
+/// storages::postgres::Cluster::GetNotificationHub().
+///
+/// The connection is started on the first subscription. If the connection
+/// fails or the master host changes, the hub reconnects and listens to all
+/// the channels again. Notifications sent in the meantime are lost, so the
+/// subscribers should not rely on receiving every notification, e.g. a cache
+/// may use them to trigger an incremental update early, while keeping its
+/// periodic updates.
+///
+/// Channels are listened to until the hub is destroyed.
+///
+/// @par Usage synopsis
+/// @code
+/// subscription_ = cluster.GetNotificationHub().Subscribe(
+///     "channel", this, "my-cache", &MyCache::OnNotification);
+/// // ...
+/// subscription_.Unsubscribe();
+/// @endcode
+class NotificationHub final {
+ public:
+  using Callback = std::function<void(const Notification&)>;
+
+  /// @cond
+  using MasterPoolGetter =
+      std::function<std::shared_ptr<detail::ConnectionPool>()>;
+
+  explicit NotificationHub(MasterPoolGetter get_master_pool);
+  /// @endcond
+
+  ~NotificationHub();
+
+  NotificationHub(const NotificationHub&) = delete;
+  NotificationHub& operator=(const NotificationHub&) = delete;
+
+  /// @brief Subscribes to notifications of the channel.
+  ///
+  /// The channel is listened to asynchronously, notifications sent right after
+  /// the subscription may be missed. The same subscriber is never called
+  /// concurrently.
+  ///
+  /// @returns a scope that should be stored by the subscriber;
+  /// `Unsubscribe` should be called explicitly
+  concurrent::AsyncEventSubscriberScope Subscribe(std::string_view channel,
+                                                  concurrent::FunctionId id,
+                                                  std::string_view name,
+                                                  Callback callback);
+
+  /// @overload
+  template <class Class>
+  concurrent::AsyncEventSubscriberScope Subscribe(
+      std::string_view channel, Class* obj, std::string_view name,
+      void (Class::*func)(const Notification&)) {
+    return Subscribe(
+        channel, concurrent::FunctionId(obj), name,
+        [obj, func](const Notification& notification) {
+          (obj->*func)(notification);
+        });
+  }
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <unordered_map>
 
 #include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/utils/impl/transparent_hash.hpp>
 
@@ -259,12 +260,17 @@ struct ConnectionSettings {
   /// Execute discard all after establishing a new connection
   DiscardOnConnectOptions discard_on_connect = kDiscardAll;
 
+  /// Number of the most used statements of the pool to prepare on a new
+  /// connection before it serves queries, 0 to disable
+  std::size_t prepared_statements_warmup = 0;
+
   /// Helps keep track of the changes in settings
   SettingsVersion version{0U};
 
   bool operator==(const ConnectionSettings& rhs) const {
     return !RequiresConnectionReset(rhs) &&
-           recent_errors_threshold == rhs.recent_errors_threshold;
+           recent_errors_threshold == rhs.recent_errors_threshold &&
+           prepared_statements_warmup == rhs.prepared_statements_warmup;
   }
 
   bool operator!=(const ConnectionSettings& rhs) const {
@@ -295,6 +301,45 @@ struct StatementMetricsSettings final {
   }
 };
 
+/// @brief Multiplexing of single statements from concurrent coroutines
+///
+/// When enabled, storages::postgres::Cluster::Execute with a
+/// storages::postgres::ParameterStore and without ClusterHostType::kMaster
+/// role does not take a connection per call. Statements are queued and sent in
+/// pipelined batches over at most `connections` connections of each host.
+///
+/// @warning Only for read-only statements. Requires pipelining and prepared
+/// statements to be enabled, otherwise the statements of a batch are executed
+/// one by one.
+struct MultiplexingSettings final {
+  static constexpr std::size_t kDefaultConnections = 4;
+  static constexpr std::size_t kDefaultMaxBatchSize = 64;
+
+  bool enabled{false};
+  /// Maximum number of connections of a host pool used for multiplexing
+  std::size_t connections{kDefaultConnections};
+  /// Maximum number of statements sent in a single pipeline
+  std::size_t max_batch_size{kDefaultMaxBatchSize};
+};
+
+/// @brief Settings of the ClusterHostType::kLeastLoaded host selection
+///
+/// A host is scored by its expected statement latency multiplied by the
+/// number of its requests in flight. The latency is a moving average of the
+/// statement execution times on the host's connections.
+struct HostBalancingSettings final {
+  static constexpr std::chrono::milliseconds kDefaultCrossDcRttThreshold{2};
+
+  /// Strategy for the requests that specify none, ClusterHostType::kRoundRobin
+  /// or ClusterHostType::kLeastLoaded
+  ClusterHostType default_strategy{ClusterHostType::kRoundRobin};
+  /// Added to the expected latency of the hosts in other datacenters
+  std::chrono::milliseconds cross_dc_penalty{0};
+  /// A host is considered to be in another datacenter if its roundtrip time
+  /// exceeds the one of the nearest host by more than this value
+  std::chrono::milliseconds cross_dc_rtt_threshold{kDefaultCrossDcRttThreshold};
+};
+
 /// Initialization modes
 enum class InitMode {
   kSync = 0,
@@ -331,6 +376,12 @@ struct ClusterSettings {
 
   /// congestion control settings
   congestion_control::v2::LinearController::StaticConfig cc_config;
+
+  /// single statement multiplexing settings
+  MultiplexingSettings multiplexing_settings;
+
+  /// host selection settings
+  HostBalancingSettings host_balancing_settings;
 };
 
 }  // namespace storages::postgres
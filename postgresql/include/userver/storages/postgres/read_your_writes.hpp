@@ -0,0 +1,56 @@
+#pragma once
+
+/// @file userver/storages/postgres/read_your_writes.hpp
+/// @brief Read-your-writes consistency for replica reads
+
+#include <memory>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+class WriteLsnTracker;
+}  // namespace detail
+
+/// @brief Makes the writes of the current task visible to its replica reads.
+///
+/// While the scope is alive, the WAL position of every read-write
+/// transaction committed by the current task and the tasks it starts is
+/// remembered. Subsequent reads from slaves of the same cluster are routed
+/// only to the replicas that have already replayed that position, falling
+/// back to the master if there are none.
+///
+/// Replica positions are refreshed by the cluster topology discovery, about
+/// once a second, so reads right after a write usually go to the master.
+/// Each tracked commit costs an extra roundtrip to the master.
+///
+/// @warning Only storages::postgres::Transaction commits are tracked, wrap
+/// single-statement writes into a transaction to make them visible.
+///
+/// Nested scopes reuse the outer one.
+///
+/// @par Usage synopsis
+/// @code
+/// storages::postgres::ReadYourWritesScope read_your_writes;
+/// auto trx = cluster->Begin(ClusterHostType::kMaster, {});
+/// trx.Execute("INSERT INTO items VALUES ($1)", item);
+/// trx.Commit();
+/// // sees the inserted item
+/// cluster->Execute(ClusterHostType::kSlave, "SELECT * FROM items");
+/// @endcode
+class ReadYourWritesScope final {
+ public:
+  ReadYourWritesScope();
+  ~ReadYourWritesScope();
+
+  ReadYourWritesScope(const ReadYourWritesScope&) = delete;
+  ReadYourWritesScope& operator=(const ReadYourWritesScope&) = delete;
+
+ private:
+  std::shared_ptr<detail::WriteLsnTracker> outer_tracker_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -3,10 +3,12 @@
 /// @file userver/storages/postgres/result_set.hpp
 /// @brief Result accessors
 
+#include <functional>
 #include <initializer_list>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -173,6 +175,45 @@ namespace storages::postgres {
 ///
 /// @todo Interface for copying a ResultSet to an output iterator.
 ///
+/// @par Zero-copy fields
+///
+/// Fields of types std::string_view and Bytea of std::string_view or
+/// utils::span<const char> are not copied, they point into the result set
+/// buffer. Such values are valid only while a copy of the ResultSet is alive,
+/// which is enough to avoid keeping a second copy of large results that are
+/// processed right away.
+///
+/// @code
+/// auto result = trx.Execute("select id, payload from foobar");
+/// auto rows =
+///     result.AsContainer<std::vector<std::tuple<int, std::string_view>>>(
+///         kRowTag);
+/// // `rows` must not outlive `result`
+/// @endcode
+///
+/// @par Columnar access
+///
+/// A single column can be extracted into a container with
+/// ResultSet::AsColumn, which suits analytical queries that process the
+/// values of a column together.
+///
+/// @code
+/// auto result = trx.Execute("select id, value from foobar");
+/// auto ids = result.AsColumn<std::vector<int>>(0);
+/// auto values = result.AsColumn<std::vector<double>>("value");
+/// @endcode
+///
+/// @par Parallel parsing
+///
+/// Parsing of a large result set into a vector-like container can be split
+/// into chunks parsed by several tasks of the current task processor, see
+/// ParallelParsing.
+///
+/// @code
+/// auto data = result.AsContainer<std::vector<FooBar>>(
+///     kRowTag, ParallelParsing{});
+/// @endcode
+///
 /// @par Non-select query results
 ///
 /// @todo Process non-select result and provide interface. Do the docs.
@@ -206,6 +247,18 @@ struct FieldDescription {
   Integer type_modifier;
 };
 
+/// @brief Settings for parsing a large result set in parallel chunks, see
+/// ResultSet::AsContainer
+struct ParallelParsing final {
+  static constexpr std::size_t kDefaultMinRows = 10000;
+  static constexpr std::size_t kDefaultChunkRows = 2500;
+
+  /// Smaller result sets are parsed in the calling coroutine
+  std::size_t min_rows{kDefaultMinRows};
+  /// Number of rows parsed by a single task
+  std::size_t chunk_rows{kDefaultChunkRows};
+};
+
 /// @brief A wrapper for PGresult to access field descriptions.
 class RowDescription {
  public:
@@ -691,6 +744,25 @@ class ResultSet {
   template <typename Container>
   Container AsContainer(RowTag) const;
 
+  /// @brief Extract data into a container, a result set of at least
+  /// ParallelParsing::min_rows rows is parsed in parallel chunks.
+  /// The container must be random-access and resizable, e.g. std::vector.
+  /// For more information see @ref psql_typed_results
+  template <typename Container>
+  Container AsContainer(const ParallelParsing& parallel) const;
+  template <typename Container>
+  Container AsContainer(RowTag, const ParallelParsing& parallel) const;
+
+  /// @brief Extract a single column into a container.
+  /// @throws FieldIndexOutOfBounds if index is out of bounds
+  template <typename Container>
+  Container AsColumn(size_type field_index) const;
+  /// @brief Extract a single column into a container.
+  /// @throws FieldNameDoesntExist if the result set doesn't contain
+  ///         such a field
+  template <typename Container>
+  Container AsColumn(const std::string& name) const;
+
   /// @brief Extract first row into user type.
   /// A single row result set is expected, will throw an exception when result
   /// set size != 1
@@ -717,6 +789,14 @@ class ResultSet {
   void FillBufferCategories(const UserTypes& types);
   void SetBufferCategoriesFrom(const ResultSet&);
 
+  template <typename Container, typename Tag>
+  Container AsContainerParallel(Tag tag, const ParallelParsing& parallel) const;
+  // Calls parse_rows(begin, end) for chunks of rows in parallel tasks
+  void ParseInParallel(
+      size_type chunk_rows,
+      const std::function<void(size_type, size_type)>& parse_rows) const;
+  size_type IndexOfName(const std::string& name) const;
+
   template <typename T, typename Tag>
   friend class TypedResultSet;
   friend class ConnectionImpl;
@@ -1014,6 +1094,68 @@ Container ResultSet::AsContainer(RowTag) const {
   return c;
 }
 
+template <typename Container>
+Container ResultSet::AsContainer(const ParallelParsing& parallel) const {
+  return AsContainerParallel<Container>(kFieldTag, parallel);
+}
+
+template <typename Container>
+Container ResultSet::AsContainer(RowTag,
+                                 const ParallelParsing& parallel) const {
+  return AsContainerParallel<Container>(kRowTag, parallel);
+}
+
+template <typename Container, typename Tag>
+Container ResultSet::AsContainerParallel(
+    Tag tag, const ParallelParsing& parallel) const {
+  if (Size() < parallel.min_rows || Size() <= parallel.chunk_rows) {
+    if constexpr (std::is_same_v<Tag, RowTag>) {
+      return AsContainer<Container>(kRowTag);
+    } else {
+      return AsContainer<Container>();
+    }
+  }
+
+  detail::AssertSaneTypeToDeserialize<Container>();
+  using ValueType = typename Container::value_type;
+  // Also checks the field count
+  const auto res = AsSetOf<ValueType>(tag);
+
+  Container c(Size());
+  ParseInParallel(parallel.chunk_rows,
+                  [&c, &res](size_type begin, size_type end) {
+                    for (auto i = begin; i < end; ++i) c[i] = res[i];
+                  });
+  return c;
+}
+
+template <typename Container>
+Container ResultSet::AsColumn(size_type field_index) const {
+  detail::AssertSaneTypeToDeserialize<Container>();
+  using ValueType = typename Container::value_type;
+  detail::AssertRowTypeIsMappedToPgOrIsCompositeType<ValueType>();
+  if (field_index >= FieldCount()) throw FieldIndexOutOfBounds{field_index};
+
+  Container c;
+  if constexpr (io::traits::kCanReserve<Container>) {
+    c.reserve(Size());
+  }
+  auto inserter = io::traits::Inserter(c);
+  for (size_type row = 0; row < Size(); ++row, ++inserter) {
+    ValueType value{};
+    FieldView{*pimpl_, row, field_index}.To(value);
+    *inserter = std::move(value);
+  }
+  return c;
+}
+
+template <typename Container>
+Container ResultSet::AsColumn(const std::string& name) const {
+  const auto field_index = IndexOfName(name);
+  if (field_index == npos) throw FieldNameDoesntExist{name};
+  return AsColumn<Container>(field_index);
+}
+
 template <typename T>
 auto ResultSet::AsSingleRow() const {
   return AsSingleRow<T>(kFieldTag);
@@ -48,6 +48,12 @@ struct TransactionStatistics {
   /// to pretty uniqueness of names. Nevertheless we would like to see them to
   /// diagnose certain kinds of problems
   Counter duplicate_prepared_statements = 0;
+  /// Number of statements found in the prepared statements cache
+  Counter prepared_cache_hits = 0;
+  /// Number of statements missing in the prepared statements cache
+  Counter prepared_cache_misses = 0;
+  /// Number of statements evicted from the prepared statements cache
+  Counter prepared_cache_evictions = 0;
 
   // TODO pick reasonable resolution for transaction
   // execution times
@@ -115,6 +121,11 @@ struct InstanceStatisticsTemplate {
   Counter pool_exhaust_errors = 0;
   /// Error caused by queue size overflow
   Counter queue_size_errors = 0;
+  /// Number of times the host was chosen by ClusterHostType::kLeastLoaded
+  Counter least_loaded_selections = 0;
+  /// Moving average of statement execution time in microseconds, used by
+  /// ClusterHostType::kLeastLoaded
+  Counter latency_estimate_us = 0;
   /// Connect time percentile
   PercentileAccumulator connection_percentile;
   /// Acquire connection percentile
@@ -188,6 +199,10 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     transaction.execute_timeout = stats.transaction.execute_timeout;
     transaction.duplicate_prepared_statements =
         stats.transaction.duplicate_prepared_statements;
+    transaction.prepared_cache_hits = stats.transaction.prepared_cache_hits;
+    transaction.prepared_cache_misses = stats.transaction.prepared_cache_misses;
+    transaction.prepared_cache_evictions =
+        stats.transaction.prepared_cache_evictions;
     transaction.total_percentile =
         stats.transaction.total_percentile.GetStatsForPeriod();
     transaction.busy_percentile =
@@ -205,6 +220,8 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
 
     pool_exhaust_errors = stats.pool_exhaust_errors;
     queue_size_errors = stats.queue_size_errors;
+    least_loaded_selections = stats.least_loaded_selections;
+    latency_estimate_us = stats.latency_estimate_us;
     connection_percentile = stats.connection_percentile.GetStatsForPeriod();
     acquire_percentile = stats.acquire_percentile.GetStatsForPeriod();
 
@@ -3,10 +3,15 @@
 /// @file userver/storages/postgres/transaction.hpp
 /// @brief Transactions
 
+#include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/copy_binary.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -20,6 +25,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+namespace detail {
+class WriteLsnTracker;
+}  // namespace detail
+
 /// @page pg_transactions uPg: Transactions
 ///
 /// All queries that are run on a PostgreSQL cluster are executed inside
@@ -156,6 +165,10 @@ class Transaction {
                            detail::SteadyClock::now());
 
   void SetName(std::string name);
+
+  /// Records the WAL position of the commit for read-your-writes consistency
+  void TrackCommitLsn(std::shared_ptr<detail::WriteLsnTracker> tracker,
+                      const void* cluster_key);
   /// @endcond
 
   Transaction(Transaction&&) noexcept;
@@ -290,6 +303,59 @@ class Transaction {
   Portal MakePortal(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Insert rows into a table with `COPY ... FROM STDIN` in the binary format,
+  /// which is much faster than INSERT statements for large amounts of data.
+  /// Returns the number of inserted rows.
+  ///
+  /// A row is a tuple, an aggregate or a type with Introspect(), a value of any
+  /// other type is inserted into a single column. Fields are matched with the
+  /// columns by position and their types must match the column types exactly,
+  /// as there is no type conversion in COPY.
+  ///
+  /// The table and column names are quoted, a schema-qualified table name is
+  /// split on dots.
+  ///
+  /// Suspends coroutine for execution.
+  ///
+  /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+  template <typename Container>
+  std::size_t CopyIn(std::string_view table,
+                     const std::vector<std::string>& columns,
+                     const Container& rows) {
+    return CopyIn(OptionalCommandControl{}, table, columns, rows);
+  }
+
+  /// Insert rows into a table with `COPY ... FROM STDIN` in the binary format
+  /// with per-statement command control.
+  template <typename Container>
+  std::size_t CopyIn(OptionalCommandControl statement_cmd_ctl,
+                     std::string_view table,
+                     const std::vector<std::string>& columns,
+                     const Container& rows);
+
+  /// Stream the result of a query with `COPY (query) TO STDOUT` in the binary
+  /// format, calling `consumer(Row&&)` for each row as soon as it is received
+  /// without keeping the whole result in memory. Returns the number of rows.
+  ///
+  /// The query must not have parameters. Row is parsed the same way as in
+  /// CopyIn, and as there are no type oids in COPY data, the types of its
+  /// fields must match the column types exactly.
+  ///
+  /// Suspends coroutine for execution.
+  ///
+  /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut
+  template <typename Row, typename Consumer>
+  std::size_t CopyOut(const Query& query, Consumer&& consumer) {
+    return CopyOut<Row>(OptionalCommandControl{}, query,
+                        std::forward<Consumer>(consumer));
+  }
+
+  /// Stream the result of a query with `COPY (query) TO STDOUT` in the binary
+  /// format with per-statement command control.
+  template <typename Row, typename Consumer>
+  std::size_t CopyOut(OptionalCommandControl statement_cmd_ctl,
+                      const Query& query, Consumer&& consumer);
+
   /// Set a connection parameter
   /// https://www.postgresql.org/docs/current/sql-set.html
   /// The parameter is set for this transaction only
@@ -317,11 +383,20 @@ class Transaction {
   Portal MakePortal(const PortalName&, const Query& query,
                     const detail::QueryParameters& params,
                     OptionalCommandControl statement_cmd_ctl);
+  std::size_t DoCopyIn(std::string_view table,
+                       const std::vector<std::string>& columns,
+                       const detail::CopyInFiller& fill,
+                       OptionalCommandControl statement_cmd_ctl);
+  std::size_t DoCopyOut(const Query& query,
+                        const detail::CopyOutConsumer& consume,
+                        OptionalCommandControl statement_cmd_ctl);
 
   const UserTypes& GetConnectionUserTypes() const;
 
   std::string name_;
   detail::ConnectionPtr conn_;
+  std::shared_ptr<detail::WriteLsnTracker> lsn_tracker_;
+  const void* lsn_tracker_key_{nullptr};
 };
 
 template <typename Container>
@@ -364,6 +439,55 @@ void Transaction::ExecuteDecomposeBulk(OptionalCommandControl statement_cmd_ctl,
       });
 }
 
+template <typename Container>
+std::size_t Transaction::CopyIn(OptionalCommandControl statement_cmd_ctl,
+                                std::string_view table,
+                                const std::vector<std::string>& columns,
+                                const Container& rows) {
+  auto it = std::begin(rows);
+  const auto end = std::end(rows);
+  bool header_written = false;
+  bool trailer_written = false;
+  return DoCopyIn(
+      table, columns,
+      [&, this](std::vector<char>& buffer) {
+        if (!header_written) {
+          detail::copy::WriteHeader(buffer);
+          header_written = true;
+        }
+        const auto& types = GetConnectionUserTypes();
+        for (; it != end && buffer.size() < detail::copy::kChunkSize; ++it) {
+          detail::copy::WriteRow(types, buffer, *it);
+        }
+        if (it == end && !trailer_written) {
+          detail::copy::WriteTrailer(buffer);
+          trailer_written = true;
+        }
+      },
+      std::move(statement_cmd_ctl));
+}
+
+template <typename Row, typename Consumer>
+std::size_t Transaction::CopyOut(OptionalCommandControl statement_cmd_ctl,
+                                 const Query& query, Consumer&& consumer) {
+  bool header_read = false;
+  return DoCopyOut(
+      query,
+      [&, this](std::string_view data) {
+        if (!header_read) {
+          data = detail::copy::SkipHeader(data);
+          header_read = true;
+          if (data.empty()) return;
+        }
+        Row row{};
+        if (detail::copy::ReadRow(
+                data, row, GetConnectionUserTypes().GetTypeBufferCategories())) {
+          consumer(std::move(row));
+        }
+      },
+      std::move(statement_cmd_ctl));
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -28,6 +28,14 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    full-update-chunk-size:
+        type: integer
+        description: number of rows to request from PostgreSQL during full updates, 0 to fetch all rows in one request
+        defaultDescription: value of chunk-size
+    parse-tasks-count:
+        type: integer
+        description: number of fetched chunks that are parsed by separate tasks in parallel with fetching the next chunks, 0 to parse in the updating task
+        defaultDescription: 0
     pgcomponent:
         type: string
         description: PostgreSQL component name
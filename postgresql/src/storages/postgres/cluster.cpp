@@ -56,6 +56,15 @@ NotifyScope Cluster::Listen(std::string_view channel,
   return pimpl_->Listen(channel, cmd_ctl);
 }
 
+NotificationHub& Cluster::GetNotificationHub() {
+  return pimpl_->GetNotificationHub();
+}
+
+LogicalReplicationStream Cluster::MakeLogicalReplicationStream(
+    LogicalReplicationSettings settings) {
+  return pimpl_->MakeLogicalReplicationStream(std::move(settings));
+}
+
 QueryQueue Cluster::CreateQueryQueue(ClusterHostTypeFlags flags) {
   return CreateQueryQueue(flags, pimpl_->GetDefaultCommandControl().execute);
 }
@@ -133,6 +142,9 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  if (pimpl_->IsMultiplexingEnabled(flags)) {
+    return pimpl_->ExecuteMultiplexed(flags, statement_cmd_ctl, query, store);
+  }
   auto ntrx = Start(flags, statement_cmd_ctl);
   return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
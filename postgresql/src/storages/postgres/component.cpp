@@ -104,6 +104,27 @@ Postgres::Postgres(const ComponentConfig& config,
       initial_config[storages::postgres::kPipelineModeKey];
   initial_settings_.conn_settings.omit_describe_mode =
       initial_config[storages::postgres::kOmitDescribeInExecuteModeKey];
+  const auto multiplexing = config["multiplexing"];
+  auto& multiplexing_settings = initial_settings_.multiplexing_settings;
+  multiplexing_settings.enabled = multiplexing["enabled"].As<bool>(false);
+  multiplexing_settings.connections = multiplexing["connections"].As<size_t>(
+      storages::postgres::MultiplexingSettings::kDefaultConnections);
+  multiplexing_settings.max_batch_size =
+      multiplexing["max-batch-size"].As<size_t>(
+          storages::postgres::MultiplexingSettings::kDefaultMaxBatchSize);
+  const auto host_balancing = config["host-balancing"];
+  auto& host_balancing_settings = initial_settings_.host_balancing_settings;
+  host_balancing_settings.default_strategy =
+      host_balancing["default-strategy"].As<std::string>("round-robin") ==
+              "least-loaded"
+          ? storages::postgres::ClusterHostType::kLeastLoaded
+          : storages::postgres::ClusterHostType::kRoundRobin;
+  host_balancing_settings.cross_dc_penalty =
+      host_balancing["cross-dc-penalty"].As<std::chrono::milliseconds>(0);
+  host_balancing_settings.cross_dc_rtt_threshold =
+      host_balancing["cross-dc-rtt-threshold"].As<std::chrono::milliseconds>(
+          storages::postgres::HostBalancingSettings::
+              kDefaultCrossDcRttThreshold);
   initial_settings_.statement_metrics_settings =
       pg_config.statement_metrics_settings.GetOptional(name_).value_or(
           config.As<storages::postgres::StatementMetricsSettings>());
@@ -281,6 +302,10 @@ properties:
         type: integer
         description: prepared statements cache size limit
         defaultDescription: 5000
+    prepared-statements-warmup:
+        type: integer
+        description: number of the most used statements of the pool to prepare on new connections
+        defaultDescription: 0
     max_statement_metrics:
         type: integer
         description: limit of exported metrics for named statements
@@ -328,6 +353,47 @@ properties:
          - auto
          - manual
         description: how to learn the `max_pool_size`
+    multiplexing:
+        type: object
+        description: |
+            multiplexing of read-only single statements from concurrent
+            coroutines into pipelined batches
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: enable multiplexing
+                defaultDescription: false
+            connections:
+                type: integer
+                minimum: 1
+                description: maximum number of connections of each host used for multiplexing
+                defaultDescription: 4
+            max-batch-size:
+                type: integer
+                minimum: 1
+                description: maximum number of statements in a single pipeline
+                defaultDescription: 64
+    host-balancing:
+        type: object
+        description: selection of hosts within a role
+        additionalProperties: false
+        properties:
+            default-strategy:
+                type: string
+                description: host selection strategy for the requests that do not specify one
+                defaultDescription: round-robin
+                enum:
+                  - round-robin
+                  - least-loaded
+            cross-dc-penalty:
+                type: string
+                description: added to the expected latency of the hosts in other datacenters by the least-loaded strategy
+                defaultDescription: 0ms
+            cross-dc-rtt-threshold:
+                type: string
+                description: a host is considered to be in another datacenter if its roundtrip time exceeds the one of the nearest host by more than this value
+                defaultDescription: 2ms
 )");
 }
 
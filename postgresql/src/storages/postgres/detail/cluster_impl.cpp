@@ -1,5 +1,8 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <limits>
+#include <optional>
+
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
@@ -9,6 +12,7 @@
 
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
+#include <storages/postgres/detail/write_lsn_tracker.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -31,6 +35,7 @@ ClusterHostType Fallback(ClusterHostType ht) {
     case ClusterHostType::kNone:
     case ClusterHostType::kRoundRobin:
     case ClusterHostType::kNearest:
+    case ClusterHostType::kLeastLoaded:
       throw ClusterError("Invalid ClusterHostType value for fallback " +
                          ToString(ht));
   }
@@ -62,6 +67,46 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
   return indices[idx_pos];
 }
 
+size_t SelectLeastLoadedDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices,
+    const std::vector<std::shared_ptr<ConnectionPool>>& pools,
+    const topology::TopologyBase::Roundtrips& roundtrips,
+    const HostBalancingSettings& settings) {
+  UASSERT(!indices.empty());
+  const auto get_rtt = [&roundtrips](size_t dsn_index) {
+    return dsn_index < roundtrips.size() ? roundtrips[dsn_index]
+                                         : std::chrono::microseconds{-1};
+  };
+
+  std::optional<std::chrono::microseconds> min_rtt;
+  for (const auto dsn_index : indices) {
+    const auto rtt = get_rtt(dsn_index);
+    if (rtt.count() >= 0 && (!min_rtt || rtt < *min_rtt)) min_rtt = rtt;
+  }
+
+  // Indices are ordered by rtt, so the nearest host wins a tie
+  size_t selected = indices.front();
+  std::int64_t min_score = std::numeric_limits<std::int64_t>::max();
+  for (const auto dsn_index : indices) {
+    const auto& pool = *pools[dsn_index];
+    auto latency = pool.GetLatencyEstimate();
+    const auto rtt = get_rtt(dsn_index);
+    if (min_rtt && rtt.count() >= 0 &&
+        rtt - *min_rtt > settings.cross_dc_rtt_threshold) {
+      latency += settings.cross_dc_penalty;
+    }
+    // Hosts without latency samples are still balanced by their load
+    const auto score = static_cast<std::int64_t>(latency.count() + 1) *
+                       static_cast<std::int64_t>(pool.GetLoad() + 1);
+    if (score < min_score) {
+      min_score = score;
+      selected = dsn_index;
+    }
+  }
+  pools[selected]->CountLeastLoadedSelection();
+  return selected;
+}
+
 }  // namespace
 
 ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
@@ -78,7 +123,9 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
       rr_host_idx_(0),
       config_source_(std::move(config_source)),
       connlimit_watchdog_(*this, testsuite_tasks, shard_number,
-                          [this]() { OnConnlimitChanged(); }) {
+                          [this]() { OnConnlimitChanged(); }),
+      notification_hub_(
+          [this] { return FindPool(ClusterHostType::kMaster); }) {
   if (dsns.empty()) {
     throw ClusterError("Cannot create a cluster from an empty DSN list");
   } else if (dsns.size() == 1) {
@@ -112,6 +159,14 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
   }
   LOG_DEBUG() << "Pools initialized";
 
+  if (cluster_settings.multiplexing_settings.enabled) {
+    multiplexers_.reserve(host_pools_.size());
+    for (const auto& pool : host_pools_) {
+      multiplexers_.push_back(std::make_unique<QueryMultiplexer>(
+          pool, cluster_settings.multiplexing_settings));
+    }
+  }
+
   // Do not use IsConnlimitModeAuto() here because we don't care about
   // the current dynamic config value
   if (cluster_settings.connlimit_mode == ConnlimitMode::kAuto) {
@@ -206,6 +261,10 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
 
 ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     ClusterHostTypeFlags flags) {
+  return host_pools_.at(FindPoolIndex(flags));
+}
+
+size_t ClusterImpl::FindPoolIndex(ClusterHostTypeFlags flags) {
   LOG_TRACE() << "Looking for pool: " << flags;
 
   size_t dsn_index = -1;
@@ -223,7 +282,7 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     if (alive_dsn_indices->empty()) {
       throw ClusterUnavailable("None of cluster hosts are available");
     }
-    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+    dsn_index = ChooseConsistentDsnIndex(*alive_dsn_indices, flags);
   } else {
     auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
     auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
@@ -245,11 +304,59 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
                       ToString(host_role), ToString(role_flags)));
     }
     LOG_TRACE() << "Starting transaction on " << host_role;
-    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+    dsn_index = host_role == ClusterHostType::kMaster
+                    ? ChooseDsnIndex(dsn_indices_it->second, flags)
+                    : ChooseConsistentDsnIndex(dsn_indices_it->second, flags);
   }
 
   UASSERT(dsn_index < host_pools_.size());
-  return host_pools_.at(dsn_index);
+  return dsn_index;
+}
+
+size_t ClusterImpl::ChooseDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices,
+    ClusterHostTypeFlags flags) {
+  const auto cluster_settings = cluster_settings_.Read();
+  const auto& balancing_settings = cluster_settings->host_balancing_settings;
+
+  auto strategy_flags = flags & kClusterHostStrategyMask;
+  if (!strategy_flags) strategy_flags = balancing_settings.default_strategy;
+  if (strategy_flags == ClusterHostType::kLeastLoaded) {
+    if (indices.size() > 1) {
+      const auto roundtrips = topology_->GetRoundtripTimes();
+      return SelectLeastLoadedDsnIndex(indices, host_pools_, *roundtrips,
+                                       balancing_settings);
+    }
+    strategy_flags = ClusterHostType::kNearest;
+  }
+  return SelectDsnIndex(indices,
+                        flags.Clear(kClusterHostStrategyMask) | strategy_flags,
+                        rr_host_idx_);
+}
+
+size_t ClusterImpl::ChooseConsistentDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices,
+    ClusterHostTypeFlags flags) {
+  const auto tracker = GetCurrentWriteLsnTracker();
+  const auto required_lsn =
+      tracker ? tracker->GetRequiredLsn(this) : kUnknownLsn;
+  if (required_lsn == kUnknownLsn) return ChooseDsnIndex(indices, flags);
+
+  topology::TopologyBase::DsnIndices caught_up_indices;
+  {
+    const auto wal_lsns = topology_->GetWalLsns();
+    for (auto idx : indices) {
+      UASSERT(idx < wal_lsns->size());
+      if ((*wal_lsns)[idx] >= required_lsn) caught_up_indices.push_back(idx);
+    }
+  }
+  if (!caught_up_indices.empty()) {
+    return ChooseDsnIndex(caught_up_indices, flags);
+  }
+  LOG_DEBUG() << "No host has replayed the writes of the task yet (LSN "
+              << required_lsn << "), falling back to master";
+  return FindPoolIndex(ClusterHostType::kMaster |
+                       flags.Clear(kClusterHostRolesMask));
 }
 
 Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
@@ -267,7 +374,13 @@ Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
     }
     flags = ClusterHostType::kMaster | flags.Clear(kClusterHostRolesMask);
   }
-  return FindPool(flags)->Begin(options, cmd_ctl);
+  auto trx = FindPool(flags)->Begin(options, cmd_ctl);
+  if (!options.IsReadOnly()) {
+    if (auto tracker = GetCurrentWriteLsnTracker()) {
+      trx.TrackCommitLsn(std::move(tracker), this);
+    }
+  }
+  return trx;
 }
 
 NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
@@ -285,6 +398,15 @@ NotifyScope ClusterImpl::Listen(std::string_view channel,
   return FindPool(ClusterHostType::kMaster)->Listen(channel, cmd_ctl);
 }
 
+NotificationHub& ClusterImpl::GetNotificationHub() { return notification_hub_; }
+
+LogicalReplicationStream ClusterImpl::MakeLogicalReplicationStream(
+    LogicalReplicationSettings settings) {
+  return LogicalReplicationStream{
+      [this] { return FindPool(ClusterHostType::kMaster); },
+      std::move(settings)};
+}
+
 QueryQueue ClusterImpl::CreateQueryQueue(ClusterHostTypeFlags flags,
                                          TimeoutDuration acquire_timeout) {
   return QueryQueue{GetDefaultCommandControl(),
@@ -292,6 +414,24 @@ QueryQueue ClusterImpl::CreateQueryQueue(ClusterHostTypeFlags flags,
                         engine::Deadline::FromDuration(acquire_timeout))};
 }
 
+bool ClusterImpl::IsMultiplexingEnabled(ClusterHostTypeFlags flags) const {
+  const auto role_flags = flags & kClusterHostRolesMask;
+  return !multiplexers_.empty() && role_flags &&
+         !(role_flags & ClusterHostType::kMaster);
+}
+
+ResultSet ClusterImpl::ExecuteMultiplexed(
+    ClusterHostTypeFlags flags, OptionalCommandControl statement_cmd_ctl,
+    const Query& query, const ParameterStore& store) {
+  UASSERT(IsMultiplexingEnabled(flags));
+  LOG_TRACE() << "Requested multiplexed statement on " << flags;
+  const auto dsn_index = FindPoolIndex(flags);
+  UASSERT(dsn_index < multiplexers_.size());
+  const auto cmd_ctl = statement_cmd_ctl.value_or(
+      host_pools_[dsn_index]->GetDefaultCommandControl());
+  return multiplexers_[dsn_index]->Execute(cmd_ctl, query, store);
+}
+
 void ClusterImpl::SetDefaultCommandControl(CommandControl cmd_ctl,
                                            DefaultCommandControlSource source) {
   default_cmd_ctls_.UpdateDefaultCmdCtl(cmd_ctl, source);
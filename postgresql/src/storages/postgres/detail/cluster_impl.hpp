@@ -14,10 +14,13 @@
 #include <storages/postgres/connlimit_watchdog.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
 #include <storages/postgres/detail/pool.hpp>
+#include <storages/postgres/detail/query_multiplexer.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 #include <storages/postgres/detail/topology/base.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/logical_replication.hpp>
+#include <userver/storages/postgres/notification_hub.hpp>
 #include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query_queue.hpp>
@@ -50,9 +53,22 @@ class ClusterImpl {
 
   NotifyScope Listen(std::string_view channel, OptionalCommandControl);
 
+  NotificationHub& GetNotificationHub();
+
+  LogicalReplicationStream MakeLogicalReplicationStream(
+      LogicalReplicationSettings settings);
+
   QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags,
                               TimeoutDuration acquire_timeout);
 
+  /// Whether a single statement on `flags` hosts may be multiplexed, see
+  /// MultiplexingSettings
+  bool IsMultiplexingEnabled(ClusterHostTypeFlags flags) const;
+
+  ResultSet ExecuteMultiplexed(ClusterHostTypeFlags flags,
+                               OptionalCommandControl statement_cmd_ctl,
+                               const Query& query, const ParameterStore& store);
+
   void SetDefaultCommandControl(CommandControl, DefaultCommandControlSource);
   CommandControl GetDefaultCommandControl() const;
 
@@ -84,15 +100,27 @@ class ClusterImpl {
   using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
 
   ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
+  size_t FindPoolIndex(ClusterHostTypeFlags);
+  size_t ChooseDsnIndex(const topology::TopologyBase::DsnIndices& indices,
+                        ClusterHostTypeFlags flags);
+  // Only chooses the hosts that have replayed the writes tracked by
+  // ReadYourWritesScope, falls back to master if there are none
+  size_t ChooseConsistentDsnIndex(
+      const topology::TopologyBase::DsnIndices& indices,
+      ClusterHostTypeFlags flags);
 
   DefaultCommandControls default_cmd_ctls_;
   rcu::Variable<ClusterSettings> cluster_settings_;
   std::unique_ptr<topology::TopologyBase> topology_;
   engine::TaskProcessor& bg_task_processor_;
   std::vector<ConnectionPoolPtr> host_pools_;
+  // Empty if multiplexing is disabled, otherwise one per host pool
+  std::vector<std::unique_ptr<QueryMultiplexer>> multiplexers_;
   std::atomic<uint32_t> rr_host_idx_;
   dynamic_config::Source config_source_;
   ConnlimitWatchdog connlimit_watchdog_;
+  // Must be destroyed before the pools, it holds a master connection
+  NotificationHub notification_hub_;
 };
 
 }  // namespace storages::postgres::detail
@@ -23,14 +23,15 @@ std::unique_ptr<Connection> Connection::Connect(
     ConnectionSettings settings, const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock) {
+    engine::SemaphoreLock&& size_lock,
+    PreparedStatementsRegistry* prepared_registry) {
   std::unique_ptr<Connection> conn(new Connection());
 
   const auto deadline = engine::Deadline::FromDuration(std::max(
       kMinConnectTimeout, default_cmd_ctls.GetDefaultCmdCtl().execute));
   conn->pimpl_ = std::make_unique<ConnectionImpl>(
       bg_task_processor, bg_task_storage, id, settings, default_cmd_ctls,
-      testsuite_pg_ctl, ei_settings, std::move(size_lock));
+      testsuite_pg_ctl, ei_settings, std::move(size_lock), prepared_registry);
   if (resolver) {
     try {
       conn->pimpl_->AsyncConnect(ResolveDsnHostaddrs(dsn, *resolver, deadline),
@@ -200,6 +201,19 @@ Notification Connection::WaitNotify(engine::Deadline deadline) {
   return pimpl_->WaitNotify(deadline);
 }
 
+ResultSet Connection::CopyIn(std::string_view table,
+                             const std::vector<std::string>& columns,
+                             const CopyInFiller& fill,
+                             OptionalCommandControl cmd_ctl) {
+  return pimpl_->CopyIn(table, columns, fill, std::move(cmd_ctl));
+}
+
+ResultSet Connection::CopyOut(const Query& query,
+                              const CopyOutConsumer& consume,
+                              OptionalCommandControl cmd_ctl) {
+  return pimpl_->CopyOut(query, consume, std::move(cmd_ctl));
+}
+
 TimeoutDuration Connection::GetIdleDuration() const {
   return pimpl_->GetIdleDuration();
 }
@@ -13,6 +13,7 @@
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/strong_typedef.hpp>
 
+#include <userver/storages/postgres/detail/copy_binary.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/dsn.hpp>
@@ -39,6 +40,7 @@ enum class ConnectionState {
 namespace detail {
 
 class ConnectionImpl;
+class PreparedStatementsRegistry;
 
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
@@ -94,6 +96,12 @@ class Connection {
     /// Number of duplicate prepared statements errors,
     /// probably caused by timeout while preparing
     Counter duplicate_prepared_statements{0};
+    /// Number of statements found in the prepared statements cache
+    Counter prepared_cache_hits{0};
+    /// Number of statements missing in the prepared statements cache
+    Counter prepared_cache_misses{0};
+    /// Number of statements evicted from the prepared statements cache
+    Counter prepared_cache_evictions{0};
 
     /// Current number of prepared statements
     CurrentValue prepared_statements_current{0};
@@ -130,6 +138,7 @@ class Connection {
   /// @param testsuite_pg_ctl operation parameters customizer for testsuite
   /// @param ei_settings error injection settings
   /// @param size_guard structure to track the size of owning connection pool
+  /// @param prepared_registry pool-wide prepared statements usage registry
   /// @throws ConnectionFailed, ConnectionTimeoutError
   // clang-format on
   static std::unique_ptr<Connection> Connect(
@@ -140,7 +149,8 @@ class Connection {
       const DefaultCommandControls& default_cmd_ctls,
       const testsuite::PostgresControl& testsuite_pg_ctl,
       const error_injection::Settings& ei_settings,
-      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{});
+      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{},
+      PreparedStatementsRegistry* prepared_registry = nullptr);
 
   /// Close the connection
   /// TODO When called from another thread/coroutine will wait for current
@@ -284,6 +294,17 @@ class Connection {
   void Unlisten(std::string_view channel, OptionalCommandControl);
 
   Notification WaitNotify(engine::Deadline deadline);
+
+  /// Execute `COPY table (columns) FROM STDIN` in the binary format with the
+  /// data produced by the filler
+  ResultSet CopyIn(std::string_view table,
+                   const std::vector<std::string>& columns,
+                   const CopyInFiller& fill, OptionalCommandControl);
+
+  /// Execute `COPY (query) TO STDOUT` in the binary format passing each
+  /// received data message to the consumer
+  ResultSet CopyOut(const Query& query, const CopyOutConsumer& consume,
+                    OptionalCommandControl);
   //@}
 
   /// Get duration since last network operation
@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/connection_impl.hpp>
 
+#include <algorithm>
+
 #include <boost/functional/hash.hpp>
 
 #include <userver/error_injection/hook.hpp>
@@ -14,6 +16,7 @@
 #include <userver/utils/text_light.hpp>
 #include <userver/utils/uuid4.hpp>
 
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <storages/postgres/detail/tracing_tags.hpp>
 #include <storages/postgres/experiments.hpp>
 #include <storages/postgres/io/pg_type_parsers.hpp>
@@ -34,6 +37,10 @@ constexpr std::string_view kStatementTimeoutParameter = "statement_timeout";
 constexpr std::string_view kStatementVacuum = "vacuum";
 constexpr std::string_view kStatementListen = "listen {}";
 constexpr std::string_view kStatementUnlisten = "unlisten {}";
+constexpr std::string_view kStatementCopyIn =
+    "COPY {} ({}) FROM STDIN (FORMAT binary)";
+constexpr std::string_view kStatementCopyOut =
+    "COPY ({}) TO STDOUT (FORMAT binary)";
 
 const Query kSetConfigQuery{fmt::format("SELECT set_config($1, $2, $3) as {}",
                                         kSetConfigQueryResultName)};
@@ -184,11 +191,13 @@ ConnectionImpl::ConnectionImpl(
     ConnectionSettings settings, const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock)
+    engine::SemaphoreLock&& size_lock,
+    PreparedStatementsRegistry* prepared_registry)
     : uuid_{USERVER_NAMESPACE::utils::generators::GenerateUuid()},
       conn_wrapper_{bg_task_processor, bg_task_storage, id,
                     std::move(size_lock)},
       prepared_{settings.max_prepared_cache_size},
+      prepared_registry_{prepared_registry},
       settings_{settings},
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_{testsuite_pg_ctl},
@@ -238,6 +247,7 @@ void ConnectionImpl::AsyncConnect(const Dsn& dsn, engine::Deadline deadline) {
   if (settings_.user_types != ConnectionSettings::kPredefinedTypesOnly) {
     LoadUserTypes(deadline);
   }
+  WarmUpPreparedStatements(deadline, span, scope);
   if (settings_.pipeline_mode == PipelineMode::kEnabled) {
     conn_wrapper_.EnterPipelineMode();
   }
@@ -528,6 +538,71 @@ Notification ConnectionImpl::WaitNotify(engine::Deadline deadline) {
   return conn_wrapper_.WaitNotify(deadline);
 }
 
+ResultSet ConnectionImpl::CopyIn(std::string_view table,
+                                 const std::vector<std::string>& columns,
+                                 const CopyInFiller& fill,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  // A schema-qualified name is escaped part by part
+  auto table_parts = USERVER_NAMESPACE::utils::text::Split(table, ".");
+  for (auto& part : table_parts) part = conn_wrapper_.EscapeIdentifier(part);
+  std::vector<std::string> escaped_columns;
+  escaped_columns.reserve(columns.size());
+  for (const auto& column : columns) {
+    escaped_columns.push_back(conn_wrapper_.EscapeIdentifier(column));
+  }
+  const Query query{
+      fmt::format(kStatementCopyIn,
+                  USERVER_NAMESPACE::utils::text::Join(table_parts, "."),
+                  USERVER_NAMESPACE::utils::text::Join(escaped_columns, ", "))};
+
+  return ExecuteCopy(
+      query, PGRES_COPY_IN, std::move(statement_cmd_ctl),
+      [this, &fill](engine::Deadline deadline, tracing::ScopeTime& scope) {
+        std::vector<char> chunk;
+        while (true) {
+          chunk.clear();
+          try {
+            fill(chunk);
+          } catch (const std::exception& e) {
+            // Fail the statement, so that the connection gets back to the
+            // (aborted) transaction
+            conn_wrapper_.PutCopyEnd(deadline, e.what());
+            try {
+              conn_wrapper_.WaitResult(deadline, scope, nullptr);
+            } catch (const Error&) {
+              // The statement error is expected
+            }
+            throw;
+          }
+          if (chunk.empty()) break;
+          conn_wrapper_.PutCopyData(deadline, {chunk.data(), chunk.size()});
+        }
+        conn_wrapper_.PutCopyEnd(deadline);
+      });
+}
+
+ResultSet ConnectionImpl::CopyOut(const Query& query,
+                                  const CopyOutConsumer& consume,
+                                  OptionalCommandControl statement_cmd_ctl) {
+  const Query copy_query{fmt::format(kStatementCopyOut, query.Statement()),
+                         query.GetName()};
+
+  return ExecuteCopy(
+      copy_query, PGRES_COPY_OUT, std::move(statement_cmd_ctl),
+      [this, &consume](engine::Deadline deadline, tracing::ScopeTime&) {
+        while (auto data = conn_wrapper_.GetCopyData(deadline)) {
+          try {
+            consume({data->buffer.get(), data->size});
+          } catch (const std::exception&) {
+            // The rest of the rows is skipped to leave the connection idle
+            while (conn_wrapper_.GetCopyData(deadline)) {
+            }
+            throw;
+          }
+        }
+      });
+}
+
 void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
   auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
 
@@ -724,17 +799,21 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
   if (statement_info) {
     if (statement_info->description.pimpl_) {
       LOG_TRACE() << "Query " << statement << " is already prepared.";
+      ++stats_.prepared_cache_hits;
+      ReportPreparedStatementUse(*statement_info, params);
       return *statement_info;
     } else {
       LOG_DEBUG() << "Found prepared but not described statement";
     }
   }
+  ++stats_.prepared_cache_misses;
 
   if (prepared_.GetSize() >= settings_.max_prepared_cache_size) {
     auto statement_info = prepared_.GetLeastUsed();
     UASSERT(statement_info);
     DiscardPreparedStatement(*statement_info, deadline);
     prepared_.Erase(statement_info->id);
+    ++stats_.prepared_cache_evictions;
   }
 
   scope.Reset(scopes::kPrepare);
@@ -793,9 +872,57 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
 
   ++stats_.parse_total;
 
+  if (prepared_registry_) {
+    prepared_registry_->Account(query_hash, statement, params, 1);
+  }
+
   return *statement_info;
 }
 
+void ConnectionImpl::ReportPreparedStatementUse(
+    PreparedStatementInfo& info, const QueryParameters& params) {
+  if (!prepared_registry_) return;
+  // The registry is shared by the connections of the pool, so the uses are
+  // reported in batches and are kept for the next batch on contention
+  if (++info.unreported_uses >= PreparedStatementsRegistry::kUsesBatchSize &&
+      prepared_registry_->TryAccount(info.id.GetUnderlying(), info.statement,
+                                     params, info.unreported_uses)) {
+    info.unreported_uses = 0;
+  }
+}
+
+void ConnectionImpl::WarmUpPreparedStatements(engine::Deadline deadline,
+                                              tracing::Span& span,
+                                              tracing::ScopeTime& scope) {
+  if (!prepared_registry_ || !ArePreparedStatementsEnabled() ||
+      !settings_.prepared_statements_warmup) {
+    return;
+  }
+
+  const auto statements = prepared_registry_->GetMostUsed(std::min(
+      settings_.prepared_statements_warmup, settings_.max_prepared_cache_size));
+  std::size_t prepared = 0;
+  for (const auto& statement : statements) {
+    if (deadline.IsReached()) break;
+
+    ParamTypesHolder param_types{statement.param_types};
+    const QueryParameters params{param_types};
+    try {
+      DoPrepareStatement(statement.statement, params, deadline, span, scope);
+      ++prepared;
+    } catch (const ConnectionError&) {
+      throw;
+    } catch (const Error& e) {
+      // The statement may be no longer valid, e.g. after a migration
+      LOG_LIMITED_WARNING() << "Failed to prepare statement `"
+                            << statement.statement
+                            << "` while warming up a connection: " << e;
+    }
+  }
+  LOG_DEBUG() << "Prepared " << prepared << " of the " << statements.size()
+              << " most used statements of the pool";
+}
+
 void ConnectionImpl::DiscardOldPreparedStatements(engine::Deadline deadline) {
   // do not try to do anything in transaction as it may already be broken
   if (is_discard_prepared_pending_ && !IsInTransaction()) {
@@ -982,6 +1109,48 @@ void ConnectionImpl::SetParameter(std::string_view name, std::string_view value,
   }
 }
 
+template <typename Transfer>
+ResultSet ConnectionImpl::ExecuteCopy(const Query& query,
+                                      ExecStatusType copy_status,
+                                      OptionalCommandControl statement_cmd_ctl,
+                                      const Transfer& transfer) {
+  CheckBusy();
+
+  const auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(ExecuteTimeout(statement_cmd_ctl));
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+
+  // COPY is not allowed in the pipeline mode, so the queued commands are
+  // completed before leaving it
+  auto pipeline_guard = std::optional<ScopeGuard>{};
+  if (IsPipelineActive()) {
+    conn_wrapper_.DiscardInput(deadline);
+    conn_wrapper_.ExitPipelineMode();
+    pipeline_guard.emplace([this]() { conn_wrapper_.EnterPipelineMode(); });
+  }
+
+  const auto& statement = query.Statement();
+  const auto network_timeout =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline.TimeLeft());
+  CheckDeadlineReached(deadline);
+  auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  CountExecute count_execute(stats_);
+
+  try {
+    conn_wrapper_.SendQuery(statement, scope);
+    conn_wrapper_.WaitCopyStart(deadline, scope, copy_status);
+    scope.Reset(scopes::kLibpqCopyData);
+    transfer(deadline, scope);
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+  return WaitResult(statement, deadline, network_timeout, count_execute, span,
+                    scope, nullptr);
+}
+
 void ConnectionImpl::LoadUserTypes(engine::Deadline deadline) {
   UASSERT(settings_.user_types != ConnectionSettings::kPredefinedTypesOnly);
   try {
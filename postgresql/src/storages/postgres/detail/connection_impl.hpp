@@ -6,6 +6,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <userver/cache/lru_map.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -20,6 +21,7 @@
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <userver/storages/postgres/detail/copy_binary.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -37,6 +39,8 @@ class ConnectionImpl {
     std::string statement;
     std::string statement_name;
     ResultSet description{nullptr};
+    /// Uses not yet reported to the PreparedStatementsRegistry
+    std::size_t unreported_uses{0};
   };
 
   ConnectionImpl(engine::TaskProcessor& bg_task_processor,
@@ -45,7 +49,8 @@ class ConnectionImpl {
                  const DefaultCommandControls& default_cmd_ctls,
                  const testsuite::PostgresControl& testsuite_pg_ctl,
                  const error_injection::Settings& ei_settings,
-                 engine::SemaphoreLock&& size_lock);
+                 engine::SemaphoreLock&& size_lock,
+                 PreparedStatementsRegistry* prepared_registry);
 
   void AsyncConnect(const Dsn& dsn, engine::Deadline deadline);
   void Close();
@@ -111,6 +116,13 @@ class ConnectionImpl {
   void Unlisten(std::string_view channel, OptionalCommandControl);
   Notification WaitNotify(engine::Deadline deadline);
 
+  ResultSet CopyIn(std::string_view table,
+                   const std::vector<std::string>& columns,
+                   const CopyInFiller& fill,
+                   OptionalCommandControl statement_cmd_ctl);
+  ResultSet CopyOut(const Query& query, const CopyOutConsumer& consume,
+                    OptionalCommandControl statement_cmd_ctl);
+
   void CancelAndCleanup(TimeoutDuration timeout);
   bool Cleanup(TimeoutDuration timeout);
 
@@ -154,6 +166,10 @@ class ConnectionImpl {
       const std::string& statement, const detail::QueryParameters& params,
       engine::Deadline deadline, tracing::Span& span,
       tracing::ScopeTime& scope);
+  void ReportPreparedStatementUse(PreparedStatementInfo& info,
+                                  const detail::QueryParameters& params);
+  void WarmUpPreparedStatements(engine::Deadline deadline, tracing::Span& span,
+                                tracing::ScopeTime& scope);
   void DiscardOldPreparedStatements(engine::Deadline deadline);
   void DiscardPreparedStatement(const PreparedStatementInfo& info,
                                 engine::Deadline deadline);
@@ -180,6 +196,11 @@ class ConnectionImpl {
                     Connection::ParameterScope scope,
                     engine::Deadline deadline);
 
+  template <typename Transfer>
+  ResultSet ExecuteCopy(const Query& query, ExecStatusType copy_status,
+                        OptionalCommandControl statement_cmd_ctl,
+                        const Transfer& transfer);
+
   void LoadUserTypes(engine::Deadline deadline);
   void FillBufferCategories(ResultSet& res);
 
@@ -199,6 +220,7 @@ class ConnectionImpl {
   Connection::Statistics stats_;
   PGConnectionWrapper conn_wrapper_;
   PreparedStatements prepared_;
+  PreparedStatementsRegistry* prepared_registry_;
   UserTypes db_types_;
   bool is_in_recovery_ = true;
   bool is_read_only_ = true;
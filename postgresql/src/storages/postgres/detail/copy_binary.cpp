@@ -0,0 +1,70 @@
+#include <userver/storages/postgres/detail/copy_binary.hpp>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::copy {
+
+namespace {
+
+constexpr std::string_view kSignature{"PGCOPY\n\377\r\n\0", 11};
+constexpr std::size_t kHeaderSize =
+    kSignature.size() + sizeof(Integer) + sizeof(Integer);
+// Bit 16 of the flags field, the rest of the bits are reserved
+constexpr Integer kHasOidsFlag = 1 << 16;
+
+const UserTypes& NoUserTypes() {
+  static const UserTypes types;
+  return types;
+}
+
+Integer ReadInteger(std::string_view data) {
+  Integer value{0};
+  io::FieldBuffer buffer{false, io::BufferCategory::kPlainBuffer, data.size(),
+                         reinterpret_cast<const std::uint8_t*>(data.data())};
+  buffer.Read(value, io::BufferCategory::kPlainBuffer);
+  return value;
+}
+
+}  // namespace
+
+void WriteHeader(std::vector<char>& buffer) {
+  buffer.insert(buffer.end(), kSignature.begin(), kSignature.end());
+  // Flags
+  io::WriteBuffer(NoUserTypes(), buffer, Integer{0});
+  // Header extension area length
+  io::WriteBuffer(NoUserTypes(), buffer, Integer{0});
+}
+
+void WriteTrailer(std::vector<char>& buffer) {
+  io::WriteBuffer(NoUserTypes(), buffer, kTrailer);
+}
+
+std::string_view SkipHeader(std::string_view data) {
+  if (data.size() < kHeaderSize ||
+      data.substr(0, kSignature.size()) != kSignature) {
+    throw InvalidBinaryBuffer("Invalid binary COPY header signature");
+  }
+  data.remove_prefix(kSignature.size());
+
+  const auto flags = ReadInteger(data);
+  if (flags & kHasOidsFlag) {
+    throw InvalidBinaryBuffer("Binary COPY data with OIDs is not supported");
+  }
+  data.remove_prefix(sizeof(Integer));
+
+  const auto extension_length = ReadInteger(data);
+  data.remove_prefix(sizeof(Integer));
+  if (extension_length < 0 ||
+      static_cast<std::size_t>(extension_length) > data.size()) {
+    throw InvalidBinaryBuffer(fmt::format(
+        "Invalid binary COPY header extension length {}", extension_length));
+  }
+  data.remove_prefix(extension_length);
+  return data;
+}
+
+}  // namespace storages::postgres::detail::copy
+
+USERVER_NAMESPACE_END
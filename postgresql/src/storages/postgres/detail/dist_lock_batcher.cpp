@@ -0,0 +1,203 @@
+#include <storages/postgres/detail/dist_lock_batcher.hpp>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/engine/future.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/postgres/cluster.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+constexpr std::size_t kMaxBatchSize = 256;
+
+// keys - $1
+// owners - $2
+// timeouts in seconds - $3
+std::string MakeBatchAcquireQuery(const std::string& table) {
+  static constexpr auto kBatchAcquireQueryFmt = R"(
+    INSERT INTO {} AS t (key, owner, expiration_time)
+    SELECT r.key, r.owner, current_timestamp + make_interval(secs => r.ttl)
+    FROM UNNEST($1::text[], $2::text[], $3::float8[]) AS r(key, owner, ttl)
+    ON CONFLICT (key) DO UPDATE
+    SET owner = excluded.owner, expiration_time = excluded.expiration_time
+    WHERE (t.owner = excluded.owner) OR
+    (t.expiration_time <= current_timestamp) RETURNING t.key;
+)";
+  return fmt::format(FMT_COMPILE(kBatchAcquireQueryFmt), table);
+}
+
+}  // namespace
+
+struct DistLockBatcher::Request final {
+  Request(CommandControl cc, const std::string& key, const std::string& owner,
+          std::chrono::milliseconds lock_ttl)
+      : cc(cc), key(key), owner(owner), lock_ttl(lock_ttl) {}
+
+  const CommandControl cc;
+  const std::string& key;
+  const std::string& owner;
+  const std::chrono::milliseconds lock_ttl;
+  engine::Promise<bool> promise;
+};
+
+struct DistLockBatcher::BatchItem final {
+  // The request may be destroyed as soon as the promise is set
+  const Request* request;
+  engine::Promise<bool> promise;
+};
+
+DistLockBatcher::DistLockBatcher(ClusterPtr cluster, const std::string& table)
+    : cluster_(std::move(cluster)),
+      acquire_query_(MakeBatchAcquireQuery(table)) {}
+
+DistLockBatcher::~DistLockBatcher() { workers_.CancelAndWait(); }
+
+std::shared_ptr<DistLockBatcher> DistLockBatcher::Get(
+    const ClusterPtr& cluster, const std::string& table) {
+  static std::mutex mutex;
+  static std::map<std::pair<const Cluster*, std::string>,
+                  std::weak_ptr<DistLockBatcher>>
+      batchers;
+
+  const std::lock_guard lock{mutex};
+  auto& batcher = batchers[{cluster.get(), table}];
+  auto result = batcher.lock();
+  if (!result) {
+    result = std::make_shared<DistLockBatcher>(cluster, table);
+    batcher = result;
+  }
+  return result;
+}
+
+bool DistLockBatcher::Acquire(CommandControl cc, const std::string& key,
+                              const std::string& owner,
+                              std::chrono::milliseconds lock_ttl) {
+  Request request{cc, key, owner, lock_ttl};
+  auto future = request.promise.get_future();
+  Enqueue(request);
+
+  const auto status =
+      future.wait_until(engine::Deadline::FromDuration(cc.execute));
+  if (status != engine::FutureStatus::kReady && TryRemove(request)) {
+    if (status == engine::FutureStatus::kCancelled) {
+      throw ConnectionInterrupted(
+          "Task cancelled while waiting for a batched lock acquisition");
+    }
+    throw ConnectionTimeoutError(
+        "Timed out while waiting for a batched lock acquisition to be sent");
+  }
+
+  // The request is already taken by the worker, which reads it until the
+  // result is ready. The worker is bounded by the statement deadline.
+  const engine::TaskCancellationBlocker cancellation_blocker;
+  return future.get();
+}
+
+void DistLockBatcher::Enqueue(Request& request) {
+  {
+    const std::lock_guard lock{mutex_};
+    queue_.push_back(&request);
+    if (std::exchange(is_working_, true)) return;
+  }
+  // Critical: a worker that never starts would never reset is_working_
+  workers_.CriticalAsyncDetach("pg_dist_lock_batcher", [this] { Work(); });
+}
+
+bool DistLockBatcher::TryRemove(Request& request) {
+  const std::lock_guard lock{mutex_};
+  const auto it = std::find(queue_.begin(), queue_.end(), &request);
+  if (it == queue_.end()) return false;
+  queue_.erase(it);
+  return true;
+}
+
+bool DistLockBatcher::TakeBatch(Batch& batch) {
+  UASSERT(batch.empty());
+  const std::lock_guard lock{mutex_};
+  if (queue_.empty()) {
+    is_working_ = false;
+    return false;
+  }
+
+  // A statement may not update a row twice, the requests for the same key
+  // wait for the next batch
+  std::unordered_set<std::string_view> keys;
+  for (auto it = queue_.begin();
+       it != queue_.end() && batch.size() < kMaxBatchSize;) {
+    auto* request = *it;
+    if (!keys.insert(request->key).second) {
+      ++it;
+      continue;
+    }
+    batch.push_back(BatchItem{request, std::move(request->promise)});
+    it = queue_.erase(it);
+  }
+  return true;
+}
+
+void DistLockBatcher::Work() {
+  Batch batch;
+  while (TakeBatch(batch)) {
+    try {
+      Run(batch);
+    } catch (const std::exception&) {
+      const auto exception = std::current_exception();
+      for (auto& item : batch) item.promise.set_exception(exception);
+    }
+    batch.clear();
+  }
+}
+
+void DistLockBatcher::Run(Batch& batch) {
+  tracing::Span span{"pg_dist_lock_batch"};
+  span.AddTag("batch_size", batch.size());
+
+  std::vector<std::string> keys;
+  std::vector<std::string> owners;
+  std::vector<double> timeouts_seconds;
+  keys.reserve(batch.size());
+  owners.reserve(batch.size());
+  timeouts_seconds.reserve(batch.size());
+
+  auto cc = batch.front().request->cc;
+  for (const auto& item : batch) {
+    const auto& request = *item.request;
+    keys.push_back(request.key);
+    owners.push_back(request.owner);
+    timeouts_seconds.push_back(request.lock_ttl.count() / 1000.0);
+    // The statement must fit the shortest deadline of the batch
+    cc.execute = std::min(cc.execute, request.cc.execute);
+    cc.statement = std::min(cc.statement, request.cc.statement);
+  }
+
+  const auto result =
+      cluster_->Execute(ClusterHostType::kMaster, cc, acquire_query_, keys,
+                        owners, timeouts_seconds);
+
+  std::unordered_set<std::string> acquired;
+  for (auto key : result.AsSetOf<std::string>()) {
+    acquired.insert(std::move(key));
+  }
+  for (auto& item : batch) {
+    item.promise.set_value(acquired.count(item.request->key) != 0);
+  }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Acquires and prolongs the distributed locks of a table, requested by
+/// concurrent coroutines, in a single statement. A statement is sent as soon
+/// as the previous one completes, so the locks do not wait for a batch to
+/// fill up and keep their own deadlines.
+class DistLockBatcher final {
+ public:
+  DistLockBatcher(ClusterPtr cluster, const std::string& table);
+  ~DistLockBatcher();
+
+  /// Returns the batcher shared by all the locks of the table in the cluster
+  static std::shared_ptr<DistLockBatcher> Get(const ClusterPtr& cluster,
+                                              const std::string& table);
+
+  /// Returns false if the lock is held by another owner
+  bool Acquire(CommandControl cc, const std::string& key,
+               const std::string& owner, std::chrono::milliseconds lock_ttl);
+
+ private:
+  struct Request;
+  struct BatchItem;
+
+  using Batch = std::vector<BatchItem>;
+
+  void Enqueue(Request& request);
+  bool TryRemove(Request& request);
+  bool TakeBatch(Batch& batch);
+
+  void Work();
+  void Run(Batch& batch);
+
+  const ClusterPtr cluster_;
+  const std::string acquire_query_;
+
+  engine::Mutex mutex_;
+  std::deque<Request*> queue_;
+  bool is_working_{false};
+
+  concurrent::BackgroundTaskStorage workers_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,26 @@
+#include <storages/postgres/detail/local_connection_cache.hpp>
+
+#include <userver/compiler/thread_local.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+std::atomic<std::size_t> thread_index_counter{0};
+
+compiler::ThreadLocal local_thread_index = [] {
+  return thread_index_counter.fetch_add(1, std::memory_order_relaxed);
+};
+
+}  // namespace
+
+std::size_t GetLocalCacheThreadIndex() noexcept {
+  auto index = local_thread_index.Use();
+  return *index;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
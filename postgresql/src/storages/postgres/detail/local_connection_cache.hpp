@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Returns a process-wide index of the current thread, stable for the
+/// lifetime of the thread
+std::size_t GetLocalCacheThreadIndex() noexcept;
+
+/// @brief Per-worker-thread cache of idle connections
+///
+/// Each thread has a slot for a single idle connection, so that a
+/// coroutine that releases a connection and then acquires one again on the
+/// same thread gets the same connection without touching any shared
+/// structures. Slots of other threads may be stolen when the local one is
+/// empty. All the operations are wait-free, threads that do not fit into
+/// the configured number of slots share them.
+template <typename ConnectionType>
+class LocalConnectionCache final {
+ public:
+  explicit LocalConnectionCache(std::size_t size)
+      : size_{std::max(size, std::size_t{1})},
+        slots_{std::make_unique<Slot[]>(size_)} {}
+
+  LocalConnectionCache(const LocalConnectionCache&) = delete;
+  LocalConnectionCache& operator=(const LocalConnectionCache&) = delete;
+
+  /// Stores the connection into the slot of the current thread
+  /// @returns false if the slot is occupied
+  bool TryPut(ConnectionType* connection) noexcept {
+    ConnectionType* expected = nullptr;
+    return GetLocalSlot().connection.compare_exchange_strong(expected,
+                                                             connection);
+  }
+
+  /// Takes the connection from the slot of the current thread
+  /// @returns nullptr if the slot is empty
+  ConnectionType* TryTake() noexcept {
+    return GetLocalSlot().connection.exchange(nullptr);
+  }
+
+  /// Takes a connection from any slot, starting with the one of the current
+  /// thread
+  /// @returns nullptr if all the slots are empty
+  ConnectionType* Steal() noexcept {
+    const auto start = GetLocalCacheThreadIndex();
+    for (std::size_t i = 0; i < size_; ++i) {
+      auto& slot = slots_[(start + i) % size_];
+      // Avoid the cache line invalidation of an empty slot
+      if (!slot.connection.load(std::memory_order_relaxed)) continue;
+      if (auto* connection = slot.connection.exchange(nullptr)) {
+        return connection;
+      }
+    }
+    return nullptr;
+  }
+
+ private:
+  static constexpr std::size_t kCacheLineSize = 64;
+
+  struct alignas(kCacheLineSize) Slot final {
+    std::atomic<ConnectionType*> connection{nullptr};
+  };
+
+  Slot& GetLocalSlot() noexcept {
+    return slots_[GetLocalCacheThreadIndex() % size_];
+  }
+
+  const std::size_t size_;
+  std::unique_ptr<Slot[]> slots_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
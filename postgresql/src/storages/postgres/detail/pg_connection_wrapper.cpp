@@ -580,6 +580,101 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
   return result;
 }
 
+void PGConnectionWrapper::WaitCopyStart(Deadline deadline,
+                                        tracing::ScopeTime& scope,
+                                        ExecStatusType copy_status) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+  const auto status =
+      handle ? PQresultStatus(handle.get()) : PGRES_EMPTY_QUERY;
+  if (status == copy_status) return;
+
+  if (status != PGRES_COPY_IN && status != PGRES_COPY_OUT &&
+      status != PGRES_COPY_BOTH) {
+    // The statement failed, the rest of the results is discarded to leave the
+    // connection idle
+    while (auto* pg_res = ReadResult(deadline, nullptr)) {
+      MakeResultHandle(pg_res);
+    }
+  }
+  // Throws the statement error or closes the connection in a wrong COPY mode
+  MakeResult(std::move(handle));
+  throw LogicError{"COPY statement has not started the data transfer"};
+}
+
+void PGConnectionWrapper::PutCopyData(Deadline deadline,
+                                      std::string_view data) {
+  int put_res = 0;
+  // Zero means that the output buffer is full in the nonblocking mode
+  while ((put_res = PQputCopyData(conn_, data.data(), data.size())) == 0) {
+    Flush(deadline);
+  }
+  if (put_res < 0) {
+    HandleSocketPostClose();
+    throw CommandError(PQerrorMessage(conn_));
+  }
+  Flush(deadline);
+  UpdateLastUse();
+}
+
+void PGConnectionWrapper::PutCopyEnd(Deadline deadline,
+                                     const char* error_message) {
+  int put_res = 0;
+  while ((put_res = PQputCopyEnd(conn_, error_message)) == 0) {
+    Flush(deadline);
+  }
+  if (put_res < 0) {
+    HandleSocketPostClose();
+    throw CommandError(PQerrorMessage(conn_));
+  }
+  UpdateLastUse();
+}
+
+std::optional<PGConnectionWrapper::CopyData> PGConnectionWrapper::GetCopyData(
+    Deadline deadline) {
+  CopyData data;
+  switch (WaitCopyData(deadline, data)) {
+    case CopyDataStatus::kData:
+      return data;
+    case CopyDataStatus::kEnd:
+      return std::nullopt;
+    case CopyDataStatus::kTimeout:
+      PGCW_LOG_LIMITED_WARNING()
+          << "Timeout while receiving COPY data from PostgreSQL connection "
+             "socket";
+      throw ConnectionTimeoutError("Timed out while receiving COPY data");
+  }
+  UINVARIANT(false, "Unexpected COPY data status");
+}
+
+PGConnectionWrapper::CopyDataStatus PGConnectionWrapper::WaitCopyData(
+    Deadline deadline, CopyData& data) {
+  char* buffer = nullptr;
+  int get_res = 0;
+  // Zero means that a row is not received yet in the async mode
+  while ((get_res = PQgetCopyData(conn_, &buffer, 1)) == 0) {
+    HandleSocketPostClose();
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while receiving COPY data");
+      }
+      return CopyDataStatus::kTimeout;
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    UpdateLastUse();
+  }
+  if (get_res == -1) return CopyDataStatus::kEnd;
+  if (get_res < 0) {
+    HandleSocketPostClose();
+    throw CommandError(PQerrorMessage(conn_));
+  }
+
+  data.buffer.reset(buffer);
+  data.size = get_res;
+  return CopyDataStatus::kData;
+}
+
 std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
     [[maybe_unused]] Deadline deadline,
     const std::vector<const PGresult*>& descriptions) {
@@ -772,6 +867,14 @@ ResultSet PGConnectionWrapper::MakeResult(ResultHandle&& handle) {
   return ResultSet{wrapper};
 }
 
+void PGConnectionWrapper::SendSimpleQuery(const std::string& statement,
+                                          tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqSendQuery);
+  CheckError<CommandError>("PQsendQuery",
+                           PQsendQuery(conn_, statement.c_str()));
+  UpdateLastUse();
+}
+
 void PGConnectionWrapper::SendQuery(const std::string& statement,
                                     tracing::ScopeTime& scope) {
   scope.Reset(scopes::kLibpqSendQueryParams);
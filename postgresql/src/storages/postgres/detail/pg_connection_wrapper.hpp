@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
+#include <optional>
 #include <string_view>
 
 #include <libpq-fe.h>
@@ -114,6 +116,40 @@ class PGConnectionWrapper {
   /// @brief Wait for notification
   Notification WaitNotify(Deadline deadline);
 
+  /// @brief Wrapper for PQsendQuery
+  /// Uses the simple query protocol, the only one accepted for the
+  /// replication commands
+  void SendSimpleQuery(const std::string& statement, tracing::ScopeTime&);
+
+  /// @brief Wait for a COPY statement to start the data transfer
+  /// Will throw an exception if the statement failed
+  void WaitCopyStart(Deadline deadline, tracing::ScopeTime&,
+                     ExecStatusType copy_status);
+
+  /// @brief Wrapper for PQputCopyData
+  void PutCopyData(Deadline deadline, std::string_view data);
+
+  /// @brief Wrapper for PQputCopyEnd, the COPY statement is failed with the
+  /// error message if one is passed
+  /// The result of the statement is then read with WaitResult
+  void PutCopyEnd(Deadline deadline, const char* error_message = nullptr);
+
+  struct CopyData {
+    std::unique_ptr<char, decltype(&PQfreemem)> buffer{nullptr, &PQfreemem};
+    std::size_t size{0};
+  };
+
+  /// @brief Wrapper for PQgetCopyData
+  /// Returns std::nullopt after the last row, the result of the statement is
+  /// then read with WaitResult
+  std::optional<CopyData> GetCopyData(Deadline deadline);
+
+  enum class CopyDataStatus { kData, kEnd, kTimeout };
+
+  /// @brief Same as GetCopyData, but does not throw on the deadline, e.g. for
+  /// the streams that send the keepalive messages between the data
+  CopyDataStatus WaitCopyData(Deadline deadline, CopyData& data);
+
   std::vector<ResultSet> GatherPipeline(
       Deadline deadline, const std::vector<const PGresult*>& descriptions);
 
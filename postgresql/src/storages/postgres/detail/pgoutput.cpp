@@ -0,0 +1,256 @@
+#include <storages/postgres/detail/pgoutput.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::pgoutput {
+
+namespace {
+
+// PostgreSQL epoch is 2000-01-01 00:00:00 UTC
+constexpr std::chrono::seconds kPostgresEpochOffset{946684800};
+
+constexpr char kColumnKeyFlag = 1;
+
+void AppendBigEndian(std::string& buffer, std::uint64_t value) {
+  for (int shift = 56; shift >= 0; shift -= 8) {
+    buffer.push_back(static_cast<char>((value >> shift) & 0xFF));
+  }
+}
+
+ReplicationTuple ReadTuple(MessageReader& reader,
+                           const ReplicationRelation& relation) {
+  const auto size = reader.ReadInt16();
+  if (size < 0 || static_cast<std::size_t>(size) != relation.columns.size()) {
+    throw ReplicationProtocolError(
+        fmt::format("Tuple of {} columns for the relation '{}.{}' of {}", size,
+                    relation.schema, relation.name, relation.columns.size()));
+  }
+
+  std::vector<ReplicationTuple::Value> values(size);
+  for (auto& value : values) {
+    value.kind = static_cast<ReplicationTuple::ValueKind>(reader.ReadByte());
+    switch (value.kind) {
+      case ReplicationTuple::ValueKind::kNull:
+      case ReplicationTuple::ValueKind::kUnchanged:
+        break;
+      case ReplicationTuple::ValueKind::kText:
+      case ReplicationTuple::ValueKind::kBinary: {
+        const auto length = reader.ReadInt32();
+        if (length < 0) {
+          throw ReplicationProtocolError("Negative tuple value length");
+        }
+        value.data = reader.ReadBytes(length);
+        break;
+      }
+      default:
+        throw ReplicationProtocolError(
+            fmt::format("Unknown tuple value kind '{}'",
+                        static_cast<char>(value.kind)));
+    }
+  }
+  return ReplicationTuple{relation, std::move(values)};
+}
+
+}  // namespace
+
+char MessageReader::ReadByte() { return static_cast<char>(ReadBigEndian(1)); }
+
+std::int16_t MessageReader::ReadInt16() {
+  return static_cast<std::int16_t>(ReadBigEndian(2));
+}
+
+std::int32_t MessageReader::ReadInt32() {
+  return static_cast<std::int32_t>(ReadBigEndian(4));
+}
+
+std::int64_t MessageReader::ReadInt64() {
+  return static_cast<std::int64_t>(ReadBigEndian(8));
+}
+
+std::string_view MessageReader::ReadString() {
+  const auto end = data_.find('\0');
+  if (end == std::string_view::npos) {
+    throw ReplicationProtocolError("Unterminated string in a message");
+  }
+  const auto result = data_.substr(0, end);
+  data_.remove_prefix(end + 1);
+  return result;
+}
+
+std::string_view MessageReader::ReadBytes(std::size_t size) {
+  if (data_.size() < size) {
+    throw ReplicationProtocolError(
+        fmt::format("Message is truncated, {} bytes expected, {} left", size,
+                    data_.size()));
+  }
+  const auto result = data_.substr(0, size);
+  data_.remove_prefix(size);
+  return result;
+}
+
+std::string_view MessageReader::ReadRest() { return ReadBytes(data_.size()); }
+
+std::uint64_t MessageReader::ReadBigEndian(std::size_t size) {
+  std::uint64_t result = 0;
+  for (const char byte : ReadBytes(size)) {
+    result = (result << 8) | static_cast<unsigned char>(byte);
+  }
+  return result;
+}
+
+std::string FormatLsn(ReplicationLsn lsn) {
+  return fmt::format("{:X}/{:X}", lsn >> 32, lsn & 0xFFFFFFFF);
+}
+
+std::string MakeStatusUpdate(ReplicationLsn received, ReplicationLsn flushed,
+                             std::chrono::system_clock::time_point time,
+                             bool reply_requested) {
+  const auto pg_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      time.time_since_epoch() - kPostgresEpochOffset);
+
+  std::string message;
+  message.reserve(1 + 8 * 4 + 1);
+  message.push_back('r');
+  AppendBigEndian(message, received);
+  AppendBigEndian(message, flushed);
+  // Applied position, the changes are applied as soon as they are flushed
+  AppendBigEndian(message, flushed);
+  AppendBigEndian(message, pg_time.count());
+  message.push_back(reply_requested ? 1 : 0);
+  return message;
+}
+
+void Decoder::Decode(std::string_view message) {
+  MessageReader reader{message};
+  const auto type = reader.ReadByte();
+  switch (type) {
+    case 'B':
+      DecodeBegin(reader);
+      break;
+    case 'C':
+      DecodeCommit(reader);
+      break;
+    case 'R':
+      DecodeRelation(reader);
+      break;
+    case 'I':
+      DecodeInsert(reader);
+      break;
+    case 'U':
+      DecodeUpdate(reader);
+      break;
+    case 'D':
+      DecodeDelete(reader);
+      break;
+    case 'T':
+      DecodeTruncate(reader);
+      break;
+    // Origin, Type and logical decoding Message carry nothing to apply
+    case 'O':
+    case 'Y':
+    case 'M':
+      break;
+    default:
+      throw ReplicationProtocolError(
+          fmt::format("Unknown pgoutput message type '{}'", type));
+  }
+}
+
+void Decoder::DecodeBegin(MessageReader& reader) {
+  const auto final_lsn = static_cast<ReplicationLsn>(reader.ReadInt64());
+  in_transaction_ = true;
+  handler_.OnBegin(final_lsn);
+}
+
+void Decoder::DecodeCommit(MessageReader& reader) {
+  reader.ReadByte();  // flags
+  reader.ReadInt64();  // commit LSN
+  const auto end_lsn = static_cast<ReplicationLsn>(reader.ReadInt64());
+  handler_.OnCommit(end_lsn);
+  in_transaction_ = false;
+  committed_lsn_ = end_lsn;
+}
+
+void Decoder::DecodeRelation(MessageReader& reader) {
+  ReplicationRelation relation;
+  relation.oid = reader.ReadInt32();
+  relation.schema = reader.ReadString();
+  relation.name = reader.ReadString();
+  reader.ReadByte();  // replica identity
+  const auto columns = reader.ReadInt16();
+  relation.columns.reserve(std::max<std::int16_t>(columns, 0));
+  for (std::int16_t i = 0; i < columns; ++i) {
+    ReplicationColumn column;
+    column.is_key = reader.ReadByte() & kColumnKeyFlag;
+    column.name = reader.ReadString();
+    column.type_oid = reader.ReadInt32();
+    reader.ReadInt32();  // type modifier
+    relation.columns.push_back(std::move(column));
+  }
+
+  // A table may be described again after ALTER TABLE
+  const auto oid = relation.oid;
+  relations_.insert_or_assign(oid, std::move(relation));
+}
+
+void Decoder::DecodeInsert(MessageReader& reader) {
+  const auto& relation = GetRelation(reader.ReadInt32());
+  if (reader.ReadByte() != 'N') {
+    throw ReplicationProtocolError("Insert message without a new tuple");
+  }
+  handler_.OnInsert(relation, ReadTuple(reader, relation));
+}
+
+void Decoder::DecodeUpdate(MessageReader& reader) {
+  const auto& relation = GetRelation(reader.ReadInt32());
+  auto tuple_type = reader.ReadByte();
+  std::optional<ReplicationTuple> old_tuple;
+  if (tuple_type == 'K' || tuple_type == 'O') {
+    old_tuple.emplace(ReadTuple(reader, relation));
+    tuple_type = reader.ReadByte();
+  }
+  if (tuple_type != 'N') {
+    throw ReplicationProtocolError("Update message without a new tuple");
+  }
+  const auto new_tuple = ReadTuple(reader, relation);
+  handler_.OnUpdate(relation, old_tuple ? &*old_tuple : nullptr, new_tuple);
+}
+
+void Decoder::DecodeDelete(MessageReader& reader) {
+  const auto& relation = GetRelation(reader.ReadInt32());
+  const auto tuple_type = reader.ReadByte();
+  if (tuple_type != 'K' && tuple_type != 'O') {
+    throw ReplicationProtocolError("Delete message without an old tuple");
+  }
+  handler_.OnDelete(relation, ReadTuple(reader, relation));
+}
+
+void Decoder::DecodeTruncate(MessageReader& reader) {
+  const auto count = reader.ReadInt32();
+  reader.ReadByte();  // options
+  std::vector<const ReplicationRelation*> relations;
+  relations.reserve(std::max(count, 0));
+  for (std::int32_t i = 0; i < count; ++i) {
+    relations.push_back(&GetRelation(reader.ReadInt32()));
+  }
+  handler_.OnTruncate(relations);
+}
+
+const ReplicationRelation& Decoder::GetRelation(Oid oid) const {
+  const auto it = relations_.find(oid);
+  if (it == relations_.end()) {
+    throw ReplicationProtocolError(
+        fmt::format("Change of the relation {} that was not described", oid));
+  }
+  return it->second;
+}
+
+}  // namespace storages::postgres::detail::pgoutput
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/storages/postgres/logical_replication.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::pgoutput {
+
+/// Reads the big-endian fields of the replication protocol messages
+/// @throws ReplicationProtocolError if the message is too short
+class MessageReader final {
+ public:
+  explicit MessageReader(std::string_view data) : data_{data} {}
+
+  char ReadByte();
+  std::int16_t ReadInt16();
+  std::int32_t ReadInt32();
+  std::int64_t ReadInt64();
+  /// Reads a null-terminated string
+  std::string_view ReadString();
+  std::string_view ReadBytes(std::size_t size);
+  std::string_view ReadRest();
+
+  bool IsEnd() const { return data_.empty(); }
+
+ private:
+  std::uint64_t ReadBigEndian(std::size_t size);
+
+  std::string_view data_;
+};
+
+/// Formats the LSN as `XXX/XXX` for the replication commands
+std::string FormatLsn(ReplicationLsn lsn);
+
+/// Standby status update message of the streaming replication protocol, the
+/// `time` is the client clock
+std::string MakeStatusUpdate(ReplicationLsn received, ReplicationLsn flushed,
+                             std::chrono::system_clock::time_point time,
+                             bool reply_requested);
+
+/// Decodes the messages of the `pgoutput` plugin, protocol version 1, and
+/// calls the handler for the changes
+class Decoder final {
+ public:
+  explicit Decoder(LogicalReplicationHandler& handler) : handler_{handler} {}
+
+  /// @throws ReplicationProtocolError on malformed messages or changes of the
+  /// tables that were not described
+  void Decode(std::string_view message);
+
+  /// True between the `Begin` and `Commit` messages
+  bool IsInTransaction() const { return in_transaction_; }
+
+  /// End position of the last transaction the handler has committed
+  ReplicationLsn GetCommittedLsn() const { return committed_lsn_; }
+
+ private:
+  void DecodeBegin(MessageReader& reader);
+  void DecodeCommit(MessageReader& reader);
+  void DecodeRelation(MessageReader& reader);
+  void DecodeInsert(MessageReader& reader);
+  void DecodeUpdate(MessageReader& reader);
+  void DecodeDelete(MessageReader& reader);
+  void DecodeTruncate(MessageReader& reader);
+
+  const ReplicationRelation& GetRelation(Oid oid) const;
+
+  LogicalReplicationHandler& handler_;
+  std::unordered_map<Oid, ReplicationRelation> relations_;
+  bool in_transaction_{false};
+  ReplicationLsn committed_lsn_{0};
+};
+
+}  // namespace storages::postgres::detail::pgoutput
+
+USERVER_NAMESPACE_END
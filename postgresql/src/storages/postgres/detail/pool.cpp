@@ -1,8 +1,13 @@
 #include <storages/postgres/detail/pool.hpp>
 
+#include <algorithm>
+#include <thread>
+
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/cc_config.hpp>
+#include <storages/postgres/detail/pg_connection_wrapper.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
+#include <storages/postgres/detail/tracing_tags.hpp>
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
@@ -45,6 +50,9 @@ constexpr auto kIdleDropLimit = 1;
 // Practically unlimited number on concurrent establishing connections
 constexpr auto kUnlimitedConnecting = std::numeric_limits<std::size_t>::max();
 
+// Weight of a new sample in the statement latency moving average is 1/8
+constexpr std::int64_t kLatencyEwmaFactor = 8;
+
 class Stopwatch {
  public:
   using Accumulator = USERVER_NAMESPACE::utils::statistics::RecentPeriod<
@@ -90,6 +98,8 @@ ConnectionPool::ConnectionPool(
       conn_settings_{conn_settings},
       bg_task_processor_{bg_task_processor},
       queue_{settings.max_size},
+      local_cache_{std::min(settings.max_size,
+                            std::size_t{std::thread::hardware_concurrency()})},
       size_semaphore_{settings.max_size},
       connecting_semaphore_{settings.connecting_limit
                                 ? settings.connecting_limit
@@ -101,6 +111,7 @@ ConnectionPool::ConnectionPool(
       cancel_limit_{std::max(std::size_t{1}, settings.max_size / kCancelRatio),
                     {1, kCancelPeriod}},
       sts_{statement_metrics_settings},
+      prepared_registry_{conn_settings.max_prepared_cache_size},
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
@@ -240,6 +251,23 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
   stats_.transaction.execute_timeout += conn_stats.execute_timeout;
   stats_.transaction.duplicate_prepared_statements +=
       conn_stats.duplicate_prepared_statements;
+  stats_.transaction.prepared_cache_hits += conn_stats.prepared_cache_hits;
+  stats_.transaction.prepared_cache_misses += conn_stats.prepared_cache_misses;
+  stats_.transaction.prepared_cache_evictions +=
+      conn_stats.prepared_cache_evictions;
+
+  if (conn_stats.execute_total > 0) {
+    const std::int64_t latency =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            conn_stats.sum_query_duration)
+            .count() /
+        conn_stats.execute_total;
+    // Concurrent updates may lose a sample, that's fine for an estimate
+    const std::int64_t estimate = stats_.latency_estimate_us.Load();
+    stats_.latency_estimate_us = static_cast<std::uint32_t>(
+        estimate == 0 ? latency
+                      : estimate + (latency - estimate) / kLatencyEwmaFactor);
+  }
 
   stats_.transaction.total_percentile.GetCurrentCounter().Account(
       std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -336,6 +364,20 @@ NotifyScope ConnectionPool::Listen(std::string_view channel,
   return NotifyScope{std::move(conn), channel, cmd_ctl};
 }
 
+std::unique_ptr<PGConnectionWrapper> ConnectionPool::ConnectReplication(
+    engine::Deadline deadline) {
+  auto dsn = resolver_ ? ResolveDsnHostaddrs(dsn_, *resolver_, deadline) : dsn_;
+  dsn = DsnWithOption(dsn, "replication", "database");
+
+  tracing::Span span{scopes::kConnect};
+  auto scope = span.CreateScopeTime();
+  auto conn = std::make_unique<PGConnectionWrapper>(
+      bg_task_processor_, close_task_storage_, ++stats_.connection.open_total,
+      engine::SemaphoreLock{});
+  conn->AsyncConnect(dsn, deadline, scope);
+  return conn;
+}
+
 TimeoutDuration ConnectionPool::GetExecuteTimeout(
     OptionalCommandControl cmd_ctl) const {
   if (cmd_ctl) return cmd_ctl->execute;
@@ -375,6 +417,7 @@ void ConnectionPool::SetConnectionSettings(const ConnectionSettings& settings) {
     const auto old_settings = *writer;
     const auto old_version = old_settings.version;
     *writer = settings;
+    prepared_registry_.SetMaxSize(settings.max_prepared_cache_size);
     if (old_settings.RequiresConnectionReset(settings)) {
       writer->version = old_version + 1;
     }
@@ -391,6 +434,19 @@ void ConnectionPool::SetMaxConnectionsCc(std::size_t max_connections) {
   cc_max_connections_ = max_connections;
 }
 
+std::chrono::microseconds ConnectionPool::GetLatencyEstimate() const {
+  return std::chrono::microseconds{stats_.latency_estimate_us.Load()};
+}
+
+std::size_t ConnectionPool::GetLoad() const {
+  return stats_.connection.used.Load() +
+         wait_count_.load(std::memory_order_relaxed);
+}
+
+void ConnectionPool::CountLeastLoadedSelection() {
+  ++stats_.least_loaded_selections;
+}
+
 dynamic_config::Source ConnectionPool::GetConfigSource() const {
   return config_source_;
 }
@@ -423,7 +479,7 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock) {
     connection = Connection::Connect(
         dsn_, resolver_, bg_task_processor_, close_task_storage_, conn_id,
         *conn_settings, default_cmd_ctls_, testsuite_pg_ctl_, ei_settings_,
-        std::move(size_lock));
+        std::move(size_lock), &prepared_registry_);
   } catch (const ConnectionTimeoutError&) {
     // No problem if it's connection error
     ++stats_.connection.error_timeout;
@@ -498,6 +554,16 @@ void ConnectionPool::Push(Connection* connection) {
     return;
   }
 
+  // Keep the connection on the current thread for the next checkout, unless
+  // somebody is already waiting for it
+  if (wait_count_.load() == 0 && local_cache_.TryPut(connection)) {
+    // A waiter could have missed the connection, it is not notified about
+    // the cached ones
+    if (wait_count_.load() == 0) return;
+    connection = local_cache_.TryTake();
+    if (!connection) return;
+  }
+
   if (queue_.push(connection)) {
     conn_available_.NotifyOne();
   } else {
@@ -517,19 +583,8 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
     throw PoolError("Deadline reached before trying to get a connection");
   }
   Stopwatch st{stats_.acquire_percentile};
-  Connection* connection = nullptr;
-  auto conn_settings = conn_settings_.Read();
-  while (queue_.pop(connection)) {
-    if (connection->GetSettings().version < conn_settings->version) {
-      DropOutdatedConnection(connection);
-      continue;
-    }
-    if (connection->IsExpired()) {
-      DropExpiredConnection(connection);
-      continue;
-    }
-    return connection;
-  }
+  Connection* connection = PopIdle();
+  if (connection) return connection;
 
   auto settings = settings_.Read();
   SizeGuard wg(wait_count_);
@@ -546,8 +601,10 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
   {
     std::unique_lock<engine::Mutex> lock{wait_mutex_};
     // Wait for a connection
-    if (conn_available_.WaitUntil(lock, deadline,
-                                  [&] { return queue_.pop(connection); })) {
+    if (conn_available_.WaitUntil(lock, deadline, [&] {
+          return queue_.pop(connection) ||
+                 (connection = local_cache_.Steal()) != nullptr;
+        })) {
       return connection;
     }
   }
@@ -567,11 +624,41 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
       db_name_);
 }
 
+Connection* ConnectionPool::PopIdle() {
+  auto conn_settings = conn_settings_.Read();
+  const auto is_usable = [this, &conn_settings](Connection* connection) {
+    if (connection->GetSettings().version < conn_settings->version) {
+      DropOutdatedConnection(connection);
+      return false;
+    }
+    if (connection->IsExpired()) {
+      DropExpiredConnection(connection);
+      return false;
+    }
+    return true;
+  };
+
+  // The connection released on this thread is the hottest one
+  Connection* connection = local_cache_.TryTake();
+  if (connection && is_usable(connection)) return connection;
+
+  while (queue_.pop(connection)) {
+    if (is_usable(connection)) return connection;
+  }
+  while ((connection = local_cache_.Steal())) {
+    if (is_usable(connection)) return connection;
+  }
+  return nullptr;
+}
+
 void ConnectionPool::Clear() {
   Connection* connection = nullptr;
   while (queue_.pop(connection)) {
     delete connection;
   }
+  while ((connection = local_cache_.Steal())) {
+    delete connection;
+  }
   close_task_storage_.CancelAndWait();
 }
 
@@ -635,17 +722,7 @@ void ConnectionPool::DropOutdatedConnection(Connection* connection) {
 }
 
 Connection* ConnectionPool::AcquireImmediate() {
-  Connection* conn = nullptr;
-  auto conn_settings = conn_settings_.Read();
-  while (queue_.pop(conn)) {
-    if (conn->GetSettings().version < conn_settings->version) {
-      DropOutdatedConnection(conn);
-      continue;
-    }
-    if (conn->IsExpired()) {
-      DropExpiredConnection(conn);
-      continue;
-    }
+  if (auto* conn = PopIdle()) {
     ++stats_.connection.used;
     return conn;
   }
@@ -31,7 +31,9 @@
 #include <userver/storages/postgres/transaction.hpp>
 
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/local_connection_cache.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <storages/postgres/detail/size_guard.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 
@@ -39,6 +41,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::detail {
 
+class PGConnectionWrapper;
+
 class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   class EmplaceEnabler;
 
@@ -80,6 +84,10 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   NotifyScope Listen(std::string_view channel,
                      OptionalCommandControl cmd_ctl = {});
 
+  /// Connects to the host in the logical replication mode. The connection is
+  /// not a part of the pool and accepts only the simple query protocol.
+  std::unique_ptr<PGConnectionWrapper> ConnectReplication(engine::Deadline);
+
   CommandControl GetDefaultCommandControl() const;
 
   void SetSettings(const PoolSettings& settings);
@@ -94,6 +102,14 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   void SetMaxConnectionsCc(std::size_t max_connections);
 
+  /// Moving average of statement execution time, zero if nothing is executed
+  std::chrono::microseconds GetLatencyEstimate() const;
+
+  /// Number of the acquired connections and the requests waiting for them
+  std::size_t GetLoad() const;
+
+  void CountLeastLoadedSelection();
+
   dynamic_config::Source GetConfigSource() const;
 
  private:
@@ -111,6 +127,7 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   void Push(Connection* connection);
   Connection* Pop(engine::Deadline);
+  Connection* PopIdle();
 
   void Clear();
 
@@ -146,6 +163,7 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   engine::Mutex wait_mutex_;
   engine::ConditionVariable conn_available_;
   boost::lockfree::queue<Connection*> queue_;
+  LocalConnectionCache<Connection> local_cache_;
   engine::Semaphore size_semaphore_;
   engine::Semaphore connecting_semaphore_;
   std::atomic<size_t> wait_count_;
@@ -155,6 +173,7 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   RecentCounter recent_conn_errors_;
   USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
   detail::StatementStatsStorage sts_;
+  detail::PreparedStatementsRegistry prepared_registry_;
   dynamic_config::Source config_source_;
 
   // Congestion control stuff
@@ -0,0 +1,82 @@
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+PreparedStatementsRegistry::PreparedStatementsRegistry(std::size_t max_size)
+    : statements_{std::max(max_size, std::size_t{1})} {}
+
+void PreparedStatementsRegistry::Account(std::size_t statement_hash,
+                                         const std::string& statement,
+                                         const QueryParameters& params,
+                                         std::size_t uses) {
+  auto storage = statements_.Lock();
+  DoAccount(*storage, statement_hash, statement, params, uses);
+}
+
+bool PreparedStatementsRegistry::TryAccount(std::size_t statement_hash,
+                                            const std::string& statement,
+                                            const QueryParameters& params,
+                                            std::size_t uses) {
+  auto storage = statements_.UniqueLock(std::try_to_lock);
+  if (!storage) return false;
+  DoAccount(**storage, statement_hash, statement, params, uses);
+  return true;
+}
+
+std::vector<PreparedStatementsRegistry::Statement>
+PreparedStatementsRegistry::GetMostUsed(std::size_t count) const {
+  std::vector<Statement> result;
+  if (count == 0) return result;
+  {
+    const auto storage = statements_.Lock();
+    result.reserve(storage->GetSize());
+    storage->VisitAll([&result](std::size_t, const Statement& statement) {
+      result.push_back(statement);
+    });
+  }
+
+  const auto by_uses = [](const Statement& lhs, const Statement& rhs) {
+    return lhs.uses > rhs.uses;
+  };
+  if (result.size() > count) {
+    std::partial_sort(result.begin(), result.begin() + count, result.end(),
+                      by_uses);
+    result.resize(count);
+  } else {
+    std::sort(result.begin(), result.end(), by_uses);
+  }
+  return result;
+}
+
+void PreparedStatementsRegistry::SetMaxSize(std::size_t max_size) {
+  auto storage = statements_.Lock();
+  storage->SetMaxSize(std::max(max_size, std::size_t{1}));
+}
+
+void PreparedStatementsRegistry::DoAccount(Storage& storage,
+                                           std::size_t statement_hash,
+                                           const std::string& statement,
+                                           const QueryParameters& params,
+                                           std::size_t uses) {
+  if (auto* stored = storage.Get(statement_hash)) {
+    stored->uses += uses;
+    return;
+  }
+
+  const auto* types = params.ParamTypesBuffer();
+  storage.Put(statement_hash,
+              Statement{statement,
+                        params.Empty() ? std::vector<Oid>{}
+                                       : std::vector<Oid>(
+                                             types, types + params.Size()),
+                        uses});
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// @brief Pool-wide registry of the prepared statements usage
+///
+/// Connections report the statements they prepare and execute, and a fresh
+/// connection prepares the most used ones before serving any queries, so that
+/// a pool resize or a failover doesn't cause a latency spike of re-preparing.
+/// The registry is limited in size and evicts the least recently used
+/// statements.
+class PreparedStatementsRegistry final {
+ public:
+  /// Uses of the statements are accumulated by connections and are reported
+  /// in batches of this size to reduce the contention on the registry
+  static constexpr std::size_t kUsesBatchSize = 16;
+
+  struct Statement final {
+    std::string statement;
+    std::vector<Oid> param_types;
+    std::size_t uses{0};
+  };
+
+  explicit PreparedStatementsRegistry(std::size_t max_size);
+
+  /// Accounts the uses of the statement, waits for the registry lock
+  void Account(std::size_t statement_hash, const std::string& statement,
+               const QueryParameters& params, std::size_t uses);
+
+  /// Accounts the uses of the statement if the registry is not locked by
+  /// another connection
+  /// @returns true if the uses are accounted
+  bool TryAccount(std::size_t statement_hash, const std::string& statement,
+                  const QueryParameters& params, std::size_t uses);
+
+  /// Returns at most `count` most used statements, the most used first
+  std::vector<Statement> GetMostUsed(std::size_t count) const;
+
+  void SetMaxSize(std::size_t max_size);
+
+ private:
+  using Storage = cache::LruMap<std::size_t, Statement>;
+
+  static void DoAccount(Storage& storage, std::size_t statement_hash,
+                        const std::string& statement,
+                        const QueryParameters& params, std::size_t uses);
+
+  concurrent::Variable<Storage> statements_;
+};
+
+/// Parameters holder with types only, for preparing statements
+class ParamTypesHolder final {
+ public:
+  explicit ParamTypesHolder(const std::vector<Oid>& types) : types_(types) {}
+
+  std::size_t Size() const { return types_.size(); }
+  const char* const* ParamBuffers() const { return nullptr; }
+  const Oid* ParamTypesBuffer() const { return types_.data(); }
+  const int* ParamLengthsBuffer() const { return nullptr; }
+  const int* ParamFormatsBuffer() const { return nullptr; }
+
+ private:
+  const std::vector<Oid>& types_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,222 @@
+#include <storages/postgres/detail/query_multiplexer.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <fmt/format.h>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+struct QueryMultiplexer::Request final {
+  Request(CommandControl cc, const Query& query, const ParameterStore& store)
+      : cc(cc), query(query), params(store.GetInternalData()) {}
+
+  const CommandControl cc;
+  const Query& query;
+  const QueryParameters params;
+  engine::Promise<ResultSet> promise;
+};
+
+struct QueryMultiplexer::BatchItem final {
+  void SetValue(ResultSet&& result) {
+    UASSERT(!is_set);
+    is_set = true;
+    promise.set_value(std::move(result));
+  }
+
+  void SetException(std::exception_ptr exception) {
+    if (is_set) return;
+    is_set = true;
+    promise.set_exception(std::move(exception));
+  }
+
+  // The request may be destroyed as soon as the promise is set
+  const Request* request;
+  engine::Promise<ResultSet> promise;
+  bool is_set{false};
+};
+
+QueryMultiplexer::QueryMultiplexer(std::shared_ptr<ConnectionPool> pool,
+                                   const MultiplexingSettings& settings)
+    : pool_(std::move(pool)), settings_(settings) {
+  UINVARIANT(settings_.connections > 0 && settings_.max_batch_size > 0,
+             "Multiplexing requires at least one connection and a non-empty "
+             "batch size");
+}
+
+QueryMultiplexer::~QueryMultiplexer() { workers_.CancelAndWait(); }
+
+ResultSet QueryMultiplexer::Execute(CommandControl cc, const Query& query,
+                                    const ParameterStore& store) {
+  Request request{cc, query, store};
+  auto future = request.promise.get_future();
+  Enqueue(request);
+
+  const auto status =
+      future.wait_until(engine::Deadline::FromDuration(cc.execute));
+  if (status != engine::FutureStatus::kReady && TryRemove(request)) {
+    if (status == engine::FutureStatus::kCancelled) {
+      throw ConnectionInterrupted(
+          "Task cancelled while waiting for a multiplexed statement");
+    }
+    throw ConnectionTimeoutError(
+        "Timed out while waiting for a multiplexed statement to be sent");
+  }
+
+  // The statement is already taken by a worker, which reads the request until
+  // the result is ready. The worker is bounded by the statement deadlines.
+  const engine::TaskCancellationBlocker cancellation_blocker;
+  return future.get();
+}
+
+void QueryMultiplexer::Enqueue(Request& request) {
+  {
+    const std::lock_guard lock{mutex_};
+    queue_.push_back(&request);
+    if (active_workers_ >= settings_.connections) return;
+    ++active_workers_;
+  }
+  // Critical: a worker that never starts would never release its slot
+  workers_.CriticalAsyncDetach("pg_multiplexer_worker", [this] { Work(); });
+}
+
+bool QueryMultiplexer::TryRemove(Request& request) {
+  const std::lock_guard lock{mutex_};
+  const auto it = std::find(queue_.begin(), queue_.end(), &request);
+  if (it == queue_.end()) return false;
+  queue_.erase(it);
+  return true;
+}
+
+bool QueryMultiplexer::TakeBatch(Batch& batch) {
+  UASSERT(batch.empty());
+  const std::lock_guard lock{mutex_};
+  if (queue_.empty()) {
+    --active_workers_;
+    return false;
+  }
+  while (!queue_.empty() && batch.size() < settings_.max_batch_size) {
+    auto* request = queue_.front();
+    queue_.pop_front();
+    batch.push_back(BatchItem{request, std::move(request->promise)});
+  }
+  return true;
+}
+
+void QueryMultiplexer::Work() {
+  std::optional<ConnectionPtr> conn;
+  const auto acquire = [this, &conn](const Batch& batch) {
+    conn.reset();
+    conn.emplace(pool_->Acquire(
+        engine::Deadline::FromDuration(batch.front().request->cc.execute)));
+  };
+
+  Batch batch;
+  while (TakeBatch(batch)) {
+    try {
+      if (!conn || (*conn)->IsBroken()) acquire(batch);
+
+      (*conn)->Start(SteadyClock::now());
+      const USERVER_NAMESPACE::utils::ScopeGuard finish_guard{[&conn] {
+        if (conn) (*conn)->Finish();
+      }};
+
+      if (!RunPipelined(**conn, batch)) {
+        // The connection is left in the middle of an aborted pipeline, the
+        // pool will clean it up
+        (*conn)->Finish();
+        acquire(batch);
+        (*conn)->Start(SteadyClock::now());
+        RunOneByOne(**conn, batch);
+      }
+    } catch (const std::exception&) {
+      const auto exception = std::current_exception();
+      for (auto& item : batch) item.SetException(exception);
+    }
+    batch.clear();
+  }
+}
+
+bool QueryMultiplexer::RunPipelined(Connection& conn, Batch& batch) {
+  if (batch.size() == 1 || !conn.IsPipelineActive() ||
+      !conn.ArePreparedStatementsEnabled()) {
+    RunOneByOne(conn, batch);
+    return true;
+  }
+
+  tracing::Span span{"pg_multiplexed_batch"};
+  span.AddTag("batch_size", batch.size());
+  auto scope = span.CreateScopeTime();
+
+  std::vector<std::string> statement_names;
+  std::vector<ResultSet> descriptions;
+  statement_names.reserve(batch.size());
+  descriptions.reserve(batch.size());
+  TimeoutDuration timeout{0};
+
+  try {
+    for (const auto& item : batch) {
+      const auto& request = *item.request;
+      auto meta = conn.PrepareStatement(request.query, request.params,
+                                        request.cc.execute);
+      statement_names.push_back(std::move(meta.statement_name));
+      descriptions.push_back(std::move(meta.description));
+      timeout = std::max(timeout, request.cc.execute);
+    }
+
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+      const auto& request = *batch[i].request;
+      conn.AddIntoPipeline(request.cc, statement_names[i], request.params,
+                           descriptions[i], scope);
+    }
+
+    auto results = conn.GatherPipeline(timeout, descriptions);
+    if (results.size() != batch.size()) {
+      throw RuntimeError{fmt::format(
+          "Multiplexed batch results count mismatch: expected {}, got {}",
+          batch.size(), results.size())};
+    }
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+      batch[i].SetValue(std::move(results[i]));
+    }
+    return true;
+  } catch (const ConnectionError&) {
+    // The statements of the batch would fail in the same way
+    throw;
+  } catch (const std::exception& ex) {
+    // A failed statement aborts the rest of the pipeline, so the statements
+    // are retried separately to deliver each its own result or error
+    LOG_LIMITED_WARNING() << "Multiplexed batch of " << batch.size()
+                          << " statements failed, executing them one by one: "
+                          << ex;
+    return false;
+  }
+}
+
+void QueryMultiplexer::RunOneByOne(Connection& conn, Batch& batch) {
+  for (auto& item : batch) {
+    if (item.is_set) continue;
+    const auto& request = *item.request;
+    try {
+      item.SetValue(conn.Execute(request.query, request.params,
+                                 OptionalCommandControl{request.cc}));
+    } catch (const std::exception&) {
+      item.SetException(std::current_exception());
+    }
+  }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class ConnectionPool;
+
+/// Batches single statements from concurrent coroutines into pipelines over a
+/// few connections of a pool, see MultiplexingSettings.
+class QueryMultiplexer final {
+ public:
+  QueryMultiplexer(std::shared_ptr<ConnectionPool> pool,
+                   const MultiplexingSettings& settings);
+  ~QueryMultiplexer();
+
+  ResultSet Execute(CommandControl cc, const Query& query,
+                    const ParameterStore& store);
+
+ private:
+  struct Request;
+  struct BatchItem;
+
+  using Batch = std::vector<BatchItem>;
+
+  void Enqueue(Request& request);
+  bool TryRemove(Request& request);
+  bool TakeBatch(Batch& batch);
+
+  void Work();
+  // Returns false if the statements of the batch must be retried one by one
+  bool RunPipelined(Connection& conn, Batch& batch);
+  void RunOneByOne(Connection& conn, Batch& batch);
+
+  const std::shared_ptr<ConnectionPool> pool_;
+  const MultiplexingSettings settings_;
+
+  engine::Mutex mutex_;
+  std::deque<Request*> queue_;
+  std::size_t active_workers_{0};
+
+  concurrent::BackgroundTaskStorage workers_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/internal_pg_types.hpp>
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -26,6 +28,8 @@ class TopologyBase {
   using DsnIndices = std::vector<DsnIndex>;
   using DsnIndicesByType =
       std::unordered_map<ClusterHostType, DsnIndices, ClusterHostTypeHash>;
+  using Roundtrips = std::vector<std::chrono::microseconds>;
+  using WalLsns = std::vector<Lsn>;
 
   TopologyBase(engine::TaskProcessor& bg_task_processor, DsnList dsns,
                clients::dns::Resolver* resolver,
@@ -48,6 +52,13 @@ class TopologyBase {
   /// Currently accessible hosts
   virtual rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const = 0;
 
+  /// Last measured roundtrip times in DsnList order, negative if unknown
+  virtual rcu::ReadablePtr<Roundtrips> GetRoundtripTimes() const = 0;
+
+  /// Last known WAL positions in DsnList order: current for the master,
+  /// replayed for slaves, kUnknownLsn if unknown
+  virtual rcu::ReadablePtr<WalLsns> GetWalLsns() const = 0;
+
   // Returns statistics for each DSN in DsnList
   virtual const std::vector<decltype(InstanceStatistics::topology)>&
   GetDsnStatistics() const = 0;
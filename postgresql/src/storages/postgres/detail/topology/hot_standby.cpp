@@ -162,6 +162,15 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices()
   return alive_dsn_indices_.Read();
 }
 
+rcu::ReadablePtr<TopologyBase::Roundtrips> HotStandby::GetRoundtripTimes()
+    const {
+  return roundtrip_times_.Read();
+}
+
+rcu::ReadablePtr<TopologyBase::WalLsns> HotStandby::GetWalLsns() const {
+  return wal_lsns_.Read();
+}
+
 const std::vector<decltype(InstanceStatistics::topology)>&
 HotStandby::GetDsnStatistics() const {
   return dsn_stats_;
@@ -178,8 +187,14 @@ void HotStandby::RunDiscovery() {
   // Report states and find the master
   HostState* master = nullptr;
   std::chrono::system_clock::time_point max_slave_xact_timestamp;
+  Roundtrips roundtrip_times;
+  roundtrip_times.reserve(host_states_.size());
+  WalLsns wal_lsns;
+  wal_lsns.reserve(host_states_.size());
   for (DsnIndex i = 0; i < host_states_.size(); ++i) {
     auto& state = host_states_[i];
+    roundtrip_times.push_back(state.roundtrip_time);
+    wal_lsns.push_back(state.wal_lsn);
     LOG_DEBUG() << state.app_name << " is " << state.role << ": rtt "
                 << state.roundtrip_time.count() << "us, LSN " << state.wal_lsn
                 << ", last xact time " << state.current_xact_timestamp;
@@ -282,6 +297,8 @@ void HotStandby::RunDiscovery() {
   }
   dsn_indices_by_type_.Assign(std::move(dsn_indices_by_type));
   alive_dsn_indices_.Assign(std::move(alive_dsn_indices));
+  roundtrip_times_.Assign(std::move(roundtrip_times));
+  wal_lsns_.Assign(std::move(wal_lsns));
 }
 
 void HotStandby::RunCheck(DsnIndex idx) {
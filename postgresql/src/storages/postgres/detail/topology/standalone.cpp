@@ -18,6 +18,8 @@ Standalone::Standalone(engine::TaskProcessor& bg_task_processor, DsnList dsns,
                    testsuite_pg_ctl, std::move(ei_settings)),
       dsn_indices_by_type_(DsnIndicesByType{{ClusterHostType::kMaster, {0}}}),
       alive_dsn_indices_(DsnIndices{0}),
+      roundtrip_times_(Roundtrips{std::chrono::microseconds{-1}}),
+      wal_lsns_(WalLsns{kUnknownLsn}),
       dsn_stats_(GetDsnList().size()) {
   UASSERT(GetDsnList().size() == 1);
 }
@@ -32,6 +34,15 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> Standalone::GetAliveDsnIndices()
   return alive_dsn_indices_.Read();
 }
 
+rcu::ReadablePtr<TopologyBase::Roundtrips> Standalone::GetRoundtripTimes()
+    const {
+  return roundtrip_times_.Read();
+}
+
+rcu::ReadablePtr<TopologyBase::WalLsns> Standalone::GetWalLsns() const {
+  return wal_lsns_.Read();
+}
+
 const std::vector<decltype(InstanceStatistics::topology)>&
 Standalone::GetDsnStatistics() const {
   return dsn_stats_;
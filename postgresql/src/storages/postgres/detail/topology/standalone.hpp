@@ -23,12 +23,16 @@ class Standalone final : public TopologyBase {
 
   rcu::ReadablePtr<DsnIndicesByType> GetDsnIndicesByType() const override;
   rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const override;
+  rcu::ReadablePtr<Roundtrips> GetRoundtripTimes() const override;
+  rcu::ReadablePtr<WalLsns> GetWalLsns() const override;
   const std::vector<decltype(InstanceStatistics::topology)>& GetDsnStatistics()
       const override;
 
  private:
   const rcu::Variable<DsnIndicesByType> dsn_indices_by_type_;
   const rcu::Variable<DsnIndices> alive_dsn_indices_;
+  const rcu::Variable<Roundtrips> roundtrip_times_;
+  const rcu::Variable<WalLsns> wal_lsns_;
   const std::vector<decltype(InstanceStatistics::topology)> dsn_stats_;
 };
 
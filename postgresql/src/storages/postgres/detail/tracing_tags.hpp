@@ -20,6 +20,8 @@ const std::string kPrepare = "pg_prepare";
 const std::string kBind = "pg_bind";
 /// Execute query, driver level
 const std::string kExec = "pg_exec";
+/// Logical replication stream, driver level
+const std::string kReplication = "pg_replication";
 
 // libpq stages
 /// libpq async connect stage
@@ -30,12 +32,16 @@ const std::string kLibpqWaitConnectFinish = "libpq_wait_connect_finish";
 const std::string kLibpqWaitResult = "libpq_wait_result";
 /// libpq send query params stage
 const std::string kLibpqSendQueryParams = "libpq_send_query_params";
+/// libpq send simple query stage
+const std::string kLibpqSendQuery = "libpq_send_query";
 /// libpq send prepare stage
 const std::string kLibpqSendPrepare = "libpq_send_prepare";
 /// libpq send describe prepared stage
 const std::string kLibpqSendDescribePrepared = "libpq_send_describe_prepared";
 /// libpq send query prepared stage
 const std::string kLibpqSendQueryPrepared = "libpq_send_query_prepared";
+/// libpq transfer COPY data stage
+const std::string kLibpqCopyData = "libpq_copy_data";
 /// libpq-missing send bind portal
 const std::string kPqSendPortalBind = "pq_send_portal_bind";
 /// libpq-missing send execute portal
@@ -0,0 +1,61 @@
+#include <storages/postgres/detail/write_lsn_tracker.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#include <userver/logging/log.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/io/pg_type_parsers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Never reached by any host, reads go to the master
+constexpr Lsn kUnreachableLsn{std::numeric_limits<Lsn::UnderlyingType>::max()};
+
+// Insert position also covers commits that are not flushed yet, e.g. with
+// `synchronous_commit = off`
+const std::string kWalInsertLsn = "SELECT pg_current_wal_insert_lsn()";
+const std::string kXlogInsertLocation =
+    "SELECT pg_current_xlog_insert_location()";
+
+}  // namespace
+
+void WriteLsnTracker::RecordCommit(const void* cluster_key, Connection& conn) {
+  auto lsn = kUnreachableLsn;
+  try {
+    const auto res = conn.Execute(conn.GetServerVersion() >= 100000
+                                      ? kWalInsertLsn
+                                      : kXlogInsertLocation);
+    lsn = res.AsSingleRow<Lsn>();
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING()
+        << "Failed to get the WAL position of a committed transaction, "
+           "reads are routed to the master: "
+        << e;
+  }
+
+  auto lsns = lsns_.Lock();
+  auto& required_lsn = (*lsns)[cluster_key];
+  required_lsn = std::max(required_lsn, lsn);
+}
+
+Lsn WriteLsnTracker::GetRequiredLsn(const void* cluster_key) const {
+  const auto lsns = lsns_.Lock();
+  const auto it = lsns->find(cluster_key);
+  return it == lsns->end() ? kUnknownLsn : it->second;
+}
+
+std::shared_ptr<WriteLsnTracker> GetCurrentWriteLsnTracker() {
+  const auto* tracker = kWriteLsnTracker.GetOptional();
+  return tracker ? *tracker : nullptr;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
+
+#include <storages/postgres/internal_pg_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class Connection;
+
+/// @brief WAL positions of the transactions committed within a
+/// ReadYourWritesScope, one per cluster
+class WriteLsnTracker final {
+ public:
+  /// Fetches the WAL insert position of the master right after a commit on
+  /// `conn`. If it cannot be determined, the cluster reads are routed to
+  /// the master until the end of the scope.
+  void RecordCommit(const void* cluster_key, Connection& conn);
+
+  /// @returns the position the host must have replayed to see all the
+  /// committed writes, kUnknownLsn if there were none
+  Lsn GetRequiredLsn(const void* cluster_key) const;
+
+ private:
+  concurrent::Variable<std::unordered_map<const void*, Lsn>, std::mutex> lsns_;
+};
+
+inline engine::TaskInheritedVariable<std::shared_ptr<WriteLsnTracker>>
+    kWriteLsnTracker;
+
+/// @returns the tracker of the current task, nullptr if read-your-writes
+/// consistency is not enabled
+std::shared_ptr<WriteLsnTracker> GetCurrentWriteLsnTracker();
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
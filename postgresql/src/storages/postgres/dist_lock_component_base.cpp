@@ -36,8 +36,11 @@ DistLockComponentBase::DistLockComponentBase(
       component_config["restart-delay"].As<std::chrono::milliseconds>(
           settings.worker_func_restart_delay);
 
-  auto strategy = std::make_shared<DistLockStrategy>(std::move(cluster), table,
-                                                     lock_name, settings);
+  const auto batching = component_config["batch-acquire"].As<bool>(false)
+                            ? DistLockBatching::kEnabled
+                            : DistLockBatching::kDisabled;
+  auto strategy = std::make_shared<DistLockStrategy>(
+      std::move(cluster), table, lock_name, settings, batching);
 
   auto task_processor_name =
       component_config["task-processor"].As<std::optional<std::string>>();
@@ -118,6 +121,13 @@ properties:
         type: string
         description: how much time to wait after failed task restart
         defaultDescription: 100ms
+    batch-acquire:
+        type: boolean
+        description: |
+            acquire and prolong the lock in a single statement together with
+            the other locks of the same table and cluster that have this
+            option set
+        defaultDescription: false
     autostart:
         type: boolean
         description: if true, start automatically after component load
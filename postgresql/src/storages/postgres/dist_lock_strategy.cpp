@@ -6,6 +6,8 @@
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 
+#include <storages/postgres/detail/dist_lock_batcher.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
@@ -47,13 +49,19 @@ std::string MakeOwnerId(const std::string& prefix, const std::string& locker) {
 
 DistLockStrategy::DistLockStrategy(ClusterPtr cluster, const std::string& table,
                                    const std::string& lock_name,
-                                   const dist_lock::DistLockSettings& settings)
+                                   const dist_lock::DistLockSettings& settings,
+                                   DistLockBatching batching)
     : cluster_(std::move(cluster)),
       cc_(settings.forced_stop_margin, settings.forced_stop_margin),
       acquire_query_(MakeAcquireQuery(table)),
       release_query_(MakeReleaseQuery(table)),
       lock_name_(lock_name),
-      owner_prefix_(hostinfo::blocking::GetRealHostName()) {}
+      owner_prefix_(hostinfo::blocking::GetRealHostName()),
+      batcher_(batching == DistLockBatching::kEnabled
+                   ? detail::DistLockBatcher::Get(cluster_, table)
+                   : nullptr) {}
+
+DistLockStrategy::~DistLockStrategy() = default;
 
 void DistLockStrategy::UpdateCommandControl(CommandControl cc) {
   auto cc_ptr = cc_.StartWrite();
@@ -63,8 +71,16 @@ void DistLockStrategy::UpdateCommandControl(CommandControl cc) {
 
 void DistLockStrategy::Acquire(std::chrono::milliseconds lock_ttl,
                                const std::string& locker_id) {
-  double timeout_seconds = lock_ttl.count() / 1000.0;
   auto cc_ptr = cc_.Read();
+  if (batcher_) {
+    if (!batcher_->Acquire(*cc_ptr, lock_name_,
+                           MakeOwnerId(owner_prefix_, locker_id), lock_ttl)) {
+      throw dist_lock::LockIsAcquiredByAnotherHostException();
+    }
+    return;
+  }
+
+  double timeout_seconds = lock_ttl.count() / 1000.0;
   auto result = cluster_->Execute(
       ClusterHostType::kMaster, *cc_ptr, acquire_query_, lock_name_,
       MakeOwnerId(owner_prefix_, locker_id), timeout_seconds);
@@ -282,6 +282,20 @@ std::string EscapeHostName(const std::string& hostname, char escape_char) {
   return escaped;
 }
 
+Dsn DsnWithOption(const Dsn& dsn, const std::string& keyword,
+                  const std::string& value) {
+  std::vector<std::pair<std::string, std::string>> values;
+  const auto opts = MakeDSNOptions(dsn);
+  for (auto* opt = opts.get(); opt != nullptr && opt->keyword != nullptr;
+       ++opt) {
+    if (opt->val && keyword != opt->keyword) {
+      values.emplace_back(opt->keyword, opt->val);
+    }
+  }
+  values.emplace_back(keyword, value);
+  return MakeDsn(values);
+}
+
 Dsn ResolveDsnHostaddrs(const Dsn& dsn, clients::dns::Resolver& resolver,
                         engine::Deadline deadline) {
   std::vector<std::pair<std::string, std::string>> values;
@@ -0,0 +1,252 @@
+#include <userver/storages/postgres/logical_replication.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+#include <fmt/format.h>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+
+#include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <storages/postgres/detail/pgoutput.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <storages/postgres/detail/tracing_tags.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+constexpr std::chrono::seconds kReconnectInterval{1};
+constexpr std::chrono::seconds kSendStatusTimeout{5};
+
+void ValidateSettings(const LogicalReplicationSettings& settings) {
+  // Slot names may contain only lower case letters, numbers and underscores
+  const auto is_valid_slot_char = [](char c) {
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
+  };
+  if (settings.slot_name.empty() ||
+      !std::all_of(settings.slot_name.begin(), settings.slot_name.end(),
+                   is_valid_slot_char)) {
+    throw InvalidConfig(fmt::format("Invalid replication slot name '{}'",
+                                    settings.slot_name));
+  }
+  if (settings.publications.empty()) {
+    throw InvalidConfig("No publications for the logical replication");
+  }
+}
+
+// Doubles the `quote` characters of the `value` and encloses it in them
+std::string Quote(std::string_view value, char quote) {
+  std::string result{quote};
+  for (const char c : value) {
+    if (c == quote) result.push_back(quote);
+    result.push_back(c);
+  }
+  result.push_back(quote);
+  return result;
+}
+
+std::string MakeStartReplicationQuery(
+    const LogicalReplicationSettings& settings, ReplicationLsn start_lsn) {
+  std::string publication_names;
+  for (const auto& publication : settings.publications) {
+    if (!publication_names.empty()) publication_names.push_back(',');
+    publication_names += Quote(publication, '"');
+  }
+  return fmt::format(
+      "START_REPLICATION SLOT {} LOGICAL {} (proto_version '1', "
+      "publication_names {}, binary 'true')",
+      settings.slot_name, detail::pgoutput::FormatLsn(start_lsn),
+      Quote(publication_names, '\''));
+}
+
+}  // namespace
+
+ReplicationTuple::ReplicationTuple(const ReplicationRelation& relation,
+                                   std::vector<Value>&& values)
+    : relation_{&relation}, values_{std::move(values)} {}
+
+bool ReplicationTuple::IsNull(std::size_t index) const {
+  return GetValue(index).kind == ValueKind::kNull;
+}
+
+bool ReplicationTuple::IsUnchanged(std::size_t index) const {
+  return GetValue(index).kind == ValueKind::kUnchanged;
+}
+
+std::size_t ReplicationTuple::IndexOf(std::string_view column) const {
+  const auto& columns = relation_->columns;
+  const auto it =
+      std::find_if(columns.begin(), columns.end(),
+                   [column](const auto& c) { return c.name == column; });
+  if (it == columns.end()) throw FieldNameDoesntExist{column};
+  return it - columns.begin();
+}
+
+const ReplicationTuple::Value& ReplicationTuple::GetValue(
+    std::size_t index) const {
+  if (index >= values_.size()) throw FieldIndexOutOfBounds{index};
+  return values_[index];
+}
+
+io::FieldBuffer ReplicationTuple::GetBuffer(std::size_t index) const {
+  const auto& value = GetValue(index);
+  io::FieldBuffer buffer;
+  if (value.kind == ValueKind::kNull) {
+    buffer.is_null = true;
+    return buffer;
+  }
+  if (value.kind != ValueKind::kBinary) {
+    throw InvalidBinaryBuffer{
+        fmt::format("Value of the column `{}` is not in binary format",
+                    relation_->columns[index].name)};
+  }
+  buffer.category = io::GetTypeBufferCategory(
+      GetTypeBufferCategories(), relation_->columns[index].type_oid);
+  buffer.length = value.data.size();
+  buffer.buffer = reinterpret_cast<const std::uint8_t*>(value.data.data());
+  return buffer;
+}
+
+const io::TypeBufferCategory& ReplicationTuple::GetTypeBufferCategories() {
+  // Only the predefined types are parsed, their categories are known
+  static const io::TypeBufferCategory kNoUserTypes;
+  return kNoUserTypes;
+}
+
+class LogicalReplicationStream::Impl final {
+ public:
+  Impl(MasterPoolGetter get_master_pool, LogicalReplicationSettings settings)
+      : get_master_pool_{std::move(get_master_pool)},
+        settings_{std::move(settings)} {
+    ValidateSettings(settings_);
+  }
+
+  void Run(LogicalReplicationHandler& handler) {
+    while (!engine::current_task::ShouldCancel()) {
+      try {
+        Serve(handler);
+      } catch (const std::exception& e) {
+        if (engine::current_task::ShouldCancel()) break;
+        LOG_WARNING() << "Logical replication of the slot '"
+                      << settings_.slot_name << "' failed, reconnecting in "
+                      << kReconnectInterval.count() << "s: " << e;
+      }
+      engine::InterruptibleSleepFor(kReconnectInterval);
+    }
+  }
+
+  ReplicationLsn GetCommittedLsn() const { return committed_lsn_.load(); }
+
+ private:
+  void Serve(LogicalReplicationHandler& handler) {
+    using CopyDataStatus = detail::PGConnectionWrapper::CopyDataStatus;
+
+    const auto pool = get_master_pool_();
+    const auto deadline =
+        engine::Deadline::FromDuration(settings_.connect_timeout);
+    auto conn = pool->ConnectReplication(deadline);
+    {
+      tracing::Span span{scopes::kReplication};
+      auto scope = span.CreateScopeTime();
+      conn->SendSimpleQuery(
+          MakeStartReplicationQuery(settings_, GetCommittedLsn()), scope);
+      conn->WaitCopyStart(deadline, scope, PGRES_COPY_BOTH);
+    }
+    LOG_INFO() << "Logical replication of the slot '" << settings_.slot_name
+               << "' started";
+
+    detail::pgoutput::Decoder decoder{handler};
+    // Positions of the received changes and of the ones that are safe to be
+    // dropped by the server
+    ReplicationLsn received_lsn = GetCommittedLsn();
+    ReplicationLsn flushed_lsn = received_lsn;
+    auto next_status_time =
+        engine::Deadline::Clock::now() + settings_.status_interval;
+
+    while (!engine::current_task::ShouldCancel()) {
+      detail::PGConnectionWrapper::CopyData data;
+      const auto status = conn->WaitCopyData(
+          engine::Deadline::FromTimePoint(next_status_time), data);
+      if (status == CopyDataStatus::kEnd) {
+        throw ConnectionError("Logical replication stopped by the server");
+      }
+
+      bool reply_requested = false;
+      if (status == CopyDataStatus::kData) {
+        detail::pgoutput::MessageReader reader{{data.buffer.get(), data.size}};
+        const auto type = reader.ReadByte();
+        if (type == 'w') {
+          const auto start_lsn =
+              static_cast<ReplicationLsn>(reader.ReadInt64());
+          reader.ReadInt64();  // server WAL end
+          reader.ReadInt64();  // send time
+          received_lsn = std::max(received_lsn, start_lsn);
+          decoder.Decode(reader.ReadRest());
+          if (decoder.GetCommittedLsn() > flushed_lsn) {
+            flushed_lsn = decoder.GetCommittedLsn();
+            committed_lsn_ = flushed_lsn;
+          }
+        } else if (type == 'k') {
+          const auto sent_lsn =
+              static_cast<ReplicationLsn>(reader.ReadInt64());
+          reader.ReadInt64();  // send time
+          reply_requested = reader.ReadByte() != 0;
+          received_lsn = std::max(received_lsn, sent_lsn);
+          // Everything before a keepalive is sent, the fragments of WAL
+          // without any published changes are confirmed as well
+          if (!decoder.IsInTransaction()) {
+            flushed_lsn = std::max(flushed_lsn, sent_lsn);
+          }
+        } else {
+          throw ReplicationProtocolError(
+              fmt::format("Unknown replication message type '{}'", type));
+        }
+      }
+
+      const auto now = engine::Deadline::Clock::now();
+      if (reply_requested || now >= next_status_time) {
+        conn->PutCopyData(
+            engine::Deadline::FromDuration(kSendStatusTimeout),
+            detail::pgoutput::MakeStatusUpdate(
+                received_lsn, flushed_lsn, std::chrono::system_clock::now(),
+                false));
+        next_status_time = now + settings_.status_interval;
+      }
+    }
+  }
+
+  const MasterPoolGetter get_master_pool_;
+  const LogicalReplicationSettings settings_;
+  std::atomic<ReplicationLsn> committed_lsn_{0};
+};
+
+LogicalReplicationStream::LogicalReplicationStream(
+    MasterPoolGetter get_master_pool, LogicalReplicationSettings settings)
+    : impl_{std::make_unique<Impl>(std::move(get_master_pool),
+                                   std::move(settings))} {}
+
+LogicalReplicationStream::LogicalReplicationStream(
+    LogicalReplicationStream&&) noexcept = default;
+
+LogicalReplicationStream& LogicalReplicationStream::operator=(
+    LogicalReplicationStream&&) noexcept = default;
+
+LogicalReplicationStream::~LogicalReplicationStream() = default;
+
+void LogicalReplicationStream::Run(LogicalReplicationHandler& handler) {
+  impl_->Run(handler);
+}
+
+ReplicationLsn LogicalReplicationStream::GetCommittedLsn() const {
+  return impl_->GetCommittedLsn();
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
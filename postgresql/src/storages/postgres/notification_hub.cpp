@@ -0,0 +1,160 @@
+#include <userver/storages/postgres/notification_hub.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/concurrent/async_event_channel.hpp>
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// New subscriptions are listened to after the current wait is over
+constexpr std::chrono::milliseconds kWaitNotifyInterval{200};
+constexpr std::chrono::seconds kReconnectInterval{1};
+constexpr std::chrono::seconds kAcquireTimeout{5};
+
+using NotificationChannel = concurrent::AsyncEventChannel<const Notification&>;
+
+}  // namespace
+
+class NotificationHub::Impl final {
+ public:
+  explicit Impl(MasterPoolGetter get_master_pool)
+      : get_master_pool_{std::move(get_master_pool)} {}
+
+  ~Impl() { task_.CancelAndWait(); }
+
+  concurrent::AsyncEventSubscriberScope Subscribe(std::string_view channel,
+                                                  concurrent::FunctionId id,
+                                                  std::string_view name,
+                                                  Callback&& callback) {
+    auto channels = channels_.Lock();
+    auto& event_channel = (*channels)[std::string{channel}];
+    if (!event_channel) {
+      event_channel = std::make_unique<NotificationChannel>(
+          fmt::format("pg_notification_hub/{}", channel));
+    }
+    auto scope = event_channel->AddListener(id, name, std::move(callback));
+
+    if (!started_) {
+      started_ = true;
+      task_.CriticalAsyncDetach("pg_notification_hub", [this] { Run(); });
+    }
+    return scope;
+  }
+
+ private:
+  void Run() {
+    while (!engine::current_task::ShouldCancel()) {
+      try {
+        Serve();
+      } catch (const std::exception& e) {
+        if (engine::current_task::ShouldCancel()) break;
+        LOG_WARNING() << "Notification hub connection failed, reconnecting in "
+                      << kReconnectInterval.count() << "s: " << e;
+      }
+      engine::InterruptibleSleepFor(kReconnectInterval);
+    }
+  }
+
+  void Serve() {
+    const auto pool = get_master_pool_();
+    auto conn =
+        pool->Acquire(engine::Deadline::FromDuration(kAcquireTimeout));
+    // The connection has active LISTENs, it must not be reused by the pool
+    USERVER_NAMESPACE::utils::ScopeGuard drop_connection{
+        [&conn] { conn->MarkAsBroken(); }};
+    LOG_INFO() << "Notification hub connected";
+
+    std::unordered_set<std::string> listened;
+    while (!engine::current_task::ShouldCancel()) {
+      if (get_master_pool_() != pool) {
+        LOG_INFO() << "Master host changed, reconnecting the notification hub";
+        return;
+      }
+      ListenNewChannels(*conn, listened);
+
+      Notification notification;
+      try {
+        notification = conn->WaitNotify(
+            engine::Deadline::FromDuration(kWaitNotifyInterval));
+      } catch (const ConnectionTimeoutError&) {
+        continue;
+      }
+      Dispatch(notification);
+    }
+  }
+
+  void ListenNewChannels(detail::Connection& conn,
+                         std::unordered_set<std::string>& listened) {
+    std::vector<std::string> new_channels;
+    {
+      const auto channels = channels_.Lock();
+      if (channels->size() == listened.size()) return;
+      for (const auto& [channel, _] : *channels) {
+        if (!listened.count(channel)) new_channels.push_back(channel);
+      }
+    }
+
+    for (auto& channel : new_channels) {
+      LOG_DEBUG() << "Notification hub starts listening on channel '"
+                  << channel << "'";
+      conn.Listen(channel, {});
+      listened.insert(std::move(channel));
+    }
+  }
+
+  void Dispatch(const Notification& notification) {
+    const NotificationChannel* event_channel = nullptr;
+    {
+      const auto channels = channels_.Lock();
+      const auto it = channels->find(notification.channel);
+      if (it == channels->end()) return;
+      // Channels are never removed, the pointer stays valid
+      event_channel = it->second.get();
+    }
+    event_channel->SendEvent(notification);
+  }
+
+  const MasterPoolGetter get_master_pool_;
+  concurrent::Variable<
+      std::unordered_map<std::string, std::unique_ptr<NotificationChannel>>,
+      engine::Mutex>
+      channels_;
+  // Protected by the channels_ lock
+  bool started_{false};
+  concurrent::BackgroundTaskStorage task_;
+};
+
+NotificationHub::NotificationHub(MasterPoolGetter get_master_pool)
+    : impl_{std::make_unique<Impl>(std::move(get_master_pool))} {}
+
+NotificationHub::~NotificationHub() = default;
+
+concurrent::AsyncEventSubscriberScope NotificationHub::Subscribe(
+    std::string_view channel, concurrent::FunctionId id, std::string_view name,
+    Callback callback) {
+  return impl_->Subscribe(channel, id, name, std::move(callback));
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
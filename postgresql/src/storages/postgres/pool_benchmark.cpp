@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <storages/postgres/default_command_controls.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+void PoolCheckout(benchmark::State& state) {
+  const auto dsn = GetDsnFromEnv();
+  if (dsn.empty()) {
+    state.SkipWithError("Database not connected");
+    return;
+  }
+
+  const auto thread_count = state.range(0);
+  engine::RunStandalone(thread_count, [&] {
+    // A connection per competing coroutine, the checkout never waits
+    const pg::PoolSettings pool_settings{
+        static_cast<std::size_t>(thread_count),
+        static_cast<std::size_t>(thread_count), pg::kDefaultPoolMaxQueueSize};
+    auto pool = pg::detail::ConnectionPool::Create(
+        dsn, nullptr, engine::current_task::GetTaskProcessor(), "",
+        pg::InitMode::kSync, pool_settings,
+        {pg::ConnectionSettings::kCachePreparedStatements}, {},
+        pg::DefaultCommandControls(kBenchCmdCtl, {}, {}), {}, {}, {},
+        dynamic_config::GetDefaultSource());
+
+    RunParallelBenchmark(state, [&pool](auto& range) {
+      for ([[maybe_unused]] auto _ : range) {
+        auto connection = pool->Acquire(
+            engine::Deadline::FromDuration(std::chrono::seconds{1}));
+        benchmark::DoNotOptimize(connection);
+      }
+    });
+  });
+}
+BENCHMARK(PoolCheckout)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
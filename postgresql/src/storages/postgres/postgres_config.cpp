@@ -58,6 +58,9 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
       config["max-prepared-cache-size"].template As<size_t>(
           config["max_prepared_cache_size"].template As<size_t>(
               kDefaultMaxPreparedCacheSize));
+  settings.prepared_statements_warmup =
+      config["prepared-statements-warmup"].template As<size_t>(
+          settings.prepared_statements_warmup);
   settings.ignore_unused_query_params =
       config["ignore-unused-query-params"].template As<bool>(
           config["ignore_unused_query_params"].template As<bool>(false))
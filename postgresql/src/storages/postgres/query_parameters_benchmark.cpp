@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <string>
+
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/optional.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+
+const pg::UserTypes types;
+
+void StaticParamsSmall(benchmark::State& state) {
+  const pg::Integer id{42};
+  const pg::Bigint value{100500};
+  for (auto _ : state) {
+    pg::detail::StaticQueryParameters<2> params;
+    params.Write(types, id, value);
+    benchmark::DoNotOptimize(params.ParamBuffers());
+  }
+}
+
+void StaticParamsStrings(benchmark::State& state) {
+  const std::string key(32, 'k');
+  const std::string value(128, 'v');
+  const std::optional<std::string> comment;
+  for (auto _ : state) {
+    pg::detail::StaticQueryParameters<4> params;
+    params.Write(types, key, value, comment, pg::Integer{42});
+    benchmark::DoNotOptimize(params.ParamBuffers());
+  }
+}
+
+void DynamicParamsStrings(benchmark::State& state) {
+  const std::string key(32, 'k');
+  const std::string value(128, 'v');
+  const std::optional<std::string> comment;
+  for (auto _ : state) {
+    pg::detail::DynamicQueryParameters params;
+    params.Write(types, key, value, comment, pg::Integer{42});
+    benchmark::DoNotOptimize(params.ParamBuffers());
+  }
+}
+
+BENCHMARK(StaticParamsSmall);
+BENCHMARK(StaticParamsStrings);
+BENCHMARK(DynamicParamsStrings);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,22 @@
+#include <userver/storages/postgres/read_your_writes.hpp>
+
+#include <storages/postgres/detail/write_lsn_tracker.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+ReadYourWritesScope::ReadYourWritesScope()
+    : outer_tracker_{detail::GetCurrentWriteLsnTracker()} {
+  if (!outer_tracker_) {
+    detail::kWriteLsnTracker.Set(std::make_shared<detail::WriteLsnTracker>());
+  }
+}
+
+ReadYourWritesScope::~ReadYourWritesScope() {
+  if (!outer_tracker_) detail::kWriteLsnTracker.Erase();
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -1,14 +1,19 @@
 #include <userver/storages/postgres/result_set.hpp>
 
+#include <algorithm>
 #include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include <storages/postgres/detail/result_wrapper.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/storages/postgres/io/user_types.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -252,6 +257,29 @@ void ResultSet::SetBufferCategoriesFrom(const ResultSet& dsc) {
   pimpl_->SetTypeBufferCategories(*dsc.pimpl_);
 }
 
+void ResultSet::ParseInParallel(
+    size_type chunk_rows,
+    const std::function<void(size_type, size_type)>& parse_rows) const {
+  UINVARIANT(chunk_rows > 0, "Parallel parsing requires non-empty chunks");
+  const auto size = Size();
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(size / chunk_rows);
+  // The first chunk is parsed in the calling coroutine
+  for (size_type begin = chunk_rows; begin < size; begin += chunk_rows) {
+    const auto end = std::min(begin + chunk_rows, size);
+    tasks.push_back(USERVER_NAMESPACE::utils::Async(
+        "pg_parse_result_chunk",
+        [&parse_rows, begin, end] { parse_rows(begin, end); }));
+  }
+  parse_rows(0, std::min(chunk_rows, size));
+  engine::WaitAllChecked(tasks);
+}
+
+ResultSet::size_type ResultSet::IndexOfName(const std::string& name) const {
+  return pimpl_->IndexOfName(name);
+}
+
 Row::size_type Row::IndexOfName(const std::string& name) const {
   return res_->IndexOfName(name);
 }
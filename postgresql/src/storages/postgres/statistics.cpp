@@ -36,6 +36,11 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
     query["executed"] = stats.transaction.execute_total;
     query["replies"] = stats.transaction.reply_total;
   }
+  if (auto prepared = writer["prepared-cache"]) {
+    prepared["hits"] = stats.transaction.prepared_cache_hits;
+    prepared["misses"] = stats.transaction.prepared_cache_misses;
+    prepared["evictions"] = stats.transaction.prepared_cache_evictions;
+  }
 
   if (auto errors = writer["errors"]) {
     constexpr std::string_view kPostgresqlError = "postgresql_error";
@@ -54,6 +59,10 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
     errors.ValueWithLabels(stats.connection.error_timeout,
                            {kPostgresqlError, "connection-timeout"});
   }
+  if (auto selection = writer["host-selection"]) {
+    selection["least-loaded"] = stats.least_loaded_selections;
+    selection["latency-estimate-us"] = stats.latency_estimate_us;
+  }
   writer["prepared-per-connection"] = stats.connection.prepared_statements;
   writer["roundtrip-time"] = stats.topology.roundtrip_time;
   writer["replication-lag"] = stats.topology.replication_lag;
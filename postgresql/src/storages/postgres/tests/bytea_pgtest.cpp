@@ -15,6 +15,10 @@ static_assert(tt::kIsByteaCompatible<std::string>);
 static_assert(tt::kIsByteaCompatible<std::string_view>);
 static_assert(tt::kIsByteaCompatible<std::vector<char>>);
 static_assert(tt::kIsByteaCompatible<std::vector<unsigned char>>);
+static_assert(
+    tt::kIsByteaCompatible<USERVER_NAMESPACE::utils::span<const char>>);
+static_assert(tt::kIsByteaCompatible<
+              USERVER_NAMESPACE::utils::span<const unsigned char>>);
 static_assert(!tt::kIsByteaCompatible<std::vector<bool>>);
 static_assert(!tt::kIsByteaCompatible<std::vector<int>>);
 
@@ -51,6 +55,20 @@ TEST(PostgreIO, Bytea) {
     UEXPECT_NO_THROW(io::ReadBuffer(fb, pg::Bytea(tgt_str)));
     EXPECT_EQ(bin_str, tgt_str);
   }
+  {
+    pg::test::Buffer buffer;
+    USERVER_NAMESPACE::utils::span<const char> bin_str{kFooBar.data(),
+                                                        kFooBar.size()};
+    UEXPECT_NO_THROW(io::WriteBuffer(types, buffer, pg::Bytea(bin_str)));
+    EXPECT_EQ(kFooBar.size(), buffer.size());
+    auto fb =
+        pg::test::MakeFieldBuffer(buffer, io::BufferCategory::kPlainBuffer);
+    USERVER_NAMESPACE::utils::span<const char> tgt_str;
+    UEXPECT_NO_THROW(io::ReadBuffer(fb, pg::Bytea(tgt_str)));
+    // Points into the buffer
+    EXPECT_EQ(reinterpret_cast<const char*>(fb.buffer), tgt_str.data());
+    EXPECT_EQ(kFooBar, std::string(tgt_str.begin(), tgt_str.end()));
+  }
   {
     pg::test::Buffer buffer;
     std::vector<char> bin_str{kFooBar.begin(), kFooBar.end()};
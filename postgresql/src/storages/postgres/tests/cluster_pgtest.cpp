@@ -7,9 +7,13 @@
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/storages/postgres/cluster.hpp>
+#include <userver/storages/postgres/dist_lock_strategy.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/read_your_writes.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -59,6 +63,26 @@ pg::Cluster CreateCluster(
                      {kTestCmdCtl, {}, {}}, {}, {}, testsuite_tasks, source, 0);
 }
 
+pg::Cluster CreateMultiplexingCluster(
+    const pg::DsnList& dsns, engine::TaskProcessor& bg_task_processor,
+    testsuite::TestsuiteTasks& testsuite_tasks) {
+  pg::ClusterSettings settings{{},
+                               {utest::kMaxTestWaitTime},
+                               {0, 4, 4},
+                               kPipelineEnabled,
+                               storages::postgres::InitMode::kAsync,
+                               "",
+                               {},
+                               {},
+                               {}};
+  settings.multiplexing_settings.enabled = true;
+  settings.multiplexing_settings.connections = 2;
+  settings.multiplexing_settings.max_batch_size = 8;
+  return pg::Cluster(dsns, nullptr, bg_task_processor, settings,
+                     {kTestCmdCtl, {}, {}}, {}, {}, testsuite_tasks,
+                     dynamic_config::GetDefaultSource(), 0);
+}
+
 }  // namespace
 
 class PostgreCluster : public PostgreSQLBase {};
@@ -188,12 +212,20 @@ UTEST_F(PostgreCluster, ClusterSlaveRO) {
   CheckRoTransaction(cluster.Begin(
       {pg::ClusterHostType::kSlave, pg::ClusterHostType::kNearest},
       pg::Transaction::RO));
+  CheckRoTransaction(cluster.Begin(
+      {pg::ClusterHostType::kSlave, pg::ClusterHostType::kLeastLoaded},
+      pg::Transaction::RO));
 
   UEXPECT_THROW(cluster.Begin({pg::ClusterHostType::kSlave,
                                pg::ClusterHostType::kRoundRobin,
                                pg::ClusterHostType::kNearest},
                               pg::Transaction::RO),
                 pg::LogicError);
+  UEXPECT_THROW(cluster.Begin({pg::ClusterHostType::kSlave,
+                               pg::ClusterHostType::kNearest,
+                               pg::ClusterHostType::kLeastLoaded},
+                              pg::Transaction::RO),
+                pg::LogicError);
 }
 
 UTEST_F(PostgreCluster, ClusterSyncSlaveRO) {
@@ -431,4 +463,168 @@ UTEST_F(PostgreCluster, ListenNotify) {
                 pg::ConnectionTimeoutError);
 }
 
+UTEST_F(PostgreCluster, NotificationHub) {
+  constexpr auto kFooChannel = std::string_view{"foo"};
+  constexpr auto kBarChannel = std::string_view{"bar"};
+  constexpr auto kNotifyPayload = std::string_view{"baz"};
+
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2,
+                               testsuite_tasks);
+  auto& hub = cluster.GetNotificationHub();
+
+  engine::SingleConsumerEvent foo_received;
+  engine::SingleConsumerEvent bar_received;
+  auto foo_scope = hub.Subscribe(
+      kFooChannel, concurrent::FunctionId(&foo_received), "test",
+      [&](const pg::Notification& ntf) {
+        if (ntf.payload == kNotifyPayload) foo_received.Send();
+      });
+  auto bar_scope = hub.Subscribe(
+      kBarChannel, concurrent::FunctionId(&bar_received), "test",
+      [&](const pg::Notification& ntf) {
+        if (ntf.payload == kNotifyPayload) bar_received.Send();
+      });
+
+  // The channels are listened to asynchronously, notify until received
+  const auto wait_for = [&](std::string_view channel,
+                            engine::SingleConsumerEvent& received) {
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (!deadline.IsReached()) {
+      cluster.Execute(pg::ClusterHostType::kMaster,
+                      "select pg_notify($1, $2)", channel, kNotifyPayload);
+      if (received.WaitForEventFor(std::chrono::milliseconds{100})) {
+        return true;
+      }
+    }
+    return false;
+  };
+  EXPECT_TRUE(wait_for(kFooChannel, foo_received));
+  EXPECT_TRUE(wait_for(kBarChannel, bar_received));
+
+  foo_scope.Unsubscribe();
+  bar_scope.Unsubscribe();
+}
+
+UTEST_F(PostgreCluster, ReadYourWrites) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2,
+                               testsuite_tasks);
+  cluster.Execute(pg::ClusterHostType::kMaster,
+                  "DROP TABLE IF EXISTS read_your_writes_test");
+  cluster.Execute(pg::ClusterHostType::kMaster,
+                  "CREATE TABLE read_your_writes_test(value integer)");
+
+  const auto count_on_slave = [&cluster] {
+    return cluster
+        .Execute(pg::ClusterHostType::kSlave,
+                 "SELECT count(*) FROM read_your_writes_test")
+        .AsSingleRow<int64_t>();
+  };
+
+  {
+    pg::ReadYourWritesScope read_your_writes;
+    for (int64_t i = 0; i < 3; ++i) {
+      auto trx = cluster.Begin(pg::ClusterHostType::kMaster,
+                               pg::Transaction::RW);
+      trx.Execute("INSERT INTO read_your_writes_test VALUES ($1)",
+                  static_cast<int>(i));
+      trx.Commit();
+
+      EXPECT_EQ(i + 1, count_on_slave());
+      // The written LSN is inherited by the child tasks
+      EXPECT_EQ(i + 1, engine::AsyncNoSpan(count_on_slave).Get());
+    }
+  }
+
+  cluster.Execute(pg::ClusterHostType::kMaster,
+                  "DROP TABLE read_your_writes_test");
+}
+
+UTEST_F_MT(PostgreCluster, MultiplexedExecute, 4) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateMultiplexingCluster(GetDsnListFromEnv(),
+                                           GetTaskProcessor(), testsuite_tasks);
+
+  constexpr int kTasksCount = 50;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasksCount);
+  for (int i = 0; i < kTasksCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&cluster, i] {
+      if (i % 10 == 0) {
+        // A failed statement does not affect the others in the batch
+        UEXPECT_THROW(cluster.Execute(pg::ClusterHostType::kSlave,
+                                      "select 1 / ($1 - $1)",
+                                      pg::ParameterStore{}.PushBack(i)),
+                      pg::DataException);
+        return;
+      }
+      const auto res = cluster.Execute(pg::ClusterHostType::kSlave,
+                                       "select $1::integer",
+                                       pg::ParameterStore{}.PushBack(i));
+      EXPECT_EQ(i, res.AsSingleRow<int>());
+    }));
+  }
+  for (auto& task : tasks) UEXPECT_NO_THROW(task.Get());
+}
+
+UTEST_F_MT(PostgreCluster, DistLockBatchedAcquire, 4) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  const auto cluster = std::make_shared<pg::Cluster>(
+      GetDsnListFromEnv(), nullptr, GetTaskProcessor(),
+      pg::ClusterSettings{{},
+                          {utest::kMaxTestWaitTime},
+                          {0, 4, 4},
+                          kCachePreparedStatements,
+                          storages::postgres::InitMode::kAsync,
+                          "",
+                          {},
+                          {}},
+      pg::DefaultCommandControls{kTestCmdCtl, {}, {}},
+      testsuite::PostgresControl{}, error_injection::Settings{},
+      testsuite_tasks, dynamic_config::GetDefaultSource(), 0);
+
+  const std::string table = "dist_lock_batched_test";
+  cluster->Execute(pg::ClusterHostType::kMaster,
+                   "DROP TABLE IF EXISTS " + table);
+  cluster->Execute(pg::ClusterHostType::kMaster,
+                   "CREATE TABLE " + table +
+                       " (key TEXT PRIMARY KEY, owner TEXT, "
+                       "expiration_time TIMESTAMPTZ)");
+
+  constexpr int kLocksCount = 20;
+  const dist_lock::DistLockSettings settings{};
+  std::vector<std::unique_ptr<pg::DistLockStrategy>> strategies;
+  for (int i = 0; i < kLocksCount; ++i) {
+    strategies.push_back(std::make_unique<pg::DistLockStrategy>(
+        cluster, table, "lock-" + std::to_string(i), settings,
+        pg::DistLockBatching::kEnabled));
+  }
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kLocksCount);
+  for (auto& strategy : strategies) {
+    tasks.push_back(engine::AsyncNoSpan([&strategy] {
+      for (int attempt = 0; attempt < 3; ++attempt) {
+        strategy->Acquire(std::chrono::seconds{10}, "owner");
+      }
+    }));
+  }
+  for (auto& task : tasks) UEXPECT_NO_THROW(task.Get());
+
+  // The locks are held by "owner" now
+  for (auto& strategy : strategies) {
+    UEXPECT_THROW(strategy->Acquire(std::chrono::seconds{10}, "another"),
+                  dist_lock::LockIsAcquiredByAnotherHostException);
+  }
+
+  for (auto& strategy : strategies) strategy->Release("owner");
+  UEXPECT_NO_THROW(
+      strategies.front()->Acquire(std::chrono::seconds{10}, "another"));
+  strategies.front()->Release("another");
+
+  cluster->Execute(pg::ClusterHostType::kMaster, "DROP TABLE " + table);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/io/optional.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct CopyRow final {
+  int id{};
+  std::optional<std::string> value;
+};
+
+std::vector<CopyRow> MakeRows(int count) {
+  std::vector<CopyRow> rows;
+  rows.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    rows.push_back({i, i % 10 ? std::make_optional(std::to_string(i))
+                              : std::nullopt});
+  }
+  return rows;
+}
+
+UTEST_P(PostgreConnection, CopyIn) {
+  CheckConnection(GetConn());
+
+  GetConn()->Execute("create temporary table copy_test(id integer, value text)");
+  // Several chunks of data
+  const auto rows = MakeRows(20000);
+
+  pg::Transaction trx{std::move(GetConn())};
+  /// [CopyIn]
+  std::size_t inserted = 0;
+  UEXPECT_NO_THROW(inserted = trx.CopyIn("copy_test", {"id", "value"}, rows));
+  /// [CopyIn]
+  EXPECT_EQ(rows.size(), inserted);
+
+  const auto res = trx.Execute(
+      "select count(*), count(value), sum(id)::bigint from copy_test");
+  EXPECT_EQ(rows.size(), res[0][0].As<pg::Bigint>());
+  EXPECT_EQ(rows.size() - rows.size() / 10, res[0][1].As<pg::Bigint>());
+  EXPECT_EQ(20000LL * 19999 / 2, res[0][2].As<pg::Bigint>());
+
+  // A single column
+  const std::vector<int> ids{1, 2, 3};
+  EXPECT_EQ(ids.size(), trx.CopyIn("copy_test", {"id"}, ids));
+  const auto nulls = trx.Execute(
+      "select count(*) from copy_test where value is null and id < 4");
+  EXPECT_EQ(3, nulls.Front().As<pg::Bigint>());
+
+  // The types must match exactly
+  UEXPECT_THROW(trx.CopyIn("copy_test", {"value"}, ids), pg::Error);
+  trx.Rollback();
+}
+
+UTEST_P(PostgreConnection, CopyOut) {
+  CheckConnection(GetConn());
+
+  GetConn()->Execute("create temporary table copy_test(id integer, value text)");
+  GetConn()->Execute(
+      "insert into copy_test select i, case when i % 10 = 0 then null "
+      "else i::text end from generate_series(0, 9999) i");
+
+  pg::Transaction trx{std::move(GetConn())};
+  /// [CopyOut]
+  std::vector<CopyRow> received;
+  std::size_t count = 0;
+  UEXPECT_NO_THROW(count = trx.CopyOut<CopyRow>(
+                       "select id, value from copy_test order by id",
+                       [&received](CopyRow&& row) {
+                         received.push_back(std::move(row));
+                       }));
+  /// [CopyOut]
+  const auto expected = MakeRows(10000);
+  EXPECT_EQ(expected.size(), count);
+  ASSERT_EQ(expected.size(), received.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i].id, received[i].id);
+    EXPECT_EQ(expected[i].value, received[i].value);
+  }
+
+  // Empty result
+  EXPECT_EQ(0, trx.CopyOut<int>("select id from copy_test where id < 0",
+                                [](int) { FAIL() << "No rows expected"; }));
+
+  // The connection is usable after a consumer failure
+  UEXPECT_THROW(trx.CopyOut<int>("select id from copy_test",
+                                 [](int) { throw std::runtime_error{"test"}; }),
+                std::runtime_error);
+  const auto res = trx.Execute("select count(*) from copy_test");
+  EXPECT_EQ(10000, res.Front().As<pg::Bigint>());
+  trx.Commit();
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -134,6 +134,21 @@ TEST(PostgreDSN, DsnCutPassword) {
   EXPECT_EQ(options.dbname, "mydb");
 }
 
+TEST(PostgreDSN, DsnWithOption) {
+  const auto dsn = pg::DsnWithOption(
+      pg::Dsn{"postgresql://myuser@localhost:6432/mydb?replication=true"},
+      "replication", "database");
+  const auto& dsn_str = dsn.GetUnderlying();
+  EXPECT_NE(dsn_str.find("replication=database"), dsn_str.npos);
+  EXPECT_EQ(dsn_str.find("replication=true"), dsn_str.npos);
+  EXPECT_NE(dsn_str.find("user=myuser"), dsn_str.npos);
+
+  const auto options = pg::OptionsFromDsn(dsn);
+  EXPECT_EQ(options.host, "localhost");
+  EXPECT_EQ(options.port, "6432");
+  EXPECT_EQ(options.dbname, "mydb");
+}
+
 TEST(PostgreDSN, EscapeHostName) {
   EXPECT_EQ(pg::EscapeHostName("host-name.with.numbers130.dots.and-dashes"),
             "host_name_with_numbers130_dots_and_dashes");
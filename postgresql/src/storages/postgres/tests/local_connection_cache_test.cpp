@@ -0,0 +1,67 @@
+#include <userver/utest/utest.hpp>
+
+#include <array>
+#include <thread>
+
+#include <storages/postgres/detail/local_connection_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct FakeConnection {};
+
+using Cache = pg::detail::LocalConnectionCache<FakeConnection>;
+
+}  // namespace
+
+TEST(PostgreLocalConnectionCache, PutTake) {
+  Cache cache{4};
+  std::array<FakeConnection, 2> connections;
+
+  EXPECT_EQ(nullptr, cache.TryTake());
+  EXPECT_TRUE(cache.TryPut(&connections[0]));
+  // The slot of the current thread is occupied
+  EXPECT_FALSE(cache.TryPut(&connections[1]));
+  EXPECT_EQ(&connections[0], cache.TryTake());
+  EXPECT_EQ(nullptr, cache.TryTake());
+  EXPECT_EQ(nullptr, cache.Steal());
+}
+
+TEST(PostgreLocalConnectionCache, Steal) {
+  Cache cache{2};
+  std::array<FakeConnection, 2> connections;
+
+  // Find a thread that uses the other slot
+  const auto local_index = pg::detail::GetLocalCacheThreadIndex();
+  bool put_from_other_slot = false;
+  while (!put_from_other_slot) {
+    std::thread([&] {
+      const auto index = pg::detail::GetLocalCacheThreadIndex();
+      if (index % 2 != local_index % 2) {
+        put_from_other_slot = cache.TryPut(&connections[1]);
+      }
+    }).join();
+  }
+
+  // The local slot is empty, the connection is stolen from the other one
+  EXPECT_EQ(nullptr, cache.TryTake());
+  EXPECT_EQ(&connections[1], cache.Steal());
+  EXPECT_EQ(nullptr, cache.Steal());
+
+  // The local slot is preferred
+  EXPECT_TRUE(cache.TryPut(&connections[0]));
+  EXPECT_EQ(&connections[0], cache.Steal());
+}
+
+TEST(PostgreLocalConnectionCache, SingleSlot) {
+  Cache cache{0};
+  FakeConnection connection;
+
+  EXPECT_TRUE(cache.TryPut(&connection));
+  std::thread([&] { EXPECT_EQ(&connection, cache.TryTake()); }).join();
+}
+
+USERVER_NAMESPACE_END
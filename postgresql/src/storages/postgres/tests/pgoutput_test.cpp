@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <storages/postgres/detail/pgoutput.hpp>
+#include <userver/storages/postgres/io/optional.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+namespace pgoutput = pg::detail::pgoutput;
+
+namespace {
+
+constexpr pg::Oid kTableOid = 16385;
+constexpr pg::Oid kInt4Oid = 23;
+constexpr pg::Oid kTextOid = 25;
+
+class MessageBuilder {
+ public:
+  explicit MessageBuilder(char type) { data_.push_back(type); }
+
+  MessageBuilder& Byte(char value) {
+    data_.push_back(value);
+    return *this;
+  }
+
+  MessageBuilder& Int16(std::int16_t value) { return BigEndian(value, 2); }
+  MessageBuilder& Int32(std::int32_t value) { return BigEndian(value, 4); }
+  MessageBuilder& Int64(std::int64_t value) { return BigEndian(value, 8); }
+
+  MessageBuilder& String(std::string_view value) {
+    data_ += value;
+    data_.push_back('\0');
+    return *this;
+  }
+
+  MessageBuilder& Value(char kind, std::string_view value) {
+    Byte(kind).Int32(value.size());
+    data_ += value;
+    return *this;
+  }
+
+  MessageBuilder& Int4Value(std::int32_t value) {
+    Byte('b');
+    Int32(4);
+    return Int32(value);
+  }
+
+  std::string Build() const { return data_; }
+
+ private:
+  MessageBuilder& BigEndian(std::uint64_t value, int size) {
+    for (int i = size - 1; i >= 0; --i) {
+      data_.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+    return *this;
+  }
+
+  std::string data_;
+};
+
+std::string MakeRelation() {
+  return MessageBuilder{'R'}
+      .Int32(kTableOid)
+      .String("public")
+      .String("items")
+      .Byte('d')
+      .Int16(2)
+      .Byte(1)
+      .String("id")
+      .Int32(kInt4Oid)
+      .Int32(-1)
+      .Byte(0)
+      .String("value")
+      .Int32(kTextOid)
+      .Int32(-1)
+      .Build();
+}
+
+class RecordingHandler final : public pg::LogicalReplicationHandler {
+ public:
+  void OnBegin(pg::ReplicationLsn final_lsn) override {
+    events.push_back(fmt::format("begin {}", final_lsn));
+  }
+
+  void OnInsert(const pg::ReplicationRelation& relation,
+                const pg::ReplicationTuple& new_tuple) override {
+    events.push_back(fmt::format("insert {} {} {}", relation.name,
+                                 new_tuple.As<int>("id"),
+                                 new_tuple.As<std::string>("value")));
+  }
+
+  void OnUpdate(const pg::ReplicationRelation& relation,
+                const pg::ReplicationTuple* old_tuple,
+                const pg::ReplicationTuple& new_tuple) override {
+    events.push_back(fmt::format(
+        "update {} {} {} {}", relation.name, old_tuple != nullptr,
+        new_tuple.As<int>(0),
+        new_tuple.As<std::optional<std::string>>(1).value_or("null")));
+  }
+
+  void OnDelete(const pg::ReplicationRelation& relation,
+                const pg::ReplicationTuple& old_tuple) override {
+    events.push_back(fmt::format("delete {} {} {}", relation.name,
+                                 old_tuple.As<int>("id"),
+                                 old_tuple.IsNull(old_tuple.IndexOf("value"))));
+  }
+
+  void OnTruncate(
+      const std::vector<const pg::ReplicationRelation*>& relations) override {
+    events.push_back(fmt::format("truncate {}", relations.size()));
+  }
+
+  void OnCommit(pg::ReplicationLsn end_lsn) override {
+    events.push_back(fmt::format("commit {}", end_lsn));
+  }
+
+  std::vector<std::string> events;
+};
+
+}  // namespace
+
+TEST(PostgrePgoutput, Decode) {
+  RecordingHandler handler;
+  pgoutput::Decoder decoder{handler};
+
+  decoder.Decode(MessageBuilder{'B'}.Int64(100).Int64(0).Int32(42).Build());
+  EXPECT_TRUE(decoder.IsInTransaction());
+  decoder.Decode(MakeRelation());
+  decoder.Decode(MessageBuilder{'I'}
+                     .Int32(kTableOid)
+                     .Byte('N')
+                     .Int16(2)
+                     .Int4Value(1)
+                     .Value('b', "one")
+                     .Build());
+  decoder.Decode(MessageBuilder{'U'}
+                     .Int32(kTableOid)
+                     .Byte('N')
+                     .Int16(2)
+                     .Int4Value(1)
+                     .Byte('n')
+                     .Build());
+  decoder.Decode(MessageBuilder{'U'}
+                     .Int32(kTableOid)
+                     .Byte('K')
+                     .Int16(2)
+                     .Int4Value(1)
+                     .Byte('n')
+                     .Byte('N')
+                     .Int16(2)
+                     .Int4Value(2)
+                     .Value('b', "two")
+                     .Build());
+  decoder.Decode(MessageBuilder{'D'}
+                     .Int32(kTableOid)
+                     .Byte('K')
+                     .Int16(2)
+                     .Int4Value(2)
+                     .Byte('n')
+                     .Build());
+  decoder.Decode(
+      MessageBuilder{'T'}.Int32(1).Byte(0).Int32(kTableOid).Build());
+  decoder.Decode(
+      MessageBuilder{'C'}.Byte(0).Int64(100).Int64(120).Int64(0).Build());
+
+  EXPECT_FALSE(decoder.IsInTransaction());
+  EXPECT_EQ(decoder.GetCommittedLsn(), 120);
+  const std::vector<std::string> expected{
+      "begin 100",
+      "insert items 1 one",
+      "update items false 1 null",
+      "update items true 2 two",
+      "delete items 2 true",
+      "truncate 1",
+      "commit 120",
+  };
+  EXPECT_EQ(handler.events, expected);
+}
+
+TEST(PostgrePgoutput, TupleValues) {
+  RecordingHandler handler;
+  pgoutput::Decoder decoder{handler};
+  decoder.Decode(MakeRelation());
+
+  // Unchanged TOASTed and text values can not be parsed
+  UEXPECT_THROW(decoder.Decode(MessageBuilder{'I'}
+                                   .Int32(kTableOid)
+                                   .Byte('N')
+                                   .Int16(2)
+                                   .Int4Value(1)
+                                   .Byte('u')
+                                   .Build()),
+                pg::InvalidBinaryBuffer);
+  UEXPECT_THROW(decoder.Decode(MessageBuilder{'I'}
+                                   .Int32(kTableOid)
+                                   .Byte('N')
+                                   .Int16(2)
+                                   .Value('t', "1")
+                                   .Value('t', "one")
+                                   .Build()),
+                pg::InvalidBinaryBuffer);
+  // Non-nullable type
+  UEXPECT_THROW(decoder.Decode(MessageBuilder{'I'}
+                                   .Int32(kTableOid)
+                                   .Byte('N')
+                                   .Int16(2)
+                                   .Byte('n')
+                                   .Value('b', "one")
+                                   .Build()),
+                pg::FieldValueIsNull);
+  EXPECT_TRUE(handler.events.empty());
+}
+
+TEST(PostgrePgoutput, MalformedMessages) {
+  RecordingHandler handler;
+  pgoutput::Decoder decoder{handler};
+
+  // Change of a table that was not described
+  UEXPECT_THROW(decoder.Decode(MessageBuilder{'D'}
+                                   .Int32(kTableOid)
+                                   .Byte('K')
+                                   .Int16(2)
+                                   .Int4Value(1)
+                                   .Byte('n')
+                                   .Build()),
+                pg::ReplicationProtocolError);
+
+  decoder.Decode(MakeRelation());
+  // Truncated
+  UEXPECT_THROW(decoder.Decode(MessageBuilder{'I'}
+                                   .Int32(kTableOid)
+                                   .Byte('N')
+                                   .Int16(2)
+                                   .Int4Value(1)
+                                   .Byte('b')
+                                   .Int32(10)
+                                   .Build()),
+                pg::ReplicationProtocolError);
+  // Wrong number of columns
+  UEXPECT_THROW(decoder.Decode(MessageBuilder{'I'}
+                                   .Int32(kTableOid)
+                                   .Byte('N')
+                                   .Int16(1)
+                                   .Int4Value(1)
+                                   .Build()),
+                pg::ReplicationProtocolError);
+  UEXPECT_THROW(decoder.Decode(MessageBuilder{'?'}.Build()),
+                pg::ReplicationProtocolError);
+  EXPECT_TRUE(handler.events.empty());
+}
+
+TEST(PostgrePgoutput, StatusUpdate) {
+  EXPECT_EQ(pgoutput::FormatLsn(0), "0/0");
+  EXPECT_EQ(pgoutput::FormatLsn(0x16B3748ull | (1ull << 32)), "1/16B3748");
+
+  // 2000-01-01 00:00:01 UTC
+  const std::chrono::system_clock::time_point time{
+      std::chrono::seconds{946684801}};
+  const auto message = pgoutput::MakeStatusUpdate(200, 100, time, true);
+
+  pgoutput::MessageReader reader{message};
+  EXPECT_EQ(reader.ReadByte(), 'r');
+  EXPECT_EQ(reader.ReadInt64(), 200);
+  EXPECT_EQ(reader.ReadInt64(), 100);
+  EXPECT_EQ(reader.ReadInt64(), 100);
+  EXPECT_EQ(reader.ReadInt64(), 1'000'000);
+  EXPECT_EQ(reader.ReadByte(), 1);
+  EXPECT_TRUE(reader.IsEnd());
+}
+
+USERVER_NAMESPACE_END
@@ -285,6 +285,65 @@ UTEST_F(PostgrePoolStats, MaxPreparedCacheSize) {
             conn_settings.max_prepared_cache_size);
 }
 
+UTEST_F(PostgrePoolStats, PreparedCacheStats) {
+  pg::ConnectionSettings conn_settings;
+  conn_settings.max_prepared_cache_size = 5;
+
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
+      storages::postgres::InitMode::kAsync, {1, 10, 10}, conn_settings, {},
+      GetTestCmdCtls(), {}, {}, {}, dynamic_config::GetDefaultSource());
+
+  auto conn = pg::detail::ConnectionPtr{nullptr};
+  UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()))
+      << "Obtained connection from pool";
+  CheckConnection(conn);
+  conn->GetStatsAndReset();
+
+  UEXPECT_NO_THROW(conn->Execute("select 1"));
+  UEXPECT_NO_THROW(conn->Execute("select 1"));
+  auto stats = conn->GetStatsAndReset();
+  EXPECT_EQ(stats.prepared_cache_misses, 1);
+  EXPECT_EQ(stats.prepared_cache_hits, 1);
+  EXPECT_EQ(stats.prepared_cache_evictions, 0);
+
+  for (size_t i = 0; i < conn_settings.max_prepared_cache_size + 1; ++i) {
+    UEXPECT_NO_THROW(conn->Execute("select " + std::to_string(i + 2)));
+  }
+  stats = conn->GetStatsAndReset();
+  EXPECT_EQ(stats.prepared_cache_misses,
+            conn_settings.max_prepared_cache_size + 1);
+  EXPECT_GE(stats.prepared_cache_evictions, 1);
+}
+
+UTEST_F(PostgrePoolStats, PreparedStatementsWarmup) {
+  pg::ConnectionSettings conn_settings;
+  conn_settings.prepared_statements_warmup = 10;
+
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
+      storages::postgres::InitMode::kAsync, {1, 10, 10}, conn_settings, {},
+      GetTestCmdCtls(), {}, {}, {}, dynamic_config::GetDefaultSource());
+
+  auto conn = pg::detail::ConnectionPtr{nullptr};
+  UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()))
+      << "Obtained connection from pool";
+  CheckConnection(conn);
+  UEXPECT_NO_THROW(conn->Execute("select 42"));
+
+  // The first connection is busy, so a fresh one is established
+  auto fresh_conn = pg::detail::ConnectionPtr{nullptr};
+  UASSERT_NO_THROW(fresh_conn = pool->Acquire(MakeDeadline()))
+      << "Obtained connection from pool";
+  CheckConnection(fresh_conn);
+  fresh_conn->GetStatsAndReset();
+
+  UEXPECT_NO_THROW(fresh_conn->Execute("select 42"));
+  const auto stats = fresh_conn->GetStatsAndReset();
+  EXPECT_EQ(stats.prepared_cache_hits, 1);
+  EXPECT_EQ(stats.prepared_cache_misses, 0);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/optional.hpp>
 #include <userver/storages/postgres/io/user_types.hpp>
 #include <userver/utest/assert_macros.hpp>
 
@@ -120,6 +121,50 @@ TEST(PostgreIO, OutputFloatStatic) {
             params.ParamTypesBuffer()[0]);
 }
 
+TEST(PostgreIO, OutputSharedBufferStatic) {
+  pg::detail::StaticQueryParameters<4> params;
+  const std::string short_str{"foo"};
+  const std::string long_str(100, 'a');
+  const std::string longer_str(1000, 'b');
+
+  // The buffer is reallocated while writing
+  params.Write(types, short_str, long_str, std::optional<int>{}, longer_str);
+
+  const auto get_param = [&params](std::size_t index) {
+    return std::string_view{params.ParamBuffers()[index],
+                            static_cast<std::size_t>(
+                                params.ParamLengthsBuffer()[index])};
+  };
+  EXPECT_EQ(short_str, get_param(0));
+  EXPECT_EQ(long_str, get_param(1));
+  EXPECT_EQ(nullptr, params.ParamBuffers()[2]);
+  EXPECT_EQ(pg::io::kPgNullBufferSize, params.ParamLengthsBuffer()[2]);
+  EXPECT_EQ(longer_str, get_param(3));
+  for (std::size_t i = 0; i < params.Size(); ++i) {
+    EXPECT_EQ(1, params.ParamFormatsBuffer()[i]) << "Binary format";
+  }
+}
+
+TEST(PostgreIO, OutputSharedBufferDynamic) {
+  pg::detail::DynamicQueryParameters params;
+  const std::string long_str(100, 'a');
+  const std::string longer_str(1000, 'b');
+
+  params.Write(types, long_str, std::optional<int>{}, longer_str);
+  // Pointers to the buffer survive a move
+  auto moved_params = std::move(params);
+
+  const auto get_param = [&moved_params](std::size_t index) {
+    return std::string_view{moved_params.ParamBuffers()[index],
+                            static_cast<std::size_t>(
+                                moved_params.ParamLengthsBuffer()[index])};
+  };
+  ASSERT_EQ(3, moved_params.Size());
+  EXPECT_EQ(long_str, get_param(0));
+  EXPECT_EQ(nullptr, moved_params.ParamBuffers()[1]);
+  EXPECT_EQ(longer_str, get_param(2));
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,9 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <string_view>
+#include <tuple>
+#include <vector>
+
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -147,4 +151,64 @@ UTEST_P(PostgreConnection, ResultAsOptionalSingleRow) {
   UEXPECT_THROW(res.AsOptionalSingleRow<int>(), pg::NonSingleRowResultSet);
 }
 
+UTEST_P(PostgreConnection, ResultStringViewFields) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(res = GetConn()->Execute(
+                       "select i, i::text from generate_series(1, 3) i"));
+
+  using Row = std::tuple<int, std::string_view>;
+  const auto rows = res.AsContainer<std::vector<Row>>(pg::kRowTag);
+  ASSERT_EQ(3, rows.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    EXPECT_EQ(std::to_string(std::get<0>(rows[i])), std::get<1>(rows[i]));
+  }
+  // The views point into the result buffer
+  EXPECT_EQ(std::get<1>(rows[0]).data(),
+            res[0][1].As<std::string_view>().data());
+}
+
+UTEST_P(PostgreConnection, ResultAsColumn) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(res = GetConn()->Execute(
+                       "select i as id, i * 2 as doubled "
+                       "from generate_series(1, 100) i"));
+
+  const auto ids = res.AsColumn<std::vector<int>>(0);
+  const auto doubled = res.AsColumn<std::vector<int>>("doubled");
+  ASSERT_EQ(100, ids.size());
+  ASSERT_EQ(100, doubled.size());
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    EXPECT_EQ(static_cast<int>(i) + 1, ids[i]);
+    EXPECT_EQ(ids[i] * 2, doubled[i]);
+  }
+
+  UEXPECT_THROW(res.AsColumn<std::vector<int>>(2), pg::FieldIndexOutOfBounds);
+  UEXPECT_THROW(res.AsColumn<std::vector<int>>("missing"),
+                pg::FieldNameDoesntExist);
+}
+
+UTEST_P_MT(PostgreConnection, ResultAsContainerParallel, 4) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(res = GetConn()->Execute(
+                       "select i, i::text from generate_series(0, 9999) i"));
+
+  const pg::ParallelParsing parallel{1000, 300};
+  const auto ids = res.AsContainer<std::vector<int>>(parallel);
+  EXPECT_EQ(res.AsContainer<std::vector<int>>(), ids);
+
+  using Row = std::tuple<int, std::string>;
+  const auto rows = res.AsContainer<std::vector<Row>>(pg::kRowTag, parallel);
+  EXPECT_EQ(res.AsContainer<std::vector<Row>>(pg::kRowTag), rows);
+
+  // Small results are parsed in place
+  EXPECT_EQ(ids,
+            res.AsContainer<std::vector<int>>(pg::ParallelParsing{20000, 300}));
+}
+
 USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/statement_stats.hpp>
+#include <storages/postgres/detail/write_lsn_tracker.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/testsuite/testpoint.hpp>
 
@@ -25,6 +26,12 @@ Transaction::Transaction(detail::ConnectionPtr&& conn,
 
 void Transaction::SetName(std::string name) { name_ = std::move(name); }
 
+void Transaction::TrackCommitLsn(
+    std::shared_ptr<detail::WriteLsnTracker> tracker, const void* cluster_key) {
+  lsn_tracker_ = std::move(tracker);
+  lsn_tracker_key_ = cluster_key;
+}
+
 Transaction::Transaction(Transaction&&) noexcept = default;
 
 Transaction::~Transaction() {
@@ -84,6 +91,47 @@ ResultSet Transaction::DoExecute(const Query& query,
   }
 }
 
+std::size_t Transaction::DoCopyIn(std::string_view table,
+                                  const std::vector<std::string>& columns,
+                                  const detail::CopyInFiller& fill,
+                                  OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "CopyIn called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  auto source = conn_.GetConfigSource();
+  if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+  return conn_->CopyIn(table, columns, fill, std::move(statement_cmd_ctl))
+      .RowsAffected();
+}
+
+std::size_t Transaction::DoCopyOut(const Query& query,
+                                   const detail::CopyOutConsumer& consume,
+                                   OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "CopyOut called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  if (!statement_cmd_ctl) {
+    statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  auto source = conn_.GetConfigSource();
+  if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+  detail::StatementStats stats{query, conn_};
+  try {
+    auto res = conn_->CopyOut(query, consume, std::move(statement_cmd_ctl));
+    stats.AccountStatementExecution();
+    return res.RowsAffected();
+  } catch (const std::exception& e) {
+    stats.AccountStatementError();
+    throw;
+  }
+}
+
 Portal Transaction::MakePortal(const PortalName& portal_name,
                                const Query& query,
                                const detail::QueryParameters& params,
@@ -131,6 +179,7 @@ void Transaction::Commit() {
           });
     }
     conn_->Commit();
+    if (lsn_tracker_) lsn_tracker_->RecordCommit(lsn_tracker_key_, *conn_);
     // in case of exception inside commit let it fly and don't release the
     // connection holder to allow for rolling back later
     conn_ = detail::ConnectionPtr{nullptr};
@@ -12,8 +12,6 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::bench {
 
-namespace {
-
 Dsn GetDsnFromEnv() {
   auto* conn_list_env = std::getenv(kPostgresDsn);
   if (!conn_list_env) {
@@ -26,8 +24,6 @@ Dsn GetDsnFromEnv() {
   return by_host[0];
 }
 
-}  // namespace
-
 void PgConnection::RunStandalone(benchmark::State& state,
                                  std::function<void()> payload) {
   RunStandalone(state, 1, std::move(payload));
@@ -4,6 +4,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/options.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,6 +17,10 @@ inline constexpr uint32_t kConnectionId = 0;
 inline constexpr CommandControl kBenchCmdCtl{std::chrono::milliseconds{100},
                                              std::chrono::milliseconds{50}};
 
+/// Returns the first host of the benchmark DSN, or an empty DSN if the
+/// environment variable is not set
+Dsn GetDsnFromEnv();
+
 class PgConnection : public benchmark::Fixture {
  protected:
   bool IsConnectionValid() const;
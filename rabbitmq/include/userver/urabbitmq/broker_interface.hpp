@@ -4,6 +4,7 @@
 /// @brief A bunch of interface classes
 
 #include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/flags.hpp>
@@ -154,6 +155,27 @@ class IReliableChannelInterface {
                                const std::string& message,
                                engine::Deadline deadline) = 0;
 
+  /// @brief Publish messages to an exchange and
+  /// await confirmation of all of them from the broker
+  ///
+  /// Unlike calling `PublishReliable` for each message, this doesn't wait
+  /// for a confirmation before publishing the next message: up to
+  /// `max_in_flight_publishes` messages await confirmation at once, and
+  /// the broker may confirm many of them with a single ack.
+  ///
+  /// @param exchange the exchange to publish to
+  /// @param routing_key the routing key
+  /// @param messages the messages to send
+  /// @param deadline execution deadline
+  ///
+  /// @throws std::runtime_error on the first failed message; the messages
+  /// published before it may or may not be delivered
+  virtual void PublishReliableBatch(const Exchange& exchange,
+                                    const std::string& routing_key,
+                                    const std::vector<std::string>& messages,
+                                    MessageType type,
+                                    engine::Deadline deadline) = 0;
+
  protected:
   ~IReliableChannelInterface();
 };
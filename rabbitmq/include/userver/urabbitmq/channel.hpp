@@ -77,6 +77,12 @@ class ReliableChannel final : IReliableChannelInterface {
                     deadline);
   }
 
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type,
+                            engine::Deadline deadline) override;
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
@@ -101,6 +101,12 @@ class Client : public std::enable_shared_from_this<Client>,
                     deadline);
   }
 
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type,
+                            engine::Deadline deadline) override;
+
   /// @brief Get a reliable publisher interface for the broker
   /// (publisher-confirms)
   ///
@@ -74,6 +74,11 @@ struct PoolSettings final {
   /// (tcp error/protocol error/write timeout) leads to a errors burst:
   /// all outstanding request will fails at once
   size_t max_in_flight_requests = 5;
+
+  /// A per-connection limit for messages published by
+  /// `PublishReliableBatch` and not yet confirmed by the broker.
+  /// Increasing it allows one to publish more messages per round-trip
+  size_t max_in_flight_publishes = 100;
 };
 
 class TestsHelper;
@@ -49,6 +49,7 @@ namespace components {
 /// min_pool_size           | minimum connections pool size (per host)                             | 5
 /// max_pool_size           | maximum connections pool size (per host, consumers excluded)         | 10
 /// max_in_flight_requests  | per-connection limit for requests awaiting response from the broker  | 5
+/// max_in_flight_publishes | per-connection limit for batch published messages awaiting confirmation from the broker | 100
 /// use_secure_connection   | whether to use TLS for connections                                   | true
 ///
 // clang-format on
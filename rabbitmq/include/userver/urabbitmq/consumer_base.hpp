@@ -4,6 +4,7 @@
 /// @brief Base class for your consumers.
 
 #include <memory>
+#include <vector>
 
 #include <userver/utils/periodic_task.hpp>
 
@@ -77,6 +78,17 @@ class ConsumerBase {
   ///
   virtual void Process(ConsumedMessage msg) { Process(std::move(msg.message)); }
 
+  /// @brief You may override this method in derived class to handle many
+  /// messages at once, it is called instead of `Process` if
+  /// ConsumerSettings::process_batch_size is greater than 1. By default it
+  /// calls `Process(ConsumedMessage)` for every message one by one.
+  ///
+  /// If this method returns successfully all the messages would be acked, if
+  /// it throws all the messages of the batch would be requeued.
+  virtual void ProcessBatch(std::vector<ConsumedMessage> messages) {
+    for (auto& message : messages) Process(std::move(message));
+  }
+
  private:
   std::shared_ptr<Client> client_;
   const ConsumerSettings settings_;
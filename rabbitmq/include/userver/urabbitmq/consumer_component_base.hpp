@@ -4,6 +4,8 @@
 /// @brief Base component for your consumers.
 
 #include <memory>
+#include <vector>
+
 #include <userver/components/component_base.hpp>
 #include <userver/urabbitmq/typedefs.hpp>
 
@@ -38,6 +40,10 @@ namespace urabbitmq {
 /// rabbit_name      | Name of the RabbitMQ component to use for consumption
 /// queue            | Name of the queue to consume from
 /// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// ack_batch_size   | if greater than 1, processed messages are acked in batches of up to that many messages with a single ack; defaults to 1
+/// ack_max_delay    | max time a processed message waits for the batch ack; defaults to 20ms
+/// process_batch_size | if greater than 1, messages are passed to `ProcessBatch` in batches of up to that many messages; defaults to 1
+/// process_batch_max_delay | max time the first message of a batch waits for the other ones; defaults to 20ms
 ///
 // clang-format on
 class ConsumerComponentBase : public components::ComponentBase {
@@ -73,6 +79,17 @@ class ConsumerComponentBase : public components::ComponentBase {
   ///
   virtual void Process(ConsumedMessage msg) { Process(std::move(msg.message)); }
 
+  /// @brief You may override this method in derived class to handle many
+  /// messages at once, it is called instead of `Process` if
+  /// `process_batch_size` is greater than 1. By default it calls
+  /// `Process(ConsumedMessage)` for every message one by one.
+  ///
+  /// If this method returns successfully all the messages would be acked, if
+  /// it throws all the messages of the batch would be requeued.
+  virtual void ProcessBatch(std::vector<ConsumedMessage> messages) {
+    for (auto& message : messages) Process(std::move(message));
+  }
+
  private:
   // This is actually just a subclass of `ConsumerBase`
   class Impl;
@@ -3,6 +3,7 @@
 /// @file userver/urabbitmq/consumer_settings.hpp
 /// @brief Consumer settings.
 
+#include <chrono>
 #include <cstddef>
 
 #include <userver/urabbitmq/typedefs.hpp>
@@ -24,6 +25,25 @@ struct ConsumerSettings final {
   /// Settings this value to 1 basically makes a consumer synchronous, which
   /// could be of use for some workloads
   std::uint16_t prefetch_count;
+
+  /// If greater than 1, the processed messages are acknowledged in batches:
+  /// a single `basic.ack` with the `multiple` flag covers up to that many
+  /// deliveries. The broker counts the messages waiting for the batch ack
+  /// against the prefetch, so the consumer asks it for
+  /// `prefetch_count + ack_batch_size` messages to keep the handlers busy.
+  std::uint16_t ack_batch_size{1};
+
+  /// The time a processed message may wait for the batch acknowledgement
+  std::chrono::milliseconds ack_max_delay{20};
+
+  /// If greater than 1, the messages are passed to `ProcessBatch` of the
+  /// consumer in batches of up to that many messages. At most
+  /// `prefetch_count / process_batch_size` batches are processed concurrently,
+  /// so `prefetch_count` should be a multiple of `process_batch_size`.
+  std::uint16_t process_batch_size{1};
+
+  /// The time the first message of a batch waits for the other ones
+  std::chrono::milliseconds process_batch_max_delay{20};
 };
 
 }  // namespace urabbitmq
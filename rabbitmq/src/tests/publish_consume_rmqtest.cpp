@@ -1,5 +1,6 @@
 #include "utils_rmqtest.hpp"
 
+#include <algorithm>
 #include <optional>
 
 #include <userver/engine/sleep.hpp>
@@ -75,6 +76,38 @@ class ThrowingConsumer final : public urabbitmq::ConsumerBase {
   engine::ConditionVariable cond_;
 };
 
+class BatchConsumer final : public urabbitmq::ConsumerBase {
+ public:
+  using urabbitmq::ConsumerBase::ConsumerBase;
+  ~BatchConsumer() override { Stop(); }
+
+  void ProcessBatch(std::vector<urabbitmq::ConsumedMessage> messages) override {
+    auto max_batch_size = max_batch_size_.load();
+    while (max_batch_size < messages.size() &&
+           !max_batch_size_.compare_exchange_weak(max_batch_size,
+                                                  messages.size())) {
+    }
+    if ((consumed_ += messages.size()) == expected_consumed_) {
+      event_.Send();
+    }
+  }
+
+  void ExpectConsume(size_t count) { expected_consumed_ = count; }
+
+  size_t Wait() {
+    [[maybe_unused]] auto res = event_.WaitForEventFor(utest::kMaxTestWaitTime);
+    return consumed_;
+  }
+
+  size_t GetMaxBatchSize() const { return max_batch_size_; }
+
+ private:
+  std::atomic<size_t> expected_consumed_{0};
+  std::atomic<size_t> consumed_{0};
+  std::atomic<size_t> max_batch_size_{0};
+  engine::SingleConsumerEvent event_;
+};
+
 }  // namespace
 
 UTEST(Consumer, CreateOnInvalidQueueWorks) {
@@ -150,6 +183,94 @@ UTEST(Consumer, ExhaustesQueue) {
   consumer.Wait();
 }
 
+UTEST(Consumer, PublishReliableBatchWorks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  // More than `max_in_flight_publishes`, so that the window is exhausted
+  const size_t messages_count = 1000;
+  std::vector<std::string> messages;
+  for (size_t i = 0; i < messages_count; ++i) {
+    messages.push_back(std::to_string(i));
+  }
+  client->PublishReliableBatch(client.GetExchange(), client.GetRoutingKey(),
+                               messages, urabbitmq::MessageType::kTransient,
+                               client.GetDeadline());
+
+  {
+    auto channel = client->GetReliableChannel(client.GetDeadline());
+    channel.PublishReliableBatch(client.GetExchange(), client.GetRoutingKey(),
+                                 messages, urabbitmq::MessageType::kTransient,
+                                 client.GetDeadline());
+  }
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count * 2);
+  consumer.Start();
+
+  auto consumed = consumer.Wait();
+  ASSERT_EQ(consumed.size(), messages_count * 2);
+
+  auto expected = messages;
+  expected.insert(expected.end(), messages.begin(), messages.end());
+  std::sort(expected.begin(), expected.end());
+  std::sort(consumed.begin(), consumed.end());
+  EXPECT_EQ(consumed, expected);
+}
+
+UTEST(Consumer, BatchAckWorks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  urabbitmq::ConsumerSettings settings{client.GetQueue(), 20};
+  settings.ack_batch_size = 50;
+
+  const size_t messages_count = 1000;
+  for (size_t i = 0; i < messages_count; ++i) {
+    auto channel = client->GetReliableChannel(client.GetDeadline());
+    channel.PublishReliable(
+        client.GetExchange(), client.GetRoutingKey(), std::to_string(i),
+        urabbitmq::MessageType::kTransient, client.GetDeadline());
+  }
+
+  {
+    Consumer consumer{client.Get(), settings};
+    consumer.ExpectConsume(messages_count);
+    consumer.Start();
+    EXPECT_EQ(consumer.Wait().size(), messages_count);
+  }
+
+  // All the messages were acked, nothing is requeued
+  Consumer consumer{client.Get(), settings};
+  consumer.Start();
+  engine::InterruptibleSleepFor(std::chrono::milliseconds{200});
+  EXPECT_TRUE(consumer.Get().empty());
+}
+
+UTEST(Consumer, ProcessBatchWorks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  urabbitmq::ConsumerSettings settings{client.GetQueue(), 40};
+  settings.ack_batch_size = 20;
+  settings.process_batch_size = 10;
+
+  const size_t messages_count = 1000;
+  for (size_t i = 0; i < messages_count; ++i) {
+    auto channel = client->GetReliableChannel(client.GetDeadline());
+    channel.PublishReliable(
+        client.GetExchange(), client.GetRoutingKey(), std::to_string(i),
+        urabbitmq::MessageType::kTransient, client.GetDeadline());
+  }
+
+  BatchConsumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+
+  EXPECT_EQ(consumer.Wait(), messages_count);
+  EXPECT_LE(consumer.GetMaxBatchSize(), settings.process_batch_size);
+  EXPECT_GT(consumer.GetMaxBatchSize(), 1);
+}
+
 UTEST(Consumer, ThrowsReturnsToQueue) {
   ClientWrapper client{};
   client.SetupRmqEntities();
@@ -70,6 +70,12 @@ properties:
         description: |
           per-connection limit for requests awaiting response from the broker
         defaultDescription: 5
+    max_in_flight_publishes:
+        type: integer
+        description: |
+          per-connection limit for batch published messages awaiting
+          confirmation from the broker
+        defaultDescription: 100
     use_secure_connection:
         type: boolean
         description: whether to use TLS for connections
@@ -16,15 +16,16 @@ namespace {
 constexpr std::chrono::milliseconds kConnectionAcquisitionTimeout{1000};
 constexpr std::chrono::seconds kMonitorInterval{1};
 
-template <typename OnMessage>
+template <typename OnMessage, typename OnBatch>
 std::unique_ptr<ConsumerBaseImpl> CreateAndStartConsumerImpl(
     ClientImpl& client_impl, const ConsumerSettings& settings,
-    OnMessage&& on_message) {
+    OnMessage&& on_message, OnBatch&& on_batch) {
   auto impl = std::make_unique<ConsumerBaseImpl>(
       client_impl.GetConnection(
           engine::Deadline::FromDuration(kConnectionAcquisitionTimeout)),
       settings);
-  impl->Start(std::forward<OnMessage>(on_message));
+  impl->Start(std::forward<OnMessage>(on_message),
+              std::forward<OnBatch>(on_batch));
 
   return impl;
 }
@@ -51,7 +52,10 @@ void ConsumerBase::Start() {
   try {
     impl_ = CreateAndStartConsumerImpl(
         *client_->impl_, settings_,
-        [this](ConsumedMessage message) { Process(std::move(message)); });
+        [this](ConsumedMessage message) { Process(std::move(message)); },
+        [this](std::vector<ConsumedMessage> messages) {
+          ProcessBatch(std::move(messages));
+        });
   } catch (const std::exception& ex) {
     LOG_WARNING() << "Failed to start a consumer: '" << ex.what()
                   << "'; will try to start again";
@@ -70,10 +74,14 @@ void ConsumerBase::Start() {
             // nodes fail or we are just unlucky. Not sure how much of a problem
             // that is, but still
             impl_.reset();
-            impl_ = CreateAndStartConsumerImpl(*client_->impl_, settings_,
-                                               [this](ConsumedMessage message) {
-                                                 Process(std::move(message));
-                                               });
+            impl_ = CreateAndStartConsumerImpl(
+                *client_->impl_, settings_,
+                [this](ConsumedMessage message) {
+                  Process(std::move(message));
+                },
+                [this](std::vector<ConsumedMessage> messages) {
+                  ProcessBatch(std::move(messages));
+                });
             LOG_INFO() << "Restarted successfully";
           } catch (const std::exception& ex) {
             LOG_WARNING() << "Failed to restart a consumer: '" << ex.what()
@@ -1,9 +1,16 @@
 #include "consumer_base_impl.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <mutex>
 #include <string>
+#include <utility>
 
 #include <fmt/format.h>
 
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
@@ -21,15 +28,72 @@ namespace {
 
 constexpr std::chrono::milliseconds kStartTimeout{2000};
 
+uint16_t GetQosPrefetchCount(const ConsumerSettings& settings) {
+  std::size_t result = settings.prefetch_count;
+  // Messages waiting for the batch ack still occupy the prefetch
+  if (settings.ack_batch_size > 1) result += settings.ack_batch_size;
+  return std::min<std::size_t>(result, std::numeric_limits<uint16_t>::max());
+}
+
 }  // namespace
 
+AckBatcher::AckBatcher(std::size_t batch_size) : batch_size_{batch_size} {}
+
+bool AckBatcher::AddAck(uint64_t delivery_tag) {
+  ++pending_acks_;
+  Settle(delivery_tag, State::kAckPending);
+  return pending_acks_ >= batch_size_;
+}
+
+void AckBatcher::AddReject(uint64_t delivery_tag) {
+  Settle(delivery_tag, State::kSettled);
+}
+
+AckBatcher::Acks AckBatcher::Flush() {
+  Acks acks;
+  acks.multiple_up_to = std::exchange(multiple_up_to_, std::nullopt);
+  for (auto& [delivery_tag, state] : out_of_order_) {
+    if (state == State::kAckPending) {
+      acks.single.push_back(delivery_tag);
+      state = State::kSettled;
+    }
+  }
+  pending_acks_ = 0;
+  return acks;
+}
+
+void AckBatcher::Settle(uint64_t delivery_tag, State state) {
+  if (delivery_tag != first_unsettled_) {
+    out_of_order_.emplace(delivery_tag, state);
+    return;
+  }
+
+  if (state == State::kAckPending) multiple_up_to_ = delivery_tag;
+  ++first_unsettled_;
+  // Deliveries settled out of order are now covered by the `multiple` ack,
+  // unless they were already acked one by one
+  while (!out_of_order_.empty() &&
+         out_of_order_.begin()->first == first_unsettled_) {
+    if (out_of_order_.begin()->second == State::kAckPending) {
+      multiple_up_to_ = first_unsettled_;
+    }
+    out_of_order_.erase(out_of_order_.begin());
+    ++first_unsettled_;
+  }
+}
+
 ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
                                    const ConsumerSettings& settings)
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
-      prefetch_count_{settings.prefetch_count},
+      prefetch_count_{GetQosPrefetchCount(settings)},
+      ack_batch_size_{settings.ack_batch_size},
+      ack_max_delay_{settings.ack_max_delay},
+      process_batch_size_{settings.process_batch_size},
+      process_batch_max_delay_{settings.process_batch_max_delay},
       connection_ptr_{std::move(connection)},
-      channel_{connection_ptr_->GetChannel()} {
+      channel_{connection_ptr_->GetChannel()},
+      ack_batcher_{settings.ack_batch_size} {
   // We take ownership of the connection, because if it remains pooled
   // things get messy with lifetimes and callbacks
   connection_ptr_.Adopt();
@@ -37,11 +101,22 @@ ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
 
 ConsumerBaseImpl::~ConsumerBaseImpl() { Stop(); }
 
-void ConsumerBaseImpl::Start(DispatchCallback cb) {
+void ConsumerBaseImpl::Start(DispatchCallback cb,
+                             BatchDispatchCallback batch_cb) {
   const auto start_deadline = engine::Deadline::FromDuration(kStartTimeout);
   channel_.SetQos(prefetch_count_, start_deadline);
 
   dispatch_callback_ = std::move(cb);
+  batch_dispatch_callback_ = std::move(batch_cb);
+
+  if (ack_batch_size_ > 1) {
+    bts_.Detach(engine::AsyncNoSpan(dispatcher_, [this] {
+      while (!engine::current_task::ShouldCancel()) {
+        engine::InterruptibleSleepFor(ack_max_delay_);
+        FlushAcks();
+      }
+    }));
+  }
 
   LOG_INFO() << "Starting a consumer for '" << queue_name_ << "' queue";
 
@@ -78,6 +153,8 @@ void ConsumerBaseImpl::Stop() {
 
   // Cancel all the active dispatched tasks
   bts_.CancelAndWait();
+  // Acks of the already processed messages are not waiting for the batch
+  FlushAcks();
 
   // Destroy the connection: at this point all the remaining tasks are stopped,
   // consumer is either stopped or in unknown state - that could happen if we
@@ -93,46 +170,144 @@ bool ConsumerBaseImpl::IsBroken() const {
 
 void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
                                  uint64_t delivery_tag) {
+  Delivery delivery;
+  delivery.consumed.message = std::string(message.body(), message.bodySize());
+  delivery.consumed.metadata.exchange = message.exchange();
+  delivery.consumed.metadata.routingKey = message.routingkey();
+  delivery.trace_id = message.headers().get("u-trace-id");
+  delivery.parent_span_id = message.headers().get("u-parent-span-id");
+  delivery.delivery_tag = delivery_tag;
+
+  if (process_batch_size_ > 1) {
+    AddToBatch(std::move(delivery));
+  } else {
+    Dispatch(std::move(delivery));
+  }
+}
+
+void ConsumerBaseImpl::Dispatch(Delivery&& delivery) {
   std::string span_name{fmt::format("consume_{}_{}", queue_name_,
                                     consumer_tag_.value_or("ctag:unknown"))};
-  std::string trace_id = message.headers().get("u-trace-id");
-  std::string parent_span_id = message.headers().get("u-parent-span-id");
-  ConsumedMessage consumed;
-  consumed.message = std::string(message.body(), message.bodySize());
-  consumed.metadata.exchange = message.exchange();
-  consumed.metadata.routingKey = message.routingkey();
 
   bts_.Detach(engine::AsyncNoSpan(
-      dispatcher_,
-      [this, consumed = std::move(consumed), span_name = std::move(span_name),
-       trace_id = std::move(trace_id),
-       parent_span_id = std::move(parent_span_id), delivery_tag]() mutable {
-        auto span = tracing::Span::MakeSpan(std::move(span_name), trace_id,
-                                            {parent_span_id});
+      dispatcher_, [this, delivery = std::move(delivery),
+                    span_name = std::move(span_name)]() mutable {
+        auto span = tracing::Span::MakeSpan(
+            std::move(span_name), delivery.trace_id, {delivery.parent_span_id});
         bool success = false;
         try {
-          dispatch_callback_(std::move(consumed));
+          dispatch_callback_(std::move(delivery.consumed));
           success = true;
         } catch (const std::exception& ex) {
           LOG_ERROR() << "Failed to process the consumed message, " << ex.what()
                       << "; would requeue";
         }
 
-        try {
-          if (success) {
-            channel_.Ack(delivery_tag, {});
-            channel_.AccountMessageConsumed();
-          } else {
-            channel_.Reject(delivery_tag, true, {});
-          }
-        } catch (const std::exception& ex) {
-          LOG_WARNING()
-              << "Failed to " << (success ? "ack" : "requeue")
-              << " the message, it will be requeued by RabbitMQ at some point";
-        }
+        Settle(delivery.delivery_tag, success);
       }));
 }
 
+void ConsumerBaseImpl::AddToBatch(Delivery&& delivery) {
+  std::shared_ptr<PendingBatch> batch;
+  bool is_new_batch = false;
+  {
+    std::lock_guard lock{batch_mutex_};
+    if (!current_batch_) {
+      current_batch_ = std::make_shared<PendingBatch>();
+      is_new_batch = true;
+    }
+    batch = current_batch_;
+    batch->deliveries.push_back(std::move(delivery));
+
+    if (batch->deliveries.size() >= process_batch_size_) {
+      current_batch_.reset();
+      batch->is_full.Send();
+    }
+  }
+
+  if (is_new_batch) {
+    bts_.Detach(engine::AsyncNoSpan(
+        dispatcher_, [this, batch] { DispatchBatch(*batch); }));
+  }
+}
+
+void ConsumerBaseImpl::DispatchBatch(PendingBatch& batch) {
+  [[maybe_unused]] const bool is_full =
+      batch.is_full.WaitForEventFor(process_batch_max_delay_);
+  {
+    std::lock_guard lock{batch_mutex_};
+    if (current_batch_.get() == &batch) current_batch_.reset();
+  }
+
+  // No more deliveries are added to the batch
+  tracing::Span span{fmt::format("consume_batch_{}_{}", queue_name_,
+                                 consumer_tag_.value_or("ctag:unknown"))};
+  std::vector<ConsumedMessage> messages;
+  messages.reserve(batch.deliveries.size());
+  for (auto& delivery : batch.deliveries) {
+    messages.push_back(std::move(delivery.consumed));
+  }
+
+  bool success = false;
+  try {
+    batch_dispatch_callback_(std::move(messages));
+    success = true;
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to process a batch of " << batch.deliveries.size()
+                << " consumed messages, " << ex.what() << "; would requeue";
+  }
+
+  for (const auto& delivery : batch.deliveries) {
+    Settle(delivery.delivery_tag, success);
+  }
+}
+
+void ConsumerBaseImpl::Settle(uint64_t delivery_tag, bool success) {
+  try {
+    if (ack_batch_size_ <= 1) {
+      if (success) {
+        channel_.Ack(delivery_tag, {});
+      } else {
+        channel_.Reject(delivery_tag, true, {});
+      }
+    } else {
+      std::lock_guard lock{ack_mutex_};
+      if (!success) {
+        ack_batcher_.AddReject(delivery_tag);
+        channel_.Reject(delivery_tag, true, {});
+      } else if (ack_batcher_.AddAck(delivery_tag)) {
+        SendAcks(ack_batcher_.Flush());
+      }
+    }
+    if (success) channel_.AccountMessageConsumed();
+  } catch (const std::exception& ex) {
+    LOG_WARNING()
+        << "Failed to " << (success ? "ack" : "requeue")
+        << " the message, it will be requeued by RabbitMQ at some point";
+  }
+}
+
+void ConsumerBaseImpl::FlushAcks() {
+  if (ack_batch_size_ <= 1) return;
+
+  try {
+    std::lock_guard lock{ack_mutex_};
+    SendAcks(ack_batcher_.Flush());
+  } catch (const std::exception&) {
+    LOG_WARNING() << "Failed to ack a batch of messages, they will be "
+                     "requeued by RabbitMQ at some point";
+  }
+}
+
+void ConsumerBaseImpl::SendAcks(AckBatcher::Acks&& acks) {
+  if (acks.multiple_up_to.has_value()) {
+    channel_.AckMultiple(*acks.multiple_up_to, {});
+  }
+  for (const auto delivery_tag : acks.single) {
+    channel_.Ack(delivery_tag, {});
+  }
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,8 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
 
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
@@ -19,6 +26,40 @@ namespace impl {
 class AmqpChannel;
 }
 
+// Tracks the settled deliveries of a channel to acknowledge them in batches.
+// Delivery tags of a channel are consecutive and start from 1.
+class AckBatcher final {
+ public:
+  struct Acks final {
+    // All the deliveries up to this one are acked with the `multiple` flag
+    std::optional<uint64_t> multiple_up_to;
+    // Deliveries separated from `multiple_up_to` by the ones still being
+    // processed, these are acked one by one
+    std::vector<uint64_t> single;
+  };
+
+  explicit AckBatcher(std::size_t batch_size);
+
+  // Returns true if the batch is full and should be flushed
+  bool AddAck(uint64_t delivery_tag);
+
+  // The delivery is rejected right away, it is only tracked here
+  void AddReject(uint64_t delivery_tag);
+
+  Acks Flush();
+
+ private:
+  enum class State { kAckPending, kSettled };
+
+  void Settle(uint64_t delivery_tag, State state);
+
+  const std::size_t batch_size_;
+  uint64_t first_unsettled_{1};
+  std::optional<uint64_t> multiple_up_to_;
+  std::map<uint64_t, State> out_of_order_;
+  std::size_t pending_acks_{0};
+};
+
 class ConsumerBaseImpl final {
  public:
   ConsumerBaseImpl(ConnectionPtr&& connection,
@@ -26,18 +67,42 @@ class ConsumerBaseImpl final {
   ~ConsumerBaseImpl();
 
   using DispatchCallback = std::function<void(ConsumedMessage)>;
+  using BatchDispatchCallback =
+      std::function<void(std::vector<ConsumedMessage>)>;
 
-  void Start(DispatchCallback cb);
+  void Start(DispatchCallback cb, BatchDispatchCallback batch_cb);
 
   bool IsBroken() const;
 
  private:
+  struct Delivery final {
+    ConsumedMessage consumed;
+    std::string trace_id;
+    std::string parent_span_id;
+    uint64_t delivery_tag{0};
+  };
+
+  struct PendingBatch final {
+    std::vector<Delivery> deliveries;
+    engine::SingleConsumerEvent is_full;
+  };
+
   void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
+  void Dispatch(Delivery&& delivery);
+  void AddToBatch(Delivery&& delivery);
+  void DispatchBatch(PendingBatch& batch);
+  void Settle(uint64_t delivery_tag, bool success);
+  void FlushAcks();
+  void SendAcks(AckBatcher::Acks&& acks);
   void Stop();
 
   engine::TaskProcessor& dispatcher_;
   const std::string queue_name_;
   uint16_t prefetch_count_;
+  const uint16_t ack_batch_size_;
+  const std::chrono::milliseconds ack_max_delay_;
+  const uint16_t process_batch_size_;
+  const std::chrono::milliseconds process_batch_max_delay_;
 
   ConnectionPtr connection_ptr_;
   impl::AmqpChannel& channel_;
@@ -45,6 +110,15 @@ class ConsumerBaseImpl final {
   std::optional<std::string> consumer_tag_;
 
   DispatchCallback dispatch_callback_;
+  BatchDispatchCallback batch_dispatch_callback_;
+
+  // Acks and rejects are sent under the lock when batching, otherwise
+  // a `multiple` ack could overtake a reject of a delivery it covers
+  engine::Mutex ack_mutex_;
+  AckBatcher ack_batcher_;
+
+  engine::Mutex batch_mutex_;
+  std::shared_ptr<PendingBatch> current_batch_;
 
   std::atomic<bool> stopped_{false};
 
@@ -1,4 +1,6 @@
+#include <chrono>
 #include <string>
+#include <vector>
 
 #include <userver/urabbitmq/consumer_component_base.hpp>
 
@@ -18,8 +20,20 @@ ConsumerSettings Parse(const yaml_config::YamlConfig& config,
   ConsumerSettings settings;
   settings.queue = Queue{config["queue"].As<std::string>()};
   settings.prefetch_count = config["prefetch_count"].As<uint16_t>();
+  settings.ack_batch_size =
+      config["ack_batch_size"].As<uint16_t>(settings.ack_batch_size);
+  settings.ack_max_delay =
+      config["ack_max_delay"].As<std::chrono::milliseconds>(
+          settings.ack_max_delay);
+  settings.process_batch_size =
+      config["process_batch_size"].As<uint16_t>(settings.process_batch_size);
+  settings.process_batch_max_delay =
+      config["process_batch_max_delay"].As<std::chrono::milliseconds>(
+          settings.process_batch_max_delay);
 
   UINVARIANT(settings.prefetch_count > 0, "prefetch_count is set to zero");
+  UINVARIANT(settings.prefetch_count >= settings.process_batch_size,
+             "prefetch_count is less than process_batch_size");
 
   return settings;
 }
@@ -47,6 +61,11 @@ class ConsumerComponentBase::Impl final : public ConsumerBase {
     parent_->Process(std::move(msg));
   }
 
+  void ProcessBatch(std::vector<ConsumedMessage> messages) override {
+    UASSERT(parent_ != nullptr);
+    parent_->ProcessBatch(std::move(messages));
+  }
+
  private:
   ConsumerComponentBase* parent_{nullptr};
 };
@@ -83,6 +102,26 @@ properties:
     prefetch_count:
         type: integer
         description: prefetch_count for the consumer
+    ack_batch_size:
+        type: integer
+        description: |
+            if greater than 1, processed messages are acked in batches of up to
+            that many messages with a single ack
+        defaultDescription: 1
+    ack_max_delay:
+        type: string
+        description: max time a processed message waits for the batch ack
+        defaultDescription: 20ms
+    process_batch_size:
+        type: integer
+        description: |
+            if greater than 1, messages are passed to ProcessBatch in batches
+            of up to that many messages
+        defaultDescription: 1
+    process_batch_max_delay:
+        type: string
+        description: max time the first message of a batch waits for the others
+        defaultDescription: 20ms
 )");
 }
 
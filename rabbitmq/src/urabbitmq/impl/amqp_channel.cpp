@@ -1,7 +1,11 @@
 #include "amqp_channel.hpp"
 
+#include <atomic>
+#include <mutex>
 #include <optional>
 
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/tracing/span.hpp>
 
@@ -72,6 +76,53 @@ AMQP::Table CreateHeaders() {
   return headers;
 }
 
+// Tracks the confirms of the messages published by a batch. The callbacks
+// are invoked by the connection reader task.
+class PublishBatchState final {
+ public:
+  void OnPublished() { in_flight_.fetch_add(1); }
+
+  void OnConfirmed() {
+    in_flight_.fetch_sub(1);
+    event_.Send();
+  }
+
+  void OnFailed(const char* error) {
+    UASSERT(error);
+    {
+      std::lock_guard lock{mutex_};
+      if (!error_.has_value()) error_.emplace(error);
+    }
+    in_flight_.fetch_sub(1);
+    event_.Send();
+  }
+
+  // Waits until no more than `max_in_flight` messages await confirmation
+  void WaitInFlightAtMost(size_t max_in_flight, engine::Deadline deadline) {
+    while (true) {
+      ThrowIfFailed();
+      if (in_flight_.load() <= max_in_flight) return;
+
+      if (!event_.WaitForEventUntil(deadline)) {
+        throw std::runtime_error{"Operation timeout"};
+      }
+    }
+  }
+
+ private:
+  void ThrowIfFailed() {
+    std::lock_guard lock{mutex_};
+    if (error_.has_value()) {
+      throw std::runtime_error{*error_};
+    }
+  }
+
+  std::atomic<size_t> in_flight_{0};
+  engine::SingleConsumerEvent event_;
+  engine::Mutex mutex_;
+  std::optional<std::string> error_;
+};
+
 }  // namespace
 
 AmqpChannel::AmqpChannel(AmqpConnection& conn) : conn_{conn} {}
@@ -187,6 +238,13 @@ void AmqpChannel::Ack(uint64_t delivery_tag, engine::Deadline deadline) {
   channel->ack(delivery_tag);
 }
 
+void AmqpChannel::AckMultiple(uint64_t delivery_tag,
+                              engine::Deadline deadline) {
+  // No way to acknowledge success, no way to handle synchronous errors
+  auto channel = conn_.GetChannel(deadline);
+  channel->ack(delivery_tag, AMQP::multiple);
+}
+
 void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue,
                          engine::Deadline deadline) {
   // No way to acknowledge success, no way to handle synchronous errors
@@ -230,7 +288,9 @@ void AmqpChannel::AccountMessageConsumed() {
   conn_.GetStatistics().AccountMessageConsumed();
 }
 
-AmqpReliableChannel::AmqpReliableChannel(AmqpConnection& conn) : conn_{conn} {}
+AmqpReliableChannel::AmqpReliableChannel(AmqpConnection& conn,
+                                         size_t max_in_flight_publishes)
+    : conn_{conn}, max_in_flight_publishes_{max_in_flight_publishes} {}
 
 AmqpReliableChannel::~AmqpReliableChannel() = default;
 
@@ -261,6 +321,39 @@ ResponseAwaiter AmqpReliableChannel::Publish(const Exchange& exchange,
   return awaiter;
 }
 
+void AmqpReliableChannel::PublishBatch(const Exchange& exchange,
+                                       const std::string& routing_key,
+                                       const std::vector<std::string>& messages,
+                                       MessageType type,
+                                       engine::Deadline deadline) {
+  const auto headers = CreateHeaders();
+  auto state = std::make_shared<PublishBatchState>();
+
+  for (const auto& message : messages) {
+    state->WaitInFlightAtMost(max_in_flight_publishes_ - 1, deadline);
+
+    AMQP::Envelope envelope{message.data(), message.size()};
+    envelope.setPersistent(type == MessageType::kPersistent);
+    envelope.setHeaders(headers);
+
+    state->OnPublished();
+    {
+      auto reliable = conn_.GetReliableChannel(deadline);
+
+      // Reliable tracks the delivery tags, so a single multiple-ack from the
+      // broker confirms all the messages it covers
+      reliable->publish(exchange.GetUnderlying(), routing_key, envelope)
+          .onAck([this, state] {
+            AccountMessagePublished();
+            state->OnConfirmed();
+          })
+          .onError([state](const char* error) { state->OnFailed(error); });
+    }
+  }
+
+  state->WaitInFlightAtMost(0, deadline);
+}
+
 void AmqpReliableChannel::AccountMessagePublished() {
   conn_.GetStatistics().AccountMessagePublished();
 }
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/assert.hpp>
@@ -59,6 +62,9 @@ class AmqpChannel final {
 
   void Ack(uint64_t delivery_tag, engine::Deadline deadline);
 
+  // Acknowledges all the unacked deliveries up to and including delivery_tag
+  void AckMultiple(uint64_t delivery_tag, engine::Deadline deadline);
+
   void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
   void SetQos(uint16_t prefetch_count, engine::Deadline deadline);
@@ -82,7 +88,7 @@ class AmqpChannel final {
 
 class AmqpReliableChannel final {
  public:
-  AmqpReliableChannel(AmqpConnection& conn);
+  AmqpReliableChannel(AmqpConnection& conn, size_t max_in_flight_publishes);
   ~AmqpReliableChannel();
 
   ResponseAwaiter Publish(const Exchange& exchange,
@@ -90,10 +96,18 @@ class AmqpReliableChannel final {
                           const std::string& message, MessageType type,
                           engine::Deadline deadline);
 
+  /// Publishes the messages without waiting for each confirm: at most
+  /// `max_in_flight_publishes_` of them await confirmation at once.
+  /// Returns when all the messages are confirmed, throws on the first error.
+  void PublishBatch(const Exchange& exchange, const std::string& routing_key,
+                    const std::vector<std::string>& messages,
+                    MessageType type, engine::Deadline deadline);
+
  private:
   void AccountMessagePublished();
 
   AmqpConnection& conn_;
+  const size_t max_in_flight_publishes_;
 };
 
 }  // namespace urabbitmq::impl
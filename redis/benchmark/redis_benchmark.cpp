@@ -69,6 +69,45 @@ BENCHMARK_DEFINE_TEMPLATE_F(Redis, PipelineGrind)(benchmark::State& state) {
   });
 }
 
+// Arguments are the number of requests in flight and the buffering interval
+// in microseconds (0 disables the buffering)
+BENCHMARK_DEFINE_F(Redis, CommandsPerWrite)(benchmark::State& state) {
+  RunStandalone([this, &state] {
+    USERVER_NAMESPACE::redis::CommandsBufferingSettings buffering_settings;
+    buffering_settings.buffering_enabled = state.range(1) != 0;
+    buffering_settings.watch_command_timer_interval =
+        std::chrono::microseconds{state.range(1)};
+    GetSentinel()->SetCommandsBufferingSettings(buffering_settings);
+
+    auto request_generator = Ping{GetClient(), {}};
+    std::deque<Ping::RequestType> requests;
+
+    for (auto i = 0; i < state.range(0); ++i) {
+      requests.push_back(request_generator(state));
+    }
+
+    for (auto _ : state) {
+      requests.front().Get();
+      requests.pop_front();
+      requests.push_back(request_generator(state));
+    }
+
+    for (; !requests.empty(); requests.pop_front()) requests.front().Get();
+
+    const auto stats = GetSentinel()->GetStatistics({});
+    const auto total = stats.GetShardGroupTotalStatistics();
+    const auto& commands_per_write = total.commands_per_write_percentile;
+    for (auto p : {50, 99}) {
+      state.counters["commands_per_write_p" + std::to_string(p)] =
+          commands_per_write.GetPercentile(p);
+    }
+    state.counters["p99"] = total.timings_percentile.GetPercentile(99);
+  });
+}
+
+BENCHMARK_REGISTER_F(Redis, CommandsPerWrite)
+    ->ArgsProduct({{8, 32, 128}, {0, 100, 1000}});
+
 BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Ping)
     ->RangeMultiplier(2)
     ->Range(4, 32);
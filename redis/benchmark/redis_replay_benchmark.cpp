@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include <benchmark/benchmark.h>
+
+#include <storages/redis/impl/sentinel.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/storages/redis/impl/base.hpp>
+#include <utils/gbench_replay.hpp>
+
+#include "redis_fixture.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+namespace {
+
+// Path to a trace to replay instead of the default one. The output of
+// `redis-cli MONITOR` is accepted as is.
+constexpr const char* kTraceEnv = "REDIS_BENCHMARK_TRACE";
+
+// A sample of a session storage traffic
+constexpr std::string_view kDefaultTrace = R"(
+SET session:1 "{\"user\":1,\"roles\":[\"admin\"]}" EX 600
+GET session:1
+SET session:2 "{\"user\":2,\"roles\":[]}" EX 600
+GET session:2
+GET session:1
+EXPIRE session:1 600
+HSET profile:1 name "John Doe" locale en
+HGET profile:1 name
+HGETALL profile:1
+INCR counter:logins
+GET session:3
+SET session:3 "{\"user\":3,\"roles\":[\"reader\"]}" EX 600
+GET session:3
+MGET session:1 session:2 session:3
+DEL session:2
+PING
+)";
+
+// The commands that block, change the state of the connection or of the
+// whole server make no sense in a replay
+const std::unordered_set<std::string> kSkippedCommands{
+    "BLMOVE",   "BLPOP",     "BRPOP",   "BRPOPLPUSH", "BZPOPMAX",
+    "BZPOPMIN", "CLIENT",    "CONFIG",  "DEBUG",      "DISCARD",
+    "EXEC",     "FLUSHALL",  "FLUSHDB", "MONITOR",    "MULTI",
+    "PSUBSCRIBE", "QUIT",    "SELECT",  "SHUTDOWN",   "SUBSCRIBE",
+    "UNWATCH",  "WAIT",      "WATCH"};
+
+// Strips the `<timestamp> [<db> <address>]` prefix of the MONITOR output
+void StripMonitorPrefix(utils::bench::TraceRecord& record) {
+  auto& tokens = record.tokens;
+  if (tokens.size() < 3 || tokens[1].empty() || tokens[1].front() != '[') {
+    return;
+  }
+  const auto prefix_end =
+      std::find_if(tokens.begin() + 1, tokens.end(), [](const auto& token) {
+        return !token.empty() && token.back() == ']';
+      });
+  if (prefix_end != tokens.end()) tokens.erase(tokens.begin(), prefix_end + 1);
+}
+
+utils::bench::Trace LoadTrace() {
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  const auto* trace_path = std::getenv(kTraceEnv);
+  auto trace = utils::bench::ParseTrace(
+      trace_path ? fs::blocking::ReadFileContents(trace_path)
+                 : std::string{kDefaultTrace});
+
+  for (auto& record : trace) {
+    StripMonitorPrefix(record);
+    if (record.tokens.empty()) continue;
+    for (auto& c : record.tokens.front()) {
+      c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+  }
+  trace.erase(std::remove_if(trace.begin(), trace.end(),
+                             [](const auto& record) {
+                               return record.tokens.empty() ||
+                                      record.Operation() == "OK" ||
+                                      kSkippedCommands.count(
+                                          record.Operation()) != 0;
+                             }),
+              trace.end());
+  return trace;
+}
+
+}  // namespace
+
+// Argument is the number of requests in flight
+BENCHMARK_DEFINE_F(Redis, Replay)(benchmark::State& state) {
+  const auto trace = LoadTrace();
+  RunStandalone([this, &state, &trace] {
+    const auto sentinel = GetSentinel();
+    utils::bench::Replay(
+        state, trace, state.range(0),
+        [&sentinel](const utils::bench::TraceRecord& record) {
+          const auto& key =
+              record.tokens.size() > 1 ? record.tokens[1] : record.tokens[0];
+          return sentinel->MakeRequest({record.tokens}, key);
+        });
+  });
+}
+BENCHMARK_REGISTER_F(Redis, Replay)->Arg(1)->Arg(16)->Arg(64);
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,66 @@
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <hiredis/hiredis.h>
+
+#include <storages/redis/impl/reply_data_reader.hpp>
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis::bench {
+
+namespace {
+
+struct ReaderDeleter {
+  void operator()(redisReader* reader) const { redisReaderFree(reader); }
+};
+
+using ReaderPtr = std::unique_ptr<redisReader, ReaderDeleter>;
+
+// Array reply of the given number of bulk strings, like the one of MGET
+std::string MakeArrayReply(std::size_t elements, std::size_t value_size) {
+  const std::string value(value_size, 'x');
+  std::string result = "*" + std::to_string(elements) + "\r\n";
+  for (std::size_t i = 0; i < elements; ++i) {
+    result += "$" + std::to_string(value_size) + "\r\n" + value + "\r\n";
+  }
+  return result;
+}
+
+template <typename Convert>
+void ParseReplies(benchmark::State& state, bool reply_data_reader,
+                  Convert convert) {
+  const auto reply = MakeArrayReply(state.range(0), state.range(1));
+  ReaderPtr reader{redisReaderCreate()};
+  if (reply_data_reader) UseReplyDataReader(*reader);
+
+  for (auto _ : state) {
+    redisReaderFeed(reader.get(), reply.data(), reply.size());
+    void* hiredis_reply = nullptr;
+    redisReaderGetReply(reader.get(), &hiredis_reply);
+    auto data = convert(hiredis_reply);
+    reader->fn->freeObject(hiredis_reply);
+    benchmark::DoNotOptimize(data);
+  }
+  state.SetBytesProcessed(state.iterations() * reply.size());
+}
+
+}  // namespace
+
+void ReplyParseHiredis(benchmark::State& state) {
+  ParseReplies(state, false, [](void* reply) {
+    return ReplyData{static_cast<const redisReply*>(reply)};
+  });
+}
+BENCHMARK(ReplyParseHiredis)->Args({10000, 16})->Args({10000, 256});
+
+void ReplyParseReplyDataReader(benchmark::State& state) {
+  ParseReplies(state, true, [](void* reply) { return TakeReplyData(reply); });
+}
+BENCHMARK(ReplyParseReplyDataReader)->Args({10000, 16})->Args({10000, 256});
+
+}  // namespace redis::bench
+
+USERVER_NAMESPACE_END
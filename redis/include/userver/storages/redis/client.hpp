@@ -13,6 +13,7 @@
 #include <userver/storages/redis/bit_operation.hpp>
 #include <userver/storages/redis/client_fwd.hpp>
 #include <userver/storages/redis/command_options.hpp>
+#include <userver/storages/redis/hash_struct.hpp>
 #include <userver/storages/redis/request.hpp>
 #include <userver/storages/redis/request_eval.hpp>
 #include <userver/storages/redis/request_evalsha.hpp>
@@ -175,6 +176,14 @@ class Client {
   virtual RequestHgetall Hgetall(std::string key,
                                  const CommandControl& command_control) = 0;
 
+  /// HGETALL parsed right into the aggregate `Struct`, see HashFieldNames
+  template <typename Struct>
+  RequestHgetallStruct<Struct> HgetallStruct(
+      std::string key, const CommandControl& command_control) {
+    return RequestHgetallStruct<Struct>{
+        HgetallCommon(std::move(key), command_control)};
+  }
+
   virtual RequestHincrby Hincrby(std::string key, std::string field,
                                  int64_t increment,
                                  const CommandControl& command_control) = 0;
@@ -198,6 +207,14 @@ class Client {
       std::vector<std::pair<std::string, std::string>> field_values,
       const CommandControl& command_control) = 0;
 
+  /// HMSET of the members of the aggregate `Struct`, see HashFieldNames
+  template <typename Struct>
+  RequestHmset HmsetStruct(std::string key, Struct value,
+                           const CommandControl& command_control) {
+    return Hmset(std::move(key), SerializeHashStruct(std::move(value)),
+                 command_control);
+  }
+
   virtual RequestHscan Hscan(std::string key, HscanOptions options,
                              const CommandControl& command_control) = 0;
 
@@ -493,6 +510,8 @@ class Client {
   virtual RequestEvalShaCommon EvalShaCommon(
       std::string script_hash, std::vector<std::string> keys,
       std::vector<std::string> args, const CommandControl& command_control) = 0;
+  virtual RequestHgetallCommon HgetallCommon(
+      std::string key, const CommandControl& command_control) = 0;
 };
 
 std::string CreateTmpKey(const std::string& key, std::string prefix);
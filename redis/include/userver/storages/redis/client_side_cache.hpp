@@ -0,0 +1,90 @@
+#pragma once
+
+/// @file userver/storages/redis/client_side_cache.hpp
+/// @brief @copybrief storages::redis::ClientSideCache
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// Settings of storages::redis::ClientSideCache
+struct ClientSideCacheSettings final {
+  /// Maximum number of cached keys in each shard, least recently used keys
+  /// are evicted
+  std::size_t max_keys_per_shard{10000};
+
+  /// Cached values are dropped after this time even without an invalidation,
+  /// bounds the staleness caused by lost invalidation messages
+  std::chrono::milliseconds ttl{std::chrono::seconds{10}};
+};
+
+/// @ingroup userver_clients
+///
+/// @brief Server-assisted local cache of hot keys in front of
+/// storages::redis::Client::Get(), Hget() and Mget().
+///
+/// Requires a storages::redis::SubscribeClient of the same shard group with
+/// `client_tracking` enabled in components::Redis static config. Its
+/// connections enable `CLIENT TRACKING` in broadcasting mode and receive
+/// invalidations of every modified key via the `__redis__:invalidate`
+/// channel, cached values of such keys are dropped.
+///
+/// Missing values are read from the master, so that an invalidation
+/// received from any host of the shard makes the following reads see the
+/// modification. Values are not cached if an invalidation of the key is
+/// received while the read is in flight.
+///
+/// Messages may be lost on reconnects, subscription rebalancing or
+/// subscription queue overflow, ClientSideCacheSettings::ttl bounds the
+/// staleness in such cases. `FLUSHDB` and `FLUSHALL` are not handled.
+///
+/// @warning Not supported for Redis Cluster, as its nodes do not propagate
+/// invalidations.
+///
+/// @par Usage synopsis
+/// @code
+/// storages::redis::ClientSideCache cache{
+///     redis.GetClient("db"), redis.GetSubscribeClient("db-tracking")};
+/// auto value = cache.Get("hot-key", {});
+/// @endcode
+class ClientSideCache final {
+ public:
+  ClientSideCache(ClientPtr client, SubscribeClientPtr invalidations_client,
+                  ClientSideCacheSettings settings = {});
+  ~ClientSideCache();
+
+  ClientSideCache(const ClientSideCache&) = delete;
+  ClientSideCache& operator=(const ClientSideCache&) = delete;
+
+  /// @brief Returns the cached value of `GET key` or reads it from the master
+  std::optional<std::string> Get(std::string key,
+                                 const CommandControl& command_control);
+
+  /// @brief Returns the cached value of `HGET key field` or reads it from the
+  /// master
+  std::optional<std::string> Hget(std::string key, std::string field,
+                                  const CommandControl& command_control);
+
+  /// @brief Returns the cached values of `MGET keys...`, the missing ones are
+  /// read from the master by a single `MGET`
+  std::vector<std::optional<std::string>> Mget(
+      std::vector<std::string> keys, const CommandControl& command_control);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
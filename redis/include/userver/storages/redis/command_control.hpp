@@ -83,6 +83,11 @@ struct CommandControl {
 
     /// Send requests to 'best_dc_count' Redis instances with the min ping
     kNearestServerPing,
+
+    /// Send requests to the less loaded of two random instances, the load
+    /// is estimated by the average reply time and the number of running
+    /// commands. Supported in cluster mode only, same as kEveryDc otherwise
+    kLowestLatency,
   };
 
   /// Timeout for a single attempt to execute command
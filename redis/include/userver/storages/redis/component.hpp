@@ -68,6 +68,8 @@ namespace components {
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
 /// subscribe_groups.[].sharding_strategy | either RedisCluster or KeyShardTaximeterCrc32 | "KeyShardTaximeterCrc32"
+/// subscribe_groups.[].allow_reads_from_master | allows subscriptions to master instance to distribute load | false
+/// subscribe_groups.[].client_tracking | receive key invalidations for storages::redis::ClientSideCache, not supported in cluster mode | false
 ///
 /// ## Static configuration example:
 ///
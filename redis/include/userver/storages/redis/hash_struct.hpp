@@ -0,0 +1,190 @@
+#pragma once
+
+/// @file userver/storages/redis/hash_struct.hpp
+/// @brief Mapping of aggregate structs to Redis hashes
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/core_name.hpp>
+#include <fmt/format.h>
+
+#include <userver/storages/redis/exception.hpp>
+#include <userver/storages/redis/parse_reply.hpp>
+#include <userver/storages/redis/reply.hpp>
+#include <userver/storages/redis/request.hpp>
+#include <userver/utils/from_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// @brief Names of the hash fields of the aggregate `T`.
+///
+/// With C++20 the names of the struct members are used by default. Otherwise
+/// specialize the template with a
+/// `static constexpr std::array<std::string_view, N> kNames` member listing
+/// the hash field name of every struct member in the declaration order.
+///
+/// Supported member types: std::string, arithmetic types and std::optional of
+/// them. Members missing in the hash keep their default values, std::nullopt
+/// members are not written.
+template <typename T>
+struct HashFieldNames {};
+
+namespace impl {
+
+template <typename T, typename = void>
+struct HasHashFieldNames : std::false_type {};
+
+template <typename T>
+struct HasHashFieldNames<T, std::void_t<decltype(HashFieldNames<T>::kNames)>>
+    : std::true_type {};
+
+template <typename T>
+constexpr auto GetHashFieldNames() {
+  static_assert(std::is_aggregate_v<T>, "T must be an aggregate");
+  if constexpr (HasHashFieldNames<T>::value) {
+    static_assert(HashFieldNames<T>::kNames.size() ==
+                      boost::pfr::tuple_size_v<T>,
+                  "HashFieldNames<T>::kNames must name every member of T");
+    return HashFieldNames<T>::kNames;
+  } else {
+#if BOOST_PFR_CORE_NAME_ENABLED
+    return boost::pfr::names_as_array<T>();
+#else
+    static_assert(sizeof(T) && false,
+                  "Specialize storages::redis::HashFieldNames<T> to name the "
+                  "hash fields, member names are available with C++20 only");
+    return std::array<std::string_view, 0>{};
+#endif
+  }
+}
+
+template <typename T>
+struct IsOptional : std::false_type {};
+
+template <typename T>
+struct IsOptional<std::optional<T>> : std::true_type {};
+
+ReplyData::MovableKeyValues GetKeyValues(
+    ReplyData& array_data, const std::string& request_description);
+
+[[noreturn]] void ThrowHashFieldParseError(std::string_view field,
+                                           const std::string& value,
+                                           const std::string& error,
+                                           const std::string& description);
+
+template <typename Field>
+void ParseHashField(std::string_view name, std::string&& value, Field& field,
+                    const std::string& request_description) {
+  if constexpr (IsOptional<Field>::value) {
+    ParseHashField(name, std::move(value), field.emplace(),
+                   request_description);
+  } else if constexpr (std::is_same_v<Field, std::string>) {
+    field = std::move(value);
+  } else if constexpr (std::is_arithmetic_v<Field>) {
+    using Parsed = std::conditional_t<std::is_same_v<Field, bool>, int, Field>;
+    try {
+      field = utils::FromString<Parsed>(value);
+    } catch (const std::exception& ex) {
+      ThrowHashFieldParseError(name, value, ex.what(), request_description);
+    }
+  } else {
+    static_assert(sizeof(Field) && false, "Unsupported hash struct member");
+  }
+}
+
+template <typename Field>
+std::string SerializeHashField(Field&& field) {
+  if constexpr (std::is_same_v<Field, std::string>) {
+    return std::move(field);
+  } else if constexpr (std::is_same_v<Field, bool>) {
+    return field ? "1" : "0";
+  } else if constexpr (std::is_arithmetic_v<Field>) {
+    return fmt::to_string(field);
+  } else {
+    static_assert(sizeof(Field) && false, "Unsupported hash struct member");
+  }
+}
+
+}  // namespace impl
+
+/// Parses the reply of HGETALL into the aggregate `T`, the unknown fields of
+/// the hash are ignored
+template <typename T>
+T ParseHashStruct(ReplyData&& reply_data,
+                  const std::string& request_description) {
+  constexpr auto kNames = impl::GetHashFieldNames<T>();
+
+  reply_data.ExpectArray(request_description);
+  T result{};
+  for (auto elem : impl::GetKeyValues(reply_data, request_description)) {
+    const std::string& name = elem.Key();
+    boost::pfr::for_each_field(result, [&](auto& field, std::size_t i) {
+      if (kNames[i] == name) {
+        impl::ParseHashField(kNames[i], std::move(elem.Value()), field,
+                             request_description);
+      }
+    });
+  }
+  return result;
+}
+
+/// Converts the aggregate `T` into the field-value pairs for HSET/HMSET.
+/// Pass an rvalue to move the string members into the arguments.
+template <typename T>
+std::vector<std::pair<std::string, std::string>> SerializeHashStruct(T value) {
+  constexpr auto kNames = impl::GetHashFieldNames<T>();
+
+  std::vector<std::pair<std::string, std::string>> result;
+  result.reserve(kNames.size());
+  boost::pfr::for_each_field(value, [&](auto& field, std::size_t i) {
+    using Field = std::decay_t<decltype(field)>;
+    if constexpr (impl::IsOptional<Field>::value) {
+      if (!field) return;
+      result.emplace_back(kNames[i],
+                          impl::SerializeHashField(std::move(*field)));
+    } else {
+      result.emplace_back(kNames[i],
+                          impl::SerializeHashField(std::move(field)));
+    }
+  });
+  return result;
+}
+
+/// Request of HGETALL parsed into the aggregate `T`, see HashFieldNames
+template <typename T>
+class [[nodiscard]] RequestHgetallStruct final {
+ public:
+  using Reply = T;
+
+  explicit RequestHgetallStruct(RequestHgetallCommon&& request)
+      : request_(std::move(request)) {}
+
+  void Wait() { request_.Wait(); }
+
+  void IgnoreResult() const { request_.IgnoreResult(); }
+
+  T Get(const std::string& request_description = {}) {
+    auto reply = request_.GetRaw();
+    const auto& description =
+        impl::RequestDescription(reply, request_description);
+    impl::ExpectIsOk(reply, description);
+    return ParseHashStruct<T>(impl::ExtractData(reply), description);
+  }
+
+ private:
+  RequestHgetallCommon request_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -112,11 +112,14 @@ CmdArgs& CmdArgs::Then(Args&&... _args) {
 struct CommandsBufferingSettings {
   bool buffering_enabled{false};
   size_t commands_buffering_threshold{0};
+  size_t commands_buffering_bytes_threshold{0};
   std::chrono::microseconds watch_command_timer_interval{0};
 
   constexpr bool operator==(const CommandsBufferingSettings& o) const {
     return buffering_enabled == o.buffering_enabled &&
            commands_buffering_threshold == o.commands_buffering_threshold &&
+           commands_buffering_bytes_threshold ==
+               o.commands_buffering_bytes_threshold &&
            watch_command_timer_interval == o.watch_command_timer_interval;
   }
 };
@@ -124,6 +127,10 @@ struct CommandsBufferingSettings {
 enum class ConnectionMode {
   kCommands,
   kSubscriber,
+  /// Subscriber connections also receive invalidations of all the keys
+  /// modified on their servers, a subscription to the `__redis__:invalidate`
+  /// channel gets a message per invalidated key
+  kSubscriberWithTracking,
 };
 
 struct MetricsSettings {
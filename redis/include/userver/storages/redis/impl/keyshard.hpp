@@ -9,6 +9,9 @@ namespace redis {
 
 void GetRedisKey(const std::string& key, size_t* key_start, size_t* key_len);
 
+/// Redis Cluster hash slot of the key, takes hash tags into account
+size_t GetClusterHashSlot(const std::string& key);
+
 class KeyShard {
  public:
   virtual ~KeyShard() = default;
@@ -127,6 +127,7 @@ class ReplyData final {
   static ReplyData CreateError(std::string&& error_msg);
   static ReplyData CreateStatus(std::string&& status_msg);
   static ReplyData CreateNil();
+  static ReplyData CreateInteger(int64_t value);
 
   explicit operator bool() const { return type_ != Type::kNoReply; }
 
@@ -243,6 +244,8 @@ class Reply final {
   Reply(std::string cmd, redisReply* redis_reply, ReplyStatus status,
         std::string status_string);
   Reply(std::string cmd, ReplyData&& data);
+  Reply(std::string cmd, ReplyData&& data, ReplyStatus status,
+        std::string status_string);
 
   std::string server;
   ServerId server_id;
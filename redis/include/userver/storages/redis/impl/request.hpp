@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
@@ -37,10 +38,16 @@ class Request {
   Request(Sentinel& sentinel, CmdArgs&& args, size_t shard, bool master,
           const CommandControl& command_control, size_t replies_to_skip);
 
+  Request(engine::Future<ReplyPtr>&& future, engine::Deadline deadline);
+
   CommandPtr PrepareRequest(CmdArgs&& args,
                             const CommandControl& command_control,
                             size_t replies_to_skip);
 
+  static std::vector<Request> MakePipelined(
+      Sentinel& sentinel, std::vector<CmdArgs>&& parts, size_t shard,
+      bool master, const CommandControl& command_control);
+
   engine::Future<ReplyPtr> future_;
   engine::Deadline deadline_;
 };
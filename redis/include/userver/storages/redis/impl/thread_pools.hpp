@@ -13,10 +13,15 @@ namespace redis {
 class ThreadPools {
  public:
   ThreadPools(size_t sentinel_thread_pool_size, size_t redis_thread_pool_size);
+  /// Serves Redis connections on the given thread pool, e.g. on the ev
+  /// threads of the engine, instead of a dedicated one
+  ThreadPools(size_t sentinel_thread_pool_size,
+              std::shared_ptr<engine::ev::ThreadPool> redis_thread_pool);
   ~ThreadPools();
 
   engine::ev::ThreadPool& GetSentinelThreadPool() const;
   const std::shared_ptr<engine::ev::ThreadPool>& GetRedisThreadPool() const;
+  bool HasDedicatedRedisThreadPool() const { return dedicated_redis_pool_; }
 
  private:
   // Sentinel and Redis should use separate thread pools to avoid deadlocks.
@@ -24,6 +29,7 @@ class ThreadPools {
   // Connect()/Disconnect().
   std::unique_ptr<engine::ev::ThreadPool> sentinel_thread_pool_;
   std::shared_ptr<engine::ev::ThreadPool> redis_thread_pool_;
+  bool dedicated_redis_pool_{true};
 };
 
 }  // namespace redis
@@ -52,12 +52,20 @@ class [[nodiscard]] Request final {
   template <ScanTag scan_tag>
   friend class RequestScanData;
 
+  template <typename T>
+  friend class RequestHgetallStruct;
+
  private:
   ReplyPtr GetRaw() { return impl_->GetRaw(); }
 
   std::unique_ptr<RequestDataBase<ReplyType>> impl_;
 };
 
+/// @brief Input range of the replies of a SCAN-like command.
+///
+/// The command for the next cursor page is sent as soon as the current page
+/// is received, so the next page is fetched while the current one is being
+/// processed.
 template <ScanTag scan_tag>
 class ScanRequest final {
  public:
@@ -170,6 +178,7 @@ using RequestHdel = Request<size_t>;
 using RequestHexists = Request<size_t>;
 using RequestHget = Request<std::optional<std::string>>;
 using RequestHgetall = Request<std::unordered_map<std::string, std::string>>;
+using RequestHgetallCommon = Request<ReplyData>;
 using RequestHincrby = Request<int64_t>;
 using RequestHincrbyfloat = Request<double>;
 using RequestHkeys = Request<std::vector<std::string>>;
@@ -0,0 +1,232 @@
+#pragma once
+
+/// @file userver/storages/redis/scatter_gather.hpp
+/// @brief Multi-key commands for keys of different shards
+
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/storages/redis/request.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// Failed sub-request of a MultiShardRequest
+struct ShardFailure {
+  size_t shard{0};
+  /// Indices of the keys of the sub-request in the requested keys
+  std::vector<size_t> key_indices;
+  std::exception_ptr error;
+};
+
+/// Reply of a MultiShardRequest
+template <typename ReplyType>
+struct MultiShardReply {
+  /// Merged replies of the succeeded sub-requests. For MgetAcrossShards the
+  /// values are in the order of the requested keys, the values of the keys
+  /// from the failed sub-requests are std::nullopt.
+  ReplyType reply{};
+  std::vector<ShardFailure> failures;
+
+  bool IsComplete() const noexcept { return failures.empty(); }
+
+  /// Rethrows the error of the first failed sub-request, if any
+  void ThrowIfIncomplete() const {
+    if (!failures.empty()) std::rethrow_exception(failures.front().error);
+  }
+};
+
+namespace impl {
+
+struct KeysGroup {
+  size_t shard{0};
+  std::vector<size_t> key_indices;
+  std::vector<std::string> keys;
+};
+
+/// Groups the keys by shards, or by hash slots in cluster mode, preserving
+/// the order of the keys in each group
+std::vector<KeysGroup> GroupKeysByShard(const Client& client,
+                                        std::vector<std::string>&& keys,
+                                        const CommandControl& command_control);
+
+inline void MergeReply(size_t& result, size_t part,
+                       const std::vector<size_t>& /*key_indices*/) {
+  result += part;
+}
+
+void MergeReply(std::vector<std::optional<std::string>>& result,
+                std::vector<std::optional<std::string>>&& part,
+                const std::vector<size_t>& key_indices);
+
+}  // namespace impl
+
+/// @brief Multi-key request split into concurrent sub-requests to the
+/// shards of the keys.
+///
+/// Unlike the requests of a single multi-key command, a failure of a
+/// sub-request does not fail the whole request: the reply contains the
+/// results of the other sub-requests and the description of the failures.
+template <typename RequestType>
+class [[nodiscard]] MultiShardRequest final {
+ public:
+  using Reply = MultiShardReply<typename RequestType::Reply>;
+
+  /// @cond
+  struct SubRequest {
+    size_t shard;
+    std::vector<size_t> key_indices;
+    RequestType request;
+  };
+
+  MultiShardRequest(size_t keys_count, std::vector<SubRequest>&& sub_requests)
+      : keys_count_(keys_count), sub_requests_(std::move(sub_requests)) {}
+  /// @endcond
+
+  void Wait() {
+    for (auto& sub_request : sub_requests_) sub_request.request.Wait();
+  }
+
+  void IgnoreResult() const {}
+
+  Reply Get(const std::string& request_description = {}) {
+    Reply result;
+    if constexpr (!std::is_arithmetic_v<typename RequestType::Reply>) {
+      result.reply.resize(keys_count_);
+    }
+
+    for (auto& sub_request : sub_requests_) {
+      try {
+        impl::MergeReply(result.reply,
+                         sub_request.request.Get(request_description),
+                         sub_request.key_indices);
+      } catch (const std::exception&) {
+        result.failures.push_back({sub_request.shard,
+                                   std::move(sub_request.key_indices),
+                                   std::current_exception()});
+      }
+    }
+    sub_requests_.clear();
+    return result;
+  }
+
+ private:
+  size_t keys_count_;
+  std::vector<SubRequest> sub_requests_;
+};
+
+/// @name Scatter-gather multi-key commands
+///
+/// Keys are grouped by shards (by hash slots in cluster mode), the commands
+/// for the groups are sent concurrently and the replies are merged.
+/// Replaces manual splitting of the keys via Client::ShardByKey().
+/// @{
+MultiShardRequest<RequestMget> MgetAcrossShards(
+    Client& client, std::vector<std::string> keys,
+    const CommandControl& command_control);
+
+MultiShardRequest<RequestDel> DelAcrossShards(
+    Client& client, std::vector<std::string> keys,
+    const CommandControl& command_control);
+
+MultiShardRequest<RequestUnlink> UnlinkAcrossShards(
+    Client& client, std::vector<std::string> keys,
+    const CommandControl& command_control);
+
+MultiShardRequest<RequestExists> ExistsAcrossShards(
+    Client& client, std::vector<std::string> keys,
+    const CommandControl& command_control);
+/// @}
+
+/// @brief SCAN of the keys of all the shards, the shards are scanned
+/// concurrently.
+///
+/// Up to `max_concurrent_shards` shard scans are in flight at once, each of
+/// them sends the SCAN for the next cursor page as soon as the previous page
+/// arrives. The keys are returned shard by shard; when a shard is exhausted
+/// the scan of the next shard is started. The request is an input range,
+/// the keys may be processed while the next pages are being fetched.
+///
+/// An error of a shard scan is thrown from the iteration. The client must
+/// outlive the request.
+class [[nodiscard]] MultiShardScanRequest final {
+ public:
+  using ReplyElem = std::string;
+
+  MultiShardScanRequest(Client& client, ScanOptions options,
+                        size_t max_concurrent_shards,
+                        const CommandControl& command_control);
+
+  template <typename T = std::vector<ReplyElem>>
+  T GetAll() {
+    return T{begin(), end()};
+  }
+
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = ptrdiff_t;
+    using value_type = ReplyElem;
+    using reference = value_type&;
+    using pointer = value_type*;
+
+    explicit Iterator(MultiShardScanRequest* stream) : stream_(stream) {
+      if (stream_ && !stream_->HasMore()) stream_ = nullptr;
+    }
+
+    Iterator& operator++() {
+      stream_->Advance();
+      if (!stream_->HasMore()) stream_ = nullptr;
+      return *this;
+    }
+
+    reference operator*() { return stream_->Current(); }
+
+    pointer operator->() { return &**this; }
+
+    bool operator==(const Iterator& rhs) const {
+      return stream_ == rhs.stream_;
+    }
+
+    bool operator!=(const Iterator& rhs) const { return !(*this == rhs); }
+
+   private:
+    MultiShardScanRequest* stream_;
+  };
+
+  Iterator begin() { return Iterator(this); }
+  Iterator end() { return Iterator(nullptr); }
+
+ private:
+  bool HasMore();
+  ReplyElem& Current();
+  void Advance();
+  void StartShardScans();
+
+  Client& client_;
+  const ScanOptions options_;
+  const CommandControl command_control_;
+  const size_t max_concurrent_shards_;
+  size_t next_shard_{0};
+  // deque keeps the addresses of the scans referenced by current_
+  std::deque<RequestScan> scans_;
+  std::optional<RequestScan::Iterator> current_;
+};
+
+/// Scans the keys of all the shards of the client, see MultiShardScanRequest
+MultiShardScanRequest ScanAcrossShards(Client& client, ScanOptions options,
+                                       size_t max_concurrent_shards,
+                                       const CommandControl& command_control);
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <userver/storages/redis/bit_operation.hpp>
 #include <userver/storages/redis/command_options.hpp>
@@ -308,6 +309,18 @@ class Transaction {
 
 using TransactionPtr = std::unique_ptr<Transaction>;
 
+/// @brief Executes many small independent transactions with fewer writes.
+///
+/// Equivalent to calling `Exec()` for each transaction, but the transactions
+/// of the same shard of the same client are sent back-to-back as a single
+/// pipelined command. Each transaction keeps its own atomicity and its own
+/// `RequestExec`, the results are in the order of `transactions`.
+///
+/// The pipelined command is never retried, as some of its transactions may
+/// have already been executed.
+std::vector<RequestExec> ExecPipelined(std::vector<TransactionPtr> transactions,
+                                       const CommandControl& command_control);
+
 class EmptyTransactionException : public USERVER_NAMESPACE::redis::Exception {
  public:
   using USERVER_NAMESPACE::redis::Exception::Exception;
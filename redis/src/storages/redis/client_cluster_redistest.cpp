@@ -2,6 +2,7 @@
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/storages/redis/scatter_gather.hpp>
 
 #include <storages/redis/impl/cluster_sentinel_impl.hpp>
 
@@ -113,6 +114,36 @@ UTEST_F(RedisClusterClientTest, DISABLED_MgetCrossSlot) {
   }
 }
 
+UTEST_F(RedisClusterClientTest, DISABLED_MgetAcrossShards) {
+  auto client = GetClient();
+
+  const size_t kNumKeys = 10;
+  const int add = 100;
+
+  std::vector<std::string> keys;
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    auto req = client->Set(MakeKey(i), std::to_string(add + i), kDefaultCc);
+    UASSERT_NO_THROW(req.Get());
+    keys.push_back(MakeKey(i));
+  }
+  keys.push_back("missing_key");
+
+  auto reply =
+      storages::redis::MgetAcrossShards(*client, keys, kDefaultCc).Get();
+  ASSERT_TRUE(reply.IsComplete());
+  ASSERT_EQ(reply.reply.size(), kNumKeys + 1);
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    ASSERT_TRUE(reply.reply[i]);
+    EXPECT_EQ(*reply.reply[i], std::to_string(add + i));
+  }
+  EXPECT_FALSE(reply.reply.back());
+
+  auto deleted =
+      storages::redis::DelAcrossShards(*client, keys, kDefaultCc).Get();
+  ASSERT_TRUE(deleted.IsComplete());
+  EXPECT_EQ(deleted.reply, kNumKeys);
+}
+
 UTEST_F(RedisClusterClientTest, DISABLED_Transaction) {
   auto client = GetClient();
   auto transaction = client->Multi();
@@ -179,6 +179,14 @@ RequestEvalShaCommon ClientImpl::EvalShaCommon(
                   shard, true, GetCommandControl(command_control)));
 }
 
+RequestHgetallCommon ClientImpl::HgetallCommon(
+    std::string key, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestHgetallCommon>(
+      MakeRequest(CmdArgs{"hgetall", std::move(key)}, shard, false,
+                  GetCommandControl(command_control)));
+}
+
 RequestScriptLoad ClientImpl::ScriptLoad(
     std::string script, size_t shard, const CommandControl& command_control) {
   return CreateRequest<RequestScriptLoad>(
@@ -1110,6 +1118,14 @@ USERVER_NAMESPACE::redis::Request ClientImpl::MakeRequest(
                                     command_control, replies_to_skip);
 }
 
+std::vector<USERVER_NAMESPACE::redis::Request>
+ClientImpl::MakePipelinedRequests(std::vector<CmdArgs>&& parts, size_t shard,
+                                  bool master,
+                                  const CommandControl& command_control) {
+  return redis_client_->MakePipelinedRequests(std::move(parts), shard, master,
+                                              command_control);
+}
+
 CommandControl ClientImpl::GetCommandControl(const CommandControl& cc) const {
   return redis_client_->GetCommandControl(cc);
 }
@@ -89,6 +89,8 @@ class ClientImpl final : public Client,
       std::string script_hash, std::vector<std::string> keys,
       std::vector<std::string> args,
       const CommandControl& command_control) override;
+  RequestHgetallCommon HgetallCommon(
+      std::string key, const CommandControl& command_control) override;
   RequestScriptLoad ScriptLoad(std::string script, size_t shard,
                                const CommandControl& command_control) override;
 
@@ -449,6 +451,10 @@ class ClientImpl final : public Client,
       CmdArgs&& args, size_t shard, bool master,
       const CommandControl& command_control, size_t replies_to_skip = 0);
 
+  std::vector<USERVER_NAMESPACE::redis::Request> MakePipelinedRequests(
+      std::vector<CmdArgs>&& parts, size_t shard, bool master,
+      const CommandControl& command_control);
+
   template <typename T, typename Func>
   auto MakeRequestChunks(size_t max_chunk_size, std::vector<T>&& args,
                          Func&& func) {
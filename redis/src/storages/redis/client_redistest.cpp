@@ -1,7 +1,10 @@
 #include <storages/redis/client_redistest.hpp>
 
+#include <algorithm>
+
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/storages/redis/scatter_gather.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -30,8 +33,20 @@ std::optional<std::string> RedisClientCancelRequest(
 }
 /// [Sample Redis Cancel request]
 
+struct User {
+  std::string name;
+  int age{0};
+  std::optional<std::string> email;
+};
+
 }  // namespace
 
+template <>
+struct storages::redis::HashFieldNames<User> {
+  static constexpr std::array<std::string_view, 3> kNames{"name", "age",
+                                                          "email"};
+};
+
 UTEST_F(RedisClientTest, Sample) { RedisClientSampleUsage(*GetClient()); }
 
 UTEST_F(RedisClientTest, CancelRequest) {
@@ -117,6 +132,74 @@ UTEST_F(RedisClientTest, Unlink) {
   EXPECT_EQ(removed_count, 0);
 }
 
+UTEST_F(RedisClientTest, ScatterGather) {
+  auto client = GetClient();
+  client->Set("key0", "foo", {}).Get();
+  client->Set("key2", "bar", {}).Get();
+
+  const std::vector<std::string> keys{"key2", "key1", "key0"};
+
+  auto values = storages::redis::MgetAcrossShards(*client, keys, {}).Get();
+  ASSERT_TRUE(values.IsComplete());
+  ASSERT_EQ(values.reply.size(), 3);
+  EXPECT_EQ(values.reply[0], "bar");
+  EXPECT_EQ(values.reply[1], std::nullopt);
+  EXPECT_EQ(values.reply[2], "foo");
+
+  auto exists = storages::redis::ExistsAcrossShards(*client, keys, {}).Get();
+  EXPECT_TRUE(exists.IsComplete());
+  EXPECT_EQ(exists.reply, 2);
+
+  auto deleted = storages::redis::DelAcrossShards(*client, keys, {}).Get();
+  EXPECT_TRUE(deleted.IsComplete());
+  EXPECT_EQ(deleted.reply, 2);
+
+  auto unlinked = storages::redis::UnlinkAcrossShards(*client, keys, {}).Get();
+  EXPECT_TRUE(unlinked.IsComplete());
+  EXPECT_EQ(unlinked.reply, 0);
+
+  auto empty = storages::redis::MgetAcrossShards(*client, {}, {}).Get();
+  EXPECT_TRUE(empty.IsComplete());
+  EXPECT_TRUE(empty.reply.empty());
+}
+
+UTEST_F(RedisClientTest, ScanAcrossShards) {
+  auto client = GetClient();
+  const size_t kNumKeys = 100;
+  std::vector<std::string> expected;
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    expected.push_back("scan_key:" + std::to_string(i));
+    client->Set(expected.back(), "value", {}).Get();
+  }
+  std::sort(expected.begin(), expected.end());
+
+  const storages::redis::ScanOptions options{
+      storages::redis::ScanOptions::Match{"scan_key:*"},
+      storages::redis::ScanOptions::Count{10}};
+  for (const size_t max_concurrent_shards : {1, 4}) {
+    auto keys = storages::redis::ScanAcrossShards(*client, options,
+                                                  max_concurrent_shards, {})
+                    .GetAll();
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(keys, expected);
+  }
+}
+
+UTEST_F(RedisClientTest, HashStruct) {
+  auto client = GetClient();
+  client->HmsetStruct("user", User{"Alice", 42, std::nullopt}, {}).Get();
+
+  const auto user = client->HgetallStruct<User>("user", {}).Get();
+  EXPECT_EQ(user.name, "Alice");
+  EXPECT_EQ(user.age, 42);
+  EXPECT_EQ(user.email, std::nullopt);
+  EXPECT_FALSE(client->Hexists("user", "email", {}).Get());
+
+  const auto missing = client->HgetallStruct<User>("missing", {}).Get();
+  EXPECT_EQ(missing.name, "");
+  EXPECT_EQ(missing.age, 0);
+}
+
 UTEST_F(RedisClientTest, Geosearch) {
   Version since{6, 2, 0};
   if (!CheckVersion(since))
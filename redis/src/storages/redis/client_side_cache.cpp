@@ -0,0 +1,206 @@
+#include <userver/storages/redis/client_side_cache.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+const std::string kInvalidationChannel = "__redis__:invalidate";
+
+using Clock = std::chrono::steady_clock;
+
+struct CachedValue final {
+  std::optional<std::string> value;
+  Clock::time_point expires_at;
+
+  bool IsExpired(Clock::time_point now) const { return expires_at <= now; }
+};
+
+struct KeyEntry final {
+  // Unique per entry. A read stores its value only if the entry it has seen
+  // before the request was not invalidated (erased) meanwhile.
+  std::uint64_t version{0};
+  std::optional<CachedValue> value;
+  std::unordered_map<std::string, CachedValue> fields;
+};
+
+using ShardCache =
+    concurrent::Variable<cache::LruMap<std::string, KeyEntry>, std::mutex>;
+
+CommandControl ForceMaster(const CommandControl& command_control) {
+  auto cc = command_control;
+  cc.force_request_to_master = true;
+  return cc;
+}
+
+}  // namespace
+
+class ClientSideCache::Impl final {
+ public:
+  Impl(ClientPtr client, SubscribeClientPtr invalidations_client,
+       ClientSideCacheSettings settings)
+      : client_(std::move(client)), settings_(settings) {
+    UINVARIANT(client_, "Client must be set");
+    UINVARIANT(invalidations_client, "Subscribe client must be set");
+    shards_.reserve(client_->ShardsCount());
+    for (std::size_t i = 0; i < client_->ShardsCount(); ++i) {
+      shards_.push_back(
+          std::make_unique<ShardCache>(settings_.max_keys_per_shard));
+    }
+    invalidations_ = invalidations_client->Subscribe(
+        kInvalidationChannel,
+        [this](const std::string&, const std::string& key) {
+          Invalidate(key);
+        });
+  }
+
+  ~Impl() { invalidations_.Unsubscribe(); }
+
+  std::optional<std::string> Get(std::string key, const CommandControl& cc) {
+    auto& shard = GetShard(key);
+    std::uint64_t version = 0;
+    {
+      auto lru = shard.Lock();
+      auto& entry = GetEntry(*lru, key);
+      if (entry.value && !entry.value->IsExpired(Clock::now())) {
+        return entry.value->value;
+      }
+      version = entry.version;
+    }
+
+    auto value = client_->Get(key, ForceMaster(cc)).Get();
+    auto lru = shard.Lock();
+    if (auto* entry = lru->Get(key); entry && entry->version == version) {
+      entry->value = CachedValue{value, Clock::now() + settings_.ttl};
+    }
+    return value;
+  }
+
+  std::optional<std::string> Hget(std::string key, std::string field,
+                                  const CommandControl& cc) {
+    auto& shard = GetShard(key);
+    std::uint64_t version = 0;
+    {
+      auto lru = shard.Lock();
+      auto& entry = GetEntry(*lru, key);
+      const auto it = entry.fields.find(field);
+      if (it != entry.fields.end() && !it->second.IsExpired(Clock::now())) {
+        return it->second.value;
+      }
+      version = entry.version;
+    }
+
+    auto value = client_->Hget(key, field, ForceMaster(cc)).Get();
+    auto lru = shard.Lock();
+    if (auto* entry = lru->Get(key); entry && entry->version == version) {
+      entry->fields.insert_or_assign(
+          std::move(field), CachedValue{value, Clock::now() + settings_.ttl});
+    }
+    return value;
+  }
+
+  std::vector<std::optional<std::string>> Mget(std::vector<std::string> keys,
+                                               const CommandControl& cc) {
+    std::vector<std::optional<std::string>> result(keys.size());
+    // Indices of the missing keys in `keys` and the versions of their entries
+    std::vector<std::size_t> missing_indices;
+    std::vector<std::uint64_t> versions;
+    const auto now = Clock::now();
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      auto lru = GetShard(keys[i]).Lock();
+      auto& entry = GetEntry(*lru, keys[i]);
+      if (entry.value && !entry.value->IsExpired(now)) {
+        result[i] = entry.value->value;
+      } else {
+        missing_indices.push_back(i);
+        versions.push_back(entry.version);
+      }
+    }
+    if (missing_indices.empty()) return result;
+
+    std::vector<std::string> missing_keys;
+    missing_keys.reserve(missing_indices.size());
+    for (auto i : missing_indices) missing_keys.push_back(keys[i]);
+    auto values = client_->Mget(std::move(missing_keys), ForceMaster(cc)).Get();
+    UASSERT(values.size() == missing_indices.size());
+
+    const auto expires_at = Clock::now() + settings_.ttl;
+    for (std::size_t j = 0; j < missing_indices.size(); ++j) {
+      const auto i = missing_indices[j];
+      auto lru = GetShard(keys[i]).Lock();
+      if (auto* entry = lru->Get(keys[i]);
+          entry && entry->version == versions[j]) {
+        entry->value = CachedValue{values[j], expires_at};
+      }
+      result[i] = std::move(values[j]);
+    }
+    return result;
+  }
+
+ private:
+  ShardCache& GetShard(const std::string& key) {
+    const auto shard = client_->ShardByKey(key);
+    UASSERT(shard < shards_.size());
+    return *shards_[shard];
+  }
+
+  KeyEntry& GetEntry(cache::LruMap<std::string, KeyEntry>& lru,
+                     const std::string& key) {
+    if (auto* entry = lru.Get(key)) return *entry;
+    KeyEntry entry;
+    entry.version = next_version_.fetch_add(1, std::memory_order_relaxed);
+    return *lru.Emplace(key, std::move(entry));
+  }
+
+  void Invalidate(const std::string& key) {
+    auto lru = GetShard(key).Lock();
+    lru->Erase(key);
+  }
+
+  const ClientPtr client_;
+  const ClientSideCacheSettings settings_;
+  std::vector<std::unique_ptr<ShardCache>> shards_;
+  std::atomic<std::uint64_t> next_version_{0};
+  SubscriptionToken invalidations_;
+};
+
+ClientSideCache::ClientSideCache(ClientPtr client,
+                                 SubscribeClientPtr invalidations_client,
+                                 ClientSideCacheSettings settings)
+    : impl_(std::make_unique<Impl>(std::move(client),
+                                   std::move(invalidations_client), settings)) {
+}
+
+ClientSideCache::~ClientSideCache() = default;
+
+std::optional<std::string> ClientSideCache::Get(
+    std::string key, const CommandControl& command_control) {
+  return impl_->Get(std::move(key), command_control);
+}
+
+std::optional<std::string> ClientSideCache::Hget(
+    std::string key, std::string field,
+    const CommandControl& command_control) {
+  return impl_->Hget(std::move(key), std::move(field), command_control);
+}
+
+std::vector<std::optional<std::string>> ClientSideCache::Mget(
+    std::vector<std::string> keys, const CommandControl& command_control) {
+  return impl_->Mget(std::move(keys), command_control);
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,86 @@
+#include <storages/redis/client_redistest.hpp>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/redis/client_side_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr BaseRedisClientTest::Version kClientTrackingVersion{6, 0, 0};
+
+// The invalidations channel is subscribed to asynchronously, so a write
+// is repeated with new values until the cache sees the latest one
+template <typename Write, typename Read>
+bool WaitInvalidated(Write write, Read read) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  for (int i = 0; !deadline.IsReached(); ++i) {
+    const auto value = std::to_string(i);
+    write(value);
+    for (int attempt = 0; attempt < 10; ++attempt) {
+      if (read() == value) return true;
+      engine::SleepFor(std::chrono::milliseconds{10});
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+UTEST_F(RedisClientTest, ClientSideCacheGet) {
+  if (!CheckVersion(kClientTrackingVersion)) {
+    GTEST_SKIP() << SkipMsgByVersion("CLIENT TRACKING", kClientTrackingVersion);
+  }
+  auto client = GetClient();
+  storages::redis::ClientSideCache cache{
+      client, GetTrackingSubscribeClient(), {100, std::chrono::hours{1}}};
+
+  EXPECT_EQ(cache.Get("cached_key", {}), std::nullopt);
+  EXPECT_TRUE(WaitInvalidated(
+      [&](const std::string& value) {
+        client->Set("cached_key", value, {}).Get();
+      },
+      [&] { return cache.Get("cached_key", {}); }));
+}
+
+UTEST_F(RedisClientTest, ClientSideCacheHget) {
+  if (!CheckVersion(kClientTrackingVersion)) {
+    GTEST_SKIP() << SkipMsgByVersion("CLIENT TRACKING", kClientTrackingVersion);
+  }
+  auto client = GetClient();
+  storages::redis::ClientSideCache cache{
+      client, GetTrackingSubscribeClient(), {100, std::chrono::hours{1}}};
+
+  EXPECT_EQ(cache.Hget("cached_hash", "field", {}), std::nullopt);
+  EXPECT_TRUE(WaitInvalidated(
+      [&](const std::string& value) {
+        client->Hset("cached_hash", "field", value, {}).Get();
+      },
+      [&] { return cache.Hget("cached_hash", "field", {}); }));
+}
+
+UTEST_F(RedisClientTest, ClientSideCacheMget) {
+  if (!CheckVersion(kClientTrackingVersion)) {
+    GTEST_SKIP() << SkipMsgByVersion("CLIENT TRACKING", kClientTrackingVersion);
+  }
+  auto client = GetClient();
+  storages::redis::ClientSideCache cache{
+      client, GetTrackingSubscribeClient(), {100, std::chrono::hours{1}}};
+
+  client->Set("cached_key0", "foo", {}).Get();
+  const std::vector<std::string> keys{"cached_key0", "cached_key1"};
+  const std::vector<std::optional<std::string>> expected{"foo", std::nullopt};
+  EXPECT_EQ(cache.Mget(keys, {}), expected);
+  // Both the cached and the missing keys are returned
+  EXPECT_EQ(cache.Get("cached_key0", {}), "foo");
+  EXPECT_EQ(cache.Mget(keys, {}), expected);
+
+  EXPECT_TRUE(WaitInvalidated(
+      [&](const std::string& value) {
+        client->Set("cached_key1", value, {}).Get();
+      },
+      [&] { return cache.Mget(keys, {}).back(); }));
+}
+
+USERVER_NAMESPACE_END
@@ -4,9 +4,12 @@
 #include <vector>
 
 #include <engine/ev/thread_pool.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_pools.hpp>
 #include <userver/components/component.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
+#include <userver/engine/task/task_base.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/storages/redis/impl/thread_pools.hpp>
@@ -83,6 +86,7 @@ struct SubscribeRedisGroup {
   std::string config_name;
   std::string sharding_strategy;
   bool allow_reads_from_master{false};
+  bool client_tracking{false};
 };
 
 SubscribeRedisGroup Parse(const yaml_config::YamlConfig& value,
@@ -93,12 +97,14 @@ SubscribeRedisGroup Parse(const yaml_config::YamlConfig& value,
   config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
   config.allow_reads_from_master =
       value["allow_reads_from_master"].As<bool>(false);
+  config.client_tracking = value["client_tracking"].As<bool>(false);
   return config;
 }
 
 struct RedisPools {
   int sentinel_thread_pool_size;
   int redis_thread_pool_size;
+  bool use_engine_ev_threads;
 };
 
 RedisPools Parse(const yaml_config::YamlConfig& value,
@@ -106,10 +112,21 @@ RedisPools Parse(const yaml_config::YamlConfig& value,
   RedisPools pools{};
   pools.sentinel_thread_pool_size =
       value["sentinel_thread_pool_size"].As<int>();
-  pools.redis_thread_pool_size = value["redis_thread_pool_size"].As<int>();
+  pools.use_engine_ev_threads = value["use_engine_ev_threads"].As<bool>(false);
+  pools.redis_thread_pool_size =
+      pools.use_engine_ev_threads ? 0
+                                  : value["redis_thread_pool_size"].As<int>();
   return pools;
 }
 
+std::shared_ptr<engine::ev::ThreadPool> GetEngineEvThreadPool() {
+  // Keeps the pools of the task processor alive while Redis uses them
+  auto pools = engine::current_task::GetTaskProcessor().GetTaskProcessorPools();
+  auto& event_thread_pool = pools->EventThreadPool();
+  return std::shared_ptr<engine::ev::ThreadPool>(std::move(pools),
+                                                 &event_thread_pool);
+}
+
 redis::MetricsSettings::Level Parse(
     const yaml_config::YamlConfig& value,
     formats::parse::To<redis::MetricsSettings::Level>) {
@@ -202,9 +219,14 @@ void Redis::Connect(const ComponentConfig& config,
       redis::MetricsSettings({}, static_metrics_settings_));
   const auto redis_pools = config["thread_pools"].As<RedisPools>();
 
-  thread_pools_ = std::make_shared<redis::ThreadPools>(
-      redis_pools.sentinel_thread_pool_size,
-      redis_pools.redis_thread_pool_size);
+  if (redis_pools.use_engine_ev_threads) {
+    thread_pools_ = std::make_shared<redis::ThreadPools>(
+        redis_pools.sentinel_thread_pool_size, GetEngineEvThreadPool());
+  } else {
+    thread_pools_ = std::make_shared<redis::ThreadPools>(
+        redis_pools.sentinel_thread_pool_size,
+        redis_pools.redis_thread_pool_size);
+  }
 
   const auto redis_groups = config["groups"].As<std::vector<RedisGroup>>();
   for (const RedisGroup& redis_group : redis_groups) {
@@ -246,7 +268,10 @@ void Redis::Connect(const ComponentConfig& config,
 
     auto sentinel = redis::SubscribeSentinel::Create(
         thread_pools_, settings, redis_group.config_name, config_source,
-        redis_group.db, is_cluster_mode, cc, testsuite_redis_control);
+        redis_group.db, is_cluster_mode, cc, testsuite_redis_control,
+        redis_group.client_tracking
+            ? redis::ConnectionMode::kSubscriberWithTracking
+            : redis::ConnectionMode::kSubscriber);
     if (sentinel)
       subscribe_clients_.emplace(
           redis_group.db,
@@ -280,7 +305,10 @@ void Redis::WriteStatistics(utils::statistics::Writer& writer) {
                            {"redis_database", name});
   }
   auto threads_writer = writer["ev_threads"]["cpu_load_percent"];
-  threads_writer.ValueWithLabels(*thread_pools_->GetRedisThreadPool(), {});
+  // The ev threads of the engine are accounted by the engine itself
+  if (thread_pools_->HasDedicatedRedisThreadPool()) {
+    threads_writer.ValueWithLabels(*thread_pools_->GetRedisThreadPool(), {});
+  }
   threads_writer.ValueWithLabels(thread_pools_->GetSentinelThreadPool(), {});
 }
 
@@ -347,7 +375,11 @@ properties:
         properties:
             redis_thread_pool_size:
                 type: integer
-                description: thread count to serve Redis requests
+                description: thread count to serve Redis requests, ignored if use_engine_ev_threads is true
+            use_engine_ev_threads:
+                type: boolean
+                description: serve Redis connections on the ev threads of the engine instead of a dedicated thread pool
+                defaultDescription: false
             sentinel_thread_pool_size:
                 type: integer
                 description: thread count to serve sentinel requests
@@ -411,6 +443,10 @@ properties:
                     type: boolean
                     description: allows subscriptions to master instance to distribute load
                     defaultDescription: false
+                client_tracking:
+                    type: boolean
+                    description: receive key invalidations for storages::redis::ClientSideCache
+                    defaultDescription: false
 )");
 }
 
@@ -0,0 +1,29 @@
+#include <userver/storages/redis/hash_struct.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+ReplyData::MovableKeyValues GetKeyValues(
+    ReplyData& array_data, const std::string& request_description) {
+  try {
+    return array_data.GetMovableKeyValues();
+  } catch (const std::exception& ex) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Can't parse response to '" + request_description +
+        "' request: " + ex.what());
+  }
+}
+
+void ThrowHashFieldParseError(std::string_view field, const std::string& value,
+                              const std::string& error,
+                              const std::string& description) {
+  throw USERVER_NAMESPACE::redis::ParseReplyException(
+      "Can't parse value of hash field '" + std::string{field} +
+      "' in response to '" + description + "' request: " + error +
+      ", value=" + value);
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
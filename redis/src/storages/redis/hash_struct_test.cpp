@@ -0,0 +1,84 @@
+#include <userver/storages/redis/hash_struct.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Profile {
+  std::string name;
+  int age{0};
+  double rating{0};
+  bool verified{false};
+  std::optional<std::string> email;
+};
+
+}  // namespace
+
+template <>
+struct storages::redis::HashFieldNames<Profile> {
+  static constexpr std::array<std::string_view, 5> kNames{
+      "name", "age", "rating", "verified", "email"};
+};
+
+namespace {
+
+storages::redis::ReplyData MakeHashReply(
+    std::vector<std::pair<std::string, std::string>> field_values) {
+  storages::redis::ReplyData::Array array;
+  for (auto& [field, value] : field_values) {
+    array.emplace_back(std::move(field));
+    array.emplace_back(std::move(value));
+  }
+  return storages::redis::ReplyData{std::move(array)};
+}
+
+}  // namespace
+
+TEST(HashStruct, Parse) {
+  auto profile = storages::redis::ParseHashStruct<Profile>(
+      MakeHashReply({{"age", "42"},
+                     {"unknown", "value"},
+                     {"name", "Alice"},
+                     {"verified", "1"},
+                     {"rating", "4.5"}}),
+      "hgetall");
+  EXPECT_EQ(profile.name, "Alice");
+  EXPECT_EQ(profile.age, 42);
+  EXPECT_EQ(profile.rating, 4.5);
+  EXPECT_TRUE(profile.verified);
+  EXPECT_EQ(profile.email, std::nullopt);
+
+  profile = storages::redis::ParseHashStruct<Profile>(
+      MakeHashReply({{"email", "alice@example.com"}}), "hgetall");
+  EXPECT_EQ(profile.name, "");
+  EXPECT_EQ(profile.age, 0);
+  EXPECT_EQ(profile.email, "alice@example.com");
+}
+
+TEST(HashStruct, ParseInvalidValue) {
+  EXPECT_THROW(storages::redis::ParseHashStruct<Profile>(
+                   MakeHashReply({{"age", "old"}}), "hgetall"),
+               redis::ParseReplyException);
+}
+
+TEST(HashStruct, Serialize) {
+  const auto field_values = storages::redis::SerializeHashStruct(
+      Profile{"Bob", 30, 0.5, false, std::nullopt});
+  const std::vector<std::pair<std::string, std::string>> expected{
+      {"name", "Bob"}, {"age", "30"}, {"rating", "0.5"}, {"verified", "0"}};
+  EXPECT_EQ(field_values, expected);
+
+  const auto profile = storages::redis::ParseHashStruct<Profile>(
+      MakeHashReply(storages::redis::SerializeHashStruct(
+          Profile{"Carol", 25, 3.25, true, "carol@example.com"})),
+      "hgetall");
+  EXPECT_EQ(profile.name, "Carol");
+  EXPECT_EQ(profile.age, 25);
+  EXPECT_EQ(profile.rating, 3.25);
+  EXPECT_TRUE(profile.verified);
+  EXPECT_EQ(profile.email, "carol@example.com");
+}
+
+USERVER_NAMESPACE_END
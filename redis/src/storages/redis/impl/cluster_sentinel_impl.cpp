@@ -4,12 +4,12 @@
 
 #include <fmt/format.h>
 #include <boost/container_hash/hash.hpp>
-#include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/storages/redis/exception.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
 #include <userver/storages/redis/impl/redis_state.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 #include <userver/utils/algo.hpp>
@@ -64,15 +64,6 @@ using NodesAddressesSet =
     std::unordered_set<NodeAddresses, NodeAddressesHasher>;
 using HostPort = std::string;
 
-size_t HashSlot(const std::string& key) {
-  size_t start = 0;
-  size_t len = 0;
-  GetRedisKey(key, &start, &len);
-  return std::for_each(key.data() + start, key.data() + start + len,
-                       boost::crc_optimal<16, 0x1021>())() &
-         0x3fff;
-}
-
 std::string ParseMovedShard(const std::string& err_string) {
   static const auto kUnknownShard = std::string("");
   size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
@@ -789,7 +780,7 @@ ClusterSentinelImpl::ClusterSentinelImpl(
     ConnectionSecurity /*connection_security*/,
     ReadyChangeCallback ready_callback,
     std::unique_ptr<KeyShard>&& /*key_shard*/,
-    dynamic_config::Source dynamic_config_source, ConnectionMode /*mode*/)
+    dynamic_config::Source dynamic_config_source, ConnectionMode mode)
     : sentinel_obj_(sentinel),
       ev_thread_(sentinel_thread_control),
       process_waiting_commands_timer_(
@@ -809,6 +800,11 @@ ClusterSentinelImpl::ClusterSentinelImpl(
   // https://github.com/boostorg/signals2/issues/59
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
   Init();
+  if (mode == ConnectionMode::kSubscriberWithTracking) {
+    LOG_WARNING() << "Client tracking is not supported in cluster mode, "
+                     "no invalidations are received for shard_group_name="
+                  << shard_group_name_;
+  }
   LOG_DEBUG() << "Created ClusterSentinelImpl, shard_group_name="
               << shard_group_name_;
 }
@@ -817,12 +813,12 @@ ClusterSentinelImpl::~ClusterSentinelImpl() { Stop(); }
 
 std::unordered_map<ServerId, size_t, ServerIdHasher>
 ClusterSentinelImpl::GetAvailableServersWeighted(
-    size_t /*shard_idx*/, bool with_master, const CommandControl& cc) const {
+    size_t shard_idx, bool with_master, const CommandControl& cc) const {
   auto topology = topology_holder_->GetTopology();
   /// Method used only in Subscribe. When using cluster mode every node
-  /// can listen messages from any node. So ignore concrete shard and use
-  /// kUnknown to get all of cluster nodes.
-  return topology->GetAvailableServersWeighted(kUnknownShard, with_master, cc);
+  /// can listen messages from any node, kUnknownShard gets all of
+  /// cluster nodes. Sharded channels are served by the nodes of their shard.
+  return topology->GetAvailableServersWeighted(shard_idx, with_master, cc);
 }
 
 void ClusterSentinelImpl::WaitConnectedDebug(bool /*allow_empty_slaves*/) {
@@ -996,7 +992,7 @@ void ClusterSentinelImpl::AsyncCommandToSentinel(CommandPtr /*command*/) {
 }
 
 size_t ClusterSentinelImpl::ShardByKey(const std::string& key) const {
-  const auto slot = HashSlot(key);
+  const auto slot = GetClusterHashSlot(key);
   const auto ptr = topology_holder_->GetTopology();
   return ptr->GetShardIndexBySlot(slot);
 }
@@ -1,11 +1,13 @@
 #include "cluster_shard.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <vector>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
 #include "command_control_impl.hpp"
 
@@ -19,6 +21,7 @@ bool IsNearestServerPing(const CommandControlImpl& control) {
   switch (control.strategy) {
     case CommandControl::Strategy::kEveryDc:
     case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kLowestLatency:
       return false;
     case CommandControl::Strategy::kLocalDcConductor:
     case CommandControl::Strategy::kNearestServerPing:
@@ -88,6 +91,22 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
   const auto is_nearest_ping_server = IsNearestServerPing(cc);
   const auto is_retry = command->counter != 0;
 
+  if (cc.strategy == CommandControl::Strategy::kLowestLatency && !is_retry &&
+      command->instance_idx == SentinelImpl::kDefaultPrevInstanceIdx) {
+    /// Master is the last server, it is a candidate only if reads from
+    /// master are allowed or there are no replicas
+    const auto candidates_count =
+        cc.allow_reads_from_master ? servers_count
+                                   : std::max<size_t>(servers_count - 1, 1);
+    size_t idx = SentinelImpl::kDefaultPrevInstanceIdx;
+    const auto instance =
+        GetLowestLatencyInstance(available_servers, candidates_count, &idx);
+    if (instance) {
+      command->instance_idx = idx;
+      if (instance->AsyncCommand(command)) return true;
+    }
+  }
+
   const auto masters_count = 1;
   const auto max_attempts = replicas_.size() + masters_count + 1;
   for (size_t attempt = 0; attempt < max_attempts; attempt++) {
@@ -248,6 +267,44 @@ ClusterShard::RedisPtr ClusterShard::GetInstance(
   return ret;
 }
 
+ClusterShard::RedisPtr ClusterShard::GetLowestLatencyInstance(
+    const std::vector<RedisConnectionPtr>& instances, size_t candidates_count,
+    size_t* pinstance_idx) {
+  candidates_count = std::min(candidates_count, instances.size());
+  if (candidates_count == 0) return {};
+
+  const auto get_available = [&instances](size_t idx) -> RedisPtr {
+    const auto& connection = instances[idx];
+    if (!connection) return {};
+    auto instance = connection->Get();
+    if (!instance || !instance->IsAvailable()) return {};
+    return instance;
+  };
+  const auto get_load = [](const RedisPtr& instance) {
+    return InstanceLoad{instance->GetCommandLatency(),
+                        instance->GetRunningCommands()};
+  };
+
+  /// Power of two choices: comparing two random instances avoids herding
+  /// onto the single least loaded one
+  const auto first_idx = utils::RandRange(candidates_count);
+  auto second_idx = first_idx;
+  if (candidates_count > 1) {
+    second_idx = (first_idx + 1 + utils::RandRange(candidates_count - 1)) %
+                 candidates_count;
+  }
+
+  auto first = get_available(first_idx);
+  auto second = get_available(second_idx);
+  if (!first || (second && IsLessLoaded(get_load(second), get_load(first)))) {
+    if (!second) return {};
+    *pinstance_idx = second_idx;
+    return second;
+  }
+  *pinstance_idx = first_idx;
+  return first;
+}
+
 bool ClusterShard::IsMasterReady() const {
   return master_ && master_->GetState() == Redis::State::kConnected;
 }
@@ -296,6 +353,16 @@ size_t GetStartIndex(const CommandControl& command_control, size_t attempt,
   return (prev_instance_idx + 1 + attempt) % servers_count;
 }
 
+bool IsLessLoaded(const InstanceLoad& lhs, const InstanceLoad& rhs) {
+  /// An instance without replies yet has zero latency, +1 keeps the number
+  /// of running commands significant for it
+  const auto cost = [](const InstanceLoad& load) {
+    return static_cast<double>(load.latency.count() + 1) *
+           static_cast<double>(load.running_commands + 1);
+  };
+  return cost(lhs) < cost(rhs);
+}
+
 std::vector<ClusterShard::RedisConnectionPtr>
 ClusterShard::MakeReadonlyWithMasters() const {
   std::vector<RedisConnectionPtr> ret;
@@ -60,6 +60,11 @@ class ClusterShard {
                               bool read_only) const;
   std::vector<RedisConnectionPtr> GetAvailableServers(
       const CommandControl& command_control) const;
+  /// Picks the less loaded of two random available instances, returns
+  /// nullptr if none of them is available
+  static RedisPtr GetLowestLatencyInstance(
+      const std::vector<RedisConnectionPtr>& instances, size_t candidates_count,
+      size_t* pinstance_idx);
   static RedisPtr GetInstance(const std::vector<RedisConnectionPtr>& instances,
                               bool is_retry, size_t start_idx, size_t attempt,
                               bool is_nearest_ping_server, size_t best_dc_count,
@@ -77,6 +82,16 @@ class ClusterShard {
 size_t GetStartIndex(const CommandControl& command_control, size_t attempt,
                      bool is_nearest_ping_server, size_t prev_instance_idx,
                      size_t current, size_t servers_count);
+
+struct InstanceLoad {
+  std::chrono::microseconds latency{0};
+  size_t running_commands{0};
+};
+
+/// The expected wait of a new command: the average reply time multiplied
+/// by the number of commands queued before it
+bool IsLessLoaded(const InstanceLoad& lhs, const InstanceLoad& rhs);
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
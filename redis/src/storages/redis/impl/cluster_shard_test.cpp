@@ -280,4 +280,24 @@ INSTANTIATE_TEST_SUITE_P(
                    redis::CommandControl::Strategy::kNearestServerPing, 3),
             0, kNearestServerPing, 2, 2, kServersCount, 0)));
 
+TEST(ClusterShardLowestLatency, IsLessLoaded) {
+  using redis::InstanceLoad;
+  using std::chrono::microseconds;
+
+  EXPECT_TRUE(redis::IsLessLoaded(InstanceLoad{microseconds{100}, 0},
+                                  InstanceLoad{microseconds{200}, 0}));
+  EXPECT_FALSE(redis::IsLessLoaded(InstanceLoad{microseconds{200}, 0},
+                                   InstanceLoad{microseconds{100}, 0}));
+
+  /// A fast instance with a long queue is worse than an idle slow one
+  EXPECT_TRUE(redis::IsLessLoaded(InstanceLoad{microseconds{300}, 0},
+                                  InstanceLoad{microseconds{100}, 10}));
+
+  /// Instances without replies yet still account for the running commands
+  EXPECT_TRUE(redis::IsLessLoaded(InstanceLoad{microseconds{0}, 1},
+                                  InstanceLoad{microseconds{0}, 2}));
+  EXPECT_FALSE(redis::IsLessLoaded(InstanceLoad{microseconds{0}, 0},
+                                   InstanceLoad{microseconds{0}, 0}));
+}
+
 USERVER_NAMESPACE_END
@@ -23,7 +23,7 @@ void SubscribeImplImpl(
     const ClusterSubscriptionStorage::ChannelName& channel_name,
     CallBackType cb, const CommandControl& control, SubscriptionId id) {
   const auto& channel = channel_name.channel;
-  const std::lock_guard<std::mutex> lock(storage_impl.mutex_);
+  const std::lock_guard<std::shared_mutex> lock(storage_impl.mutex_);
   auto find_res = map.find(channel);
   if (find_res == map.end()) {
     const size_t selected_shard_idx = ClusterTopology::kUnknownShard;
@@ -52,7 +52,7 @@ void SubscribeImplImpl(
 ClusterSubscriptionStorage::ClusterSubscriptionStorage(
     const std::shared_ptr<ThreadPools>& thread_pools, size_t shards_count)
     : storage_impl_(shards_count, *this), thread_pools_(thread_pools) {
-  /// TODO: support multiple shards for ssubscribe
+  /// Sharded subscriptions are split by the owning shards in DoRebalance
   rebalance_scheduler_ = std::make_unique<SubscriptionRebalanceScheduler>(
       thread_pools->GetSentinelThreadPool(), *this,
       ClusterTopology::kUnknownShard);
@@ -85,6 +85,11 @@ void ClusterSubscriptionStorage::SetShardedUnsubscribeCallback(
   storage_impl_.sharded_unsubscribe_callback_ = std::move(cb);
 }
 
+void ClusterSubscriptionStorage::SetShardedChannelServersCallback(
+    ShardedChannelServersCb cb) {
+  storage_impl_.sharded_channel_servers_callback_ = std::move(cb);
+}
+
 SubscriptionToken ClusterSubscriptionStorage::Subscribe(
     const std::string& channel, Sentinel::UserMessageCallback cb,
     CommandControl control) {
@@ -109,7 +114,7 @@ void ClusterSubscriptionStorage::Unsubscribe(SubscriptionId subscription_id) {
 
 void ClusterSubscriptionStorage::Stop() {
   {
-    const std::unique_lock<std::mutex> lock(storage_impl_.mutex_);
+    const std::unique_lock<std::shared_mutex> lock(storage_impl_.mutex_);
     storage_impl_.callback_map_.clear();
     storage_impl_.pattern_callback_map_.clear();
     storage_impl_.sharded_callback_map_.clear();
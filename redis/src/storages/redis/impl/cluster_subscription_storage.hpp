@@ -18,6 +18,7 @@ class ClusterSubscriptionStorage : public SubscriptionStorageBase {
   void SetUnsubscribeCallback(CommandCb) override;
   void SetShardedSubscribeCallback(ShardedCommandCb) override;
   void SetShardedUnsubscribeCallback(ShardedCommandCb) override;
+  void SetShardedChannelServersCallback(ShardedChannelServersCb) override;
 
   SubscriptionToken Subscribe(const std::string& channel,
                               Sentinel::UserMessageCallback cb,
@@ -94,6 +94,23 @@ class SubscriptionTest : public ::testing::Test {
 
   void Rebalance(size_t shard) { storage_->DoRebalance(shard, weights); }
 
+  /// channel0..channel3 belong to shard 0 served by host0 and host1,
+  /// other channels belong to shard 1 served by host2
+  void SetShardedChannelOwners() {
+    auto channel_servers = [this](const std::string& channel) {
+      const bool first_shard = channel < "channel4";
+      redis::SubscriptionStorageBase::ShardedChannelServers servers;
+      servers.shard_idx = first_shard ? 0 : 1;
+      if (first_shard) {
+        servers.weights = {{server_ids[0], 1}, {server_ids[1], 1}};
+      } else {
+        servers.weights = {{server_ids[2], 1}};
+      }
+      return servers;
+    };
+    storage_->SetShardedChannelServersCallback(channel_servers);
+  }
+
   const auto& GetSubscriptionsByHost() const { return subscriptions_by_host_; }
   const auto& GetShardedSubscriptionsByHost() const {
     return ssubscriptions_by_host_;
@@ -174,4 +191,27 @@ TEST_F(SubscriptionTest, Sharded) {
   EXPECT_EQ(expected, subscriptions_by_host);
 }
 
+/// Test sharded subscriptions stay on the servers of the owning shards
+TEST_F(SubscriptionTest, ShardedOwningShards) {
+  const std::unordered_map<std::string, size_t> expected = {
+      /// Two of four channel0..channel3 subscriptions are moved from host0,
+      /// both channel4 and channel5 are moved to the only host of the shard
+      {"host1", 2},
+      {"host2", 2},
+  };
+
+  SetShardedChannelOwners();
+  Ssubscribe("channel0");
+  Ssubscribe("channel1");
+  Ssubscribe("channel2");
+  Ssubscribe("channel3");
+  Ssubscribe("channel4");
+  Ssubscribe("channel5");
+
+  ProcessCommands();
+  Rebalance(0);
+
+  EXPECT_EQ(expected, GetShardedSubscriptionsByHost());
+}
+
 USERVER_NAMESPACE_END
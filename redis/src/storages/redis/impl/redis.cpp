@@ -27,6 +27,7 @@
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/reply_data_reader.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
@@ -39,6 +40,7 @@ namespace {
 
 const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
+const auto kCommandLatencyExp = 0.9;
 const size_t kMissedPingStreakThresholdDefault = 3;
 
 // channel is used for periodic subscribe/unsubscribe to calculate actual RTT
@@ -51,6 +53,14 @@ const std::string kSubscriberPingChannelName = "_ping_dummy_ch";
 #define REDIS_ERR_TIMEOUT 6
 #endif
 
+size_t GetArgsBytes(const CmdArgs& cmd_args) {
+  size_t bytes = 0;
+  for (const auto& args : cmd_args.args) {
+    for (const auto& arg : args) bytes += arg.size();
+  }
+  return bytes;
+}
+
 ReplyStatus NativeToReplyStatus(int status) {
   constexpr utils::TrivialBiMap error_map = [](auto selector) {
     return selector()
@@ -170,6 +180,10 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::chrono::milliseconds GetPingLatency() const {
     return std::chrono::milliseconds(ping_latency_ms_);
   }
+  std::chrono::microseconds GetCommandLatency() const {
+    return std::chrono::microseconds(
+        static_cast<int64_t>(command_latency_us_.load()));
+  }
   void SetCommandsBufferingSettings(
       CommandsBufferingSettings commands_buffering_settings);
   void SetReplicationMonitoringSettings(
@@ -218,9 +232,10 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   void OnNewCommandImpl();
   void CommandLoopImpl();
-  void OnRedisReplyImpl(redisReply* redis_reply, void* privdata, int status,
+  void OnRedisReplyImpl(ReplyData&& reply_data, void* privdata, int status,
                         const char* errstr);
   void AccountPingLatency(std::chrono::milliseconds latency);
+  void AccountCommandLatency(const CommandPtr& command);
   void AccountRtt();
   void OnTimerPingImpl();
   void OnTimerInfoImpl();
@@ -234,6 +249,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   void ProcessCommand(const CommandPtr& command);
 
   void Authenticate();
+  void EnableClientTracking();
+  void SendClientTracking(int64_t client_id);
   void SendReadOnly();
   void FreeCommands();
 
@@ -251,6 +268,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   static bool WatchCommandTimerEnabled(
       const CommandsBufferingSettings& commands_buffering_settings);
+  bool ShouldBufferCommands(
+      const CommandsBufferingSettings& commands_buffering_settings) const;
 
   bool Connect(const std::string& host, int port, const Password& password);
 
@@ -274,6 +293,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::string server_;
   Password password_{std::string()};
   std::atomic<size_t> commands_size_ = 0;
+  std::atomic<size_t> commands_bytes_ = 0;
   size_t sent_count_ = 0;
   size_t cmd_counter_ = 0;
   std::unordered_map<size_t, std::unique_ptr<SingleCommand>> reply_privdata_;
@@ -292,11 +312,15 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::atomic_bool enable_replication_monitoring_ = false;
   std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
   const bool send_readonly_;
+  const bool client_tracking_;
+  const bool reply_data_reader_;
   const ConnectionSecurity connection_security_;
   std::chrono::milliseconds ping_interval_{2000};
   std::chrono::milliseconds ping_timeout_{4000};
   std::chrono::milliseconds info_replication_interval_{2000};
   std::atomic<double> ping_latency_ms_{kInitialPingLatencyMs};
+  // Written from the event loop only
+  std::atomic<double> command_latency_us_{0};
   logging::LogExtra log_extra_;
   bool watch_command_timer_started_ = false;
   Statistics statistics_;
@@ -359,6 +383,10 @@ std::chrono::milliseconds Redis::GetPingLatency() const {
   return impl_->GetPingLatency();
 }
 
+std::chrono::microseconds Redis::GetCommandLatency() const {
+  return impl_->GetCommandLatency();
+}
+
 bool Redis::IsDestroying() const { return impl_->IsDestroying(); }
 
 bool Redis::IsSyncing() const { return impl_->IsSyncing(); }
@@ -393,6 +421,8 @@ Redis::RedisImpl::RedisImpl(
       ev_thread_control_(thread_control),
       thread_pool_(thread_pool),
       send_readonly_(redis_settings.send_readonly),
+      client_tracking_(redis_settings.client_tracking),
+      reply_data_reader_(redis_settings.reply_data_reader),
       connection_security_(redis_settings.connection_security),
       server_id_(ServerId::Generate()),
       retry_budget_(utils::RetryBudgetSettings{100, 0.1, false}) {
@@ -473,6 +503,9 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port,
   UASSERT(context_ != nullptr);
 
   context_->data = this;
+  if (reply_data_reader_ && context_->c.reader) {
+    UseReplyDataReader(*context_->c.reader);
+  }
 
   if (context_->err) {
     LOG_WARNING() << "error after redisAsyncConnect (host=" << host
@@ -539,6 +572,10 @@ void Redis::RedisImpl::InvokeCommand(const CommandPtr& command,
   const CommandControlImpl cc{command->control};
   if (cc.account_in_statistics)
     statistics_.AccountReplyReceived(reply, command);
+  if (reply->status == ReplyStatus::kOk ||
+      reply->status == ReplyStatus::kTimeoutError) {
+    AccountCommandLatency(command);
+  }
   reply->server = server_;
   if (reply->status == ReplyStatus::kTimeoutError) {
     reply->log_extra.Extend("timeout_ms", cc.timeout_single.count());
@@ -601,14 +638,31 @@ bool Redis::RedisImpl::WatchCommandTimerEnabled(
              std::chrono::microseconds::zero();
 }
 
+bool Redis::RedisImpl::ShouldBufferCommands(
+    const CommandsBufferingSettings& commands_buffering_settings) const {
+  if (!WatchCommandTimerEnabled(commands_buffering_settings)) return false;
+
+  const auto commands_threshold =
+      commands_buffering_settings.commands_buffering_threshold;
+  if (commands_threshold && commands_size_.load() >= commands_threshold) {
+    return false;
+  }
+
+  const auto bytes_threshold =
+      commands_buffering_settings.commands_buffering_bytes_threshold;
+  return !bytes_threshold || commands_bytes_.load() < bytes_threshold;
+}
+
 bool Redis::RedisImpl::AsyncCommand(const CommandPtr& command) {
   LOG_DEBUG() << "AsyncCommand for server_id=" << GetServerId().GetId()
               << " server=" << GetServerId().GetDescription()
               << " cmd=" << command->args;
+  const auto bytes = GetArgsBytes(command->args);
   {
     std::lock_guard<std::mutex> lock(command_mutex_);
     if (destroying_) return false;
     ++commands_size_;
+    commands_bytes_ += bytes;
     commands_.push_back(command);
   }
   ev_thread_control_.Send(watch_command_);
@@ -659,6 +713,13 @@ void Redis::RedisImpl::OnCommandTimeoutImpl(ev_timer* w) {
   }
 }
 
+void Redis::RedisImpl::AccountCommandLatency(const CommandPtr& command) {
+  const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - command->GetStartHandlingTime());
+  command_latency_us_ = command_latency_us_.load() * kCommandLatencyExp +
+                        latency.count() * (1 - kCommandLatencyExp);
+}
+
 void Redis::RedisImpl::AccountPingLatency(std::chrono::milliseconds latency) {
   statistics_.AccountPing(latency);
   ping_latency_ms_ = (ping_latency_ms_.load() * kPingLatencyExp +
@@ -872,6 +933,7 @@ void Redis::RedisImpl::FreeCommands() {
           "Disconnecting, killing commands still waiting in send queue");
     }
   }
+  commands_bytes_ = 0;
 
   for (auto& info : reply_privdata_) {
     ev_thread_control_.Stop(info.second->timer);
@@ -898,10 +960,7 @@ void Redis::RedisImpl::OnNewCommand(struct ev_loop*, ev_async* w,
 
 void Redis::RedisImpl::OnNewCommandImpl() {
   auto commands_buffering_settings = commands_buffering_settings_.Get();
-  if (WatchCommandTimerEnabled(*commands_buffering_settings) &&
-      (!commands_buffering_settings->commands_buffering_threshold ||
-       commands_size_.load() <
-           commands_buffering_settings->commands_buffering_threshold)) {
+  if (ShouldBufferCommands(*commands_buffering_settings)) {
     if (!std::exchange(watch_command_timer_started_, true)) {
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
       ev_timer_set(
@@ -937,12 +996,18 @@ void Redis::RedisImpl::CommandLoopImpl() {
   {
     std::lock_guard<std::mutex> lock(command_mutex_);
     commands_size_ -= commands_.size();
+    commands_bytes_ = 0;
     std::swap(commands_, commands);
   }
   LOG_TRACE() << "commands size=" << commands.size();
+  if (commands.empty()) return;
+
+  // hiredis accumulates the commands in its output buffer and sends them
+  // with a single write once the loop iteration is over
   for (auto& command : commands) {
     ProcessCommand(command);
   }
+  statistics_.AccountCommandsWritten(commands.size());
 }
 
 void Redis::RedisImpl::OnConnect(const redisAsyncContext* c,
@@ -1041,19 +1106,13 @@ bool Redis::RedisImpl::InitSecureConnection() {
 
 void Redis::RedisImpl::Authenticate() {
   if (password_.GetUnderlying().empty()) {
-    if (send_readonly_)
-      SendReadOnly();
-    else
-      SetState(State::kConnected);
+    EnableClientTracking();
   } else {
     ProcessCommand(PrepareCommand(
         CmdArgs{"AUTH", password_.GetUnderlying()},
         [this](const CommandPtr&, ReplyPtr reply) {
           if (*reply && reply->data.IsStatus()) {
-            if (send_readonly_)
-              SendReadOnly();
-            else
-              SetState(State::kConnected);
+            EnableClientTracking();
           } else {
             if (*reply) {
               if (reply->IsUnknownCommandError()) {
@@ -1079,7 +1138,49 @@ void Redis::RedisImpl::Authenticate() {
   }
 }
 
+void Redis::RedisImpl::EnableClientTracking() {
+  if (!client_tracking_) {
+    SendReadOnly();
+    return;
+  }
+
+  // RESP2 connections receive invalidations only as pubsub messages of the
+  // redirection target, so the connection redirects them to itself
+  ProcessCommand(PrepareCommand(
+      CmdArgs{"CLIENT", "ID"}, [this](const CommandPtr&, ReplyPtr reply) {
+        if (*reply && reply->data.IsInt()) {
+          SendClientTracking(reply->data.GetInt());
+        } else {
+          LOG_LIMITED_ERROR() << log_extra_ << "CLIENT ID failed: "
+                              << (*reply ? reply->data.ToDebugString()
+                                         : reply->status_string);
+          Disconnect();
+        }
+      }));
+}
+
+void Redis::RedisImpl::SendClientTracking(int64_t client_id) {
+  ProcessCommand(PrepareCommand(
+      CmdArgs{"CLIENT", "TRACKING", "ON", "REDIRECT", std::to_string(client_id),
+              "BCAST"},
+      [this](const CommandPtr&, ReplyPtr reply) {
+        if (*reply && reply->data.IsStatus()) {
+          SendReadOnly();
+        } else {
+          LOG_LIMITED_ERROR() << log_extra_ << "CLIENT TRACKING failed: "
+                              << (*reply ? reply->data.ToDebugString()
+                                         : reply->status_string);
+          Disconnect();
+        }
+      }));
+}
+
 void Redis::RedisImpl::SendReadOnly() {
+  if (!send_readonly_) {
+    SetState(State::kConnected);
+    return;
+  }
+
   LOG_DEBUG() << "Send READONLY command to slave "
               << GetServerId().GetDescription() << " in cluster mode";
   ProcessCommand(PrepareCommand(CmdArgs{"READONLY"}, [this](const CommandPtr&,
@@ -1108,20 +1209,24 @@ void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r,
   UASSERT(impl != nullptr);
   try {
     if (r || c->err != REDIS_OK) {
-      impl->OnRedisReplyImpl(static_cast<redisReply*>(r), privdata, c->err,
-                             c->errstr);
+      impl->OnRedisReplyImpl(impl->reply_data_reader_
+                                 ? TakeReplyData(r)
+                                 : ReplyData(static_cast<redisReply*>(r)),
+                             privdata, c->err, c->errstr);
     } else {
       // redisAsyncDisconnect causes empty replies with OK status,
       // translate to something sensible.
-      impl->OnRedisReplyImpl(nullptr, privdata, REDIS_ERR_EOF, "Disconnecting");
+      impl->OnRedisReplyImpl(ReplyData(static_cast<redisReply*>(nullptr)),
+                             privdata, REDIS_ERR_EOF, "Disconnecting");
     }
   } catch (const std::exception& ex) {
     LOG_ERROR() << "OnRedisReplyImpl() failed: " << ex;
   }
 }
 
-void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
-                                        int status, const char* errstr) {
+void Redis::RedisImpl::OnRedisReplyImpl(ReplyData&& reply_data,
+                                        void* privdata, int status,
+                                        const char* errstr) {
   auto data = reply_privdata_.find(reinterpret_cast<size_t>(privdata));
   if (data == reply_privdata_.end()) return;
 
@@ -1131,7 +1236,8 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
   ev_thread_control_.Stop(data->second->timer);
   pcommand = data->second.get();
 
-  auto reply = std::make_shared<Reply>(pcommand->cmd, redis_reply,
+  const bool has_reply_data = static_cast<bool>(reply_data);
+  auto reply = std::make_shared<Reply>(pcommand->cmd, std::move(reply_data),
                                        NativeToReplyStatus(status),
                                        errstr ? errstr : "");
 
@@ -1143,7 +1249,7 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
   // SUBSCRIBE request with the same channel name until the response to
   // UNSUBSCRIBE request is received. shard_subscriber::Fsm checks it.
   // TODO: add check in RedisImpl.
-  if (!subscriber_ || !redis_reply || IsUnsubscribeReply(reply)) {
+  if (!subscriber_ || !has_reply_data || IsUnsubscribeReply(reply)) {
     command_ptr = std::move(data->second);
     if (!subscriber_) --sent_count_;
 
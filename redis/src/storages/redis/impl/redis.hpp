@@ -38,6 +38,8 @@ class Redis {
   bool AsyncCommand(const CommandPtr& command);
   size_t GetRunningCommands() const;
   std::chrono::milliseconds GetPingLatency() const;
+  /// Exponentially weighted moving average of the command reply times
+  std::chrono::microseconds GetCommandLatency() const;
   bool IsDestroying() const;
   std::string GetServerHost() const;
   uint16_t GetServerPort() const;
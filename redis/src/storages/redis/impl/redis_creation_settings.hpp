@@ -11,6 +11,12 @@ namespace redis {
 struct RedisCreationSettings {
   ConnectionSecurity connection_security = ConnectionSecurity::kNone;
   bool send_readonly{false};
+  /// Send `CLIENT TRACKING ON BCAST` redirecting invalidations to the
+  /// connection itself, see ConnectionMode::kSubscriberWithTracking
+  bool client_tracking{false};
+  /// Parse the replies right into ReplyData, see UseReplyDataReader().
+  /// Must be disabled for subscriber connections.
+  bool reply_data_reader{false};
 };
 
 }  // namespace redis
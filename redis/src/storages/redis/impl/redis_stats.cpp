@@ -165,6 +165,10 @@ void Statistics::AccountCommandSent(const CommandPtr& cmd) {
   }
 }
 
+void Statistics::AccountCommandsWritten(size_t commands_count) {
+  commands_per_write_percentile.GetCurrentCounter().Account(commands_count);
+}
+
 void Statistics::AccountReplyReceived(const ReplyPtr& reply,
                                       const CommandPtr& cmd) {
   reply_size_percentile.GetCurrentCounter().Account(reply->data.GetSize());
@@ -211,6 +215,7 @@ void DumpMetric(utils::statistics::Writer& writer,
 
   if (stats.settings.IsRequestSizesEnabled()) {
     writer["request_sizes"] = stats.request_size_percentile;
+    writer["commands_per_write"] = stats.commands_per_write_percentile;
   }
   if (stats.settings.IsReplySizesEnabled()) {
     writer["reply_sizes"] = stats.reply_size_percentile;
@@ -31,6 +31,7 @@ class Statistics {
 
   void AccountStateChanged(RedisState new_state);
   void AccountCommandSent(const CommandPtr& cmd);
+  void AccountCommandsWritten(size_t commands_count);
   void AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd);
   void AccountPing(std::chrono::milliseconds ping);
   void AccountError(ReplyStatus code);
@@ -44,6 +45,7 @@ class Statistics {
   utils::statistics::RateCounter reconnects{0};
   std::atomic<std::chrono::milliseconds> session_start_time{};
   RecentPeriod request_size_percentile;
+  RecentPeriod commands_per_write_percentile;
   RecentPeriod reply_size_percentile;
   RecentPeriod timings_percentile;
   std::unordered_map<std::string_view, RecentPeriod> command_timings_percentile;
@@ -64,6 +66,8 @@ struct InstanceStatistics {
     session_start_time =
         other.session_start_time.load(std::memory_order_relaxed);
     request_size_percentile = other.request_size_percentile.GetStatsForPeriod();
+    commands_per_write_percentile =
+        other.commands_per_write_percentile.GetStatsForPeriod();
     reply_size_percentile = other.reply_size_percentile.GetStatsForPeriod();
     timings_percentile = other.timings_percentile.GetStatsForPeriod();
     last_ping_ms = other.last_ping_ms.load(std::memory_order_relaxed);
@@ -82,6 +86,7 @@ struct InstanceStatistics {
   void Add(const InstanceStatistics& other) {
     reconnects += other.reconnects;
     request_size_percentile.Add(other.request_size_percentile);
+    commands_per_write_percentile.Add(other.commands_per_write_percentile);
     reply_size_percentile.Add(other.reply_size_percentile);
     timings_percentile.Add(other.timings_percentile);
 
@@ -97,6 +102,7 @@ struct InstanceStatistics {
   utils::statistics::RateCounter reconnects{};
   std::chrono::milliseconds session_start_time{};
   Statistics::Percentile request_size_percentile;
+  Statistics::Percentile commands_per_write_percentile;
   Statistics::Percentile reply_size_percentile;
   Statistics::Percentile timings_percentile;
   std::unordered_map<std::string, Statistics::Percentile>
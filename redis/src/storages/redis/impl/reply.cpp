@@ -75,6 +75,13 @@ ReplyData ReplyData::CreateNil() {
   return data;
 }
 
+ReplyData ReplyData::CreateInteger(int64_t value) {
+  ReplyData data;
+  data.type_ = Type::kInteger;
+  data.integer_ = value;
+  return data;
+}
+
 std::string ReplyData::GetTypeString() const { return TypeToString(GetType()); }
 
 std::string ReplyData::ToDebugString() const {
@@ -273,6 +280,13 @@ Reply::Reply(std::string cmd, redisReply* redis_reply, ReplyStatus status,
 Reply::Reply(std::string cmd, ReplyData&& data)
     : cmd(std::move(cmd)), data(std::move(data)), status(ReplyStatus::kOk) {}
 
+Reply::Reply(std::string cmd, ReplyData&& data, ReplyStatus status,
+             std::string status_string)
+    : cmd(std::move(cmd)),
+      data(std::move(data)),
+      status(status),
+      status_string(std::move(status_string)) {}
+
 bool Reply::IsOk() const { return status == ReplyStatus::kOk; }
 
 bool Reply::IsLoggableError() const {
@@ -0,0 +1,118 @@
+#include <storages/redis/impl/reply_data_reader.hpp>
+
+#include <string>
+#include <type_traits>
+
+#include <hiredis/hiredis.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+struct RootReply final {
+  // hiredis treats the replies as redisReply, e.g. to check for errors. Only
+  // the type is filled, the payload is in `data`.
+  redisReply header{};
+  ReplyData data;
+};
+
+static_assert(std::is_standard_layout_v<RootReply>,
+              "RootReply must be usable as redisReply by hiredis");
+
+ReplyData& GetData(const redisReadTask& task) {
+  if (!task.parent) return static_cast<RootReply*>(task.obj)->data;
+  return *static_cast<ReplyData*>(task.obj);
+}
+
+template <typename Factory>
+void* Emplace(const redisReadTask* task, Factory factory) noexcept {
+  try {
+    if (!task->parent) {
+      auto* root = new RootReply{redisReply{}, factory()};
+      root->header.type = task->type;
+      return root;
+    }
+
+    // hiredis reads the elements in order, the storage is reserved by
+    // CreateArray so the pointers to the elements stay valid
+    auto& array = GetData(*task->parent).GetArray();
+    UASSERT(array.size() == static_cast<std::size_t>(task->idx));
+    return &array.emplace_back(factory());
+  } catch (const std::exception&) {
+    // hiredis reports OOM for a nullptr
+    return nullptr;
+  }
+}
+
+void* CreateString(const redisReadTask* task, char* str, size_t len) {
+  return Emplace(task, [task, str, len] {
+    std::string value(str, len);
+    switch (task->type) {
+      case REDIS_REPLY_ERROR:
+        return ReplyData::CreateError(std::move(value));
+      case REDIS_REPLY_STATUS:
+        return ReplyData::CreateStatus(std::move(value));
+      default:
+        return ReplyData{std::move(value)};
+    }
+  });
+}
+
+template <typename Size>
+void* CreateArray(const redisReadTask* task, Size elements) {
+  return Emplace(task, [elements] {
+    ReplyData::Array array;
+    array.reserve(static_cast<std::size_t>(elements));
+    return ReplyData{std::move(array)};
+  });
+}
+
+void* CreateInteger(const redisReadTask* task, long long value) {
+  return Emplace(task, [value] { return ReplyData::CreateInteger(value); });
+}
+
+void* CreateNil(const redisReadTask* task) {
+  return Emplace(task, [] { return ReplyData::CreateNil(); });
+}
+
+#if HIREDIS_MAJOR >= 1
+void* CreateDouble(const redisReadTask* task, double, char* str, size_t len) {
+  return Emplace(task, [str, len] { return ReplyData{std::string(str, len)}; });
+}
+
+void* CreateBool(const redisReadTask* task, int value) {
+  return Emplace(task, [value] { return ReplyData::CreateInteger(value); });
+}
+#endif
+
+void FreeObject(void* reply) { delete static_cast<RootReply*>(reply); }
+
+#if HIREDIS_MAJOR >= 1
+redisReplyObjectFunctions kReplyDataFunctions{
+    CreateString, CreateArray<size_t>, CreateInteger, CreateDouble,
+    CreateNil,    CreateBool,          FreeObject,
+};
+#else
+redisReplyObjectFunctions kReplyDataFunctions{
+    CreateString, CreateArray<int>, CreateInteger, CreateNil, FreeObject,
+};
+#endif
+
+}  // namespace
+
+void UseReplyDataReader(redisReader& reader) {
+  reader.fn = &kReplyDataFunctions;
+}
+
+ReplyData TakeReplyData(void* reply) {
+  if (!reply) return ReplyData{static_cast<const redisReply*>(nullptr)};
+  return std::move(static_cast<RootReply*>(reply)->data);
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+struct redisReader;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// @brief Makes the hiredis reader build ReplyData while parsing the replies
+///
+/// By default hiredis parses a reply into a redisReply tree that is then
+/// deep-copied into ReplyData. With this reader every payload is copied once
+/// from the reader buffer right into its place in the ReplyData tree.
+///
+/// Replies produced by the reader must be converted with TakeReplyData().
+/// Must not be used for subscriber connections: hiredis inspects the
+/// contents of their replies.
+void UseReplyDataReader(redisReader& reader);
+
+/// Moves the data out of a reply produced by a reader set up with
+/// UseReplyDataReader(). The reply itself is still freed by hiredis.
+ReplyData TakeReplyData(void* reply);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
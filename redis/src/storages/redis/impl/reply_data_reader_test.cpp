@@ -0,0 +1,86 @@
+#include <storages/redis/impl/reply_data_reader.hpp>
+
+#include <memory>
+#include <string_view>
+
+#include <gtest/gtest.h>
+#include <hiredis/hiredis.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct ReaderDeleter {
+  void operator()(redisReader* reader) const { redisReaderFree(reader); }
+};
+
+using ReaderPtr = std::unique_ptr<redisReader, ReaderDeleter>;
+
+ReaderPtr MakeReplyDataReader() {
+  ReaderPtr reader{redisReaderCreate()};
+  redis::UseReplyDataReader(*reader);
+  return reader;
+}
+
+// Returns kNoReply data if the reply is incomplete
+redis::ReplyData Feed(redisReader& reader, std::string_view data) {
+  EXPECT_EQ(REDIS_OK, redisReaderFeed(&reader, data.data(), data.size()));
+  void* reply = nullptr;
+  EXPECT_EQ(REDIS_OK, redisReaderGetReply(&reader, &reply));
+  auto result = redis::TakeReplyData(reply);
+  if (reply) reader.fn->freeObject(reply);
+  return result;
+}
+
+}  // namespace
+
+TEST(ReplyDataReader, Scalars) {
+  auto reader = MakeReplyDataReader();
+
+  auto data = Feed(*reader, "$5\r\nvalue\r\n");
+  ASSERT_TRUE(data.IsString());
+  EXPECT_EQ("value", data.GetString());
+
+  data = Feed(*reader, ":-42\r\n");
+  ASSERT_TRUE(data.IsInt());
+  EXPECT_EQ(-42, data.GetInt());
+
+  EXPECT_TRUE(Feed(*reader, "$-1\r\n").IsNil());
+  EXPECT_TRUE(Feed(*reader, "+OK\r\n").IsStatus());
+
+  data = Feed(*reader, "-ERR index out of range\r\n");
+  ASSERT_TRUE(data.IsError());
+  EXPECT_EQ("ERR index out of range", data.GetError());
+}
+
+TEST(ReplyDataReader, NestedArrays) {
+  auto reader = MakeReplyDataReader();
+
+  const auto data =
+      Feed(*reader, "*3\r\n$1\r\na\r\n*2\r\n:1\r\n$-1\r\n*0\r\n");
+  ASSERT_TRUE(data.IsArray());
+  const auto& array = data.GetArray();
+  ASSERT_EQ(3, array.size());
+  EXPECT_EQ("a", array[0].GetString());
+  ASSERT_TRUE(array[1].IsArray());
+  ASSERT_EQ(2, array[1].GetArray().size());
+  EXPECT_EQ(1, array[1].GetArray()[0].GetInt());
+  EXPECT_TRUE(array[1].GetArray()[1].IsNil());
+  ASSERT_TRUE(array[2].IsArray());
+  EXPECT_TRUE(array[2].GetArray().empty());
+}
+
+TEST(ReplyDataReader, PartialReply) {
+  auto reader = MakeReplyDataReader();
+
+  EXPECT_FALSE(Feed(*reader, "*2\r\n$3\r\nke"));
+  EXPECT_FALSE(Feed(*reader, "y\r\n$5\r\nva"));
+
+  const auto data = Feed(*reader, "lue\r\n");
+  ASSERT_TRUE(data.IsArray());
+  ASSERT_EQ(2, data.GetArray().size());
+  EXPECT_EQ("key", data.GetArray()[0].GetString());
+  EXPECT_EQ("value", data.GetArray()[1].GetString());
+}
+
+USERVER_NAMESPACE_END
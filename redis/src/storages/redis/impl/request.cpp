@@ -1,6 +1,7 @@
 #include <userver/storages/redis/impl/request.hpp>
 
 #include <userver/tracing/in_place_span.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <userver/storages/redis/exception.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
@@ -41,6 +42,54 @@ class ReplyState {
   bool executed_{false};
 };
 
+class PipelinedReplyState {
+ public:
+  explicit PipelinedReplyState(std::vector<size_t>&& last_reply_indices)
+      : span_("redis_pipeline"),
+        last_reply_indices_(std::move(last_reply_indices)),
+        promises_(last_reply_indices_.size()) {
+    span_.Get().DetachFromCoroStack();
+  }
+
+  ~PipelinedReplyState() {
+    if (next_part_ != promises_.size()) {
+      LOG_WARNING() << "A pipelined request has been dropped";
+    }
+  }
+
+  engine::Promise<ReplyPtr>& Promise(size_t part) { return promises_[part]; }
+
+  void OnReply(ReplyPtr&& reply) {
+    if (next_part_ == promises_.size()) {
+      LOG_LIMITED_WARNING() << "redis::Command keeps running after "
+                               "triggering the callbacks of all the parts";
+      return;
+    }
+
+    if (reply->status != ReplyStatus::kOk) {
+      // The remaining replies are not going to arrive
+      reply->FillSpanTags(span_.Get());
+      for (; next_part_ + 1 < promises_.size(); ++next_part_) {
+        promises_[next_part_].set_value(std::make_shared<Reply>(*reply));
+      }
+      promises_[next_part_++].set_value(std::move(reply));
+      return;
+    }
+
+    if (replies_received_++ != last_reply_indices_[next_part_]) return;
+
+    if (next_part_ + 1 == promises_.size()) reply->FillSpanTags(span_.Get());
+    promises_[next_part_++].set_value(std::move(reply));
+  }
+
+ private:
+  tracing::InPlaceSpan span_;
+  const std::vector<size_t> last_reply_indices_;
+  std::vector<engine::Promise<ReplyPtr>> promises_;
+  size_t replies_received_{0};
+  size_t next_part_{0};
+};
+
 std::string MakeSpanName(const CmdArgs& cmd_args) {
   if (cmd_args.args.empty() || cmd_args.args.front().empty()) {
     return "redis_unknown";
@@ -110,6 +159,49 @@ CommandPtr Request::PrepareRequest(CmdArgs&& args,
   return command;
 }
 
+Request::Request(engine::Future<ReplyPtr>&& future, engine::Deadline deadline)
+    : future_(std::move(future)), deadline_(deadline) {}
+
+std::vector<Request> Request::MakePipelined(
+    Sentinel& sentinel, std::vector<CmdArgs>&& parts, size_t shard,
+    bool master, const CommandControl& command_control) {
+  UASSERT(!parts.empty());
+
+  CmdArgs args;
+  std::vector<size_t> last_reply_indices;
+  last_reply_indices.reserve(parts.size());
+  for (auto& part : parts) {
+    UASSERT(!part.args.empty());
+    for (auto& subcommand : part.args) {
+      args.args.push_back(std::move(subcommand));
+    }
+    last_reply_indices.push_back(args.args.size() - 1);
+  }
+
+  auto control = command_control;
+  control.max_retries = 1;
+  const auto deadline = engine::Deadline::FromDuration(
+      CommandControlImpl{control}.timeout_all);
+
+  auto state_ptr =
+      std::make_shared<PipelinedReplyState>(std::move(last_reply_indices));
+  std::vector<Request> requests;
+  requests.reserve(parts.size());
+  for (size_t part = 0; part < parts.size(); ++part) {
+    requests.push_back(
+        Request{state_ptr->Promise(part).get_future(), deadline});
+  }
+
+  auto command = PrepareCommand(
+      std::move(args),
+      [state_ptr = std::move(state_ptr)](const CommandPtr&, ReplyPtr reply) {
+        state_ptr->OnReply(std::move(reply));
+      },
+      control);
+  sentinel.AsyncCommand(std::move(command), master, shard);
+  return requests;
+}
+
 ReplyPtr Request::Get() {
   switch (future_.wait_until(deadline_)) {
     case engine::FutureStatus::kReady:
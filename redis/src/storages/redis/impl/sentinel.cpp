@@ -56,8 +56,19 @@ void OnSubscribeImpl(std::string_view message_type,
                          reply_array[2].GetInt());
   } else if (!strcasecmp(reply_array[0].GetString().c_str(),
                          message_type.data())) {
-    message_callback(reply->server_id, reply_array[1].GetString(),
-                     reply_array[2].GetString());
+    const auto& payload = reply_array[2];
+    if (payload.IsArray()) {
+      // Client tracking invalidation, deliver a message per key
+      for (const auto& key : payload.GetArray()) {
+        if (key.IsString()) {
+          message_callback(reply->server_id, reply_array[1].GetString(),
+                           key.GetString());
+        }
+      }
+    } else if (payload.IsString()) {
+      message_callback(reply->server_id, reply_array[1].GetString(),
+                       payload.GetString());
+    }
   }
 }
 
@@ -168,6 +168,17 @@ class Sentinel {
             command_control, replies_to_skip};
   }
 
+  /// Sends the parts as a single command, so they are written to the
+  /// connection back-to-back. The reply to the last subcommand of a part
+  /// sets the result of the corresponding request. The command is not
+  /// retried: some of the parts may have already been executed.
+  std::vector<Request> MakePipelinedRequests(
+      std::vector<CmdArgs>&& parts, size_t shard, bool master = true,
+      const CommandControl& command_control = {}) {
+    return Request::MakePipelined(*this, std::move(parts), shard, master,
+                                  command_control);
+  }
+
   std::vector<Request> MakeRequests(CmdArgs&& args, bool master = true,
                                     const CommandControl& command_control = {},
                                     size_t replies_to_skip = 0);
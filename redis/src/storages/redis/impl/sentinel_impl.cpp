@@ -4,8 +4,6 @@
 #include <sstream>
 #include <thread>
 
-#include <boost/crc.hpp>
-
 #include <fmt/format.h>
 
 #include <hiredis/hiredis.h>
@@ -187,6 +185,10 @@ void SentinelImpl::InitShards(
     shard_options.shard_name = shard;
     shard_options.shard_group_name = shard_group_name_;
     shard_options.cluster_mode = IsInClusterMode();
+    shard_options.client_tracking =
+        connection_mode_ == ConnectionMode::kSubscriberWithTracking;
+    shard_options.reply_data_reader =
+        connection_mode_ == ConnectionMode::kCommands;
     shard_options.ready_change_callback = [i, shard,
                                            ready_callback](bool ready) {
       if (ready_callback) ready_callback(i, shard, ready);
@@ -833,11 +835,11 @@ void SentinelImpl::CheckConnections() {
       }
       LOG_WARNING() << "Failed to start in redis cluster mode for client="
                     << client_name_ << ". Switch to "
-                    << (connection_mode_ == ConnectionMode::kSubscriber
+                    << (connection_mode_ != ConnectionMode::kCommands
                             ? KeyShardZero::kName
                             : KeyShardCrc32::kName)
                     << " sharding strategy (without redis cluster support).";
-      if (connection_mode_ == ConnectionMode::kSubscriber)
+      if (connection_mode_ != ConnectionMode::kCommands)
         key_shard_.Set(std::make_shared<KeyShardZero>());
       else
         key_shard_.Set(std::make_shared<KeyShardCrc32>(ShardsCount()));
@@ -942,12 +944,7 @@ size_t SentinelImpl::ParseMovedShard(const std::string& err_string) {
 }
 
 size_t SentinelImpl::HashSlot(const std::string& key) {
-  size_t start = 0;
-  size_t len = 0;
-  GetRedisKey(key, &start, &len);
-  return std::for_each(key.data() + start, key.data() + start + len,
-                       boost::crc_optimal<16, 0x1021>())() &
-         0x3fff;
+  return GetClusterHashSlot(key);
 }
 
 SentinelImpl::SlotInfo::SlotInfo() {
@@ -70,7 +70,9 @@ Shard::Shard(Options options)
     : shard_name_(std::move(options.shard_name)),
       shard_group_name_(std::move(options.shard_group_name)),
       ready_change_callback_(std::move(options.ready_change_callback)),
-      cluster_mode_(options.cluster_mode) {
+      cluster_mode_(options.cluster_mode),
+      client_tracking_(options.client_tracking),
+      reply_data_reader_(options.reply_data_reader) {
   for (const auto& conn : options.connection_infos) {
     connection_infos_.emplace_back(conn);
   }
@@ -123,7 +125,8 @@ std::vector<unsigned char> Shard::GetAvailableServers(
 
   switch (cc.strategy) {
     case CommandControl::Strategy::kEveryDc:
-    case CommandControl::Strategy::kDefault: {
+    case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kLowestLatency: {
       std::vector<unsigned char> result(instances_.size(), 0);
       for (size_t i = 0; i < instances_.size(); i++) {
         result[i] =
@@ -293,7 +296,8 @@ bool Shard::ProcessCreation(
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
   for (const auto& id : need_to_create) {
     const auto redis_settings = RedisCreationSettings{
-        id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly()};
+        id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly(),
+        client_tracking_, reply_data_reader_};
     ConnectionStatus entry{
         id, std::make_shared<Redis>(
                 redis_thread_pool,
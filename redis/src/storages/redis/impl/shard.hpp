@@ -63,6 +63,8 @@ class Shard {
     std::string shard_name;
     std::string shard_group_name;
     bool cluster_mode{false};
+    bool client_tracking{false};
+    bool reply_data_reader{false};
     std::function<void(bool ready)> ready_change_callback;
     std::vector<ConnectionInfo> connection_infos;
   };
@@ -138,6 +140,8 @@ class Shard {
 
   bool prev_connected_ = false;
   const bool cluster_mode_ = false;
+  const bool client_tracking_ = false;
+  const bool reply_data_reader_ = false;
 };
 
 }  // namespace redis
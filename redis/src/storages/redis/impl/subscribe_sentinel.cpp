@@ -43,11 +43,11 @@ SubscribeSentinel::SubscribeSentinel(
     ConnectionSecurity connection_security, ReadyChangeCallback ready_callback,
     std::unique_ptr<KeyShard>&& key_shard, bool is_cluster_mode,
     CommandControl command_control,
-    const testsuite::RedisControl& testsuite_redis_control)
+    const testsuite::RedisControl& testsuite_redis_control, ConnectionMode mode)
     : Sentinel(thread_pools, shards, conns, std::move(shard_group_name),
                client_name, password, connection_security, ready_callback,
                dynamic_config_source, std::move(key_shard), command_control,
-               testsuite_redis_control, ConnectionMode::kSubscriber),
+               testsuite_redis_control, mode),
       thread_pools_(thread_pools),
       storage_(
           CreateSubscriptionStorage(thread_pools, shards, is_cluster_mode)),
@@ -88,7 +88,8 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
     dynamic_config::Source dynamic_config_source,
     const std::string& client_name, bool is_cluster_mode,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control) {
+    const testsuite::RedisControl& testsuite_redis_control,
+    ConnectionMode mode) {
   auto ready_callback = [](size_t shard, const std::string& shard_name,
                            bool ready) {
     LOG_INFO() << "redis: ready_callback:"
@@ -99,7 +100,8 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
   return Create(thread_pools, settings, std::move(shard_group_name),
                 dynamic_config_source, client_name, std::move(ready_callback),
-                is_cluster_mode, command_control, testsuite_redis_control);
+                is_cluster_mode, command_control, testsuite_redis_control,
+                mode);
 }
 
 std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
@@ -108,7 +110,8 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
     dynamic_config::Source dynamic_config_source,
     const std::string& client_name, ReadyChangeCallback ready_callback,
     bool is_cluster_mode, const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control) {
+    const testsuite::RedisControl& testsuite_redis_control,
+    ConnectionMode mode) {
   const auto& password = settings.password;
 
   const std::vector<std::string>& shards = settings.shards;
@@ -136,7 +139,7 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
       dynamic_config_source, client_name, password, settings.secure_connection,
       std::move(ready_callback),
       (is_cluster_mode ? nullptr : std::make_unique<KeyShardZero>()),
-      is_cluster_mode, command_control, testsuite_redis_control);
+      is_cluster_mode, command_control, testsuite_redis_control, mode);
   subscribe_sentinel->Start();
   return subscribe_sentinel;
 }
@@ -182,7 +185,10 @@ void SubscribeSentinel::RebalanceSubscriptions(size_t shard_idx) {
   const auto with_master =
       IsInClusterMode() ||
       GetCommandControl({}).allow_reads_from_master.value_or(false);
-  auto server_weights = GetAvailableServersWeighted(shard_idx, with_master);
+  /// Classic subscriptions in cluster mode may be served by any node
+  auto server_weights = GetAvailableServersWeighted(
+      IsInClusterMode() ? SentinelImplBase::kUnknownShard : shard_idx,
+      with_master);
   storage_->RequestRebalance(shard_idx, std::move(server_weights));
 }
 
@@ -213,6 +219,13 @@ void SubscribeSentinel::InitStorage() {
       [this](const std::string& channel, CommandPtr cmd) {
         AsyncCommand(cmd, channel, false);
       });
+  storage_->SetShardedChannelServersCallback(
+      [this](const std::string& channel) {
+        const auto shard_idx = ShardByKey(channel);
+        return SubscriptionStorageBase::ShardedChannelServers{
+            shard_idx,
+            GetAvailableServersWeighted(shard_idx, /*with_master=*/true)};
+      });
 }
 
 }  // namespace redis
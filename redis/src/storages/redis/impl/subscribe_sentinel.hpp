@@ -25,7 +25,8 @@ class SubscribeSentinel : protected Sentinel {
       ReadyChangeCallback ready_callback,
       std::unique_ptr<KeyShard>&& key_shard = nullptr,
       bool is_cluster_mode = false, CommandControl command_control = {},
-      const testsuite::RedisControl& testsuite_redis_control = {});
+      const testsuite::RedisControl& testsuite_redis_control = {},
+      ConnectionMode mode = ConnectionMode::kSubscriber);
   ~SubscribeSentinel() override;
 
   static std::shared_ptr<SubscribeSentinel> Create(
@@ -34,14 +35,16 @@ class SubscribeSentinel : protected Sentinel {
       dynamic_config::Source dynamic_config_source,
       const std::string& client_name, bool is_cluster_mode,
       const CommandControl& command_control,
-      const testsuite::RedisControl& testsuite_redis_control);
+      const testsuite::RedisControl& testsuite_redis_control,
+      ConnectionMode mode = ConnectionMode::kSubscriber);
   static std::shared_ptr<SubscribeSentinel> Create(
       const std::shared_ptr<ThreadPools>& thread_pools,
       const secdist::RedisSettings& settings, std::string shard_group_name,
       dynamic_config::Source dynamic_config_source,
       const std::string& client_name, ReadyChangeCallback ready_callback,
       bool is_cluster_mode, const CommandControl& command_control,
-      const testsuite::RedisControl& testsuite_redis_control);
+      const testsuite::RedisControl& testsuite_redis_control,
+      ConnectionMode mode = ConnectionMode::kSubscriber);
 
   SubscriptionToken Subscribe(
       const std::string& channel,
@@ -65,7 +65,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
   RebalanceState state(shard_idx, weights);
   if (!state.sum_weights) return;
 
-  const std::lock_guard<std::mutex> lock(mutex_);
+  const std::lock_guard<std::shared_mutex> lock(mutex_);
   if (!callback_map_.empty() || !pattern_callback_map_.empty()) {
     LOG_INFO() << "Start rebalance for shard " << shard_idx;
 
@@ -79,9 +79,47 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
 
   if (!sharded_callback_map_.empty()) {
     LOG_INFO() << "Start rebalance for sharded subscriptions";
-    RebalanceState state(shard_idx, weights);
-    RebalanceGatherSubscriptions(state, sharded_callback_map_,
-                                 /*pattern=*/false, /*sharded=*/true);
+    if (sharded_channel_servers_callback_) {
+      RebalanceShardedByOwningShards(shard_idx);
+    } else {
+      RebalanceState state(shard_idx, weights);
+      RebalanceGatherSubscriptions(state, sharded_callback_map_,
+                                   /*pattern=*/false, /*sharded=*/true);
+      RebalanceCalculateNeedCount(state);
+      RebalanceMoveSubscriptions(state);
+    }
+  }
+}
+
+template <typename CallbackMap, typename PcallbackMap>
+void SubscriptionStorageBase::SubscriptionStorageImpl<
+    CallbackMap, PcallbackMap>::RebalanceShardedByOwningShards(size_t
+                                                                   shard_idx) {
+  // SSUBSCRIBE on a server of another shard fails with MOVED, so the
+  // subscriptions are rebalanced separately for each owning shard
+  std::map<size_t, RebalanceState> states;
+  for (const auto& [channel, channel_info] : sharded_callback_map_) {
+    const auto& fsm = channel_info.GetInfo(shard_idx).fsm;
+    if (!fsm || !fsm->CanBeRebalanced()) continue;
+
+    auto servers = sharded_channel_servers_callback_(channel);
+    auto it = states.find(servers.shard_idx);
+    if (it == states.end()) {
+      it = states
+               .emplace(servers.shard_idx,
+                        RebalanceState(servers.shard_idx,
+                                       std::move(servers.weights)))
+               .first;
+    }
+    auto& state = it->second;
+    ++state.total_connections;
+    state.subscriptions_by_server[fsm->GetCurrentServerId()].emplace_back(
+        ChannelName(channel, /*pattern=*/false, /*sharded=*/true), fsm);
+  }
+
+  for (auto& shard_state : states) {
+    auto& state = shard_state.second;
+    if (!state.sum_weights) continue;
     RebalanceCalculateNeedCount(state);
     RebalanceMoveSubscriptions(state);
   }
@@ -136,7 +174,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
 template <typename CallbackMap, typename PcallbackMap>
 size_t SubscriptionStorageBase::SubscriptionStorageImpl<
     CallbackMap, PcallbackMap>::GetChannelsCountApprox() const {
-  const std::lock_guard<std::mutex> lock(mutex_);
+  const std::lock_guard<std::shared_mutex> lock(mutex_);
   return callback_map_.size() + pattern_callback_map_.size() +
          sharded_callback_map_.size();
 }
@@ -159,7 +197,7 @@ PubsubShardStatistics SubscriptionStorageBase::SubscriptionStorageImpl<
   shard_stats.by_channel.reserve(GetChannelsCountApprox());
 
   {
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::lock_guard<std::shared_mutex> lock(mutex_);
     for (const auto& channel_item : callback_map_) {
       const auto& channel_info = channel_item.second;
       const auto& info = channel_info.GetInfo(shard_idx);
@@ -280,7 +318,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap,
   event.type = event_type;
   event.server_id = server_id;
 
-  const std::lock_guard<std::mutex> lock(mutex_);
+  const std::lock_guard<std::shared_mutex> lock(mutex_);
   fsm->OnEvent(event);
   ReadActions(fsm, channel_name);
 }
@@ -321,7 +359,7 @@ bool SubscriptionStorageBase::SubscriptionStorageImpl<
     CallbackMap, PcallbackMap>::DoUnsubscribe(Map& callback_map,
                                               SubscriptionId subscription_id,
                                               bool sharded) {
-  std::unique_lock<std::mutex> lock(mutex_);
+  std::unique_lock<std::shared_mutex> lock(mutex_);
   for (auto& it1 : callback_map) {
     const auto& key = it1.first;
     auto& m = it1.second;
@@ -452,7 +490,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
                                           size_t shard_idx) {
   size_t discarded{0};
   try {
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::shared_lock<std::shared_mutex> lock(mutex_);
     auto& m = callback_map_.at(channel);
     for (const auto& it : m.callbacks) {
       try {
@@ -487,7 +525,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
                                            size_t shard_idx) {
   size_t discarded{0};
   try {
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::shared_lock<std::shared_mutex> lock(mutex_);
     auto& m = pattern_callback_map_.at(pattern);
     for (const auto& it : m.callbacks) {
       try {
@@ -521,7 +559,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
                                            size_t shard_idx) {
   size_t discarded{0};
   try {
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::shared_lock<std::shared_mutex> lock(mutex_);
     auto& m = sharded_callback_map_.at(channel);
     for (const auto& it : m.callbacks) {
       try {
@@ -551,9 +589,10 @@ void SubscriptionStorageBase::ShardChannelInfo::AccountMessage(
     ServerId server_id, size_t message_size) {
   UASSERT(fsm);
   auto current_server_id = fsm->GetCurrentServerId();
-  if (current_server_id == server_id)
-    statistics.AccountMessage(message_size);
-  else {
+  if (current_server_id == server_id) {
+    ++messages_count;
+    messages_size += message_size;
+  } else {
     // TODO: better handling in https://st.yandex-team.ru/TAXICOMMON-604
     LOG_LIMITED_ERROR()
         << "Alien message got on SUBSCRIBE, fsm=" << fsm.get()
@@ -565,14 +604,13 @@ void SubscriptionStorageBase::ShardChannelInfo::AccountMessage(
            "regular, it is a bug in PUBSUB "
            "client implementation.";
 
-    statistics.AccountAlienMessage();
+    ++messages_alien_count;
   }
 }
 
 void SubscriptionStorageBase::ShardChannelInfo::AccountDiscardedByOverflow(
     size_t discarded) {
-  statistics.messages_discarded +=
-      USERVER_NAMESPACE::utils::statistics::Rate{discarded};
+  messages_discarded.Add(USERVER_NAMESPACE::utils::statistics::Rate{discarded});
 }
 
 // logically better as non-static func
@@ -647,7 +685,7 @@ template <typename CallbackMap, typename PcallbackMap>
 void SubscriptionStorageBase::SubscriptionStorageImpl<
     CallbackMap, PcallbackMap>::SetCommandControl(const CommandControl&
                                                       control) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::lock_guard<std::shared_mutex> lock(mutex_);
   common_command_control_ = control;
   common_command_control_.max_retries = 1;
 }
@@ -659,7 +697,7 @@ SubscriptionToken SubscriptionStorageBase::SubscriptionStorageImpl<
                                           CommandControl control) {
   size_t id = 0;
   {
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::lock_guard<std::shared_mutex> lock(mutex_);
     id = GetNextSubscriptionId();
   }
   SubscriptionToken token(implemented_.shared_from_this(), id);
@@ -675,7 +713,7 @@ SubscriptionToken SubscriptionStorageBase::SubscriptionStorageImpl<
                                            CommandControl control) {
   size_t id = 0;
   {
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::lock_guard<std::shared_mutex> lock(mutex_);
     id = GetNextSubscriptionId();
   }
   SubscriptionToken token(implemented_.shared_from_this(), id);
@@ -691,7 +729,7 @@ SubscriptionToken SubscriptionStorageBase::SubscriptionStorageImpl<
                                            CommandControl control) {
   size_t id = 0;
   {
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::lock_guard<std::shared_mutex> lock(mutex_);
     id = GetNextSubscriptionId();
   }
   SubscriptionToken token(implemented_.shared_from_this(), id);
@@ -777,7 +815,7 @@ void SubscriptionStorage::Unsubscribe(SubscriptionId subscription_id) {
 
 void SubscriptionStorage::Stop() {
   {
-    std::unique_lock<std::mutex> lock(storage_impl_.mutex_);
+    std::unique_lock<std::shared_mutex> lock(storage_impl_.mutex_);
     storage_impl_.callback_map_.clear();
     storage_impl_.pattern_callback_map_.clear();
     storage_impl_.sharded_callback_map_.clear();
@@ -811,7 +849,7 @@ void SubscriptionStorage::DoRebalance(size_t shard_idx, ServerWeights weights) {
 }
 
 void SubscriptionStorage::SwitchToNonClusterMode() {
-  const std::lock_guard<std::mutex> lock(storage_impl_.mutex_);
+  const std::lock_guard<std::shared_mutex> lock(storage_impl_.mutex_);
   UASSERT(is_cluster_mode_);
   is_cluster_mode_ = false;
   LOG_INFO() << "SwitchToNonClusterMode for subscription storage";
@@ -868,7 +906,7 @@ void SubscriptionStorage::SubscribeImpl(const std::string& channel,
   /// have to subscribe to every shard to be able to receive published message.
   /// In cluster mode subscribe to only one shard because we do not use
   /// previously mentioned workaround. So each instance in cluster is connected
-  const std::lock_guard<std::mutex> lock(storage_impl_.mutex_);
+  const std::lock_guard<std::shared_mutex> lock(storage_impl_.mutex_);
   auto insert_res = storage_impl_.callback_map_.emplace(channel, ChannelInfo());
   auto& map_iter = *insert_res.first;
   auto& channel_info = map_iter.second;
@@ -918,7 +956,7 @@ void SubscriptionStorage::PsubscribeImpl(const std::string& pattern,
                                          Sentinel::UserPmessageCallback cb,
                                          CommandControl control,
                                          SubscriptionId id) {
-  const std::lock_guard<std::mutex> lock(storage_impl_.mutex_);
+  const std::lock_guard<std::shared_mutex> lock(storage_impl_.mutex_);
   auto insert_res =
       storage_impl_.pattern_callback_map_.emplace(pattern, PChannelInfo());
   auto& map_iter = *insert_res.first;
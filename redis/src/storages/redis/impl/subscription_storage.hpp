@@ -3,11 +3,14 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
 #include <storages/redis/impl/sentinel.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
 
 #include "redis.hpp"
 #include "shard_subscription_fsm.hpp"
@@ -50,6 +53,13 @@ class SubscriptionStorageBase
   using CommandCb = std::function<void(size_t shard, CommandPtr command)>;
   using ShardedCommandCb =
       std::function<void(const std::string& channel, CommandPtr command)>;
+  /// Shard that owns a sharded channel and the servers of that shard
+  struct ShardedChannelServers {
+    size_t shard_idx{0};
+    ServerWeights weights;
+  };
+  using ShardedChannelServersCb =
+      std::function<ShardedChannelServers(const std::string& channel)>;
   struct ChannelName {
     ChannelName() = default;
     ChannelName(std::string channel, bool pattern, bool sharded)
@@ -66,6 +76,7 @@ class SubscriptionStorageBase
   virtual void SetUnsubscribeCallback(CommandCb) = 0;
   virtual void SetShardedSubscribeCallback(ShardedCommandCb) = 0;
   virtual void SetShardedUnsubscribeCallback(ShardedCommandCb) = 0;
+  virtual void SetShardedChannelServersCallback(ShardedChannelServersCb) = 0;
 
   virtual SubscriptionToken Subscribe(const std::string& channel,
                                       Sentinel::UserMessageCallback cb,
@@ -120,11 +131,19 @@ class SubscriptionStorageBase
                    : std::make_shared<shard_subscriber::Fsm>(shard_idx)) {}
 
     FsmPtr fsm;
-    PubsubChannelStatistics statistics;
+    // Messages are accounted under the shared lock of the storage
+    utils::statistics::RelaxedCounter<size_t> messages_count;
+    utils::statistics::RelaxedCounter<size_t> messages_size;
+    utils::statistics::RelaxedCounter<size_t> messages_alien_count;
+    utils::statistics::RateCounter messages_discarded;
 
     PubsubChannelStatistics GetStatistics() const {
       if (!fsm) return {};
-      PubsubChannelStatistics stats(statistics);
+      PubsubChannelStatistics stats;
+      stats.messages_count = messages_count.Load();
+      stats.messages_size = messages_size.Load();
+      stats.messages_alien_count = messages_alien_count.Load();
+      stats.messages_discarded = messages_discarded.Load();
       stats.server_id = fsm->GetCurrentServerId();
       stats.subscription_timestamp = fsm->GetCurrentServerTimePoint();
       return stats;
@@ -213,6 +232,9 @@ class SubscriptionStorageBase
 
     void RebalanceMoveSubscriptions(RebalanceState& state);
 
+    /// Sharded channels are only served by the servers of the owning shard
+    void RebalanceShardedByOwningShards(size_t shard_idx);
+
     void SetCommandControl(const CommandControl& control);
     void DoRebalance(size_t shard_idx, ServerWeights weights);
     SubscriptionToken Subscribe(const std::string& channel,
@@ -226,11 +248,14 @@ class SubscriptionStorageBase
                                  CommandControl control);
     SubscriptionId GetNextSubscriptionId();
 
-    mutable std::mutex mutex_;
+    // Messages are dispatched under the shared lock, so the connections
+    // do not contend with each other
+    mutable std::shared_mutex mutex_;
     CommandCb subscribe_callback_;
     CommandCb unsubscribe_callback_;
     ShardedCommandCb sharded_subscribe_callback_;
     ShardedCommandCb sharded_unsubscribe_callback_;
+    ShardedChannelServersCb sharded_channel_servers_callback_;
     CallbackMap callback_map_;
     PcallbackMap pattern_callback_map_;
     CallbackMap sharded_callback_map_;
@@ -256,6 +281,8 @@ class SubscriptionStorage : public SubscriptionStorageBase {
   void SetUnsubscribeCallback(CommandCb) override;
   void SetShardedSubscribeCallback(ShardedCommandCb) override;
   void SetShardedUnsubscribeCallback(ShardedCommandCb) override;
+  /// Sharded subscriptions are already rebalanced per shard
+  void SetShardedChannelServersCallback(ShardedChannelServersCb) override {}
 
   SubscriptionToken Subscribe(const std::string& channel,
                               Sentinel::UserMessageCallback cb,
@@ -34,9 +34,20 @@ ThreadPools::ThreadPools(size_t sentinel_thread_pool_size,
           kRedisThreadName});
 }
 
+ThreadPools::ThreadPools(
+    size_t sentinel_thread_pool_size,
+    std::shared_ptr<engine::ev::ThreadPool> redis_thread_pool)
+    : sentinel_thread_pool_(
+          std::make_unique<engine::ev::ThreadPool>(engine::ev::ThreadPoolConfig{
+              sentinel_thread_pool_size, 0 /* dedicated_timer_threads */,
+              kSentinelThreadName})),
+      redis_thread_pool_(std::move(redis_thread_pool)),
+      dedicated_redis_pool_(false) {}
+
 ThreadPools::~ThreadPools() {
   LOG_INFO() << "Stopping redis thread pools";
-  while (redis_thread_pool_.use_count() > 1) {
+  // A borrowed pool is owned elsewhere and outlives the Redis instances
+  while (dedicated_redis_pool_ && redis_thread_pool_.use_count() > 1) {
     std::this_thread::sleep_for(kThreadPoolWaitingSleepTime);
   }
   LOG_INFO() << "Stopped redis thread pools";
@@ -1,5 +1,6 @@
 #include <userver/storages/redis/parse_reply.hpp>
 
+#include <userver/storages/redis/hash_struct.hpp>
 #include <userver/storages/redis/reply.hpp>
 #include <userver/utils/from_string.hpp>
 
@@ -26,17 +27,6 @@ std::string ExtractStringElem(ReplyData& array_data, size_t elem_idx,
   return std::move(elem.GetString());
 }
 
-ReplyData::MovableKeyValues GetKeyValues(
-    ReplyData& array_data, const std::string& request_description) {
-  try {
-    return array_data.GetMovableKeyValues();
-  } catch (const std::exception& ex) {
-    throw USERVER_NAMESPACE::redis::ParseReplyException(
-        "Can't parse response to '" + request_description +
-        "' request: " + ex.what());
-  }
-}
-
 Point ParsePointArray(const redis::ReplyData& elem,
                       const std::string& request_description) {
   const auto& array = elem.GetArray();
@@ -125,7 +115,7 @@ std::vector<std::optional<std::string>> ParseReplyDataArray(
 std::vector<std::pair<std::string, std::string>> ParseReplyDataArray(
     ReplyData&& array_data, const std::string& request_description,
     To<std::vector<std::pair<std::string, std::string>>>) {
-  auto key_values = GetKeyValues(array_data, request_description);
+  auto key_values = impl::GetKeyValues(array_data, request_description);
 
   std::vector<std::pair<std::string, std::string>> result;
 
@@ -140,7 +130,7 @@ std::vector<std::pair<std::string, std::string>> ParseReplyDataArray(
 std::vector<MemberScore> ParseReplyDataArray(
     ReplyData&& array_data, const std::string& request_description,
     To<std::vector<MemberScore>>) {
-  auto key_values = GetKeyValues(array_data, request_description);
+  auto key_values = impl::GetKeyValues(array_data, request_description);
 
   std::vector<MemberScore> result;
 
@@ -367,7 +357,7 @@ std::unordered_map<std::string, std::string> Parse(
     To<std::unordered_map<std::string, std::string>>) {
   reply_data.ExpectArray(request_description);
 
-  auto key_values = GetKeyValues(reply_data, request_description);
+  auto key_values = impl::GetKeyValues(reply_data, request_description);
 
   std::unordered_map<std::string, std::string> result;
 
@@ -91,6 +91,8 @@ USERVER_NAMESPACE::redis::CommandsBufferingSettings Parse(
   result.buffering_enabled = elem["buffering_enabled"].As<bool>();
   result.commands_buffering_threshold =
       elem["commands_buffering_threshold"].As<size_t>(0);
+  result.commands_buffering_bytes_threshold =
+      elem["commands_buffering_bytes_threshold"].As<size_t>(0);
   result.watch_command_timer_interval = std::chrono::microseconds(
       elem["watch_command_timer_interval_us"].As<size_t>());
   return result;
@@ -0,0 +1,170 @@
+#include <userver/storages/redis/scatter_gather.hpp>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+#include <userver/storages/redis/exception.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace impl {
+
+std::vector<KeysGroup> GroupKeysByShard(const Client& client,
+                                        std::vector<std::string>&& keys,
+                                        const CommandControl& command_control) {
+  // Keys of a single command must belong to the same hash slot in cluster
+  // mode, keys of a shard from different slots are sent separately
+  const bool group_by_slot =
+      client.IsInClusterMode() && !command_control.force_shard_idx;
+
+  std::vector<KeysGroup> groups;
+  std::unordered_map<size_t, size_t> group_indices;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const auto shard = command_control.force_shard_idx.value_or(
+        client.ShardByKey(keys[i]));
+    const auto group_key =
+        group_by_slot ? USERVER_NAMESPACE::redis::GetClusterHashSlot(keys[i])
+                      : shard;
+
+    const auto [it, inserted] =
+        group_indices.emplace(group_key, groups.size());
+    if (inserted) groups.push_back({shard, {}, {}});
+
+    auto& group = groups[it->second];
+    group.key_indices.push_back(i);
+    group.keys.push_back(std::move(keys[i]));
+  }
+  return groups;
+}
+
+void MergeReply(std::vector<std::optional<std::string>>& result,
+                std::vector<std::optional<std::string>>&& part,
+                const std::vector<size_t>& key_indices) {
+  if (part.size() != key_indices.size()) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected number of values in the reply: expected " +
+        std::to_string(key_indices.size()) + ", got " +
+        std::to_string(part.size()));
+  }
+  for (size_t i = 0; i < part.size(); ++i) {
+    result[key_indices[i]] = std::move(part[i]);
+  }
+}
+
+}  // namespace impl
+
+namespace {
+
+template <typename RequestType, typename MakeRequest>
+MultiShardRequest<RequestType> ScatterGather(
+    const Client& client, std::vector<std::string>&& keys,
+    const CommandControl& command_control, MakeRequest make_request) {
+  const auto keys_count = keys.size();
+  auto groups =
+      impl::GroupKeysByShard(client, std::move(keys), command_control);
+
+  std::vector<typename MultiShardRequest<RequestType>::SubRequest> requests;
+  requests.reserve(groups.size());
+  for (auto& group : groups) {
+    requests.push_back({group.shard, std::move(group.key_indices),
+                        make_request(std::move(group.keys))});
+  }
+  return {keys_count, std::move(requests)};
+}
+
+}  // namespace
+
+MultiShardRequest<RequestMget> MgetAcrossShards(
+    Client& client, std::vector<std::string> keys,
+    const CommandControl& command_control) {
+  return ScatterGather<RequestMget>(
+      client, std::move(keys), command_control, [&](auto&& group_keys) {
+        return client.Mget(std::move(group_keys), command_control);
+      });
+}
+
+MultiShardRequest<RequestDel> DelAcrossShards(
+    Client& client, std::vector<std::string> keys,
+    const CommandControl& command_control) {
+  return ScatterGather<RequestDel>(
+      client, std::move(keys), command_control, [&](auto&& group_keys) {
+        return client.Del(std::move(group_keys), command_control);
+      });
+}
+
+MultiShardRequest<RequestUnlink> UnlinkAcrossShards(
+    Client& client, std::vector<std::string> keys,
+    const CommandControl& command_control) {
+  return ScatterGather<RequestUnlink>(
+      client, std::move(keys), command_control, [&](auto&& group_keys) {
+        return client.Unlink(std::move(group_keys), command_control);
+      });
+}
+
+MultiShardRequest<RequestExists> ExistsAcrossShards(
+    Client& client, std::vector<std::string> keys,
+    const CommandControl& command_control) {
+  return ScatterGather<RequestExists>(
+      client, std::move(keys), command_control, [&](auto&& group_keys) {
+        return client.Exists(std::move(group_keys), command_control);
+      });
+}
+
+MultiShardScanRequest::MultiShardScanRequest(
+    Client& client, ScanOptions options, size_t max_concurrent_shards,
+    const CommandControl& command_control)
+    : client_(client),
+      options_(std::move(options)),
+      command_control_(command_control),
+      max_concurrent_shards_(std::max<size_t>(max_concurrent_shards, 1)) {
+  StartShardScans();
+}
+
+bool MultiShardScanRequest::HasMore() {
+  while (!scans_.empty()) {
+    if (!current_) {
+      // Waits for the first page of the shard
+      current_.emplace(scans_.front().begin());
+    }
+    if (*current_ != scans_.front().end()) return true;
+
+    current_.reset();
+    scans_.pop_front();
+    StartShardScans();
+  }
+  return false;
+}
+
+MultiShardScanRequest::ReplyElem& MultiShardScanRequest::Current() {
+  UASSERT(current_);
+  return **current_;
+}
+
+void MultiShardScanRequest::Advance() {
+  UASSERT(current_);
+  ++*current_;
+}
+
+void MultiShardScanRequest::StartShardScans() {
+  const auto shards_count = client_.ShardsCount();
+  while (scans_.size() < max_concurrent_shards_ &&
+         next_shard_ < shards_count) {
+    scans_.push_back(client_.Scan(next_shard_++, options_, command_control_));
+  }
+}
+
+MultiShardScanRequest ScanAcrossShards(Client& client, ScanOptions options,
+                                       size_t max_concurrent_shards,
+                                       const CommandControl& command_control) {
+  return MultiShardScanRequest{client, std::move(options),
+                               max_concurrent_shards, command_control};
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
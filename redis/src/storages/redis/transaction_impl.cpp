@@ -1,6 +1,9 @@
 #include <storages/redis/transaction_impl.hpp>
 
+#include <map>
+#include <optional>
 #include <sstream>
+#include <utility>
 
 #include <userver/storages/redis/impl/transaction_subrequest_data.hpp>
 
@@ -28,6 +31,74 @@ TransactionImpl::TransactionImpl(std::shared_ptr<ClientImpl> client,
       cmd_args_({"MULTI"}) {}
 
 RequestExec TransactionImpl::Exec(const CommandControl& command_control) {
+  PrepareExec(command_control);
+  auto replies_to_skip = result_promises_.size() + 1;
+  const auto master = master_;
+  master_ = false;
+  return CreateExecRequest(
+      client_->MakeRequest(std::move(cmd_args_), *shard_, master,
+                           client_->GetCommandControl(command_control),
+                           replies_to_skip),
+      std::move(result_promises_));
+}
+
+std::vector<RequestExec> TransactionImpl::ExecPipelined(
+    std::vector<TransactionPtr>&& transactions,
+    const CommandControl& command_control) {
+  struct Group {
+    TransactionImpl* first{nullptr};
+    std::vector<size_t> indices;
+    bool master{false};
+  };
+  std::map<std::pair<const ClientImpl*, size_t>, Group> groups;
+
+  std::vector<std::optional<RequestExec>> results(transactions.size());
+  for (size_t i = 0; i < transactions.size(); ++i) {
+    auto* transaction = dynamic_cast<TransactionImpl*>(transactions[i].get());
+    if (!transaction) {
+      // Mocks and other implementations are executed one by one
+      results[i].emplace(transactions[i]->Exec(command_control));
+      continue;
+    }
+
+    transaction->PrepareExec(command_control);
+    auto& group = groups[{transaction->client_.get(), *transaction->shard_}];
+    if (!group.first) group.first = transaction;
+    group.indices.push_back(i);
+    group.master = group.master || transaction->master_;
+  }
+
+  for (auto& [key, group] : groups) {
+    auto& client = *group.first->client_;
+    const auto shard = key.second;
+
+    std::vector<USERVER_NAMESPACE::redis::CmdArgs> parts;
+    parts.reserve(group.indices.size());
+    for (const auto i : group.indices) {
+      auto& transaction = static_cast<TransactionImpl&>(*transactions[i]);
+      parts.push_back(std::move(transaction.cmd_args_));
+    }
+
+    auto requests =
+        client.MakePipelinedRequests(std::move(parts), shard, group.master,
+                                     client.GetCommandControl(command_control));
+    UASSERT(requests.size() == group.indices.size());
+    for (size_t j = 0; j < requests.size(); ++j) {
+      const auto i = group.indices[j];
+      auto& transaction = static_cast<TransactionImpl&>(*transactions[i]);
+      transaction.master_ = false;
+      results[i].emplace(CreateExecRequest(
+          std::move(requests[j]), std::move(transaction.result_promises_)));
+    }
+  }
+
+  std::vector<RequestExec> ret;
+  ret.reserve(results.size());
+  for (auto& result : results) ret.push_back(std::move(*result));
+  return ret;
+}
+
+void TransactionImpl::PrepareExec(const CommandControl& command_control) {
   if (!shard_) {
     throw EmptyTransactionException(
         "Can't determine shard. Empty transaction?");
@@ -47,14 +118,6 @@ RequestExec TransactionImpl::Exec(const CommandControl& command_control) {
   }
   client_->CheckShardIdx(*shard_);
   cmd_args_.Then("EXEC");
-  auto replies_to_skip = result_promises_.size() + 1;
-  const auto master = master_;
-  master_ = false;
-  return CreateExecRequest(
-      client_->MakeRequest(std::move(cmd_args_), *shard_, master,
-                           client_->GetCommandControl(command_control),
-                           replies_to_skip),
-      std::move(result_promises_));
 }
 
 // redis commands:
@@ -757,6 +820,12 @@ Request TransactionImpl::AddCmd(std::string command, bool master,
   return request;
 }
 
+std::vector<RequestExec> ExecPipelined(std::vector<TransactionPtr> transactions,
+                                       const CommandControl& command_control) {
+  return TransactionImpl::ExecPipelined(std::move(transactions),
+                                        command_control);
+}
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
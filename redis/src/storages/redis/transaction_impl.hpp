@@ -24,6 +24,10 @@ class TransactionImpl final : public Transaction {
 
   RequestExec Exec(const CommandControl& command_control) override;
 
+  static std::vector<RequestExec> ExecPipelined(
+      std::vector<TransactionPtr>&& transactions,
+      const CommandControl& command_control);
+
   class ResultPromise {
    public:
     template <typename Result, typename ReplyType>
@@ -329,6 +333,9 @@ class TransactionImpl final : public Transaction {
   // end of redis commands
 
  private:
+  /// Checks the shard and finishes the commands with EXEC
+  void PrepareExec(const CommandControl& command_control);
+
   void UpdateShard(const std::string& key);
   void UpdateShard(const std::vector<std::string>& keys);
   void UpdateShard(
@@ -898,4 +898,50 @@ UTEST_F(RedisClientTransactionTest, DISABLED_ReadOnlyGetGet) {
   EXPECT_EQ(slave_command_count, 4);
 }
 
+UTEST_F(RedisClientTransactionTest, ExecPipelined) {
+  auto client = GetClient();
+  constexpr std::size_t kTransactions = 10;
+
+  std::vector<storages::redis::TransactionPtr> transactions;
+  std::vector<storages::redis::RequestIncr> incrs;
+  std::vector<storages::redis::RequestGet> gets;
+  for (std::size_t i = 0; i < kTransactions; ++i) {
+    auto transaction = client->Multi();
+    incrs.push_back(transaction->Incr("pipelined_counter"));
+    gets.push_back(transaction->Get("pipelined_counter"));
+    transactions.push_back(std::move(transaction));
+  }
+
+  auto execs =
+      storages::redis::ExecPipelined(std::move(transactions), kDefaultCc);
+  ASSERT_EQ(execs.size(), kTransactions);
+  for (std::size_t i = 0; i < kTransactions; ++i) {
+    UEXPECT_NO_THROW(execs[i].Get());
+    const auto expected = static_cast<int64_t>(i + 1);
+    EXPECT_EQ(incrs[i].Get(), expected);
+    EXPECT_EQ(gets[i].Get(), std::to_string(expected));
+  }
+}
+
+UTEST_F(RedisClientTransactionTest, ExecPipelinedFailedTransaction) {
+  auto client = GetClient();
+  Get(GetTransactionClient()->Set("pipelined_string", "foo"));
+
+  std::vector<storages::redis::TransactionPtr> transactions;
+  auto failed = client->Multi();
+  auto failed_incr = failed->Incr("pipelined_string");
+  transactions.push_back(std::move(failed));
+  auto succeeded = client->Multi();
+  auto succeeded_set = succeeded->Set("pipelined_other", "bar");
+  transactions.push_back(std::move(succeeded));
+
+  auto execs =
+      storages::redis::ExecPipelined(std::move(transactions), kDefaultCc);
+  ASSERT_EQ(execs.size(), 2);
+  UEXPECT_NO_THROW(execs[0].Get());
+  UEXPECT_THROW(failed_incr.Get(), std::exception);
+  UEXPECT_NO_THROW(execs[1].Get());
+  UEXPECT_NO_THROW(succeeded_set.Get());
+}
+
 USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/storages/redis/impl/secdist_redis.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/text.hpp>
 
 #include <storages/redis/impl/keyshard_impl.hpp>
@@ -145,7 +146,8 @@ RedisConnectionState::RedisConnectionState() {
       std::make_shared<SubscribeClientImpl>(subscribe_sentinel_);
 }
 
-RedisConnectionState::RedisConnectionState(InClusterMode) {
+RedisConnectionState::RedisConnectionState(InClusterMode)
+    : in_cluster_mode_(true) {
   auto configs_source = GetClusterDynamicConfigSource();
 
   thread_pools_ = std::make_shared<ThreadPools>(
@@ -166,6 +168,20 @@ RedisConnectionState::RedisConnectionState(InClusterMode) {
       std::make_shared<SubscribeClientImpl>(subscribe_sentinel_);
 }
 
+SubscribeClientPtr RedisConnectionState::GetTrackingSubscribeClient() {
+  UINVARIANT(!in_cluster_mode_, "Client tracking requires sentinel mode");
+  if (!tracking_subscribe_client_) {
+    tracking_subscribe_sentinel_ = SubscribeSentinel::Create(
+        thread_pools_, GetRedisSettings(), "none",
+        dynamic_config::GetDefaultSource(), "pub", false, {}, {},
+        USERVER_NAMESPACE::redis::ConnectionMode::kSubscriberWithTracking);
+    tracking_subscribe_sentinel_->WaitConnectedDebug();
+    tracking_subscribe_client_ =
+        std::make_shared<SubscribeClientImpl>(tracking_subscribe_sentinel_);
+  }
+  return tracking_subscribe_client_;
+}
+
 }  // namespace storages::redis::utest::impl
 
 USERVER_NAMESPACE_END
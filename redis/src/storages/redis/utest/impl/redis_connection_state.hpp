@@ -17,6 +17,9 @@ class RedisConnectionState {
 
   SubscribeClientPtr GetSubscribeClient() const { return subscribe_client_; }
 
+  /// Subscribe client with `CLIENT TRACKING` enabled, created on first use
+  SubscribeClientPtr GetTrackingSubscribeClient();
+
  protected:
   RedisConnectionState();
 
@@ -34,6 +37,10 @@ class RedisConnectionState {
   std::shared_ptr<USERVER_NAMESPACE::redis::SubscribeSentinel>
       subscribe_sentinel_;
   SubscribeClientPtr subscribe_client_;
+  std::shared_ptr<USERVER_NAMESPACE::redis::SubscribeSentinel>
+      tracking_subscribe_sentinel_;
+  SubscribeClientPtr tracking_subscribe_client_;
+  bool in_cluster_mode_{false};
 };
 
 struct RedisClusterConnectionState : public RedisConnectionState {
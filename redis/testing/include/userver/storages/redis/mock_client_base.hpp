@@ -89,6 +89,8 @@ class MockClientBase : public Client,
       std::string script, std::vector<std::string> keys,
       std::vector<std::string> args,
       const CommandControl& command_control) override;
+  RequestHgetallCommon HgetallCommon(
+      std::string key, const CommandControl& command_control) override;
 
   RequestScriptLoad ScriptLoad(std::string script, size_t shard,
                                const CommandControl& command_control) override;
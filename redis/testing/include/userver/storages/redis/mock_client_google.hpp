@@ -463,6 +463,10 @@ class GMockClient : public MockClientBase {
                const CommandControl& command_control),
               (override));
 
+  MOCK_METHOD(RequestHgetallCommon, HgetallCommon,
+              (std::string key, const CommandControl& command_control),
+              (override));
+
   MOCK_METHOD(RequestGeosearch, Geosearch,
               (std::string key, std::string member, double radius,
                const GeosearchOptions& geosearch_options,
@@ -110,6 +110,12 @@ RequestEvalShaCommon MockClientBase::EvalShaCommon(
   return RequestEvalShaCommon{nullptr};
 }
 
+RequestHgetallCommon MockClientBase::HgetallCommon(
+    std::string /*key*/, const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestHgetallCommon{nullptr};
+}
+
 RequestScriptLoad MockClientBase::ScriptLoad(
     std::string /*script*/, size_t /*shard*/,
     const CommandControl& /*command_control*/) {
@@ -3,23 +3,63 @@
 /// @file userver/storages/rocks/client.hpp
 /// @brief @copybrief storages::rocks::Client
 
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include <rocksdb/db.h>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/storages/rocks/column_family.hpp>
+#include <userver/storages/rocks/key_value_range.hpp>
+#include <userver/storages/rocks/snapshot.hpp>
+#include <userver/storages/rocks/write_batch.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace impl {
+class BlockingExecutor;
+}  // namespace impl
+
+/// storages::rocks::Client settings
+struct ClientSettings final {
+  /// Column families to open besides the default one, missing ones are created
+  std::vector<std::string> column_families;
+
+  /// Maximum count of concurrently running blocking operations
+  std::size_t max_concurrent_operations{
+      std::numeric_limits<std::size_t>::max()};
+};
+
+/// Options of the read operations of storages::rocks::Client
+struct ReadOptions final {
+  /// Column family to read from
+  ColumnFamily column_family{};
+
+  /// Snapshot to read from, the latest state is read by default
+  Snapshot snapshot{};
+
+  /// Count of records that storages::rocks::KeyValueRange fetches at once
+  std::size_t iteration_batch_size{256};
+};
+
 /**
  * @brief Client for working with RocksDB storage.
  *
  * This class provides an interface for interacting with the RocksDB database.
  * To use the class, you need to specify the database path when creating an
  * object.
+ *
+ * All the operations that may touch the disk run on the blocking task
+ * processor, at most `max_concurrent_operations` of them at a time, while the
+ * calling coroutine waits for the result.
  */
 class Client final {
  public:
@@ -29,9 +69,29 @@ class Client final {
    * @param db_path The path to the RocksDB database.
    * @param blocking_task_processor - task processor to execute blocking FS
    * operations
+   * @param settings Column families and concurrency limits.
    */
   Client(const std::string& db_path,
-         engine::TaskProcessor& blocking_task_processor);
+         engine::TaskProcessor& blocking_task_processor,
+         const ClientSettings& settings = {});
+
+  ~Client();
+
+  Client(const Client&) = delete;
+  Client& operator=(const Client&) = delete;
+
+  /**
+   * @brief Returns the handle of a column family opened by the client.
+   *
+   * @param name The name of the column family from ClientSettings.
+   * @throws storages::rocks::Exception if the column family is not opened.
+   */
+  ColumnFamily GetColumnFamily(std::string_view name) const;
+
+  /**
+   * @brief Takes a snapshot of the current state of the database.
+   */
+  Snapshot MakeSnapshot();
 
   /**
    * @brief Puts a record into the database.
@@ -41,13 +101,68 @@ class Client final {
    */
   void Put(std::string_view key, std::string_view value);
 
+  /**
+   * @brief Puts a record into the column family.
+   *
+   * @param column_family The column family to put the record into.
+   * @param key The key of the record.
+   * @param value The value of the record.
+   */
+  void Put(ColumnFamily column_family, std::string_view key,
+           std::string_view value);
+
   /**
    * @brief Retrieves the value of a record from the database by key.
    *
    * @param key The key of the record.
+   * @returns The value or an empty string if there is no such record.
    */
   std::string Get(std::string_view key);
 
+  /**
+   * @brief Retrieves the value of a record by key.
+   *
+   * @param key The key of the record.
+   * @param options The column family and the snapshot to read from.
+   * @returns The value or std::nullopt if there is no such record.
+   */
+  std::optional<std::string> Find(std::string_view key,
+                                  const ReadOptions& options = {});
+
+  /**
+   * @brief Retrieves the values of several records in a single operation.
+   *
+   * The keys are sorted internally, which lets RocksDB look them up in one
+   * pass over the data blocks.
+   *
+   * @param keys The keys of the records, possibly unsorted.
+   * @param options The column family and the snapshot to read from.
+   * @returns The values in the order of `keys`, std::nullopt for the missing
+   * records.
+   */
+  std::vector<std::optional<std::string>> MultiGet(
+      const std::vector<std::string_view>& keys,
+      const ReadOptions& options = {});
+
+  /**
+   * @brief Iterates over the records with keys starting with `prefix`.
+   *
+   * @param prefix The prefix of the keys, an empty one matches all records.
+   * @param options The column family, the snapshot and the batch size.
+   */
+  KeyValueRange IteratePrefix(std::string_view prefix,
+                              const ReadOptions& options = {});
+
+  /**
+   * @brief Iterates over the records with keys in the [begin, end) range.
+   *
+   * @param begin The first key of the range, inclusive.
+   * @param end The last key of the range, exclusive.
+   * @param options The column family, the snapshot and the batch size.
+   */
+  KeyValueRange IterateRange(std::string_view begin, std::string_view end,
+                             const ReadOptions& options = {});
+
   /**
    * @brief Deletes a record from the database by key.
    *
@@ -55,6 +170,21 @@ class Client final {
    */
   void Delete(std::string_view key);
 
+  /**
+   * @brief Deletes a record from the column family by key.
+   *
+   * @param column_family The column family to delete the record from.
+   * @param key The key of the record to be deleted.
+   */
+  void Delete(ColumnFamily column_family, std::string_view key);
+
+  /**
+   * @brief Atomically applies all the updates of the batch.
+   *
+   * @param batch The updates to apply.
+   */
+  void Write(WriteBatch batch);
+
   /**
    * Checks the status of an operation and handles any errors based on the given
    * method name.
@@ -65,8 +195,18 @@ class Client final {
   void CheckStatus(rocksdb::Status status, std::string_view method_name);
 
  private:
+  rocksdb::ColumnFamilyHandle* GetHandle(ColumnFamily column_family) const;
+
+  rocksdb::ReadOptions MakeReadOptions(const ReadOptions& options) const;
+
+  KeyValueRange Iterate(std::string lower_bound,
+                        std::optional<std::string> upper_bound,
+                        const ReadOptions& options);
+
   std::unique_ptr<rocksdb::DB> db_;
-  engine::TaskProcessor& blocking_task_processor_;
+  std::unordered_map<std::string, rocksdb::ColumnFamilyHandle*>
+      column_families_;
+  std::unique_ptr<impl::BlockingExecutor> executor_;
 };
 }  // namespace storages::rocks
 
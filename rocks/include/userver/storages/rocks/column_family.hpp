@@ -0,0 +1,37 @@
+#pragma once
+
+/// @file userver/storages/rocks/column_family.hpp
+/// @brief @copybrief storages::rocks::ColumnFamily
+
+#include <rocksdb/db.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+class Client;
+class WriteBatch;
+
+/**
+ * @brief Handle of a column family opened by storages::rocks::Client.
+ *
+ * A default constructed handle refers to the default column family. Handles
+ * are cheap to copy and stay valid while the client is alive.
+ */
+class ColumnFamily final {
+ public:
+  ColumnFamily() = default;
+
+ private:
+  friend class Client;
+  friend class WriteBatch;
+
+  explicit ColumnFamily(rocksdb::ColumnFamilyHandle* handle)
+      : handle_(handle) {}
+
+  rocksdb::ColumnFamilyHandle* handle_{nullptr};
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
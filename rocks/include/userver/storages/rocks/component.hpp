@@ -23,6 +23,8 @@ namespace storages::rocks {
 /// ---------------------------------- | ------------------------------------------------ | ---------------
 /// task-processor                     | name of the task processor to run the blocking file operations | -
 /// db-path                            | path to database file                            | -
+/// column-families                    | column families to open besides the default one, missing ones are created | []
+/// max-concurrent-operations          | maximum count of concurrently running blocking operations | unlimited
 
 // clang-format on
 
@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file userver/storages/rocks/key_value_range.hpp
+/// @brief @copybrief storages::rocks::KeyValueRange
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+class Client;
+
+/// Record of the database
+struct KeyValue final {
+  std::string key;
+  std::string value;
+};
+
+/**
+ * @brief Single-pass range of records in the key order.
+ *
+ * Records are fetched in batches on the blocking task processor of the
+ * storages::rocks::Client, so advancing the iterator suspends the current
+ * coroutine only once per batch. The range reads a consistent view of the
+ * database that is taken at the time of its creation.
+ *
+ * The range must be destroyed before the client.
+ *
+ * @code
+ * for (const auto& record : client.IteratePrefix("user:")) {
+ *   Process(record.key, record.value);
+ * }
+ * @endcode
+ */
+class KeyValueRange final {
+ public:
+  class Iterator final {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = KeyValue;
+    using reference = const KeyValue&;
+    using pointer = const KeyValue*;
+
+    Iterator() = default;
+
+    reference operator*() const;
+    pointer operator->() const;
+
+    Iterator& operator++();
+
+    bool operator==(const Iterator& other) const;
+    bool operator!=(const Iterator& other) const;
+
+   private:
+    friend class KeyValueRange;
+
+    explicit Iterator(KeyValueRange* range);
+
+    // nullptr for the end iterator
+    KeyValueRange* range_{nullptr};
+  };
+
+  KeyValueRange(KeyValueRange&&) noexcept;
+  KeyValueRange& operator=(KeyValueRange&&) noexcept;
+  ~KeyValueRange();
+
+  /// @brief Fetches the first batch of records
+  /// @note The range is single-pass, begin() may be called only once
+  Iterator begin();
+  Iterator end();
+
+ private:
+  friend class Client;
+
+  struct Impl;
+
+  explicit KeyValueRange(std::unique_ptr<Impl>&& impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
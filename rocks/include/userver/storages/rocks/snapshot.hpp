@@ -0,0 +1,40 @@
+#pragma once
+
+/// @file userver/storages/rocks/snapshot.hpp
+/// @brief @copybrief storages::rocks::Snapshot
+
+#include <memory>
+#include <utility>
+
+#include <rocksdb/db.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+class Client;
+
+/**
+ * @brief Consistent point-in-time view of the database.
+ *
+ * Reads with a snapshot do not observe writes made after its creation. The
+ * snapshot is released when the last copy of it is destroyed, which must
+ * happen before the storages::rocks::Client is destroyed. A default
+ * constructed snapshot means reading the latest state.
+ */
+class Snapshot final {
+ public:
+  Snapshot() = default;
+
+ private:
+  friend class Client;
+
+  explicit Snapshot(std::shared_ptr<const rocksdb::Snapshot> snapshot)
+      : snapshot_(std::move(snapshot)) {}
+
+  std::shared_ptr<const rocksdb::Snapshot> snapshot_;
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
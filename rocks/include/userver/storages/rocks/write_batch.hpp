@@ -0,0 +1,59 @@
+#pragma once
+
+/// @file userver/storages/rocks/write_batch.hpp
+/// @brief @copybrief storages::rocks::WriteBatch
+
+#include <cstddef>
+#include <string_view>
+
+#include <rocksdb/write_batch.h>
+
+#include <userver/storages/rocks/column_family.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+/**
+ * @brief Set of updates applied atomically by storages::rocks::Client::Write.
+ *
+ * The updates are applied in the order they were added to the batch. The
+ * batch copies keys and values, so the arguments may be destroyed right after
+ * the call.
+ */
+class WriteBatch final {
+ public:
+  WriteBatch() = default;
+
+  /// Adds a record to be put into the default column family
+  void Put(std::string_view key, std::string_view value);
+
+  /// Adds a record to be put into the column family
+  void Put(ColumnFamily column_family, std::string_view key,
+           std::string_view value);
+
+  /// Adds a key to be deleted from the default column family
+  void Delete(std::string_view key);
+
+  /// Adds a key to be deleted from the column family
+  void Delete(ColumnFamily column_family, std::string_view key);
+
+  /// Adds the [begin, end) range of keys to be deleted from the column family
+  void DeleteRange(ColumnFamily column_family, std::string_view begin,
+                   std::string_view end);
+
+  /// Returns the count of the updates in the batch
+  std::size_t GetSize() const;
+
+  /// Returns true if there are no updates in the batch
+  bool IsEmpty() const;
+
+ private:
+  friend class Client;
+
+  rocksdb::WriteBatch batch_;
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
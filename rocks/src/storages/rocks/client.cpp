@@ -1,7 +1,13 @@
 #include <userver/storages/rocks/client.hpp>
 
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
 #include <fmt/format.h>
 
+#include <storages/rocks/impl/blocking_executor.hpp>
+#include <storages/rocks/impl/key_value_range_impl.hpp>
 #include <userver/storages/rocks/exception.hpp>
 #include <userver/utils/async.hpp>
 
@@ -9,45 +15,169 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace {
+
+// The smallest key that is greater than all the keys starting with `prefix`
+std::optional<std::string> GetPrefixUpperBound(std::string_view prefix) {
+  std::string bound{prefix};
+  while (!bound.empty()) {
+    auto& last = reinterpret_cast<unsigned char&>(bound.back());
+    if (last != 0xff) {
+      ++last;
+      return bound;
+    }
+    bound.pop_back();
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
 Client::Client(const std::string& db_path,
-               engine::TaskProcessor& blocking_task_processor)
-    : blocking_task_processor_(blocking_task_processor) {
+               engine::TaskProcessor& blocking_task_processor,
+               const ClientSettings& settings)
+    : executor_(std::make_unique<impl::BlockingExecutor>(
+          blocking_task_processor, settings.max_concurrent_operations)) {
   rocksdb::Options options;
   options.create_if_missing = true;
+  options.create_missing_column_families = true;
+
+  // RocksDB requires all the existing column families to be opened
+  std::vector<std::string> names;
+  if (!rocksdb::DB::ListColumnFamilies(options, db_path, &names).ok()) {
+    names = {rocksdb::kDefaultColumnFamilyName};
+  }
+  for (const auto& name : settings.column_families) {
+    if (std::find(names.begin(), names.end(), name) == names.end()) {
+      names.push_back(name);
+    }
+  }
+
+  std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
+  descriptors.reserve(names.size());
+  for (const auto& name : names) {
+    descriptors.emplace_back(name, rocksdb::ColumnFamilyOptions{options});
+  }
 
   rocksdb::DB* db{};
-  rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db);
+  std::vector<rocksdb::ColumnFamilyHandle*> handles;
+  rocksdb::Status status = rocksdb::DB::Open(
+      rocksdb::DBOptions{options}, db_path, descriptors, &handles, &db);
   db_.reset(db);
   CheckStatus(status, "Create client");
+
+  for (std::size_t i = 0; i < handles.size(); ++i) {
+    column_families_.emplace(names[i], handles[i]);
+  }
+}
+
+Client::~Client() {
+  for (const auto& [name, handle] : column_families_) {
+    db_->DestroyColumnFamilyHandle(handle);
+  }
+}
+
+ColumnFamily Client::GetColumnFamily(std::string_view name) const {
+  const auto it = column_families_.find(std::string{name});
+  if (it == column_families_.end()) {
+    throw Exception(fmt::format("Column family '{}' is not opened", name));
+  }
+  return ColumnFamily{it->second};
+}
+
+Snapshot Client::MakeSnapshot() {
+  auto* db = db_.get();
+  return Snapshot{std::shared_ptr<const rocksdb::Snapshot>(
+      db->GetSnapshot(),
+      [db](const rocksdb::Snapshot* snapshot) {
+        db->ReleaseSnapshot(snapshot);
+      })};
 }
 
 void Client::Put(std::string_view key, std::string_view value) {
-  engine::AsyncNoSpan(blocking_task_processor_, [this, key, value] {
-    rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), key, value);
+  Put(ColumnFamily{}, key, value);
+}
+
+void Client::Put(ColumnFamily column_family, std::string_view key,
+                 std::string_view value) {
+  executor_->Execute([this, handle = GetHandle(column_family), key, value] {
+    rocksdb::Status status =
+        db_->Put(rocksdb::WriteOptions(), handle, key, value);
     CheckStatus(status, "Put");
-  }).Get();
+  });
 }
 
 std::string Client::Get(std::string_view key) {
-  return engine::AsyncNoSpan(blocking_task_processor_,
-                             [this, key] {
-                               std::string res;
-                               rocksdb::Status status =
-                                   db_->Get(rocksdb::ReadOptions(), key, &res);
-                               CheckStatus(status, "Get");
-                               return res;
-                             })
-      .Get();
-}
-
-void Client::Delete(std::string_view key) {
-  return engine::AsyncNoSpan(blocking_task_processor_,
-                             [this, key] {
-                               rocksdb::Status status =
-                                   db_->Delete(rocksdb::WriteOptions(), key);
-                               CheckStatus(status, "Delete");
-                             })
-      .Get();
+  return Find(key).value_or(std::string{});
+}
+
+std::optional<std::string> Client::Find(std::string_view key,
+                                        const ReadOptions& options) {
+  return executor_->Execute(
+      [this, handle = GetHandle(options.column_family),
+       read_options = MakeReadOptions(options),
+       key]() -> std::optional<std::string> {
+        std::string res;
+        rocksdb::Status status = db_->Get(read_options, handle, key, &res);
+        CheckStatus(status, "Get");
+        if (status.IsNotFound()) return std::nullopt;
+        return res;
+      });
+}
+
+std::vector<std::optional<std::string>> Client::MultiGet(
+    const std::vector<std::string_view>& keys, const ReadOptions& options) {
+  std::vector<std::size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&keys](std::size_t l, std::size_t r) {
+    return keys[l] < keys[r];
+  });
+
+  std::vector<rocksdb::Slice> sorted_keys;
+  sorted_keys.reserve(keys.size());
+  for (const auto i : order) sorted_keys.emplace_back(keys[i]);
+
+  std::vector<rocksdb::PinnableSlice> values(keys.size());
+  std::vector<rocksdb::Status> statuses(keys.size());
+  executor_->Execute([&, handle = GetHandle(options.column_family),
+                      read_options = MakeReadOptions(options)] {
+    db_->MultiGet(read_options, handle, sorted_keys.size(), sorted_keys.data(),
+                  values.data(), statuses.data(), /*sorted_input=*/true);
+  });
+
+  std::vector<std::optional<std::string>> result(keys.size());
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    CheckStatus(statuses[i], "MultiGet");
+    if (statuses[i].ok()) result[order[i]] = values[i].ToString();
+  }
+  return result;
+}
+
+KeyValueRange Client::IteratePrefix(std::string_view prefix,
+                                    const ReadOptions& options) {
+  return Iterate(std::string{prefix}, GetPrefixUpperBound(prefix), options);
+}
+
+KeyValueRange Client::IterateRange(std::string_view begin,
+                                   std::string_view end,
+                                   const ReadOptions& options) {
+  return Iterate(std::string{begin}, std::string{end}, options);
+}
+
+void Client::Delete(std::string_view key) { Delete(ColumnFamily{}, key); }
+
+void Client::Delete(ColumnFamily column_family, std::string_view key) {
+  executor_->Execute([this, handle = GetHandle(column_family), key] {
+    rocksdb::Status status = db_->Delete(rocksdb::WriteOptions(), handle, key);
+    CheckStatus(status, "Delete");
+  });
+}
+
+void Client::Write(WriteBatch batch) {
+  executor_->Execute([this, &batch] {
+    rocksdb::Status status = db_->Write(rocksdb::WriteOptions(), &batch.batch_);
+    CheckStatus(status, "Write");
+  });
 }
 
 void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
@@ -56,6 +186,32 @@ void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
         method_name, status.ToString());
   }
 }
+
+rocksdb::ColumnFamilyHandle* Client::GetHandle(
+    ColumnFamily column_family) const {
+  return column_family.handle_ ? column_family.handle_
+                               : db_->DefaultColumnFamily();
+}
+
+rocksdb::ReadOptions Client::MakeReadOptions(const ReadOptions& options) const {
+  rocksdb::ReadOptions read_options;
+  read_options.snapshot = options.snapshot.snapshot_.get();
+  return read_options;
+}
+
+KeyValueRange Client::Iterate(std::string lower_bound,
+                              std::optional<std::string> upper_bound,
+                              const ReadOptions& options) {
+  auto impl = std::make_unique<KeyValueRange::Impl>(
+      *executor_, std::move(lower_bound), std::move(upper_bound),
+      options.iteration_batch_size, options.snapshot.snapshot_);
+  executor_->Execute([this, &impl, handle = GetHandle(options.column_family),
+                      read_options = MakeReadOptions(options)] {
+    impl->Open(*db_, handle, read_options);
+  });
+  return KeyValueRange{std::move(impl)};
+}
+
 }  // namespace storages::rocks
 
 USERVER_NAMESPACE_END
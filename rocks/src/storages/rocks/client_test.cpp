@@ -2,6 +2,14 @@
 #include <userver/utest/utest.hpp>
 #include <userver/utils/async.hpp>
 
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/storages/rocks/exception.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -25,6 +33,135 @@ UTEST(Rocks, CheckCRUD) {
   EXPECT_EQ("", res);
 }
 
+UTEST(Rocks, WriteBatch) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  storages::rocks::Client client{dir.GetPath(),
+                                 engine::current_task::GetTaskProcessor()};
+  client.Put("stale", "value");
+
+  storages::rocks::WriteBatch batch;
+  batch.Put("a", "1");
+  batch.Put("b", "2");
+  batch.Delete("stale");
+  EXPECT_EQ(3, batch.GetSize());
+  client.Write(std::move(batch));
+
+  EXPECT_EQ("1", client.Get("a"));
+  EXPECT_EQ("2", client.Get("b"));
+  EXPECT_EQ(std::nullopt, client.Find("stale"));
+}
+
+UTEST(Rocks, MultiGet) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  storages::rocks::Client client{dir.GetPath(),
+                                 engine::current_task::GetTaskProcessor()};
+  client.Put("a", "1");
+  client.Put("c", "3");
+  client.Put("b", "");
+
+  const auto values = client.MultiGet({"c", "missing", "a", "b"});
+  const std::vector<std::optional<std::string>> expected{
+      "3", std::nullopt, "1", ""};
+  EXPECT_EQ(expected, values);
+
+  EXPECT_TRUE(client.MultiGet({}).empty());
+}
+
+UTEST(Rocks, Iterate) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  storages::rocks::Client client{dir.GetPath(),
+                                 engine::current_task::GetTaskProcessor()};
+  for (const auto* key : {"a", "user:1", "user:2", "user:3", "v"}) {
+    client.Put(key, key);
+  }
+
+  // small batches to check the refetching
+  storages::rocks::ReadOptions options;
+  options.iteration_batch_size = 2;
+
+  std::vector<std::string> keys;
+  for (const auto& record : client.IteratePrefix("user:", options)) {
+    EXPECT_EQ(record.key, record.value);
+    keys.push_back(record.key);
+  }
+  EXPECT_EQ((std::vector<std::string>{"user:1", "user:2", "user:3"}), keys);
+
+  keys.clear();
+  for (const auto& record : client.IterateRange("b", "user:3", options)) {
+    keys.push_back(record.key);
+  }
+  EXPECT_EQ((std::vector<std::string>{"user:1", "user:2"}), keys);
+
+  auto empty = client.IteratePrefix("missing");
+  EXPECT_EQ(empty.begin(), empty.end());
+}
+
+UTEST(Rocks, Snapshot) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  storages::rocks::Client client{dir.GetPath(),
+                                 engine::current_task::GetTaskProcessor()};
+  client.Put("key", "old");
+
+  storages::rocks::ReadOptions options;
+  options.snapshot = client.MakeSnapshot();
+  client.Put("key", "new");
+  client.Put("other", "value");
+
+  EXPECT_EQ("old", client.Find("key", options));
+  EXPECT_EQ(std::nullopt, client.Find("other", options));
+  EXPECT_EQ("new", client.Find("key"));
+
+  std::vector<std::string> keys;
+  for (const auto& record : client.IteratePrefix("", options)) {
+    keys.push_back(record.key);
+  }
+  EXPECT_EQ(std::vector<std::string>{"key"}, keys);
+}
+
+UTEST(Rocks, ColumnFamilies) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  storages::rocks::ClientSettings settings;
+  settings.column_families = {"state"};
+  storages::rocks::Client client{
+      dir.GetPath(), engine::current_task::GetTaskProcessor(), settings};
+
+  const auto state = client.GetColumnFamily("state");
+  client.Put(state, "key", "state value");
+  client.Put("key", "default value");
+
+  storages::rocks::ReadOptions options;
+  options.column_family = state;
+  EXPECT_EQ("state value", client.Find("key", options));
+  EXPECT_EQ("default value", client.Get("key"));
+
+  client.Delete(state, "key");
+  EXPECT_EQ(std::nullopt, client.Find("key", options));
+  EXPECT_EQ("default value", client.Get("key"));
+
+  UEXPECT_THROW(client.GetColumnFamily("missing"),
+                storages::rocks::Exception);
+}
+
+UTEST_MT(Rocks, ConcurrencyLimit, 4) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  storages::rocks::ClientSettings settings;
+  settings.max_concurrent_operations = 1;
+  storages::rocks::Client client{
+      dir.GetPath(), engine::current_task::GetTaskProcessor(), settings};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 10; ++i) {
+    tasks.push_back(utils::Async("put", [&client, i] {
+      client.Put(std::to_string(i), std::to_string(i));
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(std::to_string(i), client.Get(std::to_string(i)));
+  }
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include <userver/storages/rocks/component.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/storages/rocks/client.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
@@ -9,13 +11,28 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace {
+
+ClientSettings ParseClientSettings(const components::ComponentConfig& config) {
+  ClientSettings settings;
+  settings.column_families =
+      config["column-families"].As<std::vector<std::string>>({});
+  settings.max_concurrent_operations =
+      config["max-concurrent-operations"].As<std::size_t>(
+          settings.max_concurrent_operations);
+  return settings;
+}
+
+}  // namespace
+
 Component::Component(const components::ComponentConfig& config,
                      const components::ComponentContext& context)
     : ComponentBase(config, context),
       client_ptr_(std::make_shared<storages::rocks::Client>(
           config["db-path"].As<std::string>(),
           context.GetTaskProcessor(
-              config["task-processor"].As<std::string>()))) {}
+              config["task-processor"].As<std::string>()),
+          ParseClientSettings(config))) {}
 
 storages::rocks::ClientPtr Component::MakeClient() { return client_ptr_; }
 
@@ -31,6 +48,18 @@ properties:
     db-path:
         type: string
         description: path to database file
+    column-families:
+        type: array
+        description: column families to open besides the default one
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: column family name, created if missing
+    max-concurrent-operations:
+        type: integer
+        description: maximum count of concurrently running blocking operations
+        defaultDescription: unlimited
+        minimum: 1
 )");
 }
 }  // namespace storages::rocks
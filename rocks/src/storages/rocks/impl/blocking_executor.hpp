@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks::impl {
+
+/// Runs blocking RocksDB calls on a task processor, limiting the count of
+/// concurrently running calls
+class BlockingExecutor final {
+ public:
+  BlockingExecutor(engine::TaskProcessor& task_processor,
+                   std::size_t max_concurrent_operations)
+      : task_processor_(task_processor),
+        semaphore_(max_concurrent_operations) {}
+
+  template <typename Func>
+  auto Execute(Func&& func) {
+    const engine::SemaphoreLock lock{semaphore_};
+    return engine::AsyncNoSpan(task_processor_, std::forward<Func>(func))
+        .Get();
+  }
+
+ private:
+  engine::TaskProcessor& task_processor_;
+  engine::Semaphore semaphore_;
+};
+
+}  // namespace storages::rocks::impl
+
+USERVER_NAMESPACE_END
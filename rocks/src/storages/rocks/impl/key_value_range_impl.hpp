@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <rocksdb/db.h>
+
+#include <storages/rocks/impl/blocking_executor.hpp>
+#include <userver/storages/rocks/key_value_range.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+struct KeyValueRange::Impl final {
+  Impl(impl::BlockingExecutor& executor, std::string lower_bound,
+       std::optional<std::string> upper_bound, std::size_t batch_size,
+       std::shared_ptr<const rocksdb::Snapshot> snapshot);
+
+  /// Creates the iterator, must be called on the blocking task processor
+  void Open(rocksdb::DB& db, rocksdb::ColumnFamilyHandle* column_family,
+            rocksdb::ReadOptions read_options);
+
+  /// Replaces the current batch with the next one
+  void FetchBatch();
+
+  bool IsExhausted() const { return position == batch.size(); }
+
+  impl::BlockingExecutor& executor;
+  const std::string lower_bound;
+  const std::optional<std::string> upper_bound;
+  const std::size_t batch_size;
+
+  // referenced by the iterator, so must outlive it
+  rocksdb::Slice upper_bound_slice;
+  std::shared_ptr<const rocksdb::Snapshot> snapshot;
+  std::unique_ptr<rocksdb::Iterator> iterator;
+
+  bool is_started{false};
+  std::vector<KeyValue> batch;
+  std::size_t position{0};
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
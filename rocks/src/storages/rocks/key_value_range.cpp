@@ -0,0 +1,107 @@
+#include <userver/storages/rocks/key_value_range.hpp>
+
+#include <utility>
+
+#include <storages/rocks/impl/key_value_range_impl.hpp>
+#include <userver/storages/rocks/exception.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+KeyValueRange::Impl::Impl(impl::BlockingExecutor& executor,
+                          std::string lower_bound,
+                          std::optional<std::string> upper_bound,
+                          std::size_t batch_size,
+                          std::shared_ptr<const rocksdb::Snapshot> snapshot)
+    : executor(executor),
+      lower_bound(std::move(lower_bound)),
+      upper_bound(std::move(upper_bound)),
+      batch_size(batch_size),
+      snapshot(std::move(snapshot)) {
+  UINVARIANT(batch_size > 0, "Iteration batch size must be positive");
+}
+
+void KeyValueRange::Impl::Open(rocksdb::DB& db,
+                               rocksdb::ColumnFamilyHandle* column_family,
+                               rocksdb::ReadOptions read_options) {
+  if (upper_bound) {
+    upper_bound_slice = *upper_bound;
+    read_options.iterate_upper_bound = &upper_bound_slice;
+  }
+  iterator.reset(db.NewIterator(read_options, column_family));
+}
+
+void KeyValueRange::Impl::FetchBatch() {
+  batch.clear();
+  position = 0;
+  executor.Execute([this] {
+    if (!is_started) {
+      iterator->Seek(lower_bound);
+      is_started = true;
+    }
+    for (; batch.size() < batch_size && iterator->Valid(); iterator->Next()) {
+      batch.push_back(
+          {iterator->key().ToString(), iterator->value().ToString()});
+    }
+
+    const auto status = iterator->status();
+    if (!status.ok()) {
+      throw RequestFailedException("Iterate", status.ToString());
+    }
+  });
+}
+
+KeyValueRange::KeyValueRange(std::unique_ptr<Impl>&& impl)
+    : impl_(std::move(impl)) {}
+
+KeyValueRange::KeyValueRange(KeyValueRange&&) noexcept = default;
+
+KeyValueRange& KeyValueRange::operator=(KeyValueRange&&) noexcept = default;
+
+KeyValueRange::~KeyValueRange() = default;
+
+KeyValueRange::Iterator KeyValueRange::begin() {
+  UINVARIANT(!impl_->is_started, "KeyValueRange is single-pass");
+  impl_->FetchBatch();
+  return impl_->IsExhausted() ? end() : Iterator{this};
+}
+
+KeyValueRange::Iterator KeyValueRange::end() { return Iterator{}; }
+
+KeyValueRange::Iterator::Iterator(KeyValueRange* range) : range_(range) {}
+
+KeyValueRange::Iterator::reference KeyValueRange::Iterator::operator*() const {
+  UASSERT(range_);
+  const auto& impl = *range_->impl_;
+  return impl.batch[impl.position];
+}
+
+KeyValueRange::Iterator::pointer KeyValueRange::Iterator::operator->() const {
+  return &**this;
+}
+
+KeyValueRange::Iterator& KeyValueRange::Iterator::operator++() {
+  UASSERT(range_);
+  auto& impl = *range_->impl_;
+  ++impl.position;
+  if (impl.IsExhausted()) {
+    // a short batch means there are no more records
+    if (impl.batch.size() == impl.batch_size) impl.FetchBatch();
+    if (impl.IsExhausted()) range_ = nullptr;
+  }
+  return *this;
+}
+
+bool KeyValueRange::Iterator::operator==(const Iterator& other) const {
+  return range_ == other.range_;
+}
+
+bool KeyValueRange::Iterator::operator!=(const Iterator& other) const {
+  return !(*this == other);
+}
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
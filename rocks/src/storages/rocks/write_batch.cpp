@@ -0,0 +1,48 @@
+#include <userver/storages/rocks/write_batch.hpp>
+
+#include <userver/storages/rocks/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+namespace {
+
+void CheckBatchStatus(const rocksdb::Status& status) {
+  if (!status.ok()) {
+    throw RequestFailedException("Append to WriteBatch", status.ToString());
+  }
+}
+
+}  // namespace
+
+void WriteBatch::Put(std::string_view key, std::string_view value) {
+  Put(ColumnFamily{}, key, value);
+}
+
+// rocksdb::WriteBatch maps a null column family handle to the default one
+void WriteBatch::Put(ColumnFamily column_family, std::string_view key,
+                     std::string_view value) {
+  CheckBatchStatus(batch_.Put(column_family.handle_, key, value));
+}
+
+void WriteBatch::Delete(std::string_view key) {
+  Delete(ColumnFamily{}, key);
+}
+
+void WriteBatch::Delete(ColumnFamily column_family, std::string_view key) {
+  CheckBatchStatus(batch_.Delete(column_family.handle_, key));
+}
+
+void WriteBatch::DeleteRange(ColumnFamily column_family,
+                             std::string_view begin, std::string_view end) {
+  CheckBatchStatus(batch_.DeleteRange(column_family.handle_, begin, end));
+}
+
+std::size_t WriteBatch::GetSize() const { return batch_.Count(); }
+
+bool WriteBatch::IsEmpty() const { return GetSize() == 0; }
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
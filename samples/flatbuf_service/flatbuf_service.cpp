@@ -40,6 +40,37 @@ class FbsSumEcho final
 }  // namespace samples::fbs_handle
 /// [Flatbuf service sample - component]
 
+namespace samples::fbs_handle {
+
+/// [Flatbuf service sample - view component]
+class FbsSumEchoView final
+    : public server::handlers::HttpHandlerFlatbufViewBase<fbs::SampleRequest,
+                                                          fbs::SampleResponse> {
+ public:
+  static constexpr std::string_view kName = "handler-fbs-view-sample";
+
+  FbsSumEchoView(const components::ComponentConfig& config,
+                 const components::ComponentContext& context)
+      : HttpHandlerFlatbufViewBase(config, context) {}
+
+  // `fbs_request` points into the request body, the response is built right
+  // into the `builder` without the intermediate objects
+  flatbuffers::Offset<fbs::SampleResponse> HandleRequestFlatbufViewThrow(
+      const server::http::HttpRequest& /*request*/,
+      const fbs::SampleRequest& fbs_request,
+      flatbuffers::FlatBufferBuilder& builder,
+      server::request::RequestContext&) const override {
+    const auto echo = fbs_request.data()
+                          ? builder.CreateString(fbs_request.data())
+                          : flatbuffers::Offset<flatbuffers::String>{};
+    return fbs::CreateSampleResponse(
+        builder, fbs_request.arg1() + fbs_request.arg2(), echo);
+  }
+};
+/// [Flatbuf service sample - view component]
+
+}  // namespace samples::fbs_handle
+
 namespace samples::fbs_request {
 
 /// [Flatbuf service sample - http component]
@@ -107,7 +138,8 @@ void FbsRequest::KeepRequesting() const {
 
 int main(int argc, char* argv[]) {
   auto component_list = components::MinimalServerComponentList()        //
-                            .Append<samples::fbs_handle::FbsSumEcho>()  //
+                            .Append<samples::fbs_handle::FbsSumEcho>()      //
+                            .Append<samples::fbs_handle::FbsSumEchoView>()  //
 
                             .Append<clients::dns::Component>()            //
                             .Append<components::HttpClient>()             //
@@ -0,0 +1,15 @@
+import pytest
+
+
+# /// [service_load]
+@pytest.mark.userver_performance(p99_ms=500)
+async def test_ping_performance(service_client, service_load):
+    report = await service_load.run(
+        lambda: service_client.get('/ping'),
+        rps=100,
+        duration=1,
+        handler='handler-ping',
+    )
+    assert report.requests == 100
+    assert report.errors == 0
+    # /// [service_load]
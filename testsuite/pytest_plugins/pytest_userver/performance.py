@@ -0,0 +1,225 @@
+"""
+Python module that provides helpers for performance testing of userver based
+services with testsuite; see
+@ref scripts/docs/en/userver/functional_testing.md for an introduction.
+
+@ingroup userver_testsuite
+"""
+
+import asyncio
+import dataclasses
+import math
+import time
+import typing
+
+from pytest_userver import metrics as metric_module
+
+# @cond
+_HANDLER_CPU_TIME_PATH = 'http.handler.cpu-time-us'
+_HANDLER_ALLOCATED_BYTES_PATH = 'http.handler.allocated-bytes'
+_PROCESS_CPU_TIME_PATH = 'cpu_time_sec'
+# @endcond
+
+RequestFactory = typing.Callable[[], typing.Awaitable[typing.Any]]
+
+
+@dataclasses.dataclass(frozen=True)
+class PerformanceLimits:
+    """
+    Upper limits for the results of a load run, `None` disables a check.
+
+    The CPU time and the allocated bytes are taken from the
+    `http.handler.cpu-time-us` and `http.handler.allocated-bytes` metrics of
+    the handler, which require the `resource-usage-accounting` option of the
+    task processor. Without a handler the CPU time of the whole process is
+    used.
+
+    @ingroup userver_testsuite
+    """
+
+    p99_ms: typing.Optional[float] = None
+    cpu_us_per_request: typing.Optional[float] = None
+    allocated_bytes_per_request: typing.Optional[float] = None
+
+
+@dataclasses.dataclass
+class LoadReport:
+    """
+    Results of a load run, see pytest_userver.plugins.performance.service_load
+
+    @ingroup userver_testsuite
+    """
+
+    requests: int
+    errors: int
+    duration: float
+    latencies_ms: typing.List[float]
+    metrics_before: metric_module.MetricsSnapshot
+    metrics_after: metric_module.MetricsSnapshot
+    handler: typing.Optional[str] = None
+
+    @property
+    def rps(self) -> float:
+        """Completed requests per second."""
+        if self.duration <= 0:
+            return 0.0
+        return self.requests / self.duration
+
+    def latency_percentile_ms(self, percent: float) -> float:
+        """Client side latency percentile in milliseconds."""
+        if not self.latencies_ms:
+            return 0.0
+        latencies = sorted(self.latencies_ms)
+        index = math.ceil(percent / 100 * len(latencies)) - 1
+        return latencies[min(max(index, 0), len(latencies) - 1)]
+
+    @property
+    def cpu_us_per_request(self) -> typing.Optional[float]:
+        """
+        CPU time of the handler per request, or of the whole process if no
+        handler was given. `None` if the metrics are not available.
+        """
+        if self.handler is not None:
+            return self._handler_metric_per_request(_HANDLER_CPU_TIME_PATH)
+        cpu_time_sec = self._metric_diff(_PROCESS_CPU_TIME_PATH, None)
+        if cpu_time_sec is None or not self.requests:
+            return None
+        return cpu_time_sec * 1e6 / self.requests
+
+    @property
+    def allocated_bytes_per_request(self) -> typing.Optional[float]:
+        """
+        Bytes allocated by the handler per request. `None` if the metric is
+        not available.
+        """
+        if self.handler is None:
+            return None
+        return self._handler_metric_per_request(_HANDLER_ALLOCATED_BYTES_PATH)
+
+    def violations(self, limits: PerformanceLimits) -> typing.List[str]:
+        """Returns the descriptions of the exceeded limits."""
+        result = []
+        if self.errors:
+            result.append(f'{self.errors} of {self.requests} requests failed')
+
+        def check(name, value, limit):
+            if limit is None:
+                return
+            if value is None:
+                result.append(
+                    f'{name} is not available, check that the service '
+                    'reports the required metrics',
+                )
+            elif value > limit:
+                result.append(f'{name} {value:.3f} exceeds {limit}')
+
+        check('p99 latency ms', self.latency_percentile_ms(99), limits.p99_ms)
+        check(
+            'CPU us per request',
+            self.cpu_us_per_request,
+            limits.cpu_us_per_request,
+        )
+        check(
+            'allocated bytes per request',
+            self.allocated_bytes_per_request,
+            limits.allocated_bytes_per_request,
+        )
+        return result
+
+    def assert_limits(self, limits: PerformanceLimits) -> None:
+        """@throws AssertionError if any of the limits is exceeded"""
+        violations = self.violations(limits)
+        assert not violations, (
+            'Performance limits exceeded: '
+            + '; '.join(violations)
+            + f'\n{self.pretty_print()}'
+        )
+
+    def pretty_print(self) -> str:
+        def format_value(value):
+            return 'n/a' if value is None else f'{value:.3f}'
+
+        return (
+            f'requests={self.requests} errors={self.errors} '
+            f'rps={self.rps:.1f} '
+            f'p50_ms={self.latency_percentile_ms(50):.3f} '
+            f'p99_ms={self.latency_percentile_ms(99):.3f} '
+            f'cpu_us_per_request={format_value(self.cpu_us_per_request)} '
+            'allocated_bytes_per_request='
+            f'{format_value(self.allocated_bytes_per_request)}'
+        )
+
+    # @cond
+    def _handler_metric_per_request(self, path: str) -> typing.Optional[float]:
+        value = self._metric_diff(path, {'http_handler': self.handler})
+        if value is None or not self.requests:
+            return None
+        return value / self.requests
+
+    def _metric_diff(
+            self, path: str, require_labels: typing.Optional[typing.Dict],
+    ) -> typing.Optional[float]:
+        after = self.metrics_after.metrics_at(path, require_labels)
+        if not after:
+            return None
+        before = self.metrics_before.metrics_at(path, require_labels)
+        return sum(m.value for m in after) - sum(m.value for m in before)
+
+    # @endcond
+
+
+def is_server_error(response: typing.Any) -> bool:
+    """Default error check: an HTTP response with a 5xx status."""
+    status = getattr(response, 'status', None)
+    if status is None:
+        status = getattr(response, 'status_code', 200)
+    return status >= 500
+
+
+async def generate_load(
+        make_request: RequestFactory,
+        *,
+        rps: float,
+        duration: float,
+        max_in_flight: int,
+        is_error: typing.Callable[[typing.Any], bool] = is_server_error,
+) -> typing.Tuple[typing.List[float], int, float]:
+    """
+    Sends requests at a fixed rate for `duration` seconds. The latency is
+    measured from the scheduled send time, so a stalled service does not hide
+    the requests that should have been sent meanwhile. If `max_in_flight`
+    requests are not completed yet, the new ones wait for a free slot.
+
+    @returns latencies in milliseconds, the number of errors and the elapsed
+             time in seconds
+    """
+    assert rps > 0, 'rps must be positive'
+    total = max(int(rps * duration), 1)
+    in_flight = asyncio.Semaphore(max_in_flight)
+    latencies: typing.List[float] = []
+    errors = 0
+
+    async def send(scheduled: float) -> None:
+        nonlocal errors
+        try:
+            response = await make_request()
+            if is_error(response):
+                errors += 1
+        except Exception:  # pylint: disable=broad-except
+            errors += 1
+        finally:
+            latencies.append((time.monotonic() - scheduled) * 1000)
+            in_flight.release()
+
+    start = time.monotonic()
+    tasks = []
+    for i in range(total):
+        scheduled = start + i / rps
+        delay = scheduled - time.monotonic()
+        if delay > 0:
+            await asyncio.sleep(delay)
+        await in_flight.acquire()
+        tasks.append(asyncio.create_task(send(scheduled)))
+    await asyncio.gather(*tasks)
+    return latencies, errors, time.monotonic() - start
+
@@ -15,6 +15,7 @@ pytest_plugins = [
     'pytest_userver.plugins.dynamic_config',
     'pytest_userver.plugins.log_capture',
     'pytest_userver.plugins.logging',
+    'pytest_userver.plugins.performance',
     'pytest_userver.plugins.service',
     'pytest_userver.plugins.service_client',
     'pytest_userver.plugins.service_runner',
@@ -0,0 +1,159 @@
+"""
+Performance testing mode: loads the service with a fixed request rate and
+checks the latency and the resource usage per request.
+"""
+
+# pylint: disable=redefined-outer-name
+import logging
+import typing
+
+import pytest
+
+from pytest_userver import client
+from pytest_userver import performance
+
+
+logger = logging.getLogger(__name__)
+
+
+class ServiceLoad:
+    """
+    Drives the service with a fixed request rate and collects the metrics
+    snapshots before and after the load.
+
+    @ingroup userver_testsuite
+    """
+
+    # @cond
+    def __init__(
+            self,
+            *,
+            monitor_client: client.ClientMonitor,
+            limits: typing.Optional[performance.PerformanceLimits],
+            enforce_limits: bool,
+    ):
+        self._monitor_client = monitor_client
+        self._limits = limits
+        self._enforce_limits = enforce_limits
+
+    # @endcond
+
+    async def run(
+            self,
+            make_request: performance.RequestFactory,
+            *,
+            rps: float = 100,
+            duration: float = 1.0,
+            max_in_flight: int = 64,
+            handler: typing.Optional[str] = None,
+            warmup: float = 0.2,
+            is_error: typing.Callable[
+                [typing.Any], bool,
+            ] = performance.is_server_error,
+    ) -> performance.LoadReport:
+        """
+        Calls `make_request` `rps` times per second for `duration` seconds.
+
+        If the test is marked with `userver_performance`, the limits of the
+        mark are checked against the report.
+
+        @param make_request Coroutine function that sends a single request
+        @param rps Request rate
+        @param duration Duration of the load in seconds
+        @param max_in_flight Limit of the requests sent and not completed yet
+        @param handler Name of the handler component, for the per request CPU
+               and allocations metrics of the handler
+        @param warmup Duration of the load before the measurement in seconds
+        @param is_error Checks the result of `make_request`, the exceptions
+               are always counted as errors
+        """
+        if warmup > 0:
+            await performance.generate_load(
+                make_request,
+                rps=rps,
+                duration=warmup,
+                max_in_flight=max_in_flight,
+                is_error=is_error,
+            )
+
+        metrics_before = await self._monitor_client.metrics()
+        latencies_ms, errors, elapsed = await performance.generate_load(
+            make_request,
+            rps=rps,
+            duration=duration,
+            max_in_flight=max_in_flight,
+            is_error=is_error,
+        )
+        metrics_after = await self._monitor_client.metrics()
+
+        report = performance.LoadReport(
+            requests=len(latencies_ms),
+            errors=errors,
+            duration=elapsed,
+            latencies_ms=latencies_ms,
+            metrics_before=metrics_before,
+            metrics_after=metrics_after,
+            handler=handler,
+        )
+        logger.info('Load report: %s', report.pretty_print())
+
+        if self._limits is not None:
+            if self._enforce_limits:
+                report.assert_limits(self._limits)
+            else:
+                for violation in report.violations(self._limits):
+                    logger.warning('Performance limit exceeded: %s', violation)
+        return report
+
+
+def pytest_addoption(parser) -> None:
+    group = parser.getgroup('userver-performance')
+    group.addoption(
+        '--service-performance-report-only',
+        action='store_true',
+        help=(
+            'Log the exceeded limits of the tests marked with '
+            'userver_performance instead of failing them, e.g. for the '
+            'sanitizer or debug builds'
+        ),
+    )
+
+
+def pytest_configure(config):
+    config.addinivalue_line(
+        'markers',
+        'userver_performance(p99_ms=None, cpu_us_per_request=None, '
+        'allocated_bytes_per_request=None): limits for the service_load runs',
+    )
+
+
+@pytest.fixture
+def service_load(
+        request, pytestconfig, service_client, monitor_client,
+) -> ServiceLoad:
+    """
+    Returns a pytest_userver.plugins.performance.ServiceLoad that loads the
+    service and checks the limits of the `userver_performance` mark.
+
+    @code
+    @pytest.mark.userver_performance(p99_ms=50, cpu_us_per_request=500)
+    async def test_ping_performance(service_client, service_load):
+        report = await service_load.run(
+            lambda: service_client.get('/ping'), rps=200, duration=2,
+        )
+        assert report.requests == 400
+    @endcode
+
+    @ingroup userver_testsuite_fixtures
+    """
+    marker = request.node.get_closest_marker('userver_performance')
+    limits = None
+    if marker:
+        assert not marker.args, 'userver_performance accepts only kwargs'
+        limits = performance.PerformanceLimits(**marker.kwargs)
+
+    return ServiceLoad(
+        monitor_client=monitor_client,
+        limits=limits,
+        enforce_limits=not pytestconfig.option.service_performance_report_only,
+    )
@@ -0,0 +1,102 @@
+import asyncio
+
+import pytest
+from pytest_userver import metrics  # pylint: disable=import-error
+from pytest_userver import performance  # pylint: disable=import-error
+
+_HANDLER = 'handler-ping'
+
+
+def _snapshot(cpu_time_us, allocated_bytes, cpu_time_sec):
+    labels = {'http_handler': _HANDLER, 'http_path': '/ping'}
+    return metrics.MetricsSnapshot(
+        {
+            'http.handler.cpu-time-us': {
+                metrics.Metric(labels=labels, value=cpu_time_us),
+            },
+            'http.handler.allocated-bytes': {
+                metrics.Metric(labels=labels, value=allocated_bytes),
+            },
+            'cpu_time_sec': {metrics.Metric(labels={}, value=cpu_time_sec)},
+        },
+    )
+
+
+def _make_report(handler=_HANDLER, errors=0):
+    return performance.LoadReport(
+        requests=100,
+        errors=errors,
+        duration=2.0,
+        latencies_ms=[float(i) for i in range(1, 101)],
+        metrics_before=_snapshot(1000, 5000, 1.0),
+        metrics_after=_snapshot(21000, 105000, 1.5),
+        handler=handler,
+    )
+
+
+def test_load_report_values():
+    report = _make_report()
+    assert report.rps == 50
+    assert report.latency_percentile_ms(50) == 50
+    assert report.latency_percentile_ms(99) == 99
+    assert report.latency_percentile_ms(100) == 100
+    assert report.cpu_us_per_request == 200
+    assert report.allocated_bytes_per_request == 1000
+
+    process_report = _make_report(handler=None)
+    assert process_report.cpu_us_per_request == 5000
+    assert process_report.allocated_bytes_per_request is None
+
+
+def test_load_report_limits():
+    report = _make_report()
+    report.assert_limits(
+        performance.PerformanceLimits(
+            p99_ms=99, cpu_us_per_request=200, allocated_bytes_per_request=1000,
+        ),
+    )
+
+    violations = report.violations(
+        performance.PerformanceLimits(p99_ms=10, cpu_us_per_request=100),
+    )
+    assert len(violations) == 2
+    with pytest.raises(AssertionError):
+        report.assert_limits(performance.PerformanceLimits(p99_ms=10))
+
+    process_report = _make_report(handler=None)
+    assert process_report.violations(
+        performance.PerformanceLimits(allocated_bytes_per_request=1),
+    )
+
+    assert _make_report(errors=1).violations(performance.PerformanceLimits())
+
+
+async def test_generate_load():
+    in_flight = 0
+    max_seen_in_flight = 0
+    calls = 0
+
+    class Response:
+        def __init__(self, status):
+            self.status = status
+
+    async def make_request():
+        nonlocal in_flight, max_seen_in_flight, calls
+        calls += 1
+        call = calls
+        in_flight += 1
+        max_seen_in_flight = max(max_seen_in_flight, in_flight)
+        await asyncio.sleep(0.05)
+        in_flight -= 1
+        if call % 10 == 0:
+            raise RuntimeError('failure')
+        return Response(500 if call % 10 == 5 else 200)
+
+    latencies, errors, elapsed = await performance.generate_load(
+        make_request, rps=200, duration=0.25, max_in_flight=4,
+    )
+    assert len(latencies) == 50
+    assert errors == 10
+    assert max_seen_in_flight <= 4
+    assert elapsed >= 0.2
+    assert min(latencies) >= 50
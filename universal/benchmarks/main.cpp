@@ -1,3 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <utils/gbench_allocations.hpp>
+
+USERVER_GBENCH_COUNT_ALLOCATIONS()
+
 BENCHMARK_MAIN();
@@ -0,0 +1,749 @@
+#pragma once
+
+/// @file userver/cache/flat_hash_map.hpp
+/// @brief @copybrief cache::FlatHashMap
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Memory taken by a cache::FlatHashMap, e.g. by a cache snapshot
+struct MemoryStatistics final {
+  /// Number of the slots of the table
+  std::size_t capacity{0};
+  /// Bytes allocated for the table, including the unused slots
+  std::size_t allocated_bytes{0};
+};
+
+namespace impl {
+
+using ControlByte = std::int8_t;
+
+inline constexpr ControlByte kEmpty = -128;
+inline constexpr ControlByte kDeleted = -2;
+
+inline constexpr std::size_t kGroupWidth = 16;
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/// Mixes the bits of the user-provided hash, std::hash of integers is identity
+inline std::size_t MixHash(std::size_t hash) noexcept {
+  auto result = static_cast<std::uint64_t>(hash);
+  result ^= result >> 32;
+  result *= 0x9e3779b97f4a7c15ULL;
+  result ^= result >> 29;
+  return static_cast<std::size_t>(result);
+}
+
+/// Bitmask of the slots of a group, bit N stands for the N-th slot
+class GroupMask final {
+ public:
+  explicit GroupMask(std::uint32_t mask) noexcept : mask_(mask) {}
+
+  explicit operator bool() const noexcept { return mask_ != 0; }
+
+  std::size_t LowestBit() const noexcept { return __builtin_ctz(mask_); }
+
+  void ClearLowestBit() noexcept { mask_ &= mask_ - 1; }
+
+ private:
+  std::uint32_t mask_;
+};
+
+/// Control bytes of kGroupWidth consecutive slots, which are probed at once
+class Group final {
+ public:
+  explicit Group(const ControlByte* ctrl) noexcept {
+#ifdef __SSE2__
+    ctrl_ = _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+    std::memcpy(ctrl_, ctrl, kGroupWidth);
+#endif
+  }
+
+  /// Slots that are full and have the specified 7 bits of the hash
+  GroupMask Match(ControlByte h2) const noexcept {
+#ifdef __SSE2__
+    return GroupMask(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_))));
+#else
+    return MatchScalar([h2](ControlByte c) { return c == h2; });
+#endif
+  }
+
+  GroupMask MatchEmpty() const noexcept {
+#ifdef __SSE2__
+    return GroupMask(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(kEmpty), ctrl_))));
+#else
+    return MatchScalar([](ControlByte c) { return c == kEmpty; });
+#endif
+  }
+
+  GroupMask MatchEmptyOrDeleted() const noexcept {
+#ifdef __SSE2__
+    // Only the empty and the deleted slots have the sign bit set
+    return GroupMask(static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_)));
+#else
+    return MatchScalar([](ControlByte c) { return c < 0; });
+#endif
+  }
+
+ private:
+#ifdef __SSE2__
+  __m128i ctrl_;
+#else
+  template <typename Predicate>
+  GroupMask MatchScalar(Predicate predicate) const noexcept {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kGroupWidth; ++i) {
+      if (predicate(ctrl_[i])) mask |= std::uint32_t{1} << i;
+    }
+    return GroupMask(mask);
+  }
+
+  ControlByte ctrl_[kGroupWidth];
+#endif
+};
+
+}  // namespace impl
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Open-addressing hash map with SIMD-probed groups of slots, in the
+/// style of SwissTable.
+///
+/// The elements are stored in a single flat array without per-element
+/// allocations. Each slot has a control byte with 7 bits of the hash of its
+/// key, the control bytes of 16 slots are compared with the looked up hash at
+/// once by an SSE2 instruction, so a lookup typically touches one cache line
+/// of the control bytes and one slot. The control bytes are aligned to the
+/// cache line, so a group never crosses a cache line boundary.
+///
+/// Compared to std::unordered_map, the map takes less memory for small values
+/// and does much less pointer chasing, which makes it a good container for the
+/// snapshots of components::CachingComponentBase. For such caches the
+/// `snapshot.capacity` and `snapshot.allocated-bytes` metrics are reported.
+/// The map is supported by the dumps of the caches, see
+/// @ref scripts/docs/en/userver/cache_dumps.md.
+///
+/// Unlike std::unordered_map, insertions and rehashing invalidate the
+/// references and the iterators to the elements. The elements are moved
+/// on rehashing, so the keys and the values must be nothrow
+/// move-constructible.
+///
+/// ## Example usage:
+///
+/// @snippet cache/flat_hash_map_test.cpp  Sample cache::FlatHashMap usage
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class FlatHashMap final {
+  static_assert(std::is_nothrow_move_constructible_v<Key> &&
+                    std::is_nothrow_move_constructible_v<Value>,
+                "FlatHashMap moves the elements on rehashing, the keys and "
+                "the values must be nothrow move-constructible");
+
+  template <bool IsConst>
+  class Iterator;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = Equal;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  FlatHashMap() = default;
+
+  /// @param capacity the number of elements to reserve the memory for
+  explicit FlatHashMap(std::size_t capacity, const Hash& hash = Hash{},
+                       const Equal& equal = Equal{});
+
+  FlatHashMap(const FlatHashMap& other);
+  FlatHashMap(FlatHashMap&& other) noexcept;
+  FlatHashMap& operator=(const FlatHashMap& other);
+  FlatHashMap& operator=(FlatHashMap&& other) noexcept;
+  ~FlatHashMap();
+
+  /// Returns pointer to the value, nullptr if the key is missing
+  const Value* FindOrNullptr(const Key& key) const;
+  Value* FindOrNullptr(const Key& key);
+
+  const_iterator find(const Key& key) const;
+  iterator find(const Key& key);
+
+  /// @throws std::out_of_range if the key is missing
+  const Value& at(const Key& key) const;
+  Value& at(const Key& key);
+
+  bool contains(const Key& key) const { return FindIndex(key) != kNotFound; }
+
+  std::size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  std::size_t size() const noexcept { return size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// Number of slots, the map grows when 7/8 of them are used
+  std::size_t capacity() const noexcept { return capacity_; }
+
+  /// Constructs the value from the arguments if the key is missing
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
+
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+
+  /// Inserts the value or overwrites the existing one
+  /// @returns true if the key is a new one
+  template <typename V>
+  bool insert_or_assign(Key key, V&& value);
+
+  /// Returns a mutable reference to the value, inserts a default-constructed
+  /// value if the key is missing
+  Value& operator[](const Key& key);
+  Value& operator[](Key&& key);
+
+  /// @returns the number of removed elements
+  std::size_t erase(const Key& key);
+
+  /// Removes all the elements, keeps the allocated memory
+  void clear() noexcept;
+
+  /// Allocates the memory for at least `count` elements
+  void reserve(std::size_t count);
+
+  void swap(FlatHashMap& other) noexcept;
+
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  MemoryStatistics GetMemoryStatistics() const noexcept;
+
+  friend bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    for (const auto& [key, value] : lhs) {
+      const auto* other_value = rhs.FindOrNullptr(key);
+      if (!other_value || !(*other_value == value)) return false;
+    }
+    return true;
+  }
+
+  friend bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs) {
+    return !(lhs == rhs);
+  }
+
+ private:
+  static constexpr std::size_t kNotFound = static_cast<std::size_t>(-1);
+  static constexpr std::size_t kAlignment =
+      alignof(value_type) > impl::kCacheLineSize ? alignof(value_type)
+                                                 : impl::kCacheLineSize;
+
+  static std::size_t CapacityFor(std::size_t count) noexcept;
+  static std::size_t MaxLoad(std::size_t capacity) noexcept;
+  static std::size_t SlotsOffset(std::size_t capacity) noexcept;
+  static std::size_t AllocatedBytes(std::size_t capacity) noexcept;
+
+  static impl::ControlByte H2(std::size_t hash) noexcept {
+    return static_cast<impl::ControlByte>(hash & 0x7f);
+  }
+
+  std::size_t GetHash(const Key& key) const {
+    return impl::MixHash(hash_(key));
+  }
+
+  std::size_t FindIndex(const Key& key) const {
+    return size_ == 0 ? kNotFound : FindIndex(key, GetHash(key));
+  }
+
+  std::size_t FindIndex(const Key& key, std::size_t hash) const;
+
+  /// Returns the first empty or deleted slot on the probe sequence of the hash
+  std::size_t FindInsertSlot(std::size_t hash) const noexcept;
+
+  /// Returns the slot for a new element, grows the table if needed
+  std::size_t PrepareInsert(std::size_t hash);
+
+  void CommitInsert(std::size_t index, std::size_t hash) noexcept;
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplaceImpl(K&& key, Args&&... args);
+
+  void Rehash(std::size_t new_capacity);
+  void Allocate(std::size_t capacity);
+  void DestroyAndDeallocate() noexcept;
+
+  bool IsFull(std::size_t index) const noexcept { return ctrl_[index] >= 0; }
+
+  char* memory_{nullptr};
+  impl::ControlByte* ctrl_{nullptr};
+  value_type* slots_{nullptr};
+  std::size_t capacity_{0};
+  std::size_t size_{0};
+  std::size_t growth_left_{0};
+  Hash hash_;
+  Equal equal_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <bool IsConst>
+class FlatHashMap<Key, Value, Hash, Equal>::Iterator final {
+  using Map = std::conditional_t<IsConst, const FlatHashMap, FlatHashMap>;
+
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename FlatHashMap::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+  using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+  Iterator() = default;
+
+  template <bool C = IsConst, std::enable_if_t<!C, int> = 0>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  operator Iterator<true>() const noexcept {
+    return {map_, index_};
+  }
+
+  reference operator*() const { return map_->slots_[index_]; }
+  pointer operator->() const { return &map_->slots_[index_]; }
+
+  Iterator& operator++() {
+    ++index_;
+    SkipFreeSlots();
+    return *this;
+  }
+
+  Iterator operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+  }
+
+  bool operator==(const Iterator& other) const noexcept {
+    return index_ == other.index_;
+  }
+
+  bool operator!=(const Iterator& other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  friend class FlatHashMap;
+  friend class Iterator<!IsConst>;
+
+  Iterator(Map* map, std::size_t index) noexcept : map_(map), index_(index) {}
+
+  void SkipFreeSlots() noexcept {
+    while (index_ < map_->capacity_ && !map_->IsFull(index_)) ++index_;
+  }
+
+  Map* map_{nullptr};
+  std::size_t index_{0};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+FlatHashMap<Key, Value, Hash, Equal>::FlatHashMap(std::size_t capacity,
+                                                  const Hash& hash,
+                                                  const Equal& equal)
+    : hash_(hash), equal_(equal) {
+  reserve(capacity);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+FlatHashMap<Key, Value, Hash, Equal>::FlatHashMap(const FlatHashMap& other)
+    : hash_(other.hash_), equal_(other.equal_) {
+  reserve(other.size_);
+  try {
+    for (const auto& value : other) {
+      const auto hash = GetHash(value.first);
+      const auto index = FindInsertSlot(hash);
+      new (&slots_[index]) value_type(value);
+      CommitInsert(index, hash);
+    }
+  } catch (...) {
+    DestroyAndDeallocate();
+    throw;
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+FlatHashMap<Key, Value, Hash, Equal>::FlatHashMap(FlatHashMap&& other) noexcept
+    : hash_(other.hash_), equal_(other.equal_) {
+  swap(other);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+FlatHashMap<Key, Value, Hash, Equal>&
+FlatHashMap<Key, Value, Hash, Equal>::operator=(const FlatHashMap& other) {
+  if (this != &other) {
+    FlatHashMap copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+FlatHashMap<Key, Value, Hash, Equal>&
+FlatHashMap<Key, Value, Hash, Equal>::operator=(FlatHashMap&& other) noexcept {
+  if (this != &other) {
+    FlatHashMap moved(std::move(other));
+    swap(moved);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+FlatHashMap<Key, Value, Hash, Equal>::~FlatHashMap() {
+  DestroyAndDeallocate();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value* FlatHashMap<Key, Value, Hash, Equal>::FindOrNullptr(
+    const Key& key) const {
+  const auto index = FindIndex(key);
+  return index == kNotFound ? nullptr : &slots_[index].second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value* FlatHashMap<Key, Value, Hash, Equal>::FindOrNullptr(const Key& key) {
+  const auto index = FindIndex(key);
+  return index == kNotFound ? nullptr : &slots_[index].second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto FlatHashMap<Key, Value, Hash, Equal>::find(const Key& key) const
+    -> const_iterator {
+  const auto index = FindIndex(key);
+  return index == kNotFound ? end() : const_iterator{this, index};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto FlatHashMap<Key, Value, Hash, Equal>::find(const Key& key) -> iterator {
+  const auto index = FindIndex(key);
+  return index == kNotFound ? end() : iterator{this, index};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value& FlatHashMap<Key, Value, Hash, Equal>::at(const Key& key) const {
+  const auto* value = FindOrNullptr(key);
+  if (!value) throw std::out_of_range("FlatHashMap::at: missing key");
+  return *value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value& FlatHashMap<Key, Value, Hash, Equal>::at(const Key& key) {
+  auto* value = FindOrNullptr(key);
+  if (!value) throw std::out_of_range("FlatHashMap::at: missing key");
+  return *value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename... Args>
+auto FlatHashMap<Key, Value, Hash, Equal>::try_emplace(const Key& key,
+                                                       Args&&... args)
+    -> std::pair<iterator, bool> {
+  return TryEmplaceImpl(key, std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename... Args>
+auto FlatHashMap<Key, Value, Hash, Equal>::try_emplace(Key&& key,
+                                                       Args&&... args)
+    -> std::pair<iterator, bool> {
+  return TryEmplaceImpl(std::move(key), std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto FlatHashMap<Key, Value, Hash, Equal>::insert(const value_type& value)
+    -> std::pair<iterator, bool> {
+  return TryEmplaceImpl(value.first, value.second);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto FlatHashMap<Key, Value, Hash, Equal>::insert(value_type&& value)
+    -> std::pair<iterator, bool> {
+  return TryEmplaceImpl(value.first, std::move(value.second));
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename V>
+bool FlatHashMap<Key, Value, Hash, Equal>::insert_or_assign(Key key,
+                                                            V&& value) {
+  auto [it, inserted] = TryEmplaceImpl(std::move(key), std::forward<V>(value));
+  if (!inserted) it->second = std::forward<V>(value);
+  return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value& FlatHashMap<Key, Value, Hash, Equal>::operator[](const Key& key) {
+  return TryEmplaceImpl(key).first->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value& FlatHashMap<Key, Value, Hash, Equal>::operator[](Key&& key) {
+  return TryEmplaceImpl(std::move(key)).first->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t FlatHashMap<Key, Value, Hash, Equal>::erase(const Key& key) {
+  const auto index = FindIndex(key);
+  if (index == kNotFound) return 0;
+
+  slots_[index].~value_type();
+  --size_;
+
+  // If the group has an empty slot, no probe sequence has ever passed through
+  // the group, so the slot may become empty instead of a tombstone
+  const impl::Group group{ctrl_ + index / impl::kGroupWidth *
+                                      impl::kGroupWidth};
+  if (group.MatchEmpty()) {
+    ctrl_[index] = impl::kEmpty;
+    ++growth_left_;
+  } else {
+    ctrl_[index] = impl::kDeleted;
+  }
+  return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void FlatHashMap<Key, Value, Hash, Equal>::clear() noexcept {
+  if constexpr (!std::is_trivially_destructible_v<value_type>) {
+    for (std::size_t i = 0; i < capacity_; ++i) {
+      if (IsFull(i)) slots_[i].~value_type();
+    }
+  }
+  if (capacity_ != 0) std::memset(ctrl_, impl::kEmpty, capacity_);
+  size_ = 0;
+  growth_left_ = MaxLoad(capacity_);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void FlatHashMap<Key, Value, Hash, Equal>::reserve(std::size_t count) {
+  if (count == 0) return;
+  const auto capacity = CapacityFor(count);
+  if (capacity > capacity_) Rehash(capacity);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void FlatHashMap<Key, Value, Hash, Equal>::swap(FlatHashMap& other) noexcept {
+  using std::swap;
+  swap(memory_, other.memory_);
+  swap(ctrl_, other.ctrl_);
+  swap(slots_, other.slots_);
+  swap(capacity_, other.capacity_);
+  swap(size_, other.size_);
+  swap(growth_left_, other.growth_left_);
+  swap(hash_, other.hash_);
+  swap(equal_, other.equal_);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto FlatHashMap<Key, Value, Hash, Equal>::begin() noexcept -> iterator {
+  iterator it{this, 0};
+  it.SkipFreeSlots();
+  return it;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto FlatHashMap<Key, Value, Hash, Equal>::end() noexcept -> iterator {
+  return {this, capacity_};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto FlatHashMap<Key, Value, Hash, Equal>::begin() const noexcept
+    -> const_iterator {
+  const_iterator it{this, 0};
+  it.SkipFreeSlots();
+  return it;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto FlatHashMap<Key, Value, Hash, Equal>::end() const noexcept
+    -> const_iterator {
+  return {this, capacity_};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+MemoryStatistics FlatHashMap<Key, Value, Hash, Equal>::GetMemoryStatistics()
+    const noexcept {
+  return {capacity_, capacity_ == 0 ? 0 : AllocatedBytes(capacity_)};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t FlatHashMap<Key, Value, Hash, Equal>::CapacityFor(
+    std::size_t count) noexcept {
+  std::size_t capacity = impl::kGroupWidth;
+  while (MaxLoad(capacity) < count) capacity *= 2;
+  return capacity;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t FlatHashMap<Key, Value, Hash, Equal>::MaxLoad(
+    std::size_t capacity) noexcept {
+  return capacity - capacity / 8;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t FlatHashMap<Key, Value, Hash, Equal>::SlotsOffset(
+    std::size_t capacity) noexcept {
+  return (capacity + alignof(value_type) - 1) / alignof(value_type) *
+         alignof(value_type);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t FlatHashMap<Key, Value, Hash, Equal>::AllocatedBytes(
+    std::size_t capacity) noexcept {
+  return SlotsOffset(capacity) + capacity * sizeof(value_type);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t FlatHashMap<Key, Value, Hash, Equal>::FindIndex(
+    const Key& key, std::size_t hash) const {
+  if (size_ == 0) return kNotFound;
+
+  const auto h2 = H2(hash);
+  const auto groups_mask = capacity_ / impl::kGroupWidth - 1;
+
+  // Triangular probing visits all the groups of a power-of-two table
+  auto group_index = (hash >> 7) & groups_mask;
+  for (std::size_t step = 1;; ++step) {
+    const auto offset = group_index * impl::kGroupWidth;
+    const impl::Group group{ctrl_ + offset};
+    for (auto match = group.Match(h2); match; match.ClearLowestBit()) {
+      const auto index = offset + match.LowestBit();
+      if (equal_(slots_[index].first, key)) return index;
+    }
+    if (group.MatchEmpty()) return kNotFound;
+    group_index = (group_index + step) & groups_mask;
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t FlatHashMap<Key, Value, Hash, Equal>::FindInsertSlot(
+    std::size_t hash) const noexcept {
+  UASSERT(capacity_ != 0);
+  const auto groups_mask = capacity_ / impl::kGroupWidth - 1;
+
+  auto group_index = (hash >> 7) & groups_mask;
+  for (std::size_t step = 1;; ++step) {
+    const auto offset = group_index * impl::kGroupWidth;
+    const auto match = impl::Group{ctrl_ + offset}.MatchEmptyOrDeleted();
+    if (match) return offset + match.LowestBit();
+    group_index = (group_index + step) & groups_mask;
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t FlatHashMap<Key, Value, Hash, Equal>::PrepareInsert(
+    std::size_t hash) {
+  if (growth_left_ == 0) {
+    // Rebuilding the table of the same size is enough to drop the tombstones
+    // if they take more than a half of the used slots
+    Rehash(size_ * 2 < MaxLoad(capacity_) ? capacity_
+                                          : CapacityFor(size_ + 1));
+  }
+  return FindInsertSlot(hash);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void FlatHashMap<Key, Value, Hash, Equal>::CommitInsert(
+    std::size_t index, std::size_t hash) noexcept {
+  if (ctrl_[index] == impl::kEmpty) --growth_left_;
+  ctrl_[index] = H2(hash);
+  ++size_;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename K, typename... Args>
+auto FlatHashMap<Key, Value, Hash, Equal>::TryEmplaceImpl(K&& key,
+                                                          Args&&... args)
+    -> std::pair<iterator, bool> {
+  const auto hash = GetHash(key);
+  const auto found = FindIndex(key, hash);
+  if (found != kNotFound) return {iterator{this, found}, false};
+
+  const auto index = PrepareInsert(hash);
+  new (&slots_[index])
+      value_type(std::piecewise_construct,
+                 std::forward_as_tuple(std::forward<K>(key)),
+                 std::forward_as_tuple(std::forward<Args>(args)...));
+  CommitInsert(index, hash);
+  return {iterator{this, index}, true};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void FlatHashMap<Key, Value, Hash, Equal>::Rehash(std::size_t new_capacity) {
+  FlatHashMap old(0, hash_, equal_);
+  swap(old);
+  Allocate(new_capacity);
+
+  for (std::size_t i = 0; i < old.capacity_; ++i) {
+    if (!old.IsFull(i)) continue;
+
+    auto& slot = old.slots_[i];
+    const auto hash = GetHash(slot.first);
+    const auto index = FindInsertSlot(hash);
+    // The old slot is destroyed right away, so its key is moved from, like
+    // the node handles of the standard containers do
+    new (&slots_[index]) value_type(std::move(const_cast<Key&>(slot.first)),
+                                    std::move(slot.second));
+    CommitInsert(index, hash);
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void FlatHashMap<Key, Value, Hash, Equal>::Allocate(std::size_t capacity) {
+  UASSERT(memory_ == nullptr);
+  UASSERT(capacity % impl::kGroupWidth == 0);
+  UASSERT((capacity & (capacity - 1)) == 0);
+
+  memory_ = static_cast<char*>(::operator new(AllocatedBytes(capacity),
+                                              std::align_val_t{kAlignment}));
+  ctrl_ = reinterpret_cast<impl::ControlByte*>(memory_);
+  slots_ = reinterpret_cast<value_type*>(memory_ + SlotsOffset(capacity));
+  std::memset(ctrl_, impl::kEmpty, capacity);
+  capacity_ = capacity;
+  size_ = 0;
+  growth_left_ = MaxLoad(capacity);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void FlatHashMap<Key, Value, Hash, Equal>::DestroyAndDeallocate() noexcept {
+  if (!memory_) return;
+  clear();
+  ::operator delete(memory_, std::align_val_t{kAlignment});
+  memory_ = nullptr;
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  growth_left_ = 0;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
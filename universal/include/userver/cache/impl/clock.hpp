@@ -0,0 +1,208 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// CLOCK (second chance) approximation of LRU.
+///
+/// Unlike LruBase, a lookup does not reorder the elements, it only sets the
+/// atomic reference bit of the found element. So Get() is const and may be
+/// called concurrently from multiple threads, as long as no modifying method
+/// is called at the same time. Put(), Erase() and the other modifying methods
+/// require exclusive access.
+///
+/// On overflow, the clock hand walks over the elements, gives a second chance
+/// to the referenced ones by resetting their reference bit, and evicts the
+/// first element that was not referenced since the previous pass.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class ClockBase final {
+ public:
+  explicit ClockBase(std::size_t max_size, const Hash& hash = Hash(),
+                     const Equal& equal = Equal());
+
+  ClockBase(ClockBase&& other) = default;
+  ClockBase& operator=(ClockBase&& other) = default;
+
+  ClockBase(const ClockBase&) = delete;
+  ClockBase& operator=(const ClockBase&) = delete;
+
+  bool Put(const T& key, U value);
+
+  void Erase(const T& key);
+
+  /// Marks the element as recently used, does not modify the container
+  const U* Get(const T& key) const;
+
+  void SetMaxSize(std::size_t new_max_size);
+
+  void Clear() noexcept;
+
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  std::size_t GetSize() const;
+
+ private:
+  struct Node final {
+    template <typename Value>
+    Node(Value&& value, std::size_t ring_index)
+        : value(std::forward<Value>(value)), ring_index(ring_index) {}
+
+    U value;
+    std::size_t ring_index;
+    mutable std::atomic<bool> referenced{false};
+  };
+
+  using Map = std::unordered_map<T, Node, Hash, Equal>;
+  using Element = typename Map::value_type;
+
+  // Returns the ring index of the evicted element, the caller reuses or
+  // removes the emptied slot
+  std::size_t EvictOne();
+  void RemoveFromRing(std::size_t ring_index) noexcept;
+
+  std::size_t max_size_;
+  Map map_;
+  // Pointers to the elements of map_ in clock order, stay valid on rehashing
+  std::vector<Element*> ring_;
+  std::size_t hand_{0};
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+ClockBase<T, U, Hash, Equal>::ClockBase(std::size_t max_size, const Hash& hash,
+                                        const Equal& equal)
+    : max_size_(max_size), map_(max_size, hash, equal) {
+  UASSERT(max_size > 0);
+  ring_.reserve(max_size);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool ClockBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+  auto it = map_.find(key);
+  if (it != map_.end()) {
+    it->second.value = std::move(value);
+    it->second.referenced.store(true, std::memory_order_relaxed);
+    return false;
+  }
+
+  const bool is_full = map_.size() >= max_size_;
+  it = map_.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                    std::forward_as_tuple(std::move(value), ring_.size()))
+           .first;
+
+  if (is_full) {
+    // The new element takes the place of the evicted one, right behind the
+    // hand, so it is the last one to be visited by the hand
+    const auto ring_index = EvictOne();
+    it->second.ring_index = ring_index;
+    ring_[ring_index] = &*it;
+    hand_ = ring_index + 1;
+  } else {
+    try {
+      ring_.push_back(&*it);
+    } catch (...) {
+      map_.erase(it);
+      throw;
+    }
+  }
+  return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::Erase(const T& key) {
+  auto it = map_.find(key);
+  if (it == map_.end()) return;
+
+  RemoveFromRing(it->second.ring_index);
+  map_.erase(it);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const U* ClockBase<T, U, Hash, Equal>::Get(const T& key) const {
+  auto it = map_.find(key);
+  if (it == map_.end()) return nullptr;
+
+  // Avoid writing to the shared cache line for hot elements
+  auto& referenced = it->second.referenced;
+  if (!referenced.load(std::memory_order_relaxed)) {
+    referenced.store(true, std::memory_order_relaxed);
+  }
+  return &it->second.value;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+  UASSERT(new_max_size > 0);
+  max_size_ = new_max_size ? new_max_size : 1;
+  while (map_.size() > max_size_) RemoveFromRing(EvictOne());
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::Clear() noexcept {
+  ring_.clear();
+  map_.clear();
+  hand_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void ClockBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+  for (const auto& [key, node] : map_) {
+    func(key, node.value);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t ClockBase<T, U, Hash, Equal>::GetSize() const {
+  return map_.size();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t ClockBase<T, U, Hash, Equal>::EvictOne() {
+  UASSERT(!ring_.empty());
+
+  // Terminates in at most two passes: the first one resets all the bits
+  for (;;) {
+    if (hand_ >= ring_.size()) hand_ = 0;
+
+    auto& node = ring_[hand_]->second;
+    if (node.referenced.load(std::memory_order_relaxed)) {
+      node.referenced.store(false, std::memory_order_relaxed);
+      ++hand_;
+      continue;
+    }
+
+    map_.erase(map_.find(ring_[hand_]->first));
+    ring_[hand_] = nullptr;
+    return hand_;
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::RemoveFromRing(
+    std::size_t ring_index) noexcept {
+  UASSERT(ring_index < ring_.size());
+
+  // The last element takes the place of the removed one
+  if (ring_index + 1 != ring_.size()) {
+    ring_[ring_index] = ring_.back();
+    ring_[ring_index]->second.ring_index = ring_index;
+  }
+  ring_.pop_back();
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
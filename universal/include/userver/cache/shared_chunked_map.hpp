@@ -0,0 +1,303 @@
+#pragma once
+
+/// @file userver/cache/shared_chunked_map.hpp
+/// @brief @copybrief cache::SharedChunkedMap
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief How much of the cache::SharedChunkedMap memory is shared with its
+/// copies, e.g. with the previous snapshot of a cache
+struct SharingStatistics final {
+  /// Total number of chunks
+  std::size_t chunks{0};
+  /// Chunks that are shared with other copies of the map
+  std::size_t shared_chunks{0};
+};
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Hash map with structurally shared, copy-on-write chunks.
+///
+/// The elements are distributed between a fixed number of chunks by their
+/// hash. Copying the map only copies the pointers to the chunks, and a
+/// modification clones just the chunk it touches, if the chunk is shared
+/// with another copy of the map.
+///
+/// The map is designed for the incremental updates of
+/// components::CachingComponentBase: copy the previous snapshot, apply the
+/// changed rows and Set() the result. Such an update takes memory and time
+/// proportional to the number of touched chunks rather than to the size of
+/// the whole cache.
+///
+/// Thread safety matches Standard Library thread safety: distinct copies of
+/// the map may be used concurrently, even if they share chunks.
+///
+/// ## Example usage:
+///
+/// @snippet cache/shared_chunked_map_test.cpp  Sample cache::SharedChunkedMap usage
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class SharedChunkedMap final {
+  using Chunk = std::unordered_map<Key, Value, Hash, Equal>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = typename Chunk::value_type;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = Equal;
+
+  class const_iterator;
+  using iterator = const_iterator;
+
+  static constexpr std::size_t kDefaultChunksCount = 256;
+
+  /// @param chunks_count the number of chunks. More chunks make the incremental
+  /// updates cheaper, but make copying of the map more expensive.
+  explicit SharedChunkedMap(std::size_t chunks_count = kDefaultChunksCount,
+                            const Hash& hash = Hash(),
+                            const Equal& equal = Equal());
+
+  /// Returns pointer to the value, nullptr if the key is missing
+  const Value* FindOrNullptr(const Key& key) const;
+
+  const_iterator find(const Key& key) const;
+
+  /// @throws std::out_of_range if the key is missing
+  const Value& at(const Key& key) const;
+
+  bool contains(const Key& key) const { return FindOrNullptr(key) != nullptr; }
+
+  std::size_t size() const noexcept { return size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// Inserts the value or overwrites the existing one
+  /// @returns true if the key is a new one
+  bool insert_or_assign(const Key& key, Value value);
+
+  /// Returns a mutable reference to the value, inserts a default-constructed
+  /// value if the key is missing. Clones the chunk of the key if it is shared.
+  Value& operator[](const Key& key);
+
+  /// @returns the number of removed elements
+  std::size_t erase(const Key& key);
+
+  void clear();
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  SharingStatistics GetSharingStatistics() const noexcept;
+
+ private:
+  std::size_t GetChunkIndex(const Key& key) const;
+  Chunk& GetMutableChunk(std::size_t index);
+
+  std::vector<std::shared_ptr<Chunk>> chunks_;
+  std::size_t size_{0};
+  Hash hash_;
+  Equal equal_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+class SharedChunkedMap<Key, Value, Hash, Equal>::const_iterator final {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename Chunk::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type*;
+  using reference = const value_type&;
+
+  const_iterator() = default;
+
+  reference operator*() const { return *it_; }
+  pointer operator->() const { return &*it_; }
+
+  const_iterator& operator++() {
+    ++it_;
+    SkipEmptyChunks();
+    return *this;
+  }
+
+  const_iterator operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+  }
+
+  bool operator==(const const_iterator& other) const {
+    return chunk_ == other.chunk_ &&
+           (chunk_ == chunks_end_ || it_ == other.it_);
+  }
+
+  bool operator!=(const const_iterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  friend class SharedChunkedMap;
+
+  using ChunkIterator =
+      typename std::vector<std::shared_ptr<Chunk>>::const_iterator;
+
+  const_iterator(ChunkIterator chunk, ChunkIterator chunks_end)
+      : chunk_(chunk), chunks_end_(chunks_end) {
+    if (chunk_ != chunks_end_) {
+      it_ = (*chunk_)->begin();
+      SkipEmptyChunks();
+    }
+  }
+
+  const_iterator(ChunkIterator chunk, ChunkIterator chunks_end,
+                 typename Chunk::const_iterator it)
+      : chunk_(chunk), chunks_end_(chunks_end), it_(it) {}
+
+  void SkipEmptyChunks() {
+    while (it_ == (*chunk_)->end()) {
+      ++chunk_;
+      if (chunk_ == chunks_end_) return;
+      it_ = (*chunk_)->begin();
+    }
+  }
+
+  ChunkIterator chunk_{};
+  ChunkIterator chunks_end_{};
+  typename Chunk::const_iterator it_{};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+SharedChunkedMap<Key, Value, Hash, Equal>::SharedChunkedMap(
+    std::size_t chunks_count, const Hash& hash, const Equal& equal)
+    : hash_(hash), equal_(equal) {
+  UINVARIANT(chunks_count > 0, "SharedChunkedMap requires at least one chunk");
+
+  const auto empty_chunk = std::make_shared<Chunk>(0, hash_, equal_);
+  chunks_.assign(chunks_count, empty_chunk);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value* SharedChunkedMap<Key, Value, Hash, Equal>::FindOrNullptr(
+    const Key& key) const {
+  const auto& chunk = *chunks_[GetChunkIndex(key)];
+  const auto it = chunk.find(key);
+  return it == chunk.end() ? nullptr : &it->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename SharedChunkedMap<Key, Value, Hash, Equal>::const_iterator
+SharedChunkedMap<Key, Value, Hash, Equal>::find(const Key& key) const {
+  const auto chunk = chunks_.cbegin() + GetChunkIndex(key);
+  const auto it = (*chunk)->find(key);
+  if (it == (*chunk)->end()) return end();
+  return const_iterator(chunk, chunks_.cend(), it);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value& SharedChunkedMap<Key, Value, Hash, Equal>::at(
+    const Key& key) const {
+  const auto* value = FindOrNullptr(key);
+  if (!value) throw std::out_of_range("SharedChunkedMap::at: missing key");
+  return *value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool SharedChunkedMap<Key, Value, Hash, Equal>::insert_or_assign(
+    const Key& key, Value value) {
+  auto& chunk = GetMutableChunk(GetChunkIndex(key));
+  const bool inserted = chunk.insert_or_assign(key, std::move(value)).second;
+  if (inserted) ++size_;
+  return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value& SharedChunkedMap<Key, Value, Hash, Equal>::operator[](const Key& key) {
+  auto& chunk = GetMutableChunk(GetChunkIndex(key));
+  const auto [it, inserted] = chunk.try_emplace(key);
+  if (inserted) ++size_;
+  return it->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t SharedChunkedMap<Key, Value, Hash, Equal>::erase(const Key& key) {
+  const auto index = GetChunkIndex(key);
+  // Do not clone the chunk if there is nothing to erase
+  if (!chunks_[index]->count(key)) return 0;
+
+  GetMutableChunk(index).erase(key);
+  --size_;
+  return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void SharedChunkedMap<Key, Value, Hash, Equal>::clear() {
+  *this = SharedChunkedMap(chunks_.size(), hash_, equal_);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename SharedChunkedMap<Key, Value, Hash, Equal>::const_iterator
+SharedChunkedMap<Key, Value, Hash, Equal>::begin() const {
+  return const_iterator(chunks_.cbegin(), chunks_.cend());
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename SharedChunkedMap<Key, Value, Hash, Equal>::const_iterator
+SharedChunkedMap<Key, Value, Hash, Equal>::end() const {
+  return const_iterator(chunks_.cend(), chunks_.cend());
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+SharingStatistics
+SharedChunkedMap<Key, Value, Hash, Equal>::GetSharingStatistics()
+    const noexcept {
+  SharingStatistics stats;
+  stats.chunks = chunks_.size();
+  for (const auto& chunk : chunks_) {
+    if (chunk.use_count() > 1) ++stats.shared_chunks;
+  }
+  return stats;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t SharedChunkedMap<Key, Value, Hash, Equal>::GetChunkIndex(
+    const Key& key) const {
+  // The chunks use the same hash, twist it to avoid putting all the keys of a
+  // chunk into the same buckets
+  auto seed = hash_(key);
+  boost::hash_combine(seed, 0);
+  return seed % chunks_.size();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename SharedChunkedMap<Key, Value, Hash, Equal>::Chunk&
+SharedChunkedMap<Key, Value, Hash, Equal>::GetMutableChunk(std::size_t index) {
+  auto& chunk = chunks_[index];
+  if (chunk.use_count() > 1) {
+    chunk = std::make_shared<Chunk>(*chunk);
+  } else {
+    // Synchronizes with the release of the chunk by the other copies
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+  return *chunk;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include <userver/compression/error.hpp>
 
@@ -8,10 +14,176 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+/// Default compression level, favors the speed over the compression ratio
+inline constexpr int kDefaultCompressionLevel = 1;
+
+/// Compresses the string into a single zstd frame with the content size.
+/// @throws std::runtime_error on compression failure
+std::string Compress(std::string_view data,
+                     int level = kDefaultCompressionLevel);
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Default dictionary size limit, the same as of `zstd --train`
+inline constexpr std::size_t kDefaultMaxDictionarySize = 112'640;
+
+/// @brief Trains a dictionary on the samples of the data it would compress.
+///
+/// Dictionaries improve the compression of small payloads, e.g. of the
+/// separate records or messages, that share the field names and values.
+/// A few hundred samples are usually enough, the total size of the samples
+/// should be about 100 times the dictionary size.
+/// @throws std::runtime_error if the training fails, e.g. there are too few
+/// samples
+std::string TrainDictionary(const std::vector<std::string>& samples,
+                            std::size_t max_size = kDefaultMaxDictionarySize);
+
+/// @brief Prepared zstd dictionary.
+///
+/// The dictionary is digested once on construction for the compression at
+/// the given level and for the decompression, so the same instance should be
+/// reused across the calls. Thread-safe.
+class Dictionary final {
+ public:
+  /// @param content a dictionary from TrainDictionary or `zstd --train`
+  /// @throws std::runtime_error if the dictionary can not be loaded
+  explicit Dictionary(std::string_view content,
+                      int level = kDefaultCompressionLevel);
+  Dictionary(Dictionary&&) noexcept;
+  Dictionary& operator=(Dictionary&&) noexcept;
+  ~Dictionary();
+
+  /// ID of the dictionary, which is written into the compressed frames.
+  /// Zero for the raw content dictionaries without the zstd header.
+  std::uint32_t GetId() const noexcept;
+
+  /// Compresses the string into a single zstd frame with the content size.
+  /// @throws std::runtime_error on compression failure
+  std::string Compress(std::string_view data) const;
+
+  /// Decompresses the string compressed with this dictionary.
+  /// @throws DecompressionError
+  std::string Decompress(std::string_view compressed, size_t max_size) const;
+
+ private:
+  friend class StreamCompressor;
+  friend class StreamDecompressor;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Versions of a dictionary by their IDs.
+///
+/// Keeps the previous versions of the dictionary to decompress the data,
+/// e.g. the dumps or the stored records, compressed before the dictionary
+/// was retrained. The last added dictionary is used for compression.
+///
+/// Not thread-safe for modification, const methods are thread-safe.
+class DictionaryRegistry final {
+ public:
+  /// Adds the dictionary and makes it the current one.
+  /// @throws std::invalid_argument if the dictionary has a zero ID or a
+  /// dictionary with the same ID is already added
+  void Add(std::shared_ptr<const Dictionary> dictionary);
+
+  /// Returns the dictionary with the ID or `nullptr`
+  std::shared_ptr<const Dictionary> Find(std::uint32_t id) const;
+
+  /// Returns the last added dictionary or `nullptr`
+  std::shared_ptr<const Dictionary> GetCurrent() const;
+
+  /// Compresses the string with the current dictionary, or without a
+  /// dictionary if there is none.
+  /// @throws std::runtime_error on compression failure
+  std::string Compress(std::string_view data) const;
+
+  /// Decompresses the string compressed with any of the added dictionaries
+  /// or without a dictionary.
+  /// @throws DecompressionError, also if the dictionary of the data is unknown
+  std::string Decompress(std::string_view compressed, size_t max_size) const;
+
+ private:
+  std::unordered_map<std::uint32_t, std::shared_ptr<const Dictionary>>
+      dictionaries_;
+  std::shared_ptr<const Dictionary> current_;
+};
+
+/// @brief Streaming compressor, that produces a sequence of zstd frames.
+///
+/// Concatenated frames form a valid zstd stream, so the output may be
+/// appended to a file and decompressed by `zstd -d` or Decompress.
+///
+/// Not thread-safe.
+class StreamCompressor final {
+ public:
+  explicit StreamCompressor(int level = kDefaultCompressionLevel);
+  /// Compresses with the dictionary at its compression level. The dictionary
+  /// must outlive the compressor.
+  explicit StreamCompressor(const Dictionary& dictionary);
+  StreamCompressor(StreamCompressor&&) noexcept;
+  StreamCompressor& operator=(StreamCompressor&&) noexcept;
+  ~StreamCompressor();
+
+  /// Compresses the data and appends the ready part of the output to `out`.
+  /// The compressor may keep some of the data buffered until Flush.
+  /// @throws std::runtime_error on compression failure
+  void Compress(std::string_view data, std::string& out);
+
+  /// Appends all the buffered data to `out`. The data written so far may
+  /// be decompressed by a streaming decoder, e.g. from a tail of the file.
+  /// @throws std::runtime_error on compression failure
+  void Flush(std::string& out);
+
+  /// Appends the buffered data and the end of the current frame to `out`,
+  /// the next Compress starts a new frame. Does nothing for an empty frame.
+  /// @throws std::runtime_error on compression failure
+  void EndFrame(std::string& out);
+
+  /// Size of the data passed to Compress since the start of the frame
+  std::size_t GetFrameInputSize() const noexcept;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Streaming decompressor of a sequence of zstd frames.
+///
+/// The limit on the decompressed size is checked while decompressing, so
+/// the memory used for a malicious input does not exceed the limit.
+///
+/// Not thread-safe.
+class StreamDecompressor final {
+ public:
+  explicit StreamDecompressor(std::size_t max_size);
+  /// Decompresses the frames compressed with the dictionary. The dictionary
+  /// must outlive the decompressor.
+  StreamDecompressor(std::size_t max_size, const Dictionary& dictionary);
+  StreamDecompressor(StreamDecompressor&&) noexcept;
+  StreamDecompressor& operator=(StreamDecompressor&&) noexcept;
+  ~StreamDecompressor();
+
+  /// Decompresses the next chunk of the compressed data and appends the
+  /// output to `out`.
+  /// @throws DecompressionError, TooBigError if the total decompressed size
+  /// exceeds the limit
+  void Decompress(std::string_view data, std::string& out);
+
+  /// Checks that the data passed to Decompress ends on a frame boundary.
+  /// @throws DecompressionError if the last frame is incomplete
+  void Finish() const;
+
+  /// Size of the data decompressed so far
+  std::size_t GetDecompressedSize() const noexcept;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
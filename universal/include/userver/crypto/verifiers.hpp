@@ -64,7 +64,10 @@ using VerifierHs384 = HmacShaVerifier<DigestSize::k384>;
 using VerifierHs512 = HmacShaVerifier<DigestSize::k512>;
 /// @}
 
-/// Generic verifier for asymmetric cryptography
+/// @brief Generic verifier for asymmetric cryptography
+///
+/// OpenSSL contexts are initialized for the key once, on construction, and
+/// are copied for each verification. Copies of the verifier share them.
 template <DsaType type, DigestSize bits>
 class DsaVerifier final : public Verifier {
  public:
@@ -86,7 +89,10 @@ class DsaVerifier final : public Verifier {
                     std::string_view raw_signature) const;
 
  private:
+  struct Contexts;
+
   PublicKey pkey_;
+  std::shared_ptr<const Contexts> contexts_;
 };
 
 /// @name Verifies RSASSA signature using SHA-2 and PKCS1 padding.
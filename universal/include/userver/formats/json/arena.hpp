@@ -0,0 +1,84 @@
+#pragma once
+
+/// @file userver/formats/json/arena.hpp
+/// @brief @copybrief formats::json::ArenaScope
+
+#include <cstddef>
+#include <memory_resource>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+class Arena;
+}  // namespace impl
+
+/// @ingroup userver_universal userver_formats
+///
+/// @brief While alive, makes formats::json::Value and
+/// formats::json::ValueBuilder created on the current thread take memory from
+/// a single arena instead of calling the system allocator for each node.
+///
+/// The arena is released in one go, after the scope is destroyed and all the
+/// values that use its memory are destroyed. Such values may be freely copied,
+/// moved and destroyed, including on other threads. Memory of the destroyed
+/// values is not reused until the whole arena is released, so the scope suits
+/// documents that live about as long as each other, e.g. a parsed request
+/// body.
+///
+/// The scope must be destroyed on the thread it was created on: the coroutine
+/// should not be suspended while the scope is alive.
+///
+/// Arenas are strictly opt-in. Without any scopes and arenas alive, the values
+/// use the system allocator exactly as before. While some arena is alive,
+/// freeing any JSON memory looks its owner up by address, so do not keep
+/// arena-backed values around for long: a single retained subvalue keeps the
+/// whole arena alive.
+///
+/// The chunks of the arena are taken either from the system allocator or from
+/// an upstream `std::pmr::memory_resource`, e.g. from
+/// engine::current_task::GetMemoryResource(). In the latter case the values
+/// must not outlive the resource.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/arena_test.cpp  Sample formats::json::ArenaScope usage
+class ArenaScope final {
+ public:
+  static constexpr std::size_t kDefaultInitialSize = 4096;
+
+  struct Statistics final {
+    /// Memory blocks handed out to the JSON values
+    std::size_t allocations{0};
+    /// Chunks taken from the system allocator
+    std::size_t chunks{0};
+    /// Total size of the chunks
+    std::size_t bytes{0};
+  };
+
+  /// @param initial_size size of the first chunk of the arena
+  explicit ArenaScope(std::size_t initial_size = kDefaultInitialSize);
+
+  /// @param upstream resource to take the chunks of the arena from, must
+  /// outlive all the values created within the scope
+  /// @param initial_size size of the first chunk of the arena
+  explicit ArenaScope(std::pmr::memory_resource& upstream,
+                      std::size_t initial_size = kDefaultInitialSize);
+  ~ArenaScope();
+
+  ArenaScope(ArenaScope&&) = delete;
+  ArenaScope& operator=(ArenaScope&&) = delete;
+
+  Statistics GetStatistics() const noexcept;
+
+ private:
+  ArenaScope(std::pmr::memory_resource* upstream, std::size_t initial_size);
+
+  impl::Arena* arena_;
+  impl::Arena* previous_arena_;
+};
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -26,10 +26,12 @@ class Value;
 
 namespace impl {
 // rapidjson integration
+class Allocator;
+
 using UTF8 = ::rapidjson::UTF8<char>;
-using Value = ::rapidjson::GenericValue<UTF8, ::rapidjson::CrtAllocator>;
-using Document = ::rapidjson::GenericDocument<UTF8, ::rapidjson::CrtAllocator,
-                                              ::rapidjson::CrtAllocator>;
+using Value = ::rapidjson::GenericValue<UTF8, Allocator>;
+using Document =
+    ::rapidjson::GenericDocument<UTF8, Allocator, ::rapidjson::CrtAllocator>;
 
 class VersionedValuePtr final {
  public:
@@ -321,6 +321,8 @@ class Value final {
   friend std::uint64_t Parse(const Value& value, parse::To<std::uint64_t>);
   friend double Parse(const Value& value, parse::To<double>);
   friend std::string Parse(const Value& value, parse::To<std::string>);
+  friend std::string_view Parse(const Value& value,
+                                parse::To<std::string_view>);
 
   friend formats::json::Value FromString(std::string_view);
   friend formats::json::Value FromStream(std::istream&);
@@ -355,6 +357,10 @@ double Parse(const Value& value, parse::To<double>);
 
 std::string Parse(const Value& value, parse::To<std::string>);
 
+/// The string is viewed in place, the view is valid while the document of
+/// the `value` is alive
+std::string_view Parse(const Value& value, parse::To<std::string_view>);
+
 template <>
 bool Value::ConvertTo<bool>() const;
 
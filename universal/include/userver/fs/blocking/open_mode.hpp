@@ -37,6 +37,11 @@ enum class OpenFlag {
   /// Used together with `kWrite` to open file for writing to the end of the
   /// file.
   kAppend = 1 << 5,
+
+  /// Bypass the page cache (O_DIRECT). The buffers, sizes and offsets of the
+  /// reads and writes must be aligned to the logical block size of the file
+  /// system.
+  kDirect = 1 << 6,
 };
 
 /// A set of OpenFlags
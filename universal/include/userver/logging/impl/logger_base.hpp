@@ -34,6 +34,10 @@ class LoggerBase {
 
   Format GetFormat() const noexcept;
 
+  /// Whether the messages are passed to Log as binary records, that are
+  /// formatted by the logger itself
+  bool IsFormattingDeferred() const noexcept;
+
   virtual void SetLevel(Level level);
   Level GetLevel() const noexcept;
   bool ShouldLog(Level level) const noexcept;
@@ -46,8 +50,12 @@ class LoggerBase {
  protected:
   virtual bool DoShouldLog(Level level) const noexcept;
 
+  // Must be called before the logger is used
+  void SetFormattingDeferred(bool deferred) noexcept;
+
  private:
   const Format format_;
+  bool is_formatting_deferred_{false};
   std::atomic<Level> level_{Level::kNone};
   std::atomic<Level> flush_level_{Level::kWarning};
 };
@@ -48,8 +48,10 @@ class TagWriter {
   // The tags must not be duplicated in other Put* calls.
   void PutLogExtra(const LogExtra& extra);
 
-  // Copies the tags to the internal LogExtra. They will be deduplicated
-  // automatically.
+  // Adds the tags to the internal LogExtra. They will be deduplicated
+  // automatically. The first `extra` of a message is not copied, it is
+  // written at the end of the message, so it must outlive the LogHelper
+  // (e.g. the LogExtra of the current Span).
   void ExtendLogExtra(const LogExtra& extra);
 
  private:
@@ -57,6 +59,10 @@ class TagWriter {
 
   explicit TagWriter(LogHelper& lh) noexcept;
 
+  // Writes `extra` and the not overridden tags of `inherited`, as if
+  // `inherited` was extended with `extra`
+  void PutLogExtra(const LogExtra& extra, const LogExtra& inherited);
+
   void PutKey(TagKey key);
   void PutKey(RuntimeTagKey key);
 
@@ -107,10 +107,17 @@ class RateLimitData {
   std::chrono::steady_clock::time_point last_reset_time{};
 };
 
+class StaticLogEntry;
+
 // Represents a single rate limit usage
 class RateLimiter {
  public:
-  RateLimiter(RateLimitData& data, Level level) noexcept;
+  // Messages filtered out by the logger level or by the dynamic debug state
+  // of the `entry` do not consume the rate limit budget
+  RateLimiter(const StaticLogEntry& entry, RateLimitData& data,
+              LoggerRef logger, Level level) noexcept;
+  RateLimiter(const StaticLogEntry& entry, RateLimitData& data,
+              const LoggerPtr& logger, Level level) noexcept;
   bool ShouldLog() const { return should_log_; }
   void SetShouldNotLog() { should_log_ = false; }
   Level GetLevel() const { return level_; }
@@ -134,10 +141,12 @@ class StaticLogEntry final {
   bool ShouldNotLog(const LoggerPtr& logger, Level level) const noexcept;
 
  private:
+  friend class RateLimiter;
+
   static constexpr std::size_t kContentSize =
-      compiler::SelectSize().For64Bit(40).For32Bit(24);
+      compiler::SelectSize().For64Bit(56).For32Bit(40);
 
-  alignas(void*) std::byte content_[kContentSize];
+  alignas(sizeof(std::uint64_t)) std::byte content_[kContentSize];
 };
 
 template <class NameHolder, int Line>
@@ -345,14 +354,16 @@ struct EntryStorage final {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define LOG_LIMITED_TO(logger, lvl)                                        \
   for (USERVER_NAMESPACE::logging::impl::RateLimiter log_limited_to_rl{    \
+           USERVER_IMPL_DYNAMIC_DEBUG_ENTRY(),                             \
            []() -> USERVER_NAMESPACE::logging::impl::RateLimitData& {      \
              thread_local USERVER_NAMESPACE::logging::impl::RateLimitData  \
                  rl_data;                                                  \
              return rl_data;                                               \
            }(),                                                            \
-           (lvl)};                                                         \
+           (logger), (lvl)};                                               \
        log_limited_to_rl.ShouldLog(); log_limited_to_rl.SetShouldNotLog()) \
-  LOG_TO((logger), log_limited_to_rl.GetLevel()) << log_limited_to_rl
+  USERVER_IMPL_LOG_TO((logger), log_limited_to_rl.GetLevel())              \
+      << log_limited_to_rl
 
 /// @brief If lvl matches the verbosity then builds a stream and evaluates a
 /// message for the default logger. Ignores log messages that occur too often.
@@ -3,7 +3,10 @@
 /// @file userver/utils/trivial_map.hpp
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -576,6 +579,351 @@ class CaseFirstIndexer final {
   std::size_t index_ = 0;
 };
 
+template <std::size_t Count>
+class CaseTypeCounter final {
+ public:
+  static constexpr std::size_t kCount = Count;
+
+  template <typename First, typename Second>
+  constexpr CaseTypeCounter<Count + 1> Case(First, Second) noexcept {
+    return {};
+  }
+
+  template <typename First>
+  constexpr CaseTypeCounter<Count + 1> Case(First) noexcept {
+    return {};
+  }
+
+  template <typename T, typename U = void>
+  constexpr CaseTypeCounter& Type() {
+    return *this;
+  }
+};
+
+struct CaseTypeCounterSelector final {
+  constexpr CaseTypeCounter<0> operator()() const noexcept { return {}; }
+};
+
+// Count of Case's known at compile time, without a BuilderFunc instance
+template <typename BuilderFunc>
+struct CasesCount final
+    : std::integral_constant<
+          std::size_t, std::invoke_result_t<const BuilderFunc&,
+                                            CaseTypeCounterSelector>::kCount> {
+};
+
+template <typename First, typename Second, std::size_t Size>
+class CaseCollector final {
+ public:
+  constexpr CaseCollector& Case(First first, Second second) noexcept {
+    UASSERT(size_ < Size);
+    firsts_[size_] = first;
+    seconds_[size_] = second;
+    ++size_;
+    return *this;
+  }
+
+  template <typename T, typename U>
+  constexpr CaseCollector& Type() {
+    return *this;
+  }
+
+  constexpr const std::array<First, Size>& GetFirsts() const noexcept {
+    return firsts_;
+  }
+
+  constexpr const std::array<Second, Size>& GetSeconds() const noexcept {
+    return seconds_;
+  }
+
+ private:
+  std::array<First, Size> firsts_{};
+  std::array<Second, Size> seconds_{};
+  std::size_t size_{0};
+};
+
+template <typename First, std::size_t Size>
+class CaseCollector<First, void, Size> final {
+ public:
+  constexpr CaseCollector& Case(First first) noexcept {
+    UASSERT(size_ < Size);
+    firsts_[size_] = first;
+    ++size_;
+    return *this;
+  }
+
+  template <typename T, typename U = void>
+  constexpr CaseCollector& Type() {
+    return *this;
+  }
+
+  constexpr const std::array<First, Size>& GetFirsts() const noexcept {
+    return firsts_;
+  }
+
+ private:
+  std::array<First, Size> firsts_{};
+  std::size_t size_{0};
+};
+
+// Maps with less string Case's are faster with a plain search, that compilers
+// turn into a switch by string length
+inline constexpr std::size_t kStringIndexMinSize = 64;
+
+template <typename BuilderFunc, typename Key>
+constexpr bool UseStringIndex() noexcept {
+  if constexpr (std::is_same_v<Key, std::string_view>) {
+    return CasesCount<BuilderFunc>::value >= kStringIndexMinSize;
+  } else {
+    return false;
+  }
+}
+
+// Returns false in constant evaluation or if the compiler is not able to tell
+// the constant evaluation apart
+constexpr bool IsRuntimeEvaluated() noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+  return !std::is_constant_evaluated();
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+  return !__builtin_is_constant_evaluated();
+#else
+  return false;
+#endif
+#else
+  return false;
+#endif
+}
+
+// Compilers turn that into a single unaligned load
+template <typename T, std::size_t... Indices>
+constexpr T LoadBytes(const char* data,
+                      std::index_sequence<Indices...>) noexcept {
+  return ((T{static_cast<unsigned char>(data[Indices])} << (8 * Indices)) |
+          ...);
+}
+
+template <typename T>
+constexpr T LoadBytes(const char* data) noexcept {
+  return LoadBytes<T>(data, std::make_index_sequence<sizeof(T)>{});
+}
+
+constexpr std::uint64_t HashString(std::string_view value) noexcept {
+  constexpr std::uint64_t kMultiplier = 0x9e3779b97f4a7c15ULL;
+  const char* data = value.data();
+  const auto size = value.size();
+
+  // Words that overlap at the tail, to read each byte without a byte loop
+  std::uint64_t hash = size * kMultiplier;
+  if (size >= 8) {
+    for (std::size_t pos = 0; pos + 8 < size; pos += 8) {
+      hash = (hash ^ LoadBytes<std::uint64_t>(data + pos)) * kMultiplier;
+    }
+    hash ^= LoadBytes<std::uint64_t>(data + size - 8);
+  } else if (size >= 4) {
+    hash ^= LoadBytes<std::uint32_t>(data) |
+            std::uint64_t{LoadBytes<std::uint32_t>(data + size - 4)} << 32;
+  } else if (size > 0) {
+    hash ^= static_cast<unsigned char>(data[0]) |
+            static_cast<unsigned char>(data[size / 2]) << 8 |
+            static_cast<unsigned char>(data[size - 1]) << 16;
+  }
+  hash *= kMultiplier;
+  return hash ^ (hash >> 32);
+}
+
+constexpr std::size_t Log2(std::size_t value) noexcept {
+  std::size_t result = 0;
+  while (value > 1) {
+    value /= 2;
+    ++result;
+  }
+  return result;
+}
+
+constexpr std::size_t RoundUpToPowerOfTwo(std::size_t value) noexcept {
+  std::size_t result = 1;
+  while (result < value) result *= 2;
+  return result;
+}
+
+// Perfect hash over a fixed set of strings ("hash and displace"): keys are
+// split into buckets by the high bits of the hash, each bucket gets a pilot
+// number, so that its keys land in the unoccupied slots. A lookup costs a
+// single hash computation and a single string comparison.
+template <std::size_t Size>
+class StringIndex final {
+ public:
+  constexpr explicit StringIndex(
+      const std::array<std::string_view, Size>& keys) noexcept
+      : keys_(keys) {
+    valid_ = Build();
+  }
+
+  // Returns the index of the first key equal to `key`
+  constexpr std::optional<std::size_t> Find(
+      std::string_view key) const noexcept {
+    if (!valid_) {
+      for (std::size_t i = 0; i < Size; ++i) {
+        if (keys_[i] == key) return i;
+      }
+      return std::nullopt;
+    }
+
+    const auto hash = HashString(key);
+    const auto slot = slots_[GetSlot(hash, pilots_[GetBucket(hash)])];
+    if (slot == kEmptySlot || keys_[slot] != key) return std::nullopt;
+    return slot;
+  }
+
+ private:
+  static_assert(Size < std::numeric_limits<std::uint32_t>::max());
+
+  static constexpr std::size_t kBucketsCount =
+      RoundUpToPowerOfTwo(Size / 2 + 1);
+  static constexpr std::size_t kSlotsCount = RoundUpToPowerOfTwo(Size * 2);
+  static constexpr std::size_t kSlotsBits = Log2(kSlotsCount);
+  static constexpr std::uint32_t kEmptySlot =
+      std::numeric_limits<std::uint32_t>::max();
+  static constexpr std::uint32_t kMaxPilot = 1 << 16;
+
+  static constexpr std::size_t GetBucket(std::uint64_t hash) noexcept {
+    return (hash >> 32) & (kBucketsCount - 1);
+  }
+
+  static constexpr std::size_t GetSlot(std::uint64_t hash,
+                                       std::uint32_t pilot) noexcept {
+    const auto pilot_hash = (hash ^ pilot) * 0x9e3779b97f4a7c15ULL;
+    return pilot_hash >> (64 - kSlotsBits);
+  }
+
+  constexpr bool Build() noexcept {
+    std::array<std::uint64_t, Size> hashes{};
+    std::array<std::size_t, kBucketsCount + 1> bucket_ends{};
+    for (std::size_t i = 0; i < Size; ++i) {
+      hashes[i] = HashString(keys_[i]);
+      ++bucket_ends[GetBucket(hashes[i]) + 1];
+    }
+    for (std::size_t i = 0; i < kBucketsCount; ++i) {
+      bucket_ends[i + 1] += bucket_ends[i];
+    }
+
+    // Keys grouped by buckets, keeping the first of the duplicate keys only
+    std::array<std::size_t, Size> keys_by_bucket{};
+    std::array<std::size_t, kBucketsCount> bucket_sizes{};
+    for (std::size_t i = 0; i < Size; ++i) {
+      const auto bucket = GetBucket(hashes[i]);
+      const auto begin = bucket_ends[bucket];
+      bool is_duplicate = false;
+      for (std::size_t j = 0; j < bucket_sizes[bucket]; ++j) {
+        is_duplicate = is_duplicate || keys_[keys_by_bucket[begin + j]] ==
+                                           keys_[i];
+      }
+      if (!is_duplicate) keys_by_bucket[begin + bucket_sizes[bucket]++] = i;
+    }
+
+    // The largest buckets are the hardest to place, they go first
+    std::array<std::size_t, kBucketsCount> buckets_order{};
+    for (std::size_t i = 0; i < kBucketsCount; ++i) {
+      std::size_t j = i;
+      while (j > 0 && bucket_sizes[buckets_order[j - 1]] < bucket_sizes[i]) {
+        buckets_order[j] = buckets_order[j - 1];
+        --j;
+      }
+      buckets_order[j] = i;
+    }
+
+    for (auto& slot : slots_) slot = kEmptySlot;
+    for (const auto bucket : buckets_order) {
+      if (bucket_sizes[bucket] == 0) break;
+      if (!PlaceBucket(hashes, &keys_by_bucket[bucket_ends[bucket]],
+                       bucket_sizes[bucket], pilots_[bucket])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  constexpr bool PlaceBucket(const std::array<std::uint64_t, Size>& hashes,
+                             const std::size_t* keys, std::size_t size,
+                             std::uint32_t& pilot) noexcept {
+    for (pilot = 0; pilot < kMaxPilot; ++pilot) {
+      std::size_t placed = 0;
+      while (placed < size) {
+        auto& slot = slots_[GetSlot(hashes[keys[placed]], pilot)];
+        if (slot != kEmptySlot) break;
+        slot = keys[placed];
+        ++placed;
+      }
+      if (placed == size) return true;
+
+      while (placed > 0) {
+        --placed;
+        slots_[GetSlot(hashes[keys[placed]], pilot)] = kEmptySlot;
+      }
+    }
+    return false;
+  }
+
+  std::array<std::string_view, Size> keys_;
+  std::array<std::uint32_t, kBucketsCount> pilots_{};
+  std::array<std::uint32_t, kSlotsCount> slots_{};
+  bool valid_{false};
+};
+
+template <typename Value, std::size_t Size>
+class StringMapIndex final {
+ public:
+  constexpr StringMapIndex(const std::array<std::string_view, Size>& keys,
+                           const std::array<Value, Size>& values) noexcept
+      : index_(keys), values_(values) {}
+
+  constexpr std::optional<Value> Find(std::string_view key) const noexcept {
+    const auto index = index_.Find(key);
+    if (!index) return std::nullopt;
+    return values_[*index];
+  }
+
+ private:
+  StringIndex<Size> index_;
+  std::array<Value, Size> values_;
+};
+
+template <bool kBySecond, typename First, typename Second,
+          typename BuilderFunc>
+auto MakeStringMapIndex(const BuilderFunc& func) noexcept {
+  constexpr auto kSize = CasesCount<BuilderFunc>::value;
+  const auto cases = func([] { return CaseCollector<First, Second, kSize>{}; });
+  if constexpr (kBySecond) {
+    return StringMapIndex<First, kSize>{cases.GetSeconds(), cases.GetFirsts()};
+  } else {
+    return StringMapIndex<Second, kSize>{cases.GetFirsts(), cases.GetSeconds()};
+  }
+}
+
+// The indexes are built on the first runtime lookup, not at compile time:
+// captureless lambdas are not default constructible before C++20, so there is
+// no BuilderFunc instance for a static initializer. Besides, the constexpr
+// evaluation of hundreds of Case's is not cheap.
+//
+// noinline keeps the lookups compact at the call sites.
+template <bool kBySecond, typename First, typename Second,
+          typename BuilderFunc>
+__attribute__((noinline)) auto FindInStringMapIndex(
+    const BuilderFunc& func, std::string_view key) noexcept {
+  static const auto index = MakeStringMapIndex<kBySecond, First, Second>(func);
+  return index.Find(key);
+}
+
+template <typename First, typename BuilderFunc>
+__attribute__((noinline)) std::optional<std::size_t> FindInStringSetIndex(
+    const BuilderFunc& func, std::string_view key) noexcept {
+  constexpr auto kSize = CasesCount<BuilderFunc>::value;
+  static const StringIndex<kSize> index{
+      func([] { return CaseCollector<First, void, kSize>{}; }).GetFirsts()};
+  return index.Find(key);
+}
+
 }  // namespace impl
 
 /// @ingroup userver_universal userver_containers
@@ -598,6 +946,10 @@ class CaseFirstIndexer final {
 /// The same story with integral or enum mappings - compiler optimizes them
 /// into a switch and it usually takes O(1) to find the match.
 ///
+/// Maps and sets with 64 or more string keys are searched at runtime through
+/// a perfect hash, that is built on the first lookup. Constexpr lookups and
+/// case insensitive lookups always use the linear search.
+///
 /// @snippet universal/src/utils/trivial_map_test.cpp  sample bidir bimap
 ///
 /// Empty map:
@@ -638,12 +990,22 @@ class TrivialBiMap final {
   }
 
   constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
+    if constexpr (impl::UseStringIndex<BuilderFunc, First>()) {
+      if (impl::IsRuntimeEvaluated()) {
+        return impl::FindInStringMapIndex<false, First, Second>(func_, value);
+      }
+    }
     return func_(
                [value]() { return impl::SwitchByFirst<First, Second>{value}; })
         .Extract();
   }
 
   constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
+    if constexpr (impl::UseStringIndex<BuilderFunc, Second>()) {
+      if (impl::IsRuntimeEvaluated()) {
+        return impl::FindInStringMapIndex<true, First, Second>(func_, value);
+      }
+    }
     return func_(
                [value]() { return impl::SwitchBySecond<First, Second>{value}; })
         .Extract();
@@ -826,6 +1188,11 @@ class TrivialSet final {
   }
 
   constexpr bool Contains(First value) const noexcept {
+    if constexpr (impl::UseStringIndex<BuilderFunc, First>()) {
+      if (impl::IsRuntimeEvaluated()) {
+        return impl::FindInStringSetIndex<First>(func_, value).has_value();
+      }
+    }
     return func_(
                [value]() { return impl::SwitchByFirst<First, Second>{value}; })
         .Extract();
@@ -855,6 +1222,11 @@ class TrivialSet final {
   /// Returns index of the value in Case parameters or std::nullopt if no such
   /// value.
   constexpr std::optional<std::size_t> GetIndex(First value) const {
+    if constexpr (impl::UseStringIndex<BuilderFunc, First>()) {
+      if (impl::IsRuntimeEvaluated()) {
+        return impl::FindInStringSetIndex<First>(func_, value);
+      }
+    }
     return func_([value]() { return impl::CaseFirstIndexer{value}; }).Extract();
   }
 
@@ -949,6 +1321,14 @@ struct TrivialSetMultiCaseDispatch {
   }
 };
 
+template <const auto& Keys, const auto& Values>
+struct CasesCount<TrivialBiMapMultiCaseDispatch<Keys, Values>> final
+    : std::integral_constant<std::size_t, std::size(Keys)> {};
+
+template <const auto& Values>
+struct CasesCount<TrivialSetMultiCaseDispatch<Values>> final
+    : std::integral_constant<std::size_t, std::size(Values)> {};
+
 }  // namespace impl
 
 /// @brief Zips two global `constexpr` arrays into an utils::TrivialBiMap.
@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -24,6 +25,10 @@ namespace yaml_config {
 using Exception = formats::yaml::Exception;
 using ParseException = formats::yaml::ParseException;
 
+namespace impl {
+struct MembersIndex;
+}  // namespace impl
+
 /// @ingroup userver_formats userver_universal
 ///
 /// @brief Datatype that represents YAML with substituted variables
@@ -198,10 +203,19 @@ class YamlConfig {
   const_iterator end() const;
 
  private:
+  YamlConfig(formats::yaml::Value yaml, formats::yaml::Value config_vars,
+             std::shared_ptr<const impl::MembersIndex> config_vars_index,
+             Mode mode);
+
   formats::yaml::Value yaml_;
   formats::yaml::Value config_vars_;
   Mode mode_{Mode::kSecure};
 
+  // The members of the yaml_ and config_vars_ maps by name, built once, so
+  // that the lookups, including the #env, #file and #fallback ones, are O(1)
+  std::shared_ptr<const impl::MembersIndex> index_;
+  std::shared_ptr<const impl::MembersIndex> config_vars_index_;
+
   friend bool Parse(const YamlConfig& value, formats::parse::To<bool>);
   friend int64_t Parse(const YamlConfig& value, formats::parse::To<int64_t>);
   friend uint64_t Parse(const YamlConfig& value, formats::parse::To<uint64_t>);
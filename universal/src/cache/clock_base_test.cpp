@@ -0,0 +1,79 @@
+#include <userver/cache/impl/clock.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(ClockBase, Sample) {
+  cache::impl::ClockBase<std::string, int> cache(2);
+  EXPECT_TRUE(cache.Put("a", 1));
+  EXPECT_TRUE(cache.Put("b", 2));
+  EXPECT_FALSE(cache.Put("a", 3));
+  EXPECT_EQ(cache.GetSize(), 2);
+
+  // "a" was used after the insertion and gets the second chance
+  EXPECT_TRUE(cache.Put("c", 4));
+  EXPECT_EQ(cache.GetSize(), 2);
+  ASSERT_TRUE(cache.Get("a"));
+  EXPECT_EQ(*cache.Get("a"), 3);
+  EXPECT_FALSE(cache.Get("b"));
+  ASSERT_TRUE(cache.Get("c"));
+  EXPECT_EQ(*cache.Get("c"), 4);
+}
+
+TEST(ClockBase, HotElementsSurvive) {
+  constexpr std::size_t kSize = 100;
+  cache::impl::ClockBase<std::size_t, std::size_t> cache(kSize);
+
+  for (std::size_t i = 0; i < 10 * kSize; ++i) {
+    for (std::size_t hot = 0; hot < kSize / 10; ++hot) {
+      if (!cache.Get(hot)) cache.Put(hot, hot);
+    }
+    cache.Put(kSize + i, i);
+  }
+
+  for (std::size_t hot = 0; hot < kSize / 10; ++hot) {
+    EXPECT_TRUE(cache.Get(hot)) << hot;
+  }
+  EXPECT_EQ(cache.GetSize(), kSize);
+}
+
+TEST(ClockBase, Erase) {
+  cache::impl::ClockBase<int, int> cache(3);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  cache.Put(3, 3);
+
+  cache.Erase(1);
+  cache.Erase(42);
+  EXPECT_EQ(cache.GetSize(), 2);
+  EXPECT_FALSE(cache.Get(1));
+
+  cache.Put(4, 4);
+  cache.Put(5, 5);
+  EXPECT_EQ(cache.GetSize(), 3);
+  EXPECT_TRUE(cache.Get(5));
+}
+
+TEST(ClockBase, SetMaxSize) {
+  cache::impl::ClockBase<int, int> cache(10);
+  for (int i = 0; i < 10; ++i) cache.Put(i, i);
+
+  cache.SetMaxSize(3);
+  EXPECT_EQ(cache.GetSize(), 3);
+
+  int sum = 0;
+  cache.VisitAll([&sum](int key, int value) {
+    EXPECT_EQ(key, value);
+    sum += value;
+  });
+  EXPECT_GT(sum, 0);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetSize(), 0);
+  EXPECT_TRUE(cache.Put(1, 1));
+}
+
+USERVER_NAMESPACE_END
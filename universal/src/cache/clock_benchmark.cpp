@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include <userver/cache/impl/clock.hpp>
+#include <userver/cache/impl/slru.hpp>
+#include <userver/cache/lru_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr unsigned kElementsCount = 1000;
+constexpr unsigned kProbationPart = 800;
+constexpr unsigned kProtectedPart = 200;
+
+template <typename Cache>
+Cache MakeCache();
+
+template <>
+cache::impl::ClockBase<unsigned, unsigned> MakeCache() {
+  return cache::impl::ClockBase<unsigned, unsigned>(kElementsCount);
+}
+
+template <>
+cache::LruMap<unsigned, unsigned> MakeCache() {
+  return cache::LruMap<unsigned, unsigned>(kElementsCount);
+}
+
+template <>
+cache::impl::SlruBase<unsigned, unsigned> MakeCache() {
+  return cache::impl::SlruBase<unsigned, unsigned>(kProbationPart,
+                                                   kProtectedPart);
+}
+
+template <typename Cache>
+Cache FillCache(unsigned elements_count) {
+  auto cache = MakeCache<Cache>();
+  for (unsigned i = 0; i < elements_count; ++i) {
+    cache.Put(i, i);
+  }
+  return cache;
+}
+
+}  // namespace
+
+template <typename Cache>
+void CacheGetHit(benchmark::State& state) {
+  auto cache = FillCache<Cache>(kElementsCount);
+  for ([[maybe_unused]] auto _ : state) {
+    for (unsigned i = 0; i < kElementsCount; ++i) {
+      benchmark::DoNotOptimize(cache.Get(i));
+    }
+  }
+}
+BENCHMARK_TEMPLATE(CacheGetHit, cache::impl::ClockBase<unsigned, unsigned>);
+BENCHMARK_TEMPLATE(CacheGetHit, cache::LruMap<unsigned, unsigned>);
+BENCHMARK_TEMPLATE(CacheGetHit, cache::impl::SlruBase<unsigned, unsigned>);
+
+template <typename Cache>
+void CachePutOverflow(benchmark::State& state) {
+  auto cache = FillCache<Cache>(kElementsCount);
+  unsigned i = kElementsCount;
+  for ([[maybe_unused]] auto _ : state) {
+    for (unsigned j = 0; j < kElementsCount; ++j) {
+      cache.Put(++i, 0);
+    }
+    benchmark::DoNotOptimize(cache);
+  }
+}
+BENCHMARK_TEMPLATE(CachePutOverflow,
+                   cache::impl::ClockBase<unsigned, unsigned>);
+BENCHMARK_TEMPLATE(CachePutOverflow, cache::LruMap<unsigned, unsigned>);
+BENCHMARK_TEMPLATE(CachePutOverflow,
+                   cache::impl::SlruBase<unsigned, unsigned>);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,161 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/cache/flat_hash_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Counts the memory allocated by std::unordered_map
+std::size_t allocated_bytes = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    allocated_bytes += n * sizeof(T);
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    allocated_bytes -= n * sizeof(T);
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+using Key = std::uint64_t;
+
+// A typical small cache value, e.g. a couple of ids
+struct Value {
+  std::uint64_t first;
+  std::uint32_t second;
+};
+
+using UnorderedMap =
+    std::unordered_map<Key, Value, std::hash<Key>, std::equal_to<Key>,
+                       CountingAllocator<std::pair<const Key, Value>>>;
+using FlatMap = cache::FlatHashMap<Key, Value>;
+
+// Sparse keys, like the ids of the rows of a database table
+Key MakeKey(std::size_t i) { return i * 7919 + 13; }
+
+template <typename Map>
+Map MakeMap(std::size_t size) {
+  Map map;
+  map.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    map.insert({MakeKey(i), Value{i, static_cast<std::uint32_t>(i)}});
+  }
+  return map;
+}
+
+std::vector<Key> MakeLookups(std::size_t size, bool hits) {
+  std::vector<Key> keys;
+  keys.reserve(size);
+  // pseudo-random order, so that the lookups do not hit the cache lines
+  // touched by the previous ones
+  for (std::size_t i = 0, j = 0; i < size; ++i, j = (j + 104729) % size) {
+    keys.push_back(hits ? MakeKey(j) : MakeKey(j) + 1);
+  }
+  return keys;
+}
+
+template <typename Map>
+void Lookup(benchmark::State& state, bool hits) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto map = MakeMap<Map>(size);
+  const auto keys = MakeLookups(size, hits);
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto key : keys) {
+      benchmark::DoNotOptimize(map.find(key) != map.end());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+template <typename Map>
+void Build(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(MakeMap<Map>(size));
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+}  // namespace
+
+void FlatHashMapLookupHit(benchmark::State& state) {
+  Lookup<FlatMap>(state, true);
+}
+BENCHMARK(FlatHashMapLookupHit)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void UnorderedMapLookupHit(benchmark::State& state) {
+  Lookup<UnorderedMap>(state, true);
+}
+BENCHMARK(UnorderedMapLookupHit)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void FlatHashMapLookupMiss(benchmark::State& state) {
+  Lookup<FlatMap>(state, false);
+}
+BENCHMARK(FlatHashMapLookupMiss)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void UnorderedMapLookupMiss(benchmark::State& state) {
+  Lookup<UnorderedMap>(state, false);
+}
+BENCHMARK(UnorderedMapLookupMiss)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 22);
+
+void FlatHashMapBuild(benchmark::State& state) { Build<FlatMap>(state); }
+BENCHMARK(FlatHashMapBuild)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void UnorderedMapBuild(benchmark::State& state) { Build<UnorderedMap>(state); }
+BENCHMARK(UnorderedMapBuild)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+// Not a timing benchmark: reports the memory per element of a cache snapshot
+void FlatHashMapMemory(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto map = MakeMap<FlatMap>(size);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.counters["bytes_per_element"] =
+      static_cast<double>(map.GetMemoryStatistics().allocated_bytes) / size;
+}
+BENCHMARK(FlatHashMapMemory)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void UnorderedMapMemory(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto bytes_before = allocated_bytes;
+  const auto map = MakeMap<UnorderedMap>(size);
+  const auto map_bytes = allocated_bytes - bytes_before;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.counters["bytes_per_element"] = static_cast<double>(map_bytes) / size;
+}
+BENCHMARK(UnorderedMapMemory)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,174 @@
+#include <userver/cache/flat_hash_map.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::FlatHashMap<int, std::string>;
+
+Map MakeMap(int count) {
+  Map map;
+  for (int i = 0; i < count; ++i) map.insert_or_assign(i, std::to_string(i));
+  return map;
+}
+
+// All the keys have the same 7 bits of the hash and the same probe sequence
+struct CollidingHash final {
+  std::size_t operator()(int) const noexcept { return 42; }
+};
+
+}  // namespace
+
+TEST(FlatHashMap, Sample) {
+  /// [Sample cache::FlatHashMap usage]
+  cache::FlatHashMap<std::string, int> map;
+  map.reserve(100);
+  EXPECT_EQ(map.capacity(), 128);
+
+  EXPECT_TRUE(map.insert_or_assign("one", 1));
+  map["two"] = 2;
+
+  EXPECT_EQ(map.at("one"), 1);
+  EXPECT_EQ(map.FindOrNullptr("three"), nullptr);
+
+  // The elements and the metadata are stored in a single allocation
+  EXPECT_GE(map.GetMemoryStatistics().allocated_bytes,
+            map.capacity() * (1 + sizeof(std::pair<const std::string, int>)));
+  /// [Sample cache::FlatHashMap usage]
+}
+
+TEST(FlatHashMap, Basic) {
+  Map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.capacity(), 0);
+  EXPECT_EQ(map.FindOrNullptr(1), nullptr);
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_THROW(map.at(1), std::out_of_range);
+  EXPECT_EQ(map.begin(), map.end());
+
+  EXPECT_TRUE(map.insert_or_assign(1, "1"));
+  EXPECT_FALSE(map.insert_or_assign(1, "one"));
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_EQ(map.count(1), 1);
+
+  map[2] += "two";
+  EXPECT_EQ(map.size(), 2);
+  ASSERT_NE(map.find(2), map.end());
+  EXPECT_EQ(map.find(2)->second, "two");
+
+  const auto [it, inserted] = map.try_emplace(2, "other");
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(it->second, "two");
+  EXPECT_TRUE(map.insert({3, "three"}).second);
+
+  EXPECT_EQ(map.erase(4), 0);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.size(), 2);
+
+  const auto capacity = map.capacity();
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.capacity(), capacity);
+}
+
+TEST(FlatHashMap, Growth) {
+  auto map = MakeMap(10'000);
+  EXPECT_EQ(map.size(), 10'000);
+  EXPECT_GE(map.capacity() - map.capacity() / 8, map.size());
+
+  for (int i = 0; i < 10'000; ++i) {
+    ASSERT_EQ(map.at(i), std::to_string(i));
+  }
+  EXPECT_FALSE(map.contains(10'000));
+}
+
+TEST(FlatHashMap, Iteration) {
+  const auto map = MakeMap(1000);
+
+  std::map<int, std::string> visited;
+  for (const auto& [key, value] : map) {
+    EXPECT_TRUE(visited.emplace(key, value).second);
+  }
+
+  ASSERT_EQ(visited.size(), 1000);
+  for (const auto& [key, value] : visited) {
+    EXPECT_EQ(value, std::to_string(key));
+  }
+
+  auto mutable_map = map;
+  for (auto& [key, value] : mutable_map) value += "!";
+  EXPECT_EQ(mutable_map.at(7), "7!");
+  EXPECT_EQ(map.at(7), "7");
+}
+
+TEST(FlatHashMap, CopyAndMove) {
+  auto map = MakeMap(100);
+
+  auto copy = map;
+  copy.erase(1);
+  EXPECT_EQ(map.size(), 100);
+  EXPECT_EQ(copy.size(), 99);
+
+  auto moved = std::move(map);
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_EQ(moved.at(1), "1");
+
+  copy = moved;
+  EXPECT_EQ(copy.size(), 100);
+  copy = Map{};
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(FlatHashMap, EraseAndReinsert) {
+  // Same-size rehashes drop the tombstones, so the capacity stays the same
+  Map map;
+  map.reserve(100);
+  const auto capacity = map.capacity();
+  for (int i = 0; i < 100'000; ++i) {
+    map.insert_or_assign(i, std::to_string(i));
+    if (i >= 50) {
+      EXPECT_EQ(map.erase(i - 50), 1);
+    }
+  }
+  EXPECT_EQ(map.size(), 50);
+  EXPECT_EQ(map.capacity(), capacity);
+  for (int i = 100'000 - 50; i < 100'000; ++i) {
+    EXPECT_EQ(map.at(i), std::to_string(i));
+  }
+}
+
+TEST(FlatHashMap, Collisions) {
+  cache::FlatHashMap<int, int, CollidingHash> map;
+  for (int i = 0; i < 100; ++i) map[i] = i;
+  for (int i = 0; i < 100; i += 2) EXPECT_EQ(map.erase(i), 1);
+
+  EXPECT_EQ(map.size(), 50);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(map.contains(i), i % 2 == 1);
+  }
+}
+
+TEST(FlatHashMap, NonTrivialValues) {
+  cache::FlatHashMap<std::string, std::shared_ptr<int>> map;
+  const auto value = std::make_shared<int>(42);
+  for (int i = 0; i < 1000; ++i) map.try_emplace(std::to_string(i), value);
+  EXPECT_EQ(value.use_count(), 1001);
+
+  map.erase("1");
+  EXPECT_EQ(value.use_count(), 1000);
+  map.clear();
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+USERVER_NAMESPACE_END
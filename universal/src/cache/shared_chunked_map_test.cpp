@@ -0,0 +1,124 @@
+#include <userver/cache/shared_chunked_map.hpp>
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::SharedChunkedMap<int, std::string>;
+
+Map MakeMap(int count, std::size_t chunks = Map::kDefaultChunksCount) {
+  Map map{chunks};
+  for (int i = 0; i < count; ++i) map.insert_or_assign(i, std::to_string(i));
+  return map;
+}
+
+}  // namespace
+
+TEST(SharedChunkedMap, Sample) {
+  /// [Sample cache::SharedChunkedMap usage]
+  cache::SharedChunkedMap<int, std::string> previous{/*chunks_count=*/4};
+  for (int i = 0; i < 100; ++i) previous.insert_or_assign(i, "old");
+
+  // Copies just the pointers to the chunks
+  auto next = previous;
+  EXPECT_EQ(next.GetSharingStatistics().shared_chunks, 4);
+
+  // Clones only the chunk of the key 42
+  next.insert_or_assign(42, "new");
+  EXPECT_EQ(next.GetSharingStatistics().shared_chunks, 3);
+
+  EXPECT_EQ(next.at(42), "new");
+  EXPECT_EQ(previous.at(42), "old");
+  /// [Sample cache::SharedChunkedMap usage]
+}
+
+TEST(SharedChunkedMap, Basic) {
+  Map map{8};
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.FindOrNullptr(1), nullptr);
+  EXPECT_THROW(map.at(1), std::out_of_range);
+
+  EXPECT_TRUE(map.insert_or_assign(1, "1"));
+  EXPECT_FALSE(map.insert_or_assign(1, "one"));
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_TRUE(map.contains(1));
+
+  map[2] += "two";
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(2), "two");
+  ASSERT_NE(map.find(2), map.end());
+  EXPECT_EQ(map.find(2)->second, "two");
+  EXPECT_EQ(map.find(3), map.end());
+
+  EXPECT_EQ(map.erase(3), 0);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.size(), 1);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.GetSharingStatistics().chunks, 8);
+}
+
+TEST(SharedChunkedMap, Iteration) {
+  const auto map = MakeMap(1000, 16);
+
+  std::map<int, std::string> visited;
+  for (const auto& [key, value] : map) {
+    EXPECT_TRUE(visited.emplace(key, value).second);
+  }
+
+  ASSERT_EQ(visited.size(), 1000);
+  for (const auto& [key, value] : visited) {
+    EXPECT_EQ(value, std::to_string(key));
+  }
+}
+
+TEST(SharedChunkedMap, CopyOnWrite) {
+  const auto original = MakeMap(1000, 16);
+  EXPECT_EQ(original.GetSharingStatistics().shared_chunks, 0);
+
+  auto copy = original;
+  EXPECT_EQ(copy.GetSharingStatistics().shared_chunks, 16);
+
+  copy.insert_or_assign(1, "changed");
+  copy.erase(2);
+  copy[1000] = "1000";
+  EXPECT_GE(copy.GetSharingStatistics().shared_chunks, 13);
+
+  EXPECT_EQ(original.size(), 1000);
+  EXPECT_EQ(original.at(1), "1");
+  EXPECT_EQ(original.at(2), "2");
+  EXPECT_FALSE(original.contains(1000));
+
+  EXPECT_EQ(copy.size(), 1000);
+  EXPECT_EQ(copy.at(1), "changed");
+  EXPECT_FALSE(copy.contains(2));
+  EXPECT_EQ(copy.at(1000), "1000");
+}
+
+TEST(SharedChunkedMap, EraseMissingDoesNotClone) {
+  const auto original = MakeMap(100, 4);
+  auto copy = original;
+
+  EXPECT_EQ(copy.erase(1000), 0);
+  EXPECT_EQ(copy.GetSharingStatistics().shared_chunks, 4);
+}
+
+TEST(SharedChunkedMap, UniqueChunksAreNotCloned) {
+  auto map = MakeMap(100, 4);
+  const auto* value = map.FindOrNullptr(1);
+  ASSERT_NE(value, nullptr);
+
+  map.insert_or_assign(2, "2");
+  EXPECT_EQ(map.FindOrNullptr(1), value);
+}
+
+USERVER_NAMESPACE_END
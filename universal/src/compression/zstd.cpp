@@ -1,8 +1,16 @@
 #include <userver/compression/zstd.hpp>
 
+#include <zdict.h>
 #include <zstd.h>
 #include <zstd_errors.h>
 
+#include <memory>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/compiler/thread_local.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
@@ -10,61 +18,71 @@ namespace compression::zstd {
 namespace {
 // The same size as in ZSTD_DStreamOutSize();
 const size_t kDecompressBufferSize = ZSTD_DStreamOutSize();
-}  // namespace
 
-std::string DecompressStream(std::string_view compressed, size_t max_size) {
-  std::string decompressed;
-  std::string buf(kDecompressBufferSize, '\0');
+struct CCtxDeleter final {
+  void operator()(ZSTD_CCtx* ptr) const noexcept { ZSTD_freeCCtx(ptr); }
+};
+using CCtxPtr = std::unique_ptr<ZSTD_CCtx, CCtxDeleter>;
 
-  auto* stream = ZSTD_createDStream();
-  if (stream == nullptr) {
-    throw std::runtime_error("Couldn't create ZSTD decompression stream");
-  }
-  auto stream_del = [](ZSTD_DStream* ptr) { ZSTD_freeDStream(ptr); };
-  auto stream_guard =
-      std::unique_ptr<ZSTD_DStream, decltype(stream_del)>(stream, stream_del);
+struct DCtxDeleter final {
+  void operator()(ZSTD_DCtx* ptr) const noexcept { ZSTD_freeDCtx(ptr); }
+};
+using DCtxPtr = std::unique_ptr<ZSTD_DCtx, DCtxDeleter>;
 
-  {
-    const auto err_code = ZSTD_DCtx_reset(
-        stream, ZSTD_ResetDirective::ZSTD_reset_session_and_parameters);
-    if (ZSTD_isError(err_code)) {
-      throw ErrWithCode(ZSTD_getErrorName(err_code));
-    }
-  }
+struct CDictDeleter final {
+  void operator()(ZSTD_CDict* ptr) const noexcept { ZSTD_freeCDict(ptr); }
+};
 
-  for (size_t cur_pos(0); cur_pos < compressed.size();) {
-    ZSTD_inBuffer input{
-        compressed.data() + cur_pos,
-        std::min(kDecompressBufferSize, compressed.size() - cur_pos), 0};
+struct DDictDeleter final {
+  void operator()(ZSTD_DDict* ptr) const noexcept { ZSTD_freeDDict(ptr); }
+};
 
-    while (input.pos < input.size) {
-      ZSTD_outBuffer output{buf.data(), buf.size(), 0};
+// One-shot calls reset the contexts, reusing them saves the allocation and
+// the initialization of the context for each of the small payloads
+compiler::ThreadLocal local_compression_context = [] {
+  return CCtxPtr{ZSTD_createCCtx()};
+};
 
-      if (const auto ret = ZSTD_decompressStream(stream, &output, &input);
-          ZSTD_isError(ret)) {
-        throw ErrWithCode(ZSTD_getErrorName(ret));
-      }
+compiler::ThreadLocal local_decompression_context = [] {
+  return DCtxPtr{ZSTD_createDCtx()};
+};
 
-      decompressed.append(static_cast<char*>(output.dst), output.pos);
-    }
+[[noreturn]] void ThrowCompressionError(std::size_t code) {
+  throw std::runtime_error(std::string{"Compression failed: "} +
+                           ZSTD_getErrorName(code));
+}
 
-    if (decompressed.size() > max_size) {
-      throw TooBigError();
-    }
+// Compresses with the dictionary if `cdict` is set, at the `level` otherwise
+std::string CompressFrame(std::string_view data, const ZSTD_CDict* cdict,
+                          int level) {
+  std::string compressed(ZSTD_compressBound(data.size()), '\0');
 
-    cur_pos += input.size;
+  auto context = local_compression_context.Use();
+  if (!*context) {
+    throw std::runtime_error("Couldn't create ZSTD compression context");
   }
+  const auto compressed_size =
+      cdict ? ZSTD_compress_usingCDict(context->get(), compressed.data(),
+                                       compressed.size(), data.data(),
+                                       data.size(), cdict)
+            : ZSTD_compressCCtx(context->get(), compressed.data(),
+                                compressed.size(), data.data(), data.size(),
+                                level);
+  if (ZSTD_isError(compressed_size)) ThrowCompressionError(compressed_size);
 
-  return decompressed;
+  compressed.resize(compressed_size);
+  return compressed;
 }
 
-std::string Decompress(std::string_view compressed, size_t max_size) {
+// Returns ZSTD_CONTENTSIZE_UNKNOWN if the size is not written into the frame
+unsigned long long GetFrameContentSize(std::string_view compressed,
+                                       size_t max_size) {
   const auto decompressed_size =
       ZSTD_getFrameContentSize(compressed.data(), compressed.size());
 
   switch (decompressed_size) {
     case ZSTD_CONTENTSIZE_UNKNOWN:
-      return DecompressStream(compressed, max_size);
+      return decompressed_size;
     case ZSTD_CONTENTSIZE_ERROR:
       throw std::runtime_error("Error while getting size");
     default:
@@ -72,17 +90,311 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
         throw TooBigError();
       }
   }
+  return decompressed_size;
+}
 
+// Decompresses with the dictionary if `ddict` is set
+std::string DecompressFrame(std::string_view compressed,
+                            std::size_t decompressed_size,
+                            const ZSTD_DDict* ddict) {
   std::string decompressed(decompressed_size, '\0');
-  if (const auto ret =
-          ZSTD_decompress(decompressed.data(), decompressed.capacity(),
-                          compressed.data(), compressed.size());
-      ZSTD_isError(ret)) {
+
+  auto context = local_decompression_context.Use();
+  if (!*context) {
+    throw std::runtime_error("Couldn't create ZSTD decompression context");
+  }
+  const auto ret =
+      ddict ? ZSTD_decompress_usingDDict(
+                  context->get(), decompressed.data(), decompressed.size(),
+                  compressed.data(), compressed.size(), ddict)
+            : ZSTD_decompressDCtx(context->get(), decompressed.data(),
+                                  decompressed.size(), compressed.data(),
+                                  compressed.size());
+  if (ZSTD_isError(ret)) {
     throw ErrWithCode(ZSTD_getErrorName(ret));
   }
 
   return decompressed;
 }
 
+}  // namespace
+
+std::string DecompressStream(std::string_view compressed, size_t max_size) {
+  std::string decompressed;
+  StreamDecompressor decompressor{max_size};
+  decompressor.Decompress(compressed, decompressed);
+  return decompressed;
+}
+
+std::string Compress(std::string_view data, int level) {
+  return CompressFrame(data, nullptr, level);
+}
+
+std::string Decompress(std::string_view compressed, size_t max_size) {
+  const auto decompressed_size = GetFrameContentSize(compressed, max_size);
+  if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+    return DecompressStream(compressed, max_size);
+  }
+  return DecompressFrame(compressed, decompressed_size, nullptr);
+}
+
+std::string TrainDictionary(const std::vector<std::string>& samples,
+                            std::size_t max_size) {
+  std::string samples_buffer;
+  std::vector<std::size_t> sample_sizes;
+  sample_sizes.reserve(samples.size());
+  for (const auto& sample : samples) {
+    samples_buffer += sample;
+    sample_sizes.push_back(sample.size());
+  }
+
+  std::string dictionary(max_size, '\0');
+  const auto dictionary_size = ZDICT_trainFromBuffer(
+      dictionary.data(), dictionary.size(), samples_buffer.data(),
+      sample_sizes.data(), static_cast<unsigned>(sample_sizes.size()));
+  if (ZDICT_isError(dictionary_size)) {
+    throw std::runtime_error(std::string{"Dictionary training failed: "} +
+                             ZDICT_getErrorName(dictionary_size));
+  }
+
+  dictionary.resize(dictionary_size);
+  return dictionary;
+}
+
+struct Dictionary::Impl final {
+  std::unique_ptr<ZSTD_CDict, CDictDeleter> cdict;
+  std::unique_ptr<ZSTD_DDict, DDictDeleter> ddict;
+  std::uint32_t id{0};
+};
+
+Dictionary::Dictionary(std::string_view content, int level)
+    : impl_(std::make_unique<Impl>()) {
+  impl_->cdict.reset(ZSTD_createCDict(content.data(), content.size(), level));
+  impl_->ddict.reset(ZSTD_createDDict(content.data(), content.size()));
+  if (!impl_->cdict || !impl_->ddict) {
+    throw std::runtime_error("Couldn't load ZSTD dictionary");
+  }
+  impl_->id = ZSTD_getDictID_fromDict(content.data(), content.size());
+}
+
+Dictionary::Dictionary(Dictionary&&) noexcept = default;
+
+Dictionary& Dictionary::operator=(Dictionary&&) noexcept = default;
+
+Dictionary::~Dictionary() = default;
+
+std::uint32_t Dictionary::GetId() const noexcept { return impl_->id; }
+
+std::string Dictionary::Compress(std::string_view data) const {
+  return CompressFrame(data, impl_->cdict.get(), kDefaultCompressionLevel);
+}
+
+std::string Dictionary::Decompress(std::string_view compressed,
+                                   size_t max_size) const {
+  const auto decompressed_size = GetFrameContentSize(compressed, max_size);
+  if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+    std::string decompressed;
+    StreamDecompressor decompressor{max_size, *this};
+    decompressor.Decompress(compressed, decompressed);
+    return decompressed;
+  }
+  return DecompressFrame(compressed, decompressed_size, impl_->ddict.get());
+}
+
+void DictionaryRegistry::Add(std::shared_ptr<const Dictionary> dictionary) {
+  const auto id = dictionary->GetId();
+  // The frames compressed with a raw content dictionary do not refer to it
+  if (id == 0) {
+    throw std::invalid_argument(
+        "ZSTD dictionary without an ID can not be registered");
+  }
+  if (!dictionaries_.emplace(id, dictionary).second) {
+    throw std::invalid_argument(
+        fmt::format("ZSTD dictionary {} is already registered", id));
+  }
+  current_ = std::move(dictionary);
+}
+
+std::shared_ptr<const Dictionary> DictionaryRegistry::Find(
+    std::uint32_t id) const {
+  const auto it = dictionaries_.find(id);
+  return it == dictionaries_.end() ? nullptr : it->second;
+}
+
+std::shared_ptr<const Dictionary> DictionaryRegistry::GetCurrent() const {
+  return current_;
+}
+
+std::string DictionaryRegistry::Compress(std::string_view data) const {
+  if (!current_) return zstd::Compress(data);
+  return current_->Compress(data);
+}
+
+std::string DictionaryRegistry::Decompress(std::string_view compressed,
+                                           size_t max_size) const {
+  const auto id =
+      ZSTD_getDictID_fromFrame(compressed.data(), compressed.size());
+  if (id == 0) return zstd::Decompress(compressed, max_size);
+
+  const auto dictionary = Find(id);
+  if (!dictionary) {
+    throw DecompressionError(
+        fmt::format("Decompression failed: unknown zstd dictionary {}", id));
+  }
+  return dictionary->Decompress(compressed, max_size);
+}
+
+struct StreamCompressor::Impl final {
+  CCtxPtr stream;
+  std::size_t frame_input_size{0};
+
+  void Process(std::string_view data, ZSTD_EndDirective directive,
+               std::string& out) {
+    ZSTD_inBuffer input{data.data(), data.size(), 0};
+    while (true) {
+      const auto old_size = out.size();
+      out.resize(old_size + ZSTD_CStreamOutSize());
+      ZSTD_outBuffer output{out.data() + old_size, out.size() - old_size, 0};
+
+      const auto remaining =
+          ZSTD_compressStream2(stream.get(), &output, &input, directive);
+      out.resize(old_size + output.pos);
+      if (ZSTD_isError(remaining)) ThrowCompressionError(remaining);
+
+      // ZSTD_e_continue may leave the data in the internal buffers, other
+      // directives are done when nothing remains to be written.
+      const bool done = directive == ZSTD_e_continue
+                            ? input.pos == input.size
+                            : remaining == 0;
+      if (done) break;
+    }
+  }
+};
+
+StreamCompressor::StreamCompressor(int level)
+    : impl_(std::make_unique<Impl>()) {
+  impl_->stream.reset(ZSTD_createCCtx());
+  if (!impl_->stream) {
+    throw std::runtime_error("Couldn't create ZSTD compression stream");
+  }
+
+  const auto err_code = ZSTD_CCtx_setParameter(
+      impl_->stream.get(), ZSTD_c_compressionLevel, level);
+  if (ZSTD_isError(err_code)) ThrowCompressionError(err_code);
+}
+
+StreamCompressor::StreamCompressor(const Dictionary& dictionary)
+    : StreamCompressor() {
+  const auto err_code = ZSTD_CCtx_refCDict(impl_->stream.get(),
+                                           dictionary.impl_->cdict.get());
+  if (ZSTD_isError(err_code)) ThrowCompressionError(err_code);
+}
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&&) noexcept =
+    default;
+
+StreamCompressor::~StreamCompressor() = default;
+
+void StreamCompressor::Compress(std::string_view data, std::string& out) {
+  impl_->Process(data, ZSTD_e_continue, out);
+  impl_->frame_input_size += data.size();
+}
+
+void StreamCompressor::Flush(std::string& out) {
+  impl_->Process({}, ZSTD_e_flush, out);
+}
+
+void StreamCompressor::EndFrame(std::string& out) {
+  if (impl_->frame_input_size == 0) return;
+
+  impl_->Process({}, ZSTD_e_end, out);
+  impl_->frame_input_size = 0;
+}
+
+std::size_t StreamCompressor::GetFrameInputSize() const noexcept {
+  return impl_->frame_input_size;
+}
+
+struct StreamDecompressor::Impl final {
+  DCtxPtr stream;
+  std::size_t max_size;
+  std::size_t decompressed_size{0};
+  bool is_frame_complete{true};
+};
+
+StreamDecompressor::StreamDecompressor(std::size_t max_size)
+    : impl_(std::make_unique<Impl>()) {
+  impl_->stream.reset(ZSTD_createDCtx());
+  if (!impl_->stream) {
+    throw std::runtime_error("Couldn't create ZSTD decompression stream");
+  }
+  impl_->max_size = max_size;
+}
+
+StreamDecompressor::StreamDecompressor(std::size_t max_size,
+                                       const Dictionary& dictionary)
+    : StreamDecompressor(max_size) {
+  const auto err_code = ZSTD_DCtx_refDDict(impl_->stream.get(),
+                                           dictionary.impl_->ddict.get());
+  if (ZSTD_isError(err_code)) {
+    throw std::runtime_error(std::string{"Decompression failed: "} +
+                             ZSTD_getErrorName(err_code));
+  }
+}
+
+StreamDecompressor::StreamDecompressor(StreamDecompressor&&) noexcept =
+    default;
+
+StreamDecompressor& StreamDecompressor::operator=(
+    StreamDecompressor&&) noexcept = default;
+
+StreamDecompressor::~StreamDecompressor() = default;
+
+void StreamDecompressor::Decompress(std::string_view data, std::string& out) {
+  if (data.empty()) return;
+
+  auto& impl = *impl_;
+  ZSTD_inBuffer input{data.data(), data.size(), 0};
+  while (true) {
+    // At most one byte over the limit is ever written, which is enough to
+    // detect the overflow without allocating the whole output of a bomb.
+    const auto remaining = impl.max_size - impl.decompressed_size;
+    const auto chunk_size =
+        remaining < kDecompressBufferSize ? remaining + 1
+                                          : kDecompressBufferSize;
+
+    const auto old_size = out.size();
+    out.resize(old_size + chunk_size);
+    ZSTD_outBuffer output{out.data() + old_size, chunk_size, 0};
+
+    const auto ret = ZSTD_decompressStream(impl.stream.get(), &output, &input);
+    out.resize(old_size + output.pos);
+    if (ZSTD_isError(ret)) {
+      throw ErrWithCode(ZSTD_getErrorName(ret));
+    }
+
+    impl.decompressed_size += output.pos;
+    if (impl.decompressed_size > impl.max_size) {
+      throw TooBigError();
+    }
+    impl.is_frame_complete = ret == 0;
+
+    // The decoder has flushed everything it could if the output has room left
+    if (input.pos == input.size && output.pos < output.size) break;
+  }
+}
+
+void StreamDecompressor::Finish() const {
+  if (!impl_->is_frame_complete) {
+    throw DecompressionError("Decompression failed: truncated zstd frame");
+  }
+}
+
+std::size_t StreamDecompressor::GetDecompressedSize() const noexcept {
+  return impl_->decompressed_size;
+}
+
 }  // namespace compression::zstd
 USERVER_NAMESPACE_END
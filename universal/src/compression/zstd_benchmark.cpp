@@ -2,6 +2,8 @@
 
 #include <chrono>
 #include <random>
+#include <string>
+#include <vector>
 
 #include <zstd.h>
 #include <userver/compression/zstd.hpp>
@@ -47,4 +49,38 @@ static void ZstdDecompress(benchmark::State& state) {
 }
 BENCHMARK(ZstdDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
 
+std::vector<std::string> GenerateRecords(std::size_t count) {
+  std::vector<std::string> records;
+  records.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    records.push_back(R"({"id":")" + GenerateRandomData(16) +
+                      R"(","status":"active","zone":")" +
+                      GenerateRandomData(4) + R"(","version":)" +
+                      std::to_string(i) + "}");
+  }
+  return records;
+}
+
+static void ZstdCompressSmall(benchmark::State& state) {
+  const auto records = GenerateRecords(1000);
+  const auto use_dictionary = state.range(0) != 0;
+  const compression::zstd::Dictionary dictionary{
+      compression::zstd::TrainDictionary(GenerateRecords(1000), 4096)};
+
+  std::size_t input_size = 0;
+  std::size_t output_size = 0;
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    const auto& record = records[i++ % records.size()];
+    const auto compressed = use_dictionary
+                                ? dictionary.Compress(record)
+                                : compression::zstd::Compress(record);
+    input_size += record.size();
+    output_size += compressed.size();
+  }
+  state.counters["ratio"] =
+      static_cast<double>(input_size) / static_cast<double>(output_size);
+}
+BENCHMARK(ZstdCompressSmall)->Arg(0)->Arg(1);
+
 USERVER_NAMESPACE_END
@@ -65,4 +65,205 @@ TEST(Zstd, TestOverflow) {
       compression::TooBigError);
 }
 
+TEST(Zstd, CompressRoundTrip) {
+  constexpr std::size_t kSize = 100'000;
+  std::string str;
+  for (std::size_t i = 0; str.size() < kSize; ++i) str += std::to_string(i);
+
+  const auto compressed = compression::zstd::Compress(str);
+  EXPECT_LT(compressed.size(), str.size());
+  EXPECT_EQ(ZSTD_getFrameContentSize(compressed.data(), compressed.size()),
+            str.size());
+
+  EXPECT_EQ(compression::zstd::Decompress(compressed, str.size()), str);
+  EXPECT_EQ(compression::zstd::Decompress(compression::zstd::Compress({}), 0),
+            "");
+}
+
+TEST(Zstd, StreamCompressor) {
+  compression::zstd::StreamCompressor compressor;
+  std::string compressed;
+  std::string expected;
+
+  compressor.EndFrame(compressed);
+  EXPECT_TRUE(compressed.empty());
+
+  for (int i = 0; i < 1000; ++i) {
+    const auto line = "message " + std::to_string(i) + '\n';
+    compressor.Compress(line, compressed);
+    expected += line;
+  }
+  EXPECT_EQ(compressor.GetFrameInputSize(), expected.size());
+
+  // Flushed data is readable before the end of the frame
+  compressor.Flush(compressed);
+  EXPECT_LT(compressed.size(), expected.size());
+  EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()),
+            expected);
+
+  compressor.EndFrame(compressed);
+  EXPECT_EQ(compressor.GetFrameInputSize(), 0);
+
+  compressor.Compress("next frame\n", compressed);
+  compressor.EndFrame(compressed);
+  expected += "next frame\n";
+  EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()),
+            expected);
+}
+
+TEST(Zstd, StreamDecompressor) {
+  compression::zstd::StreamCompressor compressor;
+  std::string compressed;
+  std::string expected;
+  for (int i = 0; i < 10'000; ++i) {
+    const auto line = "message " + std::to_string(i) + '\n';
+    compressor.Compress(line, compressed);
+    expected += line;
+  }
+  compressor.EndFrame(compressed);
+
+  compression::zstd::StreamDecompressor decompressor{expected.size()};
+  std::string decompressed;
+  for (std::size_t pos = 0; pos < compressed.size(); pos += 100) {
+    decompressor.Decompress(std::string_view{compressed}.substr(pos, 100),
+                            decompressed);
+  }
+  EXPECT_NO_THROW(decompressor.Finish());
+  EXPECT_EQ(decompressor.GetDecompressedSize(), expected.size());
+  EXPECT_EQ(decompressed, expected);
+
+  compression::zstd::StreamDecompressor truncated{expected.size()};
+  decompressed.clear();
+  truncated.Decompress(
+      std::string_view{compressed}.substr(0, compressed.size() / 2),
+      decompressed);
+  EXPECT_THROW(truncated.Finish(), compression::DecompressionError);
+}
+
+TEST(Zstd, StreamDecompressorBomb) {
+  // Frame without the content size, so that the size is not known in advance
+  compression::zstd::StreamCompressor compressor;
+  std::string compressed;
+  const std::string zeros(1 << 20, '\0');
+  for (int i = 0; i < 64; ++i) compressor.Compress(zeros, compressed);
+  compressor.EndFrame(compressed);
+  ASSERT_LT(compressed.size(), 64 * 1024);
+
+  constexpr std::size_t kMaxSize = 1000;
+  compression::zstd::StreamDecompressor decompressor{kMaxSize};
+  std::string decompressed;
+  EXPECT_THROW(decompressor.Decompress(compressed, decompressed),
+               compression::TooBigError);
+  EXPECT_LE(decompressed.size(), kMaxSize + 1);
+
+  EXPECT_THROW(compression::zstd::Decompress(compressed, kMaxSize),
+               compression::TooBigError);
+}
+
+namespace {
+
+std::vector<std::string> MakeRecords(std::size_t count, std::size_t seed) {
+  std::vector<std::string> records;
+  records.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto id = std::to_string(seed * 1'000'000 + i * 7919 % 100'003);
+    records.push_back(R"({"id":")" + id + R"(","status":")" +
+                      (i % 3 == 0 ? "active" : "disabled") +
+                      R"(","tariff_zone":"moscow","updated":"2023-04-0)" +
+                      std::to_string(i % 10) + R"(T12:00:00Z"})");
+  }
+  return records;
+}
+
+}  // namespace
+
+TEST(Zstd, Dictionary) {
+  const auto dictionary_content =
+      compression::zstd::TrainDictionary(MakeRecords(1000, 1), 4096);
+  EXPECT_LE(dictionary_content.size(), 4096);
+  const compression::zstd::Dictionary dictionary{dictionary_content};
+  EXPECT_NE(dictionary.GetId(), 0);
+
+  std::size_t size = 0;
+  std::size_t plain_size = 0;
+  std::size_t dictionary_size = 0;
+  for (const auto& record : MakeRecords(100, 2)) {
+    const auto compressed = dictionary.Compress(record);
+    EXPECT_EQ(dictionary.Decompress(compressed, record.size()), record);
+    size += record.size();
+    plain_size += compression::zstd::Compress(record).size();
+    dictionary_size += compressed.size();
+  }
+  EXPECT_LT(dictionary_size * 2, plain_size);
+  EXPECT_LT(dictionary_size * 2, size);
+
+  EXPECT_THROW(compression::zstd::Decompress(dictionary.Compress("abc"), 3),
+               compression::DecompressionError);
+  EXPECT_THROW(compression::zstd::TrainDictionary({"abc", "def"}),
+               std::runtime_error);
+}
+
+TEST(Zstd, DictionaryRegistry) {
+  auto old_dictionary = std::make_shared<compression::zstd::Dictionary>(
+      compression::zstd::TrainDictionary(MakeRecords(1000, 1), 4096));
+  auto new_dictionary = std::make_shared<compression::zstd::Dictionary>(
+      compression::zstd::TrainDictionary(MakeRecords(1000, 2), 2048));
+  ASSERT_NE(old_dictionary->GetId(), new_dictionary->GetId());
+
+  compression::zstd::DictionaryRegistry registry;
+  const auto record = MakeRecords(1, 3).front();
+  const auto plain = registry.Compress(record);
+  EXPECT_EQ(registry.GetCurrent(), nullptr);
+
+  registry.Add(old_dictionary);
+  const auto old_compressed = registry.Compress(record);
+  registry.Add(new_dictionary);
+  EXPECT_THROW(registry.Add(old_dictionary), std::invalid_argument);
+  EXPECT_EQ(registry.GetCurrent(), new_dictionary);
+  EXPECT_EQ(registry.Find(old_dictionary->GetId()), old_dictionary);
+  EXPECT_EQ(registry.Find(0), nullptr);
+
+  EXPECT_EQ(registry.Compress(record), new_dictionary->Compress(record));
+  EXPECT_EQ(registry.Decompress(plain, record.size()), record);
+  EXPECT_EQ(registry.Decompress(old_compressed, record.size()), record);
+  EXPECT_EQ(registry.Decompress(registry.Compress(record), record.size()),
+            record);
+
+  compression::zstd::DictionaryRegistry other_registry;
+  EXPECT_THROW(other_registry.Decompress(old_compressed, record.size()),
+               compression::DecompressionError);
+  auto raw_dictionary = std::make_shared<compression::zstd::Dictionary>(
+      "raw content without a header");
+  EXPECT_THROW(other_registry.Add(raw_dictionary), std::invalid_argument);
+}
+
+TEST(Zstd, StreamDictionary) {
+  const compression::zstd::Dictionary dictionary{
+      compression::zstd::TrainDictionary(MakeRecords(1000, 1), 4096)};
+
+  compression::zstd::StreamCompressor compressor{dictionary};
+  std::string compressed;
+  std::string expected;
+  for (const auto& record : MakeRecords(10, 2)) {
+    compressor.Compress(record, compressed);
+    compressor.EndFrame(compressed);
+    expected += record;
+  }
+
+  compression::zstd::StreamDecompressor decompressor{expected.size(),
+                                                     dictionary};
+  std::string decompressed;
+  decompressor.Decompress(compressed, decompressed);
+  EXPECT_NO_THROW(decompressor.Finish());
+  EXPECT_EQ(decompressed, expected);
+
+  // Frames without the content size fall back to the streaming decoder
+  EXPECT_EQ(dictionary.Decompress(compressed, expected.size()), expected);
+
+  compression::zstd::StreamDecompressor no_dictionary{expected.size()};
+  decompressed.clear();
+  EXPECT_THROW(no_dictionary.Decompress(compressed, decompressed),
+               compression::DecompressionError);
+}
+
 USERVER_NAMESPACE_END
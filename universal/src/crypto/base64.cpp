@@ -2,6 +2,7 @@
 
 #include <cryptopp/base64.h>
 
+#include <crypto/base64_codec.hpp>
 #include <userver/crypto/exception.hpp>
 
 #ifdef CRYPTOPP_NO_GLOBAL_BYTE
@@ -14,26 +15,13 @@ namespace crypto::base64 {
 
 namespace {
 
-template <typename Base64Encoder>
-std::string Base64Encode(std::string_view data, Pad pad) {
-  std::string response;
-  try {
-    Base64Encoder encoder(new CryptoPP::StringSink(response));
-    CryptoPP::AlgorithmParameters params =
-        CryptoPP::MakeParameters(CryptoPP::Name::Pad(), Pad::kWith == pad)(
-            CryptoPP::Name::InsertLineBreaks(), false);
-    encoder.IsolatedInitialize(params);
-    encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
-  }
-  return response;
-}
-
 template <typename Base64Decoder>
-std::string Base64Decode(std::string_view data) {
+std::string Base64Decode(std::string_view data, impl::Alphabet alphabet) {
   std::string response;
+  // CryptoPP is only needed for the data with the characters to skip
+  if (impl::TryDecode(data, alphabet, response)) return response;
+
+  response.clear();
   try {
     Base64Decoder decoder(new CryptoPP::StringSink(response));
     decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
@@ -47,20 +35,21 @@ std::string Base64Decode(std::string_view data) {
 }  // namespace
 
 std::string Base64Encode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64Encoder>(data, pad);
+  return impl::Encode(data, impl::Alphabet::kStandard, pad == Pad::kWith);
 }
 
 std::string Base64Decode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64Decoder>(data);
+  return Base64Decode<CryptoPP::Base64Decoder>(data,
+                                               impl::Alphabet::kStandard);
 }
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 std::string Base64UrlEncode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
+  return impl::Encode(data, impl::Alphabet::kUrl, pad == Pad::kWith);
 }
 
 std::string Base64UrlDecode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64URLDecoder>(data);
+  return Base64Decode<CryptoPP::Base64URLDecoder>(data, impl::Alphabet::kUrl);
 }
 #endif
 
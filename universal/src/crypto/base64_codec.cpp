@@ -0,0 +1,257 @@
+#include <crypto/base64_codec.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace crypto::base64::impl {
+
+namespace {
+
+constexpr std::string_view kStandardChars =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr std::string_view kUrlChars =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+static_assert(kStandardChars.size() == 64 && kUrlChars.size() == 64);
+
+constexpr char kPad = '=';
+constexpr std::uint8_t kInvalid = 0xff;
+
+using DecodingTable = std::array<std::uint8_t, 256>;
+
+constexpr DecodingTable MakeDecodingTable(std::string_view chars) {
+  DecodingTable table{};
+  for (auto& value : table) value = kInvalid;
+  for (std::size_t i = 0; i < chars.size(); ++i) {
+    table[static_cast<unsigned char>(chars[i])] = i;
+  }
+  return table;
+}
+
+constexpr DecodingTable kStandardTable = MakeDecodingTable(kStandardChars);
+constexpr DecodingTable kUrlTable = MakeDecodingTable(kUrlChars);
+
+std::string_view GetChars(Alphabet alphabet) noexcept {
+  return alphabet == Alphabet::kUrl ? kUrlChars : kStandardChars;
+}
+
+#ifdef __SSSE3__
+// Encodes 12 bytes out of the 16 loaded ones into 16 characters,
+// see http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+__m128i EncodeBlock(__m128i data, __m128i shift_lut) noexcept {
+  // Spread each 3 bytes into a 32-bit lane, then move each 6-bit index into
+  // a byte of its own
+  const auto input = _mm_shuffle_epi8(
+      data, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const auto t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+  const auto t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const auto t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+  const auto t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  const auto indices = _mm_or_si128(t1, t3);
+
+  // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+  auto lut_indices = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const auto less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  lut_indices =
+      _mm_or_si128(lut_indices, _mm_and_si128(less, _mm_set1_epi8(13)));
+  return _mm_add_epi8(indices, _mm_shuffle_epi8(shift_lut, lut_indices));
+}
+
+__m128i MakeShiftLut(std::string_view chars) noexcept {
+  const char digit_shift = '0' - 52;
+  return _mm_setr_epi8('a' - 26, digit_shift, digit_shift, digit_shift,
+                       digit_shift, digit_shift, digit_shift, digit_shift,
+                       digit_shift, digit_shift, digit_shift, chars[62] - 62,
+                       chars[63] - 63, 'A', 0, 0);
+}
+
+// Signed comparisons are fine for the ASCII ranges, the bytes over 0x7f are
+// negative and are out of any such range
+__m128i InRange(__m128i chars, char low, char high) noexcept {
+  return _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(low - 1)),
+                       _mm_cmpgt_epi8(_mm_set1_epi8(high + 1), chars));
+}
+
+// Decodes 16 characters into 12 bytes of `out`. Returns `false` if some of
+// the characters are not in the alphabet.
+bool DecodeBlock(__m128i chars, std::string_view alphabet_chars,
+                 char* out) noexcept {
+  const auto upper = InRange(chars, 'A', 'Z');
+  const auto lower = InRange(chars, 'a', 'z');
+  const auto digits = InRange(chars, '0', '9');
+  const auto char62 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet_chars[62]));
+  const auto char63 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet_chars[63]));
+
+  const auto valid = _mm_or_si128(
+      _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digits, char62)),
+      char63);
+  if (_mm_movemask_epi8(valid) != 0xffff) return false;
+
+  const auto shift = _mm_or_si128(
+      _mm_or_si128(
+          _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                       _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+          _mm_or_si128(_mm_and_si128(digits, _mm_set1_epi8(52 - '0')),
+                       _mm_and_si128(char62, _mm_set1_epi8(
+                                                 62 - alphabet_chars[62])))),
+      _mm_and_si128(char63, _mm_set1_epi8(63 - alphabet_chars[63])));
+  const auto values = _mm_add_epi8(chars, shift);
+
+  // Merge each 4 6-bit values into 24 bits of a 32-bit lane, then pack the
+  // lanes in the big endian order
+  const auto pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const auto lanes = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+  const auto bytes = _mm_shuffle_epi8(
+      lanes,
+      _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+  alignas(16) char buffer[16];
+  _mm_store_si128(reinterpret_cast<__m128i*>(buffer), bytes);
+  std::memcpy(out, buffer, 12);
+  return true;
+}
+#endif
+
+}  // namespace
+
+std::string Encode(std::string_view data, Alphabet alphabet, bool pad) {
+  const auto chars = GetChars(alphabet);
+  const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+  const auto* last = first + data.size();
+
+  std::string result;
+  result.resize(pad ? (data.size() + 2) / 3 * 4 : (data.size() * 4 + 2) / 3);
+  auto* dst = result.data();
+
+#if defined(__SSSE3__)
+  const auto shift_lut = MakeShiftLut(chars);
+  // 16 bytes are loaded for each 12 encoded ones
+  while (last - first >= 16) {
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dst),
+        EncodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)),
+                    shift_lut));
+    first += 12;
+    dst += 16;
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const auto* table_chars = reinterpret_cast<const std::uint8_t*>(chars.data());
+  const uint8x16x4_t table{{vld1q_u8(table_chars), vld1q_u8(table_chars + 16),
+                            vld1q_u8(table_chars + 32),
+                            vld1q_u8(table_chars + 48)}};
+  while (last - first >= 48) {
+    // Deinterleaves the 1st, the 2nd and the 3rd bytes of each triple
+    const auto input = vld3q_u8(first);
+    uint8x16x4_t indices;
+    indices.val[0] = vshrq_n_u8(input.val[0], 2);
+    indices.val[1] =
+        vorrq_u8(vshlq_n_u8(vandq_u8(input.val[0], vdupq_n_u8(0x3)), 4),
+                 vshrq_n_u8(input.val[1], 4));
+    indices.val[2] =
+        vorrq_u8(vshlq_n_u8(vandq_u8(input.val[1], vdupq_n_u8(0xf)), 2),
+                 vshrq_n_u8(input.val[2], 6));
+    indices.val[3] = vandq_u8(input.val[2], vdupq_n_u8(0x3f));
+
+    uint8x16x4_t output;
+    for (int i = 0; i < 4; ++i) {
+      output.val[i] = vqtbl4q_u8(table, indices.val[i]);
+    }
+    vst4q_u8(reinterpret_cast<std::uint8_t*>(dst), output);
+    first += 48;
+    dst += 64;
+  }
+#endif
+
+  for (; last - first >= 3; first += 3) {
+    const std::uint32_t triple = (first[0] << 16) | (first[1] << 8) | first[2];
+    *dst++ = chars[(triple >> 18) & 0x3f];
+    *dst++ = chars[(triple >> 12) & 0x3f];
+    *dst++ = chars[(triple >> 6) & 0x3f];
+    *dst++ = chars[triple & 0x3f];
+  }
+
+  if (last - first == 1) {
+    *dst++ = chars[first[0] >> 2];
+    *dst++ = chars[(first[0] & 0x3) << 4];
+    if (pad) {
+      *dst++ = kPad;
+      *dst++ = kPad;
+    }
+  } else if (last - first == 2) {
+    *dst++ = chars[first[0] >> 2];
+    *dst++ = chars[((first[0] & 0x3) << 4) | (first[1] >> 4)];
+    *dst++ = chars[(first[1] & 0xf) << 2];
+    if (pad) *dst++ = kPad;
+  }
+
+  return result;
+}
+
+bool TryDecode(std::string_view data, Alphabet alphabet, std::string& out) {
+  while (!data.empty() && data.back() == kPad) data.remove_suffix(1);
+
+  const auto& table =
+      alphabet == Alphabet::kUrl ? kUrlTable : kStandardTable;
+  const auto* first = data.data();
+  const auto* last = first + data.size();
+
+  out.resize(data.size() / 4 * 3 + (data.size() % 4) * 3 / 4);
+  auto* dst = out.data();
+
+#ifdef __SSSE3__
+  const auto chars = GetChars(alphabet);
+  while (last - first >= 16) {
+    if (!DecodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)),
+                     chars, dst)) {
+      return false;
+    }
+    first += 16;
+    dst += 12;
+  }
+#endif
+
+  const auto value = [&table](char c) {
+    return table[static_cast<unsigned char>(c)];
+  };
+
+  for (; last - first >= 4; first += 4) {
+    const std::uint8_t a = value(first[0]);
+    const std::uint8_t b = value(first[1]);
+    const std::uint8_t c = value(first[2]);
+    const std::uint8_t d = value(first[3]);
+    if ((a | b | c | d) > 0x3f) return false;
+
+    *dst++ = static_cast<char>((a << 2) | (b >> 4));
+    *dst++ = static_cast<char>((b << 4) | (c >> 2));
+    *dst++ = static_cast<char>((c << 6) | d);
+  }
+
+  // The bits that do not make a whole byte are dropped, like CryptoPP does
+  std::uint32_t bits = 0;
+  const auto tail_size = last - first;
+  for (; first != last; ++first) {
+    const auto next = value(*first);
+    if (next == kInvalid) return false;
+    bits = (bits << 6) | next;
+  }
+  if (tail_size == 2) {
+    *dst++ = static_cast<char>(bits >> 4);
+  } else if (tail_size == 3) {
+    *dst++ = static_cast<char>(bits >> 10);
+    *dst++ = static_cast<char>(bits >> 2);
+  }
+
+  return true;
+}
+
+}  // namespace crypto::base64::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace crypto::base64::impl {
+
+enum class Alphabet { kStandard, kUrl };
+
+// Same output as CryptoPP encoders without line breaks
+std::string Encode(std::string_view data, Alphabet alphabet, bool pad);
+
+// Decodes the data that consists only of the characters of the alphabet,
+// followed by any number of padding characters. Returns `false` for any other
+// data, which should be decoded by CryptoPP that skips the unknown characters.
+// The contents of `out` are unspecified in that case.
+bool TryDecode(std::string_view data, Alphabet alphabet, std::string& out);
+
+}  // namespace crypto::base64::impl
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,42 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
+#include <cryptopp/base64.h>
+
 #include <userver/crypto/base64.hpp>
 
+#ifdef CRYPTOPP_NO_GLOBAL_BYTE
+using CryptoPP::byte;
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+template <typename Base64Encoder>
+std::string CryptoPPEncode(std::string_view data, bool pad) {
+  std::string response;
+  Base64Encoder encoder(new CryptoPP::StringSink(response));
+  CryptoPP::AlgorithmParameters params = CryptoPP::MakeParameters(
+      CryptoPP::Name::Pad(), pad)(CryptoPP::Name::InsertLineBreaks(), false);
+  encoder.IsolatedInitialize(params);
+  encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
+                        data.size());
+  return response;
+}
+
+// All the byte values at all the positions of the SIMD blocks and the tails
+std::string MakeData(std::size_t size) {
+  std::string data(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<char>(i * 37 + size);
+  }
+  return data;
+}
+
+}  // namespace
+
 TEST(Crypto, Base64) {
   EXPECT_EQ("", crypto::base64::Base64Encode(""));
   EXPECT_EQ("", crypto::base64::Base64Decode(""));
@@ -17,7 +50,37 @@ TEST(Crypto, Base64) {
   EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
+TEST(Crypto, Base64SameAsCryptoPP) {
+  for (std::size_t size = 0; size < 300; ++size) {
+    const auto data = MakeData(size);
+    const auto encoded = crypto::base64::Base64Encode(data);
+    EXPECT_EQ(encoded,
+              CryptoPPEncode<CryptoPP::Base64Encoder>(data, /*pad=*/true));
+    EXPECT_EQ(crypto::base64::Base64Encode(data, crypto::base64::Pad::kWithout),
+              CryptoPPEncode<CryptoPP::Base64Encoder>(data, /*pad=*/false));
+    EXPECT_EQ(crypto::base64::Base64Decode(encoded), data);
+
+    // The characters out of the alphabet are skipped
+    auto with_garbage = encoded;
+    with_garbage.insert(with_garbage.size() / 2, "\n$\xff");
+    EXPECT_EQ(crypto::base64::Base64Decode(with_garbage), data);
+  }
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
+TEST(Crypto, Base64UrlSameAsCryptoPP) {
+  for (std::size_t size = 0; size < 300; ++size) {
+    const auto data = MakeData(size);
+    const auto encoded = crypto::base64::Base64UrlEncode(data);
+    EXPECT_EQ(encoded,
+              CryptoPPEncode<CryptoPP::Base64URLEncoder>(data, /*pad=*/true));
+    EXPECT_EQ(
+        crypto::base64::Base64UrlEncode(data, crypto::base64::Pad::kWithout),
+        CryptoPPEncode<CryptoPP::Base64URLEncoder>(data, /*pad=*/false));
+    EXPECT_EQ(crypto::base64::Base64UrlDecode(encoded), data);
+  }
+}
+
 TEST(Crypto, Base64Url) {
   EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
   EXPECT_EQ("U_8", crypto::base64::Base64UrlEncode(
@@ -25,6 +25,7 @@ class EvpMdCtx {
   EvpMdCtx(EvpMdCtx&&) noexcept;
 
   EVP_MD_CTX* Get() { return ctx_; }
+  const EVP_MD_CTX* Get() const { return ctx_; }
 
  private:
   EVP_MD_CTX* ctx_;
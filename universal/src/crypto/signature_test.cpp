@@ -13,6 +13,8 @@
 #include <userver/fs/blocking/write.hpp>
 
 #include <fstream>
+#include <thread>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -378,4 +380,38 @@ TEST(Crypto, SignaturePs512) {
                    {}, TestFlags::kSkipDigestOps);
 }
 
+TEST(Crypto, SignatureVerifierReuse) {
+  const crypto::SignerPs256 signer{rsa512_priv_key};
+  const crypto::SignerRs512 other_signer{rsa2048_priv_key};
+  const auto sig = signer.Sign({"test"});
+  const auto other_sig = other_signer.Sign({"test"});
+
+  const crypto::VerifierPs256 verifier{rsa512_pub_key};
+  const crypto::VerifierRs512 other_verifier{rsa2048_pub_key};
+  const auto verifier_copy = verifier;
+
+  // Verifications of different keys interleave on the same thread
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NO_THROW(verifier.Verify({"te", "st"}, sig));
+    EXPECT_THROW(other_verifier.Verify({"test"}, sig),
+                 crypto::VerificationError);
+    EXPECT_NO_THROW(other_verifier.Verify({"test"}, other_sig));
+    EXPECT_THROW(verifier_copy.Verify({"not test"}, sig),
+                 crypto::VerificationError);
+    EXPECT_NO_THROW(verifier_copy.Verify({"test"}, sig));
+  }
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 20; ++j) {
+        EXPECT_NO_THROW(verifier.Verify({"test"}, sig));
+        EXPECT_THROW(verifier.Verify({"test"}, other_sig),
+                     crypto::VerificationError);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
 USERVER_NAMESPACE_END
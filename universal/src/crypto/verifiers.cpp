@@ -10,8 +10,10 @@
 #include <openssl/evp.h>
 #include <openssl/x509.h>
 
+#include <userver/compiler/thread_local.hpp>
 #include <userver/crypto/openssl.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 #include <crypto/helpers.hpp>
 
@@ -20,6 +22,12 @@ USERVER_NAMESPACE_BEGIN
 namespace crypto {
 namespace {
 
+using PkeyCtxPtr = std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)>;
+
+// Reused by the DsaVerifier::Verify() calls of the thread to avoid allocating
+// a new EVP_MD_CTX for each verification
+compiler::ThreadLocal local_verify_context = [] { return EvpMdCtx{}; };
+
 // OpenSSL expects ECDSA signatures in ASN.1/DER format, however RFC7518
 // specifies signature as a concatenation of zero-padded big-endian `(R, S)`
 // values.
@@ -151,6 +159,15 @@ template class HmacShaVerifier<DigestSize::k512>;
 /// *SA
 ///
 
+template <DsaType type, DigestSize bits>
+struct DsaVerifier<type, bits>::Contexts {
+  // Initialized by EVP_DigestVerifyInit(), copied for each Verify()
+  EvpMdCtx digest_verify;
+  // Initialized by EVP_PKEY_verify_init(), duplicated for each VerifyDigest().
+  // Not set for RSASSA-PSS.
+  PkeyCtxPtr verify_digest{nullptr, EVP_PKEY_CTX_free};
+};
+
 template <DsaType type, DigestSize bits>
 DsaVerifier<type, bits>::DsaVerifier(PublicKey pubkey)
     : Verifier(EnumValueToString(type) + EnumValueToString(bits)),
@@ -171,6 +188,36 @@ DsaVerifier<type, bits>::DsaVerifier(PublicKey pubkey)
                               " verifier");
     }
   }
+
+  auto contexts = std::make_shared<Contexts>();
+
+  EVP_PKEY_CTX* pkey_ctx = nullptr;
+  if (1 != EVP_DigestVerifyInit(contexts->digest_verify.Get(), &pkey_ctx,
+                                GetShaMdByEnum(bits), nullptr,
+                                pkey_.GetNative())) {
+    throw VerificationError(
+        FormatSslError("Failed to create verifier: EVP_DigestVerifyInit"));
+  }
+  if constexpr (type == DsaType::kRsaPss) {
+    SetupJwaRsaPssPadding(pkey_ctx, bits);
+  } else {
+    contexts->verify_digest.reset(EVP_PKEY_CTX_new(pkey_.GetNative(), nullptr));
+    if (!contexts->verify_digest) {
+      throw VerificationError(
+          FormatSslError("Failed to create verifier: EVP_PKEY_CTX_new"));
+    }
+    if (1 != EVP_PKEY_verify_init(contexts->verify_digest.get())) {
+      throw VerificationError(
+          FormatSslError("Failed to create verifier: EVP_PKEY_verify_init"));
+    }
+    if (EVP_PKEY_CTX_set_signature_md(contexts->verify_digest.get(),
+                                      GetShaMdByEnum(bits)) <= 0) {
+      throw VerificationError(FormatSslError(
+          "Failed to create verifier: EVP_PKEY_CTX_set_signature_md"));
+    }
+  }
+
+  contexts_ = std::move(contexts);
 }
 
 template <DsaType type, DigestSize bits>
@@ -181,20 +228,17 @@ template <DsaType type, DigestSize bits>
 void DsaVerifier<type, bits>::Verify(
     std::initializer_list<std::string_view> data,
     std::string_view raw_signature) const {
-  EvpMdCtx ctx;
-  EVP_PKEY_CTX* pkey_ctx = nullptr;
-  if (1 != EVP_DigestVerifyInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits),
-                                nullptr, pkey_.GetNative())) {
+  auto ctx = local_verify_context.Use();
+  // Do not keep the key referenced by the thread after the verification
+  const utils::FastScopeGuard reset_guard{
+      [&ctx]() noexcept { EVP_MD_CTX_reset(ctx->Get()); }};
+  if (1 != EVP_MD_CTX_copy_ex(ctx->Get(), contexts_->digest_verify.Get())) {
     throw VerificationError(
-        FormatSslError("Failed to verify: EVP_DigestVerifyInit"));
-  }
-
-  if constexpr (type == DsaType::kRsaPss) {
-    SetupJwaRsaPssPadding(pkey_ctx, bits);
+        FormatSslError("Failed to verify: EVP_MD_CTX_copy_ex"));
   }
 
   for (const auto& part : data) {
-    if (1 != EVP_DigestVerifyUpdate(ctx.Get(), part.data(), part.size())) {
+    if (1 != EVP_DigestVerifyUpdate(ctx->Get(), part.data(), part.size())) {
       throw VerificationError(
           FormatSslError("Failed to verify: EVP_DigestVerifyUpdate"));
     }
@@ -203,11 +247,12 @@ void DsaVerifier<type, bits>::Verify(
   int verification_result = -1;
   if constexpr (type == DsaType::kEc) {
     auto der_signature = ConvertEcSignature(raw_signature);
-    verification_result = EVP_DigestVerifyFinal(ctx.Get(), der_signature.data(),
-                                                der_signature.size());
+    verification_result = EVP_DigestVerifyFinal(
+        ctx->Get(), der_signature.data(), der_signature.size());
   } else {
     verification_result = EVP_DigestVerifyFinal(
-        ctx.Get(), reinterpret_cast<const unsigned char*>(raw_signature.data()),
+        ctx->Get(),
+        reinterpret_cast<const unsigned char*>(raw_signature.data()),
         raw_signature.size());
   }
 
@@ -229,20 +274,11 @@ void DsaVerifier<type, bits>::VerifyDigest(
     throw VerificationError("Invalid digest size for " + Name() + " verifier");
   }
 
-  std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> pkey_ctx(
-      EVP_PKEY_CTX_new(pkey_.GetNative(), nullptr), EVP_PKEY_CTX_free);
+  const PkeyCtxPtr pkey_ctx(EVP_PKEY_CTX_dup(contexts_->verify_digest.get()),
+                            EVP_PKEY_CTX_free);
   if (!pkey_ctx) {
     throw VerificationError(
-        FormatSslError("Failed to verify digest: EVP_PKEY_CTX_new"));
-  }
-  if (1 != EVP_PKEY_verify_init(pkey_ctx.get())) {
-    throw VerificationError(
-        FormatSslError("Failed to verify digest: EVP_PKEY_verify_init"));
-  }
-  if (EVP_PKEY_CTX_set_signature_md(pkey_ctx.get(), GetShaMdByEnum(bits)) <=
-      0) {
-    throw VerificationError(
-        FormatSslError("Failed to sign digest: EVP_PKEY_CTX_set_signature_md"));
+        FormatSslError("Failed to verify digest: EVP_PKEY_CTX_dup"));
   }
 
   int verification_result = -1;
@@ -0,0 +1,343 @@
+#include <userver/formats/json/arena.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <formats/json/impl/allocator.hpp>
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+
+namespace {
+
+constexpr std::size_t kMaxChunkSize = 1024 * 1024;
+
+constexpr std::size_t AlignUp(std::size_t size) noexcept {
+  constexpr std::size_t kAlignment = alignof(std::max_align_t);
+  return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+// Granularity of PageMap, arena chunks are aligned to it and take whole pages
+constexpr std::size_t kPageSize = 4096;
+
+constexpr std::size_t AlignUpToPage(std::size_t size) noexcept {
+  return (size + kPageSize - 1) & ~(kPageSize - 1);
+}
+
+// Owners of the pages of the chunks of all the live arenas. Blocks carry no
+// headers, so Free looks up the owner of a block by its address here. A page
+// never holds both an arena chunk and some other memory, so the lookup takes
+// a few atomic loads and no locks. The nodes are never freed.
+class PageMap final {
+ public:
+  void Set(const void* begin, std::size_t size, Arena* arena) {
+    const auto first = GetPageIndex(begin);
+    for (auto index = first; index < first + size / kPageSize; ++index) {
+      UINVARIANT(index < kMaxPages, "Address is out of the PageMap range");
+      auto* mid = GetOrCreate(root_[index >> (2 * kLevelBits)]);
+      auto* leaf = GetOrCreate(mid->leaves[(index >> kLevelBits) & kLevelMask]);
+      leaf->arenas[index & kLevelMask].store(arena, std::memory_order_release);
+    }
+  }
+
+  void Reset(const void* begin, std::size_t size) noexcept {
+    const auto first = GetPageIndex(begin);
+    for (auto index = first; index < first + size / kPageSize; ++index) {
+      // Missing only if Set has failed midway
+      auto* leaf = FindLeaf(index);
+      if (!leaf) continue;
+      leaf->arenas[index & kLevelMask].store(nullptr,
+                                             std::memory_order_release);
+    }
+  }
+
+  Arena* Find(const void* ptr) const noexcept {
+    const auto index = GetPageIndex(ptr);
+    const auto* leaf = FindLeaf(index);
+    if (!leaf) return nullptr;
+    return leaf->arenas[index & kLevelMask].load(std::memory_order_acquire);
+  }
+
+ private:
+  // Three levels cover 48-bit addresses
+  static constexpr std::size_t kLevelBits = 12;
+  static constexpr std::size_t kLevelSize = std::size_t{1} << kLevelBits;
+  static constexpr std::size_t kLevelMask = kLevelSize - 1;
+  static constexpr std::uintptr_t kMaxPages = std::uintptr_t{1}
+                                              << (3 * kLevelBits);
+
+  struct Leaf final {
+    std::atomic<Arena*> arenas[kLevelSize];
+  };
+
+  struct Mid final {
+    std::atomic<Leaf*> leaves[kLevelSize];
+  };
+
+  static std::uintptr_t GetPageIndex(const void* ptr) noexcept {
+    return reinterpret_cast<std::uintptr_t>(ptr) / kPageSize;
+  }
+
+  template <typename Node>
+  static Node* GetOrCreate(std::atomic<Node*>& slot) {
+    auto* node = slot.load(std::memory_order_acquire);
+    if (node) return node;
+
+    auto new_node = std::make_unique<Node>();
+    if (slot.compare_exchange_strong(node, new_node.get(),
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_acquire)) {
+      return new_node.release();
+    }
+    return node;
+  }
+
+  Leaf* FindLeaf(std::uintptr_t index) const noexcept {
+    if (index >= kMaxPages) return nullptr;
+    auto* mid =
+        root_[index >> (2 * kLevelBits)].load(std::memory_order_acquire);
+    if (!mid) return nullptr;
+    return mid->leaves[(index >> kLevelBits) & kLevelMask].load(
+        std::memory_order_acquire);
+  }
+
+  std::atomic<Mid*> root_[kLevelSize]{};
+};
+
+// Never destroyed, values in static variables may be freed after it
+PageMap& GetPageMap() {
+  static auto* page_map = new PageMap();
+  return *page_map;
+}
+
+// While there are no arenas, or no scopes, the allocator does exactly what
+// rapidjson::CrtAllocator does and checks nothing else
+std::atomic<std::size_t> live_arenas{0};
+std::atomic<std::size_t> active_scopes{0};
+
+}  // namespace
+
+class Arena final {
+ public:
+  Arena(std::size_t initial_size,
+        std::pmr::memory_resource* upstream) noexcept
+      : upstream_(upstream),
+        next_chunk_size_(
+            AlignUpToPage(std::max(initial_size, sizeof(Chunk)))) {
+    live_arenas.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  Arena(Arena&&) = delete;
+  Arena& operator=(Arena&&) = delete;
+
+  void* Allocate(std::size_t size) {
+    size = AlignUp(size);
+    if (static_cast<std::size_t>(end_ - pos_) < size) {
+      if (!AddChunk(size)) return nullptr;
+    }
+
+    auto* block = pos_;
+    pos_ += size;
+    last_block_ = block;
+
+    refs_.fetch_add(1, std::memory_order_relaxed);
+    ++stats_.allocations;
+    return block;
+  }
+
+  // Grows or shrinks the block in place, if it is the last one in the chunk
+  bool TryResize(void* ptr, std::size_t new_size) noexcept {
+    if (ptr != last_block_) return false;
+
+    new_size = AlignUp(new_size);
+    if (static_cast<std::size_t>(end_ - last_block_) < new_size) return false;
+
+    pos_ = last_block_ + new_size;
+    return true;
+  }
+
+  void Unref() noexcept {
+    if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+  }
+
+  const ArenaScope::Statistics& GetStatistics() const noexcept {
+    return stats_;
+  }
+
+ private:
+  struct alignas(std::max_align_t) Chunk final {
+    Chunk* next;
+    std::size_t size;
+  };
+
+  ~Arena() {
+    auto& page_map = GetPageMap();
+    while (chunks_) {
+      auto* chunk = std::exchange(chunks_, chunks_->next);
+      page_map.Reset(chunk, chunk->size);
+      DeallocateChunk(chunk, chunk->size);
+    }
+    live_arenas.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  Chunk* AllocateChunk(std::size_t chunk_size) noexcept {
+    if (!upstream_) {
+      return static_cast<Chunk*>(std::aligned_alloc(kPageSize, chunk_size));
+    }
+
+    try {
+      return static_cast<Chunk*>(upstream_->allocate(chunk_size, kPageSize));
+    } catch (const std::bad_alloc&) {
+      return nullptr;
+    }
+  }
+
+  void DeallocateChunk(Chunk* chunk, std::size_t chunk_size) noexcept {
+    if (upstream_) {
+      upstream_->deallocate(chunk, chunk_size, kPageSize);
+    } else {
+      std::free(chunk);
+    }
+  }
+
+  bool AddChunk(std::size_t min_size) noexcept {
+    const auto chunk_size =
+        AlignUpToPage(std::max(next_chunk_size_, sizeof(Chunk) + min_size));
+    auto* chunk = AllocateChunk(chunk_size);
+    if (!chunk) return false;
+
+    try {
+      GetPageMap().Set(chunk, chunk_size, this);
+    } catch (const std::exception&) {
+      GetPageMap().Reset(chunk, chunk_size);
+      DeallocateChunk(chunk, chunk_size);
+      return false;
+    }
+
+    chunk->next = chunks_;
+    chunk->size = chunk_size;
+    chunks_ = chunk;
+    pos_ = reinterpret_cast<char*>(chunk + 1);
+    end_ = reinterpret_cast<char*>(chunk) + chunk_size;
+    last_block_ = nullptr;
+    next_chunk_size_ = std::min(next_chunk_size_ * 2, kMaxChunkSize);
+
+    ++stats_.chunks;
+    stats_.bytes += chunk_size;
+    return true;
+  }
+
+  // One reference is held by the ArenaScope, one more by each live block
+  std::atomic<std::size_t> refs_{1};
+
+  std::pmr::memory_resource* const upstream_;
+  Chunk* chunks_{nullptr};
+  char* pos_{nullptr};
+  char* end_{nullptr};
+  char* last_block_{nullptr};
+  std::size_t next_chunk_size_;
+
+  ArenaScope::Statistics stats_;
+};
+
+namespace {
+
+compiler::ThreadLocal local_arena = [] { return static_cast<Arena*>(nullptr); };
+
+Arena* GetCurrentArena() noexcept {
+  if (active_scopes.load(std::memory_order_relaxed) == 0) return nullptr;
+  auto current_arena = local_arena.Use();
+  return *current_arena;
+}
+
+Arena* FindOwnerArena(const void* ptr) noexcept {
+  if (live_arenas.load(std::memory_order_relaxed) == 0) return nullptr;
+  return GetPageMap().Find(ptr);
+}
+
+}  // namespace
+
+void* Allocator::Malloc(std::size_t size) {
+  // Same as rapidjson::CrtAllocator
+  if (!size) return nullptr;
+
+  if (auto* arena = GetCurrentArena()) return arena->Allocate(size);
+  return std::malloc(size);
+}
+
+void* Allocator::Realloc(void* original_ptr, std::size_t original_size,
+                         std::size_t new_size) {
+  if (!new_size) {
+    Free(original_ptr);
+    return nullptr;
+  }
+  if (!original_ptr) return Malloc(new_size);
+
+  auto* owner = FindOwnerArena(original_ptr);
+  auto* arena = GetCurrentArena();
+  if (!owner && !arena) return std::realloc(original_ptr, new_size);
+  if (owner && owner == arena && arena->TryResize(original_ptr, new_size)) {
+    return original_ptr;
+  }
+
+  void* new_ptr = Malloc(new_size);
+  if (!new_ptr) return nullptr;
+  std::memcpy(new_ptr, original_ptr, std::min(original_size, new_size));
+  Free(original_ptr);
+  return new_ptr;
+}
+
+void Allocator::Free(void* ptr) noexcept {
+  if (!ptr) return;
+
+  if (auto* owner = FindOwnerArena(ptr)) {
+    owner->Unref();
+  } else {
+    std::free(ptr);
+  }
+}
+
+}  // namespace impl
+
+ArenaScope::ArenaScope(std::size_t initial_size)
+    : ArenaScope(nullptr, initial_size) {}
+
+ArenaScope::ArenaScope(std::pmr::memory_resource& upstream,
+                       std::size_t initial_size)
+    : ArenaScope(&upstream, initial_size) {}
+
+ArenaScope::ArenaScope(std::pmr::memory_resource* upstream,
+                       std::size_t initial_size)
+    : arena_(new impl::Arena(initial_size, upstream)) {
+  impl::active_scopes.fetch_add(1, std::memory_order_relaxed);
+  auto current_arena = impl::local_arena.Use();
+  previous_arena_ = std::exchange(*current_arena, arena_);
+}
+
+ArenaScope::~ArenaScope() {
+  auto current_arena = impl::local_arena.Use();
+  UASSERT_MSG(*current_arena == arena_,
+              "ArenaScope is destroyed on another thread or out of order");
+  *current_arena = previous_arena_;
+  impl::active_scopes.fetch_sub(1, std::memory_order_relaxed);
+  arena_->Unref();
+}
+
+ArenaScope::Statistics ArenaScope::GetStatistics() const noexcept {
+  return arena_->GetStatistics();
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
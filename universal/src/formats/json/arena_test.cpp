@@ -0,0 +1,173 @@
+#include <userver/formats/json/arena.hpp>
+
+#include <cstdlib>
+#include <memory_resource>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+#include <formats/json/impl/allocator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kDoc =
+    R"({"key":"some string that is rather long","array":[1,2,3,4,5,6,7,8]})";
+
+}  // namespace
+
+TEST(FormatsJsonArena, Sample) {
+  /// [Sample formats::json::ArenaScope usage]
+  formats::json::Value json;
+  {
+    formats::json::ArenaScope arena;
+    json = formats::json::FromString(kDoc);
+  }
+  // The arena is released after `json` is destroyed
+  EXPECT_EQ(json["key"].As<std::string>(), "some string that is rather long");
+  /// [Sample formats::json::ArenaScope usage]
+}
+
+TEST(FormatsJsonArena, Statistics) {
+  formats::json::ArenaScope arena;
+  EXPECT_EQ(arena.GetStatistics().allocations, 0);
+  EXPECT_EQ(arena.GetStatistics().chunks, 0);
+
+  const auto json = formats::json::FromString(kDoc);
+  const auto stats = arena.GetStatistics();
+  EXPECT_GT(stats.allocations, 1);
+  EXPECT_EQ(stats.chunks, 1);
+  EXPECT_GE(stats.bytes, formats::json::ArenaScope::kDefaultInitialSize);
+}
+
+TEST(FormatsJsonArena, ChunksGrow) {
+  formats::json::ArenaScope arena{64};
+
+  formats::json::ValueBuilder builder(formats::common::Type::kArray);
+  for (int i = 0; i < 1000; ++i) {
+    builder.PushBack(std::string(100, static_cast<char>('a' + i % 26)));
+  }
+  const auto json = builder.ExtractValue();
+
+  const auto stats = arena.GetStatistics();
+  EXPECT_GT(stats.chunks, 1);
+  EXPECT_GT(stats.bytes, 100 * 1000);
+  EXPECT_EQ(json[999].As<std::string>(), std::string(100, 'a' + 999 % 26));
+}
+
+TEST(FormatsJsonArena, ValuesOutliveScope) {
+  formats::json::ValueBuilder builder;
+  {
+    formats::json::ArenaScope arena;
+    builder = formats::json::FromString(kDoc);
+  }
+
+  // Memory from the arena is reallocated by the system allocator
+  for (int i = 9; i < 100; ++i) builder["array"].PushBack(i);
+  builder["other"] = "some other string that is rather long";
+
+  const auto json = builder.ExtractValue();
+  EXPECT_EQ(json["array"].GetSize(), 99);
+  EXPECT_EQ(json["array"][98].As<int>(), 99);
+  EXPECT_EQ(json, formats::json::FromString(formats::json::ToString(json)));
+}
+
+TEST(FormatsJsonArena, DestroyOnAnotherThread) {
+  auto json = [] {
+    formats::json::ArenaScope arena;
+    return formats::json::FromString(kDoc);
+  }();
+
+  std::thread([json = std::move(json)]() mutable {
+    EXPECT_EQ(json["array"].As<std::vector<int>>().size(), 8);
+    json = {};
+  }).join();
+}
+
+TEST(FormatsJsonArena, Upstream) {
+  std::pmr::monotonic_buffer_resource buffer;
+  std::size_t allocated_bytes = 0;
+
+  class CountingResource final : public std::pmr::memory_resource {
+   public:
+    CountingResource(std::pmr::memory_resource& upstream, std::size_t& bytes)
+        : upstream_(upstream), bytes_(bytes) {}
+
+   private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+      bytes_ += bytes;
+      return upstream_.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override {
+      bytes_ -= bytes;
+      upstream_.deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+
+    std::pmr::memory_resource& upstream_;
+    std::size_t& bytes_;
+  } counting{buffer, allocated_bytes};
+
+  {
+    formats::json::ArenaScope arena{counting, 64};
+    const auto json = formats::json::FromString(kDoc);
+    EXPECT_GT(arena.GetStatistics().chunks, 0);
+    EXPECT_EQ(allocated_bytes, arena.GetStatistics().bytes);
+  }
+  EXPECT_EQ(allocated_bytes, 0);
+}
+
+TEST(FormatsJsonArena, SystemAllocatorOutsideOfScopes) {
+  // No headers or other bookkeeping without an arena, the memory is the
+  // plain system allocator memory
+  formats::json::impl::Allocator allocator;
+  void* ptr = allocator.Malloc(16);
+  ASSERT_NE(ptr, nullptr);
+  ptr = allocator.Realloc(ptr, 16, 1024);
+  ASSERT_NE(ptr, nullptr);
+  std::free(ptr);
+
+  formats::json::Value json;
+  {
+    formats::json::ArenaScope arena;
+    json = formats::json::FromString(kDoc);
+    // A system block allocated while the arena is alive is still freed by
+    // the system allocator
+    std::thread([&allocator] {
+      allocator.Free(allocator.Malloc(16));
+    }).join();
+  }
+  EXPECT_EQ(json["array"].GetSize(), 8);
+}
+
+TEST(FormatsJsonArena, Nested) {
+  formats::json::ArenaScope outer;
+  const auto outer_json = formats::json::FromString(kDoc);
+  const auto outer_allocations = outer.GetStatistics().allocations;
+
+  formats::json::Value inner_json;
+  {
+    formats::json::ArenaScope inner;
+    inner_json = formats::json::FromString(kDoc);
+    EXPECT_EQ(inner.GetStatistics().allocations, outer_allocations);
+  }
+  EXPECT_EQ(outer.GetStatistics().allocations, outer_allocations);
+
+  const auto json = formats::json::FromString(kDoc);
+  EXPECT_EQ(outer.GetStatistics().allocations, outer_allocations * 2);
+  EXPECT_EQ(json, inner_json);
+  EXPECT_EQ(json, outer_json);
+}
+
+USERVER_NAMESPACE_END
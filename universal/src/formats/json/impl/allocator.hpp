@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+// RapidJSON allocator of formats::json values. Takes memory from the arena of
+// the formats::json::ArenaScope of the current thread, if any, and from the
+// system allocator otherwise. Memory from both sources might be freed on any
+// thread. Blocks have no headers: while no arenas exist, this is the same as
+// rapidjson::CrtAllocator.
+class Allocator final {
+ public:
+  static constexpr bool kNeedFree = true;
+
+  void* Malloc(std::size_t size);
+  void* Realloc(void* original_ptr, std::size_t original_size,
+                std::size_t new_size);
+  static void Free(void* ptr) noexcept;
+
+  bool operator==(const Allocator&) const noexcept { return true; }
+  bool operator!=(const Allocator&) const noexcept { return false; }
+};
+
+// Adapts Allocator for std::allocate_shared
+template <typename T>
+class StdAllocator final {
+ public:
+  using value_type = T;
+
+  static_assert(alignof(T) <= alignof(std::max_align_t));
+
+  StdAllocator() noexcept = default;
+
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  StdAllocator(const StdAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    void* ptr = Allocator{}.Malloc(n * sizeof(T));
+    if (!ptr) throw std::bad_alloc();
+    return static_cast<T*>(ptr);
+  }
+
+  void deallocate(T* ptr, std::size_t) noexcept { Allocator::Free(ptr); }
+
+  template <typename U>
+  bool operator==(const StdAllocator<U>&) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const StdAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -9,6 +9,7 @@
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <formats/json/impl/allocator.hpp>
 #include <formats/json/impl/exttypes.hpp>
 #include <userver/formats/common/path.hpp>
 
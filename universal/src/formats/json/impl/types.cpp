@@ -10,9 +10,9 @@ VersionedValuePtr::Data::Data(Document&& doc)
     : Data(static_cast<Value&&>(doc)) {
   static_assert(
       // NOLINTNEXTLINE(misc-redundant-expression)
-      std::is_same_v<::rapidjson::CrtAllocator, Value::AllocatorType> &&
-          std::is_same_v<::rapidjson::CrtAllocator, Document::AllocatorType>,
-      "Both Document and Value must use CrtAllocator for the fast move");
+      std::is_same_v<Allocator, Value::AllocatorType> &&
+          std::is_same_v<Allocator, Document::AllocatorType>,
+      "Both Document and Value must use impl::Allocator for the fast move");
 }
 
 VersionedValuePtr::VersionedValuePtr() noexcept = default;
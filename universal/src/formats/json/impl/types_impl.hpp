@@ -4,6 +4,7 @@
 
 #include <rapidjson/document.h>
 
+#include <formats/json/impl/allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,7 +31,8 @@ struct VersionedValuePtr::Data {
 
 template <typename... Args>
 VersionedValuePtr VersionedValuePtr::Create(Args&&... args) {
-  return VersionedValuePtr{std::make_shared<Data>(std::forward<Args>(args)...)};
+  return VersionedValuePtr{std::allocate_shared<Data>(
+      StdAllocator<Data>{}, std::forward<Args>(args)...)};
 }
 
 }  // namespace formats::json::impl
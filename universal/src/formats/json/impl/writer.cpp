@@ -0,0 +1,153 @@
+#include <formats/json/impl/writer.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+// Same as the rapidjson::internal::WriteExponent
+char* WriteExponent(int exponent, char* out) noexcept {
+  if (exponent < 0) {
+    *out++ = '-';
+    exponent = -exponent;
+  }
+  if (exponent >= 100) {
+    *out++ = static_cast<char>('0' + exponent / 100);
+    exponent %= 100;
+    *out++ = static_cast<char>('0' + exponent / 10);
+    *out++ = static_cast<char>('0' + exponent % 10);
+  } else if (exponent >= 10) {
+    *out++ = static_cast<char>('0' + exponent / 10);
+    *out++ = static_cast<char>('0' + exponent % 10);
+  } else {
+    *out++ = static_cast<char>('0' + exponent);
+  }
+  return out;
+}
+
+// Same layout as the rapidjson::internal::Prettify, `point` is the position of
+// the decimal point relative to the first digit.
+char* Prettify(const char* digits, int length, int point, char* out) noexcept {
+  if (length <= point && point <= 21) {
+    // 1234e7 -> 12340000000.0
+    std::memcpy(out, digits, length);
+    out += length;
+    for (int i = length; i < point; ++i) *out++ = '0';
+    *out++ = '.';
+    *out++ = '0';
+  } else if (0 < point && point <= 21) {
+    // 1234e-2 -> 12.34
+    std::memcpy(out, digits, point);
+    out += point;
+    *out++ = '.';
+    std::memcpy(out, digits + point, length - point);
+    out += length - point;
+  } else if (-6 < point && point <= 0) {
+    // 1234e-6 -> 0.001234
+    *out++ = '0';
+    *out++ = '.';
+    for (int i = point; i < 0; ++i) *out++ = '0';
+    std::memcpy(out, digits, length);
+    out += length;
+  } else {
+    // 1e30, 1234e30 -> 1.234e33
+    *out++ = digits[0];
+    if (length > 1) {
+      *out++ = '.';
+      std::memcpy(out, digits + 1, length - 1);
+      out += length - 1;
+    }
+    *out++ = 'e';
+    out = WriteExponent(point - 1, out);
+  }
+  return out;
+}
+
+// Prices and other values with a few decimal places are exactly
+// `integer / 10^k` for a small k. If such an integer has at most 15 digits,
+// its digits are the shortest round-trip representation: no other decimal
+// number with at most 15 significant digits rounds to the same double.
+bool TryWriteShortDecimal(double value, char* digits, int& length,
+                          int& point) noexcept {
+  constexpr double kPow10[] = {1, 10, 100, 1000, 10000};
+  constexpr double kMaxSignificand = 1e15;
+
+  if (value >= kMaxSignificand) return false;
+  for (int k = 0; k < static_cast<int>(std::size(kPow10)); ++k) {
+    const double scaled = value * kPow10[k];
+    if (scaled >= kMaxSignificand) return false;
+
+    const auto significand = static_cast<std::uint64_t>(scaled);
+    if (static_cast<double>(significand) != scaled) continue;
+    // The multiplication rounds, so check that the decimal parses back
+    if (scaled / kPow10[k] != value) continue;
+
+    const auto [end, error] =
+        std::to_chars(digits, digits + kDoubleBufferSize, significand);
+    UASSERT(error == std::errc{});
+    length = static_cast<int>(end - digits);
+    point = length - k;
+    // The rounding of the multiplication may also leave trailing zeros
+    while (length > point && digits[length - 1] == '0') --length;
+    return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+std::size_t WriteDouble(double value, char* buffer) noexcept {
+  char* out = buffer;
+  if (std::signbit(value)) {
+    *out++ = '-';
+    value = -value;
+  }
+  if (value == 0) {
+    std::memcpy(out, "0.0", 3);
+    return out + 3 - buffer;
+  }
+
+#if defined(__cpp_lib_to_chars)
+  char digits[kDoubleBufferSize];
+  int length = 0;
+  int point = 0;
+  if (TryWriteShortDecimal(value, digits, length, point)) {
+    return Prettify(digits, length, point, out) - buffer;
+  }
+
+  // The shortest round-trip representation as "d.ddde+XX"
+  char scientific[kDoubleBufferSize];
+  const auto [end, error] =
+      std::to_chars(std::begin(scientific), std::end(scientific), value,
+                    std::chars_format::scientific);
+  UASSERT(error == std::errc{});
+
+  const char* it = scientific;
+  for (; it != end && *it != 'e'; ++it) {
+    if (*it != '.') digits[length++] = *it;
+  }
+  UASSERT(it != end);
+  ++it;
+
+  const bool negative_exponent = (*it == '-');
+  int exponent = 0;
+  for (++it; it != end; ++it) exponent = exponent * 10 + (*it - '0');
+  if (negative_exponent) exponent = -exponent;
+
+  return Prettify(digits, length, exponent + 1, out) - buffer;
+#else
+  static_assert(kDoubleBufferSize >= 25);
+  return rapidjson::internal::dtoa(value, out) - buffer;
+#endif
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
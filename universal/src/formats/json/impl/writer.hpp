@@ -0,0 +1,84 @@
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/writer.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+inline constexpr std::size_t kDoubleBufferSize = 32;
+
+/// Writes a finite `value` in the format of rapidjson::Writer: `1.0`, `0.001`,
+/// `1e30`, `1.5e-7`; but with the shortest digits that round-trip.
+/// Returns the number of characters written.
+std::size_t WriteDouble(double value, char* buffer) noexcept;
+
+/// Puts a finite `value` formatted by WriteDouble into `os`
+template <typename OutputStream>
+void PutDouble(OutputStream& os, double value) {
+  char buffer[kDoubleBufferSize];
+  const auto length = WriteDouble(value, buffer);
+
+  rapidjson::PutReserve(os, length);
+  for (std::size_t i = 0; i < length; ++i) {
+    rapidjson::PutUnsafe(os, buffer[i]);
+  }
+}
+
+/// rapidjson::Writer that formats doubles through WriteDouble
+template <typename OutputStream>
+class Writer final : public rapidjson::Writer<OutputStream> {
+  using Base = rapidjson::Writer<OutputStream>;
+
+ public:
+  using Base::Base;
+
+  bool Double(double value) {
+#if defined(__cpp_lib_to_chars)
+    if (!std::isfinite(value)) return false;
+
+    Base::Prefix(rapidjson::kNumberType);
+    PutDouble(*Base::os_, value);
+    return Base::EndValue(true);
+#else
+    return Base::Double(value);
+#endif
+  }
+};
+
+template <typename OutputStream>
+Writer(OutputStream&) -> Writer<OutputStream>;
+
+/// rapidjson::PrettyWriter that formats doubles through WriteDouble, so that
+/// the numbers are the same as in the output of Writer
+template <typename OutputStream>
+class PrettyWriter final : public rapidjson::PrettyWriter<OutputStream> {
+  using Base = rapidjson::PrettyWriter<OutputStream>;
+
+ public:
+  using Base::Base;
+
+  bool Double(double value) {
+#if defined(__cpp_lib_to_chars)
+    if (!std::isfinite(value)) return false;
+
+    Base::PrettyPrefix(rapidjson::kNumberType);
+    PutDouble(*Base::os_, value);
+    return Base::EndValue(true);
+#else
+    return Base::Double(value);
+#endif
+  }
+};
+
+template <typename OutputStream>
+PrettyWriter(OutputStream&) -> PrettyWriter<OutputStream>;
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -18,9 +18,9 @@ USERVER_NAMESPACE_BEGIN
 namespace formats::json::impl {
 namespace {
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
 
-static_assert(std::is_empty_v<::rapidjson::CrtAllocator>,
+static_assert(std::is_empty_v<impl::Allocator>,
               "allocator has no state");
 
 impl::Value WrapStringView(std::string_view key) {
@@ -2,6 +2,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include <userver/formats/json/arena.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
@@ -116,6 +117,25 @@ void json_object_append(benchmark::State& state) {
 }
 BENCHMARK(json_object_append)->RangeMultiplier(2)->Range(1, 10240);
 
+void json_object_append_arena(benchmark::State& state) {
+  const auto size = state.range(0);
+  std::size_t allocations = 0;
+  std::size_t chunks = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::ArenaScope arena;
+    benchmark::DoNotOptimize(Build(size));
+
+    const auto stats = arena.GetStatistics();
+    allocations += stats.allocations;
+    chunks += stats.chunks;
+  }
+  state.counters["allocations"] =
+      benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+  state.counters["chunks"] =
+      benchmark::Counter(chunks, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(json_object_append_arena)->RangeMultiplier(2)->Range(1, 10240);
+
 void json_object_compare(benchmark::State& state) {
   const auto size = state.range(0);
   const auto a = Build(size).ExtractValue();
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 
+#include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -84,4 +87,62 @@ TEST(FormatsJson, ParseHours) {
       formats::json::Exception);
 }
 
+// SIMD scanners of the parser process input by 16 bytes, check the values that
+// start and end at every position of such block.
+TEST(FormatsJson, ParseLongStrings) {
+  for (std::size_t size = 0; size < 70; ++size) {
+    const std::string plain(size, 'a');
+    auto escaped = plain;
+    if (size > 0) escaped[size / 2] = '"';
+
+    const std::string doc =
+        R"({"plain":")" + plain + R"(","escaped":")" +
+        (size > 0 ? plain.substr(0, size / 2) + R"(\")" +
+                        plain.substr(size / 2 + 1)
+                  : std::string{}) +
+        "\"}";
+    const auto json = formats::json::FromString(doc);
+    EXPECT_EQ(json["plain"].As<std::string>(), plain);
+    EXPECT_EQ(json["escaped"].As<std::string>(), escaped);
+  }
+}
+
+TEST(FormatsJson, ParseLongWhitespace) {
+  for (std::size_t size = 0; size < 70; ++size) {
+    const std::string ws(size, size % 2 ? ' ' : '\n');
+    const auto json =
+        formats::json::FromString(ws + "[" + ws + "1" + ws + "," + ws + "2" +
+                                  ws + "]" + ws);
+    EXPECT_EQ(json.As<std::vector<int>>(), (std::vector<int>{1, 2}));
+  }
+}
+
+TEST(FormatsJson, ParseNotNullTerminated) {
+  constexpr std::string_view kDoc = R"(["value"] garbage)";
+  EXPECT_EQ(formats::json::FromString(kDoc.substr(0, 9))[0].As<std::string>(),
+            "value");
+  UEXPECT_THROW(formats::json::FromString(kDoc.substr(0, 8)),
+                formats::json::ParseException);
+}
+
+TEST(FormatsJson, ParseEmbeddedZero) {
+  using namespace std::string_view_literals;
+  EXPECT_EQ(formats::json::FromString("[1]\0[2]"sv).As<std::vector<int>>(),
+            (std::vector<int>{1}));
+  UEXPECT_THROW(formats::json::FromString("[\"a\0b\"]"sv),
+                formats::json::ParseException);
+}
+
+TEST(FormatsJson, ParseErrorInLongString) {
+  const std::string doc = "[\"" + std::string(40, 'a') + "\x01\"]";
+  try {
+    formats::json::FromString(doc);
+    FAIL() << "Exception was not thrown on json: " << doc;
+  } catch (const formats::json::ParseException& e) {
+    EXPECT_NE(std::string_view{e.what()}.find("line 1 column 43"),
+              std::string_view::npos)
+        << e.what();
+  }
+}
+
 USERVER_NAMESPACE_END
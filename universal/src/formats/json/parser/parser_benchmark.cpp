@@ -102,6 +102,40 @@ BENCHMARK(JsonParseValueSax)->RangeMultiplier(2)->Range(1, 16);
 
 namespace {
 
+// Resembles a pretty printed request body with a lot of string data
+std::string BuildTextDocument(std::size_t items) {
+  std::string r = "{\n  \"items\": [";
+  for (std::size_t i = 0; i < items; ++i) {
+    if (i > 0) r += ',';
+    r += fmt::format(
+        R"(
+    {{
+      "id": "item-{}",
+      "title": "Some rather long title of the item number {}",
+      "description": "Text with \"escapes\" inside, \\ and \n new lines",
+      "tags": ["first tag", "second tag", "third tag"],
+      "price": {}.{}
+    }})",
+        i, i, i, i % 100);
+  }
+  r += "\n  ]\n}";
+  return r;
+}
+
+}  // namespace
+
+void JsonParseTextDom(benchmark::State& state) {
+  const auto input = BuildTextDocument(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto res = formats::json::FromString(input);
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseTextDom)->RangeMultiplier(8)->Range(1, 4096);
+
+namespace {
+
 struct SomeValue final {
   std::size_t value;
 
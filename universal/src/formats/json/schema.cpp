@@ -24,11 +24,11 @@ std::string ToStdString(const impl::Value& value) {
 namespace impl {
 
 using SchemaDocument =
-    rapidjson::GenericSchemaDocument<impl::Value, rapidjson::CrtAllocator>;
+    rapidjson::GenericSchemaDocument<impl::Value, impl::Allocator>;
 
 using SchemaValidator = rapidjson::GenericSchemaValidator<
     impl::SchemaDocument, rapidjson::BaseReaderHandler<impl::UTF8, void>,
-    rapidjson::CrtAllocator>;
+    impl::Allocator>;
 
 }  // namespace impl
 
@@ -18,6 +18,8 @@
 #include <formats/json/impl/accept.hpp>
 #include <formats/json/impl/json_tree.hpp>
 #include <formats/json/impl/types_impl.hpp>
+#include <formats/json/impl/writer.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/logging/log.hpp>
@@ -29,7 +31,45 @@ namespace formats::json {
 
 namespace {
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
+
+constexpr unsigned kParseFlags = rapidjson::kParseDefaultFlags |
+                                 rapidjson::kParseIterativeFlag |
+                                 rapidjson::kParseFullPrecisionFlag;
+
+#ifdef RAPIDJSON_SIMD
+// RapidJSON scans strings with SIMD only for null-terminated input, so the
+// document is copied into a buffer padded with zeroes. The padding keeps the
+// aligned 16-byte loads of the scanner within the buffer. Embedded '\0' ends
+// the input both for the null-terminated and the sized input, so the results
+// are the same.
+constexpr std::size_t kSimdPadding = 16;
+constexpr std::size_t kMaxCachedParseBufferSize = 1024 * 1024;
+
+compiler::ThreadLocal local_parse_buffer = [] { return std::string{}; };
+
+rapidjson::ParseResult ParseDocument(impl::Document& json,
+                                     std::string_view doc) {
+  auto buffer = local_parse_buffer.Use();
+  buffer->reserve(doc.size() + kSimdPadding);
+  buffer->assign(doc);
+  buffer->append(kSimdPadding, '\0');
+
+  rapidjson::ParseResult result =
+      json.Parse<kParseFlags>(buffer->c_str());
+
+  if (buffer->capacity() > kMaxCachedParseBufferSize) {
+    buffer->clear();
+    buffer->shrink_to_fit();
+  }
+  return result;
+}
+#else
+rapidjson::ParseResult ParseDocument(impl::Document& json,
+                                     std::string_view doc) {
+  return json.Parse<kParseFlags>(doc.data(), doc.size());
+}
+#endif
 
 std::string_view AsStringView(const impl::Value& jval) {
   return {jval.GetString(), jval.GetStringLength()};
@@ -109,10 +149,7 @@ Value FromString(std::string_view doc) {
   }
 
   impl::Document json{&g_allocator};
-  rapidjson::ParseResult ok =
-      json.Parse<rapidjson::kParseDefaultFlags |
-                 rapidjson::kParseIterativeFlag |
-                 rapidjson::kParseFullPrecisionFlag>(doc.data(), doc.size());
+  rapidjson::ParseResult ok = ParseDocument(json, doc);
   if (!ok) {
     const auto offset = ok.Offset();
     const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
@@ -137,9 +174,7 @@ Value FromStream(std::istream& is) {
   rapidjson::IStreamWrapper in(is);
   impl::Document json{&g_allocator};
   rapidjson::ParseResult ok =
-      json.ParseStream<rapidjson::kParseDefaultFlags |
-                       rapidjson::kParseIterativeFlag |
-                       rapidjson::kParseFullPrecisionFlag>(in);
+      json.ParseStream<kParseFlags>(in);
   if (!ok) {
     throw ParseException(fmt::format("JSON parse error at offset {}: {}",
                                      ok.Offset(),
@@ -151,7 +186,7 @@ Value FromStream(std::istream& is) {
 
 void Serialize(const Value& doc, std::ostream& os) {
   rapidjson::OStreamWrapper out{os};
-  rapidjson::Writer writer(out);
+  impl::Writer writer(out);
   AcceptNoRecursion(doc.GetNative(), writer);
   if (!os) {
     throw BadStreamException(os);
@@ -160,7 +195,7 @@ void Serialize(const Value& doc, std::ostream& os) {
 
 std::string ToString(const Value& doc) {
   rapidjson::StringBuffer buffer;
-  rapidjson::Writer writer(buffer);
+  impl::Writer writer(buffer);
   AcceptNoRecursion(doc.GetNative(), writer);
   return std::string{buffer.GetString(), buffer.GetLength()};
 }
@@ -174,7 +209,7 @@ std::string ToStableString(Value&& doc) {
     Value value = std::move(doc);
 
     rapidjson::StringBuffer buffer;
-    rapidjson::Writer writer(buffer);
+    impl::Writer writer(buffer);
     AcceptNoRecursion<ObjectProcessing::kInplaceSorting>(value.GetNative(),
                                                          writer);
     return std::string{buffer.GetString(), buffer.GetLength()};
@@ -185,7 +220,7 @@ std::string ToStableString(Value&& doc) {
 std::string ToPrettyString(const formats::json::Value& doc,
                            PrettyFormat format) {
   rapidjson::StringBuffer buffer;
-  rapidjson::PrettyWriter writer(buffer);
+  impl::PrettyWriter writer(buffer);
   writer.SetIndent(format.indent_char, format.indent_char_count);
   // TODO add kInplaceSorting
   AcceptNoRecursion<ObjectProcessing::kNone>(doc.GetNative(), writer);
@@ -194,7 +229,7 @@ std::string ToPrettyString(const formats::json::Value& doc,
 
 logging::LogHelper& operator<<(logging::LogHelper& lh, const Value& doc) {
   rapidjson::StringBuffer buffer;
-  rapidjson::Writer writer(buffer);
+  impl::Writer writer(buffer);
   AcceptNoRecursion(doc.GetNative(), writer);
   return lh << std::string_view{buffer.GetString(), buffer.GetLength()};
 }
@@ -220,7 +255,7 @@ struct StringBuffer::Impl final {
 };
 
 StringBuffer::StringBuffer(const formats::json::Value& value) {
-  rapidjson::Writer writer(pimpl_->buffer);
+  impl::Writer writer(pimpl_->buffer);
   AcceptNoRecursion(value.GetNative(), writer);
 }
 
@@ -4,6 +4,7 @@
 #include <benchmark/benchmark.h>
 #include <rapidjson/document.h>
 
+#include <userver/formats/json/arena.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value.hpp>
@@ -12,6 +13,7 @@
 #include <userver/formats/parse/variant.hpp>
 #include <userver/formats/serialize/common_containers.hpp>
 #include <userver/formats/serialize/variant.hpp>
+#include <utils/gbench_allocations.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -1135,6 +1137,7 @@ constexpr std::string_view str_deep_width_json = R"({
 
 // json with approximately 6 nodes
 void SmallJson(benchmark::State& state) {
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     auto json = formats::json::FromString(str_small_json);
     benchmark::DoNotOptimize(json);
@@ -1144,6 +1147,7 @@ void SmallJson(benchmark::State& state) {
 // json consists of 3 objects each of which consists of approximately 5 children
 // nodes
 void MiddleJson(benchmark::State& state) {
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     auto json = formats::json::FromString(str_middle_json);
     benchmark::DoNotOptimize(json);
@@ -1153,6 +1157,7 @@ void MiddleJson(benchmark::State& state) {
 // json consists of one object of 40 nodes and several objects each of which
 // consists of approximately 7 children nodes
 void WidthJson(benchmark::State& state) {
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     auto json = formats::json::FromString(str_width_json);
     benchmark::DoNotOptimize(json);
@@ -1161,6 +1166,7 @@ void WidthJson(benchmark::State& state) {
 
 // json consists of 500 levels each of which is a key and a value
 void DeepJson(benchmark::State& state) {
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     auto json = formats::json::FromString(str_deep_json);
     benchmark::DoNotOptimize(json);
@@ -1169,6 +1175,7 @@ void DeepJson(benchmark::State& state) {
 
 // json consists of 800 nodes and approximately 9 depth levels
 void DeepWidthJson(benchmark::State& state) {
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     auto json = formats::json::FromString(str_deep_width_json);
     benchmark::DoNotOptimize(json);
@@ -1185,6 +1192,28 @@ BENCHMARK(DeepJson);
 
 BENCHMARK(DeepWidthJson);
 
+// Same as DeepWidthJson, but each document is parsed in its own arena
+void DeepWidthJsonArena(benchmark::State& state) {
+  std::size_t allocations = 0;
+  std::size_t chunks = 0;
+  const utils::bench::AllocationsReporter allocations_reporter{state};
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::ArenaScope arena{str_deep_width_json.size()};
+    auto json = formats::json::FromString(str_deep_width_json);
+    benchmark::DoNotOptimize(json);
+
+    const auto stats = arena.GetStatistics();
+    allocations += stats.allocations;
+    chunks += stats.chunks;
+  }
+  state.counters["allocations"] =
+      benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+  state.counters["chunks"] =
+      benchmark::Counter(chunks, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(DeepWidthJsonArena);
+
 namespace {
 
 struct InnerObject final {
@@ -1253,6 +1282,7 @@ void JsonArrayToVariantParseBenchmark(benchmark::State& state) {
   const PairOfArrays data{array, array};
   const auto json_data = formats::json::ValueBuilder{data}.ExtractValue();
 
+  const utils::bench::AllocationsReporter allocations_reporter{state};
   for ([[maybe_unused]] auto _ : state) {
     benchmark::DoNotOptimize(json_data.As<PairOfArrays>());
   }
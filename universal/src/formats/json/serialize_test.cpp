@@ -327,6 +327,26 @@ TEST(JsonToPrettyStringCycle, IsPretty) {
   EXPECT_EQ(kPrettyJson, formats::json::ToPrettyString(json, format));
 }
 
+TEST(JsonToPrettyStringCycle, DoublesAsInToString) {
+  formats::json::ValueBuilder builder(formats::common::Type::kArray);
+  for (const double value : {2.0, 17317.94, 0.1 + 0.2, 1.5e-7, 1e21}) {
+    builder.PushBack(value);
+  }
+  const auto json = builder.ExtractValue();
+
+  static constexpr std::string_view kPrettyJson = R"([
+  2.0,
+  17317.94,
+  0.30000000000000004,
+  1.5e-7,
+  1e21
+])";
+
+  EXPECT_EQ(kPrettyJson, formats::json::ToPrettyString(json));
+  EXPECT_EQ(formats::json::ToString(json),
+            "[2.0,17317.94,0.30000000000000004,1.5e-7,1e21]");
+}
+
 // TODO make ToPrettyString sort object keys and re-enable.
 TEST(JsonToPrettyStringCycle, DISABLED_SortsObjectKeys) {
   static constexpr std::string_view kInitialJson = R"({"c":1,"b":1,"a":1})";
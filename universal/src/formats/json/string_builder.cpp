@@ -8,6 +8,7 @@
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/writer.hpp>
 #include <userver/formats/common/validations.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/value.hpp>
@@ -20,7 +21,7 @@ namespace formats::json {
 
 struct StringBuilder::Impl {
   rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+  impl::Writer<rapidjson::StringBuffer> writer{buffer};
 
   Impl() = default;
 };
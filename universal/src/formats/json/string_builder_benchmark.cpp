@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
 
@@ -74,4 +76,22 @@ void JsonStringBuilder(benchmark::State& state) {
 }
 BENCHMARK(JsonStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
 
+void JsonStringBuilderDoubles(benchmark::State& state) {
+  // Price-like values with two decimal places and full-precision ones
+  std::vector<double> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back(state.range(0) ? i * 1.37 + 0.01 : 1.0 / (i + 3));
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    StringBuilder sw;
+    {
+      StringBuilder::ArrayGuard guard(sw);
+      for (const auto value : values) sw.WriteDouble(value);
+    }
+    benchmark::DoNotOptimize(sw.GetStringView());
+  }
+}
+BENCHMARK(JsonStringBuilderDoubles)->Arg(0)->Arg(1);
+
 USERVER_NAMESPACE_END
@@ -2,6 +2,8 @@
 
 #include <array>
 #include <cstring>
+#include <string_view>
+#include <utility>
 
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/serialize_duration.hpp>
@@ -121,6 +123,31 @@ TEST(JsonStringBuilder, Double) {
   EXPECT_EQ("12.3", sw.GetString());
 }
 
+TEST(JsonStringBuilder, DoubleFormatting) {
+  // Same layout as the RapidJSON, with the shortest round-trip digits
+  const std::pair<double, std::string_view> kCases[] = {
+      {0.0, "0.0"},
+      {-0.0, "-0.0"},
+      {2.0, "2.0"},
+      {-4.5, "-4.5"},
+      {17317.94, "17317.94"},
+      {0.1 + 0.2, "0.30000000000000004"},
+      {0.001234, "0.001234"},
+      {1.5e-7, "1.5e-7"},
+      {1e21, "1e21"},
+      {123456789012345678901.0, "123456789012345680000.0"},
+      {1.7976931348623157e308, "1.7976931348623157e308"},
+      {5e-324, "5e-324"},
+  };
+
+  for (const auto& [value, expected] : kCases) {
+    StringBuilder sw;
+    sw.WriteDouble(value);
+    EXPECT_EQ(sw.GetStringView(), expected);
+    EXPECT_EQ(FromString(sw.GetStringView()).As<double>(), value);
+  }
+}
+
 TEST(JsonStringBuilder, Object) {
   StringBuilder sw;
   {
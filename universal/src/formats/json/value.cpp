@@ -35,7 +35,7 @@ static_assert(std::numeric_limits<double>::digits <
               "Your compiler provides unusually large double, please contact "
               "userver support chat");
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
 
 template <typename T>
 auto CheckedNotTooNegative(T x, const Value& value) {
@@ -306,6 +306,14 @@ std::string Parse(const Value& value, parse::To<std::string>) {
                               value.GetPath());
 }
 
+std::string_view Parse(const Value& value, parse::To<std::string_view>) {
+  value.CheckNotMissing();
+  const auto& native = value.GetNative();
+  if (native.IsString()) return {native.GetString(), native.GetStringLength()};
+  throw TypeMismatchException(value.GetExtendedType(), impl::stringValue,
+                              value.GetPath());
+}
+
 template <>
 bool Value::ConvertTo<bool>() const {
   if (IsMissing()) return false;
@@ -34,7 +34,7 @@ rapidjson::Type ToNativeType(Type type) {
   }
 }
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
 
 }  // namespace
 
@@ -135,6 +135,21 @@ TEST(FormatsJson, NulString) {
   ASSERT_EQ(i_contain_nuls, s);
 }
 
+TEST(FormatsJson, StringView) {
+  const auto json = formats::json::FromString(R"({"short": "a", "long": )"
+                                              R"("a string out of SSO"})");
+  EXPECT_EQ(json["short"].As<std::string_view>(), "a");
+  const auto view = json["long"].As<std::string_view>();
+  EXPECT_EQ(view, "a string out of SSO");
+  // Viewed in place, not copied
+  EXPECT_EQ(view.data(), json["long"].As<std::string_view>().data());
+
+  EXPECT_THROW(json["missing"].As<std::string_view>(),
+               formats::json::MemberMissingException);
+  EXPECT_THROW(json.As<std::string_view>(),
+               formats::json::TypeMismatchException);
+}
+
 TEST(FormatsJson, NullAsDefaulted) {
   using formats::json::FromString;
   auto json = FromString(R"~({"nulled": null})~");
@@ -63,6 +63,14 @@ int ToNative(OpenMode flags) {
     result |= O_APPEND;
   }
 
+  if (flags & OpenFlag::kDirect) {
+#ifdef O_DIRECT
+    result |= O_DIRECT;
+#else
+    UINVARIANT(false, "kDirect is not supported on this platform");
+#endif
+  }
+
   return result;
 }
 
@@ -1,6 +1,13 @@
 #include <userver/http/url.hpp>
 
 #include <array>
+#include <cctype>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 #include <utils/impl/internal_tag.hpp>
 
@@ -12,33 +19,129 @@ namespace {
 
 const std::string_view kSchemaSeparator = "://";
 
+bool IsUnreserved(char symbol) noexcept {
+  if (isalnum(symbol)) return true;
+  switch (symbol) {
+    case '-':
+    case '_':
+    case '.':
+    case '!':
+    case '~':
+    case '*':
+    case '(':
+    case ')':
+    case '\'':
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if defined(__SSE2__)
+// Signed comparisons are fine for the ASCII ranges, the bytes over 0x7f are
+// negative and are out of any such range
+__m128i InRange(__m128i chars, char low, char high) noexcept {
+  return _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(low - 1)),
+                       _mm_cmpgt_epi8(_mm_set1_epi8(high + 1), chars));
+}
+
+// Bit mask of the symbols that IsUnreserved() accepts
+unsigned GetUnreservedMask(const char* block) noexcept {
+  const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+  const auto alnum = _mm_or_si128(
+      _mm_or_si128(InRange(chars, 'a', 'z'), InRange(chars, 'A', 'Z')),
+      InRange(chars, '0', '9'));
+  // '\'', '(', ')', '*' and '-', '.' are contiguous
+  const auto ranges = _mm_or_si128(InRange(chars, '\'', '*'),
+                                   InRange(chars, '-', '.'));
+  const auto others = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('!')),
+                   _mm_cmpeq_epi8(chars, _mm_set1_epi8('_'))),
+      _mm_cmpeq_epi8(chars, _mm_set1_epi8('~')));
+  return _mm_movemask_epi8(
+      _mm_or_si128(_mm_or_si128(alnum, ranges), others));
+}
+
+// Bit mask of the '%' and '+' symbols
+unsigned GetEscapesMask(const char* block) noexcept {
+  const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+  return _mm_movemask_epi8(
+      _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('%')),
+                   _mm_cmpeq_epi8(chars, _mm_set1_epi8('+'))));
+}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+uint8x16_t InRange(uint8x16_t chars, char low, char high) noexcept {
+  return vandq_u8(vcgeq_u8(chars, vdupq_n_u8(low)),
+                  vcleq_u8(chars, vdupq_n_u8(high)));
+}
+
+bool AllUnreserved(const char* block) noexcept {
+  const auto chars = vld1q_u8(reinterpret_cast<const uint8_t*>(block));
+  const auto alnum = vorrq_u8(
+      vorrq_u8(InRange(chars, 'a', 'z'), InRange(chars, 'A', 'Z')),
+      InRange(chars, '0', '9'));
+  // '\'', '(', ')', '*' and '-', '.' are contiguous
+  const auto ranges =
+      vorrq_u8(InRange(chars, '\'', '*'), InRange(chars, '-', '.'));
+  const auto others =
+      vorrq_u8(vorrq_u8(vceqq_u8(chars, vdupq_n_u8('!')),
+                        vceqq_u8(chars, vdupq_n_u8('_'))),
+               vceqq_u8(chars, vdupq_n_u8('~')));
+  return vminvq_u8(vorrq_u8(vorrq_u8(alnum, ranges), others)) != 0;
+}
+
+bool HasEscapes(const char* block) noexcept {
+  const auto chars = vld1q_u8(reinterpret_cast<const uint8_t*>(block));
+  return vmaxvq_u8(vorrq_u8(vceqq_u8(chars, vdupq_n_u8('%')),
+                            vceqq_u8(chars, vdupq_n_u8('+')))) != 0;
+}
+#endif
+
+// Returns the end of the longest prefix of symbols that are not encoded
+const char* FindReserved(const char* first, const char* last) noexcept {
+#if defined(__SSE2__)
+  for (; last - first >= 16; first += 16) {
+    const auto mask = GetUnreservedMask(first);
+    if (mask != 0xffff) return first + __builtin_ctz(~mask);
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  while (last - first >= 16 && AllUnreserved(first)) first += 16;
+#endif
+  while (first != last && IsUnreserved(*first)) ++first;
+  return first;
+}
+
+// Returns the first '%' or '+'
+const char* FindEscape(const char* first, const char* last) noexcept {
+#if defined(__SSE2__)
+  for (; last - first >= 16; first += 16) {
+    const auto mask = GetEscapesMask(first);
+    if (mask != 0) return first + __builtin_ctz(mask);
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  while (last - first >= 16 && !HasEscapes(first)) first += 16;
+#endif
+  while (first != last && *first != '%' && *first != '+') ++first;
+  return first;
+}
+
 void UrlEncodeTo(std::string_view input_string, std::string& result) {
-  for (char symbol : input_string) {
-    if (isalnum(symbol)) {
-      result.append(1, symbol);
-      continue;
-    }
-    switch (symbol) {
-      case '-':
-      case '_':
-      case '.':
-      case '!':
-      case '~':
-      case '*':
-      case '(':
-      case ')':
-      case '\'':
-        result.append(1, symbol);
-        break;
-      default:
-        std::array<char, 3> bytes = {'%', 0, 0};
-        bytes[1] = (symbol & 0xF0) / 16;
-        bytes[1] += (bytes[1] > 9) ? 'A' - 10 : '0';
-        bytes[2] = symbol & 0x0F;
-        bytes[2] += (bytes[2] > 9) ? 'A' - 10 : '0';
-        result.append(bytes.data(), bytes.size());
-        break;
-    }
+  const char* first = input_string.data();
+  const char* last = first + input_string.size();
+  while (first != last) {
+    // The unreserved symbols are copied in runs
+    const char* reserved = FindReserved(first, last);
+    result.append(first, reserved);
+    if (reserved == last) break;
+
+    const char symbol = *reserved;
+    std::array<char, 3> bytes = {'%', 0, 0};
+    bytes[1] = (symbol & 0xF0) / 16;
+    bytes[1] += (bytes[1] > 9) ? 'A' - 10 : '0';
+    bytes[2] = symbol & 0x0F;
+    bytes[2] += (bytes[2] > 9) ? 'A' - 10 : '0';
+    result.append(bytes.data(), bytes.size());
+    first = reserved + 1;
   }
 }
 
@@ -201,9 +304,17 @@ namespace impl {
 
 std::string UrlDecode(utils::impl::InternalTag, std::string_view range) {
   std::string result;
-  result.reserve(range.size() / 3);
+  // Decoding never makes the data longer
+  result.reserve(range.size());
+
+  const char* end = range.data() + range.size();
+  for (const char* i = range.data(); i != end; ++i) {
+    // The symbols that are not escapes are copied in runs
+    const char* escape = FindEscape(i, end);
+    result.append(i, escape);
+    i = escape;
+    if (i == end) break;
 
-  for (const char *i = range.begin(), *end = range.end(); i != end; ++i) {
     switch (*i) {
       case '+':
         result.append(1, ' ');
@@ -40,4 +40,30 @@ void make_query(benchmark::State& state) {
 }
 BENCHMARK(make_query)->RangeMultiplier(2)->Range(1, 256);
 
+void url_encode(benchmark::State& state) {
+  std::string source;
+  for (int i = 0; i < state.range(0); ++i) {
+    // Mostly unreserved symbols with some to encode, like in the queries
+    source.push_back(static_cast<char>(i % 17 == 16 ? ' ' : 'a' + i % 26));
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(http::UrlEncode(source));
+  }
+}
+BENCHMARK(url_encode)->RangeMultiplier(4)->Range(8, 8192);
+
+void url_decode(benchmark::State& state) {
+  std::string source;
+  for (int i = 0; i < state.range(0); ++i) {
+    source.push_back(static_cast<char>(i % 17 == 16 ? '+' : 'a' + i % 26));
+  }
+  source.append("%20%2F");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(http::UrlDecode(source));
+  }
+}
+BENCHMARK(url_decode)->RangeMultiplier(4)->Range(8, 8192);
+
 USERVER_NAMESPACE_END
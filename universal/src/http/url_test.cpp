@@ -1,3 +1,4 @@
+#include <string>
 #include <string_view>
 
 #include <gtest/gtest.h>
@@ -29,6 +30,19 @@ TEST(UrlEncode, Special) {
   EXPECT_EQ("Text%20with%20spaces%2C%3F%26%3D", UrlEncode(str));
 }
 
+TEST(UrlEncode, Long) {
+  // Longer than the SIMD blocks, with the symbols to encode at all positions
+  std::string str;
+  std::string expected;
+  for (int i = 0; i < 100; ++i) {
+    str.append(i % 40, 'a').append(" ");
+    expected.append(i % 40, 'a').append("%20");
+  }
+  EXPECT_EQ(expected, UrlEncode(str));
+  EXPECT_EQ(str, UrlDecode(expected));
+  EXPECT_EQ("%80%FF-_.!~*()'%2C", UrlEncode("\x80\xff-_.!~*()',"));
+}
+
 TEST(UrlDecode, Empty) { EXPECT_EQ("", UrlDecode("")); }
 
 TEST(UrlDecode, Latin) {
@@ -0,0 +1,113 @@
+#include <logging/binary_record.hpp>
+
+#include <cstring>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+class BinaryRecordReader final {
+ public:
+  explicit BinaryRecordReader(std::string_view record) : record_(record) {}
+
+  bool IsFinished() const noexcept { return record_.empty(); }
+
+  template <typename T>
+  T ReadNumber() {
+    UINVARIANT(record_.size() >= sizeof(T), "Truncated binary log record");
+    T result;
+    std::memcpy(&result, record_.data(), sizeof(T));
+    record_.remove_prefix(sizeof(T));
+    return result;
+  }
+
+  std::string_view ReadString() {
+    const auto size = ReadNumber<BinaryStringSize>();
+    UINVARIANT(record_.size() >= size, "Truncated binary log record");
+    const auto result = record_.substr(0, size);
+    record_.remove_prefix(size);
+    return result;
+  }
+
+ private:
+  std::string_view record_;
+};
+
+char GetSeparator(Format format) {
+  return format == Format::kLtsv ? ':' : '=';
+}
+
+}  // namespace
+
+bool IsBinaryRecord(std::string_view message) noexcept {
+  return !message.empty() && message.front() == kBinaryRecordMagic;
+}
+
+void FormatBinaryRecord(std::string_view record, Format format,
+                        LogBuffer& result) {
+  UASSERT(IsBinaryRecord(record));
+  BinaryRecordReader reader{record.substr(1)};
+
+  const auto level = static_cast<Level>(reader.ReadNumber<char>());
+  const auto timestamp = std::chrono::system_clock::time_point{
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          std::chrono::microseconds{reader.ReadNumber<BinaryTimestamp>()})};
+  PutMessageBegin(result, format, level, timestamp);
+
+  const auto separator = GetSeparator(format);
+  while (!reader.IsFinished()) {
+    switch (reader.ReadNumber<BinaryToken>()) {
+      case BinaryToken::kKey:
+        result.push_back(utils::encoding::kTskvPairsSeparator);
+        utils::encoding::EncodeTskv(
+            result, reader.ReadString(),
+            utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+        result.push_back(separator);
+        break;
+      case BinaryToken::kRawKey:
+        result.push_back(utils::encoding::kTskvPairsSeparator);
+        result.append(reader.ReadString());
+        result.push_back(separator);
+        break;
+      case BinaryToken::kText:
+        utils::encoding::EncodeTskv(result, reader.ReadString(),
+                                    utils::encoding::EncodeTskvMode::kValue);
+        break;
+      case BinaryToken::kRaw:
+        result.append(reader.ReadString());
+        break;
+      case BinaryToken::kSigned:
+        fmt::format_to(fmt::appender(result), FMT_COMPILE("{}"),
+                       reader.ReadNumber<long long>());
+        break;
+      case BinaryToken::kUnsigned:
+        fmt::format_to(fmt::appender(result), FMT_COMPILE("{}"),
+                       reader.ReadNumber<unsigned long long>());
+        break;
+      case BinaryToken::kFloat:
+        fmt::format_to(fmt::appender(result), FMT_COMPILE("{}"),
+                       reader.ReadNumber<float>());
+        break;
+      case BinaryToken::kDouble:
+        fmt::format_to(fmt::appender(result), FMT_COMPILE("{}"),
+                       reader.ReadNumber<double>());
+        break;
+      default:
+        UINVARIANT(false, "Unknown token in a binary log record");
+    }
+  }
+
+  result.push_back('\n');
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include <logging/log_helper_impl.hpp>
+#include <userver/logging/format.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+// Loggers with deferred formatting receive the messages as binary records,
+// that are formatted into text on the consumer side. The hot path only copies
+// the bytes, while the escaping, the timestamp formatting and the formatting
+// of numbers are done by FormatBinaryRecord.
+//
+// Record layout (native byte order, the record never leaves the process):
+//   kBinaryRecordMagic, level (1 byte), timestamp (int64 microseconds)
+//   tokens: BinaryToken (1 byte) + payload
+//     string tokens: uint32 size + bytes
+//     number tokens: the value bytes
+inline constexpr char kBinaryRecordMagic = '\0';
+
+enum class BinaryToken : char {
+  kKey,       // string, needs escaping
+  kRawKey,    // string
+  kText,      // string, value part that needs escaping
+  kRaw,       // string, value part that needs no escaping
+  kSigned,    // long long
+  kUnsigned,  // unsigned long long
+  kFloat,     // float
+  kDouble,    // double
+};
+
+using BinaryStringSize = std::uint32_t;
+using BinaryTimestamp = std::int64_t;
+
+inline constexpr std::size_t kBinaryRecordHeaderSize =
+    1 + 1 + sizeof(BinaryTimestamp);
+
+/// Text log records and LogRaw messages never start with the magic byte
+bool IsBinaryRecord(std::string_view message) noexcept;
+
+/// Appends the text record in the `format` for the binary record, as if the
+/// message was formatted by the LogHelper itself
+void FormatBinaryRecord(std::string_view record, Format format,
+                        LogBuffer& result);
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
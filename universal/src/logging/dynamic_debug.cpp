@@ -48,8 +48,11 @@ bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
   return x.line == y.line && std::strcmp(x.path, y.path) == 0;
 }
 
-void AddDynamicDebugLog(const std::string& location_relative, int line,
-                        EntryState state) {
+namespace {
+
+template <typename Func>
+void ForEachLocation(const std::string& location_relative, int line,
+                     Func func) {
   utils::impl::AssertStaticRegistrationFinished();
 
   auto& all_locations = GetAllLocations();
@@ -66,18 +69,27 @@ void AddDynamicDebugLog(const std::string& location_relative, int line,
       ThrowUnknownDynamicLogLocation(location_relative, line);
     }
 
-    it_lower->state.store(state);
+    func(*it_lower);
     return;
   } else {
     for (; it_lower != all_locations.end(); ++it_lower) {
       if (std::strncmp(it_lower->path, location_relative.c_str(),
                        location_relative.size()) != 0)
         break;
-      it_lower->state.store(state);
+      func(*it_lower);
     }
   }
 }
 
+}  // namespace
+
+void AddDynamicDebugLog(const std::string& location_relative, int line,
+                        EntryState state) {
+  ForEachLocation(location_relative, line, [state](LogEntryContent& entry) {
+    entry.state.store(state);
+  });
+}
+
 void RemoveDynamicDebugLog(const std::string& location_relative, int line) {
   utils::impl::AssertStaticRegistrationFinished();
   auto& all_locations = GetAllLocations();
@@ -92,6 +104,20 @@ void RemoveDynamicDebugLog(const std::string& location_relative, int line) {
   }
 }
 
+void SetLogLimit(const std::string& location_relative, int line,
+                 LogLimit limit) {
+  ForEachLocation(location_relative, line, [limit](LogEntryContent& entry) {
+    entry.limit.store(limit);
+  });
+}
+
+void ResetLogLimits() {
+  utils::impl::AssertStaticRegistrationFinished();
+  for (auto& entry : GetAllLocations()) {
+    entry.limit.store(LogLimit{});
+  }
+}
+
 const LogEntryContentSet& GetDynamicDebugLocations() {
   utils::impl::AssertStaticRegistrationFinished();
   return GetAllLocations();
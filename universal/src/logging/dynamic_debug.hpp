@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <string_view>
 
 #include <boost/intrusive/set.hpp>
@@ -25,6 +26,15 @@ Level GetForceDisabledLevelPlusOne(Level level);
 
 static_assert(std::atomic<EntryState>::is_always_lock_free);
 
+// Per-location override of the LOG_LIMITED rate limit, zeros mean the
+// defaults of components::LoggingConfigurator
+struct alignas(2 * sizeof(std::uint32_t)) LogLimit {
+  std::uint32_t interval_ms{0};
+  std::uint32_t max_per_interval{0};
+};
+
+static_assert(std::atomic<LogLimit>::is_always_lock_free);
+
 using LogEntryContentHook =
     bi::set_base_hook<bi::optimize_size<true>, bi::link_mode<bi::normal_link>>;
 
@@ -32,7 +42,11 @@ struct LogEntryContent {
   LogEntryContent(const char* path, int line) noexcept
       : line(line), path(path) {}
 
+  // LOG_LIMITED messages dropped since the last summary
+  mutable std::atomic<std::uint64_t> limited_dropped{0};
+  std::atomic<LogLimit> limit{};
   std::atomic<EntryState> state{};
+  mutable std::atomic<Level> limited_level{Level::kNone};
   const int line;
   const char* const path;
   LogEntryContentHook hook;
@@ -57,6 +71,11 @@ void AddDynamicDebugLog(const std::string& location_relative, int line,
 
 void RemoveDynamicDebugLog(const std::string& location_relative, int line);
 
+void SetLogLimit(const std::string& location_relative, int line,
+                 LogLimit limit);
+
+void ResetLogLimits();
+
 const LogEntryContentSet& GetDynamicDebugLocations();
 
 void RegisterLogLocation(LogEntryContent& location);
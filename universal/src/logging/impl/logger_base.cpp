@@ -18,6 +18,10 @@ void LoggerBase::PrependCommonTags(TagWriter /*writer*/) const {}
 
 Format LoggerBase::GetFormat() const noexcept { return format_; }
 
+bool LoggerBase::IsFormattingDeferred() const noexcept {
+  return is_formatting_deferred_;
+}
+
 void LoggerBase::SetLevel(Level level) { level_ = level; }
 
 Level LoggerBase::GetLevel() const noexcept { return level_; }
@@ -36,6 +40,10 @@ void LoggerBase::ForwardTo(LoggerBase*) {}
 
 bool LoggerBase::DoShouldLog(Level /*level*/) const noexcept { return true; }
 
+void LoggerBase::SetFormattingDeferred(bool deferred) noexcept {
+  is_formatting_deferred_ = deferred;
+}
+
 bool ShouldLogNoSpan(const LoggerBase& logger, Level level) noexcept {
   return logger.GetLevel() <= level && level != Level::kNone;
 }
@@ -32,7 +32,29 @@ void TagWriter::PutLogExtra(const LogExtra& extra) {
 }
 
 void TagWriter::ExtendLogExtra(const LogExtra& extra) {
-  lh_.pimpl_->GetLogExtra().Extend(extra);
+  auto& impl = *lh_.pimpl_;
+  if (!impl.GetInheritedLogExtra() && impl.GetLogExtra().extra_->empty()) {
+    impl.SetInheritedLogExtra(extra);
+    return;
+  }
+  impl.GetLogExtra().Extend(extra);
+}
+
+void TagWriter::PutLogExtra(const LogExtra& extra, const LogExtra& inherited) {
+  if (extra.extra_->empty()) {
+    PutLogExtra(inherited);
+    return;
+  }
+
+  for (const auto& item : *inherited.extra_) {
+    if (!item.second.IsFrozen() && extra.Find(item.first)) continue;
+    PutTag(RuntimeTagKey{item.first}, item.second.GetValue());
+  }
+  for (const auto& item : *extra.extra_) {
+    const auto* inherited_item = inherited.Find(item.first);
+    if (inherited_item && inherited_item->second.IsFrozen()) continue;
+    PutTag(RuntimeTagKey{item.first}, item.second.GetValue());
+  }
 }
 
 TagWriter::TagWriter(LogHelper& lh) noexcept : lh_(lh) {}
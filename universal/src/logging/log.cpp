@@ -104,14 +104,26 @@ void LogFlush(LoggerRef logger) { logger.Flush(); }
 
 namespace impl {
 
-RateLimiter::RateLimiter(RateLimitData& data, Level level) noexcept
+RateLimiter::RateLimiter(const StaticLogEntry& entry, RateLimitData& data,
+                         LoggerRef logger, Level level) noexcept
     : level_(level) {
+  if (entry.ShouldNotLog(logger, level)) {
+    should_log_ = false;
+    return;
+  }
+
   try {
-    if (!impl::IsLogLimitedEnabled()) {
+    const auto& content =
+        reinterpret_cast<const LogEntryContent&>(entry.content_);
+    const auto limit = content.limit.load(std::memory_order_relaxed);
+    const bool has_custom_limit = limit.max_per_interval != 0;
+    if (!has_custom_limit && !impl::IsLogLimitedEnabled()) {
       return;
     }
 
-    const auto reset_interval = impl::GetLogLimitedInterval();
+    const auto reset_interval =
+        limit.interval_ms != 0 ? std::chrono::milliseconds{limit.interval_ms}
+                               : impl::GetLogLimitedInterval();
     const auto now = std::chrono::steady_clock::now();
 
     if (now - data.last_reset_time >= reset_interval) {
@@ -119,12 +131,17 @@ RateLimiter::RateLimiter(RateLimitData& data, Level level) noexcept
       data.last_reset_time = now;
     }
 
-    if (IsPowerOf2(++data.count_since_reset)) {
+    const auto count = ++data.count_since_reset;
+    const bool should_log = has_custom_limit ? count <= limit.max_per_interval
+                                             : IsPowerOf2(count);
+    if (should_log) {
       // log the current message together with the dropped count
       dropped_count_ = std::exchange(data.dropped_count, 0);
     } else {
       // drop the current message
       ++data.dropped_count;
+      content.limited_level.store(level, std::memory_order_relaxed);
+      content.limited_dropped.fetch_add(1, std::memory_order_relaxed);
       should_log_ = false;
     }
   } catch (const std::exception& e) {
@@ -133,6 +150,11 @@ RateLimiter::RateLimiter(RateLimitData& data, Level level) noexcept
   }
 }
 
+RateLimiter::RateLimiter(const StaticLogEntry& entry, RateLimitData& data,
+                         const LoggerPtr& logger, Level level) noexcept
+    : RateLimiter(entry, data, logger ? *logger : logging::GetNullLogger(),
+                  level) {}
+
 LogHelper& operator<<(LogHelper& lh, const RateLimiter& rl) noexcept {
   if (rl.dropped_count_ != 0) {
     lh << "[" << rl.dropped_count_ << " logs dropped] ";
@@ -143,6 +165,7 @@ LogHelper& operator<<(LogHelper& lh, const RateLimiter& rl) noexcept {
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 StaticLogEntry::StaticLogEntry(const char* path, int line) noexcept {
   static_assert(sizeof(LogEntryContent) == sizeof(content_));
+  static_assert(alignof(LogEntryContent) <= alignof(StaticLogEntry));
   // static_assert(std::is_trivially_destructible_v<LogEntryContent>);
   auto* item = new (&content_) LogEntryContent(path, line);
   RegisterLogLocation(*item);
@@ -190,7 +190,11 @@ void LogHelper::DoLog() noexcept {
     if (pimpl_->IsWithinValue()) {
       pimpl_->MarkValueEnd();
     }
-    GetTagWriter().PutLogExtra(pimpl_->GetLogExtra());
+    if (const auto* inherited = pimpl_->GetInheritedLogExtra()) {
+      GetTagWriter().PutLogExtra(pimpl_->GetLogExtra(), *inherited);
+    } else {
+      GetTagWriter().PutLogExtra(pimpl_->GetLogExtra());
+    }
     pimpl_->PutMessageEnd();
 
     pimpl_->LogTheMessage();
@@ -329,25 +333,19 @@ LogHelper& LogHelper::operator<<(const LogExtra::Value& value) noexcept {
 }
 
 void LogHelper::PutFloatingPoint(float value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
+  pimpl_->PutFloatingPoint(value);
 }
 void LogHelper::PutFloatingPoint(double value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
+  pimpl_->PutFloatingPoint(value);
 }
 void LogHelper::PutFloatingPoint(long double value) {
   fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
                  FMT_COMPILE("{}"), value);
 }
 void LogHelper::PutUnsigned(unsigned long long value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
-}
-void LogHelper::PutSigned(long long value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
+  pimpl_->PutUnsigned(value);
 }
+void LogHelper::PutSigned(long long value) { pimpl_->PutSigned(value); }
 void LogHelper::PutBoolean(bool value) {
   fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
                  FMT_COMPILE("{}"), value);
@@ -1,6 +1,7 @@
 #include "log_helper_impl.hpp"
 
 #include <array>
+#include <cstring>
 
 #include <fmt/chrono.h>
 #include <fmt/compile.h>
@@ -12,6 +13,8 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
+#include <logging/binary_record.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging {
@@ -73,6 +76,45 @@ TimeString GetCurrentTimeString(TimePoint now) noexcept {
 
 }  // namespace
 
+namespace impl {
+
+void PutMessageBegin(LogBuffer& buffer, Format format, Level level,
+                     TimePoint now) {
+  const auto old_size = buffer.size();
+
+  switch (format) {
+    case Format::kTskv: {
+      constexpr std::string_view kTemplate =
+          "tskv\ttimestamp=0000-00-00T00:00:00.000000\tlevel=";
+      const auto level_string = logging::ToUpperCaseString(level);
+      buffer.resize(old_size + kTemplate.size() + level_string.size());
+      fmt::format_to(buffer.data() + old_size,
+                     FMT_COMPILE("tskv\ttimestamp={}.{:06}\tlevel={}"),
+                     GetCurrentTimeString(now).ToStringView(),
+                     FractionalMicroseconds(now), level_string);
+      return;
+    }
+    case Format::kLtsv: {
+      constexpr std::string_view kTemplate =
+          "timestamp:0000-00-00T00:00:00.000000\tlevel:";
+      const auto level_string = logging::ToUpperCaseString(level);
+      buffer.resize(old_size + kTemplate.size() + level_string.size());
+      fmt::format_to(buffer.data() + old_size,
+                     FMT_COMPILE("timestamp:{}.{:06}\tlevel:{}"),
+                     GetCurrentTimeString(now).ToStringView(),
+                     FractionalMicroseconds(now), level_string);
+      return;
+    }
+    case Format::kRaw: {
+      buffer.append(std::string_view{"tskv"});
+      return;
+    }
+  }
+  UASSERT_MSG(false, "Invalid value of Format enum");
+}
+
+}  // namespace impl
+
 auto LogHelper::Impl::BufferStd::overflow(int_type c) -> int_type {
   if (c == std::streambuf::traits_type::eof()) return c;
   impl_.PutValuePart(static_cast<char>(c));
@@ -88,7 +130,8 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s,
 LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     : logger_(&logger),
       level_(std::max(level, logger_->GetLevel())),
-      key_value_separator_(GetSeparatorFromLogger(*logger_)) {
+      key_value_separator_(GetSeparatorFromLogger(*logger_)),
+      is_binary_(logger_->IsFormattingDeferred()) {
   static_assert(sizeof(LogHelper::Impl) < 4096,
                 "Structures with size more than 4096 would consume at least "
                 "8KB memory in allocator.");
@@ -100,43 +143,37 @@ LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
 void LogHelper::Impl::PutMessageBegin() {
   UASSERT(msg_.size() == 0);
 
-  switch (logger_->GetFormat()) {
-    case Format::kTskv: {
-      constexpr std::string_view kTemplate =
-          "tskv\ttimestamp=0000-00-00T00:00:00.000000\tlevel=";
-      const auto now = TimePoint::clock::now();
-      const auto level_string = logging::ToUpperCaseString(level_);
-      msg_.resize(kTemplate.size() + level_string.size());
-      fmt::format_to(msg_.data(),
-                     FMT_COMPILE("tskv\ttimestamp={}.{:06}\tlevel={}"),
-                     GetCurrentTimeString(now).ToStringView(),
-                     FractionalMicroseconds(now), level_string);
-      return;
-    }
-    case Format::kLtsv: {
-      constexpr std::string_view kTemplate =
-          "timestamp:0000-00-00T00:00:00.000000\tlevel:";
-      const auto now = TimePoint::clock::now();
-      const auto level_string = logging::ToUpperCaseString(level_);
-      msg_.resize(kTemplate.size() + level_string.size());
-      fmt::format_to(msg_.data(), FMT_COMPILE("timestamp:{}.{:06}\tlevel:{}"),
-                     GetCurrentTimeString(now).ToStringView(),
-                     FractionalMicroseconds(now), level_string);
-      return;
-    }
-    case Format::kRaw: {
-      msg_.append(std::string_view{"tskv"});
-      return;
-    }
+  const auto now = TimePoint::clock::now();
+  if (!is_binary_) {
+    impl::PutMessageBegin(msg_, logger_->GetFormat(), level_, now);
+    return;
   }
-  UASSERT_MSG(false, "Invalid value of Format enum");
+
+  const impl::BinaryTimestamp timestamp =
+      std::chrono::time_point_cast<std::chrono::microseconds>(now)
+          .time_since_epoch()
+          .count();
+  msg_.resize(impl::kBinaryRecordHeaderSize);
+  msg_[0] = impl::kBinaryRecordMagic;
+  msg_[1] = static_cast<char>(level_);
+  std::memcpy(msg_.data() + 2, &timestamp, sizeof(timestamp));
 }
 
-void LogHelper::Impl::PutMessageEnd() { msg_.push_back('\n'); }
+void LogHelper::Impl::PutMessageEnd() {
+  if (is_binary_) {
+    CloseChunk();
+    return;
+  }
+  msg_.push_back('\n');
+}
 
 void LogHelper::Impl::PutKey(std::string_view key) {
   if (!utils::encoding::ShouldKeyBeEscaped(key)) {
     PutRawKey(key);
+  } else if (is_binary_) {
+    UASSERT(!std::exchange(is_within_value_, true));
+    CheckRepeatedKeys(key);
+    PutStringToken(impl::BinaryToken::kKey, key);
   } else {
     UASSERT(!std::exchange(is_within_value_, true));
     CheckRepeatedKeys(key);
@@ -150,6 +187,11 @@ void LogHelper::Impl::PutKey(std::string_view key) {
 void LogHelper::Impl::PutRawKey(std::string_view key) {
   UASSERT(!std::exchange(is_within_value_, true));
   CheckRepeatedKeys(key);
+  if (is_binary_) {
+    PutStringToken(impl::BinaryToken::kRawKey, key);
+    return;
+  }
+
   const auto old_size = msg_.size();
   msg_.resize(old_size + 1 + key.size() + 1);
 
@@ -162,23 +204,71 @@ void LogHelper::Impl::PutRawKey(std::string_view key) {
 
 void LogHelper::Impl::PutValuePart(std::string_view value) {
   UASSERT(is_within_value_);
+  if (is_binary_) {
+    OpenChunk(impl::BinaryToken::kText);
+    msg_.append(value);
+    return;
+  }
   utils::encoding::EncodeTskv(msg_, value,
                               utils::encoding::EncodeTskvMode::kValue);
 }
 
 void LogHelper::Impl::PutValuePart(char text_part) {
   UASSERT(is_within_value_);
+  if (is_binary_) {
+    OpenChunk(impl::BinaryToken::kText);
+    msg_.push_back(text_part);
+    return;
+  }
   utils::encoding::EncodeTskv(fmt::appender(msg_), text_part,
                               utils::encoding::EncodeTskvMode::kValue);
 }
 
-LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() noexcept {
+LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() {
   UASSERT(is_within_value_);
+  if (is_binary_) OpenChunk(impl::BinaryToken::kRaw);
   return msg_;
 }
 
+void LogHelper::Impl::PutSigned(long long value) {
+  if (is_binary_) {
+    PutNumberToken(impl::BinaryToken::kSigned, value);
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
+void LogHelper::Impl::PutUnsigned(unsigned long long value) {
+  if (is_binary_) {
+    PutNumberToken(impl::BinaryToken::kUnsigned, value);
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
+void LogHelper::Impl::PutFloatingPoint(float value) {
+  if (is_binary_) {
+    PutNumberToken(impl::BinaryToken::kFloat, value);
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
+void LogHelper::Impl::PutFloatingPoint(double value) {
+  if (is_binary_) {
+    PutNumberToken(impl::BinaryToken::kDouble, value);
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
 void LogHelper::Impl::MarkValueEnd() noexcept {
   UASSERT(std::exchange(is_within_value_, false));
+  if (is_binary_) CloseChunk();
 }
 
 void LogHelper::Impl::MarkAsTrace() noexcept { is_trace_ = true; }
@@ -213,6 +303,53 @@ void LogHelper::Impl::MarkAsBroken() noexcept { logger_ = nullptr; }
 
 bool LogHelper::Impl::IsBroken() const noexcept { return !logger_; }
 
+void LogHelper::Impl::OpenChunk(impl::BinaryToken token) {
+  UASSERT(is_binary_);
+  // Adjacent value parts of the same kind are merged into a single token
+  if (open_chunk_offset_ != 0 && open_chunk_token_ == token) return;
+
+  CloseChunk();
+  const auto old_size = msg_.size();
+  msg_.resize(old_size + 1 + sizeof(impl::BinaryStringSize));
+  msg_[old_size] = static_cast<char>(token);
+  open_chunk_offset_ = old_size + 1;
+  open_chunk_token_ = token;
+}
+
+void LogHelper::Impl::CloseChunk() noexcept {
+  if (open_chunk_offset_ == 0) return;
+
+  const auto data_offset = open_chunk_offset_ + sizeof(impl::BinaryStringSize);
+  const auto size =
+      static_cast<impl::BinaryStringSize>(msg_.size() - data_offset);
+  std::memcpy(msg_.data() + open_chunk_offset_, &size, sizeof(size));
+  open_chunk_offset_ = 0;
+}
+
+void LogHelper::Impl::PutStringToken(impl::BinaryToken token,
+                                     std::string_view value) {
+  CloseChunk();
+  const impl::BinaryStringSize size = value.size();
+  const auto old_size = msg_.size();
+  msg_.resize(old_size + 1 + sizeof(size) + value.size());
+
+  auto* position = msg_.data() + old_size;
+  *(position++) = static_cast<char>(token);
+  std::memcpy(position, &size, sizeof(size));
+  position += sizeof(size);
+  value.copy(position, value.size());
+}
+
+template <typename T>
+void LogHelper::Impl::PutNumberToken(impl::BinaryToken token, T value) {
+  UASSERT(is_within_value_);
+  CloseChunk();
+  const auto old_size = msg_.size();
+  msg_.resize(old_size + 1 + sizeof(value));
+  msg_[old_size] = static_cast<char>(token);
+  std::memcpy(msg_.data() + old_size + 1, &value, sizeof(value));
+}
+
 void LogHelper::Impl::CheckRepeatedKeys(
     [[maybe_unused]] std::string_view raw_key) {
   UASSERT_MSG(debug_tag_keys_->insert(std::string{raw_key}).second,
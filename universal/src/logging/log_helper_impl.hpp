@@ -1,11 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <ostream>
 #include <unordered_set>
 
 #include <fmt/format.h>
 
+#include <userver/logging/format.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/log_extra.hpp>
@@ -17,6 +19,16 @@ namespace logging {
 inline constexpr std::size_t kInitialLogBufferSize = 1500;
 using LogBuffer = fmt::basic_memory_buffer<char, kInitialLogBufferSize>;
 
+namespace impl {
+
+enum class BinaryToken : char;
+
+// Appends the timestamp and the level of a text log record
+void PutMessageBegin(LogBuffer& buffer, Format format, Level level,
+                     std::chrono::system_clock::time_point now);
+
+}  // namespace impl
+
 struct LogHelper::InternalTag final {};
 
 class LogHelper::Impl final {
@@ -35,13 +47,25 @@ class LogHelper::Impl final {
 
   void PutValuePart(std::string_view value);
   void PutValuePart(char text_part);
-  LogBuffer& GetBufferForRawValuePart() noexcept;
+  LogBuffer& GetBufferForRawValuePart();
+
+  void PutSigned(long long value);
+  void PutUnsigned(unsigned long long value);
+  void PutFloatingPoint(float value);
+  void PutFloatingPoint(double value);
 
   bool IsWithinValue() const noexcept { return is_within_value_; }
   void MarkValueEnd() noexcept;
 
   LogExtra& GetLogExtra() { return extra_; }
 
+  // Tags written together with the `extra_` ones without copying them, the
+  // `extra_` overrides their values that are not frozen
+  const LogExtra* GetInheritedLogExtra() const { return inherited_extra_; }
+  void SetInheritedLogExtra(const LogExtra& extra) {
+    inherited_extra_ = &extra;
+  }
+
   void StartText();
 
   std::size_t GetTextSize() const { return msg_.size() - initial_length_; }
@@ -80,13 +104,26 @@ class LogHelper::Impl final {
 
   void CheckRepeatedKeys(std::string_view raw_key);
 
+  // Binary records of the loggers with deferred formatting, see
+  // logging/binary_record.hpp
+  void OpenChunk(impl::BinaryToken token);
+  void CloseChunk() noexcept;
+  void PutStringToken(impl::BinaryToken token, std::string_view value);
+  template <typename T>
+  void PutNumberToken(impl::BinaryToken token, T value);
+
   impl::LoggerBase* logger_;
   const Level level_;
   const char key_value_separator_;
+  const bool is_binary_;
   LogBuffer msg_;
   std::optional<LazyInitedStream> lazy_stream_;
   LogExtra extra_;
+  const LogExtra* inherited_extra_{nullptr};
   std::size_t initial_length_{0};
+  // Offset of the size of the string token that is being written, 0 if none
+  std::size_t open_chunk_offset_{0};
+  impl::BinaryToken open_chunk_token_{};
   bool is_within_value_{false};
   bool is_trace_{false};
   std::optional<std::unordered_set<std::string>> debug_tag_keys_;
@@ -2,6 +2,10 @@
 
 #include <atomic>
 
+#include <logging/dynamic_debug.hpp>
+#include <userver/logging/log_helper.hpp>
+#include <userver/utils/impl/source_location.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
@@ -35,6 +39,27 @@ std::chrono::steady_clock::duration GetLogLimitedInterval() noexcept {
   return AtomicLogLimitedDuration().load();
 }
 
+std::uint64_t LogLimitedSummary() {
+  std::uint64_t total = 0;
+  for (const auto& entry : GetDynamicDebugLocations()) {
+    if (entry.limited_dropped.load(std::memory_order_relaxed) == 0) continue;
+
+    const auto dropped =
+        entry.limited_dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped == 0) continue;
+    total += dropped;
+
+    const auto level = entry.limited_level.load(std::memory_order_relaxed);
+    LogHelper(GetDefaultLogger(), level,
+              utils::impl::SourceLocation::Custom(
+                  static_cast<std::uint_least32_t>(entry.line), entry.path,
+                  {}))
+            .AsLvalue()
+        << "suppressed " << dropped << " messages during the last period";
+  }
+  return total;
+}
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,6 +15,11 @@ void SetLogLimitedInterval(std::chrono::steady_clock::duration d) noexcept;
 
 std::chrono::steady_clock::duration GetLogLimitedInterval() noexcept;
 
+/// Writes a "suppressed N messages" record to the default logger for each
+/// LOG_LIMITED location that dropped messages since the previous call.
+/// Returns the total count of suppressed messages.
+std::uint64_t LogLimitedSummary();
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
@@ -1,13 +1,12 @@
 #include <userver/utils/boost_uuid4.hpp>
 
 #include <array>
+#include <cstring>
 
-#include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
-#include <userver/compiler/thread_local.hpp>
-#include <userver/utils/rand.hpp>
+#include <utils/impl/random_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -101,19 +100,23 @@ boost::uuids::uuid FromChars(const char* begin, const char* end) {
   return u;
 }
 
-compiler::ThreadLocal local_uuid_generator = [] {
-  return WithDefaultRandom([](RandomBase& rng) {
-    return boost::uuids::basic_random_generator<RandomBase>(rng);
-  });
-};
-
 }  // namespace
 
 namespace generators {
 
 boost::uuids::uuid GenerateBoostUuid() {
-  auto generator = local_uuid_generator.Use();
-  return (*generator)();
+  boost::uuids::uuid uuid{};
+  {
+    auto pool = impl::UseLocalRandomPool();
+    const std::array<std::uint64_t, 2> random{pool->Next(), pool->Next()};
+    static_assert(sizeof(random) == boost::uuids::uuid::static_size());
+    std::memcpy(uuid.begin(), random.data(), sizeof(random));
+  }
+
+  // Same version and variant as boost::uuids::random_generator sets
+  uuid.data[6] = (uuid.data[6] & 0x0F) | 0x40;
+  uuid.data[8] = (uuid.data[8] & 0x3F) | 0x80;
+  return uuid;
 }
 
 }  // namespace generators
@@ -1,16 +1,13 @@
 #include <userver/utils/boost_uuid7.hpp>
 
 #include <chrono>
-#include <limits>
-
-#include <boost/random/uniform_int.hpp>
-#include <boost/random/variate_generator.hpp>
 
 #include <userver/compiler/thread_local.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
-#include <userver/utils/rand.hpp>
 #include <userver/utils/span.hpp>
 
+#include <utils/impl/random_pool.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -19,12 +16,6 @@ namespace {
 /// https://commitfest.postgresql.org/43/4388/
 class UuidV7Generator {
  public:
-  UuidV7Generator(utils::RandomBase& rng)
-      : random_generator_(&rng,
-                          boost::uniform_int<std::uint64_t>(
-                              std::numeric_limits<std::uint64_t>::min(),
-                              std::numeric_limits<std::uint64_t>::max())) {}
-
   boost::uuids::uuid operator()() {
     boost::uuids::uuid uuid{};
     auto current_timestamp = CurrentUnixTimestamp();
@@ -95,13 +86,15 @@ class UuidV7Generator {
   }
 
  private:
-  void GenerateRandomBlock(utils::span<std::uint8_t> block) {
+  static void GenerateRandomBlock(utils::span<std::uint8_t> block) {
+    auto pool = utils::impl::UseLocalRandomPool();
+
     int i = 0;
-    std::uint64_t random_value = random_generator_();
+    std::uint64_t random_value = pool->Next();
 
     for (auto it = block.begin(), end = block.end(); it != end; ++it, ++i) {
       if (i == sizeof(std::uint64_t)) {
-        random_value = random_generator_();
+        random_value = pool->Next();
         i = 0;
       }
 
@@ -116,10 +109,6 @@ class UuidV7Generator {
   }
 
  private:
-  boost::random::variate_generator<utils::RandomBase*,
-                                   boost::uniform_int<std::uint64_t>>
-      random_generator_;
-
   std::uint32_t sequence_counter_{0};
   std::uint64_t previous_timestamp_{0};
 
@@ -127,8 +116,7 @@ class UuidV7Generator {
 };
 
 compiler::ThreadLocal local_uuid_v7_generator = [] {
-  return utils::WithDefaultRandom(
-      [](utils::RandomBase& rng) { return UuidV7Generator(rng); });
+  return UuidV7Generator{};
 };
 
 }  // namespace
@@ -2,6 +2,7 @@
 
 #include <userver/utils/boost_uuid4.hpp>
 #include <userver/utils/boost_uuid7.hpp>
+#include <userver/utils/uuid4.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -13,6 +14,7 @@ void GenerateUuid(UuidGenerator generator, benchmark::State& state) {
       benchmark::ClobberMemory();
     }
   }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
 }
 
 void GenerateUuidV4(benchmark::State& state) {
@@ -23,7 +25,17 @@ void GenerateUuidV7(benchmark::State& state) {
   GenerateUuid(&utils::generators::GenerateBoostUuidV7, state);
 }
 
+void GenerateUuidV4String(benchmark::State& state) {
+  GenerateUuid(&utils::generators::GenerateUuid, state);
+}
+
 BENCHMARK(GenerateUuidV4)->RangeMultiplier(2)->Range(1, 1 << 12);
 BENCHMARK(GenerateUuidV7)->RangeMultiplier(2)->Range(1, 1 << 12);
+BENCHMARK(GenerateUuidV4String)->RangeMultiplier(8)->Range(1, 1 << 12);
+
+// The generators keep their state in thread-locals, so the throughput per
+// thread should not drop with the number of threads
+BENCHMARK(GenerateUuidV4)->Arg(1 << 10)->ThreadRange(1, 8);
+BENCHMARK(GenerateUuidV7)->Arg(1 << 10)->ThreadRange(1, 8);
 
 USERVER_NAMESPACE_END
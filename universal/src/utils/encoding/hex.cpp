@@ -3,8 +3,12 @@
 #include <stdexcept>
 #include <string_view>
 
-#ifdef __SSSE3__
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
 #include <tmmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
 #endif
 
 USERVER_NAMESPACE_BEGIN
@@ -109,6 +113,35 @@ bool IsXDigit(unsigned char x_digit) noexcept {
 const auto kLow4BitsMask = _mm_set1_epi8(0xf);
 const auto kDigitsMask = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
                                        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+// Signed comparisons are fine for the ASCII ranges, the bytes over 0x7f are
+// negative and are out of any such range
+inline __m128i InRange(__m128i chars, char low, char high) noexcept {
+  return _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(low - 1)),
+                       _mm_cmpgt_epi8(_mm_set1_epi8(high + 1), chars));
+}
+
+struct XDigitValues final {
+  __m128i values;
+  // 0xff for the hex digits, 0 for the other bytes
+  __m128i valid;
+};
+
+inline XDigitValues GetXDigitValues(__m128i chars) noexcept {
+  const auto lowercase = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+  const auto digits = InRange(chars, '0', '9');
+  const auto letters = InRange(lowercase, 'a', 'f');
+  const auto values = _mm_or_si128(
+      _mm_and_si128(digits, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+      _mm_and_si128(letters,
+                    _mm_sub_epi8(lowercase, _mm_set1_epi8('a' - 10))));
+  return {values, _mm_or_si128(digits, letters)};
+}
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+const auto kDigitsTable = vld1q_u8(
+    reinterpret_cast<const uint8_t*>(kXdigits.data()));
 #endif
 
 }  // namespace detail
@@ -116,6 +149,16 @@ const auto kDigitsMask = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
 std::string_view GetHexPart(std::string_view encoded) noexcept {
   const char* ptr = encoded.data();
   const char* last = ptr + encoded.size();
+#ifdef __SSSE3__
+  while (last - ptr >= 16) {
+    const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    // The loop below finds the first non-digit within the block
+    if (_mm_movemask_epi8(detail::GetXDigitValues(chars).valid) != 0xffff) {
+      break;
+    }
+    ptr += 16;
+  }
+#endif
   for (; ptr != last; ptr++) {
     if (!detail::IsXDigit(*ptr)) {
       break;
@@ -138,31 +181,77 @@ void ToHex(std::string_view input, std::string& out) noexcept {
   const auto* last = input.data() + input.size();
   auto* dst = out.data();
 
+#ifdef __AVX2__
+  const auto low_4_bits_mask = _mm256_set1_epi8(0xf);
+  const auto digits_mask = _mm256_broadcastsi128_si256(detail::kDigitsMask);
+  while (last - first >= 32) {
+    const auto data =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    // Same as the SSSE3 loop below, within each 128-bit lane
+    const auto shifted = _mm256_srli_epi64(data, 4);
+    const auto lo = _mm256_shuffle_epi8(
+        digits_mask,
+        _mm256_and_si256(_mm256_unpacklo_epi8(shifted, data),
+                         low_4_bits_mask));
+    const auto hi = _mm256_shuffle_epi8(
+        digits_mask,
+        _mm256_and_si256(_mm256_unpackhi_epi8(shifted, data),
+                         low_4_bits_mask));
+
+    // The unpacks do not cross the lanes, so the halves are reordered
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst),
+                        _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32),
+                        _mm256_permute2x128_si256(lo, hi, 0x31));
+
+    first += 32;
+    dst += 64;
+  }
+#endif
+
 #ifdef __SSSE3__
-  while (last - first >= 8) {
-    // we only take 8 bytes because each byte transforms into 2 bytes
-    // (first digit comes from 4 high bits, second comes from 4 low bits)
-    const auto eight_bytes_of_data = _mm_loadu_si64(first);
+  while (last - first >= 16) {
+    // each byte transforms into 2 bytes (first digit comes from 4 high bits,
+    // second comes from 4 low bits)
+    const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
 
-    // we take the original eight bytes, shift them (as one 64-bits integer)
+    // we take the original bytes, shift them (as 64-bits integers)
     // 4 bits to the right - now we have 4 high bits of each original byte
     // in the lowest 4 bits, with some garbage in higher bits, - combine
-    // the original 8 bytes interleaved with it and mask out
+    // the original bytes interleaved with it and mask out
     // highest 4 bits of each byte. So we get this in the end:
     // h4(b0), l4(b0), h4(b1), l4(b1), ... where h4() is the highest 4 bits,
     // l4() - lowest 4 bits, and b0, b1, ... are the original bytes
-    const auto interleaving_hi_lo =
-        _mm_and_si128(_mm_unpacklo_epi8(_mm_srli_epi64(eight_bytes_of_data, 4),
-                                        eight_bytes_of_data),
-                      detail::kLow4BitsMask);
+    const auto shifted = _mm_srli_epi64(data, 4);
+    const auto interleaving_hi_lo_0 = _mm_and_si128(
+        _mm_unpacklo_epi8(shifted, data), detail::kLow4BitsMask);
+    const auto interleaving_hi_lo_1 = _mm_and_si128(
+        _mm_unpackhi_epi8(shifted, data), detail::kLow4BitsMask);
 
     // and now we gather kXdigits as specified in interleaving_hi_lo
     // and store them into the result
-    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
-                     _mm_shuffle_epi8(detail::kDigitsMask, interleaving_hi_lo));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dst),
+        _mm_shuffle_epi8(detail::kDigitsMask, interleaving_hi_lo_0));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dst + 16),
+        _mm_shuffle_epi8(detail::kDigitsMask, interleaving_hi_lo_1));
 
-    first += 8;
-    dst += 16;
+    first += 16;
+    dst += 32;
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  while (last - first >= 16) {
+    const auto data = vld1q_u8(reinterpret_cast<const uint8_t*>(first));
+    uint8x16x2_t digits;
+    digits.val[0] = vqtbl1q_u8(detail::kDigitsTable, vshrq_n_u8(data, 4));
+    digits.val[1] =
+        vqtbl1q_u8(detail::kDigitsTable, vandq_u8(data, vdupq_n_u8(0xf)));
+    // Stores the high and the low digits interleaved
+    vst2q_u8(reinterpret_cast<uint8_t*>(dst), digits);
+
+    first += 16;
+    dst += 32;
   }
 #endif
 
@@ -190,6 +279,22 @@ size_t FromHex(std::string_view encoded, std::string& out) noexcept {
   const char* first = encoded.data();
   const char* pair_ptr = first;
   const char* last = first + encoded.size();
+#ifdef __SSSE3__
+  while (last - pair_ptr >= 16) {
+    const auto [values, valid] = detail::GetXDigitValues(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pair_ptr)));
+    // The pairs before the first invalid digit are decoded by the loop below
+    if (_mm_movemask_epi8(valid) != 0xffff) break;
+
+    // value of the first digit * 16 + value of the second digit
+    const auto words = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+    alignas(16) char bytes[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(bytes),
+                    _mm_packus_epi16(words, words));
+    out.append(bytes, 8);
+    pair_ptr += 16;
+  }
+#endif
   for (; pair_ptr != last; pair_ptr += 2) {
     if (!detail::IsXDigit(pair_ptr[0])) {
       break;
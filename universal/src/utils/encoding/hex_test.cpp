@@ -104,6 +104,28 @@ TEST(Hex, FromHex) {
   }
 }
 
+TEST(Hex, Long) {
+  // Longer than the SIMD blocks, with the invalid symbols at all positions
+  std::string data;
+  for (int i = 0; i < 100; ++i) data.push_back(static_cast<char>(i * 37));
+  const auto hex = ToHex(data);
+  EXPECT_EQ(hex.substr(0, 8), "00254a6f");
+
+  std::string out;
+  EXPECT_EQ(hex.size(), FromHex(hex, out));
+  EXPECT_EQ(data, out);
+
+  for (std::size_t i = 0; i < 70; ++i) {
+    auto corrupted = hex;
+    corrupted[i] = 'x';
+    EXPECT_EQ(i, GetHexPart(corrupted).size() + i % 2);
+
+    out.clear();
+    EXPECT_EQ(i - i % 2, FromHex(corrupted, out));
+    EXPECT_EQ(data.substr(0, i / 2), out);
+  }
+}
+
 TEST(Hex, GetHexPart) {
   // Test simple case - everything is correct
   {
@@ -28,4 +28,12 @@ BENCHMARK_TEMPLATE(ConstFromString, std::uint32_t)->DenseRange(1, 10, 1);
 BENCHMARK_TEMPLATE(ConstFromString, std::uint16_t)->DenseRange(1, 5, 1);
 BENCHMARK_TEMPLATE(ConstFromString, double)->DenseRange(1, 10, 1);
 
+void PriceFromString(benchmark::State& state) {
+  const std::string str = "12345.67";
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::FromString<double>(str));
+  }
+}
+BENCHMARK(PriceFromString);
+
 USERVER_NAMESPACE_END
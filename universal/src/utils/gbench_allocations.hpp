@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include <benchmark/benchmark.h>
+
+// Counts the heap allocations of the benchmark binaries.
+//
+// The main() of the userver benchmark targets replaces the global operator
+// new with USERVER_GBENCH_COUNT_ALLOCATIONS(), the benchmarks opt into the
+// reporting with utils::bench::AllocationsReporter:
+//
+//   void MyBenchmark(benchmark::State& state) {
+//     const utils::bench::AllocationsReporter allocations_reporter{state};
+//     for ([[maybe_unused]] auto _ : state) { ... }
+//   }
+//
+// The results may be compared across commits with the `compare.py` tool of
+// google-benchmark, e.g. `compare.py benchmarks old.json new.json` for the
+// outputs of `--benchmark_out=<file>.json`.
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::bench {
+
+struct Allocations final {
+  std::uint64_t count{0};
+  std::uint64_t bytes{0};
+};
+
+namespace impl {
+
+inline constexpr std::size_t kAllocationsShardCount = 16;
+
+// Sharded to keep the multithreaded benchmarks from contending on a counter
+struct alignas(128) AllocationsShard final {
+  std::atomic<std::uint64_t> count{0};
+  std::atomic<std::uint64_t> bytes{0};
+};
+
+inline AllocationsShard allocations_shards[kAllocationsShardCount];
+inline std::atomic<bool> is_allocations_counting_enabled{false};
+inline std::atomic<std::size_t> next_allocations_shard{0};
+
+inline void CountAllocation(std::size_t size) noexcept {
+  thread_local const std::size_t shard_index =
+      next_allocations_shard.fetch_add(1, std::memory_order_relaxed) %
+      kAllocationsShardCount;
+  auto& shard = allocations_shards[shard_index];
+  shard.count.fetch_add(1, std::memory_order_relaxed);
+  shard.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+}  // namespace impl
+
+/// Returns false if the binary does not count the allocations
+inline bool IsAllocationsCountingEnabled() noexcept {
+  return impl::is_allocations_counting_enabled.load();
+}
+
+/// Returns the allocations made by all the threads since the start
+inline Allocations GetAllocations() noexcept {
+  Allocations result;
+  for (const auto& shard : impl::allocations_shards) {
+    result.count += shard.count.load(std::memory_order_relaxed);
+    result.bytes += shard.bytes.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+/// Reports the allocations made during its lifetime by all the threads as
+/// the `allocs_per_iter` and `bytes_per_iter` counters. The allocations made
+/// before the benchmark loop are amortized over the iterations.
+///
+/// Not suitable for the `->Threads(n)` benchmarks, as each of their threads
+/// would report the allocations of all the threads.
+class AllocationsReporter final {
+ public:
+  explicit AllocationsReporter(benchmark::State& state) noexcept
+      : state_(state), start_(GetAllocations()) {}
+
+  AllocationsReporter(const AllocationsReporter&) = delete;
+  AllocationsReporter& operator=(const AllocationsReporter&) = delete;
+
+  ~AllocationsReporter() {
+    if (!IsAllocationsCountingEnabled()) return;
+
+    const auto finish = GetAllocations();
+    state_.counters["allocs_per_iter"] =
+        benchmark::Counter(static_cast<double>(finish.count - start_.count),
+                           benchmark::Counter::kAvgIterations);
+    state_.counters["bytes_per_iter"] =
+        benchmark::Counter(static_cast<double>(finish.bytes - start_.bytes),
+                           benchmark::Counter::kAvgIterations);
+  }
+
+ private:
+  benchmark::State& state_;
+  const Allocations start_;
+};
+
+}  // namespace utils::bench
+
+USERVER_NAMESPACE_END
+
+// Replaces the global operator new of the binary with a counting one. Must be
+// used once per binary at the global namespace scope. The matching operator
+// delete is replaced too, for the sanitizers to see the malloc and free
+// pairs. The array forms keep their default implementations, which call the
+// replaced ones.
+// NOLINTBEGIN
+#define USERVER_GBENCH_COUNT_ALLOCATIONS()                                     \
+  [[maybe_unused]] static const bool kUserverGbenchAllocationsCounted = [] {  \
+    USERVER_NAMESPACE::utils::bench::impl::is_allocations_counting_enabled    \
+        .store(true);                                                          \
+    return true;                                                               \
+  }();                                                                         \
+  void* operator new(std::size_t size, const std::nothrow_t&) noexcept {       \
+    USERVER_NAMESPACE::utils::bench::impl::CountAllocation(size);              \
+    return std::malloc(size ? size : 1);                                       \
+  }                                                                            \
+  void* operator new(std::size_t size) {                                       \
+    if (void* result = operator new(size, std::nothrow)) return result;        \
+    throw std::bad_alloc{};                                                    \
+  }                                                                            \
+  void* operator new(std::size_t size, std::align_val_t alignment,             \
+                     const std::nothrow_t&) noexcept {                         \
+    USERVER_NAMESPACE::utils::bench::impl::CountAllocation(size);              \
+    const auto align = static_cast<std::size_t>(alignment);                    \
+    const auto aligned_size =                                                  \
+        ((size ? size : 1) + align - 1) / align * align;                       \
+    return std::aligned_alloc(align, aligned_size);                            \
+  }                                                                            \
+  void* operator new(std::size_t size, std::align_val_t alignment) {           \
+    if (void* result = operator new(size, alignment, std::nothrow)) {          \
+      return result;                                                           \
+    }                                                                          \
+    throw std::bad_alloc{};                                                    \
+  }                                                                            \
+  void operator delete(void* ptr) noexcept { std::free(ptr); }                 \
+  void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }    \
+  void operator delete(void* ptr, std::align_val_t) noexcept {                 \
+    std::free(ptr);                                                            \
+  }                                                                            \
+  void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {    \
+    std::free(ptr);                                                            \
+  }
+// NOLINTEND
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <utils/gbench_allocations.hpp>
+
+// Replays recorded driver traffic in google benchmarks.
+//
+// A trace is a text with a command per line: whitespace separated tokens,
+// the first one is the operation. Tokens may be double quoted with C-style
+// escapes (`\"`, `\\`, `\n`, `\r`, `\t`, `\xHH`), empty lines and lines
+// starting with `#` are skipped. The drivers map the tokens to their requests.
+//
+// The reported counters are the same for all the drivers:
+// * `rps` - completed operations per second;
+// * `p50_us`, `p99_us`, `p99.9_us` - latencies of all the operations;
+// * `<operation>_p50_us`, `<operation>_p99_us` - latencies per operation;
+// * `allocs_per_op` - heap allocations per operation, only reported if the
+//   binary counts them, see utils/gbench_allocations.hpp.
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::bench {
+
+struct TraceRecord final {
+  const std::string& Operation() const { return tokens.front(); }
+
+  std::vector<std::string> tokens;
+};
+
+using Trace = std::vector<TraceRecord>;
+
+namespace impl {
+
+inline bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+inline char ParseHexDigit(char c) {
+  if (c >= '0' && c <= '9') return static_cast<char>(c - '0');
+  if (c >= 'a' && c <= 'f') return static_cast<char>(c - 'a' + 10);
+  if (c >= 'A' && c <= 'F') return static_cast<char>(c - 'A' + 10);
+  throw std::invalid_argument("Invalid hex digit in a trace");
+}
+
+// Parses a quoted token starting at `pos`, advances `pos` past the closing
+// quote
+inline std::string ParseQuotedToken(std::string_view line, std::size_t& pos) {
+  std::string result;
+  for (++pos; pos < line.size(); ++pos) {
+    const char c = line[pos];
+    if (c == '"') {
+      ++pos;
+      return result;
+    }
+    if (c != '\\') {
+      result.push_back(c);
+      continue;
+    }
+
+    if (++pos == line.size()) break;
+    switch (line[pos]) {
+      case 'n':
+        result.push_back('\n');
+        break;
+      case 'r':
+        result.push_back('\r');
+        break;
+      case 't':
+        result.push_back('\t');
+        break;
+      case 'x':
+        if (pos + 2 >= line.size()) {
+          throw std::invalid_argument("Truncated hex escape in a trace");
+        }
+        result.push_back(static_cast<char>(ParseHexDigit(line[pos + 1]) * 16 +
+                                           ParseHexDigit(line[pos + 2])));
+        pos += 2;
+        break;
+      default:
+        result.push_back(line[pos]);
+    }
+  }
+  throw std::invalid_argument("Unterminated quoted token in a trace");
+}
+
+inline double ToMicroseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+// Sorts the latencies
+inline double Percentile(std::vector<std::chrono::steady_clock::duration>& v,
+                         double percentile) {
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  const auto index = static_cast<std::size_t>(
+      percentile / 100 * static_cast<double>(v.size() - 1));
+  return ToMicroseconds(v[index]);
+}
+
+}  // namespace impl
+
+/// Parses a trace, throws std::invalid_argument on malformed lines
+inline Trace ParseTrace(std::string_view text) {
+  Trace result;
+  while (!text.empty()) {
+    const auto line_end = std::min(text.find('\n'), text.size());
+    const auto line = text.substr(0, line_end);
+    text.remove_prefix(std::min(line_end + 1, text.size()));
+
+    TraceRecord record;
+    std::size_t pos = 0;
+    while (true) {
+      while (pos < line.size() && impl::IsSpace(line[pos])) ++pos;
+      if (pos == line.size()) break;
+      if (record.tokens.empty() && line[pos] == '#') break;
+
+      if (line[pos] == '"') {
+        record.tokens.push_back(impl::ParseQuotedToken(line, pos));
+      } else {
+        const auto token_begin = pos;
+        while (pos < line.size() && !impl::IsSpace(line[pos])) ++pos;
+        record.tokens.emplace_back(line.substr(token_begin, pos - token_begin));
+      }
+    }
+    if (!record.tokens.empty()) result.push_back(std::move(record));
+  }
+  return result;
+}
+
+/// Replays the trace in a loop, keeping up to `in_flight` requests started
+/// and waiting for the oldest one. `issue` starts the request of a record and
+/// returns a handle with a blocking `Get()`.
+///
+/// The latency of a request is measured up to the return of its `Get()`, so
+/// with more than one request in flight it includes the head-of-line wait.
+template <typename Issue>
+void Replay(benchmark::State& state, const Trace& trace, std::size_t in_flight,
+            Issue issue) {
+  using Clock = std::chrono::steady_clock;
+  using Request = decltype(issue(trace.front()));
+
+  if (trace.empty()) {
+    state.SkipWithError("Empty trace");
+    return;
+  }
+  in_flight = std::max<std::size_t>(in_flight, 1);
+
+  std::vector<std::string> operations;
+  std::vector<std::size_t> operation_indices;
+  operation_indices.reserve(trace.size());
+  {
+    std::unordered_map<std::string, std::size_t> known_operations;
+    for (const auto& record : trace) {
+      const auto [it, inserted] = known_operations.emplace(
+          record.Operation(), known_operations.size());
+      if (inserted) operations.push_back(record.Operation());
+      operation_indices.push_back(it->second);
+    }
+  }
+
+  struct Pending final {
+    Request request;
+    Clock::time_point start;
+    std::size_t operation_index;
+  };
+  std::deque<Pending> pending;
+  std::vector<std::vector<Clock::duration>> latencies(operations.size());
+  std::size_t completed = 0;
+
+  const auto complete_oldest = [&] {
+    auto& oldest = pending.front();
+    oldest.request.Get();
+    latencies[oldest.operation_index].push_back(Clock::now() - oldest.start);
+    pending.pop_front();
+    ++completed;
+  };
+
+  const auto allocations_before = GetAllocations().count;
+  std::size_t next = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    if (pending.size() == in_flight) complete_oldest();
+
+    const auto& record = trace[next];
+    const auto start = Clock::now();
+    pending.push_back(Pending{issue(record), start, operation_indices[next]});
+    if (++next == trace.size()) next = 0;
+  }
+  while (!pending.empty()) complete_oldest();
+  const auto allocations = GetAllocations().count - allocations_before;
+
+  state.counters["rps"] = benchmark::Counter(static_cast<double>(completed),
+                                             benchmark::Counter::kIsRate);
+  if (IsAllocationsCountingEnabled() && completed != 0) {
+    state.counters["allocs_per_op"] =
+        static_cast<double>(allocations) / static_cast<double>(completed);
+  }
+
+  std::vector<Clock::duration> all_latencies;
+  all_latencies.reserve(completed);
+  for (std::size_t i = 0; i < operations.size(); ++i) {
+    auto& operation_latencies = latencies[i];
+    all_latencies.insert(all_latencies.end(), operation_latencies.begin(),
+                         operation_latencies.end());
+    state.counters[operations[i] + "_p50_us"] =
+        impl::Percentile(operation_latencies, 50);
+    state.counters[operations[i] + "_p99_us"] =
+        impl::Percentile(operation_latencies, 99);
+  }
+  state.counters["p50_us"] = impl::Percentile(all_latencies, 50);
+  state.counters["p99_us"] = impl::Percentile(all_latencies, 99);
+  state.counters["p99.9_us"] = impl::Percentile(all_latencies, 99.9);
+}
+
+}  // namespace utils::bench
+
+USERVER_NAMESPACE_END
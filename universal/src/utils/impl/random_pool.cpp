@@ -0,0 +1,31 @@
+#include <utils/impl/random_pool.hpp>
+
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+namespace {
+
+compiler::ThreadLocal local_random_pool = [] { return RandomPool{}; };
+
+}  // namespace
+
+RandomPool::RandomPool() {
+  auto seed_seq = MakeSeedSeq();
+  gen_.seed(seed_seq);
+}
+
+void RandomPool::Refill() noexcept {
+  for (auto& word : buffer_) word = gen_();
+  pos_ = 0;
+}
+
+compiler::ThreadLocalScope<RandomPool> UseLocalRandomPool() {
+  return local_random_pool.Use();
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
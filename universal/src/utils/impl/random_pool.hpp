@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+#include <userver/compiler/thread_local.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+// Random 64-bit words for the id generators (UUIDs, span ids).
+//
+// The words are generated in bulk, so that taking one is a load from the
+// buffer rather than a virtual utils::RandomBase call per 32 bits. Not
+// cryptographically secure, same as the rest of userver/utils/rand.hpp.
+class RandomPool final {
+ public:
+  RandomPool();
+
+  std::uint64_t Next() noexcept {
+    if (pos_ == buffer_.size()) Refill();
+    return buffer_[pos_++];
+  }
+
+ private:
+  void Refill() noexcept;
+
+  std::mt19937_64 gen_;
+  std::array<std::uint64_t, 64> buffer_{};
+  std::size_t pos_{buffer_.size()};
+};
+
+compiler::ThreadLocalScope<RandomPool> UseLocalRandomPool();
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include <userver/utils/str_icase.hpp>
 
 #include <algorithm>  // for std::min
+#include <cstdint>
+#include <cstring>
 
 #include <userver/compiler/thread_local.hpp>
 #include <userver/utils/rand.hpp>
@@ -20,6 +22,45 @@ static_assert((static_cast<std::size_t>('Z') | kUppercaseToLowerMask) == 'z');
 static_assert((static_cast<std::size_t>('a') | kUppercaseToLowerMask) == 'a');
 static_assert((static_cast<std::size_t>('z') | kUppercaseToLowerMask) == 'z');
 
+// Lowercases 8 ASCII bytes at once, leaving the non-ASCII bytes as is
+constexpr std::uint64_t LowercaseWord(std::uint64_t word) noexcept {
+  constexpr std::uint64_t kOnes = 0x0101010101010101;
+  constexpr std::uint64_t kHighBits = kOnes * 0x80;
+
+  // No carry crosses the bytes: each of the sums is below 0x100
+  const auto heptets = word & ~kHighBits;
+  const auto is_gt_z = heptets + kOnes * (0x7f - 'Z');
+  const auto is_ge_a = heptets + kOnes * (0x80 - 'A');
+  const auto is_upper = (is_ge_a ^ is_gt_z) & ~word & kHighBits;
+
+  // 0x80 >> 2 == kUppercaseToLowerMask
+  return word | (is_upper >> 2);
+}
+
+static_assert(LowercaseWord(0x4041425a5b617a80) == 0x4061627a5b617a80);
+
+inline std::uint64_t LoadWord(const char* data) noexcept {
+  std::uint64_t result{};
+  std::memcpy(&result, data, sizeof(result));
+  return result;
+}
+
+inline int CompareBytes(std::string_view lhs, std::string_view rhs,
+                        std::size_t begin, std::size_t end) noexcept {
+  for (std::size_t i = begin; i < end; ++i) {
+    unsigned char a = lhs[i];
+    unsigned char b = rhs[i];
+
+    if (a == b) continue;
+    if ('A' <= a && a <= 'Z') a |= kUppercaseToLowerMask;
+    if ('A' <= b && b <= 'Z') b |= kUppercaseToLowerMask;
+    if (a == b) continue;
+
+    return static_cast<int>(a) - static_cast<int>(b);
+  }
+  return 0;
+}
+
 compiler::ThreadLocal local_rng = [] {
   auto seed_seq = impl::MakeSeedSeq();
   return std::mt19937{seed_seq};
@@ -60,18 +101,21 @@ std::size_t StrCaseHash::operator()(std::string_view s) const& noexcept {
 int StrIcaseCompareThreeWay::operator()(std::string_view lhs,
                                         std::string_view rhs) const noexcept {
   const auto min_len = std::min(lhs.size(), rhs.size());
-  for (std::size_t i = 0; i < min_len; ++i) {
-    unsigned char a = lhs[i];
-    unsigned char b = rhs[i];
 
-    if (a == b) continue;
-    if ('A' <= a && a <= 'Z') a |= kUppercaseToLowerMask;
-    if ('A' <= b && b <= 'Z') b |= kUppercaseToLowerMask;
-    if (a == b) continue;
+  // Skip the equal prefix 8 bytes at a time, the first different word is
+  // compared bytewise to keep the result independent of the byte order
+  std::size_t i = 0;
+  for (; i + sizeof(std::uint64_t) <= min_len; i += sizeof(std::uint64_t)) {
+    const auto a = LoadWord(lhs.data() + i);
+    const auto b = LoadWord(rhs.data() + i);
+    if (a == b || LowercaseWord(a) == LowercaseWord(b)) continue;
 
-    return static_cast<int>(a) - static_cast<int>(b);
+    return CompareBytes(lhs, rhs, i, i + sizeof(std::uint64_t));
   }
 
+  const auto tail_result = CompareBytes(lhs, rhs, i, min_len);
+  if (tail_result != 0) return tail_result;
+
   if (lhs.size() != rhs.size()) return lhs.size() < rhs.size() ? -1 : 1;
   return 0;
 }
@@ -116,6 +116,20 @@ void CaseInsensitiveCompareDifferentStrings(benchmark::State& state) {
   }
 }
 
+void CaseInsensitiveLessEqualStrings(benchmark::State& state) {
+  const auto len = state.range(0);
+
+  const auto first = GenerateRandomString(len);
+  const auto second = std::string{first};
+  const auto less = utils::StrIcaseLess{};
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < 20; ++i) {
+      benchmark::DoNotOptimize(less(first, second));
+    }
+  }
+}
+
 BENCHMARK(CaseInsensitiveCompareEqualStrings)->DenseRange(1, 31, 3);
 BENCHMARK_TEMPLATE(CaseInsensitiveCompareDifferentStrings, 31)
     ->DenseRange(1, 31, 3);
@@ -123,5 +137,6 @@ BENCHMARK_TEMPLATE(CaseInsensitiveCompareDifferentStrings, 15)
     ->DenseRange(1, 15, 2);
 BENCHMARK_TEMPLATE(CaseInsensitiveCompareDifferentStrings, 7)
     ->DenseRange(1, 7, 1);
+BENCHMARK(CaseInsensitiveLessEqualStrings)->DenseRange(1, 64, 7);
 
 USERVER_NAMESPACE_END
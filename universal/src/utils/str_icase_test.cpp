@@ -110,6 +110,29 @@ TEST(StrIcases, CompareLess) {
                                     std::string_view("ab", 2)));
 }
 
+TEST(StrIcases, CompareThreeWayLong) {
+  const utils::StrIcaseCompareThreeWay cmp{};
+  const std::string_view lhs{"Content-Type-Options"};
+
+  EXPECT_EQ(cmp(lhs, "content-type-options"), 0);
+  EXPECT_EQ(cmp(lhs, "CONTENT-TYPE-OPTIONS"), 0);
+
+  // The difference in the first, the middle and the last 8-byte chunk
+  EXPECT_LT(cmp(lhs, "Dontent-Type-Options"), 0);
+  EXPECT_GT(cmp(lhs, "Content-Typa-Options"), 0);
+  EXPECT_LT(cmp(lhs, "Content-Type-OptionT"), 0);
+
+  // '[' is between 'Z' and 'a', the case folding is done before comparison
+  EXPECT_LT(cmp("Content[", "ContentZ"), 0);
+  EXPECT_LT(cmp("Content[", "Contentz"), 0);
+
+  // Non-ASCII bytes are never folded
+  EXPECT_NE(cmp("Content-\xc1", "Content-\xe1"), 0);
+
+  EXPECT_LT(cmp(lhs, "content-type-options-nosniff"), 0);
+  EXPECT_GT(cmp("content-type-options-nosniff", lhs), 0);
+}
+
 TEST(StrIcases, CompareLessMany) {
   std::vector<std::string> v;
   for (size_t i = 0; i < 26; i++) {
@@ -17,6 +17,7 @@
 #endif
 
 #include <algorithm>
+#include <stdexcept>
 
 #include <fmt/format.h>
 
@@ -79,6 +80,26 @@ void SetCurrentThreadLowPriorityScheduling() {
                       "setting thread scheduling parameters");
 }
 
+void SetCurrentThreadCpuAffinity(const std::vector<std::size_t>& cpus) {
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : cpus) {
+    if (cpu >= CPU_SETSIZE) {
+      throw std::runtime_error(
+          fmt::format("CPU index {} is out of the supported range", cpu));
+    }
+    CPU_SET(cpu, &cpu_set);
+  }
+
+  utils::CheckSyscall(::sched_setaffinity(0, sizeof(cpu_set), &cpu_set),
+                      "setting thread CPU affinity");
+#else
+  (void)cpus;
+  throw std::runtime_error("CPU affinity is not supported on this platform");
+#endif
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/utils/threads.hpp>
 
+#include <sched.h>
 #include <sys/resource.h>
 #include <thread>
 
@@ -28,4 +29,24 @@ TEST(Threads, NotMainThreadLowPriority) {
   EXPECT_EQ(main_priority, ::getpriority(PRIO_PROCESS, 0));
 }
 
+#ifdef __linux__
+TEST(Threads, CpuAffinity) {
+  std::thread another_thread([] {
+    cpu_set_t initial;
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(initial), &initial), 0);
+
+    std::size_t first_allowed_cpu = 0;
+    while (!CPU_ISSET(first_allowed_cpu, &initial)) ++first_allowed_cpu;
+
+    utils::SetCurrentThreadCpuAffinity({first_allowed_cpu});
+
+    cpu_set_t current;
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(current), &current), 0);
+    EXPECT_EQ(CPU_COUNT(&current), 1);
+    EXPECT_TRUE(CPU_ISSET(first_allowed_cpu, &current));
+  });
+  another_thread.join();
+}
+#endif
+
 USERVER_NAMESPACE_END
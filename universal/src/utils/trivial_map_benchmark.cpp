@@ -131,6 +131,33 @@ const auto kHugeUnorderedMapping = std::unordered_map<std::string_view, int>{
     {"aaaaaaaaaaaaaaaa_x9", 42},
 };
 
+constexpr std::string_view kSameLengthKeys[] = {
+    "ad", "ae", "af", "ag", "ai", "al", "am", "ao", "aq", "ar", "as", "at",
+    "au", "aw", "ax", "az", "ba", "bb", "bd", "be", "bf", "bg", "bh", "bi",
+    "bj", "bl", "bm", "bn", "bo", "bq", "br", "bs", "bt", "bv", "bw", "by",
+    "bz", "ca", "cc", "cd", "cf", "cg", "ch", "ci", "ck", "cl", "cm", "cn",
+    "co", "cr", "cu", "cv", "cw", "cx", "cy", "cz", "de", "dj", "dk", "dm",
+    "do", "dz", "ec", "ee",
+};
+
+constexpr int kSameLengthValues[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63,
+};
+
+constexpr auto kSameLengthTrivialBiMap =
+    utils::MakeTrivialBiMap<kSameLengthKeys, kSameLengthValues>();
+
+const auto kSameLengthUnorderedMapping = [] {
+  std::unordered_map<std::string_view, int> result;
+  for (const auto [key, value] : kSameLengthTrivialBiMap) {
+    result.emplace(key, value);
+  }
+  return result;
+}();
+
 enum class Enum1 {
   C1,
   C2,
@@ -447,6 +474,36 @@ void MappingHugeUnorderedLast(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeUnorderedLast);
 
+void MappingSameLengthTrivialBiMap(benchmark::State& state) {
+  auto first = MyLaunder("ad");
+  auto middle = MyLaunder("cc");
+  auto last = MyLaunder("ee");
+  auto missing = MyLaunder("zz");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(kSameLengthTrivialBiMap.TryFind(first));
+    benchmark::DoNotOptimize(kSameLengthTrivialBiMap.TryFind(middle));
+    benchmark::DoNotOptimize(kSameLengthTrivialBiMap.TryFind(last));
+    benchmark::DoNotOptimize(kSameLengthTrivialBiMap.TryFind(missing));
+  }
+}
+BENCHMARK(MappingSameLengthTrivialBiMap);
+
+void MappingSameLengthUnordered(benchmark::State& state) {
+  auto first = MyLaunder("ad");
+  auto middle = MyLaunder("cc");
+  auto last = MyLaunder("ee");
+  auto missing = MyLaunder("zz");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(kSameLengthUnorderedMapping.find(first));
+    benchmark::DoNotOptimize(kSameLengthUnorderedMapping.find(middle));
+    benchmark::DoNotOptimize(kSameLengthUnorderedMapping.find(last));
+    benchmark::DoNotOptimize(kSameLengthUnorderedMapping.find(missing));
+  }
+}
+BENCHMARK(MappingSameLengthUnordered);
+
 void MappingEnumsTrivialBiMap(benchmark::State& state) {
   const auto enum2 = Launder(Enum2::C7);
 
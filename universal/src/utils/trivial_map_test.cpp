@@ -1,5 +1,7 @@
 #include <userver/utils/trivial_map.hpp>
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 USERVER_NAMESPACE_BEGIN
@@ -386,4 +388,129 @@ TEST(TrivialBiMap, Empty) {
   EXPECT_EQ(sum, 0);
 }
 
+// Large enough for the perfect hash lookups
+constexpr utils::TrivialBiMap kCountryCodes = [](auto selector) {
+  return selector()
+      .Case("ad", 0)
+      .Case("ae", 1)
+      .Case("af", 2)
+      .Case("ag", 3)
+      .Case("ai", 4)
+      .Case("al", 5)
+      .Case("am", 6)
+      .Case("ao", 7)
+      .Case("aq", 8)
+      .Case("ar", 9)
+      .Case("as", 10)
+      .Case("at", 11)
+      .Case("au", 12)
+      .Case("aw", 13)
+      .Case("ax", 14)
+      .Case("az", 15)
+      .Case("ba", 16)
+      .Case("bb", 17)
+      .Case("bd", 18)
+      .Case("be", 19)
+      .Case("bf", 20)
+      .Case("bg", 21)
+      .Case("bh", 22)
+      .Case("bi", 23)
+      .Case("bj", 24)
+      .Case("bl", 25)
+      .Case("bm", 26)
+      .Case("bn", 27)
+      .Case("bo", 28)
+      .Case("bq", 29)
+      .Case("br", 30)
+      .Case("bs", 31)
+      .Case("bt", 32)
+      .Case("bv", 33)
+      .Case("bw", 34)
+      .Case("by", 35)
+      .Case("bz", 36)
+      .Case("ca", 37)
+      .Case("cc", 38)
+      .Case("cd", 39)
+      .Case("cf", 40)
+      .Case("cg", 41)
+      .Case("ch", 42)
+      .Case("ci", 43)
+      .Case("ck", 44)
+      .Case("cl", 45)
+      .Case("cm", 46)
+      .Case("cn", 47)
+      .Case("co", 48)
+      .Case("cr", 49)
+      .Case("cu", 50)
+      .Case("cv", 51)
+      .Case("cw", 52)
+      .Case("cx", 53)
+      .Case("cy", 54)
+      .Case("cz", 55)
+      .Case("de", 56)
+      .Case("dj", 57)
+      .Case("dk", 58)
+      .Case("dm", 59)
+      .Case("do", 60)
+      .Case("dz", 61)
+      .Case("ec", 62)
+      .Case("ee", 63)
+      .Case("ad", 100);
+};
+
+TEST(TrivialBiMap, LargeStringMap) {
+  static_assert(kCountryCodes.size() == 65);
+  static_assert(kCountryCodes.TryFind("ad") == 0);
+  static_assert(kCountryCodes.TryFind("ee") == 63);
+  static_assert(kCountryCodes.TryFind("zz") == std::nullopt);
+
+  for (const auto [code, index] : kCountryCodes) {
+    if (index == 100) continue;
+    EXPECT_EQ(kCountryCodes.TryFind(std::string{code}), index) << code;
+    EXPECT_EQ(kCountryCodes.TryFind(index), code);
+  }
+
+  // The first Case of the duplicates wins, as in the constexpr search
+  EXPECT_EQ(kCountryCodes.TryFind(std::string{"ad"}), 0);
+  EXPECT_EQ(kCountryCodes.TryFind(100), "ad");
+
+  EXPECT_EQ(kCountryCodes.TryFind(std::string{"zz"}), std::nullopt);
+  EXPECT_EQ(kCountryCodes.TryFind(std::string{"a"}), std::nullopt);
+  EXPECT_EQ(kCountryCodes.TryFind(std::string{}), std::nullopt);
+  EXPECT_EQ(kCountryCodes.TryFind(std::string{"adad"}), std::nullopt);
+  EXPECT_EQ(kCountryCodes.TryFindICase("AD"), 0);
+}
+
+constexpr std::string_view kCountryCodesKeys[] = {
+    "ad", "ae", "af", "ag", "ai", "al", "am", "ao", "aq", "ar", "as", "at",
+    "au", "aw", "ax", "az", "ba", "bb", "bd", "be", "bf", "bg", "bh", "bi",
+    "bj", "bl", "bm", "bn", "bo", "bq", "br", "bs", "bt", "bv", "bw", "by",
+    "bz", "ca", "cc", "cd", "cf", "cg", "ch", "ci", "ck", "cl", "cm", "cn",
+    "co", "cr", "cu", "cv", "cw", "cx", "cy", "cz", "de", "dj", "dk", "dm",
+    "do", "dz", "ec", "ee",
+};
+
+constexpr int kCountryCodesValues[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63,
+};
+
+TEST(TrivialBiMap, LargeMakeTrivialBiMap) {
+  static constexpr auto kMap =
+      utils::MakeTrivialBiMap<kCountryCodesValues, kCountryCodesKeys>();
+  static constexpr auto kSet = utils::MakeTrivialSet<kCountryCodesKeys>();
+
+  for (const auto [index, code] : kMap) {
+    EXPECT_EQ(kMap.TryFindBySecond(std::string{code}), index);
+    EXPECT_TRUE(kSet.Contains(std::string{code}));
+    EXPECT_EQ(kSet.GetIndex(std::string{code}), index);
+  }
+
+  EXPECT_EQ(kMap.TryFindBySecond("zz"), std::nullopt);
+  EXPECT_FALSE(kSet.Contains("zz"));
+  EXPECT_EQ(kSet.GetIndex("zz"), std::nullopt);
+}
+
 USERVER_NAMESPACE_END
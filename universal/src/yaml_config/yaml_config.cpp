@@ -8,6 +8,7 @@
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/yaml/serialize.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/string_to_duration.hpp>
 #include <userver/utils/text_light.hpp>
 
@@ -15,8 +16,27 @@ USERVER_NAMESPACE_BEGIN
 
 namespace yaml_config {
 
+namespace impl {
+
+struct Members final {
+  std::optional<formats::yaml::Value> value;
+  std::optional<formats::yaml::Value> env;
+  std::optional<formats::yaml::Value> file;
+  std::optional<formats::yaml::Value> fallback;
+};
+
+struct MembersIndex final {
+  utils::impl::TransparentMap<std::string, Members> members;
+};
+
+}  // namespace impl
+
 namespace {
 
+constexpr std::string_view kEnvSuffix = "#env";
+constexpr std::string_view kFileSuffix = "#file";
+constexpr std::string_view kFallbackSuffix = "#fallback";
+
 bool IsSubstitution(const formats::yaml::Value& value) {
   if (!value.IsString()) return false;
   const auto& str = value.As<std::string>();
@@ -28,15 +48,68 @@ std::string GetSubstitutionVarName(const formats::yaml::Value& value) {
 }
 
 std::string GetEnvName(std::string_view str) {
-  return std::string{str} + "#env";
+  return std::string{str}.append(kEnvSuffix);
 }
 
 std::string GetFileName(std::string_view str) {
-  return std::string{str} + "#file";
+  return std::string{str}.append(kFileSuffix);
 }
 
 std::string GetFallbackName(std::string_view str) {
-  return std::string{str} + "#fallback";
+  return std::string{str}.append(kFallbackSuffix);
+}
+
+std::shared_ptr<const impl::MembersIndex> MakeMembersIndex(
+    const formats::yaml::Value& yaml) {
+  if (!yaml.IsObject()) return {};
+
+  auto index = std::make_shared<impl::MembersIndex>();
+  index->members.reserve(yaml.GetSize());
+  for (auto it = yaml.begin(); it != yaml.end(); ++it) {
+    const auto raw_name = it.GetName();
+    std::string_view name = raw_name;
+
+    auto member = &impl::Members::value;
+    if (utils::text::EndsWith(name, kEnvSuffix)) {
+      member = &impl::Members::env;
+      name.remove_suffix(kEnvSuffix.size());
+    } else if (utils::text::EndsWith(name, kFileSuffix)) {
+      member = &impl::Members::file;
+      name.remove_suffix(kFileSuffix.size());
+    } else if (utils::text::EndsWith(name, kFallbackSuffix)) {
+      member = &impl::Members::fallback;
+      name.remove_suffix(kFallbackSuffix.size());
+    }
+
+    auto& slot = index->members[std::string{name}].*member;
+    // The first of the duplicate keys wins, as in the yaml-cpp lookup
+    if (!slot) slot.emplace(*it);
+  }
+  return index;
+}
+
+const impl::Members& LookupMembers(const formats::yaml::Value& yaml,
+                                   const impl::MembersIndex* index,
+                                   std::string_view key,
+                                   impl::Members& buffer) {
+  if (index) {
+    static const impl::Members kNoMembers{};
+    const auto* members =
+        utils::impl::FindTransparentOrNullptr(index->members, key);
+    return members ? *members : kNoMembers;
+  }
+
+  // Not a map: missing or null, or a type mismatch to throw on
+  const auto get = [&yaml](std::string_view name) {
+    auto value = yaml[name];
+    return value.IsMissing() ? std::nullopt
+                             : std::make_optional(std::move(value));
+  };
+  buffer.value = get(key);
+  buffer.env = get(GetEnvName(key));
+  buffer.file = get(GetFileName(key));
+  buffer.fallback = get(GetFallbackName(key));
+  return buffer;
 }
 
 template <typename Field>
@@ -63,15 +136,16 @@ void AssertFileMode(YamlConfig::Mode mode) {
 }
 
 std::optional<formats::yaml::Value> GetFromEnvImpl(
-    const formats::yaml::Value& env_name, YamlConfig::Mode mode) {
-  if (env_name.IsMissing()) {
+    const std::optional<formats::yaml::Value>& env_name,
+    YamlConfig::Mode mode) {
+  if (!env_name) {
     return {};
   }
 
   AssertEnvMode(mode);
 
   // NOLINTNEXTLINE(concurrency-mt-unsafe)
-  const auto* env_value = std::getenv(env_name.As<std::string>().c_str());
+  const auto* env_value = std::getenv(env_name->As<std::string>().c_str());
   if (env_value) {
     return formats::yaml::FromString(env_value);
   }
@@ -80,100 +154,108 @@ std::optional<formats::yaml::Value> GetFromEnvImpl(
 }
 
 std::optional<formats::yaml::Value> GetFromFileImpl(
-    const formats::yaml::Value& file_name, YamlConfig::Mode mode) {
-  if (file_name.IsMissing()) {
+    const std::optional<formats::yaml::Value>& file_name,
+    YamlConfig::Mode mode) {
+  if (!file_name) {
     return {};
   }
 
   AssertFileMode(mode);
-  const auto str_filename = file_name.As<std::string>();
+  const auto str_filename = file_name->As<std::string>();
   if (!boost::filesystem::exists(str_filename)) {
     return {};
   }
   return formats::yaml::blocking::FromFile(str_filename);
 }
 
-std::optional<YamlConfig> GetSharpCommandValue(const formats::yaml::Value& yaml,
+std::optional<YamlConfig> GetSharpCommandValue(const impl::Members& members,
                                                YamlConfig::Mode mode,
                                                std::string_view key,
                                                bool met_substitution) {
-  const auto env_name = yaml[GetEnvName(key)];
-  auto env_value = GetFromEnvImpl(env_name, mode);
+  auto env_value = GetFromEnvImpl(members.env, mode);
   if (env_value) {
     // Strip substitutions off to disallow nested substitutions
     return YamlConfig{std::move(*env_value), {}, YamlConfig::Mode::kSecure};
   }
 
-  const auto file_name = yaml[GetFileName(key)];
-  auto file_value = GetFromFileImpl(file_name, mode);
+  auto file_value = GetFromFileImpl(members.file, mode);
   if (file_value) {
     // Strip substitutions off to disallow nested substitutions
     return YamlConfig{std::move(*file_value), {}, YamlConfig::Mode::kSecure};
   }
 
-  if (met_substitution || !env_name.IsMissing() || !file_name.IsMissing()) {
-    const auto fallback_name = GetFallbackName(key);
-    if (yaml.HasMember(fallback_name)) {
+  if (met_substitution || members.env || members.file) {
+    if (members.fallback) {
       LOG_INFO() << "using fallback value for '" << key << '\'';
       // Strip substitutions off to disallow nested substitutions
-      return YamlConfig{yaml[fallback_name], {}, YamlConfig::Mode::kSecure};
+      return YamlConfig{*members.fallback, {}, YamlConfig::Mode::kSecure};
     }
   }
 
   return {};
 }
 
-std::optional<YamlConfig> GetYamlConfig(const formats::yaml::Value& yaml,
-                                        const formats::yaml::Value& config_vars,
-                                        YamlConfig::Mode mode,
-                                        std::string_view key) {
-  auto value = yaml[key];
+std::optional<YamlConfig> GetSubstitutedConfig(
+    const formats::yaml::Value& value, const formats::yaml::Value& config_vars,
+    const impl::MembersIndex* config_vars_index, YamlConfig::Mode mode) {
+  const auto var_name = GetSubstitutionVarName(value);
 
-  const bool is_substitution = IsSubstitution(value);
-  if (is_substitution) {
-    const auto var_name = GetSubstitutionVarName(value);
-    auto var_data = config_vars[var_name];
-    if (!var_data.IsMissing()) {
-      // Strip substitutions off to disallow nested substitutions
-      return YamlConfig{std::move(var_data), {}, YamlConfig::Mode::kSecure};
-    }
-
-    auto res = GetSharpCommandValue(config_vars, mode, var_name,
-                                    /*met_substitution*/ false);
-    if (res) {
-      return std::move(*res);
-    }
-  }
-
-  if (!value.IsMissing() && !is_substitution) {
-    return YamlConfig{std::move(value), config_vars, mode};
+  impl::Members buffer;
+  const auto& var_members =
+      LookupMembers(config_vars, config_vars_index, var_name, buffer);
+  if (var_members.value) {
+    // Strip substitutions off to disallow nested substitutions
+    return YamlConfig{*var_members.value, {}, YamlConfig::Mode::kSecure};
   }
 
-  return GetSharpCommandValue(yaml, mode, key,
-                              /*met_substitution*/ is_substitution);
+  return GetSharpCommandValue(var_members, mode, var_name,
+                              /*met_substitution*/ false);
 }
 
 }  // namespace
 
 YamlConfig::YamlConfig(formats::yaml::Value yaml,
                        formats::yaml::Value config_vars, Mode mode)
+    : YamlConfig(std::move(yaml), config_vars, MakeMembersIndex(config_vars),
+                 mode) {}
+
+YamlConfig::YamlConfig(
+    formats::yaml::Value yaml, formats::yaml::Value config_vars,
+    std::shared_ptr<const impl::MembersIndex> config_vars_index, Mode mode)
     : yaml_(std::move(yaml)),
       config_vars_(std::move(config_vars)),
-      mode_(mode) {}
+      mode_(mode),
+      index_(MakeMembersIndex(yaml_)),
+      config_vars_index_(std::move(config_vars_index)) {}
 
 const formats::yaml::Value& YamlConfig::Yaml() const { return yaml_; }
 
 YamlConfig YamlConfig::operator[](std::string_view key) const {
-  if (utils::text::EndsWith(key, "#env") ||
-      utils::text::EndsWith(key, "#file") ||
-      utils::text::EndsWith(key, "#fallback")) {
+  if (utils::text::EndsWith(key, kEnvSuffix) ||
+      utils::text::EndsWith(key, kFileSuffix) ||
+      utils::text::EndsWith(key, kFallbackSuffix)) {
     UASSERT_MSG(false, "Do not use names ending on #env, #file and #fallback");
     return MakeMissingConfig(*this, key);
   }
 
-  auto yaml_config = GetYamlConfig(yaml_, config_vars_, mode_, key);
-  if (yaml_config) {
-    return std::move(*yaml_config);
+  impl::Members buffer;
+  const auto& members = LookupMembers(yaml_, index_.get(), key, buffer);
+
+  const bool is_substitution = members.value && IsSubstitution(*members.value);
+  if (is_substitution) {
+    auto res = GetSubstitutedConfig(*members.value, config_vars_,
+                                    config_vars_index_.get(), mode_);
+    if (res) {
+      return std::move(*res);
+    }
+  } else if (members.value) {
+    return YamlConfig{*members.value, config_vars_, config_vars_index_, mode_};
+  }
+
+  auto res = GetSharpCommandValue(members, mode_, key,
+                                  /*met_substitution*/ is_substitution);
+  if (res) {
+    return std::move(*res);
   }
 
   return MakeMissingConfig(*this, key);
@@ -183,16 +265,8 @@ YamlConfig YamlConfig::operator[](size_t index) const {
   auto value = yaml_[index];
 
   if (IsSubstitution(value)) {
-    const auto var_name = GetSubstitutionVarName(value);
-
-    auto var_data = config_vars_[var_name];
-    if (!var_data.IsMissing()) {
-      // Strip substitutions off to disallow nested substitutions
-      return YamlConfig{std::move(var_data), {}, Mode::kSecure};
-    }
-
-    auto res = GetSharpCommandValue(config_vars_, mode_, var_name,
-                                    /*met_substitution*/ false);
+    auto res = GetSubstitutedConfig(value, config_vars_,
+                                    config_vars_index_.get(), mode_);
     if (res) {
       return std::move(*res);
     }
@@ -201,7 +275,7 @@ YamlConfig YamlConfig::operator[](size_t index) const {
     return MakeMissingConfig(*this, index);
   }
 
-  return {std::move(value), config_vars_};
+  return {std::move(value), config_vars_, config_vars_index_, Mode::kSecure};
 }
 
 std::size_t YamlConfig::GetSize() const { return yaml_.GetSize(); }
@@ -243,6 +317,14 @@ void YamlConfig::CheckObjectOrArrayOrNull() const {
 }
 
 bool YamlConfig::HasMember(std::string_view key) const {
+  const bool is_internal_name = utils::text::EndsWith(key, kEnvSuffix) ||
+                                utils::text::EndsWith(key, kFileSuffix) ||
+                                utils::text::EndsWith(key, kFallbackSuffix);
+  if (index_ && !is_internal_name) {
+    const auto* members =
+        utils::impl::FindTransparentOrNullptr(index_->members, key);
+    return members && members->value;
+  }
   return yaml_.HasMember(key);
 }
 
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+yaml_config::YamlConfig MakeComponentConfig(std::size_t members) {
+  std::string yaml = "component:\n";
+  for (std::size_t i = 0; i < members; ++i) {
+    fmt::format_to(std::back_inserter(yaml), "  member_{0}: {0}\n", i);
+  }
+  return {formats::yaml::FromString(yaml), {}};
+}
+
+}  // namespace
+
+// A component constructor reading all of its options and a few missing ones
+void YamlConfigComponentLookups(benchmark::State& state) {
+  const auto members = static_cast<std::size_t>(state.range(0));
+  const auto config = MakeComponentConfig(members);
+
+  std::vector<std::string> keys;
+  for (std::size_t i = 0; i < members; ++i) {
+    keys.push_back(fmt::format("member_{}", i));
+  }
+  keys.emplace_back("missing_1");
+  keys.emplace_back("missing_2");
+
+  for ([[maybe_unused]] auto _ : state) {
+    const auto component_config = config["component"];
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(component_config[key].As<int>(0));
+    }
+  }
+}
+BENCHMARK(YamlConfigComponentLookups)->RangeMultiplier(4)->Range(4, 256);
+
+void YamlConfigIteration(benchmark::State& state) {
+  const auto config =
+      MakeComponentConfig(static_cast<std::size_t>(state.range(0)));
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& member : config["component"]) {
+      benchmark::DoNotOptimize(member.As<int>());
+    }
+  }
+}
+BENCHMARK(YamlConfigIteration)->RangeMultiplier(4)->Range(4, 256);
+
+USERVER_NAMESPACE_END
@@ -627,6 +627,37 @@ TEST(YamlConfig, Subconfig) {
   EXPECT_TRUE(missing_subconf.IsMissing());
 }
 
+TEST(YamlConfig, MembersLookup) {
+  auto vmap = formats::yaml::FromString(R"(
+    var: from-vars
+  )");
+
+  auto node = formats::yaml::FromString(R"(
+    plain: 1
+    substituted: $var
+    missing_var: $no_such_var
+    missing_var#fallback: 2
+    only_fallback#fallback: 3
+    duplicate: 4
+    duplicate: 5
+  )");
+
+  const yaml_config::YamlConfig conf(std::move(node), std::move(vmap));
+  EXPECT_EQ(conf["plain"].As<int>(), 1);
+  EXPECT_EQ(conf["substituted"].As<std::string>(), "from-vars");
+  EXPECT_EQ(conf["missing_var"].As<int>(), 2);
+  EXPECT_EQ(conf["duplicate"].As<int>(), 4);
+
+  // #fallback is only used for substitutions, #env and #file
+  EXPECT_TRUE(conf["only_fallback"].IsMissing());
+  EXPECT_EQ(conf["only_fallback"].GetPath(), "only_fallback");
+
+  EXPECT_TRUE(conf.HasMember("plain"));
+  EXPECT_TRUE(conf.HasMember("missing_var#fallback"));
+  EXPECT_FALSE(conf.HasMember("only_fallback"));
+  EXPECT_FALSE(conf.HasMember("unknown"));
+}
+
 TEST(YamlConfig, SubconfigNotObject) {
   auto vmap = formats::yaml::ValueBuilder(formats::common::Type::kObject)
                   .ExtractValue();
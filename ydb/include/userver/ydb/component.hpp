@@ -39,6 +39,7 @@ class Driver;
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// credentials-provider | name of credentials provider component | -
+/// topic-compression-task-processor | task processor to compress and decompress the topic messages on | native threads of the YDB SDK
 /// operation-settings.retries | default retries count for an operation | 3
 /// operation-settings.operation-timeout | default operation timeout in utils::StringToDuration() format | 1s
 /// operation-settings.cancel-after | cancel operation after specified string in utils::StringToDuration() format | 1s
@@ -56,6 +57,10 @@ class Driver;
 /// databases.<dbname>.sync_start | fail on boot time if YDB is not accessible | true
 /// databases.<dbname>.by-database-timings-buckets-ms | histogram bounds for by-database timing metrics | 40 buckets with +20% increment per step
 /// databases.<dbname>.by-query-timings-buckets-ms | histogram bounds for by-query timing metrics | 15 buckets with +100% increment per step
+/// databases.<dbname>.warmup-sessions | sessions to create at start and to prepare the ydb::TableClient::WarmUpQuery queries on; with sync_start a failure to create them fails the start | 0
+/// databases.<dbname>.session-keep-alive-idle-threshold | idle time after which a pooled session is kept alive by a request | SDK default
+/// databases.<dbname>.session-close-idle-threshold | idle time after which a pooled session above min_pool_size is closed | SDK default
+/// databases.<dbname>.warmup-queries-refresh-interval | interval to prepare the ydb::TableClient::WarmUpQuery queries again, 0 to disable | 0s
 
 // clang-format on
 
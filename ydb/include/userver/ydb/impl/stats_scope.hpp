@@ -25,6 +25,7 @@ class StatsScope final {
   void OnError() noexcept;
   void OnTransportError() noexcept;
   void OnCancelled() noexcept;
+  void OnQueryCacheResult(bool is_from_cache) noexcept;
 
  private:
   explicit StatsScope(StatsCounters&);
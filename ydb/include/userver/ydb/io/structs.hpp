@@ -3,6 +3,7 @@
 #include <ydb-cpp-sdk/client/result/result.h>
 #include <ydb-cpp-sdk/client/value/value.h>
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <optional>
@@ -178,14 +179,24 @@ struct ValueTraits<
 
   template <typename Builder>
   static void Write(NYdb::TValueBuilderBase<Builder>& builder, const T& value) {
+    // Member names are converted once, not for every row of a large list
+    static const auto kYdbFieldNames = MakeYdbFieldNames();
     builder.BeginStruct();
     boost::pfr::for_each_field(value, [&](const auto& field, std::size_t i) {
-      builder.AddMember(impl::ToString(kFieldNames[i]));
+      builder.AddMember(kYdbFieldNames[i]);
       ydb::Write(builder, field);
     });
     builder.EndStruct();
   }
 
+  static std::array<impl::String, kFieldsCount> MakeYdbFieldNames() {
+    std::array<impl::String, kFieldsCount> names;
+    for (std::size_t i = 0; i < kFieldsCount; ++i) {
+      names[i] = impl::ToString(kFieldNames[i]);
+    }
+    return names;
+  }
+
   static NYdb::TType MakeType() {
     NYdb::TTypeBuilder builder;
     builder.BeginStruct();
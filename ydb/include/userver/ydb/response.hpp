@@ -198,6 +198,13 @@ class ReadTableResults final {
 
   std::optional<Cursor> GetNextResult();
 
+  /// @brief Parses the next part of the table to rows of `T`, which must be
+  /// a struct type, see Row::As. Useful to fill a cache chunk by chunk.
+  ///
+  /// @returns std::nullopt when the whole table is read
+  template <typename T>
+  std::optional<std::vector<T>> GetNextChunk();
+
   ReadTableResults(const ReadTableResults&) = delete;
   ReadTableResults(ReadTableResults&&) noexcept = default;
   ReadTableResults& operator=(const ReadTableResults&) = delete;
@@ -230,6 +237,17 @@ class ScanQueryResults final {
   TScanQueryPartIterator iterator_;
 };
 
+template <typename T>
+std::optional<std::vector<T>> ReadTableResults::GetNextChunk() {
+  auto cursor = GetNextResult();
+  if (!cursor.has_value()) return std::nullopt;
+
+  std::vector<T> rows;
+  rows.reserve(cursor->size());
+  for (auto row : *cursor) rows.push_back(std::move(row).As<T>());
+  return rows;
+}
+
 template <typename T>
 T Row::As() && {
   if (&typeid(T) != parse_state_.row_type_id) {
@@ -2,7 +2,14 @@
 
 #include <ydb-cpp-sdk/client/table/table.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
 #include <userver/dynamic_config/source.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/periodic_task.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
 #include <userver/ydb/builder.hpp>
@@ -107,6 +114,15 @@ class TableClient final {
   /// Builder for storing dynamic query params.
   PreparedArgsBuilder GetBuilder() const;
 
+  /// @brief Prepare the data query on the warmed up sessions of the pool, so
+  /// that its first executions do not wait for the query compilation.
+  ///
+  /// The query is remembered and prepared again every
+  /// `warmup-queries-refresh-interval` of the static config, if it is set.
+  /// Hits and misses of the session query cache are reported in the
+  /// `query-cache` metrics of the query.
+  void WarmUpQuery(const Query& query);
+
   /// Efficiently write large ranges of table data.
   void BulkUpsert(std::string_view table, NYdb::TValue&& rows,
                   OperationSettings settings = {});
@@ -123,6 +139,19 @@ class TableClient final {
       NYdb::NTable::TReadTableSettings&& read_settings = {},
       OperationSettings settings = {});
 
+  /// @brief Efficiently read a whole large table: the shards of the table are
+  /// read in parallel, at most `max_parallel_reads` at once.
+  ///
+  /// `func` is called with `std::vector<T>&&` for every part of every shard,
+  /// concurrently from different tasks. `T` must be a struct type matching
+  /// the columns read, see ReadTableResults::GetNextChunk. The key range of
+  /// `read_settings` is replaced by the ranges of the shards.
+  template <typename T, typename Func>
+  void ReadTableByShards(std::string_view table, std::size_t max_parallel_reads,
+                         Func&& func,
+                         NYdb::NTable::TReadTableSettings read_settings = {},
+                         OperationSettings settings = {});
+
   /// @name Scan queries execution
   /// A separate data access interface designed primarily for performing
   /// analytical ad-hoc queries.
@@ -161,8 +190,16 @@ class TableClient final {
 
   std::string JoinDbPath(std::string_view path) const;
 
+  void ReadTableByShardsImpl(
+      std::string_view table, std::size_t max_parallel_reads,
+      const NYdb::NTable::TReadTableSettings& read_settings,
+      const OperationSettings& settings,
+      std::function<void(ReadTableResults&)> read_shard);
+
   void Select1();
 
+  void WarmUp(const std::vector<Query>& queries);
+
   NYdb::NTable::TExecDataQuerySettings ToExecQuerySettings(
       QuerySettings query_settings) const;
 
@@ -187,6 +224,10 @@ class TableClient final {
   std::shared_ptr<impl::Driver> driver_;
   std::unique_ptr<NYdb::NScheme::TSchemeClient> scheme_client_;
   std::unique_ptr<NYdb::NTable::TTableClient> table_client_;
+  const std::uint32_t warmup_sessions_;
+  engine::Mutex warmup_queries_mutex_;
+  std::vector<Query> warmup_queries_;
+  utils::PeriodicTask warmup_task_;
 };
 
 template <typename... Args>
@@ -219,6 +260,19 @@ void TableClient::BulkUpsert(std::string_view table, const RangeOfStructs& rows,
   BulkUpsert(table, builder.Build(), std::move(settings));
 }
 
+template <typename T, typename Func>
+void TableClient::ReadTableByShards(
+    std::string_view table, std::size_t max_parallel_reads, Func&& func,
+    NYdb::NTable::TReadTableSettings read_settings,
+    OperationSettings settings) {
+  ReadTableByShardsImpl(table, max_parallel_reads, read_settings, settings,
+                        [&func](ReadTableResults& results) {
+                          while (auto chunk = results.GetNextChunk<T>()) {
+                            func(std::move(*chunk));
+                          }
+                        });
+}
+
 template <typename... Args>
 ScanQueryResults TableClient::ExecuteScanQuery(const Query& query,
                                                Args&&... args) {
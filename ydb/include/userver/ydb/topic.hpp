@@ -4,8 +4,12 @@
 /// @brief YDB Topic client
 
 #include <chrono>
+#include <cstddef>
+#include <deque>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <ydb-cpp-sdk/client/topic/client.h>
 
@@ -20,6 +24,12 @@ struct TopicSettings;
 
 /// @brief Read session used to connect to one or more topics for reading
 ///
+/// Events are awaited without blocking the task processor threads. If the
+/// `topic-compression-task-processor` static option of ydb::YdbComponent is
+/// set, the received data is decompressed on that task processor.
+///
+/// The session is not thread-safe, use it from a single task.
+///
 /// @see https://ydb.tech/docs/en/reference/ydb-sdk/topic#reading
 ///
 /// ## Example usage:
@@ -39,12 +49,26 @@ class TopicReadSession final {
   /// Waits until event occurs
   /// @param max_events_count maximum events count in batch
   /// if not specified, read session chooses event batch size automatically
+  ///
+  /// The commits scheduled by DeferCommit() are sent before waiting.
   std::vector<NYdb::NTopic::TReadSessionEvent::TEvent> GetEvents(
       std::optional<std::size_t> max_events_count = {});
 
+  /// @brief Schedule a commit of all the messages of the event
+  ///
+  /// The scheduled commits are merged by offset ranges of the partitions, so
+  /// the consecutive events are committed by a single request on the next
+  /// GetEvents() or CommitDeferred() call.
+  void DeferCommit(
+      const NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent& event);
+
+  /// Send the commits scheduled by DeferCommit()
+  void CommitDeferred();
+
   /// @brief Close read session
   ///
-  /// Waits for all commit acknowledgments to arrive.
+  /// Sends the commits scheduled by DeferCommit() and waits for all commit
+  /// acknowledgments to arrive.
   /// Force close after timeout
   bool Close(std::chrono::milliseconds timeout);
 
@@ -56,6 +80,62 @@ class TopicReadSession final {
 
  private:
   std::shared_ptr<NYdb::NTopic::IReadSession> read_session_;
+  std::optional<NYdb::NTopic::TDeferredCommit> deferred_commit_;
+};
+
+/// @brief Write session used to write messages to a topic
+///
+/// The messages are batched by the native session according to the
+/// `BatchFlushInterval` and `BatchFlushSizeBytes` of the settings. Write()
+/// waits without blocking the task processor threads while there are more than
+/// `max_in_flight_bytes` of messages not acknowledged by the server. If the
+/// `topic-compression-task-processor` static option of ydb::YdbComponent is
+/// set, the messages are compressed on that task processor.
+///
+/// The session is not thread-safe, use it from a single task.
+///
+/// @see https://ydb.tech/docs/en/reference/ydb-sdk/topic#write
+class TopicWriteSession final {
+ public:
+  /// @cond
+  // For internal use only.
+  TopicWriteSession(std::shared_ptr<NYdb::NTopic::IWriteSession> write_session,
+                    std::size_t max_in_flight_bytes);
+  /// @endcond
+
+  /// @brief Write the message
+  ///
+  /// Returns as soon as the message is passed to the native session.
+  /// @throws ydb::YdbResponseError if the session is closed
+  void Write(std::string message);
+
+  /// @brief Write the messages, see Write()
+  void WriteBatch(std::vector<std::string> messages);
+
+  /// @brief Wait until all the written messages are acknowledged
+  /// @throws ydb::YdbResponseError if the session is closed
+  void Flush();
+
+  /// @brief Close write session
+  ///
+  /// Waits for the written messages to be sent, force close after timeout
+  bool Close(std::chrono::milliseconds timeout);
+
+  /// Get native write session
+  /// @warning Use with care! Facilities from
+  /// `<core/include/userver/drivers/subscribable_futures.hpp>` can help with
+  /// non-blocking wait operations.
+  std::shared_ptr<NYdb::NTopic::IWriteSession> GetNativeTopicWriteSession();
+
+ private:
+  void HandleEvents();
+
+  std::shared_ptr<NYdb::NTopic::IWriteSession> write_session_;
+  const std::size_t max_in_flight_bytes_;
+  std::optional<NYdb::NTopic::TContinuationToken> continuation_token_;
+  // Not yet acknowledged messages, in the order of writing
+  std::deque<std::string> in_flight_;
+  std::size_t in_flight_bytes_{0};
 };
 
 /// @ingroup userver_clients
@@ -84,6 +164,13 @@ class TopicClient final {
   TopicReadSession CreateReadSession(
       const NYdb::NTopic::TReadSessionSettings& settings);
 
+  /// @brief Create write session
+  /// @param max_in_flight_bytes the amount of not yet acknowledged messages
+  /// at which TopicWriteSession::Write() starts waiting
+  TopicWriteSession CreateWriteSession(
+      const NYdb::NTopic::TWriteSessionSettings& settings,
+      std::size_t max_in_flight_bytes = 16 * 1024 * 1024);
+
   /// Get native topic client
   /// @warning Use with care! Facilities from
   /// `<core/include/userver/drivers/subscribable_futures.hpp>` can help with
@@ -93,6 +180,8 @@ class TopicClient final {
  private:
   std::shared_ptr<impl::Driver> driver_;
   NYdb::NTopic::TTopicClient topic_client_;
+  // Null if the data is (de)compressed by the native executor
+  NYdb::NTopic::IExecutor::TPtr compression_executor_;
 };
 
 }  // namespace ydb
@@ -1,5 +1,7 @@
 #include <userver/ydb/component.hpp>
 
+#include <optional>
+#include <string>
 #include <unordered_set>
 
 #include <boost/range/adaptor/map.hpp>
@@ -48,9 +50,9 @@ struct YdbComponent::DatabaseUtils final {
                        std::shared_ptr<NYdb::ICredentialsProviderFactory>
                            credentials_provider_factory,
                        const OperationSettings& operation_settings,
+                       const impl::TopicSettings& topic_settings,
                        const dynamic_config::Source& config_source) {
     const auto table_settings = impl::ParseTableSettings(dbconfig, dbsettings);
-    const auto topic_settings = impl::TopicSettings{};
     const auto driver_settings = impl::ParseDriverSettings(
         dbconfig, dbsettings, std::move(credentials_provider_factory));
 
@@ -82,6 +84,14 @@ YdbComponent::YdbComponent(const components::ComponentConfig& config,
   const auto operation_settings =
       config["operation-settings"].As<OperationSettings>();
 
+  impl::TopicSettings topic_settings;
+  if (const auto task_processor_name =
+          config["topic-compression-task-processor"]
+              .As<std::optional<std::string>>()) {
+    topic_settings.compression_task_processor =
+        &context.GetTaskProcessor(*task_processor_name);
+  }
+
   const auto dbnames = GetDbNames(config);
 
   for (const auto& dbname : dbnames) {
@@ -103,7 +113,8 @@ YdbComponent::YdbComponent(const components::ComponentConfig& config,
     databases_.emplace(dbname,
                        DatabaseUtils::Make(dbname, dbconfig, dbsettings,
                                            credentials_provider_factory,
-                                           operation_settings, config_source));
+                                           operation_settings, topic_settings,
+                                           config_source));
 
     if (dbconfig.HasMember("aliases")) {
       for (const auto& config_alias : dbconfig["aliases"]) {
@@ -112,7 +123,8 @@ YdbComponent::YdbComponent(const components::ComponentConfig& config,
             dbname_alias,
             DatabaseUtils::Make(dbname_alias, dbconfig, dbsettings,
                                 credentials_provider_factory,
-                                operation_settings, config_source));
+                                operation_settings, topic_settings,
+                                config_source));
       }
     }
   }
@@ -184,6 +196,11 @@ properties:
     credentials-provider:
         type: string
         description: name of credentials provider component
+    topic-compression-task-processor:
+        type: string
+        description: |
+            task processor to compress and decompress the topic messages on,
+            the native threads of the YDB SDK are used if not set
     operation-settings:
         type: object
         description: default operation settings for requests to the database
@@ -279,6 +296,21 @@ properties:
                     items:
                         type: number
                         description: upper bound for an individual bucket
+                warmup-sessions:
+                    type: integer
+                    minimum: 0
+                    defaultDescription: 0
+                    description: sessions to create at start and to prepare queries on
+                session-keep-alive-idle-threshold:
+                    type: string
+                    description: idle time after which a pooled session is kept alive by a request
+                session-close-idle-threshold:
+                    type: string
+                    description: idle time after which an extra pooled session is closed
+                warmup-queries-refresh-interval:
+                    type: string
+                    defaultDescription: 0s
+                    description: interval to prepare the warmed up queries again, 0 to disable
 )");
 }
 
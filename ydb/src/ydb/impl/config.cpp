@@ -47,6 +47,18 @@ TableSettings ParseTableSettings(const yaml_config::YamlConfig& dbconfig,
 
   result.sync_start = dbconfig["sync_start"].As<bool>(result.sync_start);
 
+  result.warmup_sessions =
+      dbconfig["warmup-sessions"].As<std::uint32_t>(result.warmup_sessions);
+  result.keep_alive_idle_threshold =
+      dbconfig["session-keep-alive-idle-threshold"]
+          .As<std::optional<std::chrono::milliseconds>>();
+  result.close_idle_threshold =
+      dbconfig["session-close-idle-threshold"]
+          .As<std::optional<std::chrono::milliseconds>>();
+  result.warmup_queries_refresh_interval =
+      dbconfig["warmup-queries-refresh-interval"].As<std::chrono::milliseconds>(
+          result.warmup_queries_refresh_interval);
+
   result.by_database_timings_buckets =
       dbconfig["by-database-timings-buckets-ms"]
           .As<std::optional<std::vector<double>>>();
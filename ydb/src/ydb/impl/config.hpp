@@ -10,6 +10,7 @@
 #include <ydb-cpp-sdk/client/types/credentials/credentials.h>
 
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
@@ -33,11 +34,18 @@ struct TableSettings {
   std::uint32_t get_session_retry_limit{5};
   bool keep_in_query_cache{true};
   bool sync_start{true};
+  std::uint32_t warmup_sessions{0};
+  std::optional<std::chrono::milliseconds> keep_alive_idle_threshold{};
+  std::optional<std::chrono::milliseconds> close_idle_threshold{};
+  std::chrono::milliseconds warmup_queries_refresh_interval{0};
   std::optional<std::vector<double>> by_database_timings_buckets{};
   std::optional<std::vector<double>> by_query_timings_buckets{};
 };
 
-struct TopicSettings {};
+struct TopicSettings {
+  // If set, the topic sessions compress and decompress the data there
+  engine::TaskProcessor* compression_task_processor{nullptr};
+};
 
 struct DriverSettings {
   std::string endpoint;
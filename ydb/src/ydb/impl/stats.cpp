@@ -51,6 +51,9 @@ void DoDumpMetric(utils::statistics::Writer& writer, const T& stats) {
   writer["timings"] = stats.timings;
 
   writer["cancelled"] = stats.cancelled;
+
+  writer["query-cache"]["hit"] = stats.query_cache_hit;
+  writer["query-cache"]["miss"] = stats.query_cache_miss;
 }
 
 }  // namespace
@@ -76,6 +79,8 @@ void StatsAggregator::Add(const StatsCounters& other) {
   transport_error += other.transport_error.Load();
   timings.Add(other.timings.GetView());
   cancelled += other.cancelled.Load();
+  query_cache_hit += other.query_cache_hit.Load();
+  query_cache_miss += other.query_cache_miss.Load();
 }
 
 void StatsAggregator::Assign(const StatsCounters& other) {
@@ -85,6 +90,8 @@ void StatsAggregator::Assign(const StatsCounters& other) {
   timings.Reset();
   timings.Add(other.timings.GetView());
   cancelled = other.cancelled.Load();
+  query_cache_hit = other.query_cache_hit.Load();
+  query_cache_miss = other.query_cache_miss.Load();
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
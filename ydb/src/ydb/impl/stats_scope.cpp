@@ -77,6 +77,14 @@ void StatsScope::OnTransportError() noexcept { is_transport_error_ = true; }
 
 void StatsScope::OnCancelled() noexcept { is_cancelled_ = true; }
 
+void StatsScope::OnQueryCacheResult(bool is_from_cache) noexcept {
+  if (is_from_cache) {
+    ++stats_.query_cache_hit;
+  } else {
+    ++stats_.query_cache_miss;
+  }
+}
+
 }  // namespace ydb::impl
 
 USERVER_NAMESPACE_END
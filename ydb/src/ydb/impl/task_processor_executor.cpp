@@ -0,0 +1,25 @@
+#include <ydb/impl/task_processor_executor.hpp>
+
+#include <userver/engine/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb::impl {
+
+TaskProcessorExecutor::TaskProcessorExecutor(
+    engine::TaskProcessor& task_processor)
+    : task_processor_(task_processor) {}
+
+bool TaskProcessorExecutor::IsAsync() const { return true; }
+
+void TaskProcessorExecutor::Post(TFunction&& f) {
+  // The session waits for the posted functions itself, and it must not lose
+  // decompressed data because of a task cancellation
+  engine::CriticalAsyncNoSpan(task_processor_, std::move(f)).Detach();
+}
+
+void TaskProcessorExecutor::DoStart() {}
+
+}  // namespace ydb::impl
+
+USERVER_NAMESPACE_END
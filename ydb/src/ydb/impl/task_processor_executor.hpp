@@ -0,0 +1,30 @@
+#pragma once
+
+#include <ydb-cpp-sdk/client/topic/client.h>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb::impl {
+
+// Runs the functions posted by the native topic sessions (e.g. the data
+// decompression) as tasks of a userver task processor
+class TaskProcessorExecutor final : public NYdb::NTopic::IExecutor {
+ public:
+  explicit TaskProcessorExecutor(engine::TaskProcessor& task_processor);
+
+  bool IsAsync() const override;
+
+  // May be called from the native threads of the SDK
+  void Post(TFunction&& f) override;
+
+ private:
+  void DoStart() override;
+
+  engine::TaskProcessor& task_processor_;
+};
+
+}  // namespace ydb::impl
+
+USERVER_NAMESPACE_END
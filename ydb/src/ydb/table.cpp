@@ -1,8 +1,18 @@
 #include <userver/ydb/table.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+
+#include <fmt/format.h>
+
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/statistics/writer.hpp>
 #include <userver/ydb/impl/cast.hpp>
 
@@ -48,11 +58,19 @@ TableClient::TableClient(impl::TableSettings settings,
           settings.by_query_timings_buckets
               ? utils::span{*settings.by_query_timings_buckets}
               : impl::kDefaultPerQueryBounds)),
-      driver_(std::move(driver)) {
+      driver_(std::move(driver)),
+      warmup_sessions_(std::min(settings.warmup_sessions,
+                                settings.max_pool_size)) {
   NYdb::NTable::TSessionPoolSettings session_config;
   session_config.MaxActiveSessions(settings.max_pool_size)
       .MinPoolSize(settings.min_pool_size);
   session_config.RetryLimit(settings.get_session_retry_limit);
+  if (settings.keep_alive_idle_threshold) {
+    session_config.KeepAliveIdleThreshold(*settings.keep_alive_idle_threshold);
+  }
+  if (settings.close_idle_threshold) {
+    session_config.CloseIdleThreshold(*settings.close_idle_threshold);
+  }
 
   NYdb::NTable::TClientSettings client_config;
   client_config.SessionPoolSettings(session_config);
@@ -66,9 +84,33 @@ TableClient::TableClient(impl::TableSettings settings,
                 << driver_->GetDbName() << "'";
     Select1();
   }
+
+  if (warmup_sessions_ > 0) {
+    try {
+      WarmUp({});
+    } catch (const std::exception& ex) {
+      if (settings.sync_start) throw;
+      LOG_WARNING() << "Failed to warm up the session pool of ydb client "
+                    << "with name '" << driver_->GetDbName() << "': " << ex;
+    }
+  }
+
+  if (settings.warmup_queries_refresh_interval.count() > 0) {
+    warmup_task_.Start(
+        fmt::format("ydb-warmup-{}", driver_->GetDbName()),
+        {settings.warmup_queries_refresh_interval}, [this] {
+          std::vector<Query> queries;
+          {
+            const std::lock_guard lock{warmup_queries_mutex_};
+            queries = warmup_queries_;
+          }
+          if (!queries.empty()) WarmUp(queries);
+        });
+  }
 }
 
 TableClient::~TableClient() {
+  warmup_task_.Stop();
   try {
     impl::GetFutureValue(table_client_->Stop());
   } catch (const std::exception& ex) {
@@ -135,6 +177,48 @@ ReadTableResults TableClient::ReadTable(
       impl::GetFutureValueChecked(std::move(future), "ReadTable", context)};
 }
 
+void TableClient::ReadTableByShardsImpl(
+    std::string_view table, std::size_t max_parallel_reads,
+    const NYdb::NTable::TReadTableSettings& read_settings,
+    const OperationSettings& settings,
+    std::function<void(ReadTableResults&)> read_shard) {
+  UINVARIANT(max_parallel_reads > 0, "max_parallel_reads is set to zero");
+
+  using DescribeSettings = NYdb::NTable::TDescribeTableSettings;
+  const auto description = ExecuteWithPathImpl<DescribeSettings>(
+      table, "DescribeTable", /*settings=*/{},
+      [](NYdb::NTable::TSession session, const std::string& full_path,
+         const DescribeSettings& settings) {
+        auto shards_settings = settings;
+        shards_settings.WithKeyShardBoundary(true);
+        return session.DescribeTable(impl::ToString(full_path),
+                                     shards_settings);
+      });
+  auto key_ranges = description.GetTableDescription().GetKeyRanges();
+  if (key_ranges.empty()) key_ranges.emplace_back(std::nullopt, std::nullopt);
+
+  engine::Semaphore semaphore{max_parallel_reads};
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(key_ranges.size());
+  for (const auto& key_range : key_ranges) {
+    auto shard_settings = read_settings;
+    shard_settings.From_ = key_range.From();
+    shard_settings.To_ = key_range.To();
+
+    tasks.push_back(utils::Async(
+        "ydb_read_table_shard",
+        [this, table, &settings, &read_shard, &semaphore,
+         shard_settings = std::move(shard_settings)]() mutable {
+          const std::shared_lock lock{semaphore};
+          auto results = ReadTable(table, std::move(shard_settings), settings);
+          read_shard(results);
+        }));
+  }
+
+  // On the first failure the rest of the tasks are cancelled in destructors
+  for (auto& task : tasks) task.Get();
+}
+
 ScanQueryResults TableClient::ExecuteScanQuery(
     ScanQuerySettings&& scan_settings, OperationSettings settings,
     const Query& query, PreparedArgsBuilder&& builder) {
@@ -154,6 +238,51 @@ ScanQueryResults TableClient::ExecuteScanQuery(
       std::move(future), "ExecuteScanQuery", context)};
 }
 
+void TableClient::WarmUpQuery(const Query& query) {
+  {
+    const std::lock_guard lock{warmup_queries_mutex_};
+    const auto it = std::find_if(
+        warmup_queries_.begin(), warmup_queries_.end(),
+        [&query](const Query& other) {
+          return other.Statement() == query.Statement();
+        });
+    if (it == warmup_queries_.end()) warmup_queries_.push_back(query);
+  }
+  WarmUp({query});
+}
+
+void TableClient::WarmUp(const std::vector<Query>& queries) {
+  // Holding the sessions at once makes the pool create that many of them
+  std::vector<NYdb::NTable::TAsyncCreateSessionResult> session_futures;
+  const auto sessions_count = std::max<std::uint32_t>(warmup_sessions_, 1);
+  session_futures.reserve(sessions_count);
+  for (std::uint32_t i = 0; i < sessions_count; ++i) {
+    session_futures.push_back(table_client_->GetSession());
+  }
+
+  std::vector<NYdb::NTable::TSession> sessions;
+  sessions.reserve(sessions_count);
+  for (auto& future : session_futures) {
+    sessions.push_back(
+        impl::GetFutureValueChecked(std::move(future), "GetSession")
+            .GetSession());
+  }
+
+  // Prepared queries are compiled by the server and stored in the query
+  // cache of the session, the executions of the same query text reuse them
+  std::vector<NYdb::NTable::TAsyncPrepareQueryResult> prepare_futures;
+  prepare_futures.reserve(sessions.size() * queries.size());
+  for (auto& session : sessions) {
+    for (const auto& query : queries) {
+      prepare_futures.push_back(
+          session.PrepareDataQuery(impl::ToString(query.Statement())));
+    }
+  }
+  for (auto& future : prepare_futures) {
+    impl::GetFutureValueChecked(std::move(future), "PrepareDataQuery");
+  }
+}
+
 void TableClient::Select1() {
   const auto response = ExecuteDataQuery(Query("SELECT 1"))
                             .GetSingleCursor()
@@ -324,8 +453,10 @@ ExecuteResponse TableClient::ExecuteDataQuery(QuerySettings query_settings,
                                         exec_settings);
       });
 
-  return ExecuteResponse{impl::GetFutureValueChecked(
-      std::move(future), "ExecuteDataQuery", context)};
+  auto status = impl::GetFutureValueChecked(std::move(future),
+                                            "ExecuteDataQuery", context);
+  context.stats_scope.OnQueryCacheResult(status.IsQueryFromCache());
+  return ExecuteResponse{std::move(status)};
 }
 
 std::string TableClient::JoinDbPath(std::string_view path) const {
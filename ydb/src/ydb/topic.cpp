@@ -1,11 +1,17 @@
 #include <userver/ydb/topic.hpp>
 
+#include <utility>
+#include <variant>
+
 #include <userver/engine/async.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/ydb/exceptions.hpp>
 #include <userver/ydb/impl/cast.hpp>
 
 #include <ydb/impl/config.hpp>
 #include <ydb/impl/driver.hpp>
 #include <ydb/impl/future.hpp>
+#include <ydb/impl/task_processor_executor.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,6 +25,7 @@ TopicReadSession::TopicReadSession(
 
 std::vector<NYdb::NTopic::TReadSessionEvent::TEvent>
 TopicReadSession::GetEvents(std::optional<std::size_t> max_events_count) {
+  CommitDeferred();
   impl::GetFutureValue(read_session_->WaitEvent());
   if (max_events_count.has_value()) {
     return read_session_->GetEvents(false, *max_events_count);
@@ -27,7 +34,20 @@ TopicReadSession::GetEvents(std::optional<std::size_t> max_events_count) {
   }
 }
 
+void TopicReadSession::DeferCommit(
+    const NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent& event) {
+  if (!deferred_commit_.has_value()) deferred_commit_.emplace();
+  deferred_commit_->Add(event);
+}
+
+void TopicReadSession::CommitDeferred() {
+  if (!deferred_commit_.has_value()) return;
+  deferred_commit_->Commit();
+  deferred_commit_.reset();
+}
+
 bool TopicReadSession::Close(std::chrono::milliseconds timeout) {
+  CommitDeferred();
   return read_session_->Close(timeout);
 }
 
@@ -36,9 +56,81 @@ TopicReadSession::GetNativeTopicReadSession() {
   return read_session_;
 }
 
+TopicWriteSession::TopicWriteSession(
+    std::shared_ptr<NYdb::NTopic::IWriteSession> write_session,
+    std::size_t max_in_flight_bytes)
+    : write_session_(std::move(write_session)),
+      max_in_flight_bytes_(max_in_flight_bytes) {
+  UASSERT(write_session_);
+}
+
+void TopicWriteSession::Write(std::string message) {
+  // A message larger than the limit is still written when nothing is in flight
+  while (!continuation_token_.has_value() ||
+         (in_flight_bytes_ != 0 &&
+          in_flight_bytes_ + message.size() > max_in_flight_bytes_)) {
+    HandleEvents();
+  }
+
+  in_flight_bytes_ += message.size();
+  // The data stays alive until it is acknowledged
+  const auto& data = in_flight_.emplace_back(std::move(message));
+  auto token = std::move(*continuation_token_);
+  continuation_token_.reset();
+  write_session_->Write(std::move(token), NYdb::NTopic::TWriteMessage{data});
+}
+
+void TopicWriteSession::WriteBatch(std::vector<std::string> messages) {
+  for (auto& message : messages) Write(std::move(message));
+}
+
+void TopicWriteSession::Flush() {
+  while (!in_flight_.empty()) HandleEvents();
+}
+
+bool TopicWriteSession::Close(std::chrono::milliseconds timeout) {
+  return write_session_->Close(timeout);
+}
+
+std::shared_ptr<NYdb::NTopic::IWriteSession>
+TopicWriteSession::GetNativeTopicWriteSession() {
+  return write_session_;
+}
+
+void TopicWriteSession::HandleEvents() {
+  using TWriteSessionEvent = NYdb::NTopic::TWriteSessionEvent;
+
+  impl::GetFutureValue(write_session_->WaitEvent());
+  for (auto& event : write_session_->GetEvents(false)) {
+    std::visit(
+        utils::Overloaded{
+            [this](TWriteSessionEvent::TReadyToAcceptEvent& e) {
+              continuation_token_.emplace(std::move(e.ContinuationToken));
+            },
+            [this](TWriteSessionEvent::TAcksEvent& e) {
+              // Acks arrive in the order of writing
+              for (std::size_t i = 0; i < e.Acks.size() && !in_flight_.empty();
+                   ++i) {
+                in_flight_bytes_ -= in_flight_.front().size();
+                in_flight_.pop_front();
+              }
+            },
+            [](NYdb::NTopic::TSessionClosedEvent& e) {
+              throw YdbResponseError{"TopicWriteSession", std::move(e)};
+            },
+        },
+        event);
+  }
+}
+
 TopicClient::TopicClient(std::shared_ptr<impl::Driver> driver,
-                         [[maybe_unused]] impl::TopicSettings settings)
-    : driver_{std::move(driver)}, topic_client_{driver_->GetNativeDriver()} {}
+                         impl::TopicSettings settings)
+    : driver_{std::move(driver)}, topic_client_{driver_->GetNativeDriver()} {
+  if (settings.compression_task_processor) {
+    compression_executor_ = NYdb::NTopic::IExecutor::TPtr{
+        new impl::TaskProcessorExecutor{*settings.compression_task_processor}};
+  }
+}
 
 TopicClient::~TopicClient() = default;
 
@@ -57,7 +149,25 @@ NYdb::NTopic::TDescribeTopicResult TopicClient::DescribeTopic(
 
 TopicReadSession TopicClient::CreateReadSession(
     const NYdb::NTopic::TReadSessionSettings& settings) {
-  return TopicReadSession{topic_client_.CreateReadSession(settings)};
+  if (!compression_executor_ || settings.DecompressionExecutor_) {
+    return TopicReadSession{topic_client_.CreateReadSession(settings)};
+  }
+  auto settings_copy = settings;
+  settings_copy.DecompressionExecutor(compression_executor_);
+  return TopicReadSession{topic_client_.CreateReadSession(settings_copy)};
+}
+
+TopicWriteSession TopicClient::CreateWriteSession(
+    const NYdb::NTopic::TWriteSessionSettings& settings,
+    std::size_t max_in_flight_bytes) {
+  if (!compression_executor_ || settings.CompressionExecutor_) {
+    return TopicWriteSession{topic_client_.CreateWriteSession(settings),
+                             max_in_flight_bytes};
+  }
+  auto settings_copy = settings;
+  settings_copy.CompressionExecutor(compression_executor_);
+  return TopicWriteSession{topic_client_.CreateWriteSession(settings_copy),
+                           max_in_flight_bytes};
 }
 
 NYdb::NTopic::TTopicClient& TopicClient::GetNativeTopicClient() {
@@ -155,6 +155,7 @@ ExecuteResponse Transaction::Execute(QuerySettings query_settings,
   auto status = impl::GetFutureValueChecked(
       std::move(execute_fut), "Transaction::Execute",
       table_client_.driver_->GetRetryBudget(), context);
+  context.stats_scope.OnQueryCacheResult(status.IsQueryFromCache());
 
   error_guard.Release();
   return ExecuteResponse(std::move(status));
@@ -1,6 +1,12 @@
+#include <algorithm>
 #include <chrono>
+#include <mutex>
 #include <thread>
+#include <vector>
 
+#include <boost/pfr/ops_fields.hpp>
+
+#include <userver/engine/mutex.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/enumerate.hpp>
 #include <userver/ydb/exceptions.hpp>
@@ -116,6 +122,25 @@ UTEST_F(YdbExecute, SimpleMultiCursorRead) {
   }
 }
 
+UTEST_F(YdbExecute, WarmedUpQuery) {
+  CreateTable("warmed_up_read", true);
+
+  const ydb::Query query{R"(
+        DECLARE $search_key AS String;
+
+        SELECT key, value_str
+        FROM warmed_up_read
+        WHERE key = $search_key;
+    )"};
+  UASSERT_NO_THROW(GetTableClient().WarmUpQuery(query));
+
+  auto builder = GetTableClient().GetBuilder();
+  builder.Add("$search_key", std::string{"key2"});
+  auto response = GetTableClient().ExecuteDataQuery(
+      ydb::OperationSettings{}, query, std::move(builder));
+  AssertArePreFilledRows(response.GetSingleCursor(), {2});
+}
+
 UTEST_F(YdbExecute, PreparedRead) {
   CreateTable("prepared_read", true);
 
@@ -386,6 +411,53 @@ UTEST_F(YdbExecute, ReadTable) {
   EXPECT_FALSE(results.GetNextResult().has_value());
 }
 
+UTEST_F(YdbExecute, ReadTableChunks) {
+  CreateTable("read_table_chunks", true);
+
+  auto settings = NYdb::NTable::TReadTableSettings{}
+                      .Ordered()
+                      .AppendColumns("key")
+                      .AppendColumns("value_str")
+                      .AppendColumns("value_int");
+  auto results =
+      GetTableClient().ReadTable("read_table_chunks", std::move(settings));
+
+  std::vector<tests::RowValue> rows;
+  while (auto chunk = results.GetNextChunk<tests::RowValue>()) {
+    rows.insert(rows.end(), chunk->begin(), chunk->end());
+  }
+  ASSERT_EQ(rows.size(), kPreFilledRows.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    EXPECT_TRUE(boost::pfr::eq_fields(rows[i], kPreFilledRows[i]));
+  }
+}
+
+UTEST_F_MT(YdbExecute, ReadTableByShards, 2) {
+  CreateTable("read_table_by_shards", true);
+
+  auto settings = NYdb::NTable::TReadTableSettings{}
+                      .AppendColumns("key")
+                      .AppendColumns("value_str")
+                      .AppendColumns("value_int");
+  engine::Mutex mutex;
+  std::vector<tests::RowValue> rows;
+  GetTableClient().ReadTableByShards<tests::RowValue>(
+      "read_table_by_shards", 2,
+      [&](std::vector<tests::RowValue>&& chunk) {
+        const std::lock_guard lock{mutex};
+        rows.insert(rows.end(), chunk.begin(), chunk.end());
+      },
+      std::move(settings));
+
+  std::sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.key < rhs.key;
+  });
+  ASSERT_EQ(rows.size(), kPreFilledRows.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    EXPECT_TRUE(boost::pfr::eq_fields(rows[i], kPreFilledRows[i]));
+  }
+}
+
 UTEST_F(YdbExecute, IsQueryFromCache) {
   CreateTable("test_table", true);
 
@@ -1,5 +1,8 @@
 #include <userver/utest/utest.hpp>
 
+#include <string>
+#include <vector>
+
 #include <userver/engine/async.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/ydb/impl/cast.hpp>
@@ -14,6 +17,7 @@ constexpr std::string_view kTable = "test_table";
 constexpr std::string_view kChangefeed = "test_changefeed";
 const std::string kTopicPath = fmt::format("{}/{}", kTable, kChangefeed);
 constexpr std::string_view kConsumerName = "test_consumer";
+constexpr std::string_view kWriteTopicPath = "test_write_topic";
 
 class YdbTopicFixture : public ydb::ClientFixtureBase {
  protected:
@@ -149,6 +153,71 @@ UTEST_F(YdbTopicFixture, TopicReadSessionGetEvents) {
   DropConsumer(kTopicPath, kConsumerName);
 }
 
+UTEST_F(YdbTopicFixture, TopicWriteSessionWriteRead) {
+  const auto create_status =
+      GetNativeTopicClient()
+          .CreateTopic(ydb::impl::ToString(kWriteTopicPath))
+          .GetValueSync();
+  ASSERT_TRUE(create_status.IsSuccess())
+      << "CreateTopic failed: " + create_status.GetIssues().ToString();
+  AddConsumer(kWriteTopicPath, kConsumerName);
+
+  constexpr std::size_t kMessagesCount = 50;
+  std::vector<std::string> messages;
+  for (std::size_t i = 0; i < kMessagesCount; ++i) {
+    messages.push_back(fmt::format("message-{}", i));
+  }
+
+  NYdb::NTopic::TWriteSessionSettings write_session_settings;
+  write_session_settings.Path(ydb::impl::ToString(kWriteTopicPath));
+  write_session_settings.ProducerId("test_producer");
+  write_session_settings.MessageGroupId("test_producer");
+  // Less than the size of all the messages, so that Write has to wait
+  auto write_session =
+      GetTopicClient().CreateWriteSession(write_session_settings, 100);
+  UASSERT_NO_THROW(write_session.WriteBatch(messages));
+  UASSERT_NO_THROW(write_session.Flush());
+  write_session.Close(std::chrono::milliseconds{1000});
+
+  auto read_session = CreateReadSession(kWriteTopicPath, kConsumerName);
+  std::vector<std::string> received;
+  while (received.size() < kMessagesCount) {
+    std::vector<NYdb::NTopic::TReadSessionEvent::TEvent> events;
+    auto task = engine::AsyncNoSpan([&events, &read_session] {
+      UASSERT_NO_THROW(events = read_session.GetEvents());
+    });
+    task.WaitFor(utest::kMaxTestWaitTime);
+    ASSERT_TRUE(task.IsFinished());
+
+    for (auto& event : events) {
+      std::visit(
+          utils::Overloaded{
+              [&received, &read_session](
+                  NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent& e) {
+                for (const auto& message : e.GetMessages()) {
+                  received.emplace_back(message.GetData());
+                }
+                read_session.DeferCommit(e);
+              },
+              [](NYdb::NTopic::TReadSessionEvent::TStartPartitionSessionEvent&
+                     e) { e.Confirm(); },
+              [](NYdb::NTopic::TReadSessionEvent::TStopPartitionSessionEvent&
+                     e) { e.Confirm(); },
+              []([[maybe_unused]] auto& e) {
+                // do nothing
+              }},
+          event);
+    }
+  }
+  EXPECT_EQ(received, messages);
+
+  read_session.Close(std::chrono::milliseconds{1000});
+  DropConsumer(kWriteTopicPath, kConsumerName);
+  GetNativeTopicClient()
+      .DropTopic(ydb::impl::ToString(kWriteTopicPath))
+      .GetValueSync();
+}
+
 UTEST_F(YdbTopicFixture, AlterTopic) {
   constexpr std::string_view consumer_name = "another_test_consumer";
 